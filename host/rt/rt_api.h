@@ -0,0 +1,359 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        rt_api.h
+ * Description:  host replacement of the PULP runtime
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: host (x86)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __PLP_HOST_RT_API_H__
+#define __PLP_HOST_RT_API_H__
+
+// Host replacement of the PULP runtime, used by `make host` to build the library (and the tests)
+// with the compiler of the host. It provides the part of the runtime which the library uses:
+//
+// - The caller starts on the fabric controller (rt_cluster_id() == ARCHI_FC_CID), such that the
+//   glue code runs the RV32IM kernels. rt_cluster_call runs the entry as core 0 of the cluster,
+//   which then runs the XPULPV2 kernels with the builtins below.
+// - rt_team_fork runs the entry on nb_cores threads, the caller being core 0, and
+//   rt_team_barrier synchronizes them.
+// - rt_cluster_call with an event returns immediately, and rt_event_wait waits for the call.
+//   There are ARCHI_NB_CLUSTER clusters, which run concurrently.
+// - L1 and L2 are both the heap of the host, and the DMA copies with memcpy.
+// - The performance counters count nanoseconds instead of cycles (RT_PERF_CYCLES and
+//   RT_PERF_ACTIVE_CYCLES), all other events read 0, and rt_freq_get returns 1 GHz.
+//
+// The library assumes 32-bit pointers (e.g. the addresses of the DMA), so the host build uses -m32.
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARCHI_FC_CID 32
+#define ARCHI_CLUSTER_NB_PE 8
+#define ARCHI_NB_CLUSTER 4
+
+// no memory placement on the host
+#define RT_L1_DATA
+#define RT_L2_DATA
+#define RT_CL_DATA
+#define RT_FC_DATA
+#define RT_FC_GLOBAL_DATA
+#define RT_LOCAL_DATA
+
+/*
+ * Cores and teams
+ */
+
+extern __thread int plp_host_core_id;
+extern __thread int plp_host_cluster_id;
+
+static inline int rt_core_id(void) {
+    return plp_host_core_id;
+}
+
+static inline int rt_cluster_id(void) {
+    return plp_host_cluster_id;
+}
+
+static inline int rt_nb_pe(void) {
+    return ARCHI_CLUSTER_NB_PE;
+}
+
+void rt_team_fork(int nb_cores, void (*entry)(void *), void *arg);
+void rt_team_barrier(void);
+
+// A cluster call with an event runs on a separate thread, which is joined by rt_event_wait. The
+// calls to the same cluster are serialized, as on PULP.
+typedef struct rt_cluster_call_s {
+    int cid;
+    void (*entry)(void *arg);
+    void *arg;
+} rt_cluster_call_t;
+
+typedef struct rt_event_s {
+    pthread_t thread;
+    int pending;
+    rt_cluster_call_t call; // used if the caller passes no call
+} rt_event_t;
+
+static inline int rt_event_alloc(void *sched, int nb_events) {
+    (void)sched;
+    (void)nb_events;
+    return 0;
+}
+
+rt_event_t *rt_event_get_blocking(void *sched);
+void rt_event_wait(rt_event_t *event);
+
+void rt_cluster_mount(int mount, int cid, int flags, rt_event_t *event);
+int rt_cluster_call(rt_cluster_call_t *call,
+                    int cid,
+                    void (*entry)(void *arg),
+                    void *arg,
+                    void *stacks,
+                    int master_stack_size,
+                    int slave_stack_size,
+                    int nb_pe,
+                    rt_event_t *event);
+
+/*
+ * Memory allocation
+ */
+
+typedef enum {
+    RT_ALLOC_FC_CODE = 0,
+    RT_ALLOC_FC_DATA = 1,
+    RT_ALLOC_FC_RET_DATA = 2,
+    RT_ALLOC_CL_CODE = 3,
+    RT_ALLOC_CL_DATA = 4,
+    RT_ALLOC_L2_CL_DATA = 5,
+    RT_ALLOC_PERIPH = 6,
+} rt_alloc_e;
+
+static inline void *rt_alloc(rt_alloc_e flags, int size) {
+    (void)flags;
+    return malloc(size);
+}
+
+static inline void rt_free(rt_alloc_e flags, void *chunk, int size) {
+    (void)flags;
+    (void)size;
+    free(chunk);
+}
+
+/*
+ * DMA
+ */
+
+typedef enum {
+    RT_DMA_DIR_LOC2EXT = 0,
+    RT_DMA_DIR_EXT2LOC = 1,
+} rt_dma_dir_e;
+
+typedef struct {
+    unsigned int id;
+} rt_dma_copy_t;
+
+static inline void rt_dma_memcpy(unsigned int ext,
+                                 unsigned int loc,
+                                 unsigned int size,
+                                 rt_dma_dir_e dir,
+                                 int merge,
+                                 rt_dma_copy_t *copy) {
+    (void)merge;
+    (void)copy;
+    if (dir == RT_DMA_DIR_EXT2LOC) {
+        memcpy((void *)(uintptr_t)loc, (void *)(uintptr_t)ext, size);
+    } else {
+        memcpy((void *)(uintptr_t)ext, (void *)(uintptr_t)loc, size);
+    }
+}
+
+// copies size bytes, in lines of length bytes, which are stride bytes apart in ext and contiguous
+// in loc
+static inline void rt_dma_memcpy_2d(unsigned int ext,
+                                    unsigned int loc,
+                                    unsigned int size,
+                                    unsigned int stride,
+                                    unsigned int length,
+                                    rt_dma_dir_e dir,
+                                    int merge,
+                                    rt_dma_copy_t *copy) {
+    unsigned int done;
+    for (done = 0; done < size; done += length) {
+        unsigned int len = (size - done < length) ? size - done : length;
+        rt_dma_memcpy(ext, loc + done, len, dir, merge, copy);
+        ext += stride;
+    }
+}
+
+static inline void rt_dma_wait(rt_dma_copy_t *copy) {
+    (void)copy;
+}
+
+/*
+ * Performance counters
+ */
+
+typedef enum {
+    RT_PERF_ACTIVE_CYCLES = 0,
+    RT_PERF_INSTR = 1,
+    RT_PERF_LD_STALL = 2,
+    RT_PERF_JR_STALL = 3,
+    RT_PERF_IMISS = 4,
+    RT_PERF_LD = 5,
+    RT_PERF_ST = 6,
+    RT_PERF_JUMP = 7,
+    RT_PERF_BRANCH = 8,
+    RT_PERF_BTAKEN = 9,
+    RT_PERF_RVC = 10,
+    RT_PERF_LD_EXT = 11,
+    RT_PERF_ST_EXT = 12,
+    RT_PERF_LD_EXT_CYC = 13,
+    RT_PERF_ST_EXT_CYC = 14,
+    RT_PERF_TCDM_CONT = 15,
+    RT_PERF_CYCLES = 16,
+} rt_perf_event_e;
+
+typedef struct {
+    unsigned int events;
+} rt_perf_t;
+
+static inline void rt_perf_init(rt_perf_t *perf) {
+    perf->events = 0;
+}
+
+static inline void rt_perf_conf(rt_perf_t *perf, unsigned int events) {
+    perf->events = events;
+}
+
+// the counters belong to the calling core, as on PULP
+void rt_perf_reset(rt_perf_t *perf);
+void rt_perf_start(rt_perf_t *perf);
+void rt_perf_stop(rt_perf_t *perf);
+unsigned int rt_perf_read(int event);
+
+/*
+ * Frequencies
+ */
+
+typedef enum {
+    RT_FREQ_DOMAIN_FC = 0,
+    RT_FREQ_DOMAIN_CL = 1,
+    RT_FREQ_DOMAIN_PERIPH = 2,
+} rt_freq_domain_e;
+
+// the performance counters count nanoseconds, so all domains run at 1 GHz
+static inline unsigned int rt_freq_get(rt_freq_domain_e domain) {
+    (void)domain;
+    return 1000000000;
+}
+
+/*
+ * Builtins of the XPULPV2 extension
+ */
+
+typedef int16_t v2s __attribute__((vector_size(4)));
+typedef uint16_t v2u __attribute__((vector_size(4)));
+typedef int8_t v4s __attribute__((vector_size(4)));
+typedef uint8_t v4u __attribute__((vector_size(4)));
+
+#define __PACK2(x, y) ((v2s){ (int16_t)(x), (int16_t)(y) })
+#define __PACK4(x, y, z, t) ((v4s){ (int8_t)(x), (int8_t)(y), (int8_t)(z), (int8_t)(t) })
+
+#define __ADD2(x, y) ((v2s)(x) + (v2s)(y))
+#define __SUB2(x, y) ((v2s)(x) - (v2s)(y))
+#define __AND2(x, y) ((v2s)(x) & (v2s)(y))
+#define __SRA2(x, y) ((v2s)(x) >> (y))
+#define __SLL2(x, y) ((v2s)(x) << (y))
+#define __ADD4(x, y) ((v4s)(x) + (v4s)(y))
+#define __SUB4(x, y) ((v4s)(x) - (v4s)(y))
+#define __AND4(x, y) ((v4s)(x) & (v4s)(y))
+#define __SRA4(x, y) ((v4s)(x) >> (y))
+#define __SLL4(x, y) ((v4s)(x) << (y))
+
+static inline v2s __ABS2(v2s x) {
+    return (v2s){ (x[0] < 0) ? -x[0] : x[0], (x[1] < 0) ? -x[1] : x[1] };
+}
+
+static inline v2s __MAX2(v2s x, v2s y) {
+    return (v2s){ (x[0] > y[0]) ? x[0] : y[0], (x[1] > y[1]) ? x[1] : y[1] };
+}
+
+static inline v2s __MIN2(v2s x, v2s y) {
+    return (v2s){ (x[0] < y[0]) ? x[0] : y[0], (x[1] < y[1]) ? x[1] : y[1] };
+}
+
+static inline v4s __MAX4(v4s x, v4s y) {
+    return (v4s){ (x[0] > y[0]) ? x[0] : y[0], (x[1] > y[1]) ? x[1] : y[1],
+                  (x[2] > y[2]) ? x[2] : y[2], (x[3] > y[3]) ? x[3] : y[3] };
+}
+
+static inline v4s __MIN4(v4s x, v4s y) {
+    return (v4s){ (x[0] < y[0]) ? x[0] : y[0], (x[1] < y[1]) ? x[1] : y[1],
+                  (x[2] < y[2]) ? x[2] : y[2], (x[3] < y[3]) ? x[3] : y[3] };
+}
+
+static inline int32_t __DOTP2(v2s x, v2s y) {
+    return (int32_t)x[0] * y[0] + (int32_t)x[1] * y[1];
+}
+
+static inline int32_t __DOTP4(v4s x, v4s y) {
+    return (int32_t)x[0] * y[0] + (int32_t)x[1] * y[1] + (int32_t)x[2] * y[2] +
+        (int32_t)x[3] * y[3];
+}
+
+// XpulpNN: each byte holds two signed nibbles (low nibble first)
+static inline int32_t __DOTP8(v4s x, v4s y) {
+    int32_t sum = 0;
+    for (int i = 0; i < 4; i++) {
+        sum += (int32_t)((int8_t)(x[i] << 4) >> 4) * ((int8_t)(y[i] << 4) >> 4);
+        sum += (int32_t)(x[i] >> 4) * (y[i] >> 4);
+    }
+    return sum;
+}
+
+// XpulpNN: each byte holds four signed crumbs (lowest bits first)
+static inline int32_t __DOTP16(v4s x, v4s y) {
+    int32_t sum = 0;
+    for (int i = 0; i < 4; i++) {
+        for (int k = 0; k < 4; k++) {
+            sum += (int32_t)((int8_t)(x[i] << (6 - 2 * k)) >> 6) *
+                ((int8_t)(y[i] << (6 - 2 * k)) >> 6);
+        }
+    }
+    return sum;
+}
+
+#define __SUMDOTP2(x, y, acc) ((int32_t)(acc) + __DOTP2((v2s)(x), (v2s)(y)))
+#define __SUMDOTP4(x, y, acc) ((int32_t)(acc) + __DOTP4((v4s)(x), (v4s)(y)))
+#define __builtin_pulp_sdotsp2(x, y, acc) __SUMDOTP2(x, y, acc)
+#define __builtin_pulp_sdotsp4(x, y, acc) __SUMDOTP4(x, y, acc)
+#define __SUMDOTP8(x, y, acc) ((int32_t)(acc) + __DOTP8((v4s)(x), (v4s)(y)))
+#define __SUMDOTP16(x, y, acc) ((int32_t)(acc) + __DOTP16((v4s)(x), (v4s)(y)))
+#define __builtin_pulp_sdotsp8(x, y, acc) __SUMDOTP8(x, y, acc)
+#define __builtin_pulp_sdotsp16(x, y, acc) __SUMDOTP16(x, y, acc)
+
+#define __MAC(acc, x, y) ((int32_t)(acc) + (int32_t)(x) * (int32_t)(y))
+
+// saturates x to [-2^precision, 2^precision - 1]
+static inline int32_t __CLIP(int32_t x, int32_t precision) {
+    int32_t high = (1 << precision) - 1;
+    int32_t low = -(1 << precision);
+    return (x > high) ? high : (x < low) ? low : x;
+}
+
+// arithmetic right shift by scale, rounded to the nearest
+static inline int32_t __ROUNDNORM_REG(int32_t x, int32_t scale) {
+    return (int32_t)(((int64_t)x + ((1 << scale) >> 1)) >> scale);
+}
+
+static inline int32_t __ADDROUNDNORM_REG(int32_t x, int32_t y, int32_t scale) {
+    return (int32_t)(((int64_t)x + y + ((1 << scale) >> 1)) >> scale);
+}
+
+#endif // __PLP_HOST_RT_API_H__
@@ -0,0 +1,229 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        rt_host.c
+ * Description:  host replacement of the PULP runtime
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: host (x86)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <pthread.h>
+#include <time.h>
+
+#include "rt/rt_api.h"
+
+// the caller starts on the fabric controller
+__thread int plp_host_core_id = 0;
+__thread int plp_host_cluster_id = ARCHI_FC_CID;
+
+/*
+ * Teams
+ */
+
+typedef struct {
+    void (*entry)(void *);
+    void *arg;
+    int core_id;
+    int cluster_id;
+} plp_host_core_t;
+
+// barrier of the team which is currently forked, per cluster
+static pthread_barrier_t plp_host_barrier[ARCHI_NB_CLUSTER];
+
+static pthread_barrier_t *plp_host_team_barrier(void) {
+    int cid = plp_host_cluster_id;
+    return &plp_host_barrier[(cid >= 0 && cid < ARCHI_NB_CLUSTER) ? cid : 0];
+}
+
+static void *plp_host_core(void *args) {
+    plp_host_core_t *core = (plp_host_core_t *)args;
+    plp_host_core_id = core->core_id;
+    plp_host_cluster_id = core->cluster_id;
+    core->entry(core->arg);
+    return NULL;
+}
+
+void rt_team_fork(int nb_cores, void (*entry)(void *), void *arg) {
+
+    int i;
+    int master_core_id = plp_host_core_id;
+    pthread_t threads[ARCHI_CLUSTER_NB_PE];
+    plp_host_core_t cores[ARCHI_CLUSTER_NB_PE];
+
+    if (nb_cores <= 0 || nb_cores > ARCHI_CLUSTER_NB_PE) {
+        nb_cores = ARCHI_CLUSTER_NB_PE;
+    }
+
+    pthread_barrier_t *barrier = plp_host_team_barrier();
+    pthread_barrier_init(barrier, NULL, nb_cores);
+
+    for (i = 1; i < nb_cores; i++) {
+        cores[i].entry = entry;
+        cores[i].arg = arg;
+        cores[i].core_id = i;
+        cores[i].cluster_id = plp_host_cluster_id;
+        pthread_create(&threads[i], NULL, plp_host_core, &cores[i]);
+    }
+
+    // the caller is core 0 of the team
+    plp_host_core_id = 0;
+    entry(arg);
+
+    for (i = 1; i < nb_cores; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    plp_host_core_id = master_core_id;
+    pthread_barrier_destroy(barrier);
+}
+
+void rt_team_barrier(void) {
+    pthread_barrier_wait(plp_host_team_barrier());
+}
+
+void rt_cluster_mount(int mount, int cid, int flags, rt_event_t *event) {
+    (void)mount;
+    (void)cid;
+    (void)flags;
+    (void)event;
+}
+
+// only one call runs on each cluster at a time
+static pthread_mutex_t plp_host_cluster_lock[ARCHI_NB_CLUSTER] = {
+    [0 ... ARCHI_NB_CLUSTER - 1] = PTHREAD_MUTEX_INITIALIZER
+};
+
+// runs the entry on core 0 of the cluster
+static void *plp_host_cluster(void *args) {
+    rt_cluster_call_t *call = (rt_cluster_call_t *)args;
+    pthread_mutex_lock(&plp_host_cluster_lock[call->cid]);
+    plp_host_core_id = 0;
+    plp_host_cluster_id = call->cid;
+    call->entry(call->arg);
+    plp_host_cluster_id = ARCHI_FC_CID;
+    pthread_mutex_unlock(&plp_host_cluster_lock[call->cid]);
+    return NULL;
+}
+
+int rt_cluster_call(rt_cluster_call_t *call,
+                    int cid,
+                    void (*entry)(void *arg),
+                    void *arg,
+                    void *stacks,
+                    int master_stack_size,
+                    int slave_stack_size,
+                    int nb_pe,
+                    rt_event_t *event) {
+
+    rt_cluster_call_t sync_call;
+
+    (void)stacks;
+    (void)master_stack_size;
+    (void)slave_stack_size;
+    (void)nb_pe;
+
+    if (call == NULL) {
+        call = (event != NULL) ? &event->call : &sync_call;
+    }
+    call->cid = cid;
+    call->entry = entry;
+    call->arg = arg;
+
+    if (event == NULL) {
+        plp_host_cluster(call);
+    } else {
+        event->pending = 1;
+        pthread_create(&event->thread, NULL, plp_host_cluster, call);
+    }
+
+    return 0;
+}
+
+/*
+ * Events
+ */
+
+#define PLP_HOST_NB_EVENTS 16
+
+static rt_event_t plp_host_events[PLP_HOST_NB_EVENTS];
+static int plp_host_next_event = 0;
+
+rt_event_t *rt_event_get_blocking(void *sched) {
+    (void)sched;
+    rt_event_t *event = &plp_host_events[plp_host_next_event];
+    plp_host_next_event = (plp_host_next_event + 1) % PLP_HOST_NB_EVENTS;
+    rt_event_wait(event);
+    return event;
+}
+
+void rt_event_wait(rt_event_t *event) {
+    if (event->pending) {
+        pthread_join(event->thread, NULL);
+        event->pending = 0;
+    }
+}
+
+/*
+ * Performance counters
+ */
+
+// nanoseconds counted by the calling core
+static __thread uint64_t plp_host_perf_count = 0;
+static __thread uint64_t plp_host_perf_start = 0;
+static __thread int plp_host_perf_running = 0;
+
+static uint64_t plp_host_time_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+void rt_perf_reset(rt_perf_t *perf) {
+    (void)perf;
+    plp_host_perf_count = 0;
+    plp_host_perf_start = plp_host_time_ns();
+}
+
+void rt_perf_start(rt_perf_t *perf) {
+    (void)perf;
+    plp_host_perf_start = plp_host_time_ns();
+    plp_host_perf_running = 1;
+}
+
+void rt_perf_stop(rt_perf_t *perf) {
+    (void)perf;
+    if (plp_host_perf_running) {
+        plp_host_perf_count += plp_host_time_ns() - plp_host_perf_start;
+        plp_host_perf_running = 0;
+    }
+}
+
+unsigned int rt_perf_read(int event) {
+    if (event != RT_PERF_CYCLES && event != RT_PERF_ACTIVE_CYCLES) {
+        return 0;
+    }
+    if (plp_host_perf_running) {
+        return (unsigned int)(plp_host_perf_count + plp_host_time_ns() - plp_host_perf_start);
+    }
+    return (unsigned int)plp_host_perf_count;
+}
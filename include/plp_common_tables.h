@@ -27,6 +27,8 @@
 
 #include "plp_math.h"
 
+#ifndef PLP_NO_STATIC_FFT_TABLES
+
 extern const int16_t twiddleCoef_16_q16[24];
 extern const int16_t twiddleCoef_32_q16[48];
 extern const int16_t twiddleCoef_64_q16[96];
@@ -47,6 +49,9 @@ extern const int32_t twiddleCoef_1024_q32[1536];
 extern const int32_t twiddleCoef_2048_q32[3072];
 extern const int32_t twiddleCoef_4096_q32[6144];
 
+extern const int16_t twiddleCoef_rfft_q16[4096];
+extern const int32_t twiddleCoef_rfft_q32[4096];
+
 #define PLPBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH ((uint16_t)12)
 #define PLPBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH ((uint16_t)24)
 #define PLPBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH ((uint16_t)56)
@@ -67,12 +72,25 @@ extern const uint16_t plpBitRevIndexTable_fixed_1024[PLPBITREVINDEXTABLE_FIXED_1
 extern const uint16_t plpBitRevIndexTable_fixed_2048[PLPBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH];
 extern const uint16_t plpBitRevIndexTable_fixed_4096[PLPBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH];
 
+extern const Complex_type_f32 twiddleCoef_rfft_2048[1024];
+
+extern short bit_rev_radix2_LUT[2048];
+
+#endif // PLP_NO_STATIC_FFT_TABLES
+
+#ifndef PLP_FAST_MATH_POLY
 extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
 extern const int32_t sinTable_q32[FAST_MATH_TABLE_SIZE + 1];
+#endif // PLP_FAST_MATH_POLY
+
 extern const int16_t sinTable_q16[FAST_MATH_TABLE_SIZE + 1];
 
-extern const Complex_type_f32 twiddleCoef_rfft_2048[1024];
+#define CORDIC_ATAN_TABLE_SIZE 30
+#define CORDIC_INV_GAIN_Q32 2608131496U // 1 / prod(sqrt(1 + 2^(-2i))) in Q0.32
 
-extern short bit_rev_radix2_LUT[2048];
+extern const int32_t cordicAtanTable_q32[CORDIC_ATAN_TABLE_SIZE];
+
+extern const plp_dwt_lifting_f32 dwtLiftingTable_f32[PLP_DWT_NUM_WAVELETS];
+extern const plp_dwt_lifting_q16 dwtLiftingTable_q16[PLP_DWT_NUM_WAVELETS];
 
 #endif // PLP_COMMON_TABLES_H
\ No newline at end of file
@@ -0,0 +1,208 @@
+/** ==========================================================================
+ * @file     plp_math_inline.h
+ * @brief    Header-only inline kernels of PULP DSP Library for small fixed sizes
+ * @version  V0
+ * @date     15. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @defgroup groupInline Inline Functions
+ *
+ * Optional header with static inline variants of the library functions for a length fixed at
+ * compile time, e.g. plp_dot_prod_q16_16 is plp_dot_prod_q16 with blockSize = 16. For vectors of a
+ * few elements (e.g. quaternions), the call of the glue code and of the kernel costs more than the
+ * computation itself. The inline variants have no glue code and no loop, and the compiler can keep
+ * the operands in registers across calls.
+ *
+ * The kernel is chosen at compile time, as there is no glue code: by default, the variants use the
+ * XPULPV2 SIMD instructions, and return the same results as the XPULPV2 kernels of the library.
+ * Define PLP_MATH_INLINE_RV32IM before including this header in code running on a core without
+ * XPULPV2 (e.g. an IBEX fabric controller), to use the arithmetic of the RV32IM kernels instead.
+ * As in the kernels, the 8-bit and 16-bit vectors must be aligned to 32 bit for the SIMD loads.
+ *
+ * The variants exist for the lengths 4, 8 and 16. Further lengths can be generated with the
+ * PLP_DOT_PROD_INLINE_* macros, e.g. PLP_DOT_PROD_INLINE_I16(32) defines plp_dot_prod_i16_32. The
+ * length must be a multiple of 4.
+ */
+
+#ifndef __PLP_MATH_INLINE_H__
+#define __PLP_MATH_INLINE_H__
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupInline
+ */
+
+/**
+  @addtogroup InlineDotProd
+  @{
+ */
+
+/**
+  @brief Defines plp_dot_prod_i32_<N>, the dot product of 32-bit integer vectors of length N.
+  @param[in]  N  length of the vectors, known at compile time
+*/
+#define PLP_DOT_PROD_INLINE_I32(N)                                                                 \
+    static inline void plp_dot_prod_i32_##N(const int32_t *__restrict__ pSrcA,                    \
+                                            const int32_t *__restrict__ pSrcB,                    \
+                                            int32_t *__restrict__ pRes) {                         \
+        int32_t sum = 0;                                                                           \
+        _Pragma("GCC unroll 32") for (uint32_t i = 0; i < (N); i++) {                              \
+            sum = __MAC(sum, pSrcA[i], pSrcB[i]);                                                  \
+        }                                                                                          \
+        *pRes = sum;                                                                               \
+    }
+
+/**
+  @brief Defines plp_dot_prod_f32_<N>, the dot product of 32-bit float vectors of length N.
+  @param[in]  N  length of the vectors, known at compile time
+*/
+#define PLP_DOT_PROD_INLINE_F32(N)                                                                 \
+    static inline void plp_dot_prod_f32_##N(const float32_t *__restrict__ pSrcA,                  \
+                                            const float32_t *__restrict__ pSrcB,                  \
+                                            float32_t *__restrict__ pRes) {                       \
+        float32_t sum = 0.0f;                                                                      \
+        _Pragma("GCC unroll 32") for (uint32_t i = 0; i < (N); i++) {                              \
+            sum += pSrcA[i] * pSrcB[i];                                                            \
+        }                                                                                          \
+        *pRes = sum;                                                                               \
+    }
+
+#ifndef PLP_MATH_INLINE_RV32IM
+
+/**
+  @brief Defines plp_dot_prod_i16_<N>, the dot product of 16-bit integer vectors of length N.
+  @param[in]  N  length of the vectors, known at compile time
+*/
+#define PLP_DOT_PROD_INLINE_I16(N)                                                                 \
+    static inline void plp_dot_prod_i16_##N(const int16_t *__restrict__ pSrcA,                    \
+                                            const int16_t *__restrict__ pSrcB,                    \
+                                            int32_t *__restrict__ pRes) {                         \
+        int32_t sum = 0;                                                                           \
+        _Pragma("GCC unroll 16") for (uint32_t i = 0; i < (N) / 2; i++) {                          \
+            sum = __SUMDOTP2(((v2s *)pSrcA)[i], ((v2s *)pSrcB)[i], sum);                           \
+        }                                                                                          \
+        *pRes = sum;                                                                               \
+    }
+
+/**
+  @brief Defines plp_dot_prod_i8_<N>, the dot product of 8-bit integer vectors of length N.
+  @param[in]  N  length of the vectors, known at compile time
+*/
+#define PLP_DOT_PROD_INLINE_I8(N)                                                                  \
+    static inline void plp_dot_prod_i8_##N(const int8_t *__restrict__ pSrcA,                      \
+                                           const int8_t *__restrict__ pSrcB,                      \
+                                           int32_t *__restrict__ pRes) {                          \
+        int32_t sum = 0;                                                                           \
+        _Pragma("GCC unroll 16") for (uint32_t i = 0; i < (N) / 4; i++) {                          \
+            sum = __SUMDOTP4(((v4s *)pSrcA)[i], ((v4s *)pSrcB)[i], sum);                           \
+        }                                                                                          \
+        *pRes = sum;                                                                               \
+    }
+
+/**
+  @brief Defines plp_dot_prod_q16_<N>, the dot product of 16-bit fixed point vectors of length N.
+  The products are summed four by four, and every sum is rounded and shifted by deciPoint, as in
+  plp_dot_prod_q16s_xpulpv2.
+  @param[in]  N  length of the vectors, known at compile time
+*/
+#define PLP_DOT_PROD_INLINE_Q16(N)                                                                 \
+    static inline void plp_dot_prod_q16_##N(const int16_t *__restrict__ pSrcA,                    \
+                                            const int16_t *__restrict__ pSrcB,                    \
+                                            uint32_t deciPoint, int32_t *__restrict__ pRes) {     \
+        int32_t sum = 0;                                                                           \
+        _Pragma("GCC unroll 8") for (uint32_t i = 0; i < (N) / 4; i++) {                           \
+            int32_t x0 = __DOTP2(((v2s *)pSrcA)[2 * i], ((v2s *)pSrcB)[2 * i]);                    \
+            int32_t x1 = __DOTP2(((v2s *)pSrcA)[2 * i + 1], ((v2s *)pSrcB)[2 * i + 1]);            \
+            sum += __ADDROUNDNORM_REG(x0, x1, deciPoint);                                          \
+        }                                                                                          \
+        *pRes = sum;                                                                               \
+    }
+
+#else // PLP_MATH_INLINE_RV32IM
+
+#define PLP_DOT_PROD_INLINE_I16(N)                                                                 \
+    static inline void plp_dot_prod_i16_##N(const int16_t *__restrict__ pSrcA,                    \
+                                            const int16_t *__restrict__ pSrcB,                    \
+                                            int32_t *__restrict__ pRes) {                         \
+        int32_t sum = 0;                                                                           \
+        _Pragma("GCC unroll 32") for (uint32_t i = 0; i < (N); i++) {                              \
+            sum = __MAC(sum, pSrcA[i], pSrcB[i]);                                                  \
+        }                                                                                          \
+        *pRes = sum;                                                                               \
+    }
+
+#define PLP_DOT_PROD_INLINE_I8(N)                                                                  \
+    static inline void plp_dot_prod_i8_##N(const int8_t *__restrict__ pSrcA,                      \
+                                           const int8_t *__restrict__ pSrcB,                      \
+                                           int32_t *__restrict__ pRes) {                          \
+        int32_t sum = 0;                                                                           \
+        _Pragma("GCC unroll 32") for (uint32_t i = 0; i < (N); i++) {                              \
+            sum = __MAC(sum, pSrcA[i], pSrcB[i]);                                                  \
+        }                                                                                          \
+        *pRes = sum;                                                                               \
+    }
+
+// the products are summed four by four, and every sum is rounded and shifted by deciPoint, as in
+// plp_dot_prod_q16s_rv32im
+#define PLP_DOT_PROD_INLINE_Q16(N)                                                                 \
+    static inline void plp_dot_prod_q16_##N(const int16_t *__restrict__ pSrcA,                    \
+                                            const int16_t *__restrict__ pSrcB,                    \
+                                            uint32_t deciPoint, int32_t *__restrict__ pRes) {     \
+        int32_t sum = 0;                                                                           \
+        int32_t bias = (1 << deciPoint) >> 1;                                                      \
+        _Pragma("GCC unroll 8") for (uint32_t i = 0; i < (N) / 4; i++) {                           \
+            int32_t tmp = pSrcA[4 * i] * pSrcB[4 * i];                                             \
+            tmp += pSrcA[4 * i + 1] * pSrcB[4 * i + 1];                                            \
+            tmp += pSrcA[4 * i + 2] * pSrcB[4 * i + 2];                                            \
+            tmp += pSrcA[4 * i + 3] * pSrcB[4 * i + 3];                                            \
+            sum += (tmp + bias) >> deciPoint;                                                      \
+        }                                                                                          \
+        *pRes = sum;                                                                               \
+    }
+
+#endif // PLP_MATH_INLINE_RV32IM
+
+PLP_DOT_PROD_INLINE_I32(4)
+PLP_DOT_PROD_INLINE_I32(8)
+PLP_DOT_PROD_INLINE_I32(16)
+
+PLP_DOT_PROD_INLINE_I16(4)
+PLP_DOT_PROD_INLINE_I16(8)
+PLP_DOT_PROD_INLINE_I16(16)
+
+PLP_DOT_PROD_INLINE_I8(4)
+PLP_DOT_PROD_INLINE_I8(8)
+PLP_DOT_PROD_INLINE_I8(16)
+
+PLP_DOT_PROD_INLINE_Q16(4)
+PLP_DOT_PROD_INLINE_Q16(8)
+PLP_DOT_PROD_INLINE_Q16(16)
+
+PLP_DOT_PROD_INLINE_F32(4)
+PLP_DOT_PROD_INLINE_F32(8)
+PLP_DOT_PROD_INLINE_F32(16)
+
+/**
+  @} end of InlineDotProd group
+ */
+
+#endif // __PLP_MATH_INLINE_H__
@@ -50,6 +50,9 @@
   <pre>
   pDst[n] = abs(pSrc[n]),   0 <= n < blockSize.
   </pre>
+
+  The functions can work in-place, i.e., pDst may be equal to pSrc.
+
   There are separate functions for floating point, integer, and fixed point 32- 16- 8-bit data
   types. For lower precision integers (16- and 8-bit), functions exploiting SIMD instructions are
   provided.
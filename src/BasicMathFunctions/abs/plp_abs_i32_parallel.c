@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_abs_i32_parallel.c
+ * Description:  32-bit integer parallel vector absolute value glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicAbs
+  @{
+ */
+
+/**
+  @brief Glue code for parallel absolute value of 32-bit integer vectors.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nPE        number of parallel processing units
+  @return     none
+ */
+
+void plp_abs_i32_parallel(const int32_t *pSrc,
+                          int32_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_abs_instance_i32 args = { .pSrc = pSrc,
+                                      .pDst = pDst,
+                                      .blockSize = blockSize,
+                                      .nPE = nPE };
+        rt_team_fork(nPE, plp_abs_i32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of BasicAbs group
+ */
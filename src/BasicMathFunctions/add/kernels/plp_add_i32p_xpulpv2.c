@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_i32p_xpulpv2.c
+ * Description:  parallel 32-bit integer vector addition for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicAdd
+ */
+
+/**
+  @addtogroup BasicAddKernels
+  @{
+ */
+
+/**
+   @brief Parallel addition of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_add_instance_i32 struct initialized by
+                     plp_add_i32_parallel
+   @return     none
+
+   @par Parallelization
+   Every core computes a contiguous chunk of the vectors with plp_add_i32s_xpulpv2, instead of
+   interleaving the elements, such that the cores do not compete for the same memory banks. The
+   size of each chunk is a multiple of 4, such that every chunk starts word aligned.
+*/
+
+void plp_add_i32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_add_instance_i32 *a = (plp_add_instance_i32 *)args;
+
+    const int32_t *pSrcA = a->pSrcA;
+    const int32_t *pSrcB = a->pSrcB;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    int32_t *pDst = a->pDst;
+
+    uint32_t chunk = (((blockSize + nPE - 1) / nPE) + 3) & ~3;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > blockSize) {
+        start = blockSize;
+    }
+    if (end > blockSize) {
+        end = blockSize;
+    }
+
+    if (start < end) {
+        plp_add_i32s_xpulpv2(pSrcA + start,
+                             pSrcB + start,
+                             pDst + start,
+                             end - start);
+    }
+}
+
+/**
+   @} end of BasicAddKernels group
+*/
@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_q8s_rv32im.c
+ * Description:  8-bit fixed-point saturating vector addition kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicAdd
+ */
+
+/**
+  @addtogroup BasicAddKernels
+  @{
+ */
+
+/**
+  @brief Saturating addition of 8-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]  pSrcA      points to first input vector
+  @param[in]  pSrcB      points to second input vector
+  @param[out] pDst       points to output vector, may be equal to pSrcA or pSrcB
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+ */
+
+void plp_add_q8s_rv32im(const int8_t *pSrcA,
+                        const int8_t *pSrcB,
+                        int8_t *pDst,
+                        uint32_t blockSize) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i < blockSize; i++) {
+        int32_t val = pSrcA[i] + pSrcB[i];
+        pDst[i] = (int8_t)((val > INT8_MAX) ? INT8_MAX : (val < INT8_MIN) ? INT8_MIN : val);
+    }
+}
+
+/**
+  @} end of BasicAddKernels group
+ */
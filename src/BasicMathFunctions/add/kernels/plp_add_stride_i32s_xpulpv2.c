@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_stride_i32s_xpulpv2.c
+ * Description:  Addition of strided 32-bit integer vectors kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicAdd
+ */
+
+/**
+  @addtogroup BasicAddKernels
+  @{
+ */
+
+/**
+  @brief Element-by-element addition of strided 32-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  strideA    distance between two samples of pSrcA, in elements
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  strideB    distance between two samples of pSrcB, in elements
+  @param[out] pDst       points to the output vector
+  @param[in]  strideDst  distance between two samples of pDst, in elements
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+ */
+
+void plp_add_stride_i32s_xpulpv2(const int32_t *pSrcA,
+                                 uint32_t strideA,
+                                 const int32_t *pSrcB,
+                                 uint32_t strideB,
+                                 int32_t *pDst,
+                                 uint32_t strideDst,
+                                 uint32_t blockSize) {
+
+    uint32_t blkCnt;
+
+    // both samples are loaded before the first result is stored, which hides the load latency and
+    // still allows pDst to be equal to one of the inputs
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        int32_t a1 = pSrcA[0];
+        int32_t b1 = pSrcB[0];
+        int32_t a2 = pSrcA[strideA];
+        int32_t b2 = pSrcB[strideB];
+        pDst[0] = a1 + b1;
+        pDst[strideDst] = a2 + b2;
+        pSrcA += 2 * strideA;
+        pSrcB += 2 * strideB;
+        pDst += 2 * strideDst;
+    }
+
+    if (blockSize & 1) {
+        *pDst = *pSrcA + *pSrcB;
+    }
+}
+
+/**
+  @} end of BasicAddKernels group
+ */
@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_i16_coop.c
+ * Description:  Glue code for cooperative addition of 16-bit integer vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// arguments of plp_add_i16_coop, passed to both shares
+typedef struct {
+    const int16_t *pSrcA;
+    const int16_t *pSrcB;
+    int32_t *pDst;
+    uint32_t clLen;
+    uint32_t fcLen;
+    uint32_t nPE;
+} plp_add_coop_args_i16;
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicAdd
+  @{
+ */
+
+/**
+  @brief      Cluster share of plp_add_i16_coop, the first clLen samples.
+  @param[in]  args  pointer to plp_add_coop_args_i16 struct initialized by plp_add_i16_coop
+  @return     none
+ */
+
+static void plp_add_i16_coop_cl(void *args) {
+
+    plp_add_coop_args_i16 *a = (plp_add_coop_args_i16 *)args;
+
+    plp_add_i16_l2(a->pSrcA, a->pSrcB, a->pDst, a->clLen, a->nPE);
+}
+
+/**
+  @brief      Fabric controller share of plp_add_i16_coop, the last fcLen samples.
+  @param[in]  args  pointer to plp_add_coop_args_i16 struct initialized by plp_add_i16_coop
+  @return     none
+ */
+
+static void plp_add_i16_coop_fc(void *args) {
+
+    plp_add_coop_args_i16 *a = (plp_add_coop_args_i16 *)args;
+
+    plp_add_i16s_rv32im(a->pSrcA + a->clLen, a->pSrcB + a->clLen, a->pDst + a->clLen, a->fcLen);
+}
+
+/**
+  @brief      Glue code for addition of 16-bit integer vectors in L2, computed by the cluster and
+              the fabric controller together, called from the fabric controller.
+  @param[in,out] C       points to the state of the cooperative calls, see plp_coop_init
+  @param[in]  pSrcA      points to the first input vector in L2
+  @param[in]  pSrcB      points to the second input vector in L2
+  @param[out] pDst       points to the output vector in L2
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nPE        number of parallel processing units of the cluster
+  @return     none
+
+  @par
+  The samples are split with plp_coop_split. The cluster adds its share with plp_add_i16_l2, and
+  the fabric controller adds its share with plp_add_i16s_rv32im at the same time, such that both
+  write disjoint parts of pDst.
+ */
+
+void plp_add_i16_coop(plp_coop_t *C,
+                      const int16_t *pSrcA,
+                      const int16_t *pSrcB,
+                      int32_t *pDst,
+                      uint32_t blockSize,
+                      uint32_t nPE) {
+
+    uint32_t fcLen = plp_coop_split(C, blockSize);
+
+    plp_add_coop_args_i16 args = { .pSrcA = pSrcA,
+                                   .pSrcB = pSrcB,
+                                   .pDst = pDst,
+                                   .clLen = blockSize - fcLen,
+                                   .fcLen = fcLen,
+                                   .nPE = nPE };
+
+    plp_coop_run(C, plp_add_i16_coop_cl, plp_add_i16_coop_fc, (void *)&args, args.clLen,
+                 args.fcLen);
+}
+
+/**
+  @} end of BasicAdd group
+ */
@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_i32_l2.c
+ * Description:  32-bit integer parallel addition of L2 vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicAdd
+  @{
+ */
+
+/**
+  @brief Glue code for parallel addition of 32-bit integer vectors in L2.
+  @param[in]  pSrcA      points to the first input vector in L2
+  @param[in]  pSrcB      points to the second input vector in L2
+  @param[out] pDst       points to the output vector in L2
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nPE        number of parallel processing units
+  @return     none
+
+  @par
+  The vectors are streamed through L1 tiles with plp_dma_stream_next, and every tile is processed
+  with plp_add_i32_parallel while the DMA copies the next tile. The L1 buffer of
+  PLP_DMA_STREAM_BUFFER_BYTES bytes is taken with plp_scratch_alloc.
+ */
+
+void plp_add_i32_l2(const int32_t *pSrcA,
+                    const int32_t *pSrcB,
+                    int32_t *pDst,
+                    uint32_t blockSize,
+                    uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        uint8_t *pBuf = (uint8_t *)plp_scratch_alloc(PLP_DMA_STREAM_BUFFER_BYTES);
+
+        if (pBuf == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+
+        plp_dma_stream_t S;
+        plp_dma_stream_init(&S, pSrcA, pSrcB, sizeof(int32_t), pDst, sizeof(int32_t), blockSize,
+                            pBuf, PLP_DMA_STREAM_BUFFER_BYTES);
+
+        void *pA, *pB, *pD;
+        uint32_t len;
+
+        while ((len = plp_dma_stream_next(&S, &pA, &pB, &pD)) > 0) {
+            plp_add_i32_parallel(pA, pB, pD, len, nPE);
+        }
+
+        plp_scratch_free(pBuf, PLP_DMA_STREAM_BUFFER_BYTES);
+    }
+}
+
+/**
+  @} end of BasicAdd group
+ */
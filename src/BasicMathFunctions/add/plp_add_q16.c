@@ -0,0 +1,63 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_q16.c
+ * Description:  16-bit fixed-point saturating vector addition glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicAdd
+  @{
+ */
+
+/**
+  @brief Glue code for saturating addition of 16-bit fixed-point vectors.
+  @param[in]  pSrcA      points to first input vector
+  @param[in]  pSrcB      points to second input vector
+  @param[out] pDst       points to output vector, may be equal to pSrcA or pSrcB
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+ */
+
+void plp_add_q16(const int16_t *pSrcA,
+                 const int16_t *pSrcB,
+                 int16_t *pDst,
+                 uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_add_q16s_rv32im(pSrcA, pSrcB, pDst, blockSize);
+    } else {
+        plp_add_q16s_xpulpv2(pSrcA, pSrcB, pDst, blockSize);
+    }
+}
+
+/**
+  @} end of BasicAdd group
+ */
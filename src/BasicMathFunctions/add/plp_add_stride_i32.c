@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_add_stride_i32.c
+ * Description:  Glue code for addition of strided 32-bit integer vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicAdd
+  @{
+ */
+
+/**
+  @brief Glue code for element-by-element addition of strided 32-bit integer vectors.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  strideA    distance between two samples of pSrcA, in elements
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  strideB    distance between two samples of pSrcB, in elements
+  @param[out] pDst       points to the output vector
+  @param[in]  strideDst  distance between two samples of pDst, in elements
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+
+  @par Strides
+  pDst[n * strideDst] = pSrcA[n * strideA] + pSrcB[n * strideB] for 0 <= n < blockSize. pDst may
+  be equal to pSrcA or pSrcB if it has the same stride, such that one channel of interleaved
+  multi-channel data can be updated in place.
+ */
+
+void plp_add_stride_i32(const int32_t *pSrcA,
+                        uint32_t strideA,
+                        const int32_t *pSrcB,
+                        uint32_t strideB,
+                        int32_t *pDst,
+                        uint32_t strideDst,
+                        uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_add_stride_i32s_rv32im(pSrcA, strideA, pSrcB, strideB, pDst, strideDst, blockSize);
+    } else {
+        plp_add_stride_i32s_xpulpv2(pSrcA, strideA, pSrcB, strideB, pDst, strideDst, blockSize);
+    }
+}
+
+/**
+  @} end of BasicAdd group
+ */
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_axpy_f32p_xpulpv2.c
+ * Description:  parallel 32-bit float vector AXPY for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicAxpy
+ */
+
+/**
+  @addtogroup BasicAxpyKernels
+  @{
+ */
+
+/**
+   @brief Parallel AXPY of 32-bit float vectors kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_axpy_instance_f32 struct initialized by
+                     plp_axpy_f32_parallel
+   @return     none
+
+   @par Parallelization
+   Every core computes a contiguous chunk of the vectors with plp_axpy_f32s_xpulpv2. The size of
+   each chunk is a multiple of 4, such that neighbouring cores never write to the same word.
+*/
+
+void plp_axpy_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_axpy_instance_f32 *a = (plp_axpy_instance_f32 *)args;
+
+    const float32_t *__restrict__ pSrcX = a->pSrcX;
+    const float32_t *pSrcY = a->pSrcY;
+    float32_t alpha = a->alpha;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    float32_t *pDst = a->pDst;
+
+    uint32_t chunk = (((blockSize + nPE - 1) / nPE) + 3) & ~3;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > blockSize) {
+        start = blockSize;
+    }
+    if (end > blockSize) {
+        end = blockSize;
+    }
+
+    if (start < end) {
+        plp_axpy_f32s_xpulpv2(pSrcX + start,
+                              pSrcY + start,
+                              alpha,
+                              end - start,
+                              pDst + start);
+    }
+}
+
+/**
+   @} end of BasicAxpyKernels group
+*/
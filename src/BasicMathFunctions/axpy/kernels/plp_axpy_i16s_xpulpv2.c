@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_axpy_i16s_xpulpv2.c
+ * Description:  16-bit integer vector AXPY for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicAxpy
+ */
+
+/**
+  @addtogroup BasicAxpyKernels
+  @{
+ */
+
+/**
+   @brief AXPY of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcX      points to the input vector x
+   @param[in]  pSrcY      points to the input vector y
+   @param[in]  alpha      factor to multiply x with
+   @param[in]  shift      amount to shift the product alpha * x to the right
+   @param[in]  blockSize  number of samples in each vector
+   @param[out] pDst       points to the output vector, may be equal to pSrcY
+   @return     none
+*/
+
+void plp_axpy_i16s_xpulpv2(const int16_t *__restrict__ pSrcX,
+                           const int16_t *pSrcY,
+                           int16_t alpha,
+                           int32_t shift,
+                           uint32_t blockSize,
+                           int16_t *pDst) {
+
+    uint32_t i; // loop counter
+
+    // load both elements before storing, since pDst may be equal to pSrcY
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        int32_t x0 = pSrcX[i];
+        int32_t x1 = pSrcX[i + 1];
+        int32_t y0 = pSrcY[i];
+        int32_t y1 = pSrcY[i + 1];
+        pDst[i] = (int16_t)(((x0 * alpha) >> shift) + y0);
+        pDst[i + 1] = (int16_t)(((x1 * alpha) >> shift) + y1);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = (int16_t)((((int32_t)pSrcX[i] * alpha) >> shift) + pSrcY[i]);
+    }
+}
+
+/**
+   @} end of BasicAxpyKernels group
+*/
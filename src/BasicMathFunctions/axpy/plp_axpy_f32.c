@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_axpy_f32.c
+ * Description:  32-bit float vector AXPY glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicAxpy
+  @{
+ */
+
+/**
+  @brief Glue code for AXPY of 32-bit float vectors.
+  @param[in]  pSrcX      points to the input vector x
+  @param[in]  pSrcY      points to the input vector y
+  @param[in]  alpha      factor to multiply x with
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pDst       points to the output vector, may be equal to pSrcY
+  @return     none
+ */
+
+void plp_axpy_f32(const float32_t *__restrict__ pSrcX,
+                  const float32_t *pSrcY,
+                  float32_t alpha,
+                  uint32_t blockSize,
+                  float32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_axpy_f32s_xpulpv2(pSrcX, pSrcY, alpha, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of BasicAxpy group
+ */
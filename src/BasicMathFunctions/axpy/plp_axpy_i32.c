@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_axpy_i32.c
+ * Description:  32-bit integer vector AXPY glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @defgroup BasicAxpy Vector AXPY
+  This module contains the glue code for Vector AXPY. The kernel codes (kernels) are in the
+  Module Vector AXPY Kernels.
+
+  The Vector AXPY adds a scaled vector x to a vector y, element-by-element. For floating-point,
+  the shift is not applied.
+
+  <pre>
+  pDst[n] = ((alpha * pSrcX[n]) >> shift) + pSrcY[n],   0 <= n < blockSize.
+  </pre>
+
+  It replaces a scale followed by an addition, but reads every operand only once. pDst may be equal
+  to pSrcY, to update y in place. There are separate functions for floating point, and integer
+  32- 16- 8-bit data types.
+
+  The naming scheme of the functions follows the following pattern (for example plp_axpy_i32s):
+  <pre>
+  \<pulp\> _ \<function name\> _ \<data type\> \<precision\> \<method\> _ \<isa extension\>, with
+
+  data type = {f, i, q} respectively for floats, integers, fixed points
+
+  precision = {32, 16, 8} bits
+
+  method = {s, p} respectively meaning single core or parallel multicore implementation.
+
+  isa extension = rv32im, xpulpv2, etc. of which rv32im is the most general one.
+
+  </pre>
+ */
+
+/**
+  @addtogroup BasicAxpy
+  @{
+ */
+
+/**
+  @brief Glue code for AXPY of 32-bit integer vectors.
+  @param[in]  pSrcX      points to the input vector x
+  @param[in]  pSrcY      points to the input vector y
+  @param[in]  alpha      factor to multiply x with
+  @param[in]  shift      amount to shift the product alpha * x to the right
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pDst       points to the output vector, may be equal to pSrcY
+  @return     none
+ */
+
+void plp_axpy_i32(const int32_t *__restrict__ pSrcX,
+                  const int32_t *pSrcY,
+                  int32_t alpha,
+                  int32_t shift,
+                  uint32_t blockSize,
+                  int32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_axpy_i32s_rv32im(pSrcX, pSrcY, alpha, shift, blockSize, pDst);
+    } else {
+        plp_axpy_i32s_xpulpv2(pSrcX, pSrcY, alpha, shift, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of BasicAxpy group
+ */
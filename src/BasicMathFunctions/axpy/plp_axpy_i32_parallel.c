@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_axpy_i32_parallel.c
+ * Description:  parallel 32-bit integer vector AXPY glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicAxpy
+  @{
+ */
+
+/**
+  @brief Glue code for parallel AXPY of 32-bit integer vectors.
+  @param[in]  pSrcX      points to the input vector x
+  @param[in]  pSrcY      points to the input vector y
+  @param[in]  alpha      factor to multiply x with
+  @param[in]  shift      amount to shift the product alpha * x to the right
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the output vector, may be equal to pSrcY
+  @return     none
+ */
+
+void plp_axpy_i32_parallel(const int32_t *__restrict__ pSrcX,
+                           const int32_t *pSrcY,
+                           int32_t alpha,
+                           int32_t shift,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_axpy_instance_i32 args = { .pSrcX = pSrcX,
+                                       .pSrcY = pSrcY,
+                                       .alpha = alpha,
+                                       .shift = shift,
+                                       .blockSize = blockSize,
+                                       .nPE = nPE,
+                                       .pDst = pDst };
+        rt_team_fork(nPE, plp_axpy_i32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of BasicAxpy group
+ */
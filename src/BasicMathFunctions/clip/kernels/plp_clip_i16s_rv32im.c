@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_clip_i16s_rv32im.c
+ * Description:  16-bit integer vector clipping kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicClip
+ */
+
+/**
+  @addtogroup BasicClipKernels
+  @{
+ */
+
+/**
+  @brief Clipping of 16-bit integer vectors kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  low        lower bound of the output
+  @param[in]  high       upper bound of the output
+  @return     none
+ */
+
+void plp_clip_i16s_rv32im(const int16_t *pSrc,
+                          int16_t *pDst,
+                          uint32_t blockSize,
+                          int16_t low,
+                          int16_t high) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i < blockSize; i++) {
+        int16_t x = pSrc[i];
+        pDst[i] = (x < low) ? low : (x > high) ? high : x;
+    }
+}
+
+/**
+  @} end of BasicClipKernels group
+ */
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_clip_i32s_rv32im.c
+ * Description:  32-bit integer vector clipping kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicClip
+ */
+
+/**
+  @defgroup BasicClipKernels Vector Clipping Kernels
+  The Vector Clipping limits every element of a vector to the range [low, high].
+
+  <pre>
+  pDst[n] = min(max(pSrc[n], low), high),   0 <= n < blockSize.
+  </pre>
+
+  There are separate functions for floating point and 32-, 16- and 8-bit integer data types.
+  The bounds must satisfy low <= high.
+ */
+
+/**
+  @addtogroup BasicClipKernels
+  @{
+ */
+
+/**
+  @brief Clipping of 32-bit integer vectors kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  low        lower bound of the output
+  @param[in]  high       upper bound of the output
+  @return     none
+ */
+
+void plp_clip_i32s_rv32im(const int32_t *pSrc,
+                          int32_t *pDst,
+                          uint32_t blockSize,
+                          int32_t low,
+                          int32_t high) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i < blockSize; i++) {
+        int32_t x = pSrc[i];
+        pDst[i] = (x < low) ? low : (x > high) ? high : x;
+    }
+}
+
+/**
+  @} end of BasicClipKernels group
+ */
@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmp_eq_i8p_xpulpv2.c
+ * Description:  parallel 8-bit integer vector equality comparison for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicCompare
+ */
+
+/**
+  @addtogroup BasicCompareKernels
+  @{
+ */
+
+/**
+   @brief Parallel equality comparison of an 8-bit integer vector kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_cmp_instance_i8 struct initialized by
+                     plp_cmp_eq_i8_parallel
+   @return     none
+
+   @par Parallelization
+   Every core compares a contiguous chunk of the vector with plp_cmp_eq_i8s_xpulpv2. The size of
+   each chunk is a multiple of 32, such that every core writes its own words of the mask.
+*/
+
+void plp_cmp_eq_i8p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_cmp_instance_i8 *a = (plp_cmp_instance_i8 *)args;
+
+    uint32_t start, end;
+    plp_team_chunk(a->blockSize, a->nPE, core_id, 32, &start, &end);
+
+    if (start < end) {
+        plp_cmp_eq_i8s_xpulpv2(a->pSrc + start,
+                               a->pMask + (start >> 5),
+                               end - start,
+                               a->threshold);
+    }
+}
+
+/**
+   @} end of BasicCompareKernels group
+*/
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmp_gt_f32s_xpulpv2.c
+ * Description:  32-bit float vector greater-than comparison for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicCompare
+ */
+
+/**
+  @addtogroup BasicCompareKernels
+  @{
+ */
+
+/**
+  @brief Greater-than comparison of a 32-bit float vector kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pMask      points to the output bitmask of (blockSize + 31) / 32 words
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  threshold  value every element is compared with
+  @return     none
+ */
+
+void plp_cmp_gt_f32s_xpulpv2(const float32_t *pSrc,
+                             uint32_t *pMask,
+                             uint32_t blockSize,
+                             float32_t threshold) {
+
+    uint32_t i, k; // loop counters
+    uint32_t mask;
+
+    // the inner loop has a constant trip count, and runs as a hardware loop
+    for (i = 0; i + 31 < blockSize; i += 32) {
+        mask = 0;
+        for (k = 0; k < 32; k++) {
+            mask |= (uint32_t)(pSrc[i + k] > threshold) << k;
+        }
+        pMask[i >> 5] = mask;
+    }
+
+    // last partial word
+    if (i < blockSize) {
+        mask = 0;
+        for (k = 0; i + k < blockSize; k++) {
+            mask |= (uint32_t)(pSrc[i + k] > threshold) << k;
+        }
+        pMask[i >> 5] = mask;
+    }
+}
+
+/**
+  @} end of BasicCompareKernels group
+ */
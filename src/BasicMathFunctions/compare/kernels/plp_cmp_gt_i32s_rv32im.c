@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmp_gt_i32s_rv32im.c
+ * Description:  32-bit integer vector greater-than comparison for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicCompare
+ */
+
+/**
+  @defgroup BasicCompareKernels Vector Compare and Select Kernels
+  The comparisons test every element of a vector against a threshold, and store the results as a
+  packed bitmask, in which bit (n % 32) of pMask[n / 32] is set if the condition holds for
+  pSrc[n]. The unused bits of the last word are cleared.
+
+  <pre>
+  plp_cmp_gt:         pSrc[n] > threshold, and likewise for plp_cmp_lt and plp_cmp_eq
+  plp_select:         pDst[n] = (bit n of pMask) ? pSrcA[n] : pSrcB[n]
+  plp_count_nonzero:  *pRes = number of n with pSrc[n] != 0
+  </pre>
+
+  There are separate functions for floating point and 32-, 16- and 8-bit integer data types.
+ */
+
+/**
+  @addtogroup BasicCompareKernels
+  @{
+ */
+
+/**
+  @brief Greater-than comparison of a 32-bit integer vector kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pMask      points to the output bitmask of (blockSize + 31) / 32 words
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  threshold  value every element is compared with
+  @return     none
+ */
+
+void plp_cmp_gt_i32s_rv32im(const int32_t *pSrc,
+                            uint32_t *pMask,
+                            uint32_t blockSize,
+                            int32_t threshold) {
+
+    uint32_t i; // loop counter
+    uint32_t mask = 0;
+
+    for (i = 0; i < blockSize; i++) {
+        mask |= (uint32_t)(pSrc[i] > threshold) << (i & 0x1F);
+        if ((i & 0x1F) == 0x1F) {
+            pMask[i >> 5] = mask;
+            mask = 0;
+        }
+    }
+
+    // last partial word
+    if (blockSize & 0x1F) {
+        pMask[blockSize >> 5] = mask;
+    }
+}
+
+/**
+  @} end of BasicCompareKernels group
+ */
@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_count_nonzero_f32p_xpulpv2.c
+ * Description:  parallel 32-bit float vector nonzero count for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicCompare
+ */
+
+/**
+  @addtogroup BasicCompareKernels
+  @{
+ */
+
+/**
+   @brief Partial count of the nonzero elements of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  args  pointer to plp_count_nonzero_instance_f32 struct initialized by
+                     plp_count_nonzero_f32_parallel
+   @return     none
+
+   @par Parallelization
+   Every core counts a contiguous chunk of the vector with plp_count_nonzero_f32s_xpulpv2.
+*/
+
+void plp_count_nonzero_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_count_nonzero_instance_f32 *a = (plp_count_nonzero_instance_f32 *)args;
+
+    uint32_t start, end;
+    plp_team_chunk(a->blockSize, a->nPE, core_id, 1, &start, &end);
+
+    plp_count_nonzero_f32s_xpulpv2(a->pSrc + start, end - start, &a->resBuffer[core_id]);
+}
+
+/**
+   @} end of BasicCompareKernels group
+*/
@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_count_nonzero_i32s_xpulpv2.c
+ * Description:  32-bit integer vector nonzero count for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicCompare
+ */
+
+/**
+  @addtogroup BasicCompareKernels
+  @{
+ */
+
+/**
+  @brief Counting the nonzero elements of a 32-bit integer vector kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pRes       number of nonzero elements returned here
+  @return     none
+ */
+
+void plp_count_nonzero_i32s_xpulpv2(const int32_t *pSrc,
+                                    uint32_t blockSize,
+                                    uint32_t *pRes) {
+
+    uint32_t i; // loop counter
+    uint32_t cnt = 0;
+
+    for (i = 0; i < blockSize; i++) {
+        cnt += (pSrc[i] != 0);
+    }
+
+    *pRes = cnt;
+}
+
+/**
+  @} end of BasicCompareKernels group
+ */
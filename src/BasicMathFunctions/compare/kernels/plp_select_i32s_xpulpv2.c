@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_select_i32s_xpulpv2.c
+ * Description:  32-bit integer vector selection with a bitmask for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicCompare
+ */
+
+/**
+  @addtogroup BasicCompareKernels
+  @{
+ */
+
+/**
+  @brief Selection of 32-bit integer elements with a bitmask kernel for XPULPV2 extension.
+  @param[in]  pMask      points to the bitmask, with the layout of plp_cmp_gt
+  @param[in]  pSrcA      points to the vector selected where the bit of the mask is set
+  @param[in]  pSrcB      points to the vector selected where the bit of the mask is cleared
+  @param[out] pDst       points to the output vector, may be equal to pSrcA or pSrcB
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+ */
+
+void plp_select_i32s_xpulpv2(const uint32_t *pMask,
+                             const int32_t *pSrcA,
+                             const int32_t *pSrcB,
+                             int32_t *pDst,
+                             uint32_t blockSize) {
+
+    uint32_t i, k; // loop counters
+    uint32_t mask;
+
+    for (i = 0; i + 31 < blockSize; i += 32) {
+        mask = pMask[i >> 5];
+        for (k = 0; k < 32; k++) {
+            // m is all ones where the bit is set, which blends without a branch
+            int32_t m = -(int32_t)((mask >> k) & 0x1);
+            int32_t b = pSrcB[i + k];
+            pDst[i + k] = b ^ ((pSrcA[i + k] ^ b) & m);
+        }
+    }
+
+    // last partial word
+    for (; i < blockSize; i++) {
+        pDst[i] = ((pMask[i >> 5] >> (i & 0x1F)) & 0x1) ? pSrcA[i] : pSrcB[i];
+    }
+}
+
+/**
+  @} end of BasicCompareKernels group
+ */
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_select_i8s_xpulpv2.c
+ * Description:  8-bit integer vector selection with a bitmask for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicCompare
+ */
+
+/**
+  @addtogroup BasicCompareKernels
+  @{
+ */
+
+/**
+  @brief Selection of 8-bit integer elements with a bitmask kernel for XPULPV2 extension.
+  @param[in]  pMask      points to the bitmask, with the layout of plp_cmp_gt
+  @param[in]  pSrcA      points to the vector selected where the bit of the mask is set
+  @param[in]  pSrcB      points to the vector selected where the bit of the mask is cleared
+  @param[out] pDst       points to the output vector, may be equal to pSrcA or pSrcB
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+ */
+
+void plp_select_i8s_xpulpv2(const uint32_t *pMask,
+                            const int8_t *pSrcA,
+                            const int8_t *pSrcB,
+                            int8_t *pDst,
+                            uint32_t blockSize) {
+
+    uint32_t i, k; // loop counters
+    uint32_t mask;
+
+    for (i = 0; i + 31 < blockSize; i += 32) {
+        mask = pMask[i >> 5];
+        for (k = 0; k < 32; k += 4) {
+            // spreads the four bits of the mask to the lowest bit of the four bytes, and fills the
+            // bytes where the bit is set
+            uint32_t m = ((((mask >> k) & 0xF) * 0x00204081) & 0x01010101) * 0xFF;
+            uint32_t a = *((uint32_t *)&pSrcA[i + k]);
+            uint32_t b = *((uint32_t *)&pSrcB[i + k]);
+            *((uint32_t *)&pDst[i + k]) = b ^ ((a ^ b) & m);
+        }
+    }
+
+    // last partial word
+    for (; i < blockSize; i++) {
+        pDst[i] = ((pMask[i >> 5] >> (i & 0x1F)) & 0x1) ? pSrcA[i] : pSrcB[i];
+    }
+}
+
+/**
+  @} end of BasicCompareKernels group
+ */
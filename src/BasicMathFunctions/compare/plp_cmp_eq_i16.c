@@ -0,0 +1,63 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmp_eq_i16.c
+ * Description:  16-bit integer vector equality comparison glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicCompare
+  @{
+ */
+
+/**
+  @brief Glue code for the equality comparison of a 16-bit integer vector with a threshold.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pMask      points to the output bitmask of (blockSize + 31) / 32 words
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  threshold  value every element is compared with
+  @return     none
+ */
+
+void plp_cmp_eq_i16(const int16_t *pSrc,
+                    uint32_t *pMask,
+                    uint32_t blockSize,
+                    int16_t threshold) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmp_eq_i16s_rv32im(pSrc, pMask, blockSize, threshold);
+    } else {
+        plp_cmp_eq_i16s_xpulpv2(pSrc, pMask, blockSize, threshold);
+    }
+}
+
+/**
+  @} end of BasicCompare group
+ */
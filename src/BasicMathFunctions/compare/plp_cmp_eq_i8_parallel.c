@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmp_eq_i8_parallel.c
+ * Description:  8-bit integer parallel vector equality comparison glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicCompare
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel equality comparison of an 8-bit integer vector.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pMask      points to the output bitmask of (blockSize + 31) / 32 words
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  threshold  value every element is compared with
+  @param[in]  nPE        number of parallel processing units
+  @return     none
+ */
+
+void plp_cmp_eq_i8_parallel(const int8_t *pSrc,
+                            uint32_t *pMask,
+                            uint32_t blockSize,
+                            int8_t threshold,
+                            uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_cmp_instance_i8 args = { .pSrc = pSrc,
+                                     .blockSize = blockSize,
+                                     .threshold = threshold,
+                                     .nPE = nPE,
+                                     .pMask = pMask };
+        rt_team_fork(nPE, plp_cmp_eq_i8p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of BasicCompare group
+ */
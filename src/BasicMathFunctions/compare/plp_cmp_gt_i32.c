@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmp_gt_i32.c
+ * Description:  32-bit integer vector greater-than comparison glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @defgroup BasicCompare Vector Compare and Select
+  This module contains the glue code for Vector Compare and Select. The kernel codes (kernels) are
+  in the Module Vector Compare and Select Kernels.
+
+  The comparisons test every element of a vector against a threshold, and store the results as a
+  packed bitmask, in which bit (n % 32) of pMask[n / 32] is set if the condition holds for
+  pSrc[n].
+
+  <pre>
+  plp_cmp_gt:  pSrc[n] >  threshold
+  plp_cmp_lt:  pSrc[n] <  threshold
+  plp_cmp_eq:  pSrc[n] == threshold,   0 <= n < blockSize.
+  </pre>
+
+  The mask has (blockSize + 31) / 32 words, and the unused bits of the last word are cleared. One
+  word holds the conditions of 32 elements, hence masks are combined with word-wide logic, e.g.
+  the AND of two masks is set where both conditions hold. The select blends two vectors with a
+  mask, and the nonzero count counts the elements which are not zero.
+
+  <pre>
+  plp_select:         pDst[n] = (bit n of pMask) ? pSrcA[n] : pSrcB[n]
+  plp_count_nonzero:  *pRes = number of n with pSrc[n] != 0
+  </pre>
+
+  There are separate functions for floating point and 32-, 16- and 8-bit integer data types. The
+  XPULPV2 kernels for 16- and 8-bit integers compare two or four elements with a single SIMD
+  comparison, and count the nonzero elements with popcount. The select only moves bits, hence the
+  float version uses the 32-bit integer kernels and also runs on the fabric controller. A float
+  comparison with NaN is always false, and -0.0f is equal to 0.0f.
+ */
+
+/**
+  @addtogroup BasicCompare
+  @{
+ */
+
+/**
+  @brief Glue code for the greater-than comparison of a 32-bit integer vector with a threshold.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pMask      points to the output bitmask of (blockSize + 31) / 32 words
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  threshold  value every element is compared with
+  @return     none
+ */
+
+void plp_cmp_gt_i32(const int32_t *pSrc,
+                    uint32_t *pMask,
+                    uint32_t blockSize,
+                    int32_t threshold) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmp_gt_i32s_rv32im(pSrc, pMask, blockSize, threshold);
+    } else {
+        plp_cmp_gt_i32s_xpulpv2(pSrc, pMask, blockSize, threshold);
+    }
+}
+
+/**
+  @} end of BasicCompare group
+ */
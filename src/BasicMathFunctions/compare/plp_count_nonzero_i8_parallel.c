@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_count_nonzero_i8_parallel.c
+ * Description:  8-bit integer parallel vector nonzero count glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicCompare
+  @{
+ */
+
+/**
+  @brief Glue code for counting the nonzero elements of an 8-bit integer vector in parallel.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pRes       number of nonzero elements returned here
+  @return     none
+
+  @par Every core counts a contiguous chunk of the input. The partial counts are added after the
+  join, without a further fork.
+ */
+
+void plp_count_nonzero_i8_parallel(const int8_t *pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t nPE,
+                                   uint32_t *pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t i;
+        uint32_t resBuffer[nPE];
+
+        plp_count_nonzero_instance_i8 S = { .pSrc = pSrc,
+                                            .blockSize = blockSize,
+                                            .nPE = nPE,
+                                            .resBuffer = resBuffer };
+
+        rt_team_fork(nPE, plp_count_nonzero_i8p_xpulpv2, (void *)&S);
+
+        uint32_t cnt = 0;
+
+        for (i = 0; i < nPE; i++) {
+            cnt += resBuffer[i];
+        }
+
+        *pRes = cnt;
+    }
+}
+
+/**
+  @} end of BasicCompare group
+ */
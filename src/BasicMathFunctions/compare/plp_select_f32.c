@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_select_f32.c
+ * Description:  32-bit float vector selection with a bitmask glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicCompare
+  @{
+ */
+
+/**
+  @brief Glue code for the selection of 32-bit float elements with a bitmask.
+  @param[in]  pMask      points to the bitmask, with the layout of plp_cmp_gt
+  @param[in]  pSrcA      points to the vector selected where the bit of the mask is set
+  @param[in]  pSrcB      points to the vector selected where the bit of the mask is cleared
+  @param[out] pDst       points to the output vector, may be equal to pSrcA or pSrcB
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+
+  @par
+  The selection only moves bits, hence it uses the 32-bit integer kernels, also on the fabric
+  controller.
+ */
+
+void plp_select_f32(const uint32_t *pMask,
+                    const float32_t *pSrcA,
+                    const float32_t *pSrcB,
+                    float32_t *pDst,
+                    uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_select_i32s_rv32im(pMask, (const int32_t *)pSrcA, (const int32_t *)pSrcB,
+                               (int32_t *)pDst, blockSize);
+    } else {
+        plp_select_i32s_xpulpv2(pMask, (const int32_t *)pSrcA, (const int32_t *)pSrcB,
+                                (int32_t *)pDst, blockSize);
+    }
+}
+
+/**
+  @} end of BasicCompare group
+ */
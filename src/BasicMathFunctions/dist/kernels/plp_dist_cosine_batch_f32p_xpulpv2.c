@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dist_cosine_batch_f32p_xpulpv2.c
+ * Description:  Parallel cosine distances of a 32-bit float query to a codebook on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDist
+ */
+
+/**
+  @addtogroup BasicDistKernels
+  @{
+ */
+
+/**
+  @brief Parallel cosine distances of a 32-bit float query to a codebook for XPULPV2 extension.
+  @param[in]  args  pointer to plp_dist_batch_instance_f32 struct initialized by
+                    plp_dist_cosine_batch_f32_parallel
+  @return     none
+
+  @par Parallelization
+  Every core computes the distances to a contiguous chunk of the codebook with
+  plp_dist_cosine_batch_f32s_xpulpv2, and returns the nearest vector of its chunk in
+  pMin[core_id] and pIndex[core_id].
+ */
+
+void plp_dist_cosine_batch_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_dist_batch_instance_f32 *a = (plp_dist_batch_instance_f32 *)args;
+
+    uint32_t blockSize = a->blockSize;
+    uint32_t nVec = a->nVec;
+    uint32_t nPE = a->nPE;
+
+    uint32_t chunk = (nVec + nPE - 1) / nPE;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > nVec) {
+        start = nVec;
+    }
+    if (end > nVec) {
+        end = nVec;
+    }
+
+    if (start < end) {
+        plp_dist_cosine_batch_f32s_xpulpv2(a->pSrcQ,
+                                   &a->pCodebook[start * blockSize],
+                                   blockSize,
+                                   end - start,
+                                   (a->pDist != NULL) ? &a->pDist[start] : NULL,
+                                   &a->pMin[core_id],
+                                   &a->pIndex[core_id]);
+        a->pIndex[core_id] += start;
+    }
+}
+
+/**
+  @} end of BasicDistKernels group
+ */
@@ -0,0 +1,237 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dist_cosine_batch_i8s_xpulpv2.c
+ * Description:  Cosine distances of a 8-bit integer query to a codebook on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// square root of a 64 bit integer, rounded down
+static uint32_t isqrt64(uint64_t x) {
+    uint64_t res = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)res;
+}
+
+// cosine distance 1 - dot / sqrt(qq * vv) in Q16 format. The product of the norms is scaled up by
+// an even number of bits before the square root, such that it keeps 30 significant bits.
+static int32_t cosine_dist_q16(int32_t dot, uint32_t qq, uint32_t vv) {
+    uint64_t prod = (uint64_t)qq * vv;
+    uint32_t shift = 0;
+
+    if (prod == 0) {
+        return 1 << 16;
+    }
+    while (prod < ((uint64_t)1 << 60)) {
+        prod <<= 2;
+        shift++;
+    }
+
+    return (1 << 16) - (int32_t)((int64_t)dot * ((int64_t)1 << (16 + shift)) / isqrt64(prod));
+}
+
+/**
+  @ingroup BasicDist
+ */
+
+/**
+  @defgroup BasicDistKernels Vector Distance Kernels
+ */
+
+/**
+  @addtogroup BasicDistKernels
+  @{
+ */
+
+/**
+  @brief Cosine distances of a 8-bit integer query to a codebook for XPULPV2 extension.
+  @param[in]  pSrcQ      points to the query vector
+  @param[in]  pCodebook  points to the nVec vectors of blockSize samples, stored row by row
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nVec       number of vectors in the codebook, at least 1
+  @param[out] pDist      points to the nVec distances in Q16, or NULL if only the nearest
+                        vector is needed
+  @param[out] pMin       distance to the nearest vector in Q16 returned here
+  @param[out] pIndex     index of the nearest vector returned here, the first one on ties
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The dot product and the squared norm of every vector are accumulated with packed dot
+  products. The square root of the product of the norms is taken with integers only.
+ */
+
+void plp_dist_cosine_batch_i8s_xpulpv2(const int8_t *__restrict__ pSrcQ,
+                                       const int8_t *__restrict__ pCodebook,
+                                       uint32_t blockSize,
+                                       uint32_t nVec,
+                                       int32_t *__restrict__ pDist,
+                                       int32_t *__restrict__ pMin,
+                                       uint32_t *__restrict__ pIndex) {
+
+    uint32_t i, k; // loop counters
+    v4s q, v;
+    int32_t qs;
+    int32_t vs;
+    uint32_t qq = 0;
+    int32_t dist;
+    int32_t min = INT32_MAX;
+    uint32_t minIndex = 0;
+
+    // the squared norm of the query is needed for every vector
+    for (i = 0; i < blockSize; i++) {
+        qq += (int32_t)pSrcQ[i] * pSrcQ[i];
+    }
+
+    for (k = 0; k + 3 < nVec; k += 4) {
+        const int8_t *pV0 = &pCodebook[k * blockSize];
+        const int8_t *pV1 = &pCodebook[(k + 1) * blockSize];
+        const int8_t *pV2 = &pCodebook[(k + 2) * blockSize];
+        const int8_t *pV3 = &pCodebook[(k + 3) * blockSize];
+        int32_t dot0 = 0, dot1 = 0, dot2 = 0, dot3 = 0;
+        int32_t pow0 = 0, pow1 = 0, pow2 = 0, pow3 = 0;
+
+        // every word of the query (4 samples) is loaded once for the four vectors
+        for (i = 0; i + 3 < blockSize; i += 4) {
+            q = *((v4s *)&pSrcQ[i]);
+            v = *((v4s *)&pV0[i]);
+            dot0 = __SUMDOTP4(q, v, dot0);
+            pow0 = __SUMDOTP4(v, v, pow0);
+            v = *((v4s *)&pV1[i]);
+            dot1 = __SUMDOTP4(q, v, dot1);
+            pow1 = __SUMDOTP4(v, v, pow1);
+            v = *((v4s *)&pV2[i]);
+            dot2 = __SUMDOTP4(q, v, dot2);
+            pow2 = __SUMDOTP4(v, v, pow2);
+            v = *((v4s *)&pV3[i]);
+            dot3 = __SUMDOTP4(q, v, dot3);
+            pow3 = __SUMDOTP4(v, v, pow3);
+        }
+
+        // leftover samples
+        for (; i < blockSize; i++) {
+            qs = pSrcQ[i];
+            vs = pV0[i];
+            dot0 += qs * vs;
+            pow0 += vs * vs;
+            vs = pV1[i];
+            dot1 += qs * vs;
+            pow1 += vs * vs;
+            vs = pV2[i];
+            dot2 += qs * vs;
+            pow2 += vs * vs;
+            vs = pV3[i];
+            dot3 += qs * vs;
+            pow3 += vs * vs;
+        }
+
+        dist = cosine_dist_q16(dot0, qq, (uint32_t)pow0);
+        if (pDist != NULL) {
+            pDist[k] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k;
+        }
+
+        dist = cosine_dist_q16(dot1, qq, (uint32_t)pow1);
+        if (pDist != NULL) {
+            pDist[k + 1] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k + 1;
+        }
+
+        dist = cosine_dist_q16(dot2, qq, (uint32_t)pow2);
+        if (pDist != NULL) {
+            pDist[k + 2] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k + 2;
+        }
+
+        dist = cosine_dist_q16(dot3, qq, (uint32_t)pow3);
+        if (pDist != NULL) {
+            pDist[k + 3] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k + 3;
+        }
+    }
+
+    // leftover vectors
+    for (; k < nVec; k++) {
+        const int8_t *pV0 = &pCodebook[k * blockSize];
+        int32_t dot0 = 0;
+        int32_t pow0 = 0;
+
+        for (i = 0; i + 3 < blockSize; i += 4) {
+            q = *((v4s *)&pSrcQ[i]);
+            v = *((v4s *)&pV0[i]);
+            dot0 = __SUMDOTP4(q, v, dot0);
+            pow0 = __SUMDOTP4(v, v, pow0);
+        }
+
+        // leftover samples
+        for (; i < blockSize; i++) {
+            qs = pSrcQ[i];
+            vs = pV0[i];
+            dot0 += qs * vs;
+            pow0 += vs * vs;
+        }
+
+        dist = cosine_dist_q16(dot0, qq, (uint32_t)pow0);
+        if (pDist != NULL) {
+            pDist[k] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k;
+        }
+    }
+
+    *pMin = min;
+    *pIndex = minIndex;
+}
+
+/**
+  @} end of BasicDistKernels group
+ */
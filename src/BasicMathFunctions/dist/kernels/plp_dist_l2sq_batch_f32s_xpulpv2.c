@@ -0,0 +1,156 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dist_l2sq_batch_f32s_xpulpv2.c
+ * Description:  Squared l2 distances of a 32-bit float query to a codebook on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDist
+ */
+
+/**
+  @defgroup BasicDistKernels Vector Distance Kernels
+ */
+
+/**
+  @addtogroup BasicDistKernels
+  @{
+ */
+
+/**
+  @brief Squared L2 distances of a 32-bit float query to a codebook for XPULPV2 extension.
+  @param[in]  pSrcQ      points to the query vector
+  @param[in]  pCodebook  points to the nVec vectors of blockSize samples, stored row by row
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nVec       number of vectors in the codebook, at least 1
+  @param[out] pDist      points to the nVec distances, or NULL if only the nearest
+                        vector is needed
+  @param[out] pMin       distance to the nearest vector returned here
+  @param[out] pIndex     index of the nearest vector returned here, the first one on ties
+  @return     none
+ */
+
+void plp_dist_l2sq_batch_f32s_xpulpv2(const float32_t *__restrict__ pSrcQ,
+                                      const float32_t *__restrict__ pCodebook,
+                                      uint32_t blockSize,
+                                      uint32_t nVec,
+                                      float32_t *__restrict__ pDist,
+                                      float32_t *__restrict__ pMin,
+                                      uint32_t *__restrict__ pIndex) {
+
+    uint32_t i, k; // loop counters
+    float32_t q;
+    float32_t d;
+    float32_t dist;
+    float32_t min = INFINITY;
+    uint32_t minIndex = 0;
+
+    for (k = 0; k + 3 < nVec; k += 4) {
+        const float32_t *pV0 = &pCodebook[k * blockSize];
+        const float32_t *pV1 = &pCodebook[(k + 1) * blockSize];
+        const float32_t *pV2 = &pCodebook[(k + 2) * blockSize];
+        const float32_t *pV3 = &pCodebook[(k + 3) * blockSize];
+        float32_t sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+
+        // every sample of the query is loaded once for the four vectors
+        for (i = 0; i < blockSize; i++) {
+            q = pSrcQ[i];
+            d = q - pV0[i];
+            sum0 += d * d;
+            d = q - pV1[i];
+            sum1 += d * d;
+            d = q - pV2[i];
+            sum2 += d * d;
+            d = q - pV3[i];
+            sum3 += d * d;
+        }
+
+        dist = sum0;
+        if (pDist != NULL) {
+            pDist[k] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k;
+        }
+
+        dist = sum1;
+        if (pDist != NULL) {
+            pDist[k + 1] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k + 1;
+        }
+
+        dist = sum2;
+        if (pDist != NULL) {
+            pDist[k + 2] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k + 2;
+        }
+
+        dist = sum3;
+        if (pDist != NULL) {
+            pDist[k + 3] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k + 3;
+        }
+    }
+
+    // leftover vectors
+    for (; k < nVec; k++) {
+        const float32_t *pV0 = &pCodebook[k * blockSize];
+        float32_t sum0 = 0.0f;
+
+        for (i = 0; i < blockSize; i++) {
+            q = pSrcQ[i];
+            d = q - pV0[i];
+            sum0 += d * d;
+        }
+
+        dist = sum0;
+        if (pDist != NULL) {
+            pDist[k] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k;
+        }
+    }
+
+    *pMin = min;
+    *pIndex = minIndex;
+}
+
+/**
+  @} end of BasicDistKernels group
+ */
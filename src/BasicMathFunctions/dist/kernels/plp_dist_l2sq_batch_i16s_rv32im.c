@@ -0,0 +1,156 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dist_l2sq_batch_i16s_rv32im.c
+ * Description:  Squared l2 distances of a 16-bit integer query to a codebook on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDist
+ */
+
+/**
+  @defgroup BasicDistKernels Vector Distance Kernels
+ */
+
+/**
+  @addtogroup BasicDistKernels
+  @{
+ */
+
+/**
+  @brief Squared L2 distances of a 16-bit integer query vector to a codebook for RV32IM extension.
+  @param[in]  pSrcQ      points to the query vector
+  @param[in]  pCodebook  points to the nVec vectors of blockSize samples, stored row by row
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nVec       number of vectors in the codebook, at least 1
+  @param[out] pDist      points to the nVec distances, or NULL if only the nearest
+                        vector is needed
+  @param[out] pMin       distance to the nearest vector returned here
+  @param[out] pIndex     index of the nearest vector returned here, the first one on ties
+  @return     none
+ */
+
+void plp_dist_l2sq_batch_i16s_rv32im(const int16_t *__restrict__ pSrcQ,
+                                     const int16_t *__restrict__ pCodebook,
+                                     uint32_t blockSize,
+                                     uint32_t nVec,
+                                     int32_t *__restrict__ pDist,
+                                     int32_t *__restrict__ pMin,
+                                     uint32_t *__restrict__ pIndex) {
+
+    uint32_t i, k; // loop counters
+    int32_t q;
+    int32_t d;
+    int32_t dist;
+    int32_t min = INT32_MAX;
+    uint32_t minIndex = 0;
+
+    for (k = 0; k + 3 < nVec; k += 4) {
+        const int16_t *pV0 = &pCodebook[k * blockSize];
+        const int16_t *pV1 = &pCodebook[(k + 1) * blockSize];
+        const int16_t *pV2 = &pCodebook[(k + 2) * blockSize];
+        const int16_t *pV3 = &pCodebook[(k + 3) * blockSize];
+        int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+        // every sample of the query is loaded once for the four vectors
+        for (i = 0; i < blockSize; i++) {
+            q = pSrcQ[i];
+            d = q - pV0[i];
+            sum0 += d * d;
+            d = q - pV1[i];
+            sum1 += d * d;
+            d = q - pV2[i];
+            sum2 += d * d;
+            d = q - pV3[i];
+            sum3 += d * d;
+        }
+
+        dist = sum0;
+        if (pDist != NULL) {
+            pDist[k] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k;
+        }
+
+        dist = sum1;
+        if (pDist != NULL) {
+            pDist[k + 1] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k + 1;
+        }
+
+        dist = sum2;
+        if (pDist != NULL) {
+            pDist[k + 2] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k + 2;
+        }
+
+        dist = sum3;
+        if (pDist != NULL) {
+            pDist[k + 3] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k + 3;
+        }
+    }
+
+    // leftover vectors
+    for (; k < nVec; k++) {
+        const int16_t *pV0 = &pCodebook[k * blockSize];
+        int32_t sum0 = 0;
+
+        for (i = 0; i < blockSize; i++) {
+            q = pSrcQ[i];
+            d = q - pV0[i];
+            sum0 += d * d;
+        }
+
+        dist = sum0;
+        if (pDist != NULL) {
+            pDist[k] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k;
+        }
+    }
+
+    *pMin = min;
+    *pIndex = minIndex;
+}
+
+/**
+  @} end of BasicDistKernels group
+ */
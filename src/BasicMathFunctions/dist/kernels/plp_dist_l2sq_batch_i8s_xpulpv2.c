@@ -0,0 +1,200 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dist_l2sq_batch_i8s_xpulpv2.c
+ * Description:  Squared l2 distances of a 8-bit integer query to a codebook on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDist
+ */
+
+/**
+  @defgroup BasicDistKernels Vector Distance Kernels
+ */
+
+/**
+  @addtogroup BasicDistKernels
+  @{
+ */
+
+/**
+  @brief Squared L2 distances of a 8-bit integer query to a codebook for XPULPV2 extension.
+  @param[in]  pSrcQ      points to the query vector
+  @param[in]  pCodebook  points to the nVec vectors of blockSize samples, stored row by row
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nVec       number of vectors in the codebook, at least 1
+  @param[out] pDist      points to the nVec distances, or NULL if only the nearest
+                        vector is needed
+  @param[out] pMin       distance to the nearest vector returned here
+  @param[out] pIndex     index of the nearest vector returned here, the first one on ties
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The differences of packed samples would overflow, so the distance is computed as
+  |q|^2 + |v|^2 - 2 * dot(q, v) with packed dot products, which is exact in 32 bits
+  whenever the distance itself fits.
+ */
+
+void plp_dist_l2sq_batch_i8s_xpulpv2(const int8_t *__restrict__ pSrcQ,
+                                     const int8_t *__restrict__ pCodebook,
+                                     uint32_t blockSize,
+                                     uint32_t nVec,
+                                     int32_t *__restrict__ pDist,
+                                     int32_t *__restrict__ pMin,
+                                     uint32_t *__restrict__ pIndex) {
+
+    uint32_t i, k; // loop counters
+    v4s q, v;
+    int32_t qs;
+    int32_t vs;
+    uint32_t qq = 0;
+    int32_t dist;
+    int32_t min = INT32_MAX;
+    uint32_t minIndex = 0;
+
+    // the squared norm of the query is needed for every vector
+    for (i = 0; i < blockSize; i++) {
+        qq += (int32_t)pSrcQ[i] * pSrcQ[i];
+    }
+
+    for (k = 0; k + 3 < nVec; k += 4) {
+        const int8_t *pV0 = &pCodebook[k * blockSize];
+        const int8_t *pV1 = &pCodebook[(k + 1) * blockSize];
+        const int8_t *pV2 = &pCodebook[(k + 2) * blockSize];
+        const int8_t *pV3 = &pCodebook[(k + 3) * blockSize];
+        int32_t dot0 = 0, dot1 = 0, dot2 = 0, dot3 = 0;
+        int32_t pow0 = 0, pow1 = 0, pow2 = 0, pow3 = 0;
+
+        // every word of the query (4 samples) is loaded once for the four vectors
+        for (i = 0; i + 3 < blockSize; i += 4) {
+            q = *((v4s *)&pSrcQ[i]);
+            v = *((v4s *)&pV0[i]);
+            dot0 = __SUMDOTP4(q, v, dot0);
+            pow0 = __SUMDOTP4(v, v, pow0);
+            v = *((v4s *)&pV1[i]);
+            dot1 = __SUMDOTP4(q, v, dot1);
+            pow1 = __SUMDOTP4(v, v, pow1);
+            v = *((v4s *)&pV2[i]);
+            dot2 = __SUMDOTP4(q, v, dot2);
+            pow2 = __SUMDOTP4(v, v, pow2);
+            v = *((v4s *)&pV3[i]);
+            dot3 = __SUMDOTP4(q, v, dot3);
+            pow3 = __SUMDOTP4(v, v, pow3);
+        }
+
+        // leftover samples
+        for (; i < blockSize; i++) {
+            qs = pSrcQ[i];
+            vs = pV0[i];
+            dot0 += qs * vs;
+            pow0 += vs * vs;
+            vs = pV1[i];
+            dot1 += qs * vs;
+            pow1 += vs * vs;
+            vs = pV2[i];
+            dot2 += qs * vs;
+            pow2 += vs * vs;
+            vs = pV3[i];
+            dot3 += qs * vs;
+            pow3 += vs * vs;
+        }
+
+        dist = (int32_t)(qq + pow0 - 2 * dot0);
+        if (pDist != NULL) {
+            pDist[k] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k;
+        }
+
+        dist = (int32_t)(qq + pow1 - 2 * dot1);
+        if (pDist != NULL) {
+            pDist[k + 1] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k + 1;
+        }
+
+        dist = (int32_t)(qq + pow2 - 2 * dot2);
+        if (pDist != NULL) {
+            pDist[k + 2] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k + 2;
+        }
+
+        dist = (int32_t)(qq + pow3 - 2 * dot3);
+        if (pDist != NULL) {
+            pDist[k + 3] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k + 3;
+        }
+    }
+
+    // leftover vectors
+    for (; k < nVec; k++) {
+        const int8_t *pV0 = &pCodebook[k * blockSize];
+        int32_t dot0 = 0;
+        int32_t pow0 = 0;
+
+        for (i = 0; i + 3 < blockSize; i += 4) {
+            q = *((v4s *)&pSrcQ[i]);
+            v = *((v4s *)&pV0[i]);
+            dot0 = __SUMDOTP4(q, v, dot0);
+            pow0 = __SUMDOTP4(v, v, pow0);
+        }
+
+        // leftover samples
+        for (; i < blockSize; i++) {
+            qs = pSrcQ[i];
+            vs = pV0[i];
+            dot0 += qs * vs;
+            pow0 += vs * vs;
+        }
+
+        dist = (int32_t)(qq + pow0 - 2 * dot0);
+        if (pDist != NULL) {
+            pDist[k] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k;
+        }
+    }
+
+    *pMin = min;
+    *pIndex = minIndex;
+}
+
+/**
+  @} end of BasicDistKernels group
+ */
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dtw_f32p_xpulpv2.c
+ * Description:  Parallel DTW distances of a 32-bit float query to templates for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDtw
+ */
+
+/**
+  @addtogroup BasicDtwKernels
+  @{
+ */
+
+/**
+  @brief Parallel DTW distances of a 32-bit float query to templates for XPULPV2 extension.
+  @param[in]  args  pointer to plp_dtw_instance_f32 struct initialized by plp_dtw_f32_parallel
+  @return     none
+
+  @par Parallelization
+  Every core computes the distances to a contiguous chunk of the templates with
+  plp_dtw_f32s_xpulpv2 and its own lenT values of pTmp, and returns the nearest template of its
+  chunk in pMin[core_id] and pIndex[core_id].
+ */
+
+void plp_dtw_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_dtw_instance_f32 *a = (plp_dtw_instance_f32 *)args;
+
+    uint32_t lenT = a->lenT;
+    uint32_t nTemplates = a->nTemplates;
+    uint32_t nPE = a->nPE;
+
+    uint32_t chunk = (nTemplates + nPE - 1) / nPE;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > nTemplates) {
+        start = nTemplates;
+    }
+    if (end > nTemplates) {
+        end = nTemplates;
+    }
+
+    if (start < end) {
+        plp_dtw_f32s_xpulpv2(a->pSrcQ, a->lenQ, &a->pTemplates[start * lenT], lenT, end - start,
+                             a->band, &a->pTmp[core_id * lenT],
+                             (a->pDist != NULL) ? &a->pDist[start] : NULL, &a->pMin[core_id],
+                             &a->pIndex[core_id]);
+        a->pIndex[core_id] += start;
+    }
+}
+
+/**
+  @} end of BasicDtwKernels group
+ */
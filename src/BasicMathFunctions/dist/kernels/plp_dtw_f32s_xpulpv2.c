@@ -0,0 +1,194 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dtw_f32s_xpulpv2.c
+ * Description:  DTW distances of a 32-bit float query to templates for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// DTW distance of the query to one template, with the cost row pRow of lenT values
+static float32_t dtw_f32_xpulpv2(const float32_t *__restrict__ pSrcQ,
+                                 uint32_t lenQ,
+                                 const float32_t *__restrict__ pSrcT,
+                                 uint32_t lenT,
+                                 uint32_t band,
+                                 float32_t *__restrict__ pRow) {
+
+    uint32_t i, j; // loop counters
+    float32_t t, d0, d1;
+    float32_t m, c0, c1;
+
+    if (lenQ > lenT + band || lenT > lenQ + band) {
+        return INFINITY;
+    }
+
+    for (j = 0; j < lenT; j++) {
+        pRow[j] = INFINITY;
+    }
+
+    // pRow holds the row i-1 of the cost matrix, and is overwritten with the row i+1. The band of
+    // the row i+1 starts and ends at most one cell after the one of the row i, hence the first
+    // cell of the row i and the last cell of the row i+1 may be alone. The cells left of the band
+    // are never read again, and the cells right of the band have not been written yet.
+    for (i = 0; i + 1 < lenQ; i += 2) {
+        float32_t q0 = pSrcQ[i];
+        float32_t q1 = pSrcQ[i + 1];
+        uint32_t lo0 = (i > band) ? i - band : 0;
+        uint32_t lo1 = (i + 1 > band) ? i + 1 - band : 0;
+        uint32_t hi0 = (i + band + 1 < lenT) ? i + band + 1 : lenT;
+        uint32_t hi1 = (i + band + 2 < lenT) ? i + band + 2 : lenT;
+        float32_t diag0 = (lo0 > 0) ? pRow[lo0 - 1] : (i == 0) ? 0.0f : INFINITY;
+        float32_t left0 = INFINITY;
+        float32_t left1 = INFINITY;
+
+        j = lo0;
+        if (lo1 > lo0) {
+            float32_t up0 = pRow[j];
+
+            d0 = q0 - pSrcT[j];
+            m = fminf(diag0, up0);
+            left0 = m + fabsf(d0);
+            diag0 = up0;
+            j++;
+        }
+
+        // the cells (i, j) and (i+1, j) share the template sample, and the cell (i, j) is the
+        // upper neighbor of (i+1, j) and the diagonal one of (i+1, j+1)
+        for (; j < hi0; j++) {
+            float32_t up0 = pRow[j];
+
+            t = pSrcT[j];
+            d0 = q0 - t;
+            d1 = q1 - t;
+            m = fminf(diag0, up0);
+            m = fminf(left0, m);
+            c0 = m + fabsf(d0);
+            m = fminf(left0, c0);
+            m = fminf(left1, m);
+            c1 = m + fabsf(d1);
+            pRow[j] = c1;
+            diag0 = up0;
+            left0 = c0;
+            left1 = c1;
+        }
+
+        if (hi1 > hi0) {
+            d1 = q1 - pSrcT[j];
+            m = fminf(left0, left1);
+            pRow[j] = m + fabsf(d1);
+        }
+    }
+
+    if (i < lenQ) {
+        float32_t q0 = pSrcQ[i];
+        uint32_t lo0 = (i > band) ? i - band : 0;
+        uint32_t hi0 = (i + band + 1 < lenT) ? i + band + 1 : lenT;
+        float32_t diag0 = (lo0 > 0) ? pRow[lo0 - 1] : (i == 0) ? 0.0f : INFINITY;
+        float32_t left0 = INFINITY;
+
+        for (j = lo0; j < hi0; j++) {
+            float32_t up0 = pRow[j];
+
+            d0 = q0 - pSrcT[j];
+            m = fminf(diag0, up0);
+            m = fminf(left0, m);
+            left0 = m + fabsf(d0);
+            pRow[j] = left0;
+            diag0 = up0;
+        }
+    }
+
+    return pRow[lenT - 1];
+}
+
+/**
+  @ingroup BasicDtw
+ */
+
+/**
+  @addtogroup BasicDtwKernels
+  @{
+ */
+
+/**
+  @brief DTW distances of a 32-bit float query sequence to templates for XPULPV2 extension.
+  @param[in]  pSrcQ       points to the query sequence of lenQ samples
+  @param[in]  lenQ        number of samples of the query, at least 1
+  @param[in]  pTemplates  points to the nTemplates templates of lenT samples, stored row by row
+  @param[in]  lenT        number of samples of every template, at least 1
+  @param[in]  nTemplates  number of templates, at least 1
+  @param[in]  band        Sakoe-Chiba band, the largest |i - j| of the aligned samples
+  @param[in]  pTmp        points to a temporary buffer of lenT values
+  @param[out] pDist       points to the nTemplates distances, or NULL if only the nearest
+                          template is needed
+  @param[out] pMin        distance to the nearest template returned here
+  @param[out] pIndex      index of the nearest template returned here, the first one on ties
+  @return     none
+
+  @par
+  Two rows of the cost matrix are computed in one pass, such that every template sample and
+  every value of the cost row is loaded once for two cells, and the cell of the second row
+  takes its upper and diagonal neighbors from registers. The three-way minimum and the absolute
+  difference map to fmin.s and fabs.s.
+ */
+
+void plp_dtw_f32s_xpulpv2(const float32_t *__restrict__ pSrcQ,
+                          uint32_t lenQ,
+                          const float32_t *__restrict__ pTemplates,
+                          uint32_t lenT,
+                          uint32_t nTemplates,
+                          uint32_t band,
+                          float32_t *__restrict__ pTmp,
+                          float32_t *__restrict__ pDist,
+                          float32_t *__restrict__ pMin,
+                          uint32_t *__restrict__ pIndex) {
+
+    uint32_t k; // loop counter
+    float32_t dist;
+    float32_t min = INFINITY;
+    uint32_t minIndex = 0;
+
+    if (band > lenQ + lenT) {
+        band = lenQ + lenT;
+    }
+
+    for (k = 0; k < nTemplates; k++) {
+        dist = dtw_f32_xpulpv2(pSrcQ, lenQ, &pTemplates[k * lenT], lenT, band, pTmp);
+        if (pDist != NULL) {
+            pDist[k] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k;
+        }
+    }
+
+    *pMin = min;
+    *pIndex = minIndex;
+}
+
+/**
+  @} end of BasicDtwKernels group
+ */
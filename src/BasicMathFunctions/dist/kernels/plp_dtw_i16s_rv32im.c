@@ -0,0 +1,140 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dtw_i16s_rv32im.c
+ * Description:  DTW distances of a 16-bit integer query to templates for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// DTW distance of the query to one template, with the cost row pRow of lenT values
+static int32_t dtw_i16_rv32im(const int16_t *__restrict__ pSrcQ,
+                              uint32_t lenQ,
+                              const int16_t *__restrict__ pSrcT,
+                              uint32_t lenT,
+                              uint32_t band,
+                              int32_t *__restrict__ pRow) {
+
+    uint32_t i, j; // loop counters
+
+    if (lenQ > lenT + band || lenT > lenQ + band) {
+        return INT32_MAX;
+    }
+
+    for (j = 0; j < lenT; j++) {
+        pRow[j] = INT32_MAX;
+    }
+
+    // pRow holds the row i-1 of the cost matrix, and is overwritten with the row i from the left.
+    // The cells left of the band are never read again, and the cells right of the band have not
+    // been written yet, hence only the left neighbor of the first cell needs special care.
+    for (i = 0; i < lenQ; i++) {
+        int32_t q = pSrcQ[i];
+        uint32_t lo = (i > band) ? i - band : 0;
+        uint32_t hi = (i + band + 1 < lenT) ? i + band + 1 : lenT;
+        int32_t diag = (lo > 0) ? pRow[lo - 1] : (i == 0) ? 0 : INT32_MAX;
+        int32_t left = INT32_MAX;
+
+        for (j = lo; j < hi; j++) {
+            int32_t up = pRow[j];
+            int32_t d = q - pSrcT[j];
+            int32_t m = (diag < up) ? diag : up;
+
+            m = (left < m) ? left : m;
+            left = m + ((d < 0) ? -d : d);
+            pRow[j] = left;
+            diag = up;
+        }
+    }
+
+    return pRow[lenT - 1];
+}
+
+/**
+  @ingroup BasicDtw
+ */
+
+/**
+  @defgroup BasicDtwKernels Dynamic Time Warping Kernels
+ */
+
+/**
+  @addtogroup BasicDtwKernels
+  @{
+ */
+
+/**
+  @brief DTW distances of a 16-bit integer query sequence to templates for RV32IM extension.
+  @param[in]  pSrcQ       points to the query sequence of lenQ samples
+  @param[in]  lenQ        number of samples of the query, at least 1
+  @param[in]  pTemplates  points to the nTemplates templates of lenT samples, stored row by row
+  @param[in]  lenT        number of samples of every template, at least 1
+  @param[in]  nTemplates  number of templates, at least 1
+  @param[in]  band        Sakoe-Chiba band, the largest |i - j| of the aligned samples
+  @param[in]  pTmp        points to a temporary buffer of lenT values
+  @param[out] pDist       points to the nTemplates distances, or NULL if only the nearest
+                          template is needed
+  @param[out] pMin        distance to the nearest template returned here
+  @param[out] pIndex      index of the nearest template returned here, the first one on ties
+  @return     none
+ */
+
+void plp_dtw_i16s_rv32im(const int16_t *__restrict__ pSrcQ,
+                         uint32_t lenQ,
+                         const int16_t *__restrict__ pTemplates,
+                         uint32_t lenT,
+                         uint32_t nTemplates,
+                         uint32_t band,
+                         int32_t *__restrict__ pTmp,
+                         int32_t *__restrict__ pDist,
+                         int32_t *__restrict__ pMin,
+                         uint32_t *__restrict__ pIndex) {
+
+    uint32_t k; // loop counter
+    int32_t dist;
+    int32_t min = INT32_MAX;
+    uint32_t minIndex = 0;
+
+    if (band > lenQ + lenT) {
+        band = lenQ + lenT;
+    }
+
+    for (k = 0; k < nTemplates; k++) {
+        dist = dtw_i16_rv32im(pSrcQ, lenQ, &pTemplates[k * lenT], lenT, band, pTmp);
+        if (pDist != NULL) {
+            pDist[k] = dist;
+        }
+        if (dist < min) {
+            min = dist;
+            minIndex = k;
+        }
+    }
+
+    *pMin = min;
+    *pIndex = minIndex;
+}
+
+/**
+  @} end of BasicDtwKernels group
+ */
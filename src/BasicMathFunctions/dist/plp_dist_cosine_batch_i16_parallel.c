@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dist_cosine_batch_i16_parallel.c
+ * Description:  Parallel cosine distances of a 16-bit integer query to a codebook glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDist
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel cosine distances of a 16-bit integer query to a codebook.
+  @param[in]  pSrcQ      points to the query vector
+  @param[in]  pCodebook  points to the nVec vectors of blockSize samples, stored row by row
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nVec       number of vectors in the codebook, at least 1
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDist      points to the nVec distances in Q16, or NULL if only the nearest
+                        vector is needed
+  @param[out] pMin       distance to the nearest vector in Q16 returned here
+  @param[out] pIndex     index of the nearest vector returned here, the first one on ties
+  @return     none
+
+  @par Parallelization
+  The codebook is split into contiguous chunks of vectors, one per core. The nearest vectors
+  of all cores are compared in core order after the join, so ties resolve to the first vector
+  as in the single core version.
+ */
+
+void plp_dist_cosine_batch_i16_parallel(const int16_t *__restrict__ pSrcQ,
+                                        const int16_t *__restrict__ pCodebook,
+                                        uint32_t blockSize,
+                                        uint32_t nVec,
+                                        uint32_t nPE,
+                                        int32_t *__restrict__ pDist,
+                                        int32_t *__restrict__ pMin,
+                                        uint32_t *__restrict__ pIndex) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t i;
+        uint32_t chunk = (nVec + nPE - 1) / nPE;
+        int32_t minBuffer[nPE];
+        uint32_t minIndexBuffer[nPE];
+
+        plp_dist_batch_instance_i16 args = { .pSrcQ = pSrcQ,
+                                             .pCodebook = pCodebook,
+                                             .blockSize = blockSize,
+                                             .nVec = nVec,
+                                             .nPE = nPE,
+                                             .pDist = pDist,
+                                             .pMin = minBuffer,
+                                             .pIndex = minIndexBuffer };
+        rt_team_fork(nPE, plp_dist_cosine_batch_i16p_xpulpv2, (void *)&args);
+
+        *pMin = minBuffer[0];
+        *pIndex = minIndexBuffer[0];
+
+        // only the cores with a non-empty chunk have a result
+        for (i = 1; i * chunk < nVec; i++) {
+            if (minBuffer[i] < *pMin) {
+                *pMin = minBuffer[i];
+                *pIndex = minIndexBuffer[i];
+            }
+        }
+    }
+}
+
+/**
+  @} end of BasicDist group
+ */
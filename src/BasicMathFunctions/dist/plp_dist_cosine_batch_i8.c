@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dist_cosine_batch_i8.c
+ * Description:  Cosine distances of a 8-bit integer query to a codebook glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @defgroup BasicDist Vector Distance
+  Distances of a query vector to all nVec rows of a codebook, stored as a matrix of nVec rows with
+  blockSize samples each, together with the index of the nearest row.
+  <pre>
+      L1:          pDist[k] = sum_i |pSrcQ[i] - pCodebook[k * blockSize + i]|
+      squared L2:  pDist[k] = sum_i (pSrcQ[i] - pCodebook[k * blockSize + i])^2
+      cosine:      pDist[k] = 1 - dot(pSrcQ, row k) / (|pSrcQ| * |row k|)
+  </pre>
+  The query is loaded once for four rows. The integer versions accumulate in 32 bits, as
+  plp_dot_prod_i16 and plp_dot_prod_i8, and return the cosine distance in Q16 format, with 1.0
+  represented by 2^16. The cosine distance to a row of zero norm is 1.0.
+ */
+
+/**
+  @addtogroup BasicDist
+  @{
+ */
+
+/**
+  @brief Glue code for the cosine distances of a 8-bit integer query vector to a codebook.
+  @param[in]  pSrcQ      points to the query vector
+  @param[in]  pCodebook  points to the nVec vectors of blockSize samples, stored row by row
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nVec       number of vectors in the codebook, at least 1
+  @param[out] pDist      points to the nVec distances in Q16, or NULL if only the nearest
+                        vector is needed
+  @param[out] pMin       distance to the nearest vector in Q16 returned here
+  @param[out] pIndex     index of the nearest vector returned here, the first one on ties
+  @return     none
+ */
+
+void plp_dist_cosine_batch_i8(const int8_t *__restrict__ pSrcQ,
+                              const int8_t *__restrict__ pCodebook,
+                              uint32_t blockSize,
+                              uint32_t nVec,
+                              int32_t *__restrict__ pDist,
+                              int32_t *__restrict__ pMin,
+                              uint32_t *__restrict__ pIndex) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_dist_cosine_batch_i8s_rv32im(pSrcQ, pCodebook, blockSize, nVec, pDist, pMin, pIndex);
+    } else {
+        plp_dist_cosine_batch_i8s_xpulpv2(pSrcQ, pCodebook, blockSize, nVec, pDist, pMin, pIndex);
+    }
+}
+
+/**
+  @} end of BasicDist group
+ */
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dtw_f32.c
+ * Description:  Glue code for the DTW distances of a 32-bit float query to templates
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDtw
+  @{
+ */
+
+/**
+  @brief Glue code for the DTW distances of a 32-bit float query sequence to templates.
+  @param[in]  pSrcQ       points to the query sequence of lenQ samples
+  @param[in]  lenQ        number of samples of the query, at least 1
+  @param[in]  pTemplates  points to the nTemplates templates of lenT samples, stored row by row
+  @param[in]  lenT        number of samples of every template, at least 1
+  @param[in]  nTemplates  number of templates, at least 1
+  @param[in]  band        Sakoe-Chiba band, the largest |i - j| of the aligned samples
+  @param[in]  pTmp        points to a temporary buffer of lenT values
+  @param[out] pDist       points to the nTemplates distances, or NULL if only the nearest
+                          template is needed
+  @param[out] pMin        distance to the nearest template returned here
+  @param[out] pIndex      index of the nearest template returned here, the first one on ties
+  @return     none
+ */
+
+void plp_dtw_f32(const float32_t *__restrict__ pSrcQ,
+                 uint32_t lenQ,
+                 const float32_t *__restrict__ pTemplates,
+                 uint32_t lenT,
+                 uint32_t nTemplates,
+                 uint32_t band,
+                 float32_t *__restrict__ pTmp,
+                 float32_t *__restrict__ pDist,
+                 float32_t *__restrict__ pMin,
+                 uint32_t *__restrict__ pIndex) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_dtw_f32s_xpulpv2(pSrcQ, lenQ, pTemplates, lenT, nTemplates, band, pTmp, pDist, pMin,
+                             pIndex);
+    }
+}
+
+/**
+  @} end of BasicDtw group
+ */
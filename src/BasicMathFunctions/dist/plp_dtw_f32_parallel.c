@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dtw_f32_parallel.c
+ * Description:  Glue code for the parallel DTW distances of a 32-bit float query to templates
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDtw
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel DTW distances of a 32-bit float query to templates.
+  @param[in]  pSrcQ       points to the query sequence of lenQ samples
+  @param[in]  lenQ        number of samples of the query, at least 1
+  @param[in]  pTemplates  points to the nTemplates templates of lenT samples, stored row by row
+  @param[in]  lenT        number of samples of every template, at least 1
+  @param[in]  nTemplates  number of templates, at least 1
+  @param[in]  band        Sakoe-Chiba band, the largest |i - j| of the aligned samples
+  @param[in]  nPE         number of parallel processing units
+  @param[in]  pTmp        points to a temporary buffer of nPE*lenT values
+  @param[out] pDist       points to the nTemplates distances, or NULL if only the nearest
+                          template is needed
+  @param[out] pMin        distance to the nearest template returned here
+  @param[out] pIndex      index of the nearest template returned here, the first one on ties
+  @return     none
+
+  @par Parallelization
+  The templates are split into contiguous chunks, one per core, and every core uses lenT values
+  of pTmp as its cost row. The nearest templates of all cores are compared in core order after
+  the join, so ties resolve to the first template as in the single core version.
+ */
+
+void plp_dtw_f32_parallel(const float32_t *__restrict__ pSrcQ,
+                          uint32_t lenQ,
+                          const float32_t *__restrict__ pTemplates,
+                          uint32_t lenT,
+                          uint32_t nTemplates,
+                          uint32_t band,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pTmp,
+                          float32_t *__restrict__ pDist,
+                          float32_t *__restrict__ pMin,
+                          uint32_t *__restrict__ pIndex) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t i;
+        uint32_t chunk = (nTemplates + nPE - 1) / nPE;
+        float32_t minBuffer[nPE];
+        uint32_t minIndexBuffer[nPE];
+
+        plp_dtw_instance_f32 args = { .pSrcQ = pSrcQ,
+                                     .lenQ = lenQ,
+                                     .pTemplates = pTemplates,
+                                     .lenT = lenT,
+                                     .nTemplates = nTemplates,
+                                     .band = band,
+                                     .nPE = nPE,
+                                     .pTmp = pTmp,
+                                     .pDist = pDist,
+                                     .pMin = minBuffer,
+                                     .pIndex = minIndexBuffer };
+        rt_team_fork(nPE, plp_dtw_f32p_xpulpv2, (void *)&args);
+
+        *pMin = minBuffer[0];
+        *pIndex = minIndexBuffer[0];
+
+        // only the cores with a non-empty chunk have a result
+        for (i = 1; i * chunk < nTemplates; i++) {
+            if (minBuffer[i] < *pMin) {
+                *pMin = minBuffer[i];
+                *pIndex = minIndexBuffer[i];
+            }
+        }
+    }
+}
+
+/**
+  @} end of BasicDtw group
+ */
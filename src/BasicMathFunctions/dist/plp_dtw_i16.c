@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dtw_i16.c
+ * Description:  Glue code for the DTW distances of a 16-bit integer query to templates
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @defgroup BasicDtw Dynamic Time Warping
+  Dynamic time warping (DTW) distances of a query sequence to all nTemplates rows of a template
+  matrix, stored as nTemplates rows of lenT samples each, together with the index of the nearest
+  template. The DTW distance of the query q and the template t is the cost D(lenQ-1, lenT-1) of
+  the cheapest monotonic alignment of both sequences, with
+
+  <pre>
+      D(i, j) = |q[i] - t[j]| + min(D(i-1, j-1), D(i-1, j), D(i, j-1))
+  </pre>
+
+  and D(-1, -1) = 0. An optional Sakoe-Chiba band leaves out the cells with |i - j| > band, which
+  saves time and forbids pathological alignments. A band of at least max(lenQ, lenT) computes the
+  full cost matrix, and if |lenQ - lenT| > band, no alignment exists and the distance is the
+  largest value (INT32_MAX or INFINITY).
+
+  The cost matrix is computed row by row, and only the last row of lenT values is kept in the
+  buffer pTmp. The integer version accumulates |q[i] - t[j]| in 32 bits, hence the sequences may
+  be at most 32768 samples long together. The parallel version splits the templates into
+  contiguous chunks, one per core.
+ */
+
+/**
+  @addtogroup BasicDtw
+  @{
+ */
+
+/**
+  @brief Glue code for the DTW distances of a 16-bit integer query sequence to templates.
+  @param[in]  pSrcQ       points to the query sequence of lenQ samples
+  @param[in]  lenQ        number of samples of the query, at least 1
+  @param[in]  pTemplates  points to the nTemplates templates of lenT samples, stored row by row
+  @param[in]  lenT        number of samples of every template, at least 1
+  @param[in]  nTemplates  number of templates, at least 1
+  @param[in]  band        Sakoe-Chiba band, the largest |i - j| of the aligned samples
+  @param[in]  pTmp        points to a temporary buffer of lenT values
+  @param[out] pDist       points to the nTemplates distances, or NULL if only the nearest
+                          template is needed
+  @param[out] pMin        distance to the nearest template returned here
+  @param[out] pIndex      index of the nearest template returned here, the first one on ties
+  @return     none
+ */
+
+void plp_dtw_i16(const int16_t *__restrict__ pSrcQ,
+                 uint32_t lenQ,
+                 const int16_t *__restrict__ pTemplates,
+                 uint32_t lenT,
+                 uint32_t nTemplates,
+                 uint32_t band,
+                 int32_t *__restrict__ pTmp,
+                 int32_t *__restrict__ pDist,
+                 int32_t *__restrict__ pMin,
+                 uint32_t *__restrict__ pIndex) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_dtw_i16s_rv32im(pSrcQ, lenQ, pTemplates, lenT, nTemplates, band, pTmp, pDist, pMin,
+                            pIndex);
+    } else {
+        plp_dtw_i16s_xpulpv2(pSrcQ, lenQ, pTemplates, lenT, nTemplates, band, pTmp, pDist, pMin,
+                             pIndex);
+    }
+}
+
+/**
+  @} end of BasicDtw group
+ */
@@ -0,0 +1,132 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_cols_i32_xpulpv2.c
+ * Description:  Column dot products of a 32-bit integer matrix kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Column dot products of a 32-bit integer matrix kernel for XPULPV2 extension.
+  @param[in]  pSrcA    points to the first input matrix of shape MxN
+  @param[in]  pSrcB    points to the second input matrix of shape MxN
+  @param[in]  M        height of both matrices, number of samples of every column
+  @param[in]  N        width of both matrices, number of columns
+  @param[in]  strideA  distance between two rows of pSrcA, in elements
+  @param[in]  strideB  distance between two rows of pSrcB, in elements
+  @param[out] pDst     points to the N dot products
+  @return     none
+ */
+
+void plp_dot_prod_cols_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    int32_t *__restrict__ pDst) {
+
+    uint32_t m, n;
+
+    // 4 adjacent columns per sweep over the rows, such that the samples of one row are loaded
+    // from consecutive addresses and every sum stays in a register
+    for (n = 0; n + 3 < N; n += 4) {
+        const int32_t *pColA = &pSrcA[n];
+        const int32_t *pColB = &pSrcB[n];
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        int32_t sum2 = 0;
+        int32_t sum3 = 0;
+        for (m = 0; m < M; m++) {
+            sum0 += pColA[0] * pColB[0];
+            sum1 += pColA[1] * pColB[1];
+            sum2 += pColA[2] * pColB[2];
+            sum3 += pColA[3] * pColB[3];
+            pColA += strideA;
+            pColB += strideB;
+        }
+        pDst[n + 0] = sum0;
+        pDst[n + 1] = sum1;
+        pDst[n + 2] = sum2;
+        pDst[n + 3] = sum3;
+    }
+
+    for (; n < N; n++) {
+        const int32_t *pColA = &pSrcA[n];
+        const int32_t *pColB = &pSrcB[n];
+        int32_t sum = 0;
+        for (m = 0; m < M; m++) {
+            sum += pColA[0] * pColB[0];
+            pColA += strideA;
+            pColB += strideB;
+        }
+        pDst[n] = sum;
+    }
+}
+
+/**
+  @brief Parallel column dot products of a 32-bit integer matrix kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_dot_prod_cols_instance_i32 struct initialized by
+                    plp_dot_prod_cols_i32_parallel
+  @return     none
+
+  @par Parallelization
+  The columns are split into contiguous chunks, one per core, and every core computes the column dot
+  products of its chunk with plp_dot_prod_cols_i32s_xpulpv2. In every row, the cores load from
+  neighbouring addresses, which are in different banks, and every result is written by exactly one
+  core, so no reduction is needed.
+ */
+
+void plp_dot_prod_cols_i32p_xpulpv2(void *args) {
+
+    plp_dot_prod_cols_instance_i32 *a = (plp_dot_prod_cols_instance_i32 *)args;
+
+    uint32_t start, end;
+
+    plp_team_chunk(a->N, a->nPE, rt_core_id(), 1, &start, &end);
+
+    if (start < end) {
+        plp_dot_prod_cols_i32s_xpulpv2(a->pSrcA + start,
+                                       a->pSrcB + start,
+                                       a->M,
+                                       end - start,
+                                       a->strideA,
+                                       a->strideB,
+                                       a->pDst + start);
+    }
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_cols_i32s_rv32im.c
+ * Description:  Column dot products of a 32-bit integer matrix kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Column dot products of a 32-bit integer matrix kernel for RV32IM extension.
+  @param[in]  pSrcA    points to the first input matrix of shape MxN
+  @param[in]  pSrcB    points to the second input matrix of shape MxN
+  @param[in]  M        height of both matrices, number of samples of every column
+  @param[in]  N        width of both matrices, number of columns
+  @param[in]  strideA  distance between two rows of pSrcA, in elements
+  @param[in]  strideB  distance between two rows of pSrcB, in elements
+  @param[out] pDst     points to the N dot products
+  @return     none
+ */
+
+void plp_dot_prod_cols_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                   const int32_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t strideA,
+                                   uint32_t strideB,
+                                   int32_t *__restrict__ pDst) {
+
+    uint32_t m, n;
+
+    // 2 adjacent columns per sweep over the rows, such that the samples of one row are loaded
+    // from consecutive addresses and every sum stays in a register
+    for (n = 0; n + 1 < N; n += 2) {
+        const int32_t *pColA = &pSrcA[n];
+        const int32_t *pColB = &pSrcB[n];
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        for (m = 0; m < M; m++) {
+            sum0 += pColA[0] * pColB[0];
+            sum1 += pColA[1] * pColB[1];
+            pColA += strideA;
+            pColB += strideB;
+        }
+        pDst[n + 0] = sum0;
+        pDst[n + 1] = sum1;
+    }
+
+    for (; n < N; n++) {
+        const int32_t *pColA = &pSrcA[n];
+        const int32_t *pColB = &pSrcB[n];
+        int32_t sum = 0;
+        for (m = 0; m < M; m++) {
+            sum += pColA[0] * pColB[0];
+            pColA += strideA;
+            pColB += strideB;
+        }
+        pDst[n] = sum;
+    }
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
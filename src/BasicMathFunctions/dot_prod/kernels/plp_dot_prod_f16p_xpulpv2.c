@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_f16p_xpulpv2.c
+ * Description:  Parallel dot product of half-precision float vectors kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Parallel dot product with interleaved access of half-precision float vectors kernel for
+  XPULPV2 extension with the smallFloat extensions. Every core processes blkSizePE pairs of
+  samples, starting with the pair of its core id.
+  @param[in]  S     points to the instance structure for half-precision parallel dot product
+  @return     none
+ */
+
+void plp_dot_prod_f16p_xpulpv2(void *S) {
+
+    plp_dot_prod_instance_f16 *a = (plp_dot_prod_instance_f16 *)S;
+    uint32_t core_id = rt_core_id();
+    uint32_t nPE = a->nPE;
+    uint32_t blkCnt;
+
+#ifdef PLP_MATH_SMALLFLOAT
+
+    const v2f16 *pA = (const v2f16 *)a->pSrcA + core_id;
+    const v2f16 *pB = (const v2f16 *)a->pSrcB + core_id;
+    v2f16 sum = { 0, 0 };
+
+    for (blkCnt = 0; blkCnt < a->blkSizePE; blkCnt++) {
+        sum += pA[nPE * blkCnt] * pB[nPE * blkCnt]; // vfmac.h
+    }
+
+    a->resBuffer[core_id] = (float32_t)sum[0] + (float32_t)sum[1];
+
+#else // PLP_MATH_SMALLFLOAT
+
+    const float16_t *pA = a->pSrcA + 2 * core_id;
+    const float16_t *pB = a->pSrcB + 2 * core_id;
+    float32_t sum = 0;
+
+    for (blkCnt = 0; blkCnt < a->blkSizePE; blkCnt++) {
+        uint32_t i = 2 * nPE * blkCnt;
+        sum += plp_f16_to_f32(pA[i]) * plp_f16_to_f32(pB[i]);
+        sum += plp_f16_to_f32(pA[i + 1]) * plp_f16_to_f32(pB[i + 1]);
+    }
+
+    a->resBuffer[core_id] = sum;
+
+#endif // PLP_MATH_SMALLFLOAT
+
+    plp_team_reduce_sum_f32(a->resBuffer, 1, nPE);
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_f16s_xpulpv2.c
+ * Description:  Dot product of half-precision float vectors kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Dot product of half-precision float vectors kernel for XPULPV2 extension with the
+  smallFloat extensions.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here
+  @return     none
+ */
+
+void plp_dot_prod_f16s_xpulpv2(const float16_t *__restrict__ pSrcA,
+                               const float16_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               float16_t *__restrict__ pRes) {
+
+    uint32_t blkCnt;
+
+#ifdef PLP_MATH_SMALLFLOAT
+
+    const v2f16 *pA = (const v2f16 *)pSrcA;
+    const v2f16 *pB = (const v2f16 *)pSrcB;
+    v2f16 sum = { 0, 0 };
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        sum += (*pA++) * (*pB++); // vfmac.h
+    }
+
+    float16_t res = sum[0] + sum[1];
+    if (blockSize % 2 == 1) {
+        res += pSrcA[blockSize - 1] * pSrcB[blockSize - 1];
+    }
+    *pRes = res;
+
+#else // PLP_MATH_SMALLFLOAT
+
+    float32_t sum = 0;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        sum += plp_f16_to_f32(pSrcA[blkCnt]) * plp_f16_to_f32(pSrcB[blkCnt]);
+    }
+    *pRes = plp_f32_to_f16(sum);
+
+#endif // PLP_MATH_SMALLFLOAT
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
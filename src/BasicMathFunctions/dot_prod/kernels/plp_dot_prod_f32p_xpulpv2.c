@@ -91,6 +91,8 @@ void plp_dot_prod_f32p_xpulpv2(void *S) {
     //* resBufferPE = sum1 + sum2;
     *resBufferPE = sum1;
 
+    plp_team_reduce_sum_f32(((plp_dot_prod_instance_f32 *)S)->resBuffer, 1, nPE);
+
     // printf("resBufferPE %d, core id %d\n", *resBufferPE, rt_core_id());
 }
 
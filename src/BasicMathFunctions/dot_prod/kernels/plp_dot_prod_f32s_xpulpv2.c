@@ -53,9 +53,13 @@ void plp_dot_prod_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
                                uint32_t blockSize,
                                float32_t *__restrict__ pRes) {
 
-    for (int i = 0; i < blockSize; i++) {
-        *pRes += *(pSrcA++) * (*(pSrcB++));
+    float32_t sum = 0;
+
+    for (uint32_t i = 0; i < blockSize; i++) {
+        sum += *(pSrcA++) * (*(pSrcB++));
     }
+
+    *pRes = sum;
 }
 
 /**
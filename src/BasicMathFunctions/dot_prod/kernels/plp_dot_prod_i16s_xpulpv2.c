@@ -57,6 +57,7 @@
   performed simultaneously on 32 bit vectors, with 32 bit accumulator.
  */
 
+PLP_HOT_CODE
 void plp_dot_prod_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
                                const int16_t *__restrict__ pSrcB,
                                uint32_t blockSize,
@@ -68,6 +69,7 @@ void plp_dot_prod_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
 
     tmpBS = (blockSize >> 2);
 
+    PLP_UNROLL(4)
     for (blkCnt = 0; blkCnt < tmpBS; blkCnt++) {
 
         v2s a0 = *((v2s *)((void *)(pSrcA + 4 * blkCnt)));
@@ -85,6 +85,8 @@ void plp_dot_prod_i32p_xpulpv2(void *S) {
 
     *resBufferPE = sum1 + sum2;
 
+    plp_team_reduce_sum_i32(((plp_dot_prod_instance_i32 *)S)->resBuffer, 1, nPE);
+
     // printf("resBufferPE %d, core id %d\n", *resBufferPE, rt_core_id());
 }
 
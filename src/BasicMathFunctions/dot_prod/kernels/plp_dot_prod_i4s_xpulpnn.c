@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_i4s_xpulpnn.c
+ * Description:  Dot product of packed 4-bit integer vectors kernel for XpulpNN
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+   @brief Returns the element n of a packed 4-bit vector, sign-extended to 32 bit.
+   @param[in]  p  points to the first byte of the vector
+   @param[in]  n  index of the element
+   @return     element n of the vector
+*/
+static inline int32_t plp_dot_prod_i4_unpack(const int8_t *__restrict__ p, uint32_t n) {
+    // move the element to the upper bits of the byte, and shift it back arithmetically
+    return (int32_t)(int8_t)((uint32_t)p[n / 2] << (4 - 4 * (n & 1))) >> 4;
+}
+
+/**
+  @brief Dot product of packed 4-bit integer vectors kernel for XpulpNN extension.
+  @param[in]  pSrcA      points to the first input vector (packed 4-bit)
+  @param[in]  pSrcB      points to the second input vector (packed 4-bit)
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here [32 bit]
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Eight elements are loaded as one word, and pv.sdotsp.n multiplies and accumulates all
+  nibbles of the word at once, without unpacking them.
+ */
+
+void plp_dot_prod_i4s_xpulpnn(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes) {
+
+    uint32_t n;
+    int32_t sum = 0;
+
+    for (n = 0; n + 7 < blockSize; n += 8) {
+        sum = __SUMDOTP8(*((v4s *)&pSrcA[n / 2]), *((v4s *)&pSrcB[n / 2]), sum); // pv.sdotsp.n
+    }
+
+    for (; n < blockSize; n++) {
+        sum += plp_dot_prod_i4_unpack(pSrcA, n) * plp_dot_prod_i4_unpack(pSrcB, n);
+    }
+
+    *pRes = sum;
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
@@ -57,6 +57,7 @@
   performed on 32 bit vectors, with 32 bit accumulator.
  */
 
+PLP_HOT_CODE
 void plp_dot_prod_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
                               const int8_t *__restrict__ pSrcB,
                               uint32_t blockSize,
@@ -68,6 +69,7 @@ void plp_dot_prod_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
 
     tmpBS = (blockSize >> 3);
 
+    PLP_UNROLL(4)
     for (blkCnt = 0; blkCnt < tmpBS; blkCnt++) {
 
         v4s a0 = *((v4s *)((void *)(pSrcA + 8 * blkCnt)));
@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_multi_i32p_xpulpv2.c
+ * Description:  parallel 32-bit integer multi-vector dot product for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Parallel dot products of one 32-bit integer query vector with nVec other vectors kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_dot_prod_multi_instance_i32 struct initialized by
+                    plp_dot_prod_multi_i32_parallel
+  @return     none
+
+  @par Parallelization
+  The vectors are split into contiguous chunks, one per core, and every core computes the dot
+  products of its chunk with plp_dot_prod_multi_i32s_xpulpv2. Every result is written by exactly
+  one core, so no reduction is needed.
+ */
+
+void plp_dot_prod_multi_i32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_dot_prod_multi_instance_i32 *a = (plp_dot_prod_multi_instance_i32 *)args;
+
+    const int32_t *pSrcQ = a->pSrcQ;
+    const int32_t *const *pSrcV = a->pSrcV;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nVec = a->nVec;
+    uint32_t nPE = a->nPE;
+    int32_t *pRes = a->pRes;
+
+    uint32_t chunk = (nVec + nPE - 1) / nPE;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > nVec) {
+        start = nVec;
+    }
+    if (end > nVec) {
+        end = nVec;
+    }
+
+    if (start < end) {
+        plp_dot_prod_multi_i32s_xpulpv2(pSrcQ,
+                                        pSrcV + start,
+                                        blockSize,
+                                        end - start,
+                                        pRes + start);
+    }
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_multi_i8s_rv32im.c
+ * Description:  8-bit integer multi-vector dot product kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Dot products of one 8-bit integer query vector with nVec other vectors kernel for RV32IM
+         extension.
+  @param[in]  pSrcQ      points to the query vector
+  @param[in]  pSrcV      points to the array of nVec pointers to the other vectors
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nVec       number of vectors the query is multiplied with
+  @param[out] pRes       points to the nVec output results
+  @return     none
+
+  @par Multiple vectors
+  Four vectors are processed in every pass, such that every sample of the query is loaded once
+  and multiplied with the samples of all four vectors.
+ */
+
+void plp_dot_prod_multi_i8s_rv32im(const int8_t *__restrict__ pSrcQ,
+                                   const int8_t *const *__restrict__ pSrcV,
+                                   uint32_t blockSize,
+                                   uint32_t nVec,
+                                   int32_t *__restrict__ pRes) {
+
+    uint32_t i, k; // loop counters
+
+    for (k = 0; k + 3 < nVec; k += 4) {
+        const int8_t *pV0 = pSrcV[k + 0];
+        const int8_t *pV1 = pSrcV[k + 1];
+        const int8_t *pV2 = pSrcV[k + 2];
+        const int8_t *pV3 = pSrcV[k + 3];
+        int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+        // every sample of the query is loaded once for the four vectors
+        for (i = 0; i < blockSize; i++) {
+            int32_t q = pSrcQ[i];
+            sum0 += q * pV0[i];
+            sum1 += q * pV1[i];
+            sum2 += q * pV2[i];
+            sum3 += q * pV3[i];
+        }
+
+        pRes[k + 0] = sum0;
+        pRes[k + 1] = sum1;
+        pRes[k + 2] = sum2;
+        pRes[k + 3] = sum3;
+    }
+
+    // leftover vectors
+    for (; k < nVec; k++) {
+        plp_dot_prod_i8s_rv32im(pSrcQ, pSrcV[k], blockSize, &pRes[k]);
+    }
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
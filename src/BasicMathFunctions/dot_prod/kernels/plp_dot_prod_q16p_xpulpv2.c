@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_q16p_xpulpv2.c
+ * Description:  parallel 16-bit fixed point dot product for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Parallel dot product of 16-bit fixed point vectors kernel for XPULPV2 extension.
+  @param[in]  S     points to the instance structure for fixed point parallel dot product
+  @return        none
+
+  @par Parallelization
+  Every core computes the dot product of a contiguous chunk of the vectors with
+  plp_dot_prod_q16s_xpulpv2, and writes the partial sum to its entry of the result buffer. The
+  partial sums are added up with plp_team_reduce_sum_i32, which leaves the result in the first
+  entry of the result buffer.
+  The chunks are a multiple of 8 samples, such that every chunk starts word aligned and the
+  products are rounded in the same groups as in plp_dot_prod_q16s_xpulpv2. Thus, the result
+  is identical to the single core result.
+ */
+
+void plp_dot_prod_q16p_xpulpv2(void *S) {
+
+    int core_id = rt_core_id();
+
+    plp_dot_prod_instance_q16 *args = (plp_dot_prod_instance_q16 *)S;
+
+    const int16_t *pSrcA = args->pSrcA;
+    const int16_t *pSrcB = args->pSrcB;
+    uint32_t blkSizePE = args->blkSizePE;
+    uint32_t deciPoint = args->deciPoint;
+    uint32_t nPE = args->nPE;
+    int32_t *resBufferPE = &(args->resBuffer[core_id]);
+
+    uint32_t chunk = (((blkSizePE + nPE - 1) / nPE) + 7) & ~7;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > blkSizePE) {
+        start = blkSizePE;
+    }
+    if (end > blkSizePE) {
+        end = blkSizePE;
+    }
+
+    if (start < end) {
+        plp_dot_prod_q16s_xpulpv2(pSrcA + start,
+                                  pSrcB + start,
+                                  end - start,
+                                  deciPoint,
+                                  resBufferPE);
+    } else {
+        *resBufferPE = 0;
+    }
+
+    plp_team_reduce_sum_i32(args->resBuffer, 1, nPE);
+}
+
+/**
+   @} end of BasicDotProdKernels group
+*/
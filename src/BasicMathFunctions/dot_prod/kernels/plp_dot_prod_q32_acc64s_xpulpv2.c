@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_q32_acc64s_xpulpv2.c
+ * Description:  32-bit fixed point dot product with 64-bit accumulation for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Scalar dot product of 32-bit fixed point vectors with 64-bit accumulation kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  deciPoint  decimal point for right shift
+  @param[out] pRes       output result returned here
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product is computed with the full 64-bit precision (mul and mulh), and accumulated in 64
+  bits. Only the final sum is shifted by deciPoint to the right (with rounding), and saturated to
+  32 bits. Hence, no precision is lost by shifting each product, and the accumulator only
+  overflows if the exact sum does not fit into 64 bits.
+
+  @par Loop Unrolling
+  Two independent 64-bit accumulators are used, such that the carry of one addition does not
+  stall the next multiplication.
+ */
+
+void plp_dot_prod_q32_acc64s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t blockSize,
+                                     uint32_t deciPoint,
+                                     int32_t *__restrict__ pRes) {
+    uint32_t blkCnt;  /* Loop counter */
+    int64_t sum0 = 0; /* 64-bit accumulator of the even elements */
+    int64_t sum1 = 0; /* 64-bit accumulator of the odd elements */
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        sum0 += (int64_t)(*pSrcA++) * (*pSrcB++);
+        sum1 += (int64_t)(*pSrcA++) * (*pSrcB++);
+    }
+
+    if (blockSize & 1) {
+        sum0 += (int64_t)(*pSrcA++) * (*pSrcB++);
+    }
+
+    *pRes = plp_acc64_to_q32(sum0 + sum1, deciPoint);
+}
+
+/**
+   @} end of BasicDotProdKernels group
+*/
@@ -83,16 +83,12 @@ void plp_dot_prod_q32p_xpulpv2(void *S) {
         blkSize = blkSizePE - (nPE - 1) * blkSize;
     }
 
-    if (blkSize == 0) {
-        *resBufferPE = 0;
-        return;
-    }
-
     int32_t i, sum = 0;
 
 #if defined(PLP_MATH_LOOPUNROLL)
 
-    for (i = 0; i < blkSize - 1; i += 2) {
+    // also correct for cores without elements, which must take part in the reduction
+    for (i = 0; i + 1 < blkSize; i += 2) {
         int32_t x0 = pSrcA[i] * pSrcB[i];
         int32_t x1 = pSrcA[i + 1] * pSrcB[i + 1];
         sum += __ADDROUNDNORM_REG(x0, x1, deciPoint);
@@ -111,6 +107,8 @@ void plp_dot_prod_q32p_xpulpv2(void *S) {
 #endif // PLP_MATH_LOOPUNROLL
 
     *resBufferPE = sum;
+
+    plp_team_reduce_sum_i32(args->resBuffer, 1, nPE);
 }
 
 /**
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_stride_i16s_rv32im.c
+ * Description:  Dot product of strided 16-bit integer vectors kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Dot product of strided 16-bit integer vectors kernel for RV32IM extension.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  strideA    distance between two samples of pSrcA, in elements
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  strideB    distance between two samples of pSrcB, in elements
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here
+  @return     none
+ */
+
+void plp_dot_prod_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                     uint32_t strideA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t strideB,
+                                     uint32_t blockSize,
+                                     int32_t *__restrict__ pRes) {
+
+    uint32_t blkCnt;
+    int32_t sum = 0;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        sum += *pSrcA * *pSrcB;
+        pSrcA += strideA;
+        pSrcB += strideB;
+    }
+
+    *pRes = sum;
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
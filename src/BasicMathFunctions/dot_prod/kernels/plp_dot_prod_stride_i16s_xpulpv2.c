@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_stride_i16s_xpulpv2.c
+ * Description:  Dot product of strided 16-bit integer vectors kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicDotProd
+ */
+
+/**
+  @addtogroup BasicDotProdKernels
+  @{
+ */
+
+/**
+  @brief Dot product of strided 16-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  strideA    distance between two samples of pSrcA, in elements
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  strideB    distance between two samples of pSrcB, in elements
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here
+  @return     none
+ */
+
+void plp_dot_prod_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                      uint32_t strideA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t strideB,
+                                      uint32_t blockSize,
+                                      int32_t *__restrict__ pRes) {
+
+    uint32_t blkCnt;
+    int32_t sum1 = 0;
+    int32_t sum2 = 0;
+
+    // two samples per iteration into independent sums, such that the loads of the second sample
+    // hide the latency of the first one
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        int16_t a1 = pSrcA[0];
+        int16_t b1 = pSrcB[0];
+        int16_t a2 = pSrcA[strideA];
+        int16_t b2 = pSrcB[strideB];
+        sum1 += a1 * b1;
+        sum2 += a2 * b2;
+        pSrcA += 2 * strideA;
+        pSrcB += 2 * strideB;
+    }
+
+    if (blockSize & 1) {
+        sum1 += *pSrcA * *pSrcB;
+    }
+
+    *pRes = sum1 + sum2;
+}
+
+/**
+  @} end of BasicDotProdKernels group
+ */
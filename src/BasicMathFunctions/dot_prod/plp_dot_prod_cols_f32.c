@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_cols_f32.c
+ * Description:  Glue code for column dot products of a 32-bit float matrix
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief Glue code for the dot products of all columns of two 32-bit float matrices.
+  @param[in]  pSrcA    points to the first input matrix of shape MxN
+  @param[in]  pSrcB    points to the second input matrix of shape MxN
+  @param[in]  M        height of both matrices, number of samples of every column
+  @param[in]  N        width of both matrices, number of columns
+  @param[in]  strideA  distance between two rows of pSrcA, in elements
+  @param[in]  strideB  distance between two rows of pSrcB, in elements
+  @param[out] pDst     points to the N dot products
+  @return     none
+
+  @par Columns
+  pDst[n] is the dot product of the columns n of pSrcA and pSrcB, which is the same as calling
+  plp_dot_prod_stride_f32 for every column. All columns are computed in a single sweep over the
+  rows, such that every row is loaded from consecutive addresses.
+ */
+
+void plp_dot_prod_cols_f32(const float32_t *__restrict__ pSrcA,
+                           const float32_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t strideA,
+                           uint32_t strideB,
+                           float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_dot_prod_cols_f32s_xpulpv2(pSrcA, pSrcB, M, N, strideA, strideB, pDst);
+    }
+}
+
+/**
+  @} end of BasicDotProd group
+ */
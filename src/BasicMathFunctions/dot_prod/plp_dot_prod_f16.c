@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_f16.c
+ * Description:  Dot product of half-precision float vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief Glue code for dot product of half-precision float vectors.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here
+  @return     none
+
+  @par Half Precision
+  With PLP_MATH_SMALLFLOAT, two samples are multiplied and accumulated at once with the packed
+  half-precision SIMD instructions, and the vectors must be aligned to 32 bits. Otherwise, the
+  samples are converted to single precision.
+ */
+
+void plp_dot_prod_f16(const float16_t *__restrict__ pSrcA,
+                      const float16_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      float16_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("error: FC doesn't have FPU\n");
+        return;
+    } else {
+        plp_dot_prod_f16s_xpulpv2(pSrcA, pSrcB, blockSize, pRes);
+    }
+}
+
+/**
+  @} end of BasicDotProd group
+ */
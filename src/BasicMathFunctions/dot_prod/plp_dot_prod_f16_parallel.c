@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_f16_parallel.c
+ * Description:  Parallel dot product of half-precision float vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief Glue code for parallel dot product of half-precision float vectors.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pRes       output result returned here
+  @return     none
+
+  @par Work Distribution
+  The cores process the pairs of samples in an interleaved way, such that every core can use the
+  packed half-precision SIMD instructions. The results of the cores are summed up in single
+  precision.
+ */
+
+void plp_dot_prod_f16_parallel(const float16_t *__restrict__ pSrcA,
+                               const float16_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               float16_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        uint32_t i, tmpblkSizePE = (blockSize >> 1) / nPE;
+        float32_t resBuffer[rt_nb_pe()];
+
+        plp_dot_prod_instance_f16 S = { .pSrcA = pSrcA,
+                                        .pSrcB = pSrcB,
+                                        .blkSizePE = tmpblkSizePE,
+                                        .nPE = nPE,
+                                        .resBuffer = resBuffer };
+
+        // Fork the dot product to nPE cores (i.e. processing units)
+        rt_team_fork(nPE, plp_dot_prod_f16p_xpulpv2, (void *)&S);
+
+        float32_t sum = resBuffer[0];
+
+        for (i = 2 * tmpblkSizePE * nPE; i < blockSize; i++) {
+            sum += plp_f16_to_f32(pSrcA[i]) * plp_f16_to_f32(pSrcB[i]);
+        }
+
+        *pRes = plp_f32_to_f16(sum);
+    }
+}
+
+/**
+  @} end of BasicDotProd group
+ */
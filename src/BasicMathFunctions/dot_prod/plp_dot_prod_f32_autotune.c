@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_f32_autotune.c
+ * Description:  32-bit floating-point dot product with autotuned number of cores
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// arguments of plp_dot_prod_f32_autotune, passed to plp_dot_prod_f32_autotune_run
+typedef struct {
+    const float32_t *pSrcA;
+    const float32_t *pSrcB;
+    uint32_t blockSize;
+    float32_t *pRes;
+} plp_dot_prod_autotune_args_f32;
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief      Runs the single core or the parallel version of plp_dot_prod_f32, on the number of
+              cores found fastest in a previous call.
+  @param[in]  args  pointer to plp_dot_prod_autotune_args_f32 struct initialized by
+                    plp_dot_prod_f32_autotune
+  @param[in]  nPE   number of parallel processing units, 0 for the single core version
+  @return     none
+ */
+
+static void plp_dot_prod_f32_autotune_run(void *args, uint32_t nPE) {
+
+    plp_dot_prod_autotune_args_f32 *a = (plp_dot_prod_autotune_args_f32 *)args;
+
+    if (nPE == 0) {
+        plp_dot_prod_f32(a->pSrcA, a->pSrcB, a->blockSize, a->pRes);
+    } else {
+        plp_dot_prod_f32_parallel(a->pSrcA, a->pSrcB, a->blockSize, nPE, a->pRes);
+    }
+}
+
+/**
+  @brief      Glue code for dot product of 32-bit floating-point vectors, which selects the single
+              core or the parallel version and the number of cores with plp_autotune_run.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here
+  @return     none
+
+  @par
+  The variants are tuned per bucket of blockSize.
+ */
+
+void plp_dot_prod_f32_autotune(const float32_t *__restrict__ pSrcA,
+                               const float32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               float32_t *__restrict__ pRes) {
+
+    plp_dot_prod_autotune_args_f32 args = { .pSrcA = pSrcA,
+                                            .pSrcB = pSrcB,
+                                            .blockSize = blockSize,
+                                            .pRes = pRes };
+
+    plp_autotune_run((const void *)plp_dot_prod_f32_autotune, plp_autotune_bucket(blockSize),
+                     plp_dot_prod_f32_autotune_run, (void *)&args);
+}
+
+/**
+  @} end of BasicDotProd group
+ */
@@ -81,10 +81,7 @@ void plp_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
         // Fork the dot product to nPE cores (i.e. processing units)
         rt_team_fork(nPE, plp_dot_prod_f32p_xpulpv2, (void *)&S);
 
-        float32_t sum = 0;
-        for (i = 0; i < nPE; i++) { // not necessary rt_nb_pe()
-            sum += resBuffer[i];
-        }
+        float32_t sum = resBuffer[0];
 
         /* #if defined(PLP_MATH_LOOPUNROLL) */
         /* #undef PLP_MATH_LOOPUNROLL */
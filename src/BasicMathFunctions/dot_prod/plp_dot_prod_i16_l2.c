@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_i16_l2.c
+ * Description:  16-bit integer parallel dot product of L2 vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief Glue code for parallel dot product of 16-bit integer vectors in L2.
+  @param[in]  pSrcA      points to the first input vector in L2
+  @param[in]  pSrcB      points to the second input vector in L2
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pRes       output result returned here
+  @return     none
+
+  @par
+  The vectors are streamed through L1 tiles with plp_dma_stream_next, and every tile is processed
+  with plp_dot_prod_i16_parallel while the DMA copies the next tile. The results of the tiles are
+  summed up. The L1 buffer of PLP_DMA_STREAM_BUFFER_BYTES bytes is taken with plp_scratch_alloc.
+ */
+
+void plp_dot_prod_i16_l2(const int16_t *__restrict__ pSrcA,
+                         const int16_t *__restrict__ pSrcB,
+                         uint32_t blockSize,
+                         uint32_t nPE,
+                         int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        uint8_t *pBuf = (uint8_t *)plp_scratch_alloc(PLP_DMA_STREAM_BUFFER_BYTES);
+
+        if (pBuf == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+
+        plp_dma_stream_t S;
+        plp_dma_stream_init(&S, pSrcA, pSrcB, sizeof(int16_t), NULL, 0, blockSize, pBuf,
+                            PLP_DMA_STREAM_BUFFER_BYTES);
+
+        void *pA, *pB, *pD;
+        uint32_t len;
+        int32_t res;
+        int32_t sum = 0;
+
+        while ((len = plp_dma_stream_next(&S, &pA, &pB, &pD)) > 0) {
+            plp_dot_prod_i16_parallel(pA, pB, len, nPE, &res);
+            sum += res;
+        }
+
+        *pRes = sum;
+
+        plp_scratch_free(pBuf, PLP_DMA_STREAM_BUFFER_BYTES);
+    }
+}
+
+/**
+  @} end of BasicDotProd group
+ */
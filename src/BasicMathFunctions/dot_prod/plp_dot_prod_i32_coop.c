@@ -0,0 +1,121 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_i32_coop.c
+ * Description:  Glue code for cooperative dot product of 32-bit integer vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// arguments of plp_dot_prod_i32_coop, passed to both shares
+typedef struct {
+    const int32_t *pSrcA;
+    const int32_t *pSrcB;
+    uint32_t clLen;
+    uint32_t fcLen;
+    uint32_t nPE;
+    int32_t clRes;
+    int32_t fcRes;
+} plp_dot_prod_coop_args_i32;
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief      Cluster share of plp_dot_prod_i32_coop, the first clLen samples.
+  @param[in]  args  pointer to plp_dot_prod_coop_args_i32 struct initialized by
+                    plp_dot_prod_i32_coop
+  @return     none
+ */
+
+static void plp_dot_prod_i32_coop_cl(void *args) {
+
+    plp_dot_prod_coop_args_i32 *a = (plp_dot_prod_coop_args_i32 *)args;
+
+    plp_dot_prod_i32_l2(a->pSrcA, a->pSrcB, a->clLen, a->nPE, &a->clRes);
+}
+
+/**
+  @brief      Fabric controller share of plp_dot_prod_i32_coop, the last fcLen samples.
+  @param[in]  args  pointer to plp_dot_prod_coop_args_i32 struct initialized by
+                    plp_dot_prod_i32_coop
+  @return     none
+ */
+
+static void plp_dot_prod_i32_coop_fc(void *args) {
+
+    plp_dot_prod_coop_args_i32 *a = (plp_dot_prod_coop_args_i32 *)args;
+
+    plp_dot_prod_i32s_rv32im(a->pSrcA + a->clLen, a->pSrcB + a->clLen, a->fcLen, &a->fcRes);
+}
+
+/**
+  @brief      Glue code for dot product of 32-bit integer vectors in L2, computed by the cluster
+              and the fabric controller together, called from the fabric controller.
+  @param[in,out] C       points to the state of the cooperative calls, see plp_coop_init
+  @param[in]  pSrcA      points to the first input vector in L2
+  @param[in]  pSrcB      points to the second input vector in L2
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nPE        number of parallel processing units of the cluster
+  @param[out] pRes       output result returned here
+  @return     none
+
+  @par
+  The samples are split with plp_coop_split. The cluster computes its share with
+  plp_dot_prod_i32_l2, and the fabric controller computes its share with
+  plp_dot_prod_i32s_rv32im at the same time. The result is the sum of both.
+ */
+
+void plp_dot_prod_i32_coop(plp_coop_t *C,
+                           const int32_t *__restrict__ pSrcA,
+                           const int32_t *__restrict__ pSrcB,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pRes) {
+
+    uint32_t fcLen = plp_coop_split(C, blockSize);
+
+    plp_dot_prod_coop_args_i32 args = { .pSrcA = pSrcA,
+                                        .pSrcB = pSrcB,
+                                        .clLen = blockSize - fcLen,
+                                        .fcLen = fcLen,
+                                        .nPE = nPE,
+                                        .clRes = 0,
+                                        .fcRes = 0 };
+
+    plp_coop_run(C, plp_dot_prod_i32_coop_cl, plp_dot_prod_i32_coop_fc, (void *)&args,
+                 args.clLen, args.fcLen);
+
+    *pRes = args.clRes + args.fcRes;
+}
+
+/**
+  @} end of BasicDotProd group
+ */
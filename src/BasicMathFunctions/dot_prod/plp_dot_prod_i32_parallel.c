@@ -89,10 +89,7 @@ void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
         // Fork the dot product to nPE cores (i.e. processing units)
         rt_team_fork(nPE, plp_dot_prod_i32p_xpulpv2, (void *)&S);
 
-        int sum = 0;
-        for (i = 0; i < nPE; i++) { // not necessary rt_nb_pe()
-            sum += resBuffer[i];
-        }
+        int sum = resBuffer[0];
 #if defined(PLP_MATH_LOOPUNROLL)
         // uint32_t blkCnt = blockSize/nPE/2 * 2 * nPE;
         // printf("blkCnt %d\n", blkCnt);
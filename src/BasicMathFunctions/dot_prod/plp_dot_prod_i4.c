@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_i4.c
+ * Description:  Dot product of packed 4-bit integer vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief Glue code for dot product of packed 4-bit integer vectors.
+  @param[in]  pSrcA      points to the first input vector (packed 4-bit)
+  @param[in]  pSrcB      points to the second input vector (packed 4-bit)
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here [32 bit]
+  @return     none
+
+  @par Packing
+  The vectors hold signed 4-bit values, packed two per byte. Element n is stored in the low
+  nibble (n even) or in the high nibble (n odd) of byte n / 2.
+
+  @par Kernel Tiers
+  The cluster uses plp_dot_prod_i4s_xpulpnn if the library is built with PLP_MATH_XPULPNN (make
+  PLP_MATH_XPULPNN=1), which computes eight products with one pv.sdotsp.n, and
+  plp_dot_prod_i4s_xpulpv2 otherwise.
+ */
+
+void plp_dot_prod_i4(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t blockSize,
+                     int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_dot_prod_i4s_rv32im(pSrcA, pSrcB, blockSize, pRes);
+    } else {
+#ifdef PLP_MATH_XPULPNN
+        plp_dot_prod_i4s_xpulpnn(pSrcA, pSrcB, blockSize, pRes);
+#else
+        plp_dot_prod_i4s_xpulpv2(pSrcA, pSrcB, blockSize, pRes);
+#endif
+    }
+}
+
+/**
+  @} end of BasicDotProd group
+ */
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_i8_parallel.c
+ * Description:  8-bit integer parallel dot product glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief Glue code for parallel dot product of 8-bit integer vectors.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pRes       output result returned here
+  @return     none
+ */
+
+void plp_dot_prod_i8_parallel(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        int32_t resBuffer[rt_nb_pe()];
+
+        plp_dot_prod_instance_i8 S;
+
+        // Initialize the plp_dot_prod_instance
+        S.pSrcA = pSrcA;
+        S.pSrcB = pSrcB;
+        S.blkSizePE = blockSize;
+        S.nPE = nPE;
+        S.resBuffer = resBuffer;
+
+        // Fork the dot product to nPE cores (i.e. processing units). The cores sum up their
+        // partial sums in a tree, which leaves the result in resBuffer[0].
+        rt_team_fork(nPE, plp_dot_prod_i8p_xpulpv2, (void *)&S);
+
+        *pRes = resBuffer[0];
+    }
+}
+
+/**
+  @} end of BasicDotProd group
+ */
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_multi_i32_parallel.c
+ * Description:  32-bit integer parallel multi-vector dot product glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief Glue code for parallel dot products of one 32-bit integer query vector with nVec other
+         vectors.
+  @param[in]  pSrcQ      points to the query vector
+  @param[in]  pSrcV      points to the array of nVec pointers to the other vectors
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nVec       number of vectors the query is multiplied with
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pRes       points to the nVec output results
+  @return     none
+ */
+
+void plp_dot_prod_multi_i32_parallel(const int32_t *__restrict__ pSrcQ,
+                                     const int32_t *const *__restrict__ pSrcV,
+                                     uint32_t blockSize,
+                                     uint32_t nVec,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_dot_prod_multi_instance_i32 args = { .pSrcQ = pSrcQ,
+                                                 .pSrcV = pSrcV,
+                                                 .blockSize = blockSize,
+                                                 .nVec = nVec,
+                                                 .nPE = nPE,
+                                                 .pRes = pRes };
+        rt_team_fork(nPE, plp_dot_prod_multi_i32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of BasicDotProd group
+ */
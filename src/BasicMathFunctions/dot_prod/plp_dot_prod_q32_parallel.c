@@ -67,7 +67,6 @@ void plp_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
         return;
     } else {
 
-        uint32_t i;
         int32_t resBuffer[rt_nb_pe()];
 
         plp_dot_prod_instance_q32 S;
@@ -83,12 +82,7 @@ void plp_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
         // Fork the dot product to nPE cores (i.e. processing units)
         rt_team_fork(nPE, plp_dot_prod_q32p_xpulpv2, (void *)&S);
 
-        int sum = 0;
-        for (i = 0; i < nPE; i++) { // not necessary rt_nb_pe()
-            sum += resBuffer[i];
-        }
-
-        *pRes = sum;
+        *pRes = resBuffer[0];
     }
 }
 
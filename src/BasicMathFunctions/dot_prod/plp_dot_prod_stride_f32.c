@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_stride_f32.c
+ * Description:  Glue code for dot product of strided 32-bit float vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief Glue code for dot product of strided 32-bit float vectors.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  strideA    distance between two samples of pSrcA, in elements
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  strideB    distance between two samples of pSrcB, in elements
+  @param[in]  blockSize  number of samples in each vector
+  @param[out] pRes       output result returned here
+  @return     none
+
+  @par Strides
+  The n-th sample of pSrcA is pSrcA[n * strideA], and the same for pSrcB. With a stride equal to
+  the width of a matrix, this is the dot product of two matrix columns, and with a stride equal to
+  the number of channels, the one of a channel of interleaved multi-channel data, without copying
+  the samples into contiguous vectors first.
+ */
+
+void plp_dot_prod_stride_f32(const float32_t *__restrict__ pSrcA,
+                             uint32_t strideA,
+                             const float32_t *__restrict__ pSrcB,
+                             uint32_t strideB,
+                             uint32_t blockSize,
+                             float32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_dot_prod_stride_f32s_xpulpv2(pSrcA, strideA, pSrcB, strideB, blockSize, pRes);
+    }
+}
+
+/**
+  @} end of BasicDotProd group
+ */
@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fused_f32p_xpulpv2.c
+ * Description:  Parallel fused elementwise expression of 32-bit float vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicFused
+ */
+
+/**
+  @addtogroup BasicFusedKernels
+  @{
+ */
+
+/**
+   @brief Parallel fused elementwise expression of 32-bit floating-point vectors kernel for
+          XPULPV2 extension.
+   @param[in]  args  pointer to plp_fused_instance_f32 struct initialized by
+                     plp_fused_f32_parallel
+   @return     none
+
+   @par Parallelization
+   Every core computes a contiguous chunk of the vectors with plp_fused_f32s_xpulpv2. The size of
+   each chunk is a multiple of 4, such that every chunk starts word aligned.
+*/
+
+void plp_fused_f32p_xpulpv2(void *args) {
+
+    plp_fused_instance_f32 *a = (plp_fused_instance_f32 *)args;
+
+    uint32_t start, end;
+    plp_team_chunk(a->blockSize, a->nPE, rt_core_id(), 4, &start, &end);
+
+    if (start < end) {
+        plp_fused_f32s_xpulpv2(a->pSrc + start, end - start, a->pOps, a->nOps, a->pDst + start);
+    }
+}
+
+/**
+   @} end of BasicFusedKernels group
+*/
@@ -0,0 +1,150 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fused_f32s_xpulpv2.c
+ * Description:  Fused elementwise expression of 32-bit floating-point vectors kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// applies one operation of the chain to four values, such that every operation is decoded only
+// once per four elements
+static inline void fused_f32_op4(const plp_fused_op_f32 *pOp, float32_t *y) {
+
+    float32_t a = pOp->a;
+    float32_t b = pOp->b;
+    union {
+        float32_t f;
+        int32_t i;
+    } scale;
+    uint32_t j;
+
+    switch (pOp->op) {
+    case PLP_FUSED_MULT:
+        for (j = 0; j < 4; j++) {
+            y[j] = y[j] * a;
+        }
+        break;
+    case PLP_FUSED_ADD:
+        for (j = 0; j < 4; j++) {
+            y[j] = y[j] + a;
+        }
+        break;
+    case PLP_FUSED_SHIFT:
+        // 2^-a built from the exponent bits
+        scale.i = (127 - (int32_t)a) << 23;
+        for (j = 0; j < 4; j++) {
+            y[j] = y[j] * scale.f;
+        }
+        break;
+    case PLP_FUSED_CLIP:
+        for (j = 0; j < 4; j++) {
+            y[j] = (y[j] < a) ? a : (y[j] > b) ? b : y[j];
+        }
+        break;
+    case PLP_FUSED_ABS:
+        for (j = 0; j < 4; j++) {
+            y[j] = (y[j] < 0.0f) ? -y[j] : y[j];
+        }
+        break;
+    case PLP_FUSED_MAX:
+        for (j = 0; j < 4; j++) {
+            y[j] = (y[j] < a) ? a : y[j];
+        }
+        break;
+    case PLP_FUSED_MIN:
+        for (j = 0; j < 4; j++) {
+            y[j] = (y[j] > a) ? a : y[j];
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+  @ingroup BasicFused
+ */
+
+/**
+  @addtogroup BasicFusedKernels
+  @{
+ */
+
+/**
+  @brief Fused elementwise expression of 32-bit floating-point vectors kernel for XPULPV2
+         extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  pOps       points to the chain of nOps operations
+  @param[in]  nOps       number of operations
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @return     none
+
+  @par Every operation of the chain is decoded once per four elements, which are kept in
+  registers until the end of the chain.
+ */
+
+void plp_fused_f32s_xpulpv2(const float32_t *pSrc,
+                            uint32_t blockSize,
+                            const plp_fused_op_f32 *pOps,
+                            uint32_t nOps,
+                            float32_t *pDst) {
+
+    float32_t y[4];
+    uint32_t i, j, k; // loop counters
+
+    for (i = 0; i + 3 < blockSize; i += 4) {
+        y[0] = pSrc[i];
+        y[1] = pSrc[i + 1];
+        y[2] = pSrc[i + 2];
+        y[3] = pSrc[i + 3];
+
+        for (k = 0; k < nOps; k++) {
+            fused_f32_op4(&pOps[k], y);
+        }
+
+        pDst[i] = y[0];
+        pDst[i + 1] = y[1];
+        pDst[i + 2] = y[2];
+        pDst[i + 3] = y[3];
+    }
+
+    // leftover elements, computed in a block of four with zeros
+    if (i < blockSize) {
+        for (j = 0; j < 4; j++) {
+            y[j] = (i + j < blockSize) ? pSrc[i + j] : 0.0f;
+        }
+        for (k = 0; k < nOps; k++) {
+            fused_f32_op4(&pOps[k], y);
+        }
+        for (j = 0; i + j < blockSize; j++) {
+            pDst[i + j] = y[j];
+        }
+    }
+}
+
+/**
+  @} end of BasicFusedKernels group
+ */
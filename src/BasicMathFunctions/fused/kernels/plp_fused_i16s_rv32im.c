@@ -0,0 +1,101 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fused_i16s_rv32im.c
+ * Description:  Fused elementwise expression of 16-bit integer vectors kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// applies one operation of the chain to a 32-bit intermediate value
+static inline int32_t fused_i32_op(const plp_fused_op_i32 *pOp, int32_t y) {
+
+    int32_t a = pOp->a;
+
+    switch (pOp->op) {
+    case PLP_FUSED_MULT:
+        return y * a;
+    case PLP_FUSED_ADD:
+        return y + a;
+    case PLP_FUSED_SHIFT:
+        return (a >= 0) ? (y >> a) : (int32_t)((uint32_t)y << -a);
+    case PLP_FUSED_CLIP:
+        return (y < a) ? a : (y > pOp->b) ? pOp->b : y;
+    case PLP_FUSED_ABS:
+        return (y < 0) ? -y : y;
+    case PLP_FUSED_MAX:
+        return (y < a) ? a : y;
+    case PLP_FUSED_MIN:
+        return (y > a) ? a : y;
+    default:
+        return y;
+    }
+}
+
+/**
+  @ingroup BasicFused
+ */
+
+/**
+  @defgroup BasicFusedKernels Fused Elementwise Expressions Kernels
+  A fused elementwise expression applies a chain of operations to every element of a vector in a
+  single pass, keeping the intermediate values in registers. The integer kernels compute the chain
+  on 32-bit intermediate values and saturate the result to the output type.
+ */
+
+/**
+  @addtogroup BasicFusedKernels
+  @{
+ */
+
+/**
+  @brief Fused elementwise expression of 16-bit integer vectors kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  pOps       points to the chain of nOps operations
+  @param[in]  nOps       number of operations
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @return     none
+ */
+
+void plp_fused_i16s_rv32im(const int16_t *pSrc,
+                           uint32_t blockSize,
+                           const plp_fused_op_i32 *pOps,
+                           uint32_t nOps,
+                           int16_t *pDst) {
+
+    uint32_t i, k; // loop counters
+
+    for (i = 0; i < blockSize; i++) {
+        int32_t y = pSrc[i];
+        for (k = 0; k < nOps; k++) {
+            y = fused_i32_op(&pOps[k], y);
+        }
+        pDst[i] = (int16_t)((y > 0x7FFF) ? 0x7FFF : (y < -0x8000) ? -0x8000 : y);
+    }
+}
+
+/**
+  @} end of BasicFusedKernels group
+ */
@@ -0,0 +1,145 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fused_i16s_xpulpv2.c
+ * Description:  Fused elementwise expression of 16-bit integer vectors kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// applies one operation of the chain to four 32-bit intermediate values, such that every
+// operation is decoded only once per four elements
+static inline void fused_i32_op4(const plp_fused_op_i32 *pOp, int32_t *y) {
+
+    int32_t a = pOp->a;
+    int32_t b = pOp->b;
+    uint32_t j;
+
+    switch (pOp->op) {
+    case PLP_FUSED_MULT:
+        for (j = 0; j < 4; j++) {
+            y[j] = y[j] * a;
+        }
+        break;
+    case PLP_FUSED_ADD:
+        for (j = 0; j < 4; j++) {
+            y[j] = y[j] + a;
+        }
+        break;
+    case PLP_FUSED_SHIFT:
+        for (j = 0; j < 4; j++) {
+            y[j] = (a >= 0) ? (y[j] >> a) : (int32_t)((uint32_t)y[j] << -a);
+        }
+        break;
+    case PLP_FUSED_CLIP:
+        for (j = 0; j < 4; j++) {
+            y[j] = (y[j] < a) ? a : (y[j] > b) ? b : y[j];
+        }
+        break;
+    case PLP_FUSED_ABS:
+        for (j = 0; j < 4; j++) {
+            y[j] = (y[j] < 0) ? -y[j] : y[j];
+        }
+        break;
+    case PLP_FUSED_MAX:
+        for (j = 0; j < 4; j++) {
+            y[j] = (y[j] < a) ? a : y[j];
+        }
+        break;
+    case PLP_FUSED_MIN:
+        for (j = 0; j < 4; j++) {
+            y[j] = (y[j] > a) ? a : y[j];
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+  @ingroup BasicFused
+ */
+
+/**
+  @addtogroup BasicFusedKernels
+  @{
+ */
+
+/**
+  @brief Fused elementwise expression of 16-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  pOps       points to the chain of nOps operations
+  @param[in]  nOps       number of operations
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Four elements are loaded as two words and unpacked into 32-bit registers, such that every
+  operation of the chain is decoded once per four elements and computed with single-cycle
+  instructions like p.mac, p.abs, p.max and p.min. The results are saturated with p.clip and
+  packed back into two words with pv.pack.h.
+ */
+
+void plp_fused_i16s_xpulpv2(const int16_t *pSrc,
+                            uint32_t blockSize,
+                            const plp_fused_op_i32 *pOps,
+                            uint32_t nOps,
+                            int16_t *pDst) {
+
+    int32_t y[4];
+    uint32_t i, j, k; // loop counters
+
+    for (i = 0; i + 3 < blockSize; i += 4) {
+        v2s x01 = *((v2s *)&pSrc[i]);
+        v2s x23 = *((v2s *)&pSrc[i + 2]);
+        y[0] = x01[0];
+        y[1] = x01[1];
+        y[2] = x23[0];
+        y[3] = x23[1];
+        for (k = 0; k < nOps; k++) {
+            fused_i32_op4(&pOps[k], y);
+        }
+
+        *((v2s *)&pDst[i]) = __PACK2(__CLIP(y[0], 15), __CLIP(y[1], 15));
+        *((v2s *)&pDst[i + 2]) = __PACK2(__CLIP(y[2], 15), __CLIP(y[3], 15));
+    }
+
+    // leftover elements, computed in a block of four with zeros
+    if (i < blockSize) {
+        for (j = 0; j < 4; j++) {
+            y[j] = (i + j < blockSize) ? pSrc[i + j] : 0;
+        }
+        for (k = 0; k < nOps; k++) {
+            fused_i32_op4(&pOps[k], y);
+        }
+        for (j = 0; i + j < blockSize; j++) {
+            pDst[i + j] = (int16_t)__CLIP(y[j], 15);
+        }
+    }
+}
+
+/**
+  @} end of BasicFusedKernels group
+ */
@@ -0,0 +1,144 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fused_i8s_xpulpv2.c
+ * Description:  Fused elementwise expression of 8-bit integer vectors kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// applies one operation of the chain to four 32-bit intermediate values, such that every
+// operation is decoded only once per four elements
+static inline void fused_i32_op4(const plp_fused_op_i32 *pOp, int32_t *y) {
+
+    int32_t a = pOp->a;
+    int32_t b = pOp->b;
+    uint32_t j;
+
+    switch (pOp->op) {
+    case PLP_FUSED_MULT:
+        for (j = 0; j < 4; j++) {
+            y[j] = y[j] * a;
+        }
+        break;
+    case PLP_FUSED_ADD:
+        for (j = 0; j < 4; j++) {
+            y[j] = y[j] + a;
+        }
+        break;
+    case PLP_FUSED_SHIFT:
+        for (j = 0; j < 4; j++) {
+            y[j] = (a >= 0) ? (y[j] >> a) : (int32_t)((uint32_t)y[j] << -a);
+        }
+        break;
+    case PLP_FUSED_CLIP:
+        for (j = 0; j < 4; j++) {
+            y[j] = (y[j] < a) ? a : (y[j] > b) ? b : y[j];
+        }
+        break;
+    case PLP_FUSED_ABS:
+        for (j = 0; j < 4; j++) {
+            y[j] = (y[j] < 0) ? -y[j] : y[j];
+        }
+        break;
+    case PLP_FUSED_MAX:
+        for (j = 0; j < 4; j++) {
+            y[j] = (y[j] < a) ? a : y[j];
+        }
+        break;
+    case PLP_FUSED_MIN:
+        for (j = 0; j < 4; j++) {
+            y[j] = (y[j] > a) ? a : y[j];
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+  @ingroup BasicFused
+ */
+
+/**
+  @addtogroup BasicFusedKernels
+  @{
+ */
+
+/**
+  @brief Fused elementwise expression of 8-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  pOps       points to the chain of nOps operations
+  @param[in]  nOps       number of operations
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Four elements are loaded as one word and unpacked into 32-bit registers, such that every
+  operation of the chain is decoded once per four elements and computed with single-cycle
+  instructions like p.mac, p.abs, p.max and p.min. The results are saturated with p.clip and
+  packed back into one word with pv.pack.
+ */
+
+void plp_fused_i8s_xpulpv2(const int8_t *pSrc,
+                           uint32_t blockSize,
+                           const plp_fused_op_i32 *pOps,
+                           uint32_t nOps,
+                           int8_t *pDst) {
+
+    int32_t y[4];
+    uint32_t i, j, k; // loop counters
+
+    for (i = 0; i + 3 < blockSize; i += 4) {
+        v4s x = *((v4s *)&pSrc[i]);
+        y[0] = x[0];
+        y[1] = x[1];
+        y[2] = x[2];
+        y[3] = x[3];
+        for (k = 0; k < nOps; k++) {
+            fused_i32_op4(&pOps[k], y);
+        }
+
+        *((v4s *)&pDst[i]) =
+            __PACK4(__CLIP(y[0], 7), __CLIP(y[1], 7), __CLIP(y[2], 7), __CLIP(y[3], 7));
+    }
+
+    // leftover elements, computed in a block of four with zeros
+    if (i < blockSize) {
+        for (j = 0; j < 4; j++) {
+            y[j] = (i + j < blockSize) ? pSrc[i + j] : 0;
+        }
+        for (k = 0; k < nOps; k++) {
+            fused_i32_op4(&pOps[k], y);
+        }
+        for (j = 0; i + j < blockSize; j++) {
+            pDst[i + j] = (int8_t)__CLIP(y[j], 7);
+        }
+    }
+}
+
+/**
+  @} end of BasicFusedKernels group
+ */
@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fused_i16.c
+ * Description:  Glue code for the fused elementwise expression of 16-bit integer vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @defgroup BasicFused Fused Elementwise Expressions
+  This module contains the glue code for fused elementwise expressions. The kernel codes
+  (kernels) are in the Module Fused Elementwise Expressions Kernels.
+
+  A fused elementwise expression applies a chain of nOps operations to every element of a vector
+  in a single pass,
+
+  <pre>
+  pDst[n] = opN-1(... op1(op0(pSrc[n]))),   0 <= n < blockSize,
+  </pre>
+
+  where every operation is described by an opcode and its operands:
+
+  <pre>
+  PLP_FUSED_MULT    y = y * a
+  PLP_FUSED_ADD     y = y + a
+  PLP_FUSED_SHIFT   y = y >> a, or y << -a for a negative a
+  PLP_FUSED_CLIP    y = min(max(y, a), b)
+  PLP_FUSED_ABS     y = |y|
+  PLP_FUSED_MAX     y = max(y, a)
+  PLP_FUSED_MIN     y = min(y, a)
+  </pre>
+
+  For example, y = clip((a*x + b) >> s, low, high) is the chain { MULT a, ADD b, SHIFT s, CLIP
+  low high }. Chaining plp_scale, plp_offset, plp_shift and plp_clip instead reads and writes the
+  whole vector once per operation, while the fused expression loads and stores every element only
+  once, keeping the intermediate values in registers.
+
+  The integer and fixed-point versions compute the chain on 32-bit intermediate values, which
+  must not overflow, and the shift amount must be in [-31, 31]. The result is saturated to the
+  range of the output type. The fixed-point versions share the kernels of the integer versions, a
+  fixed-point multiplication is a MULT followed by a SHIFT by the number of fractional bits. The
+  floating-point version scales by 2^-a for a SHIFT, with a in [-126, 126], and does not saturate
+  the result.
+
+  The functions can work in-place, i.e., pDst may be equal to pSrc.
+ */
+
+/**
+  @addtogroup BasicFused
+  @{
+ */
+
+/**
+  @brief Glue code for the fused elementwise expression of 16-bit integer vectors.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  pOps       points to the chain of nOps operations
+  @param[in]  nOps       number of operations
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @return     none
+ */
+
+void plp_fused_i16(const int16_t *pSrc,
+                   uint32_t blockSize,
+                   const plp_fused_op_i32 *pOps,
+                   uint32_t nOps,
+                   int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_fused_i16s_rv32im(pSrc, blockSize, pOps, nOps, pDst);
+    } else {
+        plp_fused_i16s_xpulpv2(pSrc, blockSize, pOps, nOps, pDst);
+    }
+}
+
+/**
+  @} end of BasicFused group
+ */
@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fused_i8.c
+ * Description:  Glue code for the fused elementwise expression of 8-bit integer vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicFused
+  @{
+ */
+
+/**
+  @brief Glue code for the fused elementwise expression of 8-bit integer vectors.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  pOps       points to the chain of nOps operations
+  @param[in]  nOps       number of operations
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @return     none
+ */
+
+void plp_fused_i8(const int8_t *pSrc,
+                  uint32_t blockSize,
+                  const plp_fused_op_i32 *pOps,
+                  uint32_t nOps,
+                  int8_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_fused_i8s_rv32im(pSrc, blockSize, pOps, nOps, pDst);
+    } else {
+        plp_fused_i8s_xpulpv2(pSrc, blockSize, pOps, nOps, pDst);
+    }
+}
+
+/**
+  @} end of BasicFused group
+ */
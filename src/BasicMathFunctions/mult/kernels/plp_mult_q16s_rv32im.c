@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mult_q16s_rv32im.c
+ * Description:  16-bit fixed-point saturating vector multiplication kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMult
+ */
+
+/**
+  @addtogroup BasicMultKernels
+  @{
+ */
+
+/**
+  @brief Saturating multiplication of 16-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]  pSrcA      points to first input vector
+  @param[in]  pSrcB      points to second input vector
+  @param[out] pDst       points to output vector, may be equal to pSrcA or pSrcB
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  deciPoint  decimal point for right shift of the product
+  @return     none
+ */
+
+void plp_mult_q16s_rv32im(const int16_t *pSrcA,
+                          const int16_t *pSrcB,
+                          int16_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t deciPoint) {
+
+    uint32_t i; // loop counter
+    int32_t rnd = (1 << deciPoint) >> 1; // rounding of the shift
+
+    for (i = 0; i < blockSize; i++) {
+        int32_t val = (pSrcA[i] * pSrcB[i] + rnd) >> deciPoint;
+        pDst[i] = (int16_t)((val > INT16_MAX) ? INT16_MAX : (val < INT16_MIN) ? INT16_MIN : val);
+    }
+}
+
+/**
+  @} end of BasicMultKernels group
+ */
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mult_q8s_xpulpv2.c
+ * Description:  8-bit fixed-point saturating vector multiplication kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMult
+ */
+
+/**
+  @addtogroup BasicMultKernels
+  @{
+ */
+
+/**
+  @brief Saturating multiplication of 8-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA      points to first input vector
+  @param[in]  pSrcB      points to second input vector
+  @param[out] pDst       points to output vector, may be equal to pSrcA or pSrcB
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  deciPoint  decimal point for right shift of the product
+  @return     none
+ */
+
+void plp_mult_q8s_xpulpv2(const int8_t *pSrcA,
+                          const int8_t *pSrcB,
+                          int8_t *pDst,
+                          uint32_t blockSize,
+                          uint32_t deciPoint) {
+
+    uint32_t i; // loop counter
+
+    // 4 samples fill one word. Both words are loaded before the store, since pDst may be equal
+    // to pSrcA or pSrcB.
+    for (i = 0; i + 3 < blockSize; i += 4) {
+        v4s a = *((v4s *)&pSrcA[i]);
+        v4s b = *((v4s *)&pSrcB[i]);
+        *((v4s *)&pDst[i]) = __PACK4(__CLIP(__ROUNDNORM_REG(a[0] * b[0], deciPoint), 7),
+                                     __CLIP(__ROUNDNORM_REG(a[1] * b[1], deciPoint), 7),
+                                     __CLIP(__ROUNDNORM_REG(a[2] * b[2], deciPoint), 7),
+                                     __CLIP(__ROUNDNORM_REG(a[3] * b[3], deciPoint), 7));
+    }
+
+    // leftover elements
+    for (; i < blockSize; i++) {
+        pDst[i] = (int8_t)__CLIP(__ROUNDNORM_REG(pSrcA[i] * pSrcB[i], deciPoint), 7);
+    }
+}
+
+/**
+  @} end of BasicMultKernels group
+ */
@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_negate_f32s_xpulpv2.c
+ * Description:  32-bit float vector negation kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicNegate
+ */
+
+/**
+  @addtogroup BasicNegateKernels
+  @{
+ */
+
+/**
+  @brief Negation of 32-bit float vectors kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+ */
+
+void plp_negate_f32s_xpulpv2(const float32_t *pSrc,
+                             float32_t *pDst,
+                             uint32_t blockSize) {
+
+    uint32_t i; // loop counter
+
+    // load both elements before storing, since pDst may be equal to pSrc
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        float32_t x0 = pSrc[i];
+        float32_t x1 = pSrc[i + 1];
+        pDst[i] = -x0;
+        pDst[i + 1] = -x1;
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = -pSrc[i];
+    }
+}
+
+/**
+  @} end of BasicNegateKernels group
+ */
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_negate_i8s_xpulpv2.c
+ * Description:  8-bit integer vector negation kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicNegate
+ */
+
+/**
+  @addtogroup BasicNegateKernels
+  @{
+ */
+
+/**
+  @brief Negation of 8-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+ */
+
+void plp_negate_i8s_xpulpv2(const int8_t *pSrc,
+                            int8_t *pDst,
+                            uint32_t blockSize) {
+
+    uint32_t i; // loop counter
+
+    v4s vMin = __PACK4(INT8_MIN, INT8_MIN, INT8_MIN, INT8_MIN);
+
+    // -INT8_MIN wraps to itself, adding the comparison result (-1 for true)
+    // saturates it to INT8_MAX
+    for (i = 0; i + 3 < blockSize; i += 4) {
+        v4s x = *((v4s *)&pSrc[i]);
+        *((v4s *)&pDst[i]) = -x + (v4s)(x == vMin);
+    }
+
+    // leftover elements
+    for (; i < blockSize; i++) {
+        pDst[i] = (pSrc[i] == INT8_MIN) ? INT8_MAX : -pSrc[i];
+    }
+}
+
+/**
+  @} end of BasicNegateKernels group
+ */
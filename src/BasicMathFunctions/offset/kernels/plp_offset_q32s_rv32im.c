@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_offset_q32s_rv32im.c
+ * Description:  32-bit fixed-point vector offset kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicOffset
+ */
+
+/**
+  @defgroup BasicOffsetKernels Vector Offset Kernels
+  The Vector Offset adds a scalar offset to every element of a vector.
+
+  <pre>
+  pDst[n] = pSrc[n] + offset,   0 <= n < blockSize.
+  </pre>
+
+  There are separate functions for floating point and fixed point 32-, 16- and 8-bit data types.
+  The fixed point versions saturate the result.
+ */
+
+/**
+  @addtogroup BasicOffsetKernels
+  @{
+ */
+
+/**
+  @brief Offset of 32-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  offset     value to add to each element
+  @return     none
+ */
+
+void plp_offset_q32s_rv32im(const int32_t *pSrc,
+                            int32_t *pDst,
+                            uint32_t blockSize,
+                            int32_t offset) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = plp_acc64_to_q32((int64_t)pSrc[i] + offset, 0);
+    }
+}
+
+/**
+  @} end of BasicOffsetKernels group
+ */
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_offset_q16_parallel.c
+ * Description:  16-bit fixed-point parallel vector offset glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicOffset
+  @{
+ */
+
+/**
+  @brief Glue code for parallel offset of 16-bit fixed-point vectors.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  offset     value to add to each element
+  @param[in]  nPE        number of parallel processing units
+  @return     none
+ */
+
+void plp_offset_q16_parallel(const int16_t *pSrc,
+                             int16_t *pDst,
+                             uint32_t blockSize,
+                             int16_t offset,
+                             uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_offset_instance_q16 args = { .pSrc = pSrc,
+                                         .pDst = pDst,
+                                         .blockSize = blockSize,
+                                         .offset = offset,
+                                         .nPE = nPE };
+        rt_team_fork(nPE, plp_offset_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of BasicOffset group
+ */
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_offset_q32.c
+ * Description:  32-bit fixed-point vector offset glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @defgroup BasicOffset Vector Offset
+  This module contains the glue code for Vector Offset. The kernel codes (kernels) are in
+  the Module Vector Offset Kernels.
+
+  The Vector Offset adds a scalar offset to every element of a vector.
+
+  <pre>
+  pDst[n] = pSrc[n] + offset,   0 <= n < blockSize.
+  </pre>
+
+  The functions can work in-place, i.e., pDst may be equal to pSrc.
+
+  There are separate functions for floating point and fixed point 32-, 16- and 8-bit data types.
+  The fixed point versions saturate the result.
+ */
+
+/**
+  @addtogroup BasicOffset
+  @{
+ */
+
+/**
+  @brief Glue code for offset of 32-bit fixed-point vectors.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  offset     value to add to each element
+  @return     none
+ */
+
+void plp_offset_q32(const int32_t *pSrc,
+                    int32_t *pDst,
+                    uint32_t blockSize,
+                    int32_t offset) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_offset_q32s_rv32im(pSrc, pDst, blockSize, offset);
+    } else {
+        plp_offset_q32s_xpulpv2(pSrc, pDst, blockSize, offset);
+    }
+}
+
+/**
+  @} end of BasicOffset group
+ */
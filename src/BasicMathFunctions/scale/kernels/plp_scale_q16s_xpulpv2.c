@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_scale_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point vector scaling kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicScale
+ */
+
+/**
+  @addtogroup BasicScaleKernels
+  @{
+ */
+
+/**
+  @brief Scaling of 16-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  scale      factor to multiply each element with
+  @param[in]  deciPoint  decimal point for right shift of the product
+  @return     none
+ */
+
+void plp_scale_q16s_xpulpv2(const int16_t *pSrc,
+                            int16_t *pDst,
+                            uint32_t blockSize,
+                            int16_t scale,
+                            uint32_t deciPoint) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        v2s x = *((v2s *)&pSrc[i]);
+        *((v2s *)&pDst[i]) = __PACK2(__CLIP(__ROUNDNORM_REG(x[0] * scale, deciPoint), 15),
+                                     __CLIP(__ROUNDNORM_REG(x[1] * scale, deciPoint), 15));
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = (int16_t)__CLIP(__ROUNDNORM_REG(pSrc[i] * scale, deciPoint), 15);
+    }
+}
+
+/**
+  @} end of BasicScaleKernels group
+ */
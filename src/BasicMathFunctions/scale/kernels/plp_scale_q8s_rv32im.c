@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_scale_q8s_rv32im.c
+ * Description:  8-bit fixed-point vector scaling kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicScale
+ */
+
+/**
+  @addtogroup BasicScaleKernels
+  @{
+ */
+
+/**
+  @brief Scaling of 8-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  scale      factor to multiply each element with
+  @param[in]  deciPoint  decimal point for right shift of the product
+  @return     none
+ */
+
+void plp_scale_q8s_rv32im(const int8_t *pSrc,
+                          int8_t *pDst,
+                          uint32_t blockSize,
+                          int8_t scale,
+                          uint32_t deciPoint) {
+
+    uint32_t i; // loop counter
+
+    int32_t rnd = (1 << deciPoint) >> 1; // rounding of the shift
+
+    for (i = 0; i < blockSize; i++) {
+        int32_t val = (pSrc[i] * scale + rnd) >> deciPoint;
+        pDst[i] = (int8_t)((val > INT8_MAX) ? INT8_MAX : (val < INT8_MIN) ? INT8_MIN : val);
+    }
+}
+
+/**
+  @} end of BasicScaleKernels group
+ */
@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_scale_q16_parallel.c
+ * Description:  16-bit fixed-point parallel vector scaling glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicScale
+  @{
+ */
+
+/**
+  @brief Glue code for parallel scaling of 16-bit fixed-point vectors.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  scale      factor to multiply each element with
+  @param[in]  deciPoint  decimal point for right shift of the product
+  @param[in]  nPE        number of parallel processing units
+  @return     none
+ */
+
+void plp_scale_q16_parallel(const int16_t *pSrc,
+                            int16_t *pDst,
+                            uint32_t blockSize,
+                            int16_t scale,
+                            uint32_t deciPoint,
+                            uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_scale_instance_q16 args = { .pSrc = pSrc,
+                                        .pDst = pDst,
+                                        .blockSize = blockSize,
+                                        .scale = scale,
+                                        .deciPoint = deciPoint,
+                                        .nPE = nPE };
+        rt_team_fork(nPE, plp_scale_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of BasicScale group
+ */
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_scale_q32.c
+ * Description:  32-bit fixed-point vector scaling glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @defgroup BasicScale Vector Scaling
+  This module contains the glue code for Vector Scaling. The kernel codes (kernels) are in
+  the Module Vector Scaling Kernels.
+
+  The Vector Scaling multiplies every element of a vector with a scalar factor.
+
+  <pre>
+  pDst[n] = (pSrc[n] * scale) >> deciPoint,   0 <= n < blockSize.
+  </pre>
+
+  The functions can work in-place, i.e., pDst may be equal to pSrc.
+
+  There are separate functions for floating point and fixed point 32-, 16- and 8-bit data types.
+  The fixed point versions round the product before the shift and saturate the result. The
+  floating point version does not shift.
+ */
+
+/**
+  @addtogroup BasicScale
+  @{
+ */
+
+/**
+  @brief Glue code for scaling of 32-bit fixed-point vectors.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  scale      factor to multiply each element with
+  @param[in]  deciPoint  decimal point for right shift of the product
+  @return     none
+ */
+
+void plp_scale_q32(const int32_t *pSrc,
+                   int32_t *pDst,
+                   uint32_t blockSize,
+                   int32_t scale,
+                   uint32_t deciPoint) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_scale_q32s_rv32im(pSrc, pDst, blockSize, scale, deciPoint);
+    } else {
+        plp_scale_q32s_xpulpv2(pSrc, pDst, blockSize, scale, deciPoint);
+    }
+}
+
+/**
+  @} end of BasicScale group
+ */
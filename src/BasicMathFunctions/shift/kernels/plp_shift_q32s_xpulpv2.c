@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_shift_q32s_xpulpv2.c
+ * Description:  32-bit fixed-point vector shift kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicShift
+ */
+
+/**
+  @addtogroup BasicShiftKernels
+  @{
+ */
+
+/**
+  @brief Shift of 32-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  shiftBits  amount to shift to the left, or to the right if negative
+  @return     none
+ */
+
+void plp_shift_q32s_xpulpv2(const int32_t *pSrc,
+                            int32_t *pDst,
+                            uint32_t blockSize,
+                            int8_t shiftBits) {
+
+    uint32_t i; // loop counter
+
+    if (shiftBits >= 0) {
+        for (i = 0; i + 1 < blockSize; i += 2) {
+            int32_t x0 = pSrc[i];
+            int32_t x1 = pSrc[i + 1];
+            pDst[i] = plp_acc64_to_q32((int64_t)x0 << shiftBits, 0);
+            pDst[i + 1] = plp_acc64_to_q32((int64_t)x1 << shiftBits, 0);
+        }
+
+        // leftover element
+        if (i < blockSize) {
+            pDst[i] = plp_acc64_to_q32((int64_t)pSrc[i] << shiftBits, 0);
+        }
+    } else {
+        int32_t r = -shiftBits;
+
+        for (i = 0; i + 1 < blockSize; i += 2) {
+            int32_t x0 = pSrc[i];
+            int32_t x1 = pSrc[i + 1];
+            pDst[i] = x0 >> r;
+            pDst[i + 1] = x1 >> r;
+        }
+
+        // leftover element
+        if (i < blockSize) {
+            pDst[i] = pSrc[i] >> r;
+        }
+    }
+}
+
+/**
+  @} end of BasicShiftKernels group
+ */
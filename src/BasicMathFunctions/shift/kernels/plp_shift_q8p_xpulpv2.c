@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_shift_q8p_xpulpv2.c
+ * Description:  parallel 8-bit fixed-point vector shift for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicShift
+ */
+
+/**
+  @addtogroup BasicShiftKernels
+  @{
+ */
+
+/**
+   @brief Parallel shift of 8-bit fixed-point vectors kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_shift_instance_q8 struct initialized by
+                     plp_shift_q8_parallel
+   @return     none
+
+   @par Parallelization
+   Every core computes a contiguous chunk of the vectors with plp_shift_q8s_xpulpv2. The size of
+   each chunk is a multiple of 4, such that every chunk starts word aligned.
+*/
+
+void plp_shift_q8p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_shift_instance_q8 *a = (plp_shift_instance_q8 *)args;
+
+    const int8_t *pSrc = a->pSrc;
+    int8_t *pDst = a->pDst;
+    uint32_t blockSize = a->blockSize;
+    int8_t shiftBits = a->shiftBits;
+    uint32_t nPE = a->nPE;
+
+    uint32_t chunk = (((blockSize + nPE - 1) / nPE) + 3) & ~3;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > blockSize) {
+        start = blockSize;
+    }
+    if (end > blockSize) {
+        end = blockSize;
+    }
+
+    if (start < end) {
+        plp_shift_q8s_xpulpv2(pSrc + start,
+                              pDst + start,
+                              end - start,
+                              shiftBits);
+    }
+}
+
+/**
+   @} end of BasicShiftKernels group
+*/
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_shift_q8s_xpulpv2.c
+ * Description:  8-bit fixed-point vector shift kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicShift
+ */
+
+/**
+  @addtogroup BasicShiftKernels
+  @{
+ */
+
+/**
+  @brief Shift of 8-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  shiftBits  amount to shift to the left, or to the right if negative
+  @return     none
+ */
+
+void plp_shift_q8s_xpulpv2(const int8_t *pSrc,
+                           int8_t *pDst,
+                           uint32_t blockSize,
+                           int8_t shiftBits) {
+
+    uint32_t i; // loop counter
+
+    if (shiftBits >= 0) {
+        for (i = 0; i + 3 < blockSize; i += 4) {
+            v4s x = *((v4s *)&pSrc[i]);
+            *((v4s *)&pDst[i]) = __PACK4(__CLIP(x[0] << shiftBits, 7),
+                                         __CLIP(x[1] << shiftBits, 7),
+                                         __CLIP(x[2] << shiftBits, 7),
+                                         __CLIP(x[3] << shiftBits, 7));
+        }
+
+        // leftover elements
+        for (; i < blockSize; i++) {
+            pDst[i] = (int8_t)__CLIP(pSrc[i] << shiftBits, 7);
+        }
+    } else {
+        int32_t r = -shiftBits;
+
+        for (i = 0; i + 3 < blockSize; i += 4) {
+            v4s x = *((v4s *)&pSrc[i]);
+            *((v4s *)&pDst[i]) = x >> r;
+        }
+
+        // leftover elements
+        for (; i < blockSize; i++) {
+            pDst[i] = pSrc[i] >> r;
+        }
+    }
+}
+
+/**
+  @} end of BasicShiftKernels group
+ */
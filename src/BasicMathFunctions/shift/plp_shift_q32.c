@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_shift_q32.c
+ * Description:  32-bit fixed-point vector shift glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @defgroup BasicShift Vector Shift
+  This module contains the glue code for Vector Shift. The kernel codes (kernels) are in
+  the Module Vector Shift Kernels.
+
+  The Vector Shift shifts every element of a vector to the left by a signed number of
+  bits. Negative shifts are arithmetic shifts to the right.
+
+  <pre>
+  pDst[n] = pSrc[n] << shiftBits,   0 <= n < blockSize.
+  </pre>
+
+  The functions can work in-place, i.e., pDst may be equal to pSrc.
+
+  There are functions for fixed point 32-, 16- and 8-bit data types. Left shifts saturate the
+  result. shiftBits must be smaller than the width of the data type in magnitude.
+ */
+
+/**
+  @addtogroup BasicShift
+  @{
+ */
+
+/**
+  @brief Glue code for shift of 32-bit fixed-point vectors.
+  @param[in]  pSrc       points to the input vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  shiftBits  amount to shift to the left, or to the right if negative
+  @return     none
+ */
+
+void plp_shift_q32(const int32_t *pSrc,
+                   int32_t *pDst,
+                   uint32_t blockSize,
+                   int8_t shiftBits) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_shift_q32s_rv32im(pSrc, pDst, blockSize, shiftBits);
+    } else {
+        plp_shift_q32s_xpulpv2(pSrc, pDst, blockSize, shiftBits);
+    }
+}
+
+/**
+  @} end of BasicShift group
+ */
@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sub_i32s_xpulpv2.c
+ * Description:  32-bit integer vector subtraction kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicSub
+ */
+
+/**
+  @addtogroup BasicSubKernels
+  @{
+ */
+
+/**
+  @brief Subtraction of 32-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  pSrcB      points to the second input vector
+  @param[out] pDst       points to the output vector
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+ */
+
+void plp_sub_i32s_xpulpv2(const int32_t *pSrcA,
+                          const int32_t *pSrcB,
+                          int32_t *pDst,
+                          uint32_t blockSize) {
+
+    uint32_t i; // loop counter
+
+    // load both elements before storing
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        int32_t a0 = pSrcA[i];
+        int32_t a1 = pSrcA[i + 1];
+        int32_t b0 = pSrcB[i];
+        int32_t b1 = pSrcB[i + 1];
+        pDst[i] = a0 - b0;
+        pDst[i + 1] = a1 - b1;
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = pSrcA[i] - pSrcB[i];
+    }
+}
+
+/**
+  @} end of BasicSubKernels group
+ */
@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sub_i8s_xpulpv2.c
+ * Description:  8-bit integer vector subtraction kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicSub
+ */
+
+/**
+  @addtogroup BasicSubKernels
+  @{
+ */
+
+/**
+  @brief Subtraction of 8-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  pSrcB      points to the second input vector
+  @param[out] pDst       points to the output vector
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+ */
+
+void plp_sub_i8s_xpulpv2(const int8_t *pSrcA,
+                         const int8_t *pSrcB,
+                         int32_t *pDst,
+                         uint32_t blockSize) {
+
+    uint32_t i; // loop counter
+
+    // one word of each input holds 4 samples
+    for (i = 0; i + 3 < blockSize; i += 4) {
+        v4s a = *((v4s *)&pSrcA[i]);
+        v4s b = *((v4s *)&pSrcB[i]);
+        pDst[i] = a[0] - b[0];
+        pDst[i + 1] = a[1] - b[1];
+        pDst[i + 2] = a[2] - b[2];
+        pDst[i + 3] = a[3] - b[3];
+    }
+
+    // leftover elements
+    for (; i < blockSize; i++) {
+        pDst[i] = (int32_t)pSrcA[i] - pSrcB[i];
+    }
+}
+
+/**
+  @} end of BasicSubKernels group
+ */
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sub_q16s_rv32im.c
+ * Description:  16-bit fixed-point saturating vector subtraction kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicSub
+ */
+
+/**
+  @defgroup BasicSubKernels Vector Subtraction Kernels
+  The Vector Subtraction computes element-by-element subtraction of two vectors.
+
+  <pre>
+  pDst[n] = pSrcA[n] - pSrcB[n],   0 <= n < blockSize.
+  </pre>
+
+  There are separate functions for floating point, integer, and fixed point 16- and 8-bit data
+  types. The integer versions write 32-bit results, while the fixed point versions saturate the
+  result to the width of the input. The XPULPV2 kernels load and store whole words of packed samples.
+ */
+
+/**
+  @addtogroup BasicSubKernels
+  @{
+ */
+
+/**
+  @brief Saturating subtraction of 16-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]  pSrcA      points to first input vector
+  @param[in]  pSrcB      points to second input vector
+  @param[out] pDst       points to output vector, may be equal to pSrcA or pSrcB
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+ */
+
+void plp_sub_q16s_rv32im(const int16_t *pSrcA,
+                         const int16_t *pSrcB,
+                         int16_t *pDst,
+                         uint32_t blockSize) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i < blockSize; i++) {
+        int32_t val = pSrcA[i] - pSrcB[i];
+        pDst[i] = (int16_t)((val > INT16_MAX) ? INT16_MAX : (val < INT16_MIN) ? INT16_MIN : val);
+    }
+}
+
+/**
+  @} end of BasicSubKernels group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sub_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point saturating vector subtraction kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicSub
+ */
+
+/**
+  @addtogroup BasicSubKernels
+  @{
+ */
+
+/**
+  @brief Saturating subtraction of 16-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA      points to first input vector
+  @param[in]  pSrcB      points to second input vector
+  @param[out] pDst       points to output vector, may be equal to pSrcA or pSrcB
+  @param[in]  blockSize  number of samples in each vector
+  @return     none
+ */
+
+void plp_sub_q16s_xpulpv2(const int16_t *pSrcA,
+                          const int16_t *pSrcB,
+                          int16_t *pDst,
+                          uint32_t blockSize) {
+
+    uint32_t i; // loop counter
+
+    // 2 samples fill one word. Both words are loaded before the store, since pDst may be equal
+    // to pSrcA or pSrcB.
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        v2s a = *((v2s *)&pSrcA[i]);
+        v2s b = *((v2s *)&pSrcB[i]);
+        *((v2s *)&pDst[i]) = __PACK2(__CLIP(a[0] - b[0], 15), __CLIP(a[1] - b[1], 15));
+    }
+
+    // leftover elements
+    for (; i < blockSize; i++) {
+        pDst[i] = (int16_t)__CLIP(pSrcA[i] - pSrcB[i], 15);
+    }
+}
+
+/**
+  @} end of BasicSubKernels group
+ */
@@ -25,6 +25,8 @@
 #include "plp_const_structs.h"
 #include "plp_common_tables.h"
 
+#ifndef PLP_NO_STATIC_FFT_TABLES
+
 const plp_cfft_instance_q16 plp_cfft_sR_q16_len16 = { 16, twiddleCoef_16_q16,
                                                       plpBitRevIndexTable_fixed_16,
                                                       PLPBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH };
@@ -100,4 +102,60 @@ const plp_cfft_instance_q32 plp_cfft_sR_q32_len4096 = { 4096, twiddleCoef_4096_q
 
 
 const plp_rfft_instance_f32 plp_rfft_sR_f32_len2048 = { 2048, 0, (float32_t *)twiddleCoef_rfft_2048,
-                                                        (uint16_t *)bit_rev_radix2_LUT };
\ No newline at end of file
+                                                        (uint16_t *)bit_rev_radix2_LUT };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len32 = { 32, &plp_cfft_sR_q16_len16,
+                                                      twiddleCoef_rfft_q16, 256 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len64 = { 64, &plp_cfft_sR_q16_len32,
+                                                      twiddleCoef_rfft_q16, 128 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len128 = { 128, &plp_cfft_sR_q16_len64,
+                                                       twiddleCoef_rfft_q16, 64 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len256 = { 256, &plp_cfft_sR_q16_len128,
+                                                       twiddleCoef_rfft_q16, 32 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len512 = { 512, &plp_cfft_sR_q16_len256,
+                                                       twiddleCoef_rfft_q16, 16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len1024 = { 1024, &plp_cfft_sR_q16_len512,
+                                                        twiddleCoef_rfft_q16, 8 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len2048 = { 2048, &plp_cfft_sR_q16_len1024,
+                                                        twiddleCoef_rfft_q16, 4 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len4096 = { 4096, &plp_cfft_sR_q16_len2048,
+                                                        twiddleCoef_rfft_q16, 2 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len8192 = { 8192, &plp_cfft_sR_q16_len4096,
+                                                        twiddleCoef_rfft_q16, 1 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len32 = { 32, &plp_cfft_sR_q32_len16,
+                                                      twiddleCoef_rfft_q32, 256 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len64 = { 64, &plp_cfft_sR_q32_len32,
+                                                      twiddleCoef_rfft_q32, 128 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len128 = { 128, &plp_cfft_sR_q32_len64,
+                                                       twiddleCoef_rfft_q32, 64 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len256 = { 256, &plp_cfft_sR_q32_len128,
+                                                       twiddleCoef_rfft_q32, 32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len512 = { 512, &plp_cfft_sR_q32_len256,
+                                                       twiddleCoef_rfft_q32, 16 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len1024 = { 1024, &plp_cfft_sR_q32_len512,
+                                                        twiddleCoef_rfft_q32, 8 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len2048 = { 2048, &plp_cfft_sR_q32_len1024,
+                                                        twiddleCoef_rfft_q32, 4 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len4096 = { 4096, &plp_cfft_sR_q32_len2048,
+                                                        twiddleCoef_rfft_q32, 2 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len8192 = { 8192, &plp_cfft_sR_q32_len4096,
+                                                        twiddleCoef_rfft_q32, 1 };
+
+#endif // PLP_NO_STATIC_FFT_TABLES
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_conj_i32p_xpulpv2.c
+ * Description:  Parallel complex conjugate of i32 vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_conj
+  @{
+ */
+
+/**
+  @brief Parallel complex conjugate of 32-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_cmplx_instance_i32 struct initialized by
+                    plp_cmplx_conj_i32_parallel
+  @return     none
+
+  @par Parallelization
+  Every core computes a contiguous chunk of the samples with plp_cmplx_conj_i32_xpulpv2.
+ */
+
+void plp_cmplx_conj_i32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_cmplx_instance_i32 *a = (plp_cmplx_instance_i32 *)args;
+
+    uint32_t numSamples = a->numSamples;
+    uint32_t nPE = a->nPE;
+    uint32_t chunk = (numSamples + nPE - 1) / nPE;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > numSamples) {
+        start = numSamples;
+    }
+    if (end > numSamples) {
+        end = numSamples;
+    }
+
+    if (start < end) {
+        plp_cmplx_conj_i32_xpulpv2(a->pSrcA + 2 * start, a->pDst + 2 * start, end - start);
+    }
+}
+
+/**
+  @} end of cmplx_conj group
+ */
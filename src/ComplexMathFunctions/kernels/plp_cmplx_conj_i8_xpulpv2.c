@@ -76,25 +76,37 @@ void plp_cmplx_conj_i8_xpulpv2(const int8_t *__restrict__ pSrc,
                                int8_t *__restrict__ pDst,
                                uint32_t numSamples) {
     uint32_t blkCnt; /* Loop counter */
+    v4s x, neg;      /* Two complex samples as a packed word, and its negation */
+    const v4s min4 = { INT8_MIN, INT8_MIN, INT8_MIN, INT8_MIN };
+    const v4s conjMask = { 0, 5, 2, 7 }; /* Real parts of x, imaginary parts of neg */
 
-    /* Initialize blkCnt with number of samples */
-    blkCnt = 2 * numSamples;
-    int8_t sign = 1;
+    /* Two complex samples fill one packed word */
+    blkCnt = numSamples >> 1U;
     while (blkCnt > 0U) {
         /* C[0] + jC[1] = A[0]+ j(-1)A[1] */
 
+        x = *((v4s *)pSrc);
+        pSrc += 4;
+
+        /* negate all lanes. A negated INT8_MIN wraps around and is moved to INT8_MAX by adding
+           the comparison result (-1 for true), such that the negation saturates. */
+        neg = -x + (v4s)(x == min4);
+
         /* Calculate Complex Conjugate and store result in destination buffer. */
-        if (sign == 1) {
-            *pDst++ = *pSrc++;
-        } else {
-            int8_t in = *pSrc++;
-            *pDst++ = (in == INT8_MIN) ? INT8_MAX : -in;
-        }
-        sign *= -1;
+        *((v4s *)pDst) = __builtin_shuffle(x, neg, conjMask);
+        pDst += 4;
 
         /* Decrement loop counter */
         blkCnt--;
     }
+
+    /* Compute the remaining sample */
+    if (numSamples % 2U) {
+        int8_t in;
+        *pDst++ = *pSrc++;
+        in = *pSrc++;
+        *pDst++ = (in == INT8_MIN) ? INT8_MAX : -in;
+    }
 }
 
 /**
@@ -0,0 +1,112 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_conj_i16_xpulpv2.c
+ * Description:  16-bit integer complex dot product with conjugate for XPULPV2
+ *
+ * $Date:        29. June 2020
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2019 ETH Zurich and Ubiversity of Bologna.
+ *
+ * Author: Hanna Mueller, ETH Zurich
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Notice: project inspired by ARM CMSIS DSP and parts of source code
+  ported and adopted for RISC-V PULP platform from ARM CMSIS DSP
+ released under Copyright (C) 2010-2019 ARM Limited or its affiliates
+  with Apache-2.0.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_dot_prod_conj Complex Dot Product with Conjugate
+  Computes the dot product of a complex vector with the conjugate of a second complex vector,
+  as needed for correlations, beamforming weights and cross-spectra. The conjugation is folded
+  into the products, such that no conjugated copy of <code>pSrcB</code> is needed.
+  <code>numSamples</code> specifies the number of complex samples
+  and the data in each array is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  Each array has a total of <code>2*numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  realResult = 0;
+  imagResult = 0;
+  for (n = 0; n < numSamples; n++) {
+      realResult += pSrcA[(2*n)+0] * pSrcB[(2*n)+0] + pSrcA[(2*n)+1] * pSrcB[(2*n)+1];
+      imagResult += pSrcA[(2*n)+1] * pSrcB[(2*n)+0] - pSrcA[(2*n)+0] * pSrcB[(2*n)+1];
+  }
+  </pre>
+  There are separate functions for floating point, integer, and fixed point 32- 16- 8-bit data
+  types.
+ */
+
+/**
+  @addtogroup cmplx_dot_prod_conj
+  @{
+ */
+
+/**
+  @brief         16-bit integer complex dot product with conjugate.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in]     numSamples  number of samples in each vector
+  @param[out]    realResult  real part of the result returned here
+  @param[out]    imagResult  imaginary part of the result returned here
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_conj_i16_xpulpv2(const int16_t *pSrcA,
+                                         const int16_t *pSrcB,
+                                         uint32_t numSamples,
+                                         int16_t *realResult,
+                                         int16_t *imagResult) {
+    uint32_t blkCnt;                    /* Loop counter */
+    int32_t real_sum = 0, imag_sum = 0; /* Temporary result variables */
+    v2s x, y;                           /* One complex sample of each input as a packed word */
+
+    /* The conjugation is folded into the operands: the real part is the plain dot product, the
+       imaginary part uses B swapped, with its imaginary part negated. The 32-bit sums wrap around
+       like the 16-bit ones modulo 2^16, such that the result is the same. Negating INT16_MIN
+       wraps, which does not change the lower 16 bits either. */
+    blkCnt = numSamples;
+    while (blkCnt > 0U) {
+        x = *((v2s *)pSrcA);
+        y = *((v2s *)pSrcB);
+        pSrcA += 2;
+        pSrcB += 2;
+
+        real_sum = __SUMDOTP2(x, y, real_sum);
+        imag_sum = __SUMDOTP2(x, __PACK2(-y[1], y[0]), imag_sum);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Store real and imaginary result in destination buffer. */
+    *realResult = (int16_t)real_sum;
+    *imagResult = (int16_t)imag_sum;
+}
+/**
+  @} end of cmplx_dot_prod_conj group
+ */
\ No newline at end of file
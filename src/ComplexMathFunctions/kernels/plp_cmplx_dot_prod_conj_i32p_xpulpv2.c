@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_conj_i32p_xpulpv2.c
+ * Description:  Parallel complex dot product with conjugate of i32 vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod_conj
+  @{
+ */
+
+/**
+  @brief Parallel complex dot product with conjugate of 32-bit integer vectors kernel for XPULPV2
+  extension.
+  @param[in]  args  pointer to plp_cmplx_dot_prod_instance_i32 struct initialized by
+                    plp_cmplx_dot_prod_conj_i32_parallel
+  @return     none
+
+  @par Parallelization
+  Every core computes the dot product of a contiguous chunk of the vectors with
+  plp_cmplx_dot_prod_conj_i32_xpulpv2 and stores the partial result in its two entries of resBuffer.
+  Cores without samples store zero. The partial results are summed up in a tree with
+  plp_team_reduce_sum_i32, which leaves the result in the first two entries of resBuffer. The
+  partial sums wrap around like the single core accumulator, such that the result is identical to
+  plp_cmplx_dot_prod_conj_i32.
+ */
+
+void plp_cmplx_dot_prod_conj_i32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_cmplx_dot_prod_instance_i32 *a = (plp_cmplx_dot_prod_instance_i32 *)args;
+
+    uint32_t numSamples = a->numSamples;
+    uint32_t nPE = a->nPE;
+    uint32_t chunk = (numSamples + nPE - 1) / nPE;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > numSamples) {
+        start = numSamples;
+    }
+    if (end > numSamples) {
+        end = numSamples;
+    }
+
+    plp_cmplx_dot_prod_conj_i32_xpulpv2(a->pSrcA + 2 * start,
+                                        a->pSrcB + 2 * start,
+                                        end - start,
+                                        &a->resBuffer[2 * core_id],
+                                        &a->resBuffer[2 * core_id + 1]);
+
+    plp_team_reduce_sum_i32(a->resBuffer, 2, nPE);
+}
+
+/**
+  @} end of cmplx_dot_prod_conj group
+ */
@@ -82,13 +82,31 @@ void plp_cmplx_dot_prod_i8_xpulpv2(const int8_t *pSrcA,
                                    uint32_t numSamples,
                                    int8_t *realResult,
                                    int8_t *imagResult) {
-    uint32_t blkCnt;                   /* Loop counter */
-    int8_t real_sum = 0, imag_sum = 0; /* Temporary result variables */
+    uint32_t blkCnt;                    /* Loop counter */
+    int32_t real_sum = 0, imag_sum = 0; /* Temporary result variables */
     int8_t a0, b0, c0, d0;
+    v4s x, y; /* Two complex samples of each input as a packed word */
+    const v4s conjMask = { 0, 5, 2, 7 };
+    const v4s swapMask = { 1, 0, 3, 2 };
 
-    /* Initialize blkCnt with number of samples */
-    blkCnt = numSamples;
+    /* Two complex samples fill one packed word. The 32-bit sums wrap around like the 8-bit ones
+       modulo 256, such that the result is the same. */
+    blkCnt = numSamples >> 1U;
     while (blkCnt > 0U) {
+        x = *((v4s *)pSrcA);
+        y = *((v4s *)pSrcB);
+        pSrcA += 4;
+        pSrcB += 4;
+
+        real_sum = __SUMDOTP4(x, __builtin_shuffle(y, -y, conjMask), real_sum);
+        imag_sum = __SUMDOTP4(x, __builtin_shuffle(y, swapMask), imag_sum);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Compute the remaining sample */
+    if (numSamples % 2U) {
         a0 = *pSrcA++;
         b0 = *pSrcA++;
         c0 = *pSrcB++;
@@ -98,15 +116,11 @@ void plp_cmplx_dot_prod_i8_xpulpv2(const int8_t *pSrcA,
         imag_sum += a0 * d0;
         real_sum -= b0 * d0;
         imag_sum += b0 * c0;
-
-        /* Decrement loop counter */
-        blkCnt--;
     }
 
     /* Store real and imaginary result in destination buffer. */
-    *realResult = real_sum;
-    *imagResult = imag_sum;
-    // printf("real %d imag %d\n", real_sum, imag_sum);
+    *realResult = (int8_t)real_sum;
+    *imagResult = (int8_t)imag_sum;
 }
 /**
   @} end of cmplx_dot_prod group
@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_join_f32p_xpulpv2.c
+ * Description:  Parallel join of 32-bit float complex vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_split
+  @{
+ */
+
+/**
+  @brief Parallel join of the real and imaginary parts into a 32-bit float complex vector kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_cmplx_join_instance_f32 struct initialized by
+                    plp_cmplx_join_f32_parallel
+  @return     none
+
+  @par Parallelization
+  Every core processes a contiguous chunk of the samples with plp_cmplx_join_f32_xpulpv2.
+ */
+
+void plp_cmplx_join_f32p_xpulpv2(void *args) {
+
+    plp_cmplx_join_instance_f32 *a = (plp_cmplx_join_instance_f32 *)args;
+
+    uint32_t start, end;
+
+    plp_team_chunk(a->numSamples, a->nPE, rt_core_id(), 1, &start, &end);
+
+    if (start < end) {
+        plp_cmplx_join_f32_xpulpv2(a->pSrcRe + start,
+                                   a->pSrcIm + start,
+                                   end - start,
+                                   a->pDst + 2 * start);
+    }
+}
+
+/**
+  @} end of cmplx_split group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_join_i16_xpulpv2.c
+ * Description:  Join of 16-bit integer complex vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_split
+  @{
+ */
+
+/**
+  @brief Join of the real and imaginary parts into a 16-bit integer complex vector for XPULPV2
+         extension.
+  @param[in]  pSrcRe      points to the real parts
+  @param[in]  pSrcIm      points to the imaginary parts
+  @param[in]  numSamples  number of complex samples
+  @param[out] pDst        points to the interleaved complex output vector
+  @return     none
+ */
+
+void plp_cmplx_join_i16_xpulpv2(const int16_t *__restrict__ pSrcRe,
+                                const int16_t *__restrict__ pSrcIm,
+                                uint32_t numSamples,
+                                int16_t *__restrict__ pDst) {
+
+    uint32_t n;
+
+    // two samples at a time, a 2x2 transpose of two words
+    for (n = 0; n + 1 < numSamples; n += 2) {
+        v2s re = *(v2s *)&pSrcRe[n];
+        v2s im = *(v2s *)&pSrcIm[n];
+        *(v2s *)&pDst[2 * n] = __builtin_shuffle(re, im, (v2s){ 0, 2 });
+        *(v2s *)&pDst[2 * n + 2] = __builtin_shuffle(re, im, (v2s){ 1, 3 });
+    }
+    if (n < numSamples) {
+        pDst[2 * n] = pSrcRe[n];
+        pDst[2 * n + 1] = pSrcIm[n];
+    }
+}
+
+/**
+  @} end of cmplx_split group
+ */
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_join_i32_rv32im.c
+ * Description:  Join of 32-bit integer complex vectors for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_split
+  @{
+ */
+
+/**
+  @brief Join of the real and imaginary parts into a 32-bit integer complex vector for RV32IM
+         extension.
+  @param[in]  pSrcRe      points to the real parts
+  @param[in]  pSrcIm      points to the imaginary parts
+  @param[in]  numSamples  number of complex samples
+  @param[out] pDst        points to the interleaved complex output vector
+  @return     none
+ */
+
+void plp_cmplx_join_i32_rv32im(const int32_t *__restrict__ pSrcRe,
+                               const int32_t *__restrict__ pSrcIm,
+                               uint32_t numSamples,
+                               int32_t *__restrict__ pDst) {
+
+    uint32_t n;
+
+    for (n = 0; n < numSamples; n++) {
+        int32_t re = pSrcRe[n];
+        int32_t im = pSrcIm[n];
+        pDst[2 * n] = re;
+        pDst[2 * n + 1] = im;
+    }
+}
+
+/**
+  @} end of cmplx_split group
+ */
@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_fast_q16s_rv32im.c
+ * Description:  Fast q16 complex magnitude for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_fast
+  @{
+ */
+
+/**
+  @brief Fast complex magnitude of 16-bit fixed-point vectors for RV32IM extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of complex samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_fast_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                    int16_t *__restrict__ pDst,
+                                    uint32_t numSamples) {
+    uint32_t blkCnt;             /* Loop counter */
+    int32_t real, imag;          /* Absolute values of the input */
+    int32_t hi, lo, mag;         /* Larger and smaller part, and the result */
+    const int32_t alpha = 29425; /* 0.898 in Q1.15 */
+    const int32_t beta = 15939;  /* 0.486 in Q1.15 */
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = numSamples;
+    while (blkCnt > 0U) {
+        /* C[0] = max(hi, alpha * hi + beta * lo) */
+
+        real = *pSrc++;
+        imag = *pSrc++;
+
+        /* INT16_MIN is treated as -INT16_MAX, like in the packed version */
+        real = (real < 0) ? -real : real;
+        imag = (imag < 0) ? -imag : imag;
+        if (real > INT16_MAX) {
+            real = INT16_MAX;
+        }
+        if (imag > INT16_MAX) {
+            imag = INT16_MAX;
+        }
+
+        hi = (real > imag) ? real : imag;
+        lo = (real > imag) ? imag : real;
+        mag = (alpha * hi + beta * lo + (1 << 14)) >> 15;
+        if (mag > INT16_MAX) {
+            mag = INT16_MAX;
+        }
+
+        /* store result in destination buffer. */
+        *pDst++ = (int16_t)((mag > hi) ? mag : hi);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of cmplx_mag_fast group
+ */
@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_fast_q16s_xpulpv2.c
+ * Description:  Fast q16 complex magnitude for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_fast
+  @{
+ */
+
+/**
+  @brief Fast complex magnitude of 16-bit fixed-point vectors for XPULPV2 extension.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of complex samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_fast_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                     int16_t *__restrict__ pDst,
+                                     uint32_t numSamples) {
+    uint32_t blkCnt;    /* Loop counter */
+    v2s x0, x1;         /* Two complex samples as packed words */
+    v2s real, imag;     /* Absolute real and imaginary parts of both samples */
+    v2s hi, lo;         /* Larger and smaller part of both samples */
+    int32_t mag0, mag1; /* Weighted sums of both samples */
+    const v2s coeff = { 29425, 15939 }; /* alpha = 0.898 and beta = 0.486 in Q1.15 */
+    const v2s minVal = { -INT16_MAX, -INT16_MAX };
+
+    /* Two samples per iteration, such that the real and imaginary parts fill one word each */
+    blkCnt = numSamples >> 1U;
+    while (blkCnt > 0U) {
+        /* C[0] = max(hi, alpha * hi + beta * lo) */
+
+        x0 = *((v2s *)pSrc);
+        x1 = *((v2s *)(pSrc + 2));
+        pSrc += 4;
+
+        /* INT16_MIN is moved to -INT16_MAX first, as its absolute value would wrap around */
+        real = __ABS2(__MAX2(__builtin_shuffle(x0, x1, (v2s){ 0, 2 }), minVal));
+        imag = __ABS2(__MAX2(__builtin_shuffle(x0, x1, (v2s){ 1, 3 }), minVal));
+        hi = __MAX2(real, imag);
+        lo = __MIN2(real, imag);
+
+        mag0 = __ROUNDNORM_REG(__DOTP2(__builtin_shuffle(hi, lo, (v2s){ 0, 2 }), coeff), 15);
+        mag1 = __ROUNDNORM_REG(__DOTP2(__builtin_shuffle(hi, lo, (v2s){ 1, 3 }), coeff), 15);
+
+        /* store result in destination buffer. */
+        *((v2s *)pDst) = __MAX2(hi, __PACK2(__CLIP(mag0, 15), __CLIP(mag1, 15)));
+        pDst += 2;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Compute the remaining sample */
+    if (numSamples % 2U) {
+        plp_cmplx_mag_fast_q16s_rv32im(pSrc, pDst, 1);
+    }
+}
+
+/**
+  @} end of cmplx_mag_fast group
+ */
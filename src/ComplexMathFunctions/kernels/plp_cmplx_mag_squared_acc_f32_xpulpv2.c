@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_squared_acc_f32_xpulpv2.c
+ * Description:  32-bit float complex squared magnitude accumulation for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_squared_acc
+  @{
+ */
+
+/**
+  @brief 32-bit float complex squared magnitude accumulation for XPULPV2 extension.
+  @param[in]     pSrc        points to the complex input vector
+  @param[in,out] pAcc        points to the accumulator vector
+  @param[in]     alpha       averaging weight, 0 for plain accumulation
+  @param[in]     numSamples  number of complex samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_acc_f32_xpulpv2(const float32_t *__restrict__ pSrc,
+                                           float32_t *__restrict__ pAcc,
+                                           float32_t alpha,
+                                           uint32_t numSamples) {
+    uint32_t blkCnt;      /* Loop counter */
+    float32_t real, imag; /* Temporary input variables */
+    float32_t pwr;        /* Squared magnitude of one sample */
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = numSamples;
+    if (alpha == 0.0f) {
+        while (blkCnt > 0U) {
+            /* Acc[n] += A[2n]^2 + A[2n+1]^2 */
+            real = *pSrc++;
+            imag = *pSrc++;
+            *pAcc++ += (real * real) + (imag * imag);
+
+            /* Decrement loop counter */
+            blkCnt--;
+        }
+    } else {
+        while (blkCnt > 0U) {
+            /* Acc[n] += alpha * (A[2n]^2 + A[2n+1]^2 - Acc[n]) */
+            real = *pSrc++;
+            imag = *pSrc++;
+            pwr = (real * real) + (imag * imag);
+            *pAcc += alpha * (pwr - *pAcc);
+            pAcc++;
+
+            /* Decrement loop counter */
+            blkCnt--;
+        }
+    }
+}
+
+/**
+  @} end of cmplx_mag_squared_acc group
+ */
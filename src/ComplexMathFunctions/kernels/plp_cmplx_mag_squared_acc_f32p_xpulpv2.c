@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_squared_acc_f32p_xpulpv2.c
+ * Description:  Parallel complex squared magnitude accumulation of f32 vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_squared_acc
+  @{
+ */
+
+/**
+  @brief Parallel complex squared magnitude accumulation of 32-bit float vectors kernel for XPULPV2
+  extension.
+  @param[in]  args  pointer to plp_cmplx_mag_squared_acc_instance_f32 struct initialized by
+                    plp_cmplx_mag_squared_acc_f32_parallel
+  @return     none
+
+  @par Parallelization
+  Every core updates a contiguous chunk of the accumulator with
+  plp_cmplx_mag_squared_acc_f32_xpulpv2.
+ */
+
+void plp_cmplx_mag_squared_acc_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_cmplx_mag_squared_acc_instance_f32 *a = (plp_cmplx_mag_squared_acc_instance_f32 *)args;
+
+    uint32_t numSamples = a->numSamples;
+    uint32_t nPE = a->nPE;
+    uint32_t chunk = (numSamples + nPE - 1) / nPE;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > numSamples) {
+        start = numSamples;
+    }
+    if (end > numSamples) {
+        end = numSamples;
+    }
+
+    if (start < end) {
+        plp_cmplx_mag_squared_acc_f32_xpulpv2(a->pSrc + 2 * start,
+                                              a->pAcc + start,
+                                              a->alpha,
+                                              end - start);
+    }
+}
+
+/**
+  @} end of cmplx_mag_squared_acc group
+ */
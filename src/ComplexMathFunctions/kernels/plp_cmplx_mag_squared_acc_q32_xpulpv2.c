@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_squared_acc_q32_xpulpv2.c
+ * Description:  32-bit fixed-point complex squared magnitude accumulation for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_squared_acc
+  @{
+ */
+
+/**
+  @brief 32-bit fixed-point complex squared magnitude accumulation for XPULPV2 extension.
+  @param[in]     pSrc        points to the complex input vector
+  @param[in,out] pAcc        points to the accumulator vector
+  @param[in]     deciPoint   decimal point for right shift of the squared magnitude
+  @param[in]     alpha       averaging weight in Q1.15, 0 for plain accumulation
+  @param[in]     numSamples  number of complex samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_acc_q32_xpulpv2(const int32_t *__restrict__ pSrc,
+                                           int32_t *__restrict__ pAcc,
+                                           uint32_t deciPoint,
+                                           int16_t alpha,
+                                           uint32_t numSamples) {
+    uint32_t blkCnt;                                /* Loop counter */
+    uint64_t rnd = ((uint64_t)1 << deciPoint) >> 1; /* Rounding of the shift */
+    uint32_t pwr;                                   /* Squared magnitude of one sample */
+    int32_t acc;                                    /* Temporary accumulator value */
+    int32_t real, imag;                             /* Temporary input variables */
+    uint64_t pwr64;                                 /* Full precision squared magnitude */
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = numSamples;
+    if (alpha == 0) {
+        while (blkCnt > 0U) {
+            /* Acc[n] += (A[2n]^2 + A[2n+1]^2) >> deciPoint */
+            real = *pSrc++;
+            imag = *pSrc++;
+            /* the unsigned sum still holds 2^63 for two INT32_MIN parts */
+            pwr64 = (uint64_t)((int64_t)real * real) + (uint64_t)((int64_t)imag * imag);
+            pwr64 = (pwr64 + rnd) >> deciPoint;
+            pwr = (pwr64 > 0x7FFFFFFFU) ? 0x7FFFFFFFU : (uint32_t)pwr64;
+
+            /* saturate instead of wrapping the non-negative accumulator */
+            pwr += (uint32_t)*pAcc;
+            *pAcc++ = (pwr > 0x7FFFFFFFU) ? 0x7FFFFFFF : (int32_t)pwr;
+
+            /* Decrement loop counter */
+            blkCnt--;
+        }
+    } else {
+        while (blkCnt > 0U) {
+            /* Acc[n] += alpha * (((A[2n]^2 + A[2n+1]^2) >> deciPoint) - Acc[n]) */
+            real = *pSrc++;
+            imag = *pSrc++;
+            /* the unsigned sum still holds 2^63 for two INT32_MIN parts */
+            pwr64 = (uint64_t)((int64_t)real * real) + (uint64_t)((int64_t)imag * imag);
+            pwr64 = (pwr64 + rnd) >> deciPoint;
+            pwr = (pwr64 > 0x7FFFFFFFU) ? 0x7FFFFFFFU : (uint32_t)pwr64;
+
+            /* the step lies between zero and the difference, such that the result is between the
+               old value and the new squared magnitude */
+            acc = *pAcc;
+            acc += (int32_t)(((int64_t)alpha * ((int32_t)pwr - acc) + (1 << 14)) >> 15);
+            *pAcc++ = acc;
+
+            /* Decrement loop counter */
+            blkCnt--;
+        }
+    }
+}
+
+/**
+  @} end of cmplx_mag_squared_acc group
+ */
@@ -76,22 +76,34 @@ void plp_cmplx_mag_squared_i8_xpulpv2(const int8_t *__restrict__ pSrc,
                                       int8_t *__restrict__ pDst,
                                       uint32_t numSamples) {
     uint32_t blkCnt;   /* Loop counter */
+    v4s x;             /* Two complex samples as a packed word */
     int8_t real, imag; /* Temporary input variables */
+    const v4s zero = { 0, 0, 0, 0 };
+    const v4s mask0 = { 0, 1, 4, 4 }; /* Keep the first sample only */
+    const v4s mask1 = { 4, 4, 2, 3 }; /* Keep the second sample only */
 
-    /* Initialize blkCnt with number of samples */
-    blkCnt = numSamples;
+    /* Two complex samples fill one packed word */
+    blkCnt = numSamples >> 1U;
     while (blkCnt > 0U) {
         /* C[0] = (A[0] * A[0] + A[1] * A[1]) */
 
-        real = *pSrc++;
-        imag = *pSrc++;
+        x = *((v4s *)pSrc);
+        pSrc += 4;
 
         /* store result in destination buffer. */
-        *pDst++ = (real * real) + (imag * imag);
+        *pDst++ = __DOTP4(x, __builtin_shuffle(x, zero, mask0));
+        *pDst++ = __DOTP4(x, __builtin_shuffle(x, zero, mask1));
 
         /* Decrement loop counter */
         blkCnt--;
     }
+
+    /* Compute the remaining sample */
+    if (numSamples % 2U) {
+        real = *pSrc++;
+        imag = *pSrc++;
+        *pDst++ = (real * real) + (imag * imag);
+    }
 }
 
 /**
@@ -76,8 +76,9 @@ void plp_cmplx_mult_cmplx_i16_xpulpv2(const int16_t *__restrict__ pSrcA,
                                       const int16_t *__restrict__ pSrcB,
                                       int16_t *__restrict__ pDst,
                                       uint32_t numSamples) {
-    uint32_t blkCnt;    /* Loop counter */
-    int16_t a, b, c, d; /* Temporary variables to store real and imaginary values */
+    uint32_t blkCnt; /* Loop counter */
+    v2s a, b;        /* One complex sample of each input as a packed word */
+    int16_t re, im;
 
     /* Initialize blkCnt with number of samples */
     blkCnt = numSamples;
@@ -85,14 +86,19 @@ void plp_cmplx_mult_cmplx_i16_xpulpv2(const int16_t *__restrict__ pSrcA,
         /* C[2 * i    ] = A[2 * i] * B[2 * i    ] - A[2 * i + 1] * B[2 * i + 1]. */
         /* C[2 * i + 1] = A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i    ]. */
 
-        a = *pSrcA++;
-        b = *pSrcA++;
-        c = *pSrcB++;
-        d = *pSrcB++;
+        a = *((v2s *)pSrcA);
+        b = *((v2s *)pSrcB);
+        pSrcA += 2;
+        pSrcB += 2;
+
+        /* real part with the conjugate of B, imaginary part with the swapped B. Negating
+           INT16_MIN wraps, which does not change the lower 16 bits of the result. */
+        re = (int16_t)__DOTP2(a, __PACK2(b[0], -b[1]));
+        im = (int16_t)__DOTP2(a, __builtin_shuffle(b, (v2s){ 1, 0 }));
 
         /* store result in destination buffer. */
-        *pDst++ = (a * c) - (b * d);
-        *pDst++ = (a * d) + (b * c);
+        *((v2s *)pDst) = __PACK2(re, im);
+        pDst += 2;
 
         /* Decrement loop counter */
         blkCnt--;
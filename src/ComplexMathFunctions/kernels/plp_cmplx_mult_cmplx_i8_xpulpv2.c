@@ -78,13 +78,43 @@ void plp_cmplx_mult_cmplx_i8_xpulpv2(const int8_t *__restrict__ pSrcA,
                                      uint32_t numSamples) {
     uint32_t blkCnt;   /* Loop counter */
     int8_t a, b, c, d; /* Temporary variables to store real and imaginary values */
+    v4s x, y;          /* Two complex samples of each input as a packed word */
+    v4s x0, x1;        /* First and second sample of A, the other one set to zero */
+    v4s yConj, ySwap;  /* B conjugated and B with real and imaginary parts swapped */
+    const v4s zero = { 0, 0, 0, 0 };
+    const v4s mask0 = { 0, 1, 4, 4 };
+    const v4s mask1 = { 4, 4, 2, 3 };
+    const v4s conjMask = { 0, 5, 2, 7 };
+    const v4s swapMask = { 1, 0, 3, 2 };
 
-    /* Initialize blkCnt with number of samples */
-    blkCnt = numSamples;
+    /* Two complex samples fill one packed word */
+    blkCnt = numSamples >> 1U;
     while (blkCnt > 0U) {
         /* C[2 * i    ] = A[2 * i] * B[2 * i    ] - A[2 * i + 1] * B[2 * i + 1]. */
         /* C[2 * i + 1] = A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i    ]. */
 
+        x = *((v4s *)pSrcA);
+        y = *((v4s *)pSrcB);
+        pSrcA += 4;
+        pSrcB += 4;
+
+        /* the negation may wrap, which does not change the 8-bit result */
+        x0 = __builtin_shuffle(x, zero, mask0);
+        x1 = __builtin_shuffle(x, zero, mask1);
+        yConj = __builtin_shuffle(y, -y, conjMask);
+        ySwap = __builtin_shuffle(y, swapMask);
+
+        /* store result in destination buffer. */
+        *((v4s *)pDst) = __PACK4(__DOTP4(x0, yConj), __DOTP4(x0, ySwap), __DOTP4(x1, yConj),
+                                 __DOTP4(x1, ySwap));
+        pDst += 4;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Compute the remaining sample */
+    if (numSamples % 2U) {
         a = *pSrcA++;
         b = *pSrcA++;
         c = *pSrcB++;
@@ -93,9 +123,6 @@ void plp_cmplx_mult_cmplx_i8_xpulpv2(const int8_t *__restrict__ pSrcA,
         /* store result in destination buffer. */
         *pDst++ = (a * c) - (b * d);
         *pDst++ = (a * d) + (b * c);
-
-        /* Decrement loop counter */
-        blkCnt--;
     }
 }
 
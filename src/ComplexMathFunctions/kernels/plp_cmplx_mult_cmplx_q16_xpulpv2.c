@@ -71,8 +71,10 @@ void plp_cmplx_mult_cmplx_q16_xpulpv2(const int16_t *__restrict__ pSrcA,
                                       int16_t *__restrict__ pDst,
                                       uint32_t deciPoint,
                                       uint32_t numSamples) {
-    uint32_t blkCnt;    /* Loop counter */
-    int16_t a, b, c, d; /* Temporary variables to store real and imaginary values */
+    uint32_t blkCnt; /* Loop counter */
+    v2s a, b;        /* One complex sample of each input as a packed word */
+    int16_t nbi;     /* Negated imaginary part of B */
+    int32_t re, im;
 
     /* Initialize blkCnt with number of samples */
     blkCnt = numSamples;
@@ -80,14 +82,20 @@ void plp_cmplx_mult_cmplx_q16_xpulpv2(const int16_t *__restrict__ pSrcA,
         /* C[2 * i    ] = A[2 * i] * B[2 * i    ] - A[2 * i + 1] * B[2 * i + 1]. */
         /* C[2 * i + 1] = A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i    ]. */
 
-        a = *pSrcA++;
-        b = *pSrcA++;
-        c = *pSrcB++;
-        d = *pSrcB++;
+        a = *((v2s *)pSrcA);
+        b = *((v2s *)pSrcB);
+        pSrcA += 2;
+        pSrcB += 2;
+
+        /* real part with the conjugate of B, imaginary part with the swapped B. The negation
+           saturates like plp_cmplx_conj_i16, as a wrapped INT16_MIN would flip the sign. */
+        nbi = (b[1] == INT16_MIN) ? INT16_MAX : -b[1];
+        re = __DOTP2(a, __PACK2(b[0], nbi));
+        im = __DOTP2(a, __builtin_shuffle(b, (v2s){ 1, 0 }));
 
         /* store result in destination buffer. */
-        *pDst++ = __ROUNDNORM_REG((a * c), deciPoint) - __ROUNDNORM_REG((b * d), deciPoint);
-        *pDst++ = __ROUNDNORM_REG((a * d), deciPoint) + __ROUNDNORM_REG((b * c), deciPoint);
+        *((v2s *)pDst) = __PACK2(__ROUNDNORM_REG(re, deciPoint), __ROUNDNORM_REG(im, deciPoint));
+        pDst += 2;
 
         /* Decrement loop counter */
         blkCnt--;
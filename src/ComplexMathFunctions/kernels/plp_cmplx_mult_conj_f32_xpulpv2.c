@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mult_conj_f32_xpulpv2.c
+ * Description:  32-bit float complex-by-conjugate multiplication for XPULPV2
+ *
+ * $Date:        29. June 2020
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2019 ETH Zurich and Ubiversity of Bologna.
+ *
+ * Author: Hanna Mueller, ETH Zurich
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Notice: project inspired by ARM CMSIS DSP and parts of source code
+  ported and adopted for RISC-V PULP platform from ARM CMSIS DSP
+ released under Copyright (C) 2010-2019 ARM Limited or its affiliates
+  with Apache-2.0.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxByConjMult Complex-by-Conjugate Multiplication
+  Multiplies a complex vector by the conjugate of another complex vector and generates a complex
+  result. The conjugation is folded into the products, such that no conjugated copy of
+  <code>pSrcB</code> is needed.
+  The data in the complex arrays is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The parameter <code>numSamples</code> represents the number of complex
+  samples processed.  The complex arrays have a total of <code>2*numSamples</code>
+  real values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDst[(2*n)+0] = pSrcA[(2*n)+0] * pSrcB[(2*n)+0] + pSrcA[(2*n)+1] * pSrcB[(2*n)+1];
+      pDst[(2*n)+1] = pSrcA[(2*n)+1] * pSrcB[(2*n)+0] - pSrcA[(2*n)+0] * pSrcB[(2*n)+1];
+  }
+  </pre>
+  There are separate functions for floating point, integer, and fixed point 32- 16- 8-bit data
+  types.
+ */
+
+/**
+  @addtogroup CmplxByConjMult
+  @{
+ */
+
+/**
+  @brief         Floating-point complex-by-conjugate multiplication.
+  @param[in]     pSrcA       points to complex input vector
+  @param[in]     pSrcB       points to real input vector
+  @param[out]    pDst        points to complex output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void plp_cmplx_mult_conj_f32_xpulpv2(const float32_t *__restrict__ pSrcA,
+                                     const float32_t *__restrict__ pSrcB,
+                                     float32_t *__restrict__ pDst,
+                                     uint32_t numSamples) {
+    uint32_t blkCnt;      /* Loop counter */
+    float32_t a, b, c, d; /* Temporary variables to store real and imaginary values */
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = numSamples;
+    while (blkCnt > 0U) {
+        /* C[2 * i    ] = A[2 * i] * B[2 * i    ] + A[2 * i + 1] * B[2 * i + 1]. */
+        /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i    ] - A[2 * i] * B[2 * i + 1]. */
+
+        a = *pSrcA++;
+        b = *pSrcA++;
+        c = *pSrcB++;
+        d = *pSrcB++;
+
+        /* store result in destination buffer. */
+        *pDst++ = (a * c) + (b * d);
+        *pDst++ = (b * c) - (a * d);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+  @} end of CmplxByConjMult group
+ */
\ No newline at end of file
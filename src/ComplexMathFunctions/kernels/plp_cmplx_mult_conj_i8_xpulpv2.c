@@ -0,0 +1,130 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mult_conj_i8_xpulpv2.c
+ * Description:  8-bit integer complex-by-conjugate multiplication for XPULPV2
+ *
+ * $Date:        29. June 2020
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2019 ETH Zurich and Ubiversity of Bologna.
+ *
+ * Author: Hanna Mueller, ETH Zurich
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Notice: project inspired by ARM CMSIS DSP and parts of source code
+  ported and adopted for RISC-V PULP platform from ARM CMSIS DSP
+ released under Copyright (C) 2010-2019 ARM Limited or its affiliates
+  with Apache-2.0.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup CmplxByConjMult Complex-by-Conjugate Multiplication
+  Multiplies a complex vector by the conjugate of another complex vector and generates a complex
+  result. The conjugation is folded into the products, such that no conjugated copy of
+  <code>pSrcB</code> is needed.
+  The data in the complex arrays is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The parameter <code>numSamples</code> represents the number of complex
+  samples processed.  The complex arrays have a total of <code>2*numSamples</code>
+  real values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDst[(2*n)+0] = pSrcA[(2*n)+0] * pSrcB[(2*n)+0] + pSrcA[(2*n)+1] * pSrcB[(2*n)+1];
+      pDst[(2*n)+1] = pSrcA[(2*n)+1] * pSrcB[(2*n)+0] - pSrcA[(2*n)+0] * pSrcB[(2*n)+1];
+  }
+  </pre>
+  There are separate functions for floating point, integer, and fixed point 32- 16- 8-bit data
+  types.
+ */
+
+/**
+  @addtogroup CmplxByConjMult
+  @{
+ */
+
+/**
+  @brief         8-bit integer complex-by-conjugate multiplication
+  @param[in]     pSrcA       points to first input vector
+  @param[in]     pSrcB       points to second input vector
+  @param[out]    pDst        points to output vector
+  @param[in]     numSamples  number of samples in each vector
+  @return        none
+ */
+void plp_cmplx_mult_conj_i8_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    int8_t *__restrict__ pDst,
+                                    uint32_t numSamples) {
+    uint32_t blkCnt;   /* Loop counter */
+    int8_t a, b, c, d; /* Temporary variables to store real and imaginary values */
+    v4s x, y;          /* Two complex samples of each input as a packed word */
+    v4s x0, x1;        /* First and second sample of A, the other one set to zero */
+    v4s yNegSwap;      /* B swapped, with the new real parts negated */
+    const v4s zero = { 0, 0, 0, 0 };
+    const v4s mask0 = { 0, 1, 4, 4 };
+    const v4s mask1 = { 4, 4, 2, 3 };
+    const v4s negSwapMask = { 5, 0, 7, 2 };
+
+    /* Two complex samples fill one packed word */
+    blkCnt = numSamples >> 1U;
+    while (blkCnt > 0U) {
+        /* C[2 * i    ] = A[2 * i] * B[2 * i    ] + A[2 * i + 1] * B[2 * i + 1]. */
+        /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i    ] - A[2 * i] * B[2 * i + 1]. */
+
+        x = *((v4s *)pSrcA);
+        y = *((v4s *)pSrcB);
+        pSrcA += 4;
+        pSrcB += 4;
+
+        /* the negation may wrap, which does not change the 8-bit result */
+        x0 = __builtin_shuffle(x, zero, mask0);
+        x1 = __builtin_shuffle(x, zero, mask1);
+        yNegSwap = __builtin_shuffle(y, -y, negSwapMask);
+
+        /* store result in destination buffer. The real parts are the plain dot products. */
+        *((v4s *)pDst) = __PACK4(__DOTP4(x0, y), __DOTP4(x0, yNegSwap), __DOTP4(x1, y),
+                                 __DOTP4(x1, yNegSwap));
+        pDst += 4;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Compute the remaining sample */
+    if (numSamples % 2U) {
+        a = *pSrcA++;
+        b = *pSrcA++;
+        c = *pSrcB++;
+        d = *pSrcB++;
+
+        /* store result in destination buffer. */
+        *pDst++ = (a * c) + (b * d);
+        *pDst++ = (b * c) - (a * d);
+    }
+}
+
+/**
+  @} end of CmplxByConjMult group
+ */
\ No newline at end of file
@@ -77,26 +77,34 @@ void plp_cmplx_mult_real_i8_xpulpv2(const int8_t *__restrict__ pSrcCmplx,
                                     int8_t *__restrict__ pDst,
                                     uint32_t numSamples) {
     uint32_t blkCnt; /* Loop counter */
-    int8_t in;       /* Temporary variable */
+    v4s x;           /* Two complex samples as a packed word */
+    int8_t in0, in1; /* Temporary variables */
 
-    /* Initialize blkCnt with number of samples */
-    blkCnt = 2 * numSamples;
-    int8_t even = 1;
+    /* Two complex samples fill one packed word */
+    blkCnt = numSamples >> 1U;
     while (blkCnt > 0U) {
         /* C[2 * i    ] = A[2 * i    ] * B[i]. */
         /* C[2 * i + 1] = A[2 * i + 1] * B[i]. */
 
-        if (even == 1) {
-            in = *pSrcReal++;
-            /* store result in destination buffer. */
-            *pDst++ = *pSrcCmplx++ * in;
-        } else {
-            *pDst++ = *pSrcCmplx++ * in;
-        }
-        even = !even;
+        x = *((v4s *)pSrcCmplx);
+        pSrcCmplx += 4;
+        in0 = *pSrcReal++;
+        in1 = *pSrcReal++;
+
+        /* store result in destination buffer. */
+        *((v4s *)pDst) = __PACK4(x[0] * in0, x[1] * in0, x[2] * in1, x[3] * in1);
+        pDst += 4;
+
         /* Decrement loop counter */
         blkCnt--;
     }
+
+    /* Compute the remaining sample */
+    if (numSamples % 2U) {
+        in0 = *pSrcReal++;
+        *pDst++ = *pSrcCmplx++ * in0;
+        *pDst++ = *pSrcCmplx++ * in0;
+    }
 }
 
 /**
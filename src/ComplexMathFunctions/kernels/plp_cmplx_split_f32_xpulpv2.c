@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_split_f32_xpulpv2.c
+ * Description:  Split of 32-bit float complex vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_split
+  @{
+ */
+
+/**
+  @brief Split of a 32-bit float complex vector into its real and imaginary parts for XPULPV2
+         extension.
+  @param[in]  pSrc        points to the interleaved complex input vector
+  @param[in]  numSamples  number of complex samples
+  @param[out] pDstRe      points to the real parts
+  @param[out] pDstIm      points to the imaginary parts
+  @return     none
+ */
+
+void plp_cmplx_split_f32_xpulpv2(const float32_t *__restrict__ pSrc,
+                                 uint32_t numSamples,
+                                 float32_t *__restrict__ pDstRe,
+                                 float32_t *__restrict__ pDstIm) {
+
+    uint32_t n;
+
+    for (n = 0; n + 1 < numSamples; n += 2) {
+        float32_t re0 = pSrc[2 * n];
+        float32_t im0 = pSrc[2 * n + 1];
+        float32_t re1 = pSrc[2 * n + 2];
+        float32_t im1 = pSrc[2 * n + 3];
+        pDstRe[n] = re0;
+        pDstIm[n] = im0;
+        pDstRe[n + 1] = re1;
+        pDstIm[n + 1] = im1;
+    }
+    if (n < numSamples) {
+        pDstRe[n] = pSrc[2 * n];
+        pDstIm[n] = pSrc[2 * n + 1];
+    }
+}
+
+/**
+  @} end of cmplx_split group
+ */
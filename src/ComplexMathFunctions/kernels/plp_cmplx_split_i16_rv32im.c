@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_split_i16_rv32im.c
+ * Description:  Split of 16-bit integer complex vectors for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_split
+  @{
+ */
+
+/**
+  @brief Split of a 16-bit integer complex vector into its real and imaginary parts for RV32IM
+         extension.
+  @param[in]  pSrc        points to the interleaved complex input vector
+  @param[in]  numSamples  number of complex samples
+  @param[out] pDstRe      points to the real parts
+  @param[out] pDstIm      points to the imaginary parts
+  @return     none
+ */
+
+void plp_cmplx_split_i16_rv32im(const int16_t *__restrict__ pSrc,
+                                uint32_t numSamples,
+                                int16_t *__restrict__ pDstRe,
+                                int16_t *__restrict__ pDstIm) {
+
+    uint32_t n;
+
+    for (n = 0; n < numSamples; n++) {
+        int16_t re = pSrc[2 * n];
+        int16_t im = pSrc[2 * n + 1];
+        pDstRe[n] = re;
+        pDstIm[n] = im;
+    }
+}
+
+/**
+  @} end of cmplx_split group
+ */
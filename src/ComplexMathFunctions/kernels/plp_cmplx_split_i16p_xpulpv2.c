@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_split_i16p_xpulpv2.c
+ * Description:  Parallel split of 16-bit integer complex vectors for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_split
+  @{
+ */
+
+/**
+  @brief Parallel split of a 16-bit integer complex vector into its real and imaginary parts kernel
+         for XPULPV2 extension.
+  @param[in]  args  pointer to plp_cmplx_split_instance_i16 struct initialized by
+                    plp_cmplx_split_i16_parallel
+  @return     none
+
+  @par Parallelization
+  Every core processes a contiguous chunk of the samples with plp_cmplx_split_i16_xpulpv2. The size
+  of each chunk is a multiple of 2 samples, such that all chunks have the same word alignment.
+ */
+
+void plp_cmplx_split_i16p_xpulpv2(void *args) {
+
+    plp_cmplx_split_instance_i16 *a = (plp_cmplx_split_instance_i16 *)args;
+
+    uint32_t start, end;
+
+    plp_team_chunk(a->numSamples, a->nPE, rt_core_id(), 2, &start, &end);
+
+    if (start < end) {
+        plp_cmplx_split_i16_xpulpv2(a->pSrc + 2 * start,
+                                    end - start,
+                                    a->pDstRe + start,
+                                    a->pDstIm + start);
+    }
+}
+
+/**
+  @} end of cmplx_split group
+ */
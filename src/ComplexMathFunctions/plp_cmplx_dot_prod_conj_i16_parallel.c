@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_dot_prod_conj_i16_parallel.c
+ * Description:  Glue code for the parallel complex dot product with conjugate of i16 vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_dot_prod_conj
+  @{
+ */
+
+/**
+  @brief Glue code for parallel complex dot product with conjugate of 16-bit integer vectors.
+  @param[in]     pSrcA       points to the first input vector
+  @param[in]     pSrcB       points to the second input vector
+  @param[in]     numSamples  number of complex samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @param[out]    realResult  real part of the result
+  @param[out]    imagResult  imaginary part of the result
+  @return        none
+ */
+
+void plp_cmplx_dot_prod_conj_i16_parallel(const int16_t *pSrcA,
+                                          const int16_t *pSrcB,
+                                          uint32_t numSamples,
+                                          uint32_t nPE,
+                                          int16_t *realResult,
+                                          int16_t *imagResult) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        int32_t resBuffer[2 * rt_nb_pe()];
+
+        plp_cmplx_dot_prod_instance_i16 S = { .pSrcA = pSrcA,
+                                              .pSrcB = pSrcB,
+                                              .numSamples = numSamples,
+                                              .nPE = nPE,
+                                              .resBuffer = resBuffer };
+
+        // the cores sum up the real and imaginary parts of their partial sums in a tree, which
+        // leaves the result in the first two entries of resBuffer
+        rt_team_fork(nPE, plp_cmplx_dot_prod_conj_i16p_xpulpv2, (void *)&S);
+
+        *realResult = (int16_t)resBuffer[0];
+        *imagResult = (int16_t)resBuffer[1];
+    }
+}
+
+/**
+  @} end of cmplx_dot_prod_conj group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_join_i16_parallel.c
+ * Description:  Glue code for parallel joining 16-bit integer complex vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_split
+  @{
+ */
+
+/**
+  @brief Glue code for parallel joining of the real and imaginary parts into a 16-bit integer
+         complex vector.
+  @param[in]  pSrcRe      points to the real parts
+  @param[in]  pSrcIm      points to the imaginary parts
+  @param[in]  numSamples  number of complex samples
+  @param[in]  nPE         number of parallel processing units
+  @param[out] pDst        points to the interleaved complex output vector
+  @return     none
+ */
+
+void plp_cmplx_join_i16_parallel(const int16_t *__restrict__ pSrcRe,
+                                 const int16_t *__restrict__ pSrcIm,
+                                 uint32_t numSamples,
+                                 uint32_t nPE,
+                                 int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_cmplx_join_instance_i16 args = { .pSrcRe = pSrcRe,
+                                             .pSrcIm = pSrcIm,
+                                             .numSamples = numSamples,
+                                             .nPE = nPE,
+                                             .pDst = pDst };
+        rt_team_fork(nPE, plp_cmplx_join_i16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of cmplx_split group
+ */
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_fast_q16.c
+ * Description:  Glue code for the fast complex magnitude of q16 vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_mag_fast Fast Complex Magnitude
+  Approximates the magnitude of the elements of a complex data vector without a square root, with
+  the alpha max plus beta min algorithm.
+  The <code>pSrc</code> points to the source data and
+  <code>pDst</code> points to the where the result should be written.
+  <code>numSamples</code> specifies the number of complex samples
+  in the input array and the data is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The input array has a total of <code>2*numSamples</code> values;
+  the output array has a total of <code>numSamples</code> values.
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      hi = max(|pSrc[(2*n)+0]|, |pSrc[(2*n)+1]|);
+      lo = min(|pSrc[(2*n)+0]|, |pSrc[(2*n)+1]|);
+      pDst[n] = max(hi, alpha * hi + beta * lo);
+  }
+  </pre>
+  with alpha = 0.898 and beta = 0.486 (29425 and 15939 in Q1.15), which keeps the relative error
+  below 2.5% for all phases. As the approximation scales with the input, the result has the same
+  format as the input, and the function can be used for 16-bit integers and for every 16-bit
+  fixed-point format. Inputs of INT16_MIN are treated as -INT16_MAX, and the result saturates at
+  INT16_MAX.
+ */
+
+/**
+  @addtogroup cmplx_mag_fast
+  @{
+ */
+
+/**
+  @brief Glue code for fast complex magnitude of 16-bit fixed-point vectors.
+  @param[in]     pSrc        points to the input vector
+  @param[out]    pDst        points to the output vector
+  @param[in]     numSamples  number of complex samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_fast_q16(const int16_t *__restrict__ pSrc,
+                            int16_t *__restrict__ pDst,
+                            uint32_t numSamples) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmplx_mag_fast_q16s_rv32im(pSrc, pDst, numSamples);
+    } else {
+        plp_cmplx_mag_fast_q16s_xpulpv2(pSrc, pDst, numSamples);
+    }
+}
+
+/**
+  @} end of cmplx_mag_fast group
+ */
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_squared_acc_f32_parallel.c
+ * Description:  Glue code for the parallel complex squared magnitude accumulation of f32 vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_mag_squared_acc
+  @{
+ */
+
+/**
+  @brief Glue code for parallel complex squared magnitude accumulation of 32-bit float vectors.
+  @param[in]     pSrc        points to the complex input vector
+  @param[in,out] pAcc        points to the accumulator vector
+  @param[in]     alpha       averaging weight, 0 for plain accumulation
+  @param[in]     numSamples  number of complex samples in each vector
+  @param[in]     nPE         number of parallel processing units
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_acc_f32_parallel(const float32_t *__restrict__ pSrc,
+                                            float32_t *__restrict__ pAcc,
+                                            float32_t alpha,
+                                            uint32_t numSamples,
+                                            uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_cmplx_mag_squared_acc_instance_f32 args = { .pSrc = pSrc,
+                                                        .pAcc = pAcc,
+                                                        .alpha = alpha,
+                                                        .numSamples = numSamples,
+                                                        .nPE = nPE };
+        rt_team_fork(nPE, plp_cmplx_mag_squared_acc_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of cmplx_mag_squared_acc group
+ */
@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_mag_squared_acc_q16.c
+ * Description:  Glue code for the complex squared magnitude accumulation of q16 vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_mag_squared_acc Complex Magnitude Squared Accumulation
+  Accumulates the magnitude squared of the elements of a complex data vector into a buffer, as
+  needed when averaging power spectra (e.g. Welch's method). Compared to
+  plp_cmplx_mag_squared followed by an addition, the squared magnitude is never written back to
+  memory, and the fixed-point versions keep it at the full 32-bit precision of the accumulator.
+  The <code>pSrc</code> points to the source data and <code>pAcc</code> points to the
+  accumulator, which is read and updated. <code>numSamples</code> specifies the number of complex
+  samples in the input array and the data is stored in an interleaved fashion
+  (real, imag, real, imag, ...).
+  The underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      p = pSrc[(2*n)+0]^2 + pSrc[(2*n)+1]^2;
+      if (alpha == 0) {
+          pAcc[n] += p;
+      } else {
+          pAcc[n] += alpha * (p - pAcc[n]);
+      }
+  }
+  </pre>
+  A zero <code>alpha</code> sums up the squared magnitudes of all frames (scale the result once at
+  the end), a non-zero <code>alpha</code> computes an exponential moving average.
+  The fixed-point versions take 16- or 32-bit complex inputs and accumulate into a 32-bit buffer.
+  The squared magnitude is shifted right by <code>deciPoint</code> with rounding, and
+  <code>alpha</code> is in Q1.15 format. The accumulator is expected to hold non-negative values,
+  the plain accumulation saturates at 0x7FFFFFFF.
+  There are separate functions for floating point, and fixed point 32- and 16-bit data types.
+ */
+
+/**
+  @addtogroup cmplx_mag_squared_acc
+  @{
+ */
+
+/**
+  @brief Glue code for complex squared magnitude accumulation of 16-bit fixed-point vectors.
+  @param[in]     pSrc        points to the complex input vector
+  @param[in,out] pAcc        points to the accumulator vector
+  @param[in]     deciPoint   decimal point for right shift of the squared magnitude
+  @param[in]     alpha       averaging weight in Q1.15, 0 for plain accumulation
+  @param[in]     numSamples  number of complex samples in each vector
+  @return        none
+ */
+
+void plp_cmplx_mag_squared_acc_q16(const int16_t *__restrict__ pSrc,
+                                   int32_t *__restrict__ pAcc,
+                                   uint32_t deciPoint,
+                                   int16_t alpha,
+                                   uint32_t numSamples) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmplx_mag_squared_acc_q16_rv32im(pSrc, pAcc, deciPoint, alpha, numSamples);
+    } else {
+        plp_cmplx_mag_squared_acc_q16_xpulpv2(pSrc, pAcc, deciPoint, alpha, numSamples);
+    }
+}
+
+/**
+  @} end of cmplx_mag_squared_acc group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_split_f32_parallel.c
+ * Description:  Glue code for parallel splitting 32-bit float complex vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @addtogroup cmplx_split
+  @{
+ */
+
+/**
+  @brief Glue code for parallel splitting of a 32-bit float complex vector into its real and
+         imaginary parts.
+  @param[in]  pSrc        points to the interleaved complex input vector
+  @param[in]  numSamples  number of complex samples
+  @param[in]  nPE         number of parallel processing units
+  @param[out] pDstRe      points to the real parts
+  @param[out] pDstIm      points to the imaginary parts
+  @return     none
+ */
+
+void plp_cmplx_split_f32_parallel(const float32_t *__restrict__ pSrc,
+                                  uint32_t numSamples,
+                                  uint32_t nPE,
+                                  float32_t *__restrict__ pDstRe,
+                                  float32_t *__restrict__ pDstIm) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_cmplx_split_instance_f32 args = { .pSrc = pSrc,
+                                              .numSamples = numSamples,
+                                              .nPE = nPE,
+                                              .pDstRe = pDstRe,
+                                              .pDstIm = pDstIm };
+        rt_team_fork(nPE, plp_cmplx_split_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of cmplx_split group
+ */
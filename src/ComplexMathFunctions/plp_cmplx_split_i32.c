@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cmplx_split_i32.c
+ * Description:  Glue code for splitting 32-bit integer complex vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupCmplxMath
+ */
+
+/**
+  @defgroup cmplx_split Complex Split and Join
+  Converts complex data between the interleaved layout (real, imag, real, imag, ...) used by the
+  other complex math functions, and two separate vectors of the real and imaginary parts. The
+  underlying algorithm is used:
+  <pre>
+  for (n = 0; n < numSamples; n++) {
+      pDstRe[n] = pSrc[(2*n)  ];    // split
+      pDstIm[n] = pSrc[(2*n)+1];
+  }
+  for (n = 0; n < numSamples; n++) {
+      pDst[(2*n)  ] = pSrcRe[n];    // join
+      pDst[(2*n)+1] = pSrcIm[n];
+  }
+  </pre>
+  The 8-bit and 16-bit kernels for the cluster move whole words and reorder the samples with the
+  SIMD shuffle instructions, which needs word aligned buffers.
+ */
+
+/**
+  @addtogroup cmplx_split
+  @{
+ */
+
+/**
+  @brief Glue code for splitting a 32-bit integer complex vector into its real and imaginary parts.
+  @param[in]  pSrc        points to the interleaved complex input vector
+  @param[in]  numSamples  number of complex samples
+  @param[out] pDstRe      points to the real parts
+  @param[out] pDstIm      points to the imaginary parts
+  @return     none
+ */
+
+void plp_cmplx_split_i32(const int32_t *__restrict__ pSrc,
+                         uint32_t numSamples,
+                         int32_t *__restrict__ pDstRe,
+                         int32_t *__restrict__ pDstIm) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cmplx_split_i32_rv32im(pSrc, numSamples, pDstRe, pDstIm);
+    } else {
+        plp_cmplx_split_i32_xpulpv2(pSrc, numSamples, pDstRe, pDstIm);
+    }
+}
+
+/**
+  @} end of cmplx_split group
+ */
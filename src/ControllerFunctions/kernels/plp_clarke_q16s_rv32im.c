@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_clarke_q16s_rv32im.c
+ * Description:  16-bit fixed-point Clarke transform kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// saturates x to the range of int16_t
+static inline int32_t cp_q16_sat(int32_t x) {
+    return (x > 32767) ? 32767 : (x < -32768) ? -32768 : x;
+}
+
+/**
+  @ingroup ClarkePark
+ */
+
+/**
+  @defgroup ClarkeParkKernels Clarke and Park Transform Kernels
+  @{
+ */
+
+/**
+  @brief Clarke transform of 16-bit fixed-point values kernel for RV32IM extension.
+  @param[in]  Ia       current of phase a in Q1.15
+  @param[in]  Ib       current of phase b in Q1.15
+  @param[out] pIalpha  points to the alpha component
+  @param[out] pIbeta   points to the beta component
+  @return     none
+ */
+
+void plp_clarke_q16s_rv32im(int16_t Ia,
+                            int16_t Ib,
+                            int16_t *__restrict__ pIalpha,
+                            int16_t *__restrict__ pIbeta) {
+
+    int32_t beta = ((Ia + 2 * Ib) * PLP_INV_SQRT3_Q15 + 0x4000) >> 15;
+
+    *pIalpha = Ia;
+    *pIbeta = cp_q16_sat(beta);
+}
+
+/**
+  @} end of ClarkeParkKernels group
+ */
@@ -0,0 +1,60 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_clarke_q32s_xpulpv2.c
+ * Description:  32-bit fixed-point Clarke transform kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup ClarkePark
+ */
+
+/**
+  @addtogroup ClarkeParkKernels
+  @{
+ */
+
+/**
+  @brief Clarke transform of 32-bit fixed-point values kernel for XPULPV2 extension.
+  @param[in]  Ia       current of phase a in Q1.31
+  @param[in]  Ib       current of phase b in Q1.31
+  @param[out] pIalpha  points to the alpha component
+  @param[out] pIbeta   points to the beta component
+  @return     none
+ */
+
+void plp_clarke_q32s_xpulpv2(int32_t Ia,
+                             int32_t Ib,
+                             int32_t *__restrict__ pIalpha,
+                             int32_t *__restrict__ pIbeta) {
+
+    *pIalpha = Ia;
+    *pIbeta = plp_acc64_to_q32(((int64_t)Ia + 2 * (int64_t)Ib) * PLP_INV_SQRT3_Q31, 31);
+}
+
+/**
+  @} end of ClarkeParkKernels group
+ */
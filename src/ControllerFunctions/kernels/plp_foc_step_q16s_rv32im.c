@@ -0,0 +1,133 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_foc_step_q16s_rv32im.c
+ * Description:  16-bit fixed-point field-oriented control step kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+// saturates x to the range of int16_t
+static inline int32_t foc_q16_sat(int32_t x) {
+    return (x > 32767) ? 32767 : (x < -32768) ? -32768 : x;
+}
+
+// sine and cosine of theta with the interpolation in the table of plp_sincos_q16
+static inline void foc_q16_sincos(int16_t theta, int32_t *pSin, int32_t *pCos) {
+
+    uint32_t phase = (uint16_t)theta & 0x7FFF;
+    uint32_t sinIndex = phase >> FAST_MATH_Q16_SHIFT;
+    uint32_t cosIndex = (sinIndex + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+    int32_t fract = (phase & ((1 << FAST_MATH_Q16_SHIFT) - 1)) << 9;
+    int32_t sinVal, cosVal;
+
+    sinVal = ((0x8000 - fract) * sinTable_q16[sinIndex]) >> 16;
+    cosVal = ((0x8000 - fract) * sinTable_q16[cosIndex]) >> 16;
+    sinVal = ((sinVal * 65536) + fract * sinTable_q16[sinIndex + 1]) >> 16;
+    cosVal = ((cosVal * 65536) + fract * sinTable_q16[cosIndex + 1]) >> 16;
+
+    *pSin = (int16_t)(sinVal * 2);
+    *pCos = (int16_t)(cosVal * 2);
+}
+
+// one step of the current controller S with the control error in
+static inline int32_t foc_q16_pid(plp_pid_instance_q16 *S, int32_t in) {
+
+    int32_t out;
+    uint32_t fracBits = S->fracBits;
+    int32_t lo = S->outMin * (1 << fracBits);
+    int32_t hi = S->outMax * (1 << fracBits);
+    int32_t diff = foc_q16_sat(in - S->prevIn);
+    int32_t integ = S->integ + S->Ki * in;
+    int32_t acc;
+
+    // the integral term is clamped to the output range, against wind-up
+    integ = (integ > hi) ? hi : (integ < lo) ? lo : integ;
+    acc = integ + S->Kp * in + S->Kd * diff;
+    acc = (acc + ((1 << fracBits) >> 1)) >> fracBits;
+
+    S->integ = integ;
+    S->prevIn = in;
+    out = (acc > S->outMax) ? S->outMax : (acc < S->outMin) ? S->outMin : acc;
+
+    return out;
+}
+
+/**
+  @ingroup FOC
+ */
+
+/**
+  @defgroup FOCKernels Field-Oriented Control Kernels
+  @{
+ */
+
+/**
+  @brief One 16-bit fixed-point step of the field-oriented current control kernel for RV32IM
+         extension.
+  @param[in,out] S        points to the instance, whose controllers are initialized by
+                          plp_pid_init_q16
+  @param[in]     Ia       current of phase a in Q1.15
+  @param[in]     Ib       current of phase b in Q1.15
+  @param[in]     theta    electrical rotor angle, Q1.15 value in [0, 1) mapped to [0, 2*PI)
+  @param[in]     IdRef    reference of the direct current in Q1.15
+  @param[in]     IqRef    reference of the quadrature current in Q1.15
+  @param[out]    pValpha  points to the alpha component of the voltage reference
+  @param[out]    pVbeta   points to the beta component of the voltage reference
+  @return        none
+ */
+
+void plp_foc_step_q16s_rv32im(plp_foc_instance_q16 *S,
+                              int16_t Ia,
+                              int16_t Ib,
+                              int16_t theta,
+                              int16_t IdRef,
+                              int16_t IqRef,
+                              int16_t *__restrict__ pValpha,
+                              int16_t *__restrict__ pVbeta) {
+
+    int32_t sinVal, cosVal;
+    int32_t Ialpha, Ibeta, Id, Iq, Vd, Vq;
+
+    foc_q16_sincos(theta, &sinVal, &cosVal);
+
+    // Clarke and Park transforms of the measured currents
+    Ialpha = Ia;
+    Ibeta = foc_q16_sat(((Ia + 2 * Ib) * PLP_INV_SQRT3_Q15 + 0x4000) >> 15);
+    Id = foc_q16_sat((Ialpha * cosVal + Ibeta * sinVal + 0x4000) >> 15);
+    Iq = foc_q16_sat((Ibeta * cosVal - Ialpha * sinVal + 0x4000) >> 15);
+
+    // current controllers
+    Vd = foc_q16_pid(&S->pidD, foc_q16_sat(IdRef - Id));
+    Vq = foc_q16_pid(&S->pidQ, foc_q16_sat(IqRef - Iq));
+
+    // inverse Park transform of the voltages
+    *pValpha = foc_q16_sat((Vd * cosVal - Vq * sinVal + 0x4000) >> 15);
+    *pVbeta = foc_q16_sat((Vd * sinVal + Vq * cosVal + 0x4000) >> 15);
+}
+
+/**
+  @} end of FOCKernels group
+ */
@@ -0,0 +1,144 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_foc_step_q32s_xpulpv2.c
+ * Description:  32-bit fixed-point field-oriented control step kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+// sine and cosine of theta with the interpolation in the table (or the polynomial) of
+// plp_sincos_q32
+static inline void foc_q32_sincos(int32_t theta, int32_t *pSin, int32_t *pCos) {
+#if defined(PLP_FAST_MATH_POLY)
+    uint32_t phase = (uint32_t)theta << 1;
+
+    *pSin = plp_sin_poly_q32(phase);
+    *pCos = plp_sin_poly_q32(phase + 0x40000000);
+#else
+    uint32_t phase = (uint32_t)theta & 0x7FFFFFFF;
+    uint32_t sinIndex = phase >> FAST_MATH_Q32_SHIFT;
+    uint32_t cosIndex = (sinIndex + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+    int32_t fract = (phase & ((1 << FAST_MATH_Q32_SHIFT) - 1)) << 9;
+    int32_t sinA = sinTable_q32[sinIndex];
+    int32_t sinB = sinTable_q32[sinIndex + 1];
+    int32_t cosA = sinTable_q32[cosIndex];
+    int32_t cosB = sinTable_q32[cosIndex + 1];
+    int32_t sinVal, cosVal;
+
+    sinVal = (int32_t)(((int64_t)(0x80000000U - fract) * sinA) >> 32);
+    cosVal = (int32_t)(((int64_t)(0x80000000U - fract) * cosA) >> 32);
+    sinVal = (int32_t)(((int64_t)sinVal * 0x100000000LL + (int64_t)fract * sinB) >> 32);
+    cosVal = (int32_t)(((int64_t)cosVal * 0x100000000LL + (int64_t)fract * cosB) >> 32);
+
+    *pSin = (int32_t)((uint32_t)sinVal << 1);
+    *pCos = (int32_t)((uint32_t)cosVal << 1);
+#endif
+}
+
+// one step of the current controller S with the control error in
+static inline int32_t foc_q32_pid(plp_pid_instance_q32 *S, int32_t in) {
+
+    int32_t out;
+    uint32_t fracBits = S->fracBits;
+    int64_t lo = (int64_t)S->outMin * ((int64_t)1 << fracBits);
+    int64_t hi = (int64_t)S->outMax * ((int64_t)1 << fracBits);
+    int64_t diff = (int64_t)in - S->prevIn;
+    int64_t integ = S->integ + (int64_t)S->Ki * in;
+    int64_t acc;
+
+    diff = (diff > 0x7FFFFFFF) ? 0x7FFFFFFF : (diff < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : diff;
+
+    // the integral term is clamped to the output range, against wind-up
+    integ = (integ > hi) ? hi : (integ < lo) ? lo : integ;
+    acc = integ + (int64_t)S->Kp * in + (int64_t)S->Kd * diff;
+    acc = (acc + (((int64_t)1 << fracBits) >> 1)) >> fracBits;
+
+    S->integ = integ;
+    S->prevIn = in;
+    out = (acc > S->outMax) ? S->outMax : (acc < S->outMin) ? S->outMin : acc;
+
+    return out;
+}
+
+/**
+  @ingroup FOC
+ */
+
+/**
+  @addtogroup FOCKernels
+  @{
+ */
+
+/**
+  @brief One 32-bit fixed-point step of the field-oriented current control kernel for XPULPV2
+         extension.
+  @param[in,out] S        points to the instance, whose controllers are initialized by
+                          plp_pid_init_q32
+  @param[in]     Ia       current of phase a in Q1.31
+  @param[in]     Ib       current of phase b in Q1.31
+  @param[in]     theta    electrical rotor angle, Q1.31 value in [0, 1) mapped to [0, 2*PI)
+  @param[in]     IdRef    reference of the direct current in Q1.31
+  @param[in]     IqRef    reference of the quadrature current in Q1.31
+  @param[out]    pValpha  points to the alpha component of the voltage reference
+  @param[out]    pVbeta   points to the beta component of the voltage reference
+  @return        none
+ */
+
+void plp_foc_step_q32s_xpulpv2(plp_foc_instance_q32 *S,
+                               int32_t Ia,
+                               int32_t Ib,
+                               int32_t theta,
+                               int32_t IdRef,
+                               int32_t IqRef,
+                               int32_t *__restrict__ pValpha,
+                               int32_t *__restrict__ pVbeta) {
+
+    int32_t sinVal, cosVal;
+    int32_t Ialpha, Ibeta, Id, Iq, Vd, Vq;
+    int64_t err;
+
+    foc_q32_sincos(theta, &sinVal, &cosVal);
+
+    // Clarke and Park transforms of the measured currents
+    Ialpha = Ia;
+    Ibeta = plp_acc64_to_q32(((int64_t)Ia + 2 * (int64_t)Ib) * PLP_INV_SQRT3_Q31, 31);
+    Id = plp_acc64_to_q32((int64_t)Ialpha * cosVal + (int64_t)Ibeta * sinVal, 31);
+    Iq = plp_acc64_to_q32((int64_t)Ibeta * cosVal - (int64_t)Ialpha * sinVal, 31);
+
+    // current controllers, with the saturated control errors
+    err = (int64_t)IdRef - Id;
+    Vd = foc_q32_pid(&S->pidD, plp_acc64_to_q32(err, 0));
+    err = (int64_t)IqRef - Iq;
+    Vq = foc_q32_pid(&S->pidQ, plp_acc64_to_q32(err, 0));
+
+    // inverse Park transform of the voltages
+    *pValpha = plp_acc64_to_q32((int64_t)Vd * cosVal - (int64_t)Vq * sinVal, 31);
+    *pVbeta = plp_acc64_to_q32((int64_t)Vd * sinVal + (int64_t)Vq * cosVal, 31);
+}
+
+/**
+  @} end of FOCKernels group
+ */
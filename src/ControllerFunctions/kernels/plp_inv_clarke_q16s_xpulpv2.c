@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_inv_clarke_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point inverse Clarke transform kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup ClarkePark
+ */
+
+/**
+  @addtogroup ClarkeParkKernels
+  @{
+ */
+
+/**
+  @brief Inverse Clarke transform of 16-bit fixed-point values kernel for XPULPV2 extension.
+  @param[in]  Ialpha  alpha component in Q1.15
+  @param[in]  Ibeta   beta component in Q1.15
+  @param[out] pIa     points to the current of phase a
+  @param[out] pIb     points to the current of phase b
+  @return     none
+
+  @par The products are summed with pv.dotsp.h and saturated with p.clip.
+ */
+
+void plp_inv_clarke_q16s_xpulpv2(int16_t Ialpha,
+                                 int16_t Ibeta,
+                                 int16_t *__restrict__ pIa,
+                                 int16_t *__restrict__ pIb) {
+
+    int32_t b = __DOTP2(__PACK2(Ialpha, Ibeta), __PACK2(-0x4000, PLP_SQRT3_BY_2_Q15));
+    b = (b + 0x4000) >> 15;
+
+    *pIa = Ialpha;
+    *pIb = __CLIP(b, 15);
+}
+
+/**
+  @} end of ClarkeParkKernels group
+ */
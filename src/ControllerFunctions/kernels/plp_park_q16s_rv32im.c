@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_park_q16s_rv32im.c
+ * Description:  16-bit fixed-point Park transform kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// saturates x to the range of int16_t
+static inline int32_t cp_q16_sat(int32_t x) {
+    return (x > 32767) ? 32767 : (x < -32768) ? -32768 : x;
+}
+
+/**
+  @ingroup ClarkePark
+ */
+
+/**
+  @addtogroup ClarkeParkKernels
+  @{
+ */
+
+/**
+  @brief Park transform of 16-bit fixed-point values kernel for RV32IM extension.
+  @param[in]  Ialpha  alpha component in Q1.15
+  @param[in]  Ibeta   beta component in Q1.15
+  @param[in]  sinVal  sine of the rotor angle in Q1.15
+  @param[in]  cosVal  cosine of the rotor angle in Q1.15
+  @param[out] pId     points to the direct component
+  @param[out] pIq     points to the quadrature component
+  @return     none
+ */
+
+void plp_park_q16s_rv32im(int16_t Ialpha,
+                          int16_t Ibeta,
+                          int16_t sinVal,
+                          int16_t cosVal,
+                          int16_t *__restrict__ pId,
+                          int16_t *__restrict__ pIq) {
+
+    int32_t d = (Ialpha * cosVal + Ibeta * sinVal + 0x4000) >> 15;
+    int32_t q = (Ibeta * cosVal - Ialpha * sinVal + 0x4000) >> 15;
+
+    *pId = cp_q16_sat(d);
+    *pIq = cp_q16_sat(q);
+}
+
+/**
+  @} end of ClarkeParkKernels group
+ */
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pid_q16s_rv32im.c
+ * Description:  16-bit fixed-point PID controller kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// saturates x to the range of int16_t
+static inline int32_t pid_q16_sat(int32_t x) {
+    return (x > 32767) ? 32767 : (x < -32768) ? -32768 : x;
+}
+
+/**
+  @ingroup PID
+ */
+
+/**
+  @defgroup PIDKernels PID Controller Kernels
+  @{
+ */
+
+/**
+  @brief One step of the 16-bit fixed-point PID controller kernel for RV32IM extension.
+  @param[in,out] S   points to the instance, initialized by plp_pid_init_q16
+  @param[in]     in  control error, with the format of the output
+  @return        control output, within [outMin, outMax]
+ */
+
+int16_t plp_pid_q16s_rv32im(plp_pid_instance_q16 *S,
+                            int16_t in) {
+
+    int16_t out;
+    uint32_t fracBits = S->fracBits;
+    int32_t lo = S->outMin * (1 << fracBits);
+    int32_t hi = S->outMax * (1 << fracBits);
+    int32_t diff = pid_q16_sat(in - S->prevIn);
+    int32_t integ = S->integ + S->Ki * in;
+    int32_t acc;
+
+    // the integral term is clamped to the output range, against wind-up
+    integ = (integ > hi) ? hi : (integ < lo) ? lo : integ;
+    acc = integ + S->Kp * in + S->Kd * diff;
+    acc = (acc + ((1 << fracBits) >> 1)) >> fracBits;
+
+    S->integ = integ;
+    S->prevIn = in;
+    out = (acc > S->outMax) ? S->outMax : (acc < S->outMin) ? S->outMin : acc;
+
+    return out;
+}
+
+/**
+  @} end of PIDKernels group
+ */
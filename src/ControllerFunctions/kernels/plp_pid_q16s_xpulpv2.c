@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pid_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point PID controller kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup PID
+ */
+
+/**
+  @addtogroup PIDKernels
+  @{
+ */
+
+/**
+  @brief One step of the 16-bit fixed-point PID controller kernel for XPULPV2 extension.
+  @param[in,out] S   points to the instance, initialized by plp_pid_init_q16
+  @param[in]     in  control error, with the format of the output
+  @return        control output, within [outMin, outMax]
+
+  @par The proportional and the derivative terms are computed with pv.dotsp.h.
+ */
+
+int16_t plp_pid_q16s_xpulpv2(plp_pid_instance_q16 *S,
+                             int16_t in) {
+
+    int16_t out;
+    uint32_t fracBits = S->fracBits;
+    int32_t lo = S->outMin * (1 << fracBits);
+    int32_t hi = S->outMax * (1 << fracBits);
+    int32_t diff = __CLIP(in - S->prevIn, 15);
+    int32_t integ = S->integ + S->Ki * in;
+    int32_t acc;
+
+    // the integral term is clamped to the output range, against wind-up
+    integ = (integ > hi) ? hi : (integ < lo) ? lo : integ;
+    acc = integ + __DOTP2(__PACK2(in, diff), __PACK2(S->Kp, S->Kd));
+    acc = (acc + ((1 << fracBits) >> 1)) >> fracBits;
+
+    S->integ = integ;
+    S->prevIn = in;
+    out = (acc > S->outMax) ? S->outMax : (acc < S->outMin) ? S->outMin : acc;
+
+    return out;
+}
+
+/**
+  @} end of PIDKernels group
+ */
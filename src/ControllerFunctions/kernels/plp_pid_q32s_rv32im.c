@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pid_q32s_rv32im.c
+ * Description:  32-bit fixed-point PID controller kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup PID
+ */
+
+/**
+  @addtogroup PIDKernels
+  @{
+ */
+
+/**
+  @brief One step of the 32-bit fixed-point PID controller kernel for RV32IM extension.
+  @param[in,out] S   points to the instance, initialized by plp_pid_init_q32
+  @param[in]     in  control error, with the format of the output
+  @return        control output, within [outMin, outMax]
+ */
+
+int32_t plp_pid_q32s_rv32im(plp_pid_instance_q32 *S,
+                            int32_t in) {
+
+    int32_t out;
+    uint32_t fracBits = S->fracBits;
+    int64_t lo = (int64_t)S->outMin * ((int64_t)1 << fracBits);
+    int64_t hi = (int64_t)S->outMax * ((int64_t)1 << fracBits);
+    int64_t diff = (int64_t)in - S->prevIn;
+    int64_t integ = S->integ + (int64_t)S->Ki * in;
+    int64_t acc;
+
+    diff = (diff > 0x7FFFFFFF) ? 0x7FFFFFFF : (diff < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : diff;
+
+    // the integral term is clamped to the output range, against wind-up
+    integ = (integ > hi) ? hi : (integ < lo) ? lo : integ;
+    acc = integ + (int64_t)S->Kp * in + (int64_t)S->Kd * diff;
+    acc = (acc + (((int64_t)1 << fracBits) >> 1)) >> fracBits;
+
+    S->integ = integ;
+    S->prevIn = in;
+    out = (acc > S->outMax) ? S->outMax : (acc < S->outMin) ? S->outMin : acc;
+
+    return out;
+}
+
+/**
+  @} end of PIDKernels group
+ */
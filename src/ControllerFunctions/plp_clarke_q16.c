@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_clarke_q16.c
+ * Description:  Glue code for the 16-bit fixed-point Clarke transform
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupController
+ */
+
+/**
+  @defgroup ClarkePark Clarke and Park Transforms
+  Transforms of the field-oriented control between the phase currents of a three-phase motor,
+  the stationary two-phase frame (alpha, beta) and the frame (d, q) rotating with the rotor.
+
+  The Clarke transform computes the stationary frame from two phase currents of a balanced
+  three-phase system, i.e. Ia + Ib + Ic = 0,
+
+  <pre>
+      Ialpha = Ia
+      Ibeta  = (Ia + 2 * Ib) / sqrt(3)
+  </pre>
+
+  and the inverse Clarke transform returns Ia = Ialpha and Ib = -Ialpha / 2 + sqrt(3) / 2 * Ibeta.
+  The Park transform rotates the stationary frame by the rotor angle theta,
+
+  <pre>
+      Id =  Ialpha * cos(theta) + Ibeta * sin(theta)
+      Iq = -Ialpha * sin(theta) + Ibeta * cos(theta)
+  </pre>
+
+  and the inverse Park transform rotates it back. The functions take sin(theta) and cos(theta),
+  e.g. from plp_sincos_q16, which are computed once per control period.
+
+  The fixed-point versions work on Q1.15 or Q1.31 values, and round and saturate the results.
+  plp_foc_step_q16 and plp_foc_step_q32 fuse the transforms with the current controllers.
+ */
+
+/**
+  @addtogroup ClarkePark
+  @{
+ */
+
+/**
+  @brief Glue code for the Clarke transform of 16-bit fixed-point values.
+  @param[in]  Ia       current of phase a in Q1.15
+  @param[in]  Ib       current of phase b in Q1.15
+  @param[out] pIalpha  points to the alpha component
+  @param[out] pIbeta   points to the beta component
+  @return     none
+ */
+
+void plp_clarke_q16(int16_t Ia,
+                    int16_t Ib,
+                    int16_t *__restrict__ pIalpha,
+                    int16_t *__restrict__ pIbeta) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_clarke_q16s_rv32im(Ia, Ib, pIalpha, pIbeta);
+    } else {
+        plp_clarke_q16s_xpulpv2(Ia, Ib, pIalpha, pIbeta);
+    }
+}
+
+/**
+  @} end of ClarkePark group
+ */
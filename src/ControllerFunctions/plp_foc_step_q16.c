@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_foc_step_q16.c
+ * Description:  Glue code for the 16-bit fixed-point field-oriented control step
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupController
+ */
+
+/**
+  @defgroup FOC Field-Oriented Control
+  One step of the current loop of the field-oriented control of a permanent magnet synchronous
+  motor. From the measured phase currents Ia and Ib, the rotor angle theta and the references of
+  the currents Id and Iq, the step computes the voltage reference in the stationary frame, e.g. for
+  a space vector modulation,
+
+  <pre>
+      (Ialpha, Ibeta) = clarke(Ia, Ib)
+      (Id, Iq)        = park(Ialpha, Ibeta, theta)
+      Vd              = pidD(IdRef - Id)
+      Vq              = pidQ(IqRef - Iq)
+      (Valpha, Vbeta) = inv_park(Vd, Vq, theta)
+  </pre>
+
+  The step is a single kernel, which interpolates sin(theta) and cos(theta) in the table of
+  plp_sincos_q16 and plp_sincos_q32, and keeps all intermediate values in registers, for the
+  latency of control loops running at tens of kHz on the fabric controller. It returns the same
+  values as the separate functions.
+ */
+
+/**
+  @addtogroup FOC
+  @{
+ */
+
+/**
+  @brief Glue code for one 16-bit fixed-point step of the field-oriented current control.
+  @param[in,out] S        points to the instance, whose controllers are initialized by
+                          plp_pid_init_q16
+  @param[in]     Ia       current of phase a in Q1.15
+  @param[in]     Ib       current of phase b in Q1.15
+  @param[in]     theta    electrical rotor angle, Q1.15 value in [0, 1) mapped to [0, 2*PI)
+  @param[in]     IdRef    reference of the direct current in Q1.15
+  @param[in]     IqRef    reference of the quadrature current in Q1.15
+  @param[out]    pValpha  points to the alpha component of the voltage reference
+  @param[out]    pVbeta   points to the beta component of the voltage reference
+  @return        none
+ */
+
+void plp_foc_step_q16(plp_foc_instance_q16 *S,
+                      int16_t Ia,
+                      int16_t Ib,
+                      int16_t theta,
+                      int16_t IdRef,
+                      int16_t IqRef,
+                      int16_t *__restrict__ pValpha,
+                      int16_t *__restrict__ pVbeta) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_foc_step_q16s_rv32im(S, Ia, Ib, theta, IdRef, IqRef, pValpha, pVbeta);
+    } else {
+        plp_foc_step_q16s_xpulpv2(S, Ia, Ib, theta, IdRef, IqRef, pValpha, pVbeta);
+    }
+}
+
+/**
+  @} end of FOC group
+ */
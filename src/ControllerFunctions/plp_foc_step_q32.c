@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_foc_step_q32.c
+ * Description:  Glue code for the 32-bit fixed-point field-oriented control step
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupController
+ */
+
+/**
+  @addtogroup FOC
+  @{
+ */
+
+/**
+  @brief Glue code for one 32-bit fixed-point step of the field-oriented current control.
+  @param[in,out] S        points to the instance, whose controllers are initialized by
+                          plp_pid_init_q32
+  @param[in]     Ia       current of phase a in Q1.31
+  @param[in]     Ib       current of phase b in Q1.31
+  @param[in]     theta    electrical rotor angle, Q1.31 value in [0, 1) mapped to [0, 2*PI)
+  @param[in]     IdRef    reference of the direct current in Q1.31
+  @param[in]     IqRef    reference of the quadrature current in Q1.31
+  @param[out]    pValpha  points to the alpha component of the voltage reference
+  @param[out]    pVbeta   points to the beta component of the voltage reference
+  @return        none
+ */
+
+void plp_foc_step_q32(plp_foc_instance_q32 *S,
+                      int32_t Ia,
+                      int32_t Ib,
+                      int32_t theta,
+                      int32_t IdRef,
+                      int32_t IqRef,
+                      int32_t *__restrict__ pValpha,
+                      int32_t *__restrict__ pVbeta) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_foc_step_q32s_rv32im(S, Ia, Ib, theta, IdRef, IqRef, pValpha, pVbeta);
+    } else {
+        plp_foc_step_q32s_xpulpv2(S, Ia, Ib, theta, IdRef, IqRef, pValpha, pVbeta);
+    }
+}
+
+/**
+  @} end of FOC group
+ */
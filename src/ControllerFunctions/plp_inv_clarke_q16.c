@@ -0,0 +1,63 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_inv_clarke_q16.c
+ * Description:  Glue code for the 16-bit fixed-point inverse Clarke transform
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupController
+ */
+
+/**
+  @addtogroup ClarkePark
+  @{
+ */
+
+/**
+  @brief Glue code for the inverse Clarke transform of 16-bit fixed-point values.
+  @param[in]  Ialpha  alpha component in Q1.15
+  @param[in]  Ibeta   beta component in Q1.15
+  @param[out] pIa     points to the current of phase a
+  @param[out] pIb     points to the current of phase b
+  @return     none
+ */
+
+void plp_inv_clarke_q16(int16_t Ialpha,
+                        int16_t Ibeta,
+                        int16_t *__restrict__ pIa,
+                        int16_t *__restrict__ pIb) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_inv_clarke_q16s_rv32im(Ialpha, Ibeta, pIa, pIb);
+    } else {
+        plp_inv_clarke_q16s_xpulpv2(Ialpha, Ibeta, pIa, pIb);
+    }
+}
+
+/**
+  @} end of ClarkePark group
+ */
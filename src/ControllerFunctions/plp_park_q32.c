@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_park_q32.c
+ * Description:  Glue code for the 32-bit fixed-point Park transform
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupController
+ */
+
+/**
+  @addtogroup ClarkePark
+  @{
+ */
+
+/**
+  @brief Glue code for the Park transform of 32-bit fixed-point values.
+  @param[in]  Ialpha  alpha component in Q1.31
+  @param[in]  Ibeta   beta component in Q1.31
+  @param[in]  sinVal  sine of the rotor angle in Q1.31
+  @param[in]  cosVal  cosine of the rotor angle in Q1.31
+  @param[out] pId     points to the direct component
+  @param[out] pIq     points to the quadrature component
+  @return     none
+ */
+
+void plp_park_q32(int32_t Ialpha,
+                  int32_t Ibeta,
+                  int32_t sinVal,
+                  int32_t cosVal,
+                  int32_t *__restrict__ pId,
+                  int32_t *__restrict__ pIq) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_park_q32s_rv32im(Ialpha, Ibeta, sinVal, cosVal, pId, pIq);
+    } else {
+        plp_park_q32s_xpulpv2(Ialpha, Ibeta, sinVal, cosVal, pId, pIq);
+    }
+}
+
+/**
+  @} end of ClarkePark group
+ */
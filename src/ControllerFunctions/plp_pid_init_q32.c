@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pid_init_q32.c
+ * Description:  Initialization of the 32-bit fixed-point PID controller
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupController
+ */
+
+/**
+  @addtogroup PID
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 32-bit fixed-point PID controller.
+  @param[out] S         points to the instance of the 32-bit fixed-point PID controller
+  @param[in]  Kp        proportional gain, with fracBits fractional bits
+  @param[in]  Ki        integral gain, with fracBits fractional bits
+  @param[in]  Kd        derivative gain, with fracBits fractional bits
+  @param[in]  fracBits  number of fractional bits of the gains, at most 31
+  @param[in]  outMin    lower limit of the output
+  @param[in]  outMax    upper limit of the output, at least outMin
+  @return     none
+
+  @par The gains must have a magnitude below 2^30. The integral term and the previous input
+  are cleared.
+ */
+
+void plp_pid_init_q32(plp_pid_instance_q32 *S,
+                      int32_t Kp,
+                      int32_t Ki,
+                      int32_t Kd,
+                      uint32_t fracBits,
+                      int32_t outMin,
+                      int32_t outMax) {
+
+    S->Kp = Kp;
+    S->Ki = Ki;
+    S->Kd = Kd;
+    S->fracBits = fracBits;
+    S->outMin = outMin;
+    S->outMax = outMax;
+    S->integ = 0;
+    S->prevIn = 0;
+}
+
+/**
+  @} end of PID group
+ */
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pid_q16.c
+ * Description:  Glue code for the 16-bit fixed-point PID controller
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupController
+ */
+
+/**
+  @defgroup PID PID Controller
+  Proportional-integral-derivative controller in parallel form,
+
+  <pre>
+      y[n] = Kp * x[n] + Ki * (x[0] + ... + x[n]) + Kd * (x[n] - x[n-1])
+  </pre>
+
+  where x is the control error. The gains are fixed-point values with fracBits fractional bits,
+  e.g. Q8.8 for a 16-bit instance with fracBits = 8, and the output has the format of the input.
+  The output is clamped to [outMin, outMax], and so is the integral term, such that it does not
+  wind up while the output is saturated. The difference of the input is saturated as well.
+
+  All values are kept in 32 bits by the 16-bit version, which requires gains of magnitude below
+  2^14, and in 64 bits by the 32-bit version, which requires gains of magnitude below 2^30.
+ */
+
+/**
+  @addtogroup PID
+  @{
+ */
+
+/**
+  @brief Glue code for one step of the 16-bit fixed-point PID controller.
+  @param[in,out] S   points to the instance, initialized by plp_pid_init_q16
+  @param[in]     in  control error, with the format of the output
+  @return        control output, within [outMin, outMax]
+ */
+
+int16_t plp_pid_q16(plp_pid_instance_q16 *S,
+                    int16_t in) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        return plp_pid_q16s_rv32im(S, in);
+    } else {
+        return plp_pid_q16s_xpulpv2(S, in);
+    }
+}
+
+/**
+  @} end of PID group
+ */
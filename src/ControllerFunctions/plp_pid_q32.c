@@ -0,0 +1,59 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pid_q32.c
+ * Description:  Glue code for the 32-bit fixed-point PID controller
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupController
+ */
+
+/**
+  @addtogroup PID
+  @{
+ */
+
+/**
+  @brief Glue code for one step of the 32-bit fixed-point PID controller.
+  @param[in,out] S   points to the instance, initialized by plp_pid_init_q32
+  @param[in]     in  control error, with the format of the output
+  @return        control output, within [outMin, outMax]
+ */
+
+int32_t plp_pid_q32(plp_pid_instance_q32 *S,
+                    int32_t in) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        return plp_pid_q32s_rv32im(S, in);
+    } else {
+        return plp_pid_q32s_xpulpv2(S, in);
+    }
+}
+
+/**
+  @} end of PID group
+ */
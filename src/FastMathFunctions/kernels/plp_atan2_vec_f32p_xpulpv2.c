@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_atan2_vec_f32p_xpulpv2.c
+ * Description:  Parallel arctangent of a f32 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @brief Parallel arctangent of a 32-bit float vector kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_atan2_instance_f32 struct initialized by
+                     plp_atan2_vec_f32_parallel
+   @return     none
+
+   @par Parallelization
+   Every core computes a contiguous chunk of the vector with plp_atan2_vec_f32s_xpulpv2.
+*/
+
+void plp_atan2_vec_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_atan2_instance_f32 *a = (plp_atan2_instance_f32 *)args;
+
+    const float32_t *__restrict__ pSrcY = a->pSrcY;
+    const float32_t *__restrict__ pSrcX = a->pSrcX;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    float32_t *__restrict__ pDst = a->pDst;
+
+    uint32_t chunk = (blockSize + nPE - 1) / nPE;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > blockSize) {
+        start = blockSize;
+    }
+    if (end > blockSize) {
+        end = blockSize;
+    }
+
+    if (start < end) {
+        plp_atan2_vec_f32s_xpulpv2(pSrcY + start, pSrcX + start, end - start, pDst + start);
+    }
+}
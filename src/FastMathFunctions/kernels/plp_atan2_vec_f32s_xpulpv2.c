@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_atan2_vec_f32s_xpulpv2.c
+ * Description:  Arctangent of a f32 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Four quadrant arctangent. The ratio of the smaller to the larger magnitude is in [0, 1], where
+// a degree 15 odd minimax polynomial approximates the arctangent. The octant is restored after.
+static inline float32_t plp_atan2_vec_f32_elem(float32_t y, float32_t x) {
+
+    float32_t ax = (x < 0.0f) ? -x : x;
+    float32_t ay = (y < 0.0f) ? -y : y;
+    float32_t t, u, a;
+
+    if (ay > ax) {
+        t = ax / ay;
+    } else if (ax > 0.0f) {
+        t = ay / ax;
+    } else {
+        t = 0.0f;
+    }
+
+    u = t * t;
+    a = t * (0.999999336f +
+             u * (-0.333298608f +
+                  u * (0.199465656f +
+                       u * (-0.139086295f +
+                            u * (0.0964219724f +
+                                 u * (-0.0559123257f +
+                                      u * (0.0218629572f + u * -0.00405456705f)))))));
+
+    if (ay > ax) {
+        a = 1.57079633f - a;
+    }
+    if (x < 0.0f) {
+        a = 3.14159265f - a;
+    }
+    if (y < 0.0f) {
+        a = -a;
+    }
+
+    return a;
+}
+
+/**
+   @brief Arctangent of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  pSrcY      points to the vector of y coordinates
+   @param[in]  pSrcX      points to the vector of x coordinates
+   @param[in]  blockSize  number of samples in each vector
+   @param[out] pDst       points to the output vector, angles in radians in [-PI, PI]
+   @return     none
+*/
+
+void plp_atan2_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrcY,
+                                const float32_t *__restrict__ pSrcX,
+                                uint32_t blockSize,
+                                float32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    float32_t y0, y1, x0, x1;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        y0 = pSrcY[i];
+        y1 = pSrcY[i + 1];
+        x0 = pSrcX[i];
+        x1 = pSrcX[i + 1];
+        pDst[i] = plp_atan2_vec_f32_elem(y0, x0);
+        pDst[i + 1] = plp_atan2_vec_f32_elem(y1, x1);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = plp_atan2_vec_f32_elem(pSrcY[i], pSrcX[i]);
+    }
+}
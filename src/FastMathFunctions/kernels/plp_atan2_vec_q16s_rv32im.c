@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_atan2_vec_q16s_rv32im.c
+ * Description:  Arctangent of a q16 vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Four quadrant arctangent in Q1.15 turns. The ratio t of the smaller to the larger magnitude
+// is computed in Q0.15 with an integer division, atan(t) / t scaled to quarter turns is a degree 4
+// minimax polynomial in t^2. The octant is restored after.
+static inline int16_t plp_atan2_vec_q16_elem(int32_t y, int32_t x) {
+
+    int32_t ax = (x < 0) ? -x : x;
+    int32_t ay = (y < 0) ? -y : y;
+    int32_t num = (ay > ax) ? ax : ay;
+    int32_t den = (ay > ax) ? ay : ax;
+    int32_t t, u, acc, a;
+
+    if (den == 0) {
+        return 0;
+    }
+
+    t = (num << 15) / den;
+    u = (t * t) >> 15;
+    acc = 435;
+    acc = ((acc * u) >> 15) - 1776;
+    acc = ((acc * u) >> 15) + 3758;
+    acc = ((acc * u) >> 15) - 6890;
+    acc = ((acc * u) >> 15) + 20858;
+    a = (acc * t + (1 << 16)) >> 17; // a quarter turn is 0x2000
+
+    if (ay > ax) {
+        a = 0x2000 - a;
+    }
+    if (x < 0) {
+        a = 0x4000 - a;
+    }
+    if (y < 0) {
+        a = -a;
+    }
+
+    return (int16_t)a;
+}
+
+/**
+   @brief Arctangent of a 16-bit fixed point vector for RV32IM extension.
+   @param[in]  pSrcY      points to the vector of y coordinates
+   @param[in]  pSrcX      points to the vector of x coordinates
+   @param[in]  blockSize  number of samples in each vector
+   @param[out] pDst       points to the output vector, Q1.15 angles in [-0.5, 0.5]
+                          mapped to [-PI, PI]
+   @return     none
+*/
+
+void plp_atan2_vec_q16s_rv32im(const int16_t *__restrict__ pSrcY,
+                               const int16_t *__restrict__ pSrcX,
+                               uint32_t blockSize,
+                               int16_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = plp_atan2_vec_q16_elem(pSrcY[i], pSrcX[i]);
+    }
+}
@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_atan2_vec_q32s_xpulpv2.c
+ * Description:  Arctangent of a q32 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Four quadrant arctangent in Q1.31 turns. The ratio t of the smaller to the larger magnitude
+// is computed with a newton reciprocal in Q2.30, atan(t) / t scaled to quarter turns is a degree
+// 8 minimax polynomial in t^2. The octant is restored after.
+static inline int32_t plp_atan2_vec_q32_elem(int32_t y, int32_t x) {
+
+    uint32_t ax = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+    uint32_t ay = (y < 0) ? -(uint32_t)y : (uint32_t)y;
+    uint32_t num = (ay > ax) ? ax : ay;
+    uint32_t den = (ay > ax) ? ay : ax;
+    uint32_t n, r, e;
+    int32_t t, u, acc, a;
+
+    if (den == 0) {
+        return 0;
+    }
+
+    // 1 / den with den normalized to [0.5, 1), the initial guess is 48/17 - 32/17 * den
+    n = __builtin_clz(den);
+    den <<= n;
+    num <<= n;
+    r = 3031741622U - (uint32_t)(((uint64_t)2021161081U * den) >> 32);
+    for (int i = 0; i < 3; i++) {
+        e = (uint32_t)(((uint64_t)den * r) >> 32);
+        r = (uint32_t)(((uint64_t)r * (0x80000000U - e)) >> 30);
+    }
+    t = (int32_t)(((uint64_t)num * r) >> 32); // t in Q2.30
+
+    u = (int32_t)(((int64_t)t * t) >> 30);
+    acc = 1679332;
+    acc = (int32_t)(((int64_t)acc * u) >> 30) - 9844270;
+    acc = (int32_t)(((int64_t)acc * u) >> 30) + 27193065;
+    acc = (int32_t)(((int64_t)acc * u) >> 30) - 49454974;
+    acc = (int32_t)(((int64_t)acc * u) >> 30) + 71767150;
+    acc = (int32_t)(((int64_t)acc * u) >> 30) - 96801246;
+    acc = (int32_t)(((int64_t)acc * u) >> 30) + 136616719;
+    acc = (int32_t)(((int64_t)acc * u) >> 30) - 227850059;
+    acc = (int32_t)(((int64_t)acc * u) >> 30) + 683565198;
+    a = (int32_t)(((int64_t)acc * t) >> 31); // a quarter turn is 0x20000000
+
+    if (ay > ax) {
+        a = 0x20000000 - a;
+    }
+    if (x < 0) {
+        a = 0x40000000 - a;
+    }
+    if (y < 0) {
+        a = -a;
+    }
+
+    return a;
+}
+
+/**
+   @brief Arctangent of a 32-bit fixed point vector for XPULPV2 extension.
+   @param[in]  pSrcY      points to the vector of y coordinates
+   @param[in]  pSrcX      points to the vector of x coordinates
+   @param[in]  blockSize  number of samples in each vector
+   @param[out] pDst       points to the output vector, Q1.31 angles in [-0.5, 0.5]
+                          mapped to [-PI, PI]
+   @return     none
+*/
+
+void plp_atan2_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrcY,
+                                const int32_t *__restrict__ pSrcX,
+                                uint32_t blockSize,
+                                int32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    int32_t y0, y1, x0, x1;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        y0 = pSrcY[i];
+        y1 = pSrcY[i + 1];
+        x0 = pSrcX[i];
+        x1 = pSrcX[i + 1];
+        pDst[i] = plp_atan2_vec_q32_elem(y0, x0);
+        pDst[i + 1] = plp_atan2_vec_q32_elem(y1, x1);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = plp_atan2_vec_q32_elem(pSrcY[i], pSrcX[i]);
+    }
+}
@@ -0,0 +1,123 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cordic_atan2_mag_q16s_xpulpv2.c
+ * Description:  CORDIC phase and magnitude of a q16 complex vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+// Phase and magnitude of x + iy with 16 CORDIC iterations. The vector is normalized such that the
+// larger component has 29 bits, and turned by a quarter turn into the right half plane, where the
+// iterations converge. The gain of the iterations (about 1.647) then cannot overflow. The phase is
+// accumulated in Q1.31 turns, the magnitude is corrected by the inverse gain and denormalized.
+static inline void plp_cordic_atan2_mag_q16_elem(int32_t x,
+                                                 int32_t y,
+                                                 int32_t *pPhase,
+                                                 int32_t *pMag) {
+
+    uint32_t ax = (x < 0) ? -x : x;
+    uint32_t ay = (y < 0) ? -y : y;
+    uint32_t shift, mag, i;
+    int32_t z = 0;
+    int32_t t;
+
+    if ((ax | ay) == 0) {
+        *pPhase = 0;
+        *pMag = 0;
+        return;
+    }
+
+    shift = __builtin_clz((ax > ay) ? ax : ay) - 3;
+    x = (int32_t)((uint32_t)x << shift);
+    y = (int32_t)((uint32_t)y << shift);
+
+    if (x < 0) {
+        t = x;
+        if (y >= 0) {
+            x = y;
+            y = -t;
+            z = 0x20000000; // a quarter turn
+        } else {
+            x = -y;
+            y = t;
+            z = -0x20000000;
+        }
+    }
+
+    for (i = 0; i < 16; i++) {
+        t = x;
+        if (y > 0) {
+            x += y >> i;
+            y -= t >> i;
+            z += cordicAtanTable_q32[i];
+        } else {
+            x -= y >> i;
+            y += t >> i;
+            z -= cordicAtanTable_q32[i];
+        }
+    }
+
+    mag = (uint32_t)(((uint64_t)(uint32_t)x * CORDIC_INV_GAIN_Q32) >> 32);
+    *pPhase = (z + 0x8000) >> 16;
+    *pMag = (mag + (1 << (shift - 1))) >> shift;
+}
+
+/**
+   @brief CORDIC phase and magnitude of a 16-bit fixed point vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the complex input vector, real and imaginary parts interleaved
+   @param[in]  blockSize  number of complex samples
+   @param[out] pPhase     points to the output phases, Q1.15 angles in [-0.5, 0.5] mapped
+                          to [-PI, PI]
+   @param[out] pMag       points to the output magnitudes in the format of the input,
+                          saturated to 16 bits
+   @return     none
+*/
+
+void plp_cordic_atan2_mag_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                       uint32_t blockSize,
+                                       int16_t *__restrict__ pPhase,
+                                       int16_t *__restrict__ pMag) {
+
+    uint32_t i; // loop counter
+    v2s s0, s1;
+    int32_t phase0, phase1, mag0, mag1;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        s0 = *((v2s *)&pSrc[2 * i]);
+        s1 = *((v2s *)&pSrc[2 * i + 2]);
+        plp_cordic_atan2_mag_q16_elem(s0[0], s0[1], &phase0, &mag0);
+        plp_cordic_atan2_mag_q16_elem(s1[0], s1[1], &phase1, &mag1);
+        *((v2s *)&pPhase[i]) = __PACK2(phase0, phase1);
+        *((v2s *)&pMag[i]) = __PACK2(__CLIP(mag0, 15), __CLIP(mag1, 15));
+    }
+
+    // leftover sample
+    if (i < blockSize) {
+        plp_cordic_atan2_mag_q16_elem(pSrc[2 * i], pSrc[2 * i + 1], &phase0, &mag0);
+        pPhase[i] = (int16_t)phase0;
+        pMag[i] = (int16_t)__CLIP(mag0, 15);
+    }
+}
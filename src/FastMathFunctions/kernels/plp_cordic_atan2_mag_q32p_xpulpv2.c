@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cordic_atan2_mag_q32p_xpulpv2.c
+ * Description:  Parallel CORDIC phase and magnitude of a q32 complex vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @brief Parallel CORDIC phase and magnitude of a 32-bit fixed point vector for XPULPV2.
+   @param[in]  args  pointer to plp_cordic_atan2_mag_instance_q32 struct initialized by
+                     plp_cordic_atan2_mag_q32_parallel
+   @return     none
+
+   @par Parallelization
+   Every core computes a contiguous chunk of the vector with plp_cordic_atan2_mag_q32s_xpulpv2.
+*/
+
+void plp_cordic_atan2_mag_q32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_cordic_atan2_mag_instance_q32 *a = (plp_cordic_atan2_mag_instance_q32 *)args;
+
+    const int32_t *__restrict__ pSrc = a->pSrc;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pPhase = a->pPhase;
+    int32_t *__restrict__ pMag = a->pMag;
+
+    uint32_t chunk = (blockSize + nPE - 1) / nPE;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > blockSize) {
+        start = blockSize;
+    }
+    if (end > blockSize) {
+        end = blockSize;
+    }
+
+    if (start < end) {
+        plp_cordic_atan2_mag_q32s_xpulpv2(pSrc + 2 * start,
+                                          end - start,
+                                          pPhase + start,
+                                          pMag + start);
+    }
+}
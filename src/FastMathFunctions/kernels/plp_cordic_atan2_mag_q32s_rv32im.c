@@ -0,0 +1,123 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cordic_atan2_mag_q32s_rv32im.c
+ * Description:  CORDIC phase and magnitude of a q32 complex vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+// Phase and magnitude of x + iy with 30 CORDIC iterations. The vector is normalized such that the
+// larger component has 29 bits, and turned by a quarter turn into the right half plane, where the
+// iterations converge. The gain of the iterations (about 1.647) then cannot overflow. The phase is
+// accumulated in Q1.31 turns, the magnitude is corrected by the inverse gain and denormalized.
+static inline void plp_cordic_atan2_mag_q32_elem(int32_t x,
+                                                 int32_t y,
+                                                 int32_t *pPhase,
+                                                 int32_t *pMag) {
+
+    uint32_t ax = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+    uint32_t ay = (y < 0) ? -(uint32_t)y : (uint32_t)y;
+    uint32_t i;
+    int32_t shift;
+    int32_t z = 0;
+    int32_t t;
+    uint64_t mag;
+
+    if ((ax | ay) == 0) {
+        *pPhase = 0;
+        *pMag = 0;
+        return;
+    }
+
+    // inputs with more than 29 bits lose their lowest bits
+    shift = (int32_t)__builtin_clz((ax > ay) ? ax : ay) - 3;
+    if (shift >= 0) {
+        x = (int32_t)((uint32_t)x << shift);
+        y = (int32_t)((uint32_t)y << shift);
+    } else {
+        x >>= -shift;
+        y >>= -shift;
+    }
+
+    if (x < 0) {
+        t = x;
+        if (y >= 0) {
+            x = y;
+            y = -t;
+            z = 0x20000000; // a quarter turn
+        } else {
+            x = -y;
+            y = t;
+            z = -0x20000000;
+        }
+    }
+
+    for (i = 0; i < CORDIC_ATAN_TABLE_SIZE; i++) {
+        t = x;
+        if (y > 0) {
+            x += y >> i;
+            y -= t >> i;
+            z += cordicAtanTable_q32[i];
+        } else {
+            x -= y >> i;
+            y += t >> i;
+            z -= cordicAtanTable_q32[i];
+        }
+    }
+
+    mag = ((uint64_t)(uint32_t)x * CORDIC_INV_GAIN_Q32) >> 32;
+    if (shift > 0) {
+        mag = (mag + (1U << (shift - 1))) >> shift;
+    } else {
+        mag <<= -shift;
+    }
+
+    *pPhase = z;
+    *pMag = (mag > INT32_MAX) ? INT32_MAX : (int32_t)mag;
+}
+
+/**
+   @brief CORDIC phase and magnitude of a 32-bit fixed point vector for RV32IM extension.
+   @param[in]  pSrc       points to the complex input vector, real and imaginary parts interleaved
+   @param[in]  blockSize  number of complex samples
+   @param[out] pPhase     points to the output phases, Q1.31 angles in [-0.5, 0.5] mapped
+                          to [-PI, PI]
+   @param[out] pMag       points to the output magnitudes in the format of the input,
+                          saturated to 32 bits
+   @return     none
+*/
+
+void plp_cordic_atan2_mag_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      int32_t *__restrict__ pPhase,
+                                      int32_t *__restrict__ pMag) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i < blockSize; i++) {
+        plp_cordic_atan2_mag_q32_elem(pSrc[2 * i], pSrc[2 * i + 1], &pPhase[i], &pMag[i]);
+    }
+}
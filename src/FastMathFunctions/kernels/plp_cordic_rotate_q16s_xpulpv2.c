@@ -0,0 +1,117 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cordic_rotate_q16s_xpulpv2.c
+ * Description:  CORDIC rotation of a q16 complex vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+// Rotation of x + iy by the angle a in Q1.15 turns with 16 CORDIC iterations. The angle is reduced
+// to [-1/8, 1/8) turns by a multiple of a quarter turn, which is applied exactly by swapping and
+// negating the components. The components are scaled to 29 bits, such that the gain of the
+// iterations (about 1.647) cannot overflow, and corrected by the inverse gain after.
+static inline void plp_cordic_rotate_q16_elem(
+    int32_t x, int32_t y, int32_t a, int32_t *pRe, int32_t *pIm) {
+
+    // angles in Q1.31 turns wrap modulo two full turns
+    uint32_t u = ((uint32_t)a << 16) + 0x10000000;
+    int32_t z = (int32_t)(u & 0x1FFFFFFF) - 0x10000000;
+    uint32_t i;
+    int32_t t;
+
+    switch ((u >> 29) & 3) {
+    case 1:
+        t = x;
+        x = -y;
+        y = t;
+        break;
+    case 2:
+        x = -x;
+        y = -y;
+        break;
+    case 3:
+        t = x;
+        x = y;
+        y = -t;
+        break;
+    default:
+        break;
+    }
+
+    x = (int32_t)((uint32_t)x << 14);
+    y = (int32_t)((uint32_t)y << 14);
+
+    for (i = 0; i < 16; i++) {
+        t = x;
+        if (z >= 0) {
+            x -= y >> i;
+            y += t >> i;
+            z -= cordicAtanTable_q32[i];
+        } else {
+            x += y >> i;
+            y -= t >> i;
+            z += cordicAtanTable_q32[i];
+        }
+    }
+
+    *pRe = (int32_t)((((int64_t)x * CORDIC_INV_GAIN_Q32 >> 32) + (1 << 13)) >> 14);
+    *pIm = (int32_t)((((int64_t)y * CORDIC_INV_GAIN_Q32 >> 32) + (1 << 13)) >> 14);
+}
+
+/**
+   @brief CORDIC rotation of a 16-bit fixed point vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the complex input vector, real and imaginary parts interleaved
+   @param[in]  pAngle     points to the rotation angles, Q1.15 angles with 0.5 mapped to PI
+   @param[in]  blockSize  number of complex samples
+   @param[out] pDst       points to the complex output vector, saturated to 16 bits
+   @return     none
+*/
+
+void plp_cordic_rotate_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                    const int16_t *__restrict__ pAngle,
+                                    uint32_t blockSize,
+                                    int16_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    v2s s0, s1, a;
+    int32_t re0, im0, re1, im1;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        s0 = *((v2s *)&pSrc[2 * i]);
+        s1 = *((v2s *)&pSrc[2 * i + 2]);
+        a = *((v2s *)&pAngle[i]);
+        plp_cordic_rotate_q16_elem(s0[0], s0[1], a[0], &re0, &im0);
+        plp_cordic_rotate_q16_elem(s1[0], s1[1], a[1], &re1, &im1);
+        *((v2s *)&pDst[2 * i]) = __PACK2(__CLIP(re0, 15), __CLIP(im0, 15));
+        *((v2s *)&pDst[2 * i + 2]) = __PACK2(__CLIP(re1, 15), __CLIP(im1, 15));
+    }
+
+    // leftover sample
+    if (i < blockSize) {
+        plp_cordic_rotate_q16_elem(pSrc[2 * i], pSrc[2 * i + 1], pAngle[i], &re0, &im0);
+        *((v2s *)&pDst[2 * i]) = __PACK2(__CLIP(re0, 15), __CLIP(im0, 15));
+    }
+}
@@ -44,6 +44,9 @@
  */
 
 float32_t plp_cos_f32s_xpulpv2(float32_t x) {
+#if defined(PLP_FAST_MATH_POLY)
+    return plp_sin_poly_f32(x * 0.159154943092f + 0.25f);
+#else
     float32_t cosVal, fract, in; /* Temporary input, output variables */
     uint16_t index;              /* Index variable */
     float32_t a, b;              /* Two nearest output values */
@@ -88,4 +91,5 @@ float32_t plp_cos_f32s_xpulpv2(float32_t x) {
 
     /* Return output value */
     return (cosVal);
+#endif
 }
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cos_vec_q16s_xpulpv2.c
+ * Description:  Cosine of a q16 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+// Interpolates the sine table at a phase in [0, 0x7FFF], with the same rounding as
+// plp_cos_q16s_xpulpv2.
+static inline int16_t plp_cos_vec_q16_lookup(uint32_t x) {
+
+    uint32_t index = x >> FAST_MATH_Q16_SHIFT;
+    int32_t fract = (x & ((1 << FAST_MATH_Q16_SHIFT) - 1)) << 9;
+    int32_t a = sinTable_q16[index];
+    int32_t b = sinTable_q16[index + 1];
+    int32_t val;
+
+    val = ((0x8000 - fract) * a) >> 16;
+    val = ((val << 16) + fract * b) >> 16;
+
+    return (int16_t)(val << 1);
+}
+
+/**
+   @brief Cosine of a 16-bit fixed point vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector, Q1.15 values in [0, +0.9999]
+                          mapped to [0, 2*PI)
+   @param[in]  blockSize  number of samples in each vector
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_cos_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int16_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    v2s x;
+    int16_t y0, y1;
+
+    // add a quarter turn to read the sine table, negative phases wrap into the table range
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        x = *((v2s *)(pSrc + i));
+        y0 = plp_cos_vec_q16_lookup(((uint16_t)x[0] + 0x2000) & 0x7FFF);
+        y1 = plp_cos_vec_q16_lookup(((uint16_t)x[1] + 0x2000) & 0x7FFF);
+        *((v2s *)(pDst + i)) = __PACK2(y0, y1);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = plp_cos_vec_q16_lookup(((uint16_t)pSrc[i] + 0x2000) & 0x7FFF);
+    }
+}
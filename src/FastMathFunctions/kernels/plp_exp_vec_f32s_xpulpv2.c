@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_exp_vec_f32s_xpulpv2.c
+ * Description:  Exponential of a f32 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Exponential with the range reduction x = k * ln(2) + r, r in [0, ln(2)), and a degree 6
+// minimax polynomial for exp(r). The power of two is added to the exponent bits of the result.
+static inline float32_t plp_exp_vec_f32_elem(float32_t x) {
+
+    union {
+        float32_t f;
+        int32_t i;
+    } y;
+    float32_t t, r;
+    int32_t k;
+
+    // outside of this range, the result is not a normal float
+    if (x < -87.3365479f) {
+        return 0.0f;
+    }
+    if (x > 88.7228241f) {
+        return INFINITY;
+    }
+
+    t = x * 1.44269504f;
+    k = (int32_t)t;
+    k -= (t < (float32_t)k);
+
+    // ln(2) is split into two constants to keep r exact
+    r = x - (float32_t)k * 0.693145752f;
+    r = r - (float32_t)k * 1.42860677e-06f;
+
+    y.f = 1.0f +
+          r * (0.999999716f +
+               r * (0.50000693f +
+                    r * (0.166604309f +
+                         r * (0.0419296764f + r * (0.0077746738f + r * 0.00195682553f)))));
+    y.i += k << 23;
+
+    return y.f;
+}
+
+/**
+   @brief Exponential of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_exp_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              float32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    float32_t x0, x1;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        x0 = pSrc[i];
+        x1 = pSrc[i + 1];
+        pDst[i] = plp_exp_vec_f32_elem(x0);
+        pDst[i + 1] = plp_exp_vec_f32_elem(x1);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = plp_exp_vec_f32_elem(pSrc[i]);
+    }
+}
@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_exp_vec_q16s_xpulpv2.c
+ * Description:  Exponential of a q16 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Exponential of a Q(fracBits) value. x * log2(e) is split into the power of two k and the
+// fraction u in Q0.15, 2^u is a degree 4 minimax polynomial in Q2.15. The result is rounded and
+// saturated to Q(fracBits).
+static inline int16_t plp_exp_vec_q16_elem(int32_t x, uint32_t fracBits) {
+
+    int32_t t = (x * 47274) >> fracBits; // log2(e) in Q1.15
+    int32_t shift = 15 - (int32_t)fracBits - (t >> 15);
+    int32_t u = t & 0x7FFF;
+    int32_t acc;
+
+    // the polynomial is at least 1.0, larger shifts round to zero
+    if (shift <= 0) {
+        return 0x7FFF;
+    }
+    if (shift > 16) {
+        return 0;
+    }
+
+    acc = 449;
+    acc = ((acc * u) >> 15) + 1694;
+    acc = ((acc * u) >> 15) + 7918;
+    acc = ((acc * u) >> 15) + 22707;
+    acc = ((acc * u) >> 15) + 32768;
+    acc = (acc + (1 << (shift - 1))) >> shift;
+
+    return (int16_t)((acc > 0x7FFF) ? 0x7FFF : acc);
+}
+
+/**
+   @brief Exponential of a 16-bit fixed point vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  fracBits   number of fractional bits of the input and output values
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_exp_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    v2s x;
+    int16_t y0, y1;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        x = *((v2s *)(pSrc + i));
+        y0 = plp_exp_vec_q16_elem(x[0], fracBits);
+        y1 = plp_exp_vec_q16_elem(x[1], fracBits);
+        *((v2s *)(pDst + i)) = __PACK2(y0, y1);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = plp_exp_vec_q16_elem(pSrc[i], fracBits);
+    }
+}
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_exp_vec_q32s_rv32im.c
+ * Description:  Exponential of a q32 vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Exponential of a Q(fracBits) value. x * log2(e) is split into the power of two k and the
+// fraction u in Q0.30, 2^u is a degree 6 minimax polynomial in Q2.30. The result is rounded and
+// saturated to Q(fracBits).
+static inline int32_t plp_exp_vec_q32_elem(int32_t x, uint32_t fracBits) {
+
+    int64_t t = ((int64_t)x * 1549082005) >> fracBits; // log2(e) in Q2.30
+    int64_t shift = 30 - (int64_t)fracBits - (t >> 30);
+    int32_t u = (int32_t)t & 0x3FFFFFFF;
+    int32_t acc;
+
+    // the polynomial is at least 1.0, larger shifts round to zero
+    if (shift < 0) {
+        return 0x7FFFFFFF;
+    }
+    if (shift > 32) {
+        return 0;
+    }
+
+    acc = 235034;
+    acc = (int32_t)(((int64_t)acc * u) >> 30) + 1329754;
+    acc = (int32_t)(((int64_t)acc * u) >> 30) + 10399164;
+    acc = (int32_t)(((int64_t)acc * u) >> 30) + 59571434;
+    acc = (int32_t)(((int64_t)acc * u) >> 30) + 257945589;
+    acc = (int32_t)(((int64_t)acc * u) >> 30) + 744260843;
+
+    return plp_acc64_to_q32((((int64_t)acc * u) >> 30) + 1073741827, (uint32_t)shift);
+}
+
+/**
+   @brief Exponential of a 32-bit fixed point vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  fracBits   number of fractional bits of the input and output values
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_exp_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t fracBits,
+                             int32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = plp_exp_vec_q32_elem(pSrc[i], fracBits);
+    }
+}
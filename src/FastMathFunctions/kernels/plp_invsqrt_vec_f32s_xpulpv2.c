@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_invsqrt_vec_f32s_xpulpv2.c
+ * Description:  Inverse square root of a f32 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Inverse square root with the fast inverse square root and three newton iterations.
+// Non-positive inputs return +inf.
+static inline float32_t plp_invsqrt_vec_f32_elem(float32_t x) {
+
+    const float32_t threehalfs = 1.5f;
+    float32_t x2 = x * 0.5f;
+    float32_t y;
+
+    union {
+        float32_t f;
+        int32_t i;
+    } conv;
+
+    conv.f = x;
+    if (conv.i <= 0) {
+        return INFINITY;
+    }
+    conv.i = 0x5f3759df - (conv.i >> 1); /* initial guess of 1/sqrt(x) */
+    y = conv.f;
+    y = y * (threehalfs - (x2 * y * y)); /* newton 1st iter */
+    y = y * (threehalfs - (x2 * y * y)); /* newton 2nd iter */
+    y = y * (threehalfs - (x2 * y * y)); /* newton 3rd iter */
+
+    return y;
+}
+
+/**
+   @brief Inverse square root of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_invsqrt_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  float32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    float32_t x0, x1;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        x0 = pSrc[i];
+        x1 = pSrc[i + 1];
+        pDst[i] = plp_invsqrt_vec_f32_elem(x0);
+        pDst[i + 1] = plp_invsqrt_vec_f32_elem(x1);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = plp_invsqrt_vec_f32_elem(pSrc[i]);
+    }
+}
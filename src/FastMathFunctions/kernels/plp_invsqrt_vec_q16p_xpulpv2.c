@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_invsqrt_vec_q16p_xpulpv2.c
+ * Description:  Parallel inverse square root of a q16 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @brief Parallel inverse square root of a 16-bit fixed point vector kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_fast_math_instance_q16 struct initialized by
+                     plp_invsqrt_vec_q16_parallel
+   @return     none
+
+   @par Parallelization
+   Every core computes a contiguous chunk of the vector with plp_invsqrt_vec_q16s_xpulpv2. The
+   size of each chunk is a multiple of 4, such that every core starts on a word boundary and
+   neighbouring cores never write to the same word.
+*/
+
+void plp_invsqrt_vec_q16p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_fast_math_instance_q16 *a = (plp_fast_math_instance_q16 *)args;
+
+    const int16_t *__restrict__ pSrc = a->pSrc;
+    uint32_t blockSize = a->blockSize;
+    uint32_t fracBits = a->fracBits;
+    uint32_t nPE = a->nPE;
+    int16_t *__restrict__ pDst = a->pDst;
+
+    uint32_t chunk = (((blockSize + nPE - 1) / nPE) + 3) & ~3;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > blockSize) {
+        start = blockSize;
+    }
+    if (end > blockSize) {
+        end = blockSize;
+    }
+
+    if (start < end) {
+        plp_invsqrt_vec_q16s_xpulpv2(pSrc + start, end - start, fracBits, pDst + start);
+    }
+}
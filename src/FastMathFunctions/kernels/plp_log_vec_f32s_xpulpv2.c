@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_log_vec_f32s_xpulpv2.c
+ * Description:  Natural logarithm of a f32 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Natural logarithm with the mantissa folded into [sqrt(1/2), sqrt(2)) and a degree 7 minimax
+// polynomial for log(1 + f) / f. Zero, negative and subnormal inputs return -inf.
+static inline float32_t plp_log_vec_f32_elem(float32_t x) {
+
+    union {
+        float32_t f;
+        int32_t i;
+    } u;
+    float32_t f;
+    int32_t e;
+
+    u.f = x;
+    if (u.i < 0x00800000) {
+        return -INFINITY;
+    }
+
+    // shift the exponent by one when the mantissa is larger than sqrt(2)
+    u.i += 0x3F800000 - 0x3F3504F3;
+    e = (u.i >> 23) - 127;
+    u.i = (u.i & 0x007FFFFF) + 0x3F3504F3;
+    f = u.f - 1.0f;
+
+    return (float32_t)e * 0.693147181f +
+           f * (0.999999814f +
+                f * (-0.500006674f +
+                     f * (0.33336182f +
+                          f * (-0.249593439f +
+                               f * (0.198730463f +
+                                    f * (-0.173334648f +
+                                         f * (0.164199905f + f * -0.10102239f)))))));
+}
+
+/**
+   @brief Natural logarithm of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_log_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              float32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    float32_t x0, x1;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        x0 = pSrc[i];
+        x1 = pSrc[i + 1];
+        pDst[i] = plp_log_vec_f32_elem(x0);
+        pDst[i + 1] = plp_log_vec_f32_elem(x1);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = plp_log_vec_f32_elem(pSrc[i]);
+    }
+}
@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_log_vec_q16s_xpulpv2.c
+ * Description:  Natural logarithm of a q16 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Natural logarithm of a Q(fracBits) value. The input is normalized to a mantissa in
+// [sqrt(1/2), sqrt(2)) and an exponent e, log(1 + d) / d is a degree 4 minimax polynomial in
+// Q2.15. Non-positive inputs saturate to the most negative value.
+static inline int16_t plp_log_vec_q16_elem(int32_t x, uint32_t fracBits) {
+
+    uint32_t n, m;
+    int32_t e, d, acc, shift;
+
+    if (x <= 0) {
+        return (int16_t)0x8000;
+    }
+
+    n = __builtin_clz(x);
+    m = (uint32_t)x << n; // mantissa in Q1.31
+    e = 31 - (int32_t)n - (int32_t)fracBits;
+    if (m > 0xB504F333U) {
+        m >>= 1;
+        e++;
+    }
+    d = (int32_t)(m - 0x80000000U) >> 16;
+
+    acc = 5739;
+    acc = ((acc * d) >> 15) - 8962;
+    acc = ((acc * d) >> 15) + 11054;
+    acc = ((acc * d) >> 15) - 16359;
+    acc = ((acc * d) >> 15) + 32765;
+
+    // e * log(2) + log(1 + d) in Q15
+    acc = e * 22713 + ((acc * d) >> 15);
+    shift = 15 - (int32_t)fracBits;
+    acc = (acc + ((1 << shift) >> 1)) >> shift;
+
+    return (int16_t)((acc > 0x7FFF) ? 0x7FFF : (acc < -0x8000) ? -0x8000 : acc);
+}
+
+/**
+   @brief Natural logarithm of a 16-bit fixed point vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  fracBits   number of fractional bits of the input and output values
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_log_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    v2s x;
+    int16_t y0, y1;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        x = *((v2s *)(pSrc + i));
+        y0 = plp_log_vec_q16_elem(x[0], fracBits);
+        y1 = plp_log_vec_q16_elem(x[1], fracBits);
+        *((v2s *)(pDst + i)) = __PACK2(y0, y1);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = plp_log_vec_q16_elem(pSrc[i], fracBits);
+    }
+}
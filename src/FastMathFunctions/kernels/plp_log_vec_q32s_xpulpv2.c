@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_log_vec_q32s_xpulpv2.c
+ * Description:  Natural logarithm of a q32 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Natural logarithm of a Q(fracBits) value. The input is normalized to a mantissa in
+// [sqrt(1/2), sqrt(2)) and an exponent e, log(1 + d) / d is a degree 8 minimax polynomial in
+// Q2.30. Non-positive inputs saturate to the most negative value.
+static inline int32_t plp_log_vec_q32_elem(int32_t x, uint32_t fracBits) {
+
+    uint32_t n, m;
+    int32_t e, d, acc;
+    int64_t res;
+
+    if (x <= 0) {
+        return (int32_t)0x80000000;
+    }
+
+    n = __builtin_clz(x);
+    m = (uint32_t)x << n; // mantissa in Q1.31
+    e = 31 - (int32_t)n - (int32_t)fracBits;
+    if (m > 0xB504F333U) {
+        m >>= 1;
+        e++;
+    }
+    d = (int32_t)(m - 0x80000000U);
+
+    acc = 93339623;
+    acc = (int32_t)(((int64_t)acc * d) >> 31) - 156520607;
+    acc = (int32_t)(((int64_t)acc * d) >> 31) + 161787017;
+    acc = (int32_t)(((int64_t)acc * d) >> 31) - 177520742;
+    acc = (int32_t)(((int64_t)acc * d) >> 31) + 214091679;
+    acc = (int32_t)(((int64_t)acc * d) >> 31) - 268470760;
+    acc = (int32_t)(((int64_t)acc * d) >> 31) + 357931939;
+    acc = (int32_t)(((int64_t)acc * d) >> 31) - 536870620;
+    acc = (int32_t)(((int64_t)acc * d) >> 31) + 1073741696;
+
+    // e * log(2) + log(1 + d) in Q32
+    res = (int64_t)e * 2977044472 + (((int64_t)acc * d) >> 29);
+
+    return plp_acc64_to_q32(res, 32 - fracBits);
+}
+
+/**
+   @brief Natural logarithm of a 32-bit fixed point vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  fracBits   number of fractional bits of the input and output values
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_log_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t fracBits,
+                              int32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    int32_t x0, x1;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        x0 = pSrc[i];
+        x1 = pSrc[i + 1];
+        pDst[i] = plp_log_vec_q32_elem(x0, fracBits);
+        pDst[i + 1] = plp_log_vec_q32_elem(x1, fracBits);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = plp_log_vec_q32_elem(pSrc[i], fracBits);
+    }
+}
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lut_interp_f32s_xpulpv2.c
+ * Description:  Table interpolation on a f32 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Linear interpolation in a table of tableSize entries, which are spread evenly over [xMin, xMax].
+// scale is (tableSize - 1) / (xMax - xMin), inputs outside of the range return the first or the
+// last entry.
+static inline float32_t plp_lut_interp_f32_elem(float32_t x,
+                                                const float32_t *__restrict__ pTable,
+                                                uint32_t tableSize,
+                                                float32_t xMin,
+                                                float32_t scale) {
+
+    float32_t t = (x - xMin) * scale;
+    float32_t a, frac;
+    uint32_t index;
+
+    if (!(t > 0.0f)) {
+        return pTable[0];
+    }
+    if (t >= (float32_t)(tableSize - 1)) {
+        return pTable[tableSize - 1];
+    }
+
+    index = (uint32_t)t;
+    frac = t - (float32_t)index;
+    a = pTable[index];
+
+    return a + frac * (pTable[index + 1] - a);
+}
+
+/**
+   @brief Table interpolation on a 32-bit float vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  pTable     points to the table, spread evenly over [xMin, xMax]
+   @param[in]  tableSize  number of entries of the table, at least 2
+   @param[in]  xMin       input of the first table entry
+   @param[in]  xMax       input of the last table entry, larger than xMin
+   @param[out] pDst       points to the output vector, inputs outside of [xMin, xMax]
+                          return the first or the last entry
+   @return     none
+*/
+
+void plp_lut_interp_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 const float32_t *__restrict__ pTable,
+                                 uint32_t tableSize,
+                                 float32_t xMin,
+                                 float32_t xMax,
+                                 float32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    float32_t scale = (float32_t)(tableSize - 1) / (xMax - xMin);
+    float32_t x0, x1;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        x0 = pSrc[i];
+        x1 = pSrc[i + 1];
+        pDst[i] = plp_lut_interp_f32_elem(x0, pTable, tableSize, xMin, scale);
+        pDst[i + 1] = plp_lut_interp_f32_elem(x1, pTable, tableSize, xMin, scale);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = plp_lut_interp_f32_elem(pSrc[i], pTable, tableSize, xMin, scale);
+    }
+}
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lut_interp_q16s_xpulpv2.c
+ * Description:  Table interpolation on a q16 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Linear interpolation in a table of tableSize entries, which are spread evenly over the input
+// range [-1, 1). The position in the table is (x + 1) * (tableSize - 1) in Q16. The two nearest
+// entries are weighted in Q0.16, as the weights sum to one the result fits in 32 bits.
+static inline int32_t plp_lut_interp_q16_elem(int32_t x,
+                                              const int16_t *__restrict__ pTable,
+                                              uint32_t tableSize) {
+
+    uint32_t pos = (uint32_t)(x + 0x8000) * (tableSize - 1);
+    uint32_t index = pos >> 16;
+    int32_t frac = pos & 0xFFFF;
+
+    if (frac == 0) {
+        return pTable[index];
+    }
+
+    return (pTable[index] * (0x10000 - frac) + pTable[index + 1] * frac + 0x8000) >> 16;
+}
+
+/**
+   @brief Table interpolation on a 16-bit fixed point vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector in Q1.15
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  pTable     points to the table, spread evenly over the inputs [-1, 1), with
+                          the first entry at -1 and the last entry at 1
+   @param[in]  tableSize  number of entries of the table, in [2, 65536]
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_lut_interp_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 const int16_t *__restrict__ pTable,
+                                 uint32_t tableSize,
+                                 int16_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    v2s x;
+    int32_t y0, y1;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        x = *((v2s *)(pSrc + i));
+        y0 = plp_lut_interp_q16_elem(x[0], pTable, tableSize);
+        y1 = plp_lut_interp_q16_elem(x[1], pTable, tableSize);
+        *((v2s *)(pDst + i)) = __PACK2(y0, y1);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = (int16_t)plp_lut_interp_q16_elem(pSrc[i], pTable, tableSize);
+    }
+}
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_nco_q16s_rv32im.c
+ * Description:  Numerically controlled oscillator with q16 output for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+// Sine and cosine at the phase given by the upper 15 bits of phase, with the same rounding as
+// plp_sincos_q16s_rv32im.
+static inline void plp_nco_q16_lookup(uint32_t phase, int16_t *pSin, int16_t *pCos) {
+
+    uint32_t sinIndex, cosIndex;
+    int32_t fract, sinVal, cosVal;
+
+    phase = phase >> 17;
+    sinIndex = phase >> FAST_MATH_Q16_SHIFT;
+    cosIndex = (sinIndex + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+    fract = (phase & ((1 << FAST_MATH_Q16_SHIFT) - 1)) << 9;
+
+    sinVal = ((0x8000 - fract) * sinTable_q16[sinIndex]) >> 16;
+    cosVal = ((0x8000 - fract) * sinTable_q16[cosIndex]) >> 16;
+    sinVal = ((sinVal << 16) + fract * sinTable_q16[sinIndex + 1]) >> 16;
+    cosVal = ((cosVal << 16) + fract * sinTable_q16[cosIndex + 1]) >> 16;
+
+    *pSin = sinVal << 1;
+    *pCos = cosVal << 1;
+}
+
+/**
+   @brief Numerically controlled oscillator with 16-bit fixed point output for RV32IM extension.
+   @param[in]  S          points to the instance initialized by plp_nco_init_q16
+   @param[in]  blockSize  number of complex samples to generate
+   @param[out] pDst       points to the output vector of 2 * blockSize values, as interleaved
+                          real (cosine) and imaginary (sine) parts in Q1.15
+   @return     none
+*/
+
+void plp_nco_q16s_rv32im(plp_nco_instance_q16 *S,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    uint32_t phase = S->phase;
+    uint32_t phaseInc = S->phaseInc;
+    int16_t sinVal, cosVal;
+
+    for (i = 0; i < blockSize; i++) {
+        plp_nco_q16_lookup(phase, &sinVal, &cosVal);
+        pDst[2 * i] = cosVal;
+        pDst[2 * i + 1] = sinVal;
+        phase += phaseInc;
+    }
+
+    S->phase = phase;
+}
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_poly_eval_f32s_xpulpv2.c
+ * Description:  Polynomial evaluation on a f32 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @brief Polynomial evaluation on a 32-bit float vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  pCoeffs    points to the order + 1 coefficients, the constant
+                          term first
+   @param[in]  order      order of the polynomial
+   @param[out] pDst       points to the output vector
+   @return     none
+
+   @par Unrolling
+   Four samples are evaluated at a time, such that their multiply-adds
+   are independent and hide the latency of the FPU.
+*/
+
+void plp_poly_eval_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                const float32_t *__restrict__ pCoeffs,
+                                uint32_t order,
+                                float32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    int32_t k;
+    float32_t x0, x1, x2, x3;
+    float32_t acc0, acc1, acc2, acc3;
+
+    // four independent Horner chains hide the latency of the FPU
+    for (i = 0; i + 3 < blockSize; i += 4) {
+        x0 = pSrc[i];
+        x1 = pSrc[i + 1];
+        x2 = pSrc[i + 2];
+        x3 = pSrc[i + 3];
+        acc0 = acc1 = acc2 = acc3 = pCoeffs[order];
+        for (k = (int32_t)order - 1; k >= 0; k--) {
+            float32_t c = pCoeffs[k];
+            acc0 = acc0 * x0 + c;
+            acc1 = acc1 * x1 + c;
+            acc2 = acc2 * x2 + c;
+            acc3 = acc3 * x3 + c;
+        }
+        pDst[i] = acc0;
+        pDst[i + 1] = acc1;
+        pDst[i + 2] = acc2;
+        pDst[i + 3] = acc3;
+    }
+
+    // leftover elements
+    for (; i < blockSize; i++) {
+        x0 = pSrc[i];
+        acc0 = pCoeffs[order];
+        for (k = (int32_t)order - 1; k >= 0; k--) {
+            acc0 = acc0 * x0 + pCoeffs[k];
+        }
+        pDst[i] = acc0;
+    }
+}
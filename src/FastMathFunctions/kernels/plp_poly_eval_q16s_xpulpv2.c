@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_poly_eval_q16s_xpulpv2.c
+ * Description:  Polynomial evaluation on a q16 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Horner evaluation of the polynomial with order + 1 coefficients in Q(fracBits). Every step is
+// rounded to Q(fracBits) and saturated to 16 bits.
+static inline int32_t plp_poly_eval_q16_elem(int32_t x,
+                                             const int16_t *__restrict__ pCoeffs,
+                                             uint32_t order,
+                                             uint32_t fracBits,
+                                             int32_t rnd) {
+
+    int32_t acc = pCoeffs[order];
+    int32_t k;
+
+    for (k = (int32_t)order - 1; k >= 0; k--) {
+        acc = ((acc * x + rnd) >> fracBits) + pCoeffs[k];
+        acc = __CLIP(acc, 15);
+    }
+
+    return acc;
+}
+
+/**
+   @brief Polynomial evaluation on a 16-bit fixed point vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector in Q(fracBits)
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  pCoeffs    points to the order + 1 coefficients in Q(fracBits), the constant
+                          term first
+   @param[in]  order      order of the polynomial
+   @param[in]  fracBits   number of fractional bits of the input, the coefficients
+                          and the output
+   @param[out] pDst       points to the output vector, saturated
+   @return     none
+*/
+
+void plp_poly_eval_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                const int16_t *__restrict__ pCoeffs,
+                                uint32_t order,
+                                uint32_t fracBits,
+                                int16_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    int32_t rnd = (fracBits > 0) ? 1 << (fracBits - 1) : 0;
+    v2s x;
+    int32_t y0, y1;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        x = *((v2s *)(pSrc + i));
+        y0 = plp_poly_eval_q16_elem(x[0], pCoeffs, order, fracBits, rnd);
+        y1 = plp_poly_eval_q16_elem(x[1], pCoeffs, order, fracBits, rnd);
+        *((v2s *)(pDst + i)) = __PACK2(y0, y1);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = (int16_t)plp_poly_eval_q16_elem(pSrc[i], pCoeffs, order, fracBits, rnd);
+    }
+}
@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_poly_eval_q32p_xpulpv2.c
+ * Description:  Parallel polynomial evaluation on a q32 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @brief Parallel polynomial evaluation on a 32-bit fixed point vector for XPULPV2.
+   @param[in]  args  pointer to plp_poly_eval_instance_q32 struct initialized by
+                     plp_poly_eval_q32_parallel
+   @return     none
+
+   @par Parallelization
+   Every core computes a contiguous chunk of the vector with plp_poly_eval_q32s_xpulpv2.
+*/
+
+void plp_poly_eval_q32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_poly_eval_instance_q32 *a = (plp_poly_eval_instance_q32 *)args;
+
+    const int32_t *__restrict__ pSrc = a->pSrc;
+    uint32_t blockSize = a->blockSize;
+    const int32_t *__restrict__ pCoeffs = a->pCoeffs;
+    uint32_t order = a->order;
+    uint32_t fracBits = a->fracBits;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDst = a->pDst;
+
+    uint32_t chunk = (blockSize + nPE - 1) / nPE;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > blockSize) {
+        start = blockSize;
+    }
+    if (end > blockSize) {
+        end = blockSize;
+    }
+
+    if (start < end) {
+        plp_poly_eval_q32s_xpulpv2(pSrc + start,
+                                   end - start,
+                                   pCoeffs,
+                                   order,
+                                   fracBits,
+                                   pDst + start);
+    }
+}
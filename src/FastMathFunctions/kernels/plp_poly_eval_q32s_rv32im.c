@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_poly_eval_q32s_rv32im.c
+ * Description:  Polynomial evaluation on a q32 vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Horner evaluation of the polynomial with order + 1 coefficients in Q(fracBits). Every step is
+// rounded to Q(fracBits) and saturated to 32 bits.
+static inline int32_t plp_poly_eval_q32_elem(int32_t x,
+                                             const int32_t *__restrict__ pCoeffs,
+                                             uint32_t order,
+                                             uint32_t fracBits,
+                                             int64_t rnd) {
+
+    int64_t acc = pCoeffs[order];
+    int32_t k;
+
+    for (k = (int32_t)order - 1; k >= 0; k--) {
+        acc = ((acc * x + rnd) >> fracBits) + pCoeffs[k];
+        acc = (acc > INT32_MAX) ? INT32_MAX : (acc < INT32_MIN) ? INT32_MIN : acc;
+    }
+
+    return (int32_t)acc;
+}
+
+/**
+   @brief Polynomial evaluation on a 32-bit fixed point vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector in Q(fracBits)
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  pCoeffs    points to the order + 1 coefficients in Q(fracBits), the constant
+                          term first
+   @param[in]  order      order of the polynomial
+   @param[in]  fracBits   number of fractional bits of the input, the coefficients
+                          and the output
+   @param[out] pDst       points to the output vector, saturated
+   @return     none
+*/
+
+void plp_poly_eval_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               const int32_t *__restrict__ pCoeffs,
+                               uint32_t order,
+                               uint32_t fracBits,
+                               int32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    int64_t rnd = (fracBits > 0) ? (int64_t)1 << (fracBits - 1) : 0;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = plp_poly_eval_q32_elem(pSrc[i], pCoeffs, order, fracBits, rnd);
+    }
+}
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_recip_vec_f32s_xpulpv2.c
+ * Description:  Reciprocal of a f32 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Reciprocal with an initial guess from the exponent bits and three newton iterations. The
+// magnitude of the input must be within [2^-126, 2^126].
+static inline float32_t plp_recip_vec_f32_elem(float32_t x) {
+
+    union {
+        float32_t f;
+        uint32_t i;
+    } conv;
+    float32_t y;
+
+    conv.f = x;
+    conv.i = 0x7EF311C3 - conv.i; /* initial guess of 1/x, the sign is preserved */
+    y = conv.f;
+    y = y * (2.0f - x * y); /* newton 1st iter */
+    y = y * (2.0f - x * y); /* newton 2nd iter */
+    y = y * (2.0f - x * y); /* newton 3rd iter */
+
+    return y;
+}
+
+/**
+   @brief Reciprocal of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_recip_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                float32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    float32_t x0, x1;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        x0 = pSrc[i];
+        x1 = pSrc[i + 1];
+        pDst[i] = plp_recip_vec_f32_elem(x0);
+        pDst[i + 1] = plp_recip_vec_f32_elem(x1);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = plp_recip_vec_f32_elem(pSrc[i]);
+    }
+}
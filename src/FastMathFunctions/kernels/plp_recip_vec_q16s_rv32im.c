@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_recip_vec_q16s_rv32im.c
+ * Description:  Reciprocal of a q16 vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Reciprocal of a Q(fracBits) value with an integer division, rounded and saturated to
+// Q(fracBits). A zero input returns the largest value.
+static inline int16_t plp_recip_vec_q16_elem(int32_t x, uint32_t fracBits) {
+
+    uint32_t ax = (x < 0) ? -x : x;
+    uint32_t y;
+
+    if (ax == 0) {
+        return 0x7FFF;
+    }
+
+    y = ((1U << (2 * fracBits)) + (ax >> 1)) / ax;
+    if (x < 0) {
+        return (int16_t)((y > 0x8000) ? -0x8000 : -(int32_t)y);
+    }
+
+    return (int16_t)((y > 0x7FFF) ? 0x7FFF : y);
+}
+
+/**
+   @brief Reciprocal of a 16-bit fixed point vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  fracBits   number of fractional bits of the input and output values
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_recip_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t fracBits,
+                               int16_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = plp_recip_vec_q16_elem(pSrc[i], fracBits);
+    }
+}
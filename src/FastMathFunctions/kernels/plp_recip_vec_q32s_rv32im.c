@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_recip_vec_q32s_rv32im.c
+ * Description:  Reciprocal of a q32 vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Reciprocal of a Q(fracBits) value. The magnitude is normalized to [0.5, 1) and inverted with
+// three newton iterations in Q2.30, starting from 48/17 - 32/17 * x. The result is rounded and
+// saturated to Q(fracBits), a zero input returns the largest value.
+static inline int32_t plp_recip_vec_q32_elem(int32_t x, uint32_t fracBits) {
+
+    uint32_t ax = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+    uint32_t n, d, r, e;
+    int32_t shift, y;
+
+    if (ax == 0) {
+        return 0x7FFFFFFF;
+    }
+
+    n = __builtin_clz(ax);
+    d = ax << n;
+    r = 3031741622U - (uint32_t)(((uint64_t)2021161081U * d) >> 32);
+    for (int i = 0; i < 3; i++) {
+        e = (uint32_t)(((uint64_t)d * r) >> 32);
+        r = (uint32_t)(((uint64_t)r * (0x80000000U - e)) >> 30);
+    }
+
+    // 1 / x = r * 2^(2 * fracBits + n - 62) in Q(fracBits)
+    shift = 62 - (int32_t)n - 2 * (int32_t)fracBits;
+    if (shift < 0) {
+        return (x < 0) ? (int32_t)0x80000000 : 0x7FFFFFFF;
+    }
+    y = plp_acc64_to_q32((int64_t)r, (uint32_t)shift);
+
+    return (x < 0) ? -y : y;
+}
+
+/**
+   @brief Reciprocal of a 32-bit fixed point vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  fracBits   number of fractional bits of the input and output values
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_recip_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t fracBits,
+                               int32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = plp_recip_vec_q32_elem(pSrc[i], fracBits);
+    }
+}
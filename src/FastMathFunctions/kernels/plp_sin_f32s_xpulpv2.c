@@ -44,6 +44,9 @@
  */
 
 float32_t plp_sin_f32s_xpulpv2(float32_t x) {
+#if defined(PLP_FAST_MATH_POLY)
+    return plp_sin_poly_f32(x * 0.159154943092f);
+#else
     float32_t sinVal, fract, in; /* Temporary input, output variables */
     uint16_t index;              /* Index variable */
     float32_t a, b;              /* Two nearest output values */
@@ -87,4 +90,5 @@ float32_t plp_sin_f32s_xpulpv2(float32_t x) {
 
     /* Return output value */
     return (sinVal);
+#endif
 }
@@ -45,7 +45,10 @@
  */
 
 int32_t plp_sin_q32s_rv32im(int32_t x) {
-
+#if defined(PLP_FAST_MATH_POLY)
+    /* the Q1.31 input covers a full turn, doubling it gives the 32-bit phase */
+    return plp_sin_poly_q32((uint32_t)x << 1);
+#else
     int32_t sinVal; /* Temporary variables for input, output */
     int32_t index;  /* Index variable */
     int32_t a, b;   /* Two nearest output values */
@@ -71,4 +74,5 @@ int32_t plp_sin_q32s_rv32im(int32_t x) {
 
     /* Return output value */
     return (sinVal << 1);
+#endif
 }
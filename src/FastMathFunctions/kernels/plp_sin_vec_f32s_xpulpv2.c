@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sin_vec_f32s_xpulpv2.c
+ * Description:  Sine of a f32 vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+// Reads the sine table at a phase given in turns. The floor towards -infinity and the wrap of
+// an index equal to FAST_MATH_TABLE_SIZE are computed without branches.
+static inline float32_t plp_sin_vec_f32_lookup(float32_t in) {
+#if defined(PLP_FAST_MATH_POLY)
+    return plp_sin_poly_f32(in);
+#else
+    int32_t n;
+    uint32_t index;
+    float32_t findex, fract;
+
+    n = (int32_t)in;
+    n -= (in < 0.0f);
+    in = in - (float32_t)n;
+
+    findex = (float32_t)FAST_MATH_TABLE_SIZE * in;
+    index = (uint32_t)findex;
+    fract = findex - (float32_t)index;
+    index &= FAST_MATH_TABLE_SIZE - 1;
+
+    return (1.0f - fract) * sinTable_f32[index] + fract * sinTable_f32[index + 1];
+#endif
+}
+
+/**
+   @brief Sine of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector, values in radians
+   @param[in]  blockSize  number of samples in each vector
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_sin_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              float32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+    float32_t x0, x1;
+
+    // scale to turns
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        x0 = pSrc[i];
+        x1 = pSrc[i + 1];
+        pDst[i] = plp_sin_vec_f32_lookup(x0 * 0.159154943092f);
+        pDst[i + 1] = plp_sin_vec_f32_lookup(x1 * 0.159154943092f);
+    }
+
+    // leftover element
+    if (i < blockSize) {
+        pDst[i] = plp_sin_vec_f32_lookup(pSrc[i] * 0.159154943092f);
+    }
+}
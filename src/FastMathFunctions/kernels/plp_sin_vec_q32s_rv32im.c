@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sin_vec_q32s_rv32im.c
+ * Description:  Sine of a q32 vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+// Interpolates the sine table at a phase in [0, 0x7FFFFFFF], with the same rounding as
+// plp_sin_q32s_rv32im.
+static inline int32_t plp_sin_vec_q32_lookup(uint32_t x) {
+#if defined(PLP_FAST_MATH_POLY)
+    return plp_sin_poly_q32(x << 1);
+#else
+    uint32_t index = x >> FAST_MATH_Q32_SHIFT;
+    int32_t fract = (x & ((1 << FAST_MATH_Q32_SHIFT) - 1)) << 9;
+    int32_t a = sinTable_q32[index];
+    int32_t b = sinTable_q32[index + 1];
+    int32_t val;
+
+    val = (int32_t)(((int64_t)(0x80000000U - fract) * a) >> 32);
+    val = (int32_t)((((int64_t)val << 32) + (int64_t)fract * b) >> 32);
+
+    return val << 1;
+#endif
+}
+
+/**
+   @brief Sine of a 32-bit fixed point vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector, Q1.31 values in [0, +0.9999]
+                          mapped to [0, 2*PI)
+   @param[in]  blockSize  number of samples in each vector
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_sin_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+
+    // negative phases wrap into the table range by clearing the sign bit
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = plp_sin_vec_q32_lookup((uint32_t)pSrc[i] & 0x7FFFFFFF);
+    }
+}
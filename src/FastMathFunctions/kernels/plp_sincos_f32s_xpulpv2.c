@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sincos_f32s_xpulpv2.c
+ * Description:  Calculates sine and cosine of a f32 input for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+   @brief Sine and cosine of a 32-bit float value for XPULPV2 extension.
+   @param[in]  x     input value in radians
+   @param[out] pSin  sin(x) returned here
+   @param[out] pCos  cos(x) returned here
+   @return     none
+*/
+
+void plp_sincos_f32s_xpulpv2(float32_t x,
+                             float32_t *__restrict__ pSin,
+                             float32_t *__restrict__ pCos) {
+#if defined(PLP_FAST_MATH_POLY)
+    float32_t in = x * 0.159154943092f;
+
+    *pSin = plp_sin_poly_f32(in);
+    *pCos = plp_sin_poly_f32(in + 0.25f);
+#else
+    int32_t n;
+    uint32_t sinIndex, cosIndex;
+    float32_t in, findex, fract;
+
+    /* Scale input to [0 1] range from [0 2*PI] , divide input by 2*pi */
+    in = x * 0.159154943092f;
+
+    /* Floor towards -infinity without a branch */
+    n = (int32_t)in;
+    n -= (in < 0.0f);
+    in = in - (float32_t)n;
+
+    findex = (float32_t)FAST_MATH_TABLE_SIZE * in;
+    sinIndex = (uint32_t)findex;
+    fract = findex - (float32_t)sinIndex;
+
+    /* An index equal to FAST_MATH_TABLE_SIZE wraps to 0. The cosine is read a quarter of the
+       table further, with the same fractional part. */
+    sinIndex &= FAST_MATH_TABLE_SIZE - 1;
+    cosIndex = (sinIndex + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+
+    /* Linear interpolation process */
+    *pSin = (1.0f - fract) * sinTable_f32[sinIndex] + fract * sinTable_f32[sinIndex + 1];
+    *pCos = (1.0f - fract) * sinTable_f32[cosIndex] + fract * sinTable_f32[cosIndex + 1];
+#endif
+}
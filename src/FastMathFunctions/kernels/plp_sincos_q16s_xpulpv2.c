@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sincos_q16s_xpulpv2.c
+ * Description:  Calculates sine and cosine of a q16 input for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+   @brief Sine and cosine of a 16-bit fixed point value for XPULPV2 extension.
+   @param[in]  x     Q1.15 value in range [0, +0.9999], mapped to [0, 2*PI)
+   @param[out] pSin  sin(x) returned here
+   @param[out] pCos  cos(x) returned here
+   @return     none
+*/
+
+void plp_sincos_q16s_xpulpv2(int16_t x,
+                             int16_t *__restrict__ pSin,
+                             int16_t *__restrict__ pCos) {
+
+    uint32_t phase, sinIndex, cosIndex;
+    int32_t fract, sinVal, cosVal;
+
+    /* Negative numbers wrap into the table range by clearing the sign bit */
+    phase = (uint16_t)x & 0x7FFF;
+
+    /* Calculate the nearest index and the fractional value. The cosine is read a quarter of the
+       table further, with the same fractional part. */
+    sinIndex = phase >> FAST_MATH_Q16_SHIFT;
+    cosIndex = (sinIndex + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+    fract = (phase & ((1 << FAST_MATH_Q16_SHIFT) - 1)) << 9;
+
+    /* Linear interpolation process */
+    sinVal = ((0x8000 - fract) * sinTable_q16[sinIndex]) >> 16;
+    cosVal = ((0x8000 - fract) * sinTable_q16[cosIndex]) >> 16;
+    sinVal = ((sinVal << 16) + fract * sinTable_q16[sinIndex + 1]) >> 16;
+    cosVal = ((cosVal << 16) + fract * sinTable_q16[cosIndex + 1]) >> 16;
+
+    *pSin = sinVal << 1;
+    *pCos = cosVal << 1;
+}
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sincos_q32s_xpulpv2.c
+ * Description:  Calculates sine and cosine of a q32 input for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+   @brief Sine and cosine of a 32-bit fixed point value for XPULPV2 extension.
+   @param[in]  x     Q1.31 value in range [0, +0.9999], mapped to [0, 2*PI)
+   @param[out] pSin  sin(x) returned here
+   @param[out] pCos  cos(x) returned here
+   @return     none
+*/
+
+void plp_sincos_q32s_xpulpv2(int32_t x,
+                             int32_t *__restrict__ pSin,
+                             int32_t *__restrict__ pCos) {
+#if defined(PLP_FAST_MATH_POLY)
+    /* the Q1.31 input covers a full turn, doubling it gives the 32-bit phase */
+    uint32_t phase = (uint32_t)x << 1;
+
+    *pSin = plp_sin_poly_q32(phase);
+    *pCos = plp_sin_poly_q32(phase + 0x40000000);
+#else
+    uint32_t phase, sinIndex, cosIndex;
+    int32_t fract, sinVal, cosVal;
+    int32_t sinA, sinB, cosA, cosB;
+
+    /* Negative numbers wrap into the table range by clearing the sign bit */
+    phase = (uint32_t)x & 0x7FFFFFFF;
+
+    /* Calculate the nearest index and the fractional value. The cosine is read a quarter of the
+       table further, with the same fractional part. */
+    sinIndex = phase >> FAST_MATH_Q32_SHIFT;
+    cosIndex = (sinIndex + FAST_MATH_TABLE_SIZE / 4) & (FAST_MATH_TABLE_SIZE - 1);
+    fract = (phase & ((1 << FAST_MATH_Q32_SHIFT) - 1)) << 9;
+
+    /* Read two nearest values of input value from the sin table */
+    sinA = sinTable_q32[sinIndex];
+    sinB = sinTable_q32[sinIndex + 1];
+    cosA = sinTable_q32[cosIndex];
+    cosB = sinTable_q32[cosIndex + 1];
+
+    /* Linear interpolation process */
+    sinVal = (int32_t)(((int64_t)(0x80000000U - fract) * sinA) >> 32);
+    cosVal = (int32_t)(((int64_t)(0x80000000U - fract) * cosA) >> 32);
+    sinVal = (int32_t)((((int64_t)sinVal << 32) + (int64_t)fract * sinB) >> 32);
+    cosVal = (int32_t)((((int64_t)cosVal << 32) + (int64_t)fract * cosB) >> 32);
+
+    *pSin = sinVal << 1;
+    *pCos = cosVal << 1;
+#endif
+}
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sqrt_f32s_rv32im.c
+ * Description:  Square root of a 32-bit float number on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup sqrt
+*/
+
+/**
+   @addtogroup sqrtKernels
+   @{
+*/
+
+/**
+   @brief Square root of a 32-bit floating point number for RV32IM extension.
+   @param[in]  pSrc       points to the input value
+   @param[out] pRes       square root returned here
+   @return     none
+*/
+
+void plp_sqrt_f32s_rv32im(const float *__restrict__ pSrc,
+                          float *__restrict__ pRes) {
+
+    const float threehalfs = 1.5f;
+    float x2, y;
+
+    union {
+        float f;
+        int32_t i;
+    } conv;
+
+    conv.f = *pSrc;
+
+    // the sign test is done on the bit pattern, which avoids a software floating point compare
+    if (conv.i > 0) {
+        /* fast inverse square root with proper type punning */
+        x2 = conv.f * 0.5f;
+        conv.i = 0x5f3759df - (conv.i >> 1); /* evil floating point bit level hacking */
+        y = conv.f;
+        y = y * (threehalfs - (x2 * y * y)); /* newton 1st iter */
+        y = y * (threehalfs - (x2 * y * y)); /* newton 2nd iter */
+        *pRes = *pSrc * y;                   /* to square root */
+    } else {
+        *pRes = 0.f;
+    }
+}
+
+/**
+   @} end of sqrtKernels group
+*/
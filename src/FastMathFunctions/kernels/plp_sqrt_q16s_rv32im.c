@@ -33,7 +33,6 @@
  * with Apache-2.0.
  */
 
-#define sqrt2 0b1011010100000100
 #include "plp_math.h"
 
 /**
@@ -52,6 +51,7 @@
 /**
    @brief         Square root of a 16-bit fixed point number for RV32IM extension.
    @param[in]     pSrc       points to the input vector
+   @param[in]     fracBits   number of fractional bits of the input and output
    @param[out]    pRes   Square root returned here
    @return        none
 */
@@ -60,59 +60,6 @@ void plp_sqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
                           const uint32_t fracBits,
                           int16_t *__restrict__ pRes) {
 
-    int16_t number, temp1, intermediate_fixpoint, signBits, half;
-
-    number = *pSrc;
-
-    /* If the input is a positive number then compute the signBits. */
-    if (number > 0) {
-        signBits = __builtin_clz(number) - 17;
-
-        /* Shift by the number of signBits */
-        if ((signBits % 2) == 0) {
-            number = number << signBits;
-        } else {
-            number = number << (signBits - 1);
-        }
-
-        /* Calculate half value of the number */
-        half = number >> 1;
-        /* Store the number for later use */
-        temp1 = number;
-        /* Initial guess for 1/(2sqrt(x)) */
-        intermediate_fixpoint = (sqrt2 >> 1) - (((sqrt2 >> 1) * (temp1 - 0x40000000)) >>
-                                                15); // Taylor at 0.5: sqrt(2)/2 - sqrt(2)/2*(x-0.5)
-
-        for (int i = 0; i < 12; i++) {
-
-            intermediate_fixpoint =
-                ((int16_t)((int32_t)intermediate_fixpoint *
-                               (0x3000 - ((int16_t)((((int16_t)(((int32_t)intermediate_fixpoint *
-                                                                 intermediate_fixpoint) >>
-                                                                15)) *
-                                                     (int32_t)half) >>
-                                                    15))) >>
-                           15))
-                << 2;
-        }
-
-        intermediate_fixpoint = ((int16_t)(((int32_t)temp1 * intermediate_fixpoint) >> 15)) << 1;
-
-        if ((16 - fracBits) > 1) {
-            intermediate_fixpoint = intermediate_fixpoint >> ((int32_t)((16 - fracBits)) >> 1);
-            if ((16 - fracBits) % 2 == 0) {
-                intermediate_fixpoint = ((int32_t)intermediate_fixpoint * sqrt2) >> 15;
-            }
-        }
-
-        if ((signBits % 2) == 0) {
-            intermediate_fixpoint = intermediate_fixpoint >> (signBits / 2);
-        } else {
-            intermediate_fixpoint = intermediate_fixpoint >> ((signBits - 1) / 2);
-        }
-        *pRes = intermediate_fixpoint;
-
-    } else {
-        *pRes = 0;
-    }
+    // integer newton iteration on the normalized input, see plp_sqrt_vec_q16s_rv32im
+    plp_sqrt_vec_q16s_rv32im(pSrc, 1, fracBits, pRes);
 }
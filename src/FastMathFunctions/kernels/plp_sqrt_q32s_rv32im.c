@@ -28,7 +28,6 @@
  *
  */
 
-#define sqrt2 0b1011010100000100
 #include "plp_math.h"
 
 /**
@@ -47,6 +46,7 @@
 /**
    @brief         Square root of a 32-bit fixed point number for RV32IM extension.
    @param[in]     pSrc       points to the input vector
+   @param[in]     fracBits   number of fractional bits of the input and output
    @param[out]    pRes    Square root returned here
    @return        none
 */
@@ -55,35 +55,6 @@ void plp_sqrt_q32s_rv32im(const int32_t *__restrict__ pSrc,
                           const uint32_t fracBits,
                           int32_t *__restrict__ pRes) {
 
-    int32_t number = *pSrc;
-    int32_t root;
-
-    int32_t start = 0;
-    int32_t end = 46341; // smallest integer that is larger than sqrt(0x7FFFFFFF)
-    int32_t mid;
-
-    if (number > 0) {
-
-        while (start <= end) {
-
-            mid = (start + end) >> 1;
-
-            if (((mid * mid) >> fracBits) == number) {
-                root = mid;
-                break;
-            }
-
-            if (((mid * mid) >> fracBits) < number) {
-                start = mid + 1;
-                root = mid;
-            } else {
-                end = mid - 1;
-            }
-        }
-
-        *pRes = root;
-
-    } else {
-        *pRes = 0;
-    }
+    // integer newton iteration on the normalized input, see plp_sqrt_vec_q32s_rv32im
+    plp_sqrt_vec_q32s_rv32im(pSrc, 1, fracBits, pRes);
 }
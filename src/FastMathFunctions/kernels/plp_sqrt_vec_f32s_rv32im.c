@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sqrt_vec_f32s_rv32im.c
+ * Description:  Square root of a f32 vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup sqrt
+*/
+
+/**
+   @addtogroup sqrtKernels
+   @{
+*/
+
+// Square root of a non-negative value with the fast inverse square root and two newton
+// iterations. The input must not have the sign bit set.
+static inline float32_t plp_sqrt_vec_f32_elem(float32_t x) {
+
+    const float32_t threehalfs = 1.5f;
+    float32_t x2 = x * 0.5f;
+    float32_t y;
+
+    union {
+        float32_t f;
+        int32_t i;
+    } conv;
+
+    conv.f = x;
+    conv.i = 0x5f3759df - (conv.i >> 1); /* initial guess of 1/sqrt(x) */
+    y = conv.f;
+    y = y * (threehalfs - (x2 * y * y)); /* newton 1st iter */
+    y = y * (threehalfs - (x2 * y * y)); /* newton 2nd iter */
+
+    return x * y;
+}
+
+/**
+   @brief Square root of a 32-bit float vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_sqrt_vec_f32s_rv32im(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              float32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+
+    union {
+        float32_t f;
+        int32_t i;
+    } x, y;
+    int32_t mask;
+
+    // non-positive inputs are computed on the absolute value and masked to zero afterwards
+    for (i = 0; i < blockSize; i++) {
+        x.f = pSrc[i];
+        mask = -(int32_t)(x.i > 0);
+        x.i &= 0x7FFFFFFF;
+        y.f = plp_sqrt_vec_f32_elem(x.f);
+        y.i &= mask;
+        pDst[i] = y.f;
+    }
+}
+
+/**
+   @} end of sqrtKernels group
+*/
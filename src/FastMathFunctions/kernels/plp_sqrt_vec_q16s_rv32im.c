@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sqrt_vec_q16s_rv32im.c
+ * Description:  Square root of a q16 vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup sqrt
+*/
+
+/**
+   @addtogroup sqrtKernels
+   @{
+*/
+
+// Square root of a Q(fracBits) value. The input is normalized to [0.25, 1) with a shift of the
+// same parity as fracBits, its inverse square root is refined with three newton iterations in
+// Q2.30 and multiplied back onto the input. The result is rounded to Q(fracBits), non-positive
+// inputs return zero.
+static inline int16_t plp_sqrt_vec_q16_elem(int16_t x, uint32_t fracBits) {
+
+    uint32_t n, s, d, r, e;
+    int32_t shift;
+
+    if (x <= 0) {
+        return 0;
+    }
+
+    n = __builtin_clz(x);
+    s = n - ((n ^ fracBits) & 1);
+    d = (uint32_t)x << s;
+    r = 2290047081U - (uint32_t)(((uint64_t)1308598332U * d) >> 32);
+    for (int i = 0; i < 3; i++) {
+        e = (uint32_t)(((uint64_t)d * r) >> 32);
+        e = (uint32_t)(((uint64_t)e * r) >> 30);
+        r = (uint32_t)(((uint64_t)r * (0xC0000000U - e)) >> 31);
+    }
+
+    // sqrt(x) = d * r * 2^((fracBits - s) / 2 - 46) in Q(fracBits)
+    shift = 46 + ((int32_t)s - (int32_t)fracBits) / 2;
+    r = (uint32_t)((((uint64_t)d * r) + (1ULL << (shift - 1))) >> shift);
+
+    return (int16_t)((r > 0x7FFF) ? 0x7FFF : r);
+}
+
+/**
+   @brief Square root of a 16-bit fixed point vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  fracBits   number of fractional bits of the input and output values
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_sqrt_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t fracBits,
+                              int16_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = plp_sqrt_vec_q16_elem(pSrc[i], fracBits);
+    }
+}
+
+/**
+   @} end of sqrtKernels group
+*/
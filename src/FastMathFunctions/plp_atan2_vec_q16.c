@@ -0,0 +1,51 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_atan2_vec_q16.c
+ * Description:  Glue code for the arctangent of a q16 vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @brief Glue code for the arctangent of a 16-bit fixed point vector.
+   @param[in]  pSrcY      points to the vector of y coordinates
+   @param[in]  pSrcX      points to the vector of x coordinates
+   @param[in]  blockSize  number of samples in each vector
+   @param[out] pDst       points to the output vector, Q1.15 angles in [-0.5, 0.5]
+                          mapped to [-PI, PI]
+   @return     none
+*/
+
+void plp_atan2_vec_q16(const int16_t *__restrict__ pSrcY,
+                       const int16_t *__restrict__ pSrcX,
+                       uint32_t blockSize,
+                       int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_atan2_vec_q16s_rv32im(pSrcY, pSrcX, blockSize, pDst);
+    } else {
+        plp_atan2_vec_q16s_xpulpv2(pSrcY, pSrcX, blockSize, pDst);
+    }
+}
@@ -0,0 +1,60 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cordic_atan2_mag_q16_parallel.c
+ * Description:  Glue code for the parallel CORDIC phase and magnitude of a q16 complex vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @brief Glue code for parallel CORDIC phase and magnitude of a 16-bit fixed point vector.
+   @param[in]  pSrc       points to the complex input vector, real and imaginary parts interleaved
+   @param[in]  blockSize  number of complex samples
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pPhase     points to the output phases, Q1.15 angles in [-0.5, 0.5] mapped
+                          to [-PI, PI]
+   @param[out] pMag       points to the output magnitudes in the format of the input,
+                          saturated to 16 bits
+   @return     none
+*/
+
+void plp_cordic_atan2_mag_q16_parallel(const int16_t *__restrict__ pSrc,
+                                       uint32_t blockSize,
+                                       uint32_t nPE,
+                                       int16_t *__restrict__ pPhase,
+                                       int16_t *__restrict__ pMag) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_cordic_atan2_mag_instance_q16 args = { .pSrc = pSrc,
+                                                   .blockSize = blockSize,
+                                                   .nPE = nPE,
+                                                   .pPhase = pPhase,
+                                                   .pMag = pMag };
+        rt_team_fork(nPE, plp_cordic_atan2_mag_q16p_xpulpv2, (void *)&args);
+    }
+}
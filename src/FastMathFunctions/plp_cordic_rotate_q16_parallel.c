@@ -0,0 +1,58 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cordic_rotate_q16_parallel.c
+ * Description:  Glue code for the parallel CORDIC rotation of a q16 complex vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @brief Glue code for the parallel CORDIC rotation of a 16-bit fixed point vector.
+   @param[in]  pSrc       points to the complex input vector, real and imaginary parts interleaved
+   @param[in]  pAngle     points to the rotation angles, Q1.15 angles with 0.5 mapped to PI
+   @param[in]  blockSize  number of complex samples
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pDst       points to the complex output vector, saturated to 16 bits
+   @return     none
+*/
+
+void plp_cordic_rotate_q16_parallel(const int16_t *__restrict__ pSrc,
+                                    const int16_t *__restrict__ pAngle,
+                                    uint32_t blockSize,
+                                    uint32_t nPE,
+                                    int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_cordic_rotate_instance_q16 args = { .pSrc = pSrc,
+                                                .pAngle = pAngle,
+                                                .blockSize = blockSize,
+                                                .nPE = nPE,
+                                                .pDst = pDst };
+        rt_team_fork(nPE, plp_cordic_rotate_q16p_xpulpv2, (void *)&args);
+    }
+}
@@ -0,0 +1,58 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lut_interp_f32.c
+ * Description:  Glue code for the table interpolation on a f32 vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @brief Glue code for the table interpolation on a 32-bit float vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  pTable     points to the table, spread evenly over [xMin, xMax]
+   @param[in]  tableSize  number of entries of the table, at least 2
+   @param[in]  xMin       input of the first table entry
+   @param[in]  xMax       input of the last table entry, larger than xMin
+   @param[out] pDst       points to the output vector, inputs outside of [xMin, xMax]
+                          return the first or the last entry
+   @return     none
+*/
+
+void plp_lut_interp_f32(const float32_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        const float32_t *__restrict__ pTable,
+                        uint32_t tableSize,
+                        float32_t xMin,
+                        float32_t xMax,
+                        float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_lut_interp_f32s_xpulpv2(pSrc, blockSize, pTable, tableSize, xMin, xMax, pDst);
+    }
+}
@@ -0,0 +1,53 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lut_interp_q16.c
+ * Description:  Glue code for the table interpolation on a q16 vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @brief Glue code for the table interpolation on a 16-bit fixed point vector.
+   @param[in]  pSrc       points to the input vector in Q1.15
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  pTable     points to the table, spread evenly over the inputs [-1, 1), with
+                          the first entry at -1 and the last entry at 1
+   @param[in]  tableSize  number of entries of the table, in [2, 65536]
+   @param[out] pDst       points to the output vector
+   @return     none
+*/
+
+void plp_lut_interp_q16(const int16_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        const int16_t *__restrict__ pTable,
+                        uint32_t tableSize,
+                        int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_lut_interp_q16s_rv32im(pSrc, blockSize, pTable, tableSize, pDst);
+    } else {
+        plp_lut_interp_q16s_xpulpv2(pSrc, blockSize, pTable, tableSize, pDst);
+    }
+}
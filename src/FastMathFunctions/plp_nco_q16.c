@@ -0,0 +1,55 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_nco_q16.c
+ * Description:  Glue code for the numerically controlled oscillator with q16 output
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @brief Glue code for the numerically controlled oscillator with 16-bit fixed point output.
+   @param[in]  S          points to the instance initialized by plp_nco_init_q16
+   @param[in]  blockSize  number of complex samples to generate
+   @param[out] pDst       points to the output vector of 2 * blockSize values, as interleaved
+                          real (cosine) and imaginary (sine) parts in Q1.15
+   @return     none
+
+   @par Sample n of the output is exp(j * 2*PI * phase_n / 2^32), where the phase advances by
+   phaseInc for every sample and wraps around after a full turn. The phase after the last sample
+   is kept in S, such that consecutive calls produce a continuous signal. The output is in the
+   format of plp_cmplx_mult_cmplx_q16, so it can be mixed with a complex signal in Q1.15 with a
+   decimal point of 15.
+*/
+
+void plp_nco_q16(plp_nco_instance_q16 *S,
+                 uint32_t blockSize,
+                 int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_nco_q16s_rv32im(S, blockSize, pDst);
+    } else {
+        plp_nco_q16s_xpulpv2(S, blockSize, pDst);
+    }
+}
@@ -0,0 +1,56 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_poly_eval_q16.c
+ * Description:  Glue code for the polynomial evaluation on a q16 vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @brief Glue code for the polynomial evaluation on a 16-bit fixed point vector.
+   @param[in]  pSrc       points to the input vector in Q(fracBits)
+   @param[in]  blockSize  number of samples in each vector
+   @param[in]  pCoeffs    points to the order + 1 coefficients in Q(fracBits), the constant
+                          term first
+   @param[in]  order      order of the polynomial
+   @param[in]  fracBits   number of fractional bits of the input, the coefficients
+                          and the output
+   @param[out] pDst       points to the output vector, saturated
+   @return     none
+*/
+
+void plp_poly_eval_q16(const int16_t *__restrict__ pSrc,
+                       uint32_t blockSize,
+                       const int16_t *__restrict__ pCoeffs,
+                       uint32_t order,
+                       uint32_t fracBits,
+                       int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_poly_eval_q16s_rv32im(pSrc, blockSize, pCoeffs, order, fracBits, pDst);
+    } else {
+        plp_poly_eval_q16s_xpulpv2(pSrc, blockSize, pCoeffs, order, fracBits, pDst);
+    }
+}
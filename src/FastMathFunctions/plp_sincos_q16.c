@@ -0,0 +1,51 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sincos_q16.c
+ * Description:  Glue code for the sine and cosine of a q16 input
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @brief Glue code for the sine and cosine of a 16-bit fixed point value.
+   @param[in]  x     Q1.15 value in range [0, +0.9999], mapped to [0, 2*PI)
+   @param[out] pSin  sin(x) returned here
+   @param[out] pCos  cos(x) returned here
+   @return     none
+
+   @par The table index and the fractional part are shared by both results, which are identical to
+   the ones of plp_sin_q16 and plp_cos_q16.
+*/
+
+void plp_sincos_q16(int16_t x,
+                    int16_t *__restrict__ pSin,
+                    int16_t *__restrict__ pCos) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_sincos_q16s_rv32im(x, pSin, pCos);
+    } else {
+        plp_sincos_q16s_xpulpv2(x, pSin, pCos);
+    }
+}
@@ -58,7 +58,7 @@
 void plp_sqrt_f32(const float *__restrict__ pSrc, float *__restrict__ pRes) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
-        *pRes = 0.f;
+        plp_sqrt_f32s_rv32im(pSrc, pRes);
     } else {
         plp_sqrt_f32s_xpulpv2(pSrc, pRes);
     }
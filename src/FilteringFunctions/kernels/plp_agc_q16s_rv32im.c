@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_agc_q16s_rv32im.c
+ * Description:  Automatic gain control of 16-bit fixed-point streams for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// updates the envelope with the block peak and returns the new gain in Q8.8
+static inline int32_t agc_q16_gain(plp_agc_instance_q16 *S, int32_t peak) {
+
+    int32_t env = S->env;
+    int32_t d = peak - env;
+    int32_t gain;
+
+    env += (((d > 0) ? S->attack : S->release) * d) >> 15;
+    S->env = (int16_t)env;
+
+    gain = (env == 0) ? S->maxGain : (S->target << 8) / env;
+    return (gain < S->minGain) ? S->minGain : (gain > S->maxGain) ? S->maxGain : gain;
+}
+
+/**
+  @ingroup Agc
+ */
+
+/**
+  @defgroup AgcKernels Automatic Gain Control Kernels
+  @{
+ */
+
+/**
+  @brief Automatic gain control of a 16-bit fixed-point block kernel for RV32IM extension.
+  @param[in,out] S          points to the instance, initialized by plp_agc_init_q16
+  @param[in]     pSrc       points to the block of input samples in Q1.15
+  @param[in]     blockSize  number of input and output samples
+  @param[out]    pDst       points to the block of output samples in Q1.15, which may be pSrc
+  @return        none
+ */
+
+void plp_agc_q16s_rv32im(plp_agc_instance_q16 *S,
+                         const int16_t *pSrc,
+                         uint32_t blockSize,
+                         int16_t *pDst) {
+
+    int32_t peak = 0;
+    int32_t gNew, gain, step, y;
+    uint32_t i;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    for (i = 0; i < blockSize; i++) {
+        int32_t a = (pSrc[i] < 0) ? -pSrc[i] : pSrc[i];
+        peak = (a > peak) ? a : peak;
+    }
+    peak = (peak > 0x7FFF) ? 0x7FFF : peak;
+
+    // the gain in Q8.24 moves by step per sample from the last gain to the new one
+    gNew = agc_q16_gain(S, peak);
+    step = (gNew - S->gain) * 65536 / (int32_t)blockSize;
+    gain = S->gain * 65536;
+    S->gain = (int16_t)gNew;
+
+    for (i = 0; i < blockSize; i++) {
+        gain += step;
+        y = (pSrc[i] * (gain >> 16)) >> 8;
+        pDst[i] = (int16_t)((y > 0x7FFF) ? 0x7FFF : (y < -0x8000) ? -0x8000 : y);
+    }
+}
+
+/**
+  @} end of AgcKernels group
+ */
@@ -0,0 +1,160 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_autocorr_f32_xpulpv2.c
+ * Description:  Autocorrelation of 32-bit floating-point vectors for XPULPV2 extension
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static void autocorr_f32_lag_pair(const float32_t *pSrc,
+                                  uint32_t n,
+                                  uint32_t lag,
+                                  uint32_t start,
+                                  uint32_t end,
+                                  float32_t *pAcc);
+
+/**
+  @ingroup Autocorrelation
+ */
+
+/**
+  @addtogroup AutocorrelationKernels
+  @{
+ */
+
+/**
+  @brief Autocorrelation of a 32-bit floating-point vector for XPULPV2 extension.
+  @param[in]  pSrc      points to the input vector of n samples
+  @param[in]  n         number of input samples
+  @param[in]  maxLag    largest lag to compute
+  @param[out] pDst      points to the maxLag+1 output values
+  @return     none
+
+  @par Two neighbouring lags are computed at a time, such that every loaded sample is used by both
+  lags.
+ */
+
+void plp_autocorr_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                               uint32_t n,
+                               uint32_t maxLag,
+                               float32_t *__restrict__ pDst) {
+
+    float32_t acc[2];
+    uint32_t l;
+
+    for (l = 0; l <= maxLag; l += 2) {
+        autocorr_f32_lag_pair(pSrc, n, l, 0, n, acc);
+        pDst[l] = acc[0];
+        if (l < maxLag) {
+            pDst[l + 1] = acc[1];
+        }
+    }
+}
+
+/**
+  @brief Parallel autocorrelation of a 32-bit floating-point vector for XPULPV2 extension.
+  @param[in]  args  pointer to plp_autocorr_instance_f32 struct initialized by
+                    plp_autocorr_f32_parallel
+  @return     none
+
+  @par Every core computes the partial sums of all lags over a contiguous chunk of samples, as in
+  plp_autocorr_f32s_xpulpv2. After a barrier, the partial sums of the cores are added up, where
+  every core reduces a chunk of the lags.
+ */
+
+void plp_autocorr_f32p_xpulpv2(void *args) {
+
+    plp_autocorr_instance_f32 *a = (plp_autocorr_instance_f32 *)args;
+
+    uint32_t nPE = a->nPE;
+    uint32_t numLags = a->maxLag + 1;
+    uint32_t coreId = rt_core_id();
+    float32_t *pPartial = a->pPartial + coreId * numLags;
+    float32_t acc[2];
+    uint32_t start, end, l, c;
+
+    plp_team_chunk(a->n, nPE, coreId, 1, &start, &end);
+
+    for (l = 0; l < numLags; l += 2) {
+        autocorr_f32_lag_pair(a->pSrc, a->n, l, start, end, acc);
+        pPartial[l] = acc[0];
+        if (l + 1 < numLags) {
+            pPartial[l + 1] = acc[1];
+        }
+    }
+
+    plp_team_barrier();
+
+    plp_team_chunk(numLags, nPE, coreId, 1, &start, &end);
+
+    for (l = start; l < end; l++) {
+        float32_t sum = 0;
+        for (c = 0; c < nPE; c++) {
+            sum += a->pPartial[c * numLags + l];
+        }
+        a->pDst[l] = sum;
+    }
+}
+
+/**
+  @} end of AutocorrelationKernels group
+ */
+
+// sums of x[i] * x[i + lag] and x[i] * x[i + lag + 1] over start <= i < end, both loaded samples
+// of the shifted signal are used by the two lags
+static void autocorr_f32_lag_pair(const float32_t *pSrc,
+                                  uint32_t n,
+                                  uint32_t lag,
+                                  uint32_t start,
+                                  uint32_t end,
+                                  float32_t *pAcc) {
+
+    const float32_t *pLag = pSrc + lag;
+    uint32_t stop0 = (lag < n) ? MIN(end, n - lag) : 0;
+    uint32_t stop1 = (lag + 1 < n) ? MIN(end, n - lag - 1) : 0;
+    float32_t acc0 = 0;
+    float32_t acc1 = 0;
+    uint32_t i = start;
+
+    if (i < stop1) {
+        float32_t y0 = pLag[i];
+        for (; i < stop1; i++) {
+            float32_t x = pSrc[i];
+            float32_t y1 = pLag[i + 1];
+            acc0 += x * y0;
+            acc1 += x * y1;
+            y0 = y1;
+        }
+    }
+
+    for (; i < stop0; i++) {
+        acc0 += pSrc[i] * pLag[i];
+    }
+
+    pAcc[0] = acc0;
+    pAcc[1] = acc1;
+}
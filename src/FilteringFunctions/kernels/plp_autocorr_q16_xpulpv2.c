@@ -0,0 +1,183 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_autocorr_q16_xpulpv2.c
+ * Description:  Autocorrelation of 16-bit fixed-point vectors for XPULPV2 extension
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static uint32_t autocorr_q16_block_len(const int16_t *pSrc, uint32_t start, uint32_t end);
+
+static int64_t autocorr_q16_lag(const int16_t *pSrc,
+                                uint32_t lag,
+                                uint32_t start,
+                                uint32_t end,
+                                uint32_t blockLen);
+
+// x * 2^-fracBits, rounded and saturated to 32 bits
+static inline int32_t saturate_q32(int64_t x, uint32_t fracBits) {
+    if (fracBits > 0) {
+        x = (x + ((int64_t)1 << (fracBits - 1))) >> fracBits;
+    }
+    return (int32_t)((x > 0x7FFFFFFF) ? 0x7FFFFFFF : ((x < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : x));
+}
+
+/**
+  @ingroup Autocorrelation
+ */
+
+/**
+  @addtogroup AutocorrelationKernels
+  @{
+ */
+
+/**
+  @brief Autocorrelation of a 16-bit fixed-point vector for XPULPV2 extension.
+  @param[in]  pSrc      points to the input vector of n samples
+  @param[in]  n         number of input samples
+  @param[in]  maxLag    largest lag to compute
+  @param[in]  fracBits  number of fractional bits removed from the sums
+  @param[out] pDst      points to the maxLag+1 output values
+  @return     none
+
+  @par Every lag is a SIMD dot product of the signal with itself, shifted by the lag. The sums of
+  blocks of samples are accumulated in 32 bits and added up in 64 bits. The block length is
+  derived from the peak magnitude of the signal, such that a block cannot overflow.
+ */
+
+void plp_autocorr_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                               uint32_t n,
+                               uint32_t maxLag,
+                               uint32_t fracBits,
+                               int32_t *__restrict__ pDst) {
+
+    uint32_t blockLen = autocorr_q16_block_len(pSrc, 0, n);
+    uint32_t l;
+
+    for (l = 0; l <= maxLag; l++) {
+        int64_t acc = (l < n) ? autocorr_q16_lag(pSrc, l, 0, n - l, blockLen) : 0;
+        pDst[l] = saturate_q32(acc, fracBits);
+    }
+}
+
+/**
+  @brief Parallel autocorrelation of a 16-bit fixed-point vector for XPULPV2 extension.
+  @param[in]  args  pointer to plp_autocorr_instance_q16 struct initialized by
+                    plp_autocorr_q16_parallel
+  @return     none
+
+  @par Every core computes the partial sums of all lags over a contiguous chunk of an even number
+  of samples, as in plp_autocorr_q16s_xpulpv2. After a barrier, the partial sums of the cores are
+  added up, where every core reduces a chunk of the lags.
+ */
+
+void plp_autocorr_q16p_xpulpv2(void *args) {
+
+    plp_autocorr_instance_q16 *a = (plp_autocorr_instance_q16 *)args;
+
+    const int16_t *pSrc = a->pSrc;
+    uint32_t n = a->n;
+    uint32_t nPE = a->nPE;
+    uint32_t numLags = a->maxLag + 1;
+    uint32_t coreId = rt_core_id();
+    int64_t *pPartial = a->pPartial;
+    uint32_t start, end, blockLen, l, c;
+
+    plp_team_chunk(n, nPE, coreId, 2, &start, &end);
+
+    // the products of the chunk touch the samples up to end + maxLag
+    blockLen = autocorr_q16_block_len(pSrc, start, MIN(end + a->maxLag, n));
+
+    for (l = 0; l < numLags; l++) {
+        uint32_t stop = (l < n) ? MIN(end, n - l) : 0;
+        pPartial[coreId * numLags + l] =
+            (start < stop) ? autocorr_q16_lag(pSrc, l, start, stop, blockLen) : 0;
+    }
+
+    plp_team_barrier();
+
+    plp_team_chunk(numLags, nPE, coreId, 1, &start, &end);
+
+    for (l = start; l < end; l++) {
+        int64_t sum = 0;
+        for (c = 0; c < nPE; c++) {
+            sum += pPartial[c * numLags + l];
+        }
+        a->pDst[l] = saturate_q32(sum, a->fracBits);
+    }
+}
+
+/**
+  @} end of AutocorrelationKernels group
+ */
+
+// largest even number of products bounded by the peak of the samples that fit into 32 bits,
+// 0 if the peak is -32768
+static uint32_t autocorr_q16_block_len(const int16_t *pSrc, uint32_t start, uint32_t end) {
+
+    uint32_t i;
+    uint32_t peak = 0;
+
+    for (i = start; i < end; i++) {
+        uint32_t m = (pSrc[i] < 0) ? -pSrc[i] : pSrc[i];
+        peak = (m > peak) ? m : peak;
+    }
+
+    return (peak == 0) ? 0xFFFFFFFE : (0x7FFFFFFF / (peak * peak)) & ~1;
+}
+
+// sum of x[i] * x[i + lag] over start <= i < end, where start is even
+static int64_t autocorr_q16_lag(const int16_t *pSrc,
+                                uint32_t lag,
+                                uint32_t start,
+                                uint32_t end,
+                                uint32_t blockLen) {
+
+    const int16_t *pLag = pSrc + lag;
+    int64_t acc = 0;
+    uint32_t i = start;
+    uint32_t j;
+
+    if (blockLen > 0) {
+        while (i + 1 < end) {
+            uint32_t blockEnd = (end - i > blockLen) ? i + blockLen : end;
+            int32_t sum = 0;
+            for (j = i; j + 1 < blockEnd; j += 2) {
+                sum = __SUMDOTP2(*((v2s *)&pSrc[j]), *((v2s *)&pLag[j]), sum);
+            }
+            acc += sum;
+            i = j;
+        }
+    }
+
+    // odd tail, or all products if the peak is -32768
+    for (; i < end; i++) {
+        acc += (int32_t)pSrc[i] * pLag[i];
+    }
+
+    return acc;
+}
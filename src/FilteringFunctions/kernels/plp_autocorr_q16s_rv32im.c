@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_autocorr_q16s_rv32im.c
+ * Description:  Autocorrelation of 16-bit fixed-point vectors for RV32IM extension
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// x * 2^-fracBits, rounded and saturated to 32 bits
+static inline int32_t saturate_q32(int64_t x, uint32_t fracBits) {
+    if (fracBits > 0) {
+        x = (x + ((int64_t)1 << (fracBits - 1))) >> fracBits;
+    }
+    return (int32_t)((x > 0x7FFFFFFF) ? 0x7FFFFFFF : ((x < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : x));
+}
+
+/**
+  @ingroup Autocorrelation
+ */
+
+/**
+  @defgroup AutocorrelationKernels Autocorrelation Kernels
+  This module contains the kernel code for the autocorrelation.
+ */
+
+/**
+  @addtogroup AutocorrelationKernels
+  @{
+ */
+
+/**
+  @brief Autocorrelation of a 16-bit fixed-point vector for RV32IM extension.
+  @param[in]  pSrc      points to the input vector of n samples
+  @param[in]  n         number of input samples
+  @param[in]  maxLag    largest lag to compute
+  @param[in]  fracBits  number of fractional bits removed from the sums
+  @param[out] pDst      points to the maxLag+1 output values
+  @return     none
+ */
+
+void plp_autocorr_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                              uint32_t n,
+                              uint32_t maxLag,
+                              uint32_t fracBits,
+                              int32_t *__restrict__ pDst) {
+
+    uint32_t i, l;
+
+    for (l = 0; l <= maxLag; l++) {
+        int64_t acc = 0;
+        for (i = 0; i + l < n; i++) {
+            acc += (int32_t)pSrc[i] * pSrc[i + l];
+        }
+        pDst[l] = saturate_q32(acc, fracBits);
+    }
+}
+
+/**
+  @} end of AutocorrelationKernels group
+ */
@@ -0,0 +1,169 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_autocorr_q32_xpulpv2.c
+ * Description:  Autocorrelation of 32-bit fixed-point vectors for XPULPV2 extension
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static void autocorr_q32_lag_pair(const int32_t *pSrc,
+                                  uint32_t n,
+                                  uint32_t lag,
+                                  uint32_t start,
+                                  uint32_t end,
+                                  uint32_t fracBits,
+                                  int64_t *pAcc);
+
+// x saturated to 32 bits
+static inline int32_t saturate_q32(int64_t x) {
+    return (int32_t)((x > 0x7FFFFFFF) ? 0x7FFFFFFF : ((x < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : x));
+}
+
+/**
+  @ingroup Autocorrelation
+ */
+
+/**
+  @addtogroup AutocorrelationKernels
+  @{
+ */
+
+/**
+  @brief Autocorrelation of a 32-bit fixed-point vector for XPULPV2 extension.
+  @param[in]  pSrc      points to the input vector of n samples
+  @param[in]  n         number of input samples
+  @param[in]  maxLag    largest lag to compute
+  @param[in]  fracBits  number of fractional bits removed from every product
+  @param[out] pDst      points to the maxLag+1 output values
+  @return     none
+
+  @par Two neighbouring lags are computed at a time, such that every loaded sample is used by both
+  lags. Every product is shifted to the right by fracBits before it is summed up in 64 bits.
+ */
+
+void plp_autocorr_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                               uint32_t n,
+                               uint32_t maxLag,
+                               uint32_t fracBits,
+                               int32_t *__restrict__ pDst) {
+
+    int64_t acc[2];
+    uint32_t l;
+
+    for (l = 0; l <= maxLag; l += 2) {
+        autocorr_q32_lag_pair(pSrc, n, l, 0, n, fracBits, acc);
+        pDst[l] = saturate_q32(acc[0]);
+        if (l < maxLag) {
+            pDst[l + 1] = saturate_q32(acc[1]);
+        }
+    }
+}
+
+/**
+  @brief Parallel autocorrelation of a 32-bit fixed-point vector for XPULPV2 extension.
+  @param[in]  args  pointer to plp_autocorr_instance_q32 struct initialized by
+                    plp_autocorr_q32_parallel
+  @return     none
+
+  @par Every core computes the partial sums of all lags over a contiguous chunk of samples, as in
+  plp_autocorr_q32s_xpulpv2. After a barrier, the partial sums of the cores are added up, where
+  every core reduces a chunk of the lags.
+ */
+
+void plp_autocorr_q32p_xpulpv2(void *args) {
+
+    plp_autocorr_instance_q32 *a = (plp_autocorr_instance_q32 *)args;
+
+    uint32_t nPE = a->nPE;
+    uint32_t numLags = a->maxLag + 1;
+    uint32_t coreId = rt_core_id();
+    int64_t *pPartial = a->pPartial + coreId * numLags;
+    int64_t acc[2];
+    uint32_t start, end, l, c;
+
+    plp_team_chunk(a->n, nPE, coreId, 1, &start, &end);
+
+    for (l = 0; l < numLags; l += 2) {
+        autocorr_q32_lag_pair(a->pSrc, a->n, l, start, end, a->fracBits, acc);
+        pPartial[l] = acc[0];
+        if (l + 1 < numLags) {
+            pPartial[l + 1] = acc[1];
+        }
+    }
+
+    plp_team_barrier();
+
+    plp_team_chunk(numLags, nPE, coreId, 1, &start, &end);
+
+    for (l = start; l < end; l++) {
+        int64_t sum = 0;
+        for (c = 0; c < nPE; c++) {
+            sum += a->pPartial[c * numLags + l];
+        }
+        a->pDst[l] = saturate_q32(sum);
+    }
+}
+
+/**
+  @} end of AutocorrelationKernels group
+ */
+
+// sums of x[i] * x[i + lag] and x[i] * x[i + lag + 1] over start <= i < end, both loaded samples
+// of the shifted signal are used by the two lags
+static void autocorr_q32_lag_pair(const int32_t *pSrc,
+                                  uint32_t n,
+                                  uint32_t lag,
+                                  uint32_t start,
+                                  uint32_t end,
+                                  uint32_t fracBits,
+                                  int64_t *pAcc) {
+
+    const int32_t *pLag = pSrc + lag;
+    uint32_t stop0 = (lag < n) ? MIN(end, n - lag) : 0;
+    uint32_t stop1 = (lag + 1 < n) ? MIN(end, n - lag - 1) : 0;
+    int64_t acc0 = 0;
+    int64_t acc1 = 0;
+    uint32_t i = start;
+
+    if (i < stop1) {
+        int32_t y0 = pLag[i];
+        for (; i < stop1; i++) {
+            int32_t x = pSrc[i];
+            int32_t y1 = pLag[i + 1];
+            acc0 += ((int64_t)x * y0) >> fracBits;
+            acc1 += ((int64_t)x * y1) >> fracBits;
+            y0 = y1;
+        }
+    }
+
+    for (; i < stop0; i++) {
+        acc0 += ((int64_t)pSrc[i] * pLag[i]) >> fracBits;
+    }
+
+    pAcc[0] = acc0;
+    pAcc[1] = acc1;
+}
@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point biquad cascade direct form I for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BiquadCascade
+ */
+
+/**
+  @addtogroup BiquadCascadeKernels
+  @{
+ */
+
+/**
+  @brief 16-bit fixed-point biquad cascade filtering in direct form I kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_biquad_cascade_df1_init_q16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input and output samples
+  @param[out] pDst       points to the block of output samples, which may be equal to pSrc
+  @return     none
+
+  @par The feedforward and feedback pairs are computed with one dot product each, using the word
+  aligned coefficient pairs {b1, b2} and {a1, a2}.
+ */
+
+void plp_biquad_cascade_df1_q16s_xpulpv2(const plp_biquad_cascade_df1_instance_q16 *S,
+                                         const int16_t *pSrc,
+                                         uint32_t blockSize,
+                                         int16_t *pDst) {
+
+    uint32_t stage, i;
+    uint32_t shift = 15 - S->postShift;
+    const int16_t *pCoeffs = S->pCoeffs;
+    int16_t *pState = S->pState;
+    const int16_t *pIn = pSrc;
+
+    // filter the entire block with one stage, before moving to the next stage
+    for (stage = 0; stage < S->numStages; stage++) {
+        int16_t b0 = pCoeffs[0];
+        v2s b12 = *((v2s *)&pCoeffs[2]);
+        v2s a12 = *((v2s *)&pCoeffs[4]);
+        int16_t x1 = pState[0];
+        int16_t x2 = pState[1];
+        int16_t y1 = pState[2];
+        int16_t y2 = pState[3];
+
+        for (i = 0; i < blockSize; i++) {
+            int16_t x = pIn[i];
+            int32_t acc = b0 * x;
+            acc = __SUMDOTP2(__PACK2(x1, x2), b12, acc);
+            acc = __SUMDOTP2(__PACK2(y1, y2), a12, acc);
+            int16_t y = (int16_t)__CLIP(__ROUNDNORM_REG(acc, shift), 15);
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            pDst[i] = y;
+        }
+
+        pState[0] = x1;
+        pState[1] = x2;
+        pState[2] = y1;
+        pState[3] = y2;
+
+        pCoeffs += 6;
+        pState += 4;
+        pIn = pDst;
+    }
+}
+
+/**
+  @} end of BiquadCascadeKernels group
+ */
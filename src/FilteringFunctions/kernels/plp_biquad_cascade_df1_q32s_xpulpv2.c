@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q32s_xpulpv2.c
+ * Description:  32-bit fixed-point biquad cascade direct form I for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// sum * 2^-shift, rounded and saturated to 32 bits
+static inline int32_t saturate_q32(int64_t sum, uint32_t shift) {
+    int64_t val = (sum + (((int64_t)1 << shift) >> 1)) >> shift;
+    if (val > 0x7FFFFFFFLL) {
+        val = 0x7FFFFFFFLL;
+    } else if (val < -0x80000000LL) {
+        val = -0x80000000LL;
+    }
+    return (int32_t)val;
+}
+
+/**
+  @ingroup BiquadCascade
+ */
+
+/**
+  @addtogroup BiquadCascadeKernels
+  @{
+ */
+
+/**
+  @brief 32-bit fixed-point biquad cascade filtering in direct form I kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_biquad_cascade_df1_init_q32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input and output samples
+  @param[out] pDst       points to the block of output samples, which may be equal to pSrc
+  @return     none
+ */
+
+void plp_biquad_cascade_df1_q32s_xpulpv2(const plp_biquad_cascade_df1_instance_q32 *S,
+                                         const int32_t *pSrc,
+                                         uint32_t blockSize,
+                                         int32_t *pDst) {
+
+    uint32_t stage, i;
+    uint32_t shift = 31 - S->postShift;
+    const int32_t *pCoeffs = S->pCoeffs;
+    int32_t *pState = S->pState;
+    const int32_t *pIn = pSrc;
+
+    // filter the entire block with one stage, before moving to the next stage
+    for (stage = 0; stage < S->numStages; stage++) {
+        int32_t b0 = pCoeffs[0];
+        int32_t b1 = pCoeffs[1];
+        int32_t b2 = pCoeffs[2];
+        int32_t a1 = pCoeffs[3];
+        int32_t a2 = pCoeffs[4];
+        int32_t x1 = pState[0];
+        int32_t x2 = pState[1];
+        int32_t y1 = pState[2];
+        int32_t y2 = pState[3];
+
+        for (i = 0; i < blockSize; i++) {
+            int32_t x = pIn[i];
+            int64_t acc = (int64_t)b0 * x;
+            acc += (int64_t)b1 * x1;
+            acc += (int64_t)b2 * x2;
+            acc += (int64_t)a1 * y1;
+            acc += (int64_t)a2 * y2;
+            int32_t y = saturate_q32(acc, shift);
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            pDst[i] = y;
+        }
+
+        pState[0] = x1;
+        pState[1] = x2;
+        pState[2] = y1;
+        pState[3] = y2;
+
+        pCoeffs += 5;
+        pState += 4;
+        pIn = pDst;
+    }
+}
+
+/**
+  @} end of BiquadCascadeKernels group
+ */
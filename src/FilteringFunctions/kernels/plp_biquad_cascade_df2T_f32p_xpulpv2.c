@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df2T_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point biquad cascade transposed direct form II for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BiquadCascade
+ */
+
+/**
+  @addtogroup BiquadCascadeKernels
+  @{
+ */
+
+/**
+  @brief Parallel multi-channel 32-bit floating-point biquad cascade filtering in transposed direct
+         form II kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_biquad_cascade_df2T_instance_f32_parallel struct initialized by
+                    plp_biquad_cascade_df2T_f32_parallel
+  @return     none
+
+  @par Core k filters the channels k, k+nPE, k+2*nPE, ... with plp_biquad_cascade_df2T_f32s_xpulpv2.
+  The channels are independent, hence no synchronization is needed.
+ */
+
+void plp_biquad_cascade_df2T_f32p_xpulpv2(void *args) {
+
+    plp_biquad_cascade_df2T_instance_f32_parallel *a =
+        (plp_biquad_cascade_df2T_instance_f32_parallel *)args;
+
+    uint32_t blockSize = a->blockSize;
+    uint32_t c;
+
+    for (c = rt_core_id(); c < a->nChannels; c += a->nPE) {
+        plp_biquad_cascade_df2T_f32s_xpulpv2(&a->S[c], &a->pSrc[c * blockSize], blockSize,
+                                              &a->pDst[c * blockSize]);
+    }
+}
+
+/**
+  @} end of BiquadCascadeKernels group
+ */
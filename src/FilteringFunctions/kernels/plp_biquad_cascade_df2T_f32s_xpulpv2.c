@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df2T_f32s_xpulpv2.c
+ * Description:  32-bit floating-point biquad cascade transposed direct form II for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BiquadCascade
+ */
+
+/**
+  @addtogroup BiquadCascadeKernels
+  @{
+ */
+
+/**
+  @brief 32-bit floating-point biquad cascade filtering in transposed direct form II kernel for
+         XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_biquad_cascade_df2T_init_f32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input and output samples
+  @param[out] pDst       points to the block of output samples, which may be equal to pSrc
+  @return     none
+ */
+
+void plp_biquad_cascade_df2T_f32s_xpulpv2(const plp_biquad_cascade_df2T_instance_f32 *S,
+                                          const float32_t *pSrc,
+                                          uint32_t blockSize,
+                                          float32_t *pDst) {
+
+    uint32_t stage, i;
+    const float32_t *pCoeffs = S->pCoeffs;
+    float32_t *pState = S->pState;
+    const float32_t *pIn = pSrc;
+
+    // filter the entire block with one stage, before moving to the next stage
+    for (stage = 0; stage < S->numStages; stage++) {
+        float32_t b0 = pCoeffs[0];
+        float32_t b1 = pCoeffs[1];
+        float32_t b2 = pCoeffs[2];
+        float32_t a1 = pCoeffs[3];
+        float32_t a2 = pCoeffs[4];
+        float32_t d1 = pState[0];
+        float32_t d2 = pState[1];
+
+        for (i = 0; i < blockSize; i++) {
+            float32_t x = pIn[i];
+            float32_t y = b0 * x + d1;
+            d1 = b1 * x + a1 * y + d2;
+            d2 = b2 * x + a2 * y;
+            pDst[i] = y;
+        }
+
+        pState[0] = d1;
+        pState[1] = d2;
+
+        pCoeffs += 5;
+        pState += 2;
+        pIn = pDst;
+    }
+}
+
+/**
+  @} end of BiquadCascadeKernels group
+ */
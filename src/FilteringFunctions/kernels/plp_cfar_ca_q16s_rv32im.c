@@ -0,0 +1,224 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfar_ca_q16s_rv32im.c
+ * Description:  16-bit fixed-point cell-averaging CFAR kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// number of cells of the window [i - r, i + r] inside [0, n)
+static inline int32_t cfar_ca_q16_span(int32_t i, int32_t r, int32_t n) {
+
+    int32_t lo = (i < r) ? 0 : i - r;
+    int32_t hi = (i + r >= n) ? n - 1 : i + r;
+
+    return hi - lo + 1;
+}
+
+// slides the sums of the outer and the guard window along the row from column j-1 to column j
+static inline void cfar_ca_q16_step(const int32_t *pOuter,
+                                    const int32_t *pGuard,
+                                    int32_t j,
+                                    int32_t oC,
+                                    int32_t gC,
+                                    int32_t numCols,
+                                    int32_t *pSumO,
+                                    int32_t *pSumG) {
+
+    if (j + oC < numCols) {
+        *pSumO += pOuter[j + oC];
+    }
+    if (j > oC) {
+        *pSumO -= pOuter[j - 1 - oC];
+    }
+    if (j + gC < numCols) {
+        *pSumG += pGuard[j + gC];
+    }
+    if (j > gC) {
+        *pSumG -= pGuard[j - 1 - gC];
+    }
+}
+
+// sets the bit of cell j if x exceeds alpha times the mean of the n training cells, with their sum
+static inline void cfar_ca_q16_detect(int16_t x,
+                                      int32_t n,
+                                      int32_t sum,
+                                      int64_t alpha,
+                                      int32_t j,
+                                      uint32_t *pMaskRow) {
+
+    if (n > 0 && (int64_t)x * n * 256 > alpha * sum) {
+        pMaskRow[j >> 5] |= 1U << (j & 31);
+    }
+}
+
+// column sums of the outer and the guard window of the first row, which include the rows of the
+// neighbouring chunks
+static void cfar_ca_q16_init(const int16_t *pSrc,
+                             int32_t numRows,
+                             int32_t numCols,
+                             int32_t row,
+                             int32_t oR,
+                             int32_t gR,
+                             int32_t *pOuter,
+                             int32_t *pGuard) {
+
+    int32_t r, j;
+
+    for (j = 0; j < numCols; j++) {
+        pOuter[j] = 0;
+        pGuard[j] = 0;
+    }
+
+    for (r = (row < oR) ? 0 : row - oR; r <= row + oR && r < numRows; r++) {
+        const int16_t *pRow = &pSrc[r * numCols];
+        for (j = 0; j < numCols; j++) {
+            pOuter[j] += pRow[j];
+        }
+        if (r >= row - gR && r <= row + gR) {
+            for (j = 0; j < numCols; j++) {
+                pGuard[j] += pRow[j];
+            }
+        }
+    }
+}
+
+// moves the column sums down by one row, row rOut leaving and row rIn entering the window
+static void cfar_ca_q16_slide(const int16_t *pSrc,
+                              int32_t numRows,
+                              int32_t numCols,
+                              int32_t rOut,
+                              int32_t rIn,
+                              int32_t *pSum) {
+
+    int32_t j;
+
+    if (rOut >= 0) {
+        const int16_t *pOut = &pSrc[rOut * numCols];
+        for (j = 0; j < numCols; j++) {
+            pSum[j] -= pOut[j];
+        }
+    }
+    if (rIn < numRows) {
+        const int16_t *pIn = &pSrc[rIn * numCols];
+        for (j = 0; j < numCols; j++) {
+            pSum[j] += pIn[j];
+        }
+    }
+}
+
+// detection of the rows [rowStart, rowEnd), with the column sums in pTmp
+static void cfar_ca_q16_rows(const plp_cfar_ca_instance_q16 *S,
+                             const int16_t *pSrc,
+                             int32_t numRows,
+                             int32_t numCols,
+                             int32_t rowStart,
+                             int32_t rowEnd,
+                             int32_t *pTmp,
+                             uint32_t *pMask) {
+
+    int32_t gR = S->guardRows;
+    int32_t gC = S->guardCols;
+    int32_t oR = gR + S->trainRows;
+    int32_t oC = gC + S->trainCols;
+    int64_t alpha = S->alpha;
+    int32_t maskWords = (numCols + 31) >> 5;
+    int32_t *pOuter = pTmp;
+    int32_t *pGuard = &pTmp[numCols];
+    int32_t i, j;
+
+    if (rowStart >= rowEnd) {
+        return;
+    }
+
+    cfar_ca_q16_init(pSrc, numRows, numCols, rowStart, oR, gR, pOuter, pGuard);
+
+    for (i = rowStart; i < rowEnd; i++) {
+        const int16_t *pRow = &pSrc[i * numCols];
+        uint32_t *pMaskRow = &pMask[i * maskWords];
+        int32_t nR = cfar_ca_q16_span(i, oR, numRows);
+        int32_t nG = cfar_ca_q16_span(i, gR, numRows);
+        int32_t sumO = 0;
+        int32_t sumG = 0;
+
+        if (i > rowStart) {
+            cfar_ca_q16_slide(pSrc, numRows, numCols, i - 1 - oR, i + oR, pOuter);
+            cfar_ca_q16_slide(pSrc, numRows, numCols, i - 1 - gR, i + gR, pGuard);
+        }
+
+        for (j = 0; j < maskWords; j++) {
+            pMaskRow[j] = 0;
+        }
+
+        // sums of the windows of column 0, the step of column 0 adds their last column
+        for (j = 0; j < oC && j < numCols; j++) {
+            sumO += pOuter[j];
+        }
+        for (j = 0; j < gC && j < numCols; j++) {
+            sumG += pGuard[j];
+        }
+
+        for (j = 0; j < numCols; j++) {
+            int32_t n = nR * cfar_ca_q16_span(j, oC, numCols) -
+                        nG * cfar_ca_q16_span(j, gC, numCols);
+            cfar_ca_q16_step(pOuter, pGuard, j, oC, gC, numCols, &sumO, &sumG);
+            cfar_ca_q16_detect(pRow[j], n, sumO - sumG, alpha, j, pMaskRow);
+        }
+    }
+}
+
+/**
+  @ingroup CFAR
+ */
+
+/**
+  @defgroup CFARKernels Constant False Alarm Rate Detector Kernels
+  @{
+ */
+
+/**
+  @brief Cell-averaging CFAR of a 16-bit fixed-point power map kernel for RV32IM extension.
+  @param[in]  S        points to the instance, initialized by plp_cfar_ca_init_q16
+  @param[in]  pSrc     points to the power map of numRows x numCols cells, stored row by row
+  @param[in]  numRows  number of rows of the map
+  @param[in]  numCols  number of columns of the map
+  @param[out] pMask    points to the detection mask of numRows*((numCols+31)/32) words
+  @return     none
+
+  @par The column sums are updated row by row, and the row sums column by column.
+ */
+
+void plp_cfar_ca_q16s_rv32im(const plp_cfar_ca_instance_q16 *S,
+                             const int16_t *__restrict__ pSrc,
+                             uint32_t numRows,
+                             uint32_t numCols,
+                             uint32_t *__restrict__ pMask) {
+
+    cfar_ca_q16_rows(S, pSrc, numRows, numCols, 0, numRows, S->pTmp, pMask);
+}
+
+/**
+  @} end of CFARKernels group
+ */
@@ -0,0 +1,271 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfar_ca_q32_xpulpv2.c
+ * Description:  32-bit fixed-point cell-averaging CFAR kernels for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// number of cells of the window [i - r, i + r] inside [0, n)
+static inline int32_t cfar_ca_q32_span(int32_t i, int32_t r, int32_t n) {
+
+    int32_t lo = (i < r) ? 0 : i - r;
+    int32_t hi = (i + r >= n) ? n - 1 : i + r;
+
+    return hi - lo + 1;
+}
+
+// slides the sums of the outer and the guard window along the row from column j-1 to column j
+static inline void cfar_ca_q32_step(const int64_t *pOuter,
+                                    const int64_t *pGuard,
+                                    int32_t j,
+                                    int32_t oC,
+                                    int32_t gC,
+                                    int32_t numCols,
+                                    int64_t *pSumO,
+                                    int64_t *pSumG) {
+
+    if (j + oC < numCols) {
+        *pSumO += pOuter[j + oC];
+    }
+    if (j > oC) {
+        *pSumO -= pOuter[j - 1 - oC];
+    }
+    if (j + gC < numCols) {
+        *pSumG += pGuard[j + gC];
+    }
+    if (j > gC) {
+        *pSumG -= pGuard[j - 1 - gC];
+    }
+}
+
+// sets the bit of cell j if x exceeds alpha times the mean of the n training cells, with their sum
+static inline void cfar_ca_q32_detect(int32_t x,
+                                      int32_t n,
+                                      int64_t sum,
+                                      int64_t alpha,
+                                      int32_t j,
+                                      uint32_t *pMaskRow) {
+
+    if (n > 0 && (int64_t)x * n * 256 > alpha * sum) {
+        pMaskRow[j >> 5] |= 1U << (j & 31);
+    }
+}
+
+// column sums of the outer and the guard window of the first row, which include the rows of the
+// neighbouring chunks
+static void cfar_ca_q32_init(const int32_t *pSrc,
+                             int32_t numRows,
+                             int32_t numCols,
+                             int32_t row,
+                             int32_t oR,
+                             int32_t gR,
+                             int64_t *pOuter,
+                             int64_t *pGuard) {
+
+    int32_t r, j;
+
+    for (j = 0; j < numCols; j++) {
+        pOuter[j] = 0;
+        pGuard[j] = 0;
+    }
+
+    for (r = (row < oR) ? 0 : row - oR; r <= row + oR && r < numRows; r++) {
+        const int32_t *pRow = &pSrc[r * numCols];
+        for (j = 0; j < numCols; j++) {
+            pOuter[j] += pRow[j];
+        }
+        if (r >= row - gR && r <= row + gR) {
+            for (j = 0; j < numCols; j++) {
+                pGuard[j] += pRow[j];
+            }
+        }
+    }
+}
+
+// moves the column sums down by one row, row rOut leaving and row rIn entering the window. Inside
+// the map, both rows are handled in a single loop.
+static void cfar_ca_q32_slide(const int32_t *pSrc,
+                              int32_t numRows,
+                              int32_t numCols,
+                              int32_t rOut,
+                              int32_t rIn,
+                              int64_t *pSum) {
+
+    int32_t j;
+
+    if (rOut >= 0 && rIn < numRows) {
+        const int32_t *pOut = &pSrc[rOut * numCols];
+        const int32_t *pIn = &pSrc[rIn * numCols];
+        for (j = 0; j < numCols; j++) {
+            pSum[j] += (int64_t)pIn[j] - pOut[j];
+        }
+    } else if (rOut >= 0) {
+        const int32_t *pOut = &pSrc[rOut * numCols];
+        for (j = 0; j < numCols; j++) {
+            pSum[j] -= pOut[j];
+        }
+    } else if (rIn < numRows) {
+        const int32_t *pIn = &pSrc[rIn * numCols];
+        for (j = 0; j < numCols; j++) {
+            pSum[j] += pIn[j];
+        }
+    }
+}
+
+// detection of the rows [rowStart, rowEnd), with the column sums in pTmp
+static void cfar_ca_q32_rows(const plp_cfar_ca_instance_q32 *S,
+                             const int32_t *pSrc,
+                             int32_t numRows,
+                             int32_t numCols,
+                             int32_t rowStart,
+                             int32_t rowEnd,
+                             int64_t *pTmp,
+                             uint32_t *pMask) {
+
+    int32_t gR = S->guardRows;
+    int32_t gC = S->guardCols;
+    int32_t oR = gR + S->trainRows;
+    int32_t oC = gC + S->trainCols;
+    int64_t alpha = S->alpha;
+    int32_t maskWords = (numCols + 31) >> 5;
+    int64_t *pOuter = pTmp;
+    int64_t *pGuard = &pTmp[numCols];
+    int32_t i, j;
+
+    if (rowStart >= rowEnd) {
+        return;
+    }
+
+    cfar_ca_q32_init(pSrc, numRows, numCols, rowStart, oR, gR, pOuter, pGuard);
+
+    for (i = rowStart; i < rowEnd; i++) {
+        const int32_t *pRow = &pSrc[i * numCols];
+        uint32_t *pMaskRow = &pMask[i * maskWords];
+        int32_t nR = cfar_ca_q32_span(i, oR, numRows);
+        int32_t nG = cfar_ca_q32_span(i, gR, numRows);
+        int64_t sumO = 0;
+        int64_t sumG = 0;
+
+        if (i > rowStart) {
+            cfar_ca_q32_slide(pSrc, numRows, numCols, i - 1 - oR, i + oR, pOuter);
+            cfar_ca_q32_slide(pSrc, numRows, numCols, i - 1 - gR, i + gR, pGuard);
+        }
+
+        for (j = 0; j < maskWords; j++) {
+            pMaskRow[j] = 0;
+        }
+
+        // sums of the windows of column 0, the step of column 0 adds their last column
+        for (j = 0; j < oC && j < numCols; j++) {
+            sumO += pOuter[j];
+        }
+        for (j = 0; j < gC && j < numCols; j++) {
+            sumG += pGuard[j];
+        }
+
+        // the windows of the columns [jLo, jHi) do not cross the borders, and need no checks
+        int32_t jLo = (oC + 1 < numCols) ? oC + 1 : numCols;
+        int32_t jHi = (numCols - oC > jLo) ? numCols - oC : jLo;
+        int32_t nFull = nR * (2 * oC + 1) - nG * (2 * gC + 1);
+
+        for (j = 0; j < jLo; j++) {
+            int32_t n = nR * cfar_ca_q32_span(j, oC, numCols) -
+                        nG * cfar_ca_q32_span(j, gC, numCols);
+            cfar_ca_q32_step(pOuter, pGuard, j, oC, gC, numCols, &sumO, &sumG);
+            cfar_ca_q32_detect(pRow[j], n, sumO - sumG, alpha, j, pMaskRow);
+        }
+        for (; j < jHi; j++) {
+            sumO += pOuter[j + oC] - pOuter[j - 1 - oC];
+            sumG += pGuard[j + gC] - pGuard[j - 1 - gC];
+            cfar_ca_q32_detect(pRow[j], nFull, sumO - sumG, alpha, j, pMaskRow);
+        }
+        for (; j < numCols; j++) {
+            int32_t n = nR * cfar_ca_q32_span(j, oC, numCols) -
+                        nG * cfar_ca_q32_span(j, gC, numCols);
+            cfar_ca_q32_step(pOuter, pGuard, j, oC, gC, numCols, &sumO, &sumG);
+            cfar_ca_q32_detect(pRow[j], n, sumO - sumG, alpha, j, pMaskRow);
+        }
+    }
+}
+
+/**
+  @ingroup CFAR
+ */
+
+/**
+  @addtogroup CFARKernels
+  @{
+ */
+
+/**
+  @brief Cell-averaging CFAR of a 32-bit fixed-point power map kernel for XPULPV2 extension.
+  @param[in]  S        points to the instance, initialized by plp_cfar_ca_init_q32
+  @param[in]  pSrc     points to the power map of numRows x numCols cells, stored row by row
+  @param[in]  numRows  number of rows of the map
+  @param[in]  numCols  number of columns of the map
+  @param[out] pMask    points to the detection mask of numRows*((numCols+31)/32) words
+  @return     none
+
+  @par The column sums are updated with the entering and the leaving row in one loop. The
+  cells away from the borders are detected without any border checks.
+ */
+
+void plp_cfar_ca_q32s_xpulpv2(const plp_cfar_ca_instance_q32 *S,
+                              const int32_t *__restrict__ pSrc,
+                              uint32_t numRows,
+                              uint32_t numCols,
+                              uint32_t *__restrict__ pMask) {
+
+    cfar_ca_q32_rows(S, pSrc, numRows, numCols, 0, numRows, S->pTmp, pMask);
+}
+
+/**
+  @brief Parallel cell-averaging CFAR of a 32-bit fixed-point power map kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_cfar_ca_instance_q32_parallel struct initialized by
+                    plp_cfar_ca_q32_parallel
+  @return     none
+
+  @par Core k detects the k-th chunk of rows, and starts with the column sums of the rows
+  around the first row of the chunk.
+ */
+
+void plp_cfar_ca_q32p_xpulpv2(void *args) {
+
+    plp_cfar_ca_instance_q32_parallel *a = (plp_cfar_ca_instance_q32_parallel *)args;
+
+    uint32_t core = rt_core_id();
+    uint32_t numCols = a->numCols;
+    uint32_t rowStart, rowEnd;
+
+    plp_team_chunk(a->numRows, a->nPE, core, 1, &rowStart, &rowEnd);
+    cfar_ca_q32_rows(a->S, a->pSrc, a->numRows, numCols, rowStart, rowEnd,
+                     &a->S->pTmp[2 * core * numCols], a->pMask);
+}
+
+/**
+  @} end of CFARKernels group
+ */
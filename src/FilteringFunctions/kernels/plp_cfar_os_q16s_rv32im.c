@@ -0,0 +1,154 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfar_os_q16s_rv32im.c
+ * Description:  16-bit fixed-point ordered-statistic CFAR kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// inserts x into the sorted window of len values
+static inline void cfar_os_q16_insert(int16_t *pSorted, uint32_t len, int16_t x) {
+
+    uint32_t j;
+
+    for (j = len; j > 0 && pSorted[j - 1] > x; j--) {
+        pSorted[j] = pSorted[j - 1];
+    }
+    pSorted[j] = x;
+}
+
+// removes x from the sorted window of len values
+static inline void cfar_os_q16_remove(int16_t *pSorted, uint32_t len, int16_t x) {
+
+    uint32_t lo = 0;
+    uint32_t hi = len - 1;
+
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) >> 1;
+        if (pSorted[mid] < x) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    for (; lo + 1 < len; lo++) {
+        pSorted[lo] = pSorted[lo + 1];
+    }
+}
+
+// detection of one row, with the sorted training cells in pSorted
+static void cfar_os_q16_row(const plp_cfar_os_instance_q16 *S,
+                            const int16_t *pRow,
+                            int32_t numCols,
+                            int16_t *pSorted,
+                            uint32_t *pMaskRow) {
+
+    int32_t g = S->guardCells;
+    int32_t t = S->trainCells;
+    uint32_t fullLen = 2 * t;
+    uint32_t rank = S->rank;
+    int64_t alpha = S->alpha;
+    uint32_t len = 0;
+    int32_t j;
+
+    for (j = 0; j < (numCols + 31) >> 5; j++) {
+        pMaskRow[j] = 0;
+    }
+
+    if (t == 0) {
+        return;
+    }
+
+    // leading training cells of column 0
+    for (j = g + 1; j <= g + t && j < numCols; j++) {
+        cfar_os_q16_insert(pSorted, len++, pRow[j]);
+    }
+
+    for (j = 0; j < numCols; j++) {
+        uint32_t k;
+
+        // the lagging cells [j-g-t, j-g-1] and the leading cells [j+g+1, j+g+t] move by one
+        if (j > 0) {
+            if (j > g + t) {
+                cfar_os_q16_remove(pSorted, len--, pRow[j - 1 - g - t]);
+            }
+            if (j > g) {
+                cfar_os_q16_insert(pSorted, len++, pRow[j - 1 - g]);
+            }
+            if (j + g < numCols) {
+                cfar_os_q16_remove(pSorted, len--, pRow[j + g]);
+            }
+            if (j + g + t < numCols) {
+                cfar_os_q16_insert(pSorted, len++, pRow[j + g + t]);
+            }
+        }
+
+        // near the borders, the rank is scaled with the number of training cells
+        k = (len == fullLen) ? rank : rank * len / fullLen;
+        if (len > 0 && (int64_t)pRow[j] * 256 > alpha * pSorted[k]) {
+            pMaskRow[j >> 5] |= 1U << (j & 31);
+        }
+    }
+}
+
+/**
+  @ingroup CFAR
+ */
+
+/**
+  @addtogroup CFARKernels
+  @{
+ */
+
+/**
+  @brief Ordered-statistic CFAR of a 16-bit fixed-point power map kernel for RV32IM extension.
+  @param[in]  S        points to the instance, initialized by plp_cfar_os_init_q16
+  @param[in]  pSrc     points to the power map of numRows x numCols cells, stored row by row
+  @param[in]  numRows  number of rows of the map
+  @param[in]  numCols  number of columns of the map
+  @param[out] pMask    points to the detection mask of numRows*((numCols+31)/32) words
+  @return     none
+
+  @par The sorted training cells are updated by removing and inserting single cells.
+ */
+
+void plp_cfar_os_q16s_rv32im(const plp_cfar_os_instance_q16 *S,
+                             const int16_t *__restrict__ pSrc,
+                             uint32_t numRows,
+                             uint32_t numCols,
+                             uint32_t *__restrict__ pMask) {
+
+    uint32_t i;
+
+    for (i = 0; i < numRows; i++) {
+        cfar_os_q16_row(S, &pSrc[i * numCols], numCols, S->pTmp,
+                        &pMask[i * ((numCols + 31) >> 5)]);
+    }
+}
+
+/**
+  @} end of CFARKernels group
+ */
@@ -0,0 +1,122 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cic_decimate_i32s_rv32im.c
+ * Description:  CIC decimation of a 32-bit integer block on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Combs of the N stages with differential delay D, applied to the integrator output y, followed by
+// the rounding shift of the output
+static inline int32_t plp_cic_decimate_comb(uint32_t *pComb,
+                                            uint32_t y,
+                                            uint32_t N,
+                                            uint32_t D,
+                                            uint32_t shift) {
+
+    uint32_t s, k;
+    uint32_t x;
+
+    for (s = 0; s < N; s++) {
+        x = y;
+        y -= pComb[s * D + D - 1];
+        for (k = D - 1; k > 0; k--) {
+            pComb[s * D + k] = pComb[s * D + k - 1];
+        }
+        pComb[s * D] = x;
+    }
+
+    return (int32_t)(y + ((1 << shift) >> 1)) >> shift;
+}
+
+/**
+  @ingroup CICDecimate
+ */
+
+/**
+  @defgroup CICDecimateKernels CIC Decimator Kernels
+  @{
+ */
+
+/**
+  @brief CIC decimation of a 32-bit integer block kernel for RV32IM extension.
+  @param[in]  S          points to the instance, initialized by plp_cic_decimate_init_i32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples
+  @param[out] pDst       points to the output samples, at most PLP_CIC_DST_LEN(blockSize, R)
+  @return     number of output samples written to pDst
+
+  @par The input is integrated in runs up to the next output, such that the inner loop has no
+  branches. The integrators and combs are computed with unsigned arithmetic, which wraps around.
+ */
+
+uint32_t plp_cic_decimate_i32s_rv32im(plp_cic_decimate_instance_i32 *S,
+                                      const int32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      int32_t *__restrict__ pDst) {
+
+    uint32_t i, s;
+    uint32_t N = S->numStages;
+    uint32_t R = S->R;
+    uint32_t D = S->diffDelay;
+    uint32_t *pInteg = (uint32_t *)S->pState;
+    uint32_t *pComb = pInteg + N;
+    uint32_t phase = S->phase;
+    uint32_t numOut = 0;
+    uint32_t run, x;
+
+    while (blockSize > 0) {
+        run = R - phase;
+        if (run > blockSize) {
+            run = blockSize;
+        }
+
+        for (i = 0; i < run; i++) {
+            x = (uint32_t)pSrc[i];
+            for (s = 0; s < N; s++) {
+                x += pInteg[s];
+                pInteg[s] = x;
+            }
+        }
+
+        pSrc += run;
+        blockSize -= run;
+        phase += run;
+
+        if (phase == R) {
+            phase = 0;
+            *pDst++ = plp_cic_decimate_comb(pComb, pInteg[N - 1], N, D, S->shift);
+            numOut++;
+        }
+    }
+
+    S->phase = phase;
+
+    return numOut;
+}
+
+/**
+  @} end of CICDecimateKernels group
+ */
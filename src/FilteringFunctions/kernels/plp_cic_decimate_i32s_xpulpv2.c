@@ -0,0 +1,154 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cic_decimate_i32s_xpulpv2.c
+ * Description:  CIC decimation of a 32-bit integer block on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Combs of the N stages with differential delay D, applied to the integrator output y, followed by
+// the rounding shift of the output
+static inline int32_t plp_cic_decimate_comb(uint32_t *pComb,
+                                            uint32_t y,
+                                            uint32_t N,
+                                            uint32_t D,
+                                            uint32_t shift) {
+
+    uint32_t s, k;
+    uint32_t x;
+
+    for (s = 0; s < N; s++) {
+        x = y;
+        y -= pComb[s * D + D - 1];
+        for (k = D - 1; k > 0; k--) {
+            pComb[s * D + k] = pComb[s * D + k - 1];
+        }
+        pComb[s * D] = x;
+    }
+
+    return (int32_t)(y + ((1 << shift) >> 1)) >> shift;
+}
+
+// CIC decimation with N stages. It is called with a constant N, such that the stage loops are
+// unrolled and the integrators are kept in registers instead of the state buffer.
+static inline uint32_t plp_cic_decimate_i32_stages(plp_cic_decimate_instance_i32 *S,
+                                                   const int32_t *__restrict__ pSrc,
+                                                   uint32_t blockSize,
+                                                   int32_t *__restrict__ pDst,
+                                                   const uint32_t N) {
+
+    uint32_t i, s;
+    uint32_t R = S->R;
+    uint32_t D = S->diffDelay;
+    uint32_t integ[PLP_CIC_MAX_STAGES];
+    uint32_t *pComb = (uint32_t *)S->pState + N;
+    uint32_t phase = S->phase;
+    uint32_t numOut = 0;
+    uint32_t run, x;
+
+    for (s = 0; s < N; s++) {
+        integ[s] = (uint32_t)S->pState[s];
+    }
+
+    while (blockSize > 0) {
+        run = R - phase;
+        if (run > blockSize) {
+            run = blockSize;
+        }
+
+        for (i = 0; i < run; i++) {
+            x = (uint32_t)pSrc[i];
+            for (s = 0; s < N; s++) {
+                integ[s] += x;
+                x = integ[s];
+            }
+        }
+
+        pSrc += run;
+        blockSize -= run;
+        phase += run;
+
+        if (phase == R) {
+            phase = 0;
+            *pDst++ = plp_cic_decimate_comb(pComb, integ[N - 1], N, D, S->shift);
+            numOut++;
+        }
+    }
+
+    for (s = 0; s < N; s++) {
+        S->pState[s] = (int32_t)integ[s];
+    }
+
+    S->phase = phase;
+
+    return numOut;
+}
+
+/**
+  @ingroup CICDecimate
+ */
+
+/**
+  @addtogroup CICDecimateKernels
+  @{
+ */
+
+/**
+  @brief CIC decimation of a 32-bit integer block kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_cic_decimate_init_i32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples
+  @param[out] pDst       points to the output samples, at most PLP_CIC_DST_LEN(blockSize, R)
+  @return     number of output samples written to pDst
+
+  @par The integrators run at the input rate and dominate the cost. Therefore, the kernel is
+  specialized for every number of stages, which keeps the integrators in registers for the whole
+  block, with a single load and add per stage and input sample.
+ */
+
+uint32_t plp_cic_decimate_i32s_xpulpv2(plp_cic_decimate_instance_i32 *S,
+                                       const int32_t *__restrict__ pSrc,
+                                       uint32_t blockSize,
+                                       int32_t *__restrict__ pDst) {
+
+    switch (S->numStages) {
+    case 1:
+        return plp_cic_decimate_i32_stages(S, pSrc, blockSize, pDst, 1);
+    case 2:
+        return plp_cic_decimate_i32_stages(S, pSrc, blockSize, pDst, 2);
+    case 3:
+        return plp_cic_decimate_i32_stages(S, pSrc, blockSize, pDst, 3);
+    case 4:
+        return plp_cic_decimate_i32_stages(S, pSrc, blockSize, pDst, 4);
+    case 5:
+        return plp_cic_decimate_i32_stages(S, pSrc, blockSize, pDst, 5);
+    default:
+        return plp_cic_decimate_i32_stages(S, pSrc, blockSize, pDst, PLP_CIC_MAX_STAGES);
+    }
+}
+
+/**
+  @} end of CICDecimateKernels group
+ */
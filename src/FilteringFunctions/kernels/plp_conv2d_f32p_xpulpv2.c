@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_f32p_xpulpv2.c
+ * Description:  Parallel 2D convolution of 32-bit float images kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup Conv2d
+ */
+
+/**
+ * @addtogroup Conv2dKernels
+ * @{
+ */
+
+/**
+ * @brief Parallel 2D convolution of 32-bit float images kernel for XPULPV2 extension.
+ * @param[in]  args  pointer to plp_conv2d_instance_f32 struct initialized by
+ *                   plp_conv2d_f32_parallel
+ * @return     none
+ *
+ * @par The output rows of all channels are numbered one after the other, and every core computes
+ * a contiguous range of them. Output rows i to i + n - 1 of a channel only depend on the input
+ * rows i to i + n + kRows - 2, so the range is computed with the single-core kernel, one call per
+ * channel it covers.
+ */
+
+void plp_conv2d_f32p_xpulpv2(void *args) {
+
+    plp_conv2d_instance_f32 *S = (plp_conv2d_instance_f32 *)args;
+
+    uint32_t outRows = S->srcRows - S->kRows + 1;
+    uint32_t outCols = S->srcCols - S->kCols + 1;
+    uint32_t total = S->nChannels * outRows; // output rows of all channels
+
+    uint32_t chunk = (total + S->nPE - 1) / S->nPE;
+    uint32_t start = MIN(rt_core_id() * chunk, total);
+    uint32_t end = MIN(start + chunk, total);
+
+    while (start < end) {
+        uint32_t ch = start / outRows;
+        uint32_t row = start - ch * outRows;
+        uint32_t rows = MIN(outRows - row, end - start);
+
+        plp_conv2d_f32s_xpulpv2(S->pSrc + (ch * S->srcRows + row) * S->srcCols,
+                               rows + S->kRows - 1, S->srcCols,
+                               S->pKernel + ch * S->kRows * S->kCols, S->kRows, S->kCols,
+                               S->pDst + (ch * outRows + row) * outCols);
+        start += rows;
+    }
+}
+
+/**
+ * @} end of Conv2dKernels group
+ */
@@ -0,0 +1,130 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_f32s_xpulpv2.c
+ * Description:  2D convolution of 32-bit float images kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup Conv2d
+ */
+
+/**
+ * @addtogroup Conv2dKernels
+ * @{
+ */
+
+// computes the outputs x0 to outCols - 1 of an output row, with one multiplication per tap, where
+// pSrc points to the first input row of the output row
+static void plp_conv2d_f32_tail(const float32_t *__restrict__ pSrc,
+                                uint32_t srcCols,
+                                const float32_t *__restrict__ pKernel,
+                                uint32_t kRows,
+                                uint32_t kCols,
+                                uint32_t x0,
+                                uint32_t outCols,
+                                float32_t *__restrict__ pDst) {
+
+    uint32_t j, r, c;
+
+    for (j = x0; j < outCols; j++) {
+        float32_t sum = 0.0f;
+        for (r = 0; r < kRows; r++) {
+            const float32_t *pIn = pSrc + r * srcCols + j;
+            const float32_t *pK = pKernel + (kRows - 1 - r) * kCols; // row of the flipped kernel
+            for (c = 0; c < kCols; c++) {
+                sum += pIn[c] * pK[kCols - 1 - c];
+            }
+        }
+        pDst[j] = sum;
+    }
+}
+
+/**
+ * @brief 2D convolution of 32-bit float images kernel for XPULPV2 extension.
+ * @param[in]  pSrc       points to the input image, srcRows x srcCols
+ * @param[in]  srcRows    number of rows of the input image
+ * @param[in]  srcCols    number of columns of the input image
+ * @param[in]  pKernel    points to the kernel, kRows x kCols
+ * @param[in]  kRows      number of rows of the kernel
+ * @param[in]  kCols      number of columns of the kernel
+ * @param[out] pDst       output image returned here, (srcRows - kRows + 1) x
+ *                        (srcCols - kCols + 1)
+ * @return     none
+ *
+ * @par
+ * Four outputs of a row are computed at a time, such that every tap of the kernel is loaded once
+ * for four multiply-accumulates.
+ */
+
+void plp_conv2d_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             uint32_t srcRows,
+                             uint32_t srcCols,
+                             const float32_t *__restrict__ pKernel,
+                             uint32_t kRows,
+                             uint32_t kCols,
+                             float32_t *__restrict__ pDst) {
+
+    uint32_t outRows = srcRows - kRows + 1;
+    uint32_t outCols = srcCols - kCols + 1;
+    uint32_t vecCols = outCols & ~3; // outputs of a row computed in blocks of four
+    uint32_t i, j, r, c;
+
+    for (i = 0; i < outRows; i++) {
+        const float32_t *pRow = pSrc + i * srcCols;
+        float32_t *pOut = pDst + i * outCols;
+
+        for (j = 0; j < vecCols; j += 4) {
+            float32_t sum0 = 0.0f;
+            float32_t sum1 = 0.0f;
+            float32_t sum2 = 0.0f;
+            float32_t sum3 = 0.0f;
+
+            for (r = 0; r < kRows; r++) {
+                const float32_t *pIn = pRow + r * srcCols + j;
+                const float32_t *pK = pKernel + (kRows - 1 - r) * kCols; // flipped kernel row
+                for (c = 0; c < kCols; c++) {
+                    float32_t w = pK[kCols - 1 - c];
+                    sum0 += pIn[c] * w;
+                    sum1 += pIn[c + 1] * w;
+                    sum2 += pIn[c + 2] * w;
+                    sum3 += pIn[c + 3] * w;
+                }
+            }
+
+            pOut[j] = sum0;
+            pOut[j + 1] = sum1;
+            pOut[j + 2] = sum2;
+            pOut[j + 3] = sum3;
+        }
+
+        plp_conv2d_f32_tail(pRow, srcCols, pKernel, kRows, kCols, vecCols, outCols, pOut);
+    }
+}
+
+/**
+ * @} end of Conv2dKernels group
+ */
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i8s_rv32im.c
+ * Description:  2D convolution of 8-bit integer images kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup Conv2d
+ */
+
+/**
+ * @defgroup Conv2dKernels 2D Convolution Kernels
+ * Computes the valid 2D convolution of a single channel image.
+ */
+
+/**
+ * @addtogroup Conv2dKernels
+ * @{
+ */
+
+/**
+ * @brief 2D convolution of 8-bit integer images kernel for RV32IM extension.
+ * @param[in]  pSrc       points to the input image, srcRows x srcCols
+ * @param[in]  srcRows    number of rows of the input image
+ * @param[in]  srcCols    number of columns of the input image
+ * @param[in]  pKernel    points to the kernel, kRows x kCols
+ * @param[in]  kRows      number of rows of the kernel
+ * @param[in]  kCols      number of columns of the kernel
+ * @param[out] pDst       output image returned here, (srcRows - kRows + 1) x
+ *                        (srcCols - kCols + 1)
+ * @return     none
+ */
+
+void plp_conv2d_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                           uint32_t srcRows,
+                           uint32_t srcCols,
+                           const int8_t *__restrict__ pKernel,
+                           uint32_t kRows,
+                           uint32_t kCols,
+                           int32_t *__restrict__ pDst) {
+
+    uint32_t outRows = srcRows - kRows + 1;
+    uint32_t outCols = srcCols - kCols + 1;
+    uint32_t i, j, r, c;
+
+    for (i = 0; i < outRows; i++) {
+        for (j = 0; j < outCols; j++) {
+            int32_t sum = 0;
+            for (r = 0; r < kRows; r++) {
+                const int8_t *pIn = pSrc + (i + r) * srcCols + j;
+                const int8_t *pK = pKernel + (kRows - 1 - r) * kCols; // flipped kernel row
+                for (c = 0; c < kCols; c++) {
+                    sum = __MAC(sum, pIn[c], pK[kCols - 1 - c]);
+                }
+            }
+            pDst[i * outCols + j] = sum;
+        }
+    }
+}
+
+/**
+ * @} end of Conv2dKernels group
+ */
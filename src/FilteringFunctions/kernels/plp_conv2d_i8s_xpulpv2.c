@@ -0,0 +1,155 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i8s_xpulpv2.c
+ * Description:  2D convolution of 8-bit integer images kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup Conv2d
+ */
+
+/**
+ * @addtogroup Conv2dKernels
+ * @{
+ */
+
+// computes the outputs x0 to outCols - 1 of an output row, with one multiplication per tap, where
+// pSrc points to the first input row of the output row
+static void plp_conv2d_i8_tail(const int8_t *__restrict__ pSrc,
+                               uint32_t srcCols,
+                               const int8_t *__restrict__ pKernel,
+                               uint32_t kRows,
+                               uint32_t kCols,
+                               uint32_t x0,
+                               uint32_t outCols,
+                               int32_t *__restrict__ pDst) {
+
+    uint32_t j, r, c;
+
+    for (j = x0; j < outCols; j++) {
+        int32_t sum = 0;
+        for (r = 0; r < kRows; r++) {
+            const int8_t *pIn = pSrc + r * srcCols + j;
+            const int8_t *pK = pKernel + (kRows - 1 - r) * kCols; // row of the flipped kernel
+            for (c = 0; c < kCols; c++) {
+                sum += pIn[c] * pK[kCols - 1 - c];
+            }
+        }
+        pDst[j] = sum;
+    }
+}
+
+/**
+ * @brief 2D convolution of 8-bit integer images kernel for XPULPV2 extension.
+ * @param[in]  pSrc       points to the input image, srcRows x srcCols
+ * @param[in]  srcRows    number of rows of the input image
+ * @param[in]  srcCols    number of columns of the input image
+ * @param[in]  pKernel    points to the kernel, kRows x kCols
+ * @param[in]  kRows      number of rows of the kernel
+ * @param[in]  kCols      number of columns of the kernel
+ * @param[out] pDst       output image returned here, (srcRows - kRows + 1) x
+ *                        (srcCols - kCols + 1)
+ * @return     none
+ *
+ * @par Exploiting SIMD instructions
+ * The kernel is flipped once into rows padded with zeros to a multiple of four taps. Four outputs
+ * of a row are computed at a time: the input words of the four windows are built from two loads
+ * with pv.shuffle2.b, and multiplied with the kernel with pv.sdotsp.b. Kernels larger than
+ * PLP_CONV2D_MAX_KERNEL_SIZE, and the last outputs of a row, are computed without SIMD.
+ */
+
+void plp_conv2d_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t srcRows,
+                            uint32_t srcCols,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t kRows,
+                            uint32_t kCols,
+                            int32_t *__restrict__ pDst) {
+
+    const v4s mask1 = { 1, 2, 3, 4 };
+    const v4s mask2 = { 2, 3, 4, 5 };
+    const v4s mask3 = { 3, 4, 5, 6 };
+
+    v4s kernel[PLP_CONV2D_MAX_KERNEL_SIZE * ((PLP_CONV2D_MAX_KERNEL_SIZE + 3) / 4)];
+    int8_t *pFlip = (int8_t *)kernel;
+
+    uint32_t outRows = srcRows - kRows + 1;
+    uint32_t outCols = srcCols - kCols + 1;
+    uint32_t kVecs = (kCols + 3) / 4; // vectors per padded kernel row
+    uint32_t vecCols = 0; // outputs of a row computed with SIMD, in blocks of four
+    uint32_t i, j, r, c;
+
+    // the loads of a block of four outputs end before pIn[4 * kVecs + 4]
+    if (kRows <= PLP_CONV2D_MAX_KERNEL_SIZE && kCols <= PLP_CONV2D_MAX_KERNEL_SIZE &&
+        srcCols >= 4 * kVecs + 4) {
+        vecCols = ((srcCols - 4 * kVecs - 4) / 4 + 1) * 4;
+
+        for (r = 0; r < kRows; r++) {
+            for (c = 0; c < 4 * kVecs; c++) {
+                pFlip[r * 4 * kVecs + c] = (c < kCols) ? pKernel[(kRows - r) * kCols - 1 - c] : 0;
+            }
+        }
+    }
+
+    for (i = 0; i < outRows; i++) {
+        const int8_t *pRow = pSrc + i * srcCols;
+        int32_t *pOut = pDst + i * outCols;
+
+        for (j = 0; j < vecCols; j += 4) {
+            const v4s *pK = kernel;
+            int32_t sum0 = 0;
+            int32_t sum1 = 0;
+            int32_t sum2 = 0;
+            int32_t sum3 = 0;
+
+            for (r = 0; r < kRows; r++) {
+                const int8_t *pIn = pRow + r * srcCols + j;
+                for (c = 0; c < kVecs; c++) {
+                    v4s x0 = *((v4s *)&pIn[4 * c]);
+                    v4s x4 = *((v4s *)&pIn[4 * c + 4]);
+                    v4s k = *pK++;
+
+                    sum0 = __SUMDOTP4(x0, k, sum0);
+                    sum1 = __SUMDOTP4(__builtin_shuffle(x0, x4, mask1), k, sum1);
+                    sum2 = __SUMDOTP4(__builtin_shuffle(x0, x4, mask2), k, sum2);
+                    sum3 = __SUMDOTP4(__builtin_shuffle(x0, x4, mask3), k, sum3);
+                }
+            }
+
+            pOut[j] = sum0;
+            pOut[j + 1] = sum1;
+            pOut[j + 2] = sum2;
+            pOut[j + 3] = sum3;
+        }
+
+        plp_conv2d_i8_tail(pRow, srcCols, pKernel, kRows, kCols, vecCols, outCols, pOut);
+    }
+}
+
+/**
+ * @} end of Conv2dKernels group
+ */
@@ -0,0 +1,193 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_winograd_i16s_xpulpv2.c
+ * Description:  Winograd 3x3 convolution of 16-bit integer images kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup Conv2dWinograd
+ */
+
+/**
+ * @addtogroup Conv2dWinogradKernels
+ * @{
+ */
+
+// transforms the 4x4 tiles at input row 2 * tileRow of the input channels ci0 to ci1 - 1 into
+// V = B^T d B, with B^T = [1 0 -1 0; 0 1 1 0; 0 -1 1 0; 0 1 0 -1]. Element k of tile t of channel
+// ci is stored at pV[(k * tiles + t) * inChannels + ci]. Inputs outside the image are zero.
+static void plp_winograd_input_i16(const int16_t *__restrict__ pSrc,
+                                   uint32_t srcRows,
+                                   uint32_t srcCols,
+                                   uint32_t inChannels,
+                                   uint32_t ci0,
+                                   uint32_t ci1,
+                                   uint32_t tileRow,
+                                   int32_t *__restrict__ pV) {
+
+    uint32_t tiles = (srcCols - 1) / 2;
+    uint32_t stride = tiles * inChannels; // distance between the elements of a tile
+    uint32_t row = 2 * tileRow;
+    uint32_t ci, t, r;
+
+    for (ci = ci0; ci < ci1; ci++) {
+        const int16_t *pIn = pSrc + (ci * srcRows + row) * srcCols;
+        for (t = 0; t < tiles; t++) {
+            uint32_t col = 2 * t;
+            int32_t d[4][4];
+            int32_t *pD = &d[0][0];
+            int32_t *pOut = pV + t * inChannels + ci;
+
+            for (r = 0; r < 4; r++) {
+                const int16_t *p = pIn + r * srcCols + col;
+                int32_t valid = row + r < srcRows;
+                d[r][0] = valid ? p[0] : 0;
+                d[r][1] = valid ? p[1] : 0;
+                d[r][2] = valid ? p[2] : 0;
+                d[r][3] = (valid && col + 3 < srcCols) ? p[3] : 0;
+            }
+
+            // columns, then rows
+            for (r = 0; r < 4; r++) {
+                int32_t d0 = pD[r], d1 = pD[4 + r], d2 = pD[8 + r], d3 = pD[12 + r];
+                pD[r] = d0 - d2;
+                pD[4 + r] = d1 + d2;
+                pD[8 + r] = d2 - d1;
+                pD[12 + r] = d1 - d3;
+            }
+            for (r = 0; r < 4; r++) {
+                int32_t d0 = d[r][0], d1 = d[r][1], d2 = d[r][2], d3 = d[r][3];
+                pOut[(4 * r) * stride] = (int32_t)(d0 - d2);
+                pOut[(4 * r + 1) * stride] = (int32_t)(d1 + d2);
+                pOut[(4 * r + 2) * stride] = (int32_t)(d2 - d1);
+                pOut[(4 * r + 3) * stride] = (int32_t)(d1 - d3);
+            }
+        }
+    }
+}
+
+// transforms the products M of the output channels co0 to co1 - 1 into the 2x2 output tiles
+// A^T M A / 4 at output row 2 * tileRow, with A^T = [1 1 1 0; 0 1 -1 -1]. Element k of tile t of
+// channel co is read from pM[(k * outChannels + co) * tiles + t].
+static void plp_winograd_output_i16(const int32_t *__restrict__ pM,
+                                    uint32_t srcRows,
+                                    uint32_t srcCols,
+                                    uint32_t outChannels,
+                                    uint32_t co0,
+                                    uint32_t co1,
+                                    uint32_t tileRow,
+                                    int32_t *__restrict__ pDst) {
+
+    uint32_t outRows = srcRows - 2;
+    uint32_t outCols = srcCols - 2;
+    uint32_t tiles = (srcCols - 1) / 2;
+    uint32_t stride = outChannels * tiles; // distance between the elements of a tile
+    uint32_t row = 2 * tileRow;
+    uint32_t co, t, c;
+
+    for (co = co0; co < co1; co++) {
+        int32_t *pOut = pDst + (co * outRows + row) * outCols;
+        for (t = 0; t < tiles; t++) {
+            const int32_t *pIn = pM + co * tiles + t;
+            int32_t s0[4], s1[4];
+
+            for (c = 0; c < 4; c++) {
+                int32_t m0 = pIn[c * stride];
+                int32_t m1 = pIn[(4 + c) * stride];
+                int32_t m2 = pIn[(8 + c) * stride];
+                int32_t m3 = pIn[(12 + c) * stride];
+                s0[c] = m0 + m1 + m2;
+                s1[c] = m1 - m2 - m3;
+            }
+
+            pOut[2 * t] = (s0[0] + s0[1] + s0[2]) >> 2;
+            if (2 * t + 1 < outCols) {
+                pOut[2 * t + 1] = (s0[1] - s0[2] - s0[3]) >> 2;
+            }
+            if (row + 1 < outRows) {
+                pOut[outCols + 2 * t] = (s1[0] + s1[1] + s1[2]) >> 2;
+                if (2 * t + 1 < outCols) {
+                    pOut[outCols + 2 * t + 1] = (s1[1] - s1[2] - s1[3]) >> 2;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Winograd 3x3 convolution of 16-bit integer images kernel for XPULPV2 extension.
+ * @param[in]  pSrc         points to the input image, inChannels x srcRows x srcCols
+ * @param[in]  srcRows      number of rows of the input image
+ * @param[in]  srcCols      number of columns of the input image
+ * @param[in]  inChannels   number of input channels
+ * @param[in]  pU           points to the transformed weights, computed by
+ *                          plp_conv2d_winograd_weights_i16
+ * @param[in]  outChannels  number of output channels
+ * @param[in]  pTmpV        points to a buffer of 16 * inChannels * ((srcCols - 1) / 2) values
+ * @param[in]  pTmpM        points to a buffer of 16 * outChannels * ((srcCols - 1) / 2) values
+ * @param[out] pDst         output image returned here, outChannels x (srcRows - 2) x
+ *                          (srcCols - 2)
+ * @return     none
+ *
+ * @par The output is computed one row of 2x2 tiles at a time: the input tiles of all channels are
+ * transformed into pTmpV, the 16 matrices U[k] x V[k]^T are computed into pTmpM with
+ * plp_mat_mult_trans_i32s_xpulpv2, and are transformed into the output tiles.
+ *
+ * @par The transformed inputs need 18 bits, such that the transforms are computed without SIMD,
+ * and the matrix multiplications use the 32-bit kernel of plp_mat_mult_trans.
+ */
+
+void plp_conv2d_winograd_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                      uint32_t srcRows,
+                                      uint32_t srcCols,
+                                      uint32_t inChannels,
+                                      const int32_t *__restrict__ pU,
+                                      uint32_t outChannels,
+                                      int32_t *__restrict__ pTmpV,
+                                      int32_t *__restrict__ pTmpM,
+                                      int32_t *__restrict__ pDst) {
+
+    uint32_t tiles = (srcCols - 1) / 2;
+    uint32_t tileRows = (srcRows - 1) / 2;
+    uint32_t tr, k;
+
+    for (tr = 0; tr < tileRows; tr++) {
+        plp_winograd_input_i16(pSrc, srcRows, srcCols, inChannels, 0, inChannels, tr, pTmpV);
+
+        for (k = 0; k < 16; k++) {
+            plp_mat_mult_trans_i32s_xpulpv2(pU + k * outChannels * inChannels,
+                                            pTmpV + k * tiles * inChannels, outChannels, inChannels,
+                                            tiles, pTmpM + k * outChannels * tiles);
+        }
+
+        plp_winograd_output_i16(pTmpM, srcRows, srcCols, outChannels, 0, outChannels, tr, pDst);
+    }
+}
+
+/**
+ * @} end of Conv2dWinogradKernels group
+ */
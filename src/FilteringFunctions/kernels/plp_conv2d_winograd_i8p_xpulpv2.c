@@ -0,0 +1,205 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_winograd_i8p_xpulpv2.c
+ * Description:  Parallel Winograd 3x3 convolution of 8-bit integer images kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup Conv2dWinograd
+ */
+
+/**
+ * @addtogroup Conv2dWinogradKernels
+ * @{
+ */
+
+// transforms the 4x4 tiles at input row 2 * tileRow of the input channels ci0 to ci1 - 1 into
+// V = B^T d B, with B^T = [1 0 -1 0; 0 1 1 0; 0 -1 1 0; 0 1 0 -1]. Element k of tile t of channel
+// ci is stored at pV[(k * tiles + t) * inChannels + ci]. Inputs outside the image are zero.
+static void plp_winograd_input_i8(const int8_t *__restrict__ pSrc,
+                                  uint32_t srcRows,
+                                  uint32_t srcCols,
+                                  uint32_t inChannels,
+                                  uint32_t ci0,
+                                  uint32_t ci1,
+                                  uint32_t tileRow,
+                                  int16_t *__restrict__ pV) {
+
+    uint32_t tiles = (srcCols - 1) / 2;
+    uint32_t stride = tiles * inChannels; // distance between the elements of a tile
+    uint32_t row = 2 * tileRow;
+    uint32_t ci, t, r;
+
+    for (ci = ci0; ci < ci1; ci++) {
+        const int8_t *pIn = pSrc + (ci * srcRows + row) * srcCols;
+        for (t = 0; t < tiles; t++) {
+            uint32_t col = 2 * t;
+            v2s lo[4]; // columns 0 and 1 of the rows of the tile
+            v2s hi[4]; // columns 2 and 3 of the rows of the tile
+            int16_t *pOut = pV + t * inChannels + ci;
+
+            for (r = 0; r < 4; r++) {
+                const int8_t *p = pIn + r * srcCols + col;
+                if (row + r < srcRows) {
+                    lo[r] = __PACK2(p[0], p[1]);
+                    hi[r] = __PACK2(p[2], (col + 3 < srcCols) ? p[3] : 0);
+                } else {
+                    lo[r] = __PACK2(0, 0);
+                    hi[r] = __PACK2(0, 0);
+                }
+            }
+
+            // B^T d on two columns at a time
+            v2s lo0 = __SUB2(lo[0], lo[2]);
+            v2s lo1 = __ADD2(lo[1], lo[2]);
+            v2s lo2 = __SUB2(lo[2], lo[1]);
+            v2s lo3 = __SUB2(lo[1], lo[3]);
+            v2s hi0 = __SUB2(hi[0], hi[2]);
+            v2s hi1 = __ADD2(hi[1], hi[2]);
+            v2s hi2 = __SUB2(hi[2], hi[1]);
+            v2s hi3 = __SUB2(hi[1], hi[3]);
+            lo[0] = lo0;
+            lo[1] = lo1;
+            lo[2] = lo2;
+            lo[3] = lo3;
+            hi[0] = hi0;
+            hi[1] = hi1;
+            hi[2] = hi2;
+            hi[3] = hi3;
+
+            // (B^T d) B on every row, with elements 0 and 3 from one subtraction
+            for (r = 0; r < 4; r++) {
+                v2s diff = __SUB2(lo[r], hi[r]);
+                int16_t *pRow = pOut + 4 * r * stride;
+                pRow[0] = diff[0];
+                pRow[stride] = lo[r][1] + hi[r][0];
+                pRow[2 * stride] = hi[r][0] - lo[r][1];
+                pRow[3 * stride] = diff[1];
+            }
+        }
+    }
+}
+
+// transforms the products M of the output channels co0 to co1 - 1 into the 2x2 output tiles
+// A^T M A / 4 at output row 2 * tileRow, with A^T = [1 1 1 0; 0 1 -1 -1]. Element k of tile t of
+// channel co is read from pM[(k * outChannels + co) * tiles + t].
+static void plp_winograd_output_i8(const int32_t *__restrict__ pM,
+                                   uint32_t srcRows,
+                                   uint32_t srcCols,
+                                   uint32_t outChannels,
+                                   uint32_t co0,
+                                   uint32_t co1,
+                                   uint32_t tileRow,
+                                   int32_t *__restrict__ pDst) {
+
+    uint32_t outRows = srcRows - 2;
+    uint32_t outCols = srcCols - 2;
+    uint32_t tiles = (srcCols - 1) / 2;
+    uint32_t stride = outChannels * tiles; // distance between the elements of a tile
+    uint32_t row = 2 * tileRow;
+    uint32_t co, t, c;
+
+    for (co = co0; co < co1; co++) {
+        int32_t *pOut = pDst + (co * outRows + row) * outCols;
+        for (t = 0; t < tiles; t++) {
+            const int32_t *pIn = pM + co * tiles + t;
+            int32_t s0[4], s1[4];
+
+            for (c = 0; c < 4; c++) {
+                int32_t m0 = pIn[c * stride];
+                int32_t m1 = pIn[(4 + c) * stride];
+                int32_t m2 = pIn[(8 + c) * stride];
+                int32_t m3 = pIn[(12 + c) * stride];
+                s0[c] = m0 + m1 + m2;
+                s1[c] = m1 - m2 - m3;
+            }
+
+            pOut[2 * t] = (s0[0] + s0[1] + s0[2]) >> 2;
+            if (2 * t + 1 < outCols) {
+                pOut[2 * t + 1] = (s0[1] - s0[2] - s0[3]) >> 2;
+            }
+            if (row + 1 < outRows) {
+                pOut[outCols + 2 * t] = (s1[0] + s1[1] + s1[2]) >> 2;
+                if (2 * t + 1 < outCols) {
+                    pOut[outCols + 2 * t + 1] = (s1[1] - s1[2] - s1[3]) >> 2;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Parallel Winograd 3x3 convolution of 8-bit integer images kernel for XPULPV2
+ * extension.
+ * @param[in]  args  pointer to plp_conv2d_winograd_instance_i8 struct initialized by
+ *                   plp_conv2d_winograd_i8_parallel
+ * @return     none
+ *
+ * @par Every row of 2x2 tiles is computed in two stages. First, every core transforms the input
+ * tiles of its range of input channels. After a barrier, every core computes the rows of its
+ * range of output channels of the 16 matrix products with plp_mat_mult_trans_i16s_xpulpv2,
+ * and transforms them into the output tiles of these channels. A second barrier protects pTmpV
+ * until all cores are done with the row.
+ */
+
+void plp_conv2d_winograd_i8p_xpulpv2(void *args) {
+
+    plp_conv2d_winograd_instance_i8 *S = (plp_conv2d_winograd_instance_i8 *)args;
+
+    uint32_t inChannels = S->inChannels;
+    uint32_t outChannels = S->outChannels;
+    uint32_t tiles = (S->srcCols - 1) / 2;
+    uint32_t tileRows = (S->srcRows - 1) / 2;
+    uint32_t ci0, ci1, co0, co1;
+    uint32_t tr, k;
+
+    plp_team_chunk(inChannels, S->nPE, rt_core_id(), 1, &ci0, &ci1);
+    plp_team_chunk(outChannels, S->nPE, rt_core_id(), 1, &co0, &co1);
+
+    for (tr = 0; tr < tileRows; tr++) {
+        plp_winograd_input_i8(S->pSrc, S->srcRows, S->srcCols, inChannels, ci0, ci1, tr, S->pTmpV);
+
+        rt_team_barrier();
+
+        if (co0 < co1) {
+            for (k = 0; k < 16; k++) {
+                plp_mat_mult_trans_i16s_xpulpv2(S->pU + (k * outChannels + co0) * inChannels,
+                                                S->pTmpV + k * tiles * inChannels, co1 - co0,
+                                                inChannels, tiles,
+                                                S->pTmpM + (k * outChannels + co0) * tiles);
+            }
+            plp_winograd_output_i8(S->pTmpM, S->srcRows, S->srcCols, outChannels, co0, co1, tr,
+                                    S->pDst);
+        }
+
+        rt_team_barrier();
+    }
+}
+
+/**
+ * @} end of Conv2dWinogradKernels group
+ */
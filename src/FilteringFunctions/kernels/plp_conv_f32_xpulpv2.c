@@ -0,0 +1,364 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_f32_xpulpv2.c
+ * Description:  Convolution and correlation of 32-bit floating-point vectors kernels for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static void conv_f32_outputs(const float32_t *pX,
+                             uint32_t xLen,
+                             const float32_t *pY,
+                             int32_t yStride,
+                             uint32_t yLen,
+                             uint32_t start,
+                             uint32_t end,
+                             float32_t *pOut,
+                             int32_t outStride);
+
+static void conv_f32_ola(uint32_t nPE,
+                         uint32_t srcALen,
+                         uint32_t srcBLen,
+                         const float32_t *pScratch,
+                         float32_t *pRes);
+
+/**
+   @ingroup BasicConvolution
+*/
+
+/**
+   @addtogroup BasicConvolutionKernels
+   @{
+*/
+
+/**
+   @brief Convolution of 32-bit floating-point vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[out] pRes     output result returned here, of size srcALen + srcBLen - 1
+   @return     none
+
+   @par The outputs where the shorter vector fully overlaps the longer one are computed four at a
+   time. Every loaded sample of the shorter vector feeds four independent fmadd chains, and the
+   samples of the longer vector are rotated through registers, such that only one new sample of
+   each vector is loaded per four fmadd. The partially overlapping outputs at both ends use two
+   chains each.
+*/
+
+void plp_conv_f32s_xpulpv2(const float32_t *pSrcA,
+                           const uint32_t srcALen,
+                           const float32_t *pSrcB,
+                           const uint32_t srcBLen,
+                           float32_t *pRes) {
+
+    if (srcALen >= srcBLen) {
+        conv_f32_outputs(pSrcA, srcALen, pSrcB, 1, srcBLen, 0, srcALen + srcBLen - 1, pRes, 1);
+    } else {
+        conv_f32_outputs(pSrcB, srcBLen, pSrcA, 1, srcALen, 0, srcALen + srcBLen - 1, pRes, 1);
+    }
+}
+
+/**
+   @brief Parallel convolution of 32-bit floating-point vectors kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_conv_instance_f32 struct initialized by
+                          plp_conv_f32_parallel_ws
+   @return     none
+
+   @par Every core convolves one chunk of pSrcA with pSrcB into the scratch buffer. After a
+   barrier, the same team overlap-adds the partial results directly into pRes, as in
+   plp_conv_i32p_xpulpv2.
+*/
+
+// Pre-condition: srcALen <= srcBLen, established by calling function plp_conv_f32_parallel_ws
+// Pre-condition: pScratch has plp_conv_parallel_scratch_size(srcALen, srcBLen, nPE) elements
+
+void plp_conv_f32p_xpulpv2(void *task_args) {
+
+    plp_conv_instance_f32 *S = (plp_conv_instance_f32 *)task_args;
+
+    uint32_t coreId = rt_core_id();
+    uint32_t srcAoffset = ((S->srcALen + S->nPE - 1) / S->nPE);
+    uint32_t resultoffset = srcAoffset + S->srcBLen - 1;
+    // if srcALen is small, the last cores get no chunk and only take part in the overlap-add
+    uint32_t nChunks = (S->srcALen + srcAoffset - 1) / srcAoffset;
+
+    if (coreId < nChunks) {
+        uint32_t srcALen =
+            (coreId == nChunks - 1) ? S->srcALen - srcAoffset * (nChunks - 1) : srcAoffset;
+
+        plp_conv_f32s_xpulpv2(S->pSrcA + coreId * srcAoffset, srcALen, S->pSrcB, S->srcBLen,
+                              S->pScratch + resultoffset * coreId);
+    }
+
+    rt_team_barrier();
+
+    conv_f32_ola(S->nPE, S->srcALen, S->srcBLen, S->pScratch, S->pRes);
+}
+
+/**
+   @brief Convolution (valid) of 32-bit floating-point vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[out] pRes     output result returned here, of size srcALen - srcBLen + 1
+   @return     none
+
+   @par All outputs of the valid range fully overlap, and are computed four at a time as in
+   plp_conv_f32s_xpulpv2.
+*/
+
+// Pre-condition: srcALen >= srcBLen, established by calling function plp_conv_valid_f32
+
+void plp_conv_valid_f32s_xpulpv2(const float32_t *pSrcA,
+                                 const uint32_t srcALen,
+                                 const float32_t *pSrcB,
+                                 const uint32_t srcBLen,
+                                 float32_t *pRes) {
+
+    conv_f32_outputs(pSrcA, srcALen, pSrcB, 1, srcBLen, srcBLen - 1, srcALen, pRes, 1);
+}
+
+/**
+   @brief Parallel convolution (valid) of 32-bit floating-point vectors kernel for XPULPV2
+          extension.
+   @param[in]  task_args  pointer to plp_conv_instance_f32 struct initialized by
+                          plp_conv_valid_f32_parallel
+   @return     none
+
+   @par Every core computes a contiguous range of the output directly into pRes. The ranges are a
+   multiple of four outputs, the block size of the single-core kernel.
+*/
+
+// Pre-condition: srcALen >= srcBLen, established by calling function plp_conv_valid_f32_parallel
+
+void plp_conv_valid_f32p_xpulpv2(void *task_args) {
+
+    plp_conv_instance_f32 *S = (plp_conv_instance_f32 *)task_args;
+
+    uint32_t start, end;
+    plp_team_chunk(S->srcALen - S->srcBLen + 1, S->nPE, rt_core_id(), 4, &start, &end);
+
+    if (start < end) {
+        conv_f32_outputs(S->pSrcA, S->srcALen, S->pSrcB, 1, S->srcBLen, start + S->srcBLen - 1,
+                         end + S->srcBLen - 1, S->pRes + start, 1);
+    }
+}
+
+/**
+   @} end of BasicConvolutionKernels
+*/
+
+/**
+   @ingroup BasicCorrelation
+*/
+
+/**
+   @addtogroup BasicCorrelationKernels
+   @{
+*/
+
+/**
+   @brief Correlation of 32-bit floating-point vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[out] pRes     output result returned here, of size srcALen + srcBLen - 1
+   @return     none
+
+   @par Output n is the correlation at lag n - (srcBLen - 1), i.e. the sum over k of
+   pSrcA[k] * pSrcB[k - n + srcBLen - 1]. This is the convolution of pSrcA with the reversed
+   pSrcB, which is computed by plp_conv_f32s_xpulpv2 with pSrcB read backwards. If pSrcB is the
+   longer vector, pSrcA is read backwards instead, and the output is written from the end.
+*/
+
+void plp_correlate_f32s_xpulpv2(const float32_t *pSrcA,
+                                const uint32_t srcALen,
+                                const float32_t *pSrcB,
+                                const uint32_t srcBLen,
+                                float32_t *pRes) {
+
+    uint32_t resLen = srcALen + srcBLen - 1;
+
+    if (srcALen >= srcBLen) {
+        conv_f32_outputs(pSrcA, srcALen, pSrcB + srcBLen - 1, -1, srcBLen, 0, resLen, pRes, 1);
+    } else {
+        conv_f32_outputs(pSrcB, srcBLen, pSrcA + srcALen - 1, -1, srcALen, 0, resLen,
+                         pRes + resLen - 1, -1);
+    }
+}
+
+/**
+   @brief Parallel correlation of 32-bit floating-point vectors kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_conv_instance_f32 struct initialized by
+                          plp_correlate_f32_parallel
+   @return     none
+
+   @par Every core computes a contiguous range of output lags as in plp_correlate_f32s_xpulpv2,
+   and writes it directly to pRes.
+*/
+
+void plp_correlate_f32p_xpulpv2(void *task_args) {
+
+    plp_conv_instance_f32 *S = (plp_conv_instance_f32 *)task_args;
+
+    uint32_t srcALen = S->srcALen;
+    uint32_t srcBLen = S->srcBLen;
+    uint32_t resLen = srcALen + srcBLen - 1;
+
+    uint32_t start, end;
+    plp_team_chunk(resLen, S->nPE, rt_core_id(), 4, &start, &end);
+
+    if (start >= end) {
+        return;
+    }
+
+    if (srcALen >= srcBLen) {
+        conv_f32_outputs(S->pSrcA, srcALen, S->pSrcB + srcBLen - 1, -1, srcBLen, start, end,
+                         S->pRes + start, 1);
+    } else {
+        // output n of the correlation is output resLen - 1 - n of the reversed problem
+        conv_f32_outputs(S->pSrcB, srcBLen, S->pSrcA + srcALen - 1, -1, srcALen,
+                         resLen - end, resLen - start, S->pRes + end - 1, -1);
+    }
+}
+
+/**
+   @} end of BasicCorrelationKernels
+*/
+
+// pOut[(n - start) * outStride] = sum over k of pX[k] * pY[(n - k) * yStride], for n from start
+// to end - 1, where pX is the longer vector, i.e. xLen >= yLen
+static void conv_f32_outputs(const float32_t *pX,
+                             uint32_t xLen,
+                             const float32_t *pY,
+                             int32_t yStride,
+                             uint32_t yLen,
+                             uint32_t start,
+                             uint32_t end,
+                             float32_t *pOut,
+                             int32_t outStride) {
+
+    uint32_t n = start;
+
+    while (n < end) {
+        if (n + 1 >= yLen && n + 4 <= MIN(xLen, end)) {
+            // four outputs with full overlap, pY is read from its last sample to its first one
+            const float32_t *px = pX + n + 1 - yLen;
+            const float32_t *py = pY + (int32_t)(yLen - 1) * yStride;
+            float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+            float32_t x0 = px[0];
+            float32_t x1 = px[1];
+            float32_t x2 = px[2];
+
+            px += 3;
+            for (uint32_t i = 0; i < yLen; i++) {
+                float32_t c = *py;
+                float32_t x3 = *px++;
+                py -= yStride;
+                acc0 += x0 * c;
+                acc1 += x1 * c;
+                acc2 += x2 * c;
+                acc3 += x3 * c;
+                x0 = x1;
+                x1 = x2;
+                x2 = x3;
+            }
+
+            pOut[0] = acc0;
+            pOut[outStride] = acc1;
+            pOut[2 * outStride] = acc2;
+            pOut[3 * outStride] = acc3;
+            pOut += 4 * outStride;
+            n += 4;
+        } else {
+            // partial overlap at both ends, and the last outputs of a block of four
+            uint32_t kStart = (n + 1 >= yLen) ? n + 1 - yLen : 0;
+            uint32_t kEnd = MIN(n + 1, xLen);
+            const float32_t *py = pY + (int32_t)(n - kStart) * yStride;
+            float32_t acc0 = 0.0f, acc1 = 0.0f;
+            uint32_t k;
+
+            for (k = kStart; k + 1 < kEnd; k += 2) {
+                acc0 += pX[k] * py[0];
+                acc1 += pX[k + 1] * py[-yStride];
+                py -= 2 * yStride;
+            }
+            if (k < kEnd) {
+                acc0 += pX[k] * py[0];
+            }
+
+            *pOut = acc0 + acc1;
+            pOut += outStride;
+            n++;
+        }
+    }
+}
+
+// float32_t version of plp_conv_parallel_OLA_core, every core sums up a contiguous range of the
+// outputs from the partial results which overlap it
+static void conv_f32_ola(uint32_t nPE,
+                         uint32_t srcALen,
+                         uint32_t srcBLen,
+                         const float32_t *pScratch,
+                         float32_t *pRes) {
+
+    uint32_t srcAoffset = ((srcALen + nPE - 1) / nPE);
+    uint32_t resultsoffset = srcAoffset + srcBLen - 1;
+    uint32_t nChunks = (srcALen + srcAoffset - 1) / srcAoffset;
+    uint32_t lastLen = srcALen - srcAoffset * (nChunks - 1) + srcBLen - 1;
+    uint32_t resLen = srcALen + srcBLen - 1;
+
+    uint32_t start, end;
+    plp_team_chunk(resLen, nPE, rt_core_id(), 1, &start, &end);
+
+    for (uint32_t n = start; n < end; n++) {
+        int32_t p = MIN(n / srcAoffset, nChunks - 1); // last partial result overlapping n
+        uint32_t idx = n - p * srcAoffset;            // index of n inside partial result p
+        float32_t sum = 0.0f;
+
+        // the last partial result may be shorter than the others
+        if (p == nChunks - 1) {
+            if (idx < lastLen) {
+                sum = pScratch[p * resultsoffset + idx];
+            }
+            p--;
+            idx += srcAoffset;
+        }
+
+        while (p >= 0 && idx < resultsoffset) {
+            sum += pScratch[p * resultsoffset + idx];
+            p--;
+            idx += srcAoffset;
+        }
+
+        pRes[n] = sum;
+    }
+}
@@ -41,65 +41,46 @@
 
 /**
    @brief Parallel convolution of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  task_args      pointer to plp_conv_instance_i8 struct initialized by
-   plp_conv_i8_parallel
-   @return        none */
+   @param[in]  task_args  pointer to plp_conv_instance_i8 struct initialized by
+                          plp_conv_i8_parallel_ws
+   @return     none
 
-// Pre-condition: psrcALen >= psrcBLen, established by calling function plp_conv_i8
+   @par Every core convolves one chunk of pSrcA with pSrcB into the scratch buffer. After a
+   barrier, the same team overlap-adds the partial results directly into pRes.
+*/
+
+// Pre-condition: psrcALen <= psrcBLen, established by calling function plp_conv_i8_parallel_ws
+// Pre-condition: pScratch has plp_conv_parallel_scratch_size(srcALen, srcBLen, nPE) elements
 // Pre-condition: pRes has enough allocated memory, i.e. srcALen + srcBLen-1u
-// Pre-condition: srcALen >= 2 and srcBLen >= 2, otherwise use vector dot product
 
 void plp_conv_i8p_xpulpv2(void *task_args) {
 
     plp_conv_instance_i8 *S = (plp_conv_instance_i8 *)task_args;
 
-    uint32_t resultoffset = ((S->srcALen + S->nPE - 1) / S->nPE) + S->srcBLen - 1;
+    uint32_t coreId = rt_core_id();
     uint32_t srcAoffset = ((S->srcALen + S->nPE - 1) / S->nPE);
-
-    int8_t *pSrcA;
-    uint32_t srcALen;
-    int8_t *pSrcB;
-    uint32_t srcBLen;
-    int32_t *pRes;
-
-    int8_t *pIn1;
-    int8_t *pIn2;
-    uint32_t pIn1Len;
-    uint32_t pIn2Len;
-
-    // Unpack partial convolution vectors
-    if (rt_core_id() == (S->nPE - 1)) {
-
-        pSrcA = (int8_t *)((S->pSrcA + srcAoffset * (S->nPE - 1)));
-        srcALen = S->srcALen - (srcAoffset * (S->nPE - 1));
-        pSrcB = (int8_t *)(S->pSrcB);
-        srcBLen = S->srcBLen;
-        pRes = (int32_t *)(S->pRes + resultoffset * (S->nPE - 1));
-
-    } else {
-
-        srcALen = srcAoffset;
-        pSrcA = (int8_t *)(S->pSrcA + (rt_core_id() * srcAoffset));
-        pSrcB = (int8_t *)S->pSrcB;
-        srcBLen = S->srcBLen;
-        pRes = (int32_t *)(S->pRes + resultoffset * (rt_core_id()));
+    uint32_t resultoffset = srcAoffset + S->srcBLen - 1;
+    // if srcALen is small, the last cores get no chunk and only take part in the overlap-add
+    uint32_t nChunks = (S->srcALen + srcAoffset - 1) / srcAoffset;
+
+    if (coreId < nChunks) {
+
+        const int8_t *pSrcA = S->pSrcA + coreId * srcAoffset;
+        uint32_t srcALen =
+            (coreId == nChunks - 1) ? S->srcALen - srcAoffset * (nChunks - 1) : srcAoffset;
+        int32_t *pRes = S->pScratch + resultoffset * coreId;
+
+        // Reorder vectors; longest first
+        if (srcALen >= S->srcBLen) {
+            plp_conv_i8s_xpulpv2(pSrcA, srcALen, S->pSrcB, S->srcBLen, pRes);
+        } else {
+            plp_conv_i8s_xpulpv2(S->pSrcB, S->srcBLen, pSrcA, srcALen, pRes);
+        }
     }
 
-    // Reorder vectors; longest first
-    if (srcALen >= srcBLen) {
-        pIn1 = pSrcA;
-        pIn1Len = srcALen;
-        pIn2 = pSrcB;
-        pIn2Len = srcBLen;
-    } else {
-        pIn1 = pSrcB;
-        pIn1Len = srcBLen;
-        pIn2 = pSrcA;
-        pIn2Len = srcALen;
-    }
-
-    plp_conv_i8s_xpulpv2(pIn1, pIn1Len, pIn2, pIn2Len, pRes);
     rt_team_barrier();
+
+    plp_conv_parallel_OLA_core(S->nPE, S->srcALen, S->srcBLen, S->pScratch, S->pRes);
 }
 
 /**
@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_parallel_OLA_core.c
+ * Description:  overlap-add of partial convolution results inside a team
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup BasicConvolution
+*/
+
+/**
+   @addtogroup BasicConvolutionKernels
+   @{
+*/
+
+/**
+   @brief Overlap-add of partial convolution results, called by every core of the team.
+   @param[in]  nPE       Number of processing cores
+   @param[in]  srcALen   Length of the (short) vector which is split among the cores
+   @param[in]  srcBLen   Length of the other vector
+   @param[in]  pScratch  partial results, srcAoffset + srcBLen - 1 elements apart
+   @param[out] pRes      output result returned here, of size srcALen + srcBLen - 1
+   @return     none
+
+   @par Partial result p starts at output p * srcAoffset, with srcAoffset = ceil(srcALen / nPE).
+   Therefore, every output knows which partial results overlap it, and every core sums up a
+   contiguous range of the outputs directly into pRes. This needs neither a reduction tree nor a
+   final copy. The caller must synchronize the team before, such that all partial results are
+   complete.
+*/
+
+void plp_conv_parallel_OLA_core(uint32_t nPE,
+                                uint32_t srcALen,
+                                uint32_t srcBLen,
+                                const int32_t *pScratch,
+                                int32_t *pRes) {
+
+    uint32_t srcAoffset = ((srcALen + nPE - 1) / nPE);
+    uint32_t resultsoffset = srcAoffset + srcBLen - 1;
+    uint32_t nChunks = (srcALen + srcAoffset - 1) / srcAoffset;
+    uint32_t lastLen = srcALen - srcAoffset * (nChunks - 1) + srcBLen - 1;
+    uint32_t resLen = srcALen + srcBLen - 1;
+
+    uint32_t chunk = (resLen + nPE - 1) / nPE;
+    uint32_t start = MIN(rt_core_id() * chunk, resLen);
+    uint32_t end = MIN(start + chunk, resLen);
+
+    for (uint32_t n = start; n < end; n++) {
+        int32_t p = MIN(n / srcAoffset, nChunks - 1); // last partial result overlapping n
+        uint32_t idx = n - p * srcAoffset;            // index of n inside partial result p
+        int32_t sum = 0;
+
+        // the last partial result may be shorter than the others
+        if (p == nChunks - 1) {
+            if (idx < lastLen) {
+                sum = pScratch[p * resultsoffset + idx];
+            }
+            p--;
+            idx += srcAoffset;
+        }
+
+        while (p >= 0 && idx < resultsoffset) {
+            sum += pScratch[p * resultsoffset + idx];
+            p--;
+            idx += srcAoffset;
+        }
+
+        pRes[n] = sum;
+    }
+}
+
+/**
+   @} end of BasicConvolutionKernels
+*/
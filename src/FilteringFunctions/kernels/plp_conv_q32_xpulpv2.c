@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_q32_xpulpv2.c
+ * Description:  Convolution of 32-bit fixed-point vectors for XPULPV2 extension
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// output sample n of the convolution, shifted and saturated
+static inline int32_t conv_q32_output(const int32_t *pSrcA,
+                                      uint32_t srcALen,
+                                      const int32_t *pSrcB,
+                                      uint32_t srcBLen,
+                                      uint32_t fracBits,
+                                      uint32_t n) {
+
+    uint32_t kMin = (n >= srcBLen) ? n - srcBLen + 1 : 0;
+    uint32_t kMax = (n < srcALen) ? n : srcALen - 1;
+    uint32_t k = kMin;
+    int64_t sum = 0;
+
+    for (; k <= kMax; k++) {
+        sum += (int64_t)pSrcA[k] * pSrcB[n - k];
+    }
+
+    if (fracBits > 0) {
+        sum = (sum + ((int64_t)1 << (fracBits - 1))) >> fracBits;
+    }
+
+    return (int32_t)((sum > 0x7FFFFFFF) ? 0x7FFFFFFF
+                                        : ((sum < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : sum));
+}
+
+/**
+   @ingroup BasicConvolution
+*/
+
+/**
+   @addtogroup BasicConvolutionKernels
+   @{
+*/
+
+/**
+  @brief Convolution of 32-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input vector
+  @param[in]  srcALen   length of the first input vector
+  @param[in]  pSrcB     points to the second input vector
+  @param[in]  srcBLen   length of the second input vector
+  @param[in]  fracBits  number of fractional bits of the output, see plp_conv_q32
+  @param[out] pRes      points to the srcALen+srcBLen-1 output samples
+  @return     none
+
+  @par Every output is a sum of 64-bit products, shifted and saturated to 32 bits before it is
+  stored.
+ */
+
+void plp_conv_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                           uint32_t srcALen,
+                           const int32_t *__restrict__ pSrcB,
+                           uint32_t srcBLen,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes) {
+
+    uint32_t n;
+
+    for (n = 0; n < srcALen + srcBLen - 1; n++) {
+        pRes[n] = conv_q32_output(pSrcA, srcALen, pSrcB, srcBLen, fracBits, n);
+    }
+}
+
+/**
+  @brief Parallel convolution of 32-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_conv_instance_q32 struct initialized by
+                    plp_conv_q32_parallel
+  @return     none
+ */
+
+void plp_conv_q32p_xpulpv2(void *args) {
+
+    plp_conv_instance_q32 *a = (plp_conv_instance_q32 *)args;
+
+    uint32_t n, start, end;
+
+    plp_team_chunk(a->srcALen + a->srcBLen - 1, a->nPE, rt_core_id(), 1, &start, &end);
+
+    for (n = start; n < end; n++) {
+        a->pRes[n] = conv_q32_output(a->pSrcA, a->srcALen, a->pSrcB, a->srcBLen, a->fracBits, n);
+    }
+}
+
+/**
+   @} end of BasicConvolutionKernels group
+*/
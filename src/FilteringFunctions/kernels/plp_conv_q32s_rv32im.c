@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_q32s_rv32im.c
+ * Description:  Convolution of 32-bit fixed-point vectors for RV32IM extension
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BasicConvolution
+*/
+
+/**
+   @addtogroup BasicConvolutionKernels
+   @{
+*/
+
+/**
+  @brief Convolution of 32-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]  pSrcA     points to the first input vector
+  @param[in]  srcALen   length of the first input vector
+  @param[in]  pSrcB     points to the second input vector
+  @param[in]  srcBLen   length of the second input vector
+  @param[in]  fracBits  number of fractional bits of the output, see plp_conv_q32
+  @param[out] pRes      points to the srcALen+srcBLen-1 output samples
+  @return     none
+ */
+
+void plp_conv_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                          uint32_t srcALen,
+                          const int32_t *__restrict__ pSrcB,
+                          uint32_t srcBLen,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes) {
+
+    uint32_t n, k, kMin, kMax;
+
+    for (n = 0; n < srcALen + srcBLen - 1; n++) {
+        int64_t acc = 0;
+        int64_t y;
+
+        kMin = (n >= srcBLen) ? n - srcBLen + 1 : 0;
+        kMax = (n < srcALen) ? n : srcALen - 1;
+        for (k = kMin; k <= kMax; k++) {
+            acc += (int64_t)pSrcA[k] * pSrcB[n - k];
+        }
+
+        y = acc;
+        if (fracBits > 0) {
+            y = (y + ((int64_t)1 << (fracBits - 1))) >> fracBits;
+        }
+        y = (y > 0x7FFFFFFF) ? 0x7FFFFFFF : y;
+        pRes[n] = (int32_t)((y < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : y);
+    }
+}
+
+/**
+   @} end of BasicConvolutionKernels group
+*/
@@ -0,0 +1,116 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_q8_xpulpv2.c
+ * Description:  Convolution of 8-bit fixed-point vectors for XPULPV2 extension
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// output sample n of the convolution, shifted and saturated
+static inline int8_t conv_q8_output(const int8_t *pSrcA,
+                                    uint32_t srcALen,
+                                    const int8_t *pSrcB,
+                                    uint32_t srcBLen,
+                                    uint32_t fracBits,
+                                    uint32_t n) {
+
+    uint32_t kMin = (n >= srcBLen) ? n - srcBLen + 1 : 0;
+    uint32_t kMax = (n < srcALen) ? n : srcALen - 1;
+    uint32_t k = kMin;
+    int32_t sum = 0;
+
+    for (; k + 3 <= kMax; k += 4) {
+        v4s b = *((v4s *)&pSrcB[n - k - 3]);
+        sum = __SUMDOTP4(*((v4s *)&pSrcA[k]), __builtin_shuffle(b, (v4s){ 3, 2, 1, 0 }), sum);
+    }
+
+    for (; k <= kMax; k++) {
+        sum += pSrcA[k] * pSrcB[n - k];
+    }
+
+    return (int8_t)__CLIP(__ROUNDNORM_REG(sum, fracBits), 7);
+}
+
+/**
+   @ingroup BasicConvolution
+*/
+
+/**
+   @addtogroup BasicConvolutionKernels
+   @{
+*/
+
+/**
+  @brief Convolution of 8-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input vector
+  @param[in]  srcALen   length of the first input vector
+  @param[in]  pSrcB     points to the second input vector
+  @param[in]  srcBLen   length of the second input vector
+  @param[in]  fracBits  number of fractional bits of the output, see plp_conv_q8
+  @param[out] pRes      points to the srcALen+srcBLen-1 output samples
+  @return     none
+
+  @par Every output is a sum of SIMD dot products of four samples of pSrcA with four reversed
+  samples of pSrcB. The sum is shifted and clipped to 8 bits before it is stored, such
+  that no intermediate 32-bit output buffer is needed.
+ */
+
+void plp_conv_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                          uint32_t srcALen,
+                          const int8_t *__restrict__ pSrcB,
+                          uint32_t srcBLen,
+                          uint32_t fracBits,
+                          int8_t *__restrict__ pRes) {
+
+    uint32_t n;
+
+    for (n = 0; n < srcALen + srcBLen - 1; n++) {
+        pRes[n] = conv_q8_output(pSrcA, srcALen, pSrcB, srcBLen, fracBits, n);
+    }
+}
+
+/**
+  @brief Parallel convolution of 8-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_conv_instance_q8 struct initialized by
+                    plp_conv_q8_parallel
+  @return     none
+ */
+
+void plp_conv_q8p_xpulpv2(void *args) {
+
+    plp_conv_instance_q8 *a = (plp_conv_instance_q8 *)args;
+
+    uint32_t n, start, end;
+
+    plp_team_chunk(a->srcALen + a->srcBLen - 1, a->nPE, rt_core_id(), 1, &start, &end);
+
+    for (n = start; n < end; n++) {
+        a->pRes[n] = conv_q8_output(a->pSrcA, a->srcALen, a->pSrcB, a->srcBLen, a->fracBits, n);
+    }
+}
+
+/**
+   @} end of BasicConvolutionKernels group
+*/
@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_i16s_rv32im.c
+ * Description:  16-bit integer convolution (valid) for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup BasicConvolution
+ */
+
+/**
+ * @addtogroup BasicConvolutionKernels
+ * @{
+ */
+
+/**
+ * @brief Convolution (valid) of 16-bit integer vectors kernel for RV32IM extension.
+ * @param[in]  pSrcA   points to the first input vector
+ * @param[in]  srcALen Length of the first input vector
+ * @param[in]  pSrcB   points to the second input vector
+ * @param[in]  srcBLen Length of the second input vector
+ * @param[out] pRes    output result returned here, of size srcALen - srcBLen + 1
+ * @return     none
+ */
+
+// Pre-condition: srcALen >= srcBLen, established by the calling function
+
+void plp_conv_valid_i16s_rv32im(const int16_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *pRes) {
+
+    uint32_t blkCnt = srcALen - srcBLen + 1; // number of outputs
+    const int16_t *pSrcBEnd = pSrcB + (srcBLen - 1U);
+    const int16_t *px; // Intermediate inputA pointer
+    const int16_t *py; // Intermediate inputB pointer
+    int32_t sum;
+    uint32_t k;
+
+    while (blkCnt > 0U) {
+        px = pSrcA++;
+        py = pSrcBEnd;
+        sum = 0;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+        k = srcBLen >> 2U;
+        while (k > 0U) {
+            sum += *px++ * *py--;
+            sum += *px++ * *py--;
+            sum += *px++ * *py--;
+            sum += *px++ * *py--;
+            k--;
+        }
+
+        k = srcBLen % 0x4U;
+#else
+        k = srcBLen;
+#endif /* #if defined (PLP_MATH_LOOPUNROLL) */
+
+        while (k > 0U) {
+            sum += *px++ * *py--;
+            k--;
+        }
+
+        *pRes++ = sum;
+        blkCnt--;
+    }
+}
+
+/**
+ * @} end of BasicConvolutionKernels
+ */
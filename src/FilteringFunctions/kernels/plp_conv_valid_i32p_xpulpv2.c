@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_i32p_xpulpv2.c
+ * Description:  parallel 32-bit integer convolution (valid) for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup BasicConvolution
+ */
+
+/**
+ * @addtogroup BasicConvolutionKernels
+ * @{
+ */
+
+/**
+ * @brief Parallel convolution (valid) of 32-bit integer vectors kernel for XPULPV2 extension.
+ * @param[in]  task_args  pointer to plp_conv_instance_i32 struct initialized by
+ *                        plp_conv_valid_i32_parallel
+ * @return     none
+ *
+ * @par Output n only depends on pSrcA[n] to pSrcA[n + srcBLen - 1]. Therefore, every core runs
+ * the single-core kernel on the slice of pSrcA that belongs to its output range.
+ */
+
+// Pre-condition: srcALen >= srcBLen, established by calling function plp_conv_valid_i32_parallel
+
+void plp_conv_valid_i32p_xpulpv2(void *task_args) {
+
+    plp_conv_instance_i32 *S = (plp_conv_instance_i32 *)task_args;
+
+    uint32_t resLen = S->srcALen - S->srcBLen + 1;
+
+    uint32_t chunk = (resLen + S->nPE - 1) / S->nPE;
+    uint32_t start = MIN(rt_core_id() * chunk, resLen);
+    uint32_t end = MIN(start + chunk, resLen);
+
+    if (end > start) {
+        plp_conv_valid_i32s_xpulpv2(S->pSrcA + start, end - start + S->srcBLen - 1, S->pSrcB,
+                                    S->srcBLen, S->pRes + start);
+    }
+}
+
+/**
+ * @} end of BasicConvolutionKernels
+ */
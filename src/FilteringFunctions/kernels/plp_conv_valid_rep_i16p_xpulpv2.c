@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_rep_i16p_xpulpv2.c
+ * Description:  parallel 16-bit integer convolution (valid with replication) for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup BasicConvolution
+ */
+
+/**
+ * @addtogroup BasicConvolutionKernels
+ * @{
+ */
+
+/**
+ * @brief Parallel convolution (valid with data replication) of 16-bit integer vectors kernel for
+ * XPULPV2 extension.
+ * @param[in]  task_args  pointer to plp_conv_valid_rep_instance_i16_parallel struct initialized by
+ *                        plp_conv_valid_rep_inst_i16_parallel
+ * @return     none
+ *
+ * @par Every core runs the single-core kernel on its own output range. The ranges start at a
+ * multiple of 4 elements, such that the word alignment of the replications is preserved.
+ */
+
+// Pre-condition: pSrcA replicated 2 times by plp_conv_valid_rep_init_i16, shifted by 1 element.
+// Pre-condition: srcALen >= srcBLen
+
+void plp_conv_valid_rep_i16p_xpulpv2(void *task_args) {
+
+    plp_conv_valid_rep_instance_i16_parallel *a =
+        (plp_conv_valid_rep_instance_i16_parallel *)task_args;
+
+    const plp_conv_valid_rep_instance_i16 *S = a->S;
+    uint32_t resLen = S->srcALen - a->srcBLen + 1;
+
+    uint32_t chunk = (((resLen + a->nPE - 1) / a->nPE) + 3) & ~0x3U;
+    uint32_t start = MIN(rt_core_id() * chunk, resLen);
+    uint32_t end = MIN(start + chunk, resLen);
+
+    if (end > start) {
+        plp_conv_valid_rep_i16s_xpulpv2(S->pSrcA + start, end - start + a->srcBLen - 1,
+                                        S->srcAMem, a->pSrcB, a->srcBLen, a->pRes + start);
+    }
+}
+
+/**
+ * @} end of BasicConvolutionKernels
+ */
@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_correlate_i8p_xpulpv2.c
+ * Description:  parallel 8-bit integer correlation for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static inline int32_t plp_correlate_i8_lag(const int8_t *pA,
+                                           const int8_t *pB,
+                                           uint32_t len) {
+
+    int32_t sum = 0;
+    uint32_t k;
+
+    for (k = 0; k + 3 < len; k += 4) {
+        sum = __SUMDOTP4(*((v4s *)&pA[k]), *((v4s *)&pB[k]), sum);
+    }
+    for (; k < len; k++) {
+        sum += pA[k] * pB[k];
+    }
+    return sum;
+}
+
+/**
+   @ingroup BasicCorrelation
+*/
+
+/**
+   @addtogroup BasicCorrelationKernels
+   @{
+*/
+
+/**
+   @brief Parallel correlation of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_conv_instance_i8 struct initialized by
+                          plp_correlate_i8_parallel
+   @return     none
+
+   @par Every core computes a contiguous range of output lags and writes it directly to pRes.
+   Output n is the correlation at lag n - (srcBLen - 1), i.e. the sum over k of
+   pSrcA[k] * pSrcB[k - n + srcBLen - 1].
+*/
+
+void plp_correlate_i8p_xpulpv2(void *task_args) {
+
+    plp_conv_instance_i8 *S = (plp_conv_instance_i8 *)task_args;
+
+    uint32_t srcALen = S->srcALen;
+    uint32_t srcBLen = S->srcBLen;
+    uint32_t resLen = srcALen + srcBLen - 1;
+
+    uint32_t chunk = (resLen + S->nPE - 1) / S->nPE;
+    uint32_t start = MIN(rt_core_id() * chunk, resLen);
+    uint32_t end = MIN(start + chunk, resLen);
+
+    for (uint32_t n = start; n < end; n++) {
+        if (n >= srcBLen - 1) {
+            // non-negative lag: pSrcA is shifted against the start of pSrcB
+            uint32_t m = n - (srcBLen - 1);
+            S->pRes[n] =
+                plp_correlate_i8_lag(S->pSrcA + m, S->pSrcB, MIN(srcALen - m, srcBLen));
+        } else {
+            // negative lag: pSrcB is shifted against the start of pSrcA
+            uint32_t m = (srcBLen - 1) - n;
+            S->pRes[n] =
+                plp_correlate_i8_lag(S->pSrcA, S->pSrcB + m, MIN(srcALen, srcBLen - m));
+        }
+    }
+}
+
+/**
+   @} end of BasicCorrelationKernels
+*/
@@ -0,0 +1,129 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_correlate_lags_f32s_xpulpv2.c
+ * Description:  Correlation lags of 32-bit floating-point vectors for XPULPV2 extension
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static void correlate_lags_f32_pair(const float32_t *pSrcA,
+                                    uint32_t srcALen,
+                                    const float32_t *pSrcB,
+                                    uint32_t srcBLen,
+                                    int32_t lag,
+                                    float32_t *pAcc);
+
+/**
+   @ingroup BasicCorrelation
+*/
+
+/**
+   @addtogroup BasicCorrelationKernels
+   @{
+*/
+
+/**
+  @brief Window of correlation lags of 32-bit floating-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input vector
+  @param[in]  srcALen   length of the first input vector
+  @param[in]  pSrcB     points to the second input vector
+  @param[in]  srcBLen   length of the second input vector
+  @param[in]  minLag    smallest lag to compute, may be negative
+  @param[in]  maxLag    largest lag to compute, at least minLag
+  @param[out] pDst      points to the maxLag-minLag+1 output values, starting with minLag
+  @return     none
+
+  @par Two neighbouring lags are computed at a time, such that every loaded sample is used by both
+  lags.
+ */
+
+void plp_correlate_lags_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
+                                     uint32_t srcALen,
+                                     const float32_t *__restrict__ pSrcB,
+                                     uint32_t srcBLen,
+                                     int32_t minLag,
+                                     int32_t maxLag,
+                                     float32_t *__restrict__ pDst) {
+
+    float32_t acc[2];
+    int32_t l;
+
+    for (l = minLag; l <= maxLag; l += 2) {
+        correlate_lags_f32_pair(pSrcA, srcALen, pSrcB, srcBLen, l, acc);
+        pDst[l - minLag] = acc[0];
+        if (l < maxLag) {
+            pDst[l + 1 - minLag] = acc[1];
+        }
+    }
+}
+
+/**
+   @} end of BasicCorrelationKernels group
+*/
+
+// sums of pSrcA[n + lag] * pSrcB[n] and pSrcA[n + lag + 1] * pSrcB[n] over the overlaps of both
+// vectors, every loaded sample of pSrcA is used by both lags
+static void correlate_lags_f32_pair(const float32_t *pSrcA,
+                                    uint32_t srcALen,
+                                    const float32_t *pSrcB,
+                                    uint32_t srcBLen,
+                                    int32_t lag,
+                                    float32_t *pAcc) {
+
+    int32_t start0 = (lag < 0) ? -lag : 0;
+    int32_t start1 = (lag + 1 < 0) ? -lag - 1 : 0;
+    int32_t end0 = MIN((int32_t)srcALen - lag, (int32_t)srcBLen);
+    int32_t end1 = MIN((int32_t)srcALen - lag - 1, (int32_t)srcBLen);
+    float32_t acc0 = 0;
+    float32_t acc1 = 0;
+    int32_t n = start0;
+
+    // both lags, end1 <= end0 and start1 <= start0
+    if (n < end1) {
+        float32_t y0 = pSrcA[n + lag];
+        for (; n < end1; n++) {
+            float32_t x = pSrcB[n];
+            float32_t y1 = pSrcA[n + lag + 1];
+            acc0 += y0 * x;
+            acc1 += y1 * x;
+            y0 = y1;
+        }
+    }
+
+    // last sample of the first lag
+    for (; n < end0; n++) {
+        acc0 += pSrcA[n + lag] * pSrcB[n];
+    }
+
+    // first sample of the second lag
+    if (start1 < start0 && start1 < end1) {
+        acc1 += pSrcA[start1 + lag + 1] * pSrcB[start1];
+    }
+
+    pAcc[0] = acc0;
+    pAcc[1] = acc1;
+}
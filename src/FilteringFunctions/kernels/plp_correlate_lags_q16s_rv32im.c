@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_correlate_lags_q16s_rv32im.c
+ * Description:  Correlation lags of 16-bit fixed-point vectors for RV32IM extension
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BasicCorrelation
+*/
+
+/**
+   @addtogroup BasicCorrelationKernels
+   @{
+*/
+
+/**
+  @brief Window of correlation lags of 16-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]  pSrcA     points to the first input vector
+  @param[in]  srcALen   length of the first input vector
+  @param[in]  pSrcB     points to the second input vector
+  @param[in]  srcBLen   length of the second input vector
+  @param[in]  minLag    smallest lag to compute, may be negative
+  @param[in]  maxLag    largest lag to compute, at least minLag
+  @param[in]  fracBits  number of fractional bits removed, see plp_correlate_lags_q16
+  @param[out] pDst      points to the maxLag-minLag+1 output values, starting with minLag
+  @return     none
+ */
+
+void plp_correlate_lags_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    uint32_t srcALen,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t srcBLen,
+                                    int32_t minLag,
+                                    int32_t maxLag,
+                                    uint32_t fracBits,
+                                    int32_t *__restrict__ pDst) {
+
+    int32_t l, n, start, end;
+
+    for (l = minLag; l <= maxLag; l++) {
+        int64_t acc = 0;
+
+        start = (l < 0) ? -l : 0;
+        end = ((int32_t)srcALen - l < (int32_t)srcBLen) ? (int32_t)srcALen - l : (int32_t)srcBLen;
+        for (n = start; n < end; n++) {
+            acc += (int32_t)pSrcA[n + l] * pSrcB[n];
+        }
+
+        if (fracBits > 0) {
+            acc = (acc + ((int64_t)1 << (fracBits - 1))) >> fracBits;
+        }
+        acc = (acc > 0x7FFFFFFF) ? 0x7FFFFFFF : acc;
+        pDst[l - minLag] = (int32_t)((acc < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : acc);
+    }
+}
+
+/**
+   @} end of BasicCorrelationKernels group
+*/
@@ -0,0 +1,167 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_correlate_lags_q16s_xpulpv2.c
+ * Description:  Correlation lags of 16-bit fixed-point vectors for XPULPV2 extension
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+// x * 2^-fracBits, rounded and saturated to 32 bits
+static inline int32_t saturate_q32(int64_t x, uint32_t fracBits) {
+    if (fracBits > 0) {
+        x = (x + ((int64_t)1 << (fracBits - 1))) >> fracBits;
+    }
+    return (int32_t)((x > 0x7FFFFFFF) ? 0x7FFFFFFF : ((x < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : x));
+}
+
+static uint32_t correlate_lags_q16_block_len(const int16_t *pSrcA,
+                                             uint32_t srcALen,
+                                             const int16_t *pSrcB,
+                                             uint32_t srcBLen);
+
+static int64_t correlate_lags_q16_lag(const int16_t *pSrcA,
+                                      uint32_t srcALen,
+                                      const int16_t *pSrcB,
+                                      uint32_t srcBLen,
+                                      int32_t lag,
+                                      uint32_t blockLen);
+
+/**
+   @ingroup BasicCorrelation
+*/
+
+/**
+   @addtogroup BasicCorrelationKernels
+   @{
+*/
+
+/**
+  @brief Window of correlation lags of 16-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input vector
+  @param[in]  srcALen   length of the first input vector
+  @param[in]  pSrcB     points to the second input vector
+  @param[in]  srcBLen   length of the second input vector
+  @param[in]  minLag    smallest lag to compute, may be negative
+  @param[in]  maxLag    largest lag to compute, at least minLag
+  @param[in]  fracBits  number of fractional bits removed, see plp_correlate_lags_q16
+  @param[out] pDst      points to the maxLag-minLag+1 output values, starting with minLag
+  @return     none
+
+  @par Every lag is a SIMD dot product of the overlapping parts of both vectors. The sums of
+  blocks of samples are accumulated in 32 bits and added up in 64 bits. The block length is
+  derived from the peak magnitudes of both vectors, such that a block cannot overflow.
+ */
+
+void plp_correlate_lags_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     uint32_t srcALen,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t srcBLen,
+                                     int32_t minLag,
+                                     int32_t maxLag,
+                                     uint32_t fracBits,
+                                     int32_t *__restrict__ pDst) {
+
+    uint32_t blockLen = correlate_lags_q16_block_len(pSrcA, srcALen, pSrcB, srcBLen);
+    int32_t l;
+
+    for (l = minLag; l <= maxLag; l++) {
+        int64_t acc = correlate_lags_q16_lag(pSrcA, srcALen, pSrcB, srcBLen, l, blockLen);
+        pDst[l - minLag] = saturate_q32(acc, fracBits);
+    }
+}
+
+/**
+   @} end of BasicCorrelationKernels group
+*/
+
+// peak magnitude of a vector
+static uint32_t peak_q16(const int16_t *pSrc, uint32_t len) {
+
+    uint32_t i;
+    uint32_t peak = 0;
+
+    for (i = 0; i < len; i++) {
+        uint32_t m = (pSrc[i] < 0) ? -pSrc[i] : pSrc[i];
+        peak = (m > peak) ? m : peak;
+    }
+
+    return peak;
+}
+
+// largest even number of products bounded by the peaks of the inputs that fit into 32 bits,
+// 0 if both peaks are -32768
+static uint32_t correlate_lags_q16_block_len(const int16_t *pSrcA,
+                                             uint32_t srcALen,
+                                             const int16_t *pSrcB,
+                                             uint32_t srcBLen) {
+
+    uint32_t bound = peak_q16(pSrcA, srcALen) * peak_q16(pSrcB, srcBLen);
+
+    return (bound == 0) ? 0xFFFFFFFE : (0x7FFFFFFF / bound) & ~1;
+}
+
+// sum of pSrcA[n + lag] * pSrcB[n] over the overlap of both vectors
+static int64_t correlate_lags_q16_lag(const int16_t *pSrcA,
+                                      uint32_t srcALen,
+                                      const int16_t *pSrcB,
+                                      uint32_t srcBLen,
+                                      int32_t lag,
+                                      uint32_t blockLen) {
+
+    int32_t start = (lag < 0) ? -lag : 0;
+    int32_t end = MIN((int32_t)srcALen - lag, (int32_t)srcBLen);
+    int64_t acc = 0;
+    uint32_t len, i, j;
+
+    if (end <= start) {
+        return 0;
+    }
+
+    const int16_t *pX = &pSrcA[start + lag];
+    const int16_t *pY = &pSrcB[start];
+    len = end - start;
+    i = 0;
+
+    if (blockLen > 0) {
+        while (i + 1 < len) {
+            uint32_t blockEnd = (len - i > blockLen) ? i + blockLen : len;
+            int32_t sum = 0;
+            for (j = i; j + 1 < blockEnd; j += 2) {
+                sum = __SUMDOTP2(*((v2s *)&pX[j]), *((v2s *)&pY[j]), sum);
+            }
+            acc += sum;
+            i = j;
+        }
+    }
+
+    // odd tail, or all products if both peaks are -32768
+    for (; i < len; i++) {
+        acc += (int32_t)pX[i] * pY[i];
+    }
+
+    return acc;
+}
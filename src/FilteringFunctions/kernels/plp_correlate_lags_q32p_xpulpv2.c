@@ -0,0 +1,131 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_correlate_lags_q32p_xpulpv2.c
+ * Description:  Parallel correlation lags of 32-bit fixed-point vectors for XPULPV2 extension
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+// x saturated to 32 bits
+static inline int32_t saturate_q32(int64_t x) {
+    return (int32_t)((x > 0x7FFFFFFF) ? 0x7FFFFFFF : ((x < -0x7FFFFFFF - 1) ? -0x7FFFFFFF - 1 : x));
+}
+
+static void correlate_lags_q32_pair(const int32_t *pSrcA,
+                                    uint32_t srcALen,
+                                    const int32_t *pSrcB,
+                                    uint32_t srcBLen,
+                                    int32_t lag,
+                                    uint32_t fracBits,
+                                    int64_t *pAcc);
+
+/**
+   @ingroup BasicCorrelation
+*/
+
+/**
+   @addtogroup BasicCorrelationKernels
+   @{
+*/
+
+/**
+  @brief Parallel window of correlation lags of 32-bit fixed-point vectors kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_correlate_lags_instance_q32 struct initialized by
+                    plp_correlate_lags_q32_parallel
+  @return     none
+
+  @par The lags are split into contiguous ranges, one per core, and every core computes its lags
+  as in plp_correlate_lags_q32s_xpulpv2.
+ */
+
+void plp_correlate_lags_q32p_xpulpv2(void *args) {
+
+    plp_correlate_lags_instance_q32 *a = (plp_correlate_lags_instance_q32 *)args;
+
+    int64_t acc[2];
+    uint32_t start, end, i;
+
+    plp_team_chunk(a->maxLag - a->minLag + 1, a->nPE, rt_core_id(), 1, &start, &end);
+
+    for (i = start; i < end; i += 2) {
+        correlate_lags_q32_pair(a->pSrcA, a->srcALen, a->pSrcB, a->srcBLen, a->minLag + (int32_t)i,
+                                a->fracBits, acc);
+        a->pDst[i] = saturate_q32(acc[0]);
+        if (i + 1 < end) {
+            a->pDst[i + 1] = saturate_q32(acc[1]);
+        }
+    }
+}
+
+/**
+   @} end of BasicCorrelationKernels group
+*/
+
+// sums of pSrcA[n + lag] * pSrcB[n] and pSrcA[n + lag + 1] * pSrcB[n] over the overlaps of both
+// vectors, every loaded sample of pSrcA is used by both lags
+static void correlate_lags_q32_pair(const int32_t *pSrcA,
+                                    uint32_t srcALen,
+                                    const int32_t *pSrcB,
+                                    uint32_t srcBLen,
+                                    int32_t lag,
+                                    uint32_t fracBits,
+                                    int64_t *pAcc) {
+
+    int32_t start0 = (lag < 0) ? -lag : 0;
+    int32_t start1 = (lag + 1 < 0) ? -lag - 1 : 0;
+    int32_t end0 = MIN((int32_t)srcALen - lag, (int32_t)srcBLen);
+    int32_t end1 = MIN((int32_t)srcALen - lag - 1, (int32_t)srcBLen);
+    int64_t acc0 = 0;
+    int64_t acc1 = 0;
+    int32_t n = start0;
+
+    // both lags, end1 <= end0 and start1 <= start0
+    if (n < end1) {
+        int32_t y0 = pSrcA[n + lag];
+        for (; n < end1; n++) {
+            int32_t x = pSrcB[n];
+            int32_t y1 = pSrcA[n + lag + 1];
+            acc0 += ((int64_t)y0 * x) >> fracBits;
+            acc1 += ((int64_t)y1 * x) >> fracBits;
+            y0 = y1;
+        }
+    }
+
+    // last sample of the first lag
+    for (; n < end0; n++) {
+        acc0 += ((int64_t)pSrcA[n + lag] * pSrcB[n]) >> fracBits;
+    }
+
+    // first sample of the second lag
+    if (start1 < start0 && start1 < end1) {
+        acc1 += ((int64_t)pSrcA[start1 + lag + 1] * pSrcB[start1]) >> fracBits;
+    }
+
+    pAcc[0] = acc0;
+    pAcc[1] = acc1;
+}
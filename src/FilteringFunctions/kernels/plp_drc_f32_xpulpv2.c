@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_drc_f32_xpulpv2.c
+ * Description:  Dynamic range compression of 32-bit floating-point streams for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Drc
+ */
+
+/**
+  @addtogroup DrcKernels
+  @{
+ */
+
+/**
+  @brief Dynamic range compressor of a 32-bit floating-point block kernel for XPULPV2 extension.
+  @param[in,out] S          points to the instance, initialized by plp_drc_init_f32
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     blockSize  number of input and output samples
+  @param[out]    pDst       points to the block of output samples, which may be pSrc
+  @return        none
+ */
+
+void plp_drc_f32s_xpulpv2(plp_drc_instance_f32 *S,
+                          const float32_t *pSrc,
+                          uint32_t blockSize,
+                          float32_t *pDst) {
+
+    float32_t peak = 0.0f;
+    float32_t env, d, gNew, gain, step;
+    uint32_t i;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    for (i = 0; i < blockSize; i++) {
+        float32_t a = (pSrc[i] < 0.0f) ? -pSrc[i] : pSrc[i];
+        peak = (a > peak) ? a : peak;
+    }
+
+    env = S->env;
+    d = peak - env;
+    env += ((d > 0.0f) ? S->attack : S->release) * d;
+    S->env = env;
+
+    gNew = S->makeup;
+    if (env > S->threshold) {
+        gNew *= powf(S->threshold / env, S->slope);
+    }
+
+    // the gain moves by step per sample from the last gain to the new one
+    step = (gNew - S->gain) / (float32_t)blockSize;
+    gain = S->gain;
+    S->gain = gNew;
+
+    for (i = 0; i < blockSize; i++) {
+        gain += step;
+        pDst[i] = pSrc[i] * gain;
+    }
+}
+
+/**
+  @brief Parallel multi-channel dynamic range compressor of 32-bit floating-point blocks kernel
+         for XPULPV2 extension.
+  @param[in]  args  pointer to plp_drc_instance_f32_parallel struct initialized by
+                    plp_drc_f32_parallel
+  @return     none
+
+  @par Core k processes the channels k, k+nPE, k+2*nPE, ... with plp_drc_f32s_xpulpv2. The
+  channels are independent, hence no synchronization is needed.
+ */
+
+void plp_drc_f32p_xpulpv2(void *args) {
+
+    plp_drc_instance_f32_parallel *a = (plp_drc_instance_f32_parallel *)args;
+
+    uint32_t blockSize = a->blockSize;
+    uint32_t c;
+
+    for (c = rt_core_id(); c < a->nChannels; c += a->nPE) {
+        plp_drc_f32s_xpulpv2(&a->S[c], &a->pSrc[c * blockSize], blockSize,
+                             &a->pDst[c * blockSize]);
+    }
+}
+
+/**
+  @} end of DrcKernels group
+ */
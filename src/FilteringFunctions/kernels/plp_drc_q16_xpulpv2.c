@@ -0,0 +1,188 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_drc_q16_xpulpv2.c
+ * Description:  Dynamic range compression of 16-bit fixed-point streams for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// natural logarithm of a positive integer in Q15, with the polynomial of plp_log_vec_q16
+static inline int32_t drc_q16_log(int32_t x) {
+
+    uint32_t n = __builtin_clz(x);
+    uint32_t m = (uint32_t)x << n; // mantissa in Q1.31
+    int32_t e = 31 - (int32_t)n;
+    int32_t d, acc;
+
+    if (m > 0xB504F333U) {
+        m >>= 1;
+        e++;
+    }
+    d = (int32_t)(m - 0x80000000U) >> 16;
+
+    acc = 5739;
+    acc = ((acc * d) >> 15) - 8962;
+    acc = ((acc * d) >> 15) + 11054;
+    acc = ((acc * d) >> 15) - 16359;
+    acc = ((acc * d) >> 15) + 32765;
+
+    return e * 22713 + ((acc * d) >> 15);
+}
+
+// updates the envelope with the block peak and returns the new gain in Q8.8
+static inline int32_t drc_q16_gain(plp_drc_instance_q16 *S, int32_t peak) {
+
+    int32_t env = S->env;
+    int32_t d = peak - env;
+    int32_t t, u, shift, acc;
+
+    env += (((d > 0) ? S->attack : S->release) * d) >> 15;
+    S->env = (int16_t)env;
+
+    if (env <= S->threshold) {
+        return S->makeup;
+    }
+
+    // log2 of (threshold / env)^slope in Q15, split into the power of two and the fraction u
+    t = drc_q16_log(env) - drc_q16_log(S->threshold);
+    t = -(int32_t)(((int64_t)S->slope * t * 47274) >> 30);
+    shift = -(t >> 15);
+    u = t & 0x7FFF;
+    if (shift > 16) {
+        return 0;
+    }
+
+    // 2^u in Q15 with the polynomial of plp_exp_vec_q16, scaled to the gain reduction in Q15
+    acc = 449;
+    acc = ((acc * u) >> 15) + 1694;
+    acc = ((acc * u) >> 15) + 7918;
+    acc = ((acc * u) >> 15) + 22707;
+    acc = ((acc * u) >> 15) + 32768;
+    if (shift > 0) {
+        acc = (acc + (1 << (shift - 1))) >> shift;
+    }
+
+    return (acc * S->makeup) >> 15;
+}
+
+/**
+  @ingroup Drc
+ */
+
+/**
+  @addtogroup DrcKernels
+  @{
+ */
+
+/**
+  @brief Dynamic range compressor of a 16-bit fixed-point block kernel for XPULPV2 extension.
+  @param[in,out] S          points to the instance, initialized by plp_drc_init_q16
+  @param[in]     pSrc       points to the block of input samples in Q1.15
+  @param[in]     blockSize  number of input and output samples
+  @param[out]    pDst       points to the block of output samples in Q1.15, which may be pSrc
+  @return        none
+
+  @par Exploiting SIMD instructions
+  The block peak is found with pv.max and pv.min on two samples at a time. XPULPV2 has no packed
+  16-bit multiplication, hence both samples of a word are multiplied with their gain like
+  p.mulsN, saturated with p.clip and packed back into one word with pv.pack.
+ */
+
+void plp_drc_q16s_xpulpv2(plp_drc_instance_q16 *S,
+                          const int16_t *pSrc,
+                          uint32_t blockSize,
+                          int16_t *pDst) {
+
+    v2s vMax = (v2s){ 0, 0 };
+    v2s vMin = (v2s){ 0, 0 };
+    int32_t peak, gNew, gain, step;
+    uint32_t i;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        v2s x = *((v2s *)&pSrc[i]);
+        vMax = __MAX2(vMax, x);
+        vMin = __MIN2(vMin, x);
+    }
+    if (i < blockSize) {
+        v2s x = (v2s){ pSrc[i], 0 };
+        vMax = __MAX2(vMax, x);
+        vMin = __MIN2(vMin, x);
+    }
+    peak = (vMax[0] > vMax[1]) ? vMax[0] : vMax[1];
+    peak = (-vMin[0] > peak) ? -vMin[0] : peak;
+    peak = (-vMin[1] > peak) ? -vMin[1] : peak;
+    peak = (peak > 0x7FFF) ? 0x7FFF : peak;
+
+    // the gain in Q8.24 moves by step per sample from the last gain to the new one
+    gNew = drc_q16_gain(S, peak);
+    step = (gNew - S->gain) * 65536 / (int32_t)blockSize;
+    gain = S->gain * 65536;
+    S->gain = (int16_t)gNew;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        v2s x = *((v2s *)&pSrc[i]);
+        int32_t g0 = (gain + step) >> 16;
+        int32_t g1 = (gain + 2 * step) >> 16;
+        int32_t y0 = __CLIP((x[0] * g0) >> 8, 15);
+        int32_t y1 = __CLIP((x[1] * g1) >> 8, 15);
+        *((v2s *)&pDst[i]) = __PACK2(y0, y1);
+        gain += 2 * step;
+    }
+    if (i < blockSize) {
+        pDst[i] = (int16_t)__CLIP((pSrc[i] * ((gain + step) >> 16)) >> 8, 15);
+    }
+}
+
+/**
+  @brief Parallel multi-channel dynamic range compressor of 16-bit fixed-point blocks kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_drc_instance_q16_parallel struct initialized by
+                    plp_drc_q16_parallel
+  @return     none
+
+  @par Core k processes the channels k, k+nPE, k+2*nPE, ... with plp_drc_q16s_xpulpv2. The
+  channels are independent, hence no synchronization is needed.
+ */
+
+void plp_drc_q16p_xpulpv2(void *args) {
+
+    plp_drc_instance_q16_parallel *a = (plp_drc_instance_q16_parallel *)args;
+
+    uint32_t blockSize = a->blockSize;
+    uint32_t c;
+
+    for (c = rt_core_id(); c < a->nChannels; c += a->nPE) {
+        plp_drc_q16s_xpulpv2(&a->S[c], &a->pSrc[c * blockSize], blockSize,
+                             &a->pDst[c * blockSize]);
+    }
+}
+
+/**
+  @} end of DrcKernels group
+ */
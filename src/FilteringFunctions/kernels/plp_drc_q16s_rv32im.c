@@ -0,0 +1,142 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_drc_q16s_rv32im.c
+ * Description:  Dynamic range compression of 16-bit fixed-point streams for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// natural logarithm of a positive integer in Q15, with the polynomial of plp_log_vec_q16
+static inline int32_t drc_q16_log(int32_t x) {
+
+    uint32_t n = __builtin_clz(x);
+    uint32_t m = (uint32_t)x << n; // mantissa in Q1.31
+    int32_t e = 31 - (int32_t)n;
+    int32_t d, acc;
+
+    if (m > 0xB504F333U) {
+        m >>= 1;
+        e++;
+    }
+    d = (int32_t)(m - 0x80000000U) >> 16;
+
+    acc = 5739;
+    acc = ((acc * d) >> 15) - 8962;
+    acc = ((acc * d) >> 15) + 11054;
+    acc = ((acc * d) >> 15) - 16359;
+    acc = ((acc * d) >> 15) + 32765;
+
+    return e * 22713 + ((acc * d) >> 15);
+}
+
+// updates the envelope with the block peak and returns the new gain in Q8.8
+static inline int32_t drc_q16_gain(plp_drc_instance_q16 *S, int32_t peak) {
+
+    int32_t env = S->env;
+    int32_t d = peak - env;
+    int32_t t, u, shift, acc;
+
+    env += (((d > 0) ? S->attack : S->release) * d) >> 15;
+    S->env = (int16_t)env;
+
+    if (env <= S->threshold) {
+        return S->makeup;
+    }
+
+    // log2 of (threshold / env)^slope in Q15, split into the power of two and the fraction u
+    t = drc_q16_log(env) - drc_q16_log(S->threshold);
+    t = -(int32_t)(((int64_t)S->slope * t * 47274) >> 30);
+    shift = -(t >> 15);
+    u = t & 0x7FFF;
+    if (shift > 16) {
+        return 0;
+    }
+
+    // 2^u in Q15 with the polynomial of plp_exp_vec_q16, scaled to the gain reduction in Q15
+    acc = 449;
+    acc = ((acc * u) >> 15) + 1694;
+    acc = ((acc * u) >> 15) + 7918;
+    acc = ((acc * u) >> 15) + 22707;
+    acc = ((acc * u) >> 15) + 32768;
+    if (shift > 0) {
+        acc = (acc + (1 << (shift - 1))) >> shift;
+    }
+
+    return (acc * S->makeup) >> 15;
+}
+
+/**
+  @ingroup Drc
+ */
+
+/**
+  @defgroup DrcKernels Dynamic Range Compressor Kernels
+  @{
+ */
+
+/**
+  @brief Dynamic range compressor of a 16-bit fixed-point block kernel for RV32IM extension.
+  @param[in,out] S          points to the instance, initialized by plp_drc_init_q16
+  @param[in]     pSrc       points to the block of input samples in Q1.15
+  @param[in]     blockSize  number of input and output samples
+  @param[out]    pDst       points to the block of output samples in Q1.15, which may be pSrc
+  @return        none
+ */
+
+void plp_drc_q16s_rv32im(plp_drc_instance_q16 *S,
+                         const int16_t *pSrc,
+                         uint32_t blockSize,
+                         int16_t *pDst) {
+
+    int32_t peak = 0;
+    int32_t gNew, gain, step, y;
+    uint32_t i;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    for (i = 0; i < blockSize; i++) {
+        int32_t a = (pSrc[i] < 0) ? -pSrc[i] : pSrc[i];
+        peak = (a > peak) ? a : peak;
+    }
+    peak = (peak > 0x7FFF) ? 0x7FFF : peak;
+
+    // the gain in Q8.24 moves by step per sample from the last gain to the new one
+    gNew = drc_q16_gain(S, peak);
+    step = (gNew - S->gain) * 65536 / (int32_t)blockSize;
+    gain = S->gain * 65536;
+    S->gain = (int16_t)gNew;
+
+    for (i = 0; i < blockSize; i++) {
+        gain += step;
+        y = (pSrc[i] * (gain >> 16)) >> 8;
+        pDst[i] = (int16_t)((y > 0x7FFF) ? 0x7FFF : (y < -0x8000) ? -0x8000 : y);
+    }
+}
+
+/**
+  @} end of DrcKernels group
+ */
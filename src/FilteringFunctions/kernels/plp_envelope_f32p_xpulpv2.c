@@ -0,0 +1,133 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_envelope_f32p_xpulpv2.c
+ * Description:  Parallel envelope detection of a 32-bit floating-point block for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static inline void plp_hilbert_fir_f32_outputs(const float32_t *pCoeffs,
+                                               const float32_t *pState,
+                                               uint32_t numTaps,
+                                               uint32_t start,
+                                               uint32_t end,
+                                               float32_t *pDst,
+                                               uint32_t stride) {
+
+    uint32_t n, m;
+    uint32_t nCoeffs = (numTaps + 1) / 2;
+
+    // two outputs at a time, sharing the coefficient loads
+    for (n = start; n + 1 < end; n += 2) {
+        const float32_t *px = &pState[n];
+        float32_t acc0 = 0.0f;
+        float32_t acc1 = 0.0f;
+        for (m = 0; m < nCoeffs; m++) {
+            float32_t c = pCoeffs[m];
+            acc0 += c * px[2 * m];
+            acc1 += c * px[2 * m + 1];
+        }
+        pDst[(n - start) * stride] = acc0;
+        pDst[(n + 1 - start) * stride] = acc1;
+    }
+
+    if (n < end) {
+        const float32_t *px = &pState[n];
+        float32_t acc0 = 0.0f;
+        for (m = 0; m < nCoeffs; m++) {
+            acc0 += pCoeffs[m] * px[2 * m];
+        }
+        pDst[(n - start) * stride] = acc0;
+    }
+}
+
+/**
+  @ingroup Envelope
+ */
+
+/**
+  @addtogroup EnvelopeKernels
+  @{
+ */
+
+/**
+  @brief Parallel envelope detection of a 32-bit floating-point block kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_hilbert_fir_instance_f32_parallel struct initialized by
+                    plp_envelope_f32_parallel
+  @return     none
+
+  @par Every core copies a contiguous chunk of an even number of input samples and computes the
+  envelope of the same chunk, with its own buffer on the stack. The cores synchronize before the
+  computation and before core 0 moves the state.
+ */
+
+void plp_envelope_f32p_xpulpv2(void *args) {
+
+    plp_hilbert_fir_instance_f32_parallel *a = (plp_hilbert_fir_instance_f32_parallel *)args;
+
+    const plp_hilbert_fir_instance_f32 *S = a->S;
+    uint32_t blockSize = a->blockSize;
+    uint32_t H = S->numTaps - 1;
+    float32_t *pState = S->pState;
+    uint32_t i, start, end;
+    uint32_t n, len;
+    uint32_t delay = (S->numTaps - 1) / 2;
+    float32_t buffer[2 * PLP_ENVELOPE_BUFFER_LEN];
+    float32_t *pBuf = buffer;
+
+    plp_team_chunk(blockSize, a->nPE, rt_core_id(), 2, &start, &end);
+
+    for (i = start; i < end; i++) {
+        pState[H + i] = a->pSrc[i];
+    }
+
+    plp_team_barrier();
+
+    for (n = start; n < end; n += len) {
+        len = MIN(PLP_ENVELOPE_BUFFER_LEN, end - n);
+
+        // analytic signal, interleaved as x[n-delay], y[n]
+        for (i = 0; i < len; i++) {
+            pBuf[2 * i] = pState[n + i + delay];
+        }
+        plp_hilbert_fir_f32_outputs(S->pCoeffs, pState, S->numTaps, n, n + len, pBuf + 1, 2);
+
+        plp_cmplx_mag_f32s_xpulpv2(pBuf, a->pDst + n, len);
+    }
+
+    plp_team_barrier();
+
+    if (rt_core_id() == 0) {
+        for (i = 0; i < H; i++) {
+            pState[i] = pState[i + blockSize];
+        }
+    }
+}
+
+/**
+  @} end of EnvelopeKernels group
+ */
@@ -0,0 +1,137 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_envelope_q16p_xpulpv2.c
+ * Description:  Parallel envelope detection of a 16-bit fixed-point block for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static inline void plp_hilbert_fir_q16_outputs(const int16_t *pCoeffs,
+                                               const int16_t *pState,
+                                               uint32_t numTaps,
+                                               uint32_t shift,
+                                               uint32_t start,
+                                               uint32_t end,
+                                               int16_t *pDst,
+                                               uint32_t stride) {
+
+    uint32_t n, m;
+    uint32_t nVec = (numTaps + 1) / 4; // number of coefficient vectors
+
+    // two outputs at a time, the even and odd samples of the same words are used by either output
+    for (n = start; n + 1 < end; n += 2) {
+        const int16_t *px = &pState[n];
+        int32_t acc0 = 0;
+        int32_t acc1 = 0;
+        for (m = 0; m < nVec; m++) {
+            v2s x0 = *((v2s *)&px[4 * m]);
+            v2s x1 = *((v2s *)&px[4 * m + 2]);
+            v2s c = *((v2s *)&pCoeffs[2 * m]);
+            acc0 = __SUMDOTP2(__builtin_shuffle(x0, x1, (v2s){ 0, 2 }), c, acc0);
+            acc1 = __SUMDOTP2(__builtin_shuffle(x0, x1, (v2s){ 1, 3 }), c, acc1);
+        }
+        pDst[(n - start) * stride] = (int16_t)__CLIP(__ROUNDNORM_REG(acc0, shift), 15);
+        pDst[(n + 1 - start) * stride] = (int16_t)__CLIP(__ROUNDNORM_REG(acc1, shift), 15);
+    }
+
+    if (n < end) {
+        const int16_t *px = &pState[n];
+        int32_t acc0 = 0;
+        for (m = 0; m < 2 * nVec; m++) {
+            acc0 += pCoeffs[m] * px[2 * m];
+        }
+        pDst[(n - start) * stride] = (int16_t)__CLIP(__ROUNDNORM_REG(acc0, shift), 15);
+    }
+}
+
+/**
+  @ingroup Envelope
+ */
+
+/**
+  @addtogroup EnvelopeKernels
+  @{
+ */
+
+/**
+  @brief Parallel envelope detection of a 16-bit fixed-point block kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_hilbert_fir_instance_q16_parallel struct initialized by
+                    plp_envelope_q16_parallel
+  @return     none
+
+  @par Every core copies a contiguous chunk of an even number of input samples and computes the
+  envelope of the same chunk, with its own buffer on the stack. The cores synchronize before the
+  computation and before core 0 moves the state.
+ */
+
+void plp_envelope_q16p_xpulpv2(void *args) {
+
+    plp_hilbert_fir_instance_q16_parallel *a = (plp_hilbert_fir_instance_q16_parallel *)args;
+
+    const plp_hilbert_fir_instance_q16 *S = a->S;
+    uint32_t blockSize = a->blockSize;
+    uint32_t H = S->numTaps - 1;
+    int16_t *pState = S->pState;
+    uint32_t i, start, end;
+    uint32_t n, len;
+    uint32_t delay = (S->numTaps - 1) / 2;
+    v2s buffer[PLP_ENVELOPE_BUFFER_LEN];
+    int16_t *pBuf = (int16_t *)buffer;
+
+    plp_team_chunk(blockSize, a->nPE, rt_core_id(), 2, &start, &end);
+
+    for (i = start; i < end; i++) {
+        pState[H + i] = a->pSrc[i];
+    }
+
+    plp_team_barrier();
+
+    for (n = start; n < end; n += len) {
+        len = MIN(PLP_ENVELOPE_BUFFER_LEN, end - n);
+
+        // analytic signal, interleaved as x[n-delay], y[n]
+        for (i = 0; i < len; i++) {
+            pBuf[2 * i] = pState[n + i + delay];
+        }
+        plp_hilbert_fir_q16_outputs(S->pCoeffs, pState,
+                                    S->numTaps, S->shift, n, n + len, pBuf + 1, 2);
+
+        plp_cmplx_mag_fast_q16s_xpulpv2(pBuf, a->pDst + n, len);
+    }
+
+    plp_team_barrier();
+
+    if (rt_core_id() == 0) {
+        for (i = 0; i < H; i++) {
+            pState[i] = pState[i + blockSize];
+        }
+    }
+}
+
+/**
+  @} end of EnvelopeKernels group
+ */
@@ -0,0 +1,171 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fftconv_f32_xpulpv2.c
+ * Description:  32-bit floating-point FFT convolution for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static inline void process_fftconv_f32(plp_fftconv_instance_f32 *S,
+                                       const float32_t *pSrc,
+                                       uint32_t numSamples,
+                                       float32_t *pDst,
+                                       uint32_t coreId,
+                                       uint32_t nPE);
+
+/**
+  @ingroup FFTConvolution
+ */
+
+/**
+  @defgroup FFTConvolutionKernels FFT Convolution Kernels
+  @{
+ */
+
+/**
+  @brief FFT convolution of a 32-bit floating-point stream for XPULPV2 extension.
+  @param[in,out] S           points to the instance, initialized by plp_fftconv_init_f32
+  @param[in]     pSrc        points to the next numSamples input samples
+  @param[in]     numSamples  number of input and output samples
+  @param[out]    pDst        points to the output buffer of numSamples samples
+  @return        none
+ */
+
+void plp_fftconv_f32s_xpulpv2(plp_fftconv_instance_f32 *S,
+                              const float32_t *__restrict__ pSrc,
+                              uint32_t numSamples,
+                              float32_t *__restrict__ pDst) {
+
+    process_fftconv_f32(S, pSrc, numSamples, pDst, 0, 1);
+}
+
+/**
+  @brief Parallel FFT convolution of a 32-bit floating-point stream for XPULPV2 extension.
+  @param[in]  args  pointer to plp_fftconv_instance_f32_parallel struct initialized by
+                    plp_fftconv_f32_parallel
+  @return     none
+
+  @par Every core computes a contiguous part of each block, and the transforms are computed by the
+  parallel kernels plp_rfft_f32_xpulpv2_parallel and plp_rifft_f32_xpulpv2_parallel, so the team is
+  only forked once per call.
+ */
+
+void plp_fftconv_f32p_xpulpv2(void *args) {
+
+    plp_fftconv_instance_f32_parallel *a = (plp_fftconv_instance_f32_parallel *)args;
+
+    process_fftconv_f32(a->S, a->pSrc, a->numSamples, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+  @} end of FFTConvolutionKernels group
+ */
+
+static inline void process_fftconv_f32(plp_fftconv_instance_f32 *S,
+                                       const float32_t *pSrc,
+                                       uint32_t numSamples,
+                                       float32_t *pDst,
+                                       uint32_t coreId,
+                                       uint32_t nPE) {
+
+    uint32_t o, n, k, nNew, start, end, chunk;
+    int32_t idx;
+    uint32_t N = S->S->FFTLength;
+    uint32_t H = S->filterLen - 1; // number of past samples needed for every output
+    uint32_t L = S->blockLen;
+    float32_t *pState = S->pState;
+    float32_t *pTime = S->pBuffer;
+    float32_t *pFreq = S->pBuffer + N;
+    const float32_t *pFilter = S->pFilterSpectrum;
+    plp_rfft_parallel_arg_f32 fftArgs = {
+        .S = (plp_rfft_instance_f32 *)S->S, .pSrc = pTime, .nPE = nPE, .pDst = pFreq
+    };
+    plp_rfft_parallel_arg_f32 ifftArgs = {
+        .S = (plp_rfft_instance_f32 *)S->S, .pSrc = pFreq, .nPE = nPE, .pDst = pTime
+    };
+
+    chunk = (N + nPE - 1) / nPE;
+    start = MIN(coreId * chunk, N);
+    end = MIN(start + chunk, N);
+
+    for (o = 0; o < numSamples; o += L) {
+        nNew = MIN(L, numSamples - o);
+
+        // input block: H past samples and nNew new samples, zero padded at the end of the stream
+        for (n = start; n < end; n++) {
+            idx = (int32_t)(o + n) - (int32_t)H;
+            if (idx < 0) {
+                pTime[n] = pState[H + idx];
+            } else if ((uint32_t)idx < numSamples) {
+                pTime[n] = pSrc[idx];
+            } else {
+                pTime[n] = 0.0f;
+            }
+        }
+
+        if (nPE > 1) {
+            rt_team_barrier();
+            plp_rfft_f32_xpulpv2_parallel(&fftArgs);
+        } else {
+            plp_rfft_f32_xpulpv2(S->S, pTime, pFreq);
+        }
+
+        for (k = start; k < end; k++) {
+            float32_t re = pFreq[2 * k];
+            float32_t im = pFreq[2 * k + 1];
+            pFreq[2 * k] = re * pFilter[2 * k] - im * pFilter[2 * k + 1];
+            pFreq[2 * k + 1] = re * pFilter[2 * k + 1] + im * pFilter[2 * k];
+        }
+
+        if (nPE > 1) {
+            rt_team_barrier();
+            plp_rifft_f32_xpulpv2_parallel(&ifftArgs);
+            rt_team_barrier();
+        } else {
+            plp_rifft_f32_xpulpv2(S->S, pFreq, pTime);
+        }
+
+        // the first H samples contain the circular wrap-around
+        for (n = start; n < end; n++) {
+            if (n >= H && n < H + nNew) {
+                pDst[o + n - H] = pTime[n];
+            }
+        }
+
+        if (nPE > 1) {
+            rt_team_barrier();
+        }
+    }
+
+    // keep the last H input samples
+    if (coreId == 0) {
+        for (n = 0; n < H; n++) {
+            idx = (int32_t)(numSamples + n) - (int32_t)H;
+            pState[n] = (idx < 0) ? pState[H + idx] : pSrc[idx];
+        }
+    }
+}
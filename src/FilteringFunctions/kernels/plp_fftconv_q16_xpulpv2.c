@@ -0,0 +1,194 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fftconv_q16_xpulpv2.c
+ * Description:  16-bit fixed-point FFT convolution for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+// sample x[idx - H] of the stream, where the H past samples are stored in pState
+static inline int16_t input_sample(const int16_t *pState,
+                                   const int16_t *pSrc,
+                                   uint32_t numSamples,
+                                   uint32_t H,
+                                   uint32_t idx) {
+    if (idx < H) {
+        return pState[idx];
+    } else if (idx - H < numSamples) {
+        return pSrc[idx - H];
+    } else {
+        return 0;
+    }
+}
+
+// x * 2^-shift, rounded and saturated to 16 bits
+static inline int16_t saturate_q16(int32_t x, int32_t shift) {
+    int64_t y;
+    if (shift > 0) {
+        y = ((int64_t)x + (1 << (shift - 1))) >> shift;
+    } else {
+        y = (int64_t)x << (-shift);
+    }
+    return (int16_t)((y > 32767) ? 32767 : ((y < -32768) ? -32768 : y));
+}
+
+static inline void process_fftconv_q16(plp_fftconv_instance_q16 *S,
+                                       const int16_t *pSrc,
+                                       uint32_t numSamples,
+                                       int16_t *pDst,
+                                       uint32_t coreId,
+                                       uint32_t nPE);
+
+/**
+  @ingroup FFTConvolution
+ */
+
+/**
+  @addtogroup FFTConvolutionKernels
+  @{
+ */
+
+/**
+  @brief FFT convolution of a 16-bit fixed-point stream for XPULPV2 extension.
+  @param[in,out] S           points to the instance, initialized by plp_fftconv_init_q16
+  @param[in]     pSrc        points to the next numSamples input samples
+  @param[in]     numSamples  number of input and output samples
+  @param[out]    pDst        points to the output buffer of numSamples samples
+  @return        none
+ */
+
+void plp_fftconv_q16s_xpulpv2(plp_fftconv_instance_q16 *S,
+                              const int16_t *__restrict__ pSrc,
+                              uint32_t numSamples,
+                              int16_t *__restrict__ pDst) {
+
+    process_fftconv_q16(S, pSrc, numSamples, pDst, 0, 1);
+}
+
+/**
+  @brief Parallel FFT convolution of a 16-bit fixed-point stream for XPULPV2 extension.
+  @param[in]  args  pointer to plp_fftconv_instance_q16_parallel struct initialized by
+                    plp_fftconv_q16_parallel
+  @return     none
+
+  @par Every core computes a contiguous part of each block, and the transforms are computed by the
+  parallel kernel plp_cfft_q32p_xpulpv2, so the team is only forked once per call.
+ */
+
+void plp_fftconv_q16p_xpulpv2(void *args) {
+
+    plp_fftconv_instance_q16_parallel *a = (plp_fftconv_instance_q16_parallel *)args;
+
+    process_fftconv_q16(a->S, a->pSrc, a->numSamples, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+  @} end of FFTConvolutionKernels group
+ */
+
+static inline void process_fftconv_q16(plp_fftconv_instance_q16 *S,
+                                       const int16_t *pSrc,
+                                       uint32_t numSamples,
+                                       int16_t *pDst,
+                                       uint32_t coreId,
+                                       uint32_t nPE) {
+
+    uint32_t o, n, k, nA, nB, start, end, chunk;
+    uint32_t N = S->S->fftLen;
+    uint32_t H = S->filterLen - 1; // number of past samples needed for every output
+    uint32_t L = S->blockLen;
+    int32_t shift = S->outShift;
+    int16_t *pState = S->pState;
+    int32_t *pBuf = S->pBuffer;
+    const int32_t *pFilter = S->pFilterSpectrum;
+    plp_cfft_instance_q32_parallel fftArgs = {
+        .S = S->S, .p1 = pBuf, .ifftFlag = 0, .bitReverseFlag = 1, .fracBits = 31, .nPE = nPE
+    };
+
+    chunk = (N + nPE - 1) / nPE;
+    start = MIN(coreId * chunk, N);
+    end = MIN(start + chunk, N);
+
+    for (o = 0; o < numSamples; o += 2 * L) {
+        nA = MIN(L, numSamples - o);
+        nB = (numSamples - o > L) ? MIN(L, numSamples - o - L) : 0;
+
+        // two input blocks of H past samples and L new samples in real and imaginary part, scaled
+        // to Q2.30 such that the magnitude of the complex values stays below one
+        for (n = start; n < end; n++) {
+            pBuf[2 * n] = (int32_t)input_sample(pState, pSrc, numSamples, H, o + n) << 15;
+            pBuf[2 * n + 1] = (int32_t)input_sample(pState, pSrc, numSamples, H, o + L + n) << 15;
+        }
+
+        if (nPE > 1) {
+            rt_team_barrier();
+            plp_cfft_q32p_xpulpv2(&fftArgs);
+            rt_team_barrier();
+        } else {
+            plp_cfft_q32s_xpulpv2(S->S, pBuf, 0, 1, 31);
+        }
+
+        // conj(X * filter), such that the forward transform computes the conjugated inverse
+        // transform
+        for (k = start; k < end; k++) {
+            int32_t re = pBuf[2 * k];
+            int32_t im = pBuf[2 * k + 1];
+            int32_t fRe = pFilter[2 * k];
+            int32_t fIm = pFilter[2 * k + 1];
+            pBuf[2 * k] = (int32_t)(((int64_t)re * fRe - (int64_t)im * fIm) >> 31);
+            pBuf[2 * k + 1] = (int32_t)((-(int64_t)re * fIm - (int64_t)im * fRe) >> 31);
+        }
+
+        if (nPE > 1) {
+            rt_team_barrier();
+            plp_cfft_q32p_xpulpv2(&fftArgs);
+            rt_team_barrier();
+        } else {
+            plp_cfft_q32s_xpulpv2(S->S, pBuf, 0, 1, 31);
+        }
+
+        // the first H samples contain the circular wrap-around, the second block is conjugated
+        for (n = start; n < end; n++) {
+            if (n >= H && n < H + nA) {
+                pDst[o + n - H] = saturate_q16(pBuf[2 * n], shift);
+            }
+            if (n >= H && n < H + nB) {
+                pDst[o + L + n - H] = saturate_q16(-pBuf[2 * n + 1], shift);
+            }
+        }
+        if (nPE > 1) {
+            rt_team_barrier();
+        }
+    }
+
+    // keep the last H input samples
+    if (coreId == 0) {
+        for (n = 0; n < H; n++) {
+            pState[n] = input_sample(pState, pSrc, numSamples, H, numSamples + n);
+        }
+    }
+}
@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_filter2d_box_i8s_xpulpv2.c
+ * Description:  Box filtering of 8-bit integer images kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup Filter2d
+ */
+
+/**
+ * @addtogroup Filter2dKernels
+ * @{
+ */
+
+/**
+ * @brief Box filtering of 8-bit integer images kernel for XPULPV2 extension.
+ * @param[in]  pSrc     points to the input image, srcRows x srcCols
+ * @param[in]  srcRows  number of rows of the input image
+ * @param[in]  srcCols  number of columns of the input image
+ * @param[in]  kRows    number of rows of the window
+ * @param[in]  kCols    number of columns of the window, at most
+ *                      PLP_FILTER2D_STRIP_LEN / 2, with kRows * kCols below 2^14
+ * @param[out] pDst     output image returned here, (srcRows - kRows + 1) x
+ *                      (srcCols - kCols + 1)
+ * @return     none
+ *
+ * @par The running sums along the rows, and the updates of the column sums, are unrolled
+ * by two, and the division by the window size is a multiplication with its reciprocal.
+ */
+
+void plp_filter2d_box_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                  uint32_t srcRows,
+                                  uint32_t srcCols,
+                                  uint32_t kRows,
+                                  uint32_t kCols,
+                                  int8_t *__restrict__ pDst) {
+
+    int32_t colSum[PLP_FILTER2D_STRIP_LEN]; // sums over the window rows of a strip
+
+    uint32_t outRows = srcRows - kRows + 1;
+    uint32_t outCols = srcCols - kCols + 1;
+    uint32_t step = PLP_FILTER2D_STRIP_LEN - kCols + 1; // outputs per strip
+    uint32_t area = kRows * kCols;
+    uint32_t shift;
+    uint32_t recip = plp_filter2d_box_recip(area, &shift);
+    uint32_t i, j, x0, r, c;
+
+    for (x0 = 0; x0 < outCols; x0 += step) {
+        uint32_t n = MIN(step, outCols - x0); // outputs of the strip
+        uint32_t width = n + kCols - 1;        // columns of the strip
+        const int8_t *pCol = pSrc + x0;
+
+        // sums over the first kRows rows
+        for (c = 0; c < width; c++) {
+            int32_t sum = 0;
+            for (r = 0; r < kRows; r++) {
+                sum += pCol[r * srcCols + c];
+            }
+            colSum[c] = sum;
+        }
+
+        for (i = 0; i < outRows; i++) {
+            int8_t *pOut = pDst + i * outCols + x0;
+            int32_t sum = 0;
+
+            for (c = 0; c < kCols; c++) {
+                sum += colSum[c];
+            }
+            pOut[0] = (int8_t)plp_filter2d_box_mean(sum, area, recip, shift);
+            for (j = 1; j + 1 < n; j += 2) {
+                int32_t sum1 = sum + colSum[j + kCols - 1] - colSum[j - 1];
+                sum = sum1 + colSum[j + kCols] - colSum[j];
+                pOut[j] = (int8_t)plp_filter2d_box_mean(sum1, area, recip, shift);
+                pOut[j + 1] = (int8_t)plp_filter2d_box_mean(sum, area, recip, shift);
+            }
+            if (j < n) {
+                sum += colSum[j + kCols - 1] - colSum[j - 1];
+                pOut[j] = (int8_t)plp_filter2d_box_mean(sum, area, recip, shift);
+            }
+
+            // move the window of the column sums down by one row
+            if (i + 1 < outRows) {
+                const int8_t *pOld = pCol + i * srcCols;
+                const int8_t *pNew = pOld + kRows * srcCols;
+                for (c = 0; c + 1 < width; c += 2) {
+                    int32_t d0 = pNew[c] - pOld[c];
+                    int32_t d1 = pNew[c + 1] - pOld[c + 1];
+                    colSum[c] += d0;
+                    colSum[c + 1] += d1;
+                }
+                if (c < width) {
+                    colSum[c] += pNew[c] - pOld[c];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @} end of Filter2dKernels group
+ */
@@ -0,0 +1,149 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_filter2d_separable_i16s_xpulpv2.c
+ * Description:  Separable 2D filtering of 16-bit integer images kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup Filter2d
+ */
+
+/**
+ * @addtogroup Filter2dKernels
+ * @{
+ */
+
+/**
+ * @brief Separable 2D filtering of 16-bit integer images kernel for XPULPV2 extension.
+ * @param[in]  pSrc      points to the input image, srcRows x srcCols
+ * @param[in]  srcRows   number of rows of the input image
+ * @param[in]  srcCols   number of columns of the input image
+ * @param[in]  pKernelY  points to the kRows taps of the vertical pass
+ * @param[in]  kRows     number of rows of the kernel
+ * @param[in]  pKernelX  points to the kCols taps of the horizontal pass
+ * @param[in]  kCols     number of columns of the kernel, at most
+ *                       PLP_FILTER2D_STRIP_LEN / 2
+ * @param[in]  shiftY    right shift of the vertical pass, rounded
+ * @param[in]  shift     right shift of the horizontal pass, rounded and saturated
+ * @param[out] pDst      output image returned here, (srcRows - kRows + 1) x
+ *                       (srcCols - kCols + 1)
+ * @return     none
+ *
+ * @par Exploiting SIMD instructions
+ * The vertical pass computes two columns at a time: the words of two rows are interleaved
+ * with pv.shuffle2.h into one word per column, and multiplied with two taps with pv.sdotsp.h.
+ * The horizontal pass computes two outputs at a time, which share the loads of the taps and
+ * of the intermediate values. p.addRN and p.clip round and saturate the results.
+ */
+
+void plp_filter2d_separable_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                         uint32_t srcRows,
+                                         uint32_t srcCols,
+                                         const int16_t *__restrict__ pKernelY,
+                                         uint32_t kRows,
+                                         const int16_t *__restrict__ pKernelX,
+                                         uint32_t kCols,
+                                         uint32_t shiftY,
+                                         uint32_t shift,
+                                         int16_t *__restrict__ pDst) {
+
+    const v2s maskLo = { 0, 2 };
+    const v2s maskHi = { 1, 3 };
+
+    int32_t tmp[PLP_FILTER2D_STRIP_LEN]; // vertical pass of a strip of the row
+
+    uint32_t outRows = srcRows - kRows + 1;
+    uint32_t outCols = srcCols - kCols + 1;
+    uint32_t step = PLP_FILTER2D_STRIP_LEN - kCols + 1; // outputs per strip
+    uint32_t i, j, x0, r, c;
+
+    for (i = 0; i < outRows; i++) {
+        for (x0 = 0; x0 < outCols; x0 += step) {
+            uint32_t n = MIN(step, outCols - x0); // outputs of the strip
+            uint32_t width = n + kCols - 1;        // intermediate values of the strip
+            const int16_t *pRow = pSrc + i * srcCols + x0;
+            int16_t *pOut = pDst + i * outCols + x0;
+
+            // vertical pass
+            for (c = 0; c + 1 < width; c += 2) {
+                const int16_t *pIn = pRow + c;
+                int32_t sum0 = 0;
+                int32_t sum1 = 0;
+                for (r = 0; r + 1 < kRows; r += 2) {
+                    v2s a = *((v2s *)pIn);             // row r, columns c and c + 1
+                    v2s b = *((v2s *)(pIn + srcCols)); // row r + 1
+                    v2s k = *((v2s *)&pKernelY[r]);
+                    sum0 = __SUMDOTP2(__builtin_shuffle(a, b, maskLo), k, sum0);
+                    sum1 = __SUMDOTP2(__builtin_shuffle(a, b, maskHi), k, sum1);
+                    pIn += 2 * srcCols;
+                }
+                if (r < kRows) {
+                    sum0 = __MAC(sum0, pIn[0], pKernelY[r]);
+                    sum1 = __MAC(sum1, pIn[1], pKernelY[r]);
+                }
+                tmp[c] = __ROUNDNORM_REG(sum0, shiftY);
+                tmp[c + 1] = __ROUNDNORM_REG(sum1, shiftY);
+            }
+            for (; c < width; c++) {
+                int32_t sum = 0;
+                for (r = 0; r < kRows; r++) {
+                    sum = __MAC(sum, pRow[r * srcCols + c], pKernelY[r]);
+                }
+                tmp[c] = __ROUNDNORM_REG(sum, shiftY);
+            }
+
+            // horizontal pass
+            for (j = 0; j + 1 < n; j += 2) {
+                int32_t sum0 = 0;
+                int32_t sum1 = 0;
+                int32_t t1 = tmp[j];
+                for (c = 0; c < kCols; c++) {
+                    int32_t k = pKernelX[c];
+                    int32_t t0 = t1;
+                    t1 = tmp[j + c + 1];
+                    sum0 = __MAC(sum0, t0, k);
+                    sum1 = __MAC(sum1, t1, k);
+                }
+                pOut[j] = (int16_t)__CLIP(__ROUNDNORM_REG(sum0, shift), 15);
+                pOut[j + 1] = (int16_t)__CLIP(__ROUNDNORM_REG(sum1, shift), 15);
+            }
+            if (j < n) {
+                int32_t sum = 0;
+                for (c = 0; c < kCols; c++) {
+                    sum = __MAC(sum, tmp[j + c], pKernelX[c]);
+                }
+                pOut[j] = (int16_t)__CLIP(__ROUNDNORM_REG(sum, shift), 15);
+            }
+        }
+    }
+}
+
+/**
+ * @} end of Filter2dKernels group
+ */
@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_filter2d_separable_i8s_rv32im.c
+ * Description:  Separable 2D filtering of 8-bit integer images kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup Filter2d
+ */
+
+/**
+ * @defgroup Filter2dKernels Separable 2D Filter Kernels
+ * This module contains the kernel codes of the separable 2D filters.
+ */
+
+/**
+ * @addtogroup Filter2dKernels
+ * @{
+ */
+
+/**
+ * @brief Separable 2D filtering of 8-bit integer images kernel for RV32IM extension.
+ * @param[in]  pSrc      points to the input image, srcRows x srcCols
+ * @param[in]  srcRows   number of rows of the input image
+ * @param[in]  srcCols   number of columns of the input image
+ * @param[in]  pKernelY  points to the kRows taps of the vertical pass
+ * @param[in]  kRows     number of rows of the kernel
+ * @param[in]  pKernelX  points to the kCols taps of the horizontal pass
+ * @param[in]  kCols     number of columns of the kernel, at most
+ *                       PLP_FILTER2D_STRIP_LEN / 2
+ * @param[in]  shiftY    right shift of the vertical pass, rounded
+ * @param[in]  shift     right shift of the horizontal pass, rounded and saturated
+ * @param[out] pDst      output image returned here, (srcRows - kRows + 1) x
+ *                       (srcCols - kCols + 1)
+ * @return     none
+ */
+
+void plp_filter2d_separable_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                       uint32_t srcRows,
+                                       uint32_t srcCols,
+                                       const int8_t *__restrict__ pKernelY,
+                                       uint32_t kRows,
+                                       const int8_t *__restrict__ pKernelX,
+                                       uint32_t kCols,
+                                       uint32_t shiftY,
+                                       uint32_t shift,
+                                       int8_t *__restrict__ pDst) {
+
+    int32_t tmp[PLP_FILTER2D_STRIP_LEN]; // vertical pass of a strip of the row
+
+    uint32_t outRows = srcRows - kRows + 1;
+    uint32_t outCols = srcCols - kCols + 1;
+    uint32_t step = PLP_FILTER2D_STRIP_LEN - kCols + 1; // outputs per strip
+    int32_t roundY = (1 << shiftY) >> 1;
+    int32_t round = (1 << shift) >> 1;
+    uint32_t i, j, x0, r, c;
+
+    for (i = 0; i < outRows; i++) {
+        for (x0 = 0; x0 < outCols; x0 += step) {
+            uint32_t n = MIN(step, outCols - x0); // outputs of the strip
+            uint32_t width = n + kCols - 1;        // intermediate values of the strip
+            const int8_t *pRow = pSrc + i * srcCols + x0;
+            int8_t *pOut = pDst + i * outCols + x0;
+
+            // vertical pass
+            for (c = 0; c < width; c++) {
+                int32_t sum = 0;
+                for (r = 0; r < kRows; r++) {
+                    sum += pKernelY[r] * pRow[r * srcCols + c];
+                }
+                tmp[c] = (sum + roundY) >> shiftY;
+            }
+
+            // horizontal pass
+            for (j = 0; j < n; j++) {
+                int32_t sum = 0;
+                for (c = 0; c < kCols; c++) {
+                    sum += pKernelX[c] * tmp[j + c];
+                }
+                sum = (sum + round) >> shift;
+                pOut[j] = (int8_t)((sum > 127) ? 127 : (sum < -128) ? -128 : sum);
+            }
+        }
+    }
+}
+
+/**
+ * @} end of Filter2dKernels group
+ */
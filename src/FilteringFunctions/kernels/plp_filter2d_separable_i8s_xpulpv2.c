@@ -0,0 +1,168 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_filter2d_separable_i8s_xpulpv2.c
+ * Description:  Separable 2D filtering of 8-bit integer images kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup Filter2d
+ */
+
+/**
+ * @addtogroup Filter2dKernels
+ * @{
+ */
+
+/**
+ * @brief Separable 2D filtering of 8-bit integer images kernel for XPULPV2 extension.
+ * @param[in]  pSrc      points to the input image, srcRows x srcCols
+ * @param[in]  srcRows   number of rows of the input image
+ * @param[in]  srcCols   number of columns of the input image
+ * @param[in]  pKernelY  points to the kRows taps of the vertical pass
+ * @param[in]  kRows     number of rows of the kernel
+ * @param[in]  pKernelX  points to the kCols taps of the horizontal pass
+ * @param[in]  kCols     number of columns of the kernel, at most
+ *                       PLP_FILTER2D_STRIP_LEN / 2
+ * @param[in]  shiftY    right shift of the vertical pass, rounded
+ * @param[in]  shift     right shift of the horizontal pass, rounded and saturated
+ * @param[out] pDst      output image returned here, (srcRows - kRows + 1) x
+ *                       (srcCols - kCols + 1)
+ * @return     none
+ *
+ * @par Exploiting SIMD instructions
+ * The vertical pass computes four columns at a time: the words of four rows are transposed
+ * with pv.shuffle2.b into one word per column, and multiplied with four taps with
+ * pv.sdotsp.b. The horizontal pass computes two outputs at a time, which share the loads of
+ * the taps and of the intermediate values. p.addRN and p.clip round and saturate the results.
+ */
+
+void plp_filter2d_separable_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                        uint32_t srcRows,
+                                        uint32_t srcCols,
+                                        const int8_t *__restrict__ pKernelY,
+                                        uint32_t kRows,
+                                        const int8_t *__restrict__ pKernelX,
+                                        uint32_t kCols,
+                                        uint32_t shiftY,
+                                        uint32_t shift,
+                                        int8_t *__restrict__ pDst) {
+
+    const v4s maskLo = { 0, 4, 1, 5 };
+    const v4s maskHi = { 2, 6, 3, 7 };
+    const v4s mask01 = { 0, 1, 4, 5 };
+    const v4s mask23 = { 2, 3, 6, 7 };
+
+    int32_t tmp[PLP_FILTER2D_STRIP_LEN]; // vertical pass of a strip of the row
+
+    uint32_t outRows = srcRows - kRows + 1;
+    uint32_t outCols = srcCols - kCols + 1;
+    uint32_t step = PLP_FILTER2D_STRIP_LEN - kCols + 1; // outputs per strip
+    uint32_t i, j, x0, r, c;
+
+    for (i = 0; i < outRows; i++) {
+        for (x0 = 0; x0 < outCols; x0 += step) {
+            uint32_t n = MIN(step, outCols - x0); // outputs of the strip
+            uint32_t width = n + kCols - 1;        // intermediate values of the strip
+            const int8_t *pRow = pSrc + i * srcCols + x0;
+            int8_t *pOut = pDst + i * outCols + x0;
+
+            // vertical pass
+            for (c = 0; c + 3 < width; c += 4) {
+                const int8_t *pIn = pRow + c;
+                int32_t sum0 = 0;
+                int32_t sum1 = 0;
+                int32_t sum2 = 0;
+                int32_t sum3 = 0;
+                for (r = 0; r + 3 < kRows; r += 4) {
+                    v4s r0 = *((v4s *)pIn); // row r, columns c to c + 3
+                    v4s r1 = *((v4s *)(pIn + srcCols));
+                    v4s r2 = *((v4s *)(pIn + 2 * srcCols));
+                    v4s r3 = *((v4s *)(pIn + 3 * srcCols));
+                    v4s k = *((v4s *)&pKernelY[r]);
+
+                    // transpose, such that x0 to x3 hold the four rows of one column each
+                    v4s t01Lo = __builtin_shuffle(r0, r1, maskLo);
+                    v4s t23Lo = __builtin_shuffle(r2, r3, maskLo);
+                    v4s t01Hi = __builtin_shuffle(r0, r1, maskHi);
+                    v4s t23Hi = __builtin_shuffle(r2, r3, maskHi);
+                    sum0 = __SUMDOTP4(__builtin_shuffle(t01Lo, t23Lo, mask01), k, sum0);
+                    sum1 = __SUMDOTP4(__builtin_shuffle(t01Lo, t23Lo, mask23), k, sum1);
+                    sum2 = __SUMDOTP4(__builtin_shuffle(t01Hi, t23Hi, mask01), k, sum2);
+                    sum3 = __SUMDOTP4(__builtin_shuffle(t01Hi, t23Hi, mask23), k, sum3);
+                    pIn += 4 * srcCols;
+                }
+                for (; r < kRows; r++) {
+                    sum0 = __MAC(sum0, pIn[0], pKernelY[r]);
+                    sum1 = __MAC(sum1, pIn[1], pKernelY[r]);
+                    sum2 = __MAC(sum2, pIn[2], pKernelY[r]);
+                    sum3 = __MAC(sum3, pIn[3], pKernelY[r]);
+                    pIn += srcCols;
+                }
+                tmp[c] = __ROUNDNORM_REG(sum0, shiftY);
+                tmp[c + 1] = __ROUNDNORM_REG(sum1, shiftY);
+                tmp[c + 2] = __ROUNDNORM_REG(sum2, shiftY);
+                tmp[c + 3] = __ROUNDNORM_REG(sum3, shiftY);
+            }
+            for (; c < width; c++) {
+                int32_t sum = 0;
+                for (r = 0; r < kRows; r++) {
+                    sum = __MAC(sum, pRow[r * srcCols + c], pKernelY[r]);
+                }
+                tmp[c] = __ROUNDNORM_REG(sum, shiftY);
+            }
+
+            // horizontal pass
+            for (j = 0; j + 1 < n; j += 2) {
+                int32_t sum0 = 0;
+                int32_t sum1 = 0;
+                int32_t t1 = tmp[j];
+                for (c = 0; c < kCols; c++) {
+                    int32_t k = pKernelX[c];
+                    int32_t t0 = t1;
+                    t1 = tmp[j + c + 1];
+                    sum0 = __MAC(sum0, t0, k);
+                    sum1 = __MAC(sum1, t1, k);
+                }
+                pOut[j] = (int8_t)__CLIP(__ROUNDNORM_REG(sum0, shift), 7);
+                pOut[j + 1] = (int8_t)__CLIP(__ROUNDNORM_REG(sum1, shift), 7);
+            }
+            if (j < n) {
+                int32_t sum = 0;
+                for (c = 0; c < kCols; c++) {
+                    sum = __MAC(sum, tmp[j + c], pKernelX[c]);
+                }
+                pOut[j] = (int8_t)__CLIP(__ROUNDNORM_REG(sum, shift), 7);
+            }
+        }
+    }
+}
+
+/**
+ * @} end of Filter2dKernels group
+ */
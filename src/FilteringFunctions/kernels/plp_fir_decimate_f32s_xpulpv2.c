@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_f32s_xpulpv2.c
+ * Description:  32-bit floating-point decimating FIR filter for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void plp_fir_decimate_f32_outputs(const float32_t *pCoeffs,
+                                                const float32_t *pState,
+                                                uint32_t numTaps,
+                                                uint32_t M,
+                                                uint32_t start,
+                                                uint32_t end,
+                                                float32_t *pDst) {
+
+    uint32_t m, k;
+
+    // two outputs at a time, sharing the coefficient loads
+    for (m = start; m + 1 < end; m += 2) {
+        const float32_t *px0 = &pState[m * M];
+        const float32_t *px1 = px0 + M;
+        float32_t acc0 = 0.0f;
+        float32_t acc1 = 0.0f;
+        for (k = 0; k < numTaps; k++) {
+            float32_t c = pCoeffs[k];
+            acc0 += c * px0[k];
+            acc1 += c * px1[k];
+        }
+        pDst[m] = acc0;
+        pDst[m + 1] = acc1;
+    }
+
+    if (m < end) {
+        const float32_t *px0 = &pState[m * M];
+        float32_t acc0 = 0.0f;
+        for (k = 0; k < numTaps; k++) {
+            acc0 += pCoeffs[k] * px0[k];
+        }
+        pDst[m] = acc0;
+    }
+}
+
+/**
+  @ingroup FIRDecimate
+ */
+
+/**
+  @addtogroup FIRDecimateKernels
+  @{
+ */
+
+/**
+  @brief Decimating FIR filtering of a 32-bit floating-point block kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_fir_decimate_init_f32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, the block size of the instance
+  @param[out] pDst       points to the blockSize/M output samples, which may be equal to pSrc
+  @return     none
+
+  @par The new samples are appended to the state buffer after the numTaps-1 previous samples. Only
+  every M-th output is computed as a dot product of the time-reversed coefficients with the state,
+  and two outputs are computed together to share the coefficient loads. Finally, the last
+  numTaps-1 samples are moved to the beginning of the state buffer.
+ */
+
+void plp_fir_decimate_f32s_xpulpv2(const plp_fir_decimate_instance_f32 *S,
+                                   const float32_t *pSrc,
+                                   uint32_t blockSize,
+                                   float32_t *pDst) {
+
+    uint32_t i;
+    uint32_t H = S->numTaps - 1;
+    float32_t *pState = S->pState;
+
+    for (i = 0; i < blockSize; i++) {
+        pState[H + i] = pSrc[i];
+    }
+
+    plp_fir_decimate_f32_outputs(S->pCoeffs, pState, S->numTaps, S->M, 0, blockSize / S->M, pDst);
+
+    for (i = 0; i < H; i++) {
+        pState[i] = pState[i + blockSize];
+    }
+}
+
+/**
+  @} end of FIRDecimateKernels group
+ */
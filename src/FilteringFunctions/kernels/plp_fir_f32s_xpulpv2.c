@@ -0,0 +1,112 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_f32s_xpulpv2.c
+ * Description:  32-bit floating-point FIR filter for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void plp_fir_f32_outputs(const float32_t *pCoeffs,
+                                       const float32_t *pState,
+                                       uint32_t numTaps,
+                                       uint32_t start,
+                                       uint32_t end,
+                                       float32_t *pDst) {
+
+    uint32_t n, k;
+
+    // two outputs at a time, sharing the coefficient loads
+    for (n = start; n + 1 < end; n += 2) {
+        const float32_t *px = &pState[n];
+        float32_t acc0 = 0.0f;
+        float32_t acc1 = 0.0f;
+        float32_t x0 = px[0];
+        for (k = 0; k < numTaps; k++) {
+            float32_t c = pCoeffs[k];
+            float32_t x1 = px[k + 1];
+            acc0 += c * x0;
+            acc1 += c * x1;
+            x0 = x1;
+        }
+        pDst[n] = acc0;
+        pDst[n + 1] = acc1;
+    }
+
+    if (n < end) {
+        const float32_t *px = &pState[n];
+        float32_t acc0 = 0.0f;
+        for (k = 0; k < numTaps; k++) {
+            acc0 += pCoeffs[k] * px[k];
+        }
+        pDst[n] = acc0;
+    }
+}
+
+/**
+  @ingroup FIR
+ */
+
+/**
+  @addtogroup FIRKernels
+  @{
+ */
+
+/**
+  @brief FIR filtering of a 32-bit floating-point block kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_fir_init_f32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input and output samples, at most the block size of the instance
+  @param[out] pDst       points to the block of output samples, which may be equal to pSrc
+  @return     none
+
+  @par The new samples are appended to the state buffer after the numTaps-1 previous samples. Every
+  output is a dot product of the time-reversed coefficients with a contiguous window of the state,
+  and two outputs are computed together to share the coefficient loads. Finally, the last
+  numTaps-1 samples are moved to the beginning of the state buffer.
+ */
+
+void plp_fir_f32s_xpulpv2(const plp_fir_instance_f32 *S,
+                          const float32_t *pSrc,
+                          uint32_t blockSize,
+                          float32_t *pDst) {
+
+    uint32_t i;
+    uint32_t H = S->numTaps - 1;
+    float32_t *pState = S->pState;
+
+    for (i = 0; i < blockSize; i++) {
+        pState[H + i] = pSrc[i];
+    }
+
+    plp_fir_f32_outputs(S->pCoeffs, pState, S->numTaps, 0, blockSize, pDst);
+
+    for (i = 0; i < H; i++) {
+        pState[i] = pState[i + blockSize];
+    }
+}
+
+/**
+  @} end of FIRKernels group
+ */
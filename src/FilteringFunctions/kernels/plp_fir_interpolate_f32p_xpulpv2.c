@@ -0,0 +1,132 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point interpolating FIR filter for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static inline void plp_fir_interpolate_f32_outputs(const float32_t *pCoeffs,
+                                                   const float32_t *pState,
+                                                   uint32_t P,
+                                                   uint32_t L,
+                                                   uint32_t start,
+                                                   uint32_t end,
+                                                   float32_t *pDst) {
+
+    uint32_t n, j, k;
+
+    for (n = start; n < end; n++) {
+        const float32_t *px = &pState[n];
+        float32_t *pOut = &pDst[n * L];
+
+        // two branches at a time, sharing the input loads
+        for (j = 0; j + 1 < L; j += 2) {
+            const float32_t *pc0 = &pCoeffs[j * P];
+            const float32_t *pc1 = pc0 + P;
+            float32_t acc0 = 0.0f;
+            float32_t acc1 = 0.0f;
+            for (k = 0; k < P; k++) {
+                float32_t x = px[k];
+                acc0 += pc0[k] * x;
+                acc1 += pc1[k] * x;
+            }
+            pOut[j] = acc0;
+            pOut[j + 1] = acc1;
+        }
+
+        if (j < L) {
+            const float32_t *pc0 = &pCoeffs[j * P];
+            float32_t acc0 = 0.0f;
+            for (k = 0; k < P; k++) {
+                acc0 += pc0[k] * px[k];
+            }
+            pOut[j] = acc0;
+        }
+    }
+}
+
+/**
+  @ingroup FIRInterpolate
+ */
+
+/**
+  @addtogroup FIRInterpolateKernels
+  @{
+ */
+
+/**
+  @brief Parallel interpolating FIR filtering of a 32-bit floating-point block kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_fir_interpolate_instance_f32_parallel struct initialized by
+                    plp_fir_interpolate_f32_parallel
+  @return     none
+
+  @par Every core copies a contiguous chunk of the input samples and computes a contiguous chunk of
+  the input samples. The cores synchronize before the computation and before core 0 moves the
+  state.
+ */
+
+void plp_fir_interpolate_f32p_xpulpv2(void *args) {
+
+    plp_fir_interpolate_instance_f32_parallel *a = (plp_fir_interpolate_instance_f32_parallel *)args;
+
+    const plp_fir_interpolate_instance_f32 *S = a->S;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    uint32_t core_id = rt_core_id();
+    uint32_t H = S->phaseLength - 1;
+    float32_t *pState = S->pState;
+    uint32_t i;
+
+    uint32_t chunk = (blockSize + nPE - 1) / nPE;
+    uint32_t start = MIN(core_id * chunk, blockSize);
+    uint32_t end = MIN(start + chunk, blockSize);
+
+    for (i = start; i < end; i++) {
+        pState[H + i] = a->pSrc[i];
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    plp_fir_interpolate_f32_outputs(S->pCoeffs, pState, S->phaseLength, S->L, start, end, a->pDst);
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    if (core_id == 0) {
+        for (i = 0; i < H; i++) {
+            pState[i] = pState[i + blockSize];
+        }
+    }
+}
+
+/**
+  @} end of FIRInterpolateKernels group
+ */
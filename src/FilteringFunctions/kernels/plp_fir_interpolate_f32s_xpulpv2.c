@@ -0,0 +1,116 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_f32s_xpulpv2.c
+ * Description:  32-bit floating-point interpolating FIR filter for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void plp_fir_interpolate_f32_outputs(const float32_t *pCoeffs,
+                                                   const float32_t *pState,
+                                                   uint32_t P,
+                                                   uint32_t L,
+                                                   uint32_t start,
+                                                   uint32_t end,
+                                                   float32_t *pDst) {
+
+    uint32_t n, j, k;
+
+    for (n = start; n < end; n++) {
+        const float32_t *px = &pState[n];
+        float32_t *pOut = &pDst[n * L];
+
+        // two branches at a time, sharing the input loads
+        for (j = 0; j + 1 < L; j += 2) {
+            const float32_t *pc0 = &pCoeffs[j * P];
+            const float32_t *pc1 = pc0 + P;
+            float32_t acc0 = 0.0f;
+            float32_t acc1 = 0.0f;
+            for (k = 0; k < P; k++) {
+                float32_t x = px[k];
+                acc0 += pc0[k] * x;
+                acc1 += pc1[k] * x;
+            }
+            pOut[j] = acc0;
+            pOut[j + 1] = acc1;
+        }
+
+        if (j < L) {
+            const float32_t *pc0 = &pCoeffs[j * P];
+            float32_t acc0 = 0.0f;
+            for (k = 0; k < P; k++) {
+                acc0 += pc0[k] * px[k];
+            }
+            pOut[j] = acc0;
+        }
+    }
+}
+
+/**
+  @ingroup FIRInterpolate
+ */
+
+/**
+  @addtogroup FIRInterpolateKernels
+  @{
+ */
+
+/**
+  @brief Interpolating FIR filtering of a 32-bit floating-point block kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_fir_interpolate_init_f32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, at most the block size of the instance
+  @param[out] pDst       points to the blockSize*L output samples
+  @return     none
+
+  @par The new samples are appended to the state buffer after the numTaps/L-1 previous samples.
+  For every input sample, each of the L polyphase branches computes one output, and two branches
+  are computed together to share the input loads. Finally, the last numTaps/L-1 samples are moved
+  to the beginning of the state buffer.
+ */
+
+void plp_fir_interpolate_f32s_xpulpv2(const plp_fir_interpolate_instance_f32 *S,
+                                      const float32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      float32_t *__restrict__ pDst) {
+
+    uint32_t i;
+    uint32_t H = S->phaseLength - 1;
+    float32_t *pState = S->pState;
+
+    for (i = 0; i < blockSize; i++) {
+        pState[H + i] = pSrc[i];
+    }
+
+    plp_fir_interpolate_f32_outputs(S->pCoeffs, pState, S->phaseLength, S->L, 0, blockSize, pDst);
+
+    for (i = 0; i < H; i++) {
+        pState[i] = pState[i + blockSize];
+    }
+}
+
+/**
+  @} end of FIRInterpolateKernels group
+ */
@@ -0,0 +1,142 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_q16p_xpulpv2.c
+ * Description:  parallel 16-bit fixed-point interpolating FIR filter for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static inline void plp_fir_interpolate_q16_outputs(const int16_t *pCoeffs,
+                                                   const int16_t *pState,
+                                                   uint32_t P,
+                                                   uint32_t L,
+                                                   uint32_t shift,
+                                                   uint32_t start,
+                                                   uint32_t end,
+                                                   int16_t *pDst) {
+
+    uint32_t n, j, k;
+    uint32_t nVec = P >> 1;    // number of vectors per branch
+    uint32_t nRem = nVec << 1; // first coefficient which is not part of a vector
+
+    for (n = start; n < end; n++) {
+        const int16_t *px = &pState[n];
+        int16_t *pOut = &pDst[n * L];
+
+        // two branches at a time, sharing the input loads
+        for (j = 0; j + 1 < L; j += 2) {
+            const int16_t *pc0 = &pCoeffs[j * P];
+            const int16_t *pc1 = pc0 + P;
+            int32_t acc0 = 0;
+            int32_t acc1 = 0;
+            for (k = 0; k < nVec; k++) {
+                v2s x = *((v2s *)&px[2 * k]);
+                acc0 = __SUMDOTP2(x, *((v2s *)&pc0[2 * k]), acc0);
+                acc1 = __SUMDOTP2(x, *((v2s *)&pc1[2 * k]), acc1);
+            }
+            for (k = nRem; k < P; k++) {
+                acc0 += pc0[k] * px[k];
+                acc1 += pc1[k] * px[k];
+            }
+            pOut[j] = (int16_t)__CLIP(__ROUNDNORM_REG(acc0, shift), 15);
+            pOut[j + 1] = (int16_t)__CLIP(__ROUNDNORM_REG(acc1, shift), 15);
+        }
+
+        if (j < L) {
+            const int16_t *pc0 = &pCoeffs[j * P];
+            int32_t acc0 = 0;
+            for (k = 0; k < nVec; k++) {
+                acc0 = __SUMDOTP2(*((v2s *)&px[2 * k]), *((v2s *)&pc0[2 * k]), acc0);
+            }
+            for (k = nRem; k < P; k++) {
+                acc0 += pc0[k] * px[k];
+            }
+            pOut[j] = (int16_t)__CLIP(__ROUNDNORM_REG(acc0, shift), 15);
+        }
+    }
+}
+
+/**
+  @ingroup FIRInterpolate
+ */
+
+/**
+  @addtogroup FIRInterpolateKernels
+  @{
+ */
+
+/**
+  @brief Parallel interpolating FIR filtering of a 16-bit fixed-point block kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_fir_interpolate_instance_q16_parallel struct initialized by
+                    plp_fir_interpolate_q16_parallel
+  @return     none
+
+  @par Every core copies a contiguous chunk of the input samples and computes a contiguous chunk of
+  the input samples. The cores synchronize before the computation and before core 0 moves the
+  state.
+ */
+
+void plp_fir_interpolate_q16p_xpulpv2(void *args) {
+
+    plp_fir_interpolate_instance_q16_parallel *a = (plp_fir_interpolate_instance_q16_parallel *)args;
+
+    const plp_fir_interpolate_instance_q16 *S = a->S;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    uint32_t core_id = rt_core_id();
+    uint32_t H = S->phaseLength - 1;
+    int16_t *pState = S->pState;
+    uint32_t i;
+
+    uint32_t chunk = (blockSize + nPE - 1) / nPE;
+    uint32_t start = MIN(core_id * chunk, blockSize);
+    uint32_t end = MIN(start + chunk, blockSize);
+
+    for (i = start; i < end; i++) {
+        pState[H + i] = a->pSrc[i];
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    plp_fir_interpolate_q16_outputs(S->pCoeffs, pState, S->phaseLength, S->L, S->shift, start, end, a->pDst);
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    if (core_id == 0) {
+        for (i = 0; i < H; i++) {
+            pState[i] = pState[i + blockSize];
+        }
+    }
+}
+
+/**
+  @} end of FIRInterpolateKernels group
+ */
@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_q32s_rv32im.c
+ * Description:  32-bit fixed-point interpolating FIR filter for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// sum * 2^-shift, rounded and saturated to 32 bits
+static inline int32_t saturate_q32(int64_t sum, uint32_t shift) {
+    int64_t val = (sum + (((int64_t)1 << shift) >> 1)) >> shift;
+    if (val > 0x7FFFFFFFLL) {
+        val = 0x7FFFFFFFLL;
+    } else if (val < -0x80000000LL) {
+        val = -0x80000000LL;
+    }
+    return (int32_t)val;
+}
+
+static inline void plp_fir_interpolate_q32_outputs(const int32_t *pCoeffs,
+                                                   const int32_t *pState,
+                                                   uint32_t P,
+                                                   uint32_t L,
+                                                   uint32_t shift,
+                                                   uint32_t start,
+                                                   uint32_t end,
+                                                   int32_t *pDst) {
+
+    uint32_t n, j, k;
+
+    for (n = start; n < end; n++) {
+        const int32_t *px = &pState[n];
+        for (j = 0; j < L; j++) {
+            const int32_t *pc = &pCoeffs[j * P];
+            int64_t acc = 0;
+            for (k = 0; k < P; k++) {
+                acc += (int64_t)pc[k] * px[k];
+            }
+            pDst[n * L + j] = saturate_q32(acc, shift);
+        }
+    }
+}
+
+/**
+  @ingroup FIRInterpolate
+ */
+
+/**
+  @addtogroup FIRInterpolateKernels
+  @{
+ */
+
+/**
+  @brief Interpolating FIR filtering of a 32-bit fixed-point block kernel for RV32IM extension.
+  @param[in]  S          points to the instance, initialized by plp_fir_interpolate_init_q32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, at most the block size of the instance
+  @param[out] pDst       points to the blockSize*L output samples
+  @return     none
+ */
+
+void plp_fir_interpolate_q32s_rv32im(const plp_fir_interpolate_instance_q32 *S,
+                                     const int32_t *__restrict__ pSrc,
+                                     uint32_t blockSize,
+                                     int32_t *__restrict__ pDst) {
+
+    uint32_t i;
+    uint32_t H = S->phaseLength - 1;
+    int32_t *pState = S->pState;
+
+    for (i = 0; i < blockSize; i++) {
+        pState[H + i] = pSrc[i];
+    }
+
+    plp_fir_interpolate_q32_outputs(S->pCoeffs, pState, S->phaseLength, S->L, S->shift, 0, blockSize, pDst);
+
+    for (i = 0; i < H; i++) {
+        pState[i] = pState[i + blockSize];
+    }
+}
+
+/**
+  @} end of FIRInterpolateKernels group
+ */
@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_q32s_xpulpv2.c
+ * Description:  32-bit fixed-point interpolating FIR filter for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// sum * 2^-shift, rounded and saturated to 32 bits
+static inline int32_t saturate_q32(int64_t sum, uint32_t shift) {
+    int64_t val = (sum + (((int64_t)1 << shift) >> 1)) >> shift;
+    if (val > 0x7FFFFFFFLL) {
+        val = 0x7FFFFFFFLL;
+    } else if (val < -0x80000000LL) {
+        val = -0x80000000LL;
+    }
+    return (int32_t)val;
+}
+
+static inline void plp_fir_interpolate_q32_outputs(const int32_t *pCoeffs,
+                                                   const int32_t *pState,
+                                                   uint32_t P,
+                                                   uint32_t L,
+                                                   uint32_t shift,
+                                                   uint32_t start,
+                                                   uint32_t end,
+                                                   int32_t *pDst) {
+
+    uint32_t n, j, k;
+
+    for (n = start; n < end; n++) {
+        const int32_t *px = &pState[n];
+        int32_t *pOut = &pDst[n * L];
+
+        // two branches at a time, sharing the input loads
+        for (j = 0; j + 1 < L; j += 2) {
+            const int32_t *pc0 = &pCoeffs[j * P];
+            const int32_t *pc1 = pc0 + P;
+            int64_t acc0 = 0;
+            int64_t acc1 = 0;
+            for (k = 0; k < P; k++) {
+                int32_t x = px[k];
+                acc0 += (int64_t)pc0[k] * x;
+                acc1 += (int64_t)pc1[k] * x;
+            }
+            pOut[j] = saturate_q32(acc0, shift);
+            pOut[j + 1] = saturate_q32(acc1, shift);
+        }
+
+        if (j < L) {
+            const int32_t *pc0 = &pCoeffs[j * P];
+            int64_t acc0 = 0;
+            for (k = 0; k < P; k++) {
+                acc0 += (int64_t)pc0[k] * px[k];
+            }
+            pOut[j] = saturate_q32(acc0, shift);
+        }
+    }
+}
+
+/**
+  @ingroup FIRInterpolate
+ */
+
+/**
+  @addtogroup FIRInterpolateKernels
+  @{
+ */
+
+/**
+  @brief Interpolating FIR filtering of a 32-bit fixed-point block kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_fir_interpolate_init_q32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, at most the block size of the instance
+  @param[out] pDst       points to the blockSize*L output samples
+  @return     none
+
+  @par The new samples are appended to the state buffer after the numTaps/L-1 previous samples.
+  For every input sample, each of the L polyphase branches computes one output, and two branches
+  are computed together to share the input loads. Finally, the last numTaps/L-1 samples are moved
+  to the beginning of the state buffer.
+ */
+
+void plp_fir_interpolate_q32s_xpulpv2(const plp_fir_interpolate_instance_q32 *S,
+                                      const int32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      int32_t *__restrict__ pDst) {
+
+    uint32_t i;
+    uint32_t H = S->phaseLength - 1;
+    int32_t *pState = S->pState;
+
+    for (i = 0; i < blockSize; i++) {
+        pState[H + i] = pSrc[i];
+    }
+
+    plp_fir_interpolate_q32_outputs(S->pCoeffs, pState, S->phaseLength, S->L, S->shift, 0, blockSize, pDst);
+
+    for (i = 0; i < H; i++) {
+        pState[i] = pState[i + blockSize];
+    }
+}
+
+/**
+  @} end of FIRInterpolateKernels group
+ */
@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_q16s_rv32im.c
+ * Description:  16-bit fixed-point FIR filter for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// sum * 2^-shift, rounded and saturated to 16 bits
+static inline int16_t saturate_q16(int32_t sum, uint32_t shift) {
+    int32_t val = (sum + ((1 << shift) >> 1)) >> shift;
+#if defined(PLP_MATH_BOUNDED_LATENCY)
+    val = plp_clip_bounded_i32(val, -(1 << 15), (1 << 15) - 1);
+#else
+    if (val > (1 << 15) - 1) {
+        val = (1 << 15) - 1;
+    } else if (val < -(1 << 15)) {
+        val = -(1 << 15);
+    }
+#endif
+    return (int16_t)val;
+}
+
+static inline void plp_fir_q16_outputs(const int16_t *pCoeffs,
+                                       const int16_t *pState,
+                                       uint32_t numTaps,
+                                       uint32_t shift,
+                                       uint32_t start,
+                                       uint32_t end,
+                                       int16_t *pDst) {
+
+    uint32_t n, k;
+
+    for (n = start; n < end; n++) {
+        const int16_t *px = &pState[n];
+        int32_t acc = 0;
+        for (k = 0; k < numTaps; k++) {
+            acc += pCoeffs[k] * px[k];
+        }
+        pDst[n] = saturate_q16(acc, shift);
+    }
+}
+
+/**
+  @ingroup FIR
+ */
+
+/**
+  @addtogroup FIRKernels
+  @{
+ */
+
+/**
+  @brief FIR filtering of a 16-bit fixed-point block kernel for RV32IM extension.
+  @param[in]  S          points to the instance, initialized by plp_fir_init_q16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input and output samples, at most the block size of the instance
+  @param[out] pDst       points to the block of output samples, which may be equal to pSrc
+  @return     none
+ */
+
+void plp_fir_q16s_rv32im(const plp_fir_instance_q16 *S,
+                         const int16_t *pSrc,
+                         uint32_t blockSize,
+                         int16_t *pDst) {
+
+    uint32_t i;
+    uint32_t H = S->numTaps - 1;
+    int16_t *pState = S->pState;
+
+    for (i = 0; i < blockSize; i++) {
+        pState[H + i] = pSrc[i];
+    }
+
+    plp_fir_q16_outputs(S->pCoeffs, pState, S->numTaps, S->shift, 0, blockSize, pDst);
+
+    for (i = 0; i < H; i++) {
+        pState[i] = pState[i + blockSize];
+    }
+}
+
+/**
+  @} end of FIRKernels group
+ */
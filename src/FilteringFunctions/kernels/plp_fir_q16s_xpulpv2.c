@@ -0,0 +1,119 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point FIR filter for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void plp_fir_q16_outputs(const int16_t *pCoeffs,
+                                       const int16_t *pState,
+                                       uint32_t numTaps,
+                                       uint32_t shift,
+                                       uint32_t start,
+                                       uint32_t end,
+                                       int16_t *pDst) {
+
+    uint32_t n, k;
+    uint32_t nVec = numTaps >> 1; // number of coefficient vectors
+    uint32_t nRem = nVec << 1;    // first coefficient which is not part of a vector
+
+    // two outputs at a time, sharing the coefficient loads
+    for (n = start; n + 1 < end; n += 2) {
+        const int16_t *px = &pState[n];
+        int32_t acc0 = 0;
+        int32_t acc1 = 0;
+        for (k = 0; k < nVec; k++) {
+            v2s c = *((v2s *)&pCoeffs[2 * k]);
+            acc0 = __SUMDOTP2(*((v2s *)&px[2 * k]), c, acc0);
+            acc1 = __SUMDOTP2(*((v2s *)&px[2 * k + 1]), c, acc1);
+        }
+        for (k = nRem; k < numTaps; k++) {
+            acc0 += pCoeffs[k] * px[k];
+            acc1 += pCoeffs[k] * px[k + 1];
+        }
+        pDst[n] = (int16_t)__CLIP(__ROUNDNORM_REG(acc0, shift), 15);
+        pDst[n + 1] = (int16_t)__CLIP(__ROUNDNORM_REG(acc1, shift), 15);
+    }
+
+    if (n < end) {
+        const int16_t *px = &pState[n];
+        int32_t acc0 = 0;
+        for (k = 0; k < nVec; k++) {
+            acc0 = __SUMDOTP2(*((v2s *)&px[2 * k]), *((v2s *)&pCoeffs[2 * k]), acc0);
+        }
+        for (k = nRem; k < numTaps; k++) {
+            acc0 += pCoeffs[k] * px[k];
+        }
+        pDst[n] = (int16_t)__CLIP(__ROUNDNORM_REG(acc0, shift), 15);
+    }
+}
+
+/**
+  @ingroup FIR
+ */
+
+/**
+  @addtogroup FIRKernels
+  @{
+ */
+
+/**
+  @brief FIR filtering of a 16-bit fixed-point block kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_fir_init_q16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input and output samples, at most the block size of the instance
+  @param[out] pDst       points to the block of output samples, which may be equal to pSrc
+  @return     none
+
+  @par The new samples are appended to the state buffer after the numTaps-1 previous samples. Every
+  output is a dot product of the time-reversed coefficients with a contiguous window of the state,
+  and two outputs are computed together to share the coefficient loads. Finally, the last
+  numTaps-1 samples are moved to the beginning of the state buffer.
+ */
+
+void plp_fir_q16s_xpulpv2(const plp_fir_instance_q16 *S,
+                          const int16_t *pSrc,
+                          uint32_t blockSize,
+                          int16_t *pDst) {
+
+    uint32_t i;
+    uint32_t H = S->numTaps - 1;
+    int16_t *pState = S->pState;
+
+    for (i = 0; i < blockSize; i++) {
+        pState[H + i] = pSrc[i];
+    }
+
+    plp_fir_q16_outputs(S->pCoeffs, pState, S->numTaps, S->shift, 0, blockSize, pDst);
+
+    for (i = 0; i < H; i++) {
+        pState[i] = pState[i + blockSize];
+    }
+}
+
+/**
+  @} end of FIRKernels group
+ */
@@ -0,0 +1,139 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_q32p_xpulpv2.c
+ * Description:  parallel 32-bit fixed-point FIR filter for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+// sum * 2^-shift, rounded and saturated to 32 bits
+static inline int32_t saturate_q32(int64_t sum, uint32_t shift) {
+    int64_t val = (sum + (((int64_t)1 << shift) >> 1)) >> shift;
+    if (val > 0x7FFFFFFFLL) {
+        val = 0x7FFFFFFFLL;
+    } else if (val < -0x80000000LL) {
+        val = -0x80000000LL;
+    }
+    return (int32_t)val;
+}
+
+static inline void plp_fir_q32_outputs(const int32_t *pCoeffs,
+                                       const int32_t *pState,
+                                       uint32_t numTaps,
+                                       uint32_t shift,
+                                       uint32_t start,
+                                       uint32_t end,
+                                       int32_t *pDst) {
+
+    uint32_t n, k;
+
+    // two outputs at a time, sharing the coefficient loads
+    for (n = start; n + 1 < end; n += 2) {
+        const int32_t *px = &pState[n];
+        int64_t acc0 = 0;
+        int64_t acc1 = 0;
+        int32_t x0 = px[0];
+        for (k = 0; k < numTaps; k++) {
+            int32_t c = pCoeffs[k];
+            int32_t x1 = px[k + 1];
+            acc0 += (int64_t)c * x0;
+            acc1 += (int64_t)c * x1;
+            x0 = x1;
+        }
+        pDst[n] = saturate_q32(acc0, shift);
+        pDst[n + 1] = saturate_q32(acc1, shift);
+    }
+
+    if (n < end) {
+        const int32_t *px = &pState[n];
+        int64_t acc0 = 0;
+        for (k = 0; k < numTaps; k++) {
+            acc0 += (int64_t)pCoeffs[k] * px[k];
+        }
+        pDst[n] = saturate_q32(acc0, shift);
+    }
+}
+
+/**
+  @ingroup FIR
+ */
+
+/**
+  @addtogroup FIRKernels
+  @{
+ */
+
+/**
+  @brief Parallel FIR filtering of a 32-bit fixed-point block kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_fir_instance_q32_parallel struct initialized by
+                    plp_fir_q32_parallel
+  @return     none
+
+  @par Every core copies and computes a contiguous chunk of the block, and the cores synchronize
+  before the computation and before core 0 moves the state.
+ */
+
+void plp_fir_q32p_xpulpv2(void *args) {
+
+    plp_fir_instance_q32_parallel *a = (plp_fir_instance_q32_parallel *)args;
+
+    const plp_fir_instance_q32 *S = a->S;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    uint32_t core_id = rt_core_id();
+    uint32_t H = S->numTaps - 1;
+    int32_t *pState = S->pState;
+    uint32_t i;
+
+    uint32_t chunk = (blockSize + nPE - 1) / nPE;
+    uint32_t start = MIN(core_id * chunk, blockSize);
+    uint32_t end = MIN(start + chunk, blockSize);
+
+    for (i = start; i < end; i++) {
+        pState[H + i] = a->pSrc[i];
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    plp_fir_q32_outputs(S->pCoeffs, pState, S->numTaps, S->shift, start, end, a->pDst);
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    if (core_id == 0) {
+        for (i = 0; i < H; i++) {
+            pState[i] = pState[i + blockSize];
+        }
+    }
+}
+
+/**
+  @} end of FIRKernels group
+ */
@@ -0,0 +1,134 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_q8p_xpulpv2.c
+ * Description:  parallel 8-bit fixed-point FIR filter for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static inline void plp_fir_q8_outputs(const int8_t *pCoeffs,
+                                      const int8_t *pState,
+                                      uint32_t numTaps,
+                                      uint32_t shift,
+                                      uint32_t start,
+                                      uint32_t end,
+                                      int8_t *pDst) {
+
+    uint32_t n, k;
+    uint32_t nVec = numTaps >> 2; // number of coefficient vectors
+    uint32_t nRem = nVec << 2;    // first coefficient which is not part of a vector
+
+    // two outputs at a time, sharing the coefficient loads
+    for (n = start; n + 1 < end; n += 2) {
+        const int8_t *px = &pState[n];
+        int32_t acc0 = 0;
+        int32_t acc1 = 0;
+        for (k = 0; k < nVec; k++) {
+            v4s c = *((v4s *)&pCoeffs[4 * k]);
+            acc0 = __SUMDOTP4(*((v4s *)&px[4 * k]), c, acc0);
+            acc1 = __SUMDOTP4(*((v4s *)&px[4 * k + 1]), c, acc1);
+        }
+        for (k = nRem; k < numTaps; k++) {
+            acc0 += pCoeffs[k] * px[k];
+            acc1 += pCoeffs[k] * px[k + 1];
+        }
+        pDst[n] = (int8_t)__CLIP(__ROUNDNORM_REG(acc0, shift), 7);
+        pDst[n + 1] = (int8_t)__CLIP(__ROUNDNORM_REG(acc1, shift), 7);
+    }
+
+    if (n < end) {
+        const int8_t *px = &pState[n];
+        int32_t acc0 = 0;
+        for (k = 0; k < nVec; k++) {
+            acc0 = __SUMDOTP4(*((v4s *)&px[4 * k]), *((v4s *)&pCoeffs[4 * k]), acc0);
+        }
+        for (k = nRem; k < numTaps; k++) {
+            acc0 += pCoeffs[k] * px[k];
+        }
+        pDst[n] = (int8_t)__CLIP(__ROUNDNORM_REG(acc0, shift), 7);
+    }
+}
+
+/**
+  @ingroup FIR
+ */
+
+/**
+  @addtogroup FIRKernels
+  @{
+ */
+
+/**
+  @brief Parallel FIR filtering of an 8-bit fixed-point block kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_fir_instance_q8_parallel struct initialized by
+                    plp_fir_q8_parallel
+  @return     none
+
+  @par Every core copies and computes a contiguous chunk of the block, and the cores synchronize
+  before the computation and before core 0 moves the state.
+ */
+
+void plp_fir_q8p_xpulpv2(void *args) {
+
+    plp_fir_instance_q8_parallel *a = (plp_fir_instance_q8_parallel *)args;
+
+    const plp_fir_instance_q8 *S = a->S;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    uint32_t core_id = rt_core_id();
+    uint32_t H = S->numTaps - 1;
+    int8_t *pState = S->pState;
+    uint32_t i;
+
+    uint32_t chunk = (blockSize + nPE - 1) / nPE;
+    uint32_t start = MIN(core_id * chunk, blockSize);
+    uint32_t end = MIN(start + chunk, blockSize);
+
+    for (i = start; i < end; i++) {
+        pState[H + i] = a->pSrc[i];
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    plp_fir_q8_outputs(S->pCoeffs, pState, S->numTaps, S->shift, start, end, a->pDst);
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    if (core_id == 0) {
+        for (i = 0; i < H; i++) {
+            pState[i] = pState[i + blockSize];
+        }
+    }
+}
+
+/**
+  @} end of FIRKernels group
+ */
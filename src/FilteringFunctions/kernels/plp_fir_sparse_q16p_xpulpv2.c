@@ -0,0 +1,165 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_sparse_q16p_xpulpv2.c
+ * Description:  parallel 16-bit fixed-point sparse FIR filter for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void plp_fir_sparse_q16_outputs(const plp_fir_sparse_instance_q16 *S,
+                                              uint32_t first,
+                                              uint32_t start,
+                                              uint32_t end,
+                                              int16_t *pDst) {
+
+    uint32_t n, k;
+    uint32_t L = S->maxDelay + S->blockSize;
+    uint32_t numTaps = S->numTaps;
+    const uint32_t *pTapDelays = S->pTapDelays;
+    const int16_t *pCoeffs = S->pCoeffs;
+    const int16_t *pLine = S->pState;
+    uint32_t shift = S->shift;
+
+    // four outputs at a time, which share the loads of the taps
+    for (n = start; n + 3 < end; n += 4) {
+        uint32_t p = first + n; // slot of x[n]
+        int32_t acc0 = 0;
+        int32_t acc1 = 0;
+        int32_t acc2 = 0;
+        int32_t acc3 = 0;
+        if (p >= L) {
+            p -= L;
+        }
+        for (k = 0; k < numTaps; k++) {
+            int32_t b = pCoeffs[k];
+            uint32_t q = p + L - pTapDelays[k]; // slot of x[n-d[k]]
+            if (q >= L) {
+                q -= L;
+            }
+            if (q + 3 < L) {
+                const int16_t *px = &pLine[q];
+                acc0 = __MAC(acc0, b, px[0]);
+                acc1 = __MAC(acc1, b, px[1]);
+                acc2 = __MAC(acc2, b, px[2]);
+                acc3 = __MAC(acc3, b, px[3]);
+            } else {
+                // the four samples wrap around the end of the delay line
+                uint32_t q1 = (q + 1 == L) ? 0 : q + 1;
+                uint32_t q2 = (q1 + 1 == L) ? 0 : q1 + 1;
+                uint32_t q3 = (q2 + 1 == L) ? 0 : q2 + 1;
+                acc0 = __MAC(acc0, b, pLine[q]);
+                acc1 = __MAC(acc1, b, pLine[q1]);
+                acc2 = __MAC(acc2, b, pLine[q2]);
+                acc3 = __MAC(acc3, b, pLine[q3]);
+            }
+        }
+        pDst[n] = (int16_t)__CLIP(__ROUNDNORM_REG(acc0, shift), 15);
+        pDst[n + 1] = (int16_t)__CLIP(__ROUNDNORM_REG(acc1, shift), 15);
+        pDst[n + 2] = (int16_t)__CLIP(__ROUNDNORM_REG(acc2, shift), 15);
+        pDst[n + 3] = (int16_t)__CLIP(__ROUNDNORM_REG(acc3, shift), 15);
+    }
+
+    for (; n < end; n++) {
+        uint32_t p = first + n;
+        int32_t acc0 = 0;
+        if (p >= L) {
+            p -= L;
+        }
+        for (k = 0; k < numTaps; k++) {
+            int32_t b = pCoeffs[k];
+            uint32_t q = p + L - pTapDelays[k];
+            if (q >= L) {
+                q -= L;
+            }
+            acc0 = __MAC(acc0, b, pLine[q]);
+        }
+        pDst[n] = (int16_t)__CLIP(__ROUNDNORM_REG(acc0, shift), 15);
+    }
+}
+
+/**
+  @ingroup FIRSparse
+ */
+
+/**
+  @addtogroup FIRSparseKernels
+  @{
+ */
+
+/**
+  @brief Parallel sparse FIR filtering of a 16-bit fixed-point block kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_fir_sparse_instance_q16_parallel struct initialized by
+                    plp_fir_sparse_q16_parallel
+  @return     none
+
+  @par Every core writes a contiguous chunk of the input samples into the delay line and computes a
+  contiguous chunk of the outputs, a multiple of four outputs. The cores synchronize before the
+  computation and before core 0 advances the state index.
+ */
+
+void plp_fir_sparse_q16p_xpulpv2(void *args) {
+
+    plp_fir_sparse_instance_q16_parallel *a = (plp_fir_sparse_instance_q16_parallel *)args;
+
+    plp_fir_sparse_instance_q16 *S = a->S;
+    const int16_t *pSrc = a->pSrc;
+    uint32_t blockSize = S->blockSize;
+    uint32_t nPE = a->nPE;
+    uint32_t core_id = rt_core_id();
+    uint32_t L = S->maxDelay + blockSize;
+    uint32_t first = S->stateIndex;
+    uint32_t i, start, end;
+
+    plp_team_chunk(blockSize, nPE, core_id, 1, &start, &end);
+
+    for (i = start; i < end; i++) {
+        uint32_t q = first + i;
+        if (q >= L) {
+            q -= L;
+        }
+        S->pState[q] = pSrc[i];
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    plp_team_chunk(blockSize, nPE, core_id, 4, &start, &end);
+
+    plp_fir_sparse_q16_outputs(S, first, start, end, a->pDst);
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    if (core_id == 0) {
+        first += blockSize;
+        S->stateIndex = (first >= L) ? first - L : first;
+    }
+}
+
+/**
+  @} end of FIRSparseKernels group
+ */
@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_sparse_q16s_rv32im.c
+ * Description:  16-bit fixed-point sparse FIR filter for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// sum * 2^-shift, rounded and saturated to 16 bits
+static inline int16_t saturate_q16(int32_t sum, uint32_t shift) {
+    int32_t val = (sum + ((1 << shift) >> 1)) >> shift;
+    if (val > (1 << 15) - 1) {
+        val = (1 << 15) - 1;
+    } else if (val < -(1 << 15)) {
+        val = -(1 << 15);
+    }
+    return (int16_t)val;
+}
+
+/**
+  @ingroup FIRSparse
+ */
+
+/**
+  @defgroup FIRSparseKernels Sparse FIR Filter Kernels
+  @{
+ */
+
+/**
+  @brief Sparse FIR filtering of a 16-bit fixed-point block kernel for RV32IM extension.
+  @param[in,out] S          points to the instance, initialized by plp_fir_sparse_init_q16
+  @param[in]     pSrc       points to the S->blockSize input samples
+  @param[out]    pDst       points to the S->blockSize output samples, which may be equal to pSrc
+  @return        none
+ */
+
+void plp_fir_sparse_q16s_rv32im(plp_fir_sparse_instance_q16 *S,
+                                const int16_t *pSrc,
+                                int16_t *pDst) {
+
+    uint32_t i, k;
+    uint32_t blockSize = S->blockSize;
+    uint32_t L = S->maxDelay + blockSize;
+    uint32_t first = S->stateIndex;
+    int16_t *pLine = S->pState;
+
+    for (i = 0; i < blockSize; i++) {
+        uint32_t q = first + i;
+        if (q >= L) {
+            q -= L;
+        }
+        pLine[q] = pSrc[i];
+    }
+
+    // every output gathers the samples of the taps from the delay line
+    for (i = 0; i < blockSize; i++) {
+        uint32_t p = first + i;
+        int32_t acc = 0;
+        if (p >= L) {
+            p -= L;
+        }
+        for (k = 0; k < S->numTaps; k++) {
+            uint32_t q = p + L - S->pTapDelays[k];
+            if (q >= L) {
+                q -= L;
+            }
+            acc += S->pCoeffs[k] * pLine[q];
+        }
+        pDst[i] = saturate_q16(acc, S->shift);
+    }
+
+    first += blockSize;
+    S->stateIndex = (first >= L) ? first - L : first;
+}
+
+/**
+  @} end of FIRSparseKernels group
+ */
@@ -0,0 +1,230 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gcc_phat_f32_xpulpv2.c
+ * Description:  GCC-PHAT of 32-bit floating-point channels for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void process_gcc_phat_f32(const plp_gcc_phat_instance_f32 *S,
+                                        const float32_t *const *pChannels,
+                                        float32_t *pCorr,
+                                        int32_t *pDelay,
+                                        uint32_t coreId,
+                                        uint32_t nPE);
+
+/**
+  @ingroup GccPhat
+ */
+
+/**
+  @defgroup GccPhatKernels GCC-PHAT Kernels
+  @{
+ */
+
+/**
+  @brief GCC-PHAT of 32-bit floating-point channels for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_gcc_phat_init_f32
+  @param[in]  pChannels  array of nChannels pointers to the blockSize samples of every channel
+  @param[out] pCorr      points to nPairs correlations of 2*maxLag+1 values
+  @param[out] pDelay     points to nPairs delays, or NULL
+  @return     none
+ */
+
+void plp_gcc_phat_f32s_xpulpv2(const plp_gcc_phat_instance_f32 *S,
+                               const float32_t *const *pChannels,
+                               float32_t *__restrict__ pCorr,
+                               int32_t *__restrict__ pDelay) {
+
+    process_gcc_phat_f32(S, pChannels, pCorr, pDelay, 0, 1);
+}
+
+/**
+  @brief Parallel GCC-PHAT of 32-bit floating-point channels for XPULPV2 extension.
+  @param[in]  args  pointer to plp_gcc_phat_instance_f32_parallel struct initialized by
+                    plp_gcc_phat_f32_parallel
+  @return     none
+
+  @par Every core transforms whole channels with plp_rfft_f32_xpulpv2 in its own part of the work
+  buffer, and then computes whole pairs with plp_rifft_f32_xpulpv2. The remaining nChannels % nPE
+  channels and nPairs % nPE pairs are computed by all cores together with the parallel transforms,
+  so the team is only forked once per call.
+ */
+
+void plp_gcc_phat_f32p_xpulpv2(void *args) {
+
+    plp_gcc_phat_instance_f32_parallel *a = (plp_gcc_phat_instance_f32_parallel *)args;
+
+    process_gcc_phat_f32(a->S, a->pChannels, a->pCorr, a->pDelay, rt_core_id(), a->nPE);
+}
+
+/**
+  @} end of GccPhatKernels group
+ */
+
+// channel zero padded to N samples, samples start to end
+static inline void plp_gcc_phat_pad_f32(const float32_t *pSrc,
+                                        uint32_t blockSize,
+                                        uint32_t start,
+                                        uint32_t end,
+                                        float32_t *pDst) {
+    uint32_t n;
+
+    for (n = start; n < end; n++) {
+        pDst[n] = (n < blockSize) ? pSrc[n] : 0.0f;
+    }
+}
+
+// phase of the cross spectrum conj(A) * B of pair p, bins start to end of 0 .. N/2, and the
+// mirrored bins N - k of the hermitian spectrum
+static inline void plp_gcc_phat_weight_f32(const plp_gcc_phat_instance_f32 *S,
+                                           uint32_t p,
+                                           uint32_t start,
+                                           uint32_t end,
+                                           float32_t *pDst) {
+    uint32_t N = S->S->FFTLength;
+    const float32_t *pA = &S->pSpectra[2 * N * S->pPairs[2 * p]];
+    const float32_t *pB = &S->pSpectra[2 * N * S->pPairs[2 * p + 1]];
+    uint32_t k;
+
+    for (k = start; k < end; k++) {
+        float32_t re = pA[2 * k] * pB[2 * k] + pA[2 * k + 1] * pB[2 * k + 1];
+        float32_t im = pA[2 * k] * pB[2 * k + 1] - pA[2 * k + 1] * pB[2 * k];
+        float32_t mag = sqrtf(re * re + im * im);
+
+        // bins without energy carry no phase
+        if (mag > 0.0f) {
+            float32_t scale = 1.0f / mag;
+            re *= scale;
+            im *= scale;
+        } else {
+            re = 0.0f;
+            im = 0.0f;
+        }
+
+        pDst[2 * k] = re;
+        pDst[2 * k + 1] = im;
+        if (k > 0 && k < N / 2) {
+            pDst[2 * (N - k)] = re;
+            pDst[2 * (N - k) + 1] = -im;
+        }
+    }
+}
+
+// lags -maxLag .. maxLag of the circular correlation, and the lag of the largest value
+static inline void plp_gcc_phat_lags_f32(const float32_t *pTime,
+                                         uint32_t N,
+                                         uint32_t maxLag,
+                                         float32_t *pCorr,
+                                         int32_t *pDelay) {
+    uint32_t l, best = 0;
+
+    for (l = 0; l < 2 * maxLag + 1; l++) {
+        pCorr[l] = (l < maxLag) ? pTime[N - maxLag + l] : pTime[l - maxLag];
+        if (pCorr[l] > pCorr[best]) {
+            best = l;
+        }
+    }
+
+    if (pDelay != NULL) {
+        *pDelay = (int32_t)best - (int32_t)maxLag;
+    }
+}
+
+static inline void process_gcc_phat_f32(const plp_gcc_phat_instance_f32 *S,
+                                        const float32_t *const *pChannels,
+                                        float32_t *pCorr,
+                                        int32_t *pDelay,
+                                        uint32_t coreId,
+                                        uint32_t nPE) {
+
+    uint32_t N = S->S->FFTLength;
+    uint32_t nChannels = S->nChannels;
+    uint32_t nPairs = S->nPairs;
+    uint32_t corrLen = 2 * S->maxLag + 1;
+    float32_t *pSpectra = S->pSpectra;
+    // own part of the work buffer, the one of core 0 is shared by the joint transforms
+    float32_t *pTime = &S->pBuffer[3 * N * coreId];
+    float32_t *pFreq = pTime + N;
+    float32_t *pTimeShared = S->pBuffer;
+    float32_t *pFreqShared = S->pBuffer + N;
+    uint32_t c, p, nFull, start, end;
+    plp_rfft_parallel_arg_f32 fftArgs = {
+        .S = (plp_rfft_instance_f32 *)S->S, .pSrc = pTimeShared, .nPE = nPE, .pDst = NULL
+    };
+    plp_rfft_parallel_arg_f32 ifftArgs = {
+        .S = (plp_rfft_instance_f32 *)S->S, .pSrc = pFreqShared, .nPE = nPE, .pDst = pTimeShared
+    };
+
+    // spectra of the channels
+    nFull = nChannels - nChannels % nPE;
+    for (c = coreId; c < nFull; c += nPE) {
+        plp_gcc_phat_pad_f32(pChannels[c], S->blockSize, 0, N, pTime);
+        plp_rfft_f32_xpulpv2(S->S, pTime, &pSpectra[2 * N * c]);
+    }
+
+    if (nFull > 0 && nFull < nChannels) {
+        // core 0 may still use the shared buffer
+        rt_team_barrier();
+    }
+
+    plp_team_chunk(N, nPE, coreId, 1, &start, &end);
+    for (c = nFull; c < nChannels; c++) {
+        plp_gcc_phat_pad_f32(pChannels[c], S->blockSize, start, end, pTimeShared);
+        rt_team_barrier();
+        // the parallel real FFT ends with a barrier
+        fftArgs.pDst = &pSpectra[2 * N * c];
+        plp_rfft_f32_xpulpv2_parallel(&fftArgs);
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    // correlations of the pairs
+    nFull = nPairs - nPairs % nPE;
+    for (p = coreId; p < nFull; p += nPE) {
+        plp_gcc_phat_weight_f32(S, p, 0, N / 2 + 1, pFreq);
+        plp_rifft_f32_xpulpv2(S->S, pFreq, pTime);
+        plp_gcc_phat_lags_f32(pTime, N, S->maxLag, &pCorr[p * corrLen],
+                              (pDelay != NULL) ? &pDelay[p] : NULL);
+    }
+
+    if (nFull > 0 && nFull < nPairs) {
+        rt_team_barrier();
+    }
+
+    plp_team_chunk(N / 2 + 1, nPE, coreId, 1, &start, &end);
+    for (p = nFull; p < nPairs; p++) {
+        plp_gcc_phat_weight_f32(S, p, start, end, pFreqShared);
+        rt_team_barrier();
+        plp_rifft_f32_xpulpv2_parallel(&ifftArgs);
+        rt_team_barrier();
+        if (coreId == 0) {
+            plp_gcc_phat_lags_f32(pTimeShared, N, S->maxLag, &pCorr[p * corrLen],
+                                  (pDelay != NULL) ? &pDelay[p] : NULL);
+        }
+    }
+}
@@ -0,0 +1,110 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_fir_f32s_xpulpv2.c
+ * Description:  Hilbert transformation of a 32-bit floating-point block for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void plp_hilbert_fir_f32_outputs(const float32_t *pCoeffs,
+                                               const float32_t *pState,
+                                               uint32_t numTaps,
+                                               uint32_t start,
+                                               uint32_t end,
+                                               float32_t *pDst,
+                                               uint32_t stride) {
+
+    uint32_t n, m;
+    uint32_t nCoeffs = (numTaps + 1) / 2;
+
+    // two outputs at a time, sharing the coefficient loads
+    for (n = start; n + 1 < end; n += 2) {
+        const float32_t *px = &pState[n];
+        float32_t acc0 = 0.0f;
+        float32_t acc1 = 0.0f;
+        for (m = 0; m < nCoeffs; m++) {
+            float32_t c = pCoeffs[m];
+            acc0 += c * px[2 * m];
+            acc1 += c * px[2 * m + 1];
+        }
+        pDst[(n - start) * stride] = acc0;
+        pDst[(n + 1 - start) * stride] = acc1;
+    }
+
+    if (n < end) {
+        const float32_t *px = &pState[n];
+        float32_t acc0 = 0.0f;
+        for (m = 0; m < nCoeffs; m++) {
+            acc0 += pCoeffs[m] * px[2 * m];
+        }
+        pDst[(n - start) * stride] = acc0;
+    }
+}
+
+/**
+  @ingroup HilbertFIR
+ */
+
+/**
+  @addtogroup HilbertFIRKernels
+  @{
+ */
+
+/**
+  @brief Hilbert transformation of a 32-bit floating-point block kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_hilbert_fir_init_f32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, at most the block size of the instance
+  @param[out] pDst       points to the blockSize output samples
+  @return     none
+
+  @par The new samples are appended to the state buffer after the numTaps-1 previous samples.
+  Every output is the dot product of the non-zero coefficients with every second sample of the
+  state buffer. Finally, the last numTaps-1 samples are moved to the beginning of the state buffer.
+ */
+
+void plp_hilbert_fir_f32s_xpulpv2(const plp_hilbert_fir_instance_f32 *S,
+                                  const float32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  float32_t *__restrict__ pDst) {
+
+    uint32_t i;
+    uint32_t H = S->numTaps - 1;
+    float32_t *pState = S->pState;
+
+    for (i = 0; i < blockSize; i++) {
+        pState[H + i] = pSrc[i];
+    }
+
+    plp_hilbert_fir_f32_outputs(S->pCoeffs, pState, S->numTaps, 0, blockSize, pDst, 1);
+
+    for (i = 0; i < H; i++) {
+        pState[i] = pState[i + blockSize];
+    }
+}
+
+/**
+  @} end of HilbertFIRKernels group
+ */
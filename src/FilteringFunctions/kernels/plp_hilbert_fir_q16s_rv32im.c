@@ -0,0 +1,108 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_fir_q16s_rv32im.c
+ * Description:  Hilbert transformation of a 16-bit fixed-point block for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// sum * 2^-shift, rounded and saturated to 16 bits
+static inline int16_t saturate_q16(int32_t sum, uint32_t shift) {
+    int32_t val = (sum + ((1 << shift) >> 1)) >> shift;
+    if (val > (1 << 15) - 1) {
+        val = (1 << 15) - 1;
+    } else if (val < -(1 << 15)) {
+        val = -(1 << 15);
+    }
+    return (int16_t)val;
+}
+
+static inline void plp_hilbert_fir_q16_outputs(const int16_t *pCoeffs,
+                                               const int16_t *pState,
+                                               uint32_t numTaps,
+                                               uint32_t shift,
+                                               uint32_t start,
+                                               uint32_t end,
+                                               int16_t *pDst,
+                                               uint32_t stride) {
+
+    uint32_t n, m;
+    uint32_t nCoeffs = (numTaps + 1) / 2;
+
+    for (n = start; n < end; n++) {
+        const int16_t *px = &pState[n];
+        int32_t acc = 0;
+        for (m = 0; m < nCoeffs; m++) {
+            acc += pCoeffs[m] * px[2 * m];
+        }
+        pDst[(n - start) * stride] = saturate_q16(acc, shift);
+    }
+}
+
+/**
+  @ingroup HilbertFIR
+ */
+
+/**
+  @defgroup HilbertFIRKernels Hilbert Transformer Kernels
+  @{
+ */
+
+/**
+  @brief Hilbert transformation of a 16-bit fixed-point block kernel for RV32IM extension.
+  @param[in]  S          points to the instance, initialized by plp_hilbert_fir_init_q16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, at most the block size of the instance
+  @param[out] pDst       points to the blockSize output samples
+  @return     none
+
+  @par The new samples are appended to the state buffer after the numTaps-1 previous samples.
+  Every output is the dot product of the non-zero coefficients with every second sample of the
+  state buffer. Finally, the last numTaps-1 samples are moved to the beginning of the state buffer.
+ */
+
+void plp_hilbert_fir_q16s_rv32im(const plp_hilbert_fir_instance_q16 *S,
+                                 const int16_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 int16_t *__restrict__ pDst) {
+
+    uint32_t i;
+    uint32_t H = S->numTaps - 1;
+    int16_t *pState = S->pState;
+
+    for (i = 0; i < blockSize; i++) {
+        pState[H + i] = pSrc[i];
+    }
+
+    plp_hilbert_fir_q16_outputs(S->pCoeffs, pState, S->numTaps, S->shift, 0, blockSize, pDst, 1);
+
+    for (i = 0; i < H; i++) {
+        pState[i] = pState[i + blockSize];
+    }
+}
+
+/**
+  @} end of HilbertFIRKernels group
+ */
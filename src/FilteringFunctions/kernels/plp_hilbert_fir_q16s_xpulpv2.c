@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_fir_q16s_xpulpv2.c
+ * Description:  Hilbert transformation of a 16-bit fixed-point block for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void plp_hilbert_fir_q16_outputs(const int16_t *pCoeffs,
+                                               const int16_t *pState,
+                                               uint32_t numTaps,
+                                               uint32_t shift,
+                                               uint32_t start,
+                                               uint32_t end,
+                                               int16_t *pDst,
+                                               uint32_t stride) {
+
+    uint32_t n, m;
+    uint32_t nVec = (numTaps + 1) / 4; // number of coefficient vectors
+
+    // two outputs at a time, the even and odd samples of the same words are used by either output
+    for (n = start; n + 1 < end; n += 2) {
+        const int16_t *px = &pState[n];
+        int32_t acc0 = 0;
+        int32_t acc1 = 0;
+        for (m = 0; m < nVec; m++) {
+            v2s x0 = *((v2s *)&px[4 * m]);
+            v2s x1 = *((v2s *)&px[4 * m + 2]);
+            v2s c = *((v2s *)&pCoeffs[2 * m]);
+            acc0 = __SUMDOTP2(__builtin_shuffle(x0, x1, (v2s){ 0, 2 }), c, acc0);
+            acc1 = __SUMDOTP2(__builtin_shuffle(x0, x1, (v2s){ 1, 3 }), c, acc1);
+        }
+        pDst[(n - start) * stride] = (int16_t)__CLIP(__ROUNDNORM_REG(acc0, shift), 15);
+        pDst[(n + 1 - start) * stride] = (int16_t)__CLIP(__ROUNDNORM_REG(acc1, shift), 15);
+    }
+
+    if (n < end) {
+        const int16_t *px = &pState[n];
+        int32_t acc0 = 0;
+        for (m = 0; m < 2 * nVec; m++) {
+            acc0 += pCoeffs[m] * px[2 * m];
+        }
+        pDst[(n - start) * stride] = (int16_t)__CLIP(__ROUNDNORM_REG(acc0, shift), 15);
+    }
+}
+
+/**
+  @ingroup HilbertFIR
+ */
+
+/**
+  @addtogroup HilbertFIRKernels
+  @{
+ */
+
+/**
+  @brief Hilbert transformation of a 16-bit fixed-point block kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_hilbert_fir_init_q16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, at most the block size of the instance
+  @param[out] pDst       points to the blockSize output samples
+  @return     none
+
+  @par The new samples are appended to the state buffer after the numTaps-1 previous samples.
+  Every output is the dot product of the non-zero coefficients with every second sample of the
+  state buffer. Finally, the last numTaps-1 samples are moved to the beginning of the state buffer.
+  Two outputs are computed together: the even and odd samples of two consecutive words are
+  shuffled into the vectors of either output, such that every word is loaded once.
+ */
+
+void plp_hilbert_fir_q16s_xpulpv2(const plp_hilbert_fir_instance_q16 *S,
+                                  const int16_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int16_t *__restrict__ pDst) {
+
+    uint32_t i;
+    uint32_t H = S->numTaps - 1;
+    int16_t *pState = S->pState;
+
+    for (i = 0; i < blockSize; i++) {
+        pState[H + i] = pSrc[i];
+    }
+
+    plp_hilbert_fir_q16_outputs(S->pCoeffs, pState, S->numTaps, S->shift, 0, blockSize, pDst, 1);
+
+    for (i = 0; i < H; i++) {
+        pState[i] = pState[i + blockSize];
+    }
+}
+
+/**
+  @} end of HilbertFIRKernels group
+ */
@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_kalman_predict_f32s_xpulpv2.c
+ * Description:  Prediction step of the 32-bit floating-point Kalman filter for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Kalman
+ */
+
+/**
+  @defgroup KalmanKernels Kalman Filter Kernels
+  @{
+ */
+
+/**
+  @brief Prediction step of the 32-bit floating-point Kalman filter kernel for XPULPV2 extension.
+  @param[in]  S      points to the instance, initialized by plp_kalman_init_f32
+  @param[in]  pF     points to the state transition matrix of shape NxN
+  @param[in]  pQ     points to the symmetric process noise covariance of shape NxN
+  @param[in]  pXPred points to the predicted state f(x) of N values of an extended Kalman filter,
+                     or NULL to predict x = F * x
+  @return     none
+
+  @par F * P is computed into the work buffer, and only the upper triangle of
+  F * P * F^T + Q is accumulated, which is then mirrored into the lower triangle of P.
+ */
+
+void plp_kalman_predict_f32s_xpulpv2(const plp_kalman_instance_f32 *S,
+                                     const float32_t *__restrict__ pF,
+                                     const float32_t *__restrict__ pQ,
+                                     const float32_t *__restrict__ pXPred) {
+
+    uint32_t N = S->nStates;
+    float32_t *pX = S->pX;
+    float32_t *pP = S->pP;
+    float32_t *pFP = S->pWork;
+    uint32_t i, j, k;
+
+    // x = F * x through the work buffer, which is needed for F * P afterwards
+    if (pXPred == NULL) {
+        for (i = 0; i < N; i++) {
+            float32_t sum = 0.0f;
+            for (k = 0; k < N; k++) {
+                sum += pF[i * N + k] * pX[k];
+            }
+            pFP[i] = sum;
+        }
+        pXPred = pFP;
+    }
+    for (i = 0; i < N; i++) {
+        pX[i] = pXPred[i];
+    }
+
+    // F * P
+    for (i = 0; i < N; i++) {
+        for (j = 0; j < N; j++) {
+            float32_t sum = 0.0f;
+            for (k = 0; k < N; k++) {
+                sum += pF[i * N + k] * pP[k * N + j];
+            }
+            pFP[i * N + j] = sum;
+        }
+    }
+
+    // P = (F * P) * F^T + Q, upper triangle
+    for (i = 0; i < N; i++) {
+        for (j = i; j < N; j++) {
+            float32_t sum = pQ[i * N + j];
+            for (k = 0; k < N; k++) {
+                sum += pFP[i * N + k] * pF[j * N + k];
+            }
+            pP[i * N + j] = sum;
+            pP[j * N + i] = sum;
+        }
+    }
+}
+
+/**
+  @} end of KalmanKernels group
+ */
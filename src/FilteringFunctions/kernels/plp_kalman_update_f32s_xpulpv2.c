@@ -0,0 +1,169 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_kalman_update_f32s_xpulpv2.c
+ * Description:  Update step of the 32-bit floating-point Kalman filter for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Kalman
+ */
+
+/**
+  @addtogroup KalmanKernels
+  @{
+ */
+
+/**
+  @brief Update step of the 32-bit floating-point Kalman filter kernel for XPULPV2 extension.
+  @param[in]  S    points to the instance, initialized by plp_kalman_init_f32
+  @param[in]  pH   points to the measurement matrix of shape MxN
+  @param[in]  pR   points to the symmetric measurement noise covariance of shape MxM
+  @param[in]  pZ   points to the measurement of M values
+  @param[in]  pHx  points to the predicted measurement h(x) of M values of an extended Kalman
+                   filter, or NULL to use H * x
+  @return     0: Success, 1: the innovation covariance is not positive definite, the state is
+              not changed
+
+  @par The work buffer holds W = H * P (MxN), the upper triangle of S = W * H^T + R (MxM) and the
+  innovation y (M values). S is factorized in place into S = U^T U, and W and y are overwritten by
+  the forward substitutions U^-T W and U^-T y. The correction x = x + W^T * y and the upper
+  triangle of P = P - W^T * W are then accumulated directly into the instance.
+ */
+
+int plp_kalman_update_f32s_xpulpv2(const plp_kalman_instance_f32 *S,
+                                   const float32_t *__restrict__ pH,
+                                   const float32_t *__restrict__ pR,
+                                   const float32_t *__restrict__ pZ,
+                                   const float32_t *__restrict__ pHx) {
+
+    uint32_t N = S->nStates;
+    uint32_t M = S->nMeas;
+    float32_t *pX = S->pX;
+    float32_t *pP = S->pP;
+    float32_t *pW = S->pWork;
+    float32_t *pU = pW + M * N;
+    float32_t *pY = pU + M * M;
+    uint32_t a, b, i, j, k;
+
+    // W = H * P
+    for (a = 0; a < M; a++) {
+        for (j = 0; j < N; j++) {
+            float32_t sum = 0.0f;
+            for (k = 0; k < N; k++) {
+                sum += pH[a * N + k] * pP[k * N + j];
+            }
+            pW[a * N + j] = sum;
+        }
+    }
+
+    // S = W * H^T + R, upper triangle
+    for (a = 0; a < M; a++) {
+        for (b = a; b < M; b++) {
+            float32_t sum = pR[a * M + b];
+            for (k = 0; k < N; k++) {
+                sum += pW[a * N + k] * pH[b * N + k];
+            }
+            pU[a * M + b] = sum;
+        }
+    }
+
+    // y = z - H * x
+    for (a = 0; a < M; a++) {
+        float32_t hx = 0.0f;
+        if (pHx == NULL) {
+            for (k = 0; k < N; k++) {
+                hx += pH[a * N + k] * pX[k];
+            }
+        } else {
+            hx = pHx[a];
+        }
+        pY[a] = pZ[a] - hx;
+    }
+
+    // S = U^T U in place, and the forward substitutions U^-T W and U^-T y row by row
+    for (a = 0; a < M; a++) {
+        float32_t diag = pU[a * M + a];
+        for (k = 0; k < a; k++) {
+            diag -= pU[k * M + a] * pU[k * M + a];
+        }
+        if (diag <= 0.0f) {
+            return 1;
+        }
+        diag = sqrtf(diag);
+        float32_t invDiag = 1.0f / diag;
+        pU[a * M + a] = diag;
+
+        for (b = a + 1; b < M; b++) {
+            float32_t sum = pU[a * M + b];
+            for (k = 0; k < a; k++) {
+                sum -= pU[k * M + a] * pU[k * M + b];
+            }
+            pU[a * M + b] = sum * invDiag;
+        }
+
+        for (j = 0; j < N; j++) {
+            float32_t sum = pW[a * N + j];
+            for (k = 0; k < a; k++) {
+                sum -= pU[k * M + a] * pW[k * N + j];
+            }
+            pW[a * N + j] = sum * invDiag;
+        }
+
+        float32_t sum = pY[a];
+        for (k = 0; k < a; k++) {
+            sum -= pU[k * M + a] * pY[k];
+        }
+        pY[a] = sum * invDiag;
+    }
+
+    // x = x + W^T * y
+    for (i = 0; i < N; i++) {
+        float32_t sum = pX[i];
+        for (a = 0; a < M; a++) {
+            sum += pW[a * N + i] * pY[a];
+        }
+        pX[i] = sum;
+    }
+
+    // P = P - W^T * W, upper triangle
+    for (i = 0; i < N; i++) {
+        for (j = i; j < N; j++) {
+            float32_t sum = pP[i * N + j];
+            for (a = 0; a < M; a++) {
+                sum -= pW[a * N + i] * pW[a * N + j];
+            }
+            pP[i * N + j] = sum;
+            pP[j * N + i] = sum;
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of KalmanKernels group
+ */
@@ -0,0 +1,132 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_f32s_xpulpv2.c
+ * Description:  32-bit floating-point LMS filter for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// dot product of the coefficients with the window px
+static inline float32_t plp_lms_f32_dot(const float32_t *pCoeffs,
+                                        const float32_t *px,
+                                        uint32_t numTaps) {
+    uint32_t k;
+    float32_t acc = 0.0f;
+    for (k = 0; k < numTaps; k++) {
+        acc += pCoeffs[k] * px[k];
+    }
+    return acc;
+}
+
+// updates the coefficients with the window px and the scaled error g, and returns the dot product
+// of the new coefficients with the next window px + 1
+static inline float32_t plp_lms_f32_update_dot(float32_t *pCoeffs,
+                                               const float32_t *px,
+                                               uint32_t numTaps,
+                                               float32_t g) {
+    uint32_t k;
+    float32_t acc = 0.0f;
+    for (k = 0; k < numTaps; k++) {
+        float32_t w = pCoeffs[k] + g * px[k];
+        pCoeffs[k] = w;
+        acc += w * px[k + 1];
+    }
+    return acc;
+}
+
+// updates the coefficients with the window px and the scaled error g
+static inline void plp_lms_f32_update(float32_t *pCoeffs,
+                                      const float32_t *px,
+                                      uint32_t numTaps,
+                                      float32_t g) {
+    uint32_t k;
+    for (k = 0; k < numTaps; k++) {
+        pCoeffs[k] = pCoeffs[k] + g * px[k];
+    }
+}
+
+/**
+  @ingroup LMS
+ */
+
+/**
+  @addtogroup LMSKernels
+  @{
+ */
+
+/**
+  @brief LMS filtering of a 32-bit floating-point block kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_lms_init_f32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference samples
+  @param[in]  blockSize  number of samples, at most the block size of the instance
+  @param[out] pOut       points to the block of filter outputs, which may be equal to pSrc
+  @param[out] pErr       points to the block of error samples, which may be equal to pRef
+  @return     none
+ */
+
+void plp_lms_f32s_xpulpv2(const plp_lms_instance_f32 *S,
+                          const float32_t *pSrc,
+                          const float32_t *pRef,
+                          uint32_t blockSize,
+                          float32_t *pOut,
+                          float32_t *pErr) {
+
+    uint32_t n;
+    uint32_t numTaps = S->numTaps;
+    float32_t *pState = S->pState;
+    float32_t *pCoeffs = S->pCoeffs;
+    float32_t mu = S->mu;
+
+    for (n = 0; n < blockSize; n++) {
+        pState[numTaps - 1 + n] = pSrc[n];
+    }
+
+    // the output of the first sample is computed here, all following outputs are computed while
+    // updating the coefficients
+    float32_t acc = plp_lms_f32_dot(pCoeffs, pState, numTaps);
+
+    for (n = 0; n < blockSize; n++) {
+        float32_t y = acc;
+        float32_t e = pRef[n] - y;
+        float32_t g = mu * e;
+        pOut[n] = y;
+        pErr[n] = e;
+
+        if (n + 1 < blockSize) {
+            acc = plp_lms_f32_update_dot(pCoeffs, &pState[n], numTaps, g);
+        } else {
+            plp_lms_f32_update(pCoeffs, &pState[n], numTaps, g);
+        }
+    }
+
+    for (n = 0; n < numTaps - 1; n++) {
+        pState[n] = pState[n + blockSize];
+    }
+}
+
+/**
+  @} end of LMSKernels group
+ */
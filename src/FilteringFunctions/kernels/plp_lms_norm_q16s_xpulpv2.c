@@ -0,0 +1,151 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_norm_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point normalized LMS filter for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// dot product of the coefficients with the window px
+static inline int32_t plp_lms_q16_dot(const int16_t *pCoeffs, const int16_t *px, uint32_t numTaps) {
+    uint32_t k;
+    int32_t acc = 0;
+    for (k = 0; k < numTaps >> 1; k++) {
+        acc = __SUMDOTP2(*((v2s *)&px[2 * k]), *((v2s *)&pCoeffs[2 * k]), acc);
+    }
+    if (numTaps & 1) {
+        acc += pCoeffs[numTaps - 1] * px[numTaps - 1];
+    }
+    return acc;
+}
+
+// updates the coefficients with the window px and the scaled error g, and returns the dot product
+// of the new coefficients with the next window px + 1
+static inline int32_t plp_lms_q16_update_dot(int16_t *pCoeffs,
+                                             const int16_t *px,
+                                             uint32_t numTaps,
+                                             int32_t g) {
+    uint32_t k;
+    int32_t acc = 0;
+    for (k = 0; k < numTaps >> 1; k++) {
+        int16_t *pw = &pCoeffs[2 * k];
+        int16_t w0 = (int16_t)__CLIP(pw[0] + __ROUNDNORM_REG(g * px[2 * k], 15), 15);
+        int16_t w1 = (int16_t)__CLIP(pw[1] + __ROUNDNORM_REG(g * px[2 * k + 1], 15), 15);
+        pCoeffs[2 * k] = w0;
+        pCoeffs[2 * k + 1] = w1;
+        acc = __SUMDOTP2(*((v2s *)&px[2 * k + 1]), __PACK2(w0, w1), acc);
+    }
+    if (numTaps & 1) {
+        k = numTaps - 1;
+        int16_t w0 = (int16_t)__CLIP(pCoeffs[k] + __ROUNDNORM_REG(g * px[k], 15), 15);
+        pCoeffs[k] = w0;
+        acc += w0 * px[k + 1];
+    }
+    return acc;
+}
+
+// updates the coefficients with the window px and the scaled error g
+static inline void plp_lms_q16_update(int16_t *pCoeffs,
+                                      const int16_t *px,
+                                      uint32_t numTaps,
+                                      int32_t g) {
+    uint32_t k;
+    for (k = 0; k < numTaps; k++) {
+        pCoeffs[k] = (int16_t)__CLIP(pCoeffs[k] + __ROUNDNORM_REG(g * px[k], 15), 15);
+    }
+}
+
+/**
+  @ingroup LMSNorm
+ */
+
+/**
+  @addtogroup LMSNormKernels
+  @{
+ */
+
+/**
+  @brief Normalized LMS filtering of a 16-bit fixed-point block kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_lms_norm_init_q16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference samples
+  @param[in]  blockSize  number of samples, at most the block size of the instance
+  @param[out] pOut       points to the block of filter outputs, which may be equal to pSrc
+  @param[out] pErr       points to the block of error samples, which may be equal to pRef
+  @return     none
+ */
+
+void plp_lms_norm_q16s_xpulpv2(plp_lms_norm_instance_q16 *S,
+                               const int16_t *pSrc,
+                               const int16_t *pRef,
+                               uint32_t blockSize,
+                               int16_t *pOut,
+                               int16_t *pErr) {
+
+    uint32_t n;
+    uint32_t numTaps = S->numTaps;
+    int16_t *pState = S->pState;
+    int16_t *pCoeffs = S->pCoeffs;
+    int16_t mu = S->mu;
+    uint32_t shift = 15 - S->postShift;
+    int32_t energy = S->energy;
+
+    for (n = 0; n < blockSize; n++) {
+        pState[numTaps - 1 + n] = pSrc[n];
+    }
+
+    // the output of the first sample is computed here, all following outputs are computed while
+    // updating the coefficients
+    int32_t acc = plp_lms_q16_dot(pCoeffs, pState, numTaps);
+
+    for (n = 0; n < blockSize; n++) {
+        // update the energy with the newest sample and the sample leaving the window
+        int16_t xNew = pState[numTaps - 1 + n];
+        int16_t xOld = (n == 0) ? S->x0 : pState[n - 1];
+        energy += ((xNew * xNew) >> 15) - ((xOld * xOld) >> 15);
+        int16_t y = (int16_t)__CLIP(__ROUNDNORM_REG(acc, shift), 15);
+        int16_t e = (int16_t)__CLIP(pRef[n] - y, 15);
+        int32_t g = __CLIP((mu * e) / (energy + 1), 15);
+        pOut[n] = y;
+        pErr[n] = e;
+
+        if (n + 1 < blockSize) {
+            acc = plp_lms_q16_update_dot(pCoeffs, &pState[n], numTaps, g);
+        } else {
+            plp_lms_q16_update(pCoeffs, &pState[n], numTaps, g);
+        }
+    }
+
+    S->energy = energy;
+    S->x0 = pState[blockSize - 1];
+
+    for (n = 0; n < numTaps - 1; n++) {
+        pState[n] = pState[n + blockSize];
+    }
+}
+
+/**
+  @} end of LMSNormKernels group
+ */
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_norm_q32p_xpulpv2.c
+ * Description:  parallel 32-bit fixed-point normalized LMS filter for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup LMSNorm
+ */
+
+/**
+  @addtogroup LMSNormKernels
+  @{
+ */
+
+/**
+  @brief Parallel multi-channel normalized LMS filtering of a 32-bit fixed-point block kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_lms_norm_instance_q32_parallel struct initialized by
+                    plp_lms_norm_q32_parallel
+  @return     none
+
+  @par Core i adapts the channels i, i+nPE, i+2*nPE, ... with plp_lms_norm_q32s_xpulpv2. The
+  channels are independent, hence no synchronization is needed.
+ */
+
+void plp_lms_norm_q32p_xpulpv2(void *args) {
+
+    plp_lms_norm_instance_q32_parallel *a = (plp_lms_norm_instance_q32_parallel *)args;
+
+    uint32_t blockSize = a->blockSize;
+    uint32_t c;
+
+    for (c = rt_core_id(); c < a->nChannels; c += a->nPE) {
+        uint32_t offset = c * blockSize;
+        plp_lms_norm_q32s_xpulpv2(&a->S[c], &a->pSrc[offset], &a->pRef[offset], blockSize,
+                                  &a->pOut[offset], &a->pErr[offset]);
+    }
+}
+
+/**
+  @} end of LMSNormKernels group
+ */
@@ -0,0 +1,144 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_q16s_rv32im.c
+ * Description:  16-bit fixed-point LMS filter for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// sum * 2^-shift, rounded and saturated to 16 bits
+static inline int16_t saturate_q16(int32_t sum, uint32_t shift) {
+    int32_t val = (sum + ((1 << shift) >> 1)) >> shift;
+    if (val > (1 << 15) - 1) {
+        val = (1 << 15) - 1;
+    } else if (val < -(1 << 15)) {
+        val = -(1 << 15);
+    }
+    return (int16_t)val;
+}
+
+// dot product of the coefficients with the window px
+static inline int32_t plp_lms_q16_dot(const int16_t *pCoeffs,
+                                      const int16_t *px,
+                                      uint32_t numTaps) {
+    uint32_t k;
+    int32_t acc = 0;
+    for (k = 0; k < numTaps; k++) {
+        acc += pCoeffs[k] * px[k];
+    }
+    return acc;
+}
+
+// updates the coefficients with the window px and the scaled error g, and returns the dot product
+// of the new coefficients with the next window px + 1
+static inline int32_t plp_lms_q16_update_dot(int16_t *pCoeffs,
+                                             const int16_t *px,
+                                             uint32_t numTaps,
+                                             int32_t g) {
+    uint32_t k;
+    int32_t acc = 0;
+    for (k = 0; k < numTaps; k++) {
+        int16_t w = saturate_q16((pCoeffs[k] << 15) + g * px[k], 15);
+        pCoeffs[k] = w;
+        acc += w * px[k + 1];
+    }
+    return acc;
+}
+
+// updates the coefficients with the window px and the scaled error g
+static inline void plp_lms_q16_update(int16_t *pCoeffs,
+                                      const int16_t *px,
+                                      uint32_t numTaps,
+                                      int32_t g) {
+    uint32_t k;
+    for (k = 0; k < numTaps; k++) {
+        pCoeffs[k] = saturate_q16((pCoeffs[k] << 15) + g * px[k], 15);
+    }
+}
+
+/**
+  @ingroup LMS
+ */
+
+/**
+  @defgroup LMSKernels LMS Filter Kernels
+  @{
+ */
+
+/**
+  @brief LMS filtering of a 16-bit fixed-point block kernel for RV32IM extension.
+  @param[in]  S          points to the instance, initialized by plp_lms_init_q16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference samples
+  @param[in]  blockSize  number of samples, at most the block size of the instance
+  @param[out] pOut       points to the block of filter outputs, which may be equal to pSrc
+  @param[out] pErr       points to the block of error samples, which may be equal to pRef
+  @return     none
+ */
+
+void plp_lms_q16s_rv32im(const plp_lms_instance_q16 *S,
+                         const int16_t *pSrc,
+                         const int16_t *pRef,
+                         uint32_t blockSize,
+                         int16_t *pOut,
+                         int16_t *pErr) {
+
+    uint32_t n;
+    uint32_t numTaps = S->numTaps;
+    int16_t *pState = S->pState;
+    int16_t *pCoeffs = S->pCoeffs;
+    int16_t mu = S->mu;
+    uint32_t shift = 15 - S->postShift;
+
+    for (n = 0; n < blockSize; n++) {
+        pState[numTaps - 1 + n] = pSrc[n];
+    }
+
+    // the output of the first sample is computed here, all following outputs are computed while
+    // updating the coefficients
+    int32_t acc = plp_lms_q16_dot(pCoeffs, pState, numTaps);
+
+    for (n = 0; n < blockSize; n++) {
+        int16_t y = saturate_q16(acc, shift);
+        int16_t e = saturate_q16(pRef[n] - y, 0);
+        int32_t g = saturate_q16(mu * e, 15);
+        pOut[n] = y;
+        pErr[n] = e;
+
+        if (n + 1 < blockSize) {
+            acc = plp_lms_q16_update_dot(pCoeffs, &pState[n], numTaps, g);
+        } else {
+            plp_lms_q16_update(pCoeffs, &pState[n], numTaps, g);
+        }
+    }
+
+    for (n = 0; n < numTaps - 1; n++) {
+        pState[n] = pState[n + blockSize];
+    }
+}
+
+/**
+  @} end of LMSKernels group
+ */
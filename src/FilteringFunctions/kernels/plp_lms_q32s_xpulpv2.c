@@ -0,0 +1,144 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_q32s_xpulpv2.c
+ * Description:  32-bit fixed-point LMS filter for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// sum * 2^-shift, rounded and saturated to 32 bits
+static inline int32_t saturate_q32(int64_t sum, uint32_t shift) {
+    int64_t val = (sum + (((int64_t)1 << shift) >> 1)) >> shift;
+    if (val > 0x7FFFFFFFLL) {
+        val = 0x7FFFFFFFLL;
+    } else if (val < -0x80000000LL) {
+        val = -0x80000000LL;
+    }
+    return (int32_t)val;
+}
+
+// dot product of the coefficients with the window px
+static inline int64_t plp_lms_q32_dot(const int32_t *pCoeffs,
+                                      const int32_t *px,
+                                      uint32_t numTaps) {
+    uint32_t k;
+    int64_t acc = 0;
+    for (k = 0; k < numTaps; k++) {
+        acc += (int64_t)pCoeffs[k] * px[k];
+    }
+    return acc;
+}
+
+// updates the coefficients with the window px and the scaled error g, and returns the dot product
+// of the new coefficients with the next window px + 1
+static inline int64_t plp_lms_q32_update_dot(int32_t *pCoeffs,
+                                             const int32_t *px,
+                                             uint32_t numTaps,
+                                             int32_t g) {
+    uint32_t k;
+    int64_t acc = 0;
+    for (k = 0; k < numTaps; k++) {
+        int32_t w = saturate_q32(pCoeffs[k] + (((int64_t)g * px[k] + (1 << 30)) >> 31), 0);
+        pCoeffs[k] = w;
+        acc += (int64_t)w * px[k + 1];
+    }
+    return acc;
+}
+
+// updates the coefficients with the window px and the scaled error g
+static inline void plp_lms_q32_update(int32_t *pCoeffs,
+                                      const int32_t *px,
+                                      uint32_t numTaps,
+                                      int32_t g) {
+    uint32_t k;
+    for (k = 0; k < numTaps; k++) {
+        pCoeffs[k] = saturate_q32(pCoeffs[k] + (((int64_t)g * px[k] + (1 << 30)) >> 31), 0);
+    }
+}
+
+/**
+  @ingroup LMS
+ */
+
+/**
+  @addtogroup LMSKernels
+  @{
+ */
+
+/**
+  @brief LMS filtering of a 32-bit fixed-point block kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_lms_init_q32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference samples
+  @param[in]  blockSize  number of samples, at most the block size of the instance
+  @param[out] pOut       points to the block of filter outputs, which may be equal to pSrc
+  @param[out] pErr       points to the block of error samples, which may be equal to pRef
+  @return     none
+ */
+
+void plp_lms_q32s_xpulpv2(const plp_lms_instance_q32 *S,
+                          const int32_t *pSrc,
+                          const int32_t *pRef,
+                          uint32_t blockSize,
+                          int32_t *pOut,
+                          int32_t *pErr) {
+
+    uint32_t n;
+    uint32_t numTaps = S->numTaps;
+    int32_t *pState = S->pState;
+    int32_t *pCoeffs = S->pCoeffs;
+    int32_t mu = S->mu;
+    uint32_t shift = 31 - S->postShift;
+
+    for (n = 0; n < blockSize; n++) {
+        pState[numTaps - 1 + n] = pSrc[n];
+    }
+
+    // the output of the first sample is computed here, all following outputs are computed while
+    // updating the coefficients
+    int64_t acc = plp_lms_q32_dot(pCoeffs, pState, numTaps);
+
+    for (n = 0; n < blockSize; n++) {
+        int32_t y = saturate_q32(acc, shift);
+        int32_t e = saturate_q32((int64_t)pRef[n] - y, 0);
+        int32_t g = saturate_q32((int64_t)mu * e, 31);
+        pOut[n] = y;
+        pErr[n] = e;
+
+        if (n + 1 < blockSize) {
+            acc = plp_lms_q32_update_dot(pCoeffs, &pState[n], numTaps, g);
+        } else {
+            plp_lms_q32_update(pCoeffs, &pState[n], numTaps, g);
+        }
+    }
+
+    for (n = 0; n < numTaps - 1; n++) {
+        pState[n] = pState[n + blockSize];
+    }
+}
+
+/**
+  @} end of LMSKernels group
+ */
@@ -0,0 +1,233 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_filter_f32_xpulpv2.c
+ * Description:  Median and rank-order filter of 32-bit floating-point streams for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// sorts the window of the first output, the history and the first input sample
+static void median_filter_f32_sort(const float32_t *pHist,
+                                   float32_t first,
+                                   uint32_t windowLen,
+                                   float32_t *pSorted) {
+
+    uint32_t i, j;
+
+    for (i = 0; i < windowLen; i++) {
+        float32_t x = (i + 1 < windowLen) ? pHist[i] : first;
+        for (j = i; j > 0 && pSorted[j - 1] > x; j--) {
+            pSorted[j] = pSorted[j - 1];
+        }
+        pSorted[j] = x;
+    }
+}
+
+// replaces xOut by xIn in the sorted window, shifting only the values between both positions
+static inline void median_filter_f32_replace(float32_t *pSorted,
+                                             uint32_t windowLen,
+                                             float32_t xOut,
+                                             float32_t xIn) {
+
+    uint32_t lo = 0;
+    uint32_t hi = windowLen - 1;
+
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) >> 1;
+        if (pSorted[mid] < xOut) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (xIn > xOut) {
+        for (; lo + 1 < windowLen && pSorted[lo + 1] < xIn; lo++) {
+            pSorted[lo] = pSorted[lo + 1];
+        }
+    } else {
+        for (; lo > 0 && pSorted[lo - 1] > xIn; lo--) {
+            pSorted[lo] = pSorted[lo - 1];
+        }
+    }
+    pSorted[lo] = xIn;
+}
+
+// output of a block with the sorted window, which is kept in the second half of the state
+static void median_filter_f32_sorted(const plp_median_filter_instance_f32 *S,
+                                     const float32_t *pSrc,
+                                     uint32_t blockSize,
+                                     float32_t *pDst) {
+
+    uint32_t windowLen = S->windowLen;
+    uint32_t rank = S->rank;
+    const float32_t *pHist = S->pState;
+    float32_t *pSorted = &S->pState[windowLen - 1];
+    uint32_t n;
+
+    median_filter_f32_sort(pHist, pSrc[0], windowLen, pSorted);
+    pDst[0] = pSorted[rank];
+
+    for (n = 1; n < blockSize; n++) {
+        float32_t xOut = (n < windowLen) ? pHist[n - 1] : pSrc[n - windowLen];
+        median_filter_f32_replace(pSorted, windowLen, xOut, pSrc[n]);
+        pDst[n] = pSorted[rank];
+    }
+}
+
+// keeps the last windowLen-1 input samples in the first half of the state
+static void median_filter_f32_history(const plp_median_filter_instance_f32 *S,
+                                      const float32_t *pSrc,
+                                      uint32_t blockSize) {
+
+    uint32_t histLen = S->windowLen - 1;
+    float32_t *pHist = S->pState;
+    uint32_t i;
+
+    if (blockSize >= histLen) {
+        for (i = 0; i < histLen; i++) {
+            pHist[i] = pSrc[blockSize - histLen + i];
+        }
+    } else {
+        for (i = 0; i < histLen - blockSize; i++) {
+            pHist[i] = pHist[i + blockSize];
+        }
+        for (i = 0; i < blockSize; i++) {
+            pHist[histLen - blockSize + i] = pSrc[i];
+        }
+    }
+}
+
+// outputs of the windows pX[j..j+windowLen-1] for j < count with an odd-even transposition sorting
+// network of branch-free minimum and maximum operations
+static void median_filter_f32_network(const float32_t *pX,
+                                      uint32_t windowLen,
+                                      uint32_t rank,
+                                      uint32_t count,
+                                      float32_t *pDst) {
+
+    float32_t s[PLP_MEDIAN_FILTER_NETWORK_LEN] = { 0 };
+    uint32_t j, k, r;
+
+    for (j = 0; j < count; j++) {
+        for (k = 0; k < windowLen; k++) {
+            s[k] = pX[j + k];
+        }
+        for (r = 0; r < windowLen; r++) {
+            for (k = r & 1; k + 1 < windowLen; k += 2) {
+                float32_t lo = fminf(s[k], s[k + 1]);
+                s[k + 1] = fmaxf(s[k], s[k + 1]);
+                s[k] = lo;
+            }
+        }
+        pDst[j] = s[rank];
+    }
+}
+
+/**
+  @ingroup MedianFilter
+ */
+
+/**
+  @addtogroup MedianFilterKernels
+  @{
+ */
+
+/**
+  @brief Median and rank-order filter of a 32-bit floating-point block kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_median_filter_init_f32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input and output samples
+  @param[out] pDst       points to the block of output samples, which must not overlap pSrc
+  @return     none
+
+  @par Windows of at most PLP_MEDIAN_FILTER_NETWORK_LEN samples are sorted from scratch with a
+  sorting network of fmin.s and fmax.s instructions. Larger windows are kept sorted, and every
+  sample replaces the oldest value of the window.
+ */
+
+void plp_median_filter_f32s_xpulpv2(const plp_median_filter_instance_f32 *S,
+                                    const float32_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    float32_t *__restrict__ pDst) {
+
+    uint32_t windowLen = S->windowLen;
+    uint32_t i;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    if (windowLen <= PLP_MEDIAN_FILTER_NETWORK_LEN) {
+        // windows which overlap the history are copied next to the first input samples
+        float32_t head[2 * PLP_MEDIAN_FILTER_NETWORK_LEN] = { 0 };
+        uint32_t headLen = (blockSize < windowLen - 1) ? blockSize : windowLen - 1;
+
+        for (i = 0; i < windowLen - 1; i++) {
+            head[i] = S->pState[i];
+        }
+        for (i = 0; i < headLen; i++) {
+            head[windowLen - 1 + i] = pSrc[i];
+        }
+        median_filter_f32_network(head, windowLen, S->rank, headLen, pDst);
+
+        if (blockSize > windowLen - 1) {
+            median_filter_f32_network(pSrc, windowLen, S->rank, blockSize - (windowLen - 1),
+                                      &pDst[windowLen - 1]);
+        }
+    } else {
+        median_filter_f32_sorted(S, pSrc, blockSize, pDst);
+    }
+
+    median_filter_f32_history(S, pSrc, blockSize);
+}
+
+/**
+  @brief Parallel multi-channel median and rank-order filter of 32-bit floating-point blocks
+         kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_median_filter_instance_f32_parallel struct initialized by
+                    plp_median_filter_f32_parallel
+  @return     none
+
+  @par Core k filters the channels k, k+nPE, k+2*nPE, ... with plp_median_filter_f32s_xpulpv2.
+  The channels are independent, hence no synchronization is needed.
+ */
+
+void plp_median_filter_f32p_xpulpv2(void *args) {
+
+    plp_median_filter_instance_f32_parallel *a = (plp_median_filter_instance_f32_parallel *)args;
+
+    uint32_t blockSize = a->blockSize;
+    uint32_t c;
+
+    for (c = rt_core_id(); c < a->nChannels; c += a->nPE) {
+        plp_median_filter_f32s_xpulpv2(&a->S[c], &a->pSrc[c * blockSize], blockSize,
+                                       &a->pDst[c * blockSize]);
+    }
+}
+
+/**
+  @} end of MedianFilterKernels group
+ */
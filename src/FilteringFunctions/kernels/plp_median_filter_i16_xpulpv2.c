@@ -0,0 +1,250 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_filter_i16_xpulpv2.c
+ * Description:  Median and rank-order filter of 16-bit integer streams for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// sorts the window of the first output, the history and the first input sample
+static void median_filter_i16_sort(const int16_t *pHist,
+                                   int16_t first,
+                                   uint32_t windowLen,
+                                   int16_t *pSorted) {
+
+    uint32_t i, j;
+
+    for (i = 0; i < windowLen; i++) {
+        int16_t x = (i + 1 < windowLen) ? pHist[i] : first;
+        for (j = i; j > 0 && pSorted[j - 1] > x; j--) {
+            pSorted[j] = pSorted[j - 1];
+        }
+        pSorted[j] = x;
+    }
+}
+
+// replaces xOut by xIn in the sorted window, shifting only the values between both positions
+static inline void median_filter_i16_replace(int16_t *pSorted,
+                                             uint32_t windowLen,
+                                             int16_t xOut,
+                                             int16_t xIn) {
+
+    uint32_t lo = 0;
+    uint32_t hi = windowLen - 1;
+
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) >> 1;
+        if (pSorted[mid] < xOut) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (xIn > xOut) {
+        for (; lo + 1 < windowLen && pSorted[lo + 1] < xIn; lo++) {
+            pSorted[lo] = pSorted[lo + 1];
+        }
+    } else {
+        for (; lo > 0 && pSorted[lo - 1] > xIn; lo--) {
+            pSorted[lo] = pSorted[lo - 1];
+        }
+    }
+    pSorted[lo] = xIn;
+}
+
+// output of a block with the sorted window, which is kept in the second half of the state
+static void median_filter_i16_sorted(const plp_median_filter_instance_i16 *S,
+                                     const int16_t *pSrc,
+                                     uint32_t blockSize,
+                                     int16_t *pDst) {
+
+    uint32_t windowLen = S->windowLen;
+    uint32_t rank = S->rank;
+    const int16_t *pHist = S->pState;
+    int16_t *pSorted = &S->pState[windowLen - 1];
+    uint32_t n;
+
+    median_filter_i16_sort(pHist, pSrc[0], windowLen, pSorted);
+    pDst[0] = pSorted[rank];
+
+    for (n = 1; n < blockSize; n++) {
+        int16_t xOut = (n < windowLen) ? pHist[n - 1] : pSrc[n - windowLen];
+        median_filter_i16_replace(pSorted, windowLen, xOut, pSrc[n]);
+        pDst[n] = pSorted[rank];
+    }
+}
+
+// keeps the last windowLen-1 input samples in the first half of the state
+static void median_filter_i16_history(const plp_median_filter_instance_i16 *S,
+                                      const int16_t *pSrc,
+                                      uint32_t blockSize) {
+
+    uint32_t histLen = S->windowLen - 1;
+    int16_t *pHist = S->pState;
+    uint32_t i;
+
+    if (blockSize >= histLen) {
+        for (i = 0; i < histLen; i++) {
+            pHist[i] = pSrc[blockSize - histLen + i];
+        }
+    } else {
+        for (i = 0; i < histLen - blockSize; i++) {
+            pHist[i] = pHist[i + blockSize];
+        }
+        for (i = 0; i < blockSize; i++) {
+            pHist[histLen - blockSize + i] = pSrc[i];
+        }
+    }
+}
+
+// outputs of the windows pX[j..j+windowLen-1] for j < count with an odd-even transposition sorting
+// network, two neighbouring windows at a time in the two halves of a SIMD register
+static void median_filter_i16_network(const int16_t *pX,
+                                      uint32_t windowLen,
+                                      uint32_t rank,
+                                      uint32_t count,
+                                      int16_t *pDst) {
+
+    v2s win[PLP_MEDIAN_FILTER_NETWORK_LEN];
+    uint32_t j, k, r;
+
+    for (j = 0; j + 1 < count; j += 2) {
+        for (k = 0; k < windowLen; k++) {
+            win[k] = *((v2s *)&pX[j + k]);
+        }
+        for (r = 0; r < windowLen; r++) {
+            for (k = r & 1; k + 1 < windowLen; k += 2) {
+                v2s lo = __MIN2(win[k], win[k + 1]);
+                win[k + 1] = __MAX2(win[k], win[k + 1]);
+                win[k] = lo;
+            }
+        }
+        pDst[j] = win[rank][0];
+        pDst[j + 1] = win[rank][1];
+    }
+
+    // last window, if count is odd
+    if (j < count) {
+        int16_t s[PLP_MEDIAN_FILTER_NETWORK_LEN];
+        for (k = 0; k < windowLen; k++) {
+            s[k] = pX[j + k];
+        }
+        for (r = 0; r < windowLen; r++) {
+            for (k = r & 1; k + 1 < windowLen; k += 2) {
+                int16_t lo = (s[k] < s[k + 1]) ? s[k] : s[k + 1];
+                s[k + 1] = (s[k] < s[k + 1]) ? s[k + 1] : s[k];
+                s[k] = lo;
+            }
+        }
+        pDst[j] = s[rank];
+    }
+}
+
+/**
+  @ingroup MedianFilter
+ */
+
+/**
+  @addtogroup MedianFilterKernels
+  @{
+ */
+
+/**
+  @brief Median and rank-order filter of a 16-bit integer block kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_median_filter_init_i16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input and output samples
+  @param[out] pDst       points to the block of output samples, which must not overlap pSrc
+  @return     none
+
+  @par Windows of at most PLP_MEDIAN_FILTER_NETWORK_LEN samples are sorted from scratch with a
+  sorting network, which computes two outputs at a time with pv.min and pv.max. Larger windows are
+  kept sorted, and every sample replaces the oldest value of the window.
+ */
+
+void plp_median_filter_i16s_xpulpv2(const plp_median_filter_instance_i16 *S,
+                                    const int16_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    int16_t *__restrict__ pDst) {
+
+    uint32_t windowLen = S->windowLen;
+    uint32_t i;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    if (windowLen <= PLP_MEDIAN_FILTER_NETWORK_LEN) {
+        // windows which overlap the history are copied next to the first input samples
+        int16_t head[2 * PLP_MEDIAN_FILTER_NETWORK_LEN] = { 0 };
+        uint32_t headLen = (blockSize < windowLen - 1) ? blockSize : windowLen - 1;
+
+        for (i = 0; i < windowLen - 1; i++) {
+            head[i] = S->pState[i];
+        }
+        for (i = 0; i < headLen; i++) {
+            head[windowLen - 1 + i] = pSrc[i];
+        }
+        median_filter_i16_network(head, windowLen, S->rank, headLen, pDst);
+
+        if (blockSize > windowLen - 1) {
+            median_filter_i16_network(pSrc, windowLen, S->rank, blockSize - (windowLen - 1),
+                                      &pDst[windowLen - 1]);
+        }
+    } else {
+        median_filter_i16_sorted(S, pSrc, blockSize, pDst);
+    }
+
+    median_filter_i16_history(S, pSrc, blockSize);
+}
+
+/**
+  @brief Parallel multi-channel median and rank-order filter of 16-bit integer blocks kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_median_filter_instance_i16_parallel struct initialized by
+                    plp_median_filter_i16_parallel
+  @return     none
+
+  @par Core k filters the channels k, k+nPE, k+2*nPE, ... with plp_median_filter_i16s_xpulpv2.
+  The channels are independent, hence no synchronization is needed.
+ */
+
+void plp_median_filter_i16p_xpulpv2(void *args) {
+
+    plp_median_filter_instance_i16_parallel *a = (plp_median_filter_instance_i16_parallel *)args;
+
+    uint32_t blockSize = a->blockSize;
+    uint32_t c;
+
+    for (c = rt_core_id(); c < a->nChannels; c += a->nPE) {
+        plp_median_filter_i16s_xpulpv2(&a->S[c], &a->pSrc[c * blockSize], blockSize,
+                                       &a->pDst[c * blockSize]);
+    }
+}
+
+/**
+  @} end of MedianFilterKernels group
+ */
@@ -0,0 +1,195 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pbconv_f32_xpulpv2.c
+ * Description:  Partitioned convolution of a 32-bit floating-point stream kernels for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void process_pbconv_f32(plp_pbconv_instance_f32 *S,
+                                      const float32_t *pSrc,
+                                      uint32_t numSamples,
+                                      float32_t *pDst,
+                                      uint32_t coreId,
+                                      uint32_t nPE);
+
+/**
+  @ingroup PartitionedConvolution
+ */
+
+/**
+  @defgroup PartitionedConvolutionKernels Partitioned Convolution Kernels
+  @{
+ */
+
+/**
+  @brief Partitioned convolution of a 32-bit floating-point stream for XPULPV2 extension.
+  @param[in,out] S           points to the instance, initialized by plp_pbconv_init_f32
+  @param[in]     pSrc        points to the next numSamples input samples
+  @param[in]     numSamples  number of input and output samples, a multiple of S->blockLen
+  @param[out]    pDst        points to the output buffer of numSamples samples
+  @return        none
+ */
+
+void plp_pbconv_f32s_xpulpv2(plp_pbconv_instance_f32 *S,
+                             const float32_t *__restrict__ pSrc,
+                             uint32_t numSamples,
+                             float32_t *__restrict__ pDst) {
+
+    process_pbconv_f32(S, pSrc, numSamples, pDst, 0, 1);
+}
+
+/**
+  @brief Parallel partitioned convolution of a 32-bit floating-point stream for XPULPV2 extension.
+  @param[in]  args  pointer to plp_pbconv_instance_f32_parallel struct initialized by
+                    plp_pbconv_f32_parallel
+  @return     none
+
+  @par Every core builds a contiguous part of the input block, and accumulates the partitions of a
+  contiguous range of the bins 0 to blockLen. The transforms are computed by the parallel kernels
+  plp_rfft_f32_xpulpv2_parallel and plp_rifft_f32_xpulpv2_parallel.
+ */
+
+void plp_pbconv_f32p_xpulpv2(void *args) {
+
+    plp_pbconv_instance_f32_parallel *a = (plp_pbconv_instance_f32_parallel *)args;
+
+    process_pbconv_f32(a->S, a->pSrc, a->numSamples, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+  @} end of PartitionedConvolutionKernels group
+ */
+
+static inline void process_pbconv_f32(plp_pbconv_instance_f32 *S,
+                                      const float32_t *pSrc,
+                                      uint32_t numSamples,
+                                      float32_t *pDst,
+                                      uint32_t coreId,
+                                      uint32_t nPE) {
+
+    uint32_t o, n, k, p, start, end, binStart, binEnd, outStart, outEnd;
+    uint32_t N = S->S->FFTLength;
+    uint32_t B = S->blockLen;
+    uint32_t P = S->numPartitions;
+    uint32_t stride = 2 * (B + 1); // values per spectrum in the delay line
+    uint32_t cur = S->fdlIndex;
+    const float32_t *pPrev = S->pState;
+    float32_t *pTime = S->pBuffer;
+    float32_t *pFreq = S->pBuffer + N;
+    plp_rfft_parallel_arg_f32 fftArgs = {
+        .S = (plp_rfft_instance_f32 *)S->S, .pSrc = pTime, .nPE = nPE, .pDst = pFreq
+    };
+    plp_rfft_parallel_arg_f32 ifftArgs = {
+        .S = (plp_rfft_instance_f32 *)S->S, .pSrc = pFreq, .nPE = nPE, .pDst = pTime
+    };
+
+    plp_team_chunk(N, nPE, coreId, 1, &start, &end);
+    plp_team_chunk(B + 1, nPE, coreId, 1, &binStart, &binEnd);
+    plp_team_chunk(B, nPE, coreId, 1, &outStart, &outEnd);
+
+    for (o = 0; o < numSamples; o += B) {
+
+        // input block: B past samples and B new samples
+        for (n = start; n < end; n++) {
+            pTime[n] = (n < B) ? pPrev[n] : pSrc[o + n - B];
+        }
+        pPrev = pSrc + o;
+
+        if (nPE > 1) {
+            rt_team_barrier();
+            plp_rfft_f32_xpulpv2_parallel(&fftArgs);
+        } else {
+            plp_rfft_f32_xpulpv2(S->S, pTime, pFreq);
+        }
+
+        // the newest spectrum replaces the oldest one
+        cur = (cur == 0) ? P - 1 : cur - 1;
+
+        for (k = binStart; k < binEnd; k++) {
+            float32_t *pX = S->pFdl + cur * stride + 2 * k;
+            const float32_t *pH = S->pFilterSpectra + 2 * k;
+            float32_t accRe = 0.0f;
+            float32_t accIm = 0.0f;
+
+            pX[0] = pFreq[2 * k];
+            pX[1] = pFreq[2 * k + 1];
+
+            // partition p is multiplied with the spectrum of p blocks ago, which is in slot
+            // cur + p, wrapped around at the end of the delay line
+            for (p = cur; p < P; p++) {
+                accRe += pX[0] * pH[0];
+                accRe -= pX[1] * pH[1];
+                accIm += pX[0] * pH[1];
+                accIm += pX[1] * pH[0];
+                pX += stride;
+                pH += stride;
+            }
+            pX = S->pFdl + 2 * k;
+            for (p = 0; p < cur; p++) {
+                accRe += pX[0] * pH[0];
+                accRe -= pX[1] * pH[1];
+                accIm += pX[0] * pH[1];
+                accIm += pX[1] * pH[0];
+                pX += stride;
+                pH += stride;
+            }
+
+            // bins above B by conjugate symmetry, they are not read from the forward transform
+            pFreq[2 * k] = accRe;
+            pFreq[2 * k + 1] = accIm;
+            if (k > 0 && k < B) {
+                pFreq[2 * (N - k)] = accRe;
+                pFreq[2 * (N - k) + 1] = -accIm;
+            }
+        }
+
+        if (nPE > 1) {
+            rt_team_barrier();
+            plp_rifft_f32_xpulpv2_parallel(&ifftArgs);
+        } else {
+            plp_rifft_f32_xpulpv2(S->S, pFreq, pTime);
+        }
+
+        // the first B samples contain the circular wrap-around
+        for (n = outStart; n < outEnd; n++) {
+            pDst[o + n] = pTime[B + n];
+        }
+
+        if (nPE > 1) {
+            rt_team_barrier();
+        }
+    }
+
+    // keep the last block of the input and the position of the newest spectrum
+    if (numSamples > 0) {
+        for (n = outStart; n < outEnd; n++) {
+            S->pState[n] = pSrc[numSamples - B + n];
+        }
+        if (coreId == 0) {
+            S->fdlIndex = cur;
+        }
+    }
+}
@@ -0,0 +1,144 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pbconv_q16s_rv32im.c
+ * Description:  Partitioned convolution of a 16-bit fixed-point stream kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// x * 2^-shift, rounded and saturated to 16 bits
+static inline int16_t saturate_q16(int32_t x, int32_t shift) {
+    int64_t y;
+    if (shift > 0) {
+        y = ((int64_t)x + (1 << (shift - 1))) >> shift;
+    } else {
+        y = (int64_t)x << (-shift);
+    }
+    return (int16_t)((y > 32767) ? 32767 : ((y < -32768) ? -32768 : y));
+}
+
+/**
+  @ingroup PartitionedConvolution
+ */
+
+/**
+  @addtogroup PartitionedConvolutionKernels
+  @{
+ */
+
+/**
+  @brief Partitioned convolution of a 16-bit fixed-point stream for RV32IM extension.
+  @param[in,out] S           points to the instance, initialized by plp_pbconv_init_q16
+  @param[in]     pSrc        points to the next numSamples input samples
+  @param[in]     numSamples  number of input and output samples, a multiple of S->blockLen
+  @param[out]    pDst        points to the output buffer of numSamples samples
+  @return        none
+ */
+
+void plp_pbconv_q16s_rv32im(plp_pbconv_instance_q16 *S,
+                            const int16_t *__restrict__ pSrc,
+                            uint32_t numSamples,
+                            int16_t *__restrict__ pDst) {
+
+
+    uint32_t o, n, k, p;
+    uint32_t N = S->S->fftLen;
+    uint32_t B = S->blockLen;
+    uint32_t P = S->numPartitions;
+    uint32_t stride = 2 * (B + 1); // values per spectrum in the delay line
+    uint32_t cur = S->fdlIndex;
+    int32_t shift = S->outShift;
+    const int16_t *pPrev = S->pState;
+    int32_t *pBuf = S->pBuffer;
+
+    for (o = 0; o < numSamples; o += B) {
+
+        // input block of B past samples and B new samples, scaled to Q2.30
+        for (n = 0; n < N; n++) {
+            pBuf[2 * n] = (int32_t)((n < B) ? pPrev[n] : pSrc[o + n - B]) << 15;
+            pBuf[2 * n + 1] = 0;
+        }
+        pPrev = pSrc + o;
+
+        plp_cfft_q32s_rv32im(S->S, pBuf, 0, 1, 31);
+
+        // the newest spectrum replaces the oldest one
+        cur = (cur == 0) ? P - 1 : cur - 1;
+
+        for (k = 0; k <= B; k++) {
+            int32_t *pX = S->pFdl + cur * stride + 2 * k;
+            const int32_t *pH = S->pFilterSpectra + 2 * k;
+            int32_t accRe = 0;
+            int32_t accIm = 0;
+
+            pX[0] = pBuf[2 * k];
+            pX[1] = pBuf[2 * k + 1];
+
+            // partition p is multiplied with the spectrum of p blocks ago, which is in slot
+            // cur + p, wrapped around at the end of the delay line
+            for (p = cur; p < P; p++) {
+                accRe += (int32_t)(((int64_t)pX[0] * pH[0] - (int64_t)pX[1] * pH[1]) >> 31);
+                accIm += (int32_t)(((int64_t)pX[0] * pH[1] + (int64_t)pX[1] * pH[0]) >> 31);
+                pX += stride;
+                pH += stride;
+            }
+            pX = S->pFdl + 2 * k;
+            for (p = 0; p < cur; p++) {
+                accRe += (int32_t)(((int64_t)pX[0] * pH[0] - (int64_t)pX[1] * pH[1]) >> 31);
+                accIm += (int32_t)(((int64_t)pX[0] * pH[1] + (int64_t)pX[1] * pH[0]) >> 31);
+                pX += stride;
+                pH += stride;
+            }
+
+            // conjugated spectrum, such that the forward transform computes the conjugated
+            // inverse transform, completed by conjugate symmetry
+            pBuf[2 * k] = accRe;
+            pBuf[2 * k + 1] = -accIm;
+            if (k > 0 && k < B) {
+                pBuf[2 * (N - k)] = accRe;
+                pBuf[2 * (N - k) + 1] = accIm;
+            }
+        }
+
+        plp_cfft_q32s_rv32im(S->S, pBuf, 0, 1, 31);
+
+        // the first B samples contain the circular wrap-around, the output is real
+        for (n = 0; n < B; n++) {
+            pDst[o + n] = saturate_q16(pBuf[2 * (B + n)], shift);
+        }
+    }
+
+    // keep the last block of the input and the position of the newest spectrum
+    if (numSamples > 0) {
+        for (n = 0; n < B; n++) {
+            S->pState[n] = pSrc[numSamples - B + n];
+        }
+        S->fdlIndex = cur;
+    }
+}
+
+/**
+  @} end of PartitionedConvolutionKernels group
+ */
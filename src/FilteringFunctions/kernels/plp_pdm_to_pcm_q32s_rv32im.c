@@ -0,0 +1,116 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pdm_to_pcm_q32s_rv32im.c
+ * Description:  PDM to PCM conversion with 32-bit fixed-point output on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Combs of the N stages with differential delay D, applied to the integrator output y, followed by
+// the rounding shift of the output
+static inline int32_t plp_cic_decimate_comb(uint32_t *pComb,
+                                            uint32_t y,
+                                            uint32_t N,
+                                            uint32_t D,
+                                            uint32_t shift) {
+
+    uint32_t s, k;
+    uint32_t x;
+
+    for (s = 0; s < N; s++) {
+        x = y;
+        y -= pComb[s * D + D - 1];
+        for (k = D - 1; k > 0; k--) {
+            pComb[s * D + k] = pComb[s * D + k - 1];
+        }
+        pComb[s * D] = x;
+    }
+
+    return (int32_t)(y + ((1 << shift) >> 1)) >> shift;
+}
+
+/**
+  @ingroup PDMToPCM
+ */
+
+/**
+  @defgroup PDMToPCMKernels PDM to PCM Conversion Kernels
+  @{
+ */
+
+/**
+  @brief PDM to PCM conversion with 32-bit fixed-point output kernel for RV32IM extension.
+  @param[in]  S          points to the instance, initialized by plp_pdm_to_pcm_init_q32
+  @param[in]  pSrc       points to the blockSize PDM bits, packed into blockSize/32 words
+  @param[in]  blockSize  number of PDM bits, the block size of the instance
+  @param[out] pDst       points to the blockSize/(R*M) PCM samples
+  @return     none
+
+  @par The CIC decimator integrates the bits as +1 or -1 and writes its blockSize/R outputs to the
+  buffer of the instance, which is then filtered by plp_fir_decimate_q32s_rv32im.
+ */
+
+void plp_pdm_to_pcm_q32s_rv32im(const plp_pdm_to_pcm_instance_q32 *S,
+                                const uint32_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                int32_t *__restrict__ pDst) {
+
+    plp_cic_decimate_instance_i32 *pCic = S->pCic;
+
+    uint32_t w, b, s;
+    uint32_t N = pCic->numStages;
+    uint32_t R = pCic->R;
+    uint32_t D = pCic->diffDelay;
+    uint32_t *pInteg = (uint32_t *)pCic->pState;
+    uint32_t *pComb = pInteg + N;
+    uint32_t phase = pCic->phase;
+    int32_t *pBuffer = S->pBuffer;
+    uint32_t word, x;
+
+    for (w = 0; w < (blockSize >> 5); w++) {
+        word = pSrc[w];
+        for (b = 0; b < 32; b++) {
+            // a set bit is +1, a cleared bit -1
+            x = ((word & 1) << 1) - 1;
+            word >>= 1;
+            for (s = 0; s < N; s++) {
+                x += pInteg[s];
+                pInteg[s] = x;
+            }
+            if (++phase == R) {
+                phase = 0;
+                *pBuffer++ = plp_cic_decimate_comb(pComb, pInteg[N - 1], N, D, pCic->shift);
+            }
+        }
+    }
+
+    pCic->phase = phase;
+
+    plp_fir_decimate_q32s_rv32im(S->pFir, S->pBuffer, blockSize / R, pDst);
+}
+
+/**
+  @} end of PDMToPCMKernels group
+ */
@@ -0,0 +1,171 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pdm_to_pcm_q32s_xpulpv2.c
+ * Description:  PDM to PCM conversion with 32-bit fixed-point output on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Combs of the N stages with differential delay D, applied to the integrator output y, followed by
+// the rounding shift of the output
+static inline int32_t plp_cic_decimate_comb(uint32_t *pComb,
+                                            uint32_t y,
+                                            uint32_t N,
+                                            uint32_t D,
+                                            uint32_t shift) {
+
+    uint32_t s, k;
+    uint32_t x;
+
+    for (s = 0; s < N; s++) {
+        x = y;
+        y -= pComb[s * D + D - 1];
+        for (k = D - 1; k > 0; k--) {
+            pComb[s * D + k] = pComb[s * D + k - 1];
+        }
+        pComb[s * D] = x;
+    }
+
+    return (int32_t)(y + ((1 << shift) >> 1)) >> shift;
+}
+
+// CIC decimation of the PDM bits with N stages. It is called with a constant N, such that the stage
+// loops are unrolled and the integrators are kept in registers instead of the state buffer.
+static inline void plp_pdm_to_pcm_cic_stages(plp_cic_decimate_instance_i32 *pCic,
+                                             const uint32_t *__restrict__ pSrc,
+                                             uint32_t blockSize,
+                                             int32_t *__restrict__ pBuffer,
+                                             const uint32_t N) {
+
+    uint32_t i, s;
+    uint32_t R = pCic->R;
+    uint32_t D = pCic->diffDelay;
+    uint32_t integ[PLP_CIC_MAX_STAGES];
+    uint32_t *pComb = (uint32_t *)pCic->pState + N;
+    uint32_t phase = pCic->phase;
+    uint32_t bits = 0; // bits left in word
+    uint32_t word = 0;
+    uint32_t run, x;
+
+    for (s = 0; s < N; s++) {
+        integ[s] = (uint32_t)pCic->pState[s];
+    }
+
+    while (blockSize > 0) {
+        if (bits == 0) {
+            word = *pSrc++;
+            bits = 32;
+        }
+
+        // integrate up to the end of the word or the next output, whichever comes first
+        run = R - phase;
+        if (run > bits) {
+            run = bits;
+        }
+
+        for (i = 0; i < run; i++) {
+            // a set bit is +1, a cleared bit -1
+            x = ((word & 1) << 1) - 1;
+            word >>= 1;
+            for (s = 0; s < N; s++) {
+                integ[s] += x;
+                x = integ[s];
+            }
+        }
+
+        bits -= run;
+        blockSize -= run;
+        phase += run;
+
+        if (phase == R) {
+            phase = 0;
+            *pBuffer++ = plp_cic_decimate_comb(pComb, integ[N - 1], N, D, pCic->shift);
+        }
+    }
+
+    for (s = 0; s < N; s++) {
+        pCic->pState[s] = (int32_t)integ[s];
+    }
+
+    pCic->phase = phase;
+}
+
+/**
+  @ingroup PDMToPCM
+ */
+
+/**
+  @addtogroup PDMToPCMKernels
+  @{
+ */
+
+/**
+  @brief PDM to PCM conversion with 32-bit fixed-point output kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_pdm_to_pcm_init_q32
+  @param[in]  pSrc       points to the blockSize PDM bits, packed into blockSize/32 words
+  @param[in]  blockSize  number of PDM bits, the block size of the instance
+  @param[out] pDst       points to the blockSize/(R*M) PCM samples
+  @return     none
+
+  @par The CIC decimator is specialized for every number of stages like in
+  plp_cic_decimate_i32s_xpulpv2, and integrates the bits as +1 or -1 in runs without branches. Its
+  blockSize/R outputs are written to the buffer of the instance, which is then filtered by
+  plp_fir_decimate_q32s_xpulpv2.
+ */
+
+void plp_pdm_to_pcm_q32s_xpulpv2(const plp_pdm_to_pcm_instance_q32 *S,
+                                 const uint32_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 int32_t *__restrict__ pDst) {
+
+    plp_cic_decimate_instance_i32 *pCic = S->pCic;
+
+    switch (pCic->numStages) {
+    case 1:
+        plp_pdm_to_pcm_cic_stages(pCic, pSrc, blockSize, S->pBuffer, 1);
+        break;
+    case 2:
+        plp_pdm_to_pcm_cic_stages(pCic, pSrc, blockSize, S->pBuffer, 2);
+        break;
+    case 3:
+        plp_pdm_to_pcm_cic_stages(pCic, pSrc, blockSize, S->pBuffer, 3);
+        break;
+    case 4:
+        plp_pdm_to_pcm_cic_stages(pCic, pSrc, blockSize, S->pBuffer, 4);
+        break;
+    case 5:
+        plp_pdm_to_pcm_cic_stages(pCic, pSrc, blockSize, S->pBuffer, 5);
+        break;
+    default:
+        plp_pdm_to_pcm_cic_stages(pCic, pSrc, blockSize, S->pBuffer, PLP_CIC_MAX_STAGES);
+        break;
+    }
+
+    plp_fir_decimate_q32s_xpulpv2(S->pFir, S->pBuffer, blockSize / pCic->R, pDst);
+}
+
+/**
+  @} end of PDMToPCMKernels group
+ */
@@ -0,0 +1,162 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pfb_analysis_f32_xpulpv2.c
+ * Description:  Polyphase filter bank analysis of 32-bit floating-point samples kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void process_pfb_analysis_f32(plp_pfb_analysis_instance_f32 *S,
+                                            const float32_t *pSrc,
+                                            uint32_t numFrames,
+                                            float32_t *pDst,
+                                            uint32_t coreId,
+                                            uint32_t nPE);
+
+/**
+  @ingroup PolyphaseFilterBank
+ */
+
+/**
+  @defgroup PolyphaseFilterBankKernels Polyphase Filter Bank Kernels
+  @{
+ */
+
+/**
+  @brief Polyphase filter bank analysis of 32-bit floating-point samples for XPULPV2 extension.
+  @param[in,out] S          points to the instance, initialized by plp_pfb_analysis_init_f32
+  @param[in]     pSrc       points to numFrames*numChannels complex input samples
+  @param[in]     numFrames  number of frames
+  @param[out]    pDst       points to the output buffer of numFrames*numChannels complex samples
+  @return        none
+ */
+
+void plp_pfb_analysis_f32s_xpulpv2(plp_pfb_analysis_instance_f32 *S,
+                                   const float32_t *__restrict__ pSrc,
+                                   uint32_t numFrames,
+                                   float32_t *__restrict__ pDst) {
+
+    process_pfb_analysis_f32(S, pSrc, numFrames, pDst, 0, 1);
+}
+
+/**
+  @brief Parallel polyphase filter bank analysis of 32-bit floating-point samples for XPULPV2
+  extension.
+  @param[in]  args  pointer to plp_pfb_analysis_instance_f32_parallel struct initialized by
+                    plp_pfb_analysis_f32_parallel
+  @return     none
+
+  @par Every core computes the MACs of a contiguous range of branches for all frames, and owns the
+  delay lines of these branches. After a barrier, the transforms of the frames are distributed as
+  in plp_cfft_q16p_batched_xpulpv2: every core computes whole transforms with
+  plp_cfft_f32s_xpulpv2, and the last numFrames % nPE frames are computed by all cores together
+  with plp_cfft_f32p_xpulpv2.
+ */
+
+void plp_pfb_analysis_f32p_xpulpv2(void *args) {
+
+    plp_pfb_analysis_instance_f32_parallel *a = (plp_pfb_analysis_instance_f32_parallel *)args;
+
+    process_pfb_analysis_f32(a->S, a->pSrc, a->numFrames, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+  @} end of PolyphaseFilterBankKernels group
+ */
+
+static inline void process_pfb_analysis_f32(plp_pfb_analysis_instance_f32 *S,
+                                            const float32_t *pSrc,
+                                            uint32_t numFrames,
+                                            float32_t *pDst,
+                                            uint32_t coreId,
+                                            uint32_t nPE) {
+
+    uint32_t r, m, p, start, end;
+    uint32_t M = S->numChannels;
+    uint32_t T = S->tapsPerBranch;
+    uint32_t cur = S->stateIndex;
+
+    plp_team_chunk(M, nPE, coreId, 1, &start, &end);
+
+    for (r = 0; r < numFrames; r++) {
+        const float32_t *pIn = pSrc + 2 * M * r;
+        float32_t *pOut = pDst + 2 * M * r;
+
+        // the newest sample replaces the oldest one in the delay line of every branch
+        cur = (cur == 0) ? T - 1 : cur - 1;
+
+        for (m = start; m < end; m++) {
+            float32_t *pLine = S->pState + 2 * T * m;
+            const float32_t *pH = S->pCoeffs + T * m;
+            const float32_t *pX = pLine + 2 * cur;
+            float32_t accRe = 0.0f;
+            float32_t accIm = 0.0f;
+
+            // the commutator feeds the branches in reverse order
+            pLine[2 * cur] = pIn[2 * (M - 1 - m)];
+            pLine[2 * cur + 1] = pIn[2 * (M - 1 - m) + 1];
+
+            // tap t is the sample of t frames ago, in slot cur + t of the wrapped delay line
+            for (p = cur; p < T; p++) {
+                accRe += pH[0] * pX[0];
+                accIm += pH[0] * pX[1];
+                pH++;
+                pX += 2;
+            }
+            pX = pLine;
+            for (p = 0; p < cur; p++) {
+                accRe += pH[0] * pX[0];
+                accIm += pH[0] * pX[1];
+                pH++;
+                pX += 2;
+            }
+
+            // branch m goes to input (M - m) % M of the forward transform, which computes the
+            // transform with positive exponent
+            p = (m == 0) ? 0 : M - m;
+            pOut[2 * p] = accRe;
+            pOut[2 * p + 1] = accIm;
+        }
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    if (coreId == 0) {
+        S->stateIndex = cur;
+    }
+
+    uint32_t nWhole = numFrames - numFrames % nPE;
+    for (r = coreId; r < nWhole; r += nPE) {
+        plp_cfft_f32s_xpulpv2(S->S, pDst + 2 * M * r, 0);
+    }
+    for (r = nWhole; r < numFrames; r++) {
+        plp_cfft_instance_f32_parallel fftArgs = {
+            .S = S->S, .p1 = pDst + 2 * M * r, .ifftFlag = 0, .nPE = nPE
+        };
+        plp_cfft_f32p_xpulpv2(&fftArgs);
+    }
+}
@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pfb_analysis_q16s_rv32im.c
+ * Description:  Polyphase filter bank analysis of 16-bit fixed-point samples kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup PolyphaseFilterBank
+ */
+
+/**
+  @addtogroup PolyphaseFilterBankKernels
+  @{
+ */
+
+/**
+  @brief Polyphase filter bank analysis of 16-bit fixed-point samples for RV32IM extension.
+  @param[in,out] S          points to the instance, initialized by plp_pfb_analysis_init_q16
+  @param[in]     pSrc       points to numFrames*numChannels complex input samples in Q1.15
+  @param[in]     numFrames  number of frames
+  @param[out]    pDst       points to the output buffer of numFrames*numChannels complex samples
+  @return        none
+ */
+
+void plp_pfb_analysis_q16s_rv32im(plp_pfb_analysis_instance_q16 *S,
+                                  const int16_t *__restrict__ pSrc,
+                                  uint32_t numFrames,
+                                  int16_t *__restrict__ pDst) {
+
+    uint32_t r, m, t;
+    uint32_t M = S->numChannels;
+    uint32_t T = S->tapsPerBranch;
+    uint32_t cur = S->stateIndex;
+
+    for (r = 0; r < numFrames; r++) {
+        const int16_t *pIn = pSrc + 2 * M * r;
+        int16_t *pOut = pDst + 2 * M * r;
+
+        cur = (cur == 0) ? T - 1 : cur - 1;
+
+        for (m = 0; m < M; m++) {
+            int16_t *pLine = S->pState + 2 * T * m;
+            const int16_t *pH = S->pCoeffs + T * m;
+            int32_t accRe = 0;
+            int32_t accIm = 0;
+            uint32_t p = (m == 0) ? 0 : M - m;
+
+            pLine[2 * cur] = pIn[2 * (M - 1 - m)];
+            pLine[2 * cur + 1] = pIn[2 * (M - 1 - m) + 1];
+
+            for (t = 0; t < T; t++) {
+                uint32_t i = (cur + t < T) ? cur + t : cur + t - T;
+                accRe += pH[t] * pLine[2 * i];
+                accIm += pH[t] * pLine[2 * i + 1];
+            }
+
+            accRe = (accRe + (1 << 14)) >> 15;
+            accIm = (accIm + (1 << 14)) >> 15;
+            pOut[2 * p] = (int16_t)((accRe > 32767) ? 32767 : (accRe < -32768) ? -32768 : accRe);
+            pOut[2 * p + 1] =
+                (int16_t)((accIm > 32767) ? 32767 : (accIm < -32768) ? -32768 : accIm);
+        }
+
+        plp_cfft_q16s_rv32im(S->S, pOut, 0, 1, 15);
+    }
+
+    S->stateIndex = cur;
+}
+
+/**
+  @} end of PolyphaseFilterBankKernels group
+ */
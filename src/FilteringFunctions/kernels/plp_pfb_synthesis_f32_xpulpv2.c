@@ -0,0 +1,166 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pfb_synthesis_f32_xpulpv2.c
+ * Description:  Polyphase filter bank synthesis of 32-bit floating-point samples kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void process_pfb_synthesis_f32(plp_pfb_synthesis_instance_f32 *S,
+                                             const float32_t *pSrc,
+                                             uint32_t numFrames,
+                                             float32_t *pDst,
+                                             uint32_t coreId,
+                                             uint32_t nPE);
+
+/**
+  @ingroup PolyphaseFilterBank
+ */
+
+/**
+  @addtogroup PolyphaseFilterBankKernels
+  @{
+ */
+
+/**
+  @brief Polyphase filter bank synthesis of 32-bit floating-point samples for XPULPV2 extension.
+  @param[in,out] S          points to the instance, initialized by plp_pfb_synthesis_init_f32
+  @param[in]     pSrc       points to numFrames*numChannels complex channel samples
+  @param[in]     numFrames  number of frames
+  @param[out]    pDst       points to the output buffer of numFrames*numChannels complex samples
+  @return        none
+ */
+
+void plp_pfb_synthesis_f32s_xpulpv2(plp_pfb_synthesis_instance_f32 *S,
+                                    const float32_t *__restrict__ pSrc,
+                                    uint32_t numFrames,
+                                    float32_t *__restrict__ pDst) {
+
+    process_pfb_synthesis_f32(S, pSrc, numFrames, pDst, 0, 1);
+}
+
+/**
+  @brief Parallel polyphase filter bank synthesis of 32-bit floating-point samples for XPULPV2
+  extension.
+  @param[in]  args  pointer to plp_pfb_synthesis_instance_f32_parallel struct initialized by
+                    plp_pfb_synthesis_f32_parallel
+  @return     none
+
+  @par The inverse transforms of the frames are distributed as in plp_pfb_analysis_f32p_xpulpv2.
+  After a barrier, every core computes the MACs of a contiguous range of branches for all frames,
+  and owns the delay lines of these branches.
+ */
+
+void plp_pfb_synthesis_f32p_xpulpv2(void *args) {
+
+    plp_pfb_synthesis_instance_f32_parallel *a = (plp_pfb_synthesis_instance_f32_parallel *)args;
+
+    process_pfb_synthesis_f32(a->S, a->pSrc, a->numFrames, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+  @} end of PolyphaseFilterBankKernels group
+ */
+
+static inline void process_pfb_synthesis_f32(plp_pfb_synthesis_instance_f32 *S,
+                                             const float32_t *pSrc,
+                                             uint32_t numFrames,
+                                             float32_t *pDst,
+                                             uint32_t coreId,
+                                             uint32_t nPE) {
+
+    uint32_t r, m, p, start, end;
+    uint32_t M = S->numChannels;
+    uint32_t T = S->tapsPerBranch;
+    uint32_t cur = S->stateIndex;
+    uint32_t nWhole = numFrames - numFrames % nPE;
+
+    // the frames are transformed in place in the output buffer
+    for (r = coreId; r < nWhole; r += nPE) {
+        for (p = 0; p < 2 * M; p++) {
+            pDst[2 * M * r + p] = pSrc[2 * M * r + p];
+        }
+        plp_cfft_f32s_xpulpv2(S->S, pDst + 2 * M * r, 1);
+    }
+    plp_team_chunk(2 * M, nPE, coreId, 1, &start, &end);
+    for (r = nWhole; r < numFrames; r++) {
+        plp_cfft_instance_f32_parallel fftArgs = {
+            .S = S->S, .p1 = pDst + 2 * M * r, .ifftFlag = 1, .nPE = nPE
+        };
+        for (p = start; p < end; p++) {
+            pDst[2 * M * r + p] = pSrc[2 * M * r + p];
+        }
+        rt_team_barrier();
+        plp_cfft_f32p_xpulpv2(&fftArgs);
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    plp_team_chunk(M, nPE, coreId, 1, &start, &end);
+
+    for (r = 0; r < numFrames; r++) {
+        float32_t *pOut = pDst + 2 * M * r;
+
+        // the newest sample replaces the oldest one in the delay line of every branch
+        cur = (cur == 0) ? T - 1 : cur - 1;
+
+        for (m = start; m < end; m++) {
+            float32_t *pLine = S->pState + 2 * T * m;
+            const float32_t *pH = S->pCoeffs + T * m;
+            const float32_t *pX = pLine + 2 * cur;
+            float32_t accRe = 0.0f;
+            float32_t accIm = 0.0f;
+
+            // sample m of the inverse transform feeds branch m, which computes output sample m
+            // of the frame, such that the output overwrites the sample just read
+            pLine[2 * cur] = pOut[2 * m];
+            pLine[2 * cur + 1] = pOut[2 * m + 1];
+
+            // tap t is the sample of t frames ago, in slot cur + t of the wrapped delay line
+            for (p = cur; p < T; p++) {
+                accRe += pH[0] * pX[0];
+                accIm += pH[0] * pX[1];
+                pH++;
+                pX += 2;
+            }
+            pX = pLine;
+            for (p = 0; p < cur; p++) {
+                accRe += pH[0] * pX[0];
+                accIm += pH[0] * pX[1];
+                pH++;
+                pX += 2;
+            }
+
+            pOut[2 * m] = accRe;
+            pOut[2 * m + 1] = accIm;
+        }
+    }
+
+    if (coreId == 0) {
+        S->stateIndex = cur;
+    }
+}
@@ -0,0 +1,220 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_qmf_analysis_f32_xpulpv2.c
+ * Description:  QMF analysis of 32-bit floating-point samples kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void process_qmf_analysis_f32(const plp_qmf_instance_f32 *S,
+                                            const float32_t *pSrc,
+                                            float32_t *pLow,
+                                            float32_t *pHigh,
+                                            uint32_t coreId,
+                                            uint32_t nPE);
+
+static inline void process_qmf_tree_analysis_f32(const plp_qmf_tree_instance_f32 *S,
+                                                 const float32_t *pSrc,
+                                                 float32_t *pDst,
+                                                 uint32_t coreId,
+                                                 uint32_t nPE);
+
+/**
+  @ingroup QMF
+ */
+
+/**
+  @defgroup QMFKernels Quadrature Mirror Filter Bank Kernels
+  @{
+ */
+
+/**
+  @brief QMF analysis of 32-bit floating-point samples for XPULPV2 extension.
+  @param[in,out] S      points to the instance, initialized by plp_qmf_init_f32
+  @param[in]     pSrc   points to the blockSize input samples
+  @param[out]    pLow   points to the blockSize/2 samples of the lower band
+  @param[out]    pHigh  points to the blockSize/2 samples of the upper band
+  @return        none
+ */
+
+void plp_qmf_analysis_f32s_xpulpv2(const plp_qmf_instance_f32 *S,
+                                   const float32_t *__restrict__ pSrc,
+                                   float32_t *__restrict__ pLow,
+                                   float32_t *__restrict__ pHigh) {
+
+    process_qmf_analysis_f32(S, pSrc, pLow, pHigh, 0, 1);
+}
+
+/**
+  @brief Parallel QMF analysis of 32-bit floating-point samples for XPULPV2 extension.
+  @param[in]  args  pointer to plp_qmf_analysis_instance_f32_parallel struct initialized by
+                    plp_qmf_analysis_f32_parallel
+  @return     none
+
+  @par Every core splits a contiguous chunk of the input pairs into the two delay lines, and
+  computes the same chunk of both bands. The cores synchronize before the computation and before
+  core 0 moves the delay lines.
+ */
+
+void plp_qmf_analysis_f32p_xpulpv2(void *args) {
+
+    plp_qmf_analysis_instance_f32_parallel *a = (plp_qmf_analysis_instance_f32_parallel *)args;
+
+    process_qmf_analysis_f32(a->S, a->pSrc, a->pLow, a->pHigh, rt_core_id(), a->nPE);
+}
+
+/**
+  @brief QMF tree analysis of 32-bit floating-point samples for XPULPV2 extension.
+  @param[in,out] S     points to the instance, initialized by plp_qmf_tree_init_f32
+  @param[in]     pSrc  points to the blockSize input samples
+  @param[out]    pDst  points to the blockSize samples of all bands, see plp_qmf_tree_analysis_f32
+  @return        none
+ */
+
+void plp_qmf_tree_analysis_f32s_xpulpv2(const plp_qmf_tree_instance_f32 *S,
+                                        const float32_t *__restrict__ pSrc,
+                                        float32_t *__restrict__ pDst) {
+
+    process_qmf_tree_analysis_f32(S, pSrc, pDst, 0, 1);
+}
+
+/**
+  @brief Parallel QMF tree analysis of 32-bit floating-point samples for XPULPV2 extension.
+  @param[in]  args  pointer to plp_qmf_tree_instance_f32_parallel struct initialized by
+                    plp_qmf_tree_analysis_f32_parallel
+  @return     none
+
+  @par All levels are computed in the same fork, one after the other, each distributed as in
+  plp_qmf_analysis_f32p_xpulpv2. The barrier at the end of a level makes its lower band visible to
+  all cores for the next level.
+ */
+
+void plp_qmf_tree_analysis_f32p_xpulpv2(void *args) {
+
+    plp_qmf_tree_instance_f32_parallel *a = (plp_qmf_tree_instance_f32_parallel *)args;
+
+    process_qmf_tree_analysis_f32(a->S, a->pSrc, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+  @} end of QMFKernels group
+ */
+
+static inline void process_qmf_analysis_f32(const plp_qmf_instance_f32 *S,
+                                            const float32_t *pSrc,
+                                            float32_t *pLow,
+                                            float32_t *pHigh,
+                                            uint32_t coreId,
+                                            uint32_t nPE) {
+
+    uint32_t r, k, start, end;
+    uint32_t T = S->numTaps >> 1;
+    uint32_t H = T - 1;
+    uint32_t nOut = S->blockSize >> 1;
+    const float32_t *pC0 = S->pCoeffs;
+    const float32_t *pC1 = S->pCoeffs + T;
+    float32_t *pLine0 = S->pState;
+    float32_t *pLine1 = S->pState + H + nOut;
+
+    plp_team_chunk(nOut, nPE, coreId, 1, &start, &end);
+
+    // the odd samples feed branch 0, and the even samples branch 1
+    for (r = start; r < end; r++) {
+        pLine1[H + r] = pSrc[2 * r];
+        pLine0[H + r] = pSrc[2 * r + 1];
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    // two outputs at a time, sharing the coefficient loads
+    for (r = start; r + 1 < end; r += 2) {
+        const float32_t *px0 = &pLine0[r];
+        const float32_t *px1 = &pLine1[r];
+        float32_t e00 = 0.0f;
+        float32_t e01 = 0.0f;
+        float32_t e10 = 0.0f;
+        float32_t e11 = 0.0f;
+        for (k = 0; k < T; k++) {
+            float32_t c0 = pC0[k];
+            float32_t c1 = pC1[k];
+            e00 += c0 * px0[k];
+            e01 += c0 * px0[k + 1];
+            e10 += c1 * px1[k];
+            e11 += c1 * px1[k + 1];
+        }
+        // the mirrored filter only flips the sign of branch 1
+        pLow[r] = e00 + e10;
+        pHigh[r] = e00 - e10;
+        pLow[r + 1] = e01 + e11;
+        pHigh[r + 1] = e01 - e11;
+    }
+
+    if (r < end) {
+        const float32_t *px0 = &pLine0[r];
+        const float32_t *px1 = &pLine1[r];
+        float32_t e0 = 0.0f;
+        float32_t e1 = 0.0f;
+        for (k = 0; k < T; k++) {
+            e0 += pC0[k] * px0[k];
+            e1 += pC1[k] * px1[k];
+        }
+        pLow[r] = e0 + e1;
+        pHigh[r] = e0 - e1;
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    // the last T-1 samples of both delay lines are the history of the next block
+    if (coreId == 0) {
+        for (k = 0; k < H; k++) {
+            pLine0[k] = pLine0[k + nOut];
+            pLine1[k] = pLine1[k + nOut];
+        }
+    }
+}
+
+static inline void process_qmf_tree_analysis_f32(const plp_qmf_tree_instance_f32 *S,
+                                                 const float32_t *pSrc,
+                                                 float32_t *pDst,
+                                                 uint32_t coreId,
+                                                 uint32_t nPE) {
+
+    uint32_t l;
+    uint32_t L = S->numLevels;
+    uint32_t N = S->blockSize;
+    const float32_t *pIn = pSrc;
+
+    // the lower bands of the inner levels alternate between both halves of the scratch buffer,
+    // the upper band of level l and the last lower band are stored in their place in pDst
+    for (l = 0; l < L; l++) {
+        float32_t *pLow = (l == L - 1) ? pDst : S->pScratch + ((l & 1) ? (N >> 1) : 0);
+        process_qmf_analysis_f32(&S->pStages[l], pIn, pLow, pDst + (N >> (l + 1)), coreId, nPE);
+        pIn = pLow;
+    }
+}
@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_qmf_analysis_q16s_rv32im.c
+ * Description:  QMF analysis of 16-bit fixed-point samples kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup QMF
+ */
+
+/**
+  @addtogroup QMFKernels
+  @{
+ */
+
+/**
+  @brief QMF analysis of 16-bit fixed-point samples for RV32IM extension.
+  @param[in,out] S      points to the instance, initialized by plp_qmf_init_q16
+  @param[in]     pSrc   points to the blockSize input samples in Q1.15
+  @param[out]    pLow   points to the blockSize/2 samples of the lower band
+  @param[out]    pHigh  points to the blockSize/2 samples of the upper band
+  @return        none
+ */
+
+void plp_qmf_analysis_q16s_rv32im(const plp_qmf_instance_q16 *S,
+                                  const int16_t *__restrict__ pSrc,
+                                  int16_t *__restrict__ pLow,
+                                  int16_t *__restrict__ pHigh) {
+
+    uint32_t r, k;
+    uint32_t T = S->numTaps >> 1;
+    uint32_t H = T - 1;
+    uint32_t nOut = S->blockSize >> 1;
+    const int16_t *pC0 = S->pCoeffs;
+    const int16_t *pC1 = S->pCoeffs + T;
+    int16_t *pLine0 = S->pState;
+    int16_t *pLine1 = S->pState + H + nOut;
+
+    for (r = 0; r < nOut; r++) {
+        pLine1[H + r] = pSrc[2 * r];
+        pLine0[H + r] = pSrc[2 * r + 1];
+    }
+
+    for (r = 0; r < nOut; r++) {
+        int32_t e0 = 0;
+        int32_t e1 = 0;
+        int32_t low, high;
+        for (k = 0; k < T; k++) {
+            e0 += pC0[k] * pLine0[r + k];
+            e1 += pC1[k] * pLine1[r + k];
+        }
+        low = (e0 + e1 + (1 << 14)) >> 15;
+        high = (e0 - e1 + (1 << 14)) >> 15;
+        pLow[r] = (int16_t)((low > 32767) ? 32767 : (low < -32768) ? -32768 : low);
+        pHigh[r] = (int16_t)((high > 32767) ? 32767 : (high < -32768) ? -32768 : high);
+    }
+
+    for (k = 0; k < H; k++) {
+        pLine0[k] = pLine0[k + nOut];
+        pLine1[k] = pLine1[k + nOut];
+    }
+}
+
+/**
+  @brief QMF tree analysis of 16-bit fixed-point samples for RV32IM extension.
+  @param[in,out] S     points to the instance, initialized by plp_qmf_tree_init_q16
+  @param[in]     pSrc  points to the blockSize input samples in Q1.15
+  @param[out]    pDst  points to the blockSize samples of all bands, see plp_qmf_tree_analysis_q16
+  @return        none
+ */
+
+void plp_qmf_tree_analysis_q16s_rv32im(const plp_qmf_tree_instance_q16 *S,
+                                       const int16_t *__restrict__ pSrc,
+                                       int16_t *__restrict__ pDst) {
+
+    uint32_t l;
+    uint32_t L = S->numLevels;
+    uint32_t N = S->blockSize;
+    const int16_t *pIn = pSrc;
+
+    for (l = 0; l < L; l++) {
+        int16_t *pLow = (l == L - 1) ? pDst : S->pScratch + ((l & 1) ? (N >> 1) : 0);
+        plp_qmf_analysis_q16s_rv32im(&S->pStages[l], pIn, pLow, pDst + (N >> (l + 1)));
+        pIn = pLow;
+    }
+}
+
+/**
+  @} end of QMFKernels group
+ */
@@ -0,0 +1,246 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_qmf_synthesis_f32_xpulpv2.c
+ * Description:  QMF synthesis of 32-bit floating-point samples kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void process_qmf_synthesis_f32(const plp_qmf_instance_f32 *S,
+                                             const float32_t *pLow,
+                                             const float32_t *pHigh,
+                                             float32_t *pDst,
+                                             uint32_t coreId,
+                                             uint32_t nPE);
+
+static inline void process_qmf_tree_synthesis_f32(const plp_qmf_tree_instance_f32 *S,
+                                                  const float32_t *pSrc,
+                                                  float32_t *pDst,
+                                                  uint32_t coreId,
+                                                  uint32_t nPE);
+
+/**
+  @ingroup QMF
+ */
+
+/**
+  @addtogroup QMFKernels
+  @{
+ */
+
+/**
+  @brief QMF synthesis of 32-bit floating-point samples for XPULPV2 extension.
+  @param[in,out] S      points to the instance, initialized by plp_qmf_init_f32
+  @param[in]     pLow   points to the blockSize/2 samples of the lower band
+  @param[in]     pHigh  points to the blockSize/2 samples of the upper band
+  @param[out]    pDst   points to the blockSize output samples
+  @return        none
+ */
+
+void plp_qmf_synthesis_f32s_xpulpv2(const plp_qmf_instance_f32 *S,
+                                    const float32_t *__restrict__ pLow,
+                                    const float32_t *__restrict__ pHigh,
+                                    float32_t *__restrict__ pDst) {
+
+    process_qmf_synthesis_f32(S, pLow, pHigh, pDst, 0, 1);
+}
+
+/**
+  @brief Parallel QMF synthesis of 32-bit floating-point samples for XPULPV2 extension.
+  @param[in]  args  pointer to plp_qmf_synthesis_instance_f32_parallel struct initialized by
+                    plp_qmf_synthesis_f32_parallel
+  @return     none
+
+  @par Every core computes the sum and the difference of a contiguous chunk of both bands, and the
+  output pairs of the same chunk. The cores synchronize before the computation and before core 0
+  moves the delay lines.
+ */
+
+void plp_qmf_synthesis_f32p_xpulpv2(void *args) {
+
+    plp_qmf_synthesis_instance_f32_parallel *a = (plp_qmf_synthesis_instance_f32_parallel *)args;
+
+    process_qmf_synthesis_f32(a->S, a->pLow, a->pHigh, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+  @brief QMF tree synthesis of 32-bit floating-point samples for XPULPV2 extension.
+  @param[in,out] S     points to the instance, initialized by plp_qmf_tree_init_f32
+  @param[in]     pSrc  points to the blockSize samples of all bands, see plp_qmf_tree_analysis_f32
+  @param[out]    pDst  points to the blockSize output samples
+  @return        none
+ */
+
+void plp_qmf_tree_synthesis_f32s_xpulpv2(const plp_qmf_tree_instance_f32 *S,
+                                         const float32_t *__restrict__ pSrc,
+                                         float32_t *__restrict__ pDst) {
+
+    process_qmf_tree_synthesis_f32(S, pSrc, pDst, 0, 1);
+}
+
+/**
+  @brief Parallel QMF tree synthesis of 32-bit floating-point samples for XPULPV2 extension.
+  @param[in]  args  pointer to plp_qmf_tree_instance_f32_parallel struct initialized by
+                    plp_qmf_tree_synthesis_f32_parallel
+  @return     none
+
+  @par All levels are computed in the same fork, from the deepest one to the first one, each
+  distributed as in plp_qmf_synthesis_f32p_xpulpv2.
+ */
+
+void plp_qmf_tree_synthesis_f32p_xpulpv2(void *args) {
+
+    plp_qmf_tree_instance_f32_parallel *a = (plp_qmf_tree_instance_f32_parallel *)args;
+
+    process_qmf_tree_synthesis_f32(a->S, a->pSrc, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+  @} end of QMFKernels group
+ */
+
+static inline void process_qmf_synthesis_f32(const plp_qmf_instance_f32 *S,
+                                             const float32_t *pLow,
+                                             const float32_t *pHigh,
+                                             float32_t *pDst,
+                                             uint32_t coreId,
+                                             uint32_t nPE) {
+
+    uint32_t r, k, start, end;
+    uint32_t T = S->numTaps >> 1;
+    uint32_t H = T - 1;
+    uint32_t nIn = S->blockSize >> 1;
+    const float32_t *pC0 = S->pCoeffs;
+    const float32_t *pC1 = S->pCoeffs + T;
+    float32_t *pLine0 = S->pState;
+    float32_t *pLine1 = S->pState + H + nIn;
+
+    plp_team_chunk(nIn, nPE, coreId, 1, &start, &end);
+
+    // the difference of the bands feeds branch 0, and their sum branch 1
+    for (r = start; r < end; r++) {
+        pLine0[H + r] = pLow[r] - pHigh[r];
+        pLine1[H + r] = pLow[r] + pHigh[r];
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    // two output pairs at a time, sharing the coefficient loads
+    for (r = start; r + 1 < end; r += 2) {
+        const float32_t *px0 = &pLine0[r];
+        const float32_t *px1 = &pLine1[r];
+        float32_t y00 = 0.0f;
+        float32_t y01 = 0.0f;
+        float32_t y10 = 0.0f;
+        float32_t y11 = 0.0f;
+        for (k = 0; k < T; k++) {
+            float32_t c0 = pC0[k];
+            float32_t c1 = pC1[k];
+            y00 += c0 * px0[k];
+            y01 += c0 * px0[k + 1];
+            y10 += c1 * px1[k];
+            y11 += c1 * px1[k + 1];
+        }
+        // the synthesis has a gain of 2
+        pDst[2 * r] = 2.0f * y00;
+        pDst[2 * r + 1] = 2.0f * y10;
+        pDst[2 * r + 2] = 2.0f * y01;
+        pDst[2 * r + 3] = 2.0f * y11;
+    }
+
+    if (r < end) {
+        const float32_t *px0 = &pLine0[r];
+        const float32_t *px1 = &pLine1[r];
+        float32_t y0 = 0.0f;
+        float32_t y1 = 0.0f;
+        for (k = 0; k < T; k++) {
+            y0 += pC0[k] * px0[k];
+            y1 += pC1[k] * px1[k];
+        }
+        pDst[2 * r] = 2.0f * y0;
+        pDst[2 * r + 1] = 2.0f * y1;
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    // the last T-1 samples of both delay lines are the history of the next block
+    if (coreId == 0) {
+        for (k = 0; k < H; k++) {
+            pLine0[k] = pLine0[k + nIn];
+            pLine1[k] = pLine1[k + nIn];
+        }
+    }
+}
+
+static inline void process_qmf_tree_synthesis_f32(const plp_qmf_tree_instance_f32 *S,
+                                                  const float32_t *pSrc,
+                                                  float32_t *pDst,
+                                                  uint32_t coreId,
+                                                  uint32_t nPE) {
+
+    uint32_t l, r, start, end;
+    uint32_t L = S->numLevels;
+    uint32_t N = S->blockSize;
+    uint32_t G = S->pStages[0].numTaps - 2; // delay of one level
+    const float32_t *pLow = pSrc;
+    float32_t *pDelay = S->pDelay;
+
+    // the outputs of the inner levels alternate between both halves of the scratch buffer, the
+    // first level writes the output
+    for (l = L; l-- > 0;) {
+        float32_t *pOut = (l == 0) ? pDst : S->pScratch + ((l & 1) ? 0 : (N >> 1));
+        const float32_t *pHigh = pSrc + (N >> (l + 1));
+        uint32_t n = N >> (l + 1);
+        uint32_t D = G * ((1 << (L - 1 - l)) - 1);
+
+        if (D == 0) {
+            process_qmf_synthesis_f32(&S->pStages[l], pLow, pHigh, pOut, coreId, nPE);
+        } else {
+            // the upper band is delayed by the levels below, which the lower band went through
+            plp_team_chunk(n, nPE, coreId, 1, &start, &end);
+            for (r = start; r < end; r++) {
+                pDelay[D + r] = pHigh[r];
+            }
+
+            if (nPE > 1) {
+                rt_team_barrier();
+            }
+
+            process_qmf_synthesis_f32(&S->pStages[l], pLow, pDelay, pOut, coreId, nPE);
+
+            if (coreId == 0) {
+                for (r = 0; r < D; r++) {
+                    pDelay[r] = pDelay[r + n];
+                }
+            }
+            pDelay += D + n;
+        }
+        pLow = pOut;
+    }
+}
@@ -0,0 +1,260 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_qmf_synthesis_q16_xpulpv2.c
+ * Description:  QMF synthesis of 16-bit fixed-point samples kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void process_qmf_synthesis_q16(const plp_qmf_instance_q16 *S,
+                                             const int16_t *pLow,
+                                             const int16_t *pHigh,
+                                             int16_t *pDst,
+                                             uint32_t coreId,
+                                             uint32_t nPE);
+
+static inline void process_qmf_tree_synthesis_q16(const plp_qmf_tree_instance_q16 *S,
+                                                  const int16_t *pSrc,
+                                                  int16_t *pDst,
+                                                  uint32_t coreId,
+                                                  uint32_t nPE);
+
+/**
+  @ingroup QMF
+ */
+
+/**
+  @addtogroup QMFKernels
+  @{
+ */
+
+/**
+  @brief QMF synthesis of 16-bit fixed-point samples for XPULPV2 extension.
+  @param[in,out] S      points to the instance, initialized by plp_qmf_init_q16
+  @param[in]     pLow   points to the blockSize/2 samples of the lower band
+  @param[in]     pHigh  points to the blockSize/2 samples of the upper band
+  @param[out]    pDst   points to the blockSize output samples
+  @return        none
+ */
+
+void plp_qmf_synthesis_q16s_xpulpv2(const plp_qmf_instance_q16 *S,
+                                    const int16_t *__restrict__ pLow,
+                                    const int16_t *__restrict__ pHigh,
+                                    int16_t *__restrict__ pDst) {
+
+    process_qmf_synthesis_q16(S, pLow, pHigh, pDst, 0, 1);
+}
+
+/**
+  @brief Parallel QMF synthesis of 16-bit fixed-point samples for XPULPV2 extension.
+  @param[in]  args  pointer to plp_qmf_synthesis_instance_q16_parallel struct initialized by
+                    plp_qmf_synthesis_q16_parallel
+  @return     none
+
+  @par Every core computes the sum and the difference of a contiguous chunk of both bands, and the
+  output pairs of the same chunk. The cores synchronize before the computation and before core 0
+  moves the delay lines.
+ */
+
+void plp_qmf_synthesis_q16p_xpulpv2(void *args) {
+
+    plp_qmf_synthesis_instance_q16_parallel *a = (plp_qmf_synthesis_instance_q16_parallel *)args;
+
+    process_qmf_synthesis_q16(a->S, a->pLow, a->pHigh, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+  @brief QMF tree synthesis of 16-bit fixed-point samples for XPULPV2 extension.
+  @param[in,out] S     points to the instance, initialized by plp_qmf_tree_init_q16
+  @param[in]     pSrc  points to the blockSize samples of all bands, see plp_qmf_tree_analysis_q16
+  @param[out]    pDst  points to the blockSize output samples
+  @return        none
+ */
+
+void plp_qmf_tree_synthesis_q16s_xpulpv2(const plp_qmf_tree_instance_q16 *S,
+                                         const int16_t *__restrict__ pSrc,
+                                         int16_t *__restrict__ pDst) {
+
+    process_qmf_tree_synthesis_q16(S, pSrc, pDst, 0, 1);
+}
+
+/**
+  @brief Parallel QMF tree synthesis of 16-bit fixed-point samples for XPULPV2 extension.
+  @param[in]  args  pointer to plp_qmf_tree_instance_q16_parallel struct initialized by
+                    plp_qmf_tree_synthesis_q16_parallel
+  @return     none
+
+  @par All levels are computed in the same fork, from the deepest one to the first one, each
+  distributed as in plp_qmf_synthesis_q16p_xpulpv2.
+ */
+
+void plp_qmf_tree_synthesis_q16p_xpulpv2(void *args) {
+
+    plp_qmf_tree_instance_q16_parallel *a = (plp_qmf_tree_instance_q16_parallel *)args;
+
+    process_qmf_tree_synthesis_q16(a->S, a->pSrc, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+  @} end of QMFKernels group
+ */
+
+static inline void process_qmf_synthesis_q16(const plp_qmf_instance_q16 *S,
+                                             const int16_t *pLow,
+                                             const int16_t *pHigh,
+                                             int16_t *pDst,
+                                             uint32_t coreId,
+                                             uint32_t nPE) {
+
+    uint32_t r, k, start, end;
+    uint32_t T = S->numTaps >> 1;
+    uint32_t H = T - 1;
+    uint32_t nIn = S->blockSize >> 1;
+    const int16_t *pC0 = S->pCoeffs;
+    const int16_t *pC1 = S->pCoeffs + T;
+    int16_t *pLine0 = S->pState;
+    int16_t *pLine1 = S->pState + H + nIn;
+    uint32_t nVec = T >> 1; // number of coefficient vectors
+    uint32_t nRem = nVec << 1; // first coefficient which is not part of a vector
+
+    plp_team_chunk(nIn, nPE, coreId, 1, &start, &end);
+
+    // the difference of the bands feeds branch 0, and their sum branch 1
+    for (r = start; r < end; r++) {
+        int32_t a = pLow[r];
+        int32_t b = pHigh[r];
+        pLine0[H + r] = (int16_t)__CLIP(a - b, 15);
+        pLine1[H + r] = (int16_t)__CLIP(a + b, 15);
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    // two output pairs at a time, sharing the coefficient loads
+    for (r = start; r + 1 < end; r += 2) {
+        const int16_t *px0 = &pLine0[r];
+        const int16_t *px1 = &pLine1[r];
+        int32_t y00 = 0;
+        int32_t y01 = 0;
+        int32_t y10 = 0;
+        int32_t y11 = 0;
+        for (k = 0; k < nVec; k++) {
+            v2s c0 = *((v2s *)&pC0[2 * k]);
+            v2s c1 = *((v2s *)&pC1[2 * k]);
+            y00 = __SUMDOTP2(*((v2s *)&px0[2 * k]), c0, y00);
+            y01 = __SUMDOTP2(*((v2s *)&px0[2 * k + 1]), c0, y01);
+            y10 = __SUMDOTP2(*((v2s *)&px1[2 * k]), c1, y10);
+            y11 = __SUMDOTP2(*((v2s *)&px1[2 * k + 1]), c1, y11);
+        }
+        for (k = nRem; k < T; k++) {
+            y00 += pC0[k] * px0[k];
+            y01 += pC0[k] * px0[k + 1];
+            y10 += pC1[k] * px1[k];
+            y11 += pC1[k] * px1[k + 1];
+        }
+        // the gain of 2 of the synthesis is folded into the normalization
+        *((v2s *)&pDst[2 * r]) =
+            __PACK2(__CLIP(__ROUNDNORM_REG(y00, 14), 15), __CLIP(__ROUNDNORM_REG(y10, 14), 15));
+        *((v2s *)&pDst[2 * r + 2]) =
+            __PACK2(__CLIP(__ROUNDNORM_REG(y01, 14), 15), __CLIP(__ROUNDNORM_REG(y11, 14), 15));
+    }
+
+    if (r < end) {
+        const int16_t *px0 = &pLine0[r];
+        const int16_t *px1 = &pLine1[r];
+        int32_t y0 = 0;
+        int32_t y1 = 0;
+        for (k = 0; k < nVec; k++) {
+            y0 = __SUMDOTP2(*((v2s *)&px0[2 * k]), *((v2s *)&pC0[2 * k]), y0);
+            y1 = __SUMDOTP2(*((v2s *)&px1[2 * k]), *((v2s *)&pC1[2 * k]), y1);
+        }
+        for (k = nRem; k < T; k++) {
+            y0 += pC0[k] * px0[k];
+            y1 += pC1[k] * px1[k];
+        }
+        *((v2s *)&pDst[2 * r]) =
+            __PACK2(__CLIP(__ROUNDNORM_REG(y0, 14), 15), __CLIP(__ROUNDNORM_REG(y1, 14), 15));
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    // the last T-1 samples of both delay lines are the history of the next block
+    if (coreId == 0) {
+        for (k = 0; k < H; k++) {
+            pLine0[k] = pLine0[k + nIn];
+            pLine1[k] = pLine1[k + nIn];
+        }
+    }
+}
+
+static inline void process_qmf_tree_synthesis_q16(const plp_qmf_tree_instance_q16 *S,
+                                                  const int16_t *pSrc,
+                                                  int16_t *pDst,
+                                                  uint32_t coreId,
+                                                  uint32_t nPE) {
+
+    uint32_t l, r, start, end;
+    uint32_t L = S->numLevels;
+    uint32_t N = S->blockSize;
+    uint32_t G = S->pStages[0].numTaps - 2; // delay of one level
+    const int16_t *pLow = pSrc;
+    int16_t *pDelay = S->pDelay;
+
+    // the outputs of the inner levels alternate between both halves of the scratch buffer, the
+    // first level writes the output
+    for (l = L; l-- > 0;) {
+        int16_t *pOut = (l == 0) ? pDst : S->pScratch + ((l & 1) ? 0 : (N >> 1));
+        const int16_t *pHigh = pSrc + (N >> (l + 1));
+        uint32_t n = N >> (l + 1);
+        uint32_t D = G * ((1 << (L - 1 - l)) - 1);
+
+        if (D == 0) {
+            process_qmf_synthesis_q16(&S->pStages[l], pLow, pHigh, pOut, coreId, nPE);
+        } else {
+            // the upper band is delayed by the levels below, which the lower band went through
+            plp_team_chunk(n, nPE, coreId, 1, &start, &end);
+            for (r = start; r < end; r++) {
+                pDelay[D + r] = pHigh[r];
+            }
+
+            if (nPE > 1) {
+                rt_team_barrier();
+            }
+
+            process_qmf_synthesis_q16(&S->pStages[l], pLow, pDelay, pOut, coreId, nPE);
+
+            if (coreId == 0) {
+                for (r = 0; r < D; r++) {
+                    pDelay[r] = pDelay[r + n];
+                }
+            }
+            pDelay += D + n;
+        }
+        pLow = pOut;
+    }
+}
@@ -0,0 +1,132 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_qmf_synthesis_q16s_rv32im.c
+ * Description:  QMF synthesis of 16-bit fixed-point samples kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup QMF
+ */
+
+/**
+  @addtogroup QMFKernels
+  @{
+ */
+
+/**
+  @brief QMF synthesis of 16-bit fixed-point samples for RV32IM extension.
+  @param[in,out] S      points to the instance, initialized by plp_qmf_init_q16
+  @param[in]     pLow   points to the blockSize/2 samples of the lower band
+  @param[in]     pHigh  points to the blockSize/2 samples of the upper band
+  @param[out]    pDst   points to the blockSize output samples
+  @return        none
+ */
+
+void plp_qmf_synthesis_q16s_rv32im(const plp_qmf_instance_q16 *S,
+                                   const int16_t *__restrict__ pLow,
+                                   const int16_t *__restrict__ pHigh,
+                                   int16_t *__restrict__ pDst) {
+
+    uint32_t r, k;
+    uint32_t T = S->numTaps >> 1;
+    uint32_t H = T - 1;
+    uint32_t nIn = S->blockSize >> 1;
+    const int16_t *pC0 = S->pCoeffs;
+    const int16_t *pC1 = S->pCoeffs + T;
+    int16_t *pLine0 = S->pState;
+    int16_t *pLine1 = S->pState + H + nIn;
+
+    for (r = 0; r < nIn; r++) {
+        int32_t d = pLow[r] - pHigh[r];
+        int32_t s = pLow[r] + pHigh[r];
+        pLine0[H + r] = (int16_t)((d > 32767) ? 32767 : (d < -32768) ? -32768 : d);
+        pLine1[H + r] = (int16_t)((s > 32767) ? 32767 : (s < -32768) ? -32768 : s);
+    }
+
+    for (r = 0; r < nIn; r++) {
+        int32_t y0 = 0;
+        int32_t y1 = 0;
+        for (k = 0; k < T; k++) {
+            y0 += pC0[k] * pLine0[r + k];
+            y1 += pC1[k] * pLine1[r + k];
+        }
+        y0 = (y0 + (1 << 13)) >> 14;
+        y1 = (y1 + (1 << 13)) >> 14;
+        pDst[2 * r] = (int16_t)((y0 > 32767) ? 32767 : (y0 < -32768) ? -32768 : y0);
+        pDst[2 * r + 1] = (int16_t)((y1 > 32767) ? 32767 : (y1 < -32768) ? -32768 : y1);
+    }
+
+    for (k = 0; k < H; k++) {
+        pLine0[k] = pLine0[k + nIn];
+        pLine1[k] = pLine1[k + nIn];
+    }
+}
+
+/**
+  @brief QMF tree synthesis of 16-bit fixed-point samples for RV32IM extension.
+  @param[in,out] S     points to the instance, initialized by plp_qmf_tree_init_q16
+  @param[in]     pSrc  points to the blockSize samples of all bands, see plp_qmf_tree_analysis_q16
+  @param[out]    pDst  points to the blockSize output samples
+  @return        none
+ */
+
+void plp_qmf_tree_synthesis_q16s_rv32im(const plp_qmf_tree_instance_q16 *S,
+                                        const int16_t *__restrict__ pSrc,
+                                        int16_t *__restrict__ pDst) {
+
+    uint32_t l, r;
+    uint32_t L = S->numLevels;
+    uint32_t N = S->blockSize;
+    uint32_t G = S->pStages[0].numTaps - 2;
+    const int16_t *pLow = pSrc;
+    int16_t *pDelay = S->pDelay;
+
+    for (l = L; l-- > 0;) {
+        int16_t *pOut = (l == 0) ? pDst : S->pScratch + ((l & 1) ? 0 : (N >> 1));
+        const int16_t *pHigh = pSrc + (N >> (l + 1));
+        uint32_t n = N >> (l + 1);
+        uint32_t D = G * ((1 << (L - 1 - l)) - 1);
+
+        if (D == 0) {
+            plp_qmf_synthesis_q16s_rv32im(&S->pStages[l], pLow, pHigh, pOut);
+        } else {
+            for (r = 0; r < n; r++) {
+                pDelay[D + r] = pHigh[r];
+            }
+            plp_qmf_synthesis_q16s_rv32im(&S->pStages[l], pLow, pDelay, pOut);
+            for (r = 0; r < D; r++) {
+                pDelay[r] = pDelay[r + n];
+            }
+            pDelay += D + n;
+        }
+        pLow = pOut;
+    }
+}
+
+/**
+  @} end of QMFKernels group
+ */
@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_f32s_xpulpv2.c
+ * Description:  Polyphase resampling of a 32-bit floating-point block for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Resample
+ */
+
+/**
+  @addtogroup ResampleKernels
+  @{
+ */
+
+/**
+  @brief Polyphase resampling of a 32-bit floating-point block kernel for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_resample_init_f32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, at most the block size of the instance
+  @param[out] pDst       points to the output samples, at most
+                         PLP_RESAMPLE_DST_LEN(blockSize, L, M)
+  @return     number of output samples written to pDst
+
+  @par The new samples are appended to the state buffer after the numTaps/L-1 previous samples.
+  Every output is the dot product of the polyphase branch j with the numTaps/L samples ending at
+  input sample n, computed by plp_dot_prod_f32s_xpulpv2. Finally, the last numTaps/L-1 samples are
+  moved to the beginning of the state buffer. The input sample n and the branch j of the next output
+  are advanced by M/L and M%L without divisions.
+ */
+
+uint32_t plp_resample_f32s_xpulpv2(plp_resample_instance_f32 *S,
+                                  const float32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  float32_t *__restrict__ pDst) {
+
+    uint32_t i;
+    uint32_t L = S->L;
+    uint32_t P = S->phaseLength;
+    uint32_t H = P - 1;
+    uint32_t stepN = S->M / L;
+    uint32_t stepJ = S->M % L;
+    uint32_t n = S->phase / L; // input sample of the next output
+    uint32_t j = S->phase % L; // polyphase branch of the next output
+    uint32_t numOut = 0;
+    float32_t *pState = S->pState;
+
+    for (i = 0; i < blockSize; i++) {
+        pState[H + i] = pSrc[i];
+    }
+
+    while (n < blockSize) {
+        float32_t acc = 0.0f;
+        plp_dot_prod_f32s_xpulpv2(&S->pCoeffs[j * P], &pState[n], P, &acc);
+        pDst[numOut++] = acc;
+        n += stepN;
+        j += stepJ;
+        if (j >= L) {
+            j -= L;
+            n++;
+        }
+    }
+
+    // position of the next output relative to the next block
+    S->phase = (n - blockSize) * L + j;
+
+    for (i = 0; i < H; i++) {
+        pState[i] = pState[i + blockSize];
+    }
+
+    return numOut;
+}
+
+/**
+  @} end of ResampleKernels group
+ */
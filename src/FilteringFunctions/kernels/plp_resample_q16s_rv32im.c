@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_q16s_rv32im.c
+ * Description:  Polyphase resampling of a 16-bit fixed-point block for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// sum * 2^-shift, rounded and saturated to 16 bits
+static inline int16_t saturate_q16(int32_t sum, uint32_t shift) {
+    int32_t val = (sum + ((1 << shift) >> 1)) >> shift;
+    if (val > (1 << 15) - 1) {
+        val = (1 << 15) - 1;
+    } else if (val < -(1 << 15)) {
+        val = -(1 << 15);
+    }
+    return (int16_t)val;
+}
+
+/**
+  @ingroup Resample
+ */
+
+/**
+  @defgroup ResampleKernels Polyphase Resampler Kernels
+  @{
+ */
+
+/**
+  @brief Polyphase resampling of a 16-bit fixed-point block kernel for RV32IM extension.
+  @param[in]  S          points to the instance, initialized by plp_resample_init_q16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, at most the block size of the instance
+  @param[out] pDst       points to the output samples, at most
+                         PLP_RESAMPLE_DST_LEN(blockSize, L, M)
+  @return     number of output samples written to pDst
+
+  @par The new samples are appended to the state buffer after the numTaps/L-1 previous samples.
+  Every output is the dot product of the polyphase branch j with the numTaps/L samples ending at
+  input sample n. Finally, the last numTaps/L-1 samples are moved to the beginning of the state
+  buffer. The input sample n and the branch j of the next output are advanced by M/L and M%L without
+  divisions.
+ */
+
+uint32_t plp_resample_q16s_rv32im(plp_resample_instance_q16 *S,
+                                  const int16_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int16_t *__restrict__ pDst) {
+
+    uint32_t i, k;
+    uint32_t L = S->L;
+    uint32_t P = S->phaseLength;
+    uint32_t H = P - 1;
+    uint32_t stepN = S->M / L;
+    uint32_t stepJ = S->M % L;
+    uint32_t n = S->phase / L; // input sample of the next output
+    uint32_t j = S->phase % L; // polyphase branch of the next output
+    uint32_t numOut = 0;
+    int16_t *pState = S->pState;
+
+    for (i = 0; i < blockSize; i++) {
+        pState[H + i] = pSrc[i];
+    }
+
+    while (n < blockSize) {
+        const int16_t *pc = &S->pCoeffs[j * P];
+        const int16_t *px = &pState[n];
+        int32_t acc = 0;
+        for (k = 0; k < P; k++) {
+            acc += pc[k] * px[k];
+        }
+        pDst[numOut++] = saturate_q16(acc, S->shift);
+        n += stepN;
+        j += stepJ;
+        if (j >= L) {
+            j -= L;
+            n++;
+        }
+    }
+
+    // position of the next output relative to the next block
+    S->phase = (n - blockSize) * L + j;
+
+    for (i = 0; i < H; i++) {
+        pState[i] = pState[i + blockSize];
+    }
+
+    return numOut;
+}
+
+/**
+  @} end of ResampleKernels group
+ */
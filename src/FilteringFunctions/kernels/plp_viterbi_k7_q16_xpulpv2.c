@@ -0,0 +1,173 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_viterbi_k7_q16_xpulpv2.c
+ * Description:  K=7 Viterbi decoder with 16-bit fixed-point soft values for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// decodes one block with the traceback buffer pDec
+static void viterbi_k7_q16_xpulpv2(const plp_viterbi_k7_instance_q16 *S,
+                                   const int16_t *__restrict__ pSrc,
+                                   uint32_t numBits,
+                                   uint32_t *__restrict__ pDec,
+                                   uint32_t *__restrict__ pDst) {
+
+    v2s metric[2][PLP_VITERBI_K7_STATES / 2];
+    v2s *pOld = metric[0];
+    v2s *pNew = metric[1];
+    uint8_t code[PLP_VITERBI_K7_STATES / 2];
+    uint32_t state, t, j;
+
+    // coded bits of the transitions from the states j and j+32 with the input bit 0, the other
+    // transitions of the butterfly emit the same or the inverted bits
+    for (j = 0; j < PLP_VITERBI_K7_STATES / 2; j++) {
+        code[j] = (__builtin_popcount((j << 1) & S->poly0) & 1) |
+                  ((__builtin_popcount((j << 1) & S->poly1) & 1) << 1);
+    }
+
+    // the encoder starts in state 0
+    pOld[0] = __PACK2(0, PLP_VITERBI_K7_INIT);
+    for (j = 1; j < PLP_VITERBI_K7_STATES / 2; j++) {
+        pOld[j] = __PACK2(PLP_VITERBI_K7_INIT, PLP_VITERBI_K7_INIT);
+    }
+
+    for (t = 0; t < numBits; t++) {
+        int32_t s0 = pSrc[2 * t] >> PLP_VITERBI_K7_SHIFT;
+        int32_t s1 = pSrc[2 * t + 1] >> PLP_VITERBI_K7_SHIFT;
+        int16_t bm[4] = { s0 + s1, s1 - s0, s0 - s1, -s0 - s1 };
+        v2s ref = __PACK2(pOld[0][0], pOld[0][0]);
+        uint32_t dec[2] = { 0, 0 };
+        v2s *pTmp;
+
+        for (j = 0; j < PLP_VITERBI_K7_STATES / 4; j++) {
+            v2s m = __PACK2(bm[code[2 * j]], bm[code[2 * j + 1]]);
+            v2s a = __SUB2(pOld[j], ref);
+            v2s b = __SUB2(pOld[j + 16], ref);
+            v2s x0 = __ADD2(a, m);
+            v2s y0 = __SUB2(b, m);
+            v2s x1 = __SUB2(a, m);
+            v2s y1 = __ADD2(b, m);
+            v2s n0 = __MAX2(x0, y0);
+            v2s n1 = __MAX2(x1, y1);
+            uint32_t d = (y0[0] > x0[0]) | ((y1[0] > x1[0]) << 1);
+
+            d |= ((y0[1] > x0[1]) << 2) | ((y1[1] > x1[1]) << 3);
+            pNew[2 * j] = __PACK2(n0[0], n1[0]);
+            pNew[2 * j + 1] = __PACK2(n0[1], n1[1]);
+            dec[j >> 3] |= d << ((4 * j) & 31);
+        }
+
+        pDec[2 * t] = dec[0];
+        pDec[2 * t + 1] = dec[1];
+        pTmp = pOld;
+        pOld = pNew;
+        pNew = pTmp;
+    }
+
+    state = 0;
+    if (!S->terminated) {
+        int16_t *pMetric = (int16_t *)pOld;
+
+        for (j = 1; j < PLP_VITERBI_K7_STATES; j++) {
+            state = (pMetric[j] > pMetric[state]) ? j : state;
+        }
+    }
+
+    for (t = 0; t < (numBits + 31) / 32; t++) {
+        pDst[t] = 0;
+    }
+
+    // the input bit is bit 0 of the state, the decision selects the dropped oldest bit
+    for (t = numBits; t-- > 0;) {
+        uint32_t d = (pDec[2 * t + (state >> 5)] >> (state & 31)) & 1;
+
+        pDst[t >> 5] |= (state & 1) << (t & 31);
+        state = (state >> 1) | (d << 5);
+    }
+}
+
+/**
+  @ingroup Viterbi
+ */
+
+/**
+  @addtogroup ViterbiKernels
+  @{
+ */
+
+/**
+  @brief Viterbi decoding of a block with 16-bit fixed-point soft values kernel for XPULPV2
+         extension.
+  @param[in]  S        points to the instance, initialized by plp_viterbi_k7_init_q16
+  @param[in]  pSrc     points to the 2*numBits soft values in Q1.15, two per coded bit
+  @param[in]  numBits  number of bits of the block, including the tail bits
+  @param[out] pDst     points to the (numBits+31)/32 words of decoded bits
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 64 path metrics are packed 16-bit values. One iteration of the ACS loop computes the
+  butterflies of the old states j, j+1 and j+32, j+33 at once with pv.add.h, pv.sub.h and
+  pv.max.h, and pv.pack.h interleaves both results into the new states 2j to 2j+3. The
+  renormalization is merged into the loads of the old path metrics.
+ */
+
+void plp_viterbi_k7_q16s_xpulpv2(const plp_viterbi_k7_instance_q16 *S,
+                                 const int16_t *__restrict__ pSrc,
+                                 uint32_t numBits,
+                                 uint32_t *__restrict__ pDst) {
+
+    viterbi_k7_q16_xpulpv2(S, pSrc, numBits, S->pDecisions, pDst);
+}
+
+/**
+  @brief Parallel Viterbi decoding of independent blocks with 16-bit fixed-point soft values
+         kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_viterbi_k7_instance_q16_parallel struct initialized by
+                    plp_viterbi_k7_q16_parallel
+  @return     none
+
+  @par Core k decodes the blocks k, k+nPE, k+2*nPE, ... with its own 2*numBits words of the
+  traceback buffer. The blocks are independent, hence no synchronization is needed.
+ */
+
+void plp_viterbi_k7_q16p_xpulpv2(void *args) {
+
+    plp_viterbi_k7_instance_q16_parallel *a = (plp_viterbi_k7_instance_q16_parallel *)args;
+
+    uint32_t core = rt_core_id();
+    uint32_t numBits = a->numBits;
+    uint32_t numWords = (numBits + 31) / 32;
+    uint32_t b;
+
+    for (b = core; b < a->nBlocks; b += a->nPE) {
+        viterbi_k7_q16_xpulpv2(a->S, &a->pSrc[2 * b * numBits], numBits,
+                               &a->S->pDecisions[2 * core * numBits], &a->pDst[b * numWords]);
+    }
+}
+
+/**
+  @} end of ViterbiKernels group
+ */
@@ -0,0 +1,137 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_viterbi_k7_q16s_rv32im.c
+ * Description:  K=7 Viterbi decoder with 16-bit fixed-point soft values for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// parity of the 7 bits of r
+static inline uint32_t viterbi_k7_parity(uint32_t r) {
+
+    r ^= r >> 4;
+    r ^= r >> 2;
+    r ^= r >> 1;
+    return r & 1;
+}
+
+/**
+  @ingroup Viterbi
+ */
+
+/**
+  @defgroup ViterbiKernels Viterbi Decoder Kernels
+  @{
+ */
+
+/**
+  @brief Viterbi decoding of a block with 16-bit fixed-point soft values kernel for RV32IM
+         extension.
+  @param[in]  S        points to the instance, initialized by plp_viterbi_k7_init_q16
+  @param[in]  pSrc     points to the 2*numBits soft values in Q1.15, two per coded bit
+  @param[in]  numBits  number of bits of the block, including the tail bits
+  @param[out] pDst     points to the (numBits+31)/32 words of decoded bits
+  @return     none
+ */
+
+void plp_viterbi_k7_q16s_rv32im(const plp_viterbi_k7_instance_q16 *S,
+                                const int16_t *__restrict__ pSrc,
+                                uint32_t numBits,
+                                uint32_t *__restrict__ pDst) {
+
+    uint32_t *pDec = S->pDecisions;
+    int32_t metric[2][PLP_VITERBI_K7_STATES];
+    int32_t *pOld = metric[0];
+    int32_t *pNew = metric[1];
+    uint8_t code[PLP_VITERBI_K7_STATES / 2];
+    uint32_t state, t, j;
+
+    // coded bits of the transitions from the states j and j+32 with the input bit 0, the other
+    // transitions of the butterfly emit the same or the inverted bits
+    for (j = 0; j < PLP_VITERBI_K7_STATES / 2; j++) {
+        code[j] = viterbi_k7_parity((j << 1) & S->poly0) |
+                  (viterbi_k7_parity((j << 1) & S->poly1) << 1);
+    }
+
+    // the encoder starts in state 0
+    pOld[0] = 0;
+    for (j = 1; j < PLP_VITERBI_K7_STATES; j++) {
+        pOld[j] = PLP_VITERBI_K7_INIT;
+    }
+
+    for (t = 0; t < numBits; t++) {
+        int32_t s0 = pSrc[2 * t] >> PLP_VITERBI_K7_SHIFT;
+        int32_t s1 = pSrc[2 * t + 1] >> PLP_VITERBI_K7_SHIFT;
+        int32_t bm[4] = { s0 + s1, s1 - s0, s0 - s1, -s0 - s1 };
+        int32_t ref = pOld[0];
+        uint32_t dec[2] = { 0, 0 };
+        int32_t *pTmp;
+
+        for (j = 0; j < PLP_VITERBI_K7_STATES / 2; j++) {
+            int32_t m = bm[code[j]];
+            int32_t a = pOld[j] - ref;
+            int32_t b = pOld[j + 32] - ref;
+            int32_t x0 = a + m;
+            int32_t y0 = b - m;
+            int32_t x1 = a - m;
+            int32_t y1 = b + m;
+            uint32_t d0 = (y0 > x0);
+            uint32_t d1 = (y1 > x1);
+
+            pNew[2 * j] = d0 ? y0 : x0;
+            pNew[2 * j + 1] = d1 ? y1 : x1;
+            dec[j >> 4] |= (d0 | (d1 << 1)) << ((2 * j) & 31);
+        }
+
+        pDec[2 * t] = dec[0];
+        pDec[2 * t + 1] = dec[1];
+        pTmp = pOld;
+        pOld = pNew;
+        pNew = pTmp;
+    }
+
+    state = 0;
+    if (!S->terminated) {
+        for (j = 1; j < PLP_VITERBI_K7_STATES; j++) {
+            state = (pOld[j] > pOld[state]) ? j : state;
+        }
+    }
+
+    for (t = 0; t < (numBits + 31) / 32; t++) {
+        pDst[t] = 0;
+    }
+
+    // the input bit is bit 0 of the state, the decision selects the dropped oldest bit
+    for (t = numBits; t-- > 0;) {
+        uint32_t d = (pDec[2 * t + (state >> 5)] >> (state & 31)) & 1;
+
+        pDst[t >> 5] |= (state & 1) << (t & 31);
+        state = (state >> 1) | (d << 5);
+    }
+}
+
+/**
+  @} end of ViterbiKernels group
+ */
@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_agc_init_q16.c
+ * Description:  Initialization of the 16-bit fixed-point automatic gain control
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Agc
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 16-bit fixed-point automatic gain control.
+  @param[out] S        points to the instance of the 16-bit fixed-point AGC
+  @param[in]  target   target peak level of the output in Q1.15, positive
+  @param[in]  attack   envelope smoothing factor in Q1.15 for a rising peak, 0x7FFF follows the
+                       peak immediately
+  @param[in]  release  envelope smoothing factor in Q1.15 for a falling peak
+  @param[in]  minGain  smallest gain in Q8.8, not negative
+  @param[in]  maxGain  largest gain in Q8.8, at least minGain
+  @return     none
+
+  @par The envelope is cleared, and the gain starts at 1.0, limited to [minGain, maxGain].
+ */
+
+void plp_agc_init_q16(plp_agc_instance_q16 *S,
+                      int16_t target,
+                      int16_t attack,
+                      int16_t release,
+                      int16_t minGain,
+                      int16_t maxGain) {
+
+    int16_t gain = 0x0100;
+
+    S->target = target;
+    S->attack = attack;
+    S->release = release;
+    S->minGain = minGain;
+    S->maxGain = maxGain;
+    S->env = 0;
+    S->gain = (gain < minGain) ? minGain : (gain > maxGain) ? maxGain : gain;
+}
+
+/**
+  @} end of Agc group
+ */
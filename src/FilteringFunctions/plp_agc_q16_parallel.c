@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_agc_q16_parallel.c
+ * Description:  Glue code for the parallel 16-bit fixed-point automatic gain control
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Agc
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel multi-channel automatic gain control of 16-bit fixed-point
+         blocks.
+  @param[in,out] S          points to nChannels instances, initialized by plp_agc_init_q16
+  @param[in]     pSrc       points to the input samples in Q1.15, blockSize samples per channel
+  @param[in]     blockSize  number of samples per channel
+  @param[in]     nChannels  number of independent channels
+  @param[in]     nPE        number of cores to use
+  @param[out]    pDst       points to the output samples in Q1.15, which may be pSrc
+  @return        none
+
+  @par Channel c uses the instance S[c], and its samples are stored contiguously at
+  pSrc[c*blockSize] and pDst[c*blockSize].
+ */
+
+void plp_agc_q16_parallel(plp_agc_instance_q16 *S,
+                          const int16_t *pSrc,
+                          uint32_t blockSize,
+                          uint32_t nChannels,
+                          uint32_t nPE,
+                          int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_agc_instance_q16_parallel args = { .S = S,
+                                               .pSrc = pSrc,
+                                               .blockSize = blockSize,
+                                               .nChannels = nChannels,
+                                               .nPE = nPE,
+                                               .pDst = pDst };
+
+        rt_team_fork(nPE, plp_agc_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of Agc group
+ */
@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_autocorr_f32.c
+ * Description:  Glue code for the autocorrelation of 32-bit floating-point vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Autocorrelation
+  @{
+ */
+
+/**
+  @brief Glue code for the autocorrelation of a 32-bit floating-point vector.
+  @param[in]  pSrc      points to the input vector of n samples
+  @param[in]  n         number of input samples
+  @param[in]  maxLag    largest lag to compute, the lags from n on are 0
+  @param[out] pDst      points to the maxLag+1 output values
+  @return     none
+ */
+
+void plp_autocorr_f32(const float32_t *__restrict__ pSrc,
+                      uint32_t n,
+                      uint32_t maxLag,
+                      float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_autocorr_f32s_xpulpv2(pSrc, n, maxLag, pDst);
+    }
+}
+
+/**
+  @} end of Autocorrelation group
+ */
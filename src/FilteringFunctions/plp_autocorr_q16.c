@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_autocorr_q16.c
+ * Description:  Glue code for the autocorrelation of 16-bit fixed-point vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup Autocorrelation Autocorrelation
+  This module contains the glue code for the autocorrelation
+  \f[
+      r[l] = \sum_{i=0}^{n-1-l} x[i] x[i+l], \qquad 0 \le l \le maxLag
+  \f]
+  of a vector of n samples. The autocorrelation is symmetric, r[-l] = r[l], so only the maxLag+1
+  non-negative lags are computed, instead of all 2n-1 lags of plp_correlate. A typical use is the
+  linear prediction analysis with plp_levinson_durbin. The kernel codes (kernels) are in the
+  module Autocorrelation Kernels.
+ */
+
+/**
+  @addtogroup Autocorrelation
+  @{
+ */
+
+/**
+  @brief Glue code for the autocorrelation of a 16-bit fixed-point vector.
+  @param[in]  pSrc      points to the input vector of n samples
+  @param[in]  n         number of input samples
+  @param[in]  maxLag    largest lag to compute, the lags from n on are 0
+  @param[in]  fracBits  number of fractional bits removed, see below
+  @param[out] pDst      points to the maxLag+1 output values
+  @return     none
+
+  @par Fix-Point, Shifting and Saturation
+  The products of the input samples are summed up without loss of precision, and the sums are
+  shifted to the right by fracBits, with rounding, and saturated to 32 bits. With Q1.15 input
+  samples and fracBits = 15, the output is in Q1.15, but may exceed the range of 16 bits.
+ */
+
+void plp_autocorr_q16(const int16_t *__restrict__ pSrc,
+                      uint32_t n,
+                      uint32_t maxLag,
+                      uint32_t fracBits,
+                      int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_autocorr_q16s_rv32im(pSrc, n, maxLag, fracBits, pDst);
+    } else {
+        plp_autocorr_q16s_xpulpv2(pSrc, n, maxLag, fracBits, pDst);
+    }
+}
+
+/**
+  @} end of Autocorrelation group
+ */
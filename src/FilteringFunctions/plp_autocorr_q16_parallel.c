@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_autocorr_q16_parallel.c
+ * Description:  Glue code for the parallel autocorrelation of 16-bit fixed-point vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Autocorrelation
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel autocorrelation of a 16-bit fixed-point vector.
+  @param[in]  pSrc      points to the input vector of n samples
+  @param[in]  n         number of input samples
+  @param[in]  maxLag    largest lag to compute, the lags from n on are 0
+  @param[in]  fracBits  number of fractional bits removed, see plp_autocorr_q16
+  @param[in]  nPE       number of cores to use
+  @param[out] pDst      points to the maxLag+1 output values
+  @return     none
+
+  @par
+  The input samples are split among the cores, and the partial sums of every core are added up at
+  the end, such that the result is the same as with plp_autocorr_q16. The (maxLag+1)*nPE
+  partial sums are stored in a buffer taken with plp_scratch_alloc. If it cannot be allocated,
+  plp_autocorr_q16s_xpulpv2 is used on a single core.
+ */
+
+void plp_autocorr_q16_parallel(const int16_t *__restrict__ pSrc,
+                               uint32_t n,
+                               uint32_t maxLag,
+                               uint32_t fracBits,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t partialSize = sizeof(int64_t) * (maxLag + 1) * nPE;
+        int64_t *pPartial = (int64_t *)plp_scratch_alloc(partialSize);
+
+        if (pPartial == NULL) {
+            plp_autocorr_q16s_xpulpv2(pSrc, n, maxLag, fracBits, pDst);
+            return;
+        }
+
+        plp_autocorr_instance_q16 args = { .pSrc = pSrc,
+                                           .n = n,
+                                           .maxLag = maxLag,
+                                           .fracBits = fracBits,
+                                           .nPE = nPE,
+                                           .pPartial = pPartial,
+                                           .pDst = pDst };
+
+        rt_team_fork(nPE, plp_autocorr_q16p_xpulpv2, (void *)&args);
+
+        plp_scratch_free(pPartial, partialSize);
+    }
+}
+
+/**
+  @} end of Autocorrelation group
+ */
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_init_q32.c
+ * Description:  32-bit fixed-point biquad cascade direct form I initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascade
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 32-bit fixed-point biquad cascade in direct form I.
+  @param[out] S          points to the instance of the 32-bit fixed-point biquad cascade
+  @param[in]  numStages  number of second order stages
+  @param[in]  pCoeffs    points to the 5*numStages filter coefficients
+  @param[in]  pState     points to the state buffer of 4*numStages values
+  @param[in]  postShift  left shift of the coefficients, smaller than 31
+  @return     none
+
+  @par The coefficients of each stage are stored as {b0, b1, b2, a1, a2}. The state is
+  cleared, and the buffers must stay valid as long as S is used.
+ */
+
+void plp_biquad_cascade_df1_init_q32(plp_biquad_cascade_df1_instance_q32 *S,
+                                     uint32_t numStages,
+                                     const int32_t *pCoeffs,
+                                     int32_t *pState,
+                                     uint32_t postShift) {
+
+    uint32_t i;
+
+    for (i = 0; i < 4 * numStages; i++) {
+        pState[i] = 0;
+    }
+
+    S->numStages = numStages;
+    S->pState = pState;
+    S->pCoeffs = pCoeffs;
+    S->postShift = postShift;
+}
+
+/**
+  @} end of BiquadCascade group
+ */
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q16.c
+ * Description:  16-bit fixed-point biquad cascade direct form I glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup BiquadCascade Biquad Cascade IIR Filter
+  Cascade of second order IIR sections. Each stage computes
+
+  <pre>
+      y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]
+  </pre>
+
+  where the feedback coefficients a1 and a2 have the opposite sign compared to the usual transfer
+  function notation, like in CMSIS-DSP. The fixed-point versions use the direct form I, which keeps
+  x[n-1], x[n-2], y[n-1] and y[n-2] in the state (4 values per stage). The 16-bit coefficients of a
+  stage are stored as {b0, 0, b1, b2, a1, a2}, so that {b1, b2} and {a1, a2} are word aligned and
+  can be loaded as vectors. The 32-bit coefficients are stored as {b0, b1, b2, a1, a2}. The
+  floating-point version uses the transposed direct form II, which only needs 2 state values per
+  stage, with the coefficients {b0, b1, b2, a1, a2}.
+
+  The recursion cannot be split along time. Therefore, the parallel versions filter multiple
+  independent channels, assigning one channel after the other to each core.
+ */
+
+/**
+  @addtogroup BiquadCascade
+  @{
+ */
+
+/**
+  @brief Glue code for 16-bit fixed-point biquad cascade filtering in direct form I.
+  @param[in]  S          points to the instance, initialized by plp_biquad_cascade_df1_init_q16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input and output samples
+  @param[out] pDst       points to the block of output samples, which may be equal to pSrc
+  @return     none
+
+  @par Fix-Point, Shifting and Saturation
+  The coefficients are in Q(15-postShift) format, and the products are accumulated with 32 bits.
+  The input, coefficients and scaling must therefore be chosen such that the sum of one stage fits
+  into 32 bits. The sum is shifted by 15-postShift to the right (with rounding) and saturated to
+  16 bits.
+ */
+
+void plp_biquad_cascade_df1_q16(const plp_biquad_cascade_df1_instance_q16 *S,
+                                const int16_t *pSrc,
+                                uint32_t blockSize,
+                                int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_biquad_cascade_df1_q16s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_biquad_cascade_df1_q16s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of BiquadCascade group
+ */
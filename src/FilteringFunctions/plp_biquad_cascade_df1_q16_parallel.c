@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q16_parallel.c
+ * Description:  parallel 16-bit fixed-point biquad cascade direct form I glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascade
+  @{
+ */
+
+/**
+  @brief Glue code for parallel multi-channel 16-bit fixed-point biquad cascade filtering in direct
+         form I.
+  @param[in]  S          points to nChannels instances, initialized by the init function
+  @param[in]  pSrc       points to the input samples, blockSize samples per channel
+  @param[in]  blockSize  number of samples per channel
+  @param[in]  nChannels  number of independent channels
+  @param[in]  nPE        number of cores to use
+  @param[out] pDst       points to the output samples, which may be equal to pSrc
+  @return     none
+
+  @par Channel c uses the instance S[c], and its samples are stored contiguously at
+  pSrc[c*blockSize] and pDst[c*blockSize].
+
+  @par Fix-Point, Shifting and Saturation
+  The coefficients are in Q(15-postShift) format, and the products are accumulated with 32 bits.
+  The input, coefficients and scaling must therefore be chosen such that the sum of one stage fits
+  into 32 bits. The sum is shifted by 15-postShift to the right (with rounding) and saturated to
+  16 bits.
+ */
+
+void plp_biquad_cascade_df1_q16_parallel(const plp_biquad_cascade_df1_instance_q16 *S,
+                                         const int16_t *pSrc,
+                                         uint32_t blockSize,
+                                         uint32_t nChannels,
+                                         uint32_t nPE,
+                                         int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_biquad_cascade_df1_instance_q16_parallel args = { .S = S,
+                                                              .pSrc = pSrc,
+                                                              .blockSize = blockSize,
+                                                              .nChannels = nChannels,
+                                                              .nPE = nPE,
+                                                              .pDst = pDst };
+
+        rt_team_fork(nPE, plp_biquad_cascade_df1_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of BiquadCascade group
+ */
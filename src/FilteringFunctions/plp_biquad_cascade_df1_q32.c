@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q32.c
+ * Description:  32-bit fixed-point biquad cascade direct form I glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascade
+  @{
+ */
+
+/**
+  @brief Glue code for 32-bit fixed-point biquad cascade filtering in direct form I.
+  @param[in]  S          points to the instance, initialized by plp_biquad_cascade_df1_init_q32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input and output samples
+  @param[out] pDst       points to the block of output samples, which may be equal to pSrc
+  @return     none
+
+  @par Fix-Point, Shifting and Saturation
+  The coefficients are in Q(31-postShift) format, and the products are accumulated with 64 bits.
+  The sum is shifted by 31-postShift to the right (with rounding) and saturated to 32 bits.
+ */
+
+void plp_biquad_cascade_df1_q32(const plp_biquad_cascade_df1_instance_q32 *S,
+                                const int32_t *pSrc,
+                                uint32_t blockSize,
+                                int32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_biquad_cascade_df1_q32s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_biquad_cascade_df1_q32s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of BiquadCascade group
+ */
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df2T_init_f32.c
+ * Description:  32-bit floating-point biquad cascade transposed direct form II initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascade
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 32-bit floating-point biquad cascade in transposed direct
+         form II.
+  @param[out] S          points to the instance of the 32-bit floating-point biquad cascade
+  @param[in]  numStages  number of second order stages
+  @param[in]  pCoeffs    points to the 5*numStages filter coefficients
+  @param[in]  pState     points to the state buffer of 2*numStages values
+  @return     none
+
+  @par The coefficients of each stage are stored as {b0, b1, b2, a1, a2}. The state is
+  cleared, and the buffers must stay valid as long as S is used.
+ */
+
+void plp_biquad_cascade_df2T_init_f32(plp_biquad_cascade_df2T_instance_f32 *S,
+                                      uint32_t numStages,
+                                      const float32_t *pCoeffs,
+                                      float32_t *pState) {
+
+    uint32_t i;
+
+    for (i = 0; i < 2 * numStages; i++) {
+        pState[i] = 0.0f;
+    }
+
+    S->numStages = numStages;
+    S->pState = pState;
+    S->pCoeffs = pCoeffs;
+}
+
+/**
+  @} end of BiquadCascade group
+ */
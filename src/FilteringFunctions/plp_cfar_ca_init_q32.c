@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfar_ca_init_q32.c
+ * Description:  Initialization of the 32-bit fixed-point cell-averaging CFAR
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup CFAR
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 32-bit fixed-point cell-averaging CFAR.
+  @param[out] S          points to the instance of the 32-bit fixed-point CA-CFAR
+  @param[in]  guardRows  number of guard rows above and below the cell
+  @param[in]  guardCols  number of guard columns left and right of the cell
+  @param[in]  trainRows  number of training rows above and below the guard cells
+  @param[in]  trainCols  number of training columns left and right of the guard cells
+  @param[in]  alpha      threshold factor in Q8.8
+  @param[in]  pTmp       points to a temporary buffer of 2*numCols values, or nPE*2*numCols values
+                         for the parallel version
+  @return     none
+
+  @par The training region of (2*(guardRows+trainRows)+1) x (2*(guardCols+trainCols)+1)
+  cells without the guard cells must hold at most 65535 cells. The buffer must stay valid
+  as long as S is used.
+ */
+
+void plp_cfar_ca_init_q32(plp_cfar_ca_instance_q32 *S,
+                          uint32_t guardRows,
+                          uint32_t guardCols,
+                          uint32_t trainRows,
+                          uint32_t trainCols,
+                          uint16_t alpha,
+                          int64_t *pTmp) {
+
+    S->guardRows = guardRows;
+    S->guardCols = guardCols;
+    S->trainRows = trainRows;
+    S->trainCols = trainCols;
+    S->alpha = alpha;
+    S->pTmp = pTmp;
+}
+
+/**
+  @} end of CFAR group
+ */
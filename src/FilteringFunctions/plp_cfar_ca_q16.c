@@ -0,0 +1,101 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfar_ca_q16.c
+ * Description:  Glue code for the 16-bit fixed-point cell-averaging CFAR
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup CFAR Constant False Alarm Rate Detectors
+  Constant false alarm rate (CFAR) detectors for radar post-processing, which compare every cell of
+  a power map, e.g. a range-Doppler map, against a threshold derived from the noise around it. The
+  cell x is detected if
+
+  <pre>
+      x > alpha * z
+  </pre>
+
+  where z estimates the noise from the training cells around the cell, leaving out the guard cells
+  next to it, which may still contain the target. alpha is an unsigned Q8.8 factor, which sets the
+  false alarm rate.
+
+  The cell-averaging CFAR (CA-CFAR) takes the mean of the training cells in a two-dimensional window
+  of (2*(guardRows+trainRows)+1) x (2*(guardCols+trainCols)+1) cells, without the centered
+  (2*guardRows+1) x (2*guardCols+1) guard cells. The sums over both windows are running sums,
+  first along the columns and then along the rows, hence every cell costs a few operations
+  whatever the size of the windows.
+
+  The ordered-statistic CFAR (OS-CFAR) works along the rows, and takes the value of the given rank
+  in the sorted trainCells cells on either side of the guard cells, which is robust against
+  interfering targets among the training cells. The training cells are kept sorted, and every new
+  cell replaces a leaving one, shifting only the values between both positions.
+
+  Near the borders of the map, the windows only contain the cells inside the map. The CA-CFAR
+  averages the remaining cells, and the OS-CFAR scales the rank with the number of training cells.
+
+  The detections are written as a bit mask with the layout of plp_cmp_gt_i16, i.e. cell j of a row
+  is bit j%32 of word j/32, where every row starts with a new word and takes (numCols+31)/32 words.
+  The cells hold powers, and must not be negative. At most 65535 training cells are supported.
+
+  The parallel versions split the rows into chunks for the cores. For the CA-CFAR, every core sums
+  the columns of the rows around its first row itself, hence the cores need no synchronization.
+ */
+
+/**
+  @addtogroup CFAR
+  @{
+ */
+
+/**
+  @brief Glue code for the cell-averaging CFAR of a 16-bit fixed-point power map.
+  @param[in]  S        points to the instance, initialized by plp_cfar_ca_init_q16
+  @param[in]  pSrc     points to the power map of numRows x numCols cells, stored row by row
+  @param[in]  numRows  number of rows of the map
+  @param[in]  numCols  number of columns of the map
+  @param[out] pMask    points to the detection mask of numRows*((numCols+31)/32) words
+  @return     none
+ */
+
+void plp_cfar_ca_q16(const plp_cfar_ca_instance_q16 *S,
+                     const int16_t *__restrict__ pSrc,
+                     uint32_t numRows,
+                     uint32_t numCols,
+                     uint32_t *__restrict__ pMask) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cfar_ca_q16s_rv32im(S, pSrc, numRows, numCols, pMask);
+    } else {
+        plp_cfar_ca_q16s_xpulpv2(S, pSrc, numRows, numCols, pMask);
+    }
+}
+
+/**
+  @} end of CFAR group
+ */
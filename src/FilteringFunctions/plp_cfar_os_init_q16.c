@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfar_os_init_q16.c
+ * Description:  Initialization of the 16-bit fixed-point ordered-statistic CFAR
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup CFAR
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 16-bit fixed-point ordered-statistic CFAR.
+  @param[out] S           points to the instance of the 16-bit fixed-point OS-CFAR
+  @param[in]  guardCells  number of guard cells left and right of the cell
+  @param[in]  trainCells  number of training cells left and right of the guard cells
+  @param[in]  rank        rank of the noise estimate in the 2*trainCells sorted training cells,
+                          smaller than 2*trainCells, e.g. 3/4 of it
+  @param[in]  alpha       threshold factor in Q8.8
+  @param[in]  pTmp        points to a temporary buffer of 2*trainCells values, or
+                          nPE*2*trainCells values for the parallel version
+  @return     none
+
+  @par The buffer must stay valid as long as S is used.
+ */
+
+void plp_cfar_os_init_q16(plp_cfar_os_instance_q16 *S,
+                          uint32_t guardCells,
+                          uint32_t trainCells,
+                          uint32_t rank,
+                          uint16_t alpha,
+                          int16_t *pTmp) {
+
+    S->guardCells = guardCells;
+    S->trainCells = trainCells;
+    S->rank = rank;
+    S->alpha = alpha;
+    S->pTmp = pTmp;
+}
+
+/**
+  @} end of CFAR group
+ */
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfar_os_q16_parallel.c
+ * Description:  Glue code for the parallel 16-bit fixed-point ordered-statistic CFAR
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup CFAR
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel ordered-statistic CFAR of a 16-bit fixed-point power map.
+  @param[in]  S        points to the instance, initialized by plp_cfar_os_init_q16
+  @param[in]  pSrc     points to the power map of numRows x numCols cells, stored row by row
+  @param[in]  numRows  number of rows of the map
+  @param[in]  numCols  number of columns of the map
+  @param[in]  nPE      number of cores to use
+  @param[out] pMask    points to the detection mask of numRows*((numCols+31)/32) words
+  @return     none
+
+  @par Every core uses 2*trainCells values of the temporary buffer of S for its sorted window.
+ */
+
+void plp_cfar_os_q16_parallel(const plp_cfar_os_instance_q16 *S,
+                              const int16_t *__restrict__ pSrc,
+                              uint32_t numRows,
+                              uint32_t numCols,
+                              uint32_t nPE,
+                              uint32_t *__restrict__ pMask) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_cfar_os_instance_q16_parallel args = { .S = S,
+                                                   .pSrc = pSrc,
+                                                   .numRows = numRows,
+                                                   .numCols = numCols,
+                                                   .nPE = nPE,
+                                                   .pMask = pMask };
+
+        rt_team_fork(nPE, plp_cfar_os_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of CFAR group
+ */
@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cic_decimate_i32.c
+ * Description:  CIC decimation of a 32-bit integer block glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup CICDecimate CIC Decimator
+  Cascaded integrator-comb (CIC) decimator of N stages, decimation factor R and differential delay
+  D, a multiplier-free lowpass filter for the first decimation stage of high-rate streams like the
+  bit stream of PDM microphones. Every input sample passes through N integrators, and every R-th
+  integrator output through N combs:
+
+  <pre>
+      H(z) = ((1 - z^(-R*D)) / (1 - z^(-1)))^N
+  </pre>
+
+  The DC gain is (R*D)^N, i.e., the output needs B + N*log2(R*D) bits for inputs of B bits. The
+  integrators wrap around on overflow, which cancels in the combs as long as the output fits into 32
+  bits. The output is shifted by S->shift to the right (with rounding), e.g. by N*log2(R*D) for a
+  gain of one. The position within the current R input samples is kept in the instance, hence blocks
+  of any length can be processed one after the other, and every call returns the number of produced
+  outputs, at most PLP_CIC_DST_LEN(blockSize, R). The passband droop of the CIC is usually corrected
+  with a compensation FIR filter at the lower rate, as done by plp_pdm_to_pcm_q32. The parallel
+  versions process independent channels, one channel per core.
+ */
+
+/**
+  @addtogroup CICDecimate
+  @{
+ */
+
+/**
+  @brief Glue code for CIC decimation of a 32-bit integer block.
+  @param[in]  S          points to the instance, initialized by plp_cic_decimate_init_i32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples
+  @param[out] pDst       points to the output samples, at most PLP_CIC_DST_LEN(blockSize, R)
+  @return     number of output samples written to pDst
+ */
+
+uint32_t plp_cic_decimate_i32(plp_cic_decimate_instance_i32 *S,
+                              const int32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        return plp_cic_decimate_i32s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        return plp_cic_decimate_i32s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of CICDecimate group
+ */
@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cic_decimate_i32_parallel.c
+ * Description:  Parallel multi-channel CIC decimation of a 32-bit integer block glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup CICDecimate
+  @{
+ */
+
+/**
+  @brief Glue code for parallel multi-channel CIC decimation of a 32-bit integer block.
+  @param[in]  S          points to nChannels instances, initialized by plp_cic_decimate_init_i32
+  @param[in]  pSrc       points to the input samples, blockSize samples per channel
+  @param[in]  blockSize  number of input samples per channel
+  @param[in]  nChannels  number of independent channels
+  @param[in]  nPE        number of cores to use
+  @param[out] pDst       points to the output samples, PLP_CIC_DST_LEN(blockSize, R) per channel
+  @return     number of output samples written per channel
+
+  @par Channel c uses the instance S[c], and its input samples are stored contiguously at
+  pSrc[c*blockSize]. Its outputs are stored at pDst[c*PLP_CIC_DST_LEN(blockSize, R)]. All
+  instances must have the same R and position, i.e. they were initialized together and processed
+  the same number of samples, such that all channels produce the same number of outputs.
+ */
+
+uint32_t plp_cic_decimate_i32_parallel(plp_cic_decimate_instance_i32 *S,
+                                       const int32_t *__restrict__ pSrc,
+                                       uint32_t blockSize,
+                                       uint32_t nChannels,
+                                       uint32_t nPE,
+                                       int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return 0;
+    } else {
+        uint32_t numOut = (S->phase + blockSize) / S->R;
+
+        plp_cic_decimate_instance_i32_parallel args = { .S = S,
+                                                       .pSrc = pSrc,
+                                                       .blockSize = blockSize,
+                                                       .nChannels = nChannels,
+                                                       .nPE = nPE,
+                                                       .pDst = pDst };
+
+        rt_team_fork(nPE, plp_cic_decimate_i32p_xpulpv2, (void *)&args);
+
+        return numOut;
+    }
+}
+
+/**
+  @} end of CICDecimate group
+ */
@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cic_decimate_init_i32.c
+ * Description:  Initialization of the 32-bit integer CIC decimator
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup CICDecimate
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 32-bit integer CIC decimator.
+  @param[out] S          points to the instance of the 32-bit integer CIC decimator
+  @param[in]  numStages  number of integrator and comb stages N, at most PLP_CIC_MAX_STAGES
+  @param[in]  R          decimation factor
+  @param[in]  diffDelay  differential delay D of the combs, 1 or 2
+  @param[in]  pState     points to the state buffer of PLP_CIC_STATE_LEN(numStages, diffDelay)
+                         values
+  @param[in]  shift      amount to shift the comb output to the right
+  @return     0: Success, 1: numStages, R or diffDelay is out of range
+
+  @par The state is cleared and the first output is produced after R input samples. The state
+  buffer must stay valid as long as S is used.
+ */
+
+int plp_cic_decimate_init_i32(plp_cic_decimate_instance_i32 *S,
+                              uint32_t numStages,
+                              uint32_t R,
+                              uint32_t diffDelay,
+                              int32_t *__restrict__ pState,
+                              uint32_t shift) {
+
+    uint32_t i;
+
+    if (numStages == 0 || numStages > PLP_CIC_MAX_STAGES || R == 0 || diffDelay == 0 ||
+        diffDelay > 2) {
+        return 1;
+    }
+
+    for (i = 0; i < PLP_CIC_STATE_LEN(numStages, diffDelay); i++) {
+        pState[i] = 0;
+    }
+
+    S->numStages = numStages;
+    S->R = R;
+    S->diffDelay = diffDelay;
+    S->shift = shift;
+    S->pState = pState;
+    S->phase = 0;
+
+    return 0;
+}
+
+/**
+  @} end of CICDecimate group
+ */
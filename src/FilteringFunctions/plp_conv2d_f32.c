@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_f32.c
+ * Description:  2D convolution of 32-bit float images glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv2d
+ * @{
+ */
+
+/**
+ * @brief Glue code for 2D convolution of 32-bit float images.
+ * @param[in]  pSrc       points to the input image, srcRows x srcCols
+ * @param[in]  srcRows    number of rows of the input image
+ * @param[in]  srcCols    number of columns of the input image
+ * @param[in]  nChannels  number of channels, stored one after the other
+ * @param[in]  pKernel    points to the kernel, kRows x kCols per channel
+ * @param[in]  kRows      number of rows of the kernel
+ * @param[in]  kCols      number of columns of the kernel
+ * @param[out] pDst       output image returned here, (srcRows - kRows + 1) x
+ *                        (srcCols - kCols + 1) per channel
+ * @return     none
+ */
+
+void plp_conv2d_f32(const float32_t *__restrict__ pSrc,
+                    uint32_t srcRows,
+                    uint32_t srcCols,
+                    uint32_t nChannels,
+                    const float32_t *__restrict__ pKernel,
+                    uint32_t kRows,
+                    uint32_t kCols,
+                    float32_t *__restrict__ pDst) {
+
+    if (srcRows < kRows || srcCols < kCols) {
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("error: FC doesn't have FPU\n");
+        return;
+    } else {
+        // samples per input channel, output channel and kernel
+        uint32_t srcSize = srcRows * srcCols;
+        uint32_t dstSize = (srcRows - kRows + 1) * (srcCols - kCols + 1);
+        uint32_t kSize = kRows * kCols;
+        uint32_t ch;
+
+        for (ch = 0; ch < nChannels; ch++) {
+            plp_conv2d_f32s_xpulpv2(pSrc + ch * srcSize, srcRows, srcCols, pKernel + ch * kSize,
+                                   kRows, kCols, pDst + ch * dstSize);
+        }
+    }
+}
+
+/**
+ * @} end of Conv2d group
+ */
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_f32_parallel.c
+ * Description:  Parallel 2D convolution of 32-bit float images glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv2d
+ * @{
+ */
+
+/**
+ * @brief Glue code for parallel 2D convolution of 32-bit float images.
+ * @param[in]  pSrc       points to the input image, srcRows x srcCols
+ * @param[in]  srcRows    number of rows of the input image
+ * @param[in]  srcCols    number of columns of the input image
+ * @param[in]  nChannels  number of channels, stored one after the other
+ * @param[in]  pKernel    points to the kernel, kRows x kCols per channel
+ * @param[in]  kRows      number of rows of the kernel
+ * @param[in]  kCols      number of columns of the kernel
+ * @param[in]  nPE        number of cores to compute on
+ * @param[out] pDst       output image returned here, (srcRows - kRows + 1) x
+ *                        (srcCols - kCols + 1) per channel
+ * @return     none
+ *
+ * @par The output rows of all channels are split into nPE contiguous ranges, one per core. With
+ * at least as many channels as cores, every core thus computes whole channels, otherwise the
+ * rows of a channel are shared among the cores.
+ */
+
+void plp_conv2d_f32_parallel(const float32_t *__restrict__ pSrc,
+                             uint32_t srcRows,
+                             uint32_t srcCols,
+                             uint32_t nChannels,
+                             const float32_t *__restrict__ pKernel,
+                             uint32_t kRows,
+                             uint32_t kCols,
+                             uint32_t nPE,
+                             float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        if (srcRows < kRows || srcCols < kCols) {
+            return;
+        }
+
+        plp_conv2d_instance_f32 S = { .pSrc = pSrc,
+                                      .srcRows = srcRows,
+                                      .srcCols = srcCols,
+                                      .nChannels = nChannels,
+                                      .pKernel = pKernel,
+                                      .kRows = kRows,
+                                      .kCols = kCols,
+                                      .nPE = nPE,
+                                      .pDst = pDst };
+
+        rt_team_fork(nPE, plp_conv2d_f32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+ * @} end of Conv2d group
+ */
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_winograd_i16.c
+ * Description:  Winograd 3x3 convolution of 16-bit integer images glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv2dWinograd
+ * @{
+ */
+
+/**
+ * @brief Glue code for the Winograd 3x3 convolution of 16-bit integer images.
+ * @param[in]  pSrc         points to the input image, inChannels x srcRows x srcCols
+ * @param[in]  srcRows      number of rows of the input image
+ * @param[in]  srcCols      number of columns of the input image
+ * @param[in]  inChannels   number of input channels
+ * @param[in]  pU           points to the transformed weights, computed by
+ *                          plp_conv2d_winograd_weights_i16
+ * @param[in]  outChannels  number of output channels
+ * @param[in]  pTmpV        points to a buffer of 16 * inChannels * ((srcCols - 1) / 2) values
+ * @param[in]  pTmpM        points to a buffer of 16 * outChannels * ((srcCols - 1) / 2) values
+ * @param[out] pDst         output image returned here, outChannels x (srcRows - 2) x
+ *                          (srcCols - 2)
+ * @return     none
+ */
+
+void plp_conv2d_winograd_i16(const int16_t *__restrict__ pSrc,
+                             uint32_t srcRows,
+                             uint32_t srcCols,
+                             uint32_t inChannels,
+                             const int32_t *__restrict__ pU,
+                             uint32_t outChannels,
+                             int32_t *__restrict__ pTmpV,
+                             int32_t *__restrict__ pTmpM,
+                             int32_t *__restrict__ pDst) {
+
+    if (srcRows < 3 || srcCols < 3) {
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_conv2d_winograd_i16s_rv32im(
+            pSrc, srcRows, srcCols, inChannels, pU, outChannels, pTmpV, pTmpM, pDst);
+    } else {
+        plp_conv2d_winograd_i16s_xpulpv2(
+            pSrc, srcRows, srcCols, inChannels, pU, outChannels, pTmpV, pTmpM, pDst);
+    }
+}
+
+/**
+ * @} end of Conv2dWinograd group
+ */
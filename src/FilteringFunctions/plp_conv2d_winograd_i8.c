@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_winograd_i8.c
+ * Description:  Winograd 3x3 convolution of 8-bit integer images glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Conv2dWinograd Winograd 3x3 Convolution
+ * This module contains the glue code for the valid 2D convolution of multi-channel images with
+ * 3x3 kernels and stride 1, as in the layers of a CNN, computed with the Winograd minimal
+ * filtering algorithm F(2x2,3x3). The kernel codes are in the module Winograd 3x3 Convolution
+ * Kernels.
+ *
+ * Every output channel co is the sum over all input channels ci of the 2D convolution of channel
+ * ci with the kernel pKernel[co][ci], as computed by plp_conv2d:
+ * pDst[co][i][j] = sum over ci, r, c of pSrc[ci][i + r][j + c] * pKernel[co][ci][2 - r][2 - c].
+ *
+ * The output is computed in tiles of 2x2 outputs, from overlapping 4x4 tiles of the input. Every
+ * input tile d is transformed into V = B^T d B with additions only, and multiplied element-wise
+ * with the transformed weights U of plp_conv2d_winograd_weights_i8 or _i16. Summed over the input
+ * channels, the 16 element-wise products of all tiles of a row of tiles are 16 matrix
+ * multiplications, computed with the kernels of plp_mat_mult_trans. The output tile is finally
+ * transformed back with A^T M A. This takes 16 multiplications per tile and pair of channels,
+ * instead of the 36 of the direct convolution, i.e. 2.25 times fewer.
+ *
+ * Since the weights are scaled by four to be integers, the results are exact as long as four
+ * times the output fits into 32 bits, which is always the case for 8-bit images with less than
+ * 3640 input channels.
+ */
+
+/**
+ * @addtogroup Conv2dWinograd
+ * @{
+ */
+
+/**
+ * @brief Glue code for the Winograd 3x3 convolution of 8-bit integer images.
+ * @param[in]  pSrc         points to the input image, inChannels x srcRows x srcCols
+ * @param[in]  srcRows      number of rows of the input image
+ * @param[in]  srcCols      number of columns of the input image
+ * @param[in]  inChannels   number of input channels
+ * @param[in]  pU           points to the transformed weights, computed by
+ *                          plp_conv2d_winograd_weights_i8
+ * @param[in]  outChannels  number of output channels
+ * @param[in]  pTmpV        points to a buffer of 16 * inChannels * ((srcCols - 1) / 2) values
+ * @param[in]  pTmpM        points to a buffer of 16 * outChannels * ((srcCols - 1) / 2) values
+ * @param[out] pDst         output image returned here, outChannels x (srcRows - 2) x
+ *                          (srcCols - 2)
+ * @return     none
+ */
+
+void plp_conv2d_winograd_i8(const int8_t *__restrict__ pSrc,
+                            uint32_t srcRows,
+                            uint32_t srcCols,
+                            uint32_t inChannels,
+                            const int16_t *__restrict__ pU,
+                            uint32_t outChannels,
+                            int16_t *__restrict__ pTmpV,
+                            int32_t *__restrict__ pTmpM,
+                            int32_t *__restrict__ pDst) {
+
+    if (srcRows < 3 || srcCols < 3) {
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_conv2d_winograd_i8s_rv32im(
+            pSrc, srcRows, srcCols, inChannels, pU, outChannels, pTmpV, pTmpM, pDst);
+    } else {
+        plp_conv2d_winograd_i8s_xpulpv2(
+            pSrc, srcRows, srcCols, inChannels, pU, outChannels, pTmpV, pTmpM, pDst);
+    }
+}
+
+/**
+ * @} end of Conv2dWinograd group
+ */
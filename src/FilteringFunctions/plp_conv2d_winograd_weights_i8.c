@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_winograd_weights_i8.c
+ * Description:  Winograd weight transform of 8-bit integer kernels
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv2dWinograd
+ * @{
+ */
+
+/**
+ * @brief Transforms the 3x3 kernels of a 8-bit integer convolution layer for
+ * plp_conv2d_winograd_i8.
+ * @param[in]  pKernel      points to the kernels, outChannels x inChannels x 3 x 3
+ * @param[in]  inChannels   number of input channels
+ * @param[in]  outChannels  number of output channels
+ * @param[out] pU           transformed weights returned here, 16 x outChannels x inChannels
+ * @return     none
+ *
+ * @par The transform U = G g G^T of the flipped kernel g is computed with G = [2 0 0; 1 1 1;
+ * 1 -1 1; 0 0 2], which is twice the usual matrix of F(2x2,3x3), such that all weights are
+ * integers. The weights of element k of the 4x4 tile are stored as an outChannels x inChannels
+ * matrix at pU + k * outChannels * inChannels. The transform only depends on the kernels, and is
+ * computed once per layer.
+ */
+
+void plp_conv2d_winograd_weights_i8(const int8_t *__restrict__ pKernel,
+                                    uint32_t inChannels,
+                                    uint32_t outChannels,
+                                    int16_t *__restrict__ pU) {
+
+    uint32_t size = inChannels * outChannels; // weights per tile element
+    uint32_t n, r, c;
+
+    for (n = 0; n < size; n++) {
+        // the kernels of output channel co are stored as pKernel[co][ci], such that n = co *
+        // inChannels + ci addresses the same kernel in pKernel and in every matrix of pU
+        const int8_t *pK = pKernel + 9 * n;
+        int32_t tmp[4][3];
+
+        // tmp = G g, with g[r][c] = pK[8 - 3 * r - c]
+        for (c = 0; c < 3; c++) {
+            int32_t g0 = pK[8 - c];
+            int32_t g1 = pK[5 - c];
+            int32_t g2 = pK[2 - c];
+            tmp[0][c] = 2 * g0;
+            tmp[1][c] = g0 + g1 + g2;
+            tmp[2][c] = g0 - g1 + g2;
+            tmp[3][c] = 2 * g2;
+        }
+
+        // U = tmp G^T
+        for (r = 0; r < 4; r++) {
+            int16_t *pOut = pU + 4 * r * size + n;
+            pOut[0] = (int16_t)(2 * tmp[r][0]);
+            pOut[size] = (int16_t)(tmp[r][0] + tmp[r][1] + tmp[r][2]);
+            pOut[2 * size] = (int16_t)(tmp[r][0] - tmp[r][1] + tmp[r][2]);
+            pOut[3 * size] = (int16_t)(2 * tmp[r][2]);
+        }
+    }
+}
+
+/**
+ * @} end of Conv2dWinograd group
+ */
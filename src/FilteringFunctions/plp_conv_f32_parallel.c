@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_f32_parallel.c
+ * Description:  Parallel convolution of 32-bit floating-point vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BasicConvolution
+   @{
+*/
+
+/**
+   @brief Glue code for parallel convolution of 32-bit floating-point vectors.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[in]  nPE      Number of cores to compute on
+   @param[out] pRes     output result returned here, of size srcALen + srcBLen - 1
+   @return     none
+
+   @par The scratch buffer for the partial results is allocated with plp_scratch_alloc, see
+   plp_conv_f32_parallel_ws.
+*/
+
+void plp_conv_f32_parallel(const float32_t *pSrcA,
+                           const uint32_t srcALen,
+                           const float32_t *pSrcB,
+                           const uint32_t srcBLen,
+                           const uint8_t nPE,
+                           float32_t *pRes) {
+
+    PLP_PROFILE_SHAPE(srcALen, srcBLen, 0);
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+
+        uint32_t scratchSize = plp_conv_parallel_scratch_size(srcALen, srcBLen, nPE);
+        float32_t *pScratch = NULL;
+
+        if (scratchSize > 0) {
+            pScratch = (float32_t *)plp_scratch_alloc(sizeof(float32_t) * scratchSize);
+            if (pScratch == NULL) {
+                printf("Error: insufficient L1 memory!\n");
+                return;
+            }
+        }
+
+        plp_conv_f32_parallel_ws(pSrcA, srcALen, pSrcB, srcBLen, nPE, pScratch, pRes);
+
+        if (scratchSize > 0) {
+            plp_scratch_free(pScratch, sizeof(float32_t) * scratchSize);
+        }
+    }
+}
+
+/**
+   @} end of BasicConvolution group
+*/
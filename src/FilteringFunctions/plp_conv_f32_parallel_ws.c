@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_f32_parallel_ws.c
+ * Description:  Parallel convolution of 32-bit floating-point vectors with scratch buffer glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BasicConvolution
+   @{
+*/
+
+/**
+   @brief Glue code for parallel convolution of 32-bit floating-point vectors, using a
+   caller-provided scratch buffer for the partial results.
+   @param[in]  pSrcA     points to the first input vector
+   @param[in]  srcALen   Length of the first input vector
+   @param[in]  pSrcB     points to the second input vector
+   @param[in]  srcBLen   Length of the second input vector
+   @param[in]  nPE       Number of cores to compute on
+   @param[in]  pScratch  points to a scratch buffer of
+                         plp_conv_parallel_scratch_size(srcALen, srcBLen, nPE) elements,
+                         preferably in L1
+   @param[out] pRes      output result returned here, of size srcALen + srcBLen - 1
+   @return     none
+
+   @par The shorter vector is split into nPE chunks, which are convolved with the longer vector
+   into the scratch buffer, and overlap-added into pRes by the same team, as in
+   plp_conv_i32_parallel_ws.
+*/
+
+void plp_conv_f32_parallel_ws(const float32_t *pSrcA,
+                              const uint32_t srcALen,
+                              const float32_t *pSrcB,
+                              const uint32_t srcBLen,
+                              const uint8_t nPE,
+                              float32_t *pScratch,
+                              float32_t *pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+
+        if (nPE == 1) {
+            plp_conv_f32s_xpulpv2(pSrcA, srcALen, pSrcB, srcBLen, pRes);
+            return;
+        }
+
+        // the shorter vector is split among the cores
+        plp_conv_instance_f32 S = { .pSrcA = (srcALen <= srcBLen) ? pSrcA : pSrcB,
+                                    .srcALen = (srcALen <= srcBLen) ? srcALen : srcBLen,
+                                    .pSrcB = (srcALen <= srcBLen) ? pSrcB : pSrcA,
+                                    .srcBLen = (srcALen <= srcBLen) ? srcBLen : srcALen,
+                                    .nPE = nPE,
+                                    .pScratch = pScratch,
+                                    .pRes = pRes };
+
+        // convolution and overlap-add run in the same team
+        rt_team_fork(nPE, plp_conv_f32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+   @} end of BasicConvolution group
+*/
@@ -61,6 +61,8 @@ void plp_conv_i16(const int16_t *pSrcA,
     const int16_t *pIn1;
     const int16_t *pIn2;
 
+    PLP_PROFILE_SHAPE(srcALen, srcBLen, 0);
+
     if (srcALen >= srcBLen) {
         in1Len = srcALen;
         in2Len = srcBLen;
@@ -142,9 +144,10 @@ void plp_conv_i16(const int16_t *pSrcA,
             *pOut++ += *_pRes++;
         }
 
+        rt_free(RT_ALLOC_FC_DATA, _pRes1_16, sizeof(int32_t) * (resultsoffset));
     } else {
 
-        _pRes1_16 = rt_alloc(RT_ALLOC_CL_DATA, sizeof(int32_t) * (resultsoffset));
+        _pRes1_16 = plp_scratch_alloc(sizeof(int32_t) * (resultsoffset));
 
         int32_t *pOut = pRes;
         int32_t *_pRes = _pRes1_16;
@@ -198,8 +201,9 @@ void plp_conv_i16(const int16_t *pSrcA,
         if (k) {
             *pOut++ += *_pRes++;
         }
+
+        plp_scratch_free(_pRes1_16, sizeof(int32_t) * (resultsoffset));
     }
-    rt_free(RT_ALLOC_CL_DATA, _pRes1_16, sizeof(int32_t) * (resultsoffset));
 }
 
 /**
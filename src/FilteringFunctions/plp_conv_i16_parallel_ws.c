@@ -0,0 +1,109 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_i16_parallel_ws.c
+ * Description:  parallel 16-bit integer convolution glue code with caller-provided scratch
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BasicConvolution
+   @{
+*/
+
+/**
+   @brief Glue code for parallel convolution of 16-bit integer vectors, using a caller-provided scratch
+   buffer for the partial results.
+   @param[in]  pSrcA     points to the first input vector
+   @param[in]  srcALen   Length of the first input vector
+   @param[in]  pSrcB     points to the second input vector
+   @param[in]  srcBLen   Length of the second input vector
+   @param[in]  nPE       Number of cores to compute on
+   @param[in]  pScratch  points to a scratch buffer of
+                         plp_conv_parallel_scratch_size(srcALen, srcBLen, nPE) elements,
+                         preferably in L1
+   @param[out] pRes      output result returned here, of size srcALen + srcBLen - 1
+   @return     none
+
+   @par This function does not allocate any memory and does not use global state. Concurrent
+   calls are safe as long as they use different scratch buffers.
+*/
+
+void plp_conv_i16_parallel_ws(const int16_t *pSrcA,
+                              const uint32_t srcALen,
+                              const int16_t *pSrcB,
+                              const uint32_t srcBLen,
+                              const uint8_t nPE,
+                              int32_t *pScratch,
+                              int32_t *pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        if (nPE == 1) {
+            plp_conv_i16(pSrcA, srcALen, pSrcB, srcBLen, pRes);
+            return;
+        }
+
+        const int16_t *pIn1;
+        const int16_t *pIn2;
+
+        uint32_t pIn1Len;
+        uint32_t pIn2Len;
+
+        if (srcALen >= srcBLen) {
+            pIn2 = pSrcA;
+            pIn1 = pSrcB;
+            pIn2Len = srcALen;
+            pIn1Len = srcBLen;
+        } else {
+            pIn2 = pSrcB;
+            pIn1 = pSrcA;
+            pIn2Len = srcBLen;
+            pIn1Len = srcALen;
+        }
+
+        plp_conv_instance_i16 S = { .srcALen = pIn1Len,
+                                    .srcBLen = pIn2Len,
+                                    .pSrcA = pIn1,
+                                    .pSrcB = pIn2,
+                                    .pScratch = pScratch,
+                                    .pRes = pRes,
+                                    .nPE = nPE };
+
+        // convolution and overlap-add run in the same team
+        rt_team_fork(nPE, plp_conv_i16p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+   @} end of BasicConvolution group
+*/
@@ -69,6 +69,8 @@ void plp_conv_i32(const int32_t *pSrcA,
     const int32_t *pIn1;
     const int32_t *pIn2;
 
+    PLP_PROFILE_SHAPE(srcALen, srcBLen, 0);
+
     if (srcALen >= srcBLen) {
         in1Len = srcALen;
         in2Len = srcBLen;
@@ -150,9 +152,10 @@ void plp_conv_i32(const int32_t *pSrcA,
             *pOut++ += *_pRes++;
         }
 
+        rt_free(RT_ALLOC_FC_DATA, _pRes1_32, sizeof(int32_t) * (resultsoffset));
     } else {
 
-        _pRes1_32 = rt_alloc(RT_ALLOC_CL_DATA, sizeof(int32_t) * (resultsoffset));
+        _pRes1_32 = plp_scratch_alloc(sizeof(int32_t) * (resultsoffset));
 
         int32_t *pOut = pRes;
         int32_t *_pRes = _pRes1_32;
@@ -206,8 +209,9 @@ void plp_conv_i32(const int32_t *pSrcA,
         if (k) {
             *pOut++ += *_pRes++;
         }
+
+        plp_scratch_free(_pRes1_32, sizeof(int32_t) * (resultsoffset));
     }
-    rt_free(RT_ALLOC_CL_DATA, _pRes1_32, sizeof(int32_t) * (resultsoffset));
 }
 
 /**
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_parallel_scratch_size.c
+ * Description:  scratch size of the parallel integer convolution
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BasicConvolution
+   @{
+*/
+
+/**
+   @brief Size of the scratch buffer required by plp_conv_i{8,16,32}_parallel_ws and
+   plp_conv_f32_parallel_ws.
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[in]  nPE      Number of cores to compute on
+   @return     number of int32_t (or float32_t) elements of the scratch buffer, 0 if no buffer is
+               required
+
+   @par Every core computes the full convolution of the long vector with one chunk of the short
+   vector, and the partial results are stored next to each other in the scratch buffer.
+*/
+
+uint32_t plp_conv_parallel_scratch_size(uint32_t srcALen, uint32_t srcBLen, uint8_t nPE) {
+
+    uint32_t shortLen = (srcALen >= srcBLen) ? srcBLen : srcALen;
+    uint32_t longLen = (srcALen >= srcBLen) ? srcALen : srcBLen;
+
+    if (nPE <= 1) {
+        return 0;
+    }
+
+    return (((shortLen + nPE - 1) / nPE) + longLen - 1) * nPE;
+}
+
+/**
+   @} end of BasicConvolution group
+*/
@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_q32_parallel.c
+ * Description:  Glue code for the parallel convolution of 32-bit fixed-point vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BasicConvolution
+   @{
+*/
+
+/**
+  @brief Glue code for the parallel convolution of 32-bit fixed-point vectors, with the output
+         shifted and saturated to 32 bits.
+  @param[in]  pSrcA     points to the first input vector
+  @param[in]  srcALen   length of the first input vector
+  @param[in]  pSrcB     points to the second input vector
+  @param[in]  srcBLen   length of the second input vector
+  @param[in]  fracBits  number of fractional bits of the output, see plp_conv_q32
+  @param[in]  nPE       number of cores to use
+  @param[out] pRes      points to the srcALen+srcBLen-1 output samples
+  @return     none
+
+  @par The output samples are split among the cores, every core computes a contiguous chunk of
+  them. No scratch memory is needed, and the result is the same as with plp_conv_q32.
+ */
+
+void plp_conv_q32_parallel(const int32_t *__restrict__ pSrcA,
+                           uint32_t srcALen,
+                           const int32_t *__restrict__ pSrcB,
+                           uint32_t srcBLen,
+                           uint32_t fracBits,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pRes) {
+
+    PLP_PROFILE_SHAPE(srcALen, srcBLen, 0);
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_conv_instance_q32 args = { .pSrcA = pSrcA,
+                                       .srcALen = srcALen,
+                                       .pSrcB = pSrcB,
+                                       .srcBLen = srcBLen,
+                                       .fracBits = fracBits,
+                                       .nPE = nPE,
+                                       .pRes = pRes };
+
+        rt_team_fork(nPE, plp_conv_q32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of BasicConvolution group
+*/
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_q8.c
+ * Description:  Glue code for the convolution of 8-bit fixed-point vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BasicConvolution
+   @{
+*/
+
+/**
+  @brief Glue code for the convolution of 8-bit fixed-point vectors, with the output shifted and
+         saturated to 8 bits.
+  @param[in]  pSrcA     points to the first input vector
+  @param[in]  srcALen   length of the first input vector
+  @param[in]  pSrcB     points to the second input vector
+  @param[in]  srcBLen   length of the second input vector
+  @param[in]  fracBits  number of fractional bits of the output, see below
+  @param[out] pRes      points to the srcALen+srcBLen-1 output samples
+  @return     none
+
+  @par Fix-Point, Shifting and Saturation
+  The products are accumulated in 32 bits. Every output is shifted to the right by fracBits, with
+  rounding, and saturated to 8 bits. With Q1.7 inputs and fracBits = 7, the output is in
+  Q1.7.
+ */
+
+void plp_conv_q8(const int8_t *__restrict__ pSrcA,
+                 uint32_t srcALen,
+                 const int8_t *__restrict__ pSrcB,
+                 uint32_t srcBLen,
+                 uint32_t fracBits,
+                 int8_t *__restrict__ pRes) {
+
+    PLP_PROFILE_SHAPE(srcALen, srcBLen, 0);
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_conv_q8s_rv32im(pSrcA, srcALen, pSrcB, srcBLen, fracBits, pRes);
+    } else {
+        plp_conv_q8s_xpulpv2(pSrcA, srcALen, pSrcB, srcBLen, fracBits, pRes);
+    }
+}
+
+/**
+   @} end of BasicConvolution group
+*/
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_f32.c
+ * Description:  Convolution (valid) of 32-bit floating-point vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BasicConvolution
+   @{
+*/
+
+/**
+   @brief Glue code for convolution of 32-bit floating-point vectors in valid range.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[out] pRes     output result returned here, of size |srcALen - srcBLen| + 1
+   @return     none
+*/
+
+void plp_conv_valid_f32(const float32_t *pSrcA,
+                        const uint32_t srcALen,
+                        const float32_t *pSrcB,
+                        const uint32_t srcBLen,
+                        float32_t *pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        // longest vector first
+        if (srcALen >= srcBLen) {
+            plp_conv_valid_f32s_xpulpv2(pSrcA, srcALen, pSrcB, srcBLen, pRes);
+        } else {
+            plp_conv_valid_f32s_xpulpv2(pSrcB, srcBLen, pSrcA, srcALen, pRes);
+        }
+    }
+}
+
+/**
+   @} end of BasicConvolution group
+*/
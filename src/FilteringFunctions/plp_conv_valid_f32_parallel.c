@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_f32_parallel.c
+ * Description:  Parallel convolution (valid) of 32-bit floating-point vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BasicConvolution
+   @{
+*/
+
+/**
+   @brief Glue code for parallel convolution of 32-bit floating-point vectors in valid range.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[in]  nPE      Number of cores to compute on
+   @param[out] pRes     output result returned here, of size |srcALen - srcBLen| + 1
+   @return     none
+
+   @par Every core computes a contiguous range of the output directly into pRes. Unlike the full
+   convolution, the valid range needs no overlap-add of partial results.
+*/
+
+void plp_conv_valid_f32_parallel(const float32_t *pSrcA,
+                                 const uint32_t srcALen,
+                                 const float32_t *pSrcB,
+                                 const uint32_t srcBLen,
+                                 const uint8_t nPE,
+                                 float32_t *pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        // longest vector first
+        plp_conv_instance_f32 S = { .pSrcA = (srcALen >= srcBLen) ? pSrcA : pSrcB,
+                                    .srcALen = (srcALen >= srcBLen) ? srcALen : srcBLen,
+                                    .pSrcB = (srcALen >= srcBLen) ? pSrcB : pSrcA,
+                                    .srcBLen = (srcALen >= srcBLen) ? srcBLen : srcALen,
+                                    .nPE = nPE,
+                                    .pRes = pRes };
+
+        rt_team_fork(nPE, plp_conv_valid_f32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+   @} end of BasicConvolution group
+*/
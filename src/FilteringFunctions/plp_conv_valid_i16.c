@@ -73,7 +73,7 @@ void plp_conv_valid_i16(const int16_t *pSrcA,
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
 
-        printf("Errorr: Not Implemented!");
+        plp_conv_valid_i16s_rv32im(pIn1, in1Len, pIn2, in2Len, pRes);
 
     } else {
 
@@ -73,48 +73,36 @@ void plp_conv_valid_rep_i16(const int16_t *pSrcA,
     }
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
-
-        printf("Errorr: Not Implemented!");
-
+        plp_conv_valid_i16s_rv32im(pIn1, in1Len, pIn2, in2Len, pRes);
     } else {
 
-        /*
-         * because of data replication, the first copy starts at index 0, and must go up to index
-         * in1Len - 2, therefore, it is in1Len - 1 long. The last copy starts at index 1 and goes
-         * up to index in1Len - 1.
-         */
+        plp_conv_valid_rep_instance_i16 S;
 
-        // compute required memory size
-        uint32_t len_align = ((in1Len + 1) >> 1) << 1; // compute aligned memory size
-        uint32_t mem_size = len_align << 1;            // memory size for all 2 replications
+        uint32_t mem_size = PLP_CONV_VALID_REP_BUFFER_LEN_I16(in1Len);
 
-        int16_t *p_1_loc = rt_alloc(RT_ALLOC_CL_DATA, sizeof(int16_t) * mem_size);
-        int16_t *p_2_loc = rt_alloc(RT_ALLOC_CL_DATA, sizeof(int16_t) * in2Len);
+        int16_t *p_1_loc = plp_scratch_alloc(sizeof(int16_t) * mem_size);
+        int16_t *p_2_loc = plp_scratch_alloc(sizeof(int16_t) * in2Len);
 
         if (p_1_loc == NULL || p_2_loc == NULL) {
             printf("Error: insufficient L1 memory!\n");
+            plp_scratch_free(p_1_loc, sizeof(int16_t) * mem_size);
+            plp_scratch_free(p_2_loc, sizeof(int16_t) * in2Len);
             return;
         }
 
-        // copy the data over to the L1 data, replicated 4 times
+        // copy the short vector to L1 while the long vector is replicated
         rt_dma_copy_t copy;
-        int merge = 0;
-
-        for (int i = 0; i < 2; i++) {
-            rt_dma_memcpy((unsigned int)(pIn1 + i), (unsigned int)(p_1_loc + i * len_align),
-                          sizeof(int16_t) * (in1Len - i), RT_DMA_DIR_EXT2LOC, merge, &copy);
-            merge = 1;
-        }
-
         rt_dma_memcpy((unsigned int)pIn2, (unsigned int)p_2_loc, sizeof(int16_t) * in2Len,
-                      RT_DMA_DIR_EXT2LOC, merge, &copy);
+                      RT_DMA_DIR_EXT2LOC, 0, &copy);
+
+        plp_conv_valid_rep_init_i16(&S, pIn1, in1Len, p_1_loc);
 
         rt_dma_wait(&copy);
 
-        plp_conv_valid_rep_i16s_xpulpv2(p_1_loc, in1Len, len_align, p_2_loc, in2Len, pRes);
+        plp_conv_valid_rep_inst_i16(&S, p_2_loc, in2Len, pRes);
 
-        rt_free(RT_ALLOC_CL_DATA, p_1_loc, sizeof(int16_t) * mem_size);
-        rt_free(RT_ALLOC_CL_DATA, p_2_loc, sizeof(int16_t) * in2Len);
+        plp_scratch_free(p_1_loc, sizeof(int16_t) * mem_size);
+        plp_scratch_free(p_2_loc, sizeof(int16_t) * in2Len);
     }
 }
 
@@ -0,0 +1,112 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_rep_i16_parallel.c
+ * Description:  parallel 16-bit integer convolution (valid with replication) glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BasicConvolution
+ * @{
+ */
+
+/**
+ * @brief Glue code for parallel convolution of 16-bit integer vectors in valid range, using data
+ * replication.
+ * @param[in]  pSrcA   points to the first input vector, must be on L2
+ * @param[in]  srcALen Length of the first input vector
+ * @param[in]  pSrcB   points to the second input vector, must be on L2
+ * @param[in]  srcBLen Length of the second input vector
+ * @param[in]  nPE     Number of cores to compute on
+ * @param[out] pRes    output result returned here, of size |srcALen - srcBLen| + 1, preferably in
+ * L1
+ * @return     none
+ */
+void plp_conv_valid_rep_i16_parallel(const int16_t *pSrcA,
+                                     const uint32_t srcALen,
+                                     const int16_t *pSrcB,
+                                     const uint32_t srcBLen,
+                                     const uint8_t nPE,
+                                     int32_t *pRes) {
+
+    uint32_t in1Len, in2Len;
+    const int16_t *pIn1;
+    const int16_t *pIn2;
+
+    if (srcALen >= srcBLen) {
+        in1Len = srcALen;
+        in2Len = srcBLen;
+        pIn1 = pSrcA;
+        pIn2 = pSrcB;
+    } else {
+        in2Len = srcALen;
+        in1Len = srcBLen;
+        pIn2 = pSrcA;
+        pIn1 = pSrcB;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        plp_conv_valid_rep_instance_i16 S;
+
+        uint32_t mem_size = PLP_CONV_VALID_REP_BUFFER_LEN_I16(in1Len);
+
+        int16_t *p_1_loc = plp_scratch_alloc(sizeof(int16_t) * mem_size);
+        int16_t *p_2_loc = plp_scratch_alloc(sizeof(int16_t) * in2Len);
+
+        if (p_1_loc == NULL || p_2_loc == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            plp_scratch_free(p_1_loc, sizeof(int16_t) * mem_size);
+            plp_scratch_free(p_2_loc, sizeof(int16_t) * in2Len);
+            return;
+        }
+
+        // copy the short vector to L1 while the long vector is replicated
+        rt_dma_copy_t copy;
+        rt_dma_memcpy((unsigned int)pIn2, (unsigned int)p_2_loc, sizeof(int16_t) * in2Len,
+                      RT_DMA_DIR_EXT2LOC, 0, &copy);
+
+        plp_conv_valid_rep_init_i16(&S, pIn1, in1Len, p_1_loc);
+
+        rt_dma_wait(&copy);
+
+        plp_conv_valid_rep_inst_i16_parallel(&S, p_2_loc, in2Len, nPE, pRes);
+
+        plp_scratch_free(p_1_loc, sizeof(int16_t) * mem_size);
+        plp_scratch_free(p_2_loc, sizeof(int16_t) * in2Len);
+    }
+}
+
+/**
+ * @} end of BasicConvolution group
+ */
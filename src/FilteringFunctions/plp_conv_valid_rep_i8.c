@@ -73,48 +73,36 @@ void plp_conv_valid_rep_i8(const int8_t *pSrcA,
     }
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
-
-        printf("Errorr: Not Implemented!");
-
+        plp_conv_valid_i8s_rv32im(pIn1, in1Len, pIn2, in2Len, pRes);
     } else {
 
-        /*
-         * because of data replication, the first copy starts at index 0, and must go up to index
-         * in1Len - 4, therefore, it is in1Len - 3 long. The last copy starts at index 3 and goes
-         * up to index in1Len - 1.
-         */
+        plp_conv_valid_rep_instance_i8 S;
 
-        // compute required memory size
-        uint32_t len_align = ((in1Len + 3) >> 2) << 2; // compute aligned memory size
-        uint32_t mem_size = len_align << 2;            // memory size for all 4 replications
+        uint32_t mem_size = PLP_CONV_VALID_REP_BUFFER_LEN_I8(in1Len);
 
-        int8_t *p_1_loc = rt_alloc(RT_ALLOC_CL_DATA, sizeof(int8_t) * mem_size);
-        int8_t *p_2_loc = rt_alloc(RT_ALLOC_CL_DATA, sizeof(int8_t) * in2Len);
+        int8_t *p_1_loc = plp_scratch_alloc(sizeof(int8_t) * mem_size);
+        int8_t *p_2_loc = plp_scratch_alloc(sizeof(int8_t) * in2Len);
 
         if (p_1_loc == NULL || p_2_loc == NULL) {
             printf("Error: insufficient L1 memory!\n");
+            plp_scratch_free(p_1_loc, sizeof(int8_t) * mem_size);
+            plp_scratch_free(p_2_loc, sizeof(int8_t) * in2Len);
             return;
         }
 
-        // copy the data over to the L1 data, replicated 4 times
+        // copy the short vector to L1 while the long vector is replicated
         rt_dma_copy_t copy;
-        int merge = 0;
-
-        for (int i = 0; i < 4; i++) {
-            rt_dma_memcpy((unsigned int)(pIn1 + i), (unsigned int)(p_1_loc + i * len_align),
-                          sizeof(int8_t) * (in1Len - i), RT_DMA_DIR_EXT2LOC, merge, &copy);
-            merge = 1;
-        }
-
         rt_dma_memcpy((unsigned int)pIn2, (unsigned int)p_2_loc, sizeof(int8_t) * in2Len,
-                      RT_DMA_DIR_EXT2LOC, merge, &copy);
+                      RT_DMA_DIR_EXT2LOC, 0, &copy);
+
+        plp_conv_valid_rep_init_i8(&S, pIn1, in1Len, p_1_loc);
 
         rt_dma_wait(&copy);
 
-        plp_conv_valid_rep_i8s_xpulpv2(p_1_loc, in1Len, len_align, p_2_loc, in2Len, pRes);
+        plp_conv_valid_rep_inst_i8(&S, p_2_loc, in2Len, pRes);
 
-        rt_free(RT_ALLOC_CL_DATA, p_1_loc, sizeof(int8_t) * mem_size);
-        rt_free(RT_ALLOC_CL_DATA, p_2_loc, sizeof(int8_t) * in2Len);
+        plp_scratch_free(p_1_loc, sizeof(int8_t) * mem_size);
+        plp_scratch_free(p_2_loc, sizeof(int8_t) * in2Len);
     }
 }
 
@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_rep_init_i16.c
+ * Description:  16-bit integer convolution (valid with replication) initialization
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BasicConvolution
+ * @{
+ */
+
+/**
+ * @brief Initializes an instance of the 16-bit integer convolution (valid) with data
+ * replication, by replicating the long input vector 2 times into a caller-owned buffer.
+ * @param[out] S       points to the instance
+ * @param[in]  pSrcA   points to the long input vector, must be on L2 when called on the cluster
+ * @param[in]  srcALen Length of the long input vector
+ * @param[out] pBuffer points to a buffer of PLP_CONV_VALID_REP_BUFFER_LEN_I16(srcALen) elements,
+ *                     preferably in L1
+ * @return     none
+ *
+ * @par The buffer must stay valid and unmodified as long as S is used. Since the replication is
+ * done only once, S can be used for many calls of plp_conv_valid_rep_inst_i16 without any
+ * allocation or DMA transfer.
+ */
+void plp_conv_valid_rep_init_i16(plp_conv_valid_rep_instance_i16 *S,
+                                 const int16_t *pSrcA,
+                                 uint32_t srcALen,
+                                 int16_t *pBuffer) {
+
+    // every replication starts at a word aligned address
+    uint32_t len_align = ((srcALen + 1) >> 1) << 1;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+
+        for (uint32_t i = 0; i < 2; i++) {
+            for (uint32_t j = 0; j < srcALen - i; j++) {
+                pBuffer[i * len_align + j] = pSrcA[i + j];
+            }
+        }
+
+    } else {
+
+        rt_dma_copy_t copy;
+        int merge = 0;
+
+        for (int i = 0; i < 2; i++) {
+            rt_dma_memcpy((unsigned int)(pSrcA + i), (unsigned int)(pBuffer + i * len_align),
+                          sizeof(int16_t) * (srcALen - i), RT_DMA_DIR_EXT2LOC, merge, &copy);
+            merge = 1;
+        }
+
+        rt_dma_wait(&copy);
+    }
+
+    S->pSrcA = pBuffer;
+    S->srcALen = srcALen;
+    S->srcAMem = len_align;
+}
+
+/**
+ * @} end of BasicConvolution group
+ */
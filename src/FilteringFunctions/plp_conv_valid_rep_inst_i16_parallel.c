@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_rep_inst_i16_parallel.c
+ * Description:  parallel 16-bit integer convolution (valid with replication) glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BasicConvolution
+ * @{
+ */
+
+/**
+ * @brief Glue code for parallel convolution of 16-bit integer vectors in valid range,
+ * using the replicated vector of an instance.
+ * @param[in]  S       points to the instance, initialized by plp_conv_valid_rep_init_i16
+ * @param[in]  pSrcB   points to the short input vector, preferably in L1
+ * @param[in]  srcBLen Length of the short input vector, at most S->srcALen
+ * @param[in]  nPE     Number of cores to compute on
+ * @param[out] pRes    output result returned here, of size S->srcALen - srcBLen + 1
+ * @return     none
+ */
+void plp_conv_valid_rep_inst_i16_parallel(const plp_conv_valid_rep_instance_i16 *S,
+                                          const int16_t *pSrcB,
+                                          const uint32_t srcBLen,
+                                          const uint8_t nPE,
+                                          int32_t *pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_conv_valid_rep_instance_i16_parallel args = { .S = S,
+                                                          .pSrcB = pSrcB,
+                                                          .srcBLen = srcBLen,
+                                                          .nPE = nPE,
+                                                          .pRes = pRes };
+
+        rt_team_fork(nPE, plp_conv_valid_rep_i16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+ * @} end of BasicConvolution group
+ */
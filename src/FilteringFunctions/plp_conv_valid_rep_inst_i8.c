@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_valid_rep_inst_i8.c
+ * Description:  8-bit integer convolution (valid with replication) glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BasicConvolution
+ * @{
+ */
+
+/**
+ * @brief Glue code for convolution of 8-bit integer vectors in valid range,
+ * using the replicated vector of an instance.
+ * @param[in]  S       points to the instance, initialized by plp_conv_valid_rep_init_i8
+ * @param[in]  pSrcB   points to the short input vector, preferably in L1
+ * @param[in]  srcBLen Length of the short input vector, at most S->srcALen
+ * @param[out] pRes    output result returned here, of size S->srcALen - srcBLen + 1
+ * @return     none
+ */
+void plp_conv_valid_rep_inst_i8(const plp_conv_valid_rep_instance_i8 *S,
+                                const int8_t *pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        // the first replication is the unmodified input vector
+        plp_conv_valid_i8s_rv32im(S->pSrcA, S->srcALen, pSrcB, srcBLen, pRes);
+    } else {
+        plp_conv_valid_rep_i8s_xpulpv2(S->pSrcA, S->srcALen, S->srcAMem, pSrcB, srcBLen, pRes);
+    }
+}
+
+/**
+ * @} end of BasicConvolution group
+ */
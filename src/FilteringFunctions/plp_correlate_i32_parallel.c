@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_correlate_i32_parallel.c
+ * Description:  parallel 32-bit integer correlation glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BasicCorrelation
+   @{
+*/
+
+/**
+   @brief Glue code for parallel correlation of 32-bit integer vectors.
+   @param[in]  pSrcA    points to the first input vector
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector
+   @param[in]  srcBLen  Length of the second input vector
+   @param[in]  nPE      Number of cores to compute on
+   @param[out] pRes     output result returned here, of size srcALen + srcBLen - 1
+   @return     none
+
+   @par The output lags are split into contiguous ranges, one per core. Since every output is
+   computed by exactly one core, no merge step is required.
+*/
+
+void plp_correlate_i32_parallel(const int32_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *pSrcB,
+                                const uint32_t srcBLen,
+                                const uint8_t nPE,
+                                int32_t *pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_conv_instance_i32 S = { .pSrcA = pSrcA,
+                                    .srcALen = srcALen,
+                                    .pSrcB = pSrcB,
+                                    .srcBLen = srcBLen,
+                                    .nPE = nPE,
+                                    .pRes = pRes };
+
+        rt_team_fork(nPE, plp_correlate_i32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+   @} end of BasicCorrelation group
+*/
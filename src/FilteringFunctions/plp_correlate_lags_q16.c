@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_correlate_lags_q16.c
+ * Description:  Glue code for a window of correlation lags of 16-bit fixed-point vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BasicCorrelation
+   @{
+*/
+
+/**
+  @brief Glue code for a window of correlation lags of 16-bit fixed-point vectors.
+  @param[in]  pSrcA     points to the first input vector
+  @param[in]  srcALen   length of the first input vector
+  @param[in]  pSrcB     points to the second input vector
+  @param[in]  srcBLen   length of the second input vector
+  @param[in]  minLag    smallest lag to compute, may be negative
+  @param[in]  maxLag    largest lag to compute, at least minLag
+  @param[in]  fracBits  number of fractional bits removed, see below
+  @param[out] pDst      points to the maxLag-minLag+1 output values, starting with minLag
+  @return     none
+
+  @par Fix-Point, Shifting and Saturation
+  The products of the input samples are summed up without loss of precision, and the sums are
+  shifted to the right by fracBits, with rounding, and saturated to 32 bits.
+
+  @par Correlation Lags
+  The lag l of the correlation is
+  \f[
+      r[l] = \sum_{n} pSrcA[n + l] \cdot pSrcB[n],
+  \f]
+  which is the output srcBLen - 1 + l of plp_correlate. Both inputs are real, so the negative lags
+  of the correlation of A and B are the positive lags of the correlation of B and A. Only the
+  window minLag <= l <= maxLag is computed, with a cost proportional to the input length times the
+  window length instead of the product of the input lengths.
+ */
+
+void plp_correlate_lags_q16(const int16_t *__restrict__ pSrcA,
+                            uint32_t srcALen,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t srcBLen,
+                            int32_t minLag,
+                            int32_t maxLag,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_correlate_lags_q16s_rv32im(pSrcA, srcALen, pSrcB, srcBLen, minLag, maxLag, fracBits,
+                                       pDst);
+    } else {
+        plp_correlate_lags_q16s_xpulpv2(pSrcA, srcALen, pSrcB, srcBLen, minLag, maxLag, fracBits,
+                                        pDst);
+    }
+}
+
+/**
+   @} end of BasicCorrelation group
+*/
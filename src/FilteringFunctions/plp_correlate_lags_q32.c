@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_correlate_lags_q32.c
+ * Description:  Glue code for a window of correlation lags of 32-bit fixed-point vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BasicCorrelation
+   @{
+*/
+
+/**
+  @brief Glue code for a window of correlation lags of 32-bit fixed-point vectors.
+  @param[in]  pSrcA     points to the first input vector
+  @param[in]  srcALen   length of the first input vector
+  @param[in]  pSrcB     points to the second input vector
+  @param[in]  srcBLen   length of the second input vector
+  @param[in]  minLag    smallest lag to compute, may be negative
+  @param[in]  maxLag    largest lag to compute, at least minLag
+  @param[in]  fracBits  number of fractional bits removed, see below
+  @param[out] pDst      points to the maxLag-minLag+1 output values, starting with minLag
+  @return     none
+
+  @par Fix-Point, Shifting and Saturation
+  Every product of two input samples is shifted to the right by fracBits, and the products are
+  summed up in 64 bits and saturated to 32 bits.
+
+  @par The lags are defined as in plp_correlate_lags_q16.
+ */
+
+void plp_correlate_lags_q32(const int32_t *__restrict__ pSrcA,
+                            uint32_t srcALen,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t srcBLen,
+                            int32_t minLag,
+                            int32_t maxLag,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_correlate_lags_q32s_rv32im(pSrcA, srcALen, pSrcB, srcBLen, minLag, maxLag, fracBits,
+                                       pDst);
+    } else {
+        plp_correlate_lags_q32s_xpulpv2(pSrcA, srcALen, pSrcB, srcBLen, minLag, maxLag, fracBits,
+                                        pDst);
+    }
+}
+
+/**
+   @} end of BasicCorrelation group
+*/
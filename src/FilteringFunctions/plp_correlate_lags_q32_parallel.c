@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_correlate_lags_q32_parallel.c
+ * Description:  Glue code for parallel correlation lags of 32-bit fixed-point vectors
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BasicCorrelation
+   @{
+*/
+
+/**
+  @brief Glue code for a parallel window of correlation lags of 32-bit fixed-point vectors.
+  @param[in]  pSrcA     points to the first input vector
+  @param[in]  srcALen   length of the first input vector
+  @param[in]  pSrcB     points to the second input vector
+  @param[in]  srcBLen   length of the second input vector
+  @param[in]  minLag    smallest lag to compute, may be negative
+  @param[in]  maxLag    largest lag to compute, at least minLag
+  @param[in]  fracBits  number of fractional bits removed, see plp_correlate_lags_q32
+  @param[in]  nPE       number of cores to use
+  @param[out] pDst      points to the maxLag-minLag+1 output values, starting with minLag
+  @return     none
+
+  @par The lags are split into contiguous ranges, one per core. Every lag is computed by exactly
+  one core, such that the result is the same as with plp_correlate_lags_q32.
+ */
+
+void plp_correlate_lags_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                     uint32_t srcALen,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t srcBLen,
+                                     int32_t minLag,
+                                     int32_t maxLag,
+                                     uint32_t fracBits,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_correlate_lags_instance_q32 args = { .pSrcA = pSrcA,
+                                                 .srcALen = srcALen,
+                                                 .pSrcB = pSrcB,
+                                                 .srcBLen = srcBLen,
+                                                 .minLag = minLag,
+                                                 .maxLag = maxLag,
+                                                 .fracBits = fracBits,
+                                                 .nPE = nPE,
+                                                 .pDst = pDst };
+
+        rt_team_fork(nPE, plp_correlate_lags_q32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of BasicCorrelation group
+*/
@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_drc_f32.c
+ * Description:  Glue code for the 32-bit floating-point dynamic range compressor
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Drc
+  @{
+ */
+
+/**
+  @brief Glue code for the dynamic range compressor of a 32-bit floating-point block.
+  @param[in,out] S          points to the instance, initialized by plp_drc_init_f32
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     blockSize  number of input and output samples
+  @param[out]    pDst       points to the block of output samples, which may be pSrc
+  @return        none
+ */
+
+void plp_drc_f32(plp_drc_instance_f32 *S,
+                 const float32_t *pSrc,
+                 uint32_t blockSize,
+                 float32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_drc_f32s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of Drc group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_drc_init_f32.c
+ * Description:  Initialization of the 32-bit floating-point dynamic range compressor
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Drc
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 32-bit floating-point dynamic range compressor.
+  @param[out] S          points to the instance of the 32-bit floating-point DRC
+  @param[in]  threshold  level above which the compression starts, positive
+  @param[in]  slope      compression slope 1-1/ratio, 1 for a limiter
+  @param[in]  makeup     makeup gain
+  @param[in]  attack     envelope smoothing factor in [0, 1] for a rising peak, 1 follows the
+                         peak immediately
+  @param[in]  release    envelope smoothing factor in [0, 1] for a falling peak
+  @return     none
+
+  @par The envelope is cleared, and the gain starts at the makeup gain.
+ */
+
+void plp_drc_init_f32(plp_drc_instance_f32 *S,
+                      float32_t threshold,
+                      float32_t slope,
+                      float32_t makeup,
+                      float32_t attack,
+                      float32_t release) {
+
+    S->threshold = threshold;
+    S->slope = slope;
+    S->makeup = makeup;
+    S->attack = attack;
+    S->release = release;
+    S->env = 0.0f;
+    S->gain = makeup;
+}
+
+/**
+  @} end of Drc group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_drc_init_q16.c
+ * Description:  Initialization of the 16-bit fixed-point dynamic range compressor
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Drc
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 16-bit fixed-point dynamic range compressor.
+  @param[out] S          points to the instance of the 16-bit fixed-point DRC
+  @param[in]  threshold  level in Q1.15 above which the compression starts, positive
+  @param[in]  slope      compression slope 1-1/ratio in Q1.15, 0x7FFF for a limiter
+  @param[in]  makeup     makeup gain in Q8.8, not negative
+  @param[in]  attack     envelope smoothing factor in Q1.15 for a rising peak, 0x7FFF follows the
+                         peak immediately
+  @param[in]  release    envelope smoothing factor in Q1.15 for a falling peak
+  @return     none
+
+  @par The envelope is cleared, and the gain starts at the makeup gain.
+ */
+
+void plp_drc_init_q16(plp_drc_instance_q16 *S,
+                      int16_t threshold,
+                      int16_t slope,
+                      int16_t makeup,
+                      int16_t attack,
+                      int16_t release) {
+
+    S->threshold = threshold;
+    S->slope = slope;
+    S->makeup = makeup;
+    S->attack = attack;
+    S->release = release;
+    S->env = 0;
+    S->gain = makeup;
+}
+
+/**
+  @} end of Drc group
+ */
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_drc_q16.c
+ * Description:  Glue code for the 16-bit fixed-point dynamic range compressor
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup Drc Dynamic Range Compressor
+  Block-wise dynamic range compressor and limiter. For every block, the peak |x| of the block is
+  smoothed into the envelope
+
+  <pre>
+      env += coef * (peak - env)
+  </pre>
+
+  with the attack factor if the peak is larger than the envelope and the release factor
+  otherwise. Above the threshold, the level is compressed by the ratio, i.e. the new gain is
+
+  <pre>
+      gain = makeup * (threshold / env)^slope,   slope = 1 - 1/ratio
+  </pre>
+
+  and the makeup gain otherwise. A slope of 1 gives a limiter, which keeps the envelope at the
+  threshold. The gain is interpolated linearly from the gain of the previous block to the new gain
+  over the samples of the block, such that the last sample uses the new gain, which avoids steps
+  at the block borders. The envelope and the gain are kept in the instance, hence consecutive
+  blocks of a stream are processed with consecutive calls.
+
+  The gain is computed once per block. The 16-bit fixed-point version computes it with the
+  polynomials of plp_log_vec_q16 and plp_exp_vec_q16, finds the block peak with pv.max and pv.min,
+  and multiplies every sample with its Q8.8 gain, rounding towards minus infinity and saturating
+  the result.
+
+  The parallel versions process multiple independent channels, assigning one channel after the
+  other to each core.
+ */
+
+/**
+  @addtogroup Drc
+  @{
+ */
+
+/**
+  @brief Glue code for the dynamic range compressor of a 16-bit fixed-point block.
+  @param[in,out] S          points to the instance, initialized by plp_drc_init_q16
+  @param[in]     pSrc       points to the block of input samples in Q1.15
+  @param[in]     blockSize  number of input and output samples
+  @param[out]    pDst       points to the block of output samples in Q1.15, which may be pSrc
+  @return        none
+ */
+
+void plp_drc_q16(plp_drc_instance_q16 *S,
+                 const int16_t *pSrc,
+                 uint32_t blockSize,
+                 int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_drc_q16s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_drc_q16s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of Drc group
+ */
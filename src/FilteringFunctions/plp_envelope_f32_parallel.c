@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_envelope_f32_parallel.c
+ * Description:  Glue code for parallel envelope detection of a 32-bit floating-point block
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Envelope
+  @{
+ */
+
+/**
+  @brief Glue code for parallel envelope detection of a 32-bit floating-point block.
+  @param[in]  S          points to the instance, initialized by plp_hilbert_fir_init_f32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, at most the block size of the instance
+  @param[in]  nPE        number of cores to use
+  @param[out] pDst       points to the blockSize envelope samples
+  @return     none
+ */
+
+void plp_envelope_f32_parallel(const plp_hilbert_fir_instance_f32 *S,
+                               const float32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_hilbert_fir_instance_f32_parallel args = {
+            .S = S, .pSrc = pSrc, .blockSize = blockSize, .nPE = nPE, .pDst = pDst
+        };
+
+        rt_team_fork(nPE, plp_envelope_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of Envelope group
+ */
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_envelope_q16.c
+ * Description:  Glue code for envelope detection of a 16-bit fixed-point block
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup Envelope Envelope Detection
+  Envelope of a signal as the magnitude of its analytic signal, computed with a Hilbert
+  transformer instance (see @ref HilbertFIR):
+
+  <pre>
+      e[n] = sqrt(x[n-K]^2 + y[n]^2)
+  </pre>
+
+  where y is the output of the Hilbert transformer and K = (numTaps-1)/2 its delay. The analytic
+  signal is computed in chunks of PLP_ENVELOPE_BUFFER_LEN samples on the stack and passed directly
+  to the complex magnitude kernels, such that no intermediate buffer and no FFT is needed. The
+  16-bit fixed-point version uses the fast approximate magnitude (see @ref cmplx_mag_fast). The
+  parallel versions split the samples of a block across cores.
+ */
+
+/**
+  @addtogroup Envelope
+  @{
+ */
+
+/**
+  @brief Glue code for envelope detection of a 16-bit fixed-point block.
+  @param[in]  S          points to the instance, initialized by plp_hilbert_fir_init_q16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, at most the block size of the instance
+  @param[out] pDst       points to the blockSize envelope samples
+  @return     none
+
+  @par Fix-Point, Shifting and Saturation
+  The output of the Hilbert transformer is computed as in plp_hilbert_fir_q16, and has the same
+  format as the input. The magnitude is approximated with an error below 4 %.
+ */
+
+void plp_envelope_q16(const plp_hilbert_fir_instance_q16 *S,
+                      const int16_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_envelope_q16s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_envelope_q16s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of Envelope group
+ */
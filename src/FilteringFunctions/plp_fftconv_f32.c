@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fftconv_f32.c
+ * Description:  32-bit floating-point FFT convolution glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FFTConvolution FFT Convolution
+  Streaming convolution of a long input signal with a fixed filter, computed block by block in the
+  frequency domain (overlap-save). For a filter of filterLen coefficients, one output sample costs
+  about O(log(fftLen)) instead of O(filterLen) operations of the direct convolution plp_conv. The
+  functions keep the past input samples in the instance, such that consecutive calls filter a
+  continuous stream:
+
+  <pre>
+      pDst[n] = sum_{k=0}^{filterLen-1} pFilter[k] * x[n - k]
+  </pre>
+
+  where x is the concatenation of all inputs since the initialization (with x[n] = 0 for n < 0).
+ */
+
+/**
+  @addtogroup FFTConvolution
+  @{
+ */
+
+/**
+  @brief Glue code for FFT convolution of a 32-bit floating-point stream.
+  @param[in,out] S           points to the instance, initialized by plp_fftconv_init_f32. The
+                             state is updated.
+  @param[in]     pSrc        points to the next numSamples input samples
+  @param[in]     numSamples  number of input and output samples
+  @param[out]    pDst        points to the output buffer of numSamples samples, which must not
+                             overlap with pSrc
+  @return        none
+
+  @par Overlap-Save
+  The input is processed in blocks of S->blockLen = fftLen - filterLen + 1 new samples. Every block
+  is extended by the filterLen - 1 preceding samples, transformed with plp_rfft_f32, multiplied by
+  the spectrum of the filter and transformed back with plp_rifft_f32. The first filterLen - 1
+  samples of the result contain the circular wrap-around and are discarded. The last
+  filterLen - 1 input samples are kept in S->pState, such that a stream can be filtered in
+  chunks of arbitrary numSamples.
+ */
+
+void plp_fftconv_f32(plp_fftconv_instance_f32 *S,
+                     const float32_t *__restrict__ pSrc,
+                     uint32_t numSamples,
+                     float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_fftconv_f32s_xpulpv2(S, pSrc, numSamples, pDst);
+    }
+}
+
+/**
+  @} end of FFTConvolution group
+ */
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fftconv_f32_parallel.c
+ * Description:  parallel 32-bit floating-point FFT convolution glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FFTConvolution
+  @{
+ */
+
+/**
+  @brief Glue code for parallel FFT convolution of a 32-bit floating-point stream.
+  @param[in,out] S           points to the instance, initialized by plp_fftconv_init_f32. The
+                             state is updated.
+  @param[in]     pSrc        points to the next numSamples input samples
+  @param[in]     numSamples  number of input and output samples
+  @param[in]     nPE         number of cores to use
+  @param[out]    pDst        points to the output buffer of numSamples samples, which must not
+                             overlap with pSrc
+  @return        none
+
+  @par Overlap-Save
+  The input is processed in blocks of S->blockLen = fftLen - filterLen + 1 new samples. Every block
+  is extended by the filterLen - 1 preceding samples, transformed with plp_rfft_f32, multiplied by
+  the spectrum of the filter and transformed back with plp_rifft_f32. The first filterLen - 1
+  samples of the result contain the circular wrap-around and are discarded. The last
+  filterLen - 1 input samples are kept in S->pState, such that a stream can be filtered in
+  chunks of arbitrary numSamples.
+ */
+
+void plp_fftconv_f32_parallel(plp_fftconv_instance_f32 *S,
+                              const float32_t *__restrict__ pSrc,
+                              uint32_t numSamples,
+                              uint32_t nPE,
+                              float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_fftconv_instance_f32_parallel args = {
+            .S = S, .pSrc = pSrc, .numSamples = numSamples, .nPE = nPE, .pDst = pDst
+        };
+
+        rt_team_fork(nPE, plp_fftconv_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of FFTConvolution group
+ */
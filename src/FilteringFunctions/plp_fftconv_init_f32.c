@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fftconv_init_f32.c
+ * Description:  32-bit floating-point FFT convolution instance initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+ */
+
+/**
+   @addtogroup FFTConvolution
+   @{
+ */
+
+/**
+   @brief Initializes an instance of the floating-point FFT convolution.
+   @param[out] S                points to the instance of the floating-point FFT convolution
+   @param[in]  pFft             points to the real FFT instance of length fftLen, with
+                                bitReverseFlag=1, for example created by plp_cfft_init_f32
+   @param[in]  pFilter          points to the filter coefficients
+   @param[in]  filterLen        number of filter coefficients, at most fftLen
+   @param[out] pFilterSpectrum  points to a buffer of 2*fftLen values for the spectrum of the
+                                filter
+   @param[out] pState           points to a buffer of filterLen-1 values for the past input samples
+   @param[in]  pBuffer          points to a work buffer of 3*fftLen values
+   @return     0: Success, 1: filterLen is not supported
+
+   @par Every call of plp_fftconv_f32 processes the input in blocks of fftLen-filterLen+1 samples,
+   so fftLen should be about two to four times filterLen. The state is cleared, and all buffers
+   must stay valid as long as S is used. This function must be called on the cluster side.
+ */
+
+int plp_fftconv_init_f32(plp_fftconv_instance_f32 *S,
+                         const plp_rfft_instance_f32 *pFft,
+                         const float32_t *__restrict__ pFilter,
+                         uint32_t filterLen,
+                         float32_t *__restrict__ pFilterSpectrum,
+                         float32_t *__restrict__ pState,
+                         float32_t *__restrict__ pBuffer) {
+
+    uint32_t i;
+    uint32_t N = pFft->FFTLength;
+
+    if (filterLen == 0 || filterLen > N) {
+        return 1;
+    }
+
+    // spectrum of the zero padded filter
+    for (i = 0; i < N; i++) {
+        pBuffer[i] = (i < filterLen) ? pFilter[i] : 0.0f;
+    }
+    plp_rfft_f32(pFft, pBuffer, pFilterSpectrum);
+
+    for (i = 0; i < filterLen - 1; i++) {
+        pState[i] = 0.0f;
+    }
+
+    S->S = pFft;
+    S->filterLen = filterLen;
+    S->blockLen = N - filterLen + 1;
+    S->pFilterSpectrum = pFilterSpectrum;
+    S->pState = pState;
+    S->pBuffer = pBuffer;
+
+    return 0;
+}
+
+/**
+   @} end of FFTConvolution group
+ */
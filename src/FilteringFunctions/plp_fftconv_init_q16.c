@@ -0,0 +1,123 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fftconv_init_q16.c
+ * Description:  16-bit fixed-point FFT convolution instance initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+ */
+
+/**
+   @addtogroup FFTConvolution
+   @{
+ */
+
+/**
+   @brief Initializes an instance of the 16-bit fixed-point FFT convolution.
+   @param[out] S                points to the instance of the 16-bit fixed-point FFT convolution
+   @param[in]  pFft             points to the 32-bit complex FFT instance of length fftLen, for
+                                example plp_cfft_sR_q32_len1024 or one created by plp_cfft_init_q32
+   @param[in]  pFilter          points to the filter coefficients in Q1.15
+   @param[in]  filterLen        number of filter coefficients, at most fftLen
+   @param[out] pFilterSpectrum  points to a buffer of 2*fftLen values for the spectrum of the
+                                filter
+   @param[out] pState           points to a buffer of filterLen-1 values for the past input samples
+   @param[in]  pBuffer          points to a work buffer of 2*fftLen values
+   @return     0: Success, 1: filterLen is not supported
+
+   @par Every call of plp_fftconv_q16 processes the input in blocks of fftLen-filterLen+1 samples,
+   so fftLen should be about two to four times filterLen. The state is cleared, and all buffers
+   must stay valid as long as S is used.
+
+   @par Scaling
+   The spectrum is stored as DFT(pFilter) / 2^s in Q1.31, where s is the smallest shift with
+   sum(abs(pFilter)) < 2^s, which keeps all intermediate values of the transforms below one.
+ */
+
+int plp_fftconv_init_q16(plp_fftconv_instance_q16 *S,
+                         const plp_cfft_instance_q32 *pFft,
+                         const int16_t *__restrict__ pFilter,
+                         uint32_t filterLen,
+                         int32_t *__restrict__ pFilterSpectrum,
+                         int16_t *__restrict__ pState,
+                         int32_t *__restrict__ pBuffer) {
+
+    uint32_t i;
+    uint32_t N = pFft->fftLen;
+    uint32_t log2Len = 0;
+    uint32_t s = 0;
+    uint32_t gain = 0;
+
+    if (filterLen == 0 || filterLen > N) {
+        return 1;
+    }
+
+    while ((1U << log2Len) < N) {
+        log2Len++;
+    }
+
+    for (i = 0; i < filterLen; i++) {
+        gain += (pFilter[i] < 0) ? -pFilter[i] : pFilter[i];
+    }
+    while (gain >= (1U << (15 + s))) {
+        s++;
+    }
+
+    // DFT(pFilter) / fftLen, which is scaled to DFT(pFilter) / 2^s afterwards
+    for (i = 0; i < N; i++) {
+        pFilterSpectrum[2 * i] = (i < filterLen) ? ((int32_t)pFilter[i] << 16) : 0;
+        pFilterSpectrum[2 * i + 1] = 0;
+    }
+    plp_cfft_q32(pFft, pFilterSpectrum, 0, 1, 31);
+
+    for (i = 0; i < 2 * N; i++) {
+        if (log2Len >= s) {
+            pFilterSpectrum[i] = pFilterSpectrum[i] << (log2Len - s);
+        } else {
+            pFilterSpectrum[i] = pFilterSpectrum[i] >> (s - log2Len);
+        }
+    }
+
+    for (i = 0; i < filterLen - 1; i++) {
+        pState[i] = 0;
+    }
+
+    S->S = pFft;
+    S->filterLen = filterLen;
+    S->blockLen = N - filterLen + 1;
+    S->pFilterSpectrum = pFilterSpectrum;
+    S->outShift = 15 - (int32_t)log2Len - (int32_t)s;
+    S->pState = pState;
+    S->pBuffer = pBuffer;
+
+    return 0;
+}
+
+/**
+   @} end of FFTConvolution group
+ */
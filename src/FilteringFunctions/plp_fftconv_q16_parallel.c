@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fftconv_q16_parallel.c
+ * Description:  parallel 16-bit fixed-point FFT convolution glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FFTConvolution
+  @{
+ */
+
+/**
+  @brief Glue code for parallel FFT convolution of a 16-bit fixed-point stream.
+  @param[in,out] S           points to the instance, initialized by plp_fftconv_init_q16. The
+                             state is updated.
+  @param[in]     pSrc        points to the next numSamples input samples
+  @param[in]     numSamples  number of input and output samples
+  @param[in]     nPE         number of cores to use
+  @param[out]    pDst        points to the output buffer of numSamples samples, which must not
+                             overlap with pSrc
+  @return        none
+
+  @par Overlap-Save
+  The input is processed in blocks of S->blockLen = fftLen - filterLen + 1 new samples. Every block
+  is extended by the filterLen - 1 preceding samples. Two consecutive blocks are transformed
+  together as real and imaginary part of one 32-bit complex FFT, multiplied by the (real)
+  spectrum of the filter and transformed back. The first filterLen - 1 samples of the result
+  contain the circular wrap-around and are discarded. The last filterLen - 1 input samples are
+  kept in S->pState, such that a stream can be filtered in chunks of arbitrary numSamples.
+
+  @par Precision
+  The transforms use plp_cfft_q32 instead of plp_cfft_q16. All 16-bit transforms scale by
+  1 / fftLen, which would leave only 15 - log2(fftLen) bits in the result, while the 32-bit
+  transforms keep 30 - log2(fftLen) - s bits, with the filter shift s of plp_fftconv_init_q16. The
+  result is rounded and saturated to Q1.15.
+ */
+
+void plp_fftconv_q16_parallel(plp_fftconv_instance_q16 *S,
+                              const int16_t *__restrict__ pSrc,
+                              uint32_t numSamples,
+                              uint32_t nPE,
+                              int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_fftconv_instance_q16_parallel args = {
+            .S = S, .pSrc = pSrc, .numSamples = numSamples, .nPE = nPE, .pDst = pDst
+        };
+
+        rt_team_fork(nPE, plp_fftconv_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of FFTConvolution group
+ */
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_filter2d_box_i8.c
+ * Description:  Box filtering of 8-bit integer images glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Filter2d
+ * @{
+ */
+
+/**
+ * @brief Glue code for box filtering of 8-bit integer images.
+ * @param[in]  pSrc       points to the input image, srcRows x srcCols
+ * @param[in]  srcRows    number of rows of the input image
+ * @param[in]  srcCols    number of columns of the input image
+ * @param[in]  nChannels  number of channels, stored one after the other
+ * @param[in]  kRows      number of rows of the window
+ * @param[in]  kCols      number of columns of the window, at most
+ *                        PLP_FILTER2D_STRIP_LEN / 2, with kRows * kCols below 2^14
+ * @param[out] pDst       output image returned here, (srcRows - kRows + 1) x
+ *                        (srcCols - kCols + 1) per channel
+ * @return     none
+ */
+
+void plp_filter2d_box_i8(const int8_t *__restrict__ pSrc,
+                         uint32_t srcRows,
+                         uint32_t srcCols,
+                         uint32_t nChannels,
+                         uint32_t kRows,
+                         uint32_t kCols,
+                         int8_t *__restrict__ pDst) {
+
+    if (srcRows < kRows || srcCols < kCols || kCols > PLP_FILTER2D_STRIP_LEN / 2 ||
+        kRows * kCols >= (1 << 14)) {
+        return;
+    }
+
+    // samples per input and output channel
+    uint32_t srcSize = srcRows * srcCols;
+    uint32_t dstSize = (srcRows - kRows + 1) * (srcCols - kCols + 1);
+    uint32_t ch;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        for (ch = 0; ch < nChannels; ch++) {
+            plp_filter2d_box_i8s_rv32im(pSrc + ch * srcSize, srcRows, srcCols, kRows, kCols,
+                                        pDst + ch * dstSize);
+        }
+    } else {
+        for (ch = 0; ch < nChannels; ch++) {
+            plp_filter2d_box_i8s_xpulpv2(pSrc + ch * srcSize, srcRows, srcCols, kRows, kCols,
+                                         pDst + ch * dstSize);
+        }
+    }
+}
+
+/**
+ * @} end of Filter2d group
+ */
@@ -0,0 +1,185 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_filter2d_separable_i16_l2.c
+ * Description:  Parallel separable 2D filtering of 16-bit integer images in L2 glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Filter2d
+ * @{
+ */
+
+/**
+ * @brief Glue code for parallel separable 2D filtering of 16-bit integer images in L2.
+ * @param[in]  pSrc       points to the input image in L2, srcRows x srcCols
+ * @param[in]  srcRows    number of rows of the input image
+ * @param[in]  srcCols    number of columns of the input image
+ * @param[in]  nChannels  number of channels, stored one after the other
+ * @param[in]  pKernelY   points to the kRows taps of the vertical pass in L2
+ * @param[in]  kRows      number of rows of the kernel
+ * @param[in]  pKernelX   points to the kCols taps of the horizontal pass in L2
+ * @param[in]  kCols      number of columns of the kernel, at most
+ *                        PLP_FILTER2D_STRIP_LEN / 2
+ * @param[in]  shiftY     right shift of the vertical pass, rounded
+ * @param[in]  shift      right shift of the horizontal pass, rounded and saturated
+ * @param[in]  nPE        number of cores to compute on
+ * @param[out] pDst       output image in L2 returned here, (srcRows - kRows + 1) x
+ *                        (srcCols - kCols + 1) per channel
+ * @return     none
+ *
+ * @par
+ * The output rows are computed in bands, which are streamed through L1: for every band, the
+ * cluster DMA copies the input rows of the band, including the kRows - 1 rows it shares with
+ * the next band as a halo, into L1, the band is computed with plp_filter2d_separable_i16_parallel,
+ * and the output rows are copied back to L2. The bands are double buffered, such that the DMA
+ * copies the next band and writes back the previous one while the cores compute. The L1
+ * buffer of PLP_DMA_STREAM_BUFFER_BYTES bytes is taken with plp_scratch_alloc, and the bands
+ * are as high as it allows. The taps are copied to the start of the buffer once.
+ */
+
+void plp_filter2d_separable_i16_l2(const int16_t *__restrict__ pSrc,
+                                   uint32_t srcRows,
+                                   uint32_t srcCols,
+                                   uint32_t nChannels,
+                                   const int16_t *__restrict__ pKernelY,
+                                   uint32_t kRows,
+                                   const int16_t *__restrict__ pKernelX,
+                                   uint32_t kCols,
+                                   uint32_t shiftY,
+                                   uint32_t shift,
+                                   uint32_t nPE,
+                                   int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    if (srcRows < kRows || srcCols < kCols || nChannels == 0 ||
+        kCols > PLP_FILTER2D_STRIP_LEN / 2) {
+        return;
+    }
+
+    uint32_t outRows = srcRows - kRows + 1;
+    uint32_t outCols = srcCols - kCols + 1;
+    uint32_t kBytes = ((kRows + kCols) * sizeof(int16_t) + 3) & ~3; // taps, word aligned
+    uint32_t inRowBytes = srcCols * sizeof(int16_t);
+    uint32_t outRowBytes = outCols * sizeof(int16_t);
+
+    // highest band of which input and output fit twice into the buffer, next to the taps
+    int32_t budget = (PLP_DMA_STREAM_BUFFER_BYTES - kBytes) / 2 - 6;
+    int32_t bandRows = (budget - (int32_t)((kRows - 1) * inRowBytes)) /
+        (int32_t)(inRowBytes + outRowBytes);
+
+    if (bandRows <= 0) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+    if ((uint32_t)bandRows > outRows) {
+        bandRows = outRows;
+    }
+
+    uint8_t *pBuf = (uint8_t *)plp_scratch_alloc(PLP_DMA_STREAM_BUFFER_BYTES);
+
+    if (pBuf == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+
+    uint32_t inBytes = ((bandRows + kRows - 1) * inRowBytes + 3) & ~3;
+    uint32_t outBytes = (bandRows * outRowBytes + 3) & ~3;
+    uint32_t nBands = (outRows + bandRows - 1) / bandRows;
+    uint32_t nTasks = nChannels * nBands; // bands of all channels
+    uint32_t t;
+
+    int16_t *pIn[2];
+    int16_t *pOut[2];
+    int16_t *pKY = (int16_t *)pBuf;
+    int16_t *pKX = pKY + kRows;
+    rt_dma_copy_t copyK, copyIn[2], copyOut[2];
+
+    for (t = 0; t < 2; t++) {
+        pIn[t] = (int16_t *)(pBuf + kBytes + t * (inBytes + outBytes));
+        pOut[t] = (int16_t *)(pBuf + kBytes + t * (inBytes + outBytes) + inBytes);
+    }
+
+    plp_copy_dma(pKernelY, pKY, kRows * sizeof(int16_t), RT_DMA_DIR_EXT2LOC, &copyK);
+    plp_copy_dma_wait(&copyK);
+    plp_copy_dma(pKernelX, pKX, kCols * sizeof(int16_t), RT_DMA_DIR_EXT2LOC, &copyK);
+    plp_copy_dma_wait(&copyK);
+
+    for (t = 0; t <= nTasks; t++) {
+        uint32_t b = t & 1;
+
+        // start the copy of the next band into the other buffer
+        if (t < nTasks) {
+            uint32_t ch = t / nBands;
+            uint32_t row = (t - ch * nBands) * bandRows;
+            uint32_t rows = MIN(bandRows, outRows - row);
+
+            plp_copy_dma(pSrc + (ch * srcRows + row) * srcCols, pIn[b],
+                         (rows + kRows - 1) * inRowBytes, RT_DMA_DIR_EXT2LOC, &copyIn[b]);
+        }
+
+        // compute the current band, and write it back
+        if (t > 0) {
+            uint32_t p = b ^ 1;
+            uint32_t ch = (t - 1) / nBands;
+            uint32_t row = (t - 1 - ch * nBands) * bandRows;
+            uint32_t rows = MIN(bandRows, outRows - row);
+
+            plp_copy_dma_wait(&copyIn[p]);
+            if (t > 2) {
+                plp_copy_dma_wait(&copyOut[p]); // write-back of the band before the last
+            }
+
+            plp_filter2d_separable_i16_parallel(pIn[p], rows + kRows - 1, srcCols, 1, pKY, kRows,
+                                                pKX, kCols, shiftY, shift, nPE, pOut[p]);
+
+            plp_copy_dma(pOut[p], pDst + (ch * outRows + row) * outCols, rows * outRowBytes,
+                         RT_DMA_DIR_LOC2EXT, &copyOut[p]);
+        }
+    }
+
+    // wait for the write-backs of the last two bands
+    plp_copy_dma_wait(&copyOut[(nTasks - 1) & 1]);
+    if (nTasks > 1) {
+        plp_copy_dma_wait(&copyOut[nTasks & 1]);
+    }
+
+    plp_scratch_free(pBuf, PLP_DMA_STREAM_BUFFER_BYTES);
+}
+
+/**
+ * @} end of Filter2d group
+ */
@@ -0,0 +1,124 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_filter2d_separable_i8.c
+ * Description:  Separable 2D filtering of 8-bit integer images glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Filter2d Separable 2D Filters
+ * This module contains the glue code for the valid 2D filtering of images with a separable kernel,
+ * i.e. the outer product of a vertical kernel of kRows taps and a horizontal kernel of kCols taps,
+ * and for the box filter, the mean of a window of kRows x kCols samples. The kernel codes are in
+ * the module Separable 2D Filter Kernels.
+ *
+ * The output has the size (srcRows - kRows + 1) x (srcCols - kCols + 1), and the taps are applied
+ * as in a correlation (without flipping), such that the separable filter computes
+ * <pre>
+ *     t[i][j]    = (sum over r of pKernelY[r] * pSrc[i + r][j]) >> shiftY
+ *     pDst[i][j] = (sum over c of pKernelX[c] * t[i][j + c]) >> shift,
+ * </pre>
+ * where both shifts are rounded, and the output is saturated. The intermediate values t are kept
+ * in 32 bits, such that e.g. a Gaussian with taps in Q7 uses shiftY = shift = 7. The box filter
+ * returns the mean rounded to the nearest. Images with several channels are stored channel after
+ * channel (CHW), and the same kernel is applied to every channel.
+ *
+ * Both filters traverse the image in strips of PLP_FILTER2D_STRIP_LEN columns, of which the
+ * intermediate values are kept on the stack, so no transposed copy or full-size buffer of the
+ * image is needed and all accesses run along the rows. The separable filter computes one strip
+ * of t per output row, which takes kRows + kCols multiplications per output instead of
+ * kRows * kCols. The box filter keeps running sums of the columns of the strip, which are updated
+ * with the entering and leaving row, and a running sum along the row, such that it takes four
+ * additions per output for any window size. Its division by the window size is a multiplication
+ * with the reciprocal from plp_filter2d_box_recip.
+ */
+
+/**
+ * @addtogroup Filter2d
+ * @{
+ */
+
+/**
+ * @brief Glue code for separable 2D filtering of 8-bit integer images.
+ * @param[in]  pSrc       points to the input image, srcRows x srcCols
+ * @param[in]  srcRows    number of rows of the input image
+ * @param[in]  srcCols    number of columns of the input image
+ * @param[in]  nChannels  number of channels, stored one after the other
+ * @param[in]  pKernelY   points to the kRows taps of the vertical pass
+ * @param[in]  kRows      number of rows of the kernel
+ * @param[in]  pKernelX   points to the kCols taps of the horizontal pass
+ * @param[in]  kCols      number of columns of the kernel, at most
+ *                        PLP_FILTER2D_STRIP_LEN / 2
+ * @param[in]  shiftY     right shift of the vertical pass, rounded
+ * @param[in]  shift      right shift of the horizontal pass, rounded and saturated
+ * @param[out] pDst       output image returned here, (srcRows - kRows + 1) x
+ *                        (srcCols - kCols + 1) per channel
+ * @return     none
+ */
+
+void plp_filter2d_separable_i8(const int8_t *__restrict__ pSrc,
+                               uint32_t srcRows,
+                               uint32_t srcCols,
+                               uint32_t nChannels,
+                               const int8_t *__restrict__ pKernelY,
+                               uint32_t kRows,
+                               const int8_t *__restrict__ pKernelX,
+                               uint32_t kCols,
+                               uint32_t shiftY,
+                               uint32_t shift,
+                               int8_t *__restrict__ pDst) {
+
+    if (srcRows < kRows || srcCols < kCols || kCols > PLP_FILTER2D_STRIP_LEN / 2) {
+        return;
+    }
+
+    // samples per input and output channel
+    uint32_t srcSize = srcRows * srcCols;
+    uint32_t dstSize = (srcRows - kRows + 1) * (srcCols - kCols + 1);
+    uint32_t ch;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        for (ch = 0; ch < nChannels; ch++) {
+            plp_filter2d_separable_i8s_rv32im(pSrc + ch * srcSize, srcRows, srcCols, pKernelY,
+                                              kRows, pKernelX, kCols, shiftY, shift,
+                                              pDst + ch * dstSize);
+        }
+    } else {
+        for (ch = 0; ch < nChannels; ch++) {
+            plp_filter2d_separable_i8s_xpulpv2(pSrc + ch * srcSize, srcRows, srcCols, pKernelY,
+                                               kRows, pKernelX, kCols, shiftY, shift,
+                                               pDst + ch * dstSize);
+        }
+    }
+}
+
+/**
+ * @} end of Filter2d group
+ */
@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_filter2d_separable_i8_parallel.c
+ * Description:  Parallel separable 2D filtering of 8-bit integer images glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Filter2d
+ * @{
+ */
+
+/**
+ * @brief Glue code for parallel separable 2D filtering of 8-bit integer images.
+ * @param[in]  pSrc       points to the input image, srcRows x srcCols
+ * @param[in]  srcRows    number of rows of the input image
+ * @param[in]  srcCols    number of columns of the input image
+ * @param[in]  nChannels  number of channels, stored one after the other
+ * @param[in]  pKernelY   points to the kRows taps of the vertical pass
+ * @param[in]  kRows      number of rows of the kernel
+ * @param[in]  pKernelX   points to the kCols taps of the horizontal pass
+ * @param[in]  kCols      number of columns of the kernel, at most
+ *                        PLP_FILTER2D_STRIP_LEN / 2
+ * @param[in]  shiftY     right shift of the vertical pass, rounded
+ * @param[in]  shift      right shift of the horizontal pass, rounded and saturated
+ * @param[in]  nPE        number of cores to compute on
+ * @param[out] pDst       output image returned here, (srcRows - kRows + 1) x
+ *                        (srcCols - kCols + 1) per channel
+ * @return     none
+ *
+ * @par The output rows of all channels are split into nPE contiguous ranges, one per core.
+ * Every core reads the kRows - 1 input rows below its range as a halo.
+ */
+
+void plp_filter2d_separable_i8_parallel(const int8_t *__restrict__ pSrc,
+                                        uint32_t srcRows,
+                                        uint32_t srcCols,
+                                        uint32_t nChannels,
+                                        const int8_t *__restrict__ pKernelY,
+                                        uint32_t kRows,
+                                        const int8_t *__restrict__ pKernelX,
+                                        uint32_t kCols,
+                                        uint32_t shiftY,
+                                        uint32_t shift,
+                                        uint32_t nPE,
+                                        int8_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    if (srcRows < kRows || srcCols < kCols || kCols > PLP_FILTER2D_STRIP_LEN / 2) {
+        return;
+    }
+
+    plp_filter2d_separable_instance_i8 S = { .pSrc = pSrc,
+                                             .srcRows = srcRows,
+                                             .srcCols = srcCols,
+                                             .nChannels = nChannels,
+                                             .pKernelY = pKernelY,
+                                             .kRows = kRows,
+                                             .pKernelX = pKernelX,
+                                             .kCols = kCols,
+                                             .shiftY = shiftY,
+                                             .shift = shift,
+                                             .nPE = nPE,
+                                             .pDst = pDst };
+
+    rt_team_fork(nPE, plp_filter2d_separable_i8p_xpulpv2, (void *)&S);
+}
+
+/**
+ * @} end of Filter2d group
+ */
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_init_f32.c
+ * Description:  32-bit floating-point decimating FIR filter instance initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIRDecimate
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 32-bit floating-point decimating FIR filter.
+  @param[out] S          points to the instance of the 32-bit floating-point decimating FIR filter
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  M          decimation factor
+  @param[in]  pCoeffs    points to the numTaps filter coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of numTaps+blockSize-1 samples
+  @param[in]  blockSize  number of input samples processed per call, a multiple of M
+  @return     0: Success, 1: blockSize is not a multiple of M
+
+  @par The coefficients are stored in time-reversed order, {b[numTaps-1], ..., b[1], b[0]}, like in
+  CMSIS-DSP. The state is cleared, and all buffers must stay valid as long as S is used.
+ */
+
+int plp_fir_decimate_init_f32(plp_fir_decimate_instance_f32 *S,
+                              uint32_t numTaps,
+                              uint32_t M,
+                              const float32_t *__restrict__ pCoeffs,
+                              float32_t *__restrict__ pState,
+                              uint32_t blockSize) {
+
+    uint32_t i;
+
+    if (M == 0 || blockSize % M != 0) {
+        return 1;
+    }
+
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = 0.0f;
+    }
+
+    S->M = M;
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->blockSize = blockSize;
+
+    return 0;
+}
+
+/**
+  @} end of FIRDecimate group
+ */
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_q32.c
+ * Description:  32-bit fixed-point decimating FIR filter glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIRDecimate
+  @{
+ */
+
+/**
+  @brief Glue code for decimating FIR filtering of a 32-bit fixed-point block.
+  @param[in]  S          points to the instance, initialized by plp_fir_decimate_init_q32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, the block size of the instance
+  @param[out] pDst       points to the blockSize/M output samples, which may be equal to pSrc
+  @return     none
+
+  @par Fix-Point, Shifting and Saturation
+  The products are accumulated with 64 bits, without intermediate shifts. The sum is shifted by
+  S->shift to the right (with rounding) and saturated to 32 bits.
+ */
+
+void plp_fir_decimate_q32(const plp_fir_decimate_instance_q32 *S,
+                          const int32_t *pSrc,
+                          uint32_t blockSize,
+                          int32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_fir_decimate_q32s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_fir_decimate_q32s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of FIRDecimate group
+ */
@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_init_f32.c
+ * Description:  32-bit floating-point FIR filter instance initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 32-bit floating-point FIR filter.
+  @param[out] S          points to the instance of the 32-bit floating-point FIR filter
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the numTaps filter coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of numTaps+blockSize-1 samples
+  @param[in]  blockSize  maximum number of samples processed per call
+  @return     none
+
+  @par The coefficients are stored in time-reversed order, {b[numTaps-1], ..., b[1], b[0]}, like in
+  CMSIS-DSP, so that every output is a contiguous dot product with the state buffer. The state
+  is cleared, and all buffers must stay valid as long as S is used.
+ */
+
+void plp_fir_init_f32(plp_fir_instance_f32 *S,
+                      uint32_t numTaps,
+                      const float32_t *__restrict__ pCoeffs,
+                      float32_t *__restrict__ pState,
+                      uint32_t blockSize) {
+
+    uint32_t i;
+
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = 0.0f;
+    }
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->blockSize = blockSize;
+}
+
+/**
+  @} end of FIR group
+ */
@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_init_q32.c
+ * Description:  32-bit fixed-point interpolating FIR filter instance initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIRInterpolate
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 32-bit fixed-point interpolating FIR filter.
+  @param[out] S             points to the instance of the 32-bit fixed-point interpolating FIR filter
+  @param[in]  L             interpolation factor
+  @param[in]  numTaps       number of filter coefficients, a multiple of L
+  @param[in]  pCoeffs       points to the numTaps filter coefficients in time-reversed order
+  @param[out] pPhaseCoeffs  points to a buffer of numTaps values for the polyphase coefficients
+  @param[in]  pState        points to the state buffer of numTaps/L+blockSize-1 samples
+  @param[in]  blockSize     maximum number of input samples processed per call
+  @param[in]  shift         amount to shift the accumulated sum to the right
+  @return     0: Success, 1: numTaps is not a multiple of L
+
+  @par The coefficients are stored in time-reversed order, {b[numTaps-1], ..., b[1], b[0]}, like in
+  CMSIS-DSP. They are copied into pPhaseCoeffs, where branch j holds the coefficients
+  {b[numTaps-L+j], ..., b[L+j], b[j]} contiguously. The state is cleared, and all buffers must stay
+  valid as long as S is used.
+ */
+
+int plp_fir_interpolate_init_q32(plp_fir_interpolate_instance_q32 *S,
+                                 uint32_t L,
+                                 uint32_t numTaps,
+                                 const int32_t *__restrict__ pCoeffs,
+                                 int32_t *__restrict__ pPhaseCoeffs,
+                                 int32_t *__restrict__ pState,
+                                 uint32_t blockSize,
+                                 uint32_t shift) {
+
+    uint32_t i, j;
+    uint32_t P;
+
+    if (L == 0 || numTaps % L != 0) {
+        return 1;
+    }
+
+    P = numTaps / L;
+
+    for (j = 0; j < L; j++) {
+        for (i = 0; i < P; i++) {
+            pPhaseCoeffs[j * P + i] = pCoeffs[i * L + L - 1 - j];
+        }
+    }
+
+    for (i = 0; i < P - 1; i++) {
+        pState[i] = 0;
+    }
+
+    S->L = L;
+    S->phaseLength = P;
+    S->pCoeffs = pPhaseCoeffs;
+    S->pState = pState;
+    S->blockSize = blockSize;
+    S->shift = shift;
+
+    return 0;
+}
+
+/**
+  @} end of FIRInterpolate group
+ */
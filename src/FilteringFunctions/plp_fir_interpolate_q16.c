@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_q16.c
+ * Description:  16-bit fixed-point interpolating FIR filter glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIRInterpolate Interpolating FIR Filter
+  Upsampling by an integer factor L (inserting L-1 zeros after every input sample) followed by a
+  stateful FIR filter. The filter is split into L polyphase branches of numTaps/L coefficients:
+
+  <pre>
+      y[n*L+j] = b[j] * x[n] + b[L+j] * x[n-1] + ... + b[numTaps-L+j] * x[n-numTaps/L+1]
+  </pre>
+
+  such that the zeros are never multiplied. During initialization, the coefficients are reordered
+  into the L branches, so that every output is a contiguous dot product with the state buffer.
+  The parallel versions split the input samples of a block across cores, each of them producing L
+  output samples.
+ */
+
+/**
+  @addtogroup FIRInterpolate
+  @{
+ */
+
+/**
+  @brief Glue code for interpolating FIR filtering of a 16-bit fixed-point block.
+  @param[in]  S          points to the instance, initialized by plp_fir_interpolate_init_q16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, at most the block size of the instance
+  @param[out] pDst       points to the blockSize*L output samples
+  @return     none
+
+  @par Fix-Point, Shifting and Saturation
+  The products are accumulated with 32 bits, without intermediate shifts. The sum is shifted by
+  S->shift to the right (with rounding) and saturated to 16 bits.
+ */
+
+void plp_fir_interpolate_q16(const plp_fir_interpolate_instance_q16 *S,
+                             const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_fir_interpolate_q16s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_fir_interpolate_q16s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of FIRInterpolate group
+ */
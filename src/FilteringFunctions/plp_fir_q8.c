@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_q8.c
+ * Description:  8-bit fixed-point FIR filter glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR FIR Filter
+  Stateful finite impulse response filter, which filters a continuous stream block by block:
+
+  <pre>
+      y[n] = b[0] * x[n] + b[1] * x[n-1] + ... + b[numTaps-1] * x[n-numTaps+1]
+  </pre>
+
+  The instance keeps the last numTaps-1 input samples in a linear state buffer of
+  numTaps+blockSize-1 samples. Every call appends the new block to the state, computes each output
+  as one contiguous dot product with the time-reversed coefficients, and moves the last
+  numTaps-1 samples to the beginning of the buffer. Because all inputs of a block are available in
+  the buffer, the parallel versions can split the output samples of a block across cores.
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/**
+  @brief Glue code for FIR filtering of an 8-bit fixed-point block.
+  @param[in]  S          points to the instance, initialized by plp_fir_init_q8
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input and output samples, at most the block size of the instance
+  @param[out] pDst       points to the block of output samples, which may be equal to pSrc
+  @return     none
+
+  @par Fix-Point, Shifting and Saturation
+  The products are accumulated with 32 bits, without intermediate shifts. The sum is shifted by
+  S->shift to the right (with rounding) and saturated to 8 bits. For Q1.7 input and coefficients,
+  use a shift of 7.
+ */
+
+void plp_fir_q8(const plp_fir_instance_q8 *S,
+                const int8_t *pSrc,
+                uint32_t blockSize,
+                int8_t *pDst) {
+
+    PLP_PROFILE_SHAPE(S->numTaps, blockSize, 0);
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_fir_q8s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_fir_q8s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of FIR group
+ */
@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_sparse_init_f32.c
+ * Description:  32-bit floating-point sparse FIR filter initialization
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIRSparse
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 32-bit floating-point sparse FIR filter.
+  @param[out] S            points to the instance of the 32-bit floating-point sparse FIR filter
+  @param[in]  numTaps      number of non-zero taps
+  @param[in]  pTapDelays   points to the delays of the numTaps taps in samples
+  @param[in]  pCoeffs      points to the values of the numTaps taps
+  @param[in]  pState       points to the state buffer of max(pTapDelays)+blockSize samples
+  @param[in]  blockSize    number of input samples processed per call
+  @return     0: Success, 1: numTaps or blockSize is 0
+
+  @par The taps may be given in any order. The state is cleared, and all buffers must stay valid as
+  long as S is used.
+ */
+
+int plp_fir_sparse_init_f32(plp_fir_sparse_instance_f32 *S,
+                            uint32_t numTaps,
+                            const uint32_t *__restrict__ pTapDelays,
+                            const float32_t *__restrict__ pCoeffs,
+                            float32_t *__restrict__ pState,
+                            uint32_t blockSize) {
+
+    uint32_t i;
+    uint32_t maxDelay = 0;
+
+    if (numTaps == 0 || blockSize == 0) {
+        return 1;
+    }
+
+    for (i = 0; i < numTaps; i++) {
+        if (pTapDelays[i] > maxDelay) {
+            maxDelay = pTapDelays[i];
+        }
+    }
+
+    for (i = 0; i < maxDelay + blockSize; i++) {
+        pState[i] = 0.0f;
+    }
+
+    S->numTaps = numTaps;
+    S->pTapDelays = pTapDelays;
+    S->pCoeffs = pCoeffs;
+    S->maxDelay = maxDelay;
+    S->pState = pState;
+    S->stateIndex = 0;
+    S->blockSize = blockSize;
+
+    return 0;
+}
+
+/**
+  @} end of FIRSparse group
+ */
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_sparse_q16.c
+ * Description:  16-bit fixed-point sparse FIR filter glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIRSparse Sparse FIR Filter
+  Stateful FIR filter with only a few non-zero taps at arbitrary delays, such as an echo path or a
+  tapped delay line:
+
+  <pre>
+      y[n] = b[0] * x[n-d[0]] + b[1] * x[n-d[1]] + ... + b[numTaps-1] * x[n-d[numTaps-1]]
+  </pre>
+
+  The instance stores the delay d[k] and the value b[k] of every tap. The state is a circular
+  delay line of maxDelay+blockSize samples, where maxDelay is the largest delay. A block is
+  written once into the delay line, and every output gathers the samples of the taps from it,
+  hence a block costs numTaps multiplications per output, independent of the delays, and the state
+  is never moved. The xpulpv2 kernels compute four outputs at a time, which load every tap once
+  and read four contiguous samples of the delay line. The parallel versions split the outputs of a
+  block across cores.
+ */
+
+/**
+  @addtogroup FIRSparse
+  @{
+ */
+
+/**
+  @brief Glue code for sparse FIR filtering of a 16-bit fixed-point block.
+  @param[in,out] S          points to the instance, initialized by plp_fir_sparse_init_q16
+  @param[in]     pSrc       points to the S->blockSize input samples
+  @param[out]    pDst       points to the S->blockSize output samples, which may be equal to pSrc
+  @return        none
+  @par Fix-Point, Shifting and Saturation
+  The products are accumulated with 32 bits, without intermediate shifts. The sum is shifted by
+  S->shift to the right (with rounding) and saturated to 16 bits.
+ */
+
+void plp_fir_sparse_q16(plp_fir_sparse_instance_q16 *S,
+                        const int16_t *pSrc,
+                        int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_fir_sparse_q16s_rv32im(S, pSrc, pDst);
+    } else {
+        plp_fir_sparse_q16s_xpulpv2(S, pSrc, pDst);
+    }
+}
+
+/**
+  @} end of FIRSparse group
+ */
@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gcc_phat_f32.c
+ * Description:  Glue code for the 32-bit floating-point GCC-PHAT
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup GccPhat GCC-PHAT
+  Generalized cross-correlation with phase transform, to estimate the time delays between pairs of
+  channels, e.g. of a microphone array. The cross-correlation of a pair a, b is
+
+  <pre>
+      r[l] = IFFT(conj(A[k]) * B[k] / |conj(A[k]) * B[k]|)[l]
+  </pre>
+
+  where A and B are the spectra of the zero padded channels. Only the phase of every bin is kept,
+  which sharpens the peak of r at the delay of b with respect to a.
+
+  Every channel is transformed once, and its spectrum is used by all pairs which contain it. Thus,
+  nChannels real FFTs and nPairs inverse FFTs of fftLen samples replace the nPairs direct
+  correlations (see plp_correlate) of O(blockSize^2) operations each.
+ */
+
+/**
+  @addtogroup GccPhat
+  @{
+ */
+
+/**
+  @brief Glue code for the GCC-PHAT of 32-bit floating-point channels.
+  @param[in]  S          points to the instance, initialized by plp_gcc_phat_init_f32
+  @param[in]  pChannels  array of nChannels pointers to the blockSize samples of every channel
+  @param[out] pCorr      points to nPairs correlations of 2*maxLag+1 values, for the lags -maxLag to
+                         maxLag
+  @param[out] pDelay     points to nPairs delays, the lag of the largest value of every correlation,
+                         or NULL. A positive delay means that the second channel of the pair lags
+                         behind the first.
+  @return     none
+ */
+
+void plp_gcc_phat_f32(const plp_gcc_phat_instance_f32 *S,
+                      const float32_t *const *pChannels,
+                      float32_t *__restrict__ pCorr,
+                      int32_t *__restrict__ pDelay) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_gcc_phat_f32s_xpulpv2(S, pChannels, pCorr, pDelay);
+}
+
+/**
+  @} end of GccPhat group
+ */
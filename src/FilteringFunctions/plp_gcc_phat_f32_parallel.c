@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gcc_phat_f32_parallel.c
+ * Description:  Glue code for the parallel 32-bit floating-point GCC-PHAT
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup GccPhat
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel GCC-PHAT of 32-bit floating-point channels.
+  @param[in]  S          points to the instance, initialized by plp_gcc_phat_init_f32 with a work
+                         buffer of 3*fftLen*nPE values
+  @param[in]  pChannels  array of nChannels pointers to the blockSize samples of every channel
+  @param[in]  nPE        number of cores to use
+  @param[out] pCorr      points to nPairs correlations of 2*maxLag+1 values, for the lags -maxLag to
+                         maxLag
+  @param[out] pDelay     points to nPairs delays, the lag of the largest value of every correlation,
+                         or NULL
+  @return     none
+ */
+
+void plp_gcc_phat_f32_parallel(const plp_gcc_phat_instance_f32 *S,
+                               const float32_t *const *pChannels,
+                               uint32_t nPE,
+                               float32_t *__restrict__ pCorr,
+                               int32_t *__restrict__ pDelay) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_gcc_phat_instance_f32_parallel args = {
+            .S = S, .pChannels = pChannels, .nPE = nPE, .pCorr = pCorr, .pDelay = pDelay
+        };
+
+        rt_team_fork(nPE, plp_gcc_phat_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of GccPhat group
+ */
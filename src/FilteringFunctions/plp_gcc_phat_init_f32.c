@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gcc_phat_init_f32.c
+ * Description:  Initialization of the 32-bit floating-point GCC-PHAT
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+ */
+
+/**
+   @addtogroup GccPhat
+   @{
+ */
+
+/**
+   @brief Initializes an instance of the floating-point GCC-PHAT.
+   @param[out] S          points to the instance of the floating-point GCC-PHAT
+   @param[in]  pFft       points to the real FFT instance of length fftLen, with bitReverseFlag=1,
+                          for example created by plp_cfft_init_f32
+   @param[in]  nChannels  number of input channels, at most 256
+   @param[in]  blockSize  number of samples of every channel
+   @param[in]  pPairs     points to 2*nPairs channel indices, the two channels of every pair
+   @param[in]  nPairs     number of channel pairs
+   @param[in]  maxLag     largest delay of interest, in samples
+   @param[out] pSpectra   points to a buffer of 2*fftLen*nChannels values for the spectra of the
+                          channels
+   @param[in]  pBuffer    points to a work buffer of 3*fftLen values for every core, i.e.
+                          3*fftLen*nPE values for the parallel version
+   @return     0: Success, 1: the configuration is not supported
+
+   @par The correlation is circular in the FFT, so fftLen must be at least blockSize + maxLag to
+   keep the lags -maxLag .. maxLag free of wrap-around. All buffers must stay valid as long as S is
+   used.
+ */
+
+int plp_gcc_phat_init_f32(plp_gcc_phat_instance_f32 *S,
+                          const plp_rfft_instance_f32 *pFft,
+                          uint32_t nChannels,
+                          uint32_t blockSize,
+                          const uint8_t *pPairs,
+                          uint32_t nPairs,
+                          uint32_t maxLag,
+                          float32_t *__restrict__ pSpectra,
+                          float32_t *__restrict__ pBuffer) {
+
+    uint32_t p;
+
+    if (blockSize == 0 || blockSize + maxLag > pFft->FFTLength || nChannels > 256) {
+        return 1;
+    }
+
+    for (p = 0; p < 2 * nPairs; p++) {
+        if (pPairs[p] >= nChannels) {
+            return 1;
+        }
+    }
+
+    S->S = pFft;
+    S->nChannels = nChannels;
+    S->blockSize = blockSize;
+    S->pPairs = pPairs;
+    S->nPairs = nPairs;
+    S->maxLag = maxLag;
+    S->pSpectra = pSpectra;
+    S->pBuffer = pBuffer;
+
+    return 0;
+}
+
+/**
+   @} end of GccPhat group
+ */
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_fir_init_f32.c
+ * Description:  Initialization of the 32-bit floating-point Hilbert transformer
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup HilbertFIR
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 32-bit floating-point Hilbert transformer.
+  @param[out] S            points to the instance of the 32-bit floating-point Hilbert transformer
+  @param[in]  numTaps      number of filter coefficients, 4*k+3 for some k
+  @param[in]  pCoeffs      points to the numTaps filter coefficients in time-reversed order
+  @param[out] pEvenCoeffs  points to a buffer of (numTaps+1)/2 values for the non-zero coefficients
+  @param[in]  pState       points to the state buffer of numTaps+blockSize-1 samples
+  @param[in]  blockSize    maximum number of input samples processed per call
+  @return     0: Success, 1: numTaps is not of the form 4*k+3
+
+  @par The coefficients at the even positions {pCoeffs[0], pCoeffs[2], ..., pCoeffs[numTaps-1]}
+  are copied into pEvenCoeffs, the ones at the odd positions must be zero and are skipped. The
+  state is cleared, and all buffers must stay valid as long as S is used.
+ */
+
+int plp_hilbert_fir_init_f32(plp_hilbert_fir_instance_f32 *S,
+                             uint32_t numTaps,
+                             const float32_t *__restrict__ pCoeffs,
+                             float32_t *__restrict__ pEvenCoeffs,
+                             float32_t *__restrict__ pState,
+                             uint32_t blockSize) {
+
+    uint32_t i;
+
+    if (numTaps % 4 != 3) {
+        return 1;
+    }
+
+    for (i = 0; i < (numTaps + 1) / 2; i++) {
+        pEvenCoeffs[i] = pCoeffs[2 * i];
+    }
+
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = 0;
+    }
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pEvenCoeffs;
+    S->pState = pState;
+    S->blockSize = blockSize;
+
+    return 0;
+}
+
+/**
+  @} end of HilbertFIR group
+ */
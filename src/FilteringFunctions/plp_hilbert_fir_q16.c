@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_fir_q16.c
+ * Description:  Glue code for Hilbert transformation of a 16-bit fixed-point block
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup HilbertFIR Hilbert Transformer
+  Stateful FIR filter approximating the Hilbert transform, i.e. a phase shift of -90 degrees of
+  all frequencies. The filter is antisymmetric with an odd length numTaps = 2*K+1 and K odd, and
+  all coefficients at an even distance from the center are zero, for example the windowed ideal
+  response
+
+  <pre>
+      h[K+d] = -h[K-d] = 2 / (pi * d) * w[K+d]   for odd d,   h[K+d] = 0 for even d
+  </pre>
+
+  The zero coefficients are at the odd positions of the filter, and they are skipped, such that
+  every output needs only (numTaps+1)/2 multiplications. The output is delayed by K samples with
+  respect to the input, hence x[n-K] + j*y[n] is the analytic signal. The parallel versions split
+  the samples of a block across cores.
+ */
+
+/**
+  @addtogroup HilbertFIR
+  @{
+ */
+
+/**
+  @brief Glue code for Hilbert transformation of a 16-bit fixed-point block.
+  @param[in]  S          points to the instance, initialized by plp_hilbert_fir_init_q16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, at most the block size of the instance
+  @param[out] pDst       points to the blockSize output samples
+  @return     none
+
+  @par Fix-Point, Shifting and Saturation
+  The products are accumulated with 32 bits, without intermediate shifts. The sum is shifted by
+  S->shift to the right (with rounding) and saturated to 16 bits.
+ */
+
+void plp_hilbert_fir_q16(const plp_hilbert_fir_instance_q16 *S,
+                         const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_hilbert_fir_q16s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_hilbert_fir_q16s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of HilbertFIR group
+ */
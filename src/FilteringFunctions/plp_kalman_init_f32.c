@@ -0,0 +1,103 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_kalman_init_f32.c
+ * Description:  Initialization of the 32-bit floating-point Kalman filter
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup Kalman Kalman Filter
+  Linear and extended Kalman filter with nStates states and nMeas measurements. The state estimate
+  x and its covariance P are kept in the instance, and are advanced by a prediction
+
+  <pre>
+      x = F * x           (or x = f(x), computed by the caller for an extended Kalman filter)
+      P = F * P * F^T + Q
+  </pre>
+
+  and corrected by a measurement z with
+
+  <pre>
+      y = z - H * x       (or y = z - h(x))
+      S = H * P * H^T + R
+      K = P * H^T * S^-1
+      x = x + K * y
+      P = P - K * H * P
+  </pre>
+
+  For an extended Kalman filter, F and H are the Jacobians of f and h at the current estimate.
+
+  Each step runs in a single kernel without calling the matrix functions. Only the upper triangles
+  of the symmetric matrices P and S are computed and then mirrored. S is factorized with a
+  Cholesky decomposition S = U^T U instead of being inverted, and the Kalman gain is never formed:
+  with W = U^-T * H * P, the correction is x = x + W^T * U^-T * y and P = P - W^T * W, which keeps P
+  symmetric by construction.
+
+  All matrices are stored row-major. The instance needs a work buffer of
+  PLP_KALMAN_WORK_LEN(nStates, nMeas) values for the temporaries.
+ */
+
+/**
+  @addtogroup Kalman
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 32-bit floating-point Kalman filter.
+  @param[out] S        points to the instance of the 32-bit floating-point Kalman filter
+  @param[in]  nStates  number of states N
+  @param[in]  nMeas    number of measurements M per update
+  @param[in]  pX       points to the state estimate of N values, holding the initial state
+  @param[in]  pP       points to the symmetric covariance matrix of shape NxN, holding the initial
+                       covariance
+  @param[in]  pWork    points to a work buffer of PLP_KALMAN_WORK_LEN(nStates, nMeas) values
+  @return     none
+
+  @par The state and covariance are updated in place, and all buffers must stay valid as long as
+  S is used.
+ */
+
+void plp_kalman_init_f32(plp_kalman_instance_f32 *S,
+                         uint32_t nStates,
+                         uint32_t nMeas,
+                         float32_t *pX,
+                         float32_t *pP,
+                         float32_t *pWork) {
+
+    S->nStates = nStates;
+    S->nMeas = nMeas;
+    S->pX = pX;
+    S->pP = pP;
+    S->pWork = pWork;
+}
+
+/**
+  @} end of Kalman group
+ */
@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_kalman_predict_f32.c
+ * Description:  Glue code for the prediction step of the 32-bit floating-point Kalman filter
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Kalman
+  @{
+ */
+
+/**
+  @brief Glue code for the prediction step of the 32-bit floating-point Kalman filter.
+  @param[in]  S      points to the instance, initialized by plp_kalman_init_f32
+  @param[in]  pF     points to the state transition matrix of shape NxN
+  @param[in]  pQ     points to the symmetric process noise covariance of shape NxN
+  @param[in]  pXPred points to the predicted state f(x) of N values of an extended Kalman filter,
+                     or NULL to predict x = F * x
+  @return     none
+ */
+
+void plp_kalman_predict_f32(const plp_kalman_instance_f32 *S,
+                            const float32_t *__restrict__ pF,
+                            const float32_t *__restrict__ pQ,
+                            const float32_t *__restrict__ pXPred) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_kalman_predict_f32s_xpulpv2(S, pF, pQ, pXPred);
+    }
+}
+
+/**
+  @} end of Kalman group
+ */
@@ -0,0 +1,112 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_levinson_durbin_f32.c
+ * Description:  Levinson-Durbin recursion of 32-bit floating-point autocorrelations
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup LevinsonDurbin
+  @{
+ */
+
+/**
+  @brief Levinson-Durbin recursion of a 32-bit floating-point autocorrelation.
+  @param[in]  pR     points to the autocorrelation at the lags 0 to order
+  @param[in]  order  order of the linear predictor
+  @param[out] pA     points to the order+1 coefficients of A(z), where pA[0] is 1
+  @param[out] pK     points to the order reflection coefficients, or NULL
+  @param[out] pErr   prediction error, or NULL
+  @return     0: Success, 1: pR[0] is not positive or a reflection coefficient reaches a
+              magnitude of 1, 2: operation not supported
+
+  @par If the recursion fails, pA and pK hold the coefficients of the last completed order.
+ */
+
+int plp_levinson_durbin_f32(const float32_t *__restrict__ pR,
+                            uint32_t order,
+                            float32_t *__restrict__ pA,
+                            float32_t *__restrict__ pK,
+                            float32_t *__restrict__ pErr) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return 2;
+    } else {
+        uint32_t j, m;
+        float32_t err = pR[0];
+        float32_t acc, k;
+
+        if (!(err > 0.0f)) {
+            return 1;
+        }
+
+        pA[0] = 1.0f;
+
+        for (m = 1; m <= order; m++) {
+            acc = 0.0f;
+            for (j = 0; j < m; j++) {
+                acc += pA[j] * pR[m - j];
+            }
+
+            k = -acc / err;
+            if (!(k < 1.0f && k > -1.0f)) {
+                return 1;
+            }
+
+            for (j = 1; 2 * j < m; j++) {
+                float32_t a0 = pA[j];
+                float32_t a1 = pA[m - j];
+                pA[j] = a0 + k * a1;
+                pA[m - j] = a1 + k * a0;
+            }
+            if (m % 2 == 0) {
+                pA[m / 2] += k * pA[m / 2];
+            }
+            pA[m] = k;
+
+            if (pK != NULL) {
+                pK[m - 1] = k;
+            }
+
+            err *= 1.0f - k * k;
+        }
+
+        if (pErr != NULL) {
+            *pErr = err;
+        }
+
+        return 0;
+    }
+}
+
+/**
+  @} end of LevinsonDurbin group
+ */
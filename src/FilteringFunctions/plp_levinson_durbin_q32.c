@@ -0,0 +1,134 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_levinson_durbin_q32.c
+ * Description:  Levinson-Durbin recursion of 32-bit fixed-point autocorrelations
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup LevinsonDurbin Levinson-Durbin Recursion
+  This module contains the Levinson-Durbin recursion, which computes the coefficients of the
+  linear predictor of a given order from the autocorrelation of a signal, see plp_autocorr. The
+  prediction error filter is
+  \f[
+      A(z) = 1 + \sum_{k=1}^{order} a_k z^{-k}
+  \f]
+  The recursion also returns the reflection coefficients of every order and the energy of the
+  prediction error. It takes O(order^2) operations on scalars, and runs on a single core, both
+  on the fabric controller and on the cluster.
+ */
+
+/**
+  @addtogroup LevinsonDurbin
+  @{
+ */
+
+/**
+  @brief Levinson-Durbin recursion of a 32-bit fixed-point autocorrelation.
+  @param[in]  pR     points to the autocorrelation at the lags 0 to order
+  @param[in]  order  order of the linear predictor
+  @param[out] pA     points to the order+1 coefficients of A(z) in Q4.27, where pA[0] is 1
+  @param[out] pK     points to the order reflection coefficients in Q1.31, or NULL
+  @param[out] pErr   prediction error, in the format of pR, or NULL
+  @return     0: Success, 1: pR[0] is not positive, a reflection coefficient reaches a magnitude
+              of 1, or a coefficient exceeds the range of Q4.27
+
+  @par Fix-Point, Shifting and Saturation
+  The autocorrelation is normalized such that pR[0] uses the full range of 32 bits, every lag must
+  not exceed pR[0] in magnitude. The products of the coefficients and the autocorrelation are
+  accumulated in 64 bits, and every reflection coefficient is computed with a 64-bit division.
+  The content of pA and pK is only valid if the recursion succeeds.
+ */
+
+int plp_levinson_durbin_q32(const int32_t *__restrict__ pR,
+                            uint32_t order,
+                            int32_t *__restrict__ pA,
+                            int32_t *__restrict__ pK,
+                            int32_t *__restrict__ pErr) {
+
+    uint32_t j, m;
+    uint32_t shift;
+    int64_t err, acc, limit;
+    int32_t k;
+
+    if (pR[0] <= 0) {
+        return 1;
+    }
+
+    shift = __builtin_clz(pR[0]) - 1;
+    err = (int64_t)pR[0] << shift;
+    pA[0] = 1 << 27;
+
+    for (m = 1; m <= order; m++) {
+        // prediction of pR[m] with the coefficients of order m-1, in Q23 of the normalized pR
+        acc = 0;
+        for (j = 0; j < m; j++) {
+            acc += ((int64_t)pA[j] * ((int64_t)pR[m - j] << shift)) >> 4;
+        }
+
+        limit = err << 23;
+        if (acc >= limit || acc <= -limit) {
+            return 1;
+        }
+        k = (int32_t)(-(acc << 8) / err);
+
+        for (j = 1; 2 * j <= m; j++) {
+            int64_t a0 = pA[j] + (((int64_t)k * pA[m - j] + (1 << 30)) >> 31);
+            int64_t a1 = pA[m - j] + (((int64_t)k * pA[j] + (1 << 30)) >> 31);
+            if (a0 > 0x7FFFFFFF || a0 < -0x7FFFFFFF - 1 || a1 > 0x7FFFFFFF ||
+                a1 < -0x7FFFFFFF - 1) {
+                return 1;
+            }
+            pA[j] = (int32_t)a0;
+            pA[m - j] = (int32_t)a1;
+        }
+        pA[m] = (int32_t)(((int64_t)k + 8) >> 4);
+
+        if (pK != NULL) {
+            pK[m - 1] = k;
+        }
+
+        // err * (1 - k^2)
+        err -= (((err * k) >> 31) * k) >> 31;
+        if (err <= 0) {
+            return 1;
+        }
+    }
+
+    if (pErr != NULL) {
+        *pErr = (int32_t)(err >> shift);
+    }
+
+    return 0;
+}
+
+/**
+  @} end of LevinsonDurbin group
+ */
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_init_q16.c
+ * Description:  16-bit fixed-point LMS filter instance initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup LMS
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 16-bit fixed-point LMS filter.
+  @param[out] S          points to the instance of the 16-bit fixed-point LMS filter
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the numTaps initial coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of numTaps+blockSize-1 samples
+  @param[in]  mu         step size in Q1.15
+  @param[in]  blockSize  maximum number of samples processed per call
+  @param[in]  postShift  left shift of the filter output, smaller than 15
+  @return     none
+
+  @par The coefficients are stored in time-reversed order, {b[numTaps-1], ..., b[1], b[0]}, and
+  they are updated in place. The state is cleared, and all buffers must stay valid as long as S
+  is used.
+ */
+
+void plp_lms_init_q16(plp_lms_instance_q16 *S,
+                      uint32_t numTaps,
+                      int16_t *pCoeffs,
+                      int16_t *pState,
+                      int16_t mu,
+                      uint32_t blockSize,
+                      uint32_t postShift) {
+
+    uint32_t i;
+
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = 0;
+    }
+
+    S->numTaps = numTaps;
+    S->pState = pState;
+    S->pCoeffs = pCoeffs;
+    S->mu = mu;
+    S->postShift = postShift;
+}
+
+/**
+  @} end of LMS group
+ */
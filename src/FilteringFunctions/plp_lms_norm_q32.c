@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_norm_q32.c
+ * Description:  32-bit fixed-point normalized LMS filter glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup LMSNorm
+  @{
+ */
+
+/**
+  @brief Glue code for normalized LMS filtering of a 32-bit fixed-point block.
+  @param[in]  S          points to the instance, initialized by plp_lms_norm_init_q32
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference samples
+  @param[in]  blockSize  number of samples, at most the block size of the instance
+  @param[out] pOut       points to the block of filter outputs, which may be equal to pSrc
+  @param[out] pErr       points to the block of error samples, which may be equal to pRef
+  @return     none
+
+  @par Fix-Point, Shifting and Saturation
+  The filter output is accumulated with 64 bits, shifted by 31-postShift to the right (with
+  rounding) and saturated to 32 bits. The error, the scaled error mu*e and the coefficients are
+  rounded and saturated to Q1.31.
+  The step size is divided by the energy of the input window in Q1.31 (plus 2^-31), and saturated
+  to 32 bits.
+ */
+
+void plp_lms_norm_q32(plp_lms_norm_instance_q32 *S,
+                      const int32_t *pSrc,
+                      const int32_t *pRef,
+                      uint32_t blockSize,
+                      int32_t *pOut,
+                      int32_t *pErr) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_lms_norm_q32s_rv32im(S, pSrc, pRef, blockSize, pOut, pErr);
+    } else {
+        plp_lms_norm_q32s_xpulpv2(S, pSrc, pRef, blockSize, pOut, pErr);
+    }
+}
+
+/**
+  @} end of LMSNorm group
+ */
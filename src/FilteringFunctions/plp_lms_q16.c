@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_q16.c
+ * Description:  16-bit fixed-point LMS filter glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup LMS Least Mean Square (LMS) Filter
+  Adaptive FIR filter, which updates its coefficients with the least mean square algorithm. For
+  each sample, it computes
+
+  <pre>
+      y[n] = b[0] * x[n] + b[1] * x[n-1] + ... + b[numTaps-1] * x[n-numTaps+1]
+      e[n] = d[n] - y[n]
+      b[k] = b[k] + mu * e[n] * x[n-k]
+  </pre>
+
+  where d[n] is the reference signal. Like the FIR filter, the coefficients are stored in
+  time-reversed order, and the state buffer holds the last numTaps-1 inputs followed by the current
+  block. The coefficient update of sample n and the filter output of sample n+1 are computed in the
+  same pass over the coefficients, such that every coefficient is loaded and stored only once per
+  sample.
+
+  The recursion cannot be split along time. Therefore, the parallel versions adapt multiple
+  independent channels, assigning one channel after the other to each core.
+ */
+
+/**
+  @addtogroup LMS
+  @{
+ */
+
+/**
+  @brief Glue code for LMS filtering of a 16-bit fixed-point block.
+  @param[in]  S          points to the instance, initialized by plp_lms_init_q16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference samples
+  @param[in]  blockSize  number of samples, at most the block size of the instance
+  @param[out] pOut       points to the block of filter outputs, which may be equal to pSrc
+  @param[out] pErr       points to the block of error samples, which may be equal to pRef
+  @return     none
+
+  @par Fix-Point, Shifting and Saturation
+  The filter output is accumulated with 32 bits, shifted by 15-postShift to the right (with
+  rounding) and saturated to 16 bits. The error, the scaled error mu*e and the coefficients are
+  rounded and saturated to Q1.15.
+ */
+
+void plp_lms_q16(const plp_lms_instance_q16 *S,
+                 const int16_t *pSrc,
+                 const int16_t *pRef,
+                 uint32_t blockSize,
+                 int16_t *pOut,
+                 int16_t *pErr) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_lms_q16s_rv32im(S, pSrc, pRef, blockSize, pOut, pErr);
+    } else {
+        plp_lms_q16s_xpulpv2(S, pSrc, pRef, blockSize, pOut, pErr);
+    }
+}
+
+/**
+  @} end of LMS group
+ */
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_q16_parallel.c
+ * Description:  parallel 16-bit fixed-point LMS filter glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup LMS
+  @{
+ */
+
+/**
+  @brief Glue code for parallel multi-channel LMS filtering of a 16-bit fixed-point block.
+  @param[in]  S          points to nChannels instances, initialized by the init function
+  @param[in]  pSrc       points to the input samples, blockSize samples per channel
+  @param[in]  pRef       points to the reference samples, blockSize samples per channel
+  @param[in]  blockSize  number of samples per channel
+  @param[in]  nChannels  number of independent channels
+  @param[in]  nPE        number of cores to use
+  @param[out] pOut       points to the filter output, which may be equal to pSrc
+  @param[out] pErr       points to the error signal, which may be equal to pRef
+  @return     none
+
+  @par Channel c uses the instance S[c], and its samples are stored contiguously at offset
+  c*blockSize of all buffers.
+
+  @par Fix-Point, Shifting and Saturation
+  The filter output is accumulated with 32 bits, shifted by 15-postShift to the right (with
+  rounding) and saturated to 16 bits. The error, the scaled error mu*e and the coefficients are
+  rounded and saturated to Q1.15.
+ */
+
+void plp_lms_q16_parallel(const plp_lms_instance_q16 *S,
+                          const int16_t *pSrc,
+                          const int16_t *pRef,
+                          uint32_t blockSize,
+                          uint32_t nChannels,
+                          uint32_t nPE,
+                          int16_t *pOut,
+                          int16_t *pErr) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_lms_instance_q16_parallel args = { .S = S,
+                                               .pSrc = pSrc,
+                                               .pRef = pRef,
+                                               .blockSize = blockSize,
+                                               .nChannels = nChannels,
+                                               .nPE = nPE,
+                                               .pOut = pOut,
+                                               .pErr = pErr };
+
+        rt_team_fork(nPE, plp_lms_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of LMS group
+ */
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_filter_i16.c
+ * Description:  Glue code for the 16-bit integer median and rank-order filter
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup MedianFilter Median and Rank-Order Filter
+  Sliding-window rank-order filter, which outputs
+
+  <pre>
+      y[n] = sort(x[n-windowLen+1], ..., x[n])[rank]
+  </pre>
+
+  i.e. the value of the given rank in the last windowLen input samples, with rank 0 being the
+  smallest one. An odd windowLen with rank (windowLen-1)/2 gives the median filter, which rejects
+  spikes shorter than half the window. The filter is causal and streams over consecutive blocks,
+  keeping the last windowLen-1 input samples in the state of the instance. The samples before the
+  first block are 0.
+
+  Small windows are sorted from scratch for every output with a sorting network, which is free of
+  data-dependent branches. Windows larger than PLP_MEDIAN_FILTER_NETWORK_LEN are kept sorted
+  instead: every new sample replaces the oldest one, shifting only the values between the old and
+  the new position. The 16-bit fixed-point versions are ordered like 16-bit integers and therefore
+  share the instance and the kernels of the integer versions.
+
+  The parallel versions filter multiple independent channels, assigning one channel after the
+  other to each core.
+ */
+
+/**
+  @addtogroup MedianFilter
+  @{
+ */
+
+/**
+  @brief Glue code for the median and rank-order filter of a 16-bit integer block.
+  @param[in]  S          points to the instance, initialized by plp_median_filter_init_i16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input and output samples
+  @param[out] pDst       points to the block of output samples, which must not overlap pSrc
+  @return     none
+ */
+
+void plp_median_filter_i16(const plp_median_filter_instance_i16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_median_filter_i16s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_median_filter_i16s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of MedianFilter group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_filter_init_i16.c
+ * Description:  Initialization of the 16-bit integer median and rank-order filter
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup MedianFilter
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 16-bit integer median and rank-order filter.
+  @param[out] S          points to the instance of the 16-bit integer median filter
+  @param[in]  windowLen  number of samples in the sliding window, at least 1
+  @param[in]  rank       rank of the output in the sorted window, smaller than windowLen, which
+                         is (windowLen-1)/2 for the median
+  @param[in]  pState     points to the state buffer of 2*windowLen-1 values
+  @return     none
+
+  @par The first windowLen-1 values of the state hold the input history, which is cleared. The
+  remaining windowLen values are used as work buffer. The buffer must stay valid as long as S is
+  used.
+ */
+
+void plp_median_filter_init_i16(plp_median_filter_instance_i16 *S,
+                                uint32_t windowLen,
+                                uint32_t rank,
+                                int16_t *pState) {
+
+    uint32_t i;
+
+    for (i = 0; i < 2 * windowLen - 1; i++) {
+        pState[i] = 0;
+    }
+
+    S->windowLen = windowLen;
+    S->rank = rank;
+    S->pState = pState;
+}
+
+/**
+  @} end of MedianFilter group
+ */
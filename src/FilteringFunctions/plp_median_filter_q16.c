@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_filter_q16.c
+ * Description:  Glue code for the 16-bit fixed-point median and rank-order filter
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup MedianFilter
+  @{
+ */
+
+/**
+  @brief Glue code for the median and rank-order filter of a 16-bit fixed-point block.
+  @param[in]  S          points to the instance, initialized by plp_median_filter_init_i16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input and output samples
+  @param[out] pDst       points to the block of output samples, which must not overlap pSrc
+  @return     none
+
+  @par The 16-bit fixed-point samples are ordered like 16-bit integers, hence this function uses the
+  instance and the kernels of the 16-bit integer version. The output has the format of the input.
+ */
+
+void plp_median_filter_q16(const plp_median_filter_instance_i16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_median_filter_i16s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_median_filter_i16s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of MedianFilter group
+ */
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_filter_q16_parallel.c
+ * Description:  Glue code for the parallel 16-bit fixed-point median and rank-order filter
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup MedianFilter
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel multi-channel median and rank-order filter of 16-bit fixed-point
+         blocks.
+  @param[in]  S          points to nChannels instances, initialized by plp_median_filter_init_i16
+  @param[in]  pSrc       points to the input samples, blockSize samples per channel
+  @param[in]  blockSize  number of samples per channel
+  @param[in]  nChannels  number of independent channels
+  @param[in]  nPE        number of cores to use
+  @param[out] pDst       points to the output samples, which must not overlap pSrc
+  @return     none
+
+  @par Channel c uses the instance S[c], and its samples are stored contiguously at
+  pSrc[c*blockSize] and pDst[c*blockSize].
+
+  @par The 16-bit fixed-point samples are ordered like 16-bit integers, hence this function uses the
+  instances and the kernels of the 16-bit integer version. The output has the format of the input.
+ */
+
+void plp_median_filter_q16_parallel(const plp_median_filter_instance_i16 *S,
+                                    const int16_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    uint32_t nChannels,
+                                    uint32_t nPE,
+                                    int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_median_filter_instance_i16_parallel args = { .S = S,
+                                                         .pSrc = pSrc,
+                                                         .blockSize = blockSize,
+                                                         .nChannels = nChannels,
+                                                         .nPE = nPE,
+                                                         .pDst = pDst };
+
+        rt_team_fork(nPE, plp_median_filter_i16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MedianFilter group
+ */
@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pbconv_f32.c
+ * Description:  Partitioned convolution of a 32-bit floating-point stream glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup PartitionedConvolution Partitioned Convolution
+  Low-latency streaming convolution of a long input signal with a fixed filter, computed in the
+  frequency domain with a uniformly partitioned filter (UPOLS). Unlike the FFT convolution
+  plp_fftconv, whose blocks are longer than the filter, the latency is only one block of blockLen
+  samples, independent of the filter length:
+
+  <pre>
+      pDst[n] = sum_{k=0}^{filterLen-1} pFilter[k] * x[n - k]
+  </pre>
+
+  where x is the concatenation of all inputs since the initialization (with x[n] = 0 for n < 0).
+  The filter is split into numPartitions partitions of blockLen coefficients, whose spectra are
+  computed once by the init function. Every block of the input is transformed once, and its
+  spectrum is kept in a frequency-domain delay line (FDL) of numPartitions spectra. The spectrum of
+  the output block is the sum over p of the spectrum of the input block p blocks ago times the
+  spectrum of partition p.
+ */
+
+/**
+  @addtogroup PartitionedConvolution
+  @{
+ */
+
+/**
+  @brief Glue code for partitioned convolution of a 32-bit floating-point stream.
+  @param[in,out] S           points to the instance, initialized by plp_pbconv_init_f32. The
+                             state and the delay line are updated.
+  @param[in]     pSrc        points to the next numSamples input samples
+  @param[in]     numSamples  number of input and output samples, a multiple of S->blockLen
+  @param[out]    pDst        points to the output buffer of numSamples samples, which must not
+                             overlap with pSrc
+  @return        none
+
+  @par Uniformly Partitioned Overlap-Save
+  Every block of blockLen new samples is extended by the blockLen preceding samples and
+  transformed with plp_rfft_f32 of length fftLen = 2*blockLen. Its bins 0 to blockLen are stored
+  in the oldest slot of the delay line, and multiplied and accumulated with the spectra of all
+  partitions. The accumulated spectrum is completed by conjugate symmetry and transformed back
+  with plp_rifft_f32, and the last blockLen samples of the result are the output block. The cost
+  per block is two transforms of length fftLen and numPartitions*(blockLen+1) complex MACs.
+ */
+
+void plp_pbconv_f32(plp_pbconv_instance_f32 *S,
+                    const float32_t *__restrict__ pSrc,
+                    uint32_t numSamples,
+                    float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        if (numSamples % S->blockLen != 0) {
+            printf("Error: numSamples must be a multiple of blockLen\n");
+            return;
+        }
+        plp_pbconv_f32s_xpulpv2(S, pSrc, numSamples, pDst);
+    }
+}
+
+/**
+  @} end of PartitionedConvolution group
+ */
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pbconv_f32_parallel.c
+ * Description:  Parallel partitioned convolution of a 32-bit floating-point stream glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup PartitionedConvolution
+  @{
+ */
+
+/**
+  @brief Glue code for parallel partitioned convolution of a 32-bit floating-point stream.
+  @param[in,out] S           points to the instance, initialized by plp_pbconv_init_f32. The
+                             state and the delay line are updated.
+  @param[in]     pSrc        points to the next numSamples input samples
+  @param[in]     numSamples  number of input and output samples, a multiple of S->blockLen
+  @param[in]     nPE         number of cores to use
+  @param[out]    pDst        points to the output buffer of numSamples samples, which must not
+                             overlap with pSrc
+  @return        none
+
+  @par The team is forked once per call, and computes the transforms with the parallel FFT
+  kernels. The complex MACs over the partitions are split by frequency bins, such that every core
+  accumulates all partitions of its bins and no reduction between the cores is needed.
+ */
+
+void plp_pbconv_f32_parallel(plp_pbconv_instance_f32 *S,
+                             const float32_t *__restrict__ pSrc,
+                             uint32_t numSamples,
+                             uint32_t nPE,
+                             float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (numSamples % S->blockLen != 0) {
+            printf("Error: numSamples must be a multiple of blockLen\n");
+            return;
+        }
+
+        plp_pbconv_instance_f32_parallel args = {
+            .S = S, .pSrc = pSrc, .numSamples = numSamples, .nPE = nPE, .pDst = pDst
+        };
+
+        rt_team_fork(nPE, plp_pbconv_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of PartitionedConvolution group
+ */
@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pbconv_init_f32.c
+ * Description:  Initialization of the floating-point partitioned convolution
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+ */
+
+/**
+   @addtogroup PartitionedConvolution
+   @{
+ */
+
+/**
+   @brief Initializes an instance of the floating-point partitioned convolution.
+   @param[out] S               points to the instance of the floating-point partitioned convolution
+   @param[in]  pFft            points to the real FFT instance of length fftLen = 2*blockLen, with
+                               bitReverseFlag=1, for example created by plp_cfft_init_f32
+   @param[in]  pFilter         points to the filter coefficients
+   @param[in]  filterLen       number of filter coefficients
+   @param[out] pFilterSpectra  points to a buffer of 2*(blockLen+1)*numPartitions values for the
+                               spectra of the filter partitions
+   @param[out] pFdl            points to a buffer of 2*(blockLen+1)*numPartitions values for the
+                               frequency-domain delay line
+   @param[out] pState          points to a buffer of blockLen values for the past input samples
+   @param[in]  pBuffer         points to a work buffer of 3*fftLen values
+   @return     0: Success, 1: filterLen or the FFT length is not supported
+
+   @par The filter is split into numPartitions = ceil(filterLen / blockLen) partitions of blockLen
+   coefficients. Only the bins 0 to blockLen of every spectrum are stored, since the spectra of
+   real signals are conjugate symmetric. The state and the delay line are cleared, and all buffers
+   must stay valid as long as S is used. This function must be called on the cluster side.
+ */
+
+int plp_pbconv_init_f32(plp_pbconv_instance_f32 *S,
+                        const plp_rfft_instance_f32 *pFft,
+                        const float32_t *__restrict__ pFilter,
+                        uint32_t filterLen,
+                        float32_t *__restrict__ pFilterSpectra,
+                        float32_t *__restrict__ pFdl,
+                        float32_t *__restrict__ pState,
+                        float32_t *__restrict__ pBuffer) {
+
+    uint32_t i, p;
+    uint32_t N = pFft->FFTLength;
+    uint32_t B = N / 2;
+    uint32_t P;
+    float32_t *pTime = pBuffer;
+    float32_t *pFreq = pBuffer + N;
+
+    if (filterLen == 0 || N < 2 || (N & (N - 1)) != 0) {
+        return 1;
+    }
+
+    P = (filterLen + B - 1) / B;
+
+    // spectra of the partitions, zero padded to fftLen
+    for (p = 0; p < P; p++) {
+        for (i = 0; i < N; i++) {
+            pTime[i] = (i < B && p * B + i < filterLen) ? pFilter[p * B + i] : 0.0f;
+        }
+        plp_rfft_f32(pFft, pTime, pFreq);
+        for (i = 0; i < 2 * (B + 1); i++) {
+            pFilterSpectra[2 * (B + 1) * p + i] = pFreq[i];
+        }
+    }
+
+    for (i = 0; i < 2 * (B + 1) * P; i++) {
+        pFdl[i] = 0.0f;
+    }
+    for (i = 0; i < B; i++) {
+        pState[i] = 0.0f;
+    }
+
+    S->S = pFft;
+    S->blockLen = B;
+    S->numPartitions = P;
+    S->pFilterSpectra = pFilterSpectra;
+    S->pFdl = pFdl;
+    S->fdlIndex = 0;
+    S->pState = pState;
+    S->pBuffer = pBuffer;
+
+    return 0;
+}
+
+/**
+   @} end of PartitionedConvolution group
+ */
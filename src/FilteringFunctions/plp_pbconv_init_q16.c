@@ -0,0 +1,141 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pbconv_init_q16.c
+ * Description:  Initialization of the 16-bit fixed-point partitioned convolution
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+ */
+
+/**
+   @addtogroup PartitionedConvolution
+   @{
+ */
+
+/**
+   @brief Initializes an instance of the 16-bit fixed-point partitioned convolution.
+   @param[out] S               points to the instance of the 16-bit fixed-point partitioned
+                               convolution
+   @param[in]  pFft            points to the 32-bit complex FFT instance of length
+                               fftLen = 2*blockLen, for example plp_cfft_sR_q32_len128 or one
+                               created by plp_cfft_init_q32
+   @param[in]  pFilter         points to the filter coefficients in Q1.15
+   @param[in]  filterLen       number of filter coefficients
+   @param[out] pFilterSpectra  points to a buffer of 2*(blockLen+1)*numPartitions values for the
+                               spectra of the filter partitions
+   @param[out] pFdl            points to a buffer of 2*(blockLen+1)*numPartitions values for the
+                               frequency-domain delay line
+   @param[out] pState          points to a buffer of blockLen values for the past input samples
+   @param[in]  pBuffer         points to a work buffer of 2*fftLen values
+   @return     0: Success, 1: filterLen or the FFT length is not supported
+
+   @par The filter is split into numPartitions = ceil(filterLen / blockLen) partitions of blockLen
+   coefficients, and the bins 0 to blockLen of their spectra are stored. The state and the delay
+   line are cleared, and all buffers must stay valid as long as S is used.
+
+   @par Scaling
+   The spectra are stored as DFT(partition) / 2^s in Q1.31, where s is the smallest shift with
+   sum(abs(pFilter)) < 2^s over the whole filter. Therefore, the sum over all partitions stays
+   below one, as in plp_fftconv_init_q16.
+ */
+
+int plp_pbconv_init_q16(plp_pbconv_instance_q16 *S,
+                        const plp_cfft_instance_q32 *pFft,
+                        const int16_t *__restrict__ pFilter,
+                        uint32_t filterLen,
+                        int32_t *__restrict__ pFilterSpectra,
+                        int32_t *__restrict__ pFdl,
+                        int16_t *__restrict__ pState,
+                        int32_t *__restrict__ pBuffer) {
+
+    uint32_t i, p;
+    uint32_t N = pFft->fftLen;
+    uint32_t B = N / 2;
+    uint32_t P;
+    uint32_t log2Len = 0;
+    uint32_t s = 0;
+    uint32_t gain = 0;
+
+    if (filterLen == 0 || N < 2 || (N & (N - 1)) != 0) {
+        return 1;
+    }
+
+    P = (filterLen + B - 1) / B;
+
+    while ((1U << log2Len) < N) {
+        log2Len++;
+    }
+
+    for (i = 0; i < filterLen; i++) {
+        gain += (pFilter[i] < 0) ? -pFilter[i] : pFilter[i];
+    }
+    while (gain >= (1U << (15 + s))) {
+        s++;
+    }
+
+    for (p = 0; p < P; p++) {
+        // DFT(partition) / fftLen, which is scaled to DFT(partition) / 2^s afterwards
+        for (i = 0; i < N; i++) {
+            pBuffer[2 * i] = (i < B && p * B + i < filterLen) ? ((int32_t)pFilter[p * B + i] << 16)
+                                                              : 0;
+            pBuffer[2 * i + 1] = 0;
+        }
+        plp_cfft_q32(pFft, pBuffer, 0, 1, 31);
+
+        for (i = 0; i < 2 * (B + 1); i++) {
+            if (log2Len >= s) {
+                pFilterSpectra[2 * (B + 1) * p + i] = pBuffer[i] << (log2Len - s);
+            } else {
+                pFilterSpectra[2 * (B + 1) * p + i] = pBuffer[i] >> (s - log2Len);
+            }
+        }
+    }
+
+    for (i = 0; i < 2 * (B + 1) * P; i++) {
+        pFdl[i] = 0;
+    }
+    for (i = 0; i < B; i++) {
+        pState[i] = 0;
+    }
+
+    S->S = pFft;
+    S->blockLen = B;
+    S->numPartitions = P;
+    S->pFilterSpectra = pFilterSpectra;
+    S->pFdl = pFdl;
+    S->fdlIndex = 0;
+    S->outShift = 15 - (int32_t)log2Len - (int32_t)s;
+    S->pState = pState;
+    S->pBuffer = pBuffer;
+
+    return 0;
+}
+
+/**
+   @} end of PartitionedConvolution group
+ */
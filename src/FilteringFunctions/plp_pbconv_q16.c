@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pbconv_q16.c
+ * Description:  Partitioned convolution of a 16-bit fixed-point stream glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup PartitionedConvolution
+  @{
+ */
+
+/**
+  @brief Glue code for partitioned convolution of a 16-bit fixed-point stream.
+  @param[in,out] S           points to the instance, initialized by plp_pbconv_init_q16. The
+                             state and the delay line are updated.
+  @param[in]     pSrc        points to the next numSamples input samples in Q1.15
+  @param[in]     numSamples  number of input and output samples, a multiple of S->blockLen
+  @param[out]    pDst        points to the output buffer of numSamples samples in Q1.15, which
+                             must not overlap with pSrc
+  @return        none
+
+  @par Fixed-Point Processing
+  Every input block is transformed with plp_cfft_q32 in Q2.30, and its bins 0 to blockLen are
+  multiplied with the scaled spectra of the partitions in Q1.31 and accumulated in 32 bits. The
+  conjugate of the accumulated spectrum is completed by conjugate symmetry and transformed with
+  the forward transform again, which computes the inverse transform of a real signal. The result
+  is rounded and saturated to Q1.15 with S->outShift, as in plp_fftconv_q16.
+ */
+
+void plp_pbconv_q16(plp_pbconv_instance_q16 *S,
+                    const int16_t *__restrict__ pSrc,
+                    uint32_t numSamples,
+                    int16_t *__restrict__ pDst) {
+
+    if (numSamples % S->blockLen != 0) {
+        printf("Error: numSamples must be a multiple of blockLen\n");
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_pbconv_q16s_rv32im(S, pSrc, numSamples, pDst);
+    } else {
+        plp_pbconv_q16s_xpulpv2(S, pSrc, numSamples, pDst);
+    }
+}
+
+/**
+  @} end of PartitionedConvolution group
+ */
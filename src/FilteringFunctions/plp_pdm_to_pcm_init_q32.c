@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pdm_to_pcm_init_q32.c
+ * Description:  Initialization of the PDM to PCM front end
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup PDMToPCM
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the PDM to PCM front end with 32-bit fixed-point output.
+  @param[out] S          points to the instance of the PDM to PCM front end
+  @param[in]  pCic       points to the CIC decimator, initialized by plp_cic_decimate_init_i32
+  @param[in]  pFir       points to the compensation FIR decimator, initialized by
+                         plp_fir_decimate_init_q32 with a block size of blockSize/R
+  @param[in]  pBuffer    points to a buffer of blockSize/R values for the CIC output
+  @param[in]  blockSize  number of PDM bits processed per call, a multiple of 32 and of R
+  @return     0: Success, 1: blockSize does not match the CIC and FIR decimators
+
+  @par The CIC decimator must not have processed any samples yet, such that every block produces
+  the same number of outputs. All instances and buffers must stay valid as long as S is used.
+ */
+
+int plp_pdm_to_pcm_init_q32(plp_pdm_to_pcm_instance_q32 *S,
+                            plp_cic_decimate_instance_i32 *pCic,
+                            const plp_fir_decimate_instance_q32 *pFir,
+                            int32_t *__restrict__ pBuffer,
+                            uint32_t blockSize) {
+
+    if (blockSize % 32 != 0 || blockSize % pCic->R != 0 || pCic->phase != 0 ||
+        blockSize / pCic->R != pFir->blockSize) {
+        return 1;
+    }
+
+    S->pCic = pCic;
+    S->pFir = pFir;
+    S->pBuffer = pBuffer;
+    S->blockSize = blockSize;
+
+    return 0;
+}
+
+/**
+  @} end of PDMToPCM group
+ */
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pdm_to_pcm_q32.c
+ * Description:  PDM to PCM conversion with 32-bit fixed-point output glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup PDMToPCM PDM to PCM Conversion
+  Front end for PDM microphones, which converts the 1-bit PDM stream to PCM samples in two
+  decimation stages. A CIC decimator (see CICDecimate) reduces the rate by R, working directly on
+  the packed bits, each of which is interpreted as +1 (set) or -1 (cleared). A decimating FIR filter
+  (see FIRDecimate) compensates the passband droop of the CIC, removes the remaining aliases and
+  reduces the rate by M. For example, a 3.072 MHz stream is converted to 16 kHz with R = 48 and
+  M = 4.
+
+  The bits are packed into 32-bit words, the first bit in the least significant bit. The CIC output
+  is in the range [-(R*D)^N, (R*D)^N] before its shift, and the format of the PCM output is set by
+  the shift of the CIC together with the coefficients and the shift of the FIR filter. The parallel
+  versions process independent channels, one channel per core.
+ */
+
+/**
+  @addtogroup PDMToPCM
+  @{
+ */
+
+/**
+  @brief Glue code for PDM to PCM conversion with 32-bit fixed-point output.
+  @param[in]  S          points to the instance, initialized by plp_pdm_to_pcm_init_q32
+  @param[in]  pSrc       points to the blockSize PDM bits, packed into blockSize/32 words
+  @param[in]  blockSize  number of PDM bits, the block size of the instance
+  @param[out] pDst       points to the blockSize/(R*M) PCM samples
+  @return     none
+ */
+
+void plp_pdm_to_pcm_q32(const plp_pdm_to_pcm_instance_q32 *S,
+                        const uint32_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_pdm_to_pcm_q32s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_pdm_to_pcm_q32s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of PDMToPCM group
+ */
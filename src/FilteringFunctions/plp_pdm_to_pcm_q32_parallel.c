@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pdm_to_pcm_q32_parallel.c
+ * Description:  Parallel multi-channel PDM to PCM conversion glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup PDMToPCM
+  @{
+ */
+
+/**
+  @brief Glue code for parallel multi-channel PDM to PCM conversion with 32-bit fixed-point output.
+  @param[in]  S          points to nChannels instances, initialized by plp_pdm_to_pcm_init_q32
+  @param[in]  pSrc       points to the PDM bits, blockSize/32 words per channel
+  @param[in]  blockSize  number of PDM bits per channel, the block size of the instances
+  @param[in]  nChannels  number of independent channels
+  @param[in]  nPE        number of cores to use
+  @param[out] pDst       points to the PCM samples, blockSize/(R*M) per channel
+  @return     none
+
+  @par Channel c uses the instance S[c], which refers to its own CIC and FIR decimators and buffer.
+  Its bits are stored at pSrc[c*blockSize/32] and its outputs at pDst[c*blockSize/(R*M)]. All
+  instances must have the same block size and decimation factors.
+ */
+
+void plp_pdm_to_pcm_q32_parallel(const plp_pdm_to_pcm_instance_q32 *S,
+                                 const uint32_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 uint32_t nChannels,
+                                 uint32_t nPE,
+                                 int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_pdm_to_pcm_instance_q32_parallel args = { .S = S,
+                                                     .pSrc = pSrc,
+                                                     .blockSize = blockSize,
+                                                     .nChannels = nChannels,
+                                                     .nPE = nPE,
+                                                     .pDst = pDst };
+
+        rt_team_fork(nPE, plp_pdm_to_pcm_q32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of PDMToPCM group
+ */
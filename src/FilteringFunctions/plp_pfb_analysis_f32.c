@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pfb_analysis_f32.c
+ * Description:  Polyphase filter bank analysis of 32-bit floating-point samples glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup PolyphaseFilterBank Polyphase Filter Bank
+  Critically sampled uniform filter bank, which splits a complex stream into numChannels = M
+  channels, each decimated by M (analysis), or combines M such channels into one stream
+  (synthesis). The channels are modulated copies of a lowpass prototype filter h of length
+  L = M*T, zero padded if the filter is shorter. The analysis computes every frame r of M input
+  samples the M channel samples
+
+  <pre>
+      pDst[r][k] = sum_{l=0}^{L-1} h[l] * x[r*M + M-1 - l] * exp(j*2*pi*k*l/M)
+  </pre>
+
+  where x is the concatenation of all inputs since the initialization (with x[n] = 0 for n < 0).
+  The synthesis computes every frame r of M channel samples Y[r] the M output samples
+
+  <pre>
+      pDst[r][m] = sum_{t=0}^{T-1} g[m + t*M] * u[r - t][m],
+      u[r][m] = 1/M * sum_{k=0}^{M-1} Y[r][k] * exp(j*2*pi*k*m/M)
+  </pre>
+
+  with the prototype filter g. Both are computed with the polyphase decomposition: branch m of the
+  filter holds the T coefficients h[m + t*M], and filters every M-th sample of the stream. The
+  commutated branches are followed (analysis) or preceded (synthesis) by one transform of length M
+  per frame, such that the cost per frame is M*T complex MACs and one FFT of length M. The frames
+  and the channels are stored frame by frame, as complex samples with interleaved real and
+  imaginary parts.
+ */
+
+/**
+  @addtogroup PolyphaseFilterBank
+  @{
+ */
+
+/**
+  @brief Glue code for polyphase filter bank analysis of 32-bit floating-point samples.
+  @param[in,out] S          points to the instance, initialized by plp_pfb_analysis_init_f32. The
+                            delay lines of the branches are updated.
+  @param[in]     pSrc       points to the next numFrames*numChannels complex input samples
+  @param[in]     numFrames  number of frames
+  @param[out]    pDst       points to the output buffer of numFrames*numChannels complex channel
+                            samples, frame by frame, which must not overlap with pSrc
+  @return        none
+
+  @par The outputs of the branches are written to the output buffer, which is then transformed in
+  place with plp_cfft_f32s_xpulpv2, without any intermediate buffer.
+ */
+
+void plp_pfb_analysis_f32(plp_pfb_analysis_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          uint32_t numFrames,
+                          float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_pfb_analysis_f32s_xpulpv2(S, pSrc, numFrames, pDst);
+    }
+}
+
+/**
+  @} end of PolyphaseFilterBank group
+ */
@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pfb_synthesis_init_f32.c
+ * Description:  Polyphase filter bank synthesis of 32-bit floating-point samples init function
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+ */
+
+/**
+   @addtogroup PolyphaseFilterBank
+   @{
+ */
+
+/**
+   @brief Initializes an instance of the floating-point polyphase filter bank synthesis.
+   @param[out] S          points to the instance of the floating-point polyphase filter bank
+                          synthesis
+   @param[in]  pFft       points to the complex FFT instance of length numChannels, with
+                          bitReverseFlag=1, for example created by plp_cfft_init_f32
+   @param[in]  pFilter    points to the coefficients of the prototype filter
+   @param[in]  filterLen  number of coefficients of the prototype filter
+   @param[out] pCoeffs    points to a buffer of numChannels*tapsPerBranch values for the
+                          coefficients of the branches
+   @param[out] pState     points to a buffer of 2*numChannels*tapsPerBranch values for the delay
+                          lines of the branches
+   @return     0: Success, 1: filterLen or the FFT length is not supported
+
+   @par The number of taps per branch is tapsPerBranch = ceil(filterLen / numChannels). Branch m
+   holds the coefficients pFilter[m + t*numChannels] for t = 0 to tapsPerBranch-1, which are zero
+   beyond the end of the filter. The delay lines are cleared, and all buffers must stay valid as
+   long as S is used.
+ */
+
+int plp_pfb_synthesis_init_f32(plp_pfb_synthesis_instance_f32 *S,
+                               const plp_rfft_instance_f32 *pFft,
+                               const float32_t *__restrict__ pFilter,
+                               uint32_t filterLen,
+                               float32_t *__restrict__ pCoeffs,
+                               float32_t *__restrict__ pState) {
+
+    uint32_t m, t;
+    uint32_t M = pFft->FFTLength;
+    uint32_t T;
+
+    if (filterLen == 0 || M < 2) {
+        return 1;
+    }
+
+    T = (filterLen + M - 1) / M;
+
+    for (m = 0; m < M; m++) {
+        for (t = 0; t < T; t++) {
+            pCoeffs[T * m + t] = (m + t * M < filterLen) ? pFilter[m + t * M] : 0.0f;
+        }
+    }
+
+    for (m = 0; m < 2 * M * T; m++) {
+        pState[m] = 0.0f;
+    }
+
+    S->S = pFft;
+    S->numChannels = M;
+    S->tapsPerBranch = T;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->stateIndex = 0;
+
+    return 0;
+}
+
+/**
+   @} end of PolyphaseFilterBank group
+ */
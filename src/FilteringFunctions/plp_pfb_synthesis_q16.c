@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pfb_synthesis_q16.c
+ * Description:  Polyphase filter bank synthesis of 16-bit fixed-point samples glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup PolyphaseFilterBank
+  @{
+ */
+
+/**
+  @brief Glue code for polyphase filter bank synthesis of 16-bit fixed-point samples.
+  @param[in,out] S          points to the instance, initialized by plp_pfb_synthesis_init_q16. The
+                            delay lines of the branches are updated.
+  @param[in]     pSrc       points to the next numFrames*numChannels complex channel samples in
+                            Q1.15, frame by frame
+  @param[in]     numFrames  number of frames
+  @param[out]    pDst       points to the output buffer of numFrames*numChannels complex samples
+                            in Q1.15, which must not overlap with pSrc
+  @return        none
+
+  @par Fixed-Point Processing
+  Every frame is copied to the output buffer with the channels in reverse order, and transformed
+  in place with the forward transform of plp_cfft_q16, which computes the inverse transform
+  including the scaling by 1/numChannels in Q1.15. The MACs of the branches are accumulated in 32
+  bits, and rounded and saturated to Q1.15.
+ */
+
+void plp_pfb_synthesis_q16(plp_pfb_synthesis_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_pfb_synthesis_q16s_rv32im(S, pSrc, numFrames, pDst);
+    } else {
+        plp_pfb_synthesis_q16s_xpulpv2(S, pSrc, numFrames, pDst);
+    }
+}
+
+/**
+  @} end of PolyphaseFilterBank group
+ */
@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_qmf_analysis_f32.c
+ * Description:  QMF analysis of 32-bit floating-point samples glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup QMF Quadrature Mirror Filter Bank
+  Two-band quadrature mirror filter (QMF) bank, which splits a real stream into a lower and an
+  upper band, each decimated by 2 (analysis), or combines both bands into one stream (synthesis).
+  The upper band is filtered with the mirrored filter (-1)^l * h[l] of the lowpass prototype h of
+  even length L. The analysis computes for every pair of input samples the two band samples
+
+  <pre>
+      pLow[r]  = sum_{l=0}^{L-1} h[l] * x[2r+1 - l]
+      pHigh[r] = sum_{l=0}^{L-1} (-1)^l * h[l] * x[2r+1 - l]
+  </pre>
+
+  where x is the concatenation of all inputs since the initialization (with x[n] = 0 for n < 0).
+  The synthesis computes for every sample of the lower band a and the upper band b the two output
+  samples
+
+  <pre>
+      pDst[2r]   = 2 * sum_{t=0}^{L/2-1} h[2t] * (a[r-t] - b[r-t])
+      pDst[2r+1] = 2 * sum_{t=0}^{L/2-1} h[2t+1] * (a[r-t] + b[r-t])
+  </pre>
+
+  which are the upsampled bands filtered with 2*h and the negated mirrored filter. With a QMF
+  prototype whose coefficients sum up to 1 (e.g. a Johnston filter), the synthesis reconstructs
+  the input of the analysis, delayed by L-2 samples.
+
+  Both are computed at the decimated rate with the polyphase decomposition: branch 0 holds the even
+  coefficients h[2t] and branch 1 the odd coefficients h[2t+1]. The mirrored filter only flips the
+  sign of branch 1, such that both bands are the sum and the difference of the same two branch
+  outputs. A pair of samples costs L MACs for both bands, instead of 4L for two convolutions at the
+  full rate, followed by discarding every other sample.
+
+  The tree functions process an octave tree of numLevels such filter banks, which splits the lower
+  band of every level again, for example for sub-band coding. All levels of a block are processed
+  in a single fork of the team. The synthesis delays the upper band of every level to match the
+  lower band, which passed through the levels below, such that the tree reconstructs the input
+  delayed by (2^numLevels - 1)*(L-2) samples.
+ */
+
+/**
+  @addtogroup QMF
+  @{
+ */
+
+/**
+  @brief Glue code for QMF analysis of 32-bit floating-point samples.
+  @param[in,out] S      points to the instance, initialized by plp_qmf_init_f32. The delay
+                        lines are updated.
+  @param[in]     pSrc   points to the blockSize input samples
+  @param[out]    pLow   points to the blockSize/2 samples of the lower band
+  @param[out]    pHigh  points to the blockSize/2 samples of the upper band
+  @return        none
+
+  @par The two branch outputs of every pair of input samples are computed once, and combined
+  into the samples of both bands.
+ */
+
+void plp_qmf_analysis_f32(const plp_qmf_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          float32_t *__restrict__ pLow,
+                          float32_t *__restrict__ pHigh) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_qmf_analysis_f32s_xpulpv2(S, pSrc, pLow, pHigh);
+    }
+}
+
+/**
+  @} end of QMF group
+ */
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_qmf_analysis_q16.c
+ * Description:  QMF analysis of 16-bit fixed-point samples glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup QMF
+  @{
+ */
+
+/**
+  @brief Glue code for QMF analysis of 16-bit fixed-point samples.
+  @param[in,out] S      points to the instance, initialized by plp_qmf_init_q16. The delay
+                        lines are updated.
+  @param[in]     pSrc   points to the blockSize input samples in Q1.15
+  @param[out]    pLow   points to the blockSize/2 samples of the lower band
+  @param[out]    pHigh  points to the blockSize/2 samples of the upper band
+  @return        none
+
+  @par Fixed-Point Processing
+  The MACs of both branches are accumulated in 32 bits. Their sum and difference are rounded
+  and saturated to Q1.15.
+ */
+
+void plp_qmf_analysis_q16(const plp_qmf_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          int16_t *__restrict__ pLow,
+                          int16_t *__restrict__ pHigh) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_qmf_analysis_q16s_rv32im(S, pSrc, pLow, pHigh);
+    } else {
+        plp_qmf_analysis_q16s_xpulpv2(S, pSrc, pLow, pHigh);
+    }
+}
+
+/**
+  @} end of QMF group
+ */
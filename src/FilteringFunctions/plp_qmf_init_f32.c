@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_qmf_init_f32.c
+ * Description:  QMF bank of 32-bit floating-point samples init function
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup QMF
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 32-bit floating-point QMF bank.
+  @param[out] S          points to the instance of the 32-bit floating-point QMF bank
+  @param[in]  pFilter    points to the coefficients of the lowpass prototype filter
+  @param[in]  numTaps    number of coefficients of the prototype filter, even
+  @param[out] pCoeffs    points to a buffer of numTaps values for the coefficients of the
+                         branches
+  @param[out] pState     points to a buffer of numTaps-2+blockSize values for the delay
+                         lines of the branches
+  @param[in]  blockSize  number of samples at the full rate processed per call, even
+  @return     0: Success, 1: numTaps or blockSize is zero or odd
+
+  @par The instance is used either for the analysis or for the synthesis. Branch 0 holds the
+  even coefficients, and branch 1 the odd coefficients of the prototype, both in
+  time-reversed order. The delay lines are cleared, and all buffers must stay valid as long
+  as S is used.
+ */
+
+int plp_qmf_init_f32(plp_qmf_instance_f32 *S,
+                     const float32_t *__restrict__ pFilter,
+                     uint32_t numTaps,
+                     float32_t *__restrict__ pCoeffs,
+                     float32_t *__restrict__ pState,
+                     uint32_t blockSize) {
+
+    uint32_t k;
+    uint32_t T = numTaps >> 1;
+
+    if (numTaps == 0 || (numTaps & 1) || blockSize == 0 || (blockSize & 1)) {
+        return 1;
+    }
+
+    for (k = 0; k < T; k++) {
+        pCoeffs[k] = pFilter[2 * (T - 1 - k)];
+        pCoeffs[T + k] = pFilter[2 * (T - 1 - k) + 1];
+    }
+
+    for (k = 0; k < numTaps - 2 + blockSize; k++) {
+        pState[k] = 0;
+    }
+
+    S->numTaps = numTaps;
+    S->blockSize = blockSize;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+
+    return 0;
+}
+
+/**
+  @} end of QMF group
+ */
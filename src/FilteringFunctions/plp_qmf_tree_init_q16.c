@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_qmf_tree_init_q16.c
+ * Description:  QMF tree of 16-bit fixed-point samples init function
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup QMF
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 16-bit fixed-point QMF tree.
+  @param[out] S          points to the instance of the 16-bit fixed-point QMF tree
+  @param[out] pStages    points to numLevels QMF bank instances, one per level
+  @param[in]  numLevels  number of levels of the tree
+  @param[in]  pFilter    points to the coefficients of the lowpass prototype filter in Q1.15
+  @param[in]  numTaps    number of coefficients of the prototype filter, even
+  @param[out] pCoeffs    points to a buffer of numTaps values for the coefficients of the
+                         branches, which are shared by all levels
+  @param[out] pState     points to a buffer of
+                         numLevels*(numTaps-2) + 2*(blockSize - (blockSize >> numLevels))
+                         values for the delay lines of all levels
+  @param[out] pDelay     points to a buffer of
+                         (numTaps-2)*(2^numLevels - 1 - numLevels)
+                         + blockSize - (blockSize >> (numLevels-1))
+                         values for the delay of the upper bands in the synthesis, which may be
+                         NULL for the analysis or if numLevels is 1
+  @param[out] pScratch   points to a buffer of 3*blockSize/4 values for the bands of the
+                         inner levels, which may be NULL if numLevels is 1
+  @param[in]  blockSize  number of input samples processed per call, a multiple of
+                         2^numLevels
+  @return     0: Success, 1: numLevels, numTaps or blockSize is not supported
+
+  @par Level l (starting at 0) is initialized with plp_qmf_init_q16 for blocks of
+  blockSize >> l samples, with the same prototype filter for all levels. The instance is
+  used either for the analysis or for the synthesis.
+
+  @par The synthesis delays the upper band of level l by the delay of the levels below it, which
+  is (numTaps-2)*(2^(numLevels-1-l) - 1) samples at the rate of the band.
+ */
+
+int plp_qmf_tree_init_q16(plp_qmf_tree_instance_q16 *S,
+                          plp_qmf_instance_q16 *pStages,
+                          uint32_t numLevels,
+                          const int16_t *__restrict__ pFilter,
+                          uint32_t numTaps,
+                          int16_t *__restrict__ pCoeffs,
+                          int16_t *__restrict__ pState,
+                          int16_t *__restrict__ pDelay,
+                          int16_t *__restrict__ pScratch,
+                          uint32_t blockSize) {
+
+    uint32_t l, k, n;
+
+    if (numLevels == 0 || numLevels > 16 || blockSize % (1 << numLevels) != 0) {
+        return 1;
+    }
+
+    for (l = 0; l < numLevels; l++) {
+        if (plp_qmf_init_q16(&pStages[l], pFilter, numTaps, pCoeffs, pState, blockSize >> l)) {
+            return 1;
+        }
+        pState += numTaps - 2 + (blockSize >> l);
+    }
+
+    if (pDelay != NULL) {
+        n = (numTaps - 2) * ((1 << numLevels) - 1 - numLevels) + blockSize -
+            (blockSize >> (numLevels - 1));
+        for (k = 0; k < n; k++) {
+            pDelay[k] = 0;
+        }
+    }
+
+    S->numLevels = numLevels;
+    S->blockSize = blockSize;
+    S->pStages = pStages;
+    S->pDelay = pDelay;
+    S->pScratch = pScratch;
+
+    return 0;
+}
+
+/**
+  @} end of QMF group
+ */
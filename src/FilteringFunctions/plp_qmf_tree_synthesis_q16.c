@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_qmf_tree_synthesis_q16.c
+ * Description:  QMF tree synthesis of 16-bit fixed-point samples glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup QMF
+  @{
+ */
+
+/**
+  @brief Glue code for QMF tree synthesis of 16-bit fixed-point samples.
+  @param[in,out] S     points to the instance, initialized by plp_qmf_tree_init_q16. The
+                       delay lines of all levels are updated.
+  @param[in]     pSrc  points to the blockSize samples of all bands in Q1.15, stored as by
+                       plp_qmf_tree_analysis_q16
+  @param[out]    pDst  points to the output buffer of blockSize samples, which must not
+                       overlap with pSrc
+  @return        none
+
+  @par The levels are combined from the deepest one to the first one. The outputs of the
+  inner levels are stored in the scratch buffer of the instance, and the upper bands wait
+  in its delay lines for the delay of the levels below.
+ */
+
+void plp_qmf_tree_synthesis_q16(const plp_qmf_tree_instance_q16 *S,
+                                const int16_t *__restrict__ pSrc,
+                                int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_qmf_tree_synthesis_q16s_rv32im(S, pSrc, pDst);
+    } else {
+        plp_qmf_tree_synthesis_q16s_xpulpv2(S, pSrc, pDst);
+    }
+}
+
+/**
+  @} end of QMF group
+ */
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_q16.c
+ * Description:  Glue code for polyphase resampling of a 16-bit fixed-point block
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup Resample Polyphase Resampler
+  Sample-rate conversion by the rational factor L/M, for example L=160, M=147 from 44.1 kHz to
+  48 kHz. The input is conceptually upsampled by L (inserting L-1 zeros after every sample),
+  filtered by an anti-aliasing FIR filter h of numTaps coefficients and decimated by M. Only the
+  outputs which are kept are computed, each with a single polyphase branch of numTaps/L
+  coefficients:
+
+  <pre>
+      y[m] = sum_k h[j + k*L] * x[n - k],   n = floor(m*M / L),  j = (m*M) mod L
+  </pre>
+
+  The coefficients are reordered into the L branches during initialization like for the
+  interpolating FIR filter, such that every output is a contiguous dot product with the state
+  buffer, computed by the dot product kernels. The position of the next output is kept in the
+  instance, hence blocks of any length can be processed one after the other, and every call
+  returns the number of produced outputs, at most PLP_RESAMPLE_DST_LEN(blockSize, L, M). For a
+  gain of one, the filter must have a DC gain of L. The parallel versions process independent
+  channels, one channel per core.
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/**
+  @brief Glue code for polyphase resampling of a 16-bit fixed-point block.
+  @param[in]  S          points to the instance, initialized by plp_resample_init_q16
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples, at most the block size of the instance
+  @param[out] pDst       points to the output samples, at most
+                         PLP_RESAMPLE_DST_LEN(blockSize, L, M)
+  @return     number of output samples written to pDst
+
+  @par Fix-Point, Shifting and Saturation
+  The products are accumulated with 32 bits, without intermediate shifts. The sum is shifted by
+  S->shift to the right (with rounding) and saturated to 16 bits.
+ */
+
+uint32_t plp_resample_q16(plp_resample_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        return plp_resample_q16s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        return plp_resample_q16s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of Resample group
+ */
@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_resample_q16_parallel.c
+ * Description:  Glue code for parallel polyphase resampling of a 16-bit fixed-point block
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/**
+  @brief Glue code for parallel multi-channel polyphase resampling of a 16-bit fixed-point block.
+  @param[in]  S          points to nChannels instances, initialized by plp_resample_init_q16
+  @param[in]  pSrc       points to the input samples, blockSize samples per channel
+  @param[in]  blockSize  number of input samples per channel
+  @param[in]  nChannels  number of independent channels
+  @param[in]  nPE        number of cores to use
+  @param[out] pDst       points to the output samples, PLP_RESAMPLE_DST_LEN(blockSize, L, M) per
+                         channel
+  @return     number of output samples written per channel
+
+  @par Channel c uses the instance S[c], and its input samples are stored contiguously at
+  pSrc[c*blockSize]. Its outputs are stored at pDst[c*PLP_RESAMPLE_DST_LEN(blockSize, L, M)]. All
+  instances must have the same L, M and position, i.e. they were initialized together and
+  processed the same number of samples, such that all channels produce the same number of outputs.
+
+  @par Fix-Point, Shifting and Saturation
+  The products are accumulated with 32 bits, without intermediate shifts. The sum is shifted by
+  S->shift to the right (with rounding) and saturated to 16 bits.
+ */
+
+uint32_t plp_resample_q16_parallel(plp_resample_instance_q16 *S,
+                                   const int16_t *pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t nChannels,
+                                   uint32_t nPE,
+                                   int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return 0;
+    } else {
+        uint32_t end = blockSize * S->L;
+        uint32_t numOut = (S->phase < end) ? (end - S->phase + S->M - 1) / S->M : 0;
+
+        plp_resample_instance_q16_parallel args = { .S = S,
+                                                   .pSrc = pSrc,
+                                                   .blockSize = blockSize,
+                                                   .nChannels = nChannels,
+                                                   .nPE = nPE,
+                                                   .pDst = pDst };
+
+        rt_team_fork(nPE, plp_resample_q16p_xpulpv2, (void *)&args);
+
+        return numOut;
+    }
+}
+
+/**
+  @} end of Resample group
+ */
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_viterbi_k7_init_q16.c
+ * Description:  Initialization function for the 16-bit fixed-point K=7 Viterbi decoder
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Viterbi
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 16-bit fixed-point K=7 rate 1/2 Viterbi decoder.
+  @param[out] S           points to the instance of the 16-bit fixed-point Viterbi decoder
+  @param[in]  poly0       generator polynomial of the first coded bit, e.g. 0171 (octal). Bit 0
+                          taps the current input bit and bit 6 the oldest one, and both must be
+                          set.
+  @param[in]  poly1       generator polynomial of the second coded bit, e.g. 0133 (octal), with
+                          bits 0 and 6 set
+  @param[in]  terminated  1 if every block ends with K-1 = 6 zero tail bits, such that the
+                          traceback starts in state 0, or 0 to start in the best state
+  @param[in]  pDecisions  points to the traceback buffer of 2*numBits words, or nPE*2*numBits
+                          words for the parallel version, preferably in L1
+  @return     none
+
+  @par The buffer must stay valid as long as S is used.
+ */
+
+void plp_viterbi_k7_init_q16(plp_viterbi_k7_instance_q16 *S,
+                             uint8_t poly0,
+                             uint8_t poly1,
+                             uint8_t terminated,
+                             uint32_t *pDecisions) {
+
+    S->poly0 = poly0;
+    S->poly1 = poly1;
+    S->terminated = terminated;
+    S->pDecisions = pDecisions;
+}
+
+/**
+  @} end of Viterbi group
+ */
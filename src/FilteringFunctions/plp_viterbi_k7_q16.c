@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_viterbi_k7_q16.c
+ * Description:  Glue code for the 16-bit fixed-point K=7 Viterbi decoder
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup Viterbi Viterbi Decoder
+  Soft-decision Viterbi decoder of the rate 1/2 convolutional code with constraint length K = 7,
+  e.g. the code with the generator polynomials 0171 and 0133 (octal) used by IEEE 802.11 and
+  many narrowband modems. The encoder starts in state 0 and shifts every input bit b into its
+  state s, which holds the last 6 input bits with the newest one in bit 0, and emits the two
+  coded bits
+
+  <pre>
+      c0 = parity(((s << 1) | b) & poly0)
+      c1 = parity(((s << 1) | b) & poly1)
+  </pre>
+
+  The decoder takes two soft values per bit in Q1.15, where a positive value stands for the coded
+  bit 0 (e.g. BPSK with 0 -> +1) and its magnitude for the confidence. For every bit, the
+  add-compare-select (ACS) step adds the correlation of the soft values with the expected coded
+  bits to the path metrics of the 64 states and keeps the better of both paths into every state.
+  Its decision bits are stored in the traceback buffer of the instance, 2 words per bit, and the
+  decoded bits are found by following the decisions backwards from the last state.
+
+  The path metrics are 16-bit values, which are renormalized after every bit. The soft values
+  are shifted right by PLP_VITERBI_K7_SHIFT bits, such that the metrics cannot overflow, hence
+  they should use the full Q1.15 range. The ACS butterflies of the XPULPV2 version work on two
+  states at a time with pv.add.h, pv.sub.h and pv.max.h.
+
+  The decoded bits are packed into words, with bit t in bit t%32 of word t/32. The parallel
+  version decodes multiple independent blocks, assigning one block after the other to each
+  core.
+ */
+
+/**
+  @addtogroup Viterbi
+  @{
+ */
+
+/**
+  @brief Glue code for the Viterbi decoding of a block with 16-bit fixed-point soft values.
+  @param[in]  S        points to the instance, initialized by plp_viterbi_k7_init_q16
+  @param[in]  pSrc     points to the 2*numBits soft values in Q1.15, two per coded bit
+  @param[in]  numBits  number of bits of the block, including the tail bits
+  @param[out] pDst     points to the (numBits+31)/32 words of decoded bits
+  @return     none
+ */
+
+void plp_viterbi_k7_q16(const plp_viterbi_k7_instance_q16 *S,
+                        const int16_t *__restrict__ pSrc,
+                        uint32_t numBits,
+                        uint32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_viterbi_k7_q16s_rv32im(S, pSrc, numBits, pDst);
+    } else {
+        plp_viterbi_k7_q16s_xpulpv2(S, pSrc, numBits, pDst);
+    }
+}
+
+/**
+  @} end of Viterbi group
+ */
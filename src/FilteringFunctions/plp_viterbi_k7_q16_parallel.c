@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_viterbi_k7_q16_parallel.c
+ * Description:  Glue code for the parallel 16-bit fixed-point K=7 Viterbi decoder
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Viterbi
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel Viterbi decoding of independent blocks with 16-bit
+         fixed-point soft values.
+  @param[in]  S        points to the instance, initialized by plp_viterbi_k7_init_q16
+  @param[in]  pSrc     points to the soft values in Q1.15, 2*numBits values per block
+  @param[in]  numBits  number of bits per block, including the tail bits
+  @param[in]  nBlocks  number of independent blocks
+  @param[in]  nPE      number of cores to use
+  @param[out] pDst     points to the decoded bits, (numBits+31)/32 words per block
+  @return     none
+
+  @par Block b is stored contiguously at pSrc[b*2*numBits] and pDst[b*((numBits+31)/32)]. Every
+  core uses 2*numBits words of the traceback buffer of S.
+ */
+
+void plp_viterbi_k7_q16_parallel(const plp_viterbi_k7_instance_q16 *S,
+                                 const int16_t *__restrict__ pSrc,
+                                 uint32_t numBits,
+                                 uint32_t nBlocks,
+                                 uint32_t nPE,
+                                 uint32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_viterbi_k7_instance_q16_parallel args = { .S = S,
+                                                      .pSrc = pSrc,
+                                                      .numBits = numBits,
+                                                      .nBlocks = nBlocks,
+                                                      .nPE = nPE,
+                                                      .pDst = pDst };
+
+        rt_team_fork(nPE, plp_viterbi_k7_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of Viterbi group
+ */
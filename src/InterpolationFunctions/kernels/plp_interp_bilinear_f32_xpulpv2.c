@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_interp_bilinear_f32_xpulpv2.c
+ * Description:  Bilinear interpolation of 32-bit floating-point values for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// splits the position x into the grid point, the offset of the next grid point (step, 0 at the
+// borders) and the fraction
+static inline void plp_interp_bilinear_f32_pos(
+    float32_t x, int32_t last, int32_t step, int32_t *pIndex, int32_t *pStep, float32_t *pFract) {
+    if (!(x > 0.0f)) {
+        *pIndex = 0;
+        *pStep = 0;
+        *pFract = 0.0f;
+    } else if (x >= (float32_t)last) {
+        *pIndex = last;
+        *pStep = 0;
+        *pFract = 0.0f;
+    } else {
+        int32_t k = (int32_t)x;
+        *pIndex = k;
+        *pStep = step;
+        *pFract = x - k;
+    }
+}
+
+/**
+  @ingroup BilinearInterpolate
+ */
+
+/**
+  @addtogroup BilinearInterpolateKernels
+  @{
+ */
+
+/**
+  @brief Bilinear interpolation of 32-bit floating-point values for XPULPV2 extension.
+  @param[in]  S          points to the instance
+  @param[in]  pX         points to the numX column positions (see the instance)
+  @param[in]  numX       number of columns of the result
+  @param[in]  pY         points to the numY row positions (see the instance)
+  @param[in]  numY       number of rows of the result
+  @param[out] pDst       points to the numY x numX result, row by row
+  @return     none
+ */
+
+void plp_interp_bilinear_f32s_xpulpv2(const plp_interp_bilinear_instance_f32 *S,
+                                      const float32_t *__restrict__ pX,
+                                      uint32_t numX,
+                                      const float32_t *__restrict__ pY,
+                                      uint32_t numY,
+                                      float32_t *__restrict__ pDst) {
+
+    const float32_t *pData = S->pData;
+    int32_t numCols = (int32_t)S->numCols;
+    int32_t lastRow = (int32_t)S->numRows - 1;
+    int32_t lastCol = numCols - 1;
+    float32_t *pOut = pDst;
+    uint32_t i, j;
+
+    for (i = 0; i < numY; i++) {
+        int32_t r, rStep;
+        float32_t fy;
+        const float32_t *pRow;
+
+        plp_interp_bilinear_f32_pos(pY[i], lastRow, numCols, &r, &rStep, &fy);
+        pRow = &pData[r * numCols];
+
+        for (j = 0; j < numX; j++) {
+            int32_t c, cStep;
+            float32_t fx, y0, y1;
+
+            plp_interp_bilinear_f32_pos(pX[j], lastCol, 1, &c, &cStep, &fx);
+            y0 = pRow[c] + fx * (pRow[c + cStep] - pRow[c]);
+            y1 = pRow[c + rStep] + fx * (pRow[c + rStep + cStep] - pRow[c + rStep]);
+            *pOut++ = y0 + fy * (y1 - y0);
+        }
+    }
+}
+
+/**
+  @brief Parallel bilinear interpolation of 32-bit floating-point values for XPULPV2 extension.
+  @param[in]  args  points to the plp_interp_bilinear_instance_f32_parallel
+  @return     none
+
+  @par Parallelization
+  Every core computes a chunk of the rows of the result.
+ */
+
+void plp_interp_bilinear_f32p_xpulpv2(void *args) {
+    plp_interp_bilinear_instance_f32_parallel *a =
+        (plp_interp_bilinear_instance_f32_parallel *)args;
+    uint32_t start, end;
+
+    plp_team_chunk(a->numY, a->nPE, rt_core_id(), 1, &start, &end);
+    if (start < end) {
+        plp_interp_bilinear_f32s_xpulpv2(a->S, a->pX, a->numX, &a->pY[start], end - start,
+                                         &a->pDst[start * a->numX]);
+    }
+}
+
+/**
+  @} end of BilinearInterpolateKernels group
+ */
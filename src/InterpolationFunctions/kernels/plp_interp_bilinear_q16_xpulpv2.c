@@ -0,0 +1,141 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_interp_bilinear_q16_xpulpv2.c
+ * Description:  Bilinear interpolation of 16-bit fixed-point values for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// splits the Q12.20 position x into the grid point, the offset of the next grid point (step,
+// 0 at the borders) and the fraction, rounded to Q1.15
+static inline void plp_interp_bilinear_q16_pos(
+    int32_t x, int32_t last, int32_t step, int32_t *pIndex, int32_t *pStep, int32_t *pFract) {
+    int32_t xr = ((x >> 4) + 1) >> 1; // rounded to Q12.15
+    int32_t k = xr >> 15;
+
+    if (x < 0) {
+        *pIndex = 0;
+        *pStep = 0;
+        *pFract = 0;
+    } else if (k >= last) {
+        *pIndex = last;
+        *pStep = 0;
+        *pFract = 0;
+    } else {
+        *pIndex = k;
+        *pStep = step;
+        *pFract = xr & 0x7FFF;
+    }
+}
+
+/**
+  @ingroup BilinearInterpolate
+ */
+
+/**
+  @addtogroup BilinearInterpolateKernels
+  @{
+ */
+
+/**
+  @brief Bilinear interpolation of 16-bit fixed-point values for XPULPV2 extension.
+  @param[in]  S          points to the instance
+  @param[in]  pX         points to the numX column positions in Q12.20
+  @param[in]  numX       number of columns of the result
+  @param[in]  pY         points to the numY row positions in Q12.20
+  @param[in]  numY       number of rows of the result
+  @param[out] pDst       points to the numY x numX result, row by row
+  @return     none
+
+  @par Each of the three interpolations is computed with a single pv.sdotsp.h.
+ */
+
+void plp_interp_bilinear_q16s_xpulpv2(const plp_interp_bilinear_instance_q16 *S,
+                                      const int32_t *__restrict__ pX,
+                                      uint32_t numX,
+                                      const int32_t *__restrict__ pY,
+                                      uint32_t numY,
+                                      int16_t *__restrict__ pDst) {
+
+    const int16_t *pData = S->pData;
+    int32_t numCols = (int32_t)S->numCols;
+    int32_t lastRow = (int32_t)S->numRows - 1;
+    int32_t lastCol = numCols - 1;
+    int16_t *pOut = pDst;
+    uint32_t i, j;
+
+    for (i = 0; i < numY; i++) {
+        int32_t r, rStep, fy;
+        const int16_t *pRow;
+        v2s wy;
+
+        plp_interp_bilinear_q16_pos(pY[i], lastRow, numCols, &r, &rStep, &fy);
+        pRow = &pData[r * numCols];
+        wy = __PACK2(-fy, fy);
+
+        for (j = 0; j < numX; j++) {
+            int32_t c, cStep, fx;
+            int32_t y00, y01, y10, y11, y0, y1;
+            v2s wx;
+
+            plp_interp_bilinear_q16_pos(pX[j], lastCol, 1, &c, &cStep, &fx);
+            wx = __PACK2(-fx, fx);
+            y00 = pRow[c];
+            y01 = pRow[c + cStep];
+            y10 = pRow[c + rStep];
+            y11 = pRow[c + rStep + cStep];
+
+            y0 = (__SUMDOTP2(__PACK2(y00, y01), wx, y00 * 32768) + 0x4000) >> 15;
+            y1 = (__SUMDOTP2(__PACK2(y10, y11), wx, y10 * 32768) + 0x4000) >> 15;
+            y0 = __SUMDOTP2(__PACK2(y0, y1), wy, y0 * 32768);
+            *pOut++ = (int16_t)((y0 + 0x4000) >> 15);
+        }
+    }
+}
+
+/**
+  @brief Parallel bilinear interpolation of 16-bit fixed-point values for XPULPV2 extension.
+  @param[in]  args  points to the plp_interp_bilinear_instance_q16_parallel
+  @return     none
+
+  @par Parallelization
+  Every core computes a chunk of the rows of the result.
+ */
+
+void plp_interp_bilinear_q16p_xpulpv2(void *args) {
+    plp_interp_bilinear_instance_q16_parallel *a =
+        (plp_interp_bilinear_instance_q16_parallel *)args;
+    uint32_t start, end;
+
+    plp_team_chunk(a->numY, a->nPE, rt_core_id(), 1, &start, &end);
+    if (start < end) {
+        plp_interp_bilinear_q16s_xpulpv2(a->S, a->pX, a->numX, &a->pY[start], end - start,
+                                         &a->pDst[start * a->numX]);
+    }
+}
+
+/**
+  @} end of BilinearInterpolateKernels group
+ */
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_interp_linear_q16s_rv32im.c
+ * Description:  Linear interpolation of 16-bit fixed-point values for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup LinearInterpolate
+ */
+
+/**
+  @defgroup LinearInterpolateKernels Linear Interpolation Kernels
+  @{
+ */
+
+/**
+  @brief Linear interpolation of 16-bit fixed-point values for RV32IM extension.
+  @param[in]  S          points to the instance
+  @param[in]  pX         points to the blockSize positions in Q12.20
+  @param[in]  blockSize  number of positions
+  @param[out] pDst       points to the blockSize interpolated values
+  @return     none
+ */
+
+void plp_interp_linear_q16s_rv32im(const plp_interp_linear_instance_q16 *S,
+                                   const int32_t *__restrict__ pX,
+                                   uint32_t blockSize,
+                                   int16_t *__restrict__ pDst) {
+
+    const int16_t *pY = S->pYData;
+    int32_t last = (int32_t)S->nValues - 1;
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        int32_t x = pX[i];
+        int32_t xr = ((x >> 4) + 1) >> 1; // rounded to Q12.15
+        int32_t k = xr >> 15;
+
+        if (x < 0) {
+            pDst[i] = pY[0];
+        } else if (k >= last) {
+            pDst[i] = pY[last];
+        } else {
+            int32_t f = xr & 0x7FFF;
+            int32_t y0 = pY[k];
+            int32_t y1 = pY[k + 1];
+            pDst[i] = (int16_t)(y0 + ((f * (y1 - y0) + 0x4000) >> 15));
+        }
+    }
+}
+
+/**
+  @} end of LinearInterpolateKernels group
+ */
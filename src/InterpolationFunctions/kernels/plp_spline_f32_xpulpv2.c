@@ -0,0 +1,101 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spline_f32_xpulpv2.c
+ * Description:  Cubic spline interpolation of 32-bit floating-point values for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup SplineInterpolate
+ */
+
+/**
+  @addtogroup SplineInterpolateKernels
+  @{
+ */
+
+/**
+  @brief Cubic spline interpolation of 32-bit floating-point values for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_spline_init_f32
+  @param[in]  pX         points to the blockSize positions (see the instance)
+  @param[in]  blockSize  number of positions
+  @param[out] pDst       points to the blockSize interpolated values
+  @return     none
+ */
+
+void plp_spline_f32s_xpulpv2(const plp_spline_instance_f32 *S,
+                             const float32_t *__restrict__ pX,
+                             uint32_t blockSize,
+                             float32_t *__restrict__ pDst) {
+
+    const float32_t *pY = S->pYData;
+    const float32_t *pC = S->pCoeffs;
+    float32_t x1 = S->x1;
+    float32_t invSpacing = 1.0f / S->xSpacing;
+    float32_t xLast = (float32_t)(S->nValues - 1);
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        float32_t x = (pX[i] - x1) * invSpacing;
+
+        if (!(x > 0.0f)) {
+            pDst[i] = pY[0];
+        } else if (x >= xLast) {
+            pDst[i] = pY[S->nValues - 1];
+        } else {
+            int32_t k = (int32_t)x;
+            float32_t t = x - k;
+            float32_t s = 1.0f - t;
+            float32_t y0 = pY[k];
+
+            pDst[i] = y0 + t * (pY[k + 1] - y0) + (s * s - 1.0f) * s * pC[2 * k] +
+                      (t * t - 1.0f) * t * pC[2 * k + 1];
+        }
+    }
+}
+
+/**
+  @brief Parallel cubic spline interpolation of 32-bit floating-point values for XPULPV2 extension.
+  @param[in]  args  points to the plp_spline_instance_f32_parallel
+  @return     none
+
+  @par Parallelization
+  Every core interpolates a chunk of the positions.
+ */
+
+void plp_spline_f32p_xpulpv2(void *args) {
+    plp_spline_instance_f32_parallel *a = (plp_spline_instance_f32_parallel *)args;
+    uint32_t start, end;
+
+    plp_team_chunk(a->blockSize, a->nPE, rt_core_id(), 1, &start, &end);
+    if (start < end) {
+        plp_spline_f32s_xpulpv2(a->S, &a->pX[start], end - start, &a->pDst[start]);
+    }
+}
+
+/**
+  @} end of SplineInterpolateKernels group
+ */
@@ -0,0 +1,119 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spline_q16_xpulpv2.c
+ * Description:  Cubic spline interpolation of 16-bit fixed-point values for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// weights 2 * (s^3 - s) = -2 * s * t * (1 + s) and 2 * (t^3 - t) = -2 * s * t * (1 + t) of the
+// coefficients M / 12, in Q1.15, with s = 1 - t
+static inline void plp_spline_q16_weights(int32_t t, int32_t *pA, int32_t *pB) {
+    int32_t s = 0x8000 - t;
+    int32_t st = (s * t + 0x1000) >> 13; // Q2.17, at most 1/4
+
+    *pA = -((st * (0x8000 + s) + 0x8000) >> 16);
+    *pB = -((st * (0x8000 + t) + 0x8000) >> 16);
+}
+
+/**
+  @ingroup SplineInterpolate
+ */
+
+/**
+  @addtogroup SplineInterpolateKernels
+  @{
+ */
+
+/**
+  @brief Cubic spline interpolation of 16-bit fixed-point values for XPULPV2 extension.
+  @param[in]  S          points to the instance, initialized by plp_spline_init_q16
+  @param[in]  pX         points to the blockSize positions in Q12.20
+  @param[in]  blockSize  number of positions
+  @param[out] pDst       points to the blockSize interpolated values
+  @return     none
+
+  @par The coefficients of an interval are loaded as one word, and applied with
+  pv.dotsp.h.
+ */
+
+void plp_spline_q16s_xpulpv2(const plp_spline_instance_q16 *S,
+                             const int32_t *__restrict__ pX,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pDst) {
+
+    const int16_t *pY = S->pYData;
+    const int16_t *pC = S->pCoeffs;
+    int32_t last = (int32_t)S->nValues - 1;
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        int32_t x = pX[i];
+        int32_t xr = ((x >> 4) + 1) >> 1; // rounded to Q12.15
+        int32_t k = xr >> 15;
+
+        if (x < 0) {
+            pDst[i] = pY[0];
+        } else if (k >= last) {
+            pDst[i] = pY[last];
+        } else {
+            int32_t f = xr & 0x7FFF;
+            int32_t y0 = pY[k];
+            int32_t y1 = pY[k + 1];
+            int32_t a, b, lin, cur, y;
+
+            plp_spline_q16_weights(f, &a, &b);
+            lin = __SUMDOTP2(__PACK2(y0, y1), __PACK2(-f, f), y0 * 32768);
+            cur = __DOTP2(*(v2s *)&pC[2 * k], __PACK2(a, b));
+
+            // both terms are halved, since their sum may overflow 32 bits
+            y = ((lin >> 1) + (cur >> 1) + 0x2000) >> 14;
+            pDst[i] = (int16_t)(__CLIP(y, 15));
+        }
+    }
+}
+
+/**
+  @brief Parallel cubic spline interpolation of 16-bit fixed-point values for XPULPV2 extension.
+  @param[in]  args  points to the plp_spline_instance_q16_parallel
+  @return     none
+
+  @par Parallelization
+  Every core interpolates a chunk of the positions.
+ */
+
+void plp_spline_q16p_xpulpv2(void *args) {
+    plp_spline_instance_q16_parallel *a = (plp_spline_instance_q16_parallel *)args;
+    uint32_t start, end;
+
+    plp_team_chunk(a->blockSize, a->nPE, rt_core_id(), 1, &start, &end);
+    if (start < end) {
+        plp_spline_q16s_xpulpv2(a->S, &a->pX[start], end - start, &a->pDst[start]);
+    }
+}
+
+/**
+  @} end of SplineInterpolateKernels group
+ */
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_interp_bilinear_f32_parallel.c
+ * Description:  Glue code for the parallel bilinear interpolation of 32-bit floating-point values
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup BilinearInterpolate
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel bilinear interpolation of 32-bit floating-point values.
+  @param[in]  S          points to the instance
+  @param[in]  pX         points to the numX column positions (see the instance)
+  @param[in]  numX       number of columns of the result
+  @param[in]  pY         points to the numY row positions (see the instance)
+  @param[in]  numY       number of rows of the result
+  @param[in]  nPE        number of cores to use
+  @param[out] pDst       points to the numY x numX result, row by row
+  @return     none
+
+  @par Parallelization
+  The rows of the result are split into nPE chunks, one for every core.
+ */
+
+void plp_interp_bilinear_f32_parallel(const plp_interp_bilinear_instance_f32 *S,
+                                      const float32_t *__restrict__ pX,
+                                      uint32_t numX,
+                                      const float32_t *__restrict__ pY,
+                                      uint32_t numY,
+                                      uint32_t nPE,
+                                      float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_interp_bilinear_instance_f32_parallel args = {
+            .S = S, .pX = pX, .numX = numX, .pY = pY, .numY = numY, .nPE = nPE, .pDst = pDst
+        };
+
+        rt_team_fork(nPE, plp_interp_bilinear_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of BilinearInterpolate group
+ */
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_interp_bilinear_q16.c
+ * Description:  Glue code for the bilinear interpolation of 16-bit fixed-point values
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @defgroup BilinearInterpolate Bilinear Interpolation
+  Bilinear interpolation on a grid of numRows x numCols samples, stored row by row. The value at
+  the position (x, y) inside the cell with the upper left corner (r, c) is interpolated along
+  the columns in the rows r and r + 1, and then along the rows,
+
+  <pre>
+      y0    = d[r][c]     + tx * (d[r][c + 1]     - d[r][c])
+      y1    = d[r + 1][c] + tx * (d[r + 1][c + 1] - d[r + 1][c])
+      d(x, y) = y0        + ty * (y1 - y0)
+  </pre>
+
+  where tx = x - c and ty = y - r. The functions evaluate the grid on the numY x numX points
+  given by the column positions pX and the row positions pY, e.g. to rescale an image or to look
+  up a two-dimensional calibration table, and store the result row by row. The positions are in
+  units of the grid points, as Q12.20 values for the 16-bit version, and are clamped to the grid.
+  The grid needs at least two rows and two columns.
+
+  Every 16-bit interpolation computes y0 * 2^15 + t * (y1 - y0) with a single pv.sdotsp.h on the
+  cluster. The parallel versions split the rows of the result among the cores.
+ */
+
+/**
+  @addtogroup BilinearInterpolate
+  @{
+ */
+
+/**
+  @brief Glue code for the bilinear interpolation of 16-bit fixed-point values.
+  @param[in]  S          points to the instance
+  @param[in]  pX         points to the numX column positions in Q12.20
+  @param[in]  numX       number of columns of the result
+  @param[in]  pY         points to the numY row positions in Q12.20
+  @param[in]  numY       number of rows of the result
+  @param[out] pDst       points to the numY x numX result, row by row
+  @return     none
+ */
+
+void plp_interp_bilinear_q16(const plp_interp_bilinear_instance_q16 *S,
+                             const int32_t *__restrict__ pX,
+                             uint32_t numX,
+                             const int32_t *__restrict__ pY,
+                             uint32_t numY,
+                             int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_interp_bilinear_q16s_rv32im(S, pX, numX, pY, numY, pDst);
+    } else {
+        plp_interp_bilinear_q16s_xpulpv2(S, pX, numX, pY, numY, pDst);
+    }
+}
+
+/**
+  @} end of BilinearInterpolate group
+ */
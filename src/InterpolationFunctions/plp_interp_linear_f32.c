@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_interp_linear_f32.c
+ * Description:  Glue code for the linear interpolation of 32-bit floating-point values
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup LinearInterpolate
+  @{
+ */
+
+/**
+  @brief Glue code for the linear interpolation of 32-bit floating-point values.
+  @param[in]  S          points to the instance
+  @param[in]  pX         points to the blockSize positions (see the instance)
+  @param[in]  blockSize  number of positions
+  @param[out] pDst       points to the blockSize interpolated values
+  @return     none
+ */
+
+void plp_interp_linear_f32(const plp_interp_linear_instance_f32 *S,
+                           const float32_t *__restrict__ pX,
+                           uint32_t blockSize,
+                           float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_interp_linear_f32s_xpulpv2(S, pX, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of LinearInterpolate group
+ */
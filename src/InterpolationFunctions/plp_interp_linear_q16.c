@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_interp_linear_q16.c
+ * Description:  Glue code for the linear interpolation of 16-bit fixed-point values
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @defgroup LinearInterpolate Linear Interpolation
+  Linear interpolation in a table of nValues samples y[0], ..., y[nValues - 1] on a uniform grid.
+  The value at the position x between the grid points k and k + 1 is
+
+  <pre>
+      y(x) = y[k] + t * (y[k + 1] - y[k]),    t = x - k
+  </pre>
+
+  The functions interpolate a vector of blockSize positions, e.g. to linearize the readings of a
+  sensor with a calibration table. The positions are given in units of the grid points, x1 +
+  x * xSpacing for the floating-point version, and as Q12.20 values for the 16-bit version, i.e.
+  the upper 12 bits select the grid point and the lower 20 bits are the fraction, hence the table
+  has at most 2048 samples. Positions outside the table return the first or the last sample.
+
+  The 16-bit version rounds the position to Q12.15, and computes y[k] * 2^15 +
+  t * (y[k + 1] - y[k]) with a single pv.sdotsp.h on the cluster. The error is below
+  |y[k + 1] - y[k]| / 2^16 + 0.5, hence at most 1.5 LSB for the steepest tables.
+ */
+
+/**
+  @addtogroup LinearInterpolate
+  @{
+ */
+
+/**
+  @brief Glue code for the linear interpolation of 16-bit fixed-point values.
+  @param[in]  S          points to the instance
+  @param[in]  pX         points to the blockSize positions in Q12.20
+  @param[in]  blockSize  number of positions
+  @param[out] pDst       points to the blockSize interpolated values
+  @return     none
+ */
+
+void plp_interp_linear_q16(const plp_interp_linear_instance_q16 *S,
+                           const int32_t *__restrict__ pX,
+                           uint32_t blockSize,
+                           int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_interp_linear_q16s_rv32im(S, pX, blockSize, pDst);
+    } else {
+        plp_interp_linear_q16s_xpulpv2(S, pX, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of LinearInterpolate group
+ */
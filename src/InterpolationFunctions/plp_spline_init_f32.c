@@ -0,0 +1,131 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spline_init_f32.c
+ * Description:  Initialization of the 32-bit floating-point cubic spline interpolation
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// solves the tridiagonal system for the second derivatives of the spline through the nValues
+// samples, which are stored in pTmp[0 .. nValues - 1]
+static void plp_spline_solve_f32(plp_spline_type_t type,
+                                 const float32_t *pY,
+                                 uint32_t nValues,
+                                 float32_t *pTmp) {
+    float32_t *pM = pTmp;
+    float32_t *pC = &pTmp[nValues];
+    int32_t n = (int32_t)nValues;
+    int32_t k;
+
+    pM[0] = 0.0f;
+    pM[n - 1] = 0.0f;
+
+    // forward elimination of the inner rows, M[0] and M[n - 1] are moved to the diagonal for the
+    // parabolic runout
+    for (k = 1; k < n - 1; k++) {
+        float32_t diag = 4.0f;
+        float32_t rhs = 6.0f * ((float32_t)pY[k + 1] - 2.0f * pY[k] + pY[k - 1]);
+
+        if (type == PLP_SPLINE_PARABOLIC_RUNOUT) {
+            diag += (k == 1) ? 1.0f : 0.0f;
+            diag += (k == n - 2) ? 1.0f : 0.0f;
+        }
+        if (k > 1) {
+            diag -= pC[k - 1];
+            rhs -= pM[k - 1];
+        }
+        pC[k] = 1.0f / diag;
+        pM[k] = rhs * pC[k];
+    }
+
+    // back substitution
+    for (k = n - 3; k >= 1; k--) {
+        pM[k] -= pC[k] * pM[k + 1];
+    }
+
+    if (type == PLP_SPLINE_PARABOLIC_RUNOUT && n > 2) {
+        pM[0] = pM[1];
+        pM[n - 1] = pM[n - 2];
+    }
+}
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup SplineInterpolate
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 32-bit floating-point cubic spline interpolation.
+  @param[out] S         points to the instance
+  @param[in]  type      boundary condition of the spline
+  @param[in]  x1        position of the first sample
+  @param[in]  xSpacing  distance of the samples, larger than 0
+  @param[in]  pYData    points to the nValues samples
+  @param[in]  nValues   number of samples, at least 2
+  @param[out] pCoeffs   points to a buffer of 2 * (nValues - 1) coefficients
+  @param[in]  pTmp      points to a temporary buffer of 2 * nValues values
+  @return     0: Success, 1: less than two samples or xSpacing not positive
+
+  @par The second derivatives of the spline are computed once in floating point, and stored as
+  coefficients of every interval. pYData and pCoeffs must stay valid as long as S is used.
+ */
+
+int plp_spline_init_f32(plp_spline_instance_f32 *S,
+                        plp_spline_type_t type,
+                        float32_t x1,
+                        float32_t xSpacing,
+                        const float32_t *pYData,
+                        uint32_t nValues,
+                        float32_t *pCoeffs,
+                        float32_t *pTmp) {
+    uint32_t k;
+
+    if (nValues < 2 || !(xSpacing > 0.0f)) {
+        return 1;
+    }
+
+    plp_spline_solve_f32(type, pYData, nValues, pTmp);
+
+    for (k = 0; k + 1 < nValues; k++) {
+        pCoeffs[2 * k] = pTmp[k] / 6.0f;
+        pCoeffs[2 * k + 1] = pTmp[k + 1] / 6.0f;
+    }
+
+    S->nValues = nValues;
+    S->x1 = x1;
+    S->xSpacing = xSpacing;
+    S->pYData = pYData;
+    S->pCoeffs = pCoeffs;
+
+    return 0;
+}
+
+/**
+  @} end of SplineInterpolate group
+ */
@@ -0,0 +1,132 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spline_init_q16.c
+ * Description:  Initialization of the 16-bit fixed-point cubic spline interpolation
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// rounds x to int16_t, with saturation
+static int16_t plp_spline_to_q16(float32_t x) {
+    float32_t y = floorf(x + 0.5f);
+    return (y > 32767.0f) ? 32767 : (y < -32768.0f) ? -32768 : (int16_t)y;
+}
+
+// solves the tridiagonal system for the second derivatives of the spline through the nValues
+// samples, which are stored in pTmp[0 .. nValues - 1]
+static void plp_spline_solve_q16(plp_spline_type_t type,
+                                 const int16_t *pY,
+                                 uint32_t nValues,
+                                 float32_t *pTmp) {
+    float32_t *pM = pTmp;
+    float32_t *pC = &pTmp[nValues];
+    int32_t n = (int32_t)nValues;
+    int32_t k;
+
+    pM[0] = 0.0f;
+    pM[n - 1] = 0.0f;
+
+    // forward elimination of the inner rows, M[0] and M[n - 1] are moved to the diagonal for the
+    // parabolic runout
+    for (k = 1; k < n - 1; k++) {
+        float32_t diag = 4.0f;
+        float32_t rhs = 6.0f * ((float32_t)pY[k + 1] - 2.0f * pY[k] + pY[k - 1]);
+
+        if (type == PLP_SPLINE_PARABOLIC_RUNOUT) {
+            diag += (k == 1) ? 1.0f : 0.0f;
+            diag += (k == n - 2) ? 1.0f : 0.0f;
+        }
+        if (k > 1) {
+            diag -= pC[k - 1];
+            rhs -= pM[k - 1];
+        }
+        pC[k] = 1.0f / diag;
+        pM[k] = rhs * pC[k];
+    }
+
+    // back substitution
+    for (k = n - 3; k >= 1; k--) {
+        pM[k] -= pC[k] * pM[k + 1];
+    }
+
+    if (type == PLP_SPLINE_PARABOLIC_RUNOUT && n > 2) {
+        pM[0] = pM[1];
+        pM[n - 1] = pM[n - 2];
+    }
+}
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup SplineInterpolate
+  @{
+ */
+
+/**
+  @brief Initializes an instance of the 16-bit fixed-point cubic spline interpolation.
+  @param[out] S         points to the instance
+  @param[in]  type      boundary condition of the spline
+  @param[in]  pYData    points to the nValues samples
+  @param[in]  nValues   number of samples, at least 2 and at most 2048
+  @param[out] pCoeffs   points to a buffer of 2 * (nValues - 1) coefficients, aligned to 4 bytes
+  @param[in]  pTmp      points to a temporary buffer of 2 * nValues values
+  @return     0: Success, 1: less than two samples
+
+  @par The second derivatives of the spline are computed once in floating point, and stored as
+  coefficients of every interval. pYData and pCoeffs must stay valid as long as S is used.
+ */
+
+int plp_spline_init_q16(plp_spline_instance_q16 *S,
+                        plp_spline_type_t type,
+                        const int16_t *pYData,
+                        uint32_t nValues,
+                        int16_t *pCoeffs,
+                        float32_t *pTmp) {
+    uint32_t k;
+
+    if (nValues < 2) {
+        return 1;
+    }
+
+    plp_spline_solve_q16(type, pYData, nValues, pTmp);
+
+    // M / 12, such that the weights of the coefficients fit Q1.15
+    for (k = 0; k + 1 < nValues; k++) {
+        pCoeffs[2 * k] = plp_spline_to_q16(pTmp[k] / 12.0f);
+        pCoeffs[2 * k + 1] = plp_spline_to_q16(pTmp[k + 1] / 12.0f);
+    }
+
+    S->nValues = nValues;
+    S->pYData = pYData;
+    S->pCoeffs = pCoeffs;
+
+    return 0;
+}
+
+/**
+  @} end of SplineInterpolate group
+ */
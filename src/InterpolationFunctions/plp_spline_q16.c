@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spline_q16.c
+ * Description:  Glue code for the cubic spline interpolation of 16-bit fixed-point values
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @defgroup SplineInterpolate Cubic Spline Interpolation
+  Cubic spline interpolation in a table of nValues samples y[0], ..., y[nValues - 1] on a
+  uniform grid. Between the grid points k and k + 1, the spline is
+
+  <pre>
+      s(x) = (1 - t) * y[k] + t * y[k + 1]
+             + ((1 - t)^3 - (1 - t)) * M[k] / 6 + (t^3 - t) * M[k + 1] / 6
+  </pre>
+
+  with t = x - k, where the second derivatives M are the solution of the tridiagonal system
+
+  <pre>
+      M[k - 1] + 4 * M[k] + M[k + 1] = 6 * (y[k + 1] - 2 * y[k] + y[k - 1])
+  </pre>
+
+  for the inner grid points. The natural spline (PLP_SPLINE_NATURAL) has M[0] = M[nValues - 1] = 0,
+  and the parabolic runout spline (PLP_SPLINE_PARABOLIC_RUNOUT) has M[0] = M[1] and
+  M[nValues - 1] = M[nValues - 2].
+
+  The system is solved once by plp_spline_init_f32 or plp_spline_init_q16, which store the
+  coefficients (M[k] / 6, M[k + 1] / 6) of every interval next to each other, hence the
+  interpolation only has to evaluate the cubic polynomial. The positions are given as for the
+  linear interpolation, and positions outside the table return the first or the last sample.
+
+  The 16-bit version stores M / 12 as 16-bit values, such that the coefficients of an interval
+  are loaded as one word and applied with a single pv.dotsp.h on the cluster. The position is
+  rounded to Q12.15, and the result is within 3 LSB of the exact spline.
+ */
+
+/**
+  @addtogroup SplineInterpolate
+  @{
+ */
+
+/**
+  @brief Glue code for the cubic spline interpolation of 16-bit fixed-point values.
+  @param[in]  S          points to the instance, initialized by plp_spline_init_q16
+  @param[in]  pX         points to the blockSize positions in Q12.20
+  @param[in]  blockSize  number of positions
+  @param[out] pDst       points to the blockSize interpolated values
+  @return     none
+ */
+
+void plp_spline_q16(const plp_spline_instance_q16 *S,
+                    const int32_t *__restrict__ pX,
+                    uint32_t blockSize,
+                    int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_spline_q16s_rv32im(S, pX, blockSize, pDst);
+    } else {
+        plp_spline_q16s_xpulpv2(S, pX, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of SplineInterpolate group
+ */
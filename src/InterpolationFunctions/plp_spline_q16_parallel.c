@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spline_q16_parallel.c
+ * Description:  Glue code for the parallel cubic spline interpolation of 16-bit fixed-point values
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup SplineInterpolate
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel cubic spline interpolation of 16-bit fixed-point values.
+  @param[in]  S          points to the instance, initialized by plp_spline_init_q16
+  @param[in]  pX         points to the blockSize positions in Q12.20
+  @param[in]  blockSize  number of positions
+  @param[in]  nPE        number of cores to use
+  @param[out] pDst       points to the blockSize interpolated values
+  @return     none
+
+  @par Parallelization
+  The positions are split into nPE chunks, one for every core.
+ */
+
+void plp_spline_q16_parallel(const plp_spline_instance_q16 *S,
+                             const int32_t *__restrict__ pX,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_spline_instance_q16_parallel args = {
+            .S = S, .pX = pX, .blockSize = blockSize, .nPE = nPE, .pDst = pDst
+        };
+
+        rt_team_fork(nPE, plp_spline_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of SplineInterpolate group
+ */
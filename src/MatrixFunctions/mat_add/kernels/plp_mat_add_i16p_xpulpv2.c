@@ -56,12 +56,12 @@ void plp_mat_add_i16p_xpulpv2(void *args) {
 
     plp_mat_add_instance_i16 *a = (plp_mat_add_instance_i16 *)args;
 
-    const int16_t *__restrict__ pSrcA = a->pSrcA;
-    const int16_t *__restrict__ pSrcB = a->pSrcB;
+    const int16_t *pSrcA = a->pSrcA;
+    const int16_t *pSrcB = a->pSrcB;
     uint32_t M = a->M;
     uint32_t N = a->N;
     uint32_t nPE = a->nPE;
-    int16_t *__restrict__ pDst = a->pDst;
+    int16_t *pDst = a->pDst;
 
     uint32_t i; // loop counters
     uint32_t total = M*N; // we can see it as a 1D operation
@@ -78,12 +78,13 @@ void plp_mat_add_i16p_xpulpv2(void *args) {
         *((v2s*)(pDst + 4*i + 2)) = __ADD2(*((v2s*)(pSrcA + 4*i + 2)), *((v2s*)(pSrcB + 4*i + 2)));
     }
 
-    // to save the branch we just compute the possibly remaining element always and with all cores
-    // might lead to wait cycles due to contention while writing the same element
-    // possible improvement 1: last core has least work to do if there is a remaining element, make use of this
-    // possible improvement 2: if the cores that don't compute flush the pipeline, it should not be a waste of time, make use of this
-    *((v2s*)(pDst + total - 2)) = __ADD2(*((v2s*)(pSrcA + total - 2)), *((v2s*)(pSrcB + total - 2)));
-    *((v2s*)(pDst + total - 4)) = __ADD2(*((v2s*)(pSrcA + total - 4)), *((v2s*)(pSrcB + total - 4)));
+    // the remaining elements are computed by the last core only, such that no element is
+    // computed twice (which would break in-place operation)
+    if (core_id == nPE - 1) {
+        for (i = (total >> 2) << 2; i < total; i++) {
+            pDst[i] = pSrcA[i] + pSrcB[i];
+        }
+    }
 #else // No PLP_MATH_LOOPUNROLL
     // amount of elements per core, rounded up
     uint32_t per_core = (total+nPE-1)/nPE;
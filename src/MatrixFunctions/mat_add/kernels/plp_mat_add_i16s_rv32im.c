@@ -72,15 +72,15 @@
   @param[in]  pSrcB   Points to the second input matrix
   @param[in]  M       Height of all matrices
   @param[in]  N       Width of all matrices
-  @param[out] pDst    Points to the output matrix
+  @param[out] pDst    Points to the output matrix, may be equal to pSrcA or pSrcB
   @return     none
  */
 
-void plp_mat_add_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                             const int16_t *__restrict__ pSrcB,
+void plp_mat_add_i16s_rv32im(const int16_t *pSrcA,
+                             const int16_t *pSrcB,
                              uint32_t M,
                              uint32_t N,
-                             int16_t *__restrict__ pDst) {
+                             int16_t *pDst) {
 
     uint32_t i; // loop counters
     uint32_t total = M*N; // we can see it as a 1D operation
@@ -90,8 +90,11 @@ void plp_mat_add_i16s_rv32im(const int16_t *__restrict__ pSrcA,
             pDst[2*i] = pSrcA[2*i] + pSrcB[2*i];
             pDst[2*i+1] = pSrcA[2*i+1] + pSrcB[2*i+1];
     }
-    // to save the branch we just always compute the possibly remaining element
-    pDst[total - 1] = pSrcA[total - 1] + pSrcB[total - 1];
+    // compute the remaining elements, such that no element is computed twice (which would
+    // break in-place operation)
+    for (i = (total >> 1) << 1; i < total; i++) {
+        pDst[i] = pSrcA[i] + pSrcB[i];
+    }
 #else // No PLP_MATH_LOOPUNROLL
     for (i = 0; i < total; i++) {
             pDst[i] = pSrcA[i] + pSrcB[i];
@@ -52,12 +52,12 @@ void plp_mat_add_i32p_xpulpv2(void *args) {
 
     plp_mat_add_instance_i32 *a = (plp_mat_add_instance_i32 *)args;
 
-    const int32_t *__restrict__ pSrcA = a->pSrcA;
-    const int32_t *__restrict__ pSrcB = a->pSrcB;
+    const int32_t *pSrcA = a->pSrcA;
+    const int32_t *pSrcB = a->pSrcB;
     uint32_t M = a->M;
     uint32_t N = a->N;
     uint32_t nPE = a->nPE;
-    int32_t *__restrict__ pDst = a->pDst;
+    int32_t *pDst = a->pDst;
 
     uint32_t i; // loop counters
     uint32_t total = M*N; // we can see it as a 1D operation
@@ -74,11 +74,13 @@ void plp_mat_add_i32p_xpulpv2(void *args) {
             pDst[2*i+1] = pSrcA[2*i+1] + pSrcB[2*i+1];
     }
 
-    // to save the branch we just compute the possibly remaining element always and with all cores
-    // might lead to wait cycles due to contention while writing the same element
-    // possible improvement 1: last core has least work to do if there is a remaining element, make use of this
-    // possible improvement 2: if the cores that don't compute flush the pipeline, it should not be a waste of time, make use of this
-    pDst[total - 1] = pSrcA[total - 1] + pSrcB[total - 1];
+    // the remaining elements are computed by the last core only, such that no element is
+    // computed twice (which would break in-place operation)
+    if (core_id == nPE - 1) {
+        for (i = (total >> 1) << 1; i < total; i++) {
+            pDst[i] = pSrcA[i] + pSrcB[i];
+        }
+    }
 #else // No PLP_MATH_LOOPUNROLL
     // amount of elements per core, rounded up
     uint32_t per_core = (total+nPE-1)/nPE;
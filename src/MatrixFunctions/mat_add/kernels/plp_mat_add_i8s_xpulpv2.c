@@ -45,15 +45,15 @@
   @param[in]  pSrcB   Points to the second input matrix
   @param[in]  M       Height of all matrices
   @param[in]  N       Width of all matrices
-  @param[out] pDst    Points to the output matrix
+  @param[out] pDst    Points to the output matrix, may be equal to pSrcA or pSrcB
   @return     none
  */
 
-void plp_mat_add_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                             const int8_t *__restrict__ pSrcB,
+void plp_mat_add_i8s_xpulpv2(const int8_t *pSrcA,
+                             const int8_t *pSrcB,
                              uint32_t M,
                              uint32_t N,
-                             int8_t *__restrict__ pDst) {
+                             int8_t *pDst) {
 
     uint32_t i; // loop counters
     uint32_t total = M*N; // we can see it as a 1D operation
@@ -63,9 +63,11 @@ void plp_mat_add_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
         *((v4s*)(pDst + 8*i    )) = __ADD4(*((v4s*)(pSrcA + 8*i    )), *((v4s*)(pSrcB + 8*i    )));
         *((v4s*)(pDst + 8*i + 4)) = __ADD4(*((v4s*)(pSrcA + 8*i + 4)), *((v4s*)(pSrcB + 8*i + 4)));
     }
-    // to save the branch we just always compute the possibly remaining elements
-    *((v4s*)(pDst + total - 4)) = __ADD4(*((v4s*)(pSrcA + total - 4)), *((v4s*)(pSrcB + total - 4)));
-    *((v4s*)(pDst + total - 8)) = __ADD4(*((v4s*)(pSrcA + total - 8)), *((v4s*)(pSrcB + total - 8)));
+    // compute the remaining elements, such that no element is computed twice (which would
+    // break in-place operation)
+    for (i = (total >> 3) << 3; i < total; i++) {
+        pDst[i] = pSrcA[i] + pSrcB[i];
+    }
 #else // No PLP_MATH_LOOPUNROLL
     for (i = 0; i < total; i++) {
             pDst[i] = pSrcA[i] + pSrcB[i];
@@ -46,16 +46,16 @@
   @param[in]  M       Height of all matrices
   @param[in]  N       Width of all matrices
   @param[in]  nPE     Number of cores to use for computation
-  @param[out] pDst    Points to the output matrix
+  @param[out] pDst    Points to the output matrix, may be equal to pSrcA or pSrcB
   @return     none
  */
 
-void plp_mat_add_f32_parallel(const float *__restrict__ pSrcA,
-                              const float *__restrict__ pSrcB,
+void plp_mat_add_f32_parallel(const float *pSrcA,
+                              const float *pSrcB,
                               uint32_t M,
                               uint32_t N,
                               uint32_t nPE,
-                              float *__restrict__ pDst) {
+                              float *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel and floating-point processing supported only for cluster side\n");
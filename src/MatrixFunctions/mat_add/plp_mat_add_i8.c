@@ -45,15 +45,15 @@
   @param[in]  pSrcB   Points to the second input matrix
   @param[in]  M       Height of all matrices
   @param[in]  N       Width of all matrices
-  @param[out] pDst    Points to the output matrix
+  @param[out] pDst    Points to the output matrix, may be equal to pSrcA or pSrcB
   @return     none
  */
 
-void plp_mat_add_i8(const int8_t *__restrict__ pSrcA,
-                    const int8_t *__restrict__ pSrcB,
+void plp_mat_add_i8(const int8_t *pSrcA,
+                    const int8_t *pSrcB,
                     uint32_t M,
                     uint32_t N,
-                    int8_t *__restrict__ pDst) {
+                    int8_t *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_add_i8s_rv32im(pSrcA, pSrcB, M, N, pDst);
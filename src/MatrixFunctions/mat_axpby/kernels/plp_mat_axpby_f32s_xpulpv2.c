@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_axpby_f32s_xpulpv2.c
+ * Description:  32-bit floating-point fused matrix scale and addition for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatAxpby
+ */
+
+/**
+  @addtogroup MatAxpbyKernels
+  @{
+ */
+
+/**
+   @brief Fused matrix scale and addition of 32-bit floating-point matrices kernel for XPULPV2
+          extension.
+   @param[in]  pSrcX  Points to the first input matrix
+   @param[in]  pSrcY  Points to the second input matrix
+   @param[in]  M      Height of all matrices
+   @param[in]  N      Width of all matrices
+   @param[in]  alpha  Factor to multiply the first matrix with
+   @param[in]  beta   Factor to multiply the second matrix with
+   @param[out] pDst   Points to the output matrix, may be equal to pSrcY
+   @return     none
+*/
+
+void plp_mat_axpby_f32s_xpulpv2(const float *__restrict__ pSrcX,
+                                const float *pSrcY,
+                                uint32_t M,
+                                uint32_t N,
+                                float alpha,
+                                float beta,
+                                float *pDst) {
+
+    uint32_t i;             // loop counter
+    uint32_t total = M * N; // number of elements
+
+    // load both elements before storing, since pDst may be equal to pSrcY
+    for (i = 0; i + 1 < total; i += 2) {
+        float x0 = pSrcX[i];
+        float x1 = pSrcX[i + 1];
+        float y0 = pSrcY[i];
+        float y1 = pSrcY[i + 1];
+        pDst[i] = alpha * x0 + beta * y0;
+        pDst[i + 1] = alpha * x1 + beta * y1;
+    }
+
+    // leftover element
+    if (i < total) {
+        pDst[i] = alpha * pSrcX[i] + beta * pSrcY[i];
+    }
+}
+
+/**
+   @} end of MatAxpbyKernels group
+*/
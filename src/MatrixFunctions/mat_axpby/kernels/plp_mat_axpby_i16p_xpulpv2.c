@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_axpby_i16p_xpulpv2.c
+ * Description:  parallel 16-bit integer fused matrix scale and addition for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatAxpby
+ */
+
+/**
+  @addtogroup MatAxpbyKernels
+  @{
+ */
+
+/**
+   @brief Parallel fused matrix scale and addition of 16-bit integer matrices kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_mat_axpby_instance_i16 struct initialized by
+                     plp_mat_axpby_i16_parallel
+   @return     none
+
+   @par Parallelization
+   The operation is element wise, hence the matrices are treated as a single vector of M*N elements.
+   Every core computes a contiguous chunk of it with plp_mat_axpby_i16s_xpulpv2. The size of each
+   chunk is a multiple of 4, such that all SIMD accesses stay aligned.
+*/
+
+void plp_mat_axpby_i16p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_axpby_instance_i16 *a = (plp_mat_axpby_instance_i16 *)args;
+
+    const int16_t *__restrict__ pSrcX = a->pSrcX;
+    const int16_t *pSrcY = a->pSrcY;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    int16_t alpha = a->alpha;
+    int16_t beta = a->beta;
+    int32_t shift = a->shift;
+    uint32_t nPE = a->nPE;
+    int16_t *pDst = a->pDst;
+
+    uint32_t total = M * N;
+    uint32_t chunk = (((total + nPE - 1) / nPE) + 3) & ~3;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > total) {
+        start = total;
+    }
+    if (end > total) {
+        end = total;
+    }
+
+    if (start < end) {
+        plp_mat_axpby_i16s_xpulpv2(pSrcX + start,
+                                   pSrcY + start,
+                                   1,
+                                   end - start,
+                                   alpha,
+                                   beta,
+                                   shift,
+                                   pDst + start);
+    }
+}
+
+/**
+   @} end of MatAxpbyKernels group
+*/
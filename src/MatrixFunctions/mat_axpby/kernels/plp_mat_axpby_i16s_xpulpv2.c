@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_axpby_i16s_xpulpv2.c
+ * Description:  16-bit integer fused matrix scale and addition for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatAxpby
+ */
+
+/**
+  @addtogroup MatAxpbyKernels
+  @{
+ */
+
+/**
+   @brief Fused matrix scale and addition of 16-bit integer matrices kernel for XPULPV2 extension.
+   @param[in]  pSrcX  Points to the first input matrix
+   @param[in]  pSrcY  Points to the second input matrix
+   @param[in]  M      Height of all matrices
+   @param[in]  N      Width of all matrices
+   @param[in]  alpha  Factor to multiply the first matrix with
+   @param[in]  beta   Factor to multiply the second matrix with
+   @param[in]  shift  Amount to shift each element after the addition
+   @param[out] pDst   Points to the output matrix, may be equal to pSrcY
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values of X and Y are loaded two each into 32 bit vectors. They are shuffled into
+   pairs of (x, y), such that each output is computed by one pv.dotsp.h with (alpha, beta).
+*/
+
+void plp_mat_axpby_i16s_xpulpv2(const int16_t *__restrict__ pSrcX,
+                                const int16_t *pSrcY,
+                                uint32_t M,
+                                uint32_t N,
+                                int16_t alpha,
+                                int16_t beta,
+                                int32_t shift,
+                                int16_t *pDst) {
+
+    uint32_t i;             // loop counter
+    uint32_t total = M * N; // number of elements
+
+    // pair up the elements of X and Y, such that each output is a single dot product with ab
+    const v2s ab = __PACK2(alpha, beta);
+    const v2s mask0 = { 0, 2 };
+    const v2s mask1 = { 1, 3 };
+
+    for (i = 0; i + 1 < total; i += 2) {
+        v2s x = *((v2s *)&pSrcX[i]);
+        v2s y = *((v2s *)&pSrcY[i]);
+        int32_t val0 = __DOTP2(__builtin_shuffle(x, y, mask0), ab);
+        int32_t val1 = __DOTP2(__builtin_shuffle(x, y, mask1), ab);
+        *((v2s *)&pDst[i]) = __PACK2(val0 >> shift, val1 >> shift);
+    }
+
+    // leftover element
+    if (i < total) {
+        int32_t val = (int32_t)pSrcX[i] * alpha + (int32_t)pSrcY[i] * beta;
+        pDst[i] = (int16_t)(val >> shift);
+    }
+}
+
+/**
+   @} end of MatAxpbyKernels group
+*/
@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_axpby_i8s_xpulpv2.c
+ * Description:  8-bit integer fused matrix scale and addition for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatAxpby
+ */
+
+/**
+  @addtogroup MatAxpbyKernels
+  @{
+ */
+
+/**
+   @brief Fused matrix scale and addition of 8-bit integer matrices kernel for XPULPV2 extension.
+   @param[in]  pSrcX  Points to the first input matrix
+   @param[in]  pSrcY  Points to the second input matrix
+   @param[in]  M      Height of all matrices
+   @param[in]  N      Width of all matrices
+   @param[in]  alpha  Factor to multiply the first matrix with
+   @param[in]  beta   Factor to multiply the second matrix with
+   @param[in]  shift  Amount to shift each element after the addition
+   @param[out] pDst   Points to the output matrix, may be equal to pSrcY
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values of X and Y are loaded four each into 32 bit vectors. They are shuffled into
+   pairs of (x, y), such that each output is computed by one pv.dotsp.b with (alpha, beta).
+*/
+
+void plp_mat_axpby_i8s_xpulpv2(const int8_t *__restrict__ pSrcX,
+                               const int8_t *pSrcY,
+                               uint32_t M,
+                               uint32_t N,
+                               int8_t alpha,
+                               int8_t beta,
+                               int32_t shift,
+                               int8_t *pDst) {
+
+    uint32_t i;             // loop counter
+    uint32_t total = M * N; // number of elements
+
+    // interleave the elements of X and Y, such that each output is a dot product with ab0 or ab1
+    const v4s ab0 = __PACK4(alpha, beta, 0, 0);
+    const v4s ab1 = __PACK4(0, 0, alpha, beta);
+    const v4s mask01 = { 0, 4, 1, 5 };
+    const v4s mask23 = { 2, 6, 3, 7 };
+
+    for (i = 0; i + 3 < total; i += 4) {
+        v4s x = *((v4s *)&pSrcX[i]);
+        v4s y = *((v4s *)&pSrcY[i]);
+        v4s xy01 = __builtin_shuffle(x, y, mask01);
+        v4s xy23 = __builtin_shuffle(x, y, mask23);
+        int32_t val0 = __DOTP4(xy01, ab0);
+        int32_t val1 = __DOTP4(xy01, ab1);
+        int32_t val2 = __DOTP4(xy23, ab0);
+        int32_t val3 = __DOTP4(xy23, ab1);
+        *((v4s *)&pDst[i]) = __PACK4(val0 >> shift, val1 >> shift, val2 >> shift, val3 >> shift);
+    }
+
+    // leftover elements
+    for (; i < total; i++) {
+        int32_t val = (int32_t)pSrcX[i] * alpha + (int32_t)pSrcY[i] * beta;
+        pDst[i] = (int8_t)(val >> shift);
+    }
+}
+
+/**
+   @} end of MatAxpbyKernels group
+*/
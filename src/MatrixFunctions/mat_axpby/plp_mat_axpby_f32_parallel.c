@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_axpby_f32_parallel.c
+ * Description:  parallel 32-bit floating-point fused matrix scale and addition glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatAxpby
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel fused matrix scale and addition of 32-bit floating-point
+         matrices.
+  @param[in]  pSrcX  Points to the first input matrix
+  @param[in]  pSrcY  Points to the second input matrix
+  @param[in]  M      Height of all matrices
+  @param[in]  N      Width of all matrices
+  @param[in]  alpha  Factor to multiply the first matrix with
+  @param[in]  beta   Factor to multiply the second matrix with
+  @param[in]  nPE    Number of cores to use for computation
+  @param[out] pDst   Points to the output matrix, may be equal to pSrcY
+  @return     none
+ */
+
+void plp_mat_axpby_f32_parallel(const float *__restrict__ pSrcX,
+                                const float *pSrcY,
+                                uint32_t M,
+                                uint32_t N,
+                                float alpha,
+                                float beta,
+                                uint32_t nPE,
+                                float *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_axpby_instance_f32 args = { .pSrcX = pSrcX,
+                                            .pSrcY = pSrcY,
+                                            .M = M,
+                                            .N = N,
+                                            .alpha = alpha,
+                                            .beta = beta,
+                                            .nPE = nPE,
+                                            .pDst = pDst };
+        rt_team_fork(nPE, plp_mat_axpby_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatAxpby group
+ */
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_axpby_i32.c
+ * Description:  32-bit integer fused matrix scale and addition glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatAxpby Matrix AXPBY
+  This module contains the glue code for the fused matrix scale and addition. The kernel codes
+  (kernels) are in the Module Matrix AXPBY Kernels.
+
+  The Matrix AXPBY scales two matrices, adds them element wise, and applies a bitshift operation
+  to the result. For floating-point implementations, the bitshift operation is not applied.
+
+      `pDst[m,n] = (alpha * pSrcX[m,n] + beta * pSrcY[m,n]) >> shift`
+
+  It replaces a chain of plp_mat_scale and plp_mat_add, but reads every operand only once, and the
+  intermediate results never leave the registers. pDst may be equal to pSrcY, to compute
+  Y = aX + bY in place. For integers, the intermediate result has 32-bit precision.
+
+  There are functions for integer 32- 16- and 8-bit data types, and for 32-bit floating-point. For
+  lower precision integers (16- and 8-bit), the kernels exploit SIMD instructions.
+ */
+
+/**
+  @addtogroup MatAxpby
+  @{
+ */
+
+/**
+  @brief Glue code for the fused matrix scale and addition of 32-bit integer matrices.
+  @param[in]  pSrcX  Points to the first input matrix
+  @param[in]  pSrcY  Points to the second input matrix
+  @param[in]  M      Height of all matrices
+  @param[in]  N      Width of all matrices
+  @param[in]  alpha  Factor to multiply the first matrix with
+  @param[in]  beta   Factor to multiply the second matrix with
+  @param[in]  shift  Amount to shift each element after the addition
+  @param[out] pDst   Points to the output matrix, may be equal to pSrcY
+  @return     none
+ */
+
+void plp_mat_axpby_i32(const int32_t *__restrict__ pSrcX,
+                       const int32_t *pSrcY,
+                       uint32_t M,
+                       uint32_t N,
+                       int32_t alpha,
+                       int32_t beta,
+                       int32_t shift,
+                       int32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_axpby_i32s_rv32im(pSrcX, pSrcY, M, N, alpha, beta, shift, pDst);
+    } else {
+        plp_mat_axpby_i32s_xpulpv2(pSrcX, pSrcY, M, N, alpha, beta, shift, pDst);
+    }
+}
+
+/**
+  @} end of MatAxpby group
+ */
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_axpby_i32_parallel.c
+ * Description:  parallel 32-bit integer fused matrix scale and addition glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatAxpby
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel fused matrix scale and addition of 32-bit integer matrices.
+  @param[in]  pSrcX  Points to the first input matrix
+  @param[in]  pSrcY  Points to the second input matrix
+  @param[in]  M      Height of all matrices
+  @param[in]  N      Width of all matrices
+  @param[in]  alpha  Factor to multiply the first matrix with
+  @param[in]  beta   Factor to multiply the second matrix with
+  @param[in]  shift  Amount to shift each element after the addition
+  @param[in]  nPE    Number of cores to use for computation
+  @param[out] pDst   Points to the output matrix, may be equal to pSrcY
+  @return     none
+ */
+
+void plp_mat_axpby_i32_parallel(const int32_t *__restrict__ pSrcX,
+                                const int32_t *pSrcY,
+                                uint32_t M,
+                                uint32_t N,
+                                int32_t alpha,
+                                int32_t beta,
+                                int32_t shift,
+                                uint32_t nPE,
+                                int32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_axpby_instance_i32 args = { .pSrcX = pSrcX,
+                                            .pSrcY = pSrcY,
+                                            .M = M,
+                                            .N = N,
+                                            .alpha = alpha,
+                                            .beta = beta,
+                                            .shift = shift,
+                                            .nPE = nPE,
+                                            .pDst = pDst };
+        rt_team_fork(nPE, plp_mat_axpby_i32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatAxpby group
+ */
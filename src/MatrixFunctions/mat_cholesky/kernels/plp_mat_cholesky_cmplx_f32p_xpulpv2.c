@@ -0,0 +1,124 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_cmplx_f32p_xpulpv2.c
+ * Description:  Complex 32-bit floating-point parallel Cholesky decomposition kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatCholesky
+ */
+
+/**
+  @addtogroup MatCholeskyKernels
+  @{
+ */
+
+/**
+   @brief Parallel Cholesky decomposition of complex 32-bit floating-point matrices kernel for
+          XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_cholesky_instance_f32 struct initialized by
+                     plp_mat_cholesky_cmplx_f32_parallel
+   @return     none, the status (0: Success, 1: Matrix is not positive definite) is written to
+               args->ret
+
+   @par Parallelization
+   Same scheme as plp_mat_cholesky_f32p_xpulpv2. Row i of L is owned by core i % nPE, all cores
+   compute the real diagonal element of column j redundantly, and a single rt_team_barrier per
+   column is enough.
+*/
+
+void plp_mat_cholesky_cmplx_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_cholesky_instance_f32 *a = (plp_mat_cholesky_instance_f32 *)args;
+
+    const float *__restrict__ pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDst = a->pDst;
+
+    uint32_t i, j, k; // loop counters
+
+    // clear the upper triangular part of the own rows
+    for (i = core_id; i < N; i += nPE) {
+        for (j = 2 * (i + 1); j < 2 * N; j++) {
+            pDst[2 * i * N + j] = 0.0f;
+        }
+    }
+
+    for (j = 0; j < N; j++) {
+        float *pRowJ = pDst + 2 * j * N;
+
+        float diag = pSrc[2 * (j * N + j)];
+        for (k = 0; k < j; k++) {
+            diag -= pRowJ[2 * k] * pRowJ[2 * k] + pRowJ[2 * k + 1] * pRowJ[2 * k + 1];
+        }
+
+        // every core reaches the same decision, no core is left waiting in a barrier
+        if (diag <= 0.0f) {
+            if (core_id == 0) {
+                a->ret = 1;
+            }
+            return;
+        }
+
+        diag = sqrtf(diag);
+        float invDiag = 1.0f / diag;
+
+        if (j % nPE == core_id) {
+            pRowJ[2 * j] = diag;
+            pRowJ[2 * j + 1] = 0.0f;
+        }
+
+        // first own row below the diagonal
+        i = j + 1 + (core_id + nPE - (j + 1) % nPE) % nPE;
+
+        for (; i < N; i += nPE) {
+            float *pRowI = pDst + 2 * i * N;
+            float sumRe = pSrc[2 * (i * N + j)];
+            float sumIm = pSrc[2 * (i * N + j) + 1];
+            for (k = 0; k < j; k++) {
+                // L[i][k] * conj(L[j][k])
+                sumRe -= pRowI[2 * k] * pRowJ[2 * k] + pRowI[2 * k + 1] * pRowJ[2 * k + 1];
+                sumIm -= pRowI[2 * k + 1] * pRowJ[2 * k] - pRowI[2 * k] * pRowJ[2 * k + 1];
+            }
+            pRowI[2 * j] = sumRe * invDiag;
+            pRowI[2 * j + 1] = sumIm * invDiag;
+        }
+
+        rt_team_barrier();
+    }
+
+    if (core_id == 0) {
+        a->ret = 0;
+    }
+}
+
+/**
+   @} end of MatCholeskyKernels group
+*/
@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_cmplx_f32s_xpulpv2.c
+ * Description:  Complex 32-bit floating-point Cholesky decomposition kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatCholesky
+ */
+
+/**
+  @addtogroup MatCholeskyKernels
+  @{
+ */
+
+/**
+  @brief Cholesky decomposition of complex 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrc Points to the complex Hermitian, positive definite input matrix
+  @param[in]  N    Width and height of both matrices
+  @param[out] pDst Points to the complex output matrix L, the upper triangular part is set to zero
+  @return     0: Success, 1: Matrix is not positive definite
+
+  @par Algorithm
+  The Cholesky-Banachiewicz algorithm of plp_mat_cholesky_f32s_xpulpv2, with the dot products
+  taken against the conjugated row of L. The diagonal elements are real, hence the off-diagonal
+  elements are divided by a real number.
+ */
+
+int plp_mat_cholesky_cmplx_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                        uint32_t N,
+                                        float *__restrict__ pDst) {
+
+    uint32_t i, j, k; // loop counters
+
+    for (i = 0; i < N; i++) {
+        float *pRowI = pDst + 2 * i * N;
+
+        for (j = 0; j < i; j++) {
+            float *pRowJ = pDst + 2 * j * N;
+            float sumRe = pSrc[2 * (i * N + j)];
+            float sumIm = pSrc[2 * (i * N + j) + 1];
+            for (k = 0; k < j; k++) {
+                // L[i][k] * conj(L[j][k])
+                sumRe -= pRowI[2 * k] * pRowJ[2 * k] + pRowI[2 * k + 1] * pRowJ[2 * k + 1];
+                sumIm -= pRowI[2 * k + 1] * pRowJ[2 * k] - pRowI[2 * k] * pRowJ[2 * k + 1];
+            }
+            float invDiag = 1.0f / pRowJ[2 * j];
+            pRowI[2 * j] = sumRe * invDiag;
+            pRowI[2 * j + 1] = sumIm * invDiag;
+        }
+
+        float diag = pSrc[2 * (i * N + i)];
+        for (k = 0; k < i; k++) {
+            diag -= pRowI[2 * k] * pRowI[2 * k] + pRowI[2 * k + 1] * pRowI[2 * k + 1];
+        }
+
+        if (diag <= 0.0f) {
+            return 1;
+        }
+
+        pRowI[2 * i] = sqrtf(diag);
+        pRowI[2 * i + 1] = 0.0f;
+
+        for (j = 2 * (i + 1); j < 2 * N; j++) {
+            pRowI[j] = 0.0f;
+        }
+    }
+
+    return 0;
+}
+
+/**
+   @} end of MatCholeskyKernels group
+*/
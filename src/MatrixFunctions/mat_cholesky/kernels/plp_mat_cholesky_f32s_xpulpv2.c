@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_f32s_xpulpv2.c
+ * Description:  32-bit floating-point Cholesky decomposition for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatCholesky
+ */
+
+/**
+  @defgroup MatCholeskyKernels Cholesky decomposition kernels
+  This module contains the kernel functions for the Cholesky decomposition.
+
+  The Cholesky decomposition factors a symmetric, positive definite matrix A of shape NxN into
+  the product of a lower triangular matrix L and its transpose:
+
+  \f[
+    A = L \cdot L^T
+  \f]
+
+  @par Algorithm
+  The Cholesky-Banachiewicz algorithm computes L row by row. Every element is the remaining part
+  of A, after subtracting the dot product of the already computed elements, divided by the
+  diagonal element of the column. The diagonal element itself is the square root of the
+  remaining part. If this is not positive, A is not positive definite.
+ */
+
+/**
+  @addtogroup MatCholeskyKernels
+  @{
+ */
+
+/**
+  @brief Cholesky decomposition of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc Points to the symmetric, positive definite input matrix
+  @param[in]  N    Width and height of both matrices
+  @param[out] pDst Points to the output matrix L, the upper triangular part is set to zero
+  @return     0: Success, 1: Matrix is not positive definite
+ */
+
+int plp_mat_cholesky_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                  uint32_t N,
+                                  float *__restrict__ pDst) {
+
+    uint32_t i, j, k; // loop counters
+
+    for (i = 0; i < N; i++) {
+        float *pRowI = pDst + i * N;
+
+        for (j = 0; j < i; j++) {
+            float *pRowJ = pDst + j * N;
+            float sum = pSrc[i * N + j];
+            for (k = 0; k < j; k++) {
+                sum -= pRowI[k] * pRowJ[k];
+            }
+            pRowI[j] = sum / pRowJ[j];
+        }
+
+        float diag = pSrc[i * N + i];
+        for (k = 0; k < i; k++) {
+            diag -= pRowI[k] * pRowI[k];
+        }
+
+        if (diag <= 0.0f) {
+            return 1;
+        }
+
+        pRowI[i] = sqrtf(diag);
+
+        for (j = i + 1; j < N; j++) {
+            pRowI[j] = 0.0f;
+        }
+    }
+
+    return 0;
+}
+
+/**
+   @} end of MatCholeskyKernels group
+*/
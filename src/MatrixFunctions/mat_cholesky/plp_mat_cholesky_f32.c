@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_f32.c
+ * Description:  32-bit floating-point Cholesky decomposition glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatCholesky Cholesky decomposition
+  This module contains the glue code for the Cholesky decomposition. The kernel codes (kernels)
+  are in the Module Cholesky decomposition Kernels.
+
+  The Cholesky decomposition factors a symmetric, positive definite matrix A of shape NxN into
+  the product of a lower triangular matrix L and its transpose:
+
+  \f[
+    A = L \cdot L^T
+  \f]
+
+  The factor L can be used with plp_mat_solve_lower_f32 and plp_mat_solve_upper_f32 (on the
+  transposed factor, see plp_mat_trans_f32) to solve a system of linear equations, which is both
+  cheaper and numerically more stable than computing the inverse. Only the lower triangular part
+  of the input matrix is read.
+
+  plp_mat_cholesky_cmplx_f32 factors complex Hermitian, positive definite matrices, stored with
+  interleaved real and imaginary parts, into A = L * L^H. The factor is passed to
+  plp_mat_solve_cholesky_cmplx_f32 to solve the system.
+
+  @par Algorithm
+  The Cholesky-Banachiewicz algorithm computes L row by row. Every element is the remaining part
+  of A, after subtracting the dot product of the already computed elements, divided by the
+  diagonal element of the column. The diagonal element itself is the square root of the
+  remaining part. If this is not positive, A is not positive definite.
+ */
+
+/**
+  @addtogroup MatCholesky
+  @{
+ */
+
+/**
+  @brief Glue code for the Cholesky decomposition of 32-bit floating-point matrices.
+  @param[in]  pSrc Points to the symmetric, positive definite input matrix
+  @param[in]  N    Width and height of both matrices
+  @param[out] pDst Points to the output matrix L, the upper triangular part is set to zero
+  @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+ */
+
+int plp_mat_cholesky_f32(const float *__restrict__ pSrc, uint32_t N, float *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_cholesky_f32s_xpulpv2(pSrc, N, pDst);
+    }
+}
+
+/**
+  @} end of MatCholesky group
+ */
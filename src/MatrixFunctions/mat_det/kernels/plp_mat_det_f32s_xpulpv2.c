@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_det_f32s_xpulpv2.c
+ * Description:  32-bit floating-point matrix determinant for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// determinant from the packed LU factors: the product of the diagonal of U, negated if the
+// permutation is odd
+static inline float plp_mat_det_f32_from_lu(const float *pLU, const uint32_t *pPerm, uint32_t N) {
+
+    uint32_t i, j;
+    uint32_t cycles = 0;
+    float det = 1.0f;
+
+    for (i = 0; i < N; i++) {
+        det *= pLU[i * (N + 1)];
+    }
+
+    // a cycle of length c is made of c - 1 swaps, and is counted at its smallest element
+    for (i = 0; i < N; i++) {
+        j = pPerm[i];
+        while (j > i) {
+            j = pPerm[j];
+        }
+        if (j == i) {
+            cycles++;
+        }
+    }
+
+    return ((N - cycles) & 1) ? -det : det;
+}
+
+/**
+  @ingroup MatDet
+ */
+
+/**
+  @defgroup MatDetKernels matrix determinant Kernels
+  This module contains the kernels for the determinant of a matrix, see the Module matrix
+  determinant.
+  @{
+ */
+
+/**
+  @brief Determinant of a 32-bit floating-point matrix kernel for XPULPV2 extension.
+  @param[in]  pSrc     Points to the input matrix, pSrc is not modified by this kernel
+  @param[in]  N        Width and height of the matrix
+  @param[in]  pBuffer  Points to a buffer of N*N + N words for the LU decomposition
+  @param[out] pRes     Points to the determinant
+  @return     none
+ */
+
+void plp_mat_det_f32s_xpulpv2(const float *__restrict__ pSrc,
+                              uint32_t N,
+                              float *__restrict__ pBuffer,
+                              float *__restrict__ pRes) {
+
+    uint32_t *pPerm = (uint32_t *)(pBuffer + N * N);
+
+    if (plp_mat_lu_f32s_xpulpv2(pSrc, N, pBuffer, pPerm)) {
+        *pRes = 0.0f;
+    } else {
+        *pRes = plp_mat_det_f32_from_lu(pBuffer, pPerm, N);
+    }
+}
+
+/**
+   @} end of MatDetKernels group
+*/
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_det_f32.c
+ * Description:  32-bit floating-point matrix determinant glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatDet matrix determinant
+  This module contains the glue code for the determinant of a matrix. The kernel codes (kernels)
+  are in the Module matrix determinant Kernels.
+
+  The determinant of a square matrix A of dimension NxN is computed from its LU decomposition with
+  partial pivoting, P * A = L * U (see the Module LU decomposition). L has a unit diagonal, hence
+  the determinant is the product of the diagonal of U, negated if the permutation P is odd. This
+  costs about N^3/3 multiplications, instead of N^3 for the inverse. The determinant of a singular
+  matrix is 0.
+
+  The buffer pBuffer of N*N + N words holds the packed factors, followed by the permutation.
+ */
+
+/**
+  @addtogroup MatDet
+  @{
+ */
+
+/**
+  @brief Glue code for the determinant of a 32-bit floating-point matrix.
+  @param[in]  pSrc     Points to the input matrix
+  @param[in]  N        Width and height of the matrix
+  @param[in]  pBuffer  Points to a buffer of N*N + N words for the LU decomposition
+  @param[out] pRes     Points to the determinant
+  @return     0: Success, 2: operation not supported
+ */
+
+int plp_mat_det_f32(const float *__restrict__ pSrc,
+                    uint32_t N,
+                    float *__restrict__ pBuffer,
+                    float *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        plp_mat_det_f32s_xpulpv2(pSrc, N, pBuffer, pRes);
+        return 0;
+    }
+}
+
+/**
+  @} end of MatDet group
+ */
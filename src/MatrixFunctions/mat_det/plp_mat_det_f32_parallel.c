@@ -0,0 +1,103 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_det_f32_parallel.c
+ * Description:  parallel 32-bit floating-point matrix determinant glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// determinant from the packed LU factors: the product of the diagonal of U, negated if the
+// permutation is odd
+static inline float plp_mat_det_f32_from_lu(const float *pLU, const uint32_t *pPerm, uint32_t N) {
+
+    uint32_t i, j;
+    uint32_t cycles = 0;
+    float det = 1.0f;
+
+    for (i = 0; i < N; i++) {
+        det *= pLU[i * (N + 1)];
+    }
+
+    // a cycle of length c is made of c - 1 swaps, and is counted at its smallest element
+    for (i = 0; i < N; i++) {
+        j = pPerm[i];
+        while (j > i) {
+            j = pPerm[j];
+        }
+        if (j == i) {
+            cycles++;
+        }
+    }
+
+    return ((N - cycles) & 1) ? -det : det;
+}
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatDet
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel determinant of a 32-bit floating-point matrix.
+  @param[in]  pSrc     Points to the input matrix, pSrc is modified by this function
+  @param[in]  N        Width and height of the matrix
+  @param[in]  nPE      Number of cores to use for computation
+  @param[in]  pBuffer  Points to a buffer of N*N + N words for the LU decomposition
+  @param[out] pRes     Points to the determinant
+  @return     0: Success, 2: operation not supported
+
+  @par The LU decomposition is computed with plp_mat_lu_f32_parallel, and the product of the
+  diagonal after the join.
+ */
+
+int plp_mat_det_f32_parallel(float *__restrict__ pSrc,
+                             uint32_t N,
+                             uint32_t nPE,
+                             float *__restrict__ pBuffer,
+                             float *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return 2;
+    } else {
+        uint32_t *pPerm = (uint32_t *)(pBuffer + N * N);
+        int ret = plp_mat_lu_f32_parallel(pSrc, N, nPE, pBuffer, pPerm);
+
+        if (ret == 2) {
+            return 2;
+        }
+
+        *pRes = (ret == 1) ? 0.0f : plp_mat_det_f32_from_lu(pBuffer, pPerm, N);
+        return 0;
+    }
+}
+
+/**
+  @} end of MatDet group
+ */
@@ -0,0 +1,239 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_eig_sym_f32p_xpulpv2.c
+ * Description:  Parallel 32-bit floating-point symmetric eigendecomposition for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Jacobi rotation (c, s), which diagonalizes the symmetric 2x2 matrix [app apq; apq aqq]
+static inline void plp_mat_jacobi_rotation_f32(float app,
+                                               float aqq,
+                                               float apq,
+                                               float *pC,
+                                               float *pS) {
+    float tau = (aqq - app) / (2.0f * apq);
+    float t = 1.0f / (fabsf(tau) + sqrtf(1.0f + tau * tau));
+
+    if (tau < 0.0f) {
+        t = -t;
+    }
+
+    *pC = 1.0f / sqrtf(1.0f + t * t);
+    *pS = t * *pC;
+}
+
+// rotates the columns p and q of the matrix with M rows and a row stride of N
+static inline void plp_mat_jacobi_rotate_cols_f32(float *pSrc,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t p,
+                                                  uint32_t q,
+                                                  float c,
+                                                  float s) {
+    uint32_t i;
+
+    for (i = 0; i < M; i++) {
+        float xp = pSrc[i * N + p];
+        float xq = pSrc[i * N + q];
+        pSrc[i * N + p] = c * xp - s * xq;
+        pSrc[i * N + q] = s * xp + c * xq;
+    }
+}
+
+// rotates the rows p and q of the NxN matrix
+static inline void plp_mat_jacobi_rotate_rows_f32(float *pSrc,
+                                                  uint32_t N,
+                                                  uint32_t p,
+                                                  uint32_t q,
+                                                  float c,
+                                                  float s) {
+    uint32_t j;
+
+    for (j = 0; j < N; j++) {
+        float xp = pSrc[p * N + j];
+        float xq = pSrc[q * N + j];
+        pSrc[p * N + j] = c * xp - s * xq;
+        pSrc[q * N + j] = s * xp + c * xq;
+    }
+}
+
+// pair i of round r of the round-robin ordering of n indices (n even). In every round, each index
+// is part of exactly one pair, and all pairs are visited once during n - 1 rounds.
+static inline void plp_mat_jacobi_pair(uint32_t n,
+                                       uint32_t r,
+                                       uint32_t i,
+                                       uint32_t *pP,
+                                       uint32_t *pQ) {
+    uint32_t p = (i == 0) ? r : (r + i) % (n - 1);
+    uint32_t q = (i == 0) ? n - 1 : (r + n - 1 - i) % (n - 1);
+
+    *pP = (p < q) ? p : q;
+    *pQ = (p < q) ? q : p;
+}
+
+// sorts the eigenvalues in descending order, together with the columns of the eigenvectors
+static inline void plp_mat_eig_sym_sort_f32(float *pEigVal, float *pEigVec, uint32_t N) {
+    uint32_t i, j, k;
+
+    for (j = 0; j < N; j++) {
+        k = j;
+        for (i = j + 1; i < N; i++) {
+            if (pEigVal[i] > pEigVal[k]) {
+                k = i;
+            }
+        }
+        if (k != j) {
+            float tmp = pEigVal[j];
+            pEigVal[j] = pEigVal[k];
+            pEigVal[k] = tmp;
+            for (i = 0; i < N; i++) {
+                tmp = pEigVec[i * N + j];
+                pEigVec[i * N + j] = pEigVec[i * N + k];
+                pEigVec[i * N + k] = tmp;
+            }
+        }
+    }
+}
+
+/**
+  @ingroup MatEigSym
+ */
+
+/**
+  @addtogroup MatEigSymKernels
+  @{
+ */
+
+/**
+   @brief Parallel eigendecomposition of symmetric 32-bit floating-point matrices kernel for
+          XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_eig_sym_instance_f32 struct initialized by
+                     plp_mat_eig_sym_f32_parallel
+   @return     none, the status (0: Success, 1: no convergence) is written to args->ret
+
+   @par Parallelization
+   A sweep consists of N - 1 rounds of the round-robin ordering (N is rounded up to be even). The
+   N/2 rotations of a round act on disjoint rows and columns, and are distributed among the cores.
+   Each core computes the rotation of its pairs and rotates the columns of A and V. After a
+   rt_team_barrier, it rotates the rows of A. The rotations are passed between the two phases in
+   pEigVal, which is not used before the end. The number of rotations of each core is collected in
+   pRotations, such that all cores take the same decision to stop.
+*/
+
+void plp_mat_eig_sym_f32p_xpulpv2(void *args) {
+
+    uint32_t core_id = rt_core_id();
+
+    plp_mat_eig_sym_instance_f32 *a = (plp_mat_eig_sym_instance_f32 *)args;
+
+    float *__restrict__ pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pEigVal = a->pEigVal;
+    float *__restrict__ pEigVec = a->pEigVec;
+    uint32_t *pRotations = a->pRotations;
+
+    uint32_t i, r, sweep; // loop counters
+    uint32_t rotations = 1;
+    uint32_t nEven = N + (N & 1);
+    float norm2 = 0.0f;
+
+    for (i = 0; i < N * N; i++) {
+        norm2 += pSrc[i] * pSrc[i];
+    }
+    for (i = core_id; i < N * N; i += nPE) {
+        pEigVec[i] = (i % (N + 1) == 0) ? 1.0f : 0.0f;
+    }
+
+    // the Frobenius norm is invariant under the rotations
+    float thresh2 = PLP_MAT_JACOBI_TOL * PLP_MAT_JACOBI_TOL * norm2;
+
+    rt_team_barrier();
+
+    for (sweep = 0; sweep < PLP_MAT_JACOBI_MAX_SWEEPS && rotations > 0; sweep++) {
+        uint32_t *pSweepRotations = pRotations + (sweep & 1) * nPE;
+
+        pSweepRotations[core_id] = 0;
+
+        for (r = 0; r < nEven - 1; r++) {
+            uint32_t p, q;
+
+            // rotation and columns
+            for (i = core_id; i < nEven / 2; i += nPE) {
+                plp_mat_jacobi_pair(nEven, r, i, &p, &q);
+                if (q < N) {
+                    float apq = pSrc[p * N + q];
+                    float c = 1.0f;
+                    float s = 0.0f;
+
+                    if (apq * apq > thresh2) {
+                        plp_mat_jacobi_rotation_f32(pSrc[p * N + p], pSrc[q * N + q], apq, &c, &s);
+                        plp_mat_jacobi_rotate_cols_f32(pSrc, N, N, p, q, c, s);
+                        plp_mat_jacobi_rotate_cols_f32(pEigVec, N, N, p, q, c, s);
+                        pSweepRotations[core_id]++;
+                    }
+
+                    pEigVal[p] = c;
+                    pEigVal[q] = s;
+                }
+            }
+
+            rt_team_barrier();
+
+            // rows
+            for (i = core_id; i < nEven / 2; i += nPE) {
+                plp_mat_jacobi_pair(nEven, r, i, &p, &q);
+                if (q < N && pEigVal[q] != 0.0f) {
+                    plp_mat_jacobi_rotate_rows_f32(pSrc, N, p, q, pEigVal[p], pEigVal[q]);
+                    pSrc[p * N + q] = 0.0f;
+                    pSrc[q * N + p] = 0.0f;
+                }
+            }
+
+            rt_team_barrier();
+        }
+
+        // the counters of this sweep are not reset before the next barrier
+        rotations = 0;
+        for (i = 0; i < nPE; i++) {
+            rotations += pSweepRotations[i];
+        }
+    }
+
+    if (core_id == 0) {
+        for (i = 0; i < N; i++) {
+            pEigVal[i] = pSrc[i * N + i];
+        }
+
+        plp_mat_eig_sym_sort_f32(pEigVal, pEigVec, N);
+
+        a->ret = (rotations > 0) ? 1 : 0;
+    }
+}
+
+/**
+   @} end of MatEigSymKernels group
+*/
@@ -0,0 +1,187 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_eig_sym_f32s_xpulpv2.c
+ * Description:  32-bit floating-point symmetric eigendecomposition for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Jacobi rotation (c, s), which diagonalizes the symmetric 2x2 matrix [app apq; apq aqq]
+static inline void plp_mat_jacobi_rotation_f32(float app,
+                                               float aqq,
+                                               float apq,
+                                               float *pC,
+                                               float *pS) {
+    float tau = (aqq - app) / (2.0f * apq);
+    float t = 1.0f / (fabsf(tau) + sqrtf(1.0f + tau * tau));
+
+    if (tau < 0.0f) {
+        t = -t;
+    }
+
+    *pC = 1.0f / sqrtf(1.0f + t * t);
+    *pS = t * *pC;
+}
+
+// rotates the columns p and q of the matrix with M rows and a row stride of N
+static inline void plp_mat_jacobi_rotate_cols_f32(float *pSrc,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t p,
+                                                  uint32_t q,
+                                                  float c,
+                                                  float s) {
+    uint32_t i;
+
+    for (i = 0; i < M; i++) {
+        float xp = pSrc[i * N + p];
+        float xq = pSrc[i * N + q];
+        pSrc[i * N + p] = c * xp - s * xq;
+        pSrc[i * N + q] = s * xp + c * xq;
+    }
+}
+
+// rotates the rows p and q of the NxN matrix
+static inline void plp_mat_jacobi_rotate_rows_f32(float *pSrc,
+                                                  uint32_t N,
+                                                  uint32_t p,
+                                                  uint32_t q,
+                                                  float c,
+                                                  float s) {
+    uint32_t j;
+
+    for (j = 0; j < N; j++) {
+        float xp = pSrc[p * N + j];
+        float xq = pSrc[q * N + j];
+        pSrc[p * N + j] = c * xp - s * xq;
+        pSrc[q * N + j] = s * xp + c * xq;
+    }
+}
+
+// sorts the eigenvalues in descending order, together with the columns of the eigenvectors
+static inline void plp_mat_eig_sym_sort_f32(float *pEigVal, float *pEigVec, uint32_t N) {
+    uint32_t i, j, k;
+
+    for (j = 0; j < N; j++) {
+        k = j;
+        for (i = j + 1; i < N; i++) {
+            if (pEigVal[i] > pEigVal[k]) {
+                k = i;
+            }
+        }
+        if (k != j) {
+            float tmp = pEigVal[j];
+            pEigVal[j] = pEigVal[k];
+            pEigVal[k] = tmp;
+            for (i = 0; i < N; i++) {
+                tmp = pEigVec[i * N + j];
+                pEigVec[i * N + j] = pEigVec[i * N + k];
+                pEigVec[i * N + k] = tmp;
+            }
+        }
+    }
+}
+
+/**
+  @ingroup MatEigSym
+ */
+
+/**
+  @defgroup MatEigSymKernels Symmetric eigendecomposition kernels
+  This module contains the kernel functions for the eigendecomposition of symmetric matrices.
+
+  @par Algorithm
+  The cyclic Jacobi method applies plane rotations A = J^T A J, V = V J, each of which
+  annihilates one off-diagonal element. Elements which are smaller than PLP_MAT_JACOBI_TOL times
+  the Frobenius norm of A are skipped, and the iteration stops after the first sweep without a
+  rotation.
+ */
+
+/**
+  @addtogroup MatEigSymKernels
+  @{
+ */
+
+/**
+  @brief Eigendecomposition of symmetric 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in,out] pSrc     Points to the symmetric input matrix of shape NxN, overwritten
+  @param[in]     N        Width and height of the matrix
+  @param[out]    pEigVal  Points to the N eigenvalues, in descending order
+  @param[out]    pEigVec  Points to the matrix of shape NxN, whose columns are the eigenvectors
+  @return        0: Success, 1: no convergence within PLP_MAT_JACOBI_MAX_SWEEPS sweeps
+ */
+
+int plp_mat_eig_sym_f32s_xpulpv2(float *__restrict__ pSrc,
+                                 uint32_t N,
+                                 float *__restrict__ pEigVal,
+                                 float *__restrict__ pEigVec) {
+
+    uint32_t i, p, q, sweep; // loop counters
+    uint32_t rotations = 1;
+    float norm2 = 0.0f;
+
+    for (i = 0; i < N * N; i++) {
+        norm2 += pSrc[i] * pSrc[i];
+        pEigVec[i] = (i % (N + 1) == 0) ? 1.0f : 0.0f;
+    }
+
+    // the Frobenius norm is invariant under the rotations
+    float thresh2 = PLP_MAT_JACOBI_TOL * PLP_MAT_JACOBI_TOL * norm2;
+
+    for (sweep = 0; sweep < PLP_MAT_JACOBI_MAX_SWEEPS && rotations > 0; sweep++) {
+        rotations = 0;
+        for (p = 0; p < N; p++) {
+            for (q = p + 1; q < N; q++) {
+                float apq = pSrc[p * N + q];
+                float c, s;
+
+                if (apq * apq <= thresh2) {
+                    continue;
+                }
+
+                plp_mat_jacobi_rotation_f32(pSrc[p * N + p], pSrc[q * N + q], apq, &c, &s);
+                plp_mat_jacobi_rotate_cols_f32(pSrc, N, N, p, q, c, s);
+                plp_mat_jacobi_rotate_rows_f32(pSrc, N, p, q, c, s);
+                plp_mat_jacobi_rotate_cols_f32(pEigVec, N, N, p, q, c, s);
+                pSrc[p * N + q] = 0.0f;
+                pSrc[q * N + p] = 0.0f;
+                rotations++;
+            }
+        }
+    }
+
+    for (i = 0; i < N; i++) {
+        pEigVal[i] = pSrc[i * N + i];
+    }
+
+    plp_mat_eig_sym_sort_f32(pEigVal, pEigVec, N);
+
+    return (rotations > 0) ? 1 : 0;
+}
+
+/**
+  @} end of MatEigSymKernels group
+ */
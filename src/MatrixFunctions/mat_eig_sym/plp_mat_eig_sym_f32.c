@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_eig_sym_f32.c
+ * Description:  Glue code for the 32-bit floating-point symmetric eigendecomposition
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatEigSym Symmetric eigendecomposition
+  This module contains the glue code for the eigendecomposition of symmetric matrices. The kernel
+  codes (kernels) are in the Module Symmetric eigendecomposition Kernels.
+
+  A symmetric matrix A of shape NxN is decomposed into its real eigenvalues and the orthonormal
+  eigenvectors, which are stored in the columns of V:
+
+  \f[
+    A = V \cdot diag(\lambda) \cdot V^T
+  \f]
+
+  The eigenvalues are sorted in descending order, such that the first columns of V are the
+  principal components of a covariance matrix.
+
+  @par Algorithm
+  The cyclic Jacobi method applies plane rotations, which annihilate one off-diagonal element
+  each, until all off-diagonal elements are below PLP_MAT_JACOBI_TOL times the Frobenius norm of
+  A, or PLP_MAT_JACOBI_MAX_SWEEPS sweeps over all elements are done. The parallel version uses a
+  round-robin ordering, in which every round consists of N/2 rotations on disjoint rows and
+  columns. These are computed concurrently on the cores.
+ */
+
+/**
+  @addtogroup MatEigSym
+  @{
+ */
+
+/**
+  @brief Glue code for the eigendecomposition of symmetric 32-bit floating-point matrices.
+  @param[in,out] pSrc     Points to the symmetric input matrix of shape NxN, overwritten
+  @param[in]     N        Width and height of the matrix
+  @param[out]    pEigVal  Points to the N eigenvalues, in descending order
+  @param[out]    pEigVec  Points to the matrix of shape NxN, whose columns are the eigenvectors
+  @return        0: Success, 1: no convergence within PLP_MAT_JACOBI_MAX_SWEEPS sweeps, 2:
+                 operation not supported
+ */
+
+int plp_mat_eig_sym_f32(float *__restrict__ pSrc,
+                        uint32_t N,
+                        float *__restrict__ pEigVal,
+                        float *__restrict__ pEigVec) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_eig_sym_f32s_xpulpv2(pSrc, N, pEigVal, pEigVec);
+    }
+}
+
+/**
+  @} end of MatEigSym group
+ */
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_eig_sym_f32_parallel.c
+ * Description:  Glue code for the parallel 32-bit floating-point symmetric eigendecomposition
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatEigSym
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel eigendecomposition of symmetric 32-bit floating-point matrices.
+  @param[in,out] pSrc     Points to the symmetric input matrix of shape NxN, overwritten
+  @param[in]     N        Width and height of the matrix
+  @param[in]     nPE      Number of cores to use for computation
+  @param[out]    pEigVal  Points to the N eigenvalues, in descending order
+  @param[out]    pEigVec  Points to the matrix of shape NxN, whose columns are the eigenvectors
+  @return        0: Success, 1: no convergence within PLP_MAT_JACOBI_MAX_SWEEPS sweeps, 2:
+                 operation not supported
+
+  @par This function will use plp_mat_eig_sym_f32p_xpulpv2 for its computation.
+ */
+
+int plp_mat_eig_sym_f32_parallel(float *__restrict__ pSrc,
+                                 uint32_t N,
+                                 uint32_t nPE,
+                                 float *__restrict__ pEigVal,
+                                 float *__restrict__ pEigVec) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return 2;
+    } else {
+
+        if (nPE == 1) {
+            return plp_mat_eig_sym_f32s_xpulpv2(pSrc, N, pEigVal, pEigVec);
+        }
+
+        uint32_t rotations[2 * nPE];
+
+        plp_mat_eig_sym_instance_f32 args = { .pSrc = pSrc,
+                                              .N = N,
+                                              .nPE = nPE,
+                                              .pEigVal = pEigVal,
+                                              .pEigVec = pEigVec,
+                                              .pRotations = rotations,
+                                              .ret = 0 };
+
+        rt_team_fork(nPE, plp_mat_eig_sym_f32p_xpulpv2, (void *)&args);
+
+        return args.ret;
+    }
+}
+
+/**
+  @} end of MatEigSym group
+ */
@@ -0,0 +1,146 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fma_f32s_xpulpv2.c
+ * Description:  32-bit floating-point matrix multiply-accumulate kernel for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatFMA
+ */
+
+/**
+  @addtogroup MatFMAKernels
+  @{
+ */
+
+/**
+   @brief Dot product of a row of A with a column of B.
+   @param[in]  pA   points to the row of A
+   @param[in]  pB   points to the first element of the column of B
+   @param[in]  N    number of elements
+   @param[in]  O    width of B (stride of the column)
+   @return     dot product
+*/
+static inline float plp_mat_fma_dot_f32(const float *__restrict__ pA,
+                                        const float *__restrict__ pB,
+                                        uint32_t N,
+                                        uint32_t O) {
+    float sum = 0;
+    for (uint32_t n = 0; n < N; n++) {
+        sum += pA[n] * pB[n * O];
+    }
+    return sum;
+}
+
+/**
+  @brief Matrix multiply-accumulate of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]     pSrcA     points to the first input matrix
+  @param[in]     pSrcB     points to the second input matrix
+  @param[in]     pBias     points to the bias vector of length O, or NULL if no bias is added
+  @param[in]     M         height of the first input matrix
+  @param[in]     N         width of the first input matrix and hight of the second
+  @param[in]     O         width of the second input matrix
+  @param[in,out] pDstC     points to the accumulator matrix C, which is updated in place
+  @return        none
+
+  @par Blocking
+  Blocks of 2x2 elements of C are computed at once, such that every loaded value of A and B is
+  used twice. The bias and the old value of C are only added after the dot product has been
+  accumulated.
+ */
+
+void plp_mat_fma_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcB,
+                              const float *__restrict__ pBias,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              float *__restrict__ pDstC) {
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    for (m = 0; m + 2 <= M; m += 2) {
+        const float *pA0 = pSrcA + m * N;
+        const float *pA1 = pA0 + N;
+        float *pC0 = pDstC + m * O;
+        float *pC1 = pC0 + O;
+
+        for (o = 0; o + 2 <= O; o += 2) {
+            float sum00 = 0.0f;
+            float sum01 = 0.0f;
+            float sum10 = 0.0f;
+            float sum11 = 0.0f;
+
+            for (n = 0; n < N; n++) {
+                float a0 = pA0[n];
+                float a1 = pA1[n];
+                float b0 = pSrcB[n * O + o];
+                float b1 = pSrcB[n * O + o + 1];
+                sum00 += a0 * b0;
+                sum01 += a0 * b1;
+                sum10 += a1 * b0;
+                sum11 += a1 * b1;
+            }
+
+            if (pBias != NULL) {
+                sum00 += pBias[o];
+                sum10 += pBias[o];
+                sum01 += pBias[o + 1];
+                sum11 += pBias[o + 1];
+            }
+
+            pC0[o] += sum00;
+            pC0[o + 1] += sum01;
+            pC1[o] += sum10;
+            pC1[o + 1] += sum11;
+        }
+
+        // clean up for the remaining columns
+        for (; o < O; o++) {
+            float bias = (pBias != NULL) ? pBias[o] : 0.0f;
+            float sum0 = plp_mat_fma_dot_f32(pA0, pSrcB + o, N, O) + bias;
+            float sum1 = plp_mat_fma_dot_f32(pA1, pSrcB + o, N, O) + bias;
+            pC0[o] += sum0;
+            pC1[o] += sum1;
+        }
+    }
+
+    // clean up for the last row
+    for (; m < M; m++) {
+        for (o = 0; o < O; o++) {
+            float bias = (pBias != NULL) ? pBias[o] : 0.0f;
+            float sum = plp_mat_fma_dot_f32(pSrcA + m * N, pSrcB + o, N, O) + bias;
+            pDstC[m * O + o] += sum;
+        }
+    }
+}
+
+/**
+   @} end of MatFMAKernels group
+*/
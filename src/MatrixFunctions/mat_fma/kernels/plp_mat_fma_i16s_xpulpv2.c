@@ -0,0 +1,167 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fma_i16s_xpulpv2.c
+ * Description:  16-bit integer matrix multiply-accumulate kernel for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatFMA
+ */
+
+/**
+  @addtogroup MatFMAKernels
+  @{
+ */
+
+/**
+   @brief Dot product of a row of A with a column of B.
+   @param[in]  pA   points to the row of A
+   @param[in]  pB   points to the first element of the column of B
+   @param[in]  N    number of elements
+   @param[in]  O    width of B (stride of the column)
+   @return     dot product
+*/
+static inline int32_t plp_mat_fma_dot_i16(const int16_t *__restrict__ pA,
+                                          const int16_t *__restrict__ pB,
+                                          uint32_t N,
+                                          uint32_t O) {
+    int32_t sum = 0;
+    for (uint32_t n = 0; n < N; n++) {
+        sum += pA[n] * pB[n * O];
+    }
+    return sum;
+}
+
+RT_CL_DATA static v2s mask0 = { 0, 2 };
+RT_CL_DATA static v2s mask1 = { 1, 3 };
+
+/**
+  @brief Matrix multiply-accumulate of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]     pSrcA     points to the first input matrix
+  @param[in]     pSrcB     points to the second input matrix
+  @param[in]     pBias     points to the bias vector of length O, or NULL if no bias is added
+  @param[in]     M         height of the first input matrix
+  @param[in]     N         width of the first input matrix and hight of the second
+  @param[in]     O         width of the second input matrix
+  @param[in,out] pDstC     points to the accumulator matrix C, which is updated in place
+  @return        none
+
+  @par Exploiting SIMD instructions
+  Blocks of 2x2 elements of C are computed at once. The 16 bit values of A are loaded two at a
+  time, and two rows of B are shuffled into columns, such that four pv.sdotsp.h instructions
+  reuse each loaded vector. The bias and the old value of C are only added after the dot
+  product has been accumulated.
+ */
+
+void plp_mat_fma_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              const int32_t *__restrict__ pBias,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC) {
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    for (m = 0; m + 2 <= M; m += 2) {
+        const int16_t *pA0 = pSrcA + m * N;
+        const int16_t *pA1 = pA0 + N;
+        int32_t *pC0 = pDstC + m * O;
+        int32_t *pC1 = pC0 + O;
+
+        for (o = 0; o + 2 <= O; o += 2) {
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+
+            for (n = 0; n + 2 <= N; n += 2) {
+                v2s aVec0 = *((v2s *)&pA0[n]);
+                v2s aVec1 = *((v2s *)&pA1[n]);
+
+                v2s temp0 = *((v2s *)&pSrcB[n * O + o]);
+                v2s temp1 = *((v2s *)&pSrcB[(n + 1) * O + o]);
+
+                v2s bVec0 = __builtin_shuffle(temp0, temp1, mask0); // 0,2
+                v2s bVec1 = __builtin_shuffle(temp0, temp1, mask1); // 1,3
+
+                sum00 = __SUMDOTP2(aVec0, bVec0, sum00);
+                sum01 = __SUMDOTP2(aVec0, bVec1, sum01);
+                sum10 = __SUMDOTP2(aVec1, bVec0, sum10);
+                sum11 = __SUMDOTP2(aVec1, bVec1, sum11);
+            }
+
+            // clean up for odd N
+            for (; n < N; n++) {
+                int32_t a0 = pA0[n];
+                int32_t a1 = pA1[n];
+                int32_t b0 = pSrcB[n * O + o];
+                int32_t b1 = pSrcB[n * O + o + 1];
+                sum00 += a0 * b0;
+                sum01 += a0 * b1;
+                sum10 += a1 * b0;
+                sum11 += a1 * b1;
+            }
+
+            if (pBias != NULL) {
+                sum00 += pBias[o];
+                sum10 += pBias[o];
+                sum01 += pBias[o + 1];
+                sum11 += pBias[o + 1];
+            }
+
+            pC0[o] += sum00;
+            pC0[o + 1] += sum01;
+            pC1[o] += sum10;
+            pC1[o + 1] += sum11;
+        }
+
+        // clean up for the remaining columns
+        for (; o < O; o++) {
+            int32_t bias = (pBias != NULL) ? pBias[o] : 0;
+            int32_t sum0 = plp_mat_fma_dot_i16(pA0, pSrcB + o, N, O) + bias;
+            int32_t sum1 = plp_mat_fma_dot_i16(pA1, pSrcB + o, N, O) + bias;
+            pC0[o] += sum0;
+            pC1[o] += sum1;
+        }
+    }
+
+    // clean up for the last row
+    for (; m < M; m++) {
+        for (o = 0; o < O; o++) {
+            int32_t bias = (pBias != NULL) ? pBias[o] : 0;
+            int32_t sum = plp_mat_fma_dot_i16(pSrcA + m * N, pSrcB + o, N, O) + bias;
+            pDstC[m * O + o] += sum;
+        }
+    }
+}
+
+/**
+   @} end of MatFMAKernels group
+*/
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fma_i8s_rv32im.c
+ * Description:  8-bit integer matrix multiply-accumulate kernel for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatFMA
+ */
+
+/**
+  @addtogroup MatFMAKernels
+  @{
+ */
+
+/**
+  @brief Matrix multiply-accumulate of 8-bit integer matrices kernel for RV32IM extension.
+  @param[in]     pSrcA     points to the first input matrix
+  @param[in]     pSrcB     points to the second input matrix
+  @param[in]     pBias     points to the bias vector of length O, or NULL if no bias is added
+  @param[in]     M         height of the first input matrix
+  @param[in]     N         width of the first input matrix and hight of the second
+  @param[in]     O         width of the second input matrix
+  @param[in,out] pDstC     points to the accumulator matrix C, which is updated in place
+  @return        none
+ */
+
+void plp_mat_fma_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                            const int8_t *__restrict__ pSrcB,
+                            const int32_t *__restrict__ pBias,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    for (m = 0; m < M; m++) {
+        for (o = 0; o < O; o++) {
+            int32_t sum = (pBias != NULL) ? pBias[o] : 0;
+            for (n = 0; n < N; n++) {
+                sum += (int32_t)pSrcA[m * N + n] * (int32_t)pSrcB[n * O + o];
+            }
+            pDstC[m * O + o] += sum;
+        }
+    }
+}
+
+/**
+   @} end of MatFMAKernels group
+*/
@@ -0,0 +1,220 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fma_q8p_xpulpv2.c
+ * Description:  parallel 8-bit fix-point matrix multiply-accumulate kernel for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatFMA
+ */
+
+/**
+  @addtogroup MatFMAKernels
+  @{
+ */
+
+/**
+   @brief Dot product of a row of A with a column of B.
+   @param[in]  pA   points to the row of A
+   @param[in]  pB   points to the first element of the column of B
+   @param[in]  N    number of elements
+   @param[in]  O    width of B (stride of the column)
+   @return     dot product
+*/
+static inline int32_t plp_mat_fma_dot_q8(const int8_t *__restrict__ pA,
+                                         const int8_t *__restrict__ pB,
+                                         uint32_t N,
+                                         uint32_t O) {
+    int32_t sum = 0;
+    for (uint32_t n = 0; n < N; n++) {
+        sum += pA[n] * pB[n * O];
+    }
+    return sum;
+}
+
+/**
+   @brief Requantize an accumulated sum and add it to an element of C with saturation.
+   @param[in]  c      old value of C
+   @param[in]  sum    accumulated product and bias
+   @param[in]  shift  amount to shift the sum
+   @return     new value of C
+*/
+static inline int8_t plp_mat_fma_requant_q8(int8_t c, int32_t sum, uint32_t shift) {
+    return (int8_t)__CLIP((int32_t)c + __ROUNDNORM_REG(sum, shift), 7);
+}
+
+RT_CL_DATA static v4s mask0 = { 0, 1, 4, 5 };
+RT_CL_DATA static v4s mask1 = { 2, 3, 6, 7 };
+RT_CL_DATA static v4s mask2 = { 0, 2, 4, 6 };
+RT_CL_DATA static v4s mask3 = { 1, 3, 5, 7 };
+
+/**
+  @brief Parallel matrix multiply-accumulate of 8-bit fix-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_fma_instance_q8 struct initialized by
+                    plp_mat_fma_q8_parallel
+  @return     none
+
+  @par Parallelization
+  The output matrix is split into a 2-D grid of rectangles with plp_mat_partition, and every core
+  updates its own rectangle of C. Thus, no synchronization is needed.
+
+  @par Exploiting SIMD instructions
+  Blocks of 2x4 elements of C are computed at once. The 8 bit values of A are loaded four at a
+  time, and four rows of B are shuffled into columns, such that eight pv.sdotsp.b instructions
+  reuse each loaded vector. The bias and the old value of C are only added after the dot
+  product has been accumulated.
+ */
+
+void plp_mat_fma_q8p_xpulpv2(void *args) {
+
+    plp_mat_fma_instance_q8 *a = (plp_mat_fma_instance_q8 *)args;
+
+    const int8_t *__restrict__ pSrcA = a->pSrcA;
+    const int8_t *__restrict__ pSrcB = a->pSrcB;
+    const int32_t *__restrict__ pBias = a->pBias;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t shift = a->shift;
+    uint32_t nPE = a->nPE;
+    int8_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    plp_mat_partition_t part;
+    plp_mat_partition(M, O, nPE, rt_core_id(), &part);
+
+    for (m = part.rowStart; m + 2 <= part.rowEnd; m += 2) {
+        const int8_t *pA0 = pSrcA + m * N;
+        const int8_t *pA1 = pA0 + N;
+        int8_t *pC0 = pDstC + m * O;
+        int8_t *pC1 = pC0 + O;
+
+        for (o = part.colStart; o + 4 <= part.colEnd; o += 4) {
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum02 = 0;
+            int32_t sum03 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+            int32_t sum12 = 0;
+            int32_t sum13 = 0;
+
+            for (n = 0; n + 4 <= N; n += 4) {
+                v4s aVec0 = *((v4s *)&pA0[n]);
+                v4s aVec1 = *((v4s *)&pA1[n]);
+
+                v4s temp0 = *((v4s *)&pSrcB[n * O + o]);
+                v4s temp1 = *((v4s *)&pSrcB[(n + 1) * O + o]);
+                v4s temp2 = *((v4s *)&pSrcB[(n + 2) * O + o]);
+                v4s temp3 = *((v4s *)&pSrcB[(n + 3) * O + o]);
+
+                v4s temp4 = __builtin_shuffle(temp0, temp1, mask0); // 0,1,4,5
+                v4s temp5 = __builtin_shuffle(temp2, temp3, mask0); // 8,9,12,13
+                v4s temp6 = __builtin_shuffle(temp0, temp1, mask1); // 2,3,6,7
+                v4s temp7 = __builtin_shuffle(temp2, temp3, mask1); // 10,11,14,15
+
+                v4s bVec0 = __builtin_shuffle(temp4, temp5, mask2); // 0,4,8,12
+                v4s bVec1 = __builtin_shuffle(temp4, temp5, mask3); // 1,5,9,13
+                v4s bVec2 = __builtin_shuffle(temp6, temp7, mask2); // 2,6,10,14
+                v4s bVec3 = __builtin_shuffle(temp6, temp7, mask3); // 3,7,11,15
+
+                sum00 = __SUMDOTP4(aVec0, bVec0, sum00);
+                sum01 = __SUMDOTP4(aVec0, bVec1, sum01);
+                sum02 = __SUMDOTP4(aVec0, bVec2, sum02);
+                sum03 = __SUMDOTP4(aVec0, bVec3, sum03);
+                sum10 = __SUMDOTP4(aVec1, bVec0, sum10);
+                sum11 = __SUMDOTP4(aVec1, bVec1, sum11);
+                sum12 = __SUMDOTP4(aVec1, bVec2, sum12);
+                sum13 = __SUMDOTP4(aVec1, bVec3, sum13);
+            }
+
+            // clean up for N not divisible by 4
+            for (; n < N; n++) {
+                int32_t a0 = pA0[n];
+                int32_t a1 = pA1[n];
+                int32_t b0 = pSrcB[n * O + o];
+                int32_t b1 = pSrcB[n * O + o + 1];
+                int32_t b2 = pSrcB[n * O + o + 2];
+                int32_t b3 = pSrcB[n * O + o + 3];
+                sum00 += a0 * b0;
+                sum01 += a0 * b1;
+                sum02 += a0 * b2;
+                sum03 += a0 * b3;
+                sum10 += a1 * b0;
+                sum11 += a1 * b1;
+                sum12 += a1 * b2;
+                sum13 += a1 * b3;
+            }
+
+            if (pBias != NULL) {
+                sum00 += pBias[o];
+                sum10 += pBias[o];
+                sum01 += pBias[o + 1];
+                sum11 += pBias[o + 1];
+                sum02 += pBias[o + 2];
+                sum12 += pBias[o + 2];
+                sum03 += pBias[o + 3];
+                sum13 += pBias[o + 3];
+            }
+
+            pC0[o] = plp_mat_fma_requant_q8(pC0[o], sum00, shift);
+            pC0[o + 1] = plp_mat_fma_requant_q8(pC0[o + 1], sum01, shift);
+            pC0[o + 2] = plp_mat_fma_requant_q8(pC0[o + 2], sum02, shift);
+            pC0[o + 3] = plp_mat_fma_requant_q8(pC0[o + 3], sum03, shift);
+            pC1[o] = plp_mat_fma_requant_q8(pC1[o], sum10, shift);
+            pC1[o + 1] = plp_mat_fma_requant_q8(pC1[o + 1], sum11, shift);
+            pC1[o + 2] = plp_mat_fma_requant_q8(pC1[o + 2], sum12, shift);
+            pC1[o + 3] = plp_mat_fma_requant_q8(pC1[o + 3], sum13, shift);
+        }
+
+        // clean up for the remaining columns
+        for (; o < part.colEnd; o++) {
+            int32_t bias = (pBias != NULL) ? pBias[o] : 0;
+            int32_t sum0 = plp_mat_fma_dot_q8(pA0, pSrcB + o, N, O) + bias;
+            int32_t sum1 = plp_mat_fma_dot_q8(pA1, pSrcB + o, N, O) + bias;
+            pC0[o] = plp_mat_fma_requant_q8(pC0[o], sum0, shift);
+            pC1[o] = plp_mat_fma_requant_q8(pC1[o], sum1, shift);
+        }
+    }
+
+    // clean up for the last row
+    for (; m < part.rowEnd; m++) {
+        for (o = part.colStart; o < part.colEnd; o++) {
+            int32_t bias = (pBias != NULL) ? pBias[o] : 0;
+            int32_t sum = plp_mat_fma_dot_q8(pSrcA + m * N, pSrcB + o, N, O) + bias;
+            pDstC[m * O + o] = plp_mat_fma_requant_q8(pDstC[m * O + o], sum, shift);
+        }
+    }
+}
+
+/**
+   @} end of MatFMAKernels group
+*/
@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fma_i16.c
+ * Description:  16-bit integer matrix multiply-accumulate glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatFMA Matrix Multiply-Accumulate
+  This module contains the glue code for the fused Matrix Multiply-Accumulate. The kernel codes
+  (kernels) are in the Module Matrix Multiply-Accumulate Kernels.
+
+  The Matrix Multiply-Accumulate adds the product of two matrices with dimensions MxN and NxO,
+  and an optional bias vector of length O, to the accumulator matrix C with dimension MxO. For
+  fix-point implementations, the sum is requantized (shifted and saturated) before it is written
+  back. All three steps are done in a single pass over C.
+
+      `pDstC[m,o] = pDstC[m,o] + pBias[o] + pSrcA[m,0]*pSrcB[0,o] + ... + pSrcA[m,N-1]*pSrcB[N-1,o]`
+
+  There are functions for integer and fix-point 16- and 8-bit data types, and for 32-bit
+  floating-point. The integer versions accumulate into a 32-bit integer matrix.
+
+  The naming scheme of the functions follows the following pattern (for example
+  `plp_mat_fma_i16`):
+
+      `plp_<function name>_<data type><precision>[_parallel]`
+
+  name          | description
+  ------------- | ---------------------------------------------------------
+  function_name | `mat_fma`
+  data type     | {f, i, q} respectively for floats, integers, fixed points
+  precision     | {32, 16, 8} bits
+ */
+
+/**
+  @addtogroup MatFMA
+  @{
+ */
+
+/**
+  @brief Glue code for matrix multiply-accumulate of 16-bit integer matrices.
+  @param[in]     pSrcA     points to the first input matrix
+  @param[in]     pSrcB     points to the second input matrix
+  @param[in]     pBias     points to the bias vector of length O, or NULL if no bias is added
+  @param[in]     M         height of the first input matrix
+  @param[in]     N         width of the first input matrix and hight of the second
+  @param[in]     O         width of the second input matrix
+  @param[in,out] pDstC     points to the accumulator matrix C, which is updated in place
+  @return        none
+ */
+
+void plp_mat_fma_i16(const int16_t *__restrict__ pSrcA,
+                     const int16_t *__restrict__ pSrcB,
+                     const int32_t *__restrict__ pBias,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_fma_i16s_rv32im(pSrcA, pSrcB, pBias, M, N, O, pDstC);
+    } else {
+        plp_mat_fma_i16s_xpulpv2(pSrcA, pSrcB, pBias, M, N, O, pDstC);
+    }
+}
+
+/**
+  @} end of MatFMA group
+ */
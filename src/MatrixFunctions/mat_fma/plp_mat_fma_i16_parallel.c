@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fma_i16_parallel.c
+ * Description:  parallel 16-bit integer matrix multiply-accumulate glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatFMA
+  @{
+ */
+
+/**
+  @brief Glue code for parallel matrix multiply-accumulate of 16-bit integer matrices.
+  @param[in]     pSrcA     points to the first input matrix
+  @param[in]     pSrcB     points to the second input matrix
+  @param[in]     pBias     points to the bias vector of length O, or NULL if no bias is added
+  @param[in]     M         height of the first input matrix
+  @param[in]     N         width of the first input matrix and hight of the second
+  @param[in]     O         width of the second input matrix
+  @param[in]     nPE       number of cores to use
+  @param[in,out] pDstC     points to the accumulator matrix C, which is updated in place
+  @return        none
+ */
+
+void plp_mat_fma_i16_parallel(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              const int32_t *__restrict__ pBias,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_fma_instance_i16 args = { .pSrcA = pSrcA,
+                                          .pSrcB = pSrcB,
+                                          .pBias = pBias,
+                                          .M = M,
+                                          .N = N,
+                                          .O = O,
+                                          .nPE = nPE,
+                                          .pDstC = pDstC };
+
+        rt_team_fork(nPE, plp_mat_fma_i16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatFMA group
+ */
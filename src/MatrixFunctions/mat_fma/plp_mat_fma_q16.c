@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_fma_q16.c
+ * Description:  16-bit fix-point matrix multiply-accumulate glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatFMA
+  @{
+ */
+
+/**
+  @brief Glue code for matrix multiply-accumulate of 16-bit fix-point matrices.
+  @param[in]     pSrcA     points to the first input matrix
+  @param[in]     pSrcB     points to the second input matrix
+  @param[in]     pBias     points to the bias vector of length O, or NULL if no bias is added
+  @param[in]     M         height of the first input matrix
+  @param[in]     N         width of the first input matrix and hight of the second
+  @param[in]     O         width of the second input matrix
+  @param[in]     shift     amount to shift the accumulated product before adding it to C
+  @param[in,out] pDstC     points to the accumulator matrix C, which is updated in place
+  @return        none
+
+  @par Fix-Point, Shifting and Saturation
+  The product A*B and the bias are accumulated with 32 bits, without intermediate shifts. The
+  result is shifted by `shift` to the right (with rounding), added to C and saturated to
+  16 bits. Assume that matrix A is represented as pSrcA * 2^-x and matrix B as pSrcB * 2^-y.
+  Then, the bias must be represented with x + y fractional bits, and C with x + y - shift.
+ */
+
+void plp_mat_fma_q16(const int16_t *__restrict__ pSrcA,
+                     const int16_t *__restrict__ pSrcB,
+                     const int32_t *__restrict__ pBias,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     uint32_t shift,
+                     int16_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_fma_q16s_rv32im(pSrcA, pSrcB, pBias, M, N, O, shift, pDstC);
+    } else {
+        plp_mat_fma_q16s_xpulpv2(pSrcA, pSrcB, pBias, M, N, O, shift, pDstC);
+    }
+}
+
+/**
+  @} end of MatFMA group
+ */
@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_inv_batched_f32p_xpulpv2.c
+ * Description:  parallel batched 32-bit floating-point matrix inversion for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatInv
+ */
+
+/**
+  @addtogroup MatInvKernels
+  @{
+ */
+
+/**
+   @brief Parallel batched matrix inversion of 32-bit floating-point matrices kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_mat_inv_batched_instance_f32 struct initialized by
+                     plp_mat_inv_batched_f32_parallel
+   @return     none, the status (0: Success, 1: At least one matrix is singular) is written to
+               args->ret
+
+   @par Parallelization
+   The matrices are distributed cyclically among the cores, and every core inverts whole matrices
+   with the single-core kernels, including the closed-form kernels for small matrices.
+*/
+
+void plp_mat_inv_batched_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_inv_batched_instance_f32 *a = (plp_mat_inv_batched_instance_f32 *)args;
+
+    float *const *pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t batch = a->batch;
+    uint32_t nPE = a->nPE;
+    float *const *pDst = a->pDst;
+    int *pStatus = a->pStatus;
+
+    uint32_t b; // loop counter
+    int ret;    // status of the current inversion
+
+    for (b = core_id; b < batch; b += nPE) {
+        switch (N) {
+        case 2:
+            ret = plp_mat_inv_2x2_f32s_xpulpv2(pSrc[b], pDst[b]);
+            break;
+        case 3:
+            ret = plp_mat_inv_3x3_f32s_xpulpv2(pSrc[b], pDst[b]);
+            break;
+        case 4:
+            ret = plp_mat_inv_4x4_f32s_xpulpv2(pSrc[b], pDst[b]);
+            break;
+        default:
+            ret = plp_mat_inv_f32s_xpulpv2(pSrc[b], N, pDst[b]);
+            break;
+        }
+
+        if (pStatus != NULL) {
+            pStatus[b] = ret;
+        }
+
+        // all cores which find a singular matrix write the same value
+        if (ret != 0) {
+            a->ret = 1;
+        }
+    }
+}
+
+/**
+   @} end of MatInvKernels group
+*/
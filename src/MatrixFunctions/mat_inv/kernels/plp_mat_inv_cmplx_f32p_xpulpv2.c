@@ -0,0 +1,224 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_inv_cmplx_f32p_xpulpv2.c
+ * Description:  Complex 32-bit floating-point parallel matrix inversion kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatInv
+ */
+
+/**
+  @addtogroup MatInvKernels
+  @{
+ */
+
+/**
+   @brief Parallel matrix inversion of complex 32-bit floating-point matrices kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_mat_inv_instance_f32 struct initialized by
+                    plp_mat_inv_cmplx_f32_parallel
+   @return     none, the status (0: Success, 1: Matrix is singular) is written to args->ret
+
+   @par Parallelization
+   Same scheme as plp_mat_inv_f32p_xpulpv2, with the pivot search on the squared magnitude. Row i
+   of both matrices is owned by core i % nPE, the rows are never swapped physically, and a single
+   rt_team_barrier per pivot step is enough.
+*/
+
+void plp_mat_inv_cmplx_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_inv_instance_f32 *a = (plp_mat_inv_instance_f32 *)args;
+
+    float *__restrict__ pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDst = a->pDst;
+    float *pPivotVal = a->pPivotVal;
+    uint32_t *pPivotRow = a->pPivotRow;
+    uint32_t *pPerm = a->pPerm;
+    uint32_t *pRowUsed = a->pRowUsed;
+
+    uint32_t i, j, l; // loop counters
+    uint32_t p;       // pivot row
+    float best;       // largest squared magnitude of the local pivot search
+    uint32_t bestRow; // row of the local pivot candidate
+
+    // initialize the own rows of the destination matrix to the identity matrix and search the
+    // pivot candidate in the first column
+    best = 0.0f;
+    bestRow = N;
+    for (i = core_id; i < N; i += nPE) {
+        for (j = 0; j < 2 * N; j++) {
+            pDst[2 * i * N + j] = 0.0f;
+        }
+        pDst[2 * (i * N + i)] = 1.0f;
+        pRowUsed[i] = 0;
+
+        float re = pSrc[2 * i * N];
+        float im = pSrc[2 * i * N + 1];
+        float val = re * re + im * im;
+        if (val > best) {
+            best = val;
+            bestRow = i;
+        }
+    }
+    pPivotVal[core_id] = best;
+    pPivotRow[core_id] = bestRow;
+
+    for (l = 0; l < N; l++) {
+
+        float *pPivotValL = pPivotVal + (l & 1) * nPE;
+        uint32_t *pPivotRowL = pPivotRow + (l & 1) * nPE;
+
+        rt_team_barrier();
+
+        // combine the partial pivot search. Ties are resolved by the lower row index, such that
+        // every core ends up with the same pivot row.
+        best = 0.0f;
+        p = N;
+        for (i = 0; i < nPE; i++) {
+            float val = pPivotValL[i];
+            uint32_t row = pPivotRowL[i];
+            if (val > best || (val == best && val != 0.0f && row < p)) {
+                best = val;
+                p = row;
+            }
+        }
+
+        // every core reaches the same decision, no core is left waiting in a barrier
+        if (best == 0.0f) {
+            if (core_id == 0) {
+                a->ret = 1;
+            }
+            return;
+        }
+
+        if (core_id == 0) {
+            pPerm[l] = p;
+        }
+        if (p % nPE == core_id) {
+            pRowUsed[p] = 1;
+        }
+
+        float *pPivotRowSrc = pSrc + 2 * p * N;
+        float *pPivotRowDst = pDst + 2 * p * N;
+
+        // reciprocal of the pivot element
+        float invRe = pPivotRowSrc[2 * l] / best;
+        float invIm = -pPivotRowSrc[2 * l + 1] / best;
+
+        // eliminate column l in all own rows (except the pivot row), and look for the pivot
+        // candidate of column l + 1 in the rows which have not yet been used as pivot.
+        best = 0.0f;
+        bestRow = N;
+        for (i = core_id; i < N; i += nPE) {
+            if (i == p) {
+                continue;
+            }
+
+            float *pRowSrc = pSrc + 2 * i * N;
+            float *pRowDst = pDst + 2 * i * N;
+            float re = pRowSrc[2 * l];
+            float im = pRowSrc[2 * l + 1];
+            float fRe = re * invRe - im * invIm;
+            float fIm = re * invIm + im * invRe;
+
+            if (fRe != 0.0f || fIm != 0.0f) {
+                // all elements left of column l in the pivot row are zero
+                pRowSrc[2 * l] = 0.0f;
+                pRowSrc[2 * l + 1] = 0.0f;
+                for (j = l + 1; j < N; j++) {
+                    re = pPivotRowSrc[2 * j];
+                    im = pPivotRowSrc[2 * j + 1];
+                    pRowSrc[2 * j] -= fRe * re - fIm * im;
+                    pRowSrc[2 * j + 1] -= fRe * im + fIm * re;
+                }
+                for (j = 0; j < N; j++) {
+                    re = pPivotRowDst[2 * j];
+                    im = pPivotRowDst[2 * j + 1];
+                    pRowDst[2 * j] -= fRe * re - fIm * im;
+                    pRowDst[2 * j + 1] -= fRe * im + fIm * re;
+                }
+            }
+
+            if (l + 1 < N && !pRowUsed[i]) {
+                re = pRowSrc[2 * (l + 1)];
+                im = pRowSrc[2 * (l + 1) + 1];
+                float val = re * re + im * im;
+                if (val > best) {
+                    best = val;
+                    bestRow = i;
+                }
+            }
+        }
+
+        pPivotVal[((l + 1) & 1) * nPE + core_id] = best;
+        pPivotRow[((l + 1) & 1) * nPE + core_id] = bestRow;
+    }
+
+    rt_team_barrier();
+
+    // normalize the own rows and store them in pSrc, which is not needed anymore. Row i was the
+    // pivot row of the column in which it has its only non-zero element.
+    for (l = 0; l < N; l++) {
+        i = pPerm[l];
+        if (i % nPE == core_id) {
+            float pRe = pSrc[2 * (i * N + l)];
+            float pIm = pSrc[2 * (i * N + l) + 1];
+            float mag2 = pRe * pRe + pIm * pIm;
+            float invRe = pRe / mag2;
+            float invIm = -pIm / mag2;
+            for (j = 0; j < N; j++) {
+                float re = pDst[2 * (i * N + j)];
+                float im = pDst[2 * (i * N + j) + 1];
+                pSrc[2 * (i * N + j)] = re * invRe - im * invIm;
+                pSrc[2 * (i * N + j) + 1] = re * invIm + im * invRe;
+            }
+        }
+    }
+
+    rt_team_barrier();
+
+    // undo the row permutation
+    for (l = core_id; l < N; l += nPE) {
+        i = pPerm[l];
+        for (j = 0; j < 2 * N; j++) {
+            pDst[2 * l * N + j] = pSrc[2 * i * N + j];
+        }
+    }
+
+    if (core_id == 0) {
+        a->ret = 0;
+    }
+}
+
+/**
+   @} end of MatInvKernels group
+*/
@@ -43,16 +43,163 @@
    @brief Parallel matrix inversion of 32-bit floating-point matrices kernel for XPULPV2 extension.
    @param[in]  args  pointer to plp_mat_inv_instance_f32 struct initialized by
                     plp_mat_inv_f32_parallel
-   @return     0: Success, 1: Matrix is singular
+   @return     none, the status (0: Success, 1: Matrix is singular) is written to args->ret
 
-   @warn Not yet implemented
+   @par Parallelization
+   Gauss-Jordan elimination with partial pivoting. Row i of both matrices is owned by core
+   i % nPE. The rows are never swapped physically. Instead, the pivot row of every column is
+   remembered, and the rows are normalized and permuted once at the very end. Every core searches
+   the pivot candidate of the next column among its own rows directly after eliminating them.
+   Hence, a single rt_team_barrier per pivot step is enough, after which all cores combine the
+   partial results (double buffered) and deterministically agree on the same pivot row.
 */
 
-int plp_mat_inv_f32p_xpulpv2(void *args) {
+void plp_mat_inv_f32p_xpulpv2(void *args) {
 
-    // TODO
+    int core_id = rt_core_id();
 
-    return 1;
+    plp_mat_inv_instance_f32 *a = (plp_mat_inv_instance_f32 *)args;
+
+    float *__restrict__ pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDst = a->pDst;
+    float *pPivotVal = a->pPivotVal;
+    uint32_t *pPivotRow = a->pPivotRow;
+    uint32_t *pPerm = a->pPerm;
+    uint32_t *pRowUsed = a->pRowUsed;
+
+    uint32_t i, j, l; // loop counters
+    uint32_t p;       // pivot row
+    float pivot;      // pivot element
+    float best;       // largest absolute value of the local pivot search
+    uint32_t bestRow; // row of the local pivot candidate
+
+    // initialize the own rows of the destination matrix to the identity matrix and search the
+    // pivot candidate in the first column
+    best = 0.0f;
+    bestRow = N;
+    for (i = core_id; i < N; i += nPE) {
+        for (j = 0; j < N; j++) {
+            pDst[i * N + j] = 0.0f;
+        }
+        pDst[i * N + i] = 1.0f;
+        pRowUsed[i] = 0;
+
+        float val = fabsf(pSrc[i * N]);
+        if (val > best) {
+            best = val;
+            bestRow = i;
+        }
+    }
+    pPivotVal[core_id] = best;
+    pPivotRow[core_id] = bestRow;
+
+    for (l = 0; l < N; l++) {
+
+        float *pPivotValL = pPivotVal + (l & 1) * nPE;
+        uint32_t *pPivotRowL = pPivotRow + (l & 1) * nPE;
+
+        rt_team_barrier();
+
+        // combine the partial pivot search. Ties are resolved by the lower row index, such that
+        // every core ends up with the same pivot row.
+        best = 0.0f;
+        p = N;
+        for (i = 0; i < nPE; i++) {
+            float val = pPivotValL[i];
+            uint32_t row = pPivotRowL[i];
+            if (val > best || (val == best && val != 0.0f && row < p)) {
+                best = val;
+                p = row;
+            }
+        }
+
+        // every core reaches the same decision, no core is left waiting in a barrier
+        if (best == 0.0f) {
+            if (core_id == 0) {
+                a->ret = 1;
+            }
+            return;
+        }
+
+        if (core_id == 0) {
+            pPerm[l] = p;
+        }
+        if (p % nPE == core_id) {
+            pRowUsed[p] = 1;
+        }
+
+        float *pPivotRowSrc = pSrc + p * N;
+        float *pPivotRowDst = pDst + p * N;
+        pivot = pPivotRowSrc[l];
+
+        float invPivot = 1.0f / pivot;
+
+        // eliminate column l in all own rows (except the pivot row), and look for the pivot
+        // candidate of column l + 1 in the rows which have not yet been used as pivot.
+        best = 0.0f;
+        bestRow = N;
+        for (i = core_id; i < N; i += nPE) {
+            if (i == p) {
+                continue;
+            }
+
+            float *pRowSrc = pSrc + i * N;
+            float *pRowDst = pDst + i * N;
+            float factor = pRowSrc[l] * invPivot;
+
+            if (factor != 0.0f) {
+                // all elements left of column l in the pivot row are zero
+                pRowSrc[l] = 0.0f;
+                for (j = l + 1; j < N; j++) {
+                    pRowSrc[j] -= factor * pPivotRowSrc[j];
+                }
+                for (j = 0; j < N; j++) {
+                    pRowDst[j] -= factor * pPivotRowDst[j];
+                }
+            }
+
+            if (l + 1 < N && !pRowUsed[i]) {
+                float val = fabsf(pRowSrc[l + 1]);
+                if (val > best) {
+                    best = val;
+                    bestRow = i;
+                }
+            }
+        }
+
+        pPivotVal[((l + 1) & 1) * nPE + core_id] = best;
+        pPivotRow[((l + 1) & 1) * nPE + core_id] = bestRow;
+    }
+
+    rt_team_barrier();
+
+    // normalize the own rows and store them in pSrc, which is not needed anymore. Row i was the
+    // pivot row of the column in which it has its only non-zero element.
+    for (l = 0; l < N; l++) {
+        i = pPerm[l];
+        if (i % nPE == core_id) {
+            float invPivot = 1.0f / pSrc[i * N + l];
+            for (j = 0; j < N; j++) {
+                pSrc[i * N + j] = pDst[i * N + j] * invPivot;
+            }
+        }
+    }
+
+    rt_team_barrier();
+
+    // undo the row permutation
+    for (l = core_id; l < N; l += nPE) {
+        i = pPerm[l];
+        for (j = 0; j < N; j++) {
+            pDst[l * N + j] = pSrc[i * N + j];
+        }
+    }
+
+    if (core_id == 0) {
+        a->ret = 0;
+    }
 }
 
 /**
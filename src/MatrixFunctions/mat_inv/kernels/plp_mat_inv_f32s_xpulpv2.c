@@ -53,8 +53,10 @@
   The inverse is defined only if the input matrix is square and non-singular
   (the determinant is non-zero). The function checks that the input and output
   matrices are square and of the same size. Matrix inversion is numerically
-  sensitive and the PULP DSP library only supports matrix inversion of
-  floating-point matrices.
+  sensitive. The fixed-point variants plp_mat_inv_q32 and plp_mat_inv_q16 keep
+  the rows in block floating-point during the elimination, see the module
+  fixed-point linear solve. plp_mat_inv_cmplx_f32 inverts complex matrices, stored with
+  interleaved real and imaginary parts, directly instead of their real 2Nx2N embedding.
 
   @par Algorithm
   The Gauss-Jordan method is used to find the inverse. The algorithm performs a
@@ -179,13 +181,16 @@ int plp_mat_inv_f32s_xpulpv2(float *__restrict__ pSrc, uint32_t N, float *__rest
         /* Destination pointer modifier */
         k = 1U;
 
+        /* No exchange is done yet for this column */
+        flag = 0U;
+
         /* Check if the pivot element is zero */
         if (*pSrcT1 == 0.0f) {
             /* Loop over the number rows present below */
 
             for (i = (l + 1U); i < M; i++) {
                 /* Update the input and destination pointers */
-                pSrcT2 = pSrcT1 + (N * i);
+                pSrcT2 = pSrcT1 + (N * k);
                 pDstT2 = pDstT1 + (N * k);
 
                 /* Check if there is a non zero pivot element to
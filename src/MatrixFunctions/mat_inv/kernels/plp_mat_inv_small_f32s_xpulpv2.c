@@ -0,0 +1,207 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_inv_small_f32s_xpulpv2.c
+ * Description:  closed-form 32-bit floating-point matrix inversion of small matrices
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatInv
+ */
+
+/**
+  @addtogroup MatInvKernels
+  @{
+ */
+
+// relative size of the determinant, below which the matrix is regarded as singular
+#define SINGULAR_TOL 1e-6f
+
+/**
+  @brief Matrix inversion of 2x2 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc Points to the input matrix, which is not modified
+  @param[out] pDst Points to the output matrix
+  @return     0: Success, 1: Matrix is singular
+
+  @par Algorithm
+  The inverse is computed in closed form as the adjugate matrix divided by the determinant. The
+  matrix is regarded as singular if the determinant vanishes relative to the magnitude of its
+  terms (see SINGULAR_TOL), as an exact zero check would miss the rounding errors of the
+  cancellation.
+ */
+
+int plp_mat_inv_2x2_f32s_xpulpv2(const float *__restrict__ pSrc, float *__restrict__ pDst) {
+
+    float p = pSrc[0] * pSrc[3];
+    float q = pSrc[1] * pSrc[2];
+    float det = p - q;
+
+    if (fabsf(det) <= SINGULAR_TOL * (fabsf(p) + fabsf(q))) {
+        return 1;
+    }
+
+    float invDet = 1.0f / det;
+
+    pDst[0] = pSrc[3] * invDet;
+    pDst[1] = -pSrc[1] * invDet;
+    pDst[2] = -pSrc[2] * invDet;
+    pDst[3] = pSrc[0] * invDet;
+
+    return 0;
+}
+
+/**
+  @brief Matrix inversion of 3x3 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc Points to the input matrix, which is not modified
+  @param[out] pDst Points to the output matrix
+  @return     0: Success, 1: Matrix is singular
+
+  @par Algorithm
+  The inverse is computed in closed form as the adjugate matrix divided by the determinant. The
+  cofactors of the first column are reused for the determinant. The matrix is regarded as
+  singular if the determinant vanishes relative to the magnitude of its terms.
+ */
+
+int plp_mat_inv_3x3_f32s_xpulpv2(const float *__restrict__ pSrc, float *__restrict__ pDst) {
+
+    float a00 = pSrc[0], a01 = pSrc[1], a02 = pSrc[2];
+    float a10 = pSrc[3], a11 = pSrc[4], a12 = pSrc[5];
+    float a20 = pSrc[6], a21 = pSrc[7], a22 = pSrc[8];
+
+    float c00 = a11 * a22 - a12 * a21;
+    float c10 = a12 * a20 - a10 * a22;
+    float c20 = a10 * a21 - a11 * a20;
+
+    float det = a00 * c00 + a01 * c10 + a02 * c20;
+
+    // magnitude of all terms of the determinant
+    float mag = fabsf(a00) * (fabsf(a11 * a22) + fabsf(a12 * a21)) +
+                fabsf(a01) * (fabsf(a12 * a20) + fabsf(a10 * a22)) +
+                fabsf(a02) * (fabsf(a10 * a21) + fabsf(a11 * a20));
+
+    if (fabsf(det) <= SINGULAR_TOL * mag) {
+        return 1;
+    }
+
+    float invDet = 1.0f / det;
+
+    pDst[0] = c00 * invDet;
+    pDst[1] = (a02 * a21 - a01 * a22) * invDet;
+    pDst[2] = (a01 * a12 - a02 * a11) * invDet;
+    pDst[3] = c10 * invDet;
+    pDst[4] = (a00 * a22 - a02 * a20) * invDet;
+    pDst[5] = (a02 * a10 - a00 * a12) * invDet;
+    pDst[6] = c20 * invDet;
+    pDst[7] = (a01 * a20 - a00 * a21) * invDet;
+    pDst[8] = (a00 * a11 - a01 * a10) * invDet;
+
+    return 0;
+}
+
+/**
+  @brief Matrix inversion of 4x4 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc Points to the input matrix, which is not modified
+  @param[out] pDst Points to the output matrix
+  @return     0: Success, 1: Matrix is singular
+
+  @par Algorithm
+  The inverse is computed in closed form as the adjugate matrix divided by the determinant. All
+  cofactors are expanded with the Laplace theorem from the twelve 2x2 sub-determinants of the
+  upper two and the lower two rows. The matrix is regarded as singular if the determinant
+  vanishes relative to the magnitude of its terms.
+ */
+
+int plp_mat_inv_4x4_f32s_xpulpv2(const float *__restrict__ pSrc, float *__restrict__ pDst) {
+
+    float a00 = pSrc[0], a01 = pSrc[1], a02 = pSrc[2], a03 = pSrc[3];
+    float a10 = pSrc[4], a11 = pSrc[5], a12 = pSrc[6], a13 = pSrc[7];
+    float a20 = pSrc[8], a21 = pSrc[9], a22 = pSrc[10], a23 = pSrc[11];
+    float a30 = pSrc[12], a31 = pSrc[13], a32 = pSrc[14], a33 = pSrc[15];
+
+    // 2x2 sub-determinants of the upper two rows
+    float s0 = a00 * a11 - a10 * a01;
+    float s1 = a00 * a12 - a10 * a02;
+    float s2 = a00 * a13 - a10 * a03;
+    float s3 = a01 * a12 - a11 * a02;
+    float s4 = a01 * a13 - a11 * a03;
+    float s5 = a02 * a13 - a12 * a03;
+
+    // 2x2 sub-determinants of the lower two rows
+    float c0 = a20 * a31 - a30 * a21;
+    float c1 = a20 * a32 - a30 * a22;
+    float c2 = a20 * a33 - a30 * a23;
+    float c3 = a21 * a32 - a31 * a22;
+    float c4 = a21 * a33 - a31 * a23;
+    float c5 = a22 * a33 - a32 * a23;
+
+    float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+    // magnitude of all terms of the determinant
+    float ms0 = fabsf(a00 * a11) + fabsf(a10 * a01);
+    float ms1 = fabsf(a00 * a12) + fabsf(a10 * a02);
+    float ms2 = fabsf(a00 * a13) + fabsf(a10 * a03);
+    float ms3 = fabsf(a01 * a12) + fabsf(a11 * a02);
+    float ms4 = fabsf(a01 * a13) + fabsf(a11 * a03);
+    float ms5 = fabsf(a02 * a13) + fabsf(a12 * a03);
+    float mc0 = fabsf(a20 * a31) + fabsf(a30 * a21);
+    float mc1 = fabsf(a20 * a32) + fabsf(a30 * a22);
+    float mc2 = fabsf(a20 * a33) + fabsf(a30 * a23);
+    float mc3 = fabsf(a21 * a32) + fabsf(a31 * a22);
+    float mc4 = fabsf(a21 * a33) + fabsf(a31 * a23);
+    float mc5 = fabsf(a22 * a33) + fabsf(a32 * a23);
+    float mag = ms0 * mc5 + ms1 * mc4 + ms2 * mc3 + ms3 * mc2 + ms4 * mc1 + ms5 * mc0;
+
+    if (fabsf(det) <= SINGULAR_TOL * mag) {
+        return 1;
+    }
+
+    float invDet = 1.0f / det;
+
+    pDst[0] = (a11 * c5 - a12 * c4 + a13 * c3) * invDet;
+    pDst[1] = (a02 * c4 - a01 * c5 - a03 * c3) * invDet;
+    pDst[2] = (a31 * s5 - a32 * s4 + a33 * s3) * invDet;
+    pDst[3] = (a22 * s4 - a21 * s5 - a23 * s3) * invDet;
+    pDst[4] = (a12 * c2 - a10 * c5 - a13 * c1) * invDet;
+    pDst[5] = (a00 * c5 - a02 * c2 + a03 * c1) * invDet;
+    pDst[6] = (a32 * s2 - a30 * s5 - a33 * s1) * invDet;
+    pDst[7] = (a20 * s5 - a22 * s2 + a23 * s1) * invDet;
+    pDst[8] = (a10 * c4 - a11 * c2 + a13 * c0) * invDet;
+    pDst[9] = (a01 * c2 - a00 * c4 - a03 * c0) * invDet;
+    pDst[10] = (a30 * s4 - a31 * s2 + a33 * s0) * invDet;
+    pDst[11] = (a21 * s2 - a20 * s4 - a23 * s0) * invDet;
+    pDst[12] = (a11 * c1 - a10 * c3 - a12 * c0) * invDet;
+    pDst[13] = (a00 * c3 - a01 * c1 + a02 * c0) * invDet;
+    pDst[14] = (a31 * s1 - a30 * s3 - a32 * s0) * invDet;
+    pDst[15] = (a20 * s3 - a21 * s1 + a22 * s0) * invDet;
+
+    return 0;
+}
+
+#undef SINGULAR_TOL
+
+/**
+   @} end of MatInvKernels group
+*/
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_inv_batched_f32_parallel.c
+ * Description:  parallel batched 32-bit floating-point matrix inversion glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatInv
+  @{
+ */
+
+/**
+  @brief Glue code for parallel batched matrix inversion of 32-bit floating-point matrices.
+  @param[in]  pSrc    Array of batch pointers to the input matrices, which are modified by this
+                      function
+  @param[in]  N       Width and height of all matrices
+  @param[in]  batch   Number of independent matrix inversions
+  @param[in]  nPE     Number of cores to use for computation
+  @param[out] pDst    Array of batch pointers to the output matrices
+  @param[out] pStatus Points to an array of batch elements, which receives the status of every
+                      single inversion (0: Success, 1: Matrix is singular). May be NULL.
+  @return     0: Success, 1: At least one matrix is singular, 2: operation not supported
+
+  @par Batching
+  All batch inversions are computed in a single rt_team_fork, and every core inverts whole
+  matrices on its own. Hence, the fork and barrier overhead is paid only once, and there is no
+  synchronization between the cores, which makes this function well suited for many small
+  matrices. If batch is smaller than nPE, some cores are idle, and plp_mat_inv_f32_parallel
+  should be used on every matrix instead.
+
+  @par This function will use plp_mat_inv_batched_f32p_xpulpv2 for its computation.
+ */
+
+int plp_mat_inv_batched_f32_parallel(float *const *pSrc,
+                                     uint32_t N,
+                                     uint32_t batch,
+                                     uint32_t nPE,
+                                     float *const *pDst,
+                                     int *pStatus) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return 2;
+    } else {
+        plp_mat_inv_batched_instance_f32 args = { .pSrc = pSrc,
+                                                  .N = N,
+                                                  .batch = batch,
+                                                  .nPE = nPE,
+                                                  .pDst = pDst,
+                                                  .pStatus = pStatus,
+                                                  .ret = 0 };
+
+        rt_team_fork(nPE, plp_mat_inv_batched_f32p_xpulpv2, (void *)&args);
+
+        return args.ret;
+    }
+}
+
+/**
+  @} end of MatInv group
+ */
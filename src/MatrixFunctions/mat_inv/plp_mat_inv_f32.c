@@ -49,8 +49,10 @@
   The inverse is defined only if the input matrix is square and non-singular
   (the determinant is non-zero). The function checks that the input and output
   matrices are square and of the same size. Matrix inversion is numerically
-  sensitive and the PULP DSP library only supports matrix inversion of
-  floating-point matrices.
+  sensitive. The fixed-point variants plp_mat_inv_q32 and plp_mat_inv_q16 keep
+  the rows in block floating-point during the elimination, see the module
+  fixed-point linear solve. plp_mat_inv_cmplx_f32 inverts complex matrices, stored with
+  interleaved real and imaginary parts, directly instead of their real 2Nx2N embedding.
 
   @par Algorithm
   The Gauss-Jordan method is used to find the inverse. The algorithm performs a
@@ -72,6 +74,10 @@
   @return     0: Success, 1: Matrix is singular, 2: operation not supported
 
   @par This function will use plp_mat_inv_i32s_xpulpv2 for its computation.
+
+  @par Small Matrices
+  Matrices of size 2x2, 3x3 and 4x4 are inverted in closed form with the fully unrolled kernels
+  plp_mat_inv_NxN_f32s_xpulpv2. In this case, pSrc is not modified.
  */
 
 int plp_mat_inv_f32(float *__restrict__ pSrc, uint32_t N, float *__restrict__ pDst) {
@@ -80,6 +86,16 @@ int plp_mat_inv_f32(float *__restrict__ pSrc, uint32_t N, float *__restrict__ pD
         printf("Floating point is supported only for cluster side\n");
         return 2;
     } else {
+        switch (N) {
+        case 2:
+            return plp_mat_inv_2x2_f32s_xpulpv2(pSrc, pDst);
+        case 3:
+            return plp_mat_inv_3x3_f32s_xpulpv2(pSrc, pDst);
+        case 4:
+            return plp_mat_inv_4x4_f32s_xpulpv2(pSrc, pDst);
+        default:
+            break;
+        }
         return plp_mat_inv_f32s_xpulpv2(pSrc, N, pDst);
     }
 }
@@ -47,8 +47,13 @@
   @param[out] pDst Points to the output matrix
   @return     0: Success, 1: Matrix is singular, 2: operation not supported
 
-  @warn This function is not yet implemented in parallel, and it will call the
-  single-core implementation!
+  @par This function will use plp_mat_inv_f32p_xpulpv2 for its computation. The scratch buffers
+  needed for the parallel pivot search are allocated in the cluster L1 memory.
+
+  @par Small Matrices
+  Matrices of size 2x2, 3x3 and 4x4 are inverted in closed form on the calling core with the fully
+  unrolled kernels plp_mat_inv_NxN_f32s_xpulpv2, because forking the team takes longer than the
+  computation itself. In this case, pSrc is not modified.
  */
 
 int plp_mat_inv_f32_parallel(float *__restrict__ pSrc,
@@ -60,8 +65,44 @@ int plp_mat_inv_f32_parallel(float *__restrict__ pSrc,
         printf("parallel and floating-point processing supported only for cluster side\n");
         return 2;
     } else {
-        // TODO, for now, we only call the singlecore implementation, until it is implemented
-        return plp_mat_inv_f32s_xpulpv2(pSrc, N, pDst);
+
+        switch (N) {
+        case 2:
+            return plp_mat_inv_2x2_f32s_xpulpv2(pSrc, pDst);
+        case 3:
+            return plp_mat_inv_3x3_f32s_xpulpv2(pSrc, pDst);
+        case 4:
+            return plp_mat_inv_4x4_f32s_xpulpv2(pSrc, pDst);
+        default:
+            break;
+        }
+
+        if (nPE == 1) {
+            return plp_mat_inv_f32s_xpulpv2(pSrc, N, pDst);
+        }
+
+        uint32_t bufferSize = sizeof(float) * 2 * nPE + sizeof(uint32_t) * (2 * nPE + 2 * N);
+        float *pBuffer = (float *)plp_scratch_alloc(bufferSize);
+
+        if (pBuffer == NULL) {
+            return 2;
+        }
+
+        plp_mat_inv_instance_f32 args = { .pSrc = pSrc,
+                                          .N = N,
+                                          .nPE = nPE,
+                                          .pDst = pDst,
+                                          .pPivotVal = pBuffer,
+                                          .pPivotRow = (uint32_t *)(pBuffer + 2 * nPE),
+                                          .pPerm = (uint32_t *)(pBuffer + 4 * nPE),
+                                          .pRowUsed = (uint32_t *)(pBuffer + 4 * nPE) + N,
+                                          .ret = 0 };
+
+        rt_team_fork(nPE, plp_mat_inv_f32p_xpulpv2, (void *)&args);
+
+        plp_scratch_free(pBuffer, bufferSize);
+
+        return args.ret;
     }
 }
 
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_inv_q16.c
+ * Description:  16-bit fixed-point matrix inversion
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatInv
+  @{
+ */
+
+/**
+  @brief Matrix inversion of 16-bit fixed-point matrices.
+  @param[in]  pSrc     Points to the input matrix. pSrc is modified by this function
+  @param[in]  N        Width and height of both matrices
+  @param[in]  fracBits Number of bits after the binary point of both matrices
+  @param[out] pDst     Points to the output matrix
+  @return     0: Success, 1: Matrix is singular, or a pivot is lost (see MatSolveFix)
+
+  @par This function solves pSrc * pDst = I with plp_mat_solve_q16, in block floating-point. It
+  runs on a single core, both on the fabric controller and on the cluster. Elements of the inverse
+  which exceed the range of 16 bits are saturated.
+ */
+
+int plp_mat_inv_q16(int16_t *__restrict__ pSrc,
+                    uint32_t N,
+                    uint32_t fracBits,
+                    int16_t *__restrict__ pDst) {
+
+    uint32_t i;
+
+    for (i = 0; i < N * N; i++) {
+        pDst[i] = 0;
+    }
+    for (i = 0; i < N; i++) {
+        pDst[i * N + i] = 1;
+    }
+
+    // the identity has no bits after the binary point, the solution needs fracBits more of them
+    return plp_mat_solve_q16(pSrc, pDst, N, N, 2 * fracBits, pDst);
+}
+
+/**
+  @} end of MatInv group
+ */
@@ -0,0 +1,234 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lstsq_cmplx_f32p_xpulpv2.c
+ * Description:  Parallel complex 32-bit floating-point least-squares solution for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Householder vector of the complex column x of len elements in place, scaled to v^H v = 2 such
+// that H = I - v v^H. Returns the diagonal element of R in pAlpha, i.e. H x = alpha e_0.
+static inline void plp_mat_qr_reflector_cmplx_f32(float *pX,
+                                                  uint32_t stride,
+                                                  uint32_t len,
+                                                  float *pAlpha) {
+    uint32_t i;
+    float norm2 = 0.0f;
+
+    for (i = 0; i < len; i++) {
+        norm2 += pX[2 * i * stride] * pX[2 * i * stride];
+        norm2 += pX[2 * i * stride + 1] * pX[2 * i * stride + 1];
+    }
+
+    if (norm2 == 0.0f) {
+        pAlpha[0] = 0.0f; // v = 0, the column is already zero
+        pAlpha[1] = 0.0f;
+        return;
+    }
+
+    // alpha = -x0 / |x0| * norm, such that u0 = x0 - alpha does not cancel
+    float norm = sqrtf(norm2);
+    float re = pX[0];
+    float im = pX[1];
+    float abs0 = sqrtf(re * re + im * im);
+    float alphaRe = (abs0 == 0.0f) ? -norm : -re / abs0 * norm;
+    float alphaIm = (abs0 == 0.0f) ? 0.0f : -im / abs0 * norm;
+    float u0Re = re - alphaRe;
+    float u0Im = im - alphaIm;
+    float scale = sqrtf(2.0f / (norm2 - abs0 * abs0 + u0Re * u0Re + u0Im * u0Im));
+
+    pX[0] = u0Re * scale;
+    pX[1] = u0Im * scale;
+    for (i = 1; i < len; i++) {
+        pX[2 * i * stride] *= scale;
+        pX[2 * i * stride + 1] *= scale;
+    }
+
+    pAlpha[0] = alphaRe;
+    pAlpha[1] = alphaIm;
+}
+
+// c = (I - v v^H) c for a complex column c of len elements
+static inline void plp_mat_qr_apply_cmplx_f32(const float *pV,
+                                              uint32_t vStride,
+                                              float *pC,
+                                              uint32_t cStride,
+                                              uint32_t len) {
+    uint32_t i;
+    float sRe = 0.0f;
+    float sIm = 0.0f;
+
+    // s = v^H c
+    for (i = 0; i < len; i++) {
+        float vRe = pV[2 * i * vStride];
+        float vIm = pV[2 * i * vStride + 1];
+        float cRe = pC[2 * i * cStride];
+        float cIm = pC[2 * i * cStride + 1];
+        sRe += vRe * cRe + vIm * cIm;
+        sIm += vRe * cIm - vIm * cRe;
+    }
+    for (i = 0; i < len; i++) {
+        float vRe = pV[2 * i * vStride];
+        float vIm = pV[2 * i * vStride + 1];
+        pC[2 * i * cStride] -= vRe * sRe - vIm * sIm;
+        pC[2 * i * cStride + 1] -= vRe * sIm + vIm * sRe;
+    }
+}
+
+// solves R X = B for the columns oStart, oStart + oStep, ... of X by back substitution
+static inline void plp_mat_lstsq_backsub_cmplx_f32(const float *pR,
+                                                   const float *pB,
+                                                   uint32_t N,
+                                                   uint32_t O,
+                                                   uint32_t oStart,
+                                                   uint32_t oStep,
+                                                   float *pX) {
+    uint32_t i, k, o;
+
+    for (i = N; i-- > 0;) {
+        float dRe = pR[2 * (i * N + i)];
+        float dIm = pR[2 * (i * N + i) + 1];
+        float invAbs2 = 1.0f / (dRe * dRe + dIm * dIm);
+
+        for (o = oStart; o < O; o += oStep) {
+            float sRe = pB[2 * (i * O + o)];
+            float sIm = pB[2 * (i * O + o) + 1];
+
+            for (k = i + 1; k < N; k++) {
+                float rRe = pR[2 * (i * N + k)];
+                float rIm = pR[2 * (i * N + k) + 1];
+                float xRe = pX[2 * (k * O + o)];
+                float xIm = pX[2 * (k * O + o) + 1];
+                sRe -= rRe * xRe - rIm * xIm;
+                sIm -= rRe * xIm + rIm * xRe;
+            }
+
+            // s / d = s * conj(d) / |d|^2
+            pX[2 * (i * O + o)] = (sRe * dRe + sIm * dIm) * invAbs2;
+            pX[2 * (i * O + o) + 1] = (sIm * dRe - sRe * dIm) * invAbs2;
+        }
+    }
+}
+
+/**
+  @ingroup MatLstsq
+ */
+
+/**
+  @addtogroup MatLstsqKernels
+  @{
+ */
+
+/**
+   @brief Parallel least-squares solution of complex 32-bit floating-point systems kernel for
+          XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_lstsq_instance_f32 struct initialized by
+                     plp_mat_lstsq_cmplx_f32_parallel
+   @return     none, the status (0: Success, 1: A is rank deficient) is written to args->ret
+
+   @par Parallelization
+   The reduction is distributed in the same way as in plp_mat_lstsq_f32p_xpulpv2. For the back
+   substitution, column o of X is solved by core o % nPE, which needs no synchronization.
+*/
+
+void plp_mat_lstsq_cmplx_f32p_xpulpv2(void *args) {
+
+    uint32_t core_id = rt_core_id();
+
+    plp_mat_lstsq_instance_f32 *a = (plp_mat_lstsq_instance_f32 *)args;
+
+    float *__restrict__ pA = a->pA;
+    float *__restrict__ pB = a->pB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+
+    uint32_t c, k; // loop counters
+
+    // diagonal element of R, which is written once the Householder vector is not needed anymore
+    uint32_t pending = N;
+    float alpha[2] = { 0.0f, 0.0f };
+
+    if (core_id == 0) {
+        plp_mat_qr_reflector_cmplx_f32(pA, N, M, alpha);
+        pending = 0;
+    }
+
+    // A = Q R, B = Q^H B
+    for (k = 0; k < N; k++) {
+        const float *pV = pA + 2 * (k * N + k);
+
+        rt_team_barrier();
+
+        if (pending < k) {
+            pA[2 * (pending * N + pending)] = alpha[0];
+            pA[2 * (pending * N + pending) + 1] = alpha[1];
+            pending = N;
+        }
+
+        for (c = k + 1 + (core_id + nPE - (k + 1) % nPE) % nPE; c < N + O; c += nPE) {
+            if (c < N) {
+                plp_mat_qr_apply_cmplx_f32(pV, N, pA + 2 * (k * N + c), N, M - k);
+                if (c == k + 1) {
+                    plp_mat_qr_reflector_cmplx_f32(pA + 2 * (c * N + c), N, M - c, alpha);
+                    pending = c;
+                }
+            } else {
+                plp_mat_qr_apply_cmplx_f32(pV, N, pB + 2 * (k * O + c - N), O, M - k);
+            }
+        }
+    }
+
+    rt_team_barrier();
+
+    if (pending < N) {
+        pA[2 * (pending * N + pending)] = alpha[0];
+        pA[2 * (pending * N + pending) + 1] = alpha[1];
+    }
+
+    rt_team_barrier();
+
+    // every core reaches the same decision
+    for (k = 0; k < N; k++) {
+        if (pA[2 * (k * N + k)] == 0.0f && pA[2 * (k * N + k) + 1] == 0.0f) {
+            if (core_id == 0) {
+                a->ret = 1;
+            }
+            return;
+        }
+    }
+
+    // R is stored in the first N rows of A
+    plp_mat_lstsq_backsub_cmplx_f32(pA, pB, N, O, core_id, nPE, a->pX);
+
+    if (core_id == 0) {
+        a->ret = 0;
+    }
+}
+
+/**
+   @} end of MatLstsqKernels group
+*/
@@ -0,0 +1,175 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lstsq_f32p_xpulpv2.c
+ * Description:  Parallel 32-bit floating-point least-squares solution for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Householder vector of the column x of len elements in place, scaled to v^T v = 2 such that
+// H = I - v v^T. Returns the diagonal element of R, i.e. H x = alpha e_0.
+static inline float plp_mat_qr_reflector_f32(float *pX, uint32_t stride, uint32_t len) {
+    uint32_t i;
+    float norm2 = 0.0f;
+
+    for (i = 0; i < len; i++) {
+        norm2 += pX[i * stride] * pX[i * stride];
+    }
+
+    if (norm2 == 0.0f) {
+        return 0.0f; // v = 0, the column is already zero
+    }
+
+    float x0 = pX[0];
+    float alpha = (x0 >= 0.0f) ? -sqrtf(norm2) : sqrtf(norm2);
+    float u0 = x0 - alpha;
+    float scale = sqrtf(2.0f / (norm2 - x0 * x0 + u0 * u0));
+
+    pX[0] = u0 * scale;
+    for (i = 1; i < len; i++) {
+        pX[i * stride] *= scale;
+    }
+
+    return alpha;
+}
+
+// c = (I - v v^T) c for a column c of len elements
+static inline void plp_mat_qr_apply_f32(const float *pV,
+                                        uint32_t vStride,
+                                        float *pC,
+                                        uint32_t cStride,
+                                        uint32_t len) {
+    uint32_t i;
+    float s = 0.0f;
+
+    for (i = 0; i < len; i++) {
+        s += pV[i * vStride] * pC[i * cStride];
+    }
+    for (i = 0; i < len; i++) {
+        pC[i * cStride] -= s * pV[i * vStride];
+    }
+}
+
+/**
+  @ingroup MatLstsq
+ */
+
+/**
+  @addtogroup MatLstsqKernels
+  @{
+ */
+
+/**
+   @brief Parallel least-squares solution of 32-bit floating-point systems kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_mat_lstsq_instance_f32 struct initialized by
+                     plp_mat_lstsq_f32_parallel
+   @return     none, the status (0: Success, 1: A is rank deficient) is written to args->ret
+
+   @par Parallelization
+   The columns of A followed by the columns of B are distributed among the cores, column c is
+   owned by core c % nPE. In step k, every core applies the reflector of column k to its own
+   columns right of k. The owner of column k + 1 computes the next reflector directly after
+   updating it, such that a single rt_team_barrier per step is enough. The diagonal element of R
+   replaces the Householder vector one step later, when no core reads it anymore. The triangular
+   system is then solved with plp_mat_solve_upper_f32p_xpulpv2.
+*/
+
+void plp_mat_lstsq_f32p_xpulpv2(void *args) {
+
+    uint32_t core_id = rt_core_id();
+
+    plp_mat_lstsq_instance_f32 *a = (plp_mat_lstsq_instance_f32 *)args;
+
+    float *__restrict__ pA = a->pA;
+    float *__restrict__ pB = a->pB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+
+    uint32_t c, k; // loop counters
+
+    // diagonal element of R, which is written once the Householder vector is not needed anymore
+    uint32_t pending = N;
+    float alpha = 0.0f;
+
+    if (core_id == 0) {
+        alpha = plp_mat_qr_reflector_f32(pA, N, M);
+        pending = 0;
+    }
+
+    // A = Q R, B = Q^T B
+    for (k = 0; k < N; k++) {
+        const float *pV = pA + k * N + k;
+
+        rt_team_barrier();
+
+        if (pending < k) {
+            pA[pending * N + pending] = alpha;
+            pending = N;
+        }
+
+        for (c = k + 1 + (core_id + nPE - (k + 1) % nPE) % nPE; c < N + O; c += nPE) {
+            if (c < N) {
+                plp_mat_qr_apply_f32(pV, N, pA + k * N + c, N, M - k);
+                if (c == k + 1) {
+                    alpha = plp_mat_qr_reflector_f32(pA + c * N + c, N, M - c);
+                    pending = c;
+                }
+            } else {
+                plp_mat_qr_apply_f32(pV, N, pB + k * O + c - N, O, M - k);
+            }
+        }
+    }
+
+    rt_team_barrier();
+
+    if (pending < N) {
+        pA[pending * N + pending] = alpha;
+    }
+
+    rt_team_barrier();
+
+    // R is stored in the first N rows of A
+    plp_mat_solve_instance_f32 solve = { .pA = pA,
+                                         .pB = pB,
+                                         .N = N,
+                                         .O = O,
+                                         .unitDiag = 0,
+                                         .nPE = nPE,
+                                         .pX = a->pX,
+                                         .ret = 0 };
+
+    plp_mat_solve_upper_f32p_xpulpv2((void *)&solve);
+
+    if (core_id == 0) {
+        a->ret = solve.ret;
+    }
+}
+
+/**
+   @} end of MatLstsqKernels group
+*/
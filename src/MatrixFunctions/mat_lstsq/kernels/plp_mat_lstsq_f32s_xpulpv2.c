@@ -0,0 +1,137 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lstsq_f32s_xpulpv2.c
+ * Description:  32-bit floating-point least-squares solution for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Householder vector of the column x of len elements in place, scaled to v^T v = 2 such that
+// H = I - v v^T. Returns the diagonal element of R, i.e. H x = alpha e_0.
+static inline float plp_mat_qr_reflector_f32(float *pX, uint32_t stride, uint32_t len) {
+    uint32_t i;
+    float norm2 = 0.0f;
+
+    for (i = 0; i < len; i++) {
+        norm2 += pX[i * stride] * pX[i * stride];
+    }
+
+    if (norm2 == 0.0f) {
+        return 0.0f; // v = 0, the column is already zero
+    }
+
+    float x0 = pX[0];
+    float alpha = (x0 >= 0.0f) ? -sqrtf(norm2) : sqrtf(norm2);
+    float u0 = x0 - alpha;
+    float scale = sqrtf(2.0f / (norm2 - x0 * x0 + u0 * u0));
+
+    pX[0] = u0 * scale;
+    for (i = 1; i < len; i++) {
+        pX[i * stride] *= scale;
+    }
+
+    return alpha;
+}
+
+// c = (I - v v^T) c for a column c of len elements
+static inline void plp_mat_qr_apply_f32(const float *pV,
+                                        uint32_t vStride,
+                                        float *pC,
+                                        uint32_t cStride,
+                                        uint32_t len) {
+    uint32_t i;
+    float s = 0.0f;
+
+    for (i = 0; i < len; i++) {
+        s += pV[i * vStride] * pC[i * cStride];
+    }
+    for (i = 0; i < len; i++) {
+        pC[i * cStride] -= s * pV[i * vStride];
+    }
+}
+
+/**
+  @ingroup MatLstsq
+ */
+
+/**
+  @defgroup MatLstsqKernels Least-squares solution kernels
+  This module contains the kernel functions for the least-squares solution of overdetermined
+  systems of linear equations.
+
+  @par Algorithm
+  Householder reflections reduce A to the upper triangular matrix R in place, and are applied to
+  B on the fly. The first N rows of the transformed B are then solved by back substitution.
+ */
+
+/**
+  @addtogroup MatLstsqKernels
+  @{
+ */
+
+/**
+  @brief Least-squares solution of 32-bit floating-point systems kernel for XPULPV2 extension.
+  @param[in,out] pA  Points to the matrix of shape MxN, overwritten by the decomposition
+  @param[in,out] pB  Points to the right-hand side matrix of shape MxO, overwritten
+  @param[in]     M   Height of A and B
+  @param[in]     N   Width of A, height of X
+  @param[in]     O   Number of right-hand sides, width of B and X
+  @param[out]    pX  Points to the solution matrix of shape NxO
+  @return        0: Success, 1: M is smaller than N or A is rank deficient
+ */
+
+int plp_mat_lstsq_f32s_xpulpv2(float *__restrict__ pA,
+                               float *__restrict__ pB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               float *__restrict__ pX) {
+
+    uint32_t j, k; // loop counters
+
+    if (M < N) {
+        return 1;
+    }
+
+    // A = Q R, B = Q^T B
+    for (k = 0; k < N; k++) {
+        float *pV = pA + k * N + k;
+        float alpha = plp_mat_qr_reflector_f32(pV, N, M - k);
+        for (j = k + 1; j < N; j++) {
+            plp_mat_qr_apply_f32(pV, N, pA + k * N + j, N, M - k);
+        }
+        for (j = 0; j < O; j++) {
+            plp_mat_qr_apply_f32(pV, N, pB + k * O + j, O, M - k);
+        }
+        pV[0] = alpha;
+    }
+
+    // R is stored in the first N rows of A
+    return plp_mat_solve_upper_f32s_xpulpv2(pA, pB, N, O, 0, pX);
+}
+
+/**
+  @} end of MatLstsqKernels group
+ */
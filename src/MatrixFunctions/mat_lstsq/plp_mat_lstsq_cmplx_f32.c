@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lstsq_cmplx_f32.c
+ * Description:  Glue code for the complex 32-bit floating-point least-squares solution
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatLstsq
+  @{
+ */
+
+/**
+  @brief Glue code for the least-squares solution of complex 32-bit floating-point systems.
+  @param[in,out] pA  Points to the matrix of shape MxN, overwritten by the decomposition
+  @param[in,out] pB  Points to the right-hand side matrix of shape MxO, overwritten
+  @param[in]     M   Height of A and B
+  @param[in]     N   Width of A, height of X
+  @param[in]     O   Number of right-hand sides, width of B and X
+  @param[out]    pX  Points to the solution matrix of shape NxO
+  @return        0: Success, 1: M is smaller than N or A is rank deficient, 2: operation not
+                 supported
+ */
+
+int plp_mat_lstsq_cmplx_f32(float *__restrict__ pA,
+                      float *__restrict__ pB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      float *__restrict__ pX) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_lstsq_cmplx_f32s_xpulpv2(pA, pB, M, N, O, pX);
+    }
+}
+
+/**
+  @} end of MatLstsq group
+ */
@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lstsq_f32.c
+ * Description:  Glue code for the 32-bit floating-point least-squares solution
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatLstsq Least-squares solution
+  This module contains the glue code for solving overdetermined systems of linear equations in
+  the least-squares sense. The kernel codes (kernels) are in the Module Least-squares solution
+  Kernels.
+
+  For a matrix A of shape MxN with M >= N and full column rank, and a right-hand side matrix B of
+  shape MxO, the solution X of shape NxO minimizes the euclidean norm of every column of A X - B:
+
+  \f[
+    X = \underset{X}{\operatorname{argmin}} \lVert A \cdot X - B \rVert_2
+  \f]
+
+  In contrast to forming the normal equations A^T A X = A^T B, the condition number of A is not
+  squared, and no matrix inverse is computed. Complex matrices are stored with interleaved real
+  and imaginary parts.
+
+  @par Algorithm
+  Householder reflections reduce A to the upper triangular matrix R in place, and are applied to
+  B on the fly, such that Q is never formed. The first N rows of the transformed B are then solved
+  for R X = Q^T B by back substitution. Both A and B are overwritten.
+ */
+
+/**
+  @addtogroup MatLstsq
+  @{
+ */
+
+/**
+  @brief Glue code for the least-squares solution of 32-bit floating-point systems.
+  @param[in,out] pA  Points to the matrix of shape MxN, overwritten by the decomposition
+  @param[in,out] pB  Points to the right-hand side matrix of shape MxO, overwritten
+  @param[in]     M   Height of A and B
+  @param[in]     N   Width of A, height of X
+  @param[in]     O   Number of right-hand sides, width of B and X
+  @param[out]    pX  Points to the solution matrix of shape NxO
+  @return        0: Success, 1: M is smaller than N or A is rank deficient, 2: operation not
+                 supported
+ */
+
+int plp_mat_lstsq_f32(float *__restrict__ pA,
+                      float *__restrict__ pB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      float *__restrict__ pX) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_lstsq_f32s_xpulpv2(pA, pB, M, N, O, pX);
+    }
+}
+
+/**
+  @} end of MatLstsq group
+ */
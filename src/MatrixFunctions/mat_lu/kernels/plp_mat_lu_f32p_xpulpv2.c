@@ -0,0 +1,179 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point LU decomposition for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatLU
+ */
+
+/**
+  @addtogroup MatLUKernels
+  @{
+ */
+
+/**
+   @brief Parallel LU decomposition of 32-bit floating-point matrices kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_mat_lu_instance_f32 struct initialized by
+                     plp_mat_lu_f32_parallel
+   @return     none, the status (0: Success, 1: Matrix is singular) is written to args->ret
+
+   @par Parallelization
+   Row i is owned by core i % nPE. The elimination is computed in place in pSrc, and the rows are
+   never swapped physically. Instead, the pivot row of every column is remembered, and only the
+   rows which have not yet been used as pivot are eliminated. Every core searches the pivot
+   candidate of the next column among its own rows directly after eliminating them. Hence, a
+   single rt_team_barrier per pivot step is enough, after which all cores combine the partial
+   results (double buffered) and deterministically agree on the same pivot row. At the end, the
+   rows are copied to pDst in pivot order.
+*/
+
+void plp_mat_lu_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_lu_instance_f32 *a = (plp_mat_lu_instance_f32 *)args;
+
+    float *__restrict__ pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDst = a->pDst;
+    uint32_t *pPerm = a->pPerm;
+    float *pPivotVal = a->pPivotVal;
+    uint32_t *pPivotRow = a->pPivotRow;
+    uint32_t *pRowUsed = a->pRowUsed;
+
+    uint32_t i, j, l; // loop counters
+    uint32_t p;       // pivot row
+    float best;       // largest absolute value of the local pivot search
+    uint32_t bestRow; // row of the local pivot candidate
+
+    // search the pivot candidate in the first column
+    best = 0.0f;
+    bestRow = N;
+    for (i = core_id; i < N; i += nPE) {
+        pRowUsed[i] = 0;
+
+        float val = fabsf(pSrc[i * N]);
+        if (val > best) {
+            best = val;
+            bestRow = i;
+        }
+    }
+    pPivotVal[core_id] = best;
+    pPivotRow[core_id] = bestRow;
+
+    for (l = 0; l < N; l++) {
+
+        float *pPivotValL = pPivotVal + (l & 1) * nPE;
+        uint32_t *pPivotRowL = pPivotRow + (l & 1) * nPE;
+
+        rt_team_barrier();
+
+        // combine the partial pivot search. Ties are resolved by the lower row index, such that
+        // every core ends up with the same pivot row.
+        best = 0.0f;
+        p = N;
+        for (i = 0; i < nPE; i++) {
+            float val = pPivotValL[i];
+            uint32_t row = pPivotRowL[i];
+            if (val > best || (val == best && val != 0.0f && row < p)) {
+                best = val;
+                p = row;
+            }
+        }
+
+        // every core reaches the same decision, no core is left waiting in a barrier
+        if (best == 0.0f) {
+            if (core_id == 0) {
+                a->ret = 1;
+            }
+            return;
+        }
+
+        if (core_id == 0) {
+            pPerm[l] = p;
+        }
+        if (p % nPE == core_id) {
+            pRowUsed[p] = 1;
+        }
+
+        float *pPivotRowSrc = pSrc + p * N;
+        float invPivot = 1.0f / pPivotRowSrc[l];
+
+        // eliminate column l in all own rows which have not yet been used as pivot, and look for
+        // the pivot candidate of column l + 1 among them.
+        best = 0.0f;
+        bestRow = N;
+        for (i = core_id; i < N; i += nPE) {
+            if (pRowUsed[i]) {
+                continue;
+            }
+
+            float *pRow = pSrc + i * N;
+            float factor = pRow[l] * invPivot;
+            pRow[l] = factor;
+
+            if (factor != 0.0f) {
+                for (j = l + 1; j < N; j++) {
+                    pRow[j] -= factor * pPivotRowSrc[j];
+                }
+            }
+
+            if (l + 1 < N) {
+                float val = fabsf(pRow[l + 1]);
+                if (val > best) {
+                    best = val;
+                    bestRow = i;
+                }
+            }
+        }
+
+        pPivotVal[((l + 1) & 1) * nPE + core_id] = best;
+        pPivotRow[((l + 1) & 1) * nPE + core_id] = bestRow;
+    }
+
+    rt_team_barrier();
+
+    // apply the row permutation
+    for (l = core_id; l < N; l += nPE) {
+        i = pPerm[l];
+        for (j = 0; j < N; j++) {
+            pDst[l * N + j] = pSrc[i * N + j];
+        }
+    }
+
+    if (core_id == 0) {
+        a->ret = 0;
+    }
+}
+
+/**
+   @} end of MatLUKernels group
+*/
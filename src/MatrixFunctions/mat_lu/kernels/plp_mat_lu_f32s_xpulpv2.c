@@ -0,0 +1,134 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_f32s_xpulpv2.c
+ * Description:  32-bit floating-point LU decomposition for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatLU
+ */
+
+/**
+  @defgroup MatLUKernels LU decomposition kernels
+  This module contains the kernel functions for the LU decomposition.
+
+  The LU decomposition with partial pivoting factors a square matrix A of shape NxN into a
+  permutation matrix P, a lower triangular matrix L with unit diagonal, and an upper triangular
+  matrix U:
+
+  \f[
+    P \cdot A = L \cdot U
+  \f]
+
+  @par Algorithm
+  Gaussian elimination with partial pivoting. In every step, the row with the largest absolute
+  value in the current column is chosen as pivot row. The elimination factors are stored in
+  place of the eliminated elements.
+ */
+
+/**
+  @addtogroup MatLUKernels
+  @{
+ */
+
+/**
+  @brief LU decomposition of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc  Points to the input matrix, pSrc is not modified by this kernel
+  @param[in]  N     Width and height of both matrices
+  @param[out] pDst  Points to the output matrix, containing L and U packed
+  @param[out] pPerm Points to the output permutation vector of length N
+  @return     0: Success, 1: Matrix is singular
+ */
+
+int plp_mat_lu_f32s_xpulpv2(const float *__restrict__ pSrc,
+                            uint32_t N,
+                            float *__restrict__ pDst,
+                            uint32_t *__restrict__ pPerm) {
+
+    uint32_t i, j, l; // loop counters
+    uint32_t p;       // pivot row
+    float best;       // largest absolute value in the pivot column
+
+    for (i = 0; i < N; i++) {
+        for (j = 0; j < N; j++) {
+            pDst[i * N + j] = pSrc[i * N + j];
+        }
+        pPerm[i] = i;
+    }
+
+    for (l = 0; l < N; l++) {
+        float *pPivotRow = pDst + l * N;
+
+        // search the pivot row
+        best = 0.0f;
+        p = l;
+        for (i = l; i < N; i++) {
+            float val = fabsf(pDst[i * N + l]);
+            if (val > best) {
+                best = val;
+                p = i;
+            }
+        }
+
+        if (best == 0.0f) {
+            return 1;
+        }
+
+        // swap the pivot row with the current row
+        if (p != l) {
+            float *pRowP = pDst + p * N;
+            for (j = 0; j < N; j++) {
+                float tmp = pPivotRow[j];
+                pPivotRow[j] = pRowP[j];
+                pRowP[j] = tmp;
+            }
+            uint32_t tmp = pPerm[l];
+            pPerm[l] = pPerm[p];
+            pPerm[p] = tmp;
+        }
+
+        float invPivot = 1.0f / pPivotRow[l];
+
+        // eliminate column l in all rows below, and store the factor in place
+        for (i = l + 1; i < N; i++) {
+            float *pRow = pDst + i * N;
+            float factor = pRow[l] * invPivot;
+            pRow[l] = factor;
+            if (factor != 0.0f) {
+                for (j = l + 1; j < N; j++) {
+                    pRow[j] -= factor * pPivotRow[j];
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+   @} end of MatLUKernels group
+*/
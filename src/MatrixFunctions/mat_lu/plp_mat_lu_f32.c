@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_f32.c
+ * Description:  32-bit floating-point LU decomposition glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatLU LU decomposition
+  This module contains the glue code for the LU decomposition. The kernel codes (kernels) are in
+  the Module LU decomposition Kernels.
+
+  The LU decomposition with partial pivoting factors a square matrix A of shape NxN into a
+  permutation matrix P, a lower triangular matrix L with unit diagonal, and an upper triangular
+  matrix U:
+
+  \f[
+    P \cdot A = L \cdot U
+  \f]
+
+  Both factors are stored packed in the output matrix. The strictly lower triangular part
+  contains L (the unit diagonal is not stored), and the upper triangular part including the
+  diagonal contains U. The permutation is stored as a vector, where pPerm[i] is the row of A
+  which ends up in row i. To solve A x = b, permute b according to pPerm, and pass the packed
+  factor to plp_mat_solve_lower_f32 (with unitDiag set) and to plp_mat_solve_upper_f32. This is
+  both cheaper and numerically more stable than computing the inverse.
+
+  @par Algorithm
+  Gaussian elimination with partial pivoting. In every step, the row with the largest absolute
+  value in the current column is chosen as pivot row. The elimination factors are stored in
+  place of the eliminated elements.
+ */
+
+/**
+  @addtogroup MatLU
+  @{
+ */
+
+/**
+  @brief Glue code for the LU decomposition of 32-bit floating-point matrices.
+  @param[in]  pSrc  Points to the input matrix, pSrc is modified by this function
+  @param[in]  N     Width and height of both matrices
+  @param[out] pDst  Points to the output matrix, containing L and U packed
+  @param[out] pPerm Points to the output permutation vector of length N
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+ */
+
+int plp_mat_lu_f32(float *__restrict__ pSrc,
+                   uint32_t N,
+                   float *__restrict__ pDst,
+                   uint32_t *__restrict__ pPerm) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_lu_f32s_xpulpv2(pSrc, N, pDst, pPerm);
+    }
+}
+
+/**
+  @} end of MatLU group
+ */
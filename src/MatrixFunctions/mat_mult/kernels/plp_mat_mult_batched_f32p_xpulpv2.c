@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_batched_f32p_xpulpv2.c
+ * Description:  parallel batched 32-bit floating-point matrix multiplication for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMult
+ */
+
+/**
+  @addtogroup BasicMatMultKernels
+  @{
+ */
+
+/**
+  @brief Parallel batched matrix multiplication of 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_mult_batched_instance_f32 struct initialized by
+                    plp_mat_mult_batched_f32_parallel
+  @return     none
+
+  @par Parallelization
+  The matrices are distributed cyclically among the cores, and every core computes whole matrix
+  products with the single-core kernels, including the unrolled kernels for small square
+  matrices.
+*/
+
+void plp_mat_mult_batched_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_mult_batched_instance_f32 *a = (plp_mat_mult_batched_instance_f32 *)args;
+
+    const float *const *pSrcA = a->pSrcA;
+    const float *const *pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t batch = a->batch;
+    uint32_t nPE = a->nPE;
+    float *const *pDstC = a->pDstC;
+
+    uint32_t b; // loop counter
+
+    // size of the unrolled kernel to use, or 0 for the generic kernel
+    uint32_t small = (M == N && N == O) ? N : 0;
+
+    for (b = core_id; b < batch; b += nPE) {
+        switch (small) {
+        case 2:
+            plp_mat_mult_2x2_f32s_xpulpv2(pSrcA[b], pSrcB[b], pDstC[b]);
+            break;
+        case 3:
+            plp_mat_mult_3x3_f32s_xpulpv2(pSrcA[b], pSrcB[b], pDstC[b]);
+            break;
+        case 4:
+            plp_mat_mult_4x4_f32s_xpulpv2(pSrcA[b], pSrcB[b], pDstC[b]);
+            break;
+        case 6:
+            plp_mat_mult_6x6_f32s_xpulpv2(pSrcA[b], pSrcB[b], pDstC[b]);
+            break;
+        default:
+            plp_mat_mult_f32s_xpulpv2(pSrcA[b], pSrcB[b], M, N, O, pDstC[b]);
+            break;
+        }
+    }
+}
+
+/**
+   @} end of BasicMatMultKernels group
+*/
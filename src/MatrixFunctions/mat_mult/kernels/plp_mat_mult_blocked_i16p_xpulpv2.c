@@ -0,0 +1,211 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_blocked_i16p_xpulpv2.c
+ * Description:  parallel 16-bit integer blocked matrix multiplication for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMult
+ */
+
+/**
+  @addtogroup BasicMatMultKernels
+  @{
+ */
+
+/**
+   @brief Dot product of a row of A with a packed (transposed) column of B.
+   @param[in]  pA   points to the row of A
+   @param[in]  pBT  points to the packed column of B
+   @param[in]  N    number of elements
+   @return     dot product
+*/
+static inline int32_t plp_mat_mult_blocked_dot_i16(const int16_t *__restrict__ pA,
+                                                   const int16_t *__restrict__ pBT,
+                                                   uint32_t N) {
+    int32_t sum = 0;
+    uint32_t j;
+    for (j = 0; j < N / 2; j++) {
+        sum = __SUMDOTP2(*((v2s *)&pA[j * 2]), *((v2s *)&pBT[j * 2]), sum);
+    }
+    if (N & 1) {
+        sum += pA[N - 1] * pBT[N - 1];
+    }
+    return sum;
+}
+
+/**
+   @brief Parallel blocked matrix multiplication of 16-bit integer matrices kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_mat_mult_blocked_instance_i16 struct initialized by
+                     plp_mat_mult_i16_parallel
+   @return     none
+
+   @par Blocking
+   The second matrix is processed in panels of panelWidth columns. All cores first pack the panel
+   transposed into the L1 buffer pPanel, such that every column of B becomes a contiguous row.
+   Afterwards, the blocks of 4x2 elements of C are distributed with plp_mat_partition, and every
+   core computes its blocks with all accumulators kept in registers. Both operands of each pv.sdotsp.h are now loaded with unit stride, and every loaded
+   B vector is reused for 4 rows of A.
+*/
+
+void plp_mat_mult_blocked_i16p_xpulpv2(void *args) {
+
+    plp_mat_mult_blocked_instance_i16 *arguments = (plp_mat_mult_blocked_instance_i16 *)args;
+    const int16_t *__restrict__ pSrcA = arguments->pSrcA;
+    const int16_t *__restrict__ pSrcB = arguments->pSrcB;
+    uint32_t M = arguments->M;
+    uint32_t N = arguments->N;
+    uint32_t O = arguments->O;
+    uint32_t nPE = arguments->nPE;
+    int32_t *__restrict__ pDstC = arguments->pDstC;
+    int16_t *__restrict__ pPanel = arguments->pPanel;
+    uint32_t panelWidth = arguments->panelWidth;
+
+    uint32_t core_id = rt_core_id();
+
+    // each packed column is padded to an even length to keep all rows word aligned
+    uint32_t NPad = (N + 1) & ~1;
+    uint32_t nBlocks = (M + 3) / 4;
+
+    uint32_t i, j, k; // loop counters
+    uint32_t kPanel;  // first column of the current panel
+
+    for (kPanel = 0; kPanel < O; kPanel += panelWidth) {
+
+        uint32_t width = (O - kPanel < panelWidth) ? O - kPanel : panelWidth;
+
+        // pack the panel transposed, every core takes a set of rows of B
+        for (j = core_id; j < N; j += nPE) {
+            const int16_t *pB = pSrcB + j * O + kPanel;
+            for (k = 0; k < width; k++) {
+                pPanel[k * NPad + j] = pB[k];
+            }
+        }
+
+        rt_team_barrier();
+
+        // distribute the blocks of 4x2 output elements of this panel on a 2-D grid of cores
+        plp_mat_partition_t part;
+        plp_mat_partition(nBlocks, (width + 1) / 2, nPE, core_id, &part);
+
+        uint32_t kStart = part.colStart * 2;
+        uint32_t kEnd = (part.colEnd * 2 > width) ? width : part.colEnd * 2;
+
+        for (uint32_t block = part.rowStart; block < part.rowEnd; block++) {
+
+            i = block * 4;
+            int32_t *pC = pDstC + i * O + kPanel;
+
+            if (i + 4 <= M) {
+                const int16_t *pA0 = pSrcA + i * N;
+                const int16_t *pA1 = pA0 + N;
+                const int16_t *pA2 = pA1 + N;
+                const int16_t *pA3 = pA2 + N;
+
+                for (k = kStart; k + 2 <= kEnd; k += 2) {
+                    const int16_t *pB0 = pPanel + k * NPad;
+                    const int16_t *pB1 = pB0 + NPad;
+
+                    int32_t sum00 = 0;
+                    int32_t sum01 = 0;
+                    int32_t sum10 = 0;
+                    int32_t sum11 = 0;
+                    int32_t sum20 = 0;
+                    int32_t sum21 = 0;
+                    int32_t sum30 = 0;
+                    int32_t sum31 = 0;
+
+                    for (j = 0; j < N / 2; j++) {
+                        v2s bVec0 = *((v2s *)&pB0[j * 2]);
+                        v2s bVec1 = *((v2s *)&pB1[j * 2]);
+                        v2s aVec0 = *((v2s *)&pA0[j * 2]);
+                        v2s aVec1 = *((v2s *)&pA1[j * 2]);
+                        v2s aVec2 = *((v2s *)&pA2[j * 2]);
+                        v2s aVec3 = *((v2s *)&pA3[j * 2]);
+
+                        sum00 = __SUMDOTP2(aVec0, bVec0, sum00);
+                        sum01 = __SUMDOTP2(aVec0, bVec1, sum01);
+                        sum10 = __SUMDOTP2(aVec1, bVec0, sum10);
+                        sum11 = __SUMDOTP2(aVec1, bVec1, sum11);
+                        sum20 = __SUMDOTP2(aVec2, bVec0, sum20);
+                        sum21 = __SUMDOTP2(aVec2, bVec1, sum21);
+                        sum30 = __SUMDOTP2(aVec3, bVec0, sum30);
+                        sum31 = __SUMDOTP2(aVec3, bVec1, sum31);
+                    }
+
+                    // clean up for odd N
+                    if (N & 1) {
+                        int16_t b0 = pB0[N - 1];
+                        int16_t b1 = pB1[N - 1];
+                        sum00 += pA0[N - 1] * b0;
+                        sum01 += pA0[N - 1] * b1;
+                        sum10 += pA1[N - 1] * b0;
+                        sum11 += pA1[N - 1] * b1;
+                        sum20 += pA2[N - 1] * b0;
+                        sum21 += pA2[N - 1] * b1;
+                        sum30 += pA3[N - 1] * b0;
+                        sum31 += pA3[N - 1] * b1;
+                    }
+
+                    pC[k] = sum00;
+                    pC[k + 1] = sum01;
+                    pC[O + k] = sum10;
+                    pC[O + k + 1] = sum11;
+                    pC[2 * O + k] = sum20;
+                    pC[2 * O + k + 1] = sum21;
+                    pC[3 * O + k] = sum30;
+                    pC[3 * O + k + 1] = sum31;
+                }
+
+                // clean up for odd panel width
+                if (k < kEnd) {
+                    const int16_t *pB0 = pPanel + k * NPad;
+                    pC[k] = plp_mat_mult_blocked_dot_i16(pA0, pB0, N);
+                    pC[O + k] = plp_mat_mult_blocked_dot_i16(pA1, pB0, N);
+                    pC[2 * O + k] = plp_mat_mult_blocked_dot_i16(pA2, pB0, N);
+                    pC[3 * O + k] = plp_mat_mult_blocked_dot_i16(pA3, pB0, N);
+                }
+            } else {
+                // clean up for the last rows, when M is not divisible by 4
+                for (; i < M; i++) {
+                    for (k = kStart; k < kEnd; k++) {
+                        pC[k] = plp_mat_mult_blocked_dot_i16(pSrcA + i * N, pPanel + k * NPad, N);
+                    }
+                    pC += O;
+                }
+            }
+        }
+
+        // wait until all cores are done with the panel before it is overwritten
+        rt_team_barrier();
+    }
+}
+
+/**
+   @} end of BasicMatMultKernels group
+*/
@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_f16p_xpulpv2.c
+ * Description:  Parallel half-precision float matrix multiplication kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMult
+ */
+
+/**
+  @addtogroup BasicMatMultKernels
+  @{
+ */
+
+/**
+   @brief Parallel matrix multiplication of half-precision float matrices kernel for XPULPV2
+          extension with the smallFloat extensions.
+   @param[in]  args  pointer to plp_mat_mult_instance_f16 struct initialized by
+                     plp_mat_mult_f16_parallel
+   @return     none
+*/
+
+void plp_mat_mult_f16p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_mult_instance_f16 *a = (plp_mat_mult_instance_f16 *)args;
+
+    const float16_t *__restrict__ pSrcA = a->pSrcA;
+    const float16_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    float16_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t m, n, o;
+
+#ifdef PLP_MATH_SMALLFLOAT
+
+    // two columns of C at once, which needs O to be even such that every row of B is aligned
+    uint32_t oPacked = (O % 2 == 0) ? O : 0;
+
+    for (m = core_id; m < M; m += nPE) {
+        for (o = 0; o < oPacked; o += 2) {
+            v2f16 sum = { 0, 0 };
+            for (n = 0; n < N; n++) {
+                float16_t valA = pSrcA[m * N + n];
+                sum += (v2f16){ valA, valA } * *(const v2f16 *)&pSrcB[n * O + o]; // vfmac.h
+            }
+            *(v2f16 *)&pDstC[m * O + o] = sum;
+        }
+        for (o = oPacked; o < O; o++) {
+            float16_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += pSrcA[m * N + n] * pSrcB[n * O + o];
+            }
+            pDstC[m * O + o] = sum;
+        }
+    }
+
+#else // PLP_MATH_SMALLFLOAT
+
+    for (m = core_id; m < M; m += nPE) {
+        for (o = 0; o < O; o++) {
+            float32_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += plp_f16_to_f32(pSrcA[m * N + n]) * plp_f16_to_f32(pSrcB[n * O + o]);
+            }
+            pDstC[m * O + o] = plp_f32_to_f16(sum);
+        }
+    }
+
+#endif // PLP_MATH_SMALLFLOAT
+}
+
+/**
+   @} end of BasicMatMultKernels group
+*/
@@ -54,6 +54,7 @@
 
 #ifdef BASIC_VERSION
 
+PLP_HOT_CODE
 void plp_mat_mult_i16p_xpulpv2(void *args) {
     plp_mat_mult_instance_i16 *arguments = (plp_mat_mult_instance_i16 *)args;
     const int16_t *__restrict__ pSrcA = arguments->pSrcA;
@@ -85,6 +86,7 @@ void plp_mat_mult_i16p_xpulpv2(void *args) {
 
 #else
 
+PLP_HOT_CODE
 void plp_mat_mult_i16p_xpulpv2(void *args) {
     plp_mat_mult_instance_i16 *arguments = (plp_mat_mult_instance_i16 *)args;
     const int16_t *__restrict__ pSrcA = arguments->pSrcA;
@@ -115,6 +117,7 @@ void plp_mat_mult_i16p_xpulpv2(void *args) {
 
             // v2s* Bpoint = (v2s*) &(pSrcB[k]);
 
+            PLP_UNROLL(2)
             for (j = 0; j < N / 2; j++) {
 
                 v2s aVec0 = *((v2s *)&(pSrcA[(i * 4) * N + (j * 2)]));
@@ -54,6 +54,7 @@
 
 #ifdef BASIC_VERSION
 
+PLP_HOT_CODE
 void plp_mat_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
                                const int16_t *__restrict__ pSrcB,
                                uint32_t M,
@@ -78,6 +79,7 @@ void plp_mat_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
 
 #else
 
+PLP_HOT_CODE
 void plp_mat_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
                                const int16_t *__restrict__ pSrcB,
                                uint32_t M,
@@ -101,6 +103,7 @@ void plp_mat_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
             int32_t sum30 = 0;
             int32_t sum31 = 0;
 
+            PLP_UNROLL(2)
             for (j = 0; j < N / 2; j++) {
 
                 v2s aVec0 = *((v2s *)&(pSrcA[(i * 4) * N + (j * 2)]));
@@ -94,88 +94,61 @@ void plp_mat_mult_i32p_xpulpv2(void *args) {
     uint32_t nPE = arguments->nPE;
     int32_t *__restrict__ pDstC = arguments->pDstC;
 
-    uint32_t i = 0; // loop counter for M
-    uint32_t j = 0; // loop counter for N
-    uint32_t k = 0; // loop counter for O
+    uint32_t i; // loop counter for M
+    uint32_t j; // loop counter for N
+    uint32_t k; // loop counter for O
 
     int core_id = rt_core_id();
 
-    // printf("core id: %i, start: %i, end: %i\n", core_id, START, END);
+    // distribute the blocks of 2x2 output elements on a 2-D grid of cores
+    plp_mat_partition_t part;
+    plp_mat_partition((M + 1) / 2, (O + 1) / 2, nPE, core_id, &part);
 
-    for (k = core_id; k < O / 2; k += nPE) {
-        for (i = 0; i < M / 2; i++) {
+    for (uint32_t iBlk = part.rowStart; iBlk < part.rowEnd; iBlk++) {
+        i = iBlk * 2;
+        for (uint32_t kBlk = part.colStart; kBlk < part.colEnd; kBlk++) {
+            k = kBlk * 2;
 
-            int32_t sum00 = 0;
-            int32_t sum01 = 0;
-            int32_t sum10 = 0;
-            int32_t sum11 = 0;
+            if (i + 1 < M && k + 1 < O) {
 
-            for (j = 0; j < N; j++) {
-                int32_t AVal0 = pSrcA[i * 2 * N + (j)];
-                int32_t AVal1 = pSrcA[i * 2 * N + N + (j)];
+                int32_t sum00 = 0;
+                int32_t sum01 = 0;
+                int32_t sum10 = 0;
+                int32_t sum11 = 0;
 
-                int32_t BVal0 = pSrcB[j * O + (k * 2)];
-                int32_t BVal1 = pSrcB[j * O + (k * 2 + 1)];
+                for (j = 0; j < N; j++) {
+                    int32_t AVal0 = pSrcA[i * N + j];
+                    int32_t AVal1 = pSrcA[i * N + N + j];
 
-                sum00 = sum00 + AVal0 * BVal0;
-                sum01 = sum01 + AVal0 * BVal1;
-                sum10 = sum10 + AVal1 * BVal0;
-                sum11 = sum11 + AVal1 * BVal1;
-            }
+                    int32_t BVal0 = pSrcB[j * O + k];
+                    int32_t BVal1 = pSrcB[j * O + k + 1];
 
-            pDstC[(i * 2) * O + k * 2] = sum00;
-            pDstC[(i * 2) * O + k * 2 + 1] = sum01;
-            pDstC[(i * 2 + 1) * O + k * 2] = sum10;
-            pDstC[(i * 2 + 1) * O + k * 2 + 1] = sum11;
-        }
-    }
-
-    // clean up code
-    i = i * 2;
-    j = j;
-    k = k * 2;
-    // check if every index is nicely finished
-    if (i == M && j == N && k >= O) {
-
-    } else {
-        uint32_t iEnd = i;
-        uint32_t jEnd = j;
-        uint32_t kEnd = k >= O ? O : k;
-
-        // clean up for j
-        if (jEnd != N) {
-            for (i = 0; i < iEnd; i++) {
-                for (k = 0; k < kEnd; k += nPE) {
-                    int32_t sum = 0;
-                    for (j = jEnd; j < N; j++) {
-                        sum += sum + pSrcA[i * N + j] * pSrcB[j * O + k];
-                    }
-                    pDstC[i * O + k] += sum;
+                    sum00 = sum00 + AVal0 * BVal0;
+                    sum01 = sum01 + AVal0 * BVal1;
+                    sum10 = sum10 + AVal1 * BVal0;
+                    sum11 = sum11 + AVal1 * BVal1;
                 }
-            }
-        }
 
-        // clean up for i
-        if (iEnd != M) {
-            for (k = core_id; k < kEnd; k += nPE) {
-                for (i = iEnd; i < M; i++) {
-                    int32_t sum = 0;
-                    for (j = 0; j < N; j++) {
-                        sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
-                    }
-                    pDstC[i * O + k] = sum;
-                }
-            }
-        }
+                pDstC[i * O + k] = sum00;
+                pDstC[i * O + k + 1] = sum01;
+                pDstC[(i + 1) * O + k] = sum10;
+                pDstC[(i + 1) * O + k + 1] = sum11;
 
-        // clean up for k
-        for (k = kEnd; k < O; k += nPE) {
-            for (i = 0; i < M; i++) {
-                int32_t sum = 0;
-                for (j = 0; j < N; j++) {
-                    sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
+            } else {
+
+                // clean up for the last row or column, if M or O is odd
+                uint32_t iEnd = (i + 2 > M) ? M : i + 2;
+                uint32_t kEnd = (k + 2 > O) ? O : k + 2;
+
+                for (uint32_t ii = i; ii < iEnd; ii++) {
+                    for (uint32_t kk = k; kk < kEnd; kk++) {
+                        int32_t sum = 0;
+                        for (j = 0; j < N; j++) {
+                            sum = sum + pSrcA[ii * N + j] * pSrcB[j * O + kk];
+                        }
+                        pDstC[ii * O + kk] = sum;
+                    }
                 }
-                pDstC[i * O + k] = sum;
             }
         }
     }
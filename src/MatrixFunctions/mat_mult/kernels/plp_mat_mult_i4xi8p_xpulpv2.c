@@ -0,0 +1,258 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i4xi8p_xpulpv2.c
+ * Description:  parallel i4xi8 mixed-precision matrix multiplication for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMult
+ */
+
+/**
+  @addtogroup BasicMatMultKernels
+  @{
+ */
+
+/**
+   @brief Returns the element n of a packed 4-bit row, sign-extended to 32 bit.
+   @param[in]  pA  points to the first byte of the row
+   @param[in]  n   index of the element
+   @return     element n of the row
+*/
+static inline int32_t plp_mat_mult_i4xi8_unpack(const int8_t *__restrict__ pA, uint32_t n) {
+    // move the nibble to the upper half of the byte, and shift it back arithmetically
+    return (int32_t)(int8_t)((uint32_t)pA[n / 2] << (4 - 4 * (n & 1))) >> 4;
+}
+
+/**
+   @brief Dot product of a packed 4-bit row of A and a column of B, used for the leftover rows and
+          columns.
+   @param[in]  pA  points to the first byte of the row of A
+   @param[in]  pB  points to the first element of the column of B
+   @param[in]  N   number of elements
+   @param[in]  O   width of matrix B
+   @return     dot product
+*/
+static inline int32_t plp_mat_mult_i4xi8_dot(const int8_t *__restrict__ pA,
+                                             const int8_t *__restrict__ pB,
+                                             uint32_t N,
+                                             uint32_t O) {
+    const v4s shift = { 4, 4, 4, 4 };
+
+    int32_t sum = 0;
+    uint32_t n;
+    for (n = 0; n + 7 < N; n += 8) {
+        v4s aVec = *((v4s *)&pA[n / 2]);
+        v4s aEven = __SRA4(__SLL4(aVec, shift), shift); // elements n, n + 2, n + 4, n + 6
+        v4s aOdd = __SRA4(aVec, shift);                 // elements n + 1, n + 3, n + 5, n + 7
+        v4s bEven = { pB[n * O], pB[(n + 2) * O], pB[(n + 4) * O], pB[(n + 6) * O] };
+        v4s bOdd = { pB[(n + 1) * O], pB[(n + 3) * O], pB[(n + 5) * O], pB[(n + 7) * O] };
+        sum = __SUMDOTP4(aEven, bEven, sum);
+        sum = __SUMDOTP4(aOdd, bOdd, sum);
+    }
+    for (; n < N; n++) {
+        sum += plp_mat_mult_i4xi8_unpack(pA, n) * pB[n * O];
+    }
+    return sum;
+}
+
+/**
+   @brief Parallel matrix multiplication of a packed 4-bit integer matrix with an 8-bit integer
+          matrix kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i4xi8 struct initialized by
+                     plp_mat_mult_i4xi8_parallel
+   @return     none
+
+   @par Packing
+   Matrix A holds signed 4-bit values, packed two per byte. Element n of a row is stored in the
+   low nibble (n even) or in the high nibble (n odd) of byte n / 2. Every row starts at a new byte,
+   i.e., a row takes (N + 1) / 2 bytes, and the high nibble of the last byte is ignored if N is odd.
+
+   @par Exploiting SIMD instructions
+   Eight elements of a row of A are loaded as one word, and their low and high nibbles are
+   sign-extended to 8 bit with two vector shifts (pv.sll.b, pv.sra.b). This splits the row into
+   its even and its odd elements. The matching rows of B are transposed with pv.shuffle2.b, such
+   that two pv.sdotsp.b compute eight products. The output is computed in blocks of 2x4 elements,
+   with all accumulators kept in registers.
+
+   @par Parallelization
+   The blocks of 2x4 elements of C are distributed with plp_mat_partition, such that every core
+   computes a rectangle of C.
+*/
+
+void plp_mat_mult_i4xi8p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_mult_instance_i4xi8 *a = (plp_mat_mult_instance_i4xi8 *)args;
+
+    const int8_t *__restrict__ pSrcA = a->pSrcA;
+    const int8_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t m, n, o; // loop counters
+
+    // distribute the blocks of 2x4 elements of C on a 2-D grid of cores
+    plp_mat_partition_t part;
+    plp_mat_partition((M + 1) / 2, (O + 3) / 4, nPE, core_id, &part);
+
+    uint32_t rowStart = part.rowStart * 2;
+    uint32_t rowEnd = (part.rowEnd * 2 > M) ? M : part.rowEnd * 2;
+    uint32_t colStart = part.colStart * 4;
+    uint32_t colEnd = (part.colEnd * 4 > O) ? O : part.colEnd * 4;
+
+    const v4s shift = { 4, 4, 4, 4 };
+    const v4s mask0 = { 0, 1, 4, 5 };
+    const v4s mask1 = { 2, 3, 6, 7 };
+    const v4s mask2 = { 0, 2, 4, 6 };
+    const v4s mask3 = { 1, 3, 5, 7 };
+
+    uint32_t strideA = (N + 1) / 2; // bytes between each row of A
+
+    // compute blocks of 2x4 elements of C, consuming eight elements of each row of A at a time
+    for (m = rowStart; m + 1 < rowEnd; m += 2) {
+        const int8_t *pA0 = pSrcA + m * strideA;
+        const int8_t *pA1 = pA0 + strideA;
+        int32_t *pC0 = pDstC + m * O;
+        int32_t *pC1 = pC0 + O;
+
+        for (o = colStart; o + 3 < colEnd; o += 4) {
+            const int8_t *pB = pSrcB + o;
+
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum02 = 0;
+            int32_t sum03 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+            int32_t sum12 = 0;
+            int32_t sum13 = 0;
+
+            for (n = 0; n + 7 < N; n += 8) {
+                // sign-extend the low and the high nibbles of A to 8 bit
+                v4s aVec0 = *((v4s *)&pA0[n / 2]);
+                v4s aVec1 = *((v4s *)&pA1[n / 2]);
+                v4s aEven0 = __SRA4(__SLL4(aVec0, shift), shift);
+                v4s aEven1 = __SRA4(__SLL4(aVec1, shift), shift);
+                v4s aOdd0 = __SRA4(aVec0, shift);
+                v4s aOdd1 = __SRA4(aVec1, shift);
+
+                const int8_t *pBRow = pB + n * O;
+                v4s temp0 = *((v4s *)&pBRow[0]);
+                v4s temp1 = *((v4s *)&pBRow[O]);
+                v4s temp2 = *((v4s *)&pBRow[2 * O]);
+                v4s temp3 = *((v4s *)&pBRow[3 * O]);
+                v4s temp4 = *((v4s *)&pBRow[4 * O]);
+                v4s temp5 = *((v4s *)&pBRow[5 * O]);
+                v4s temp6 = *((v4s *)&pBRow[6 * O]);
+                v4s temp7 = *((v4s *)&pBRow[7 * O]);
+
+                // transpose the even rows n, n + 2, n + 4, n + 6
+                v4s temp8 = __builtin_shuffle(temp0, temp2, mask0);
+                v4s temp9 = __builtin_shuffle(temp4, temp6, mask0);
+                v4s temp10 = __builtin_shuffle(temp0, temp2, mask1);
+                v4s temp11 = __builtin_shuffle(temp4, temp6, mask1);
+                v4s bEven0 = __builtin_shuffle(temp8, temp9, mask2);
+                v4s bEven1 = __builtin_shuffle(temp8, temp9, mask3);
+                v4s bEven2 = __builtin_shuffle(temp10, temp11, mask2);
+                v4s bEven3 = __builtin_shuffle(temp10, temp11, mask3);
+
+                // transpose the odd rows n + 1, n + 3, n + 5, n + 7
+                temp8 = __builtin_shuffle(temp1, temp3, mask0);
+                temp9 = __builtin_shuffle(temp5, temp7, mask0);
+                temp10 = __builtin_shuffle(temp1, temp3, mask1);
+                temp11 = __builtin_shuffle(temp5, temp7, mask1);
+                v4s bOdd0 = __builtin_shuffle(temp8, temp9, mask2);
+                v4s bOdd1 = __builtin_shuffle(temp8, temp9, mask3);
+                v4s bOdd2 = __builtin_shuffle(temp10, temp11, mask2);
+                v4s bOdd3 = __builtin_shuffle(temp10, temp11, mask3);
+
+                sum00 = __SUMDOTP4(aEven0, bEven0, sum00);
+                sum01 = __SUMDOTP4(aEven0, bEven1, sum01);
+                sum02 = __SUMDOTP4(aEven0, bEven2, sum02);
+                sum03 = __SUMDOTP4(aEven0, bEven3, sum03);
+                sum10 = __SUMDOTP4(aEven1, bEven0, sum10);
+                sum11 = __SUMDOTP4(aEven1, bEven1, sum11);
+                sum12 = __SUMDOTP4(aEven1, bEven2, sum12);
+                sum13 = __SUMDOTP4(aEven1, bEven3, sum13);
+                sum00 = __SUMDOTP4(aOdd0, bOdd0, sum00);
+                sum01 = __SUMDOTP4(aOdd0, bOdd1, sum01);
+                sum02 = __SUMDOTP4(aOdd0, bOdd2, sum02);
+                sum03 = __SUMDOTP4(aOdd0, bOdd3, sum03);
+                sum10 = __SUMDOTP4(aOdd1, bOdd0, sum10);
+                sum11 = __SUMDOTP4(aOdd1, bOdd1, sum11);
+                sum12 = __SUMDOTP4(aOdd1, bOdd2, sum12);
+                sum13 = __SUMDOTP4(aOdd1, bOdd3, sum13);
+            }
+
+            // leftover elements, if N is not a multiple of 8
+            for (; n < N; n++) {
+                int32_t aVal0 = plp_mat_mult_i4xi8_unpack(pA0, n);
+                int32_t aVal1 = plp_mat_mult_i4xi8_unpack(pA1, n);
+                const int8_t *pBRow = pB + n * O;
+                sum00 += aVal0 * pBRow[0];
+                sum01 += aVal0 * pBRow[1];
+                sum02 += aVal0 * pBRow[2];
+                sum03 += aVal0 * pBRow[3];
+                sum10 += aVal1 * pBRow[0];
+                sum11 += aVal1 * pBRow[1];
+                sum12 += aVal1 * pBRow[2];
+                sum13 += aVal1 * pBRow[3];
+            }
+
+            pC0[o] = sum00;
+            pC0[o + 1] = sum01;
+            pC0[o + 2] = sum02;
+            pC0[o + 3] = sum03;
+            pC1[o] = sum10;
+            pC1[o + 1] = sum11;
+            pC1[o + 2] = sum12;
+            pC1[o + 3] = sum13;
+        }
+
+        // leftover columns, if the number of columns is not a multiple of 4
+        for (; o < colEnd; o++) {
+            pC0[o] = plp_mat_mult_i4xi8_dot(pA0, pSrcB + o, N, O);
+            pC1[o] = plp_mat_mult_i4xi8_dot(pA1, pSrcB + o, N, O);
+        }
+    }
+
+    // leftover row, if the number of rows is odd
+    if (m < rowEnd) {
+        for (o = colStart; o < colEnd; o++) {
+            pDstC[m * O + o] = plp_mat_mult_i4xi8_dot(pSrcA + m * strideA, pSrcB + o, N, O);
+        }
+    }
+}
+
+/**
+   @} end of BasicMatMultKernels group
+*/
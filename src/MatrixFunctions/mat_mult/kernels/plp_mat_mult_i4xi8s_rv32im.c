@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i4xi8s_rv32im.c
+ * Description:  i4xi8 mixed-precision matrix multiplication for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMult
+ */
+
+/**
+  @addtogroup BasicMatMultKernels
+  @{
+ */
+
+/**
+  @brief Matrix multiplication of a packed 4-bit integer matrix with an 8-bit integer matrix kernel
+         for RV32IM extension.
+  @param[in]  pSrcA     points to the first input matrix (packed 4-bit)
+  @param[in]  pSrcB     points to the second input matrix (8-bit)
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and height of the second
+  @param[in]  O         width of the second input matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par Packing
+  Matrix A holds signed 4-bit values, packed two per byte. Element n of a row is stored in the
+  low nibble (n even) or in the high nibble (n odd) of byte n / 2. Every row starts at a new byte,
+  i.e., a row takes (N + 1) / 2 bytes, and the high nibble of the last byte is ignored if N is odd.
+ */
+
+void plp_mat_mult_i4xi8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                const int8_t *__restrict__ pSrcB,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t O,
+                                int32_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o;               // loop counters
+    uint32_t strideA = (N + 1) / 2; // bytes between each row of A
+
+    for (m = 0; m < M; m++) {
+        const int8_t *pA = pSrcA + m * strideA;
+        for (o = 0; o < O; o++) {
+            int32_t sum = 0;
+            for (n = 0; n + 1 < N; n += 2) {
+                int32_t packed = pA[n / 2];
+                int32_t valA0 = (int32_t)(int8_t)((uint32_t)packed << 4) >> 4;
+                int32_t valA1 = packed >> 4;
+                sum += valA0 * pSrcB[n * O + o];
+                sum += valA1 * pSrcB[(n + 1) * O + o];
+            }
+            if (n < N) {
+                int32_t valA0 = (int32_t)(int8_t)((uint32_t)pA[n / 2] << 4) >> 4;
+                sum += valA0 * pSrcB[n * O + o];
+            }
+            pDstC[m * O + o] = sum;
+        }
+    }
+}
+
+/**
+   @} end of BasicMatMultKernels group
+*/
@@ -54,6 +54,7 @@
 
 #ifdef BASIC_VERSION
 
+PLP_HOT_CODE
 void plp_mat_mult_i8p_xpulpv2(void *args) {
 
     plp_mat_mult_instance_i8 *arguments = (plp_mat_mult_instance_i8 *)args;
@@ -89,6 +90,7 @@ RT_CL_DATA static v4s mask1 = { 2, 3, 6, 7 };
 RT_CL_DATA static v4s mask2 = { 0, 2, 4, 6 };
 RT_CL_DATA static v4s mask3 = { 1, 3, 5, 7 };
 
+PLP_HOT_CODE
 void plp_mat_mult_i8p_xpulpv2(void *args) {
 
     plp_mat_mult_instance_i8 *arguments = (plp_mat_mult_instance_i8 *)args;
@@ -120,6 +122,7 @@ void plp_mat_mult_i8p_xpulpv2(void *args) {
 
             // v2s* Bpoint = (v2s*) &(pSrcB[k]);
 
+            PLP_UNROLL(2)
             for (j = 0; j < N / 4; j++) {
 
                 v4s aVec0 = *((v4s *)&(pSrcA[(i * 2) * N + (j * 4)]));
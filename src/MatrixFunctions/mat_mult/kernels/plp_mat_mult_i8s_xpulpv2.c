@@ -54,6 +54,7 @@
 
 #ifdef BASIC_VERSION
 
+PLP_HOT_CODE
 void plp_mat_mult_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
                               const int8_t *__restrict__ pSrcB,
                               uint32_t M,
@@ -83,6 +84,7 @@ RT_CL_DATA static v4s mask1 = { 2, 3, 6, 7 };
 RT_CL_DATA static v4s mask2 = { 0, 2, 4, 6 };
 RT_CL_DATA static v4s mask3 = { 1, 3, 5, 7 };
 
+PLP_HOT_CODE
 void plp_mat_mult_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
                               const int8_t *__restrict__ pSrcB,
                               uint32_t M,
@@ -108,6 +110,7 @@ void plp_mat_mult_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
 
             // v2s* Bpoint = (v2s*) &(pSrcB[k]);
 
+            PLP_UNROLL(2)
             for (j = 0; j < N / 4; j++) {
 
                 v4s aVec0 = *((v4s *)&(pSrcA[(i * 2) * N + (j * 4)]));
@@ -0,0 +1,209 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i8xi16s_xpulpv2.c
+ * Description:  i8xi16 mixed-precision matrix multiplication for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMult
+ */
+
+/**
+  @addtogroup BasicMatMultKernels
+  @{
+ */
+
+/**
+   @brief Dot product of a row of A and a column of B, used for the leftover rows and columns.
+   @param[in]  pA  points to the first element of the row of A
+   @param[in]  pB  points to the first element of the column of B
+   @param[in]  N   number of elements
+   @param[in]  O   width of matrix B
+   @return     dot product
+*/
+static inline int32_t plp_mat_mult_i8xi16_dot(const int8_t *__restrict__ pA,
+                                              const int16_t *__restrict__ pB,
+                                              uint32_t N,
+                                              uint32_t O) {
+    const v2s shift = { 8, 8 };
+
+    int32_t sum = 0;
+    uint32_t n;
+    for (n = 0; n + 3 < N; n += 4) {
+        v2s aVec = *((v2s *)&pA[n]);
+        v2s aEven = __SRA2(__SLL2(aVec, shift), shift); // elements n, n + 2
+        v2s aOdd = __SRA2(aVec, shift);                 // elements n + 1, n + 3
+        v2s bEven = { pB[n * O], pB[(n + 2) * O] };
+        v2s bOdd = { pB[(n + 1) * O], pB[(n + 3) * O] };
+        sum = __SUMDOTP2(aEven, bEven, sum);
+        sum = __SUMDOTP2(aOdd, bOdd, sum);
+    }
+    for (; n < N; n++) {
+        sum += (int32_t)pA[n] * (int32_t)pB[n * O];
+    }
+    return sum;
+}
+
+/**
+   @brief Matrix multiplication of an 8-bit integer matrix with a 16-bit integer matrix kernel for
+          XPULPV2 extension.
+   @param[in]  pSrcA     points to the first input matrix (8-bit)
+   @param[in]  pSrcB     points to the second input matrix (16-bit)
+   @param[in]  M         height of the first input matrix
+   @param[in]  N         width of the first input matrix and height of the second
+   @param[in]  O         width of the second input matrix
+   @param[out] pDstC     points to the output matrix
+   @return     none
+
+   @par Exploiting SIMD instructions
+   Four elements of a row of A are loaded as one word, and their even and odd bytes are
+   sign-extended to 16 bit with two vector shifts (pv.sll.h, pv.sra.h). The matching elements of
+   B are paired with pv.shuffle2.h, such that two pv.sdotsp.h compute four products. The output is
+   computed in blocks of 2x4 elements, with all accumulators kept in registers.
+*/
+
+void plp_mat_mult_i8xi16s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  int32_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o; // loop counters
+
+    const v2s shift = { 8, 8 };
+    const v2s mask0 = { 0, 2 };
+    const v2s mask1 = { 1, 3 };
+
+    // compute blocks of 2x4 elements of C, consuming four elements of each row of A at a time
+    for (m = 0; m + 1 < M; m += 2) {
+        const int8_t *pA0 = pSrcA + m * N;
+        const int8_t *pA1 = pA0 + N;
+        int32_t *pC0 = pDstC + m * O;
+        int32_t *pC1 = pC0 + O;
+
+        for (o = 0; o + 3 < O; o += 4) {
+            const int16_t *pB = pSrcB + o;
+
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum02 = 0;
+            int32_t sum03 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+            int32_t sum12 = 0;
+            int32_t sum13 = 0;
+
+            for (n = 0; n + 3 < N; n += 4) {
+                // sign-extend the even and the odd bytes of A to 16 bit
+                v2s aVec0 = *((v2s *)&pA0[n]);
+                v2s aVec1 = *((v2s *)&pA1[n]);
+                v2s aEven0 = __SRA2(__SLL2(aVec0, shift), shift);
+                v2s aEven1 = __SRA2(__SLL2(aVec1, shift), shift);
+                v2s aOdd0 = __SRA2(aVec0, shift);
+                v2s aOdd1 = __SRA2(aVec1, shift);
+
+                const int16_t *pBRow = pB + n * O;
+                v2s temp0 = *((v2s *)&pBRow[0]);         // row n, columns 0, 1
+                v2s temp1 = *((v2s *)&pBRow[2]);         // row n, columns 2, 3
+                v2s temp2 = *((v2s *)&pBRow[O]);         // row n + 1, columns 0, 1
+                v2s temp3 = *((v2s *)&pBRow[O + 2]);     // row n + 1, columns 2, 3
+                v2s temp4 = *((v2s *)&pBRow[2 * O]);     // row n + 2, columns 0, 1
+                v2s temp5 = *((v2s *)&pBRow[2 * O + 2]); // row n + 2, columns 2, 3
+                v2s temp6 = *((v2s *)&pBRow[3 * O]);     // row n + 3, columns 0, 1
+                v2s temp7 = *((v2s *)&pBRow[3 * O + 2]); // row n + 3, columns 2, 3
+
+                v2s bEven0 = __builtin_shuffle(temp0, temp4, mask0); // rows n, n + 2
+                v2s bEven1 = __builtin_shuffle(temp0, temp4, mask1);
+                v2s bEven2 = __builtin_shuffle(temp1, temp5, mask0);
+                v2s bEven3 = __builtin_shuffle(temp1, temp5, mask1);
+                v2s bOdd0 = __builtin_shuffle(temp2, temp6, mask0); // rows n + 1, n + 3
+                v2s bOdd1 = __builtin_shuffle(temp2, temp6, mask1);
+                v2s bOdd2 = __builtin_shuffle(temp3, temp7, mask0);
+                v2s bOdd3 = __builtin_shuffle(temp3, temp7, mask1);
+
+                sum00 = __SUMDOTP2(aEven0, bEven0, sum00);
+                sum01 = __SUMDOTP2(aEven0, bEven1, sum01);
+                sum02 = __SUMDOTP2(aEven0, bEven2, sum02);
+                sum03 = __SUMDOTP2(aEven0, bEven3, sum03);
+                sum10 = __SUMDOTP2(aEven1, bEven0, sum10);
+                sum11 = __SUMDOTP2(aEven1, bEven1, sum11);
+                sum12 = __SUMDOTP2(aEven1, bEven2, sum12);
+                sum13 = __SUMDOTP2(aEven1, bEven3, sum13);
+                sum00 = __SUMDOTP2(aOdd0, bOdd0, sum00);
+                sum01 = __SUMDOTP2(aOdd0, bOdd1, sum01);
+                sum02 = __SUMDOTP2(aOdd0, bOdd2, sum02);
+                sum03 = __SUMDOTP2(aOdd0, bOdd3, sum03);
+                sum10 = __SUMDOTP2(aOdd1, bOdd0, sum10);
+                sum11 = __SUMDOTP2(aOdd1, bOdd1, sum11);
+                sum12 = __SUMDOTP2(aOdd1, bOdd2, sum12);
+                sum13 = __SUMDOTP2(aOdd1, bOdd3, sum13);
+            }
+
+            // leftover elements, if N is not a multiple of 4
+            for (; n < N; n++) {
+                int32_t aVal0 = pA0[n];
+                int32_t aVal1 = pA1[n];
+                const int16_t *pBRow = pB + n * O;
+                sum00 += aVal0 * pBRow[0];
+                sum01 += aVal0 * pBRow[1];
+                sum02 += aVal0 * pBRow[2];
+                sum03 += aVal0 * pBRow[3];
+                sum10 += aVal1 * pBRow[0];
+                sum11 += aVal1 * pBRow[1];
+                sum12 += aVal1 * pBRow[2];
+                sum13 += aVal1 * pBRow[3];
+            }
+
+            pC0[o] = sum00;
+            pC0[o + 1] = sum01;
+            pC0[o + 2] = sum02;
+            pC0[o + 3] = sum03;
+            pC1[o] = sum10;
+            pC1[o + 1] = sum11;
+            pC1[o + 2] = sum12;
+            pC1[o + 3] = sum13;
+        }
+
+        // leftover columns, if the number of columns is not a multiple of 4
+        for (; o < O; o++) {
+            pC0[o] = plp_mat_mult_i8xi16_dot(pA0, pSrcB + o, N, O);
+            pC1[o] = plp_mat_mult_i8xi16_dot(pA1, pSrcB + o, N, O);
+        }
+    }
+
+    // leftover row, if the number of rows is odd
+    if (m < M) {
+        for (o = 0; o < O; o++) {
+            pDstC[m * O + o] = plp_mat_mult_i8xi16_dot(pSrcA + m * N, pSrcB + o, N, O);
+        }
+    }
+}
+
+/**
+   @} end of BasicMatMultKernels group
+*/
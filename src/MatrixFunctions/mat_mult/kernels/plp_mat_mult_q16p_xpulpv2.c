@@ -77,8 +77,11 @@ void plp_mat_mult_q16p_xpulpv2(void *args) {
     uint32_t n; // loop counter
     uint32_t o; // loop counter
 
-    for (m = core_id; m < M; m += nPE) {
-        for (o = 0; o < O; o++) {
+    plp_mat_partition_t part;
+    plp_mat_partition(M, O, nPE, core_id, &part);
+
+    for (m = part.rowStart; m < part.rowEnd; m++) {
+        for (o = part.colStart; o < part.colEnd; o++) {
             int32_t sum = 0;
             for (n = 0; n < N; n++) {
                 int32_t valA = (int32_t)pSrcA[m * N + n];
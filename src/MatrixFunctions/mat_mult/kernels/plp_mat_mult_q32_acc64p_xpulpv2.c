@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_q32_acc64p_xpulpv2.c
+ * Description:  parallel 32-bit fix-point matrix multiplication, 64-bit accumulation, XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMult
+ */
+
+/**
+  @addtogroup BasicMatMultKernels
+  @{
+ */
+
+/**
+   @brief Parallel matrix multiplication of 32-bit fix-point matrices with 64-bit accumulation
+          kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
+                     plp_mat_mult_q32_acc64_parallel
+   @return     none
+
+   @par Parallelization
+   The output is split into a 2-D grid of rectangles with plp_mat_partition, one per core. Every
+   core computes its rectangle in blocks of 2x2 elements, like plp_mat_mult_q32_acc64s_xpulpv2.
+*/
+
+void plp_mat_mult_q32_acc64p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_mult_instance_q32 *a = (plp_mat_mult_instance_q32 *)args;
+
+    const int32_t *__restrict__ pSrcA = a->pSrcA;
+    const int32_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t shift = a->shift;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    plp_mat_partition_t part;
+    plp_mat_partition(M, O, nPE, core_id, &part);
+
+    for (m = part.rowStart; m + 1 < part.rowEnd; m += 2) {
+        const int32_t *pA0 = pSrcA + m * N;
+        const int32_t *pA1 = pA0 + N;
+
+        for (o = part.colStart; o + 1 < part.colEnd; o += 2) {
+            int64_t sum00 = 0;
+            int64_t sum01 = 0;
+            int64_t sum10 = 0;
+            int64_t sum11 = 0;
+            for (n = 0; n < N; n++) {
+                int32_t a0 = pA0[n];
+                int32_t a1 = pA1[n];
+                int32_t b0 = pSrcB[n * O + o];
+                int32_t b1 = pSrcB[n * O + o + 1];
+                sum00 += (int64_t)a0 * b0;
+                sum01 += (int64_t)a0 * b1;
+                sum10 += (int64_t)a1 * b0;
+                sum11 += (int64_t)a1 * b1;
+            }
+            pDstC[m * O + o] = plp_acc64_to_q32(sum00, shift);
+            pDstC[m * O + o + 1] = plp_acc64_to_q32(sum01, shift);
+            pDstC[(m + 1) * O + o] = plp_acc64_to_q32(sum10, shift);
+            pDstC[(m + 1) * O + o + 1] = plp_acc64_to_q32(sum11, shift);
+        }
+
+        // leftover column
+        if (o < part.colEnd) {
+            int64_t sum0 = 0;
+            int64_t sum1 = 0;
+            for (n = 0; n < N; n++) {
+                int32_t b0 = pSrcB[n * O + o];
+                sum0 += (int64_t)pA0[n] * b0;
+                sum1 += (int64_t)pA1[n] * b0;
+            }
+            pDstC[m * O + o] = plp_acc64_to_q32(sum0, shift);
+            pDstC[(m + 1) * O + o] = plp_acc64_to_q32(sum1, shift);
+        }
+    }
+
+    // leftover row
+    if (m < part.rowEnd) {
+        const int32_t *pA0 = pSrcA + m * N;
+        for (o = part.colStart; o < part.colEnd; o++) {
+            int64_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += (int64_t)pA0[n] * pSrcB[n * O + o];
+            }
+            pDstC[m * O + o] = plp_acc64_to_q32(sum, shift);
+        }
+    }
+}
+
+/**
+   @} end of BasicMatMultKernels group
+*/
@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_q8_asyms_rv32im.c
+ * Description:  Asymmetric quantized 8-bit matrix multiplication kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMult
+ */
+
+/**
+  @addtogroup BasicMatMultKernels
+  @{
+ */
+
+/**
+  @brief Matrix multiplication of asymmetric quantized 8-bit matrices with per-channel
+         requantization kernel for RV32IM extension.
+  @param[in]  pSrcA        points to the first input matrix
+  @param[in]  pSrcB        points to the second input matrix
+  @param[in]  M            height of the first input matrix
+  @param[in]  N            width of the first input matrix and hight of the second
+  @param[in]  O            width of the second input matrix, i.e. the number of channels
+  @param[in]  pZeroPointB  points to the zero point of every column of B, or NULL
+  @param[in]  pColOffset   points to the offset of every column
+  @param[in]  pMultiplier  points to the multiplier of every column in Q1.31
+  @param[in]  pShift       points to the shift of every column, positive values shift left
+  @param[in]  zeroPointC   zero point of the output matrix
+  @param[out] pDstC        points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_q8_asyms_rv32im(const int8_t *__restrict__ pSrcA,
+                                  const int8_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  const int32_t *__restrict__ pZeroPointB,
+                                  const int32_t *__restrict__ pColOffset,
+                                  const int32_t *__restrict__ pMultiplier,
+                                  const int32_t *__restrict__ pShift,
+                                  int32_t zeroPointC,
+                                  int8_t *__restrict__ pDstC) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    for (m = 0; m < M; m++) {
+        const int8_t *pA = pSrcA + m * N;
+        int32_t rowSum = 0;
+
+        if (pZeroPointB != NULL) {
+            for (n = 0; n < N; n++) {
+                rowSum += pA[n];
+            }
+        }
+
+        for (o = 0; o < O; o++) {
+            int32_t acc = pColOffset[o];
+            for (n = 0; n < N; n++) {
+                acc += pA[n] * pSrcB[n * O + o];
+            }
+            if (pZeroPointB != NULL) {
+                acc -= pZeroPointB[o] * rowSum;
+            }
+            pDstC[m * O + o] = plp_requantize_q8(acc, pMultiplier[o], pShift[o], zeroPointC);
+        }
+    }
+}
+
+/**
+   @} end of BasicMatMultKernels group
+*/
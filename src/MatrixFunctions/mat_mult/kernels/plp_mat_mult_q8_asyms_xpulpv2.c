@@ -0,0 +1,181 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_q8_asyms_xpulpv2.c
+ * Description:  Asymmetric quantized 8-bit matrix multiplication kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMult
+ */
+
+/**
+  @addtogroup BasicMatMultKernels
+  @{
+ */
+
+/**
+  @brief Matrix multiplication of asymmetric quantized 8-bit matrices with per-channel
+         requantization kernel for XPULPV2 extension.
+  @param[in]  pSrcA        points to the first input matrix
+  @param[in]  pSrcB        points to the second input matrix
+  @param[in]  M            height of the first input matrix
+  @param[in]  N            width of the first input matrix and hight of the second
+  @param[in]  O            width of the second input matrix, i.e. the number of channels
+  @param[in]  pZeroPointB  points to the zero point of every column of B, or NULL
+  @param[in]  pColOffset   points to the offset of every column
+  @param[in]  pMultiplier  points to the multiplier of every column in Q1.31
+  @param[in]  pShift       points to the shift of every column, positive values shift left
+  @param[in]  zeroPointC   zero point of the output matrix
+  @param[out] pDstC        points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The output is computed in blocks of 2x4 elements. Four rows of four columns of B are transposed
+  with pv.shuffle2.b and multiplied with four elements of two rows of A with pv.sdotsp.b, as in
+  plp_mat_mult_i8s_xpulpv2. The row sums of A are computed with pv.sdotsp.b as well, once per
+  pair of rows. The zero point corrections and the requantization are applied in the epilogue of
+  every block, such that the accumulators never leave the registers.
+ */
+
+void plp_mat_mult_q8_asyms_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   const int32_t *__restrict__ pZeroPointB,
+                                   const int32_t *__restrict__ pColOffset,
+                                   const int32_t *__restrict__ pMultiplier,
+                                   const int32_t *__restrict__ pShift,
+                                   int32_t zeroPointC,
+                                   int8_t *__restrict__ pDstC) {
+
+    const v4s mask0 = { 0, 1, 4, 5 };
+    const v4s mask1 = { 2, 3, 6, 7 };
+    const v4s mask2 = { 0, 2, 4, 6 };
+    const v4s mask3 = { 1, 3, 5, 7 };
+    uint32_t rowStart = 0;
+    uint32_t rowEnd = M;
+    uint32_t colStart = 0;
+    uint32_t colEnd = O;
+    const v4s ones = { 1, 1, 1, 1 };
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+    uint32_t k; // loop counter
+    int32_t rowSum0 = 0;
+    int32_t rowSum1 = 0;
+    int32_t sum[8];
+
+    for (m = rowStart; m < rowEnd; m += 2) {
+        // the last row of an odd number of rows is computed in a block with itself
+        uint32_t m1 = (m + 1 < rowEnd) ? m + 1 : m;
+        const int8_t *pA0 = pSrcA + m * N;
+        const int8_t *pA1 = pSrcA + m1 * N;
+
+        if (pZeroPointB != NULL) {
+            rowSum0 = 0;
+            rowSum1 = 0;
+            for (n = 0; n + 3 < N; n += 4) {
+                rowSum0 = __SUMDOTP4(*((v4s *)&pA0[n]), ones, rowSum0);
+                rowSum1 = __SUMDOTP4(*((v4s *)&pA1[n]), ones, rowSum1);
+            }
+            for (; n < N; n++) {
+                rowSum0 += pA0[n];
+                rowSum1 += pA1[n];
+            }
+        }
+
+        for (o = colStart; o < colEnd; o += 4) {
+            const int8_t *pB = pSrcB + o;
+
+            for (k = 0; k < 8; k++) {
+                sum[k] = 0;
+            }
+
+            if (o + 3 < colEnd) {
+                for (n = 0; n + 3 < N; n += 4) {
+                    v4s aVec0 = *((v4s *)&pA0[n]);
+                    v4s aVec1 = *((v4s *)&pA1[n]);
+
+                    v4s temp0 = *((v4s *)&pB[n * O]);
+                    v4s temp1 = *((v4s *)&pB[(n + 1) * O]);
+                    v4s temp2 = *((v4s *)&pB[(n + 2) * O]);
+                    v4s temp3 = *((v4s *)&pB[(n + 3) * O]);
+
+                    // transpose, such that bVec0 to bVec3 hold four rows of one column each
+                    v4s temp4 = __builtin_shuffle(temp0, temp1, mask0);
+                    v4s temp5 = __builtin_shuffle(temp2, temp3, mask0);
+                    v4s temp6 = __builtin_shuffle(temp0, temp1, mask1);
+                    v4s temp7 = __builtin_shuffle(temp2, temp3, mask1);
+
+                    v4s bVec0 = __builtin_shuffle(temp4, temp5, mask2);
+                    v4s bVec1 = __builtin_shuffle(temp4, temp5, mask3);
+                    v4s bVec2 = __builtin_shuffle(temp6, temp7, mask2);
+                    v4s bVec3 = __builtin_shuffle(temp6, temp7, mask3);
+
+                    sum[0] = __SUMDOTP4(aVec0, bVec0, sum[0]);
+                    sum[1] = __SUMDOTP4(aVec0, bVec1, sum[1]);
+                    sum[2] = __SUMDOTP4(aVec0, bVec2, sum[2]);
+                    sum[3] = __SUMDOTP4(aVec0, bVec3, sum[3]);
+                    sum[4] = __SUMDOTP4(aVec1, bVec0, sum[4]);
+                    sum[5] = __SUMDOTP4(aVec1, bVec1, sum[5]);
+                    sum[6] = __SUMDOTP4(aVec1, bVec2, sum[6]);
+                    sum[7] = __SUMDOTP4(aVec1, bVec3, sum[7]);
+                }
+            } else {
+                n = 0;
+            }
+
+            // leftover rows of B, and leftover columns of the rectangle
+            for (; n < N; n++) {
+                for (k = 0; k < 4 && o + k < colEnd; k++) {
+                    sum[k] += pA0[n] * pB[n * O + k];
+                    sum[4 + k] += pA1[n] * pB[n * O + k];
+                }
+            }
+
+            // epilogue: zero point corrections and requantization of every channel
+            for (k = 0; k < 4 && o + k < colEnd; k++) {
+                int32_t offset = pColOffset[o + k];
+                int32_t acc0 = sum[k] + offset;
+                int32_t acc1 = sum[4 + k] + offset;
+                if (pZeroPointB != NULL) {
+                    acc0 -= pZeroPointB[o + k] * rowSum0;
+                    acc1 -= pZeroPointB[o + k] * rowSum1;
+                }
+                pDstC[m * O + o + k] =
+                    plp_requantize_q8(acc0, pMultiplier[o + k], pShift[o + k], zeroPointC);
+                pDstC[m1 * O + o + k] =
+                    plp_requantize_q8(acc1, pMultiplier[o + k], pShift[o + k], zeroPointC);
+            }
+        }
+    }
+}
+
+/**
+   @} end of BasicMatMultKernels group
+*/
@@ -0,0 +1,219 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_small_f32s_xpulpv2.c
+ * Description:  unrolled 32-bit floating-point matrix multiplication of small matrices
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMult
+ */
+
+/**
+  @addtogroup BasicMatMultKernels
+  @{
+ */
+
+/**
+  @brief Fully unrolled matrix multiplication of 2x2 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_2x2_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                   const float *__restrict__ pSrcB,
+                                   float *__restrict__ pDstC) {
+
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[2];
+    pDstC[1] = pSrcA[0] * pSrcB[1] + pSrcA[1] * pSrcB[3];
+    pDstC[2] = pSrcA[2] * pSrcB[0] + pSrcA[3] * pSrcB[2];
+    pDstC[3] = pSrcA[2] * pSrcB[1] + pSrcA[3] * pSrcB[3];
+}
+
+/**
+  @brief Fully unrolled matrix multiplication of 3x3 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_3x3_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                   const float *__restrict__ pSrcB,
+                                   float *__restrict__ pDstC) {
+
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[3] + pSrcA[2] * pSrcB[6];
+    pDstC[1] = pSrcA[0] * pSrcB[1] + pSrcA[1] * pSrcB[4] + pSrcA[2] * pSrcB[7];
+    pDstC[2] = pSrcA[0] * pSrcB[2] + pSrcA[1] * pSrcB[5] + pSrcA[2] * pSrcB[8];
+    pDstC[3] = pSrcA[3] * pSrcB[0] + pSrcA[4] * pSrcB[3] + pSrcA[5] * pSrcB[6];
+    pDstC[4] = pSrcA[3] * pSrcB[1] + pSrcA[4] * pSrcB[4] + pSrcA[5] * pSrcB[7];
+    pDstC[5] = pSrcA[3] * pSrcB[2] + pSrcA[4] * pSrcB[5] + pSrcA[5] * pSrcB[8];
+    pDstC[6] = pSrcA[6] * pSrcB[0] + pSrcA[7] * pSrcB[3] + pSrcA[8] * pSrcB[6];
+    pDstC[7] = pSrcA[6] * pSrcB[1] + pSrcA[7] * pSrcB[4] + pSrcA[8] * pSrcB[7];
+    pDstC[8] = pSrcA[6] * pSrcB[2] + pSrcA[7] * pSrcB[5] + pSrcA[8] * pSrcB[8];
+}
+
+/**
+  @brief Fully unrolled matrix multiplication of 4x4 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_4x4_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                   const float *__restrict__ pSrcB,
+                                   float *__restrict__ pDstC) {
+
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[4] + pSrcA[2] * pSrcB[8] +
+               pSrcA[3] * pSrcB[12];
+    pDstC[1] = pSrcA[0] * pSrcB[1] + pSrcA[1] * pSrcB[5] + pSrcA[2] * pSrcB[9] +
+               pSrcA[3] * pSrcB[13];
+    pDstC[2] = pSrcA[0] * pSrcB[2] + pSrcA[1] * pSrcB[6] + pSrcA[2] * pSrcB[10] +
+               pSrcA[3] * pSrcB[14];
+    pDstC[3] = pSrcA[0] * pSrcB[3] + pSrcA[1] * pSrcB[7] + pSrcA[2] * pSrcB[11] +
+               pSrcA[3] * pSrcB[15];
+    pDstC[4] = pSrcA[4] * pSrcB[0] + pSrcA[5] * pSrcB[4] + pSrcA[6] * pSrcB[8] +
+               pSrcA[7] * pSrcB[12];
+    pDstC[5] = pSrcA[4] * pSrcB[1] + pSrcA[5] * pSrcB[5] + pSrcA[6] * pSrcB[9] +
+               pSrcA[7] * pSrcB[13];
+    pDstC[6] = pSrcA[4] * pSrcB[2] + pSrcA[5] * pSrcB[6] + pSrcA[6] * pSrcB[10] +
+               pSrcA[7] * pSrcB[14];
+    pDstC[7] = pSrcA[4] * pSrcB[3] + pSrcA[5] * pSrcB[7] + pSrcA[6] * pSrcB[11] +
+               pSrcA[7] * pSrcB[15];
+    pDstC[8] = pSrcA[8] * pSrcB[0] + pSrcA[9] * pSrcB[4] + pSrcA[10] * pSrcB[8] +
+               pSrcA[11] * pSrcB[12];
+    pDstC[9] = pSrcA[8] * pSrcB[1] + pSrcA[9] * pSrcB[5] + pSrcA[10] * pSrcB[9] +
+               pSrcA[11] * pSrcB[13];
+    pDstC[10] = pSrcA[8] * pSrcB[2] + pSrcA[9] * pSrcB[6] + pSrcA[10] * pSrcB[10] +
+                pSrcA[11] * pSrcB[14];
+    pDstC[11] = pSrcA[8] * pSrcB[3] + pSrcA[9] * pSrcB[7] + pSrcA[10] * pSrcB[11] +
+                pSrcA[11] * pSrcB[15];
+    pDstC[12] = pSrcA[12] * pSrcB[0] + pSrcA[13] * pSrcB[4] + pSrcA[14] * pSrcB[8] +
+                pSrcA[15] * pSrcB[12];
+    pDstC[13] = pSrcA[12] * pSrcB[1] + pSrcA[13] * pSrcB[5] + pSrcA[14] * pSrcB[9] +
+                pSrcA[15] * pSrcB[13];
+    pDstC[14] = pSrcA[12] * pSrcB[2] + pSrcA[13] * pSrcB[6] + pSrcA[14] * pSrcB[10] +
+                pSrcA[15] * pSrcB[14];
+    pDstC[15] = pSrcA[12] * pSrcB[3] + pSrcA[13] * pSrcB[7] + pSrcA[14] * pSrcB[11] +
+                pSrcA[15] * pSrcB[15];
+}
+
+/**
+  @brief Fully unrolled matrix multiplication of 6x6 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_6x6_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                   const float *__restrict__ pSrcB,
+                                   float *__restrict__ pDstC) {
+
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[6] + pSrcA[2] * pSrcB[12] +
+               pSrcA[3] * pSrcB[18] + pSrcA[4] * pSrcB[24] + pSrcA[5] * pSrcB[30];
+    pDstC[1] = pSrcA[0] * pSrcB[1] + pSrcA[1] * pSrcB[7] + pSrcA[2] * pSrcB[13] +
+               pSrcA[3] * pSrcB[19] + pSrcA[4] * pSrcB[25] + pSrcA[5] * pSrcB[31];
+    pDstC[2] = pSrcA[0] * pSrcB[2] + pSrcA[1] * pSrcB[8] + pSrcA[2] * pSrcB[14] +
+               pSrcA[3] * pSrcB[20] + pSrcA[4] * pSrcB[26] + pSrcA[5] * pSrcB[32];
+    pDstC[3] = pSrcA[0] * pSrcB[3] + pSrcA[1] * pSrcB[9] + pSrcA[2] * pSrcB[15] +
+               pSrcA[3] * pSrcB[21] + pSrcA[4] * pSrcB[27] + pSrcA[5] * pSrcB[33];
+    pDstC[4] = pSrcA[0] * pSrcB[4] + pSrcA[1] * pSrcB[10] + pSrcA[2] * pSrcB[16] +
+               pSrcA[3] * pSrcB[22] + pSrcA[4] * pSrcB[28] + pSrcA[5] * pSrcB[34];
+    pDstC[5] = pSrcA[0] * pSrcB[5] + pSrcA[1] * pSrcB[11] + pSrcA[2] * pSrcB[17] +
+               pSrcA[3] * pSrcB[23] + pSrcA[4] * pSrcB[29] + pSrcA[5] * pSrcB[35];
+    pDstC[6] = pSrcA[6] * pSrcB[0] + pSrcA[7] * pSrcB[6] + pSrcA[8] * pSrcB[12] +
+               pSrcA[9] * pSrcB[18] + pSrcA[10] * pSrcB[24] + pSrcA[11] * pSrcB[30];
+    pDstC[7] = pSrcA[6] * pSrcB[1] + pSrcA[7] * pSrcB[7] + pSrcA[8] * pSrcB[13] +
+               pSrcA[9] * pSrcB[19] + pSrcA[10] * pSrcB[25] + pSrcA[11] * pSrcB[31];
+    pDstC[8] = pSrcA[6] * pSrcB[2] + pSrcA[7] * pSrcB[8] + pSrcA[8] * pSrcB[14] +
+               pSrcA[9] * pSrcB[20] + pSrcA[10] * pSrcB[26] + pSrcA[11] * pSrcB[32];
+    pDstC[9] = pSrcA[6] * pSrcB[3] + pSrcA[7] * pSrcB[9] + pSrcA[8] * pSrcB[15] +
+               pSrcA[9] * pSrcB[21] + pSrcA[10] * pSrcB[27] + pSrcA[11] * pSrcB[33];
+    pDstC[10] = pSrcA[6] * pSrcB[4] + pSrcA[7] * pSrcB[10] + pSrcA[8] * pSrcB[16] +
+                pSrcA[9] * pSrcB[22] + pSrcA[10] * pSrcB[28] + pSrcA[11] * pSrcB[34];
+    pDstC[11] = pSrcA[6] * pSrcB[5] + pSrcA[7] * pSrcB[11] + pSrcA[8] * pSrcB[17] +
+                pSrcA[9] * pSrcB[23] + pSrcA[10] * pSrcB[29] + pSrcA[11] * pSrcB[35];
+    pDstC[12] = pSrcA[12] * pSrcB[0] + pSrcA[13] * pSrcB[6] + pSrcA[14] * pSrcB[12] +
+                pSrcA[15] * pSrcB[18] + pSrcA[16] * pSrcB[24] + pSrcA[17] * pSrcB[30];
+    pDstC[13] = pSrcA[12] * pSrcB[1] + pSrcA[13] * pSrcB[7] + pSrcA[14] * pSrcB[13] +
+                pSrcA[15] * pSrcB[19] + pSrcA[16] * pSrcB[25] + pSrcA[17] * pSrcB[31];
+    pDstC[14] = pSrcA[12] * pSrcB[2] + pSrcA[13] * pSrcB[8] + pSrcA[14] * pSrcB[14] +
+                pSrcA[15] * pSrcB[20] + pSrcA[16] * pSrcB[26] + pSrcA[17] * pSrcB[32];
+    pDstC[15] = pSrcA[12] * pSrcB[3] + pSrcA[13] * pSrcB[9] + pSrcA[14] * pSrcB[15] +
+                pSrcA[15] * pSrcB[21] + pSrcA[16] * pSrcB[27] + pSrcA[17] * pSrcB[33];
+    pDstC[16] = pSrcA[12] * pSrcB[4] + pSrcA[13] * pSrcB[10] + pSrcA[14] * pSrcB[16] +
+                pSrcA[15] * pSrcB[22] + pSrcA[16] * pSrcB[28] + pSrcA[17] * pSrcB[34];
+    pDstC[17] = pSrcA[12] * pSrcB[5] + pSrcA[13] * pSrcB[11] + pSrcA[14] * pSrcB[17] +
+                pSrcA[15] * pSrcB[23] + pSrcA[16] * pSrcB[29] + pSrcA[17] * pSrcB[35];
+    pDstC[18] = pSrcA[18] * pSrcB[0] + pSrcA[19] * pSrcB[6] + pSrcA[20] * pSrcB[12] +
+                pSrcA[21] * pSrcB[18] + pSrcA[22] * pSrcB[24] + pSrcA[23] * pSrcB[30];
+    pDstC[19] = pSrcA[18] * pSrcB[1] + pSrcA[19] * pSrcB[7] + pSrcA[20] * pSrcB[13] +
+                pSrcA[21] * pSrcB[19] + pSrcA[22] * pSrcB[25] + pSrcA[23] * pSrcB[31];
+    pDstC[20] = pSrcA[18] * pSrcB[2] + pSrcA[19] * pSrcB[8] + pSrcA[20] * pSrcB[14] +
+                pSrcA[21] * pSrcB[20] + pSrcA[22] * pSrcB[26] + pSrcA[23] * pSrcB[32];
+    pDstC[21] = pSrcA[18] * pSrcB[3] + pSrcA[19] * pSrcB[9] + pSrcA[20] * pSrcB[15] +
+                pSrcA[21] * pSrcB[21] + pSrcA[22] * pSrcB[27] + pSrcA[23] * pSrcB[33];
+    pDstC[22] = pSrcA[18] * pSrcB[4] + pSrcA[19] * pSrcB[10] + pSrcA[20] * pSrcB[16] +
+                pSrcA[21] * pSrcB[22] + pSrcA[22] * pSrcB[28] + pSrcA[23] * pSrcB[34];
+    pDstC[23] = pSrcA[18] * pSrcB[5] + pSrcA[19] * pSrcB[11] + pSrcA[20] * pSrcB[17] +
+                pSrcA[21] * pSrcB[23] + pSrcA[22] * pSrcB[29] + pSrcA[23] * pSrcB[35];
+    pDstC[24] = pSrcA[24] * pSrcB[0] + pSrcA[25] * pSrcB[6] + pSrcA[26] * pSrcB[12] +
+                pSrcA[27] * pSrcB[18] + pSrcA[28] * pSrcB[24] + pSrcA[29] * pSrcB[30];
+    pDstC[25] = pSrcA[24] * pSrcB[1] + pSrcA[25] * pSrcB[7] + pSrcA[26] * pSrcB[13] +
+                pSrcA[27] * pSrcB[19] + pSrcA[28] * pSrcB[25] + pSrcA[29] * pSrcB[31];
+    pDstC[26] = pSrcA[24] * pSrcB[2] + pSrcA[25] * pSrcB[8] + pSrcA[26] * pSrcB[14] +
+                pSrcA[27] * pSrcB[20] + pSrcA[28] * pSrcB[26] + pSrcA[29] * pSrcB[32];
+    pDstC[27] = pSrcA[24] * pSrcB[3] + pSrcA[25] * pSrcB[9] + pSrcA[26] * pSrcB[15] +
+                pSrcA[27] * pSrcB[21] + pSrcA[28] * pSrcB[27] + pSrcA[29] * pSrcB[33];
+    pDstC[28] = pSrcA[24] * pSrcB[4] + pSrcA[25] * pSrcB[10] + pSrcA[26] * pSrcB[16] +
+                pSrcA[27] * pSrcB[22] + pSrcA[28] * pSrcB[28] + pSrcA[29] * pSrcB[34];
+    pDstC[29] = pSrcA[24] * pSrcB[5] + pSrcA[25] * pSrcB[11] + pSrcA[26] * pSrcB[17] +
+                pSrcA[27] * pSrcB[23] + pSrcA[28] * pSrcB[29] + pSrcA[29] * pSrcB[35];
+    pDstC[30] = pSrcA[30] * pSrcB[0] + pSrcA[31] * pSrcB[6] + pSrcA[32] * pSrcB[12] +
+                pSrcA[33] * pSrcB[18] + pSrcA[34] * pSrcB[24] + pSrcA[35] * pSrcB[30];
+    pDstC[31] = pSrcA[30] * pSrcB[1] + pSrcA[31] * pSrcB[7] + pSrcA[32] * pSrcB[13] +
+                pSrcA[33] * pSrcB[19] + pSrcA[34] * pSrcB[25] + pSrcA[35] * pSrcB[31];
+    pDstC[32] = pSrcA[30] * pSrcB[2] + pSrcA[31] * pSrcB[8] + pSrcA[32] * pSrcB[14] +
+                pSrcA[33] * pSrcB[20] + pSrcA[34] * pSrcB[26] + pSrcA[35] * pSrcB[32];
+    pDstC[33] = pSrcA[30] * pSrcB[3] + pSrcA[31] * pSrcB[9] + pSrcA[32] * pSrcB[15] +
+                pSrcA[33] * pSrcB[21] + pSrcA[34] * pSrcB[27] + pSrcA[35] * pSrcB[33];
+    pDstC[34] = pSrcA[30] * pSrcB[4] + pSrcA[31] * pSrcB[10] + pSrcA[32] * pSrcB[16] +
+                pSrcA[33] * pSrcB[22] + pSrcA[34] * pSrcB[28] + pSrcA[35] * pSrcB[34];
+    pDstC[35] = pSrcA[30] * pSrcB[5] + pSrcA[31] * pSrcB[11] + pSrcA[32] * pSrcB[17] +
+                pSrcA[33] * pSrcB[23] + pSrcA[34] * pSrcB[29] + pSrcA[35] * pSrcB[35];
+}
+
+/**
+   @} end of BasicMatMultKernels group
+*/
@@ -0,0 +1,118 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_splitk_f32p_xpulpv2.c
+ * Description:  parallel split-K 32-bit floating-point matrix multiplication for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicMatMult
+ */
+
+/**
+  @addtogroup BasicMatMultKernels
+  @{
+ */
+
+/**
+   @brief Parallel split-K matrix multiplication of 32-bit floating-point matrices kernel for
+          XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_splitk_instance_f32 struct initialized by
+                     plp_mat_mult_f32_parallel
+   @return     none
+
+   @par Split-K
+   Every core computes the product of a slice of the columns of A with the same slice of the rows
+   of B, using plp_mat_mult_stride_f32s_xpulpv2. Core 0 writes its partial result directly to C,
+   all others to their part of pPartial. The partial results are then summed up in a tree of
+   log2(nPE) levels. In each level, all cores share the additions, such that the elements of every
+   pair of partial results are split among nPE / pairs cores.
+*/
+
+void plp_mat_mult_splitk_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_mult_splitk_instance_f32 *a = (plp_mat_mult_splitk_instance_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstC = a->pDstC;
+    float *__restrict__ pPartial = a->pPartial;
+
+    uint32_t len = M * O; // number of elements of every partial result
+    uint32_t step;        // distance between the two partial results of each addition
+    uint32_t i;           // loop counter
+
+    // slice of the inner dimension of this core
+    uint32_t nStep = (N + nPE - 1) / nPE;
+    uint32_t nStart = (core_id * nStep > N) ? N : core_id * nStep;
+    uint32_t nEnd = (nStart + nStep > N) ? N : nStart + nStep;
+
+    float *pOwn = (core_id == 0) ? pDstC : pPartial + (core_id - 1) * len;
+
+    plp_mat_mult_stride_f32s_xpulpv2(pSrcA + nStart,
+                                     pSrcB + nStart * O,
+                                     M,
+                                     nEnd - nStart,
+                                     O,
+                                     N,
+                                     O,
+                                     O,
+                                     pOwn);
+
+    for (step = 1; step < nPE; step *= 2) {
+
+        // partial result p is added to partial result p - step, for every p = step + k * 2 * step
+        uint32_t numPairs = (nPE - step - 1) / (2 * step) + 1;
+        uint32_t coresPerPair = nPE / numPairs;
+        uint32_t pair = core_id / coresPerPair;
+
+        rt_team_barrier();
+
+        if (pair < numPairs) {
+            uint32_t dst = pair * 2 * step;
+            float *pDst = (dst == 0) ? pDstC : pPartial + (dst - 1) * len;
+            const float *pSrc = pPartial + (dst + step - 1) * len;
+
+            uint32_t shardLen = (len + coresPerPair - 1) / coresPerPair;
+            uint32_t start = (core_id % coresPerPair) * shardLen;
+            uint32_t end = (start + shardLen > len) ? len : start + shardLen;
+
+            for (i = start; i < end; i++) {
+                pDst[i] += pSrc[i];
+            }
+        }
+    }
+}
+
+/**
+   @} end of BasicMatMultKernels group
+*/
@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_batched_f32_parallel.c
+ * Description:  parallel batched 32-bit floating-point matrix multiplication glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMult
+  @{
+ */
+
+/**
+  @brief Glue code for parallel batched matrix multiplication of 32-bit floating-point matrices.
+  @param[in]  pSrcA Array of batch pointers to the first input matrices of shape MxN
+  @param[in]  pSrcB Array of batch pointers to the second input matrices of shape NxO
+  @param[in]  M     Height of all first input matrices
+  @param[in]  N     Width of all first input matrices and height of all second input matrices
+  @param[in]  O     Width of all second input matrices
+  @param[in]  batch Number of independent matrix multiplications
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Array of batch pointers to the output matrices of shape MxO
+  @return     none
+
+  @par Batching
+  All batch multiplications are computed in a single rt_team_fork, and every core computes whole
+  matrix products on its own. Hence, the fork and barrier overhead is paid only once, and there is
+  no synchronization between the cores, which makes this function well suited for many small
+  matrices. If batch is smaller than nPE, some cores are idle, and plp_mat_mult_f32_parallel
+  should be used on every matrix instead.
+
+  @par This function will use plp_mat_mult_batched_f32p_xpulpv2 for its computation.
+ */
+
+void plp_mat_mult_batched_f32_parallel(const float *const *pSrcA,
+                                       const float *const *pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       uint32_t batch,
+                                       uint32_t nPE,
+                                       float *const *pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_batched_instance_f32 args = { .pSrcA = pSrcA,
+                                                   .pSrcB = pSrcB,
+                                                   .M = M,
+                                                   .N = N,
+                                                   .O = O,
+                                                   .batch = batch,
+                                                   .nPE = nPE,
+                                                   .pDstC = pDstC };
+
+        rt_team_fork(nPE, plp_mat_mult_batched_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of BasicMatMult group
+ */
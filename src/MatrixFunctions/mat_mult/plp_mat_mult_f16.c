@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_f16.c
+ * Description:  Half-precision float matrix multiplication glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMult
+  @{
+ */
+
+/**
+  @brief Glue code for matrix mutliplication of half-precision float matrices.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par Half Precision
+  With PLP_MATH_SMALLFLOAT, two elements of C are computed at once with the packed
+  half-precision SIMD instructions if O is even, and B and C must be aligned to 32 bits. Otherwise,
+  the elements are converted to single precision.
+ */
+
+void plp_mat_mult_f16(const float16_t *__restrict__ pSrcA,
+                      const float16_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      float16_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_f16s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
+    }
+}
+
+/**
+  @} end of BasicMatMult group
+ */
@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_f16_parallel.c
+ * Description:  Parallel half-precision float matrix multiplication glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMult
+  @{
+ */
+
+/**
+  @brief Glue code for parallel matrix mutliplication of half-precision float matrices.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par Work Distribution
+  The rows of C are distributed over the cores in an interleaved way, and every core computes two
+  elements of a row at once as in plp_mat_mult_f16.
+ */
+
+void plp_mat_mult_f16_parallel(const float16_t *__restrict__ pSrcA,
+                               const float16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               float16_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_instance_f16 args = {
+            .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC
+        };
+        rt_team_fork(nPE, plp_mat_mult_f16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of BasicMatMult group
+ */
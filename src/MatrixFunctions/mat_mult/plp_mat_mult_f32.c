@@ -48,6 +48,16 @@
   @param[in]  O         width of the second input matrix
   @param[out] pDstC     points to the output matrix
   @return     none
+
+  @par Small Matrices
+  Square matrices of size 2x2, 3x3, 4x4 and 6x6 are computed with the fully unrolled kernels
+  plp_mat_mult_NxN_f32s_xpulpv2, which avoid the loop overhead. All other matrices are computed with
+  the strided kernel plp_mat_mult_stride_f32s_xpulpv2, with the stride of every matrix set to its
+  width.
+
+  @par Matrix Vector Multiplication
+  If B has a single column (O == 1), the matrix vector multiplication kernel
+  plp_mat_vec_mult_f32s_xpulpv2 is used instead.
  */
 
 void plp_mat_mult_f32(const float *__restrict__ pSrcA,
@@ -57,11 +67,35 @@ void plp_mat_mult_f32(const float *__restrict__ pSrcA,
                       uint32_t O,
                       float *__restrict__ pDstC) {
 
+    PLP_PROFILE_SHAPE(M, N, O);
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
         return;
     } else {
-        plp_mat_mult_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
+        if (O == 1) {
+            plp_mat_vec_mult_f32s_xpulpv2(pSrcA, pSrcB, M, N, pDstC);
+            return;
+        }
+        if (M == N && N == O) {
+            switch (N) {
+            case 2:
+                plp_mat_mult_2x2_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            case 3:
+                plp_mat_mult_3x3_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            case 4:
+                plp_mat_mult_4x4_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            case 6:
+                plp_mat_mult_6x6_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            default:
+                break;
+            }
+        }
+        plp_mat_mult_stride_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, N, O, O, pDstC);
     }
 }
 
@@ -49,6 +49,28 @@
   @param[in]  nPE       Number of cores to use
   @param[out] pDstC     points to the output matrix
   @return     none
+
+  @par Small Matrices
+  Square matrices of size 2x2, 3x3, 4x4 and 6x6 are computed on the calling core with the fully
+  unrolled kernels plp_mat_mult_NxN_f32s_xpulpv2, because forking the team takes longer than the
+  computation itself. All other matrices are computed with the strided kernel
+  plp_mat_mult_stride_f32p_xpulpv2, with the stride of every matrix set to its width.
+
+  @par Split-K
+  If C has less than PLP_MAT_MULT_SPLITK_MAX_OUTPUT elements per core, and the inner dimension
+  has at least PLP_MAT_MULT_SPLITK_MIN_DEPTH elements per core, plp_mat_mult_splitk_f32p_xpulpv2
+  is used. Every core multiplies a slice of the inner dimension into a private partial result in
+  L1, and the partial results are summed up in a tree reduction.
+
+  @par Matrix Vector Multiplication
+  If B has a single column (O == 1), the rows of A are distributed among the cores in chunks
+  of four, and plp_mat_vec_mult_f32p_xpulpv2 is used. Split-K takes precedence
+  over this.
+
+  @par Bounded Latency
+  If the library is built with PLP_MATH_BOUNDED_LATENCY, split-K is disabled. Then, no scratch
+  buffer is allocated, and the kernel is chosen by the shape alone: the small square kernels, then
+  plp_mat_vec_mult_f32p_xpulpv2 if O == 1, and plp_mat_mult_stride_f32p_xpulpv2 otherwise.
  */
 
 void plp_mat_mult_f32_parallel(const float *__restrict__ pSrcA,
@@ -59,14 +81,77 @@ void plp_mat_mult_f32_parallel(const float *__restrict__ pSrcA,
                                uint32_t nPE,
                                float *__restrict__ pDstC) {
 
+    PLP_PROFILE_SHAPE(M, N, O);
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel and floating-point processing supported only for cluster side\n");
         return;
     } else {
-        plp_mat_mult_instance_f32 args = {
-            .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC
-        };
-        rt_team_fork(nPE, plp_mat_mult_f32p_xpulpv2, (void *)&args);
+        if (M == N && N == O) {
+            switch (N) {
+            case 2:
+                plp_mat_mult_2x2_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            case 3:
+                plp_mat_mult_3x3_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            case 4:
+                plp_mat_mult_4x4_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            case 6:
+                plp_mat_mult_6x6_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            default:
+                break;
+            }
+        }
+
+#ifndef PLP_MATH_BOUNDED_LATENCY
+        // split the inner dimension, if C is too small to keep all cores busy
+        if (nPE > 1 && M * O < PLP_MAT_MULT_SPLITK_MAX_OUTPUT * nPE &&
+            N >= PLP_MAT_MULT_SPLITK_MIN_DEPTH * nPE) {
+            uint32_t partialSize = sizeof(float) * M * O * (nPE - 1);
+            float *pPartial = (float *)plp_scratch_alloc(partialSize);
+
+            if (pPartial != NULL) {
+                plp_mat_mult_splitk_instance_f32 args = { .pSrcA = pSrcA,
+                                                          .pSrcB = pSrcB,
+                                                          .M = M,
+                                                          .N = N,
+                                                          .O = O,
+                                                          .nPE = nPE,
+                                                          .pDstC = pDstC,
+                                                          .pPartial = pPartial };
+                rt_team_fork(nPE, plp_mat_mult_splitk_f32p_xpulpv2, (void *)&args);
+                plp_scratch_free(pPartial, partialSize);
+                return;
+            }
+        }
+#endif
+
+        // multiply with a single column vector
+        if (O == 1) {
+            plp_mat_vec_mult_instance_f32 args = { .pSrcA = pSrcA,
+                                                   .pSrcX = pSrcB,
+                                                   .M = M,
+                                                   .N = N,
+                                                   .nPE = nPE,
+                                                   .pDstY = pDstC };
+            rt_team_fork(nPE, plp_mat_vec_mult_f32p_xpulpv2, (void *)&args);
+            return;
+        }
+
+        plp_mat_mult_stride_instance_f32 args = { .pSrcA = pSrcA,
+                                                  .pSrcB = pSrcB,
+                                                  .M = M,
+                                                  .N = N,
+                                                  .O = O,
+                                                  .strideA = N,
+                                                  .strideB = O,
+                                                  .strideC = O,
+                                                  .nPE = nPE,
+                                                  .pDstC = pDstC };
+        rt_team_fork(nPE, plp_mat_mult_stride_f32p_xpulpv2, (void *)&args);
     }
 }
 
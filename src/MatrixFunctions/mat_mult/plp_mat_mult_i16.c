@@ -48,6 +48,13 @@
   @param[in]  O         width of the second input matrix
   @param[out] pDstC     points to the output matrix
   @return     none
+
+  @par On the cluster, the strided kernel plp_mat_mult_stride_i16s_xpulpv2 is used, with the stride
+  of every matrix set to its width.
+
+  @par Matrix Vector Multiplication
+  If B has a single column (O == 1), the matrix vector multiplication kernel
+  plp_mat_vec_mult_i16s_rv32im (FC) or plp_mat_vec_mult_i16s_xpulpv2 (cluster) is used instead.
  */
 
 void plp_mat_mult_i16(const int16_t *__restrict__ pSrcA,
@@ -57,10 +64,20 @@ void plp_mat_mult_i16(const int16_t *__restrict__ pSrcA,
                       uint32_t O,
                       int32_t *__restrict__ pDstC) {
 
+    PLP_PROFILE_SHAPE(M, N, O);
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
+        if (O == 1) {
+            plp_mat_vec_mult_i16s_rv32im(pSrcA, pSrcB, M, N, pDstC);
+            return;
+        }
         plp_mat_mult_i16s_rv32im(pSrcA, pSrcB, M, N, O, pDstC);
     } else {
-        plp_mat_mult_i16s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
+        if (O == 1) {
+            plp_mat_vec_mult_i16s_xpulpv2(pSrcA, pSrcB, M, N, pDstC);
+            return;
+        }
+        plp_mat_mult_stride_i16s_xpulpv2(pSrcA, pSrcB, M, N, O, N, O, O, pDstC);
     }
 }
 
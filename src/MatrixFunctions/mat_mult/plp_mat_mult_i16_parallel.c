@@ -49,6 +49,28 @@
   @param[in]  nPE        Number of cores to use
   @param[out] pDstC     points to the output matrix
   @return     none
+
+  @par Blocking
+  If the matrices are large enough, plp_mat_mult_blocked_i16p_xpulpv2 is used. It packs panels of
+  B (of at most PLP_MAT_MULT_BLOCKED_PANEL_SIZE bytes) transposed into a temporary L1 buffer.
+  Otherwise, or if the buffer cannot be allocated, the strided kernel
+  plp_mat_mult_stride_i16p_xpulpv2 is used, with the stride of every matrix set to its width.
+
+  @par Split-K
+  If C has less than PLP_MAT_MULT_SPLITK_MAX_OUTPUT elements per core, and the inner dimension
+  has at least PLP_MAT_MULT_SPLITK_MIN_DEPTH elements per core, plp_mat_mult_splitk_i16p_xpulpv2
+  is used. Every core multiplies a slice of the inner dimension into a private partial result in
+  L1, and the partial results are summed up in a tree reduction.
+
+  @par Matrix Vector Multiplication
+  If B has a single column (O == 1), the rows of A are distributed among the cores in chunks
+  of four, and plp_mat_vec_mult_i16p_xpulpv2 is used. Split-K takes precedence
+  over this.
+
+  @par Bounded Latency
+  If the library is built with PLP_MATH_BOUNDED_LATENCY, split-K and blocking are disabled. Then, no
+  scratch buffer is allocated, and the kernel is chosen by the shape alone:
+  plp_mat_vec_mult_i16p_xpulpv2 if O == 1, and plp_mat_mult_stride_i16p_xpulpv2 otherwise.
  */
 
 void plp_mat_mult_i16_parallel(const int16_t *__restrict__ pSrcA,
@@ -59,14 +81,91 @@ void plp_mat_mult_i16_parallel(const int16_t *__restrict__ pSrcA,
                                uint32_t nPE,
                                int32_t *__restrict__ pDstC) {
 
+    PLP_PROFILE_SHAPE(M, N, O);
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
-        plp_mat_mult_instance_i16 args = {
-            .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC
-        };
-        rt_team_fork(nPE, plp_mat_mult_i16p_xpulpv2, (void *)&args);
+
+#ifndef PLP_MATH_BOUNDED_LATENCY
+        // split the inner dimension, if C is too small to keep all cores busy
+        if (nPE > 1 && M * O < PLP_MAT_MULT_SPLITK_MAX_OUTPUT * nPE &&
+            N >= PLP_MAT_MULT_SPLITK_MIN_DEPTH * nPE) {
+            uint32_t partialSize = sizeof(int32_t) * M * O * (nPE - 1);
+            int32_t *pPartial = (int32_t *)plp_scratch_alloc(partialSize);
+
+            if (pPartial != NULL) {
+                plp_mat_mult_splitk_instance_i16 args = { .pSrcA = pSrcA,
+                                                          .pSrcB = pSrcB,
+                                                          .M = M,
+                                                          .N = N,
+                                                          .O = O,
+                                                          .nPE = nPE,
+                                                          .pDstC = pDstC,
+                                                          .pPartial = pPartial };
+                rt_team_fork(nPE, plp_mat_mult_splitk_i16p_xpulpv2, (void *)&args);
+                plp_scratch_free(pPartial, partialSize);
+                return;
+            }
+        }
+#endif
+
+        // multiply with a single column vector
+        if (O == 1) {
+            plp_mat_vec_mult_instance_i16 args = { .pSrcA = pSrcA,
+                                                   .pSrcX = pSrcB,
+                                                   .M = M,
+                                                   .N = N,
+                                                   .nPE = nPE,
+                                                   .pDstY = pDstC };
+            rt_team_fork(nPE, plp_mat_vec_mult_i16p_xpulpv2, (void *)&args);
+            return;
+        }
+
+#ifndef PLP_MATH_BOUNDED_LATENCY
+        // use the blocked kernel, if B can be packed into L1 and enough rows share each panel
+        if (M >= 4 && N >= 4 && O >= 2) {
+            uint32_t NPad = (N + 1) & ~1;
+            uint32_t panelWidth =
+                (PLP_MAT_MULT_BLOCKED_PANEL_SIZE / (sizeof(int16_t) * NPad)) & ~1;
+            if (panelWidth < 2) {
+                panelWidth = 2;
+            }
+            if (panelWidth > O) {
+                panelWidth = O;
+            }
+            uint32_t panelSize = sizeof(int16_t) * NPad * panelWidth;
+            int16_t *pPanel = (int16_t *)plp_scratch_alloc(panelSize);
+
+            if (pPanel != NULL) {
+                plp_mat_mult_blocked_instance_i16 args = { .pSrcA = pSrcA,
+                                                         .pSrcB = pSrcB,
+                                                         .M = M,
+                                                         .N = N,
+                                                         .O = O,
+                                                         .nPE = nPE,
+                                                         .pDstC = pDstC,
+                                                         .pPanel = pPanel,
+                                                         .panelWidth = panelWidth };
+                rt_team_fork(nPE, plp_mat_mult_blocked_i16p_xpulpv2, (void *)&args);
+                plp_scratch_free(pPanel, panelSize);
+                return;
+            }
+        }
+#endif
+
+        plp_mat_mult_stride_instance_i16 args = { .pSrcA = pSrcA,
+                                                  .pSrcB = pSrcB,
+                                                  .M = M,
+                                                  .N = N,
+                                                  .O = O,
+                                                  .strideA = N,
+                                                  .strideB = O,
+                                                  .strideC = O,
+                                                  .nPE = nPE,
+                                                  .pDstC = pDstC };
+        rt_team_fork(nPE, plp_mat_mult_stride_i16p_xpulpv2, (void *)&args);
     }
 }
 
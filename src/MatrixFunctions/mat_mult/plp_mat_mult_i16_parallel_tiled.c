@@ -0,0 +1,211 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i16_parallel_tiled.c
+ * Description:  parallel 16-bit integer matrix multiplication of L2 matrices with DMA tiling
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMult
+  @{
+ */
+
+/**
+  @brief Glue code for parallel matrix multiplication of 16-bit integer matrices, which are
+  stored in L2 memory.
+  @param[in]  pSrcA     points to the first input matrix (in L2)
+  @param[in]  pSrcB     points to the second input matrix (in L2)
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDstC     points to the output matrix (in L2)
+  @return     none
+
+  @par Tiling
+  The output is computed in tiles of at most PLP_MAT_MULT_TILED_MAX_TILE x
+  PLP_MAT_MULT_TILED_MAX_TILE elements, such that all buffers fit into
+  PLP_MAT_MULT_TILED_L1_SIZE bytes of L1 memory. The tiles of A (full rows) and B (full columns)
+  are streamed into ping-pong buffers with the cluster DMA, while the cores compute the previous
+  tile with plp_mat_mult_blocked_i16p_xpulpv2. The tiles of C are written back asynchronously,
+  as well. The tiles are traversed column by column, such that each tile of B is only loaded
+  once.
+ */
+
+void plp_mat_mult_i16_parallel_tiled(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    // packed columns of B are padded to keep them word aligned
+    uint32_t NPad = (N + 1) & ~1;
+
+    // find the largest tiles, for which all buffers fit into the L1 budget
+    uint32_t tileM = (M < PLP_MAT_MULT_TILED_MAX_TILE) ? M : PLP_MAT_MULT_TILED_MAX_TILE;
+    uint32_t tileO = (O < PLP_MAT_MULT_TILED_MAX_TILE) ? O : PLP_MAT_MULT_TILED_MAX_TILE;
+    uint32_t sizeA, sizeB, sizeC, sizePanel;
+
+    while (1) {
+        sizeA = sizeof(int16_t) * tileM * N;
+        sizeB = sizeof(int16_t) * N * tileO;
+        sizeC = sizeof(int32_t) * tileM * tileO;
+        sizePanel = sizeof(int16_t) * NPad * tileO;
+        if (2 * (sizeA + sizeB + sizeC) + sizePanel <= PLP_MAT_MULT_TILED_L1_SIZE) {
+            break;
+        }
+        if (tileM >= tileO && tileM > 1) {
+            tileM = (tileM + 1) / 2;
+        } else if (tileO > 1) {
+            tileO = (tileO + 1) / 2;
+        } else {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+    }
+
+    uint32_t bufferSize = 2 * (((sizeA + 3) & ~3) + ((sizeB + 3) & ~3) + sizeC) + sizePanel;
+    int16_t *pBuffer = (int16_t *)plp_scratch_alloc(bufferSize);
+
+    if (pBuffer == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+
+    // split the buffer, keeping every part word aligned
+    uint32_t strideA = (sizeA + 3) & ~3;
+    uint32_t strideB = (sizeB + 3) & ~3;
+    uint8_t *pCursor = (uint8_t *)pBuffer;
+    int16_t *pLocA[2] = { (int16_t *)pCursor, (int16_t *)(pCursor + strideA) };
+    pCursor += 2 * strideA;
+    int16_t *pLocB[2] = { (int16_t *)pCursor, (int16_t *)(pCursor + strideB) };
+    pCursor += 2 * strideB;
+    int32_t *pLocC[2] = { (int32_t *)pCursor, (int32_t *)(pCursor + sizeC) };
+    pCursor += 2 * sizeC;
+    int16_t *pPanel = (int16_t *)pCursor;
+
+    uint32_t nTilesM = (M + tileM - 1) / tileM;
+    uint32_t nTilesO = (O + tileO - 1) / tileO;
+    uint32_t nTiles = nTilesM * nTilesO;
+
+    rt_dma_copy_t copyIn;
+    rt_dma_copy_t copyOut[2];
+
+    uint32_t curA = 0; // buffer holding the current tile of A
+    uint32_t curB = 0; // buffer holding the current tile of B
+
+    // fetch the first tiles
+    uint32_t h = (M < tileM) ? M : tileM;
+    uint32_t w = (O < tileO) ? O : tileO;
+    rt_dma_memcpy((unsigned int)pSrcA, (unsigned int)pLocA[0], sizeof(int16_t) * h * N,
+                  RT_DMA_DIR_EXT2LOC, 0, &copyIn);
+    rt_dma_memcpy_2d((unsigned int)pSrcB, (unsigned int)pLocB[0], sizeof(int16_t) * N * w,
+                     sizeof(int16_t) * O, sizeof(int16_t) * w, RT_DMA_DIR_EXT2LOC, 1, &copyIn);
+
+    for (uint32_t s = 0; s < nTiles; s++) {
+
+        uint32_t rowTile = s % nTilesM;
+        uint32_t colTile = s / nTilesM;
+        uint32_t row = rowTile * tileM;
+        uint32_t col = colTile * tileO;
+        h = (M - row < tileM) ? M - row : tileM;
+        w = (O - col < tileO) ? O - col : tileO;
+
+        // wait until the inputs of this tile have arrived
+        rt_dma_wait(&copyIn);
+
+        // prefetch the inputs of the next tile, while this one is computed
+        uint32_t nextA = curA;
+        uint32_t nextB = curB;
+        if (s + 1 < nTiles) {
+            uint32_t nextRow = ((s + 1) % nTilesM) * tileM;
+            uint32_t nextCol = ((s + 1) / nTilesM) * tileO;
+            uint32_t nextH = (M - nextRow < tileM) ? M - nextRow : tileM;
+            uint32_t nextW = (O - nextCol < tileO) ? O - nextCol : tileO;
+            int merge = 0;
+
+            if (nTilesM > 1) {
+                nextA = 1 - curA;
+                rt_dma_memcpy((unsigned int)(pSrcA + nextRow * N), (unsigned int)pLocA[nextA],
+                              sizeof(int16_t) * nextH * N, RT_DMA_DIR_EXT2LOC, merge, &copyIn);
+                merge = 1;
+            }
+            if (nextCol != col) {
+                nextB = 1 - curB;
+                rt_dma_memcpy_2d((unsigned int)(pSrcB + nextCol), (unsigned int)pLocB[nextB],
+                                 sizeof(int16_t) * N * nextW, sizeof(int16_t) * O,
+                                 sizeof(int16_t) * nextW, RT_DMA_DIR_EXT2LOC, merge, &copyIn);
+            }
+        }
+
+        // make sure that the previous write-back from this output buffer has finished
+        if (s >= 2) {
+            rt_dma_wait(&copyOut[s & 1]);
+        }
+
+        plp_mat_mult_blocked_instance_i16 args = { .pSrcA = pLocA[curA],
+                                                 .pSrcB = pLocB[curB],
+                                                 .M = h,
+                                                 .N = N,
+                                                 .O = w,
+                                                 .nPE = nPE,
+                                                 .pDstC = pLocC[s & 1],
+                                                 .pPanel = pPanel,
+                                                 .panelWidth = w };
+        rt_team_fork(nPE, plp_mat_mult_blocked_i16p_xpulpv2, (void *)&args);
+
+        // write back the output tile
+        rt_dma_memcpy_2d((unsigned int)(pDstC + row * O + col), (unsigned int)pLocC[s & 1],
+                         sizeof(int32_t) * h * w, sizeof(int32_t) * O, sizeof(int32_t) * w,
+                         RT_DMA_DIR_LOC2EXT, 0, &copyOut[s & 1]);
+
+        curA = nextA;
+        curB = nextB;
+    }
+
+    // wait for the last write-backs
+    if (nTiles >= 2) {
+        rt_dma_wait(&copyOut[nTiles & 1]);
+    }
+    rt_dma_wait(&copyOut[(nTiles - 1) & 1]);
+
+    plp_scratch_free(pBuffer, bufferSize);
+}
+
+/**
+  @} end of BasicMatMult group
+ */
@@ -75,6 +75,10 @@
   @param[in]  O         width of the second input matrix
   @param[out] pDstC     points to the output matrix
   @return     none
+
+  @par Matrix Vector Multiplication
+  If B has a single column (O == 1), the matrix vector multiplication kernel
+  plp_mat_vec_mult_i32s_rv32im (FC) or plp_mat_vec_mult_i32s_xpulpv2 (cluster) is used instead.
  */
 
 void plp_mat_mult_i32(const int32_t *__restrict__ pSrcA,
@@ -84,9 +88,19 @@ void plp_mat_mult_i32(const int32_t *__restrict__ pSrcA,
                       uint32_t O,
                       int32_t *__restrict__ pDstC) {
 
+    PLP_PROFILE_SHAPE(M, N, O);
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
+        if (O == 1) {
+            plp_mat_vec_mult_i32s_rv32im(pSrcA, pSrcB, M, N, pDstC);
+            return;
+        }
         plp_mat_mult_i32s_rv32im(pSrcA, pSrcB, M, N, O, pDstC);
     } else {
+        if (O == 1) {
+            plp_mat_vec_mult_i32s_xpulpv2(pSrcA, pSrcB, M, N, pDstC);
+            return;
+        }
         plp_mat_mult_i32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
     }
 }
@@ -49,6 +49,10 @@
   @param[in]  nPE       Number of cores to use
   @param[out] pDstC     points to the output matrix
   @return     none
+
+  @par Matrix Vector Multiplication
+  If B has a single column (O == 1), the rows of A are distributed among the cores in chunks
+  of four, and plp_mat_vec_mult_i32p_xpulpv2 is used.
  */
 
 void plp_mat_mult_i32_parallel(const int32_t *__restrict__ pSrcA,
@@ -59,10 +63,23 @@ void plp_mat_mult_i32_parallel(const int32_t *__restrict__ pSrcA,
                                uint32_t nPE,
                                int32_t *__restrict__ pDstC) {
 
+    PLP_PROFILE_SHAPE(M, N, O);
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (O == 1) {
+            plp_mat_vec_mult_instance_i32 args = { .pSrcA = pSrcA,
+                                                   .pSrcX = pSrcB,
+                                                   .M = M,
+                                                   .N = N,
+                                                   .nPE = nPE,
+                                                   .pDstY = pDstC };
+            rt_team_fork(nPE, plp_mat_vec_mult_i32p_xpulpv2, (void *)&args);
+            return;
+        }
+
         plp_mat_mult_instance_i32 args = {
             .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC
         };
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i4xi8_parallel.c
+ * Description:  parallel i4xi8 mixed-precision matrix multiplication glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMult
+  @{
+ */
+
+/**
+  @brief Glue code for parallel matrix multiplication of a packed 4-bit integer matrix
+         with an 8-bit integer matrix.
+  @param[in]  pSrcA     points to the first input matrix (packed 4-bit)
+  @param[in]  pSrcB     points to the second input matrix (8-bit)
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and height of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par Packing
+  Matrix A holds signed 4-bit values, packed two per byte. Element n of a row is stored in the
+  low nibble (n even) or in the high nibble (n odd) of byte n / 2. Every row starts at a new byte,
+  i.e., a row takes (N + 1) / 2 bytes, and the high nibble of the last byte is ignored if N is odd.
+ */
+
+void plp_mat_mult_i4xi8_parallel(const int8_t *__restrict__ pSrcA,
+                                 const int8_t *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 uint32_t nPE,
+                                 int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_instance_i4xi8 args = { .pSrcA = pSrcA,
+                                             .pSrcB = pSrcB,
+                                             .M = M,
+                                             .N = N,
+                                             .O = O,
+                                             .nPE = nPE,
+                                             .pDstC = pDstC };
+        rt_team_fork(nPE, plp_mat_mult_i4xi8p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of BasicMatMult group
+ */
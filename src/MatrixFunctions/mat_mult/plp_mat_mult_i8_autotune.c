@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i8_autotune.c
+ * Description:  8-bit integer matrix multiplication with autotuned number of cores
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMult
+  @{
+ */
+
+/**
+  @brief      Runs the single core or the parallel version of plp_mat_mult_i8, on the number of
+              cores found fastest in a previous call.
+  @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
+                    plp_mat_mult_i8_autotune
+  @param[in]  nPE   number of parallel processing units, 0 for the single core version
+  @return     none
+ */
+
+static void plp_mat_mult_i8_autotune_run(void *args, uint32_t nPE) {
+
+    plp_mat_mult_instance_i8 *a = (plp_mat_mult_instance_i8 *)args;
+
+    if (nPE == 0) {
+        plp_mat_mult_i8(a->pSrcA, a->pSrcB, a->M, a->N, a->O, a->pDstC);
+    } else {
+        plp_mat_mult_i8_parallel(a->pSrcA, a->pSrcB, a->M, a->N, a->O, nPE, a->pDstC);
+    }
+}
+
+/**
+  @brief      Glue code for matrix multiplication of 8-bit integer matrices, which selects the
+              single core or the parallel version and the number of cores with plp_autotune_run.
+  @param[in]  pSrcA  points to the first input matrix
+  @param[in]  pSrcB  points to the second input matrix
+  @param[in]  M      height of the first input matrix
+  @param[in]  N      width of the first and height of the second input matrix
+  @param[in]  O      width of the second input matrix
+  @param[out] pDstC  points to the output matrix
+  @return     none
+
+  @par
+  The variants are tuned per bucket of the output size (M * O) and of the inner dimension (N).
+  pDstC must not overlap with pSrcA or pSrcB.
+ */
+
+void plp_mat_mult_i8_autotune(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC) {
+
+    plp_mat_mult_instance_i8 args = { .pSrcA = pSrcA,
+                                      .pSrcB = pSrcB,
+                                      .M = M,
+                                      .N = N,
+                                      .O = O,
+                                      .nPE = 0,
+                                      .pDstC = pDstC };
+
+    uint32_t bucket = (plp_autotune_bucket(M * O) << 8) | plp_autotune_bucket(N);
+
+    plp_autotune_run((const void *)plp_mat_mult_i8_autotune, bucket,
+                     plp_mat_mult_i8_autotune_run, (void *)&args);
+}
+
+/**
+  @} end of MatMult group
+ */
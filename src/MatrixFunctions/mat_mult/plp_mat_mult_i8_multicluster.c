@@ -0,0 +1,119 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i8_multicluster.c
+ * Description:  8-bit integer matrix multiplication on several clusters
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMult
+  @{
+ */
+
+/**
+  @brief      Runs plp_mat_mult_i8_parallel_tiled on a band of rows, on the cluster.
+  @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
+                    plp_mat_mult_i8_multicluster
+  @return     none
+ */
+
+static void plp_mat_mult_i8_multicluster_entry(void *args) {
+
+    plp_mat_mult_instance_i8 *a = (plp_mat_mult_instance_i8 *)args;
+
+    plp_mat_mult_i8_parallel_tiled(a->pSrcA, a->pSrcB, a->M, a->N, a->O, a->nPE, a->pDstC);
+}
+
+/**
+  @brief Glue code for matrix multiplication of 8-bit integer matrices on several clusters,
+  called from the fabric controller.
+  @param[in]  pSrcA      points to the first input matrix (in L2)
+  @param[in]  pSrcB      points to the second input matrix (in L2)
+  @param[in]  M          height of the first input matrix
+  @param[in]  N          width of the first input matrix and hight of the second
+  @param[in]  O          width of the second input matrix
+  @param[in]  nClusters  number of clusters to use, at most ARCHI_NB_CLUSTER
+  @param[in]  nPE        number of cores to use on every cluster
+  @param[out] pDstC      points to the output matrix (in L2)
+  @return     none
+
+  @par Work Distribution
+  Every cluster computes a band of ceil(M / nClusters) rows of C with
+  plp_mat_mult_i8_parallel_tiled, which streams its tiles of A and B from L2 into its own L1
+  with the cluster DMA and writes its tiles of C back to L2. The clusters share no data, apart
+  from reading B. The call returns when all clusters are done, and needs nClusters events (see
+  rt_event_alloc). No arena must be selected with plp_arena_use, such that every cluster
+  allocates its buffers in its own L1.
+ */
+
+void plp_mat_mult_i8_multicluster(const int8_t *__restrict__ pSrcA,
+                                  const int8_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t nClusters,
+                                  uint32_t nPE,
+                                  int32_t *__restrict__ pDstC) {
+
+    plp_offload_task_t tasks[ARCHI_NB_CLUSTER];
+    plp_mat_mult_instance_i8 args[ARCHI_NB_CLUSTER];
+    void *pArgs[ARCHI_NB_CLUSTER];
+
+    if (rt_cluster_id() != ARCHI_FC_CID) {
+        printf("multi-cluster processing supported only for FC side\n");
+        return;
+    }
+
+    if (nClusters > ARCHI_NB_CLUSTER) {
+        nClusters = ARCHI_NB_CLUSTER;
+    }
+
+    uint32_t rows = (M + nClusters - 1) / nClusters;
+    uint32_t cid;
+
+    for (cid = 0; cid < nClusters && cid * rows < M; cid++) {
+        uint32_t row = cid * rows;
+        args[cid].pSrcA = pSrcA + row * N;
+        args[cid].pSrcB = pSrcB;
+        args[cid].M = (M - row < rows) ? M - row : rows;
+        args[cid].N = N;
+        args[cid].O = O;
+        args[cid].nPE = nPE;
+        args[cid].pDstC = pDstC + row * O;
+        pArgs[cid] = (void *)&args[cid];
+    }
+
+    plp_offload_multicluster(tasks, cid, plp_mat_mult_i8_multicluster_entry, pArgs);
+}
+
+/**
+  @} end of BasicMatMult group
+ */
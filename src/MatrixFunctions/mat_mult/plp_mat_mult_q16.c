@@ -68,6 +68,8 @@ void plp_mat_mult_q16(const int16_t *__restrict__ pSrcA,
                       uint32_t shift,
                       int16_t *__restrict__ pDstC) {
 
+    PLP_PROFILE_SHAPE(M, N, O);
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_q16s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC);
     } else {
@@ -65,6 +65,8 @@ void plp_mat_mult_q32(const int32_t *__restrict__ pSrcA,
                       uint32_t shift,
                       int32_t *__restrict__ pDstC) {
 
+    PLP_PROFILE_SHAPE(M, N, O);
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_q32s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC);
     } else {
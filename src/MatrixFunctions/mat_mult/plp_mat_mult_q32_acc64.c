@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_q32_acc64.c
+ * Description:  32-bit fix-point matrix multiplication with 64-bit accumulation glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMult
+  @{
+ */
+
+/**
+  @brief Glue code for matrix mutliplication of 32-bit fix-point matrices with 64-bit
+         accumulation.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product is computed with the full 64-bit precision (mul and mulh), and accumulated in 64
+  bits. Only the final sum is shifted by the parameter `shift` to the right (with rounding), and
+  saturated to 32 bits. Assume that matrix A is represented as pSrcA * 2^-x, and matrix B as
+  pSrcB * 2^-y. Then, the output is represented as pDstC * 2^-(x + y - shift). In contrast to
+  plp_mat_mult_q32, the accumulator only overflows if the exact sum does not fit into 64 bits.
+ */
+
+void plp_mat_mult_q32_acc64(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_mult_q32_acc64s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC);
+    } else {
+        plp_mat_mult_q32_acc64s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC);
+    }
+}
+
+/**
+  @} end of BasicMatMult group
+ */
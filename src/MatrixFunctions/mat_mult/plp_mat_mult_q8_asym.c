@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_q8_asym.c
+ * Description:  Asymmetric quantized 8-bit matrix multiplication glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMult
+  @{
+ */
+
+/**
+  @brief Glue code for matrix multiplication of asymmetric quantized 8-bit matrices with
+         per-channel requantization.
+  @param[in]  pSrcA        points to the first input matrix (e.g. the activations)
+  @param[in]  pSrcB        points to the second input matrix (e.g. the weights)
+  @param[in]  M            height of the first input matrix
+  @param[in]  N            width of the first input matrix and hight of the second
+  @param[in]  O            width of the second input matrix, i.e. the number of channels
+  @param[in]  pZeroPointB  points to the zero point of every column of B, or NULL if all of them
+                           are zero (symmetric weights)
+  @param[in]  pColOffset   points to the offset of every column, computed by
+                           plp_mat_mult_q8_asym_col_offset
+  @param[in]  pMultiplier  points to the multiplier of every column in Q1.31
+  @param[in]  pShift       points to the shift of every column, positive values shift left
+  @param[in]  zeroPointC   zero point of the output matrix
+  @param[out] pDstC        points to the output matrix
+  @return     none
+
+  @par Asymmetric Quantization
+  The matrices represent the real values sA*(A - zA), sB[o]*(B - zB[o]) and sC[o]*(C - zC), with
+  a per-tensor zero point of A and per-column (per output channel) scales and zero points of B,
+  as in TensorFlow Lite. The 32-bit accumulator of output (m, o) is
+
+  <pre>
+      acc = sum_n (A[m][n] - zA) * (B[n][o] - zB[o])
+          = sum_n A[m][n] * B[n][o] - zB[o] * rowSumA[m] + pColOffset[o]
+  </pre>
+
+  where pColOffset[o] = bias[o] - zA * colSumB[o] + N * zA * zB[o] holds all terms which only
+  depend on B, and is computed once with plp_mat_mult_q8_asym_col_offset. The row sums of A are
+  computed by the kernel, only if pZeroPointB is not NULL. Hence, the inner loop is a plain
+  multiplication of the 8-bit values. The accumulator is requantized with plp_requantize_q8,
+  using the multiplier and the shift of the column, which represent sA*sB[o]/sC[o] =
+  pMultiplier[o] * 2^(pShift[o] - 31).
+ */
+
+void plp_mat_mult_q8_asym(const int8_t *__restrict__ pSrcA,
+                          const int8_t *__restrict__ pSrcB,
+                          uint32_t M,
+                          uint32_t N,
+                          uint32_t O,
+                          const int32_t *__restrict__ pZeroPointB,
+                          const int32_t *__restrict__ pColOffset,
+                          const int32_t *__restrict__ pMultiplier,
+                          const int32_t *__restrict__ pShift,
+                          int32_t zeroPointC,
+                          int8_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_mult_q8_asyms_rv32im(pSrcA, pSrcB, M, N, O, pZeroPointB, pColOffset, pMultiplier,
+                                     pShift, zeroPointC, pDstC);
+    } else {
+        plp_mat_mult_q8_asyms_xpulpv2(pSrcA, pSrcB, M, N, O, pZeroPointB, pColOffset, pMultiplier,
+                                      pShift, zeroPointC, pDstC);
+    }
+}
+
+/**
+  @} end of BasicMatMult group
+ */
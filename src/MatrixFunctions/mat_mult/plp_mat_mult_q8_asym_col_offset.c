@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_q8_asym_col_offset.c
+ * Description:  Column offsets of the asymmetric quantized 8-bit matrix multiplication
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMult
+  @{
+ */
+
+/**
+  @brief Computes the column offsets of plp_mat_mult_q8_asym.
+  @param[in]  pSrcB        points to the second input matrix (e.g. the weights)
+  @param[in]  N            height of the second input matrix
+  @param[in]  O            width of the second input matrix, i.e. the number of channels
+  @param[in]  zeroPointA   zero point of the first input matrix
+  @param[in]  pZeroPointB  points to the zero point of every column of B, or NULL if all of them
+                           are zero
+  @param[in]  pBias        points to the 32-bit bias of every column, or NULL for no bias
+  @param[out] pColOffset   points to the O offsets
+  @return     none
+
+  @par The offset of column o is pBias[o] - zeroPointA * colSumB[o] + N * zeroPointA *
+  pZeroPointB[o], with the sum colSumB[o] of column o of B. It only depends on B, and has to be
+  computed only once for constant weights. This function can be called on the fabric controller or
+  on the cluster.
+ */
+
+void plp_mat_mult_q8_asym_col_offset(const int8_t *__restrict__ pSrcB,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t zeroPointA,
+                                     const int32_t *__restrict__ pZeroPointB,
+                                     const int32_t *__restrict__ pBias,
+                                     int32_t *__restrict__ pColOffset) {
+
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    for (o = 0; o < O; o++) {
+        int32_t colSum = 0;
+        for (n = 0; n < N; n++) {
+            colSum += pSrcB[n * O + o];
+        }
+        int32_t offset = (pBias == NULL) ? 0 : pBias[o];
+        offset -= zeroPointA * colSum;
+        if (pZeroPointB != NULL) {
+            offset += (int32_t)N * zeroPointA * pZeroPointB[o];
+        }
+        pColOffset[o] = offset;
+    }
+}
+
+/**
+  @} end of BasicMatMult group
+ */
@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_q8_asym_parallel.c
+ * Description:  Parallel asymmetric quantized 8-bit matrix multiplication glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup BasicMatMult
+  @{
+ */
+
+/**
+  @brief Glue code for parallel matrix multiplication of asymmetric quantized 8-bit matrices with
+         per-channel requantization.
+  @param[in]  pSrcA        points to the first input matrix (e.g. the activations)
+  @param[in]  pSrcB        points to the second input matrix (e.g. the weights)
+  @param[in]  M            height of the first input matrix
+  @param[in]  N            width of the first input matrix and hight of the second
+  @param[in]  O            width of the second input matrix, i.e. the number of channels
+  @param[in]  pZeroPointB  points to the zero point of every column of B, or NULL if all of them
+                           are zero (symmetric weights)
+  @param[in]  pColOffset   points to the offset of every column, computed by
+                           plp_mat_mult_q8_asym_col_offset
+  @param[in]  pMultiplier  points to the multiplier of every column in Q1.31
+  @param[in]  pShift       points to the shift of every column, positive values shift left
+  @param[in]  zeroPointC   zero point of the output matrix
+  @param[in]  nPE          Number of cores to use
+  @param[out] pDstC        points to the output matrix
+  @return     none
+
+  @par Asymmetric Quantization
+  See plp_mat_mult_q8_asym.
+ */
+
+void plp_mat_mult_q8_asym_parallel(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   const int32_t *__restrict__ pZeroPointB,
+                                   const int32_t *__restrict__ pColOffset,
+                                   const int32_t *__restrict__ pMultiplier,
+                                   const int32_t *__restrict__ pShift,
+                                   int32_t zeroPointC,
+                                   uint32_t nPE,
+                                   int8_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_asym_instance_q8 args = { .pSrcA = pSrcA,
+                                               .pSrcB = pSrcB,
+                                               .M = M,
+                                               .N = N,
+                                               .O = O,
+                                               .pZeroPointB = pZeroPointB,
+                                               .pColOffset = pColOffset,
+                                               .pMultiplier = pMultiplier,
+                                               .pShift = pShift,
+                                               .zeroPointC = zeroPointC,
+                                               .nPE = nPE,
+                                               .pDstC = pDstC };
+        rt_team_fork(nPE, plp_mat_mult_q8_asymp_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of BasicMatMult group
+ */
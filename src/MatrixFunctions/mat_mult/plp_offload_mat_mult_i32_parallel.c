@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_offload_mat_mult_i32_parallel.c
+ * Description:  offload of the 32-bit integer parallel matrix multiplication to the cluster
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMult
+  @{
+ */
+
+/**
+  @brief      Runs plp_mat_mult_i32_parallel on the cluster.
+  @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
+                    plp_offload_mat_mult_i32_parallel
+  @return     none
+ */
+
+static void plp_offload_mat_mult_i32_parallel_entry(void *args) {
+
+    plp_mat_mult_instance_i32 *a = (plp_mat_mult_instance_i32 *)args;
+
+    plp_mat_mult_i32_parallel(a->pSrcA, a->pSrcB, a->M, a->N, a->O, a->nPE, a->pDstC);
+}
+
+/**
+  @brief      Offloads the parallel matrix multiplication of 32-bit integer matrices from the fabric
+              controller to the cluster, see plp_offload.
+  @param[in]  task   task of the offloaded call, valid until done
+  @param[in]  pSrcA  points to the first input matrix
+  @param[in]  pSrcB  points to the second input matrix
+  @param[in]  M      height of the first input matrix
+  @param[in]  N      width of the first and height of the second input matrix
+  @param[in]  O      width of the second input matrix
+  @param[in]  nPE    number of parallel processing units
+  @param[out] pDstC  points to the output matrix
+  @param[in]  done   event pushed when the multiplication is done, or NULL to wait for it
+  @return     none
+ */
+
+void plp_offload_mat_mult_i32_parallel(plp_offload_mat_mult_task_i32 *task,
+                                       const int32_t *__restrict__ pSrcA,
+                                       const int32_t *__restrict__ pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       uint32_t nPE,
+                                       int32_t *__restrict__ pDstC,
+                                       rt_event_t *done) {
+
+    task->args.pSrcA = pSrcA;
+    task->args.pSrcB = pSrcB;
+    task->args.M = M;
+    task->args.N = N;
+    task->args.O = O;
+    task->args.nPE = nPE;
+    task->args.pDstC = pDstC;
+
+    plp_offload(&task->task, plp_offload_mat_mult_i32_parallel_entry, (void *)&task->args, done);
+}
+
+/**
+  @} end of MatMult group
+ */
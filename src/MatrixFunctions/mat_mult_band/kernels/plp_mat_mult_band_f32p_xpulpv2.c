@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_band_f32p_xpulpv2.c
+ * Description:  Parallel 32-bit floating-point banded matrix multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultBand
+ */
+
+/**
+  @addtogroup MatMultBandKernels
+  @{
+ */
+
+/**
+  @brief Parallel multiplication of a banded 32-bit floating-point matrix with a matrix kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_mult_band_instance_f32 struct initialized by
+                    plp_mat_mult_band_f32_parallel
+  @return     none
+
+  @par Parallelization
+  The output is split into rectangles with plp_mat_partition. Thus, the rows of a matrix vector
+  multiplication (O = 1) are split among all cores.
+ */
+
+void plp_mat_mult_band_f32p_xpulpv2(void *args) {
+
+    uint32_t core_id = rt_core_id();
+
+    plp_mat_mult_band_instance_f32 *a = (plp_mat_mult_band_instance_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t kl = a->kl;
+    uint32_t ku = a->ku;
+    float *__restrict__ pDstC = a->pDstC;
+
+    uint32_t width = kl + ku + 1;
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    plp_mat_partition_t part;
+    plp_mat_partition(a->M, O, a->nPE, core_id, &part);
+
+    for (m = part.rowStart; m < part.rowEnd; m++) {
+        // columns of A inside the band of row m
+        uint32_t lo = (m > kl) ? m - kl : 0;
+        uint32_t hi = (m + ku + 1 < N) ? m + ku + 1 : N;
+        const float *pA = pSrcA + m * width + kl + lo - m;
+
+        for (o = part.colStart; o < part.colEnd; o++) {
+            const float *pB = pSrcB + lo * O + o;
+            float sum = 0.0f;
+            for (n = lo; n < hi; n++) {
+                sum += pA[n - lo] * *pB;
+                pB += O;
+            }
+            pDstC[m * O + o] = sum;
+        }
+    }
+}
+
+/**
+  @} end of MatMultBandKernels group
+ */
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_band_f32s_xpulpv2.c
+ * Description:  32-bit floating-point banded matrix multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultBand
+ */
+
+/**
+  @defgroup MatMultBandKernels Banded matrix multiplication Kernels
+  This module contains the kernel functions for the multiplication of a banded matrix with a
+  matrix, see Banded matrix multiplication.
+ */
+
+/**
+  @addtogroup MatMultBandKernels
+  @{
+ */
+
+/**
+  @brief Multiplication of a banded 32-bit floating-point matrix with a matrix kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA  Points to the band of A, PLP_MAT_BAND_LEN(M, kl, ku) values
+  @param[in]  pSrcB  Points to the matrix B of shape NxO
+  @param[in]  M      Height of A and C
+  @param[in]  N      Width of A and height of B
+  @param[in]  O      Width of B and C, 1 for a matrix vector multiplication
+  @param[in]  kl     Number of diagonals of A below the main diagonal
+  @param[in]  ku     Number of diagonals of A above the main diagonal
+  @param[out] pDstC  Points to the output matrix C of shape MxO
+  @return     none
+ */
+
+void plp_mat_mult_band_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                    const float *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t kl,
+                                    uint32_t ku,
+                                    float *__restrict__ pDstC) {
+
+    uint32_t width = kl + ku + 1;
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    for (m = 0; m < M; m++) {
+        // columns of A inside the band of row m
+        uint32_t lo = (m > kl) ? m - kl : 0;
+        uint32_t hi = (m + ku + 1 < N) ? m + ku + 1 : N;
+        const float *pA = pSrcA + m * width + kl + lo - m;
+
+        for (o = 0; o < O; o++) {
+            const float *pB = pSrcB + lo * O + o;
+            float sum = 0.0f;
+            for (n = lo; n < hi; n++) {
+                sum += pA[n - lo] * *pB;
+                pB += O;
+            }
+            pDstC[m * O + o] = sum;
+        }
+    }
+}
+
+/**
+  @} end of MatMultBandKernels group
+ */
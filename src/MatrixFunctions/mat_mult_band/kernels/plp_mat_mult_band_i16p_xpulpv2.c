@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_band_i16p_xpulpv2.c
+ * Description:  Parallel 16-bit integer banded matrix multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultBand
+ */
+
+/**
+  @addtogroup MatMultBandKernels
+  @{
+ */
+
+/**
+  @brief Parallel multiplication of a banded 16-bit integer matrix with a matrix kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_mult_band_instance_i16 struct initialized by
+                    plp_mat_mult_band_i16_parallel
+  @return     none
+
+  @par Parallelization
+  The output is split into rectangles with plp_mat_partition. Thus, the rows of a matrix vector
+  multiplication (O = 1) are split among all cores.
+
+  @par Exploiting SIMD instructions
+  Two elements of the band and of the column of B are packed into 32 bit vectors, and
+  accumulated with a single dot product instruction.
+ */
+
+void plp_mat_mult_band_i16p_xpulpv2(void *args) {
+
+    uint32_t core_id = rt_core_id();
+
+    plp_mat_mult_band_instance_i16 *a = (plp_mat_mult_band_instance_i16 *)args;
+
+    const int16_t *__restrict__ pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t kl = a->kl;
+    uint32_t ku = a->ku;
+    int32_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t width = kl + ku + 1;
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+    uint32_t o; // loop counter
+
+    plp_mat_partition_t part;
+    plp_mat_partition(a->M, O, a->nPE, core_id, &part);
+
+    for (m = part.rowStart; m < part.rowEnd; m++) {
+        // columns of A inside the band of row m
+        uint32_t lo = (m > kl) ? m - kl : 0;
+        uint32_t hi = (m + ku + 1 < N) ? m + ku + 1 : N;
+        const int16_t *pA = pSrcA + m * width + kl + lo - m;
+
+        for (o = part.colStart; o < part.colEnd; o++) {
+            const int16_t *pB = pSrcB + lo * O + o;
+            int32_t sum = 0;
+            // pairs of A are contiguous, pairs of B are one row apart
+            for (n = lo; n + 1 < hi; n += 2) {
+                sum = __SUMDOTP2(__PACK2(pA[n - lo], pA[n - lo + 1]), __PACK2(pB[0], pB[O]), sum);
+                pB += 2 * O;
+            }
+            if (n < hi) {
+                sum += (int32_t)pA[n - lo] * *pB;
+            }
+            pDstC[m * O + o] = sum;
+        }
+    }
+}
+
+/**
+  @} end of MatMultBandKernels group
+ */
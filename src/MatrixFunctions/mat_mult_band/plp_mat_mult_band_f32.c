@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_band_f32.c
+ * Description:  Glue code for the 32-bit floating-point banded matrix multiplication
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatMultBand Banded matrix multiplication
+  This module contains the glue code for the multiplication of a banded matrix A of shape MxN with
+  a matrix B of shape NxO, or with a vector for O = 1. The kernel codes (kernels) are in the Module
+  Banded matrix multiplication Kernels.
+
+  \f[
+    C = A \cdot B
+  \f]
+
+  A has kl diagonals below and ku diagonals above its main diagonal, e.g. kl = ku = 1 for a
+  tridiagonal matrix. Only the band is stored, row by row: row m holds the kl + ku + 1 elements
+  A[m, m - kl] to A[m, m + ku], such that element (m, n) is at PLP_MAT_BAND_IDX(m, n, kl, ku), and
+  the whole band takes PLP_MAT_BAND_LEN(M, kl, ku) values. The elements of the band outside of A
+  (e.g. A[0, -1]) are never read. The product takes at most M * O * (kl + ku + 1) multiplications,
+  instead of the M * N * O multiplications of the dense product.
+ */
+
+/**
+  @addtogroup MatMultBand
+  @{
+ */
+
+/**
+  @brief Glue code for the multiplication of a banded 32-bit floating-point matrix with a matrix.
+  @param[in]  pSrcA  Points to the band of A, PLP_MAT_BAND_LEN(M, kl, ku) values
+  @param[in]  pSrcB  Points to the matrix B of shape NxO
+  @param[in]  M      Height of A and C
+  @param[in]  N      Width of A and height of B
+  @param[in]  O      Width of B and C, 1 for a matrix vector multiplication
+  @param[in]  kl     Number of diagonals of A below the main diagonal
+  @param[in]  ku     Number of diagonals of A above the main diagonal
+  @param[out] pDstC  Points to the output matrix C of shape MxO
+  @return     none
+ */
+
+void plp_mat_mult_band_f32(const float *__restrict__ pSrcA,
+                           const float *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t kl,
+                           uint32_t ku,
+                           float *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_band_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, kl, ku, pDstC);
+    }
+}
+
+/**
+  @} end of MatMultBand group
+ */
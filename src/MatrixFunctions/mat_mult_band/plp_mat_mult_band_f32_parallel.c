@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_band_f32_parallel.c
+ * Description:  Glue code for the parallel 32-bit floating-point banded matrix multiplication
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultBand
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel multiplication of a banded 32-bit floating-point matrix with a
+         matrix.
+  @param[in]  pSrcA  Points to the band of A, PLP_MAT_BAND_LEN(M, kl, ku) values
+  @param[in]  pSrcB  Points to the matrix B of shape NxO
+  @param[in]  M      Height of A and C
+  @param[in]  N      Width of A and height of B
+  @param[in]  O      Width of B and C, 1 for a matrix vector multiplication
+  @param[in]  kl     Number of diagonals of A below the main diagonal
+  @param[in]  ku     Number of diagonals of A above the main diagonal
+  @param[in]  nPE    Number of cores to use for computation
+  @param[out] pDstC  Points to the output matrix C of shape MxO
+  @return     none
+ */
+
+void plp_mat_mult_band_f32_parallel(const float *__restrict__ pSrcA,
+                                    const float *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t kl,
+                                    uint32_t ku,
+                                    uint32_t nPE,
+                                    float *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_band_instance_f32 args = { .pSrcA = pSrcA,
+                                                .pSrcB = pSrcB,
+                                                .M = M,
+                                                .N = N,
+                                                .O = O,
+                                                .kl = kl,
+                                                .ku = ku,
+                                                .nPE = nPE,
+                                                .pDstC = pDstC };
+
+        rt_team_fork(nPE, plp_mat_mult_band_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatMultBand group
+ */
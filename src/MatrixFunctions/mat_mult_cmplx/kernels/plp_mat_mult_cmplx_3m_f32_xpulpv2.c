@@ -0,0 +1,203 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_cmplx_3m_f32_xpulpv2.c
+ * Description:  Complex 32-bit float matrix multiplication with three multiplications for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// element (m, o) of the output with four multiplications per product, for the rows and columns
+// which do not fill a tile
+static void mat_mult_cmplx_3m_f32_dot(const float *__restrict__ pSrcA,
+                                      const float *__restrict__ pSrcB,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t m,
+                                      uint32_t o,
+                                      float *__restrict__ pDstC) {
+
+    float sum_re = 0;
+    float sum_im = 0;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        float a_re = pSrcA[(m * N + n) * 2 + 0];
+        float a_im = pSrcA[(m * N + n) * 2 + 1];
+        float b_re = pSrcB[(n * O + o) * 2 + 0];
+        float b_im = pSrcB[(n * O + o) * 2 + 1];
+        sum_re += a_re * b_re - a_im * b_im;
+        sum_im += a_re * b_im + a_im * b_re;
+    }
+
+    pDstC[(m * O + o) * 2 + 0] = sum_re;
+    pDstC[(m * O + o) * 2 + 1] = sum_im;
+}
+
+// block pPart of the output, computed in tiles of 2x2 elements with three multiplications per
+// product: the sums rr of a_re * b_re, ii of a_im * b_im and ss of (a_re + a_im) * (b_re + b_im)
+// give re = rr - ii and im = ss - rr - ii
+static void mat_mult_cmplx_3m_f32_block(const float *__restrict__ pSrcA,
+                                        const float *__restrict__ pSrcB,
+                                        uint32_t N,
+                                        uint32_t O,
+                                        const plp_mat_partition_t *pPart,
+                                        float *__restrict__ pDstC) {
+
+    uint32_t m, n, o;
+
+    for (m = pPart->rowStart; m + 2 <= pPart->rowEnd; m += 2) {
+        for (o = pPart->colStart; o + 2 <= pPart->colEnd; o += 2) {
+            const float *pA0 = &pSrcA[m * N * 2];
+            const float *pA1 = &pSrcA[(m + 1) * N * 2];
+            const float *pB = &pSrcB[o * 2];
+            float *pC0 = &pDstC[(m * O + o) * 2];
+            float *pC1 = &pDstC[((m + 1) * O + o) * 2];
+            float rr00 = 0;
+            float ii00 = 0;
+            float ss00 = 0;
+            float rr01 = 0;
+            float ii01 = 0;
+            float ss01 = 0;
+            float rr10 = 0;
+            float ii10 = 0;
+            float ss10 = 0;
+            float rr11 = 0;
+            float ii11 = 0;
+            float ss11 = 0;
+            for (n = 0; n < N; n++) {
+                float a0_re = pA0[0];
+                float a0_im = pA0[1];
+                float a1_re = pA1[0];
+                float a1_im = pA1[1];
+                float b0_re = pB[0];
+                float b0_im = pB[1];
+                float b1_re = pB[2];
+                float b1_im = pB[3];
+                // the four additions are shared by the twelve multiplications of the tile
+                float a0_s = a0_re + a0_im;
+                float a1_s = a1_re + a1_im;
+                float b0_s = b0_re + b0_im;
+                float b1_s = b1_re + b1_im;
+                rr00 += a0_re * b0_re;
+                ii00 += a0_im * b0_im;
+                ss00 += a0_s * b0_s;
+                rr01 += a0_re * b1_re;
+                ii01 += a0_im * b1_im;
+                ss01 += a0_s * b1_s;
+                rr10 += a1_re * b0_re;
+                ii10 += a1_im * b0_im;
+                ss10 += a1_s * b0_s;
+                rr11 += a1_re * b1_re;
+                ii11 += a1_im * b1_im;
+                ss11 += a1_s * b1_s;
+                pA0 += 2;
+                pA1 += 2;
+                pB += O * 2;
+            }
+            pC0[0] = rr00 - ii00;
+            pC0[1] = ss00 - rr00 - ii00;
+            pC0[2] = rr01 - ii01;
+            pC0[3] = ss01 - rr01 - ii01;
+            pC1[0] = rr10 - ii10;
+            pC1[1] = ss10 - rr10 - ii10;
+            pC1[2] = rr11 - ii11;
+            pC1[3] = ss11 - rr11 - ii11;
+        }
+        for (; o < pPart->colEnd; o++) {
+            mat_mult_cmplx_3m_f32_dot(pSrcA, pSrcB, N, O, m, o, pDstC);
+            mat_mult_cmplx_3m_f32_dot(pSrcA, pSrcB, N, O, m + 1, o, pDstC);
+        }
+    }
+    for (; m < pPart->rowEnd; m++) {
+        for (o = pPart->colStart; o < pPart->colEnd; o++) {
+            mat_mult_cmplx_3m_f32_dot(pSrcA, pSrcB, N, O, m, o, pDstC);
+        }
+    }
+}
+
+/**
+  @ingroup MatMultCmplx
+ */
+
+/**
+  @addtogroup MatMultCmplxKernels
+  @{
+ */
+
+/**
+  @brief      Matrix matrix multiplication for complex 32-bit floats with three
+              multiplications per product on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par The output is computed in tiles of 2x2 elements. Per element of the inner dimension, the
+  tile needs twelve multiplications and four additions instead of sixteen multiplications.
+
+  @par Precision
+  The imaginary part is the difference of sums, such that its rounding error is relative to the
+  magnitudes of the inputs instead of the magnitude of the result.
+ */
+
+void plp_mat_mult_cmplx_3m_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                        const float *__restrict__ pSrcB,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t O,
+                                        float *__restrict__ pDstC) {
+
+    plp_mat_partition_t part = { .rowStart = 0, .rowEnd = M, .colStart = 0, .colEnd = O };
+
+    mat_mult_cmplx_3m_f32_block(pSrcA, pSrcB, N, O, &part, pDstC);
+}
+
+/**
+  @brief      Parallel matrix matrix multiplication for complex 32-bit floats with three
+              multiplications per product on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
+                    plp_mat_mult_cmplx_3m_f32_parallel
+  @return     none
+
+  @par The output is split into a grid of rectangles with plp_mat_partition, one per core, and
+  every core computes its rectangle as plp_mat_mult_cmplx_3m_f32s_xpulpv2.
+ */
+
+void plp_mat_mult_cmplx_3m_f32p_xpulpv2(void *args) {
+
+    plp_mat_mult_cmplx_instance_f32 *a = (plp_mat_mult_cmplx_instance_f32 *)args;
+
+    plp_mat_partition_t part;
+    plp_mat_partition(a->M, a->O, a->nPE, rt_core_id(), &part);
+
+    mat_mult_cmplx_3m_f32_block(a->pSrcA, a->pSrcB, a->N, a->O, &part, a->pDstC);
+}
+
+/**
+   @} end of MatMultCmplxKernels group
+*/
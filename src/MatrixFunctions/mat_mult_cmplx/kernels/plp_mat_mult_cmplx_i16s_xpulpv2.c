@@ -39,6 +39,40 @@
   @{
  */
 
+/**
+   @brief Complex dot product of a row of A and a column of B for complex 16-bit integers.
+          Every complex element is loaded as one v2s vector [re, im].
+   @param[in]  pA    Points to the first element of the row of A
+   @param[in]  pB    Points to the first element of the column of B
+   @param[in]  N     Number of complex elements
+   @param[in]  O     Distance between two elements of the column of B (in complex elements)
+   @param[out] pRe   Points to the real part of the result, with 32 bit precision
+   @param[out] pIm   Points to the imaginary part of the result, with 32 bit precision
+   @return     none
+*/
+static inline void plp_mat_mult_cmplx_dot_i16(const int16_t *__restrict__ pA,
+                                              const int16_t *__restrict__ pB,
+                                              uint32_t N,
+                                              uint32_t O,
+                                              int32_t *__restrict__ pRe,
+                                              int32_t *__restrict__ pIm) {
+    const v2s mask = (v2s){ 0, -1 }; // inverts the imaginary part
+    const v2s swap = (v2s){ 1, 0 };  // swaps the real and the imaginary part
+
+    int32_t re = 0;
+    int32_t im = 0;
+    uint32_t n;
+    for (n = 0; n < N; n++) {
+        v2s a = *((v2s *)&pA[n * 2]);
+        v2s b = *((v2s *)&pB[n * O * 2]);
+        // a_re * b_re + a_im * ~b_im = a_re * b_re - a_im * b_im - a_im
+        re = __SUMDOTP2(a, b ^ mask, re) + pA[n * 2 + 1];
+        im = __SUMDOTP2(a, __builtin_shuffle(b, swap), im);
+    }
+    *pRe = re;
+    *pIm = im;
+}
+
 /**
   @brief      Matrix matrix multiplication for complex 16-bit integers on XpulpV2
   @param[in]  pSrcA Points to the first input matrix of shape MxN
@@ -48,6 +82,13 @@
   @param[in]  O     Width of matrix SrcB and DstC
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
+
+  @par Exploiting SIMD instructions
+  Every complex element is loaded as one 32 bit vector [re, im]. The imaginary part of each product
+  is computed with a single pv.sdotsp.h of a and the swapped [b_im, b_re]. For the real part, b_im
+  is inverted bitwise instead of negated (~b_im = -b_im - 1, which cannot overflow for -2^15), and
+  the resulting error of -a_im is compensated with the sum of the imaginary parts of the row of A.
+  The elements of C are computed in blocks of 2x2, such that every loaded element is used twice.
  */
 
 void plp_mat_mult_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
@@ -57,7 +98,7 @@ void plp_mat_mult_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
                                      uint32_t O,
                                      int32_t *__restrict__ pDstC) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     for (int m = 0; m < M; m++) {
@@ -79,10 +120,90 @@ void plp_mat_mult_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
 
 #else
 
-    // TODO: Hackathon
+    uint32_t m, n, o; // loop counters
+    int32_t re, im;   // result of the dot product for a single element
+
+    const v2s mask = (v2s){ 0, -1 }; // inverts the imaginary part
+    const v2s swap = (v2s){ 1, 0 };  // swaps the real and the imaginary part
+
+    // compute blocks of 2x2 elements of C, which loads every element of A and B only once per block
+    for (m = 0; m + 1 < M; m += 2) {
+        const int16_t *pA0 = pSrcA + (m * N) * 2;
+        const int16_t *pA1 = pA0 + N * 2;
+
+        // sum of the imaginary parts of both rows of A, which corrects the real parts
+        int32_t corr0 = 0;
+        int32_t corr1 = 0;
+        for (n = 0; n < N; n++) {
+            corr0 += pA0[n * 2 + 1];
+            corr1 += pA1[n * 2 + 1];
+        }
+
+        for (o = 0; o + 1 < O; o += 2) {
+            const int16_t *pB0 = pSrcB + o * 2;
+
+            int32_t re00 = corr0;
+            int32_t im00 = 0;
+            int32_t re01 = corr0;
+            int32_t im01 = 0;
+            int32_t re10 = corr1;
+            int32_t im10 = 0;
+            int32_t re11 = corr1;
+            int32_t im11 = 0;
+
+            for (n = 0; n < N; n++) {
+                v2s a0 = *((v2s *)&pA0[n * 2]);
+                v2s a1 = *((v2s *)&pA1[n * 2]);
+                v2s b0 = *((v2s *)&pB0[n * O * 2]);
+                v2s b1 = *((v2s *)&pB0[n * O * 2 + 2]);
+                v2s b0Conj = b0 ^ mask;
+                v2s b1Conj = b1 ^ mask;
+                v2s b0Swap = __builtin_shuffle(b0, swap);
+                v2s b1Swap = __builtin_shuffle(b1, swap);
+                re00 = __SUMDOTP2(a0, b0Conj, re00);
+                im00 = __SUMDOTP2(a0, b0Swap, im00);
+                re01 = __SUMDOTP2(a0, b1Conj, re01);
+                im01 = __SUMDOTP2(a0, b1Swap, im01);
+                re10 = __SUMDOTP2(a1, b0Conj, re10);
+                im10 = __SUMDOTP2(a1, b0Swap, im10);
+                re11 = __SUMDOTP2(a1, b1Conj, re11);
+                im11 = __SUMDOTP2(a1, b1Swap, im11);
+            }
+
+            int32_t *pC0 = pDstC + (m * O + o) * 2;
+            int32_t *pC1 = pC0 + O * 2;
+            pC0[0] = re00;
+            pC0[1] = im00;
+            pC0[2] = re01;
+            pC0[3] = im01;
+            pC1[0] = re10;
+            pC1[1] = im10;
+            pC1[2] = re11;
+            pC1[3] = im11;
+        }
+
+        // leftover column
+        if (o < O) {
+            plp_mat_mult_cmplx_dot_i16(pA0, pSrcB + o * 2, N, O, &re, &im);
+            pDstC[(m * O + o) * 2 + 0] = re;
+            pDstC[(m * O + o) * 2 + 1] = im;
+            plp_mat_mult_cmplx_dot_i16(pA1, pSrcB + o * 2, N, O, &re, &im);
+            pDstC[((m + 1) * O + o) * 2 + 0] = re;
+            pDstC[((m + 1) * O + o) * 2 + 1] = im;
+        }
+    }
+
+    // leftover row
+    if (m < M) {
+        for (o = 0; o < O; o++) {
+            plp_mat_mult_cmplx_dot_i16(pSrcA + (m * N) * 2, pSrcB + o * 2, N, O, &re, &im);
+            pDstC[(m * O + o) * 2 + 0] = re;
+            pDstC[(m * O + o) * 2 + 1] = im;
+        }
+    }
 
 #endif
-#undef BASIC_VERSION
+// undefine BASIC_VERSION
 }
 /**
    @} end of MatMultCmplxKernels group
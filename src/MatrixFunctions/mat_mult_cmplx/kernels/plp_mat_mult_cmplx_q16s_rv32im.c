@@ -46,7 +46,7 @@
   @param[in]  M     Height of matrix SrcA and DstC
   @param[in]  N     Width of matrix SrcA and height of matrix SrcB
   @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  shift Amount to shift the accumulated result to the right
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
 
@@ -56,8 +56,9 @@
   multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
   as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
   the output matrix C is represented as `pDstC * 2^-(x + y - shift)`. The output matrix is also
-  stored with the same number of bits as the inputs. Set the `shift` parameter such that no overflow
-  occurrs.
+  stored with the same number of bits as the inputs. The products are accumulated with 32 bit
+  precision, and only the final sum is shifted (with rounding) and saturated to 16 bits. Set the
+  `shift` parameter such that the 32 bit accumulator does not overflow.
  */
 
 void plp_mat_mult_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
@@ -71,7 +72,9 @@ void plp_mat_mult_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
 #define BASIC_VERSION // if used don' forget to also use undefine at end of file
 #ifdef BASIC_VERSION
 
-    int32_t bias = 1 << (shift - 1);
+    int32_t round = (1 << shift) >> 1;
+    int32_t minVal = -(1 << 15);
+    int32_t maxVal = (1 << 15) - 1;
 
     for (int m = 0; m < M; m++) {
         for (int o = 0; o < O; o++) {
@@ -82,9 +85,13 @@ void plp_mat_mult_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
                 int32_t a_im = (int32_t)pSrcA[(m * N + n) * 2 + 1];
                 int32_t b_re = (int32_t)pSrcB[(n * O + o) * 2 + 0];
                 int32_t b_im = (int32_t)pSrcB[(n * O + o) * 2 + 1];
-                sum_re += (a_re * b_re - a_im * b_im + bias) >> shift;
-                sum_im += (a_re * b_im + a_im * b_re + bias) >> shift;
+                sum_re += a_re * b_re - a_im * b_im;
+                sum_im += a_re * b_im + a_im * b_re;
             }
+            sum_re = (sum_re + round) >> shift;
+            sum_im = (sum_im + round) >> shift;
+            sum_re = sum_re > maxVal ? maxVal : (sum_re < minVal ? minVal : sum_re);
+            sum_im = sum_im > maxVal ? maxVal : (sum_im < minVal ? minVal : sum_im);
             pDstC[(m * O + o) * 2 + 0] = (int16_t)sum_re;
             pDstC[(m * O + o) * 2 + 1] = (int16_t)sum_im;
         }
@@ -73,8 +73,11 @@ void plp_mat_mult_cmplx_q32p_xpulpv2(void *args) {
 #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int o = 0; o < O; o++) {
+    plp_mat_partition_t part;
+    plp_mat_partition(M, O, nPE, core_id, &part);
+
+    for (int m = part.rowStart; m < part.rowEnd; m++) {
+        for (int o = part.colStart; o < part.colEnd; o++) {
             int32_t sum_re = 0;
             int32_t sum_im = 0;
             for (int n = 0; n < N; n++) {
@@ -46,7 +46,7 @@
   @param[in]  M     Height of matrix SrcA and DstC
   @param[in]  N     Width of matrix SrcA and height of matrix SrcB
   @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  shift Amount to shift the accumulated result to the right
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
 
@@ -56,8 +56,9 @@
   multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
   as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
   the output matrix C is represented as `pDstC * 2^-(x + y - shift)`. The output matrix is also
-  stored with the same number of bits as the inputs. Set the `shift` parameter such that no overflow
-  occurrs.
+  stored with the same number of bits as the inputs. The products are accumulated with 32 bit
+  precision, and only the final sum is shifted (with rounding) and saturated to 16 bits. Set the
+  `shift` parameter such that the 32 bit accumulator does not overflow.
  */
 
 void plp_mat_mult_cmplx_q16(const int16_t *__restrict__ pSrcA,
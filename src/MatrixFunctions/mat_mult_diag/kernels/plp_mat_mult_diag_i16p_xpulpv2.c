@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_diag_i16p_xpulpv2.c
+ * Description:  Parallel 16-bit integer diagonal matrix multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultDiag
+ */
+
+/**
+  @addtogroup MatMultDiagKernels
+  @{
+ */
+
+/**
+  @brief Parallel multiplication of a 16-bit integer matrix with a diagonal matrix kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_mult_diag_instance_i16 struct initialized by
+                    plp_mat_mult_diag_i16_parallel
+  @return     none
+
+  @par Parallelization
+  The output is split into rectangles with plp_mat_partition, such that every core reads only the
+  diagonal elements of its own rows or columns.
+ */
+
+void plp_mat_mult_diag_i16p_xpulpv2(void *args) {
+
+    uint32_t core_id = rt_core_id();
+
+    plp_mat_mult_diag_instance_i16 *a = (plp_mat_mult_diag_instance_i16 *)args;
+
+    const int16_t *pSrc = a->pSrc;
+    uint32_t N = a->N;
+    const int16_t *pDiag = a->pDiag;
+    uint32_t right = a->right;
+    int32_t shift = a->shift;
+    int16_t *pDst = a->pDst;
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    plp_mat_partition_t part;
+    plp_mat_partition(a->M, N, a->nPE, core_id, &part);
+
+    for (m = part.rowStart; m < part.rowEnd; m++) {
+        const int16_t *pA = pSrc + m * N;
+        int16_t *pOut = pDst + m * N;
+
+        if (right) {
+            for (n = part.colStart; n < part.colEnd; n++) {
+                pOut[n] = (int16_t)(((int32_t)pA[n] * pDiag[n]) >> shift);
+            }
+        } else {
+            // the factor of the row is loaded once
+            int32_t d = pDiag[m];
+            for (n = part.colStart; n < part.colEnd; n++) {
+                pOut[n] = (int16_t)(((int32_t)pA[n] * d) >> shift);
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatMultDiagKernels group
+ */
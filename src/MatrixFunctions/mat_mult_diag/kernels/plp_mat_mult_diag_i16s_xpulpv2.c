@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_diag_i16s_xpulpv2.c
+ * Description:  16-bit integer diagonal matrix multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultDiag
+ */
+
+/**
+  @addtogroup MatMultDiagKernels
+  @{
+ */
+
+/**
+  @brief Multiplication of a 16-bit integer matrix with a diagonal matrix kernel for
+         XPULPV2 extension.
+  @param[in]  pSrc   Points to the input matrix of shape MxN
+  @param[in]  M      Height of both matrices
+  @param[in]  N      Width of both matrices
+  @param[in]  pDiag  Points to the diagonal of D, M values for D * A or N values for A * D
+  @param[in]  right  If set, compute A * D (scale the columns) instead of D * A (scale the rows)
+  @param[in]  shift  Amount to shift each element
+  @param[out] pDst   Points to the output matrix, may be equal to pSrc
+  @return     none
+ */
+
+void plp_mat_mult_diag_i16s_xpulpv2(const int16_t *pSrc,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    const int16_t *pDiag,
+                                    uint32_t right,
+                                    int32_t shift,
+                                    int16_t *pDst) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    for (m = 0; m < M; m++) {
+        const int16_t *pA = pSrc + m * N;
+        int16_t *pOut = pDst + m * N;
+
+        if (right) {
+            for (n = 0; n < N; n++) {
+                pOut[n] = (int16_t)(((int32_t)pA[n] * pDiag[n]) >> shift);
+            }
+        } else {
+            // the factor of the row is loaded once
+            int32_t d = pDiag[m];
+            for (n = 0; n < N; n++) {
+                pOut[n] = (int16_t)(((int32_t)pA[n] * d) >> shift);
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatMultDiagKernels group
+ */
@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_diag_i32s_rv32im.c
+ * Description:  32-bit integer diagonal matrix multiplication for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultDiag
+ */
+
+/**
+  @defgroup MatMultDiagKernels Diagonal matrix multiplication Kernels
+  This module contains the kernel functions for the multiplication of a matrix with a diagonal
+  matrix, see Diagonal matrix multiplication.
+ */
+
+/**
+  @addtogroup MatMultDiagKernels
+  @{
+ */
+
+/**
+  @brief Multiplication of a 32-bit integer matrix with a diagonal matrix kernel for
+         RV32IM extension.
+  @param[in]  pSrc   Points to the input matrix of shape MxN
+  @param[in]  M      Height of both matrices
+  @param[in]  N      Width of both matrices
+  @param[in]  pDiag  Points to the diagonal of D, M values for D * A or N values for A * D
+  @param[in]  right  If set, compute A * D (scale the columns) instead of D * A (scale the rows)
+  @param[in]  shift  Amount to shift each element
+  @param[out] pDst   Points to the output matrix, may be equal to pSrc
+  @return     none
+ */
+
+void plp_mat_mult_diag_i32s_rv32im(const int32_t *pSrc,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   const int32_t *pDiag,
+                                   uint32_t right,
+                                   int32_t shift,
+                                   int32_t *pDst) {
+
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    for (m = 0; m < M; m++) {
+        const int32_t *pA = pSrc + m * N;
+        int32_t *pOut = pDst + m * N;
+
+        if (right) {
+            for (n = 0; n < N; n++) {
+                pOut[n] = (pA[n] * pDiag[n]) >> shift;
+            }
+        } else {
+            // the factor of the row is loaded once
+            int32_t d = pDiag[m];
+            for (n = 0; n < N; n++) {
+                pOut[n] = (pA[n] * d) >> shift;
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatMultDiagKernels group
+ */
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_diag_i16.c
+ * Description:  Glue code for the 16-bit integer diagonal matrix multiplication
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatMultDiag Diagonal matrix multiplication
+  This module contains the glue code for the multiplication of a matrix A of shape MxN with a
+  diagonal matrix D, given by the vector of its diagonal elements. The kernel codes (kernels) are
+  in the Module Diagonal matrix multiplication Kernels.
+
+  Multiplying from the left scales the rows of A, and multiplying from the right scales its
+  columns:
+
+      `pDst[m,n] = (pSrc[m,n] * pDiag[m]) >> shift`    for D * A
+      `pDst[m,n] = (pSrc[m,n] * pDiag[n]) >> shift`    for A * D
+
+  Both take M * N multiplications, instead of the M * M * N (or M * N * N) multiplications of a
+  dense matrix product with D. For floating-point implementations, the bitshift operation is not
+  applied. The output matrix may be equal to the input matrix (in-place operation).
+ */
+
+/**
+  @addtogroup MatMultDiag
+  @{
+ */
+
+/**
+  @brief Glue code for the multiplication of a 16-bit integer matrix with a diagonal matrix.
+  @param[in]  pSrc   Points to the input matrix of shape MxN
+  @param[in]  M      Height of both matrices
+  @param[in]  N      Width of both matrices
+  @param[in]  pDiag  Points to the diagonal of D, M values for D * A or N values for A * D
+  @param[in]  right  If set, compute A * D (scale the columns) instead of D * A (scale the rows)
+  @param[in]  shift  Amount to shift each element
+  @param[out] pDst   Points to the output matrix, may be equal to pSrc
+  @return     none
+ */
+
+void plp_mat_mult_diag_i16(const int16_t *pSrc,
+                           uint32_t M,
+                           uint32_t N,
+                           const int16_t *pDiag,
+                           uint32_t right,
+                           int32_t shift,
+                           int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_mult_diag_i16s_rv32im(pSrc, M, N, pDiag, right, shift, pDst);
+    } else {
+        plp_mat_mult_diag_i16s_xpulpv2(pSrc, M, N, pDiag, right, shift, pDst);
+    }
+}
+
+/**
+  @} end of MatMultDiag group
+ */
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_diag_i16_parallel.c
+ * Description:  Glue code for the parallel 16-bit integer diagonal matrix multiplication
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultDiag
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel multiplication of a 16-bit integer matrix with a diagonal
+         matrix.
+  @param[in]  pSrc   Points to the input matrix of shape MxN
+  @param[in]  M      Height of both matrices
+  @param[in]  N      Width of both matrices
+  @param[in]  pDiag  Points to the diagonal of D, M values for D * A or N values for A * D
+  @param[in]  right  If set, compute A * D (scale the columns) instead of D * A (scale the rows)
+  @param[in]  shift  Amount to shift each element
+  @param[in]  nPE    Number of cores to use for computation
+  @param[out] pDst   Points to the output matrix, may be equal to pSrc
+  @return     none
+ */
+
+void plp_mat_mult_diag_i16_parallel(const int16_t *pSrc,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    const int16_t *pDiag,
+                                    uint32_t right,
+                                    int32_t shift,
+                                    uint32_t nPE,
+                                    int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_diag_instance_i16 args = { .pSrc = pSrc,
+                                                .M = M,
+                                                .N = N,
+                                                .pDiag = pDiag,
+                                                .right = right,
+                                                .shift = shift,
+                                                .nPE = nPE,
+                                                .pDst = pDst };
+
+        rt_team_fork(nPE, plp_mat_mult_diag_i16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatMultDiag group
+ */
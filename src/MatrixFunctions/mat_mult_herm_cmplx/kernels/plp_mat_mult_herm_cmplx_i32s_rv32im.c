@@ -0,0 +1,152 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_herm_cmplx_i32s_rv32im.c
+ * Description:  Matrix Hermitian matrix multiplication for complex 32-bit integers on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// element (m, o) of the output, for the rows and columns which do not fill a tile
+static void mat_mult_herm_cmplx_i32_dot(const int32_t *__restrict__ pSrcA,
+                                        const int32_t *__restrict__ pSrcB,
+                                        uint32_t N,
+                                        uint32_t m,
+                                        uint32_t o,
+                                        int32_t *pDst) {
+
+    int32_t sumRe = 0;
+    int32_t sumIm = 0;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        int32_t aRe = pSrcA[(m * N + n) * 2];
+        int32_t aIm = pSrcA[(m * N + n) * 2 + 1];
+        int32_t bRe = pSrcB[(o * N + n) * 2];
+        int32_t bIm = pSrcB[(o * N + n) * 2 + 1];
+        sumRe += aRe * bRe + aIm * bIm;
+        sumIm += aIm * bRe - aRe * bIm;
+    }
+
+    pDst[0] = sumRe;
+    pDst[1] = sumIm;
+}
+
+// block pPart of the output, computed in tiles of 2x2 elements
+static void mat_mult_herm_cmplx_i32_block(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          const plp_mat_partition_t *pPart,
+                                          int32_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o;
+
+    for (m = pPart->rowStart; m + 2 <= pPart->rowEnd; m += 2) {
+        for (o = pPart->colStart; o + 2 <= pPart->colEnd; o += 2) {
+            int32_t re00 = 0;
+            int32_t im00 = 0;
+            int32_t re01 = 0;
+            int32_t im01 = 0;
+            int32_t re10 = 0;
+            int32_t im10 = 0;
+            int32_t re11 = 0;
+            int32_t im11 = 0;
+            for (n = 0; n < N; n++) {
+                int32_t a0Re = pSrcA[(m * N + n) * 2];
+                int32_t a0Im = pSrcA[(m * N + n) * 2 + 1];
+                int32_t a1Re = pSrcA[((m + 1) * N + n) * 2];
+                int32_t a1Im = pSrcA[((m + 1) * N + n) * 2 + 1];
+                int32_t b0Re = pSrcB[(o * N + n) * 2];
+                int32_t b0Im = pSrcB[(o * N + n) * 2 + 1];
+                int32_t b1Re = pSrcB[((o + 1) * N + n) * 2];
+                int32_t b1Im = pSrcB[((o + 1) * N + n) * 2 + 1];
+                re00 += a0Re * b0Re + a0Im * b0Im;
+                im00 += a0Im * b0Re - a0Re * b0Im;
+                re01 += a0Re * b1Re + a0Im * b1Im;
+                im01 += a0Im * b1Re - a0Re * b1Im;
+                re10 += a1Re * b0Re + a1Im * b0Im;
+                im10 += a1Im * b0Re - a1Re * b0Im;
+                re11 += a1Re * b1Re + a1Im * b1Im;
+                im11 += a1Im * b1Re - a1Re * b1Im;
+            }
+            pDstC[(m * O + o) * 2] = re00;
+            pDstC[(m * O + o) * 2 + 1] = im00;
+            pDstC[(m * O + o + 1) * 2] = re01;
+            pDstC[(m * O + o + 1) * 2 + 1] = im01;
+            pDstC[((m + 1) * O + o) * 2] = re10;
+            pDstC[((m + 1) * O + o) * 2 + 1] = im10;
+            pDstC[((m + 1) * O + o + 1) * 2] = re11;
+            pDstC[((m + 1) * O + o + 1) * 2 + 1] = im11;
+        }
+        for (; o < pPart->colEnd; o++) {
+            mat_mult_herm_cmplx_i32_dot(pSrcA, pSrcB, N, m, o, &pDstC[(m * O + o) * 2]);
+            mat_mult_herm_cmplx_i32_dot(pSrcA, pSrcB, N, m + 1, o, &pDstC[((m + 1) * O + o) * 2]);
+        }
+    }
+    for (; m < pPart->rowEnd; m++) {
+        for (o = pPart->colStart; o < pPart->colEnd; o++) {
+            mat_mult_herm_cmplx_i32_dot(pSrcA, pSrcB, N, m, o, &pDstC[(m * O + o) * 2]);
+        }
+    }
+}
+
+/**
+  @ingroup MatMultHermCmplx
+ */
+
+/**
+  @defgroup MatMultHermCmplxKernels Complex Matrix Hermitian Matrix Multiplication Kernels
+  @{
+ */
+
+/**
+  @brief      Matrix Hermitian matrix multiplication for complex 32-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN, used conjugated
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Both input matrices are read along their rows, i.e. with unit stride, and the output is
+  computed in tiles of 2x2 elements, such that every loaded value is used twice.
+ */
+
+void plp_mat_mult_herm_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                         const int32_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         int32_t *__restrict__ pDstC) {
+
+    plp_mat_partition_t part = { .rowStart = 0, .rowEnd = M, .colStart = 0, .colEnd = O };
+
+    mat_mult_herm_cmplx_i32_block(pSrcA, pSrcB, N, O, &part, pDstC);
+}
+
+/**
+  @} end of MatMultHermCmplxKernels group
+ */
@@ -0,0 +1,167 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_herm_cmplx_q16s_rv32im.c
+ * Description:  Matrix Hermitian matrix multiplication for complex 16-bit fix-point on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// element (m, o) of the output, for the rows and columns which do not fill a tile
+static void mat_mult_herm_cmplx_q16_dot(const int16_t *__restrict__ pSrcA,
+                                        const int16_t *__restrict__ pSrcB,
+                                        uint32_t N,
+                                        uint32_t shift,
+                                        uint32_t m,
+                                        uint32_t o,
+                                        int16_t *pDst) {
+
+    int32_t round = shift ? 1 << (shift - 1) : 0;
+    int32_t sumRe = 0;
+    int32_t sumIm = 0;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        int32_t aRe = pSrcA[(m * N + n) * 2];
+        int32_t aIm = pSrcA[(m * N + n) * 2 + 1];
+        int32_t bRe = pSrcB[(o * N + n) * 2];
+        int32_t bIm = pSrcB[(o * N + n) * 2 + 1];
+        sumRe += (aRe * bRe + aIm * bIm + round) >> shift;
+        sumIm += (aIm * bRe - aRe * bIm + round) >> shift;
+    }
+
+    pDst[0] = (int16_t)sumRe;
+    pDst[1] = (int16_t)sumIm;
+}
+
+// block pPart of the output, computed in tiles of 2x2 elements
+static void mat_mult_herm_cmplx_q16_block(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          const plp_mat_partition_t *pPart,
+                                          int16_t *__restrict__ pDstC) {
+
+    int32_t round = shift ? 1 << (shift - 1) : 0;
+    uint32_t m, n, o;
+
+    for (m = pPart->rowStart; m + 2 <= pPart->rowEnd; m += 2) {
+        for (o = pPart->colStart; o + 2 <= pPart->colEnd; o += 2) {
+            int32_t re00 = 0;
+            int32_t im00 = 0;
+            int32_t re01 = 0;
+            int32_t im01 = 0;
+            int32_t re10 = 0;
+            int32_t im10 = 0;
+            int32_t re11 = 0;
+            int32_t im11 = 0;
+            for (n = 0; n < N; n++) {
+                int32_t a0Re = pSrcA[(m * N + n) * 2];
+                int32_t a0Im = pSrcA[(m * N + n) * 2 + 1];
+                int32_t a1Re = pSrcA[((m + 1) * N + n) * 2];
+                int32_t a1Im = pSrcA[((m + 1) * N + n) * 2 + 1];
+                int32_t b0Re = pSrcB[(o * N + n) * 2];
+                int32_t b0Im = pSrcB[(o * N + n) * 2 + 1];
+                int32_t b1Re = pSrcB[((o + 1) * N + n) * 2];
+                int32_t b1Im = pSrcB[((o + 1) * N + n) * 2 + 1];
+                re00 += (a0Re * b0Re + a0Im * b0Im + round) >> shift;
+                im00 += (a0Im * b0Re - a0Re * b0Im + round) >> shift;
+                re01 += (a0Re * b1Re + a0Im * b1Im + round) >> shift;
+                im01 += (a0Im * b1Re - a0Re * b1Im + round) >> shift;
+                re10 += (a1Re * b0Re + a1Im * b0Im + round) >> shift;
+                im10 += (a1Im * b0Re - a1Re * b0Im + round) >> shift;
+                re11 += (a1Re * b1Re + a1Im * b1Im + round) >> shift;
+                im11 += (a1Im * b1Re - a1Re * b1Im + round) >> shift;
+            }
+            pDstC[(m * O + o) * 2] = (int16_t)re00;
+            pDstC[(m * O + o) * 2 + 1] = (int16_t)im00;
+            pDstC[(m * O + o + 1) * 2] = (int16_t)re01;
+            pDstC[(m * O + o + 1) * 2 + 1] = (int16_t)im01;
+            pDstC[((m + 1) * O + o) * 2] = (int16_t)re10;
+            pDstC[((m + 1) * O + o) * 2 + 1] = (int16_t)im10;
+            pDstC[((m + 1) * O + o + 1) * 2] = (int16_t)re11;
+            pDstC[((m + 1) * O + o + 1) * 2 + 1] = (int16_t)im11;
+        }
+        for (; o < pPart->colEnd; o++) {
+            mat_mult_herm_cmplx_q16_dot(pSrcA, pSrcB, N, shift, m, o, &pDstC[(m * O + o) * 2]);
+            mat_mult_herm_cmplx_q16_dot(pSrcA, pSrcB, N, shift, m + 1, o,
+                                        &pDstC[((m + 1) * O + o) * 2]);
+        }
+    }
+    for (; m < pPart->rowEnd; m++) {
+        for (o = pPart->colStart; o < pPart->colEnd; o++) {
+            mat_mult_herm_cmplx_q16_dot(pSrcA, pSrcB, N, shift, m, o, &pDstC[(m * O + o) * 2]);
+        }
+    }
+}
+
+/**
+  @ingroup MatMultHermCmplx
+ */
+
+/**
+  @addtogroup MatMultHermCmplxKernels
+  @{
+ */
+
+/**
+  @brief      Matrix Hermitian matrix multiplication for complex 16-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN, used conjugated
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication to the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Both input matrices are read along their rows, i.e. with unit stride, and the output is
+  computed in tiles of 2x2 elements, such that every loaded value is used twice.
+
+  @par Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represented as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`. The output matrix is also
+  stored with the same number of bits as the inputs. Set the `shift` parameter such that no
+  overflow occurs.
+ */
+
+void plp_mat_mult_herm_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t shift,
+                                         int16_t *__restrict__ pDstC) {
+
+    plp_mat_partition_t part = { .rowStart = 0, .rowEnd = M, .colStart = 0, .colEnd = O };
+
+    mat_mult_herm_cmplx_q16_block(pSrcA, pSrcB, N, O, shift, &part, pDstC);
+}
+
+/**
+  @} end of MatMultHermCmplxKernels group
+ */
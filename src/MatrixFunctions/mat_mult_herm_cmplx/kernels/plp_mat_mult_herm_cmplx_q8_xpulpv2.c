@@ -0,0 +1,193 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_herm_cmplx_q8_xpulpv2.c
+ * Description:  Matrix Hermitian matrix multiplication for complex 8-bit fix-point on XpulpV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// element (m, o) of the output, for the rows and columns which do not fill a tile
+static void mat_mult_herm_cmplx_q8_dot(const int8_t *__restrict__ pSrcA,
+                                       const int8_t *__restrict__ pSrcB,
+                                       uint32_t N,
+                                       uint32_t shift,
+                                       uint32_t m,
+                                       uint32_t o,
+                                       int8_t *pDst) {
+
+    int32_t sumRe = 0;
+    int32_t sumIm = 0;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        int32_t aRe = pSrcA[(m * N + n) * 2];
+        int32_t aIm = pSrcA[(m * N + n) * 2 + 1];
+        int32_t bRe = pSrcB[(o * N + n) * 2];
+        int32_t bIm = pSrcB[(o * N + n) * 2 + 1];
+        sumRe += __ROUNDNORM_REG(aRe * bRe + aIm * bIm, shift);
+        sumIm += __ROUNDNORM_REG(aIm * bRe - aRe * bIm, shift);
+    }
+
+    pDst[0] = (int8_t)sumRe;
+    pDst[1] = (int8_t)sumIm;
+}
+
+// block pPart of the output, computed in tiles of 2x2 elements
+static void mat_mult_herm_cmplx_q8_block(const int8_t *__restrict__ pSrcA,
+                                         const int8_t *__restrict__ pSrcB,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t shift,
+                                         const plp_mat_partition_t *pPart,
+                                         int8_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o;
+
+    for (m = pPart->rowStart; m + 2 <= pPart->rowEnd; m += 2) {
+        for (o = pPart->colStart; o + 2 <= pPart->colEnd; o += 2) {
+            int32_t re00 = 0;
+            int32_t im00 = 0;
+            int32_t re01 = 0;
+            int32_t im01 = 0;
+            int32_t re10 = 0;
+            int32_t im10 = 0;
+            int32_t re11 = 0;
+            int32_t im11 = 0;
+            for (n = 0; n < N; n++) {
+                int32_t a0Re = pSrcA[(m * N + n) * 2];
+                int32_t a0Im = pSrcA[(m * N + n) * 2 + 1];
+                int32_t a1Re = pSrcA[((m + 1) * N + n) * 2];
+                int32_t a1Im = pSrcA[((m + 1) * N + n) * 2 + 1];
+                int32_t b0Re = pSrcB[(o * N + n) * 2];
+                int32_t b0Im = pSrcB[(o * N + n) * 2 + 1];
+                int32_t b1Re = pSrcB[((o + 1) * N + n) * 2];
+                int32_t b1Im = pSrcB[((o + 1) * N + n) * 2 + 1];
+                re00 += __ROUNDNORM_REG(a0Re * b0Re + a0Im * b0Im, shift);
+                im00 += __ROUNDNORM_REG(a0Im * b0Re - a0Re * b0Im, shift);
+                re01 += __ROUNDNORM_REG(a0Re * b1Re + a0Im * b1Im, shift);
+                im01 += __ROUNDNORM_REG(a0Im * b1Re - a0Re * b1Im, shift);
+                re10 += __ROUNDNORM_REG(a1Re * b0Re + a1Im * b0Im, shift);
+                im10 += __ROUNDNORM_REG(a1Im * b0Re - a1Re * b0Im, shift);
+                re11 += __ROUNDNORM_REG(a1Re * b1Re + a1Im * b1Im, shift);
+                im11 += __ROUNDNORM_REG(a1Im * b1Re - a1Re * b1Im, shift);
+            }
+            pDstC[(m * O + o) * 2] = (int8_t)re00;
+            pDstC[(m * O + o) * 2 + 1] = (int8_t)im00;
+            pDstC[(m * O + o + 1) * 2] = (int8_t)re01;
+            pDstC[(m * O + o + 1) * 2 + 1] = (int8_t)im01;
+            pDstC[((m + 1) * O + o) * 2] = (int8_t)re10;
+            pDstC[((m + 1) * O + o) * 2 + 1] = (int8_t)im10;
+            pDstC[((m + 1) * O + o + 1) * 2] = (int8_t)re11;
+            pDstC[((m + 1) * O + o + 1) * 2 + 1] = (int8_t)im11;
+        }
+        for (; o < pPart->colEnd; o++) {
+            mat_mult_herm_cmplx_q8_dot(pSrcA, pSrcB, N, shift, m, o, &pDstC[(m * O + o) * 2]);
+            mat_mult_herm_cmplx_q8_dot(pSrcA, pSrcB, N, shift, m + 1, o,
+                                       &pDstC[((m + 1) * O + o) * 2]);
+        }
+    }
+    for (; m < pPart->rowEnd; m++) {
+        for (o = pPart->colStart; o < pPart->colEnd; o++) {
+            mat_mult_herm_cmplx_q8_dot(pSrcA, pSrcB, N, shift, m, o, &pDstC[(m * O + o) * 2]);
+        }
+    }
+}
+
+/**
+  @ingroup MatMultHermCmplx
+ */
+
+/**
+  @addtogroup MatMultHermCmplxKernels
+  @{
+ */
+
+/**
+  @brief      Matrix Hermitian matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN, used conjugated
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication to the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Both input matrices are read along their rows, i.e. with unit stride, and the output is
+  computed in tiles of 2x2 elements, such that every loaded value is used twice.
+
+  @par Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represented as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`. The output matrix is also
+  stored with the same number of bits as the inputs. Set the `shift` parameter such that no
+  overflow occurs.
+ */
+
+void plp_mat_mult_herm_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                         const int8_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t shift,
+                                         int8_t *__restrict__ pDstC) {
+
+    plp_mat_partition_t part = { .rowStart = 0, .rowEnd = M, .colStart = 0, .colEnd = O };
+
+    mat_mult_herm_cmplx_q8_block(pSrcA, pSrcB, N, O, shift, &part, pDstC);
+}
+
+/**
+  @brief      Parallel matrix Hermitian matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
+                    plp_mat_mult_herm_cmplx_q8_parallel
+  @return     none
+
+  @par The output is split into a grid of rectangles with plp_mat_partition, one per core, and
+  every core computes its rectangle as plp_mat_mult_herm_cmplx_q8s_xpulpv2.
+
+  @par Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represented as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`. The output matrix is also
+  stored with the same number of bits as the inputs. Set the `shift` parameter such that no
+  overflow occurs.
+ */
+
+void plp_mat_mult_herm_cmplx_q8p_xpulpv2(void *args) {
+
+    plp_mat_mult_cmplx_instance_q8 *a = (plp_mat_mult_cmplx_instance_q8 *)args;
+
+    plp_mat_partition_t part;
+    plp_mat_partition(a->M, a->O, a->nPE, rt_core_id(), &part);
+
+    mat_mult_herm_cmplx_q8_block(a->pSrcA, a->pSrcB, a->N, a->O, a->shift, &part, a->pDstC);
+}
+
+/**
+  @} end of MatMultHermCmplxKernels group
+ */
@@ -66,8 +66,11 @@ void plp_mat_mult_trans_f32p_xpulpv2(void *args) {
 
     uint32_t m, n, o;
 
-    for (m = core_id; m < M; m += nPE) {
-        for (o = 0; o < O; o++) {
+    plp_mat_partition_t part;
+    plp_mat_partition(M, O, nPE, core_id, &part);
+
+    for (m = part.rowStart; m < part.rowEnd; m++) {
+        for (o = part.colStart; o < part.colEnd; o++) {
             float sum = 0;
             for (n = 0; n < N; n++) {
                 sum = sum + pSrcA[m * N + n] * pSrcB[o * N + n];
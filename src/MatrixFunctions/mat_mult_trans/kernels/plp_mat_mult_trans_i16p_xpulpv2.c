@@ -71,8 +71,11 @@ void plp_mat_mult_trans_i16p_xpulpv2(void *args) {
     uint32_t n; // loop counter for N
     uint32_t o; // loop counter for O
 
-    for (m = core_id; m < M; m += nPE) {
-        for (o = 0; o < O; o++) {
+    plp_mat_partition_t part;
+    plp_mat_partition(M, O, nPE, core_id, &part);
+
+    for (m = part.rowStart; m < part.rowEnd; m++) {
+        for (o = part.colStart; o < part.colEnd; o++) {
             int32_t sum = 0;
             for (n = 0; n < N; n++) {
                 sum = sum + pSrcA[m * N + n] * pSrcB[o * N + n];
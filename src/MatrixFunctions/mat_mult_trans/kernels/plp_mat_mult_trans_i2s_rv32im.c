@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_trans_i2s_rv32im.c
+ * Description:  Packed 2-bit integer matrix transposed matrix multiplication kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultTrans
+ */
+
+/**
+  @addtogroup MatMultTransKernels
+  @{
+ */
+
+/**
+   @brief Returns the element n of a packed 2-bit row, sign-extended to 32 bit.
+   @param[in]  p  points to the first byte of the row
+   @param[in]  n  index of the element
+   @return     element n of the row
+*/
+static inline int32_t plp_mat_mult_trans_i2_unpack(const int8_t *__restrict__ p, uint32_t n) {
+    // move the element to the upper bits of the byte, and shift it back arithmetically
+    return (int32_t)(int8_t)((uint32_t)p[n / 4] << (6 - 2 * (n & 3))) >> 6;
+}
+
+/**
+   @brief Matrix multiplication of packed 2-bit integer matrices, with the second matrix given
+          transposed, kernel for RV32IM extension.
+   @param[in]  pSrcA     points to the first input matrix (packed 2-bit, M x N)
+   @param[in]  pSrcB     points to the transposed second input matrix (packed 2-bit, O x N)
+   @param[in]  M         height of the first input matrix
+   @param[in]  N         width of the first input matrix and of the transposed second
+   @param[in]  O         height of the transposed second input matrix
+   @param[out] pDstC     points to the output matrix (M x O)
+   @return     none
+*/
+
+void plp_mat_mult_trans_i2s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   int32_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o;
+    uint32_t stride = (N + 3) / 4; // bytes between each row of A and B
+
+    for (m = 0; m < M; m++) {
+        const int8_t *pA = pSrcA + m * stride;
+        for (o = 0; o < O; o++) {
+            const int8_t *pB = pSrcB + o * stride;
+            int32_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += plp_mat_mult_trans_i2_unpack(pA, n) * plp_mat_mult_trans_i2_unpack(pB, n);
+            }
+            pDstC[m * O + o] = sum;
+        }
+    }
+}
+
+/**
+   @} end of MatMultTransKernels group
+*/
@@ -0,0 +1,175 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_trans_i2s_xpulpv2.c
+ * Description:  Packed 2-bit integer matrix transposed matrix multiplication kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultTrans
+ */
+
+/**
+  @addtogroup MatMultTransKernels
+  @{
+ */
+
+/**
+   @brief Returns the element n of a packed 2-bit row, sign-extended to 32 bit.
+   @param[in]  p  points to the first byte of the row
+   @param[in]  n  index of the element
+   @return     element n of the row
+*/
+static inline int32_t plp_mat_mult_trans_i2_unpack(const int8_t *__restrict__ p, uint32_t n) {
+    // move the element to the upper bits of the byte, and shift it back arithmetically
+    return (int32_t)(int8_t)((uint32_t)p[n / 4] << (6 - 2 * (n & 3))) >> 6;
+}
+
+/**
+   @brief Matrix multiplication of packed 2-bit integer matrices, with the second matrix given
+          transposed, kernel for XPULPV2 extension.
+   @param[in]  pSrcA     points to the first input matrix (packed 2-bit, M x N)
+   @param[in]  pSrcB     points to the transposed second input matrix (packed 2-bit, O x N)
+   @param[in]  M         height of the first input matrix
+   @param[in]  N         width of the first input matrix and of the transposed second
+   @param[in]  O         height of the transposed second input matrix
+   @param[out] pDstC     points to the output matrix (M x O)
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The output is computed in blocks of 2x2 elements, with all accumulators kept in registers.
+   The four crumbs of every byte of a word of sixteen elements are sign-extended to 8 bit with
+   vector shifts (pv.sll.b, pv.sra.b), and multiplied with four pv.sdotsp.b.
+*/
+
+void plp_mat_mult_trans_i2s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC) {
+
+    const v4s shift2 = { 2, 2, 2, 2 };
+    const v4s shift4 = { 4, 4, 4, 4 };
+    const v4s shift6 = { 6, 6, 6, 6 };
+
+    uint32_t m, n, o;
+    uint32_t stride = (N + 3) / 4; // bytes between each row of A and B
+
+    // compute blocks of 2x2 elements of C, consuming sixteen elements of each row at a time
+    for (m = 0; m + 1 < M; m += 2) {
+        const int8_t *pA0 = pSrcA + m * stride;
+        const int8_t *pA1 = pA0 + stride;
+
+        for (o = 0; o + 1 < O; o += 2) {
+            const int8_t *pB0 = pSrcB + o * stride;
+            const int8_t *pB1 = pB0 + stride;
+
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+
+            for (n = 0; n + 15 < N; n += 16) {
+                v4s a0 = *((v4s *)&pA0[n / 4]);
+                v4s a1 = *((v4s *)&pA1[n / 4]);
+                v4s b0 = *((v4s *)&pB0[n / 4]);
+                v4s b1 = *((v4s *)&pB1[n / 4]);
+                v4s a0x, a1x, b0x, b1x;
+
+                a0x = __SRA4(__SLL4(a0, shift6), shift6);
+                a1x = __SRA4(__SLL4(a1, shift6), shift6);
+                b0x = __SRA4(__SLL4(b0, shift6), shift6);
+                b1x = __SRA4(__SLL4(b1, shift6), shift6);
+                sum00 = __SUMDOTP4(a0x, b0x, sum00);
+                sum01 = __SUMDOTP4(a0x, b1x, sum01);
+                sum10 = __SUMDOTP4(a1x, b0x, sum10);
+                sum11 = __SUMDOTP4(a1x, b1x, sum11);
+
+                a0x = __SRA4(__SLL4(a0, shift4), shift6);
+                a1x = __SRA4(__SLL4(a1, shift4), shift6);
+                b0x = __SRA4(__SLL4(b0, shift4), shift6);
+                b1x = __SRA4(__SLL4(b1, shift4), shift6);
+                sum00 = __SUMDOTP4(a0x, b0x, sum00);
+                sum01 = __SUMDOTP4(a0x, b1x, sum01);
+                sum10 = __SUMDOTP4(a1x, b0x, sum10);
+                sum11 = __SUMDOTP4(a1x, b1x, sum11);
+
+                a0x = __SRA4(__SLL4(a0, shift2), shift6);
+                a1x = __SRA4(__SLL4(a1, shift2), shift6);
+                b0x = __SRA4(__SLL4(b0, shift2), shift6);
+                b1x = __SRA4(__SLL4(b1, shift2), shift6);
+                sum00 = __SUMDOTP4(a0x, b0x, sum00);
+                sum01 = __SUMDOTP4(a0x, b1x, sum01);
+                sum10 = __SUMDOTP4(a1x, b0x, sum10);
+                sum11 = __SUMDOTP4(a1x, b1x, sum11);
+
+                a0x = __SRA4(a0, shift6);
+                a1x = __SRA4(a1, shift6);
+                b0x = __SRA4(b0, shift6);
+                b1x = __SRA4(b1, shift6);
+                sum00 = __SUMDOTP4(a0x, b0x, sum00);
+                sum01 = __SUMDOTP4(a0x, b1x, sum01);
+                sum10 = __SUMDOTP4(a1x, b0x, sum10);
+                sum11 = __SUMDOTP4(a1x, b1x, sum11);
+            }
+
+            // leftover elements, if N is not a multiple of 16
+            for (; n < N; n++) {
+                int32_t a0 = plp_mat_mult_trans_i2_unpack(pA0, n);
+                int32_t a1 = plp_mat_mult_trans_i2_unpack(pA1, n);
+                int32_t b0 = plp_mat_mult_trans_i2_unpack(pB0, n);
+                int32_t b1 = plp_mat_mult_trans_i2_unpack(pB1, n);
+                sum00 += a0 * b0;
+                sum01 += a0 * b1;
+                sum10 += a1 * b0;
+                sum11 += a1 * b1;
+            }
+
+            pDstC[m * O + o] = sum00;
+            pDstC[m * O + o + 1] = sum01;
+            pDstC[(m + 1) * O + o] = sum10;
+            pDstC[(m + 1) * O + o + 1] = sum11;
+        }
+
+        // leftover column, if O is odd
+        if (o < O) {
+            plp_dot_prod_i2s_xpulpv2(pA0, pSrcB + o * stride, N, &pDstC[m * O + o]);
+            plp_dot_prod_i2s_xpulpv2(pA1, pSrcB + o * stride, N, &pDstC[(m + 1) * O + o]);
+        }
+    }
+
+    // leftover row, if M is odd
+    if (m < M) {
+        for (o = 0; o < O; o++) {
+            plp_dot_prod_i2s_xpulpv2(pSrcA + m * stride, pSrcB + o * stride, N, &pDstC[m * O + o]);
+        }
+    }
+}
+
+/**
+   @} end of MatMultTransKernels group
+*/
@@ -0,0 +1,219 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_trans_small_f32s_xpulpv2.c
+ * Description:  unrolled 32-bit floating-point matrix multiplication (transposed) of small matrices
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultTrans
+ */
+
+/**
+  @addtogroup MatMultTransKernels
+  @{
+ */
+
+/**
+  @brief Fully unrolled matrix multiplication of 2x2 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix, stored transposed in memory
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_trans_2x2_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcB,
+                                         float *__restrict__ pDstC) {
+
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1];
+    pDstC[1] = pSrcA[0] * pSrcB[2] + pSrcA[1] * pSrcB[3];
+    pDstC[2] = pSrcA[2] * pSrcB[0] + pSrcA[3] * pSrcB[1];
+    pDstC[3] = pSrcA[2] * pSrcB[2] + pSrcA[3] * pSrcB[3];
+}
+
+/**
+  @brief Fully unrolled matrix multiplication of 3x3 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix, stored transposed in memory
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_trans_3x3_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcB,
+                                         float *__restrict__ pDstC) {
+
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1] + pSrcA[2] * pSrcB[2];
+    pDstC[1] = pSrcA[0] * pSrcB[3] + pSrcA[1] * pSrcB[4] + pSrcA[2] * pSrcB[5];
+    pDstC[2] = pSrcA[0] * pSrcB[6] + pSrcA[1] * pSrcB[7] + pSrcA[2] * pSrcB[8];
+    pDstC[3] = pSrcA[3] * pSrcB[0] + pSrcA[4] * pSrcB[1] + pSrcA[5] * pSrcB[2];
+    pDstC[4] = pSrcA[3] * pSrcB[3] + pSrcA[4] * pSrcB[4] + pSrcA[5] * pSrcB[5];
+    pDstC[5] = pSrcA[3] * pSrcB[6] + pSrcA[4] * pSrcB[7] + pSrcA[5] * pSrcB[8];
+    pDstC[6] = pSrcA[6] * pSrcB[0] + pSrcA[7] * pSrcB[1] + pSrcA[8] * pSrcB[2];
+    pDstC[7] = pSrcA[6] * pSrcB[3] + pSrcA[7] * pSrcB[4] + pSrcA[8] * pSrcB[5];
+    pDstC[8] = pSrcA[6] * pSrcB[6] + pSrcA[7] * pSrcB[7] + pSrcA[8] * pSrcB[8];
+}
+
+/**
+  @brief Fully unrolled matrix multiplication of 4x4 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix, stored transposed in memory
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_trans_4x4_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcB,
+                                         float *__restrict__ pDstC) {
+
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1] + pSrcA[2] * pSrcB[2] +
+               pSrcA[3] * pSrcB[3];
+    pDstC[1] = pSrcA[0] * pSrcB[4] + pSrcA[1] * pSrcB[5] + pSrcA[2] * pSrcB[6] +
+               pSrcA[3] * pSrcB[7];
+    pDstC[2] = pSrcA[0] * pSrcB[8] + pSrcA[1] * pSrcB[9] + pSrcA[2] * pSrcB[10] +
+               pSrcA[3] * pSrcB[11];
+    pDstC[3] = pSrcA[0] * pSrcB[12] + pSrcA[1] * pSrcB[13] + pSrcA[2] * pSrcB[14] +
+               pSrcA[3] * pSrcB[15];
+    pDstC[4] = pSrcA[4] * pSrcB[0] + pSrcA[5] * pSrcB[1] + pSrcA[6] * pSrcB[2] +
+               pSrcA[7] * pSrcB[3];
+    pDstC[5] = pSrcA[4] * pSrcB[4] + pSrcA[5] * pSrcB[5] + pSrcA[6] * pSrcB[6] +
+               pSrcA[7] * pSrcB[7];
+    pDstC[6] = pSrcA[4] * pSrcB[8] + pSrcA[5] * pSrcB[9] + pSrcA[6] * pSrcB[10] +
+               pSrcA[7] * pSrcB[11];
+    pDstC[7] = pSrcA[4] * pSrcB[12] + pSrcA[5] * pSrcB[13] + pSrcA[6] * pSrcB[14] +
+               pSrcA[7] * pSrcB[15];
+    pDstC[8] = pSrcA[8] * pSrcB[0] + pSrcA[9] * pSrcB[1] + pSrcA[10] * pSrcB[2] +
+               pSrcA[11] * pSrcB[3];
+    pDstC[9] = pSrcA[8] * pSrcB[4] + pSrcA[9] * pSrcB[5] + pSrcA[10] * pSrcB[6] +
+               pSrcA[11] * pSrcB[7];
+    pDstC[10] = pSrcA[8] * pSrcB[8] + pSrcA[9] * pSrcB[9] + pSrcA[10] * pSrcB[10] +
+                pSrcA[11] * pSrcB[11];
+    pDstC[11] = pSrcA[8] * pSrcB[12] + pSrcA[9] * pSrcB[13] + pSrcA[10] * pSrcB[14] +
+                pSrcA[11] * pSrcB[15];
+    pDstC[12] = pSrcA[12] * pSrcB[0] + pSrcA[13] * pSrcB[1] + pSrcA[14] * pSrcB[2] +
+                pSrcA[15] * pSrcB[3];
+    pDstC[13] = pSrcA[12] * pSrcB[4] + pSrcA[13] * pSrcB[5] + pSrcA[14] * pSrcB[6] +
+                pSrcA[15] * pSrcB[7];
+    pDstC[14] = pSrcA[12] * pSrcB[8] + pSrcA[13] * pSrcB[9] + pSrcA[14] * pSrcB[10] +
+                pSrcA[15] * pSrcB[11];
+    pDstC[15] = pSrcA[12] * pSrcB[12] + pSrcA[13] * pSrcB[13] + pSrcA[14] * pSrcB[14] +
+                pSrcA[15] * pSrcB[15];
+}
+
+/**
+  @brief Fully unrolled matrix multiplication of 6x6 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix, stored transposed in memory
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_trans_6x6_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcB,
+                                         float *__restrict__ pDstC) {
+
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1] + pSrcA[2] * pSrcB[2] +
+               pSrcA[3] * pSrcB[3] + pSrcA[4] * pSrcB[4] + pSrcA[5] * pSrcB[5];
+    pDstC[1] = pSrcA[0] * pSrcB[6] + pSrcA[1] * pSrcB[7] + pSrcA[2] * pSrcB[8] +
+               pSrcA[3] * pSrcB[9] + pSrcA[4] * pSrcB[10] + pSrcA[5] * pSrcB[11];
+    pDstC[2] = pSrcA[0] * pSrcB[12] + pSrcA[1] * pSrcB[13] + pSrcA[2] * pSrcB[14] +
+               pSrcA[3] * pSrcB[15] + pSrcA[4] * pSrcB[16] + pSrcA[5] * pSrcB[17];
+    pDstC[3] = pSrcA[0] * pSrcB[18] + pSrcA[1] * pSrcB[19] + pSrcA[2] * pSrcB[20] +
+               pSrcA[3] * pSrcB[21] + pSrcA[4] * pSrcB[22] + pSrcA[5] * pSrcB[23];
+    pDstC[4] = pSrcA[0] * pSrcB[24] + pSrcA[1] * pSrcB[25] + pSrcA[2] * pSrcB[26] +
+               pSrcA[3] * pSrcB[27] + pSrcA[4] * pSrcB[28] + pSrcA[5] * pSrcB[29];
+    pDstC[5] = pSrcA[0] * pSrcB[30] + pSrcA[1] * pSrcB[31] + pSrcA[2] * pSrcB[32] +
+               pSrcA[3] * pSrcB[33] + pSrcA[4] * pSrcB[34] + pSrcA[5] * pSrcB[35];
+    pDstC[6] = pSrcA[6] * pSrcB[0] + pSrcA[7] * pSrcB[1] + pSrcA[8] * pSrcB[2] +
+               pSrcA[9] * pSrcB[3] + pSrcA[10] * pSrcB[4] + pSrcA[11] * pSrcB[5];
+    pDstC[7] = pSrcA[6] * pSrcB[6] + pSrcA[7] * pSrcB[7] + pSrcA[8] * pSrcB[8] +
+               pSrcA[9] * pSrcB[9] + pSrcA[10] * pSrcB[10] + pSrcA[11] * pSrcB[11];
+    pDstC[8] = pSrcA[6] * pSrcB[12] + pSrcA[7] * pSrcB[13] + pSrcA[8] * pSrcB[14] +
+               pSrcA[9] * pSrcB[15] + pSrcA[10] * pSrcB[16] + pSrcA[11] * pSrcB[17];
+    pDstC[9] = pSrcA[6] * pSrcB[18] + pSrcA[7] * pSrcB[19] + pSrcA[8] * pSrcB[20] +
+               pSrcA[9] * pSrcB[21] + pSrcA[10] * pSrcB[22] + pSrcA[11] * pSrcB[23];
+    pDstC[10] = pSrcA[6] * pSrcB[24] + pSrcA[7] * pSrcB[25] + pSrcA[8] * pSrcB[26] +
+                pSrcA[9] * pSrcB[27] + pSrcA[10] * pSrcB[28] + pSrcA[11] * pSrcB[29];
+    pDstC[11] = pSrcA[6] * pSrcB[30] + pSrcA[7] * pSrcB[31] + pSrcA[8] * pSrcB[32] +
+                pSrcA[9] * pSrcB[33] + pSrcA[10] * pSrcB[34] + pSrcA[11] * pSrcB[35];
+    pDstC[12] = pSrcA[12] * pSrcB[0] + pSrcA[13] * pSrcB[1] + pSrcA[14] * pSrcB[2] +
+                pSrcA[15] * pSrcB[3] + pSrcA[16] * pSrcB[4] + pSrcA[17] * pSrcB[5];
+    pDstC[13] = pSrcA[12] * pSrcB[6] + pSrcA[13] * pSrcB[7] + pSrcA[14] * pSrcB[8] +
+                pSrcA[15] * pSrcB[9] + pSrcA[16] * pSrcB[10] + pSrcA[17] * pSrcB[11];
+    pDstC[14] = pSrcA[12] * pSrcB[12] + pSrcA[13] * pSrcB[13] + pSrcA[14] * pSrcB[14] +
+                pSrcA[15] * pSrcB[15] + pSrcA[16] * pSrcB[16] + pSrcA[17] * pSrcB[17];
+    pDstC[15] = pSrcA[12] * pSrcB[18] + pSrcA[13] * pSrcB[19] + pSrcA[14] * pSrcB[20] +
+                pSrcA[15] * pSrcB[21] + pSrcA[16] * pSrcB[22] + pSrcA[17] * pSrcB[23];
+    pDstC[16] = pSrcA[12] * pSrcB[24] + pSrcA[13] * pSrcB[25] + pSrcA[14] * pSrcB[26] +
+                pSrcA[15] * pSrcB[27] + pSrcA[16] * pSrcB[28] + pSrcA[17] * pSrcB[29];
+    pDstC[17] = pSrcA[12] * pSrcB[30] + pSrcA[13] * pSrcB[31] + pSrcA[14] * pSrcB[32] +
+                pSrcA[15] * pSrcB[33] + pSrcA[16] * pSrcB[34] + pSrcA[17] * pSrcB[35];
+    pDstC[18] = pSrcA[18] * pSrcB[0] + pSrcA[19] * pSrcB[1] + pSrcA[20] * pSrcB[2] +
+                pSrcA[21] * pSrcB[3] + pSrcA[22] * pSrcB[4] + pSrcA[23] * pSrcB[5];
+    pDstC[19] = pSrcA[18] * pSrcB[6] + pSrcA[19] * pSrcB[7] + pSrcA[20] * pSrcB[8] +
+                pSrcA[21] * pSrcB[9] + pSrcA[22] * pSrcB[10] + pSrcA[23] * pSrcB[11];
+    pDstC[20] = pSrcA[18] * pSrcB[12] + pSrcA[19] * pSrcB[13] + pSrcA[20] * pSrcB[14] +
+                pSrcA[21] * pSrcB[15] + pSrcA[22] * pSrcB[16] + pSrcA[23] * pSrcB[17];
+    pDstC[21] = pSrcA[18] * pSrcB[18] + pSrcA[19] * pSrcB[19] + pSrcA[20] * pSrcB[20] +
+                pSrcA[21] * pSrcB[21] + pSrcA[22] * pSrcB[22] + pSrcA[23] * pSrcB[23];
+    pDstC[22] = pSrcA[18] * pSrcB[24] + pSrcA[19] * pSrcB[25] + pSrcA[20] * pSrcB[26] +
+                pSrcA[21] * pSrcB[27] + pSrcA[22] * pSrcB[28] + pSrcA[23] * pSrcB[29];
+    pDstC[23] = pSrcA[18] * pSrcB[30] + pSrcA[19] * pSrcB[31] + pSrcA[20] * pSrcB[32] +
+                pSrcA[21] * pSrcB[33] + pSrcA[22] * pSrcB[34] + pSrcA[23] * pSrcB[35];
+    pDstC[24] = pSrcA[24] * pSrcB[0] + pSrcA[25] * pSrcB[1] + pSrcA[26] * pSrcB[2] +
+                pSrcA[27] * pSrcB[3] + pSrcA[28] * pSrcB[4] + pSrcA[29] * pSrcB[5];
+    pDstC[25] = pSrcA[24] * pSrcB[6] + pSrcA[25] * pSrcB[7] + pSrcA[26] * pSrcB[8] +
+                pSrcA[27] * pSrcB[9] + pSrcA[28] * pSrcB[10] + pSrcA[29] * pSrcB[11];
+    pDstC[26] = pSrcA[24] * pSrcB[12] + pSrcA[25] * pSrcB[13] + pSrcA[26] * pSrcB[14] +
+                pSrcA[27] * pSrcB[15] + pSrcA[28] * pSrcB[16] + pSrcA[29] * pSrcB[17];
+    pDstC[27] = pSrcA[24] * pSrcB[18] + pSrcA[25] * pSrcB[19] + pSrcA[26] * pSrcB[20] +
+                pSrcA[27] * pSrcB[21] + pSrcA[28] * pSrcB[22] + pSrcA[29] * pSrcB[23];
+    pDstC[28] = pSrcA[24] * pSrcB[24] + pSrcA[25] * pSrcB[25] + pSrcA[26] * pSrcB[26] +
+                pSrcA[27] * pSrcB[27] + pSrcA[28] * pSrcB[28] + pSrcA[29] * pSrcB[29];
+    pDstC[29] = pSrcA[24] * pSrcB[30] + pSrcA[25] * pSrcB[31] + pSrcA[26] * pSrcB[32] +
+                pSrcA[27] * pSrcB[33] + pSrcA[28] * pSrcB[34] + pSrcA[29] * pSrcB[35];
+    pDstC[30] = pSrcA[30] * pSrcB[0] + pSrcA[31] * pSrcB[1] + pSrcA[32] * pSrcB[2] +
+                pSrcA[33] * pSrcB[3] + pSrcA[34] * pSrcB[4] + pSrcA[35] * pSrcB[5];
+    pDstC[31] = pSrcA[30] * pSrcB[6] + pSrcA[31] * pSrcB[7] + pSrcA[32] * pSrcB[8] +
+                pSrcA[33] * pSrcB[9] + pSrcA[34] * pSrcB[10] + pSrcA[35] * pSrcB[11];
+    pDstC[32] = pSrcA[30] * pSrcB[12] + pSrcA[31] * pSrcB[13] + pSrcA[32] * pSrcB[14] +
+                pSrcA[33] * pSrcB[15] + pSrcA[34] * pSrcB[16] + pSrcA[35] * pSrcB[17];
+    pDstC[33] = pSrcA[30] * pSrcB[18] + pSrcA[31] * pSrcB[19] + pSrcA[32] * pSrcB[20] +
+                pSrcA[33] * pSrcB[21] + pSrcA[34] * pSrcB[22] + pSrcA[35] * pSrcB[23];
+    pDstC[34] = pSrcA[30] * pSrcB[24] + pSrcA[31] * pSrcB[25] + pSrcA[32] * pSrcB[26] +
+                pSrcA[33] * pSrcB[27] + pSrcA[34] * pSrcB[28] + pSrcA[35] * pSrcB[29];
+    pDstC[35] = pSrcA[30] * pSrcB[30] + pSrcA[31] * pSrcB[31] + pSrcA[32] * pSrcB[32] +
+                pSrcA[33] * pSrcB[33] + pSrcA[34] * pSrcB[34] + pSrcA[35] * pSrcB[35];
+}
+
+/**
+   @} end of MatMultTransKernels group
+*/
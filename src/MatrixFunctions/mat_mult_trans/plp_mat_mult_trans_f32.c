@@ -48,6 +48,10 @@
   @param[in]  O         width of the second input matrix
   @param[out] pDstC     points to the output matrix
   @return     none
+
+  @par Small Matrices
+  Square matrices of size 2x2, 3x3, 4x4 and 6x6 are computed with the fully unrolled kernels
+  plp_mat_mult_trans_NxN_f32s_xpulpv2, which avoid the loop overhead.
  */
 
 void plp_mat_mult_trans_f32(const float *__restrict__ pSrcA,
@@ -61,6 +65,24 @@ void plp_mat_mult_trans_f32(const float *__restrict__ pSrcA,
         printf("Floating point is supported only for cluster side\n");
         return;
     } else {
+        if (M == N && N == O) {
+            switch (N) {
+            case 2:
+                plp_mat_mult_trans_2x2_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            case 3:
+                plp_mat_mult_trans_3x3_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            case 4:
+                plp_mat_mult_trans_4x4_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            case 6:
+                plp_mat_mult_trans_6x6_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            default:
+                break;
+            }
+        }
         plp_mat_mult_trans_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
     }
 }
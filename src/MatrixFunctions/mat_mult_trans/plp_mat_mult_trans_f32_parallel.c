@@ -49,6 +49,11 @@
   @param[in]  nPE       Number of cores to use
   @param[out] pDstC     points to the output matrix
   @return     none
+
+  @par Small Matrices
+  Square matrices of size 2x2, 3x3, 4x4 and 6x6 are computed on the calling core with the fully
+  unrolled kernels plp_mat_mult_trans_NxN_f32s_xpulpv2, because forking the team takes longer than the
+  computation itself.
  */
 
 void plp_mat_mult_trans_f32_parallel(const float *__restrict__ pSrcA,
@@ -63,6 +68,25 @@ void plp_mat_mult_trans_f32_parallel(const float *__restrict__ pSrcA,
         printf("parallel and floating-point processing supported only for cluster side\n");
         return;
     } else {
+        if (M == N && N == O) {
+            switch (N) {
+            case 2:
+                plp_mat_mult_trans_2x2_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            case 3:
+                plp_mat_mult_trans_3x3_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            case 4:
+                plp_mat_mult_trans_4x4_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            case 6:
+                plp_mat_mult_trans_6x6_f32s_xpulpv2(pSrcA, pSrcB, pDstC);
+                return;
+            default:
+                break;
+            }
+        }
+
         plp_mat_mult_instance_f32 args = {
             .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC
         };
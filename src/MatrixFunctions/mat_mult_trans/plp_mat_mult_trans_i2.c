@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_trans_i2.c
+ * Description:  Packed 2-bit integer matrix transposed matrix multiplication glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultTrans
+  @{
+ */
+
+/**
+  @brief Glue code for matrix multiplication of packed 2-bit integer matrices, with the second
+         matrix given transposed.
+  @param[in]  pSrcA     points to the first input matrix (packed 2-bit, M x N)
+  @param[in]  pSrcB     points to the transposed second input matrix (packed 2-bit, O x N)
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and of the transposed second
+  @param[in]  O         height of the transposed second input matrix
+  @param[out] pDstC     points to the output matrix (M x O)
+  @return     none
+
+  @par Packing
+  The matrices hold signed 2-bit values, packed four per byte. Element n of a row is stored in bits
+  2 * (n % 4) and 2 * (n % 4) + 1 of byte n / 4. Every row starts at a new byte, i.e., a row takes
+  (N + 3) / 4 bytes. Both A and the transposed B are read along their rows, which matches the
+  layout of quantized weights and of an im2col buffer of a convolution.
+
+  @par Kernel Tiers
+  The cluster uses plp_mat_mult_trans_i2s_xpulpnn if the library is built with PLP_MATH_XPULPNN
+  (make PLP_MATH_XPULPNN=1), and plp_mat_mult_trans_i2s_xpulpv2 otherwise.
+ */
+
+void plp_mat_mult_trans_i2(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           int32_t *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_mult_trans_i2s_rv32im(pSrcA, pSrcB, M, N, O, pDstC);
+    } else {
+#ifdef PLP_MATH_XPULPNN
+        plp_mat_mult_trans_i2s_xpulpnn(pSrcA, pSrcB, M, N, O, pDstC);
+#else
+        plp_mat_mult_trans_i2s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
+#endif
+    }
+}
+
+/**
+  @} end of MatMultTrans group
+ */
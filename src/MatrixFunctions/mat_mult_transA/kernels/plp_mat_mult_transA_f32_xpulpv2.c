@@ -0,0 +1,154 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_transA_f32_xpulpv2.c
+ * Description:  32-bit floating-point transposed matrix matrix multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// element (m, o) of the output, for the rows and columns which do not fill a tile
+static float mat_mult_transA_f32_dot(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t m,
+                                     uint32_t o) {
+
+    float sum = 0;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        sum += pSrcA[n * M + m] * pSrcB[n * O + o];
+    }
+
+    return sum;
+}
+
+// block pPart of the output, computed in tiles of 2x2 elements
+static void mat_mult_transA_f32_block(const float *__restrict__ pSrcA,
+                                      const float *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      const plp_mat_partition_t *pPart,
+                                      float *__restrict__ pDstC) {
+
+    uint32_t m, n, o, i;
+
+    for (m = pPart->rowStart; m + 2 <= pPart->rowEnd; m += 2) {
+        for (o = pPart->colStart; o + 2 <= pPart->colEnd; o += 2) {
+            float sum00 = 0;
+            float sum01 = 0;
+            float sum10 = 0;
+            float sum11 = 0;
+            for (n = 0; n < N; n++) {
+                float a0 = pSrcA[n * M + m];
+                float a1 = pSrcA[n * M + m + 1];
+                float b0 = pSrcB[n * O + o];
+                float b1 = pSrcB[n * O + o + 1];
+                sum00 += a0 * b0;
+                sum01 += a0 * b1;
+                sum10 += a1 * b0;
+                sum11 += a1 * b1;
+            }
+            pDstC[m * O + o] = (float)sum00;
+            pDstC[m * O + o + 1] = (float)sum01;
+            pDstC[(m + 1) * O + o] = (float)sum10;
+            pDstC[(m + 1) * O + o + 1] = (float)sum11;
+        }
+        for (; o < pPart->colEnd; o++) {
+            for (i = 0; i < 2; i++) {
+                pDstC[(m + i) * O + o] = mat_mult_transA_f32_dot(pSrcA, pSrcB, M, N, O, m + i, o);
+            }
+        }
+    }
+    for (; m < pPart->rowEnd; m++) {
+        for (o = pPart->colStart; o < pPart->colEnd; o++) {
+            pDstC[m * O + o] = mat_mult_transA_f32_dot(pSrcA, pSrcB, M, N, O, m, o);
+        }
+    }
+}
+
+/**
+  @ingroup MatMultTransA
+ */
+
+/**
+  @addtogroup MatMultTransAKernels
+  @{
+ */
+
+/**
+  @brief Transposed matrix matrix multiplication of 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pSrcA     points to the first input matrix, stored transposed in memory (NxM)
+  @param[in]  pSrcB     points to the second input matrix of shape NxO
+  @param[in]  M         height of the output matrix, width of the stored first matrix
+  @param[in]  N         height of both stored input matrices
+  @param[in]  O         width of the second input matrix and of the output matrix
+  @param[out] pDstC     points to the output matrix of shape MxO
+  @return     none
+
+  @par Both input matrices are read along their rows, i.e. with unit stride. The output is
+  computed in tiles of 2x2 elements, such that every loaded value is used twice.
+ */
+
+void plp_mat_mult_transA_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                      const float *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      float *__restrict__ pDstC) {
+
+    plp_mat_partition_t part = { .rowStart = 0, .rowEnd = M, .colStart = 0, .colEnd = O };
+
+    mat_mult_transA_f32_block(pSrcA, pSrcB, M, N, O, &part, pDstC);
+}
+
+/**
+  @brief Parallel transposed matrix matrix multiplication of 32-bit floating-point matrices kernel
+         for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
+                    plp_mat_mult_transA_f32_parallel
+  @return     none
+
+  @par The output is split into a grid of rectangles with plp_mat_partition, one per core, and
+  every core computes its rectangle as plp_mat_mult_transA_f32s_xpulpv2.
+ */
+
+void plp_mat_mult_transA_f32p_xpulpv2(void *args) {
+
+    plp_mat_mult_instance_f32 *a = (plp_mat_mult_instance_f32 *)args;
+
+    plp_mat_partition_t part;
+    plp_mat_partition(a->M, a->O, a->nPE, rt_core_id(), &part);
+
+    mat_mult_transA_f32_block(a->pSrcA, a->pSrcB, a->M, a->N, a->O, &part, a->pDstC);
+}
+
+/**
+  @} end of MatMultTransAKernels group
+ */
@@ -0,0 +1,133 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_transA_i16s_rv32im.c
+ * Description:  16-bit integer transposed matrix matrix multiplication for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// element (m, o) of the output, for the rows and columns which do not fill a tile
+static int32_t mat_mult_transA_i16_dot(const int16_t *__restrict__ pSrcA,
+                                       const int16_t *__restrict__ pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       uint32_t m,
+                                       uint32_t o) {
+
+    int32_t sum = 0;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        sum += pSrcA[n * M + m] * pSrcB[n * O + o];
+    }
+
+    return sum;
+}
+
+// block pPart of the output, computed in tiles of 2x2 elements
+static void mat_mult_transA_i16_block(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      const plp_mat_partition_t *pPart,
+                                      int32_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o, i;
+
+    for (m = pPart->rowStart; m + 2 <= pPart->rowEnd; m += 2) {
+        for (o = pPart->colStart; o + 2 <= pPart->colEnd; o += 2) {
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+            for (n = 0; n < N; n++) {
+                int32_t a0 = pSrcA[n * M + m];
+                int32_t a1 = pSrcA[n * M + m + 1];
+                int32_t b0 = pSrcB[n * O + o];
+                int32_t b1 = pSrcB[n * O + o + 1];
+                sum00 += a0 * b0;
+                sum01 += a0 * b1;
+                sum10 += a1 * b0;
+                sum11 += a1 * b1;
+            }
+            pDstC[m * O + o] = (int32_t)sum00;
+            pDstC[m * O + o + 1] = (int32_t)sum01;
+            pDstC[(m + 1) * O + o] = (int32_t)sum10;
+            pDstC[(m + 1) * O + o + 1] = (int32_t)sum11;
+        }
+        for (; o < pPart->colEnd; o++) {
+            for (i = 0; i < 2; i++) {
+                pDstC[(m + i) * O + o] = mat_mult_transA_i16_dot(pSrcA, pSrcB, M, N, O, m + i, o);
+            }
+        }
+    }
+    for (; m < pPart->rowEnd; m++) {
+        for (o = pPart->colStart; o < pPart->colEnd; o++) {
+            pDstC[m * O + o] = mat_mult_transA_i16_dot(pSrcA, pSrcB, M, N, O, m, o);
+        }
+    }
+}
+
+/**
+  @ingroup MatMultTransA
+ */
+
+/**
+  @addtogroup MatMultTransAKernels
+  @{
+ */
+
+/**
+  @brief Transposed matrix matrix multiplication of 16-bit integer matrices kernel for RV32IM
+         extension.
+  @param[in]  pSrcA     points to the first input matrix, stored transposed in memory (NxM)
+  @param[in]  pSrcB     points to the second input matrix of shape NxO
+  @param[in]  M         height of the output matrix, width of the stored first matrix
+  @param[in]  N         height of both stored input matrices
+  @param[in]  O         width of the second input matrix and of the output matrix
+  @param[out] pDstC     points to the output matrix of shape MxO
+  @return     none
+
+  @par Both input matrices are read along their rows, i.e. with unit stride. The output is
+  computed in tiles of 2x2 elements, such that every loaded value is used twice.
+ */
+
+void plp_mat_mult_transA_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC) {
+
+    plp_mat_partition_t part = { .rowStart = 0, .rowEnd = M, .colStart = 0, .colEnd = O };
+
+    mat_mult_transA_i16_block(pSrcA, pSrcB, M, N, O, &part, pDstC);
+}
+
+/**
+  @} end of MatMultTransAKernels group
+ */
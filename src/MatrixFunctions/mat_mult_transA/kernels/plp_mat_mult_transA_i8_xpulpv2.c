@@ -0,0 +1,181 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_transA_i8_xpulpv2.c
+ * Description:  8-bit integer transposed matrix matrix multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// element (m, o) of the output, for the rows and columns which do not fill a tile
+static int32_t mat_mult_transA_i8_dot(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t m,
+                                      uint32_t o) {
+
+    int32_t sum = 0;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        sum += pSrcA[n * M + m] * pSrcB[n * O + o];
+    }
+
+    return sum;
+}
+
+// transposes the 4x4 block at pSrc of a matrix with the given width, such that pCol[i] holds
+// column i of the four rows
+static inline void mat_mult_transA_i8_columns(const int8_t *pSrc, uint32_t width, v4s *pCol) {
+
+    v4s r0 = *((v4s *)&pSrc[0]);
+    v4s r1 = *((v4s *)&pSrc[width]);
+    v4s r2 = *((v4s *)&pSrc[2 * width]);
+    v4s r3 = *((v4s *)&pSrc[3 * width]);
+    v4s t0 = __builtin_shuffle(r0, r1, (v4s){ 0, 4, 1, 5 });
+    v4s t1 = __builtin_shuffle(r2, r3, (v4s){ 0, 4, 1, 5 });
+    v4s t2 = __builtin_shuffle(r0, r1, (v4s){ 2, 6, 3, 7 });
+    v4s t3 = __builtin_shuffle(r2, r3, (v4s){ 2, 6, 3, 7 });
+
+    pCol[0] = __builtin_shuffle(t0, t1, (v4s){ 0, 1, 4, 5 });
+    pCol[1] = __builtin_shuffle(t0, t1, (v4s){ 2, 3, 6, 7 });
+    pCol[2] = __builtin_shuffle(t2, t3, (v4s){ 0, 1, 4, 5 });
+    pCol[3] = __builtin_shuffle(t2, t3, (v4s){ 2, 3, 6, 7 });
+}
+
+// block pPart of the output, computed in tiles of 4x4 elements
+static void mat_mult_transA_i8_block(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     const plp_mat_partition_t *pPart,
+                                     int32_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o, i;
+
+    for (m = pPart->rowStart; m + 4 <= pPart->rowEnd; m += 4) {
+        for (o = pPart->colStart; o + 4 <= pPart->colEnd; o += 4) {
+            int32_t sum[4][4] = { { 0 } };
+            uint32_t j;
+            for (n = 0; n + 3 < N; n += 4) {
+                v4s aCol[4];
+                v4s bCol[4];
+                mat_mult_transA_i8_columns(&pSrcA[n * M + m], M, aCol);
+                mat_mult_transA_i8_columns(&pSrcB[n * O + o], O, bCol);
+                for (i = 0; i < 4; i++) {
+                    for (j = 0; j < 4; j++) {
+                        sum[i][j] = __SUMDOTP4(aCol[i], bCol[j], sum[i][j]);
+                    }
+                }
+            }
+            for (; n < N; n++) {
+                for (i = 0; i < 4; i++) {
+                    for (j = 0; j < 4; j++) {
+                        sum[i][j] += pSrcA[n * M + m + i] * pSrcB[n * O + o + j];
+                    }
+                }
+            }
+            for (i = 0; i < 4; i++) {
+                for (j = 0; j < 4; j++) {
+                    pDstC[(m + i) * O + o + j] = sum[i][j];
+                }
+            }
+        }
+        for (; o < pPart->colEnd; o++) {
+            for (i = 0; i < 4; i++) {
+                pDstC[(m + i) * O + o] = mat_mult_transA_i8_dot(pSrcA, pSrcB, M, N, O, m + i, o);
+            }
+        }
+    }
+    for (; m < pPart->rowEnd; m++) {
+        for (o = pPart->colStart; o < pPart->colEnd; o++) {
+            pDstC[m * O + o] = mat_mult_transA_i8_dot(pSrcA, pSrcB, M, N, O, m, o);
+        }
+    }
+}
+
+/**
+  @ingroup MatMultTransA
+ */
+
+/**
+  @addtogroup MatMultTransAKernels
+  @{
+ */
+
+/**
+  @brief Transposed matrix matrix multiplication of 8-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA     points to the first input matrix, stored transposed in memory (NxM)
+  @param[in]  pSrcB     points to the second input matrix of shape NxO
+  @param[in]  M         height of the output matrix, width of the stored first matrix
+  @param[in]  N         height of both stored input matrices
+  @param[in]  O         width of the second input matrix and of the output matrix
+  @param[out] pDstC     points to the output matrix of shape MxO
+  @return     none
+
+  @par Both input matrices are read along their rows, i.e. with unit stride. The output is
+  computed in tiles of 4x4 elements. Four rows of each input are loaded as vectors and
+  transposed with shuffles into quadruples of the same column, which feed pv.sdotsp.b.
+ */
+
+void plp_mat_mult_transA_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC) {
+
+    plp_mat_partition_t part = { .rowStart = 0, .rowEnd = M, .colStart = 0, .colEnd = O };
+
+    mat_mult_transA_i8_block(pSrcA, pSrcB, M, N, O, &part, pDstC);
+}
+
+/**
+  @brief Parallel transposed matrix matrix multiplication of 8-bit integer matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
+                    plp_mat_mult_transA_i8_parallel
+  @return     none
+
+  @par The output is split into a grid of rectangles with plp_mat_partition, one per core, and
+  every core computes its rectangle as plp_mat_mult_transA_i8s_xpulpv2.
+ */
+
+void plp_mat_mult_transA_i8p_xpulpv2(void *args) {
+
+    plp_mat_mult_instance_i8 *a = (plp_mat_mult_instance_i8 *)args;
+
+    plp_mat_partition_t part;
+    plp_mat_partition(a->M, a->O, a->nPE, rt_core_id(), &part);
+
+    mat_mult_transA_i8_block(a->pSrcA, a->pSrcB, a->M, a->N, a->O, &part, a->pDstC);
+}
+
+/**
+  @} end of MatMultTransAKernels group
+ */
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_transA_f32_parallel.c
+ * Description:  Parallel 32-bit floating-point transposed matrix matrix multiplication glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultTransA
+  @{
+ */
+
+/**
+  @brief Glue code for parallel transposed matrix matrix multiplication of 32-bit floating-point
+         matrices.
+  @param[in]  pSrcA     points to the first input matrix, stored transposed in memory (NxM)
+  @param[in]  pSrcB     points to the second input matrix of shape NxO
+  @param[in]  M         height of the output matrix, width of the stored first matrix
+  @param[in]  N         height of both stored input matrices
+  @param[in]  O         width of the second input matrix and of the output matrix
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDstC     points to the output matrix of shape MxO
+  @return     none
+ */
+
+void plp_mat_mult_transA_f32_parallel(const float *__restrict__ pSrcA,
+                                      const float *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t nPE,
+                                      float *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_instance_f32 args = { .pSrcA = pSrcA,
+                                           .pSrcB = pSrcB,
+                                           .M = M,
+                                           .N = N,
+                                           .O = O,
+                                           .nPE = nPE,
+                                           .pDstC = pDstC };
+
+        rt_team_fork(nPE, plp_mat_mult_transA_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatMultTransA group
+ */
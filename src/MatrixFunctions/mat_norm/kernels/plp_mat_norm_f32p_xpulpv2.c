@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_norm_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point matrix norm for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// largest sum of the absolute values of the lines [start, end), with len elements each, where
+// element k of line l is pSrc[l * lineStride + k * elemStride]
+static inline float plp_mat_norm_f32_max_abs_sum(const float *pSrc,
+                                                 uint32_t start,
+                                                 uint32_t end,
+                                                 uint32_t len,
+                                                 uint32_t lineStride,
+                                                 uint32_t elemStride) {
+
+    uint32_t l, k;
+    float max = 0.0f;
+
+    for (l = start; l < end; l++) {
+        const float *p = pSrc + l * lineStride;
+        float sum = 0.0f;
+        for (k = 0; k < len; k++) {
+            sum += fabsf(*p);
+            p += elemStride;
+        }
+        if (sum > max) {
+            max = sum;
+        }
+    }
+
+    return max;
+}
+
+/**
+  @ingroup MatNorm
+ */
+
+/**
+  @addtogroup MatNormKernels
+  @{
+ */
+
+/**
+  @brief Parallel norm of a 32-bit floating-point matrix kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_norm_instance_f32 struct initialized by
+                    plp_mat_norm_f32_parallel
+  @return     none
+
+  @par Parallelization
+  For the Frobenius norm, every core computes the dot product of a contiguous chunk of the elements
+  with itself, and the partial sums are added up with plp_team_reduce_sum_f32. For the 1-norm
+  (inf-norm), every core computes the largest sum of a contiguous chunk of the columns (rows), and
+  the largest one is found with plp_team_reduce_max_f32. Both leave the result in the first entry
+  of the result buffer, which holds the squared Frobenius norm.
+ */
+
+void plp_mat_norm_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_norm_instance_f32 *a = (plp_mat_norm_instance_f32 *)args;
+
+    const float *pSrc = a->pSrc;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *resBufferPE = &(a->resBuffer[core_id]);
+    uint32_t start, end;
+
+    switch (a->normType) {
+    case PLP_MAT_NORM_FRO:
+        plp_team_chunk(M * N, nPE, core_id, 1, &start, &end);
+        plp_dot_prod_f32s_xpulpv2(pSrc + start, pSrc + start, end - start, resBufferPE);
+        plp_team_reduce_sum_f32(a->resBuffer, 1, nPE);
+        break;
+    case PLP_MAT_NORM_1:
+        plp_team_chunk(N, nPE, core_id, 1, &start, &end);
+        *resBufferPE = plp_mat_norm_f32_max_abs_sum(pSrc, start, end, M, 1, N);
+        plp_team_reduce_max_f32(a->resBuffer, 1, nPE);
+        break;
+    default:
+        plp_team_chunk(M, nPE, core_id, 1, &start, &end);
+        *resBufferPE = plp_mat_norm_f32_max_abs_sum(pSrc, start, end, N, N, 1);
+        plp_team_reduce_max_f32(a->resBuffer, 1, nPE);
+        break;
+    }
+}
+
+/**
+   @} end of MatNormKernels group
+*/
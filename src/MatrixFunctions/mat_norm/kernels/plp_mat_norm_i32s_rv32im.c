@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_norm_i32s_rv32im.c
+ * Description:  32-bit integer matrix norm for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// largest sum of the absolute values of the lines [start, end), with len elements each, where
+// element k of line l is pSrc[l * lineStride + k * elemStride]
+static inline int32_t plp_mat_norm_i32_max_abs_sum(const int32_t *pSrc,
+                                                   uint32_t start,
+                                                   uint32_t end,
+                                                   uint32_t len,
+                                                   uint32_t lineStride,
+                                                   uint32_t elemStride) {
+
+    uint32_t l, k;
+    int32_t max = 0;
+
+    for (l = start; l < end; l++) {
+        const int32_t *p = pSrc + l * lineStride;
+        int32_t sum = 0;
+        for (k = 0; k < len; k++) {
+            sum += (*p < 0) ? -(int32_t)*p : *p;
+            p += elemStride;
+        }
+        if (sum > max) {
+            max = sum;
+        }
+    }
+
+    return max;
+}
+
+/**
+  @ingroup MatNorm
+ */
+
+/**
+  @addtogroup MatNormKernels
+  @{
+ */
+
+/**
+  @brief Norm of a 32-bit integer matrix kernel for RV32IM extension.
+  @param[in]  pSrc      Points to the input matrix
+  @param[in]  M         Height of the matrix
+  @param[in]  N         Width of the matrix
+  @param[in]  normType  Norm to compute, see plp_mat_norm_t
+  @param[out] pRes      Points to the result, the squared Frobenius norm, the 1-norm or the inf-norm
+  @return     none
+ */
+
+void plp_mat_norm_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              plp_mat_norm_t normType,
+                              int32_t *__restrict__ pRes) {
+
+    switch (normType) {
+    case PLP_MAT_NORM_FRO:
+        // the squared Frobenius norm is the dot product of the matrix with itself
+        plp_dot_prod_i32s_rv32im(pSrc, pSrc, M * N, pRes);
+        break;
+    case PLP_MAT_NORM_1:
+        *pRes = plp_mat_norm_i32_max_abs_sum(pSrc, 0, N, M, 1, N);
+        break;
+    default:
+        *pRes = plp_mat_norm_i32_max_abs_sum(pSrc, 0, M, N, N, 1);
+        break;
+    }
+}
+
+/**
+   @} end of MatNormKernels group
+*/
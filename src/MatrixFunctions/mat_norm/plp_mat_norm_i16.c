@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_norm_i16.c
+ * Description:  16-bit integer matrix norm glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatNorm matrix norms
+  This module contains the glue code for matrix norms. The kernel codes (kernels) are in the
+  Module matrix norms Kernels.
+
+  The norm of a matrix of dimension MxN is selected with normType:
+
+  name             | value
+  ---------------- | ---------------------------------------------------------------------------
+  PLP_MAT_NORM_FRO | Frobenius norm, sqrt(sum of pSrc[m, n]^2)
+  PLP_MAT_NORM_1   | 1-norm, largest sum of the absolute values of a column
+  PLP_MAT_NORM_INF | inf-norm, largest sum of the absolute values of a row
+
+  The integer functions return the square of the Frobenius norm, which is the dot product of the
+  matrix with itself, and all integer results are accumulated with 32 bits, which may wrap around.
+  They can also be used for fix-point matrices: the 1- and inf-norm have the same fix-point as the
+  matrix, and the squared Frobenius norm twice as many fractional bits.
+
+  The Frobenius norm is computed in a single pass with the dot product kernels, which use the SIMD
+  instructions. The parallel versions split the elements (Frobenius norm), the columns (1-norm) or
+  the rows (inf-norm) across the cores, and combine the partial results of the cores inside the
+  fork with plp_team_reduce_sum_i32 / plp_team_reduce_sum_f32 or plp_team_reduce_max_i32 /
+  plp_team_reduce_max_f32.
+ */
+
+/**
+  @addtogroup MatNorm
+  @{
+ */
+
+/**
+  @brief Glue code for the norm of a 16-bit integer matrix.
+  @param[in]  pSrc      Points to the input matrix
+  @param[in]  M         Height of the matrix
+  @param[in]  N         Width of the matrix
+  @param[in]  normType  Norm to compute, see plp_mat_norm_t
+  @param[out] pRes      Points to the result, the squared Frobenius norm, the 1-norm or the inf-norm
+  @return     none
+ */
+
+void plp_mat_norm_i16(const int16_t *__restrict__ pSrc,
+                      uint32_t M,
+                      uint32_t N,
+                      plp_mat_norm_t normType,
+                      int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_norm_i16s_rv32im(pSrc, M, N, normType, pRes);
+    } else {
+        plp_mat_norm_i16s_xpulpv2(pSrc, M, N, normType, pRes);
+    }
+}
+
+/**
+  @} end of MatNorm group
+ */
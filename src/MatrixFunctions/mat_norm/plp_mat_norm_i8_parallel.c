@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_norm_i8_parallel.c
+ * Description:  parallel 8-bit integer matrix norm glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatNorm
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel norm of a 8-bit integer matrix.
+  @param[in]  pSrc      Points to the input matrix
+  @param[in]  M         Height of the matrix
+  @param[in]  N         Width of the matrix
+  @param[in]  normType  Norm to compute, see plp_mat_norm_t
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pRes      Points to the result, the squared Frobenius norm, the 1-norm or the inf-norm
+  @return     none
+ */
+
+void plp_mat_norm_i8_parallel(const int8_t *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              plp_mat_norm_t normType,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        int32_t resBuffer[nPE];
+
+        plp_mat_norm_instance_i8 args = {
+            .pSrc = pSrc, .M = M, .N = N, .normType = normType, .nPE = nPE, .resBuffer = resBuffer
+        };
+
+        // the cores combine their partial results in a tree, which leaves the result in
+        // resBuffer[0]
+        rt_team_fork(nPE, plp_mat_norm_i8p_xpulpv2, (void *)&args);
+
+        *pRes = resBuffer[0];
+    }
+}
+
+/**
+  @} end of MatNorm group
+ */
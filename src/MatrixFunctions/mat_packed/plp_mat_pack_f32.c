@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_pack_f32.c
+ * Description:  Glue code for packing the lower triangle of a 32-bit floating-point matrix
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatPacked Packed triangular and symmetric matrices
+  This module contains functions to convert between dense and packed storage. The packed format
+  stores the lower triangle of an NxN matrix row by row, such that element (i, j) with j <= i is
+  at index PLP_MAT_PACKED_IDX(i, j) = i * (i + 1) / 2 + j, and the matrix needs
+  PLP_MAT_PACKED_LEN(N) = N * (N + 1) / 2 values instead of N * N.
+
+  A packed symmetric matrix is defined by its lower triangle, and a packed triangular matrix L is
+  lower triangular. An upper triangular matrix U is stored as its transpose L = U^T, which is the
+  same memory layout as U packed column by column. Packed matrices are used by plp_mat_syrk_f32,
+  plp_mat_trmm_f32 and plp_mat_symv_f32.
+
+  Like the functions of MatrixFunctionsStride, the dense matrices are accessed with a stride,
+  which is the number of elements between the start of two consecutive rows.
+ */
+
+/**
+  @addtogroup MatPacked
+  @{
+ */
+
+/**
+  @brief Packs the lower triangle of a 32-bit floating-point matrix.
+  @param[in]  pSrc    points to the dense input matrix of shape NxN
+  @param[in]  N       width and height of the matrix
+  @param[in]  stride  stride of the input matrix (elements between each row)
+  @param[out] pDst    points to the packed output of PLP_MAT_PACKED_LEN(N) values
+  @return     none
+ */
+
+void plp_mat_pack_f32(const float *__restrict__ pSrc,
+                      uint32_t N,
+                      uint32_t stride,
+                      float *__restrict__ pDst) {
+
+    uint32_t i, j;
+
+    for (i = 0; i < N; i++) {
+        for (j = 0; j <= i; j++) {
+            *pDst++ = pSrc[i * stride + j];
+        }
+    }
+}
+
+/**
+  @} end of MatPacked group
+ */
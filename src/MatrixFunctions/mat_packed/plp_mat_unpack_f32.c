@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_unpack_f32.c
+ * Description:  Glue code for unpacking a packed 32-bit floating-point matrix
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatPacked
+  @{
+ */
+
+/**
+  @brief Unpacks a packed 32-bit floating-point matrix into a dense matrix.
+  @param[in]  pSrc       points to the packed input of PLP_MAT_PACKED_LEN(N) values
+  @param[in]  N          width and height of the matrix
+  @param[in]  symmetric  if set, the upper triangle is mirrored from the lower one, else it is
+                         set to zero
+  @param[in]  stride     stride of the output matrix (elements between each row)
+  @param[out] pDst       points to the dense output matrix of shape NxN
+  @return     none
+ */
+
+void plp_mat_unpack_f32(const float *__restrict__ pSrc,
+                        uint32_t N,
+                        uint32_t symmetric,
+                        uint32_t stride,
+                        float *__restrict__ pDst) {
+
+    uint32_t i, j;
+
+    for (i = 0; i < N; i++) {
+        for (j = 0; j < i; j++) {
+            float x = *pSrc++;
+            pDst[i * stride + j] = x;
+            pDst[j * stride + i] = symmetric ? x : 0.0f;
+        }
+        pDst[i * stride + i] = *pSrc++;
+    }
+}
+
+/**
+  @} end of MatPacked group
+ */
@@ -0,0 +1,224 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_qr_cmplx_f32p_xpulpv2.c
+ * Description:  Parallel complex 32-bit floating-point QR decomposition for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Householder vector of the complex column x of len elements in place, scaled to v^H v = 2 such
+// that H = I - v v^H. Returns the diagonal element of R in pAlpha, i.e. H x = alpha e_0.
+static inline void plp_mat_qr_reflector_cmplx_f32(float *pX,
+                                                  uint32_t stride,
+                                                  uint32_t len,
+                                                  float *pAlpha) {
+    uint32_t i;
+    float norm2 = 0.0f;
+
+    for (i = 0; i < len; i++) {
+        norm2 += pX[2 * i * stride] * pX[2 * i * stride];
+        norm2 += pX[2 * i * stride + 1] * pX[2 * i * stride + 1];
+    }
+
+    if (norm2 == 0.0f) {
+        pAlpha[0] = 0.0f; // v = 0, the column is already zero
+        pAlpha[1] = 0.0f;
+        return;
+    }
+
+    // alpha = -x0 / |x0| * norm, such that u0 = x0 - alpha does not cancel
+    float norm = sqrtf(norm2);
+    float re = pX[0];
+    float im = pX[1];
+    float abs0 = sqrtf(re * re + im * im);
+    float alphaRe = (abs0 == 0.0f) ? -norm : -re / abs0 * norm;
+    float alphaIm = (abs0 == 0.0f) ? 0.0f : -im / abs0 * norm;
+    float u0Re = re - alphaRe;
+    float u0Im = im - alphaIm;
+    float scale = sqrtf(2.0f / (norm2 - abs0 * abs0 + u0Re * u0Re + u0Im * u0Im));
+
+    pX[0] = u0Re * scale;
+    pX[1] = u0Im * scale;
+    for (i = 1; i < len; i++) {
+        pX[2 * i * stride] *= scale;
+        pX[2 * i * stride + 1] *= scale;
+    }
+
+    pAlpha[0] = alphaRe;
+    pAlpha[1] = alphaIm;
+}
+
+// c = (I - v v^H) c for a complex column c of len elements
+static inline void plp_mat_qr_apply_cmplx_f32(const float *pV,
+                                              uint32_t vStride,
+                                              float *pC,
+                                              uint32_t cStride,
+                                              uint32_t len) {
+    uint32_t i;
+    float sRe = 0.0f;
+    float sIm = 0.0f;
+
+    // s = v^H c
+    for (i = 0; i < len; i++) {
+        float vRe = pV[2 * i * vStride];
+        float vIm = pV[2 * i * vStride + 1];
+        float cRe = pC[2 * i * cStride];
+        float cIm = pC[2 * i * cStride + 1];
+        sRe += vRe * cRe + vIm * cIm;
+        sIm += vRe * cIm - vIm * cRe;
+    }
+    for (i = 0; i < len; i++) {
+        float vRe = pV[2 * i * vStride];
+        float vIm = pV[2 * i * vStride + 1];
+        pC[2 * i * cStride] -= vRe * sRe - vIm * sIm;
+        pC[2 * i * cStride + 1] -= vRe * sIm + vIm * sRe;
+    }
+}
+
+// column k of Q = (I - v v^H) e_k, in place of the Householder vector v stored in column k
+static inline void plp_mat_qr_finalize_cmplx_f32(float *pQ, uint32_t M, uint32_t N, uint32_t k) {
+    uint32_t i;
+    float wRe = pQ[2 * (k * N + k)];
+    float wIm = pQ[2 * (k * N + k) + 1];
+
+    for (i = 0; i < k; i++) {
+        pQ[2 * (i * N + k)] = 0.0f;
+        pQ[2 * (i * N + k) + 1] = 0.0f;
+    }
+    pQ[2 * (k * N + k)] = 1.0f - wRe * wRe - wIm * wIm;
+    pQ[2 * (k * N + k) + 1] = 0.0f;
+
+    // -v * conj(w)
+    for (i = k + 1; i < M; i++) {
+        float vRe = pQ[2 * (i * N + k)];
+        float vIm = pQ[2 * (i * N + k) + 1];
+        pQ[2 * (i * N + k)] = -(vRe * wRe + vIm * wIm);
+        pQ[2 * (i * N + k) + 1] = -(vIm * wRe - vRe * wIm);
+    }
+}
+
+/**
+  @ingroup MatQR
+ */
+
+/**
+  @addtogroup MatQRKernels
+  @{
+ */
+
+/**
+   @brief Parallel QR decomposition of complex 32-bit floating-point matrices kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_mat_qr_instance_f32 struct initialized by
+                     plp_mat_qr_cmplx_f32_parallel
+   @return     none, the status (0: Success) is written to args->ret
+
+   @par Parallelization
+   Column j is owned by core j % nPE. In step k, every core applies the reflector of column k to
+   its own columns right of k. The owner of column k + 1 computes the next reflector directly
+   after updating it, such that a single rt_team_barrier per step is enough. Q is accumulated in
+   the same way backwards, where the owner of column k + 1 turns it into a column of Q in step k,
+   when no core reads its Householder vector anymore.
+*/
+
+void plp_mat_qr_cmplx_f32p_xpulpv2(void *args) {
+
+    uint32_t core_id = rt_core_id();
+
+    plp_mat_qr_instance_f32 *a = (plp_mat_qr_instance_f32 *)args;
+
+    const float *__restrict__ pSrc = a->pSrc;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pQ = a->pQ;
+    float *__restrict__ pR = a->pR;
+
+    uint32_t i, j, k; // loop counters
+
+    for (j = core_id; j < N; j += nPE) {
+        for (i = 0; i < M; i++) {
+            pQ[2 * (i * N + j)] = pSrc[2 * (i * N + j)];
+            pQ[2 * (i * N + j) + 1] = pSrc[2 * (i * N + j) + 1];
+        }
+    }
+
+    if (core_id == 0) {
+        plp_mat_qr_reflector_cmplx_f32(pQ, N, M, pR);
+    }
+
+    // reduce the columns, the Householder vector of column k is stored from row k on
+    for (k = 0; k < N; k++) {
+        const float *pV = pQ + 2 * (k * N + k);
+
+        rt_team_barrier();
+
+        for (j = k + 1 + (core_id + nPE - (k + 1) % nPE) % nPE; j < N; j += nPE) {
+            plp_mat_qr_apply_cmplx_f32(pV, N, pQ + 2 * (k * N + j), N, M - k);
+            if (j == k + 1) {
+                plp_mat_qr_reflector_cmplx_f32(pQ + 2 * (j * N + j), N, M - j,
+                                               pR + 2 * (j * N + j));
+            }
+        }
+    }
+
+    rt_team_barrier();
+
+    // row k of the reduced matrix is final after step k
+    for (j = core_id; j < N; j += nPE) {
+        for (i = 0; i < N; i++) {
+            if (i < j) {
+                pR[2 * (i * N + j)] = pQ[2 * (i * N + j)];
+                pR[2 * (i * N + j) + 1] = pQ[2 * (i * N + j) + 1];
+            } else if (i > j) {
+                pR[2 * (i * N + j)] = 0.0f;
+                pR[2 * (i * N + j) + 1] = 0.0f;
+            }
+        }
+    }
+
+    // Q = H_0 ... H_{N-1} [I; 0], column k is finished after applying H_k
+    for (k = N; k-- > 0;) {
+        const float *pV = pQ + 2 * (k * N + k);
+
+        for (j = k + 1 + (core_id + nPE - (k + 1) % nPE) % nPE; j < N; j += nPE) {
+            if (j == k + 1) {
+                plp_mat_qr_finalize_cmplx_f32(pQ, M, N, j);
+            }
+            plp_mat_qr_apply_cmplx_f32(pV, N, pQ + 2 * (k * N + j), N, M - k);
+        }
+
+        rt_team_barrier();
+    }
+
+    if (core_id == 0) {
+        plp_mat_qr_finalize_cmplx_f32(pQ, M, N, 0);
+        a->ret = 0;
+    }
+}
+
+/**
+   @} end of MatQRKernels group
+*/
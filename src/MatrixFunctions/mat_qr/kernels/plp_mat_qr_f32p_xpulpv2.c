@@ -0,0 +1,187 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_qr_f32p_xpulpv2.c
+ * Description:  Parallel 32-bit floating-point QR decomposition for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Householder vector of the column x of len elements in place, scaled to v^T v = 2 such that
+// H = I - v v^T. Returns the diagonal element of R, i.e. H x = alpha e_0.
+static inline float plp_mat_qr_reflector_f32(float *pX, uint32_t stride, uint32_t len) {
+    uint32_t i;
+    float norm2 = 0.0f;
+
+    for (i = 0; i < len; i++) {
+        norm2 += pX[i * stride] * pX[i * stride];
+    }
+
+    if (norm2 == 0.0f) {
+        return 0.0f; // v = 0, the column is already zero
+    }
+
+    float x0 = pX[0];
+    float alpha = (x0 >= 0.0f) ? -sqrtf(norm2) : sqrtf(norm2);
+    float u0 = x0 - alpha;
+    float scale = sqrtf(2.0f / (norm2 - x0 * x0 + u0 * u0));
+
+    pX[0] = u0 * scale;
+    for (i = 1; i < len; i++) {
+        pX[i * stride] *= scale;
+    }
+
+    return alpha;
+}
+
+// c = (I - v v^T) c for a column c of len elements
+static inline void plp_mat_qr_apply_f32(const float *pV,
+                                        uint32_t vStride,
+                                        float *pC,
+                                        uint32_t cStride,
+                                        uint32_t len) {
+    uint32_t i;
+    float s = 0.0f;
+
+    for (i = 0; i < len; i++) {
+        s += pV[i * vStride] * pC[i * cStride];
+    }
+    for (i = 0; i < len; i++) {
+        pC[i * cStride] -= s * pV[i * vStride];
+    }
+}
+
+// column k of Q = (I - v v^T) e_k, in place of the Householder vector v stored in column k
+static inline void plp_mat_qr_finalize_f32(float *pQ, uint32_t M, uint32_t N, uint32_t k) {
+    uint32_t i;
+    float w = pQ[k * N + k];
+
+    for (i = 0; i < k; i++) {
+        pQ[i * N + k] = 0.0f;
+    }
+    pQ[k * N + k] = 1.0f - w * w;
+    for (i = k + 1; i < M; i++) {
+        pQ[i * N + k] *= -w;
+    }
+}
+
+/**
+  @ingroup MatQR
+ */
+
+/**
+  @addtogroup MatQRKernels
+  @{
+ */
+
+/**
+   @brief Parallel QR decomposition of 32-bit floating-point matrices kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_mat_qr_instance_f32 struct initialized by
+                     plp_mat_qr_f32_parallel
+   @return     none, the status (0: Success) is written to args->ret
+
+   @par Parallelization
+   Column j is owned by core j % nPE. In step k, every core applies the reflector of column k to
+   its own columns right of k. The owner of column k + 1 computes the next reflector directly
+   after updating it, such that a single rt_team_barrier per step is enough. Q is accumulated in
+   the same way backwards, where the owner of column k + 1 turns it into a column of Q in step k,
+   when no core reads its Householder vector anymore.
+*/
+
+void plp_mat_qr_f32p_xpulpv2(void *args) {
+
+    uint32_t core_id = rt_core_id();
+
+    plp_mat_qr_instance_f32 *a = (plp_mat_qr_instance_f32 *)args;
+
+    const float *__restrict__ pSrc = a->pSrc;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pQ = a->pQ;
+    float *__restrict__ pR = a->pR;
+
+    uint32_t i, j, k; // loop counters
+
+    for (j = core_id; j < N; j += nPE) {
+        for (i = 0; i < M; i++) {
+            pQ[i * N + j] = pSrc[i * N + j];
+        }
+    }
+
+    if (core_id == 0) {
+        pR[0] = plp_mat_qr_reflector_f32(pQ, N, M);
+    }
+
+    // reduce the columns, the Householder vector of column k is stored from row k on
+    for (k = 0; k < N; k++) {
+        const float *pV = pQ + k * N + k;
+
+        rt_team_barrier();
+
+        for (j = k + 1 + (core_id + nPE - (k + 1) % nPE) % nPE; j < N; j += nPE) {
+            plp_mat_qr_apply_f32(pV, N, pQ + k * N + j, N, M - k);
+            if (j == k + 1) {
+                pR[j * N + j] = plp_mat_qr_reflector_f32(pQ + j * N + j, N, M - j);
+            }
+        }
+    }
+
+    rt_team_barrier();
+
+    // row k of the reduced matrix is final after step k
+    for (j = core_id; j < N; j += nPE) {
+        for (i = 0; i < N; i++) {
+            if (i < j) {
+                pR[i * N + j] = pQ[i * N + j];
+            } else if (i > j) {
+                pR[i * N + j] = 0.0f;
+            }
+        }
+    }
+
+    // Q = H_0 ... H_{N-1} [I; 0], column k is finished after applying H_k
+    for (k = N; k-- > 0;) {
+        const float *pV = pQ + k * N + k;
+
+        for (j = k + 1 + (core_id + nPE - (k + 1) % nPE) % nPE; j < N; j += nPE) {
+            if (j == k + 1) {
+                plp_mat_qr_finalize_f32(pQ, M, N, j);
+            }
+            plp_mat_qr_apply_f32(pV, N, pQ + k * N + j, N, M - k);
+        }
+
+        rt_team_barrier();
+    }
+
+    if (core_id == 0) {
+        plp_mat_qr_finalize_f32(pQ, M, N, 0);
+        a->ret = 0;
+    }
+}
+
+/**
+   @} end of MatQRKernels group
+*/
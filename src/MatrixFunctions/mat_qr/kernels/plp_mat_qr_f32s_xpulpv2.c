@@ -0,0 +1,175 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_qr_f32s_xpulpv2.c
+ * Description:  32-bit floating-point QR decomposition for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Householder vector of the column x of len elements in place, scaled to v^T v = 2 such that
+// H = I - v v^T. Returns the diagonal element of R, i.e. H x = alpha e_0.
+static inline float plp_mat_qr_reflector_f32(float *pX, uint32_t stride, uint32_t len) {
+    uint32_t i;
+    float norm2 = 0.0f;
+
+    for (i = 0; i < len; i++) {
+        norm2 += pX[i * stride] * pX[i * stride];
+    }
+
+    if (norm2 == 0.0f) {
+        return 0.0f; // v = 0, the column is already zero
+    }
+
+    float x0 = pX[0];
+    float alpha = (x0 >= 0.0f) ? -sqrtf(norm2) : sqrtf(norm2);
+    float u0 = x0 - alpha;
+    float scale = sqrtf(2.0f / (norm2 - x0 * x0 + u0 * u0));
+
+    pX[0] = u0 * scale;
+    for (i = 1; i < len; i++) {
+        pX[i * stride] *= scale;
+    }
+
+    return alpha;
+}
+
+// c = (I - v v^T) c for a column c of len elements
+static inline void plp_mat_qr_apply_f32(const float *pV,
+                                        uint32_t vStride,
+                                        float *pC,
+                                        uint32_t cStride,
+                                        uint32_t len) {
+    uint32_t i;
+    float s = 0.0f;
+
+    for (i = 0; i < len; i++) {
+        s += pV[i * vStride] * pC[i * cStride];
+    }
+    for (i = 0; i < len; i++) {
+        pC[i * cStride] -= s * pV[i * vStride];
+    }
+}
+
+// column k of Q = (I - v v^T) e_k, in place of the Householder vector v stored in column k
+static inline void plp_mat_qr_finalize_f32(float *pQ, uint32_t M, uint32_t N, uint32_t k) {
+    uint32_t i;
+    float w = pQ[k * N + k];
+
+    for (i = 0; i < k; i++) {
+        pQ[i * N + k] = 0.0f;
+    }
+    pQ[k * N + k] = 1.0f - w * w;
+    for (i = k + 1; i < M; i++) {
+        pQ[i * N + k] *= -w;
+    }
+}
+
+/**
+  @ingroup MatQR
+ */
+
+/**
+  @defgroup MatQRKernels QR decomposition kernels
+  This module contains the kernel functions for the QR decomposition.
+
+  The thin QR decomposition factors a matrix A of shape MxN with M >= N into a matrix Q of shape
+  MxN with orthonormal columns, and an upper triangular matrix R of shape NxN:
+
+  \f[
+    A = Q \cdot R
+  \f]
+
+  @par Algorithm
+  Householder reflections zero the elements below the diagonal column by column. The Householder
+  vectors are stored in place of the zeroed elements, and Q is accumulated backwards in place.
+ */
+
+/**
+  @addtogroup MatQRKernels
+  @{
+ */
+
+/**
+  @brief QR decomposition of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc  Points to the input matrix of shape MxN, pSrc is not modified by this kernel
+  @param[in]  M     Height of the input matrix and of Q
+  @param[in]  N     Width of the input matrix and of Q, width and height of R
+  @param[out] pQ    Points to the output matrix Q of shape MxN with orthonormal columns
+  @param[out] pR    Points to the output matrix R of shape NxN, the lower triangular part is set
+                    to zero
+  @return     0: Success, 1: M is smaller than N
+ */
+
+int plp_mat_qr_f32s_xpulpv2(const float *__restrict__ pSrc,
+                             uint32_t M,
+                             uint32_t N,
+                             float *__restrict__ pQ,
+                             float *__restrict__ pR) {
+
+    uint32_t i, j, k; // loop counters
+
+    if (M < N) {
+        return 1;
+    }
+
+    for (i = 0; i < M * N; i++) {
+        pQ[i] = pSrc[i];
+    }
+
+    // reduce the columns, the Householder vector of column k is stored from row k on
+    for (k = 0; k < N; k++) {
+        float *pV = pQ + k * N + k;
+        pR[k * N + k] = plp_mat_qr_reflector_f32(pV, N, M - k);
+        for (j = k + 1; j < N; j++) {
+            plp_mat_qr_apply_f32(pV, N, pQ + k * N + j, N, M - k);
+        }
+    }
+
+    // row k of the reduced matrix is final after step k
+    for (i = 0; i < N; i++) {
+        for (j = 0; j < N; j++) {
+            if (j > i) {
+                pR[i * N + j] = pQ[i * N + j];
+            } else if (j < i) {
+                pR[i * N + j] = 0.0f;
+            }
+        }
+    }
+
+    // Q = H_0 ... H_{N-1} [I; 0], column k is finished after applying H_k
+    for (k = N; k-- > 0;) {
+        const float *pV = pQ + k * N + k;
+        for (j = k + 1; j < N; j++) {
+            plp_mat_qr_apply_f32(pV, N, pQ + k * N + j, N, M - k);
+        }
+        plp_mat_qr_finalize_f32(pQ, M, N, k);
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatQRKernels group
+ */
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_qr_cmplx_f32.c
+ * Description:  Glue code for the complex 32-bit floating-point QR decomposition
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatQR
+  @{
+ */
+
+/**
+  @brief Glue code for the QR decomposition of complex 32-bit floating-point matrices.
+  @param[in]  pSrc  Points to the input matrix of shape MxN
+  @param[in]  M     Height of the input matrix and of Q
+  @param[in]  N     Width of the input matrix and of Q, width and height of R
+  @param[out] pQ    Points to the output matrix Q of shape MxN with orthonormal columns
+  @param[out] pR    Points to the output matrix R of shape NxN, the lower triangular part is set
+                    to zero
+  @return     0: Success, 1: M is smaller than N, 2: operation not supported
+ */
+
+int plp_mat_qr_cmplx_f32(const float *__restrict__ pSrc,
+                   uint32_t M,
+                   uint32_t N,
+                   float *__restrict__ pQ,
+                   float *__restrict__ pR) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_qr_cmplx_f32s_xpulpv2(pSrc, M, N, pQ, pR);
+    }
+}
+
+/**
+  @} end of MatQR group
+ */
@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_qr_cmplx_f32_parallel.c
+ * Description:  Glue code for the parallel complex 32-bit floating-point QR decomposition
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatQR
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel QR decomposition of complex 32-bit floating-point matrices.
+  @param[in]  pSrc  Points to the input matrix of shape MxN
+  @param[in]  M     Height of the input matrix and of Q
+  @param[in]  N     Width of the input matrix and of Q, width and height of R
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pQ    Points to the output matrix Q of shape MxN with orthonormal columns
+  @param[out] pR    Points to the output matrix R of shape NxN, the lower triangular part is set
+                    to zero
+  @return     0: Success, 1: M is smaller than N, 2: operation not supported
+
+  @par This function will use plp_mat_qr_cmplx_f32p_xpulpv2 for its computation.
+ */
+
+int plp_mat_qr_cmplx_f32_parallel(const float *__restrict__ pSrc,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t nPE,
+                            float *__restrict__ pQ,
+                            float *__restrict__ pR) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return 2;
+    } else {
+
+        if (M < N) {
+            return 1;
+        }
+
+        if (nPE == 1) {
+            return plp_mat_qr_cmplx_f32s_xpulpv2(pSrc, M, N, pQ, pR);
+        }
+
+        plp_mat_qr_instance_f32 args = { .pSrc = pSrc,
+                                         .M = M,
+                                         .N = N,
+                                         .nPE = nPE,
+                                         .pQ = pQ,
+                                         .pR = pR,
+                                         .ret = 0 };
+
+        rt_team_fork(nPE, plp_mat_qr_cmplx_f32p_xpulpv2, (void *)&args);
+
+        return args.ret;
+    }
+}
+
+/**
+  @} end of MatQR group
+ */
@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_qr_f32.c
+ * Description:  Glue code for the 32-bit floating-point QR decomposition
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatQR QR decomposition
+  This module contains the glue code for the QR decomposition. The kernel codes (kernels) are in
+  the Module QR decomposition Kernels.
+
+  The thin QR decomposition factors a matrix A of shape MxN with M >= N into a matrix Q of shape
+  MxN with orthonormal columns, and an upper triangular matrix R of shape NxN:
+
+  \f[
+    A = Q \cdot R
+  \f]
+
+  For complex matrices, the columns of Q are orthonormal with respect to the conjugate transpose,
+  Q^H Q = I. Complex matrices are stored with interleaved real and imaginary parts. To solve an
+  overdetermined system in the least-squares sense, use plp_mat_lstsq_f32, which applies the
+  transformation to the right-hand side directly instead of forming Q.
+
+  @par Algorithm
+  Householder reflections H_k = I - v_k v_k^T, with v_k scaled to v_k^T v_k = 2, zero the
+  elements below the diagonal column by column. The vectors v_k are stored in place of the zeroed
+  elements in pQ, and Q = H_0 H_1 ... H_{N-1} is accumulated backwards in place. The diagonal of R
+  is negative or positive, depending on the sign of the diagonal element of the reduced column.
+ */
+
+/**
+  @addtogroup MatQR
+  @{
+ */
+
+/**
+  @brief Glue code for the QR decomposition of 32-bit floating-point matrices.
+  @param[in]  pSrc  Points to the input matrix of shape MxN
+  @param[in]  M     Height of the input matrix and of Q
+  @param[in]  N     Width of the input matrix and of Q, width and height of R
+  @param[out] pQ    Points to the output matrix Q of shape MxN with orthonormal columns
+  @param[out] pR    Points to the output matrix R of shape NxN, the lower triangular part is set
+                    to zero
+  @return     0: Success, 1: M is smaller than N, 2: operation not supported
+ */
+
+int plp_mat_qr_f32(const float *__restrict__ pSrc,
+                   uint32_t M,
+                   uint32_t N,
+                   float *__restrict__ pQ,
+                   float *__restrict__ pR) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_qr_f32s_xpulpv2(pSrc, M, N, pQ, pR);
+    }
+}
+
+/**
+  @} end of MatQR group
+ */
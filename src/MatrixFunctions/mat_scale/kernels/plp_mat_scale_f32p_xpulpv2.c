@@ -52,18 +52,21 @@ void plp_mat_scale_f32p_xpulpv2(void *args) {
 
     plp_mat_scale_instance_f32 *a = (plp_mat_scale_instance_f32 *)args;
 
-    const float *__restrict__ pSrc = a->pSrc;
+    const float *pSrc = a->pSrc;
     uint32_t M = a->M;
     uint32_t N = a->N;
     float scaleFactor = a->scaleFactor;
     uint32_t nPE = a->nPE;
-    float *__restrict__ pDst = a->pDst;
+    float *pDst = a->pDst;
 
 #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int n = 0; n < N; n++) {
+    plp_mat_partition_t part;
+    plp_mat_partition(M, N, nPE, core_id, &part);
+
+    for (int m = part.rowStart; m < part.rowEnd; m++) {
+        for (int n = part.colStart; n < part.colEnd; n++) {
             float val = pSrc[m * N + n] * scaleFactor;
             pDst[m * N + n] = val;
         }
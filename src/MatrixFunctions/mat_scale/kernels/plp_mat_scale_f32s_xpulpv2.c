@@ -45,15 +45,15 @@
   @param[in]  M           Height of both matrices
   @param[in]  N           Width of both matrices
   @param[in]  scaleFactor Factor to mulitply all elements
-  @param[out] pDst        Points to the output matrix
+  @param[out] pDst        Points to the output matrix, may be equal to pSrc
   @return     none
  */
 
-void plp_mat_scale_f32s_xpulpv2(const float *__restrict__ pSrc,
+void plp_mat_scale_f32s_xpulpv2(const float *pSrc,
                                 uint32_t M,
                                 uint32_t N,
                                 float scaleFactor,
-                                float *__restrict__ pDst) {
+                                float *pDst) {
 
 #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
@@ -72,16 +72,16 @@
   @param[in]  N           Width of both matrices
   @param[in]  scaleFactor Factor to mulitply all elements before shifting
   @param[in]  shift       Amount to shift each element
-  @param[out] pDst        Points to the output matrix
+  @param[out] pDst        Points to the output matrix, may be equal to pSrc
   @return     none
  */
 
-void plp_mat_scale_i16s_rv32im(const int16_t *__restrict__ pSrc,
+void plp_mat_scale_i16s_rv32im(const int16_t *pSrc,
                                uint32_t M,
                                uint32_t N,
                                int16_t scaleFactor,
                                int32_t shift,
-                               int16_t *__restrict__ pDst) {
+                               int16_t *pDst) {
 
 #define BASIC_VERSION // if used don' forget to also use undefine at end of file
 #ifdef BASIC_VERSION
@@ -52,19 +52,22 @@ void plp_mat_scale_i32p_xpulpv2(void *args) {
 
     plp_mat_scale_instance_i32 *a = (plp_mat_scale_instance_i32 *)args;
 
-    const int32_t *__restrict__ pSrc = a->pSrc;
+    const int32_t *pSrc = a->pSrc;
     uint32_t M = a->M;
     uint32_t N = a->N;
     int32_t scaleFactor = a->scaleFactor;
     int32_t shift = a->shift;
     uint32_t nPE = a->nPE;
-    int32_t *__restrict__ pDst = a->pDst;
+    int32_t *pDst = a->pDst;
 
 #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int n = 0; n < N; n++) {
+    plp_mat_partition_t part;
+    plp_mat_partition(M, N, nPE, core_id, &part);
+
+    for (int m = part.rowStart; m < part.rowEnd; m++) {
+        for (int n = part.colStart; n < part.colEnd; n++) {
             int32_t val = ((int32_t)pSrc[m * N + n]) * ((int32_t)scaleFactor);
             pDst[m * N + n] = (int32_t)(val >> shift);
         }
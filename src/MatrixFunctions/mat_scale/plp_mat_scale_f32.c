@@ -45,15 +45,15 @@
   @param[in]  M           Height of both matrices
   @param[in]  N           Width of both matrices
   @param[in]  scaleFactor Factor to mulitply all elements
-  @param[out] pDst        Points to the output matrix
+  @param[out] pDst        Points to the output matrix, may be equal to pSrc
   @return     none
  */
 
-void plp_mat_scale_f32(const float *__restrict__ pSrc,
+void plp_mat_scale_f32(const float *pSrc,
                        uint32_t M,
                        uint32_t N,
                        float scaleFactor,
-                       float *__restrict__ pDst) {
+                       float *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
@@ -46,16 +46,16 @@
   @param[in]  N           Width of both matrices
   @param[in]  scaleFactor Factor to mulitply all elements
   @param[in]  nPE         Number of cores to use for computation
-  @param[out] pDst        Points to the output matrix
+  @param[out] pDst        Points to the output matrix, may be equal to pSrc
   @return     none
  */
 
-void plp_mat_scale_f32_parallel(const float *__restrict__ pSrc,
+void plp_mat_scale_f32_parallel(const float *pSrc,
                                 uint32_t M,
                                 uint32_t N,
                                 float scaleFactor,
                                 uint32_t nPE,
-                                float *__restrict__ pDst) {
+                                float *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel and floating-point processing supported only for cluster side\n");
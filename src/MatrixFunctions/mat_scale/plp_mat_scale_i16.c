@@ -44,6 +44,8 @@
 
       `pDst[m,n] = (pSrc[m,n] * scale) >> shift`
 
+  The output matrix may be equal to the input matrix (in-place operation).
+
   There are functions for integer 32- 16- and 8-bit data types. For lower precision integers (16-
   and 8-bit), functions exploiting SIMD instructions are provided.
 
@@ -71,16 +73,16 @@
   @param[in]  N           Width of both matrices
   @param[in]  scaleFactor Factor to mulitply all elements before shifting
   @param[in]  shift       Amount to shift each element
-  @param[out] pDst        Points to the output matrix
+  @param[out] pDst        Points to the output matrix, may be equal to pSrc
   @return     none
  */
 
-void plp_mat_scale_i16(const int16_t *__restrict__ pSrc,
+void plp_mat_scale_i16(const int16_t *pSrc,
                        uint32_t M,
                        uint32_t N,
                        int16_t scaleFactor,
                        int32_t shift,
-                       int16_t *__restrict__ pDst) {
+                       int16_t *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_scale_i16s_rv32im(pSrc, M, N, scaleFactor, shift, pDst);
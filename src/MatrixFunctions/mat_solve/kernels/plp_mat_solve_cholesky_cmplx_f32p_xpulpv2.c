@@ -0,0 +1,214 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_cholesky_cmplx_f32p_xpulpv2.c
+ * Description:  Complex 32-bit floating-point parallel Hermitian solve kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolve
+ */
+
+/**
+  @addtogroup MatSolveKernels
+  @{
+ */
+
+/**
+   @brief Parallel Hermitian, positive definite solve of complex 32-bit floating-point matrices
+          kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_solve_instance_f32 struct initialized by
+                     plp_mat_solve_cholesky_cmplx_f32_parallel, pA is the Cholesky factor L
+   @return     none, the status (0: Success, 1: Matrix is singular) is written to args->ret
+
+   @par Parallelization
+   Both triangular solves follow plp_mat_solve_lower_f32p_xpulpv2 and
+   plp_mat_solve_upper_f32p_xpulpv2. If there are at least as many right-hand sides as cores, the
+   columns of B are split among the cores, which solve both systems without any synchronization.
+   Otherwise, row i of X is owned by core i % nPE, and a single rt_team_barrier per row and
+   triangular solve is needed.
+*/
+
+void plp_mat_solve_cholesky_cmplx_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_solve_instance_f32 *a = (plp_mat_solve_instance_f32 *)args;
+
+    const float *pL = a->pA;
+    const float *pB = a->pB;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    float *pX = a->pX;
+
+    uint32_t i, k, o; // loop counters
+    uint32_t oStart, oEnd;
+
+    // every core reaches the same decision, no core is left waiting in a barrier
+    for (i = 0; i < N; i++) {
+        if (pL[2 * (i * N + i)] == 0.0f) {
+            if (core_id == 0) {
+                a->ret = 1;
+            }
+            return;
+        }
+    }
+
+    if (O >= nPE) {
+
+        // split the right-hand sides among the cores
+        oStart = (O * core_id) / nPE;
+        oEnd = (O * (core_id + 1)) / nPE;
+
+        // forward substitution, L * Y = B
+        for (i = 0; i < N; i++) {
+            float *pRowX = pX + 2 * i * O;
+            const float *pRowB = pB + 2 * i * O;
+
+            for (o = 2 * oStart; o < 2 * oEnd; o++) {
+                pRowX[o] = pRowB[o];
+            }
+
+            for (k = 0; k < i; k++) {
+                float fRe = pL[2 * (i * N + k)];
+                float fIm = pL[2 * (i * N + k) + 1];
+                const float *pRowK = pX + 2 * k * O;
+                for (o = oStart; o < oEnd; o++) {
+                    pRowX[2 * o] -= fRe * pRowK[2 * o] - fIm * pRowK[2 * o + 1];
+                    pRowX[2 * o + 1] -= fRe * pRowK[2 * o + 1] + fIm * pRowK[2 * o];
+                }
+            }
+
+            float invDiag = 1.0f / pL[2 * (i * N + i)];
+            for (o = 2 * oStart; o < 2 * oEnd; o++) {
+                pRowX[o] *= invDiag;
+            }
+        }
+
+        // back substitution, L^H * X = Y
+        for (i = N; i-- > 0;) {
+            float *pRowX = pX + 2 * i * O;
+
+            for (k = i + 1; k < N; k++) {
+                float fRe = pL[2 * (k * N + i)];
+                float fIm = -pL[2 * (k * N + i) + 1];
+                const float *pRowK = pX + 2 * k * O;
+                for (o = oStart; o < oEnd; o++) {
+                    pRowX[2 * o] -= fRe * pRowK[2 * o] - fIm * pRowK[2 * o + 1];
+                    pRowX[2 * o + 1] -= fRe * pRowK[2 * o + 1] + fIm * pRowK[2 * o];
+                }
+            }
+
+            float invDiag = 1.0f / pL[2 * (i * N + i)];
+            for (o = 2 * oStart; o < 2 * oEnd; o++) {
+                pRowX[o] *= invDiag;
+            }
+        }
+
+    } else {
+
+        // copy the own rows of B to X, and solve the first row of L * Y = B
+        for (i = core_id; i < N; i += nPE) {
+            float *pRowX = pX + 2 * i * O;
+            const float *pRowB = pB + 2 * i * O;
+            float invDiag = (i == 0) ? 1.0f / pL[0] : 1.0f;
+            for (o = 0; o < 2 * O; o++) {
+                pRowX[o] = pRowB[o] * invDiag;
+            }
+        }
+
+        // forward substitution, the owner of row k + 1 scales it after its last update
+        for (k = 0; k + 1 < N; k++) {
+            const float *pRowK = pX + 2 * k * O;
+
+            rt_team_barrier();
+
+            // first own row below row k
+            i = k + 1 + (core_id + nPE - (k + 1) % nPE) % nPE;
+
+            for (; i < N; i += nPE) {
+                float *pRowX = pX + 2 * i * O;
+                float fRe = pL[2 * (i * N + k)];
+                float fIm = pL[2 * (i * N + k) + 1];
+                for (o = 0; o < O; o++) {
+                    pRowX[2 * o] -= fRe * pRowK[2 * o] - fIm * pRowK[2 * o + 1];
+                    pRowX[2 * o + 1] -= fRe * pRowK[2 * o + 1] + fIm * pRowK[2 * o];
+                }
+
+                // row k + 1 is solved
+                if (i == k + 1) {
+                    float invDiag = 1.0f / pL[2 * (i * N + i)];
+                    for (o = 0; o < 2 * O; o++) {
+                        pRowX[o] *= invDiag;
+                    }
+                }
+            }
+        }
+
+        // the last row of Y is owned by the same core as the last row of X, solve it directly
+        if ((N - 1) % nPE == core_id) {
+            float *pRowX = pX + 2 * (N - 1) * O;
+            float invDiag = 1.0f / pL[2 * ((N - 1) * N + N - 1)];
+            for (o = 0; o < 2 * O; o++) {
+                pRowX[o] *= invDiag;
+            }
+        }
+
+        // back substitution, the owner of row k - 1 scales it after its last update
+        for (k = N; k-- > 1;) {
+            const float *pRowK = pX + 2 * k * O;
+
+            rt_team_barrier();
+
+            for (i = core_id; i < k; i += nPE) {
+                float *pRowX = pX + 2 * i * O;
+                float fRe = pL[2 * (k * N + i)];
+                float fIm = -pL[2 * (k * N + i) + 1];
+                for (o = 0; o < O; o++) {
+                    pRowX[2 * o] -= fRe * pRowK[2 * o] - fIm * pRowK[2 * o + 1];
+                    pRowX[2 * o + 1] -= fRe * pRowK[2 * o + 1] + fIm * pRowK[2 * o];
+                }
+
+                // row k - 1 is solved
+                if (i == k - 1) {
+                    float invDiag = 1.0f / pL[2 * (i * N + i)];
+                    for (o = 0; o < 2 * O; o++) {
+                        pRowX[o] *= invDiag;
+                    }
+                }
+            }
+        }
+    }
+
+    if (core_id == 0) {
+        a->ret = 0;
+    }
+}
+
+/**
+   @} end of MatSolveKernels group
+*/
@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_cholesky_cmplx_f32s_xpulpv2.c
+ * Description:  Complex 32-bit floating-point Hermitian positive definite solve kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolve
+ */
+
+/**
+  @addtogroup MatSolveKernels
+  @{
+ */
+
+/**
+  @brief Hermitian, positive definite solve of complex 32-bit floating-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  pL Points to the complex lower triangular factor L of shape NxN
+  @param[in]  pB Points to the complex right-hand side matrix of shape NxO
+  @param[in]  N  Width and height of the triangular matrix
+  @param[in]  O  Number of right-hand sides
+  @param[out] pX Points to the complex solution matrix of shape NxO, may be equal to pB
+  @return     0: Success, 1: Matrix is singular
+ */
+
+int plp_mat_solve_cholesky_cmplx_f32s_xpulpv2(const float *pL,
+                                              const float *pB,
+                                              uint32_t N,
+                                              uint32_t O,
+                                              float *pX) {
+
+    uint32_t i, k, o; // loop counters
+
+    for (i = 0; i < N; i++) {
+        if (pL[2 * (i * N + i)] == 0.0f) {
+            return 1;
+        }
+    }
+
+    // forward substitution, L * Y = B
+    for (i = 0; i < N; i++) {
+        float *pRowX = pX + 2 * i * O;
+        const float *pRowB = pB + 2 * i * O;
+
+        for (o = 0; o < 2 * O; o++) {
+            pRowX[o] = pRowB[o];
+        }
+
+        for (k = 0; k < i; k++) {
+            float fRe = pL[2 * (i * N + k)];
+            float fIm = pL[2 * (i * N + k) + 1];
+            const float *pRowK = pX + 2 * k * O;
+            for (o = 0; o < O; o++) {
+                pRowX[2 * o] -= fRe * pRowK[2 * o] - fIm * pRowK[2 * o + 1];
+                pRowX[2 * o + 1] -= fRe * pRowK[2 * o + 1] + fIm * pRowK[2 * o];
+            }
+        }
+
+        float invDiag = 1.0f / pL[2 * (i * N + i)];
+        for (o = 0; o < 2 * O; o++) {
+            pRowX[o] *= invDiag;
+        }
+    }
+
+    // back substitution, L^H * X = Y, where L^H[i][k] = conj(L[k][i])
+    for (i = N; i-- > 0;) {
+        float *pRowX = pX + 2 * i * O;
+
+        for (k = i + 1; k < N; k++) {
+            float fRe = pL[2 * (k * N + i)];
+            float fIm = -pL[2 * (k * N + i) + 1];
+            const float *pRowK = pX + 2 * k * O;
+            for (o = 0; o < O; o++) {
+                pRowX[2 * o] -= fRe * pRowK[2 * o] - fIm * pRowK[2 * o + 1];
+                pRowX[2 * o + 1] -= fRe * pRowK[2 * o + 1] + fIm * pRowK[2 * o];
+            }
+        }
+
+        float invDiag = 1.0f / pL[2 * (i * N + i)];
+        for (o = 0; o < 2 * O; o++) {
+            pRowX[o] *= invDiag;
+        }
+    }
+
+    return 0;
+}
+
+/**
+   @} end of MatSolveKernels group
+*/
@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_lower_f32s_xpulpv2.c
+ * Description:  32-bit floating-point lower triangular solve for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolve
+ */
+
+/**
+  @defgroup MatSolveKernels triangular solve kernels
+  This module contains the kernel functions for solving triangular systems of linear equations.
+
+  Given a lower triangular matrix L (or an upper triangular matrix U) of shape NxN, and a matrix
+  B of shape NxO holding O right-hand sides, find the matrix X of shape NxO such that
+
+  \f[
+    L \cdot X = B
+  \f]
+
+  @par Algorithm
+  Forward substitution for lower triangular matrices, and back substitution for upper triangular
+  matrices. Every row of X is computed at once, subtracting the already solved rows scaled by the
+  corresponding element of the triangular matrix, such that all accesses to B and X are
+  contiguous.
+ */
+
+/**
+  @addtogroup MatSolveKernels
+  @{
+ */
+
+/**
+  @brief Lower triangular solve of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  pL       Points to the lower triangular matrix of shape NxN
+  @param[in]  pB       Points to the right-hand side matrix of shape NxO
+  @param[in]  N        Width and height of the triangular matrix
+  @param[in]  O        Number of right-hand sides
+  @param[in]  unitDiag If set, the diagonal of pL is assumed to be one
+  @param[out] pX       Points to the solution matrix of shape NxO, may be equal to pB
+  @return     0: Success, 1: Matrix is singular
+ */
+
+int plp_mat_solve_lower_f32s_xpulpv2(const float *pL,
+                                     const float *pB,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t unitDiag,
+                                     float *pX) {
+
+    uint32_t i, k, o; // loop counters
+
+    if (!unitDiag) {
+        for (i = 0; i < N; i++) {
+            if (pL[i * N + i] == 0.0f) {
+                return 1;
+            }
+        }
+    }
+
+    for (i = 0; i < N; i++) {
+        float *pRowX = pX + i * O;
+        const float *pRowB = pB + i * O;
+
+        for (o = 0; o < O; o++) {
+            pRowX[o] = pRowB[o];
+        }
+
+        for (k = 0; k < i; k++) {
+            float factor = pL[i * N + k];
+            const float *pRowK = pX + k * O;
+            for (o = 0; o < O; o++) {
+                pRowX[o] -= factor * pRowK[o];
+            }
+        }
+
+        if (!unitDiag) {
+            float invDiag = 1.0f / pL[i * N + i];
+            for (o = 0; o < O; o++) {
+                pRowX[o] *= invDiag;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+   @} end of MatSolveKernels group
+*/
@@ -0,0 +1,153 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_upper_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point upper triangular solve for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolve
+ */
+
+/**
+  @addtogroup MatSolveKernels
+  @{
+ */
+
+/**
+   @brief Parallel upper triangular solve of 32-bit floating-point matrices kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_mat_solve_instance_f32 struct initialized by
+                     plp_mat_solve_upper_f32_parallel
+   @return     none, the status (0: Success, 1: Matrix is singular) is written to args->ret
+
+   @par Parallelization
+   Same as plp_mat_solve_lower_f32p_xpulpv2, but the rows are solved from the bottom up. If the
+   right-hand sides cannot be split among the cores, the owner of row k - 1 scales it directly
+   after it received its last update in step k.
+*/
+
+void plp_mat_solve_upper_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_solve_instance_f32 *a = (plp_mat_solve_instance_f32 *)args;
+
+    const float *pU = a->pA;
+    const float *pB = a->pB;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t unitDiag = a->unitDiag;
+    uint32_t nPE = a->nPE;
+    float *pX = a->pX;
+
+    uint32_t i, k, o; // loop counters
+
+    // every core reaches the same decision, no core is left waiting in a barrier
+    if (!unitDiag) {
+        for (i = 0; i < N; i++) {
+            if (pU[i * N + i] == 0.0f) {
+                if (core_id == 0) {
+                    a->ret = 1;
+                }
+                return;
+            }
+        }
+    }
+
+    if (O >= nPE) {
+
+        // split the right-hand sides among the cores
+        uint32_t oStart = (O * core_id) / nPE;
+        uint32_t oEnd = (O * (core_id + 1)) / nPE;
+
+        for (i = N; i-- > 0;) {
+            float *pRowX = pX + i * O;
+            const float *pRowB = pB + i * O;
+
+            for (o = oStart; o < oEnd; o++) {
+                pRowX[o] = pRowB[o];
+            }
+
+            for (k = i + 1; k < N; k++) {
+                float factor = pU[i * N + k];
+                const float *pRowK = pX + k * O;
+                for (o = oStart; o < oEnd; o++) {
+                    pRowX[o] -= factor * pRowK[o];
+                }
+            }
+
+            if (!unitDiag) {
+                float invDiag = 1.0f / pU[i * N + i];
+                for (o = oStart; o < oEnd; o++) {
+                    pRowX[o] *= invDiag;
+                }
+            }
+        }
+
+    } else {
+
+        // copy the own rows of B to X, and solve the last row
+        for (i = core_id; i < N; i += nPE) {
+            float *pRowX = pX + i * O;
+            const float *pRowB = pB + i * O;
+            float invDiag = (i == N - 1 && !unitDiag) ? 1.0f / pU[i * N + i] : 1.0f;
+            for (o = 0; o < O; o++) {
+                pRowX[o] = pRowB[o] * invDiag;
+            }
+        }
+
+        for (k = N; k-- > 1;) {
+            const float *pRowK = pX + k * O;
+
+            rt_team_barrier();
+
+            for (i = core_id; i < k; i += nPE) {
+                float *pRowX = pX + i * O;
+                float factor = pU[i * N + k];
+                for (o = 0; o < O; o++) {
+                    pRowX[o] -= factor * pRowK[o];
+                }
+
+                // row k - 1 is solved
+                if (i == k - 1 && !unitDiag) {
+                    float invDiag = 1.0f / pU[i * N + i];
+                    for (o = 0; o < O; o++) {
+                        pRowX[o] *= invDiag;
+                    }
+                }
+            }
+        }
+    }
+
+    if (core_id == 0) {
+        a->ret = 0;
+    }
+}
+
+/**
+   @} end of MatSolveKernels group
+*/
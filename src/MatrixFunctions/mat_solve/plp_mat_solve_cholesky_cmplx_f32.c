@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_cholesky_cmplx_f32.c
+ * Description:  Complex 32-bit floating-point Hermitian positive definite solve glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSolve
+  @{
+ */
+
+/**
+  @brief Glue code for solving Hermitian, positive definite systems of complex 32-bit
+         floating-point matrices, given their Cholesky factor.
+  @param[in]  pL Points to the complex lower triangular factor L of shape NxN, computed by
+                 plp_mat_cholesky_cmplx_f32
+  @param[in]  pB Points to the complex right-hand side matrix of shape NxO
+  @param[in]  N  Width and height of the triangular matrix
+  @param[in]  O  Number of right-hand sides
+  @param[out] pX Points to the complex solution matrix of shape NxO, may be equal to pB
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+
+  @par This function will use plp_mat_solve_cholesky_cmplx_f32s_xpulpv2 for its computation. It
+  solves L * L^H * X = B by forward substitution with L, followed by back substitution with L^H,
+  which is read from L directly. Only the lower triangular part and the real part of the diagonal
+  of pL are read.
+ */
+
+int plp_mat_solve_cholesky_cmplx_f32(const float *pL,
+                                     const float *pB,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     float *pX) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_solve_cholesky_cmplx_f32s_xpulpv2(pL, pB, N, O, pX);
+    }
+}
+
+/**
+  @} end of MatSolve group
+ */
@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_cholesky_cmplx_f32_parallel.c
+ * Description:  Complex 32-bit floating-point parallel Hermitian positive definite solve glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSolve
+  @{
+ */
+
+/**
+  @brief Glue code for solving Hermitian, positive definite systems of complex 32-bit
+         floating-point matrices in parallel, given their Cholesky factor.
+  @param[in]  pL  Points to the complex lower triangular factor L of shape NxN, computed by
+                  plp_mat_cholesky_cmplx_f32_parallel
+  @param[in]  pB  Points to the complex right-hand side matrix of shape NxO
+  @param[in]  N   Width and height of the triangular matrix
+  @param[in]  O   Number of right-hand sides
+  @param[in]  nPE Number of cores to use for computation
+  @param[out] pX  Points to the complex solution matrix of shape NxO, may be equal to pB
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+
+  @par This function will use plp_mat_solve_cholesky_cmplx_f32p_xpulpv2 for its computation.
+ */
+
+int plp_mat_solve_cholesky_cmplx_f32_parallel(const float *pL,
+                                              const float *pB,
+                                              uint32_t N,
+                                              uint32_t O,
+                                              uint32_t nPE,
+                                              float *pX) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return 2;
+    } else {
+
+        if (nPE == 1) {
+            return plp_mat_solve_cholesky_cmplx_f32s_xpulpv2(pL, pB, N, O, pX);
+        }
+
+        plp_mat_solve_instance_f32 args = { .pA = pL,
+                                            .pB = pB,
+                                            .N = N,
+                                            .O = O,
+                                            .unitDiag = 0,
+                                            .nPE = nPE,
+                                            .pX = pX,
+                                            .ret = 0 };
+
+        rt_team_fork(nPE, plp_mat_solve_cholesky_cmplx_f32p_xpulpv2, (void *)&args);
+
+        return args.ret;
+    }
+}
+
+/**
+  @} end of MatSolve group
+ */
@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_lower_f32.c
+ * Description:  32-bit floating-point lower triangular solve glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatSolve triangular solve
+  This module contains the glue code for solving triangular systems of linear equations. The
+  kernel codes (kernels) are in the Module triangular solve Kernels.
+
+  Given a lower triangular matrix L (or an upper triangular matrix U) of shape NxN, and a matrix
+  B of shape NxO holding O right-hand sides, find the matrix X of shape NxO such that
+
+  \f[
+    L \cdot X = B
+  \f]
+
+  Together with plp_mat_cholesky_f32 or plp_mat_lu_f32, this solves general systems of linear
+  equations without computing the inverse, which would be both more expensive and numerically
+  less stable. Only the relevant triangular part of the matrix is read, which means that the
+  packed factor computed by plp_mat_lu_f32 can be passed to both the lower (with unitDiag set)
+  and the upper solve directly. plp_mat_solve_cholesky_cmplx_f32 solves complex Hermitian
+  systems with both triangular solves on the factor of plp_mat_cholesky_cmplx_f32.
+
+  @par Algorithm
+  Forward substitution for lower triangular matrices, and back substitution for upper triangular
+  matrices. If unitDiag is set, the diagonal elements are assumed to be one and are not read.
+ */
+
+/**
+  @addtogroup MatSolve
+  @{
+ */
+
+/**
+  @brief Glue code for solving lower triangular systems of 32-bit floating-point matrices.
+  @param[in]  pL       Points to the lower triangular matrix of shape NxN
+  @param[in]  pB       Points to the right-hand side matrix of shape NxO
+  @param[in]  N        Width and height of the triangular matrix
+  @param[in]  O        Number of right-hand sides
+  @param[in]  unitDiag If set, the diagonal of pL is assumed to be one
+  @param[out] pX       Points to the solution matrix of shape NxO, may be equal to pB
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+ */
+
+int plp_mat_solve_lower_f32(const float *pL,
+                            const float *pB,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t unitDiag,
+                            float *pX) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_solve_lower_f32s_xpulpv2(pL, pB, N, O, unitDiag, pX);
+    }
+}
+
+/**
+  @} end of MatSolve group
+ */
@@ -0,0 +1,252 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_q16.c
+ * Description:  16-bit fixed-point linear solve
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static uint32_t mat_solve_q16_bits(uint32_t x);
+static int32_t mat_solve_q16_shift(int32_t x, int32_t shift);
+static int mat_solve_q16_greater(uint32_t a, int32_t expA, uint32_t b, int32_t expB);
+static int32_t mat_solve_q16_normalize(int16_t *pRow, uint32_t len);
+static void mat_solve_q16_update(int16_t *pRow,
+                                 const int16_t *pPivot,
+                                 uint32_t len,
+                                 int32_t factor,
+                                 int32_t expF,
+                                 int32_t *pExp,
+                                 int32_t pivotExp);
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSolveFix
+  @{
+ */
+
+/**
+  @brief Solution of a system of linear equations with 16-bit fixed-point matrices.
+  @param[in]  pA       Points to the matrix of shape NxN. pA is modified by this function
+  @param[in]  pB       Points to the right-hand side matrix of shape NxO
+  @param[in]  N        Width and height of pA
+  @param[in]  O        Number of right-hand sides
+  @param[in]  fracBits Number of bits after the binary point of pA
+  @param[out] pX       Points to the solution matrix of shape NxO, may be equal to pB
+  @return     0: Success, 1: Matrix is singular, or a pivot is lost (see MatSolveFix)
+
+  @par Fix-Point and Saturation
+  pX is stored in the same format as pB, which may differ from the format of pA. The mantissas
+  have 14 bits during the elimination and are stored in place of pA and pX, and the products are
+  computed in 32 bits, which needs no 64-bit arithmetic at all. Elements of the solution which
+  exceed the range of 16 bits are saturated.
+ */
+
+int plp_mat_solve_q16(int16_t *__restrict__ pA,
+                      const int16_t *pB,
+                      uint32_t N,
+                      uint32_t O,
+                      uint32_t fracBits,
+                      int16_t *pX) {
+
+    int32_t expA[N];
+    int32_t expX[N];
+    uint32_t i, j, l, pivot;
+
+    if (pX != pB) {
+        for (i = 0; i < N * O; i++) {
+            pX[i] = pB[i];
+        }
+    }
+
+    for (i = 0; i < N; i++) {
+        expA[i] = mat_solve_q16_normalize(&pA[i * N], N);
+        expX[i] = mat_solve_q16_normalize(&pX[i * O], O);
+    }
+
+    for (l = 0; l < N; l++) {
+        // pivot with the largest magnitude, taking the exponents of the rows into account
+        pivot = l;
+        for (i = l + 1; i < N; i++) {
+            if (mat_solve_q16_greater(abs(pA[i * N + l]), expA[i], abs(pA[pivot * N + l]),
+                                      expA[pivot])) {
+                pivot = i;
+            }
+        }
+
+        if (pA[pivot * N + l] == 0) {
+            return 1;
+        }
+
+        if (pivot != l) {
+            int16_t tmp;
+            int32_t tmpExp;
+            for (j = l; j < N; j++) {
+                tmp = pA[l * N + j];
+                pA[l * N + j] = pA[pivot * N + j];
+                pA[pivot * N + j] = tmp;
+            }
+            for (j = 0; j < O; j++) {
+                tmp = pX[l * O + j];
+                pX[l * O + j] = pX[pivot * O + j];
+                pX[pivot * O + j] = tmp;
+            }
+            tmpExp = expA[l];
+            expA[l] = expA[pivot];
+            expA[pivot] = tmpExp;
+            tmpExp = expX[l];
+            expX[l] = expX[pivot];
+            expX[pivot] = tmpExp;
+        }
+
+        for (i = 0; i < N; i++) {
+            if (i != l && pA[i * N + l] != 0) {
+                int32_t a = pA[i * N + l];
+                int32_t b = pA[l * N + l];
+                uint32_t normA = __builtin_clz(abs(a)) - 18;
+                uint32_t normB = __builtin_clz(abs(b)) - 18;
+                // factor of the pivot row, in (2^13, 2^15) with exponent expF
+                int32_t factor = ((a << normA) << 14) / (b << normB);
+                int32_t expF = expA[i] - (int32_t)normA - expA[l] + (int32_t)normB - 14;
+                // rows above the pivot still hold their diagonal element left of column l
+                uint32_t start = (i < l) ? i : l;
+
+                mat_solve_q16_update(&pA[i * N + start], &pA[l * N + start], N - start, factor,
+                                     expF, &expA[i], expA[l]);
+                // only the rounding error of the eliminated element is left
+                pA[i * N + l] = 0;
+                mat_solve_q16_update(&pX[i * O], &pX[l * O], O, factor, expF, &expX[i], expX[l]);
+            }
+        }
+    }
+
+    // divide by the diagonal
+    for (i = 0; i < N; i++) {
+        int32_t d = pA[i * N + i];
+        uint32_t norm = __builtin_clz(abs(d)) - 18;
+        int32_t shift = (int32_t)norm + expX[i] - expA[i] + (int32_t)fracBits - 16;
+
+        d <<= norm;
+        for (j = 0; j < O; j++) {
+            int32_t q = (pX[i * O + j] << 16) / d;
+            if (shift > 0 && q != 0 && mat_solve_q16_bits(abs(q)) + shift > 15) {
+                q = (q > 0) ? 0x7FFF : -0x8000;
+            } else {
+                q = mat_solve_q16_shift(q, shift);
+                q = (q > 0x7FFF) ? 0x7FFF : (q < -0x8000) ? -0x8000 : q;
+            }
+            pX[i * O + j] = (int16_t)q;
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatSolveFix group
+ */
+
+// number of bits needed to represent x
+static uint32_t mat_solve_q16_bits(uint32_t x) {
+    return (x == 0) ? 0 : 32 - __builtin_clz(x);
+}
+
+// x * 2^shift, rounded to the nearest integer when shifting to the right
+static int32_t mat_solve_q16_shift(int32_t x, int32_t shift) {
+    if (shift >= 0) {
+        return x << shift;
+    }
+    if (shift < -31) {
+        return 0;
+    }
+    return (x + (1 << (-shift - 1))) >> -shift;
+}
+
+// a * 2^expA > b * 2^expB, for a and b below 2^14
+static int mat_solve_q16_greater(uint32_t a, int32_t expA, uint32_t b, int32_t expB) {
+    if (a == 0 || b == 0) {
+        return a > b;
+    }
+    if (expA >= expB) {
+        return (expA - expB > 16) || (a << (expA - expB)) > b;
+    } else {
+        return (expB - expA <= 16) && a > (b << (expB - expA));
+    }
+}
+
+// scales the row such that the largest mantissa has 13 bits, and returns the exponent of the row
+static int32_t mat_solve_q16_normalize(int16_t *pRow, uint32_t len) {
+
+    uint32_t max = 0;
+    int32_t shift;
+    uint32_t j;
+
+    // the bit length of the largest magnitude equals the one of all magnitudes or'ed together
+    for (j = 0; j < len; j++) {
+        max |= (pRow[j] < 0) ? -(uint32_t)pRow[j] : (uint32_t)pRow[j];
+    }
+
+    shift = 13 - (int32_t)mat_solve_q16_bits(max);
+    for (j = 0; j < len; j++) {
+        pRow[j] = (int16_t)mat_solve_q16_shift(pRow[j], shift);
+    }
+
+    return -shift;
+}
+
+// subtracts factor * 2^expF times the pivot row from the row, and normalizes the result
+static void mat_solve_q16_update(int16_t *pRow,
+                                 const int16_t *pPivot,
+                                 uint32_t len,
+                                 int32_t factor,
+                                 int32_t expF,
+                                 int32_t *pExp,
+                                 int32_t pivotExp) {
+
+    // the products have the exponent expP, both terms are aligned to the common exponent expR
+    int32_t expP = expF + pivotExp;
+    int32_t expR = (expP > *pExp - 15) ? expP : *pExp - 15;
+    int32_t shiftRow = *pExp - expR;
+    int32_t shiftProd = expP - expR;
+    uint32_t max = 0;
+    int32_t shift;
+    uint32_t j;
+
+    for (j = 0; j < len; j++) {
+        int32_t r = mat_solve_q16_shift(pRow[j], shiftRow) -
+                    mat_solve_q16_shift(factor * pPivot[j], shiftProd);
+        max |= (uint32_t)abs(r);
+    }
+
+    shift = 13 - (int32_t)mat_solve_q16_bits(max);
+    for (j = 0; j < len; j++) {
+        int32_t r = mat_solve_q16_shift(pRow[j], shiftRow) -
+                    mat_solve_q16_shift(factor * pPivot[j], shiftProd);
+        pRow[j] = (int16_t)mat_solve_q16_shift(r, shift);
+    }
+    *pExp = expR - shift;
+}
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_upper_f32.c
+ * Description:  32-bit floating-point upper triangular solve glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSolve
+  @{
+ */
+
+/**
+  @brief Glue code for solving upper triangular systems of 32-bit floating-point matrices.
+  @param[in]  pU       Points to the upper triangular matrix of shape NxN
+  @param[in]  pB       Points to the right-hand side matrix of shape NxO
+  @param[in]  N        Width and height of the triangular matrix
+  @param[in]  O        Number of right-hand sides
+  @param[in]  unitDiag If set, the diagonal of pU is assumed to be one
+  @param[out] pX       Points to the solution matrix of shape NxO, may be equal to pB
+  @return     0: Success, 1: Matrix is singular, 2: operation not supported
+ */
+
+int plp_mat_solve_upper_f32(const float *pU,
+                            const float *pB,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t unitDiag,
+                            float *pX) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_solve_upper_f32s_xpulpv2(pU, pB, N, O, unitDiag, pX);
+    }
+}
+
+/**
+  @} end of MatSolve group
+ */
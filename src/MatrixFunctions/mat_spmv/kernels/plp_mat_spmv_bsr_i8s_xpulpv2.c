@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_spmv_bsr_i8s_xpulpv2.c
+ * Description:  8-bit integer block-sparse SpMV for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSpMV
+ */
+
+/**
+  @addtogroup MatSpMVKernels
+  @{
+ */
+
+/**
+   @brief 1x4 block-sparse (BSR) 8-bit integer matrix vector multiplication kernel for XPULPV2
+          extension.
+   @param[in]  pVal      points to the values of the blocks, four per block
+   @param[in]  pColIdx   first column of each block
+   @param[in]  pRowPtr   start of each row in blocks (M + 1 entries)
+   @param[in]  M         number of rows of the matrix
+   @param[in]  pSrcX     points to the input vector
+   @param[out] pDstY     points to the output vector (M elements)
+   @return     none
+
+   @par Exploiting SIMD instructions
+   Both the four values of a block and the four consecutive elements of the input vector are
+   loaded as one vector each, such that a single pv.sdotsp.b computes the whole block.
+*/
+
+void plp_mat_spmv_bsr_i8s_xpulpv2(const int8_t *__restrict__ pVal,
+                                  const uint16_t *__restrict__ pColIdx,
+                                  const uint32_t *__restrict__ pRowPtr,
+                                  uint32_t M,
+                                  const int8_t *__restrict__ pSrcX,
+                                  int32_t *__restrict__ pDstY) {
+
+    uint32_t m, k; // loop counters
+
+    for (m = 0; m < M; m++) {
+        int32_t sum = 0;
+        for (k = pRowPtr[m]; k < pRowPtr[m + 1]; k++) {
+            sum = __SUMDOTP4(*((v4s *)&pVal[4 * k]), *((v4s *)&pSrcX[pColIdx[k]]), sum);
+        }
+        pDstY[m] = sum;
+    }
+}
+
+/**
+   @} end of MatSpMVKernels group
+*/
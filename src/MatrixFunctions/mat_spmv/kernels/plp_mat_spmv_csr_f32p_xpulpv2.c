@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_spmv_csr_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point CSR SpMV for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSpMV
+ */
+
+/**
+  @addtogroup MatSpMVKernels
+  @{
+ */
+
+/**
+   @brief Parallel compressed sparse row (CSR) 32-bit floating-point matrix vector multiplication
+          kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_spmv_instance_f32 struct initialized by
+                     plp_mat_spmv_csr_f32_parallel
+   @return     none
+
+   @par Parallelization
+   Every core computes a contiguous range of rows. The ranges are chosen by plp_mat_spmv_split,
+   such that every core processes a similar number of non-zero elements.
+*/
+
+void plp_mat_spmv_csr_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_spmv_instance_f32 *a = (plp_mat_spmv_instance_f32 *)args;
+
+    const float *__restrict__ pVal = a->pVal;
+    const uint16_t *__restrict__ pColIdx = a->pColIdx;
+    const uint32_t *__restrict__ pRowPtr = a->pRowPtr;
+    uint32_t M = a->M;
+    const float *__restrict__ pSrcX = a->pSrcX;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstY = a->pDstY;
+
+    uint32_t m, k; // loop counters
+
+    uint32_t rowStart = plp_mat_spmv_split(pRowPtr, M, nPE, core_id);
+    uint32_t rowEnd = plp_mat_spmv_split(pRowPtr, M, nPE, core_id + 1);
+
+    for (m = rowStart; m < rowEnd; m++) {
+        float sum = 0.0f;
+        uint32_t kEnd = pRowPtr[m + 1];
+        for (k = pRowPtr[m]; k + 1 < kEnd; k += 2) {
+            float xVal0 = pSrcX[pColIdx[k]];
+            float xVal1 = pSrcX[pColIdx[k + 1]];
+            sum += pVal[k] * xVal0;
+            sum += pVal[k + 1] * xVal1;
+        }
+        if (k < kEnd) {
+            sum += pVal[k] * pSrcX[pColIdx[k]];
+        }
+        pDstY[m] = sum;
+    }
+}
+
+/**
+   @} end of MatSpMVKernels group
+*/
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_spmv_csr_f32s_xpulpv2.c
+ * Description:  32-bit floating-point CSR SpMV for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSpMV
+ */
+
+/**
+  @addtogroup MatSpMVKernels
+  @{
+ */
+
+/**
+   @brief Compressed sparse row (CSR) 32-bit floating-point matrix vector multiplication kernel for
+          XPULPV2 extension.
+   @param[in]  pVal      points to the non-zero elements
+   @param[in]  pColIdx   column index of each non-zero element
+   @param[in]  pRowPtr   start of each row in pVal and pColIdx (M + 1 entries)
+   @param[in]  M         number of rows of the matrix
+   @param[in]  pSrcX     points to the input vector
+   @param[out] pDstY     points to the output vector (M elements)
+   @return     none
+*/
+
+void plp_mat_spmv_csr_f32s_xpulpv2(const float *__restrict__ pVal,
+                                   const uint16_t *__restrict__ pColIdx,
+                                   const uint32_t *__restrict__ pRowPtr,
+                                   uint32_t M,
+                                   const float *__restrict__ pSrcX,
+                                   float *__restrict__ pDstY) {
+
+    uint32_t m, k; // loop counters
+
+    for (m = 0; m < M; m++) {
+        float sum = 0.0f;
+        uint32_t kEnd = pRowPtr[m + 1];
+        for (k = pRowPtr[m]; k + 1 < kEnd; k += 2) {
+            float xVal0 = pSrcX[pColIdx[k]];
+            float xVal1 = pSrcX[pColIdx[k + 1]];
+            sum += pVal[k] * xVal0;
+            sum += pVal[k + 1] * xVal1;
+        }
+        if (k < kEnd) {
+            sum += pVal[k] * pSrcX[pColIdx[k]];
+        }
+        pDstY[m] = sum;
+    }
+}
+
+/**
+   @} end of MatSpMVKernels group
+*/
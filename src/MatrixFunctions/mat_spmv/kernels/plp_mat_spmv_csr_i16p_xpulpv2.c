@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_spmv_csr_i16p_xpulpv2.c
+ * Description:  parallel 16-bit integer CSR SpMV for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSpMV
+ */
+
+/**
+  @addtogroup MatSpMVKernels
+  @{
+ */
+
+/**
+   @brief Parallel compressed sparse row (CSR) 16-bit integer matrix vector multiplication kernel
+          for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_spmv_instance_i16 struct initialized by
+                     plp_mat_spmv_csr_i16_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   Two non-zero elements of a row are loaded as one vector, and the matching elements of the
+   input vector are gathered into a second vector, such that a single pv.sdotsp.h computes two
+   products.
+
+   @par Parallelization
+   Every core computes a contiguous range of rows. The ranges are chosen by plp_mat_spmv_split,
+   such that every core processes a similar number of non-zero elements.
+*/
+
+void plp_mat_spmv_csr_i16p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_spmv_instance_i16 *a = (plp_mat_spmv_instance_i16 *)args;
+
+    const int16_t *__restrict__ pVal = a->pVal;
+    const uint16_t *__restrict__ pColIdx = a->pColIdx;
+    const uint32_t *__restrict__ pRowPtr = a->pRowPtr;
+    uint32_t M = a->M;
+    const int16_t *__restrict__ pSrcX = a->pSrcX;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstY = a->pDstY;
+
+    uint32_t m, k; // loop counters
+
+    uint32_t rowStart = plp_mat_spmv_split(pRowPtr, M, nPE, core_id);
+    uint32_t rowEnd = plp_mat_spmv_split(pRowPtr, M, nPE, core_id + 1);
+
+    for (m = rowStart; m < rowEnd; m++) {
+        int32_t sum = 0;
+        uint32_t kEnd = pRowPtr[m + 1];
+        for (k = pRowPtr[m]; k + 1 < kEnd; k += 2) {
+            v2s xVec = { pSrcX[pColIdx[k]], pSrcX[pColIdx[k + 1]] };
+            sum = __SUMDOTP2(*((v2s *)&pVal[k]), xVec, sum);
+        }
+        if (k < kEnd) {
+            sum += (int32_t)pVal[k] * (int32_t)pSrcX[pColIdx[k]];
+        }
+        pDstY[m] = sum;
+    }
+}
+
+/**
+   @} end of MatSpMVKernels group
+*/
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_spmv_csr_i16s_rv32im.c
+ * Description:  16-bit integer CSR SpMV for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSpMV
+ */
+
+/**
+  @defgroup MatSpMVKernels sparse matrix vector multiplication kernels
+  This module contains the kernel code for the multiplication of a sparse matrix with a dense
+  vector.
+ */
+
+/**
+  @addtogroup MatSpMVKernels
+  @{
+ */
+
+/**
+   @brief Compressed sparse row (CSR) 16-bit integer matrix vector multiplication kernel for RV32IM
+          extension.
+   @param[in]  pVal      points to the non-zero elements
+   @param[in]  pColIdx   column index of each non-zero element
+   @param[in]  pRowPtr   start of each row in pVal and pColIdx (M + 1 entries)
+   @param[in]  M         number of rows of the matrix
+   @param[in]  pSrcX     points to the input vector
+   @param[out] pDstY     points to the output vector (M elements)
+   @return     none
+*/
+
+void plp_mat_spmv_csr_i16s_rv32im(const int16_t *__restrict__ pVal,
+                                  const uint16_t *__restrict__ pColIdx,
+                                  const uint32_t *__restrict__ pRowPtr,
+                                  uint32_t M,
+                                  const int16_t *__restrict__ pSrcX,
+                                  int32_t *__restrict__ pDstY) {
+
+    uint32_t m, k; // loop counters
+
+    for (m = 0; m < M; m++) {
+        int32_t sum = 0;
+        for (k = pRowPtr[m]; k < pRowPtr[m + 1]; k++) {
+            sum += (int32_t)pVal[k] * (int32_t)pSrcX[pColIdx[k]];
+        }
+        pDstY[m] = sum;
+    }
+}
+
+/**
+   @} end of MatSpMVKernels group
+*/
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_spmv_bsr_i8_parallel.c
+ * Description:  parallel 8-bit integer block-sparse SpMV glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSpMV
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel multiplication of a 1x4 block-sparse (BSR) 8-bit integer matrix
+         with a vector.
+  @param[in]  pVal      points to the values of the blocks, four per block
+  @param[in]  pColIdx   first column of each block
+  @param[in]  pRowPtr   start of each row in blocks (M + 1 entries)
+  @param[in]  M         number of rows of the matrix
+  @param[in]  pSrcX     points to the input vector
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDstY     points to the output vector (M elements)
+  @return     none
+
+  @par Block-sparse format
+  Every row is stored as a list of blocks of four consecutive elements (1x4). The blocks of row m
+  are pRowPtr[m] to pRowPtr[m + 1] - 1. Block k starts at column pColIdx[k], and its four values
+  are pVal[4 * k] to pVal[4 * k + 3]. All four columns of a block must be inside of pSrcX.
+
+  @par Load balancing
+  The rows are not split evenly among the cores. Instead, every core processes a contiguous range
+  of rows with a similar number of blocks, see plp_mat_spmv_split.
+ */
+
+void plp_mat_spmv_bsr_i8_parallel(const int8_t *__restrict__ pVal,
+                                  const uint16_t *__restrict__ pColIdx,
+                                  const uint32_t *__restrict__ pRowPtr,
+                                  uint32_t M,
+                                  const int8_t *__restrict__ pSrcX,
+                                  uint32_t nPE,
+                                  int32_t *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_spmv_instance_i8 args = { .pVal = pVal,
+                                          .pColIdx = pColIdx,
+                                          .pRowPtr = pRowPtr,
+                                          .M = M,
+                                          .pSrcX = pSrcX,
+                                          .nPE = nPE,
+                                          .pDstY = pDstY };
+        rt_team_fork(nPE, plp_mat_spmv_bsr_i8p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatSpMV group
+ */
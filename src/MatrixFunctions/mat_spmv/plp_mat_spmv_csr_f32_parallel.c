@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_spmv_csr_f32_parallel.c
+ * Description:  parallel 32-bit floating-point CSR SpMV glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSpMV
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel multiplication of a compressed sparse row (CSR) 32-bit
+         floating-point matrix with a vector.
+  @param[in]  pVal      points to the non-zero elements
+  @param[in]  pColIdx   column index of each non-zero element
+  @param[in]  pRowPtr   start of each row in pVal and pColIdx (M + 1 entries)
+  @param[in]  M         number of rows of the matrix
+  @param[in]  pSrcX     points to the input vector
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDstY     points to the output vector (M elements)
+  @return     none
+
+  @par Compressed sparse row format
+  The non-zero elements of row m are pVal[pRowPtr[m]] to pVal[pRowPtr[m + 1] - 1], and their
+  columns are stored at the same positions in pColIdx.
+
+  @par Load balancing
+  The rows are not split evenly among the cores. Instead, every core processes a contiguous range
+  of rows with a similar number of non-zero elements, see plp_mat_spmv_split.
+ */
+
+void plp_mat_spmv_csr_f32_parallel(const float *__restrict__ pVal,
+                                   const uint16_t *__restrict__ pColIdx,
+                                   const uint32_t *__restrict__ pRowPtr,
+                                   uint32_t M,
+                                   const float *__restrict__ pSrcX,
+                                   uint32_t nPE,
+                                   float *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_spmv_instance_f32 args = { .pVal = pVal,
+                                           .pColIdx = pColIdx,
+                                           .pRowPtr = pRowPtr,
+                                           .M = M,
+                                           .pSrcX = pSrcX,
+                                           .nPE = nPE,
+                                           .pDstY = pDstY };
+        rt_team_fork(nPE, plp_mat_spmv_csr_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatSpMV group
+ */
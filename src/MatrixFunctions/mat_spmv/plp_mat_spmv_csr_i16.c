@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_spmv_csr_i16.c
+ * Description:  16-bit integer CSR SpMV glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatSpMV sparse matrix vector multiplication
+  This module contains the glue code for the multiplication of a sparse matrix with a dense
+  vector. The kernel codes (kernels) are in the Module sparse matrix vector multiplication
+  Kernels.
+
+  \f[
+    y = A \cdot x
+  \f]
+
+  Only the non-zero elements of the matrix are stored, either in the compressed sparse row (CSR)
+  format, or as blocks of four consecutive elements (1x4 block-sparse), which allows the use of
+  vector loads on the values and on the input vector. The column indices are stored as 16-bit
+  unsigned integers, and the row pointers as 32-bit unsigned integers.
+ */
+
+/**
+  @addtogroup MatSpMV
+  @{
+ */
+
+/**
+  @brief Glue code for the multiplication of a compressed sparse row (CSR) 16-bit integer matrix
+         with a vector.
+  @param[in]  pVal      points to the non-zero elements
+  @param[in]  pColIdx   column index of each non-zero element
+  @param[in]  pRowPtr   start of each row in pVal and pColIdx (M + 1 entries)
+  @param[in]  M         number of rows of the matrix
+  @param[in]  pSrcX     points to the input vector
+  @param[out] pDstY     points to the output vector (M elements)
+  @return     none
+
+  @par Compressed sparse row format
+  The non-zero elements of row m are pVal[pRowPtr[m]] to pVal[pRowPtr[m + 1] - 1], and their
+  columns are stored at the same positions in pColIdx.
+ */
+
+void plp_mat_spmv_csr_i16(const int16_t *__restrict__ pVal,
+                          const uint16_t *__restrict__ pColIdx,
+                          const uint32_t *__restrict__ pRowPtr,
+                          uint32_t M,
+                          const int16_t *__restrict__ pSrcX,
+                          int32_t *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_spmv_csr_i16s_rv32im(pVal, pColIdx, pRowPtr, M, pSrcX, pDstY);
+    } else {
+        plp_mat_spmv_csr_i16s_xpulpv2(pVal, pColIdx, pRowPtr, M, pSrcX, pDstY);
+    }
+}
+
+/**
+  @} end of MatSpMV group
+ */
@@ -45,15 +45,15 @@
   @param[in]  pSrcB   Points to the second input matrix
   @param[in]  M       Height of all matrices
   @param[in]  N       Width of all matrices
-  @param[out] pDst    Points to the output matrix
+  @param[out] pDst    Points to the output matrix, may be equal to pSrcA or pSrcB
   @return     none
  */
 
-void plp_mat_sub_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                              const int16_t *__restrict__ pSrcB,
+void plp_mat_sub_i16s_xpulpv2(const int16_t *pSrcA,
+                              const int16_t *pSrcB,
                               uint32_t M,
                               uint32_t N,
-                              int16_t *__restrict__ pDst) {
+                              int16_t *pDst) {
 
     uint32_t i; // loop counters
     uint32_t total = M*N; // we can see it as a 1D operation
@@ -63,9 +63,11 @@ void plp_mat_sub_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
         *((v2s*)(pDst + 4*i    )) = __SUB2(*((v2s*)(pSrcA + 4*i    )), *((v2s*)(pSrcB + 4*i    )));
         *((v2s*)(pDst + 4*i + 2)) = __SUB2(*((v2s*)(pSrcA + 4*i + 2)), *((v2s*)(pSrcB + 4*i + 2)));
     }
-    // to save the branch we just always compute the possibly remaining element
-    *((v2s*)(pDst + total - 2)) = __SUB2(*((v2s*)(pSrcA + total - 2)), *((v2s*)(pSrcB + total - 2)));
-    *((v2s*)(pDst + total - 4)) = __SUB2(*((v2s*)(pSrcA + total - 4)), *((v2s*)(pSrcB + total - 4)));
+    // compute the remaining elements, such that no element is computed twice (which would
+    // break in-place operation)
+    for (i = (total >> 2) << 2; i < total; i++) {
+        pDst[i] = pSrcA[i] - pSrcB[i];
+    }
 #else // No PLP_MATH_LOOPUNROLL
     for (i = 0; i < total; i++) {
             pDst[i] = pSrcA[i] - pSrcB[i];
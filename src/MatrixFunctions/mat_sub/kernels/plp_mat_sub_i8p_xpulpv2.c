@@ -56,12 +56,12 @@ void plp_mat_sub_i8p_xpulpv2(void *args) {
 
     plp_mat_sub_instance_i8 *a = (plp_mat_sub_instance_i8 *)args;
 
-    const int8_t *__restrict__ pSrcA = a->pSrcA;
-    const int8_t *__restrict__ pSrcB = a->pSrcB;
+    const int8_t *pSrcA = a->pSrcA;
+    const int8_t *pSrcB = a->pSrcB;
     uint32_t M = a->M;
     uint32_t N = a->N;
     uint32_t nPE = a->nPE;
-    int8_t *__restrict__ pDst = a->pDst;
+    int8_t *pDst = a->pDst;
 
     uint32_t i; // loop counters
     uint32_t total = M*N; // we can see it as a 1D operation
@@ -78,12 +78,13 @@ void plp_mat_sub_i8p_xpulpv2(void *args) {
         *((v4s*)(pDst + 8*i + 4)) = __SUB4(*((v4s*)(pSrcA + 8*i + 4)), *((v4s*)(pSrcB + 8*i + 4)));
     }
 
-    // to save the branch we just compute the possibly remaining element always and with all cores
-    // might lead to wait cycles due to contention while writing the same element
-    // possible improvement 1: last core has least work to do if there is a remaining element, make use of this
-    // possible improvement 2: if the cores that don't compute flush the pipeline, it should not be a waste of time, make use of this
-    *((v4s*)(pDst + total - 4)) = __SUB4(*((v4s*)(pSrcA + total - 4)), *((v4s*)(pSrcB + total - 4)));
-    *((v4s*)(pDst + total - 8)) = __SUB4(*((v4s*)(pSrcA + total - 8)), *((v4s*)(pSrcB + total - 8)));
+    // the remaining elements are computed by the last core only, such that no element is
+    // computed twice (which would break in-place operation)
+    if (core_id == nPE - 1) {
+        for (i = (total >> 3) << 3; i < total; i++) {
+            pDst[i] = pSrcA[i] - pSrcB[i];
+        }
+    }
 #else // No PLP_MATH_LOOPUNROLL
     // amount of elements per core, rounded up
     uint32_t per_core = (total+nPE-1)/nPE;
@@ -46,15 +46,15 @@
   @param[in]  M       Height of all matrices
   @param[in]  N       Width of all matrices
   <PARALLEL_ARG_DOC>
-  @param[out] pDst    Points to the output matrix
+  @param[out] pDst    Points to the output matrix, may be equal to pSrcA or pSrcB
   @return     none
  */
 
-void plp_mat_sub_f32(const float *__restrict__ pSrcA,
-                     const float *__restrict__ pSrcB,
+void plp_mat_sub_f32(const float *pSrcA,
+                     const float *pSrcB,
                      uint32_t M,
                      uint32_t N,
-                     float *__restrict__ pDst) {
+                     float *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
@@ -44,6 +44,8 @@
 
       `pDst[m, n] = pSrcA[m, n] - pSrcB[m, n]`
 
+  The output matrix may be equal to one of the input matrices (in-place operation).
+
   There are functions for integer 32- 16- and 8-bit data types, as well as for floating-point. These
   functions can also be used for fix-point matrices, if they have their fix-point at the same
   location. The outpt matrix will then also have the fix-point at the same location.
@@ -71,15 +73,15 @@
   @param[in]  pSrcB   Points to the second input matrix
   @param[in]  M       Height of all matrices
   @param[in]  N       Width of all matrices
-  @param[out] pDst    Points to the output matrix
+  @param[out] pDst    Points to the output matrix, may be equal to pSrcA or pSrcB
   @return     none
  */
 
-void plp_mat_sub_i16(const int16_t *__restrict__ pSrcA,
-                     const int16_t *__restrict__ pSrcB,
+void plp_mat_sub_i16(const int16_t *pSrcA,
+                     const int16_t *pSrcB,
                      uint32_t M,
                      uint32_t N,
-                     int16_t *__restrict__ pDst) {
+                     int16_t *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_sub_i16s_rv32im(pSrcA, pSrcB, M, N, pDst);
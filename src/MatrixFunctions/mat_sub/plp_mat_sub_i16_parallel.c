@@ -46,16 +46,16 @@
   @param[in]  M       Height of all matrices
   @param[in]  N       Width of all matrices
   @param[in]  nPE     Number of cores to use for computation
-  @param[out] pDst    Points to the output matrix
+  @param[out] pDst    Points to the output matrix, may be equal to pSrcA or pSrcB
   @return     none
  */
 
-void plp_mat_sub_i16_parallel(const int16_t *__restrict__ pSrcA,
-                              const int16_t *__restrict__ pSrcB,
+void plp_mat_sub_i16_parallel(const int16_t *pSrcA,
+                              const int16_t *pSrcB,
                               uint32_t M,
                               uint32_t N,
                               uint32_t nPE,
-                              int16_t *__restrict__ pDst) {
+                              int16_t *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
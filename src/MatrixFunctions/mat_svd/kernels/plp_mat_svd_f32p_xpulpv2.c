@@ -0,0 +1,242 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_svd_f32p_xpulpv2.c
+ * Description:  Parallel 32-bit floating-point singular value decomposition for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Jacobi rotation (c, s), which diagonalizes the symmetric 2x2 matrix [app apq; apq aqq]
+static inline void plp_mat_jacobi_rotation_f32(float app,
+                                               float aqq,
+                                               float apq,
+                                               float *pC,
+                                               float *pS) {
+    float tau = (aqq - app) / (2.0f * apq);
+    float t = 1.0f / (fabsf(tau) + sqrtf(1.0f + tau * tau));
+
+    if (tau < 0.0f) {
+        t = -t;
+    }
+
+    *pC = 1.0f / sqrtf(1.0f + t * t);
+    *pS = t * *pC;
+}
+
+// rotates the columns p and q of the matrix with M rows and a row stride of N
+static inline void plp_mat_jacobi_rotate_cols_f32(float *pSrc,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t p,
+                                                  uint32_t q,
+                                                  float c,
+                                                  float s) {
+    uint32_t i;
+
+    for (i = 0; i < M; i++) {
+        float xp = pSrc[i * N + p];
+        float xq = pSrc[i * N + q];
+        pSrc[i * N + p] = c * xp - s * xq;
+        pSrc[i * N + q] = s * xp + c * xq;
+    }
+}
+
+// orthogonalizes the columns p and q of U, and applies the same rotation to V. Returns 1 if the
+// columns were rotated, and 0 if they are orthogonal within PLP_MAT_JACOBI_TOL.
+static inline uint32_t plp_mat_svd_rotate_f32(float *pU,
+                                              float *pV,
+                                              uint32_t M,
+                                              uint32_t N,
+                                              uint32_t p,
+                                              uint32_t q) {
+    uint32_t i;
+    float alpha = 0.0f;
+    float beta = 0.0f;
+    float gamma = 0.0f;
+    float c, s;
+
+    for (i = 0; i < M; i++) {
+        float up = pU[i * N + p];
+        float uq = pU[i * N + q];
+        alpha += up * up;
+        beta += uq * uq;
+        gamma += up * uq;
+    }
+
+    if (gamma * gamma <= PLP_MAT_JACOBI_TOL * PLP_MAT_JACOBI_TOL * alpha * beta) {
+        return 0;
+    }
+
+    plp_mat_jacobi_rotation_f32(alpha, beta, gamma, &c, &s);
+    plp_mat_jacobi_rotate_cols_f32(pU, M, N, p, q, c, s);
+    plp_mat_jacobi_rotate_cols_f32(pV, N, N, p, q, c, s);
+
+    return 1;
+}
+
+// pair i of round r of the round-robin ordering of n indices (n even). In every round, each index
+// is part of exactly one pair, and all pairs are visited once during n - 1 rounds.
+static inline void plp_mat_jacobi_pair(uint32_t n,
+                                       uint32_t r,
+                                       uint32_t i,
+                                       uint32_t *pP,
+                                       uint32_t *pQ) {
+    uint32_t p = (i == 0) ? r : (r + i) % (n - 1);
+    uint32_t q = (i == 0) ? n - 1 : (r + n - 1 - i) % (n - 1);
+
+    *pP = (p < q) ? p : q;
+    *pQ = (p < q) ? q : p;
+}
+
+// sorts the singular values in descending order, together with the columns of U and V
+static inline void plp_mat_svd_sort_f32(float *pU, float *pS, float *pV, uint32_t M, uint32_t N) {
+    uint32_t i, j, k;
+
+    for (j = 0; j < N; j++) {
+        k = j;
+        for (i = j + 1; i < N; i++) {
+            if (pS[i] > pS[k]) {
+                k = i;
+            }
+        }
+        if (k != j) {
+            float tmp = pS[j];
+            pS[j] = pS[k];
+            pS[k] = tmp;
+            for (i = 0; i < M; i++) {
+                tmp = pU[i * N + j];
+                pU[i * N + j] = pU[i * N + k];
+                pU[i * N + k] = tmp;
+            }
+            for (i = 0; i < N; i++) {
+                tmp = pV[i * N + j];
+                pV[i * N + j] = pV[i * N + k];
+                pV[i * N + k] = tmp;
+            }
+        }
+    }
+}
+
+/**
+  @ingroup MatSVD
+ */
+
+/**
+  @addtogroup MatSVDKernels
+  @{
+ */
+
+/**
+   @brief Parallel singular value decomposition of 32-bit floating-point matrices kernel for
+          XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_svd_instance_f32 struct initialized by
+                     plp_mat_svd_f32_parallel
+   @return     none, the status (0: Success, 1: no convergence) is written to args->ret
+
+   @par Parallelization
+   A sweep consists of N - 1 rounds of the round-robin ordering (N is rounded up to be even). The
+   N/2 column pairs of a round are independent, and are distributed among the cores, followed by
+   a rt_team_barrier. The number of rotations of each core is collected in pRotations, such that
+   all cores take the same decision to stop.
+*/
+
+void plp_mat_svd_f32p_xpulpv2(void *args) {
+
+    uint32_t core_id = rt_core_id();
+
+    plp_mat_svd_instance_f32 *a = (plp_mat_svd_instance_f32 *)args;
+
+    const float *__restrict__ pSrc = a->pSrc;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pU = a->pU;
+    float *__restrict__ pS = a->pS;
+    float *__restrict__ pV = a->pV;
+    uint32_t *pRotations = a->pRotations;
+
+    uint32_t i, j, r, sweep; // loop counters
+    uint32_t rotations = 1;
+    uint32_t nEven = N + (N & 1);
+
+    for (i = core_id; i < M * N; i += nPE) {
+        pU[i] = pSrc[i];
+    }
+    for (i = core_id; i < N * N; i += nPE) {
+        pV[i] = (i % (N + 1) == 0) ? 1.0f : 0.0f;
+    }
+
+    rt_team_barrier();
+
+    for (sweep = 0; sweep < PLP_MAT_JACOBI_MAX_SWEEPS && rotations > 0; sweep++) {
+        uint32_t *pSweepRotations = pRotations + (sweep & 1) * nPE;
+
+        pSweepRotations[core_id] = 0;
+
+        for (r = 0; r < nEven - 1; r++) {
+            uint32_t p, q;
+
+            for (i = core_id; i < nEven / 2; i += nPE) {
+                plp_mat_jacobi_pair(nEven, r, i, &p, &q);
+                if (q < N) {
+                    pSweepRotations[core_id] += plp_mat_svd_rotate_f32(pU, pV, M, N, p, q);
+                }
+            }
+
+            rt_team_barrier();
+        }
+
+        // the counters of this sweep are not reset before the next barrier
+        rotations = 0;
+        for (i = 0; i < nPE; i++) {
+            rotations += pSweepRotations[i];
+        }
+    }
+
+    // the singular values are the norms of the orthogonal columns
+    for (j = core_id; j < N; j += nPE) {
+        float norm2 = 0.0f;
+        for (i = 0; i < M; i++) {
+            norm2 += pU[i * N + j] * pU[i * N + j];
+        }
+        pS[j] = sqrtf(norm2);
+        float scale = (norm2 > 0.0f) ? 1.0f / pS[j] : 0.0f;
+        for (i = 0; i < M; i++) {
+            pU[i * N + j] *= scale;
+        }
+    }
+
+    rt_team_barrier();
+
+    if (core_id == 0) {
+        plp_mat_svd_sort_f32(pU, pS, pV, M, N);
+
+        a->ret = (rotations > 0) ? 1 : 0;
+    }
+}
+
+/**
+   @} end of MatSVDKernels group
+*/
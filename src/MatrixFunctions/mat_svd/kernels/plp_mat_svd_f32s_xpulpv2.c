@@ -0,0 +1,211 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_svd_f32s_xpulpv2.c
+ * Description:  32-bit floating-point singular value decomposition for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Jacobi rotation (c, s), which diagonalizes the symmetric 2x2 matrix [app apq; apq aqq]
+static inline void plp_mat_jacobi_rotation_f32(float app,
+                                               float aqq,
+                                               float apq,
+                                               float *pC,
+                                               float *pS) {
+    float tau = (aqq - app) / (2.0f * apq);
+    float t = 1.0f / (fabsf(tau) + sqrtf(1.0f + tau * tau));
+
+    if (tau < 0.0f) {
+        t = -t;
+    }
+
+    *pC = 1.0f / sqrtf(1.0f + t * t);
+    *pS = t * *pC;
+}
+
+// rotates the columns p and q of the matrix with M rows and a row stride of N
+static inline void plp_mat_jacobi_rotate_cols_f32(float *pSrc,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t p,
+                                                  uint32_t q,
+                                                  float c,
+                                                  float s) {
+    uint32_t i;
+
+    for (i = 0; i < M; i++) {
+        float xp = pSrc[i * N + p];
+        float xq = pSrc[i * N + q];
+        pSrc[i * N + p] = c * xp - s * xq;
+        pSrc[i * N + q] = s * xp + c * xq;
+    }
+}
+
+// orthogonalizes the columns p and q of U, and applies the same rotation to V. Returns 1 if the
+// columns were rotated, and 0 if they are orthogonal within PLP_MAT_JACOBI_TOL.
+static inline uint32_t plp_mat_svd_rotate_f32(float *pU,
+                                              float *pV,
+                                              uint32_t M,
+                                              uint32_t N,
+                                              uint32_t p,
+                                              uint32_t q) {
+    uint32_t i;
+    float alpha = 0.0f;
+    float beta = 0.0f;
+    float gamma = 0.0f;
+    float c, s;
+
+    for (i = 0; i < M; i++) {
+        float up = pU[i * N + p];
+        float uq = pU[i * N + q];
+        alpha += up * up;
+        beta += uq * uq;
+        gamma += up * uq;
+    }
+
+    if (gamma * gamma <= PLP_MAT_JACOBI_TOL * PLP_MAT_JACOBI_TOL * alpha * beta) {
+        return 0;
+    }
+
+    plp_mat_jacobi_rotation_f32(alpha, beta, gamma, &c, &s);
+    plp_mat_jacobi_rotate_cols_f32(pU, M, N, p, q, c, s);
+    plp_mat_jacobi_rotate_cols_f32(pV, N, N, p, q, c, s);
+
+    return 1;
+}
+
+// sorts the singular values in descending order, together with the columns of U and V
+static inline void plp_mat_svd_sort_f32(float *pU, float *pS, float *pV, uint32_t M, uint32_t N) {
+    uint32_t i, j, k;
+
+    for (j = 0; j < N; j++) {
+        k = j;
+        for (i = j + 1; i < N; i++) {
+            if (pS[i] > pS[k]) {
+                k = i;
+            }
+        }
+        if (k != j) {
+            float tmp = pS[j];
+            pS[j] = pS[k];
+            pS[k] = tmp;
+            for (i = 0; i < M; i++) {
+                tmp = pU[i * N + j];
+                pU[i * N + j] = pU[i * N + k];
+                pU[i * N + k] = tmp;
+            }
+            for (i = 0; i < N; i++) {
+                tmp = pV[i * N + j];
+                pV[i * N + j] = pV[i * N + k];
+                pV[i * N + k] = tmp;
+            }
+        }
+    }
+}
+
+/**
+  @ingroup MatSVD
+ */
+
+/**
+  @defgroup MatSVDKernels Singular value decomposition kernels
+  This module contains the kernel functions for the singular value decomposition.
+
+  @par Algorithm
+  The one-sided Jacobi method rotates pairs of columns of U = A until they are orthogonal, and
+  accumulates the rotations in V. Pairs which are orthogonal within PLP_MAT_JACOBI_TOL are skipped,
+  and the iteration stops after the first sweep without a rotation. The singular values are the
+  norms of the columns of U, which are then normalized.
+ */
+
+/**
+  @addtogroup MatSVDKernels
+  @{
+ */
+
+/**
+  @brief Singular value decomposition of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrc  Points to the input matrix of shape MxN
+  @param[in]  M     Height of the input matrix and of U
+  @param[in]  N     Width of the input matrix and of U, width and height of V
+  @param[out] pU    Points to the output matrix U of shape MxN
+  @param[out] pS    Points to the N singular values, in descending order
+  @param[out] pV    Points to the orthogonal output matrix V of shape NxN
+  @return     0: Success, 1: M is smaller than N or no convergence within
+              PLP_MAT_JACOBI_MAX_SWEEPS sweeps
+ */
+
+int plp_mat_svd_f32s_xpulpv2(const float *__restrict__ pSrc,
+                             uint32_t M,
+                             uint32_t N,
+                             float *__restrict__ pU,
+                             float *__restrict__ pS,
+                             float *__restrict__ pV) {
+
+    uint32_t i, j, sweep; // loop counters
+    uint32_t rotations = 1;
+
+    if (M < N) {
+        return 1;
+    }
+
+    for (i = 0; i < M * N; i++) {
+        pU[i] = pSrc[i];
+    }
+    for (i = 0; i < N * N; i++) {
+        pV[i] = (i % (N + 1) == 0) ? 1.0f : 0.0f;
+    }
+
+    for (sweep = 0; sweep < PLP_MAT_JACOBI_MAX_SWEEPS && rotations > 0; sweep++) {
+        rotations = 0;
+        for (i = 0; i < N; i++) {
+            for (j = i + 1; j < N; j++) {
+                rotations += plp_mat_svd_rotate_f32(pU, pV, M, N, i, j);
+            }
+        }
+    }
+
+    // the singular values are the norms of the orthogonal columns
+    for (j = 0; j < N; j++) {
+        float norm2 = 0.0f;
+        for (i = 0; i < M; i++) {
+            norm2 += pU[i * N + j] * pU[i * N + j];
+        }
+        pS[j] = sqrtf(norm2);
+        float scale = (norm2 > 0.0f) ? 1.0f / pS[j] : 0.0f;
+        for (i = 0; i < M; i++) {
+            pU[i * N + j] *= scale;
+        }
+    }
+
+    plp_mat_svd_sort_f32(pU, pS, pV, M, N);
+
+    return (rotations > 0) ? 1 : 0;
+}
+
+/**
+  @} end of MatSVDKernels group
+ */
@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_svd_f32.c
+ * Description:  Glue code for the 32-bit floating-point singular value decomposition
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatSVD Singular value decomposition
+  This module contains the glue code for the singular value decomposition. The kernel codes
+  (kernels) are in the Module Singular value decomposition Kernels.
+
+  The thin singular value decomposition factors a matrix A of shape MxN with M >= N into a matrix
+  U of shape MxN with orthonormal columns, the non-negative singular values S, and an orthogonal
+  matrix V of shape NxN:
+
+  \f[
+    A = U \cdot diag(S) \cdot V^T
+  \f]
+
+  The singular values are sorted in descending order. Columns of U that belong to a singular value
+  of zero are set to zero.
+
+  @par Algorithm
+  The one-sided Jacobi method rotates pairs of columns of A until all columns are orthogonal
+  within PLP_MAT_JACOBI_TOL, or PLP_MAT_JACOBI_MAX_SWEEPS sweeps over all pairs are done. The
+  norms of the columns are the singular values. The parallel version uses a round-robin ordering,
+  in which every round consists of N/2 independent column pairs, which are rotated concurrently on
+  the cores.
+ */
+
+/**
+  @addtogroup MatSVD
+  @{
+ */
+
+/**
+  @brief Glue code for the singular value decomposition of 32-bit floating-point matrices.
+  @param[in]  pSrc  Points to the input matrix of shape MxN
+  @param[in]  M     Height of the input matrix and of U
+  @param[in]  N     Width of the input matrix and of U, width and height of V
+  @param[out] pU    Points to the output matrix U of shape MxN
+  @param[out] pS    Points to the N singular values, in descending order
+  @param[out] pV    Points to the orthogonal output matrix V of shape NxN
+  @return     0: Success, 1: M is smaller than N or no convergence within
+              PLP_MAT_JACOBI_MAX_SWEEPS sweeps, 2: operation not supported
+ */
+
+int plp_mat_svd_f32(const float *__restrict__ pSrc,
+                    uint32_t M,
+                    uint32_t N,
+                    float *__restrict__ pU,
+                    float *__restrict__ pS,
+                    float *__restrict__ pV) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_svd_f32s_xpulpv2(pSrc, M, N, pU, pS, pV);
+    }
+}
+
+/**
+  @} end of MatSVD group
+ */
@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_symv_f32p_xpulpv2.c
+ * Description:  Parallel 32-bit floating-point symmetric matrix vector multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// element i of A * x, from row i of the lower triangle and column i below the diagonal
+static inline float plp_mat_symv_row_f32(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcX,
+                                         uint32_t N,
+                                         uint32_t i) {
+    const float *pA = pSrcA + PLP_MAT_PACKED_IDX(i, 0);
+    float sum = 0.0f;
+    uint32_t j;
+
+    for (j = 0; j <= i; j++) {
+        sum += pA[j] * pSrcX[j];
+    }
+
+    // (j, i) is i + 1 elements after the diagonal element (j - 1, j - 1) of the row before
+    pA += 2 * i + 1;
+    for (j = i + 1; j < N; j++) {
+        sum += *pA * pSrcX[j];
+        pA += j + 1;
+    }
+
+    return sum;
+}
+
+/**
+  @ingroup MatSymv
+ */
+
+/**
+  @addtogroup MatSymvKernels
+  @{
+ */
+
+/**
+   @brief Parallel multiplication of a packed symmetric 32-bit floating-point matrix with a vector
+          kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_symv_instance_f32 struct initialized by
+                     plp_mat_symv_f32_parallel
+   @return     none
+
+   @par Parallelization
+   Every output element reads N elements of A, hence the outputs are split into contiguous
+   ranges of equal size.
+*/
+
+void plp_mat_symv_f32p_xpulpv2(void *args) {
+
+    uint32_t core_id = rt_core_id();
+
+    plp_mat_symv_instance_f32 *a = (plp_mat_symv_instance_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcX = a->pSrcX;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstY = a->pDstY;
+
+    uint32_t i;
+    uint32_t start = (N * core_id) / nPE;
+    uint32_t end = (N * (core_id + 1)) / nPE;
+
+    for (i = start; i < end; i++) {
+        pDstY[i] = plp_mat_symv_row_f32(pSrcA, pSrcX, N, i);
+    }
+}
+
+/**
+   @} end of MatSymvKernels group
+*/
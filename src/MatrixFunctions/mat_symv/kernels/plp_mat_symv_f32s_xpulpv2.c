@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_symv_f32s_xpulpv2.c
+ * Description:  32-bit floating-point symmetric matrix vector multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// element i of A * x, from row i of the lower triangle and column i below the diagonal
+static inline float plp_mat_symv_row_f32(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcX,
+                                         uint32_t N,
+                                         uint32_t i) {
+    const float *pA = pSrcA + PLP_MAT_PACKED_IDX(i, 0);
+    float sum = 0.0f;
+    uint32_t j;
+
+    for (j = 0; j <= i; j++) {
+        sum += pA[j] * pSrcX[j];
+    }
+
+    // (j, i) is i + 1 elements after the diagonal element (j - 1, j - 1) of the row before
+    pA += 2 * i + 1;
+    for (j = i + 1; j < N; j++) {
+        sum += *pA * pSrcX[j];
+        pA += j + 1;
+    }
+
+    return sum;
+}
+
+/**
+  @ingroup MatSymv
+ */
+
+/**
+  @defgroup MatSymvKernels Symmetric matrix vector multiplication kernels
+  This module contains the kernel functions for the multiplication of a packed symmetric matrix
+  with a vector.
+ */
+
+/**
+  @addtogroup MatSymvKernels
+  @{
+ */
+
+/**
+  @brief Multiplication of a packed symmetric 32-bit floating-point matrix with a vector kernel
+         for XPULPV2 extension.
+  @param[in]  pSrcA  points to the packed symmetric matrix of PLP_MAT_PACKED_LEN(N) values
+  @param[in]  pSrcX  points to the input vector of N values
+  @param[in]  N      width and height of the matrix
+  @param[out] pDstY  points to the output vector of N values
+  @return     none
+ */
+
+void plp_mat_symv_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcX,
+                               uint32_t N,
+                               float *__restrict__ pDstY) {
+
+    uint32_t i;
+
+    for (i = 0; i < N; i++) {
+        pDstY[i] = plp_mat_symv_row_f32(pSrcA, pSrcX, N, i);
+    }
+}
+
+/**
+  @} end of MatSymvKernels group
+ */
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_symv_f32.c
+ * Description:  Glue code for the 32-bit floating-point symmetric matrix vector multiplication
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatSymv Symmetric matrix vector multiplication
+  This module contains the glue code for the multiplication of a packed symmetric matrix A of
+  shape NxN with a vector x. The kernel codes (kernels) are in the Module Symmetric matrix vector
+  multiplication Kernels.
+
+  \f[
+    y = A \cdot x
+  \f]
+
+  A is stored in the packed format of MatPacked. Element (i, j) with j > i is read from the lower
+  triangle at (j, i).
+ */
+
+/**
+  @addtogroup MatSymv
+  @{
+ */
+
+/**
+  @brief Glue code for the multiplication of a packed symmetric 32-bit floating-point matrix with
+         a vector.
+  @param[in]  pSrcA  points to the packed symmetric matrix of PLP_MAT_PACKED_LEN(N) values
+  @param[in]  pSrcX  points to the input vector of N values
+  @param[in]  N      width and height of the matrix
+  @param[out] pDstY  points to the output vector of N values
+  @return     none
+ */
+
+void plp_mat_symv_f32(const float *__restrict__ pSrcA,
+                      const float *__restrict__ pSrcX,
+                      uint32_t N,
+                      float *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_symv_f32s_xpulpv2(pSrcA, pSrcX, N, pDstY);
+    }
+}
+
+/**
+  @} end of MatSymv group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_symv_f32_parallel.c
+ * Description:  Glue code for the parallel 32-bit floating-point symmetric matrix vector product
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSymv
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel multiplication of a packed symmetric 32-bit floating-point
+         matrix with a vector.
+  @param[in]  pSrcA  points to the packed symmetric matrix of PLP_MAT_PACKED_LEN(N) values
+  @param[in]  pSrcX  points to the input vector of N values
+  @param[in]  N      width and height of the matrix
+  @param[in]  nPE    Number of cores to use
+  @param[out] pDstY  points to the output vector of N values
+  @return     none
+ */
+
+void plp_mat_symv_f32_parallel(const float *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcX,
+                               uint32_t N,
+                               uint32_t nPE,
+                               float *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_symv_instance_f32 args = { .pSrcA = pSrcA,
+                                           .pSrcX = pSrcX,
+                                           .N = N,
+                                           .nPE = nPE,
+                                           .pDstY = pDstY };
+        rt_team_fork(nPE, plp_mat_symv_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatSymv group
+ */
@@ -0,0 +1,120 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_syrk_f32p_xpulpv2.c
+ * Description:  Parallel 32-bit floating-point symmetric rank-k update for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// packed elements (i, j) of A * A^T for j in [jStart, jEnd), two at a time
+static inline void plp_mat_syrk_row_f32(const float *__restrict__ pSrcA,
+                                        uint32_t K,
+                                        uint32_t strideA,
+                                        uint32_t i,
+                                        uint32_t jStart,
+                                        uint32_t jEnd,
+                                        float *__restrict__ pDst) {
+    const float *pRowI = pSrcA + i * strideA;
+    uint32_t j, k;
+
+    for (j = jStart; j + 1 < jEnd; j += 2) {
+        const float *pRowJ0 = pSrcA + j * strideA;
+        const float *pRowJ1 = pRowJ0 + strideA;
+        float sum0 = 0.0f;
+        float sum1 = 0.0f;
+        for (k = 0; k < K; k++) {
+            float a = pRowI[k];
+            sum0 += a * pRowJ0[k];
+            sum1 += a * pRowJ1[k];
+        }
+        *pDst++ = sum0;
+        *pDst++ = sum1;
+    }
+    if (j < jEnd) {
+        const float *pRowJ = pSrcA + j * strideA;
+        float sum = 0.0f;
+        for (k = 0; k < K; k++) {
+            sum += pRowI[k] * pRowJ[k];
+        }
+        *pDst = sum;
+    }
+}
+
+/**
+  @ingroup MatSyrk
+ */
+
+/**
+  @addtogroup MatSyrkKernels
+  @{
+ */
+
+/**
+   @brief Parallel symmetric rank-k product of a 32-bit floating-point matrix kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_mat_syrk_instance_f32 struct initialized by
+                     plp_mat_syrk_f32_parallel
+   @return     none
+
+   @par Parallelization
+   The rows of the triangle have different lengths. Therefore, the packed output is split into
+   nPE contiguous ranges of equal size, which may start and end in the middle of a row.
+*/
+
+void plp_mat_syrk_f32p_xpulpv2(void *args) {
+
+    uint32_t core_id = rt_core_id();
+
+    plp_mat_syrk_instance_f32 *a = (plp_mat_syrk_instance_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    uint32_t N = a->N;
+    uint32_t K = a->K;
+    uint32_t strideA = a->strideA;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstC = a->pDstC;
+
+    uint32_t len = PLP_MAT_PACKED_LEN(N);
+    uint32_t start = (len * core_id) / nPE;
+    uint32_t end = (len * (core_id + 1)) / nPE;
+    uint32_t i = 0;
+
+    // row of the first element
+    while (PLP_MAT_PACKED_LEN(i + 1) <= start) {
+        i++;
+    }
+
+    while (start < end) {
+        uint32_t jStart = start - PLP_MAT_PACKED_IDX(i, 0);
+        uint32_t jEnd = (end < PLP_MAT_PACKED_LEN(i + 1)) ? end - PLP_MAT_PACKED_IDX(i, 0) : i + 1;
+        plp_mat_syrk_row_f32(pSrcA, K, strideA, i, jStart, jEnd, pDstC + start);
+        start += jEnd - jStart;
+        i++;
+    }
+}
+
+/**
+   @} end of MatSyrkKernels group
+*/
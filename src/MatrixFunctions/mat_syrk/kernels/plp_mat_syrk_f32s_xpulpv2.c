@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_syrk_f32s_xpulpv2.c
+ * Description:  32-bit floating-point symmetric rank-k update for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// packed elements (i, j) of A * A^T for j in [jStart, jEnd), two at a time
+static inline void plp_mat_syrk_row_f32(const float *__restrict__ pSrcA,
+                                        uint32_t K,
+                                        uint32_t strideA,
+                                        uint32_t i,
+                                        uint32_t jStart,
+                                        uint32_t jEnd,
+                                        float *__restrict__ pDst) {
+    const float *pRowI = pSrcA + i * strideA;
+    uint32_t j, k;
+
+    for (j = jStart; j + 1 < jEnd; j += 2) {
+        const float *pRowJ0 = pSrcA + j * strideA;
+        const float *pRowJ1 = pRowJ0 + strideA;
+        float sum0 = 0.0f;
+        float sum1 = 0.0f;
+        for (k = 0; k < K; k++) {
+            float a = pRowI[k];
+            sum0 += a * pRowJ0[k];
+            sum1 += a * pRowJ1[k];
+        }
+        *pDst++ = sum0;
+        *pDst++ = sum1;
+    }
+    if (j < jEnd) {
+        const float *pRowJ = pSrcA + j * strideA;
+        float sum = 0.0f;
+        for (k = 0; k < K; k++) {
+            sum += pRowI[k] * pRowJ[k];
+        }
+        *pDst = sum;
+    }
+}
+
+/**
+  @ingroup MatSyrk
+ */
+
+/**
+  @defgroup MatSyrkKernels Symmetric rank-k update kernels
+  This module contains the kernel functions for the symmetric rank-k product C = A * A^T, of
+  which only the lower triangle is computed in packed storage.
+ */
+
+/**
+  @addtogroup MatSyrkKernels
+  @{
+ */
+
+/**
+  @brief Symmetric rank-k product of a 32-bit floating-point matrix kernel for XPULPV2 extension.
+  @param[in]  pSrcA    points to the input matrix of shape NxK
+  @param[in]  N        height of the input matrix, width and height of the output
+  @param[in]  K        width of the input matrix
+  @param[in]  strideA  stride of matrix A (elements between each row)
+  @param[out] pDstC    points to the packed output of PLP_MAT_PACKED_LEN(N) values
+  @return     none
+ */
+
+void plp_mat_syrk_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                               uint32_t N,
+                               uint32_t K,
+                               uint32_t strideA,
+                               float *__restrict__ pDstC) {
+
+    uint32_t i;
+
+    for (i = 0; i < N; i++) {
+        plp_mat_syrk_row_f32(pSrcA, K, strideA, i, 0, i + 1, pDstC + PLP_MAT_PACKED_IDX(i, 0));
+    }
+}
+
+/**
+  @} end of MatSyrkKernels group
+ */
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_syrk_f32.c
+ * Description:  Glue code for the 32-bit floating-point symmetric rank-k update
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatSyrk Symmetric rank-k update
+  This module contains the glue code for the symmetric rank-k product of a matrix A of shape NxK
+  with its transpose. The kernel codes (kernels) are in the Module Symmetric rank-k update
+  Kernels.
+
+  \f[
+    C = A \cdot A^T
+  \f]
+
+  The result is symmetric, hence only its lower triangle is computed and stored in the packed
+  format of MatPacked, which halves the work and the memory compared to plp_mat_mult_trans_f32. A
+  is accessed with a stride like in MatrixFunctionsStride.
+ */
+
+/**
+  @addtogroup MatSyrk
+  @{
+ */
+
+/**
+  @brief Glue code for the symmetric rank-k product of a 32-bit floating-point matrix.
+  @param[in]  pSrcA    points to the input matrix of shape NxK
+  @param[in]  N        height of the input matrix, width and height of the output
+  @param[in]  K        width of the input matrix
+  @param[in]  strideA  stride of matrix A (elements between each row)
+  @param[out] pDstC    points to the packed output of PLP_MAT_PACKED_LEN(N) values
+  @return     none
+ */
+
+void plp_mat_syrk_f32(const float *__restrict__ pSrcA,
+                      uint32_t N,
+                      uint32_t K,
+                      uint32_t strideA,
+                      float *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_syrk_f32s_xpulpv2(pSrcA, N, K, strideA, pDstC);
+    }
+}
+
+/**
+  @} end of MatSyrk group
+ */
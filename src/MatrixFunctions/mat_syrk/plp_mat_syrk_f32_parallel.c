@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_syrk_f32_parallel.c
+ * Description:  Glue code for the parallel 32-bit floating-point symmetric rank-k update
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSyrk
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel symmetric rank-k product of a 32-bit floating-point matrix.
+  @param[in]  pSrcA    points to the input matrix of shape NxK
+  @param[in]  N        height of the input matrix, width and height of the output
+  @param[in]  K        width of the input matrix
+  @param[in]  strideA  stride of matrix A (elements between each row)
+  @param[in]  nPE      Number of cores to use
+  @param[out] pDstC    points to the packed output of PLP_MAT_PACKED_LEN(N) values
+  @return     none
+ */
+
+void plp_mat_syrk_f32_parallel(const float *__restrict__ pSrcA,
+                               uint32_t N,
+                               uint32_t K,
+                               uint32_t strideA,
+                               uint32_t nPE,
+                               float *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_syrk_instance_f32 args = { .pSrcA = pSrcA,
+                                           .N = N,
+                                           .K = K,
+                                           .strideA = strideA,
+                                           .nPE = nPE,
+                                           .pDstC = pDstC };
+        rt_team_fork(nPE, plp_mat_syrk_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatSyrk group
+ */
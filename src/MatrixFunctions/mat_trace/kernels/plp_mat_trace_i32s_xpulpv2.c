@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trace_i32s_xpulpv2.c
+ * Description:  32-bit integer matrix trace for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTrace
+ */
+
+/**
+  @addtogroup MatTraceKernels
+  @{
+ */
+
+/**
+  @brief Trace of a 32-bit integer matrix kernel for XPULPV2 extension.
+  @param[in]  pSrc  Points to the input matrix
+  @param[in]  N     Width and height of the matrix
+  @param[out] pRes  Points to the trace
+  @return     none
+ */
+
+void plp_mat_trace_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                uint32_t N,
+                                int32_t *__restrict__ pRes) {
+
+    uint32_t i;
+    int32_t sum = 0;
+    const int32_t *p = pSrc;
+
+    for (i = 0; i < N; i++) {
+        sum += *p;
+        p += N + 1;
+    }
+
+    *pRes = sum;
+}
+
+/**
+   @} end of MatTraceKernels group
+*/
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trace_i16.c
+ * Description:  16-bit integer matrix trace glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatTrace matrix trace
+  This module contains the glue code for the trace of a matrix. The kernel codes (kernels) are in
+  the Module matrix trace Kernels.
+
+  The trace is the sum of the diagonal elements of a square matrix of dimension NxN. The integer
+  functions accumulate with 32 bits, and can also be used for fix-point matrices, whose trace has
+  the same fix-point. There are no parallel versions, since the N elements on the diagonal cost
+  less than forking the team.
+ */
+
+/**
+  @addtogroup MatTrace
+  @{
+ */
+
+/**
+  @brief Glue code for the trace of a 16-bit integer matrix.
+  @param[in]  pSrc  Points to the input matrix
+  @param[in]  N     Width and height of the matrix
+  @param[out] pRes  Points to the trace
+  @return     none
+ */
+
+void plp_mat_trace_i16(const int16_t *__restrict__ pSrc,
+                       uint32_t N,
+                       int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_trace_i16s_rv32im(pSrc, N, pRes);
+    } else {
+        plp_mat_trace_i16s_xpulpv2(pSrc, N, pRes);
+    }
+}
+
+/**
+  @} end of MatTrace group
+ */
@@ -46,8 +46,8 @@
   @return     none
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  The matrix is transposed in tiles of 2x2 elements, such that every row of a tile is a single
+  32-bit word, which is transposed with two shuffle instructions.
 */
 
 void plp_mat_trans_i16p_xpulpv2(void *args) {
@@ -62,21 +62,66 @@ void plp_mat_trans_i16p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int16_t *__restrict__ pDst = a->pDst;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int n = 0; n < N; n++) {
+    plp_mat_partition_t part;
+    plp_mat_partition(M, N, nPE, core_id, &part);
+
+    for (int m = part.rowStart; m < part.rowEnd; m++) {
+        for (int n = part.colStart; n < part.colEnd; n++) {
             pDst[n * M + m] = pSrc[m * N + n];
         }
     }
 
 #else
 
-    // TODO: Hackathon
+    uint32_t m, n;                 // loop counters
+    uint32_t tilesM = M / 2;       // number of full tiles in each column
+    uint32_t tilesN = N / 2;       // number of full tiles in each row
+    uint32_t tm = core_id, tn = 0; // tile position
+
+    // The tiles of 2x2 elements are distributed cyclically in row-major order of the output
+    // matrix. Hence, the cores write neighboring words of the same output rows at the same time,
+    // which are located in different TCDM banks.
+    if (tilesM > 0) {
+        while (tm >= tilesM) {
+            tm -= tilesM;
+            tn++;
+        }
+    }
+
+    while (tilesM > 0 && tn < tilesN) {
+        m = tm * 2;
+        n = tn * 2;
+        v2s row0 = *((v2s *)&pSrc[m * N + n]);
+        v2s row1 = *((v2s *)&pSrc[(m + 1) * N + n]);
+        *((v2s *)&pDst[n * M + m]) = __builtin_shuffle(row0, row1, (v2s){ 0, 2 });
+        *((v2s *)&pDst[(n + 1) * M + m]) = __builtin_shuffle(row0, row1, (v2s){ 1, 3 });
+
+        tm += nPE;
+        while (tm >= tilesM) {
+            tm -= tilesM;
+            tn++;
+        }
+    }
+
+    // last column of the input matrix, if N is odd
+    if (N & 1) {
+        for (m = core_id; m < M; m += nPE) {
+            pDst[(N - 1) * M + m] = pSrc[m * N + N - 1];
+        }
+    }
+
+    // last row of the input matrix, if M is odd
+    if (M & 1) {
+        for (n = core_id; n < tilesN * 2; n += nPE) {
+            pDst[n * M + M - 1] = pSrc[(M - 1) * N + n];
+        }
+    }
 
 #endif
-#undef BASIC_VERSION
+// undefine BASIC_VERSION
 }
 
 /**
@@ -53,7 +53,7 @@ void plp_mat_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
                                 uint32_t N,
                                 int16_t *__restrict__ pDst) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     for (int m = 0; m < M; m++) {
@@ -64,10 +64,33 @@ void plp_mat_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
 
 #else
 
-    // TODO: Hackathon
+    uint32_t m, n; // loop counters
+
+    // the matrix is transposed in tiles of 2x2 elements, such that every row of a tile is a
+    // single 32-bit word, which is transposed with two shuffle instructions
+    for (m = 0; m + 1 < M; m += 2) {
+        const int16_t *pRow0 = pSrc + m * N;
+        const int16_t *pRow1 = pRow0 + N;
+        for (n = 0; n + 1 < N; n += 2) {
+            v2s row0 = *((v2s *)&pRow0[n]);
+            v2s row1 = *((v2s *)&pRow1[n]);
+            *((v2s *)&pDst[n * M + m]) = __builtin_shuffle(row0, row1, (v2s){ 0, 2 });
+            *((v2s *)&pDst[(n + 1) * M + m]) = __builtin_shuffle(row0, row1, (v2s){ 1, 3 });
+        }
+        if (n < N) {
+            pDst[n * M + m] = pRow0[n];
+            pDst[n * M + m + 1] = pRow1[n];
+        }
+    }
+
+    if (m < M) {
+        for (n = 0; n < N; n++) {
+            pDst[n * M + m] = pSrc[m * N + n];
+        }
+    }
 
 #endif
-#undef BASIC_VERSION
+// undefine BASIC_VERSION
 }
 /**
    @} end of MatTransKernels group
@@ -58,21 +58,33 @@ void plp_mat_trans_i32p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int32_t *__restrict__ pDst = a->pDst;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int n = 0; n < N; n++) {
+    plp_mat_partition_t part;
+    plp_mat_partition(M, N, nPE, core_id, &part);
+
+    for (int m = part.rowStart; m < part.rowEnd; m++) {
+        for (int n = part.colStart; n < part.colEnd; n++) {
             pDst[n * M + m] = pSrc[m * N + n];
         }
     }
 
 #else
 
-    // TODO: Hackathon
+    uint32_t m, n; // loop counters
+
+    // The rows of the input matrix are distributed cyclically. Hence, the cores write
+    // neighboring words of the same output rows at the same time, which are located in different
+    // TCDM banks.
+    for (m = core_id; m < M; m += nPE) {
+        for (n = 0; n < N; n++) {
+            pDst[n * M + m] = pSrc[m * N + n];
+        }
+    }
 
 #endif
-#undef BASIC_VERSION
+// undefine BASIC_VERSION
 }
 
 /**
@@ -46,8 +46,8 @@
   @return     none
 
   @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  The matrix is transposed in tiles of 4x4 elements, such that every row of a tile is a single
+  32-bit word, which is transposed with two stages of shuffle instructions.
 */
 
 void plp_mat_trans_i8p_xpulpv2(void *args) {
@@ -62,21 +62,74 @@ void plp_mat_trans_i8p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int8_t *__restrict__ pDst = a->pDst;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int n = 0; n < N; n++) {
+    plp_mat_partition_t part;
+    plp_mat_partition(M, N, nPE, core_id, &part);
+
+    for (int m = part.rowStart; m < part.rowEnd; m++) {
+        for (int n = part.colStart; n < part.colEnd; n++) {
             pDst[n * M + m] = pSrc[m * N + n];
         }
     }
 
 #else
 
-    // TODO: Hackathon
+    uint32_t m, n;                 // loop counters
+    uint32_t tilesM = M / 4;       // number of full tiles in each column
+    uint32_t tilesN = N / 4;       // number of full tiles in each row
+    uint32_t tm = core_id, tn = 0; // tile position
+
+    // The tiles of 4x4 elements are distributed cyclically in row-major order of the output
+    // matrix. Hence, the cores write neighboring words of the same output rows at the same time,
+    // which are located in different TCDM banks.
+    if (tilesM > 0) {
+        while (tm >= tilesM) {
+            tm -= tilesM;
+            tn++;
+        }
+    }
+
+    while (tilesM > 0 && tn < tilesN) {
+        const int8_t *pIn = pSrc + (tm * 4) * N + tn * 4;
+        v4s row0 = *((v4s *)&pIn[0]);
+        v4s row1 = *((v4s *)&pIn[N]);
+        v4s row2 = *((v4s *)&pIn[2 * N]);
+        v4s row3 = *((v4s *)&pIn[3 * N]);
+        v4s tmp0 = __builtin_shuffle(row0, row1, (v4s){ 0, 4, 2, 6 });
+        v4s tmp1 = __builtin_shuffle(row0, row1, (v4s){ 1, 5, 3, 7 });
+        v4s tmp2 = __builtin_shuffle(row2, row3, (v4s){ 0, 4, 2, 6 });
+        v4s tmp3 = __builtin_shuffle(row2, row3, (v4s){ 1, 5, 3, 7 });
+        int8_t *pOut = pDst + (tn * 4) * M + tm * 4;
+        *((v4s *)&pOut[0]) = __builtin_shuffle(tmp0, tmp2, (v4s){ 0, 1, 4, 5 });
+        *((v4s *)&pOut[M]) = __builtin_shuffle(tmp1, tmp3, (v4s){ 0, 1, 4, 5 });
+        *((v4s *)&pOut[2 * M]) = __builtin_shuffle(tmp0, tmp2, (v4s){ 2, 3, 6, 7 });
+        *((v4s *)&pOut[3 * M]) = __builtin_shuffle(tmp1, tmp3, (v4s){ 2, 3, 6, 7 });
+
+        tm += nPE;
+        while (tm >= tilesM) {
+            tm -= tilesM;
+            tn++;
+        }
+    }
+
+    // last columns of the input matrix, if N is not a multiple of 4
+    for (m = core_id; m < M; m += nPE) {
+        for (n = tilesN * 4; n < N; n++) {
+            pDst[n * M + m] = pSrc[m * N + n];
+        }
+    }
+
+    // last rows of the input matrix, if M is not a multiple of 4
+    for (n = core_id; n < tilesN * 4; n += nPE) {
+        for (m = tilesM * 4; m < M; m++) {
+            pDst[n * M + m] = pSrc[m * N + n];
+        }
+    }
 
 #endif
-#undef BASIC_VERSION
+// undefine BASIC_VERSION
 }
 
 /**
@@ -53,7 +53,7 @@ void plp_mat_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
                                uint32_t N,
                                int8_t *__restrict__ pDst) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     for (int m = 0; m < M; m++) {
@@ -64,10 +64,46 @@ void plp_mat_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
 
 #else
 
-    // TODO: Hackathon
+    uint32_t m, n; // loop counters
+
+    // the matrix is transposed in tiles of 4x4 elements, such that every row of a tile is a
+    // single 32-bit word, which is transposed with two stages of shuffle instructions
+    for (m = 0; m + 3 < M; m += 4) {
+        const int8_t *pRow0 = pSrc + m * N;
+        const int8_t *pRow1 = pRow0 + N;
+        const int8_t *pRow2 = pRow1 + N;
+        const int8_t *pRow3 = pRow2 + N;
+        for (n = 0; n + 3 < N; n += 4) {
+            v4s row0 = *((v4s *)&pRow0[n]);
+            v4s row1 = *((v4s *)&pRow1[n]);
+            v4s row2 = *((v4s *)&pRow2[n]);
+            v4s row3 = *((v4s *)&pRow3[n]);
+            v4s tmp0 = __builtin_shuffle(row0, row1, (v4s){ 0, 4, 2, 6 });
+            v4s tmp1 = __builtin_shuffle(row0, row1, (v4s){ 1, 5, 3, 7 });
+            v4s tmp2 = __builtin_shuffle(row2, row3, (v4s){ 0, 4, 2, 6 });
+            v4s tmp3 = __builtin_shuffle(row2, row3, (v4s){ 1, 5, 3, 7 });
+            int8_t *pOut = pDst + n * M + m;
+            *((v4s *)&pOut[0]) = __builtin_shuffle(tmp0, tmp2, (v4s){ 0, 1, 4, 5 });
+            *((v4s *)&pOut[M]) = __builtin_shuffle(tmp1, tmp3, (v4s){ 0, 1, 4, 5 });
+            *((v4s *)&pOut[2 * M]) = __builtin_shuffle(tmp0, tmp2, (v4s){ 2, 3, 6, 7 });
+            *((v4s *)&pOut[3 * M]) = __builtin_shuffle(tmp1, tmp3, (v4s){ 2, 3, 6, 7 });
+        }
+        for (; n < N; n++) {
+            pDst[n * M + m] = pRow0[n];
+            pDst[n * M + m + 1] = pRow1[n];
+            pDst[n * M + m + 2] = pRow2[n];
+            pDst[n * M + m + 3] = pRow3[n];
+        }
+    }
+
+    for (; m < M; m++) {
+        for (n = 0; n < N; n++) {
+            pDst[n * M + m] = pSrc[m * N + n];
+        }
+    }
 
 #endif
-#undef BASIC_VERSION
+// undefine BASIC_VERSION
 }
 /**
    @} end of MatTransKernels group
@@ -0,0 +1,62 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_in_place_i16s_rv32im.c
+ * Description:  16-bit integer in-place matrix transpose for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTrans
+ */
+
+/**
+  @addtogroup MatTransKernels
+  @{
+ */
+
+/**
+  @brief In-place matrix transpose of 16-bit integer matrices kernel for RV32IM extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @return        none
+ */
+
+void plp_mat_trans_in_place_i16s_rv32im(int16_t *__restrict__ pSrcDst, uint32_t N) {
+
+    uint32_t i, j; // loop counters
+
+    for (i = 0; i < N; i++) {
+        for (j = i + 1; j < N; j++) {
+            int16_t tmp = pSrcDst[i * N + j];
+            pSrcDst[i * N + j] = pSrcDst[j * N + i];
+            pSrcDst[j * N + i] = tmp;
+        }
+    }
+}
+
+/**
+   @} end of MatTransKernels group
+*/
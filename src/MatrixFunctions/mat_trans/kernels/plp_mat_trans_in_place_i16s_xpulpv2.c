@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_in_place_i16s_xpulpv2.c
+ * Description:  16-bit integer in-place matrix transpose for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTrans
+ */
+
+/**
+  @addtogroup MatTransKernels
+  @{
+ */
+
+/**
+  @brief In-place matrix transpose of 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @return        none
+ */
+
+void plp_mat_trans_in_place_i16s_xpulpv2(int16_t *__restrict__ pSrcDst, uint32_t N) {
+
+    uint32_t i, j; // loop counters
+
+    // the matrix is transposed in tiles of 2x2 elements, such that every row of a tile is a
+    // single 32-bit word, which is transposed with two shuffle instructions
+    for (i = 0; i + 1 < N; i += 2) {
+        int16_t *pRow0 = pSrcDst + i * N;
+        int16_t *pRow1 = pRow0 + N;
+
+        // tile on the diagonal
+        v2s row0 = *((v2s *)&pRow0[i]);
+        v2s row1 = *((v2s *)&pRow1[i]);
+        *((v2s *)&pRow0[i]) = __builtin_shuffle(row0, row1, (v2s){ 0, 2 });
+        *((v2s *)&pRow1[i]) = __builtin_shuffle(row0, row1, (v2s){ 1, 3 });
+
+        // swap the tiles right of the diagonal with the mirrored ones below
+        for (j = i + 2; j + 1 < N; j += 2) {
+            int16_t *pCol0 = pSrcDst + j * N + i;
+            int16_t *pCol1 = pCol0 + N;
+            v2s upper0 = *((v2s *)&pRow0[j]);
+            v2s upper1 = *((v2s *)&pRow1[j]);
+            v2s lower0 = *((v2s *)pCol0);
+            v2s lower1 = *((v2s *)pCol1);
+            *((v2s *)pCol0) = __builtin_shuffle(upper0, upper1, (v2s){ 0, 2 });
+            *((v2s *)pCol1) = __builtin_shuffle(upper0, upper1, (v2s){ 1, 3 });
+            *((v2s *)&pRow0[j]) = __builtin_shuffle(lower0, lower1, (v2s){ 0, 2 });
+            *((v2s *)&pRow1[j]) = __builtin_shuffle(lower0, lower1, (v2s){ 1, 3 });
+        }
+    }
+
+    // last row and column, if N is odd
+    if (N & 1) {
+        j = N - 1;
+        for (i = 0; i < j; i++) {
+            int16_t tmp = pSrcDst[i * N + j];
+            pSrcDst[i * N + j] = pSrcDst[j * N + i];
+            pSrcDst[j * N + i] = tmp;
+        }
+    }
+}
+
+/**
+   @} end of MatTransKernels group
+*/
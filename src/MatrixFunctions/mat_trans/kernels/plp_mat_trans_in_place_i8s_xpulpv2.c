@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_in_place_i8s_xpulpv2.c
+ * Description:  8-bit integer in-place matrix transpose for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTrans
+ */
+
+/**
+  @addtogroup MatTransKernels
+  @{
+ */
+
+/**
+  @brief In-place matrix transpose of 8-bit integer matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @return        none
+ */
+
+void plp_mat_trans_in_place_i8s_xpulpv2(int8_t *__restrict__ pSrcDst, uint32_t N) {
+
+    uint32_t i, j; // loop counters
+
+    // the matrix is transposed in tiles of 4x4 elements, such that every row of a tile is a
+    // single 32-bit word, which is transposed with two stages of shuffle instructions
+    for (i = 0; i + 3 < N; i += 4) {
+        int8_t *pRow = pSrcDst + i * N;
+
+        // tile on the diagonal
+        v4s row0 = *((v4s *)&pRow[i]);
+        v4s row1 = *((v4s *)&pRow[N + i]);
+        v4s row2 = *((v4s *)&pRow[2 * N + i]);
+        v4s row3 = *((v4s *)&pRow[3 * N + i]);
+        v4s tmp0 = __builtin_shuffle(row0, row1, (v4s){ 0, 4, 2, 6 });
+        v4s tmp1 = __builtin_shuffle(row0, row1, (v4s){ 1, 5, 3, 7 });
+        v4s tmp2 = __builtin_shuffle(row2, row3, (v4s){ 0, 4, 2, 6 });
+        v4s tmp3 = __builtin_shuffle(row2, row3, (v4s){ 1, 5, 3, 7 });
+        *((v4s *)&pRow[i]) = __builtin_shuffle(tmp0, tmp2, (v4s){ 0, 1, 4, 5 });
+        *((v4s *)&pRow[N + i]) = __builtin_shuffle(tmp1, tmp3, (v4s){ 0, 1, 4, 5 });
+        *((v4s *)&pRow[2 * N + i]) = __builtin_shuffle(tmp0, tmp2, (v4s){ 2, 3, 6, 7 });
+        *((v4s *)&pRow[3 * N + i]) = __builtin_shuffle(tmp1, tmp3, (v4s){ 2, 3, 6, 7 });
+
+        // swap the tiles right of the diagonal with the mirrored ones below
+        for (j = i + 4; j + 3 < N; j += 4) {
+            int8_t *pCol = pSrcDst + j * N + i;
+            v4s upper0 = *((v4s *)&pRow[j]);
+            v4s upper1 = *((v4s *)&pRow[N + j]);
+            v4s upper2 = *((v4s *)&pRow[2 * N + j]);
+            v4s upper3 = *((v4s *)&pRow[3 * N + j]);
+            v4s lower0 = *((v4s *)&pCol[0]);
+            v4s lower1 = *((v4s *)&pCol[N]);
+            v4s lower2 = *((v4s *)&pCol[2 * N]);
+            v4s lower3 = *((v4s *)&pCol[3 * N]);
+
+            tmp0 = __builtin_shuffle(upper0, upper1, (v4s){ 0, 4, 2, 6 });
+            tmp1 = __builtin_shuffle(upper0, upper1, (v4s){ 1, 5, 3, 7 });
+            tmp2 = __builtin_shuffle(upper2, upper3, (v4s){ 0, 4, 2, 6 });
+            tmp3 = __builtin_shuffle(upper2, upper3, (v4s){ 1, 5, 3, 7 });
+            *((v4s *)&pCol[0]) = __builtin_shuffle(tmp0, tmp2, (v4s){ 0, 1, 4, 5 });
+            *((v4s *)&pCol[N]) = __builtin_shuffle(tmp1, tmp3, (v4s){ 0, 1, 4, 5 });
+            *((v4s *)&pCol[2 * N]) = __builtin_shuffle(tmp0, tmp2, (v4s){ 2, 3, 6, 7 });
+            *((v4s *)&pCol[3 * N]) = __builtin_shuffle(tmp1, tmp3, (v4s){ 2, 3, 6, 7 });
+
+            tmp0 = __builtin_shuffle(lower0, lower1, (v4s){ 0, 4, 2, 6 });
+            tmp1 = __builtin_shuffle(lower0, lower1, (v4s){ 1, 5, 3, 7 });
+            tmp2 = __builtin_shuffle(lower2, lower3, (v4s){ 0, 4, 2, 6 });
+            tmp3 = __builtin_shuffle(lower2, lower3, (v4s){ 1, 5, 3, 7 });
+            *((v4s *)&pRow[j]) = __builtin_shuffle(tmp0, tmp2, (v4s){ 0, 1, 4, 5 });
+            *((v4s *)&pRow[N + j]) = __builtin_shuffle(tmp1, tmp3, (v4s){ 0, 1, 4, 5 });
+            *((v4s *)&pRow[2 * N + j]) = __builtin_shuffle(tmp0, tmp2, (v4s){ 2, 3, 6, 7 });
+            *((v4s *)&pRow[3 * N + j]) = __builtin_shuffle(tmp1, tmp3, (v4s){ 2, 3, 6, 7 });
+        }
+    }
+
+    // last rows and columns, if N is not a multiple of 4
+    for (j = N & ~3u; j < N; j++) {
+        for (i = 0; i < j; i++) {
+            int8_t tmp = pSrcDst[i * N + j];
+            pSrcDst[i * N + j] = pSrcDst[j * N + i];
+            pSrcDst[j * N + i] = tmp;
+        }
+    }
+}
+
+/**
+   @} end of MatTransKernels group
+*/
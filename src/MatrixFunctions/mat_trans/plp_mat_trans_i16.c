@@ -48,6 +48,17 @@
 
   There are functions for integer 32- 16- and 8-bit data types, as well as for
   floating-point. These functions can also be used for fix-point matrices.
+
+  @par In-place transpose
+  Square matrices can be transposed in place with plp_mat_trans_in_place, which
+  needs no second buffer of the same size.
+
+  @par Blocking
+  On the cluster, 16-bit and 8-bit matrices are transposed in tiles of 2x2 and
+  4x4 elements, such that every row of a tile is a single 32-bit word, which is
+  transposed with shuffle instructions. The parallel kernels distribute the work
+  such that the cores write to neighboring words, located in different TCDM
+  banks.
  */
 
 /**
@@ -0,0 +1,62 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_in_place_i16_parallel.c
+ * Description:  parallel 16-bit integer in-place matrix transpose glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatTrans
+  @{
+ */
+
+/**
+  @brief Glue code for parallel in-place matrix transpose of 16-bit integer matrices.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @param[in]     nPE     Number of cores to use for computation
+  @return        none
+ */
+
+void plp_mat_trans_in_place_i16_parallel(int16_t *__restrict__ pSrcDst, uint32_t N, uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_trans_in_place_instance_i16 args = { .pSrcDst = pSrcDst, .N = N, .nPE = nPE };
+
+        rt_team_fork(nPE, plp_mat_trans_in_place_i16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatTrans group
+ */
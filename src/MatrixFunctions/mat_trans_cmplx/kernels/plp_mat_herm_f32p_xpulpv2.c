@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herm_f32p_xpulpv2.c
+ * Description:  parallel complex 32-bit floating-point conjugate transpose for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransCmplx
+ */
+
+/**
+  @addtogroup MatTransCmplxKernels
+  @{
+ */
+
+/**
+  @brief Parallel conjugate transpose of complex 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_trans_instance_f32 struct initialized by
+                    plp_mat_herm_f32_parallel
+  @return     none
+ */
+
+void plp_mat_herm_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_trans_instance_f32 *a = (plp_mat_trans_instance_f32 *)args;
+
+    const float *__restrict__ pSrc = a->pSrc;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDst = a->pDst;
+
+    uint32_t m, n; // loop counters
+
+    // The rows of the input matrix are distributed cyclically. Hence, the cores write
+    // neighboring complex numbers of the same output rows at the same time, which are located
+    // in different TCDM banks.
+    for (m = core_id; m < M; m += nPE) {
+        for (n = 0; n < N; n++) {
+            pDst[2 * (n * M + m)] = pSrc[2 * (m * N + n)];
+            pDst[2 * (n * M + m) + 1] = -pSrc[2 * (m * N + n) + 1];
+        }
+    }
+}
+
+/**
+  @} end of MatTransCmplxKernels group
+ */
@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herm_i16s_xpulpv2.c
+ * Description:  complex 16-bit integer conjugate transpose for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransCmplx
+ */
+
+// conjugate of a complex number in one word, the imaginary part saturated
+static inline v2s conj_i16(v2s x) {
+    return __PACK2(x[0], __CLIP(-x[1], 15));
+}
+
+/**
+  @addtogroup MatTransCmplxKernels
+  @{
+ */
+
+/**
+  @brief Conjugate transpose of complex 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc Points to the complex input matrix of shape MxN
+  @param[in]  M    Height of the input and width of the output matrix, in complex numbers
+  @param[in]  N    Width of the input and height of the output matrix, in complex numbers
+  @param[out] pDst Points to the complex output matrix of shape NxM
+  @return     none
+
+  @par Blocking
+  The matrix is transposed in tiles of 2x2 complex numbers. Every complex number is a single 32-bit
+  word, which is read and written with one access.
+ */
+
+void plp_mat_herm_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                               uint32_t M,
+                               uint32_t N,
+                               int16_t *__restrict__ pDst) {
+
+    const v2s *pIn = (const v2s *)pSrc;
+    v2s *pOut = (v2s *)pDst;
+    uint32_t m, n; // loop counters
+
+    // the matrix is transposed in tiles of 2x2 complex numbers, such that every tile reads two
+    // neighboring words of two input rows, and writes two neighboring words of two output rows
+    for (m = 0; m + 1 < M; m += 2) {
+        const v2s *pIn0 = pIn + m * N;
+        const v2s *pIn1 = pIn0 + N;
+        for (n = 0; n + 1 < N; n += 2) {
+            v2s *pOut0 = pOut + n * M + m;
+            v2s *pOut1 = pOut0 + M;
+            v2s a0 = pIn0[n], a1 = pIn0[n + 1];
+            v2s b0 = pIn1[n], b1 = pIn1[n + 1];
+            pOut0[0] = conj_i16(a0);
+            pOut0[1] = conj_i16(b0);
+            pOut1[0] = conj_i16(a1);
+            pOut1[1] = conj_i16(b1);
+        }
+        if (n < N) {
+            pOut[n * M + m] = conj_i16(pIn0[n]);
+            pOut[n * M + m + 1] = conj_i16(pIn1[n]);
+        }
+    }
+
+    // last row of the input matrix, if M is odd
+    if (m < M) {
+        for (n = 0; n < N; n++) {
+            pOut[n * M + m] = conj_i16(pIn[m * N + n]);
+        }
+    }
+}
+
+/**
+  @} end of MatTransCmplxKernels group
+ */
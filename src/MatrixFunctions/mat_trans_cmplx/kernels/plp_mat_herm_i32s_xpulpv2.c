@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herm_i32s_xpulpv2.c
+ * Description:  complex 32-bit integer conjugate transpose for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransCmplx
+ */
+
+// -x, saturated to INT32_MAX for INT32_MIN
+static inline int32_t neg_sat_i32(int32_t x) {
+    return (x == INT32_MIN) ? INT32_MAX : -x;
+}
+
+/**
+  @addtogroup MatTransCmplxKernels
+  @{
+ */
+
+/**
+  @brief Conjugate transpose of complex 32-bit integer matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc Points to the complex input matrix of shape MxN
+  @param[in]  M    Height of the input and width of the output matrix, in complex numbers
+  @param[in]  N    Width of the input and height of the output matrix, in complex numbers
+  @param[out] pDst Points to the complex output matrix of shape NxM
+  @return     none
+
+  @par Blocking
+  The matrix is transposed in tiles of 2x2 complex numbers.
+ */
+
+void plp_mat_herm_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t *__restrict__ pDst) {
+
+    uint32_t m, n; // loop counters
+
+    // the matrix is transposed in tiles of 2x2 complex numbers, such that every tile reads two
+    // neighboring complex numbers of two input rows, and writes two neighboring complex numbers
+    // of two output rows
+    for (m = 0; m + 1 < M; m += 2) {
+        const int32_t *pIn0 = pSrc + 2 * m * N;
+        const int32_t *pIn1 = pIn0 + 2 * N;
+        for (n = 0; n + 1 < N; n += 2) {
+            int32_t *pOut0 = pDst + 2 * (n * M + m);
+            int32_t *pOut1 = pOut0 + 2 * M;
+            int32_t a0 = pIn0[2 * n], a1 = pIn0[2 * n + 1];
+            int32_t a2 = pIn0[2 * n + 2], a3 = pIn0[2 * n + 3];
+            int32_t b0 = pIn1[2 * n], b1 = pIn1[2 * n + 1];
+            int32_t b2 = pIn1[2 * n + 2], b3 = pIn1[2 * n + 3];
+            pOut0[0] = a0;
+            pOut0[1] = neg_sat_i32(a1);
+            pOut0[2] = b0;
+            pOut0[3] = neg_sat_i32(b1);
+            pOut1[0] = a2;
+            pOut1[1] = neg_sat_i32(a3);
+            pOut1[2] = b2;
+            pOut1[3] = neg_sat_i32(b3);
+        }
+        if (n < N) {
+            int32_t *pOut = pDst + 2 * (n * M + m);
+            pOut[0] = pIn0[2 * n];
+            pOut[1] = neg_sat_i32(pIn0[2 * n + 1]);
+            pOut[2] = pIn1[2 * n];
+            pOut[3] = neg_sat_i32(pIn1[2 * n + 1]);
+        }
+    }
+
+    // last row of the input matrix, if M is odd
+    if (m < M) {
+        for (n = 0; n < N; n++) {
+            pDst[2 * (n * M + m)] = pSrc[2 * (m * N + n)];
+            pDst[2 * (n * M + m) + 1] = neg_sat_i32(pSrc[2 * (m * N + n) + 1]);
+        }
+    }
+}
+
+/**
+  @} end of MatTransCmplxKernels group
+ */
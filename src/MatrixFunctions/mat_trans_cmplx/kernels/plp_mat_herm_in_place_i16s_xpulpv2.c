@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herm_in_place_i16s_xpulpv2.c
+ * Description:  complex 16-bit integer in-place conjugate transpose for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransCmplx
+ */
+
+// conjugate of a complex number in one word, the imaginary part saturated
+static inline v2s conj_i16(v2s x) {
+    return __PACK2(x[0], __CLIP(-x[1], 15));
+}
+
+/**
+  @addtogroup MatTransCmplxKernels
+  @{
+ */
+
+/**
+  @brief In-place conjugate transpose of complex 16-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in,out] pSrcDst Points to the square complex matrix of shape NxN, which is
+                         conjugated and transposed in place
+  @param[in]     N       Width and height of the matrix, in complex numbers
+  @return        none
+ */
+
+void plp_mat_herm_in_place_i16s_xpulpv2(int16_t *__restrict__ pSrcDst,
+                                        uint32_t N) {
+
+    v2s *pMat = (v2s *)pSrcDst;
+    uint32_t i, j; // loop counters
+
+    for (i = 0; i < N; i++) {
+        pMat[i * N + i] = conj_i16(pMat[i * N + i]);
+        for (j = i + 1; j < N; j++) {
+            v2s tmp = pMat[i * N + j];
+            pMat[i * N + j] = conj_i16(pMat[j * N + i]);
+            pMat[j * N + i] = conj_i16(tmp);
+        }
+    }
+}
+
+/**
+  @} end of MatTransCmplxKernels group
+ */
@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herm_in_place_i32p_xpulpv2.c
+ * Description:  parallel complex 32-bit integer in-place conjugate transpose for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransCmplx
+ */
+
+// -x, saturated to INT32_MAX for INT32_MIN
+static inline int32_t neg_sat_i32(int32_t x) {
+    return (x == INT32_MIN) ? INT32_MAX : -x;
+}
+
+/**
+  @addtogroup MatTransCmplxKernels
+  @{
+ */
+
+/**
+  @brief Parallel in-place conjugate transpose of complex 32-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_trans_in_place_instance_i32 struct initialized by
+                    plp_mat_herm_in_place_i32_parallel
+  @return     none
+ */
+
+void plp_mat_herm_in_place_i32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_trans_in_place_instance_i32 *a = (plp_mat_trans_in_place_instance_i32 *)args;
+
+    int32_t *__restrict__ pSrcDst = a->pSrcDst;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+
+    uint32_t i, j, p; // loop counters
+
+    // Row i contains N - 1 - i elements right of the diagonal. Hence, every core processes the
+    // rows p and N - 1 - p together, which always adds up to the same amount of work.
+    for (p = core_id; 2 * p < N; p += nPE) {
+        uint32_t rows[2] = { p, N - 1 - p };
+        for (uint32_t r = 0; r < 2; r++) {
+            if (r == 1 && rows[1] == p) {
+                break;
+            }
+
+            i = rows[r];
+            pSrcDst[2 * (i * N + i) + 1] = neg_sat_i32(pSrcDst[2 * (i * N + i) + 1]);
+            for (j = i + 1; j < N; j++) {
+                int32_t *pA = &pSrcDst[2 * (i * N + j)];
+                int32_t *pB = &pSrcDst[2 * (j * N + i)];
+                int32_t re = pA[0];
+                int32_t im = pA[1];
+                pA[0] = pB[0];
+                pA[1] = neg_sat_i32(pB[1]);
+                pB[0] = re;
+                pB[1] = neg_sat_i32(im);
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatTransCmplxKernels group
+ */
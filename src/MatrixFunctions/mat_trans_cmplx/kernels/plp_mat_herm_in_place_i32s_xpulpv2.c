@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_herm_in_place_i32s_xpulpv2.c
+ * Description:  complex 32-bit integer in-place conjugate transpose for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransCmplx
+ */
+
+// -x, saturated to INT32_MAX for INT32_MIN
+static inline int32_t neg_sat_i32(int32_t x) {
+    return (x == INT32_MIN) ? INT32_MAX : -x;
+}
+
+/**
+  @addtogroup MatTransCmplxKernels
+  @{
+ */
+
+/**
+  @brief In-place conjugate transpose of complex 32-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in,out] pSrcDst Points to the square complex matrix of shape NxN, which is
+                         conjugated and transposed in place
+  @param[in]     N       Width and height of the matrix, in complex numbers
+  @return        none
+ */
+
+void plp_mat_herm_in_place_i32s_xpulpv2(int32_t *__restrict__ pSrcDst,
+                                        uint32_t N) {
+
+    uint32_t i, j; // loop counters
+
+    for (i = 0; i < N; i++) {
+        pSrcDst[2 * (i * N + i) + 1] = neg_sat_i32(pSrcDst[2 * (i * N + i) + 1]);
+        for (j = i + 1; j < N; j++) {
+            int32_t *pA = &pSrcDst[2 * (i * N + j)];
+            int32_t *pB = &pSrcDst[2 * (j * N + i)];
+            int32_t re = pA[0];
+            int32_t im = pA[1];
+            pA[0] = pB[0];
+            pA[1] = neg_sat_i32(pB[1]);
+            pB[0] = re;
+            pB[1] = neg_sat_i32(im);
+        }
+    }
+}
+
+/**
+  @} end of MatTransCmplxKernels group
+ */
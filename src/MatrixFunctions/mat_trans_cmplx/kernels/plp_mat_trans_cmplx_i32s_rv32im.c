@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_cmplx_i32s_rv32im.c
+ * Description:  complex 32-bit integer transpose for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransCmplx
+ */
+
+/**
+  @defgroup MatTransCmplxKernels Complex Matrix Transpose Kernels
+  This module contains the kernels for the transpose and the conjugate transpose of complex
+  matrices, see Complex Matrix Transpose.
+ */
+
+/**
+  @addtogroup MatTransCmplxKernels
+  @{
+ */
+
+/**
+  @brief Transpose of complex 32-bit integer matrices kernel for RV32IM extension.
+  @param[in]  pSrc Points to the complex input matrix of shape MxN
+  @param[in]  M    Height of the input and width of the output matrix, in complex numbers
+  @param[in]  N    Width of the input and height of the output matrix, in complex numbers
+  @param[out] pDst Points to the complex output matrix of shape NxM
+  @return     none
+ */
+
+void plp_mat_trans_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     int32_t *__restrict__ pDst) {
+
+    uint32_t m, n; // loop counters
+
+    for (m = 0; m < M; m++) {
+        for (n = 0; n < N; n++) {
+            pDst[2 * (n * M + m)] = pSrc[2 * (m * N + n)];
+            pDst[2 * (n * M + m) + 1] = pSrc[2 * (m * N + n) + 1];
+        }
+    }
+}
+
+/**
+  @} end of MatTransCmplxKernels group
+ */
@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_cmplx_in_place_i32s_rv32im.c
+ * Description:  complex 32-bit integer in-place transpose for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransCmplx
+ */
+
+/**
+  @addtogroup MatTransCmplxKernels
+  @{
+ */
+
+/**
+  @brief In-place transpose of complex 32-bit integer matrices kernel for RV32IM extension.
+  @param[in,out] pSrcDst Points to the square complex matrix of shape NxN, which is
+                         transposed in place
+  @param[in]     N       Width and height of the matrix, in complex numbers
+  @return        none
+ */
+
+void plp_mat_trans_cmplx_in_place_i32s_rv32im(int32_t *__restrict__ pSrcDst,
+                                              uint32_t N) {
+
+    uint32_t i, j; // loop counters
+
+    for (i = 0; i < N; i++) {
+        for (j = i + 1; j < N; j++) {
+            int32_t *pA = &pSrcDst[2 * (i * N + j)];
+            int32_t *pB = &pSrcDst[2 * (j * N + i)];
+            int32_t re = pA[0];
+            int32_t im = pA[1];
+            pA[0] = pB[0];
+            pA[1] = pB[1];
+            pB[0] = re;
+            pB[1] = im;
+        }
+    }
+}
+
+/**
+  @} end of MatTransCmplxKernels group
+ */
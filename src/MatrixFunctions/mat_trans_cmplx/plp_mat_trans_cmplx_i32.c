@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_cmplx_i32.c
+ * Description:  complex 32-bit integer transpose glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatTransCmplx Complex Matrix Transpose
+  This module contains the glue code for the transpose and the conjugate (Hermitian) transpose of
+  complex matrices. The kernel codes (kernels) are in the Module Complex Matrix Transpose
+  Kernels.
+
+  The complex numbers are stored interleaved (real, imag, real, imag, ...), like for
+  plp_mat_mult_cmplx_i16. A matrix of shape MxN hence holds 2*M*N values. The transpose flips the
+  matrix, and the conjugate transpose additionally negates the imaginary parts:
+
+  <pre>
+    pDst[n, m] = pSrc[m, n]          (plp_mat_trans_cmplx)
+    pDst[n, m] = conj(pSrc[m, n])    (plp_mat_herm)
+  </pre>
+
+  The conjugation of integers saturates, like plp_cmplx_conj_i16, such that the most negative
+  imaginary part becomes the most positive one. Square matrices can be transposed in place.
+  There are functions for 32- and 16-bit integers, as well as for floating-point. A complex
+  16-bit integer is a single 32-bit word, which is read and written with one access.
+  @{
+ */
+
+/**
+  @brief Glue code for transpose of complex 32-bit integer matrices.
+  @param[in]  pSrc Points to the complex input matrix of shape MxN
+  @param[in]  M    Height of the input and width of the output matrix, in complex numbers
+  @param[in]  N    Width of the input and height of the output matrix, in complex numbers
+  @param[out] pDst Points to the complex output matrix of shape NxM
+  @return     none
+ */
+
+void plp_mat_trans_cmplx_i32(const int32_t *__restrict__ pSrc,
+                             uint32_t M,
+                             uint32_t N,
+                             int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_trans_cmplx_i32s_rv32im(pSrc, M, N, pDst);
+    } else {
+        plp_mat_trans_cmplx_i32s_xpulpv2(pSrc, M, N, pDst);
+    }
+}
+
+/**
+  @} end of MatTransCmplx group
+ */
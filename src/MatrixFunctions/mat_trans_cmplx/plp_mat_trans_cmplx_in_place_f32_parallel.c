@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_cmplx_in_place_f32_parallel.c
+ * Description:  parallel complex 32-bit floating-point in-place transpose glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatTransCmplx
+  @{
+ */
+
+/**
+  @brief Glue code for parallel in-place transpose of complex 32-bit floating-point matrices.
+  @param[in,out] pSrcDst Points to the square complex matrix of shape NxN, which is
+                         transposed in place
+  @param[in]     N       Width and height of the matrix, in complex numbers
+  @param[in]     nPE     Number of cores to use for computation
+  @return        none
+
+  @par
+  This function uses plp_mat_trans_cmplx_in_place_i32p_xpulpv2 for its computation.
+ */
+
+void plp_mat_trans_cmplx_in_place_f32_parallel(float *__restrict__ pSrcDst,
+                                               uint32_t N,
+                                               uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_trans_in_place_instance_i32 args = {
+            .pSrcDst = (int32_t *)pSrcDst, .N = N, .nPE = nPE
+        };
+
+        rt_team_fork(nPE, plp_mat_trans_cmplx_in_place_i32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatTransCmplx group
+ */
@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trmm_f32p_xpulpv2.c
+ * Description:  Parallel 32-bit floating-point triangular matrix multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// row i of C = L * B or C = L^T * B, accumulated row by row of B
+static inline void plp_mat_trmm_row_f32(const float *__restrict__ pSrcL,
+                                        const float *__restrict__ pSrcB,
+                                        uint32_t N,
+                                        uint32_t O,
+                                        uint32_t trans,
+                                        uint32_t strideB,
+                                        uint32_t i,
+                                        float *__restrict__ pRowC) {
+    uint32_t k, o;
+    uint32_t kStart = trans ? i : 0;
+    uint32_t kEnd = trans ? N : i + 1;
+
+    for (o = 0; o < O; o++) {
+        pRowC[o] = 0.0f;
+    }
+
+    // L[k, i] for the transposed version is found in row k of the packed matrix
+    for (k = kStart; k < kEnd; k++) {
+        float l = trans ? pSrcL[PLP_MAT_PACKED_IDX(k, i)] : pSrcL[PLP_MAT_PACKED_IDX(i, k)];
+        const float *pRowB = pSrcB + k * strideB;
+        for (o = 0; o < O; o++) {
+            pRowC[o] += l * pRowB[o];
+        }
+    }
+}
+
+/**
+  @ingroup MatTrmm
+ */
+
+/**
+  @addtogroup MatTrmmKernels
+  @{
+ */
+
+/**
+   @brief Parallel multiplication of a packed triangular 32-bit floating-point matrix kernel for
+          XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_trmm_instance_f32 struct initialized by
+                     plp_mat_trmm_f32_parallel
+   @return     none
+
+   @par Parallelization
+   Row i of the output needs i + 1 (or N - i) rows of B. The rows are therefore assigned
+   round-robin to the cores, such that every core gets a similar share of short and long rows.
+*/
+
+void plp_mat_trmm_f32p_xpulpv2(void *args) {
+
+    uint32_t core_id = rt_core_id();
+
+    plp_mat_trmm_instance_f32 *a = (plp_mat_trmm_instance_f32 *)args;
+
+    const float *__restrict__ pSrcL = a->pSrcL;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t trans = a->trans;
+    uint32_t strideB = a->strideB;
+    uint32_t strideC = a->strideC;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstC = a->pDstC;
+
+    uint32_t i;
+
+    for (i = core_id; i < N; i += nPE) {
+        plp_mat_trmm_row_f32(pSrcL, pSrcB, N, O, trans, strideB, i, pDstC + i * strideC);
+    }
+}
+
+/**
+   @} end of MatTrmmKernels group
+*/
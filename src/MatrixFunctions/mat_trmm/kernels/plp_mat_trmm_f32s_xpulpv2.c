@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trmm_f32s_xpulpv2.c
+ * Description:  32-bit floating-point triangular matrix multiplication for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// row i of C = L * B or C = L^T * B, accumulated row by row of B
+static inline void plp_mat_trmm_row_f32(const float *__restrict__ pSrcL,
+                                        const float *__restrict__ pSrcB,
+                                        uint32_t N,
+                                        uint32_t O,
+                                        uint32_t trans,
+                                        uint32_t strideB,
+                                        uint32_t i,
+                                        float *__restrict__ pRowC) {
+    uint32_t k, o;
+    uint32_t kStart = trans ? i : 0;
+    uint32_t kEnd = trans ? N : i + 1;
+
+    for (o = 0; o < O; o++) {
+        pRowC[o] = 0.0f;
+    }
+
+    // L[k, i] for the transposed version is found in row k of the packed matrix
+    for (k = kStart; k < kEnd; k++) {
+        float l = trans ? pSrcL[PLP_MAT_PACKED_IDX(k, i)] : pSrcL[PLP_MAT_PACKED_IDX(i, k)];
+        const float *pRowB = pSrcB + k * strideB;
+        for (o = 0; o < O; o++) {
+            pRowC[o] += l * pRowB[o];
+        }
+    }
+}
+
+/**
+  @ingroup MatTrmm
+ */
+
+/**
+  @defgroup MatTrmmKernels Triangular matrix multiplication kernels
+  This module contains the kernel functions for the multiplication of a packed lower triangular
+  matrix, or its transpose, with a dense matrix.
+ */
+
+/**
+  @addtogroup MatTrmmKernels
+  @{
+ */
+
+/**
+  @brief Multiplication of a packed triangular 32-bit floating-point matrix kernel for XPULPV2
+         extension.
+  @param[in]  pSrcL    points to the packed lower triangular matrix of PLP_MAT_PACKED_LEN(N)
+                       values
+  @param[in]  pSrcB    points to the dense matrix of shape NxO
+  @param[in]  N        width and height of L, height of B
+  @param[in]  O        width of B and C
+  @param[in]  trans    if set, compute L^T * B instead of L * B
+  @param[in]  strideB  stride of matrix B (elements between each row)
+  @param[in]  strideC  stride of output matrix (elements between each row)
+  @param[out] pDstC    points to the output matrix of shape NxO, must not overlap with B
+  @return     none
+ */
+
+void plp_mat_trmm_f32s_xpulpv2(const float *__restrict__ pSrcL,
+                               const float *__restrict__ pSrcB,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t trans,
+                               uint32_t strideB,
+                               uint32_t strideC,
+                               float *__restrict__ pDstC) {
+
+    uint32_t i;
+
+    for (i = 0; i < N; i++) {
+        plp_mat_trmm_row_f32(pSrcL, pSrcB, N, O, trans, strideB, i, pDstC + i * strideC);
+    }
+}
+
+/**
+  @} end of MatTrmmKernels group
+ */
@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trmm_f32_parallel.c
+ * Description:  Glue code for the parallel 32-bit floating-point triangular matrix multiplication
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatTrmm
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel multiplication of a packed triangular 32-bit floating-point
+         matrix.
+  @param[in]  pSrcL    points to the packed lower triangular matrix of PLP_MAT_PACKED_LEN(N)
+                       values
+  @param[in]  pSrcB    points to the dense matrix of shape NxO
+  @param[in]  N        width and height of L, height of B
+  @param[in]  O        width of B and C
+  @param[in]  trans    if set, compute L^T * B instead of L * B
+  @param[in]  strideB  stride of matrix B (elements between each row)
+  @param[in]  strideC  stride of output matrix (elements between each row)
+  @param[in]  nPE      Number of cores to use
+  @param[out] pDstC    points to the output matrix of shape NxO, must not overlap with B
+  @return     none
+ */
+
+void plp_mat_trmm_f32_parallel(const float *__restrict__ pSrcL,
+                               const float *__restrict__ pSrcB,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t trans,
+                               uint32_t strideB,
+                               uint32_t strideC,
+                               uint32_t nPE,
+                               float *__restrict__ pDstC) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_trmm_instance_f32 args = { .pSrcL = pSrcL,
+                                           .pSrcB = pSrcB,
+                                           .N = N,
+                                           .O = O,
+                                           .trans = trans,
+                                           .strideB = strideB,
+                                           .strideC = strideC,
+                                           .nPE = nPE,
+                                           .pDstC = pDstC };
+        rt_team_fork(nPE, plp_mat_trmm_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatTrmm group
+ */
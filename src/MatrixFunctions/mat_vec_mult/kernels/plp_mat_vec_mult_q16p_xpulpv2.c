@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_q16p_xpulpv2.c
+ * Description:  parallel 16-bit fix-point matrix vector multiplication for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+   @brief Parallel matrix vector multiplication of a 16-bit fix-point matrix kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_mat_vec_mult_instance_q16 struct initialized by
+                     plp_mat_vec_mult_q16_parallel
+   @return     none
+
+   @par Parallelization
+   Every core computes a contiguous range of rows with plp_mat_vec_mult_q16s_xpulpv2. If there are
+   enough rows, the size of each range is a multiple of 4, such that only the last core is left with
+   leftover rows.
+*/
+
+void plp_mat_vec_mult_q16p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_vec_mult_instance_q16 *a = (plp_mat_vec_mult_instance_q16 *)args;
+
+    const int16_t *__restrict__ pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcX = a->pSrcX;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t shift = a->shift;
+    uint32_t nPE = a->nPE;
+    int16_t *__restrict__ pDstY = a->pDstY;
+
+    // split the rows into chunks, which are a multiple of 4 if every core gets more than 4 rows
+    uint32_t chunk = (M + nPE - 1) / nPE;
+    if (chunk > 4) {
+        chunk = (chunk + 3) & ~3;
+    }
+
+    uint32_t rowStart = core_id * chunk;
+    uint32_t rowEnd = rowStart + chunk;
+    if (rowStart > M) {
+        rowStart = M;
+    }
+    if (rowEnd > M) {
+        rowEnd = M;
+    }
+
+    if (rowStart < rowEnd) {
+        plp_mat_vec_mult_q16s_xpulpv2(pSrcA + rowStart * N,
+                                      pSrcX,
+                                      rowEnd - rowStart,
+                                      N,
+                                      shift,
+                                      pDstY + rowStart);
+    }
+}
+
+/**
+   @} end of MatVecMultKernels group
+*/
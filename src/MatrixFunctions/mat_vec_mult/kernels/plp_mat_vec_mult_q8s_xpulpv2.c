@@ -0,0 +1,113 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_q8s_xpulpv2.c
+ * Description:  8-bit fix-point matrix vector multiplication for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecMult
+ */
+
+/**
+  @addtogroup MatVecMultKernels
+  @{
+ */
+
+/**
+   @brief Matrix vector multiplication of an 8-bit fix-point matrix kernel for XPULPV2 extension.
+   @param[in]  pSrcA    points to the input matrix of shape MxN
+   @param[in]  pSrcX    points to the input vector of length N
+   @param[in]  M        height of the matrix and length of the output vector
+   @param[in]  N        width of the matrix and length of the input vector
+   @param[in]  shift    Amount to shift the accumulated result to the right
+   @param[out] pDstY    points to the output vector of length M
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors. Four rows are computed at once, such
+   that every loaded vector of x is used for four pv.sdotsp.b.
+*/
+
+void plp_mat_vec_mult_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                  const int8_t *__restrict__ pSrcX,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t shift,
+                                  int8_t *__restrict__ pDstY) {
+
+    uint32_t m, n; // loop counters
+
+    // compute four rows per pass, such that every loaded element of x is used four times
+    for (m = 0; m + 3 < M; m += 4) {
+        const int8_t *pA0 = pSrcA + m * N;
+        const int8_t *pA1 = pA0 + N;
+        const int8_t *pA2 = pA1 + N;
+        const int8_t *pA3 = pA2 + N;
+
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        int32_t sum2 = 0;
+        int32_t sum3 = 0;
+
+        for (n = 0; n + 3 < N; n += 4) {
+            v4s xVec = *((v4s *)&pSrcX[n]);
+            sum0 = __SUMDOTP4(*((v4s *)&pA0[n]), xVec, sum0);
+            sum1 = __SUMDOTP4(*((v4s *)&pA1[n]), xVec, sum1);
+            sum2 = __SUMDOTP4(*((v4s *)&pA2[n]), xVec, sum2);
+            sum3 = __SUMDOTP4(*((v4s *)&pA3[n]), xVec, sum3);
+        }
+        for (; n < N; n++) {
+            int32_t xVal = pSrcX[n];
+            sum0 += pA0[n] * xVal;
+            sum1 += pA1[n] * xVal;
+            sum2 += pA2[n] * xVal;
+            sum3 += pA3[n] * xVal;
+        }
+
+        pDstY[m] = (int8_t)__CLIP(__ROUNDNORM_REG(sum0, shift), 7);
+        pDstY[m + 1] = (int8_t)__CLIP(__ROUNDNORM_REG(sum1, shift), 7);
+        pDstY[m + 2] = (int8_t)__CLIP(__ROUNDNORM_REG(sum2, shift), 7);
+        pDstY[m + 3] = (int8_t)__CLIP(__ROUNDNORM_REG(sum3, shift), 7);
+    }
+
+    // leftover rows, if M is not a multiple of 4
+    for (; m < M; m++) {
+        const int8_t *pA = pSrcA + m * N;
+        int32_t sum = 0;
+        for (n = 0; n + 3 < N; n += 4) {
+            sum = __SUMDOTP4(*((v4s *)&pA[n]), *((v4s *)&pSrcX[n]), sum);
+        }
+        for (; n < N; n++) {
+            sum += pA[n] * pSrcX[n];
+        }
+        pDstY[m] = (int8_t)__CLIP(__ROUNDNORM_REG(sum, shift), 7);
+    }
+}
+
+/**
+   @} end of MatVecMultKernels group
+*/
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_i32.c
+ * Description:  32-bit integer matrix vector multiplication glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatVecMult Matrix Vector Multiplication
+  This module contains the glue code for Matrix Vector Multiplication. The kernel codes (kernels)
+  are in the Module Matrix Vector Multiplication Kernels.
+
+  The Matrix Vector Multiplication computes the product of a matrix with dimensions MxN and a
+  vector of length N. It is a dedicated version of the Matrix Matrix Multiplication with O = 1,
+  which does not iterate over the columns of the output, and which computes multiple rows at once
+  to reuse every loaded element of the vector.
+
+      `pDstY[m] = pSrcA[m,0]*pSrcX[0] + pSrcA[m,1]*pSrcX[1] + ... + pSrcA[m,N-1]*pSrcX[N-1]`
+
+  There are functions for integer and fix-point 32- 16- and 8-bit data types, and for 32-bit
+  floating-point. For lower precision (16- and 8-bit), the kernels exploit SIMD instructions.
+ */
+
+/**
+  @addtogroup MatVecMult
+  @{
+ */
+
+/**
+  @brief Glue code for matrix vector multiplication of a 32-bit integer matrix.
+  @param[in]  pSrcA    points to the input matrix of shape MxN
+  @param[in]  pSrcX    points to the input vector of length N
+  @param[in]  M        height of the matrix and length of the output vector
+  @param[in]  N        width of the matrix and length of the input vector
+  @param[out] pDstY    points to the output vector of length M
+  @return     none
+ */
+
+void plp_mat_vec_mult_i32(const int32_t *__restrict__ pSrcA,
+                          const int32_t *__restrict__ pSrcX,
+                          uint32_t M,
+                          uint32_t N,
+                          int32_t *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_vec_mult_i32s_rv32im(pSrcA, pSrcX, M, N, pDstY);
+    } else {
+        plp_mat_vec_mult_i32s_xpulpv2(pSrcA, pSrcX, M, N, pDstY);
+    }
+}
+
+/**
+  @} end of MatVecMult group
+ */
@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_i32_parallel.c
+ * Description:  parallel 32-bit integer matrix vector multiplication glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatVecMult
+  @{
+ */
+
+/**
+  @brief Glue code for parallel matrix vector multiplication of a 32-bit integer matrix.
+  @param[in]  pSrcA    points to the input matrix of shape MxN
+  @param[in]  pSrcX    points to the input vector of length N
+  @param[in]  M        height of the matrix and length of the output vector
+  @param[in]  N        width of the matrix and length of the input vector
+  @param[in]  nPE      Number of cores to use
+  @param[out] pDstY    points to the output vector of length M
+  @return     none
+ */
+
+void plp_mat_vec_mult_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                   const int32_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t nPE,
+                                   int32_t *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_vec_mult_instance_i32 args = { .pSrcA = pSrcA,
+                                               .pSrcX = pSrcX,
+                                               .M = M,
+                                               .N = N,
+                                               .nPE = nPE,
+                                               .pDstY = pDstY };
+        rt_team_fork(nPE, plp_mat_vec_mult_i32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatVecMult group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_mult_q16.c
+ * Description:  16-bit fix-point matrix vector multiplication glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatVecMult
+  @{
+ */
+
+/**
+  @brief Glue code for matrix vector multiplication of a 16-bit fix-point matrix.
+  @param[in]  pSrcA    points to the input matrix of shape MxN
+  @param[in]  pSrcX    points to the input vector of length N
+  @param[in]  M        height of the matrix and length of the output vector
+  @param[in]  N        width of the matrix and length of the input vector
+  @param[in]  shift    Amount to shift the accumulated result to the right
+  @param[out] pDstY    points to the output vector of length M
+  @return     none
+
+  @par Fix-Point
+  The products are accumulated with 32-bit precision. The accumulated result is then shifted to the
+  right by shift (with rounding), and saturated to 16 bits. Set shift (and the range of the inputs)
+  such that the 32-bit accumulator does not overflow.
+ */
+
+void plp_mat_vec_mult_q16(const int16_t *__restrict__ pSrcA,
+                          const int16_t *__restrict__ pSrcX,
+                          uint32_t M,
+                          uint32_t N,
+                          uint32_t shift,
+                          int16_t *__restrict__ pDstY) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_vec_mult_q16s_rv32im(pSrcA, pSrcX, M, N, shift, pDstY);
+    } else {
+        plp_mat_vec_mult_q16s_xpulpv2(pSrcA, pSrcX, M, N, shift, pDstY);
+    }
+}
+
+/**
+  @} end of MatVecMult group
+ */
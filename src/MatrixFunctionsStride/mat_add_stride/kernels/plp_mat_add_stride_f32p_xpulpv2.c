@@ -53,15 +53,15 @@ void plp_mat_add_stride_f32p_xpulpv2(void *args) {
 
     plp_mat_add_stride_instance_f32 *a = (plp_mat_add_stride_instance_f32 *)args;
 
-    const float *__restrict__ pSrcA = a->pSrcA;
-    const float *__restrict__ pSrcB = a->pSrcB;
+    const float *pSrcA = a->pSrcA;
+    const float *pSrcB = a->pSrcB;
     uint32_t M = a->M;
     uint32_t N = a->N;
     uint32_t strideA = a->strideA;
     uint32_t strideB = a->strideB;
     uint32_t strideY = a->strideY;
     uint32_t nPE = a->nPE;
-    float *__restrict__ pDst = a->pDst;
+    float *pDst = a->pDst;
 
     uint32_t m, n; // loop counters
 
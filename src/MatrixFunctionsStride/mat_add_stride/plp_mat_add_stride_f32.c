@@ -49,18 +49,18 @@
   @param[in]  strideB Stride of matrid B (elements between each row)
   @param[in]  strideY Stride of output matrix (elements between each row)
   <PARALLEL_ARG_DOC>
-  @param[out] pDst    Points to the output matrix
+  @param[out] pDst    Points to the output matrix, may equal pSrcA or pSrcB with the same stride
   @return     none
  */
 
-void plp_mat_add_stride_f32(const float *__restrict__ pSrcA,
-                            const float *__restrict__ pSrcB,
+void plp_mat_add_stride_f32(const float *pSrcA,
+                            const float *pSrcB,
                             uint32_t M,
                             uint32_t N,
                             uint32_t strideA,
                             uint32_t strideB,
                             uint32_t strideY,
-                            float *__restrict__ pDst) {
+                            float *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
@@ -49,19 +49,19 @@
   @param[in]  strideB Stride of matrid B (elements between each row)
   @param[in]  strideY Stride of output matrix (elements between each row)
   @param[in]  nPE     Number of cores to use for computation
-  @param[out] pDst    Points to the output matrix
+  @param[out] pDst    Points to the output matrix, may equal pSrcA or pSrcB with the same stride
   @return     none
  */
 
-void plp_mat_add_stride_i16_parallel(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
+void plp_mat_add_stride_i16_parallel(const int16_t *pSrcA,
+                                     const int16_t *pSrcB,
                                      uint32_t M,
                                      uint32_t N,
                                      uint32_t strideA,
                                      uint32_t strideB,
                                      uint32_t strideY,
                                      uint32_t nPE,
-                                     int16_t *__restrict__ pDst) {
+                                     int16_t *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
@@ -0,0 +1,116 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_copy_stride_dma_i16.c
+ * Description:  16-bit integer strided matrix copy with the cluster DMA
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @addtogroup MatCopyStride
+  @{
+ */
+
+/**
+  @brief      Copy an MxN strided 16-bit integers matrix between L2 and L1 with the cluster DMA
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of both matrices
+  @param[in]  N         Width of both matrices
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[in]  dir       RT_DMA_DIR_EXT2LOC if pSrc is in L2 and pDst in L1, or RT_DMA_DIR_LOC2EXT
+                        if pSrc is in L1 and pDst in L2
+  @param[out] pDst      Points to the output matrix of shape MxN
+  @return     none
+
+  @par DMA Transfers
+  The cluster DMA only supports strides on the external (L2) side. If the matrix in L1 is dense
+  (its stride is equal to N), the whole matrix is copied with a single 2-D transfer. Else, every
+  row is copied with its own transfer. The cores are idle during the copy, and the function returns
+  once all transfers have finished. Every row must be smaller than 64kB.
+ */
+
+void plp_mat_copy_stride_dma_i16(const int16_t *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t strideSrc,
+                                 uint32_t strideDst,
+                                 int dir,
+                                 int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA transfers supported only for cluster side\n");
+        return;
+    }
+
+    if (M == 0 || N == 0) {
+        return;
+    }
+
+    unsigned int ext;   // address of the matrix in L2
+    unsigned int loc;   // address of the matrix in L1
+    uint32_t strideExt; // stride of the matrix in L2
+    uint32_t strideLoc; // stride of the matrix in L1
+
+    if (dir == RT_DMA_DIR_EXT2LOC) {
+        ext = (unsigned int)pSrc;
+        loc = (unsigned int)pDst;
+        strideExt = strideSrc;
+        strideLoc = strideDst;
+    } else {
+        ext = (unsigned int)pDst;
+        loc = (unsigned int)pSrc;
+        strideExt = strideDst;
+        strideLoc = strideSrc;
+    }
+
+    rt_dma_copy_t copy;
+
+    if (strideLoc == N) {
+        // dense in L1: a single 2-D transfer
+        rt_dma_memcpy_2d(ext, loc, sizeof(int16_t) * M * N, sizeof(int16_t) * strideExt,
+                         sizeof(int16_t) * N, dir, 0, &copy);
+    } else {
+        // strided in L1: one transfer per row
+        for (uint32_t m = 0; m < M; m++) {
+            rt_dma_memcpy(ext + sizeof(int16_t) * m * strideExt,
+                          loc + sizeof(int16_t) * m * strideLoc,
+                          sizeof(int16_t) * N,
+                          dir,
+                          m > 0,
+                          &copy);
+        }
+    }
+
+    rt_dma_wait(&copy);
+}
+
+/**
+  @} end of MatCopyStride group
+ */
@@ -45,9 +45,9 @@
                     plp_mat_fill_stride_i16_parallel
   @return     none
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  @par Word Stores
+  The value is replicated two times into a 32 bit word. Every row is filled with single
+  elements up to the first word boundary, and then with aligned 32 bit stores.
 */
 
 void plp_mat_fill_stride_i16p_xpulpv2(void *args) {
@@ -63,21 +63,33 @@ void plp_mat_fill_stride_i16p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int16_t *__restrict__ pDst = a->pDst;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
+    plp_mat_partition_t part;
+    plp_mat_partition(M, N, nPE, core_id, &part);
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int n = 0; n < N; n++) {
-            pDst[m * stride + n] = value;
-        }
-    }
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
+
+    uint32_t word = (uint16_t)value * 0x00010001U; // value replicated in both halfwords
+
+    for (m = part.rowStart; m < part.rowEnd; m++) {
+        int16_t *pRow = pDst + m * stride;
+        n = part.colStart;
 
-#else
+        // store single elements until the next word boundary
+        while (n < part.colEnd && ((unsigned int)(pRow + n) & 0x3)) {
+            pRow[n++] = value;
+        }
 
-    // TODO: Hackathon
+        // store whole words
+        for (; n + 1 < part.colEnd; n += 2) {
+            *((uint32_t *)(pRow + n)) = word;
+        }
 
-#endif
-#undef BASIC_VERSION
+        // store the remaining elements
+        for (; n < part.colEnd; n++) {
+            pRow[n] = value;
+        }
+    }
 }
 
 /**
@@ -46,26 +46,39 @@
   @param[in]  stride Stride of the matrix (elements between each row)
   @param[out] pSrc   Points to the output matrix
   @return     none
+
+  @par Word Stores
+  The value is replicated two times into a 32 bit word. Every row is filled with single
+  elements up to the first word boundary, and then with aligned 32 bit stores.
  */
 
 void plp_mat_fill_stride_i16s_xpulpv2(
     uint32_t M, uint32_t N, uint32_t stride, int16_t value, int16_t *__restrict__ pDst) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
+    uint32_t m; // loop counter
+    uint32_t n; // loop counter
 
-    for (int m = 0; m < M; m++) {
-        for (int n = 0; n < N; n++) {
-            pDst[m * stride + n] = value;
-        }
-    }
+    uint32_t word = (uint16_t)value * 0x00010001U; // value replicated in both halfwords
+
+    for (m = 0; m < M; m++) {
+        int16_t *pRow = pDst + m * stride;
+        n = 0;
 
-#else
+        // store single elements until the next word boundary
+        while (n < N && ((unsigned int)(pRow + n) & 0x3)) {
+            pRow[n++] = value;
+        }
 
-    // TODO: Hackathon
+        // store whole words
+        for (; n + 1 < N; n += 2) {
+            *((uint32_t *)(pRow + n)) = word;
+        }
 
-#endif
-#undef BASIC_VERSION
+        // store the remaining elements
+        for (; n < N; n++) {
+            pRow[n] = value;
+        }
+    }
 }
 /**
    @} end of MatFillStrideKernels group
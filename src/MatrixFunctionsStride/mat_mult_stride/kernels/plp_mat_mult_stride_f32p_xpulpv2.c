@@ -45,6 +45,10 @@
    @param[in]  args      pointer to plp_mat_mult_stride_instance_f32 struct initialized by
    plp_mat_mult_stride_f32_parallel
    @return        none
+
+   @par Parallelization
+   The blocks of 4x2 elements of C are distributed with plp_mat_partition. Every core computes its
+   rectangle of C with plp_mat_mult_stride_f32s_xpulpv2, by passing it as strided sub-matrix.
 */
 
 void plp_mat_mult_stride_f32p_xpulpv2(void *args) {
@@ -64,13 +68,16 @@ void plp_mat_mult_stride_f32p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     float *__restrict__ pDstC = a->pDstC;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     uint32_t m, n, o;
 
-    for (m = core_id; m < M; m += nPE) {
-        for (o = 0; o < O; o++) {
+    plp_mat_partition_t part;
+    plp_mat_partition(M, O, nPE, core_id, &part);
+
+    for (m = part.rowStart; m < part.rowEnd; m++) {
+        for (o = part.colStart; o < part.colEnd; o++) {
             float sum = 0;
             for (n = 0; n < N; n++) {
                 sum = sum + pSrcA[m * strideA + n] * pSrcB[n * strideB + o];
@@ -81,7 +88,27 @@ void plp_mat_mult_stride_f32p_xpulpv2(void *args) {
 
 #else
 
-    // TODO: Hackathon
+    // distribute the blocks of 4x2 elements of C on a 2-D grid of cores. The rectangle of every
+    // core is a strided sub-matrix of C, which is computed with the serial kernel.
+    plp_mat_partition_t part;
+    plp_mat_partition((M + 3) / 4, (O + 1) / 2, nPE, core_id, &part);
+
+    uint32_t rowStart = part.rowStart * 4;
+    uint32_t rowEnd = (part.rowEnd * 4 > M) ? M : part.rowEnd * 4;
+    uint32_t colStart = part.colStart * 2;
+    uint32_t colEnd = (part.colEnd * 2 > O) ? O : part.colEnd * 2;
+
+    if (rowStart < rowEnd && colStart < colEnd) {
+        plp_mat_mult_stride_f32s_xpulpv2(pSrcA + rowStart * strideA,
+                                         pSrcB + colStart,
+                                         rowEnd - rowStart,
+                                         N,
+                                         colEnd - colStart,
+                                         strideA,
+                                         strideB,
+                                         strideC,
+                                         pDstC + rowStart * strideC + colStart);
+    }
 
 #endif
 #undef BASIC_VERSION
@@ -39,6 +39,26 @@
   @{
  */
 
+/**
+   @brief Dot product of a row of A and a column of B, used for the leftover rows and columns.
+   @param[in]  pA       points to the first element of the row of A
+   @param[in]  pB       points to the first element of the column of B
+   @param[in]  N        number of elements
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @return     dot product
+*/
+static inline float plp_mat_mult_stride_dot_f32(const float *__restrict__ pA,
+                                                const float *__restrict__ pB,
+                                                uint32_t N,
+                                                uint32_t strideB) {
+    float sum = 0;
+    uint32_t n;
+    for (n = 0; n < N; n++) {
+        sum = sum + pA[n] * pB[n * strideB];
+    }
+    return sum;
+}
+
 /**
   @brief Matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2 extension.
   @param[in]  pSrcA     points to the first input matrix
@@ -51,6 +71,10 @@
   @param[in]  strideC   Stride of output matrix (elements between each row)
   @param[out] pDstC     points to the output matrix
   @return     none
+
+  @par Blocking
+  The output is computed in blocks of 4x2 elements, with all accumulators kept in registers, such
+  that every loaded element is used for multiple multiply-accumulate operations.
  */
 
 void plp_mat_mult_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
@@ -63,7 +87,7 @@ void plp_mat_mult_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
                                       uint32_t strideC,
                                       float *__restrict__ pDstC) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     uint32_t m, n, o;
@@ -80,7 +104,77 @@ void plp_mat_mult_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
 
 #else
 
-    // TODO: Hackathon
+    uint32_t m, n, o; // loop counters
+
+    // compute blocks of 4x2 elements of C, such that every value loaded from A is used twice, and
+    // every value of B four times
+    for (m = 0; m + 3 < M; m += 4) {
+        const float *pA0 = pSrcA + m * strideA;
+        const float *pA1 = pA0 + strideA;
+        const float *pA2 = pA1 + strideA;
+        const float *pA3 = pA2 + strideA;
+        float *pC0 = pDstC + m * strideC;
+        float *pC1 = pC0 + strideC;
+        float *pC2 = pC1 + strideC;
+        float *pC3 = pC2 + strideC;
+
+        for (o = 0; o + 1 < O; o += 2) {
+            const float *pB = pSrcB + o;
+
+            float sum00 = 0;
+            float sum01 = 0;
+            float sum10 = 0;
+            float sum11 = 0;
+            float sum20 = 0;
+            float sum21 = 0;
+            float sum30 = 0;
+            float sum31 = 0;
+
+            for (n = 0; n < N; n++) {
+                float aVal0 = pA0[n];
+                float aVal1 = pA1[n];
+                float aVal2 = pA2[n];
+                float aVal3 = pA3[n];
+
+                float bVal0 = pB[n * strideB];
+                float bVal1 = pB[n * strideB + 1];
+
+                sum00 = sum00 + aVal0 * bVal0;
+                sum01 = sum01 + aVal0 * bVal1;
+                sum10 = sum10 + aVal1 * bVal0;
+                sum11 = sum11 + aVal1 * bVal1;
+                sum20 = sum20 + aVal2 * bVal0;
+                sum21 = sum21 + aVal2 * bVal1;
+                sum30 = sum30 + aVal3 * bVal0;
+                sum31 = sum31 + aVal3 * bVal1;
+            }
+
+            pC0[o] = sum00;
+            pC0[o + 1] = sum01;
+            pC1[o] = sum10;
+            pC1[o + 1] = sum11;
+            pC2[o] = sum20;
+            pC2[o + 1] = sum21;
+            pC3[o] = sum30;
+            pC3[o + 1] = sum31;
+        }
+
+        // leftover column of odd O
+        if (o < O) {
+            pC0[o] = plp_mat_mult_stride_dot_f32(pA0, pSrcB + o, N, strideB);
+            pC1[o] = plp_mat_mult_stride_dot_f32(pA1, pSrcB + o, N, strideB);
+            pC2[o] = plp_mat_mult_stride_dot_f32(pA2, pSrcB + o, N, strideB);
+            pC3[o] = plp_mat_mult_stride_dot_f32(pA3, pSrcB + o, N, strideB);
+        }
+    }
+
+    // leftover rows, if M is not a multiple of 4
+    for (; m < M; m++) {
+        for (o = 0; o < O; o++) {
+            pDstC[m * strideC + o] =
+                plp_mat_mult_stride_dot_f32(pSrcA + m * strideA, pSrcB + o, N, strideB);
+        }
+    }
 
 #endif
 #undef BASIC_VERSION
@@ -49,6 +49,10 @@
    @par Exploiting SIMD instructions
    The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
    performed on 32 bit vectors, with 32 bit accumulator.
+
+   @par Parallelization
+   The blocks of 4x2 elements of C are distributed with plp_mat_partition. Every core computes its
+   rectangle of C with plp_mat_mult_stride_i16s_xpulpv2, by passing it as strided sub-matrix.
 */
 
 void plp_mat_mult_stride_i16p_xpulpv2(void *args) {
@@ -68,13 +72,16 @@ void plp_mat_mult_stride_i16p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int32_t *__restrict__ pDstC = a->pDstC;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     uint32_t m, n, o;
 
-    for (m = core_id; m < M; m += nPE) {
-        for (o = 0; o < O; o++) {
+    plp_mat_partition_t part;
+    plp_mat_partition(M, O, nPE, core_id, &part);
+
+    for (m = part.rowStart; m < part.rowEnd; m++) {
+        for (o = part.colStart; o < part.colEnd; o++) {
             int32_t sum = 0;
             for (n = 0; n < N; n++) {
                 int32_t valA = (int32_t)pSrcA[m * strideA + n];
@@ -87,7 +94,27 @@ void plp_mat_mult_stride_i16p_xpulpv2(void *args) {
 
 #else
 
-    // TODO: Hackathon
+    // distribute the blocks of 4x2 elements of C on a 2-D grid of cores. The rectangle of every
+    // core is a strided sub-matrix of C, which is computed with the serial kernel.
+    plp_mat_partition_t part;
+    plp_mat_partition((M + 3) / 4, (O + 1) / 2, nPE, core_id, &part);
+
+    uint32_t rowStart = part.rowStart * 4;
+    uint32_t rowEnd = (part.rowEnd * 4 > M) ? M : part.rowEnd * 4;
+    uint32_t colStart = part.colStart * 2;
+    uint32_t colEnd = (part.colEnd * 2 > O) ? O : part.colEnd * 2;
+
+    if (rowStart < rowEnd && colStart < colEnd) {
+        plp_mat_mult_stride_i16s_xpulpv2(pSrcA + rowStart * strideA,
+                                         pSrcB + colStart,
+                                         rowEnd - rowStart,
+                                         N,
+                                         colEnd - colStart,
+                                         strideA,
+                                         strideB,
+                                         strideC,
+                                         pDstC + rowStart * strideC + colStart);
+    }
 
 #endif
 #undef BASIC_VERSION
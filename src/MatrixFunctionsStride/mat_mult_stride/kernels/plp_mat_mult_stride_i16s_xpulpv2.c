@@ -39,6 +39,30 @@
   @{
  */
 
+/**
+   @brief Dot product of a row of A and a column of B, used for the leftover rows and columns.
+   @param[in]  pA       points to the first element of the row of A
+   @param[in]  pB       points to the first element of the column of B
+   @param[in]  N        number of elements
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @return     dot product
+*/
+static inline int32_t plp_mat_mult_stride_dot_i16(const int16_t *__restrict__ pA,
+                                                  const int16_t *__restrict__ pB,
+                                                  uint32_t N,
+                                                  uint32_t strideB) {
+    int32_t sum = 0;
+    uint32_t n;
+    for (n = 0; n + 1 < N; n += 2) {
+        v2s bVec = { pB[n * strideB], pB[(n + 1) * strideB] };
+        sum = __SUMDOTP2(*((v2s *)&pA[n]), bVec, sum);
+    }
+    if (n < N) {
+        sum += pA[n] * pB[n * strideB];
+    }
+    return sum;
+}
+
 /**
   @brief Matrix multiplication of 16-bit integer matrices kernel for XPULPV2 extension.
   @param[in]  pSrcA     points to the first input matrix
@@ -51,6 +75,11 @@
   @param[in]  strideC   Stride of output matrix (elements between each row)
   @param[out] pDstC     points to the output matrix
   @return        none
+
+  @par Blocking
+  The output is computed in blocks of 4x2 elements. Two rows of B are loaded as vectors and
+  shuffled, such that every vector holds two consecutive elements of the same column. Each loaded
+  vector is used for multiple pv.sdotsp.h, with all accumulators kept in registers.
  */
 
 void plp_mat_mult_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
@@ -63,7 +92,7 @@ void plp_mat_mult_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
                                       uint32_t strideC,
                                       int32_t *__restrict__ pDstC) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     uint32_t m, n, o;
@@ -82,7 +111,94 @@ void plp_mat_mult_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
 
 #else
 
-    // TODO: Hackathon
+    uint32_t m, n, o; // loop counters
+
+    // compute blocks of 4x2 elements of C, such that every vector loaded from A is used twice, and
+    // every vector of B four times
+    for (m = 0; m + 3 < M; m += 4) {
+        const int16_t *pA0 = pSrcA + m * strideA;
+        const int16_t *pA1 = pA0 + strideA;
+        const int16_t *pA2 = pA1 + strideA;
+        const int16_t *pA3 = pA2 + strideA;
+        int32_t *pC0 = pDstC + m * strideC;
+        int32_t *pC1 = pC0 + strideC;
+        int32_t *pC2 = pC1 + strideC;
+        int32_t *pC3 = pC2 + strideC;
+
+        for (o = 0; o + 1 < O; o += 2) {
+            const int16_t *pB = pSrcB + o;
+
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+            int32_t sum20 = 0;
+            int32_t sum21 = 0;
+            int32_t sum30 = 0;
+            int32_t sum31 = 0;
+
+            for (n = 0; n + 1 < N; n += 2) {
+                v2s aVec0 = *((v2s *)&pA0[n]);
+                v2s aVec1 = *((v2s *)&pA1[n]);
+                v2s aVec2 = *((v2s *)&pA2[n]);
+                v2s aVec3 = *((v2s *)&pA3[n]);
+
+                v2s bTemp0 = *((v2s *)&pB[n * strideB]);
+                v2s bTemp1 = *((v2s *)&pB[(n + 1) * strideB]);
+
+                v2s bVec0 = __builtin_shuffle(bTemp0, bTemp1, (v2s){ 0, 2 });
+                v2s bVec1 = __builtin_shuffle(bTemp0, bTemp1, (v2s){ 1, 3 });
+
+                sum00 = __SUMDOTP2(aVec0, bVec0, sum00);
+                sum01 = __SUMDOTP2(aVec0, bVec1, sum01);
+                sum10 = __SUMDOTP2(aVec1, bVec0, sum10);
+                sum11 = __SUMDOTP2(aVec1, bVec1, sum11);
+                sum20 = __SUMDOTP2(aVec2, bVec0, sum20);
+                sum21 = __SUMDOTP2(aVec2, bVec1, sum21);
+                sum30 = __SUMDOTP2(aVec3, bVec0, sum30);
+                sum31 = __SUMDOTP2(aVec3, bVec1, sum31);
+            }
+
+            // leftover element of odd N
+            if (n < N) {
+                int32_t bVal0 = pB[n * strideB];
+                int32_t bVal1 = pB[n * strideB + 1];
+                sum00 += pA0[n] * bVal0;
+                sum01 += pA0[n] * bVal1;
+                sum10 += pA1[n] * bVal0;
+                sum11 += pA1[n] * bVal1;
+                sum20 += pA2[n] * bVal0;
+                sum21 += pA2[n] * bVal1;
+                sum30 += pA3[n] * bVal0;
+                sum31 += pA3[n] * bVal1;
+            }
+
+            pC0[o] = sum00;
+            pC0[o + 1] = sum01;
+            pC1[o] = sum10;
+            pC1[o + 1] = sum11;
+            pC2[o] = sum20;
+            pC2[o + 1] = sum21;
+            pC3[o] = sum30;
+            pC3[o + 1] = sum31;
+        }
+
+        // leftover column of odd O
+        if (o < O) {
+            pC0[o] = plp_mat_mult_stride_dot_i16(pA0, pSrcB + o, N, strideB);
+            pC1[o] = plp_mat_mult_stride_dot_i16(pA1, pSrcB + o, N, strideB);
+            pC2[o] = plp_mat_mult_stride_dot_i16(pA2, pSrcB + o, N, strideB);
+            pC3[o] = plp_mat_mult_stride_dot_i16(pA3, pSrcB + o, N, strideB);
+        }
+    }
+
+    // leftover rows, if M is not a multiple of 4
+    for (; m < M; m++) {
+        for (o = 0; o < O; o++) {
+            pDstC[m * strideC + o] =
+                plp_mat_mult_stride_dot_i16(pSrcA + m * strideA, pSrcB + o, N, strideB);
+        }
+    }
 
 #endif
 #undef BASIC_VERSION
@@ -39,6 +39,33 @@
   @{
  */
 
+/**
+   @brief Dot product of a row of A and a column of B, used for the leftover rows and columns.
+   @param[in]  pA       points to the first element of the row of A
+   @param[in]  pB       points to the first element of the column of B
+   @param[in]  N        number of elements
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @return     dot product
+*/
+static inline int32_t plp_mat_mult_stride_dot_i8(const int8_t *__restrict__ pA,
+                                                 const int8_t *__restrict__ pB,
+                                                 uint32_t N,
+                                                 uint32_t strideB) {
+    int32_t sum = 0;
+    uint32_t n;
+    for (n = 0; n + 3 < N; n += 4) {
+        v4s bVec = { pB[n * strideB],
+                     pB[(n + 1) * strideB],
+                     pB[(n + 2) * strideB],
+                     pB[(n + 3) * strideB] };
+        sum = __SUMDOTP4(*((v4s *)&pA[n]), bVec, sum);
+    }
+    for (; n < N; n++) {
+        sum += pA[n] * pB[n * strideB];
+    }
+    return sum;
+}
+
 /**
   @brief Matrix multiplication of 8-bit integer matrices kernel for XPULPV2 extension.
   @param[in]  pSrcA     points to the first input matrix
@@ -51,6 +78,12 @@
   @param[in]  strideC   Stride of output matrix (elements between each row)
   @param[out] pDstC     points to the output matrix
   @return        none
+
+  @par Blocking
+  The output is computed in blocks of 2x4 elements. Four rows of B are loaded as vectors and
+  transposed with shuffles, such that every vector holds four consecutive elements of the same
+  column. Each loaded vector is used for multiple pv.sdotsp.b, with all accumulators kept in
+  registers.
  */
 
 void plp_mat_mult_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
@@ -63,7 +96,7 @@ void plp_mat_mult_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
                                      uint32_t strideC,
                                      int32_t *__restrict__ pDstC) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     uint32_t m, n, o;
@@ -82,7 +115,101 @@ void plp_mat_mult_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
 
 #else
 
-    // TODO: Hackathon
+    uint32_t m, n, o; // loop counters
+
+    const v4s mask0 = { 0, 1, 4, 5 };
+    const v4s mask1 = { 2, 3, 6, 7 };
+    const v4s mask2 = { 0, 2, 4, 6 };
+    const v4s mask3 = { 1, 3, 5, 7 };
+
+    // compute blocks of 2x4 elements of C. Four rows of B are loaded and transposed with shuffles,
+    // such that every vector holds four consecutive elements of the same column.
+    for (m = 0; m + 1 < M; m += 2) {
+        const int8_t *pA0 = pSrcA + m * strideA;
+        const int8_t *pA1 = pA0 + strideA;
+        int32_t *pC0 = pDstC + m * strideC;
+        int32_t *pC1 = pC0 + strideC;
+
+        for (o = 0; o + 3 < O; o += 4) {
+            const int8_t *pB = pSrcB + o;
+
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum02 = 0;
+            int32_t sum03 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+            int32_t sum12 = 0;
+            int32_t sum13 = 0;
+
+            for (n = 0; n + 3 < N; n += 4) {
+                v4s aVec0 = *((v4s *)&pA0[n]);
+                v4s aVec1 = *((v4s *)&pA1[n]);
+
+                v4s temp0 = *((v4s *)&pB[n * strideB]);
+                v4s temp1 = *((v4s *)&pB[(n + 1) * strideB]);
+                v4s temp2 = *((v4s *)&pB[(n + 2) * strideB]);
+                v4s temp3 = *((v4s *)&pB[(n + 3) * strideB]);
+
+                v4s temp4 = __builtin_shuffle(temp0, temp1, mask0); // 0,1,4,5
+                v4s temp5 = __builtin_shuffle(temp2, temp3, mask0); // 8,9,12,13
+                v4s temp6 = __builtin_shuffle(temp0, temp1, mask1); // 2,3,6,7
+                v4s temp7 = __builtin_shuffle(temp2, temp3, mask1); // 10,11,14,15
+
+                v4s bVec0 = __builtin_shuffle(temp4, temp5, mask2); // 0,4,8,12
+                v4s bVec1 = __builtin_shuffle(temp4, temp5, mask3); // 1,5,9,13
+                v4s bVec2 = __builtin_shuffle(temp6, temp7, mask2); // 2,6,10,14
+                v4s bVec3 = __builtin_shuffle(temp6, temp7, mask3); // 3,7,11,15
+
+                sum00 = __SUMDOTP4(aVec0, bVec0, sum00);
+                sum01 = __SUMDOTP4(aVec0, bVec1, sum01);
+                sum02 = __SUMDOTP4(aVec0, bVec2, sum02);
+                sum03 = __SUMDOTP4(aVec0, bVec3, sum03);
+                sum10 = __SUMDOTP4(aVec1, bVec0, sum10);
+                sum11 = __SUMDOTP4(aVec1, bVec1, sum11);
+                sum12 = __SUMDOTP4(aVec1, bVec2, sum12);
+                sum13 = __SUMDOTP4(aVec1, bVec3, sum13);
+            }
+
+            // leftover elements, if N is not a multiple of 4
+            for (; n < N; n++) {
+                int32_t aVal0 = pA0[n];
+                int32_t aVal1 = pA1[n];
+                const int8_t *pBRow = pB + n * strideB;
+                sum00 += aVal0 * pBRow[0];
+                sum01 += aVal0 * pBRow[1];
+                sum02 += aVal0 * pBRow[2];
+                sum03 += aVal0 * pBRow[3];
+                sum10 += aVal1 * pBRow[0];
+                sum11 += aVal1 * pBRow[1];
+                sum12 += aVal1 * pBRow[2];
+                sum13 += aVal1 * pBRow[3];
+            }
+
+            pC0[o] = sum00;
+            pC0[o + 1] = sum01;
+            pC0[o + 2] = sum02;
+            pC0[o + 3] = sum03;
+            pC1[o] = sum10;
+            pC1[o + 1] = sum11;
+            pC1[o + 2] = sum12;
+            pC1[o + 3] = sum13;
+        }
+
+        // leftover columns, if O is not a multiple of 4
+        for (; o < O; o++) {
+            pC0[o] = plp_mat_mult_stride_dot_i8(pA0, pSrcB + o, N, strideB);
+            pC1[o] = plp_mat_mult_stride_dot_i8(pA1, pSrcB + o, N, strideB);
+        }
+    }
+
+    // leftover row of odd M
+    if (m < M) {
+        for (o = 0; o < O; o++) {
+            pDstC[m * strideC + o] =
+                plp_mat_mult_stride_dot_i8(pSrcA + m * strideA, pSrcB + o, N, strideB);
+        }
+    }
 
 #endif
 #undef BASIC_VERSION
@@ -48,18 +48,18 @@
   @param[in]  strideDst   Stride of output matrix (elements between each row)
   @param[in]  scaleFactor Factor to mulitply all elements before shifting
   @param[in]  shift       Amount to shift each element
-  @param[out] pDst        Points to the output matrix
+  @param[out] pDst        Points to the output matrix, may equal pSrc if strideDst equals strideSrc
   @return     none
  */
 
-void plp_mat_scale_stride_i8s_rv32im(const int8_t *__restrict__ pSrc,
+void plp_mat_scale_stride_i8s_rv32im(const int8_t *pSrc,
                                      uint32_t M,
                                      uint32_t N,
                                      uint32_t strideSrc,
                                      uint32_t strideDst,
                                      int8_t scaleFactor,
                                      int32_t shift,
-                                     int8_t *__restrict__ pDst) {
+                                     int8_t *pDst) {
 
 #define BASIC_VERSION // if used don' forget to also use undefine at end of file
 #ifdef BASIC_VERSION
@@ -47,17 +47,17 @@
   @param[in]  strideSrc   Stride of input matrix (elements between each row)
   @param[in]  strideDst   Stride of output matrix (elements between each row)
   @param[in]  scaleFactor Factor to mulitply all elements
-  @param[out] pDst        Points to the output matrix
+  @param[out] pDst        Points to the output matrix, may equal pSrc if strideDst equals strideSrc
   @return     none
  */
 
-void plp_mat_scale_stride_f32(const float *__restrict__ pSrc,
+void plp_mat_scale_stride_f32(const float *pSrc,
                               uint32_t M,
                               uint32_t N,
                               uint32_t strideSrc,
                               uint32_t strideDst,
                               float scaleFactor,
-                              float *__restrict__ pDst) {
+                              float *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
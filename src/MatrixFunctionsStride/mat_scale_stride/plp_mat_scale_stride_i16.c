@@ -44,6 +44,9 @@
 
       `pDst[m,n] = (pSrc[m,n] * scale) >> shift`
 
+  The output matrix may be equal to the input matrix (in-place operation), if they have the
+  same stride.
+
   There are functions for integer 32- 16- and 8-bit data types. For lower precision integers (16-
   and 8-bit), functions exploiting SIMD instructions are provided.
 
@@ -76,18 +79,18 @@
   @param[in]  strideDst   Stride of output matrix (elements between each row)
   @param[in]  scaleFactor Factor to mulitply all elements before shifting
   @param[in]  shift       Amount to shift each element
-  @param[out] pDst        Points to the output matrix
+  @param[out] pDst        Points to the output matrix, may equal pSrc if strideDst equals strideSrc
   @return     none
  */
 
-void plp_mat_scale_stride_i16(const int16_t *__restrict__ pSrc,
+void plp_mat_scale_stride_i16(const int16_t *pSrc,
                               uint32_t M,
                               uint32_t N,
                               uint32_t strideSrc,
                               uint32_t strideDst,
                               int16_t scaleFactor,
                               int32_t shift,
-                              int16_t *__restrict__ pDst) {
+                              int16_t *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_scale_stride_i16s_rv32im(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift,
@@ -49,11 +49,11 @@
   @param[in]  scaleFactor Factor to mulitply all elements before shifting
   @param[in]  shift       Amount to shift each element
   @param[in]  nPE         Number of cores to use for computation
-  @param[out] pDst        Points to the output matrix
+  @param[out] pDst        Points to the output matrix, may equal pSrc if strideDst equals strideSrc
   @return     none
  */
 
-void plp_mat_scale_stride_i8_parallel(const int8_t *__restrict__ pSrc,
+void plp_mat_scale_stride_i8_parallel(const int8_t *pSrc,
                                       uint32_t M,
                                       uint32_t N,
                                       uint32_t strideSrc,
@@ -61,7 +61,7 @@ void plp_mat_scale_stride_i8_parallel(const int8_t *__restrict__ pSrc,
                                       int8_t scaleFactor,
                                       int32_t shift,
                                       uint32_t nPE,
-                                      int8_t *__restrict__ pDst) {
+                                      int8_t *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
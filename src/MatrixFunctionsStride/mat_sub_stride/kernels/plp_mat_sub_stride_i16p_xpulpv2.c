@@ -57,15 +57,15 @@ void plp_mat_sub_stride_i16p_xpulpv2(void *args) {
 
     plp_mat_sub_stride_instance_i16 *a = (plp_mat_sub_stride_instance_i16 *)args;
 
-    const int16_t *__restrict__ pSrcA = a->pSrcA;
-    const int16_t *__restrict__ pSrcB = a->pSrcB;
+    const int16_t *pSrcA = a->pSrcA;
+    const int16_t *pSrcB = a->pSrcB;
     uint32_t M = a->M;
     uint32_t N = a->N;
     uint32_t strideA = a->strideA;
     uint32_t strideB = a->strideB;
     uint32_t strideY = a->strideY;
     uint32_t nPE = a->nPE;
-    int16_t *__restrict__ pDst = a->pDst;
+    int16_t *pDst = a->pDst;
 
     uint32_t m, n; // loop counters
 
@@ -86,18 +86,18 @@
   @param[in]  strideA Stride of matrix A (elements between each row)
   @param[in]  strideB Stride of matrid B (elements between each row)
   @param[in]  strideY Stride of output matrix (elements between each row)
-  @param[out] pDst    Points to the output matrix
+  @param[out] pDst    Points to the output matrix, may equal pSrcA or pSrcB with the same stride
   @return     none
  */
 
-void plp_mat_sub_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                    const int16_t *__restrict__ pSrcB,
+void plp_mat_sub_stride_i16s_rv32im(const int16_t *pSrcA,
+                                    const int16_t *pSrcB,
                                     uint32_t M,
                                     uint32_t N,
                                     uint32_t strideA,
                                     uint32_t strideB,
                                     uint32_t strideY,
-                                    int16_t *__restrict__ pDst) {
+                                    int16_t *pDst) {
 
 #ifdef PLP_MATH_LOOPUNROLL
 
@@ -53,15 +53,15 @@ void plp_mat_sub_stride_i32p_xpulpv2(void *args) {
 
     plp_mat_sub_stride_instance_i32 *a = (plp_mat_sub_stride_instance_i32 *)args;
 
-    const int32_t *__restrict__ pSrcA = a->pSrcA;
-    const int32_t *__restrict__ pSrcB = a->pSrcB;
+    const int32_t *pSrcA = a->pSrcA;
+    const int32_t *pSrcB = a->pSrcB;
     uint32_t M = a->M;
     uint32_t N = a->N;
     uint32_t strideA = a->strideA;
     uint32_t strideB = a->strideB;
     uint32_t strideY = a->strideY;
     uint32_t nPE = a->nPE;
-    int32_t *__restrict__ pDst = a->pDst;
+    int32_t *pDst = a->pDst;
 
     uint32_t m, n; // loop counters
 
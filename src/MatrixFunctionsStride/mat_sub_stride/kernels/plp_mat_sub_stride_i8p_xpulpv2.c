@@ -56,15 +56,15 @@ void plp_mat_sub_stride_i8p_xpulpv2(void *args) {
 
     plp_mat_sub_stride_instance_i8 *a = (plp_mat_sub_stride_instance_i8 *)args;
 
-    const int8_t *__restrict__ pSrcA = a->pSrcA;
-    const int8_t *__restrict__ pSrcB = a->pSrcB;
+    const int8_t *pSrcA = a->pSrcA;
+    const int8_t *pSrcB = a->pSrcB;
     uint32_t M = a->M;
     uint32_t N = a->N;
     uint32_t strideA = a->strideA;
     uint32_t strideB = a->strideB;
     uint32_t strideY = a->strideY;
     uint32_t nPE = a->nPE;
-    int8_t *__restrict__ pDst = a->pDst;
+    int8_t *pDst = a->pDst;
 
     uint32_t m, n; // loop counters
 
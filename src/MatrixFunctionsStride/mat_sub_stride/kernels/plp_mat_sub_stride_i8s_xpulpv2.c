@@ -48,26 +48,26 @@
   @param[in]  strideA Stride of matrix A (elements between each row)
   @param[in]  strideB Stride of matrid B (elements between each row)
   @param[in]  strideY Stride of output matrix (elements between each row)
-  @param[out] pDst    Points to the output matrix
+  @param[out] pDst    Points to the output matrix, may equal pSrcA or pSrcB with the same stride
   @return     none
  */
 
-void plp_mat_sub_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
+void plp_mat_sub_stride_i8s_xpulpv2(const int8_t *pSrcA,
+                                    const int8_t *pSrcB,
                                     uint32_t M,
                                     uint32_t N,
                                     uint32_t strideA,
                                     uint32_t strideB,
                                     uint32_t strideY,
-                                    int8_t *__restrict__ pDst) {
+                                    int8_t *pDst) {
 
 #ifdef PLP_MATH_LOOPUNROLL
 
     uint32_t m, n; // loop counters
 
-    const int8_t *__restrict__ pSrcA2 = pSrcA + strideA;
-    const int8_t *__restrict__ pSrcB2 = pSrcB + strideB;
-    int8_t *__restrict__ pDst2 = pDst + strideY;
+    const int8_t *pSrcA2 = pSrcA + strideA;
+    const int8_t *pSrcB2 = pSrcB + strideB;
+    int8_t *pDst2 = pDst + strideY;
 
     unsigned int m_iter = M >> 1;
     unsigned int m_rem = M & 0x1;
@@ -44,6 +44,9 @@
 
       `pDst[m, n] = pSrcA[m, n] - pSrcB[m, n]`
 
+  The output matrix may be equal to one of the input matrices (in-place operation), if they
+  have the same stride.
+
   There are functions for integer 32- 16- and 8-bit data types, as well as for floating-point. These
   functions can also be used for fix-point matrices, if they have their fix-point at the same
   location. The outpt matrix will then also have the fix-point at the same location.
@@ -77,18 +80,18 @@
   @param[in]  strideA Stride of matrix A (elements between each row)
   @param[in]  strideB Stride of matrid B (elements between each row)
   @param[in]  strideY Stride of output matrix (elements between each row)
-  @param[out] pDst    Points to the output matrix
+  @param[out] pDst    Points to the output matrix, may equal pSrcA or pSrcB with the same stride
   @return     none
  */
 
-void plp_mat_sub_stride_i16(const int16_t *__restrict__ pSrcA,
-                            const int16_t *__restrict__ pSrcB,
+void plp_mat_sub_stride_i16(const int16_t *pSrcA,
+                            const int16_t *pSrcB,
                             uint32_t M,
                             uint32_t N,
                             uint32_t strideA,
                             uint32_t strideB,
                             uint32_t strideY,
-                            int16_t *__restrict__ pDst) {
+                            int16_t *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_sub_stride_i16s_rv32im(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst);
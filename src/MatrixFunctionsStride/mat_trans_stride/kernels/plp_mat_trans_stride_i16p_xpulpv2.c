@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_stride_i16p_xpulpv2.c
+ * Description:  Parallel strided matrix transpose of 16-bit integer kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransStride
+ */
+
+/**
+  @addtogroup MatTransStrideKernels
+  @{
+ */
+
+/**
+  @brief      Transpose an MxN strided 16-bit integers matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_trans_stride_instance_i16 struct initialized by
+                    plp_mat_trans_stride_i16_parallel
+  @return     none
+
+  @par Parallelization
+  The input matrix is split into blocks of 2 rows, which are distributed cyclically, and
+  every block is transposed with plp_mat_trans_stride_i16s_xpulpv2. Hence, the cores read the
+  same columns of neighboring blocks, and write neighboring words of the same output rows at
+  the same time. If the strides are an odd number of words (see plp_matrix_padded_stride),
+  both are located in different TCDM banks, whereas a stride of a multiple of 16 words puts
+  the reads of all cores into the same bank.
+ */
+
+void plp_mat_trans_stride_i16p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_trans_stride_instance_i16 *a = (plp_mat_trans_stride_instance_i16 *)args;
+
+    const int16_t *__restrict__ pSrc = a->pSrc;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t strideSrc = a->strideSrc;
+    uint32_t strideDst = a->strideDst;
+    uint32_t nPE = a->nPE;
+    int16_t *__restrict__ pDst = a->pDst;
+
+    uint32_t m; // first row of the block
+
+    for (m = core_id * 2; m < M; m += nPE * 2) {
+        uint32_t rows = (M - m < 2) ? M - m : 2;
+        plp_mat_trans_stride_i16s_xpulpv2(pSrc + m * strideSrc, rows, N, strideSrc, strideDst,
+                                          pDst + m);
+    }
+}
+
+/**
+  @} end of MatTransStrideKernels group
+ */
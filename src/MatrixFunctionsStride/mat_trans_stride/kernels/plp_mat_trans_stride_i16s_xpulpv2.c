@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_stride_i16s_xpulpv2.c
+ * Description:  Strided matrix transpose of 16-bit integer kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransStride
+ */
+
+/**
+  @addtogroup MatTransStrideKernels
+  @{
+ */
+
+/**
+  @brief      Transpose an MxN strided 16-bit integers matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The matrix is transposed in tiles of 2x2 elements, such that every row of a tile is a
+  single 32-bit word, which is transposed with two shuffle instructions. The words are
+  aligned if both matrices and strides are a multiple of two elements, e.g. for strides
+  from plp_matrix_padded_stride.
+ */
+
+void plp_mat_trans_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       int16_t *__restrict__ pDst) {
+
+    uint32_t m, n; // loop counters
+
+    for (m = 0; m + 1 < M; m += 2) {
+        const int16_t *pRow0 = pSrc + m * strideSrc;
+        const int16_t *pRow1 = pRow0 + strideSrc;
+        for (n = 0; n + 1 < N; n += 2) {
+            v2s row0 = *((v2s *)&pRow0[n]);
+            v2s row1 = *((v2s *)&pRow1[n]);
+            int16_t *pOut = pDst + n * strideDst + m;
+            *((v2s *)&pOut[0]) = __builtin_shuffle(row0, row1, (v2s){ 0, 2 });
+            *((v2s *)&pOut[strideDst]) = __builtin_shuffle(row0, row1, (v2s){ 1, 3 });
+        }
+        // last column of the input matrix, if N is odd
+        if (n < N) {
+            pDst[n * strideDst + m] = pRow0[n];
+            pDst[n * strideDst + m + 1] = pRow1[n];
+        }
+    }
+
+    // last row of the input matrix, if M is odd
+    if (m < M) {
+        for (n = 0; n < N; n++) {
+            pDst[n * strideDst + m] = pSrc[m * strideSrc + n];
+        }
+    }
+}
+
+/**
+  @} end of MatTransStrideKernels group
+ */
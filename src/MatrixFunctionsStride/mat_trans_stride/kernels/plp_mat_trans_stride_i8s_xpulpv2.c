@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_stride_i8s_xpulpv2.c
+ * Description:  Strided matrix transpose of 8-bit integer kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransStride
+ */
+
+/**
+  @addtogroup MatTransStrideKernels
+  @{
+ */
+
+/**
+  @brief      Transpose an MxN strided 8-bit integers matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The matrix is transposed in tiles of 4x4 elements, such that every row of a tile is a
+  single 32-bit word, which is transposed with two stages of shuffle instructions. The words
+  are aligned if both matrices and strides are a multiple of four elements, e.g. for strides
+  from plp_matrix_padded_stride.
+ */
+
+void plp_mat_trans_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int8_t *__restrict__ pDst) {
+
+    uint32_t m, n; // loop counters
+
+    for (m = 0; m + 3 < M; m += 4) {
+        const int8_t *pRow0 = pSrc + m * strideSrc;
+        const int8_t *pRow1 = pRow0 + strideSrc;
+        const int8_t *pRow2 = pRow1 + strideSrc;
+        const int8_t *pRow3 = pRow2 + strideSrc;
+        for (n = 0; n + 3 < N; n += 4) {
+            v4s row0 = *((v4s *)&pRow0[n]);
+            v4s row1 = *((v4s *)&pRow1[n]);
+            v4s row2 = *((v4s *)&pRow2[n]);
+            v4s row3 = *((v4s *)&pRow3[n]);
+            v4s tmp0 = __builtin_shuffle(row0, row1, (v4s){ 0, 4, 2, 6 });
+            v4s tmp1 = __builtin_shuffle(row0, row1, (v4s){ 1, 5, 3, 7 });
+            v4s tmp2 = __builtin_shuffle(row2, row3, (v4s){ 0, 4, 2, 6 });
+            v4s tmp3 = __builtin_shuffle(row2, row3, (v4s){ 1, 5, 3, 7 });
+            int8_t *pOut = pDst + n * strideDst + m;
+            *((v4s *)&pOut[0]) = __builtin_shuffle(tmp0, tmp2, (v4s){ 0, 1, 4, 5 });
+            *((v4s *)&pOut[strideDst]) = __builtin_shuffle(tmp1, tmp3, (v4s){ 0, 1, 4, 5 });
+            *((v4s *)&pOut[2 * strideDst]) = __builtin_shuffle(tmp0, tmp2, (v4s){ 2, 3, 6, 7 });
+            *((v4s *)&pOut[3 * strideDst]) = __builtin_shuffle(tmp1, tmp3, (v4s){ 2, 3, 6, 7 });
+        }
+        // last columns of the input matrix, if N is not a multiple of 4
+        for (; n < N; n++) {
+            pDst[n * strideDst + m] = pRow0[n];
+            pDst[n * strideDst + m + 1] = pRow1[n];
+            pDst[n * strideDst + m + 2] = pRow2[n];
+            pDst[n * strideDst + m + 3] = pRow3[n];
+        }
+    }
+
+    // last rows of the input matrix, if M is not a multiple of 4
+    for (; m < M; m++) {
+        for (n = 0; n < N; n++) {
+            pDst[n * strideDst + m] = pSrc[m * strideSrc + n];
+        }
+    }
+}
+
+/**
+  @} end of MatTransStrideKernels group
+ */
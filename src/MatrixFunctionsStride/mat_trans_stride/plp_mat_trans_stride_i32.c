@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_stride_i32.c
+ * Description:  Strided matrix transpose of 32-bit integer glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @defgroup MatTransStride Strided Matrix Transpose
+  This module contains the glue code for transposing strided matrices. The kernel codes (kernels)
+  are located in the module @ref MatTransStrideKernels.
+
+  The input matrix of shape MxN is transposed into the output matrix of shape NxM, and both can
+  have a stride larger than their width. This allows to transpose sub-blocks of larger matrices,
+  and matrices with rows padded to avoid conflicts of the L1 memory banks (see
+  plp_matrix_padded_stride). With such a padding, the parallel kernels read and write distinct
+  banks on all cores, for any shape of the matrix.
+
+  There are functions for integer 32- 16- and 8-bit data types, as well as for floating-point. The
+  naming scheme of the functions follows the following pattern (for example
+  `plp_mat_trans_stride_i32`):
+
+      `plp_<function name>_<data type><precision>[_parallel]`
+
+  name          | description
+  ------------- | ---------------------------------------------------------
+  function_name | `mat_trans_stride`
+  data type     | {f, i, q} respectively for floats, integers, fixed points
+  precision     | {32, 16, 8} bits
+
+  The `stride` arguments tell how many elements are in between the start of each row of the
+  matrices. @ref groupMatrixStride
+ */
+
+/**
+  @addtogroup MatTransStride
+  @{
+ */
+
+/**
+  @brief      Glue code to transpose an MxN strided 32-bit integers matrix
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+ */
+
+void plp_mat_trans_stride_i32(const int32_t *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t strideSrc,
+                              uint32_t strideDst,
+                              int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_trans_stride_i32s_rv32im(pSrc, M, N, strideSrc, strideDst, pDst);
+    } else {
+        plp_mat_trans_stride_i32s_xpulpv2(pSrc, M, N, strideSrc, strideDst, pDst);
+    }
+}
+
+/**
+  @} end of MatTransStride group
+ */
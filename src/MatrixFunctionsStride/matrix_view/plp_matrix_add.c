@@ -0,0 +1,325 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_matrix_add.c
+ * Description:  Addition and subtraction of matrix views
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static int matrix_check_elementwise(const plp_matrix_t *pA,
+                                    const plp_matrix_t *pB,
+                                    const plp_matrix_t *pDst);
+static void matrix_add(const plp_matrix_t *pA,
+                       const plp_matrix_t *pB,
+                       const plp_matrix_t *pDst,
+                       uint32_t nPE);
+static void matrix_sub(const plp_matrix_t *pA,
+                       const plp_matrix_t *pB,
+                       const plp_matrix_t *pDst,
+                       uint32_t nPE);
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @addtogroup MatrixView
+  @{
+ */
+
+/**
+  @brief      Matrix addition of matrix views, dispatched to the best kernel.
+  @param[in]  pA    Points to the view of the first input matrix of shape MxN
+  @param[in]  pB    Points to the view of the second input matrix of shape MxN
+  @param[out] pDst  Points to the view of the output matrix of shape MxN
+  @param[in]  nPE   Number of cores to use, 1 for the serial kernels (which also run on the fabric
+                    controller)
+  @return     0: Success, 1: The shapes or types do not match, or the views are not transposed
+              alike
+
+  @par Dispatching
+  If all three matrices are dense, the dense kernels are used, and the strided kernels otherwise.
+  Fixed-point matrices use the integer kernels of the same width, which compute the same result.
+  The views must either be all transposed or none of them.
+ */
+
+int plp_matrix_add(const plp_matrix_t *pA,
+                   const plp_matrix_t *pB,
+                   const plp_matrix_t *pDst,
+                   uint32_t nPE) {
+
+    if (matrix_check_elementwise(pA, pB, pDst)) {
+        return 1;
+    }
+
+    matrix_add(pA, pB, pDst, nPE);
+
+    return 0;
+}
+
+/**
+  @brief      Matrix subtraction of matrix views, dispatched to the best kernel.
+  @param[in]  pA    Points to the view of the first input matrix of shape MxN
+  @param[in]  pB    Points to the view of the second input matrix of shape MxN
+  @param[out] pDst  Points to the view of the output matrix of shape MxN
+  @param[in]  nPE   Number of cores to use, 1 for the serial kernels (which also run on the fabric
+                    controller)
+  @return     0: Success, 1: The shapes or types do not match, or the views are not transposed
+              alike
+
+  @par Dispatching
+  If all three matrices are dense, the dense kernels are used, and the strided kernels otherwise.
+  Fixed-point matrices use the integer kernels of the same width, which compute the same result.
+  The views must either be all transposed or none of them.
+ */
+
+int plp_matrix_sub(const plp_matrix_t *pA,
+                   const plp_matrix_t *pB,
+                   const plp_matrix_t *pDst,
+                   uint32_t nPE) {
+
+    if (matrix_check_elementwise(pA, pB, pDst)) {
+        return 1;
+    }
+
+    matrix_sub(pA, pB, pDst, nPE);
+
+    return 0;
+}
+
+/**
+  @} end of MatrixView group
+ */
+
+// 1 if the three views do not have the same type, shape and transposition
+static int matrix_check_elementwise(const plp_matrix_t *pA,
+                                    const plp_matrix_t *pB,
+                                    const plp_matrix_t *pDst) {
+    return pA->dtype != pB->dtype || pA->dtype != pDst->dtype || pA->rows != pB->rows ||
+           pA->rows != pDst->rows || pA->cols != pB->cols || pA->cols != pDst->cols ||
+           pA->trans != pB->trans || pA->trans != pDst->trans;
+}
+
+static void matrix_add(const plp_matrix_t *pA,
+                       const plp_matrix_t *pB,
+                       const plp_matrix_t *pDst,
+                       uint32_t nPE) {
+
+    // a transposed view of all three matrices is the same operation on the stored matrices
+    uint32_t M = pA->trans ? pA->cols : pA->rows;
+    uint32_t N = pA->trans ? pA->rows : pA->cols;
+    int dense = plp_matrix_is_dense(pA) && plp_matrix_is_dense(pB) && plp_matrix_is_dense(pDst);
+
+    switch (pA->dtype) {
+    case PLP_DTYPE_I8:
+    case PLP_DTYPE_Q8:
+        if (dense) {
+            if (nPE > 1) {
+                plp_mat_add_i8_parallel((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N,
+                                        nPE, (int8_t *)pDst->pData);
+            } else {
+                plp_mat_add_i8((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N,
+                               (int8_t *)pDst->pData);
+            }
+        } else {
+            if (nPE > 1) {
+                plp_mat_add_stride_i8_parallel((const int8_t *)pA->pData, (const int8_t *)pB->pData,
+                                               M, N, pA->stride, pB->stride, pDst->stride, nPE,
+                                               (int8_t *)pDst->pData);
+            } else {
+                plp_mat_add_stride_i8((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N,
+                                      pA->stride, pB->stride, pDst->stride, (int8_t *)pDst->pData);
+            }
+        }
+        break;
+    case PLP_DTYPE_I16:
+    case PLP_DTYPE_Q16:
+        if (dense) {
+            if (nPE > 1) {
+                plp_mat_add_i16_parallel((const int16_t *)pA->pData, (const int16_t *)pB->pData, M,
+                                         N, nPE, (int16_t *)pDst->pData);
+            } else {
+                plp_mat_add_i16((const int16_t *)pA->pData, (const int16_t *)pB->pData, M, N,
+                                (int16_t *)pDst->pData);
+            }
+        } else {
+            if (nPE > 1) {
+                plp_mat_add_stride_i16_parallel((const int16_t *)pA->pData,
+                                                (const int16_t *)pB->pData, M, N, pA->stride,
+                                                pB->stride, pDst->stride, nPE,
+                                                (int16_t *)pDst->pData);
+            } else {
+                plp_mat_add_stride_i16((const int16_t *)pA->pData, (const int16_t *)pB->pData, M, N,
+                                       pA->stride, pB->stride, pDst->stride,
+                                       (int16_t *)pDst->pData);
+            }
+        }
+        break;
+    case PLP_DTYPE_I32:
+    case PLP_DTYPE_Q32:
+        if (dense) {
+            if (nPE > 1) {
+                plp_mat_add_i32_parallel((const int32_t *)pA->pData, (const int32_t *)pB->pData, M,
+                                         N, nPE, (int32_t *)pDst->pData);
+            } else {
+                plp_mat_add_i32((const int32_t *)pA->pData, (const int32_t *)pB->pData, M, N,
+                                (int32_t *)pDst->pData);
+            }
+        } else {
+            if (nPE > 1) {
+                plp_mat_add_stride_i32_parallel((const int32_t *)pA->pData,
+                                                (const int32_t *)pB->pData, M, N, pA->stride,
+                                                pB->stride, pDst->stride, nPE,
+                                                (int32_t *)pDst->pData);
+            } else {
+                plp_mat_add_stride_i32((const int32_t *)pA->pData, (const int32_t *)pB->pData, M, N,
+                                       pA->stride, pB->stride, pDst->stride,
+                                       (int32_t *)pDst->pData);
+            }
+        }
+        break;
+    case PLP_DTYPE_F32:
+        if (dense) {
+            if (nPE > 1) {
+                plp_mat_add_f32_parallel((const float *)pA->pData, (const float *)pB->pData, M, N,
+                                         nPE, (float *)pDst->pData);
+            } else {
+                plp_mat_add_f32((const float *)pA->pData, (const float *)pB->pData, M, N,
+                                (float *)pDst->pData);
+            }
+        } else {
+            if (nPE > 1) {
+                plp_mat_add_stride_f32_parallel((const float *)pA->pData, (const float *)pB->pData,
+                                                M, N, pA->stride, pB->stride, pDst->stride, nPE,
+                                                (float *)pDst->pData);
+            } else {
+                plp_mat_add_stride_f32((const float *)pA->pData, (const float *)pB->pData, M, N,
+                                       pA->stride, pB->stride, pDst->stride, (float *)pDst->pData);
+            }
+        }
+        break;
+    }
+}
+
+static void matrix_sub(const plp_matrix_t *pA,
+                       const plp_matrix_t *pB,
+                       const plp_matrix_t *pDst,
+                       uint32_t nPE) {
+
+    // a transposed view of all three matrices is the same operation on the stored matrices
+    uint32_t M = pA->trans ? pA->cols : pA->rows;
+    uint32_t N = pA->trans ? pA->rows : pA->cols;
+    int dense = plp_matrix_is_dense(pA) && plp_matrix_is_dense(pB) && plp_matrix_is_dense(pDst);
+
+    switch (pA->dtype) {
+    case PLP_DTYPE_I8:
+    case PLP_DTYPE_Q8:
+        if (dense) {
+            if (nPE > 1) {
+                plp_mat_sub_i8_parallel((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N,
+                                        nPE, (int8_t *)pDst->pData);
+            } else {
+                plp_mat_sub_i8((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N,
+                               (int8_t *)pDst->pData);
+            }
+        } else {
+            if (nPE > 1) {
+                plp_mat_sub_stride_i8_parallel((const int8_t *)pA->pData, (const int8_t *)pB->pData,
+                                               M, N, pA->stride, pB->stride, pDst->stride, nPE,
+                                               (int8_t *)pDst->pData);
+            } else {
+                plp_mat_sub_stride_i8((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N,
+                                      pA->stride, pB->stride, pDst->stride, (int8_t *)pDst->pData);
+            }
+        }
+        break;
+    case PLP_DTYPE_I16:
+    case PLP_DTYPE_Q16:
+        if (dense) {
+            if (nPE > 1) {
+                plp_mat_sub_i16_parallel((const int16_t *)pA->pData, (const int16_t *)pB->pData, M,
+                                         N, nPE, (int16_t *)pDst->pData);
+            } else {
+                plp_mat_sub_i16((const int16_t *)pA->pData, (const int16_t *)pB->pData, M, N,
+                                (int16_t *)pDst->pData);
+            }
+        } else {
+            if (nPE > 1) {
+                plp_mat_sub_stride_i16_parallel((const int16_t *)pA->pData,
+                                                (const int16_t *)pB->pData, M, N, pA->stride,
+                                                pB->stride, pDst->stride, nPE,
+                                                (int16_t *)pDst->pData);
+            } else {
+                plp_mat_sub_stride_i16((const int16_t *)pA->pData, (const int16_t *)pB->pData, M, N,
+                                       pA->stride, pB->stride, pDst->stride,
+                                       (int16_t *)pDst->pData);
+            }
+        }
+        break;
+    case PLP_DTYPE_I32:
+    case PLP_DTYPE_Q32:
+        if (dense) {
+            if (nPE > 1) {
+                plp_mat_sub_i32_parallel((const int32_t *)pA->pData, (const int32_t *)pB->pData, M,
+                                         N, nPE, (int32_t *)pDst->pData);
+            } else {
+                plp_mat_sub_i32((const int32_t *)pA->pData, (const int32_t *)pB->pData, M, N,
+                                (int32_t *)pDst->pData);
+            }
+        } else {
+            if (nPE > 1) {
+                plp_mat_sub_stride_i32_parallel((const int32_t *)pA->pData,
+                                                (const int32_t *)pB->pData, M, N, pA->stride,
+                                                pB->stride, pDst->stride, nPE,
+                                                (int32_t *)pDst->pData);
+            } else {
+                plp_mat_sub_stride_i32((const int32_t *)pA->pData, (const int32_t *)pB->pData, M, N,
+                                       pA->stride, pB->stride, pDst->stride,
+                                       (int32_t *)pDst->pData);
+            }
+        }
+        break;
+    case PLP_DTYPE_F32:
+        if (dense) {
+            if (nPE > 1) {
+                plp_mat_sub_f32_parallel((const float *)pA->pData, (const float *)pB->pData, M, N,
+                                         nPE, (float *)pDst->pData);
+            } else {
+                plp_mat_sub_f32((const float *)pA->pData, (const float *)pB->pData, M, N,
+                                (float *)pDst->pData);
+            }
+        } else {
+            if (nPE > 1) {
+                plp_mat_sub_stride_f32_parallel((const float *)pA->pData, (const float *)pB->pData,
+                                                M, N, pA->stride, pB->stride, pDst->stride, nPE,
+                                                (float *)pDst->pData);
+            } else {
+                plp_mat_sub_stride_f32((const float *)pA->pData, (const float *)pB->pData, M, N,
+                                       pA->stride, pB->stride, pDst->stride, (float *)pDst->pData);
+            }
+        }
+        break;
+    }
+}
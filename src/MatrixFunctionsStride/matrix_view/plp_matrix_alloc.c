@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_matrix_alloc.c
+ * Description:  Allocation of matrix views with padded rows
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @addtogroup MatrixView
+  @{
+ */
+
+/**
+  @brief      Allocate a matrix in L1, with rows padded to avoid conflicts of the memory banks.
+  @param[out] pMat   Points to the view of the allocated matrix, dense except for the padding
+  @param[in]  rows   Number of rows
+  @param[in]  cols   Number of columns
+  @param[in]  dtype  Element type
+  @return     0: Success, 1: Not enough memory, in which case pMat->pData is NULL
+
+  @par
+  The stride of the matrix is plp_matrix_padded_stride(cols, dtype), such that cores which
+  access the same column of neighboring rows use distinct TCDM banks. The buffer is taken with
+  plp_scratch_alloc, i.e. from the arena selected with plp_arena_use, or with rt_alloc if there
+  is none, and must be released with plp_matrix_free. The padding is not initialized.
+ */
+
+int plp_matrix_alloc(plp_matrix_t *pMat, uint32_t rows, uint32_t cols, plp_dtype_t dtype) {
+
+    uint32_t stride = plp_matrix_padded_stride(cols, dtype);
+
+    *pMat = plp_matrix(NULL, rows, cols, stride, dtype);
+    pMat->pData = plp_scratch_alloc(rows * stride * plp_dtype_size(dtype));
+
+    return (pMat->pData == NULL) ? 1 : 0;
+}
+
+/**
+  @brief      Release a matrix allocated with plp_matrix_alloc.
+  @param[in]  pMat  Points to the view returned by plp_matrix_alloc, or its transpose
+  @return     none
+ */
+
+void plp_matrix_free(plp_matrix_t *pMat) {
+
+    uint32_t rows = pMat->trans ? pMat->cols : pMat->rows; // number of stored rows
+
+    plp_scratch_free(pMat->pData, rows * pMat->stride * plp_dtype_size(pMat->dtype));
+    pMat->pData = NULL;
+}
+
+/**
+  @} end of MatrixView group
+ */
@@ -0,0 +1,204 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_matrix_copy.c
+ * Description:  Copy of matrix views
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @defgroup MatrixView Matrix Views
+  A matrix view (plp_matrix_t) describes a matrix in memory by its data pointer, shape, row stride,
+  element type and whether it is transposed. Views of sub-blocks (plp_matrix_block) and transposed
+  views (plp_matrix_trans) are created without copying any data. The functions of this module take
+  views, check that their shapes and types match, and dispatch to the best kernel of the library:
+  the dense kernels if all matrices are dense, the strided kernels (plp_mat_*_stride_*) otherwise,
+  and the kernels with a transposed operand for transposed views. This replaces the copies of
+  sub-blocks into dense buffers, which are otherwise needed to call the dense kernels.
+  <pre>
+  plp_matrix_t A = plp_matrix(pData, 64, 64, 64, PLP_DTYPE_F32);
+  plp_matrix_t A11 = plp_matrix_block(A, 32, 32, 32, 32);
+  plp_matrix_t B = plp_matrix(pB, 32, 16, 16, PLP_DTYPE_F32);
+  plp_matrix_t C = plp_matrix(pC, 32, 16, 16, PLP_DTYPE_F32);
+  plp_matrix_mult(&A11, &B, &C, 0, 8);
+  </pre>
+  All functions return 0 on success, and 1 if the views do not fit together or the combination of
+  views is not supported by any kernel, in which case nothing is computed.
+ */
+
+/**
+  @addtogroup MatrixView
+  @{
+ */
+
+/**
+  @brief      Copy of a matrix view into another one, dispatched to the best kernel.
+  @param[in]  pSrc  Points to the view of the input matrix of shape MxN
+  @param[out] pDst  Points to the view of the output matrix of shape MxN
+  @param[in]  nPE   Number of cores to use, 1 for the serial kernels (which also run on the fabric
+                    controller)
+  @return     0: Success, 1: The shapes or types do not match
+
+  @par Dispatching
+  The elements are copied bitwise with the integer kernels of the same width. If both matrices are
+  dense, they are copied as a single vector, and with the strided copy otherwise. If exactly one of
+  the views is transposed, the matrix is transposed with plp_mat_trans if both are dense, and with
+  plp_mat_trans_stride otherwise (e.g. for matrices from plp_matrix_alloc).
+ */
+
+int plp_matrix_copy(const plp_matrix_t *pSrc, const plp_matrix_t *pDst, uint32_t nPE) {
+
+    if (pSrc->dtype != pDst->dtype || pSrc->rows != pDst->rows || pSrc->cols != pDst->cols) {
+        return 1;
+    }
+
+    // shape of the stored input matrix
+    uint32_t M = pSrc->trans ? pSrc->cols : pSrc->rows;
+    uint32_t N = pSrc->trans ? pSrc->rows : pSrc->cols;
+    int dense = plp_matrix_is_dense(pSrc) && plp_matrix_is_dense(pDst);
+
+    if (pSrc->trans != pDst->trans && dense) {
+        switch (plp_dtype_size(pSrc->dtype)) {
+        case 1:
+            if (nPE > 1) {
+                plp_mat_trans_i8_parallel((const int8_t *)pSrc->pData, M, N, nPE,
+                                          (int8_t *)pDst->pData);
+            } else {
+                plp_mat_trans_i8((const int8_t *)pSrc->pData, M, N, (int8_t *)pDst->pData);
+            }
+            break;
+        case 2:
+            if (nPE > 1) {
+                plp_mat_trans_i16_parallel((const int16_t *)pSrc->pData, M, N, nPE,
+                                           (int16_t *)pDst->pData);
+            } else {
+                plp_mat_trans_i16((const int16_t *)pSrc->pData, M, N, (int16_t *)pDst->pData);
+            }
+            break;
+        case 4:
+            if (nPE > 1) {
+                plp_mat_trans_i32_parallel((const int32_t *)pSrc->pData, M, N, nPE,
+                                           (int32_t *)pDst->pData);
+            } else {
+                plp_mat_trans_i32((const int32_t *)pSrc->pData, M, N, (int32_t *)pDst->pData);
+            }
+            break;
+        }
+    } else if (pSrc->trans != pDst->trans) {
+        switch (plp_dtype_size(pSrc->dtype)) {
+        case 1:
+            if (nPE > 1) {
+                plp_mat_trans_stride_i8_parallel((const int8_t *)pSrc->pData, M, N, pSrc->stride,
+                                                 pDst->stride, nPE, (int8_t *)pDst->pData);
+            } else {
+                plp_mat_trans_stride_i8((const int8_t *)pSrc->pData, M, N, pSrc->stride,
+                                        pDst->stride, (int8_t *)pDst->pData);
+            }
+            break;
+        case 2:
+            if (nPE > 1) {
+                plp_mat_trans_stride_i16_parallel((const int16_t *)pSrc->pData, M, N, pSrc->stride,
+                                                  pDst->stride, nPE, (int16_t *)pDst->pData);
+            } else {
+                plp_mat_trans_stride_i16((const int16_t *)pSrc->pData, M, N, pSrc->stride,
+                                         pDst->stride, (int16_t *)pDst->pData);
+            }
+            break;
+        case 4:
+            if (nPE > 1) {
+                plp_mat_trans_stride_i32_parallel((const int32_t *)pSrc->pData, M, N, pSrc->stride,
+                                                  pDst->stride, nPE, (int32_t *)pDst->pData);
+            } else {
+                plp_mat_trans_stride_i32((const int32_t *)pSrc->pData, M, N, pSrc->stride,
+                                         pDst->stride, (int32_t *)pDst->pData);
+            }
+            break;
+        }
+    } else if (dense) {
+        switch (plp_dtype_size(pSrc->dtype)) {
+        case 1:
+            if (nPE > 1) {
+                plp_copy_i8_parallel((int8_t *)pSrc->pData, (int8_t *)pDst->pData, M * N, nPE);
+            } else {
+                plp_copy_i8((int8_t *)pSrc->pData, (int8_t *)pDst->pData, M * N);
+            }
+            break;
+        case 2:
+            if (nPE > 1) {
+                plp_copy_i16_parallel((int16_t *)pSrc->pData, (int16_t *)pDst->pData, M * N, nPE);
+            } else {
+                plp_copy_i16((int16_t *)pSrc->pData, (int16_t *)pDst->pData, M * N);
+            }
+            break;
+        case 4:
+            if (nPE > 1) {
+                plp_copy_i32_parallel((int32_t *)pSrc->pData, (int32_t *)pDst->pData, M * N, nPE);
+            } else {
+                plp_copy_i32((int32_t *)pSrc->pData, (int32_t *)pDst->pData, M * N);
+            }
+            break;
+        }
+    } else {
+        switch (plp_dtype_size(pSrc->dtype)) {
+        case 1:
+            if (nPE > 1) {
+                plp_mat_copy_stride_i8_parallel((const int8_t *)pSrc->pData, M, N, pSrc->stride,
+                                                pDst->stride, nPE, (int8_t *)pDst->pData);
+            } else {
+                plp_mat_copy_stride_i8((const int8_t *)pSrc->pData, M, N, pSrc->stride,
+                                       pDst->stride, (int8_t *)pDst->pData);
+            }
+            break;
+        case 2:
+            if (nPE > 1) {
+                plp_mat_copy_stride_i16_parallel((const int16_t *)pSrc->pData, M, N, pSrc->stride,
+                                                 pDst->stride, nPE, (int16_t *)pDst->pData);
+            } else {
+                plp_mat_copy_stride_i16((const int16_t *)pSrc->pData, M, N, pSrc->stride,
+                                        pDst->stride, (int16_t *)pDst->pData);
+            }
+            break;
+        case 4:
+            if (nPE > 1) {
+                plp_mat_copy_stride_i32_parallel((const int32_t *)pSrc->pData, M, N, pSrc->stride,
+                                                 pDst->stride, nPE, (int32_t *)pDst->pData);
+            } else {
+                plp_mat_copy_stride_i32((const int32_t *)pSrc->pData, M, N, pSrc->stride,
+                                        pDst->stride, (int32_t *)pDst->pData);
+            }
+            break;
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatrixView group
+ */
@@ -0,0 +1,556 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_matrix_mult.c
+ * Description:  Matrix multiplication of matrix views
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static void matrix_mult_dense(const plp_matrix_t *pA,
+                              const plp_matrix_t *pB,
+                              const plp_matrix_t *pC,
+                              uint32_t shift,
+                              uint32_t nPE);
+static void matrix_mult_stride(const plp_matrix_t *pA,
+                               const plp_matrix_t *pB,
+                               const plp_matrix_t *pC,
+                               uint32_t shift,
+                               uint32_t nPE);
+static void matrix_mult_trans_dense(const plp_matrix_t *pA,
+                                    const plp_matrix_t *pB,
+                                    const plp_matrix_t *pC,
+                                    uint32_t shift,
+                                    uint32_t nPE);
+static void matrix_mult_trans_stride(const plp_matrix_t *pA,
+                                     const plp_matrix_t *pB,
+                                     const plp_matrix_t *pC,
+                                     uint32_t shift,
+                                     uint32_t nPE);
+static void matrix_mult_transA_dense(const plp_matrix_t *pA,
+                                     const plp_matrix_t *pB,
+                                     const plp_matrix_t *pC,
+                                     uint32_t shift,
+                                     uint32_t nPE);
+
+/**
+  @ingroup groupMatrixStride
+ */
+
+/**
+  @addtogroup MatrixView
+  @{
+ */
+
+/**
+  @brief      Matrix multiplication C = A B of matrix views, dispatched to the best kernel.
+  @param[in]  pA     Points to the view of the first input matrix of shape MxN
+  @param[in]  pB     Points to the view of the second input matrix of shape NxO
+  @param[out] pC     Points to the view of the output matrix of shape MxO
+  @param[in]  shift  Amount to shift the result of each multiplication to the right, only used
+                     for fixed-point types
+  @param[in]  nPE    Number of cores to use, 1 for the serial kernels (which also run on the
+                     fabric controller)
+  @return     0: Success, 1: The shapes or types do not match, or the combination of views is not
+              supported
+
+  @par Types
+  pA and pB must have the same type. The product of 8-bit and 16-bit integer matrices is a 32-bit
+  integer matrix, all other types produce a matrix of the same type.
+
+  @par Dispatching
+  If A, B and C are dense, the dense kernels are used, and the strided kernels otherwise. A
+  transposed view of B uses the kernels with a transposed second matrix, which read B in the order
+  it is stored. A transposed view of A is only supported for dense matrices. A transposed view of
+  C is computed as C^T = B^T A^T, such that C is written in the order it is stored.
+ */
+
+int plp_matrix_mult(const plp_matrix_t *pA,
+                    const plp_matrix_t *pB,
+                    const plp_matrix_t *pC,
+                    uint32_t shift,
+                    uint32_t nPE) {
+
+    if (pC->trans) {
+        plp_matrix_t a = plp_matrix_trans(*pB);
+        plp_matrix_t b = plp_matrix_trans(*pA);
+        plp_matrix_t c = plp_matrix_trans(*pC);
+        return plp_matrix_mult(&a, &b, &c, shift, nPE);
+    }
+
+    plp_dtype_t dtypeC = pA->dtype;
+    if (pA->dtype == PLP_DTYPE_I8 || pA->dtype == PLP_DTYPE_I16) {
+        dtypeC = PLP_DTYPE_I32;
+    }
+
+    if (pA->dtype != pB->dtype || pC->dtype != dtypeC || pA->cols != pB->rows ||
+        pC->rows != pA->rows || pC->cols != pB->cols) {
+        return 1;
+    }
+
+    int dense = plp_matrix_is_dense(pA) && plp_matrix_is_dense(pB) && plp_matrix_is_dense(pC);
+
+    if (!pA->trans && !pB->trans) {
+        if (dense) {
+            matrix_mult_dense(pA, pB, pC, shift, nPE);
+        } else {
+            matrix_mult_stride(pA, pB, pC, shift, nPE);
+        }
+    } else if (!pA->trans) {
+        if (dense) {
+            matrix_mult_trans_dense(pA, pB, pC, shift, nPE);
+        } else {
+            matrix_mult_trans_stride(pA, pB, pC, shift, nPE);
+        }
+    } else if (!pB->trans && dense) {
+        matrix_mult_transA_dense(pA, pB, pC, shift, nPE);
+    } else {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatrixView group
+ */
+
+// A B with dense matrices
+static void matrix_mult_dense(const plp_matrix_t *pA,
+                              const plp_matrix_t *pB,
+                              const plp_matrix_t *pC,
+                              uint32_t shift,
+                              uint32_t nPE) {
+
+    uint32_t M = pC->rows;
+    uint32_t N = pA->cols;
+    uint32_t O = pC->cols;
+
+    switch (pA->dtype) {
+    case PLP_DTYPE_I8:
+        if (nPE > 1) {
+            plp_mat_mult_i8_parallel((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N, O,
+                                     nPE, (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_i8((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N, O,
+                            (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_I16:
+        if (nPE > 1) {
+            plp_mat_mult_i16_parallel((const int16_t *)pA->pData, (const int16_t *)pB->pData, M, N,
+                                      O, nPE, (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_i16((const int16_t *)pA->pData, (const int16_t *)pB->pData, M, N, O,
+                             (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_I32:
+        if (nPE > 1) {
+            plp_mat_mult_i32_parallel((const int32_t *)pA->pData, (const int32_t *)pB->pData, M, N,
+                                      O, nPE, (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_i32((const int32_t *)pA->pData, (const int32_t *)pB->pData, M, N, O,
+                             (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q8:
+        if (nPE > 1) {
+            plp_mat_mult_q8_parallel((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N, O,
+                                     shift, nPE, (int8_t *)pC->pData);
+        } else {
+            plp_mat_mult_q8((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N, O, shift,
+                            (int8_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q16:
+        if (nPE > 1) {
+            plp_mat_mult_q16_parallel((const int16_t *)pA->pData, (const int16_t *)pB->pData, M, N,
+                                      O, shift, nPE, (int16_t *)pC->pData);
+        } else {
+            plp_mat_mult_q16((const int16_t *)pA->pData, (const int16_t *)pB->pData, M, N, O, shift,
+                             (int16_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q32:
+        if (nPE > 1) {
+            plp_mat_mult_q32_parallel((const int32_t *)pA->pData, (const int32_t *)pB->pData, M, N,
+                                      O, shift, nPE, (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_q32((const int32_t *)pA->pData, (const int32_t *)pB->pData, M, N, O, shift,
+                             (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_F32:
+        if (nPE > 1) {
+            plp_mat_mult_f32_parallel((const float *)pA->pData, (const float *)pB->pData, M, N, O,
+                                      nPE, (float *)pC->pData);
+        } else {
+            plp_mat_mult_f32((const float *)pA->pData, (const float *)pB->pData, M, N, O,
+                             (float *)pC->pData);
+        }
+        break;
+    }
+}
+
+// A B with strided matrices
+static void matrix_mult_stride(const plp_matrix_t *pA,
+                               const plp_matrix_t *pB,
+                               const plp_matrix_t *pC,
+                               uint32_t shift,
+                               uint32_t nPE) {
+
+    uint32_t M = pC->rows;
+    uint32_t N = pA->cols;
+    uint32_t O = pC->cols;
+
+    switch (pA->dtype) {
+    case PLP_DTYPE_I8:
+        if (nPE > 1) {
+            plp_mat_mult_stride_i8_parallel((const int8_t *)pA->pData, (const int8_t *)pB->pData, M,
+                                            N, O, pA->stride, pB->stride, pC->stride, nPE,
+                                            (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_stride_i8((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N, O,
+                                   pA->stride, pB->stride, pC->stride, (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_I16:
+        if (nPE > 1) {
+            plp_mat_mult_stride_i16_parallel((const int16_t *)pA->pData, (const int16_t *)pB->pData,
+                                             M, N, O, pA->stride, pB->stride, pC->stride, nPE,
+                                             (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_stride_i16((const int16_t *)pA->pData, (const int16_t *)pB->pData, M, N, O,
+                                    pA->stride, pB->stride, pC->stride, (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_I32:
+        if (nPE > 1) {
+            plp_mat_mult_stride_i32_parallel((const int32_t *)pA->pData, (const int32_t *)pB->pData,
+                                             M, N, O, pA->stride, pB->stride, pC->stride, nPE,
+                                             (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_stride_i32((const int32_t *)pA->pData, (const int32_t *)pB->pData, M, N, O,
+                                    pA->stride, pB->stride, pC->stride, (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q8:
+        if (nPE > 1) {
+            plp_mat_mult_stride_q8_parallel((const int8_t *)pA->pData, (const int8_t *)pB->pData, M,
+                                            N, O, pA->stride, pB->stride, pC->stride, shift, nPE,
+                                            (int8_t *)pC->pData);
+        } else {
+            plp_mat_mult_stride_q8((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N, O,
+                                   pA->stride, pB->stride, pC->stride, shift, (int8_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q16:
+        if (nPE > 1) {
+            plp_mat_mult_stride_q16_parallel((const int16_t *)pA->pData, (const int16_t *)pB->pData,
+                                             M, N, O, pA->stride, pB->stride, pC->stride, shift,
+                                             nPE, (int16_t *)pC->pData);
+        } else {
+            plp_mat_mult_stride_q16((const int16_t *)pA->pData, (const int16_t *)pB->pData, M, N, O,
+                                    pA->stride, pB->stride, pC->stride, shift,
+                                    (int16_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q32:
+        if (nPE > 1) {
+            plp_mat_mult_stride_q32_parallel((const int32_t *)pA->pData, (const int32_t *)pB->pData,
+                                             M, N, O, pA->stride, pB->stride, pC->stride, shift,
+                                             nPE, (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_stride_q32((const int32_t *)pA->pData, (const int32_t *)pB->pData, M, N, O,
+                                    pA->stride, pB->stride, pC->stride, shift,
+                                    (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_F32:
+        if (nPE > 1) {
+            plp_mat_mult_stride_f32_parallel((const float *)pA->pData, (const float *)pB->pData, M,
+                                             N, O, pA->stride, pB->stride, pC->stride, nPE,
+                                             (float *)pC->pData);
+        } else {
+            plp_mat_mult_stride_f32((const float *)pA->pData, (const float *)pB->pData, M, N, O,
+                                    pA->stride, pB->stride, pC->stride, (float *)pC->pData);
+        }
+        break;
+    }
+}
+
+// A B with dense matrices, B is stored transposed
+static void matrix_mult_trans_dense(const plp_matrix_t *pA,
+                                    const plp_matrix_t *pB,
+                                    const plp_matrix_t *pC,
+                                    uint32_t shift,
+                                    uint32_t nPE) {
+
+    uint32_t M = pC->rows;
+    uint32_t N = pA->cols;
+    uint32_t O = pC->cols;
+
+    switch (pA->dtype) {
+    case PLP_DTYPE_I8:
+        if (nPE > 1) {
+            plp_mat_mult_trans_i8_parallel((const int8_t *)pA->pData, (const int8_t *)pB->pData, M,
+                                           N, O, nPE, (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_trans_i8((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N, O,
+                                  (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_I16:
+        if (nPE > 1) {
+            plp_mat_mult_trans_i16_parallel((const int16_t *)pA->pData, (const int16_t *)pB->pData,
+                                            M, N, O, nPE, (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_trans_i16((const int16_t *)pA->pData, (const int16_t *)pB->pData, M, N, O,
+                                   (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_I32:
+        if (nPE > 1) {
+            plp_mat_mult_trans_i32_parallel((const int32_t *)pA->pData, (const int32_t *)pB->pData,
+                                            M, N, O, nPE, (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_trans_i32((const int32_t *)pA->pData, (const int32_t *)pB->pData, M, N, O,
+                                   (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q8:
+        if (nPE > 1) {
+            plp_mat_mult_trans_q8_parallel((const int8_t *)pA->pData, (const int8_t *)pB->pData, M,
+                                           N, O, shift, nPE, (int8_t *)pC->pData);
+        } else {
+            plp_mat_mult_trans_q8((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N, O,
+                                  shift, (int8_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q16:
+        if (nPE > 1) {
+            plp_mat_mult_trans_q16_parallel((const int16_t *)pA->pData, (const int16_t *)pB->pData,
+                                            M, N, O, shift, nPE, (int16_t *)pC->pData);
+        } else {
+            plp_mat_mult_trans_q16((const int16_t *)pA->pData, (const int16_t *)pB->pData, M, N, O,
+                                   shift, (int16_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q32:
+        if (nPE > 1) {
+            plp_mat_mult_trans_q32_parallel((const int32_t *)pA->pData, (const int32_t *)pB->pData,
+                                            M, N, O, shift, nPE, (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_trans_q32((const int32_t *)pA->pData, (const int32_t *)pB->pData, M, N, O,
+                                   shift, (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_F32:
+        if (nPE > 1) {
+            plp_mat_mult_trans_f32_parallel((const float *)pA->pData, (const float *)pB->pData, M,
+                                            N, O, nPE, (float *)pC->pData);
+        } else {
+            plp_mat_mult_trans_f32((const float *)pA->pData, (const float *)pB->pData, M, N, O,
+                                   (float *)pC->pData);
+        }
+        break;
+    }
+}
+
+// A B with strided matrices, B is stored transposed
+static void matrix_mult_trans_stride(const plp_matrix_t *pA,
+                                     const plp_matrix_t *pB,
+                                     const plp_matrix_t *pC,
+                                     uint32_t shift,
+                                     uint32_t nPE) {
+
+    uint32_t M = pC->rows;
+    uint32_t N = pA->cols;
+    uint32_t O = pC->cols;
+
+    switch (pA->dtype) {
+    case PLP_DTYPE_I8:
+        if (nPE > 1) {
+            plp_mat_mult_trans_stride_i8_parallel((const int8_t *)pA->pData,
+                                                  (const int8_t *)pB->pData, M, N, O, pA->stride,
+                                                  pB->stride, pC->stride, nPE,
+                                                  (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_trans_stride_i8((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N,
+                                         O, pA->stride, pB->stride, pC->stride,
+                                         (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_I16:
+        if (nPE > 1) {
+            plp_mat_mult_trans_stride_i16_parallel((const int16_t *)pA->pData,
+                                                   (const int16_t *)pB->pData, M, N, O, pA->stride,
+                                                   pB->stride, pC->stride, nPE,
+                                                   (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_trans_stride_i16((const int16_t *)pA->pData, (const int16_t *)pB->pData, M,
+                                          N, O, pA->stride, pB->stride, pC->stride,
+                                          (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_I32:
+        if (nPE > 1) {
+            plp_mat_mult_trans_stride_i32_parallel((const int32_t *)pA->pData,
+                                                   (const int32_t *)pB->pData, M, N, O, pA->stride,
+                                                   pB->stride, pC->stride, nPE,
+                                                   (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_trans_stride_i32((const int32_t *)pA->pData, (const int32_t *)pB->pData, M,
+                                          N, O, pA->stride, pB->stride, pC->stride,
+                                          (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q8:
+        if (nPE > 1) {
+            plp_mat_mult_trans_stride_q8_parallel((const int8_t *)pA->pData,
+                                                  (const int8_t *)pB->pData, M, N, O, pA->stride,
+                                                  pB->stride, pC->stride, shift, nPE,
+                                                  (int8_t *)pC->pData);
+        } else {
+            plp_mat_mult_trans_stride_q8((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N,
+                                         O, pA->stride, pB->stride, pC->stride, shift,
+                                         (int8_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q16:
+        if (nPE > 1) {
+            plp_mat_mult_trans_stride_q16_parallel((const int16_t *)pA->pData,
+                                                   (const int16_t *)pB->pData, M, N, O, pA->stride,
+                                                   pB->stride, pC->stride, shift, nPE,
+                                                   (int16_t *)pC->pData);
+        } else {
+            plp_mat_mult_trans_stride_q16((const int16_t *)pA->pData, (const int16_t *)pB->pData, M,
+                                          N, O, pA->stride, pB->stride, pC->stride, shift,
+                                          (int16_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q32:
+        if (nPE > 1) {
+            plp_mat_mult_trans_stride_q32_parallel((const int32_t *)pA->pData,
+                                                   (const int32_t *)pB->pData, M, N, O, pA->stride,
+                                                   pB->stride, pC->stride, shift, nPE,
+                                                   (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_trans_stride_q32((const int32_t *)pA->pData, (const int32_t *)pB->pData, M,
+                                          N, O, pA->stride, pB->stride, pC->stride, shift,
+                                          (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_F32:
+        if (nPE > 1) {
+            plp_mat_mult_trans_stride_f32_parallel((const float *)pA->pData,
+                                                   (const float *)pB->pData, M, N, O, pA->stride,
+                                                   pB->stride, pC->stride, nPE, (float *)pC->pData);
+        } else {
+            plp_mat_mult_trans_stride_f32((const float *)pA->pData, (const float *)pB->pData, M, N,
+                                          O, pA->stride, pB->stride, pC->stride,
+                                          (float *)pC->pData);
+        }
+        break;
+    }
+}
+
+// A B with dense matrices, A is stored transposed
+static void matrix_mult_transA_dense(const plp_matrix_t *pA,
+                                     const plp_matrix_t *pB,
+                                     const plp_matrix_t *pC,
+                                     uint32_t shift,
+                                     uint32_t nPE) {
+
+    uint32_t M = pC->rows;
+    uint32_t N = pA->cols;
+    uint32_t O = pC->cols;
+
+    switch (pA->dtype) {
+    case PLP_DTYPE_I8:
+        if (nPE > 1) {
+            plp_mat_mult_transA_i8_parallel((const int8_t *)pA->pData, (const int8_t *)pB->pData, M,
+                                            N, O, nPE, (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_transA_i8((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N, O,
+                                   (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_I16:
+        if (nPE > 1) {
+            plp_mat_mult_transA_i16_parallel((const int16_t *)pA->pData, (const int16_t *)pB->pData,
+                                             M, N, O, nPE, (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_transA_i16((const int16_t *)pA->pData, (const int16_t *)pB->pData, M, N, O,
+                                    (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_I32:
+        if (nPE > 1) {
+            plp_mat_mult_transA_i32_parallel((const int32_t *)pA->pData, (const int32_t *)pB->pData,
+                                             M, N, O, nPE, (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_transA_i32((const int32_t *)pA->pData, (const int32_t *)pB->pData, M, N, O,
+                                    (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q8:
+        if (nPE > 1) {
+            plp_mat_mult_transA_q8_parallel((const int8_t *)pA->pData, (const int8_t *)pB->pData, M,
+                                            N, O, shift, nPE, (int8_t *)pC->pData);
+        } else {
+            plp_mat_mult_transA_q8((const int8_t *)pA->pData, (const int8_t *)pB->pData, M, N, O,
+                                   shift, (int8_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q16:
+        if (nPE > 1) {
+            plp_mat_mult_transA_q16_parallel((const int16_t *)pA->pData, (const int16_t *)pB->pData,
+                                             M, N, O, shift, nPE, (int16_t *)pC->pData);
+        } else {
+            plp_mat_mult_transA_q16((const int16_t *)pA->pData, (const int16_t *)pB->pData, M, N, O,
+                                    shift, (int16_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_Q32:
+        if (nPE > 1) {
+            plp_mat_mult_transA_q32_parallel((const int32_t *)pA->pData, (const int32_t *)pB->pData,
+                                             M, N, O, shift, nPE, (int32_t *)pC->pData);
+        } else {
+            plp_mat_mult_transA_q32((const int32_t *)pA->pData, (const int32_t *)pB->pData, M, N, O,
+                                    shift, (int32_t *)pC->pData);
+        }
+        break;
+    case PLP_DTYPE_F32:
+        if (nPE > 1) {
+            plp_mat_mult_transA_f32_parallel((const float *)pA->pData, (const float *)pB->pData, M,
+                                             N, O, nPE, (float *)pC->pData);
+        } else {
+            plp_mat_mult_transA_f32((const float *)pA->pData, (const float *)pB->pData, M, N, O,
+                                    (float *)pC->pData);
+        }
+        break;
+    }
+}
@@ -0,0 +1,107 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_avgpool2d_q8s_rv32im.c
+ * Description:  2D average pooling of 8-bit fixed point images for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup AvgPool2d
+ */
+
+/**
+  @defgroup AvgPool2dKernels 2D Average Pooling Kernels
+  This module contains the kernel codes of the 2D average pooling.
+ */
+
+// Window sum divided by the window size, rounded to the nearest integer with ties away from
+// zero. The division is a multiplication with recip = ceil(2^32 / area), which is exact as long as
+// |sum| + area / 2 < 2^32 / area, i.e. for windows of up to 256 samples.
+static inline int8_t plp_avgpool2d_q8_div(int32_t sum,
+                                          uint32_t area,
+                                          uint32_t recip) {
+    uint32_t half = area >> 1;
+    uint32_t x = (sum < 0) ? half - sum : sum + half;
+    int32_t q = (int32_t)(((uint64_t)x * recip) >> 32);
+    return (int8_t)((sum < 0) ? -q : q);
+}
+
+/**
+  @addtogroup AvgPool2dKernels
+  @{
+ */
+
+/**
+  @brief 2D average pooling of 8-bit fixed point images kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input image, srcRows x srcCols
+  @param[in]  srcRows    number of rows of the input image
+  @param[in]  srcCols    number of columns of the input image
+  @param[in]  poolRows   number of rows of the pooling window
+  @param[in]  poolCols   number of columns of the pooling window
+  @param[in]  stride     distance between two windows, in rows and columns
+  @param[out] pDst       output image returned here, ((srcRows - poolRows) / stride + 1) x
+                         ((srcCols - poolCols) / stride + 1)
+  @return     none
+ */
+
+void plp_avgpool2d_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                              uint32_t srcRows,
+                              uint32_t srcCols,
+                              uint32_t poolRows,
+                              uint32_t poolCols,
+                              uint32_t stride,
+                              int8_t *__restrict__ pDst) {
+
+    uint32_t outRows = (srcRows - poolRows) / stride + 1;
+    uint32_t outCols = (srcCols - poolCols) / stride + 1;
+    uint32_t area = poolRows * poolCols;
+    uint32_t i, j, r, c;
+
+    // a window of one sample is a strided copy, for which the reciprocal does not fit 32 bit
+    if (area == 1) {
+        plp_maxpool2d_q8s_rv32im(pSrc, srcRows, srcCols, poolRows, poolCols, stride, pDst);
+        return;
+    }
+
+    uint32_t recip = 0xFFFFFFFFu / area + 1;
+
+    for (i = 0; i < outRows; i++) {
+        for (j = 0; j < outCols; j++) {
+            const int8_t *pIn = pSrc + i * stride * srcCols + j * stride;
+            int32_t sum = 0;
+            for (r = 0; r < poolRows; r++) {
+                for (c = 0; c < poolCols; c++) {
+                    sum += pIn[r * srcCols + c];
+                }
+            }
+            pDst[i * outCols + j] = plp_avgpool2d_q8_div(sum, area, recip);
+        }
+    }
+}
+
+/**
+  @} end of AvgPool2dKernels group
+ */
@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_depthwise_q8s_rv32im.c
+ * Description:  Depthwise convolution of 8-bit fixed point images kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup ConvDepthwise
+ */
+
+/**
+  @defgroup ConvDepthwiseKernels Depthwise Convolution Kernels
+  This module contains the kernel codes of the depthwise convolution.
+ */
+
+/**
+  @addtogroup ConvDepthwiseKernels
+  @{
+ */
+
+/**
+  @brief Depthwise convolution of an 8-bit fixed point image channel kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input channel, srcRows x srcCols
+  @param[in]  srcRows    number of rows of the input channel
+  @param[in]  srcCols    number of columns of the input channel
+  @param[in]  pKernel    points to the kernel of the channel, kRows x kCols
+  @param[in]  kRows      number of rows of the kernel
+  @param[in]  kCols      number of columns of the kernel
+  @param[in]  stride     distance between two windows, in rows and columns
+  @param[in]  bias       bias of the channel
+  @param[in]  shift      right shift of the accumulator, to requantize the output
+  @param[in]  relu       if not zero, negative outputs are set to zero
+  @param[out] pDst       output channel returned here, ((srcRows - kRows) / stride + 1) x
+                         ((srcCols - kCols) / stride + 1)
+  @return     none
+ */
+
+void plp_conv_depthwise_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                                   uint32_t srcRows,
+                                   uint32_t srcCols,
+                                   const int8_t *__restrict__ pKernel,
+                                   uint32_t kRows,
+                                   uint32_t kCols,
+                                   uint32_t stride,
+                                   int32_t bias,
+                                   uint32_t shift,
+                                   uint8_t relu,
+                                   int8_t *__restrict__ pDst) {
+
+    uint32_t outRows = (srcRows - kRows) / stride + 1;
+    uint32_t outCols = (srcCols - kCols) / stride + 1;
+    int32_t round = (1 << shift) >> 1;
+    int32_t low = relu ? 0 : -128;
+    uint32_t i, j, r, c;
+
+    for (i = 0; i < outRows; i++) {
+        for (j = 0; j < outCols; j++) {
+            const int8_t *pIn = pSrc + i * stride * srcCols + j * stride;
+            const int8_t *pK = pKernel;
+            int32_t sum = bias;
+            for (r = 0; r < kRows; r++) {
+                for (c = 0; c < kCols; c++) {
+                    sum += pIn[c] * pK[c];
+                }
+                pIn += srcCols;
+                pK += kCols;
+            }
+            sum = (sum + round) >> shift;
+            pDst[i * outCols + j] = (int8_t)((sum > 127) ? 127 : (sum < low) ? low : sum);
+        }
+    }
+}
+
+/**
+  @} end of ConvDepthwiseKernels group
+ */
@@ -0,0 +1,140 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_depthwise_q8s_xpulpv2.c
+ * Description:  Depthwise convolution of 8-bit fixed point images kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup ConvDepthwise
+ */
+
+/**
+  @addtogroup ConvDepthwiseKernels
+  @{
+ */
+
+/**
+  @brief Depthwise convolution of an 8-bit fixed point image channel kernel for XPULPV2
+  extension.
+  @param[in]  pSrc       points to the input channel, srcRows x srcCols
+  @param[in]  srcRows    number of rows of the input channel
+  @param[in]  srcCols    number of columns of the input channel
+  @param[in]  pKernel    points to the kernel of the channel, kRows x kCols
+  @param[in]  kRows      number of rows of the kernel
+  @param[in]  kCols      number of columns of the kernel
+  @param[in]  stride     distance between two windows, in rows and columns
+  @param[in]  bias       bias of the channel
+  @param[in]  shift      right shift of the accumulator, to requantize the output
+  @param[in]  relu       if not zero, negative outputs are set to zero
+  @param[out] pDst       output channel returned here, ((srcRows - kRows) / stride + 1) x
+                         ((srcCols - kCols) / stride + 1)
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The rows of the kernel are padded with zeros to a multiple of four taps, such that a row of a
+  window (e.g. the three taps of a 3x3 kernel) is multiplied with a single pv.sdotsp.b. The
+  requantization uses p.addRN and p.clip. Kernels larger than PLP_CONV2D_MAX_KERNEL_SIZE, and the
+  last windows of a row, for which the padded loads would read past the end of the row, are
+  computed without SIMD.
+ */
+
+void plp_conv_depthwise_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                    uint32_t srcRows,
+                                    uint32_t srcCols,
+                                    const int8_t *__restrict__ pKernel,
+                                    uint32_t kRows,
+                                    uint32_t kCols,
+                                    uint32_t stride,
+                                    int32_t bias,
+                                    uint32_t shift,
+                                    uint8_t relu,
+                                    int8_t *__restrict__ pDst) {
+
+    v4s kernel[PLP_CONV2D_MAX_KERNEL_SIZE * ((PLP_CONV2D_MAX_KERNEL_SIZE + 3) / 4)];
+    int8_t *pPad = (int8_t *)kernel;
+
+    uint32_t outRows = (srcRows - kRows) / stride + 1;
+    uint32_t outCols = (srcCols - kCols) / stride + 1;
+    uint32_t kVecs = (kCols + 3) / 4; // vectors per padded kernel row
+    uint32_t vecCols = 0; // outputs of a row computed with SIMD
+    int32_t low = relu ? 0 : -128;
+    uint32_t i, j, r, c;
+
+    // the loads of output j end before pIn[j * stride + 4 * kVecs]
+    if (kRows <= PLP_CONV2D_MAX_KERNEL_SIZE && kCols <= PLP_CONV2D_MAX_KERNEL_SIZE &&
+        srcCols >= 4 * kVecs) {
+        vecCols = (srcCols - 4 * kVecs) / stride + 1;
+        if (vecCols > outCols) {
+            vecCols = outCols;
+        }
+
+        for (r = 0; r < kRows; r++) {
+            for (c = 0; c < 4 * kVecs; c++) {
+                pPad[r * 4 * kVecs + c] = (c < kCols) ? pKernel[r * kCols + c] : 0;
+            }
+        }
+    }
+
+    for (i = 0; i < outRows; i++) {
+        const int8_t *pRow = pSrc + i * stride * srcCols;
+        int8_t *pOut = pDst + i * outCols;
+
+        for (j = 0; j < vecCols; j++) {
+            const int8_t *pIn = pRow + j * stride;
+            const v4s *pK = kernel;
+            int32_t sum = bias;
+            for (r = 0; r < kRows; r++) {
+                for (c = 0; c < kVecs; c++) {
+                    sum = __SUMDOTP4(*((v4s *)&pIn[4 * c]), *pK++, sum);
+                }
+                pIn += srcCols;
+            }
+            sum = __CLIP(__ROUNDNORM_REG(sum, shift), 7);
+            pOut[j] = (int8_t)((sum < low) ? low : sum);
+        }
+
+        // last windows of the row
+        for (; j < outCols; j++) {
+            const int8_t *pIn = pRow + j * stride;
+            const int8_t *pK = pKernel;
+            int32_t sum = bias;
+            for (r = 0; r < kRows; r++) {
+                for (c = 0; c < kCols; c++) {
+                    sum = __MAC(sum, pIn[c], pK[c]);
+                }
+                pIn += srcCols;
+                pK += kCols;
+            }
+            sum = __CLIP(__ROUNDNORM_REG(sum, shift), 7);
+            pOut[j] = (int8_t)((sum < low) ? low : sum);
+        }
+    }
+}
+
+/**
+  @} end of ConvDepthwiseKernels group
+ */
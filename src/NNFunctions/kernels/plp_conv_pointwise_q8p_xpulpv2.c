@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_pointwise_q8p_xpulpv2.c
+ * Description:  Parallel pointwise convolution of 8-bit fixed point images kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup ConvPointwise
+ */
+
+/**
+  @addtogroup ConvPointwiseKernels
+  @{
+ */
+
+/**
+  @brief Parallel pointwise convolution of 8-bit fixed point images kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_conv_pointwise_instance_q8 struct initialized by
+                    plp_conv_pointwise_q8_parallel
+  @return     none
+
+  @par Every core computes a contiguous range of output channels with the single-core kernel,
+  which reads the whole input image. The ranges are a multiple of two channels, the block size of
+  the single-core kernel.
+ */
+
+void plp_conv_pointwise_q8p_xpulpv2(void *args) {
+
+    plp_conv_pointwise_instance_q8 *S = (plp_conv_pointwise_instance_q8 *)args;
+
+    uint32_t start, end;
+    plp_team_chunk(S->outChannels, S->nPE, rt_core_id(), 2, &start, &end);
+
+    if (start < end) {
+        plp_conv_pointwise_q8s_xpulpv2(S->pSrc, S->nPixels, S->inChannels,
+                                       S->pWeights + start * S->inChannels, end - start,
+                                       (S->pBias == NULL) ? NULL : S->pBias + start, S->shift,
+                                       S->relu, S->pDst + start * S->nPixels);
+    }
+}
+
+/**
+  @} end of ConvPointwiseKernels group
+ */
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_pointwise_q8s_rv32im.c
+ * Description:  Pointwise convolution of 8-bit fixed point images kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup ConvPointwise
+ */
+
+/**
+  @defgroup ConvPointwiseKernels Pointwise Convolution Kernels
+  This module contains the kernel codes of the pointwise convolution.
+ */
+
+/**
+  @addtogroup ConvPointwiseKernels
+  @{
+ */
+
+/**
+  @brief Pointwise convolution of 8-bit fixed point images kernel for RV32IM extension.
+  @param[in]  pSrc         points to the input image, inChannels x nPixels
+  @param[in]  nPixels      number of pixels of a channel, i.e. rows times columns
+  @param[in]  inChannels   number of input channels
+  @param[in]  pWeights     points to the weights, outChannels x inChannels
+  @param[in]  outChannels  number of output channels
+  @param[in]  pBias        points to the bias of every output channel, or NULL for no bias
+  @param[in]  shift        right shift of the accumulator, to requantize the output
+  @param[in]  relu         if not zero, negative outputs are set to zero
+  @param[out] pDst         output image returned here, outChannels x nPixels
+  @return     none
+ */
+
+void plp_conv_pointwise_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                                   uint32_t nPixels,
+                                   uint32_t inChannels,
+                                   const int8_t *__restrict__ pWeights,
+                                   uint32_t outChannels,
+                                   const int32_t *__restrict__ pBias,
+                                   uint32_t shift,
+                                   uint8_t relu,
+                                   int8_t *__restrict__ pDst) {
+
+    int32_t round = (1 << shift) >> 1;
+    int32_t low = relu ? 0 : -128;
+    uint32_t co, ci, p;
+
+    for (co = 0; co < outChannels; co++) {
+        const int8_t *pW = pWeights + co * inChannels;
+        int32_t bias = (pBias == NULL) ? 0 : pBias[co];
+        for (p = 0; p < nPixels; p++) {
+            int32_t sum = bias;
+            for (ci = 0; ci < inChannels; ci++) {
+                sum += pW[ci] * pSrc[ci * nPixels + p];
+            }
+            sum = (sum + round) >> shift;
+            pDst[co * nPixels + p] = (int8_t)((sum > 127) ? 127 : (sum < low) ? low : sum);
+        }
+    }
+}
+
+/**
+  @} end of ConvPointwiseKernels group
+ */
@@ -0,0 +1,175 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_pointwise_q8s_xpulpv2.c
+ * Description:  Pointwise convolution of 8-bit fixed point images kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup ConvPointwise
+ */
+
+/**
+  @addtogroup ConvPointwiseKernels
+  @{
+ */
+
+/**
+  @brief Pointwise convolution of 8-bit fixed point images kernel for XPULPV2 extension.
+  @param[in]  pSrc         points to the input image, inChannels x nPixels
+  @param[in]  nPixels      number of pixels of a channel, i.e. rows times columns
+  @param[in]  inChannels   number of input channels
+  @param[in]  pWeights     points to the weights, outChannels x inChannels
+  @param[in]  outChannels  number of output channels
+  @param[in]  pBias        points to the bias of every output channel, or NULL for no bias
+  @param[in]  shift        right shift of the accumulator, to requantize the output
+  @param[in]  relu         if not zero, negative outputs are set to zero
+  @param[out] pDst         output image returned here, outChannels x nPixels
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The outputs are computed in blocks of two output channels and four pixels. The four pixels of
+  four input channels are loaded as four words, which are transposed with pv.shuffle2.b into one
+  word of four channels per pixel, and multiplied with the weights of both output channels with
+  pv.sdotsp.b. The requantization uses p.addRN and p.clip. The last output channel of an odd
+  number of channels is computed in a block with itself, and the last pixels of a channel without
+  SIMD.
+ */
+
+void plp_conv_pointwise_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                    uint32_t nPixels,
+                                    uint32_t inChannels,
+                                    const int8_t *__restrict__ pWeights,
+                                    uint32_t outChannels,
+                                    const int32_t *__restrict__ pBias,
+                                    uint32_t shift,
+                                    uint8_t relu,
+                                    int8_t *__restrict__ pDst) {
+
+    const v4s maskLo = { 0, 4, 1, 5 };
+    const v4s maskHi = { 2, 6, 3, 7 };
+    const v4s mask01 = { 0, 1, 4, 5 };
+    const v4s mask23 = { 2, 3, 6, 7 };
+
+    uint32_t ciVec = inChannels & ~3; // input channels computed with SIMD
+    uint32_t pVec = nPixels & ~3;     // pixels computed with SIMD
+    int32_t low = relu ? 0 : -128;
+    int32_t out[8];
+    uint32_t co, ci, p, k;
+
+    for (co = 0; co < outChannels; co += 2) {
+        uint32_t co1 = (co + 1 < outChannels) ? co + 1 : co;
+        const int8_t *pW0 = pWeights + co * inChannels;
+        const int8_t *pW1 = pWeights + co1 * inChannels;
+        int32_t bias0 = (pBias == NULL) ? 0 : pBias[co];
+        int32_t bias1 = (pBias == NULL) ? 0 : pBias[co1];
+
+        for (p = 0; p < pVec; p += 4) {
+            const int8_t *pIn = pSrc + p;
+            int32_t s00 = bias0, s01 = bias0, s02 = bias0, s03 = bias0;
+            int32_t s10 = bias1, s11 = bias1, s12 = bias1, s13 = bias1;
+
+            for (ci = 0; ci < ciVec; ci += 4) {
+                v4s r0 = *((v4s *)&pIn[0]);
+                v4s r1 = *((v4s *)&pIn[nPixels]);
+                v4s r2 = *((v4s *)&pIn[2 * nPixels]);
+                v4s r3 = *((v4s *)&pIn[3 * nPixels]);
+                v4s w0 = *((v4s *)&pW0[ci]);
+                v4s w1 = *((v4s *)&pW1[ci]);
+
+                // transpose, such that x0 to x3 hold the four channels of one pixel each
+                v4s t01Lo = __builtin_shuffle(r0, r1, maskLo);
+                v4s t23Lo = __builtin_shuffle(r2, r3, maskLo);
+                v4s t01Hi = __builtin_shuffle(r0, r1, maskHi);
+                v4s t23Hi = __builtin_shuffle(r2, r3, maskHi);
+                v4s x0 = __builtin_shuffle(t01Lo, t23Lo, mask01);
+                v4s x1 = __builtin_shuffle(t01Lo, t23Lo, mask23);
+                v4s x2 = __builtin_shuffle(t01Hi, t23Hi, mask01);
+                v4s x3 = __builtin_shuffle(t01Hi, t23Hi, mask23);
+
+                s00 = __SUMDOTP4(x0, w0, s00);
+                s01 = __SUMDOTP4(x1, w0, s01);
+                s02 = __SUMDOTP4(x2, w0, s02);
+                s03 = __SUMDOTP4(x3, w0, s03);
+                s10 = __SUMDOTP4(x0, w1, s10);
+                s11 = __SUMDOTP4(x1, w1, s11);
+                s12 = __SUMDOTP4(x2, w1, s12);
+                s13 = __SUMDOTP4(x3, w1, s13);
+
+                pIn += 4 * nPixels;
+            }
+
+            // leftover input channels
+            for (; ci < inChannels; ci++) {
+                s00 = __MAC(s00, pIn[0], pW0[ci]);
+                s01 = __MAC(s01, pIn[1], pW0[ci]);
+                s02 = __MAC(s02, pIn[2], pW0[ci]);
+                s03 = __MAC(s03, pIn[3], pW0[ci]);
+                s10 = __MAC(s10, pIn[0], pW1[ci]);
+                s11 = __MAC(s11, pIn[1], pW1[ci]);
+                s12 = __MAC(s12, pIn[2], pW1[ci]);
+                s13 = __MAC(s13, pIn[3], pW1[ci]);
+                pIn += nPixels;
+            }
+
+            out[0] = s00;
+            out[1] = s01;
+            out[2] = s02;
+            out[3] = s03;
+            out[4] = s10;
+            out[5] = s11;
+            out[6] = s12;
+            out[7] = s13;
+            for (k = 0; k < 8; k++) {
+                int32_t y = __CLIP(__ROUNDNORM_REG(out[k], shift), 7);
+                out[k] = (y < low) ? low : y;
+            }
+            for (k = 0; k < 4; k++) {
+                pDst[co * nPixels + p + k] = (int8_t)out[k];
+                pDst[co1 * nPixels + p + k] = (int8_t)out[4 + k];
+            }
+        }
+
+        // leftover pixels
+        for (; p < nPixels; p++) {
+            int32_t sum0 = bias0;
+            int32_t sum1 = bias1;
+            for (ci = 0; ci < inChannels; ci++) {
+                int32_t x = pSrc[ci * nPixels + p];
+                sum0 = __MAC(sum0, x, pW0[ci]);
+                sum1 = __MAC(sum1, x, pW1[ci]);
+            }
+            sum0 = __CLIP(__ROUNDNORM_REG(sum0, shift), 7);
+            sum1 = __CLIP(__ROUNDNORM_REG(sum1, shift), 7);
+            pDst[co * nPixels + p] = (int8_t)((sum0 < low) ? low : sum0);
+            pDst[co1 * nPixels + p] = (int8_t)((sum1 < low) ? low : sum1);
+        }
+    }
+}
+
+/**
+  @} end of ConvPointwiseKernels group
+ */
@@ -0,0 +1,133 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gru_cell_q8p_xpulpv2.c
+ * Description:  Parallel GRU cell of 8-bit fixed point vectors kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup RNNCell
+ */
+
+// Hidden unit j: the three gates are accumulated in a single pass over the input and the hidden
+// state, 4 values at a time with pv.sdotsp.b, followed by the activations and the update of the
+// hidden state.
+static inline void plp_gru_cell_q8_unit(const int8_t *__restrict__ pInput,
+                                        const int8_t *__restrict__ pHidden,
+                                        const int8_t *__restrict__ pWeights,
+                                        const int32_t *__restrict__ pBias,
+                                        uint32_t nInput,
+                                        uint32_t nHidden,
+                                        int32_t shift,
+                                        uint32_t j,
+                                        int8_t *__restrict__ pHiddenOut) {
+
+    uint32_t stride = (nInput + nHidden) * nHidden; // distance between the gates
+    const int8_t *pWr = pWeights + j * (nInput + nHidden);
+    const int8_t *pWz = pWr + stride;
+    const int8_t *pWn = pWz + stride;
+    int32_t accR = 0, accZ = 0, accNx = 0, accNh = 0;
+    uint32_t k;
+
+    if (pBias != NULL) {
+        accR = pBias[j];
+        accZ = pBias[nHidden + j];
+        accNx = pBias[2 * nHidden + j];
+        accNh = pBias[3 * nHidden + j];
+    }
+
+    // input
+    for (k = 0; k + 3 < nInput; k += 4) {
+        v4s x = *((v4s *)&pInput[k]);
+        accR = __SUMDOTP4(x, *((v4s *)&pWr[k]), accR);
+        accZ = __SUMDOTP4(x, *((v4s *)&pWz[k]), accZ);
+        accNx = __SUMDOTP4(x, *((v4s *)&pWn[k]), accNx);
+    }
+    for (; k < nInput; k++) {
+        accR = __MAC(accR, pInput[k], pWr[k]);
+        accZ = __MAC(accZ, pInput[k], pWz[k]);
+        accNx = __MAC(accNx, pInput[k], pWn[k]);
+    }
+
+    pWr += nInput;
+    pWz += nInput;
+    pWn += nInput;
+
+    // hidden state
+    for (k = 0; k + 3 < nHidden; k += 4) {
+        v4s x = *((v4s *)&pHidden[k]);
+        accR = __SUMDOTP4(x, *((v4s *)&pWr[k]), accR);
+        accZ = __SUMDOTP4(x, *((v4s *)&pWz[k]), accZ);
+        accNh = __SUMDOTP4(x, *((v4s *)&pWn[k]), accNh);
+    }
+    for (; k < nHidden; k++) {
+        accR = __MAC(accR, pHidden[k], pWr[k]);
+        accZ = __MAC(accZ, pHidden[k], pWz[k]);
+        accNh = __MAC(accNh, pHidden[k], pWn[k]);
+    }
+
+    int32_t r = plp_sigmoid_q12(plp_rnn_gate_q12(accR, shift));
+    int32_t z = plp_sigmoid_q12(plp_rnn_gate_q12(accZ, shift));
+    int32_t n = plp_rnn_gate_q12(accNh, shift);
+    n = plp_tanh_q12(plp_rnn_gate_q12(accNx, shift) + ((r * n + (1 << 14)) >> 15));
+
+    // h = (1 - z) * n + z * h = n + z * (h - n) in Q0.15
+    int32_t h = n + ((z * (pHidden[j] * 256 - n) + (1 << 14)) >> 15);
+    pHiddenOut[j] = (int8_t)__CLIP((h + (1 << 7)) >> 8, 7);
+}
+
+/**
+  @addtogroup RNNCellKernels
+  @{
+ */
+
+/**
+  @brief Parallel GRU cell of 8-bit fixed point vectors kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_gru_cell_instance_q8 struct initialized by
+                    plp_gru_cell_q8_parallel
+  @return     none
+
+  @par Every core computes a contiguous range of hidden units, as in plp_gru_cell_q8s_xpulpv2.
+ */
+
+void plp_gru_cell_q8p_xpulpv2(void *args) {
+
+    plp_gru_cell_instance_q8 *S = (plp_gru_cell_instance_q8 *)args;
+
+    int32_t shift = (int32_t)S->fracBits - 5; // from Q(fracBits + 7) to Q3.12
+    uint32_t start, end, j;
+
+    plp_team_chunk(S->nHidden, S->nPE, rt_core_id(), 1, &start, &end);
+
+    for (j = start; j < end; j++) {
+        plp_gru_cell_q8_unit(S->pInput, S->pHidden, S->pWeights, S->pBias, S->nInput, S->nHidden,
+                             shift, j, S->pHiddenOut);
+    }
+}
+
+/**
+  @} end of RNNCellKernels group
+ */
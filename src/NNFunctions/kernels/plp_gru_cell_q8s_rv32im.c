@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gru_cell_q8s_rv32im.c
+ * Description:  GRU cell of 8-bit fixed point vectors kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup RNNCell
+ */
+
+/**
+  @addtogroup RNNCellKernels
+  @{
+ */
+
+/**
+  @brief GRU cell of 8-bit fixed point vectors kernel for RV32IM extension.
+  @param[in]     pInput      points to the input vector, nInput values in Q0.7
+  @param[in]     pHidden     points to the hidden state of the previous step, in Q0.7
+  @param[in]     pWeights    points to the weights, 3 * nHidden x (nInput + nHidden)
+  @param[in]     pBias       points to the biases, 4 * nHidden values, or NULL
+  @param[in]     nInput      number of inputs
+  @param[in]     nHidden     number of hidden units
+  @param[in]     fracBits    number of fractional bits of the weights
+  @param[out]    pHiddenOut  points to the new hidden state, in Q0.7
+  @return        none
+ */
+
+void plp_gru_cell_q8s_rv32im(const int8_t *__restrict__ pInput,
+                             const int8_t *__restrict__ pHidden,
+                             const int8_t *__restrict__ pWeights,
+                             const int32_t *__restrict__ pBias,
+                             uint32_t nInput,
+                             uint32_t nHidden,
+                             uint32_t fracBits,
+                             int8_t *__restrict__ pHiddenOut) {
+
+    uint32_t nCols = nInput + nHidden;
+    int32_t shift = (int32_t)fracBits - 5; // from Q(fracBits + 7) to Q3.12
+    uint32_t j, g, k;
+
+    for (j = 0; j < nHidden; j++) {
+        int32_t sumX[3], sumH[3];
+
+        // products of the reset, update and new gate with the input and the hidden state
+        for (g = 0; g < 3; g++) {
+            const int8_t *pW = pWeights + (g * nHidden + j) * nCols;
+            sumX[g] = (pBias == NULL) ? 0 : pBias[g * nHidden + j];
+            sumH[g] = 0;
+            for (k = 0; k < nInput; k++) {
+                sumX[g] += pInput[k] * pW[k];
+            }
+            for (k = 0; k < nHidden; k++) {
+                sumH[g] += pHidden[k] * pW[nInput + k];
+            }
+        }
+        sumH[2] += (pBias == NULL) ? 0 : pBias[3 * nHidden + j];
+
+        int32_t r = plp_sigmoid_q12(plp_rnn_gate_q12(sumX[0] + sumH[0], shift));
+        int32_t z = plp_sigmoid_q12(plp_rnn_gate_q12(sumX[1] + sumH[1], shift));
+        int32_t n = plp_rnn_gate_q12(sumH[2], shift);
+        n = plp_tanh_q12(plp_rnn_gate_q12(sumX[2], shift) + ((r * n + (1 << 14)) >> 15));
+
+        // h = (1 - z) * n + z * h = n + z * (h - n) in Q0.15
+        int32_t h = n + ((z * (pHidden[j] * 256 - n) + (1 << 14)) >> 15);
+        h = (h + (1 << 7)) >> 8;
+        pHiddenOut[j] = (int8_t)((h > 127) ? 127 : h);
+    }
+}
+
+/**
+  @} end of RNNCellKernels group
+ */
@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lstm_cell_q8s_rv32im.c
+ * Description:  LSTM cell of 8-bit fixed point vectors kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup RNNCell
+ */
+
+/**
+  @addtogroup RNNCellKernels
+  @{
+ */
+
+/**
+  @brief LSTM cell of 8-bit fixed point vectors kernel for RV32IM extension.
+  @param[in]     pInput      points to the input vector, nInput values in Q0.7
+  @param[in]     pHidden     points to the hidden state of the previous step, in Q0.7
+  @param[in,out] pCell       points to the cell state in Q3.12, updated in place
+  @param[in]     pWeights    points to the weights, 4 * nHidden x (nInput + nHidden)
+  @param[in]     pBias       points to the biases, 4 * nHidden values, or NULL
+  @param[in]     nInput      number of inputs
+  @param[in]     nHidden     number of hidden units
+  @param[in]     fracBits    number of fractional bits of the weights
+  @param[out]    pHiddenOut  points to the new hidden state, in Q0.7
+  @return        none
+ */
+
+void plp_lstm_cell_q8s_rv32im(const int8_t *__restrict__ pInput,
+                              const int8_t *__restrict__ pHidden,
+                              int16_t *__restrict__ pCell,
+                              const int8_t *__restrict__ pWeights,
+                              const int32_t *__restrict__ pBias,
+                              uint32_t nInput,
+                              uint32_t nHidden,
+                              uint32_t fracBits,
+                              int8_t *__restrict__ pHiddenOut) {
+
+    uint32_t nCols = nInput + nHidden;
+    int32_t shift = (int32_t)fracBits - 5; // from Q(fracBits + 7) to Q3.12
+    uint32_t j, g, k;
+
+    for (j = 0; j < nHidden; j++) {
+        int32_t gate[4];
+
+        // pre-activations of the input, forget, cell and output gate
+        for (g = 0; g < 4; g++) {
+            const int8_t *pW = pWeights + (g * nHidden + j) * nCols;
+            int32_t sum = (pBias == NULL) ? 0 : pBias[g * nHidden + j];
+            for (k = 0; k < nInput; k++) {
+                sum += pInput[k] * pW[k];
+            }
+            for (k = 0; k < nHidden; k++) {
+                sum += pHidden[k] * pW[nInput + k];
+            }
+            gate[g] = plp_rnn_gate_q12(sum, shift);
+        }
+
+        int32_t i = plp_sigmoid_q12(gate[0]);
+        int32_t f = plp_sigmoid_q12(gate[1]);
+        int32_t u = plp_tanh_q12(gate[2]);
+        int32_t o = plp_sigmoid_q12(gate[3]);
+
+        // c = f * c + i * g in Q3.12, and h = o * tanh(c)
+        int32_t c = (f * pCell[j] + ((i * u) >> 3) + (1 << 14)) >> 15;
+        c = (c > 32767) ? 32767 : (c < -32768) ? -32768 : c;
+        pCell[j] = (int16_t)c;
+        pHiddenOut[j] = (int8_t)((o * plp_tanh_q12(c) + (1 << 22)) >> 23);
+    }
+}
+
+/**
+  @} end of RNNCellKernels group
+ */
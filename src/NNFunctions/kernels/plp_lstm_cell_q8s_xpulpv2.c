@@ -0,0 +1,155 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lstm_cell_q8s_xpulpv2.c
+ * Description:  LSTM cell of 8-bit fixed point vectors kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup RNNCell
+ */
+
+// Hidden unit j: the four gates are accumulated in a single pass over the input and the hidden
+// state, 4 values at a time with pv.sdotsp.b, followed by the activations and the update of the
+// cell state.
+static inline void plp_lstm_cell_q8_unit(const int8_t *__restrict__ pInput,
+                                         const int8_t *__restrict__ pHidden,
+                                         int16_t *__restrict__ pCell,
+                                         const int8_t *__restrict__ pWeights,
+                                         const int32_t *__restrict__ pBias,
+                                         uint32_t nInput,
+                                         uint32_t nHidden,
+                                         int32_t shift,
+                                         uint32_t j,
+                                         int8_t *__restrict__ pHiddenOut) {
+
+    uint32_t stride = (nInput + nHidden) * nHidden; // distance between the gates
+    const int8_t *pWi = pWeights + j * (nInput + nHidden);
+    const int8_t *pWf = pWi + stride;
+    const int8_t *pWg = pWf + stride;
+    const int8_t *pWo = pWg + stride;
+    int32_t accI = 0, accF = 0, accG = 0, accO = 0;
+    uint32_t k;
+
+    if (pBias != NULL) {
+        accI = pBias[j];
+        accF = pBias[nHidden + j];
+        accG = pBias[2 * nHidden + j];
+        accO = pBias[3 * nHidden + j];
+    }
+
+    // input
+    for (k = 0; k + 3 < nInput; k += 4) {
+        v4s x = *((v4s *)&pInput[k]);
+        accI = __SUMDOTP4(x, *((v4s *)&pWi[k]), accI);
+        accF = __SUMDOTP4(x, *((v4s *)&pWf[k]), accF);
+        accG = __SUMDOTP4(x, *((v4s *)&pWg[k]), accG);
+        accO = __SUMDOTP4(x, *((v4s *)&pWo[k]), accO);
+    }
+    for (; k < nInput; k++) {
+        accI = __MAC(accI, pInput[k], pWi[k]);
+        accF = __MAC(accF, pInput[k], pWf[k]);
+        accG = __MAC(accG, pInput[k], pWg[k]);
+        accO = __MAC(accO, pInput[k], pWo[k]);
+    }
+
+    pWi += nInput;
+    pWf += nInput;
+    pWg += nInput;
+    pWo += nInput;
+
+    // hidden state
+    for (k = 0; k + 3 < nHidden; k += 4) {
+        v4s x = *((v4s *)&pHidden[k]);
+        accI = __SUMDOTP4(x, *((v4s *)&pWi[k]), accI);
+        accF = __SUMDOTP4(x, *((v4s *)&pWf[k]), accF);
+        accG = __SUMDOTP4(x, *((v4s *)&pWg[k]), accG);
+        accO = __SUMDOTP4(x, *((v4s *)&pWo[k]), accO);
+    }
+    for (; k < nHidden; k++) {
+        accI = __MAC(accI, pHidden[k], pWi[k]);
+        accF = __MAC(accF, pHidden[k], pWf[k]);
+        accG = __MAC(accG, pHidden[k], pWg[k]);
+        accO = __MAC(accO, pHidden[k], pWo[k]);
+    }
+
+    int32_t i = plp_sigmoid_q12(plp_rnn_gate_q12(accI, shift));
+    int32_t f = plp_sigmoid_q12(plp_rnn_gate_q12(accF, shift));
+    int32_t u = plp_tanh_q12(plp_rnn_gate_q12(accG, shift));
+    int32_t o = plp_sigmoid_q12(plp_rnn_gate_q12(accO, shift));
+
+    // c = f * c + i * g in Q3.12, and h = o * tanh(c)
+    int32_t c = __CLIP((f * pCell[j] + ((i * u) >> 3) + (1 << 14)) >> 15, 15);
+    pCell[j] = (int16_t)c;
+    pHiddenOut[j] = (int8_t)((o * plp_tanh_q12(c) + (1 << 22)) >> 23);
+}
+
+/**
+  @addtogroup RNNCellKernels
+  @{
+ */
+
+/**
+  @brief LSTM cell of 8-bit fixed point vectors kernel for XPULPV2 extension.
+  @param[in]     pInput      points to the input vector, nInput values in Q0.7
+  @param[in]     pHidden     points to the hidden state of the previous step, in Q0.7
+  @param[in,out] pCell       points to the cell state in Q3.12, updated in place
+  @param[in]     pWeights    points to the weights, 4 * nHidden x (nInput + nHidden)
+  @param[in]     pBias       points to the biases, 4 * nHidden values, or NULL
+  @param[in]     nInput      number of inputs
+  @param[in]     nHidden     number of hidden units
+  @param[in]     fracBits    number of fractional bits of the weights
+  @param[out]    pHiddenOut  points to the new hidden state, in Q0.7
+  @return        none
+
+  @par Exploiting SIMD instructions
+  The four gates of a hidden unit are accumulated together, 4 values at a time with
+  pv.sdotsp.b, such that the input and the hidden state are loaded only once for all gates. The
+  activations and the update of the state follow right away, without storing the gates.
+ */
+
+void plp_lstm_cell_q8s_xpulpv2(const int8_t *__restrict__ pInput,
+                               const int8_t *__restrict__ pHidden,
+                               int16_t *__restrict__ pCell,
+                               const int8_t *__restrict__ pWeights,
+                               const int32_t *__restrict__ pBias,
+                               uint32_t nInput,
+                               uint32_t nHidden,
+                               uint32_t fracBits,
+                               int8_t *__restrict__ pHiddenOut) {
+
+    int32_t shift = (int32_t)fracBits - 5; // from Q(fracBits + 7) to Q3.12
+    uint32_t j;
+
+    for (j = 0; j < nHidden; j++) {
+        plp_lstm_cell_q8_unit(pInput, pHidden, pCell, pWeights, pBias, nInput, nHidden, shift, j,
+                              pHiddenOut);
+    }
+}
+
+/**
+  @} end of RNNCellKernels group
+ */
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_maxpool2d_f32s_xpulpv2.c
+ * Description:  2D max pooling of 32-bit float images for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MaxPool2d
+ */
+
+/**
+  @addtogroup MaxPool2dKernels
+  @{
+ */
+
+/**
+  @brief 2D max pooling of 32-bit float images kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input image, srcRows x srcCols
+  @param[in]  srcRows    number of rows of the input image
+  @param[in]  srcCols    number of columns of the input image
+  @param[in]  poolRows   number of rows of the pooling window
+  @param[in]  poolCols   number of columns of the pooling window
+  @param[in]  stride     distance between two windows, in rows and columns
+  @param[out] pDst       output image returned here, ((srcRows - poolRows) / stride + 1) x
+                         ((srcCols - poolCols) / stride + 1)
+  @return     none
+ */
+
+void plp_maxpool2d_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                uint32_t srcRows,
+                                uint32_t srcCols,
+                                uint32_t poolRows,
+                                uint32_t poolCols,
+                                uint32_t stride,
+                                float32_t *__restrict__ pDst) {
+
+    uint32_t outRows = (srcRows - poolRows) / stride + 1;
+    uint32_t outCols = (srcCols - poolCols) / stride + 1;
+    uint32_t i, j, r, c;
+
+    for (i = 0; i < outRows; i++) {
+        for (j = 0; j < outCols; j++) {
+            const float32_t *pIn = pSrc + i * stride * srcCols + j * stride;
+            float32_t max = pIn[0];
+            for (r = 0; r < poolRows; r++) {
+                for (c = 0; c < poolCols; c++) {
+                    float32_t x = pIn[r * srcCols + c];
+                    max = (x > max) ? x : max;
+                }
+            }
+            pDst[i * outCols + j] = max;
+        }
+    }
+}
+
+/**
+  @} end of MaxPool2dKernels group
+ */
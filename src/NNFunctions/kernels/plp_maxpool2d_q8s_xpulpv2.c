@@ -0,0 +1,137 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_maxpool2d_q8s_xpulpv2.c
+ * Description:  2D max pooling of 8-bit fixed point images for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+  @ingroup MaxPool2d
+ */
+
+/**
+  @addtogroup MaxPool2dKernels
+  @{
+ */
+
+// maximum of every output window in the buffered column maxima pBuf
+static inline void plp_maxpool2d_q8_windows(const int8_t *pBuf,
+                                            uint32_t poolCols,
+                                            uint32_t stride,
+                                            uint32_t n,
+                                            int8_t *pOut) {
+
+    uint32_t k, c;
+
+    for (k = 0; k < n; k++) {
+        const int8_t *pB = pBuf + k * stride;
+        int8_t max = pB[0];
+        for (c = 1; c < poolCols; c++) {
+            max = (pB[c] > max) ? pB[c] : max;
+        }
+        pOut[k] = max;
+    }
+}
+
+/**
+  @brief 2D max pooling of 8-bit fixed point images kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input image, srcRows x srcCols
+  @param[in]  srcRows    number of rows of the input image
+  @param[in]  srcCols    number of columns of the input image
+  @param[in]  poolRows   number of rows of the pooling window
+  @param[in]  poolCols   number of columns of the pooling window
+  @param[in]  stride     distance between two windows, in rows and columns
+  @param[out] pDst       output image returned here, ((srcRows - poolRows) / stride + 1) x
+                         ((srcCols - poolCols) / stride + 1)
+  @return     none
+
+  @par The pooling is split into a vertical and a horizontal pass. For every output row, the
+  maximum over the poolRows input rows is computed for 4 columns at once with pv.max, and
+  buffered on the stack for up to PLP_MAXPOOL2D_BUFFER_COLS columns. The maximum of each window is
+  then computed from the buffer. Windows wider than the buffer are pooled directly. The rows of
+  the image need not be aligned to 32 bit, the core splits the misaligned loads.
+ */
+
+void plp_maxpool2d_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                               uint32_t srcRows,
+                               uint32_t srcCols,
+                               uint32_t poolRows,
+                               uint32_t poolCols,
+                               uint32_t stride,
+                               int8_t *__restrict__ pDst) {
+
+    uint32_t outRows = (srcRows - poolRows) / stride + 1;
+    uint32_t outCols = (srcCols - poolCols) / stride + 1;
+    uint32_t i, j, r, c;
+
+    v4s buffer[PLP_MAXPOOL2D_BUFFER_COLS / 4];
+    int8_t *pBuf = (int8_t *)buffer;
+
+    if (poolCols > PLP_MAXPOOL2D_BUFFER_COLS) {
+        plp_maxpool2d_q8s_rv32im(pSrc, srcRows, srcCols, poolRows, poolCols, stride, pDst);
+        return;
+    }
+
+    // number of output windows, whose input columns fit into the buffer
+    uint32_t chunk = (PLP_MAXPOOL2D_BUFFER_COLS - poolCols) / stride + 1;
+
+    for (i = 0; i < outRows; i++) {
+        const int8_t *pRow = pSrc + i * stride * srcCols;
+        int8_t *pOut = pDst + i * outCols;
+
+        for (j = 0; j < outCols; j += chunk) {
+            uint32_t n = MIN(chunk, outCols - j);
+            uint32_t width = (n - 1) * stride + poolCols;
+            const int8_t *pIn = pRow + j * stride;
+
+            // maximum over the rows of the windows
+            for (c = 0; c + 3 < width; c += 4) {
+                v4s max = *((v4s *)&pIn[c]);
+                for (r = 1; r < poolRows; r++) {
+                    max = __MAX4(max, *((v4s *)&pIn[r * srcCols + c]));
+                }
+                buffer[c / 4] = max;
+            }
+            for (; c < width; c++) {
+                int8_t max = pIn[c];
+                for (r = 1; r < poolRows; r++) {
+                    int8_t x = pIn[r * srcCols + c];
+                    max = (x > max) ? x : max;
+                }
+                pBuf[c] = max;
+            }
+
+            // maximum over the columns of the windows
+            plp_maxpool2d_q8_windows(pBuf, poolCols, stride, n, pOut + j);
+        }
+    }
+}
+
+/**
+  @} end of MaxPool2dKernels group
+ */
@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_relu_q16s_xpulpv2.c
+ * Description:  ReLU of a 16-bit fixed point vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Relu
+ */
+
+/**
+  @addtogroup ReluKernels
+  @{
+ */
+
+/**
+  @brief ReLU of a 16-bit fixed point vector kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @return     none
+
+  @par The maximum with zero is computed for 2 samples at once with the SIMD instruction pv.max.
+  The vectors must be aligned to 32 bit.
+ */
+
+void plp_relu_q16s_xpulpv2(const int16_t *pSrc,
+                           uint32_t blockSize,
+                           int16_t *pDst) {
+
+    uint32_t i; // loop counter
+    v2s zero = __PACK2(0, 0);
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        *((v2s *)&pDst[i]) = __MAX2(*((v2s *)&pSrc[i]), zero);
+    }
+
+    // leftover samples
+    for (; i < blockSize; i++) {
+        pDst[i] = (pSrc[i] > 0) ? pSrc[i] : 0;
+    }
+}
+
+/**
+  @} end of ReluKernels group
+ */
@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_relu_q8p_xpulpv2.c
+ * Description:  Parallel ReLU of an 8-bit fixed point vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Relu
+ */
+
+/**
+  @addtogroup ReluKernels
+  @{
+ */
+
+/**
+  @brief Parallel ReLU of an 8-bit fixed point vector kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_relu_instance_q8 struct initialized by
+                    plp_relu_q8_parallel
+  @return     none
+
+  @par Every core computes a contiguous chunk of the vector with plp_relu_q8s_xpulpv2. The size of
+  each chunk is a multiple of 4, such that every chunk starts word aligned.
+ */
+
+void plp_relu_q8p_xpulpv2(void *args) {
+
+    plp_relu_instance_q8 *S = (plp_relu_instance_q8 *)args;
+
+    uint32_t start, end;
+    plp_team_chunk(S->blockSize, S->nPE, rt_core_id(), 4, &start, &end);
+
+    if (start < end) {
+        plp_relu_q8s_xpulpv2(S->pSrc + start, end - start, S->pDst + start);
+    }
+}
+
+/**
+  @} end of ReluKernels group
+ */
@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_relu_q8s_rv32im.c
+ * Description:  ReLU of an 8-bit fixed point vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Relu
+ */
+
+/**
+  @defgroup ReluKernels ReLU Kernels
+  This module contains the kernel codes of the rectified linear unit.
+ */
+
+/**
+  @addtogroup ReluKernels
+  @{
+ */
+
+/**
+  @brief ReLU of an 8-bit fixed point vector kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @return     none
+ */
+
+void plp_relu_q8s_rv32im(const int8_t *pSrc,
+                         uint32_t blockSize,
+                         int8_t *pDst) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = (pSrc[i] > 0) ? pSrc[i] : 0;
+    }
+}
+
+/**
+  @} end of ReluKernels group
+ */
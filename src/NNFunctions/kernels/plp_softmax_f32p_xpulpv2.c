@@ -0,0 +1,126 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_softmax_f32p_xpulpv2.c
+ * Description:  Parallel softmax of a 32-bit float vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Softmax
+ */
+
+// maximum of the samples
+static inline float32_t plp_softmax_f32_max(const float32_t *pSrc, uint32_t n) {
+
+    float32_t max = -INFINITY;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        max = (pSrc[i] > max) ? pSrc[i] : max;
+    }
+
+    return max;
+}
+
+// Exponentials of the differences to the maximum written to pDst, and their sum. The differences
+// are computed in chunks of PLP_SOFTMAX_BUFFER_SIZE samples.
+static inline float32_t plp_softmax_f32_exp(const float32_t *pSrc,
+                                            uint32_t n,
+                                            float32_t max,
+                                            float32_t *pDst) {
+
+    float32_t diff[PLP_SOFTMAX_BUFFER_SIZE];
+    float32_t sum = 0.0f;
+    uint32_t i, k, m;
+
+    for (i = 0; i < n; i += m) {
+        m = (n - i < PLP_SOFTMAX_BUFFER_SIZE) ? n - i : PLP_SOFTMAX_BUFFER_SIZE;
+
+        for (k = 0; k < m; k++) {
+            diff[k] = pSrc[i + k] - max;
+        }
+        plp_exp_vec_f32s_xpulpv2(diff, m, pDst + i);
+
+        for (k = 0; k < m; k++) {
+            sum += pDst[i + k];
+        }
+    }
+
+    return sum;
+}
+
+/**
+  @addtogroup SoftmaxKernels
+  @{
+ */
+
+/**
+  @brief Parallel softmax of a 32-bit float vector kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_softmax_instance_f32 struct initialized by
+                    plp_softmax_f32_parallel
+  @return     none
+
+  @par Every core computes the maximum and the sum of the exponentials of a contiguous chunk of the
+  vector, which are combined by every core after a barrier.
+ */
+
+void plp_softmax_f32p_xpulpv2(void *args) {
+
+    plp_softmax_instance_f32 *S = (plp_softmax_instance_f32 *)args;
+
+    uint32_t nPE = S->nPE;
+    uint32_t coreId = rt_core_id();
+    uint32_t start, end, i, k;
+    float32_t max, sum;
+
+    plp_team_chunk(S->blockSize, nPE, coreId, 1, &start, &end);
+
+    S->pPart[coreId] = plp_softmax_f32_max(S->pSrc + start, end - start);
+    plp_team_barrier();
+
+    max = S->pPart[0];
+    for (k = 1; k < nPE; k++) {
+        max = (S->pPart[k] > max) ? S->pPart[k] : max;
+    }
+
+    S->pPart[nPE + coreId] =
+        plp_softmax_f32_exp(S->pSrc + start, end - start, max, S->pDst + start);
+    plp_team_barrier();
+
+    sum = 0.0f;
+    for (k = 0; k < nPE; k++) {
+        sum += S->pPart[nPE + k];
+    }
+
+    float32_t scale = 1.0f / sum;
+    for (i = start; i < end; i++) {
+        S->pDst[i] *= scale;
+    }
+}
+
+/**
+  @} end of SoftmaxKernels group
+ */
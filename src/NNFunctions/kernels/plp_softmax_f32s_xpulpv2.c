@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_softmax_f32s_xpulpv2.c
+ * Description:  Softmax of a 32-bit float vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Softmax
+ */
+
+// maximum of the samples
+static inline float32_t plp_softmax_f32_max(const float32_t *pSrc, uint32_t n) {
+
+    float32_t max = -INFINITY;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        max = (pSrc[i] > max) ? pSrc[i] : max;
+    }
+
+    return max;
+}
+
+// Exponentials of the differences to the maximum written to pDst, and their sum. The differences
+// are computed in chunks of PLP_SOFTMAX_BUFFER_SIZE samples.
+static inline float32_t plp_softmax_f32_exp(const float32_t *pSrc,
+                                            uint32_t n,
+                                            float32_t max,
+                                            float32_t *pDst) {
+
+    float32_t diff[PLP_SOFTMAX_BUFFER_SIZE];
+    float32_t sum = 0.0f;
+    uint32_t i, k, m;
+
+    for (i = 0; i < n; i += m) {
+        m = (n - i < PLP_SOFTMAX_BUFFER_SIZE) ? n - i : PLP_SOFTMAX_BUFFER_SIZE;
+
+        for (k = 0; k < m; k++) {
+            diff[k] = pSrc[i + k] - max;
+        }
+        plp_exp_vec_f32s_xpulpv2(diff, m, pDst + i);
+
+        for (k = 0; k < m; k++) {
+            sum += pDst[i + k];
+        }
+    }
+
+    return sum;
+}
+
+/**
+  @addtogroup SoftmaxKernels
+  @{
+ */
+
+/**
+  @brief Softmax of a 32-bit float vector kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector
+  @return     none
+
+  @par The exponentials are computed with plp_exp_vec_f32s_xpulpv2 into the output vector, which
+  is then scaled by the reciprocal of their sum.
+ */
+
+void plp_softmax_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              float32_t *__restrict__ pDst) {
+
+    uint32_t i; // loop counter
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    float32_t max = plp_softmax_f32_max(pSrc, blockSize);
+    float32_t scale = 1.0f / plp_softmax_f32_exp(pSrc, blockSize, max, pDst);
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] *= scale;
+    }
+}
+
+/**
+  @} end of SoftmaxKernels group
+ */
@@ -0,0 +1,150 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_softmax_q8s_xpulpv2.c
+ * Description:  Softmax of an 8-bit fixed point vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Softmax
+ */
+
+// difference of x to the maximum in Q3.12, saturated to -8.0
+static inline int16_t plp_softmax_q8_diff(int32_t x, int32_t max, uint32_t fracBits) {
+    int32_t d = (x - max) * (1 << (12 - fracBits));
+    return (int16_t)((d < -32768) ? -32768 : d);
+}
+
+// exponential e in Q3.12 times recip = 2^30 / sum, rounded to Q0.7 and saturated
+static inline int8_t plp_softmax_q8_scale(int32_t e, uint32_t recip) {
+    int32_t y = (int32_t)(((uint32_t)e * recip + (1 << 22)) >> 23);
+    return (int8_t)((y > 127) ? 127 : y);
+}
+
+// maximum of the samples
+static inline int32_t plp_softmax_q8_max(const int8_t *pSrc, uint32_t n) {
+
+    v4s vMax = __PACK4(-128, -128, -128, -128);
+    int32_t max;
+    uint32_t i;
+
+    for (i = 0; i + 3 < n; i += 4) {
+        vMax = __MAX4(vMax, *((v4s *)&pSrc[i]));
+    }
+    max = (vMax[0] > vMax[1]) ? vMax[0] : vMax[1];
+    max = (vMax[2] > max) ? vMax[2] : max;
+    max = (vMax[3] > max) ? vMax[3] : max;
+
+    // leftover samples
+    for (; i < n; i++) {
+        max = (pSrc[i] > max) ? pSrc[i] : max;
+    }
+
+    return max;
+}
+
+// Sum of the exponentials in Q3.12 if pDst is NULL, otherwise the probabilities with recip are
+// written to pDst. The exponentials are computed in chunks of PLP_SOFTMAX_BUFFER_SIZE samples.
+static inline int32_t plp_softmax_q8_exp(const int8_t *pSrc,
+                                         uint32_t n,
+                                         int32_t max,
+                                         uint32_t fracBits,
+                                         uint32_t recip,
+                                         int8_t *pDst) {
+
+    v2s bufX[PLP_SOFTMAX_BUFFER_SIZE / 2];
+    v2s bufE[PLP_SOFTMAX_BUFFER_SIZE / 2];
+    int16_t *pX = (int16_t *)bufX;
+    int16_t *pE = (int16_t *)bufE;
+    int32_t sum = 0;
+    uint32_t i, k, m;
+
+    for (i = 0; i < n; i += m) {
+        m = (n - i < PLP_SOFTMAX_BUFFER_SIZE) ? n - i : PLP_SOFTMAX_BUFFER_SIZE;
+
+        for (k = 0; k < m; k++) {
+            pX[k] = plp_softmax_q8_diff(pSrc[i + k], max, fracBits);
+        }
+        plp_exp_vec_q16s_xpulpv2(pX, m, 12, pE);
+
+        if (pDst == NULL) {
+            for (k = 0; k < m; k++) {
+                sum += pE[k];
+            }
+        } else {
+            for (k = 0; k + 3 < m; k += 4) {
+                *((v4s *)&pDst[i + k]) = __PACK4(plp_softmax_q8_scale(pE[k], recip),
+                                                 plp_softmax_q8_scale(pE[k + 1], recip),
+                                                 plp_softmax_q8_scale(pE[k + 2], recip),
+                                                 plp_softmax_q8_scale(pE[k + 3], recip));
+            }
+            for (; k < m; k++) {
+                pDst[i + k] = plp_softmax_q8_scale(pE[k], recip);
+            }
+        }
+    }
+
+    return sum;
+}
+
+/**
+  @addtogroup SoftmaxKernels
+  @{
+ */
+
+/**
+  @brief Softmax of an 8-bit fixed point vector kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  fracBits   number of fractional bits of the input, at most 7
+  @param[out] pDst       points to the output vector, in Q0.7
+  @return     none
+
+  @par The maximum is computed 4 samples at a time with pv.max, and the exponentials with
+  plp_exp_vec_q16s_xpulpv2. The vectors must be aligned to 32 bit.
+ */
+
+void plp_softmax_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t fracBits,
+                             int8_t *__restrict__ pDst) {
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    int32_t max = plp_softmax_q8_max(pSrc, blockSize);
+    int32_t sum = plp_softmax_q8_exp(pSrc, blockSize, max, fracBits, 0, NULL);
+
+    // the largest sample contributes exp(0) = 1.0, thus sum >= 2^12
+    uint32_t recip = (1u << 30) / (uint32_t)sum;
+
+    plp_softmax_q8_exp(pSrc, blockSize, max, fracBits, recip, pDst);
+}
+
+/**
+  @} end of SoftmaxKernels group
+ */
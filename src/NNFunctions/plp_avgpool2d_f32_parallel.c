@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_avgpool2d_f32_parallel.c
+ * Description:  Glue code for parallel 2D average pooling of 32-bit float images
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupNN
+ */
+
+/**
+  @addtogroup AvgPool2d
+  @{
+ */
+
+/**
+  @brief Glue code for parallel 2D average pooling of 32-bit float images.
+  @param[in]  pSrc       points to the input image, srcRows x srcCols
+  @param[in]  srcRows    number of rows of the input image
+  @param[in]  srcCols    number of columns of the input image
+  @param[in]  nChannels  number of channels, stored one after the other
+  @param[in]  poolRows   number of rows of the pooling window
+  @param[in]  poolCols   number of columns of the pooling window
+  @param[in]  stride     distance between two windows, in rows and columns
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       output image returned here, ((srcRows - poolRows) / stride + 1) x
+                         ((srcCols - poolCols) / stride + 1) per channel
+  @return     none
+ */
+
+void plp_avgpool2d_f32_parallel(const float32_t *__restrict__ pSrc,
+                                uint32_t srcRows,
+                                uint32_t srcCols,
+                                uint32_t nChannels,
+                                uint32_t poolRows,
+                                uint32_t poolCols,
+                                uint32_t stride,
+                                uint32_t nPE,
+                                float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    if (srcRows < poolRows || srcCols < poolCols || stride == 0) {
+        return;
+    }
+
+    plp_pool2d_instance_f32 S = { .pSrc = pSrc,
+                                 .srcRows = srcRows,
+                                 .srcCols = srcCols,
+                                 .nChannels = nChannels,
+                                 .poolRows = poolRows,
+                                 .poolCols = poolCols,
+                                 .stride = stride,
+                                 .nPE = nPE,
+                                 .pDst = pDst };
+
+    rt_team_fork(nPE, plp_avgpool2d_f32p_xpulpv2, (void *)&S);
+}
+
+/**
+  @} end of AvgPool2d group
+ */
@@ -0,0 +1,116 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_depthwise_q8.c
+ * Description:  Depthwise convolution of 8-bit fixed point images glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupNN
+ */
+
+/**
+  @defgroup ConvDepthwise Depthwise Convolution
+  This module contains the glue code for the depthwise convolution of CNN layers (e.g. the 3x3
+  convolutions of MobileNet blocks), in which every channel of the image is convolved with its own
+  kernel. As in the layers of a CNN, the kernel is not flipped, and only windows which lie
+  completely inside the image are computed (no padding), thus the output has the size
+  ((srcRows - kRows) / stride + 1) x ((srcCols - kCols) / stride + 1). Images with several channels
+  are stored channel after channel (CHW).
+
+  The bias, the requantization and the ReLU are fused into the convolution:
+  pDst[ch][i][j] = clip((pBias[ch] + sum over r, c of pSrc[ch][i * stride + r][j * stride + c] *
+  pKernel[ch][r][c]) * 2^-shift), where the shift is rounded to the nearest, and clip saturates to
+  [-128, 127], or to [0, 127] if relu is set. The kernel codes are in the module Depthwise
+  Convolution Kernels.
+ */
+
+/**
+  @addtogroup ConvDepthwise
+  @{
+ */
+
+/**
+  @brief Glue code for depthwise convolution of 8-bit fixed point images.
+  @param[in]  pSrc       points to the input image, srcRows x srcCols per channel
+  @param[in]  srcRows    number of rows of the input image
+  @param[in]  srcCols    number of columns of the input image
+  @param[in]  nChannels  number of channels, stored one after the other
+  @param[in]  pKernel    points to the kernels, kRows x kCols per channel
+  @param[in]  kRows      number of rows of the kernel
+  @param[in]  kCols      number of columns of the kernel
+  @param[in]  stride     distance between two windows, in rows and columns
+  @param[in]  pBias      points to the bias of every channel, or NULL for no bias
+  @param[in]  shift      right shift of the accumulator, to requantize the output
+  @param[in]  relu       if not zero, negative outputs are set to zero
+  @param[out] pDst       output image returned here, ((srcRows - kRows) / stride + 1) x
+                         ((srcCols - kCols) / stride + 1) per channel
+  @return     none
+ */
+
+void plp_conv_depthwise_q8(const int8_t *__restrict__ pSrc,
+                           uint32_t srcRows,
+                           uint32_t srcCols,
+                           uint32_t nChannels,
+                           const int8_t *__restrict__ pKernel,
+                           uint32_t kRows,
+                           uint32_t kCols,
+                           uint32_t stride,
+                           const int32_t *__restrict__ pBias,
+                           uint32_t shift,
+                           uint8_t relu,
+                           int8_t *__restrict__ pDst) {
+
+    if (srcRows < kRows || srcCols < kCols || stride == 0) {
+        return;
+    }
+
+    // samples per input channel, output channel and kernel
+    uint32_t srcSize = srcRows * srcCols;
+    uint32_t dstSize = ((srcRows - kRows) / stride + 1) * ((srcCols - kCols) / stride + 1);
+    uint32_t kSize = kRows * kCols;
+    uint32_t ch;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        for (ch = 0; ch < nChannels; ch++) {
+            plp_conv_depthwise_q8s_rv32im(pSrc + ch * srcSize, srcRows, srcCols,
+                                          pKernel + ch * kSize, kRows, kCols, stride,
+                                          (pBias == NULL) ? 0 : pBias[ch], shift, relu,
+                                          pDst + ch * dstSize);
+        }
+    } else {
+        for (ch = 0; ch < nChannels; ch++) {
+            plp_conv_depthwise_q8s_xpulpv2(pSrc + ch * srcSize, srcRows, srcCols,
+                                           pKernel + ch * kSize, kRows, kCols, stride,
+                                           (pBias == NULL) ? 0 : pBias[ch], shift, relu,
+                                           pDst + ch * dstSize);
+        }
+    }
+}
+
+/**
+  @} end of ConvDepthwise group
+ */
@@ -0,0 +1,214 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_depthwise_q8_l2.c
+ * Description:  Parallel depthwise convolution of 8-bit fixed point images in L2 glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+  @ingroup groupNN
+ */
+
+/**
+  @addtogroup ConvDepthwise
+  @{
+ */
+
+/**
+  @brief Glue code for parallel depthwise convolution of 8-bit fixed point images in L2.
+  @param[in]  pSrc       points to the input image in L2, srcRows x srcCols per channel
+  @param[in]  srcRows    number of rows of the input image
+  @param[in]  srcCols    number of columns of the input image
+  @param[in]  nChannels  number of channels, stored one after the other
+  @param[in]  pKernel    points to the kernels in L2, kRows x kCols per channel
+  @param[in]  kRows      number of rows of the kernel
+  @param[in]  kCols      number of columns of the kernel
+  @param[in]  stride     distance between two windows, in rows and columns
+  @param[in]  pBias      points to the bias of every channel in L2, or NULL for no bias
+  @param[in]  shift      right shift of the accumulator, to requantize the output
+  @param[in]  relu       if not zero, negative outputs are set to zero
+  @param[in]  nPE        number of cores to compute on
+  @param[out] pDst       output image in L2 returned here, ((srcRows - kRows) / stride + 1) x
+                         ((srcCols - kCols) / stride + 1) per channel
+  @return     none
+
+  @par
+  The image is streamed through L1 in tiles: if a whole channel fits, a tile holds as many
+  channels as fit, otherwise a band of output rows of a single channel. For every tile, the
+  cluster DMA copies the kernels, the biases and the input rows of the tile into L1, the tile is
+  computed with plp_conv_depthwise_q8_parallel, and the output is copied back to L2. The buffers
+  are double buffered, such that the DMA copies the next tile and writes back the previous one
+  while the cores compute. The L1 buffer of PLP_DMA_STREAM_BUFFER_BYTES bytes is taken with
+  plp_scratch_alloc.
+ */
+
+void plp_conv_depthwise_q8_l2(const int8_t *__restrict__ pSrc,
+                              uint32_t srcRows,
+                              uint32_t srcCols,
+                              uint32_t nChannels,
+                              const int8_t *__restrict__ pKernel,
+                              uint32_t kRows,
+                              uint32_t kCols,
+                              uint32_t stride,
+                              const int32_t *__restrict__ pBias,
+                              uint32_t shift,
+                              uint8_t relu,
+                              uint32_t nPE,
+                              int8_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        if (srcRows < kRows || srcCols < kCols || stride == 0 || nChannels == 0) {
+            return;
+        }
+
+        uint32_t outRows = (srcRows - kRows) / stride + 1;
+        uint32_t outCols = (srcCols - kCols) / stride + 1;
+        uint32_t kSize = kRows * kCols;
+        uint32_t srcSize = srcRows * srcCols;
+        uint32_t dstSize = outRows * outCols;
+
+        // every part of a tile is word aligned, which costs at most 3 bytes for each of the
+        // kernels, the input and the output
+        int32_t budget = PLP_DMA_STREAM_BUFFER_BYTES / 2 - 9;
+        int32_t chBytes = kSize + sizeof(int32_t) + srcSize + dstSize;
+        uint32_t chPerTile = 1;
+        uint32_t bandRows = outRows;
+
+        if (budget >= chBytes) {
+            chPerTile = MIN(budget / chBytes, nChannels);
+        } else {
+            // the input of a band of n rows has (n - 1) * stride + kRows rows
+            int32_t rows = (budget - (int32_t)(kSize + sizeof(int32_t) + kRows * srcCols)) /
+                (int32_t)(stride * srcCols + outCols);
+            if (rows <= 0) {
+                printf("Error: insufficient L1 memory!\n");
+                return;
+            }
+            bandRows = rows;
+        }
+
+        uint8_t *pBuf = (uint8_t *)plp_scratch_alloc(PLP_DMA_STREAM_BUFFER_BYTES);
+
+        if (pBuf == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+
+        uint32_t kBytes = (chPerTile * kSize + 3) & ~3;
+        uint32_t biasBytes = chPerTile * sizeof(int32_t);
+        uint32_t inBytes = (chPerTile == 1) ? ((bandRows - 1) * stride + kRows) * srcCols
+                                            : chPerTile * srcSize;
+        uint32_t outBytes = (chPerTile == 1) ? bandRows * outCols : chPerTile * dstSize;
+        inBytes = (inBytes + 3) & ~3;
+        uint32_t tileBytes = kBytes + biasBytes + inBytes + ((outBytes + 3) & ~3);
+
+        uint32_t nBands = (outRows + bandRows - 1) / bandRows;
+        uint32_t nTasks = ((nChannels + chPerTile - 1) / chPerTile) * nBands;
+        uint32_t t;
+
+        int8_t *pK[2];
+        int32_t *pB[2];
+        int8_t *pIn[2];
+        int8_t *pOut[2];
+        rt_dma_copy_t copyK[2], copyB[2], copyIn[2], copyOut[2];
+
+        for (t = 0; t < 2; t++) {
+            pK[t] = (int8_t *)(pBuf + t * tileBytes);
+            pB[t] = (int32_t *)(pBuf + t * tileBytes + kBytes);
+            pIn[t] = (int8_t *)(pBuf + t * tileBytes + kBytes + biasBytes);
+            pOut[t] = (int8_t *)(pBuf + t * tileBytes + kBytes + biasBytes + inBytes);
+        }
+
+        for (t = 0; t <= nTasks; t++) {
+            uint32_t b = t & 1;
+
+            // start the copies of the next tile into the other buffer
+            if (t < nTasks) {
+                uint32_t ch = (t / nBands) * chPerTile;
+                uint32_t nCh = MIN(chPerTile, nChannels - ch);
+                uint32_t row = (t % nBands) * bandRows;
+                uint32_t rows = MIN(bandRows, outRows - row);
+                uint32_t inRows = (rows - 1) * stride + kRows;
+
+                plp_copy_dma(pKernel + ch * kSize, pK[b], nCh * kSize, RT_DMA_DIR_EXT2LOC,
+                             &copyK[b]);
+                if (pBias != NULL) {
+                    plp_copy_dma(pBias + ch, pB[b], nCh * sizeof(int32_t), RT_DMA_DIR_EXT2LOC,
+                                 &copyB[b]);
+                }
+                plp_copy_dma(pSrc + ch * srcSize + row * stride * srcCols, pIn[b],
+                             (nCh - 1) * srcSize + inRows * srcCols, RT_DMA_DIR_EXT2LOC,
+                             &copyIn[b]);
+            }
+
+            // compute the current tile, and write it back
+            if (t > 0) {
+                uint32_t p = b ^ 1;
+                uint32_t ch = ((t - 1) / nBands) * chPerTile;
+                uint32_t nCh = MIN(chPerTile, nChannels - ch);
+                uint32_t row = ((t - 1) % nBands) * bandRows;
+                uint32_t rows = MIN(bandRows, outRows - row);
+                uint32_t inRows = (rows - 1) * stride + kRows;
+
+                plp_copy_dma_wait(&copyK[p]);
+                if (pBias != NULL) {
+                    plp_copy_dma_wait(&copyB[p]);
+                }
+                plp_copy_dma_wait(&copyIn[p]);
+                if (t > 2) {
+                    plp_copy_dma_wait(&copyOut[p]); // write-back of the tile before the last
+                }
+
+                // the channels of a tile with several channels are complete
+                plp_conv_depthwise_q8_parallel(pIn[p], (nCh == 1) ? inRows : srcRows, srcCols,
+                                               nCh, pK[p], kRows, kCols, stride,
+                                               (pBias == NULL) ? NULL : pB[p], shift, relu, nPE,
+                                               pOut[p]);
+
+                plp_copy_dma(pOut[p], pDst + ch * dstSize + row * outCols, nCh * rows * outCols,
+                             RT_DMA_DIR_LOC2EXT, &copyOut[p]);
+            }
+        }
+
+        // wait for the write-backs of the last two tiles
+        plp_copy_dma_wait(&copyOut[(nTasks - 1) & 1]);
+        if (nTasks > 1) {
+            plp_copy_dma_wait(&copyOut[nTasks & 1]);
+        }
+
+        plp_scratch_free(pBuf, PLP_DMA_STREAM_BUFFER_BYTES);
+    }
+}
+
+/**
+  @} end of ConvDepthwise group
+ */
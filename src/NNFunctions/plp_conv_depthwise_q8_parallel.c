@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_depthwise_q8_parallel.c
+ * Description:  Parallel depthwise convolution of 8-bit fixed point images glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupNN
+ */
+
+/**
+  @addtogroup ConvDepthwise
+  @{
+ */
+
+/**
+  @brief Glue code for parallel depthwise convolution of 8-bit fixed point images.
+  @param[in]  pSrc       points to the input image, srcRows x srcCols per channel
+  @param[in]  srcRows    number of rows of the input image
+  @param[in]  srcCols    number of columns of the input image
+  @param[in]  nChannels  number of channels, stored one after the other
+  @param[in]  pKernel    points to the kernels, kRows x kCols per channel
+  @param[in]  kRows      number of rows of the kernel
+  @param[in]  kCols      number of columns of the kernel
+  @param[in]  stride     distance between two windows, in rows and columns
+  @param[in]  pBias      points to the bias of every channel, or NULL for no bias
+  @param[in]  shift      right shift of the accumulator, to requantize the output
+  @param[in]  relu       if not zero, negative outputs are set to zero
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       output image returned here, ((srcRows - kRows) / stride + 1) x
+                         ((srcCols - kCols) / stride + 1) per channel
+  @return     none
+
+  @par The output rows of all channels are split into nPE contiguous ranges, one per core. With
+  at least as many channels as cores, every core thus computes whole channels, otherwise the rows
+  of a channel are shared among the cores.
+ */
+
+void plp_conv_depthwise_q8_parallel(const int8_t *__restrict__ pSrc,
+                                    uint32_t srcRows,
+                                    uint32_t srcCols,
+                                    uint32_t nChannels,
+                                    const int8_t *__restrict__ pKernel,
+                                    uint32_t kRows,
+                                    uint32_t kCols,
+                                    uint32_t stride,
+                                    const int32_t *__restrict__ pBias,
+                                    uint32_t shift,
+                                    uint8_t relu,
+                                    uint32_t nPE,
+                                    int8_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    if (srcRows < kRows || srcCols < kCols || stride == 0) {
+        return;
+    }
+
+    plp_conv_depthwise_instance_q8 S = { .pSrc = pSrc,
+                                        .srcRows = srcRows,
+                                        .srcCols = srcCols,
+                                        .nChannels = nChannels,
+                                        .pKernel = pKernel,
+                                        .kRows = kRows,
+                                        .kCols = kCols,
+                                        .stride = stride,
+                                        .pBias = pBias,
+                                        .shift = shift,
+                                        .relu = relu,
+                                        .nPE = nPE,
+                                        .pDst = pDst };
+
+    rt_team_fork(nPE, plp_conv_depthwise_q8p_xpulpv2, (void *)&S);
+}
+
+/**
+  @} end of ConvDepthwise group
+ */
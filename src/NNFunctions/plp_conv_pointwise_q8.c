@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_pointwise_q8.c
+ * Description:  Pointwise convolution of 8-bit fixed point images glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupNN
+ */
+
+/**
+  @defgroup ConvPointwise Pointwise Convolution
+  This module contains the glue code for the pointwise (1x1) convolution of CNN layers, which
+  mixes the channels of every pixel, e.g. after the depthwise convolution of a MobileNet block.
+  The images are stored channel after channel (CHW), such that the input is an inChannels x
+  nPixels matrix, and the output is the product of the outChannels x inChannels weight matrix with
+  it, without any change of the layout.
+
+  The bias, the requantization and the ReLU are fused into the convolution:
+  pDst[co][p] = clip((pBias[co] + sum over ci of pWeights[co][ci] * pSrc[ci][p]) * 2^-shift),
+  where the shift is rounded to the nearest, and clip saturates to [-128, 127], or to [0, 127] if
+  relu is set. The kernel codes are in the module Pointwise Convolution Kernels.
+ */
+
+/**
+  @addtogroup ConvPointwise
+  @{
+ */
+
+/**
+  @brief Glue code for pointwise convolution of 8-bit fixed point images.
+  @param[in]  pSrc         points to the input image, inChannels x nPixels
+  @param[in]  nPixels      number of pixels of a channel, i.e. rows times columns
+  @param[in]  inChannels   number of input channels
+  @param[in]  pWeights     points to the weights, outChannels x inChannels
+  @param[in]  outChannels  number of output channels
+  @param[in]  pBias        points to the bias of every output channel, or NULL for no bias
+  @param[in]  shift        right shift of the accumulator, to requantize the output
+  @param[in]  relu         if not zero, negative outputs are set to zero
+  @param[out] pDst         output image returned here, outChannels x nPixels
+  @return     none
+ */
+
+void plp_conv_pointwise_q8(const int8_t *__restrict__ pSrc,
+                           uint32_t nPixels,
+                           uint32_t inChannels,
+                           const int8_t *__restrict__ pWeights,
+                           uint32_t outChannels,
+                           const int32_t *__restrict__ pBias,
+                           uint32_t shift,
+                           uint8_t relu,
+                           int8_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_conv_pointwise_q8s_rv32im(pSrc, nPixels, inChannels, pWeights, outChannels, pBias,
+                                      shift, relu, pDst);
+    } else {
+        plp_conv_pointwise_q8s_xpulpv2(pSrc, nPixels, inChannels, pWeights, outChannels, pBias,
+                                       shift, relu, pDst);
+    }
+}
+
+/**
+  @} end of ConvPointwise group
+ */
@@ -0,0 +1,213 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_pointwise_q8_l2.c
+ * Description:  Parallel pointwise convolution of 8-bit fixed point images in L2 glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupNN
+ */
+
+/**
+  @addtogroup ConvPointwise
+  @{
+ */
+
+/**
+  @brief Glue code for parallel pointwise convolution of 8-bit fixed point images in L2.
+  @param[in]  pSrc         points to the input image in L2, inChannels x nPixels
+  @param[in]  nPixels      number of pixels of a channel, i.e. rows times columns
+  @param[in]  inChannels   number of input channels
+  @param[in]  pWeights     points to the weights in L2, outChannels x inChannels
+  @param[in]  outChannels  number of output channels
+  @param[in]  pBias        points to the bias of every output channel in L2, or NULL for no bias
+  @param[in]  shift        right shift of the accumulator, to requantize the output
+  @param[in]  relu         if not zero, negative outputs are set to zero
+  @param[in]  nPE          number of cores to compute on
+  @param[out] pDst         output image in L2 returned here, outChannels x nPixels
+  @return     none
+
+  @par Tiling
+  The output is computed in tiles of tileCo output channels and tilePix pixels, which are halved
+  until the weights, biases, input and output of two tiles fit into the L1 buffer of
+  PLP_DMA_STREAM_BUFFER_BYTES bytes, taken with plp_scratch_alloc. The weights of the tile (full
+  rows) and the input pixels (columns of all input channels) are streamed into ping-pong buffers
+  with the cluster DMA, while the cores compute the previous tile with
+  plp_conv_pointwise_q8_parallel. The output tiles are written back asynchronously, as well. The
+  tiles are traversed output channel block by block for every block of pixels, such that every
+  block of the input is only loaded once.
+ */
+
+void plp_conv_pointwise_q8_l2(const int8_t *__restrict__ pSrc,
+                              uint32_t nPixels,
+                              uint32_t inChannels,
+                              const int8_t *__restrict__ pWeights,
+                              uint32_t outChannels,
+                              const int32_t *__restrict__ pBias,
+                              uint32_t shift,
+                              uint8_t relu,
+                              uint32_t nPE,
+                              int8_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    if (nPixels == 0 || inChannels == 0 || outChannels == 0) {
+        return;
+    }
+
+    // find the largest tiles, for which all buffers fit twice into the L1 buffer
+    uint32_t tileCo = outChannels;
+    uint32_t tilePix = nPixels;
+    uint32_t sizeW, sizeIn, sizeOut;
+
+    while (1) {
+        // the weights are followed by the biases
+        sizeW = ((tileCo * inChannels + 3) & ~3) + tileCo * sizeof(int32_t);
+        sizeIn = (inChannels * tilePix + 3) & ~3;
+        sizeOut = (tileCo * tilePix + 3) & ~3;
+        if (2 * (sizeW + sizeIn + sizeOut) <= PLP_DMA_STREAM_BUFFER_BYTES) {
+            break;
+        }
+        if (tileCo > 1 && (sizeW >= sizeIn || tilePix == 1)) {
+            tileCo = (tileCo + 1) / 2;
+        } else if (tilePix > 1) {
+            tilePix = (tilePix + 1) / 2;
+        } else {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+    }
+
+    uint8_t *pBuffer = (uint8_t *)plp_scratch_alloc(PLP_DMA_STREAM_BUFFER_BYTES);
+
+    if (pBuffer == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+
+    uint32_t offsetB = (tileCo * inChannels + 3) & ~3; // biases behind the weights
+    int8_t *pLocW[2] = { (int8_t *)pBuffer, (int8_t *)(pBuffer + sizeW) };
+    int8_t *pLocIn[2] = { (int8_t *)(pBuffer + 2 * sizeW),
+                          (int8_t *)(pBuffer + 2 * sizeW + sizeIn) };
+    int8_t *pLocOut[2] = { (int8_t *)(pBuffer + 2 * (sizeW + sizeIn)),
+                           (int8_t *)(pBuffer + 2 * (sizeW + sizeIn) + sizeOut) };
+
+    uint32_t nTilesCo = (outChannels + tileCo - 1) / tileCo;
+    uint32_t nTilesPix = (nPixels + tilePix - 1) / tilePix;
+    uint32_t nTiles = nTilesCo * nTilesPix;
+
+    rt_dma_copy_t copyIn;
+    rt_dma_copy_t copyOut[2];
+
+    uint32_t curW = 0;  // buffer holding the current tile of the weights
+    uint32_t curIn = 0; // buffer holding the current tile of the input
+
+    // fetch the first tiles
+    uint32_t h = (outChannels < tileCo) ? outChannels : tileCo;
+    uint32_t w = (nPixels < tilePix) ? nPixels : tilePix;
+    rt_dma_memcpy((unsigned int)pWeights, (unsigned int)pLocW[0], sizeof(int8_t) * h * inChannels,
+                  RT_DMA_DIR_EXT2LOC, 0, &copyIn);
+    if (pBias != NULL) {
+        rt_dma_memcpy((unsigned int)pBias, (unsigned int)(pLocW[0] + offsetB),
+                      sizeof(int32_t) * h, RT_DMA_DIR_EXT2LOC, 1, &copyIn);
+    }
+    rt_dma_memcpy_2d((unsigned int)pSrc, (unsigned int)pLocIn[0], sizeof(int8_t) * inChannels * w,
+                     sizeof(int8_t) * nPixels, sizeof(int8_t) * w, RT_DMA_DIR_EXT2LOC, 1, &copyIn);
+
+    for (uint32_t s = 0; s < nTiles; s++) {
+
+        uint32_t co = (s % nTilesCo) * tileCo;
+        uint32_t pix = (s / nTilesCo) * tilePix;
+        h = (outChannels - co < tileCo) ? outChannels - co : tileCo;
+        w = (nPixels - pix < tilePix) ? nPixels - pix : tilePix;
+
+        // wait until the inputs of this tile have arrived
+        rt_dma_wait(&copyIn);
+
+        // prefetch the inputs of the next tile, while this one is computed
+        uint32_t nextW = curW;
+        uint32_t nextIn = curIn;
+        if (s + 1 < nTiles) {
+            uint32_t nextCo = ((s + 1) % nTilesCo) * tileCo;
+            uint32_t nextPix = ((s + 1) / nTilesCo) * tilePix;
+            uint32_t nextH = (outChannels - nextCo < tileCo) ? outChannels - nextCo : tileCo;
+            uint32_t nextWidth = (nPixels - nextPix < tilePix) ? nPixels - nextPix : tilePix;
+            int merge = 0;
+
+            if (nTilesCo > 1) {
+                nextW = 1 - curW;
+                rt_dma_memcpy((unsigned int)(pWeights + nextCo * inChannels),
+                              (unsigned int)pLocW[nextW], sizeof(int8_t) * nextH * inChannels,
+                              RT_DMA_DIR_EXT2LOC, merge, &copyIn);
+                if (pBias != NULL) {
+                    rt_dma_memcpy((unsigned int)(pBias + nextCo),
+                                  (unsigned int)(pLocW[nextW] + offsetB),
+                                  sizeof(int32_t) * nextH, RT_DMA_DIR_EXT2LOC, 1, &copyIn);
+                }
+                merge = 1;
+            }
+            if (nextPix != pix) {
+                nextIn = 1 - curIn;
+                rt_dma_memcpy_2d((unsigned int)(pSrc + nextPix), (unsigned int)pLocIn[nextIn],
+                                 sizeof(int8_t) * inChannels * nextWidth, sizeof(int8_t) * nPixels,
+                                 sizeof(int8_t) * nextWidth, RT_DMA_DIR_EXT2LOC, merge, &copyIn);
+            }
+        }
+
+        // make sure that the previous write-back from this output buffer has finished
+        if (s >= 2) {
+            rt_dma_wait(&copyOut[s & 1]);
+        }
+
+        plp_conv_pointwise_q8_parallel(pLocIn[curIn], w, inChannels, pLocW[curW], h,
+                                       (pBias == NULL) ? NULL : (int32_t *)(pLocW[curW] + offsetB),
+                                       shift, relu, nPE, pLocOut[s & 1]);
+
+        // write back the output tile
+        rt_dma_memcpy_2d((unsigned int)(pDst + co * nPixels + pix), (unsigned int)pLocOut[s & 1],
+                         sizeof(int8_t) * h * w, sizeof(int8_t) * nPixels, sizeof(int8_t) * w,
+                         RT_DMA_DIR_LOC2EXT, 0, &copyOut[s & 1]);
+
+        curW = nextW;
+        curIn = nextIn;
+    }
+
+    // wait for the last write-backs
+    if (nTiles >= 2) {
+        rt_dma_wait(&copyOut[nTiles & 1]);
+    }
+    rt_dma_wait(&copyOut[(nTiles - 1) & 1]);
+
+    plp_scratch_free(pBuffer, PLP_DMA_STREAM_BUFFER_BYTES);
+}
+
+/**
+  @} end of ConvPointwise group
+ */
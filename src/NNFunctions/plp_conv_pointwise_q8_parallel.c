@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_pointwise_q8_parallel.c
+ * Description:  Parallel pointwise convolution of 8-bit fixed point images glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupNN
+ */
+
+/**
+  @addtogroup ConvPointwise
+  @{
+ */
+
+/**
+  @brief Glue code for parallel pointwise convolution of 8-bit fixed point images.
+  @param[in]  pSrc         points to the input image, inChannels x nPixels
+  @param[in]  nPixels      number of pixels of a channel, i.e. rows times columns
+  @param[in]  inChannels   number of input channels
+  @param[in]  pWeights     points to the weights, outChannels x inChannels
+  @param[in]  outChannels  number of output channels
+  @param[in]  pBias        points to the bias of every output channel, or NULL for no bias
+  @param[in]  shift        right shift of the accumulator, to requantize the output
+  @param[in]  relu         if not zero, negative outputs are set to zero
+  @param[in]  nPE          number of parallel processing units
+  @param[out] pDst         output image returned here, outChannels x nPixels
+  @return     none
+
+  @par The output channels are split into nPE contiguous ranges, one per core.
+ */
+
+void plp_conv_pointwise_q8_parallel(const int8_t *__restrict__ pSrc,
+                                    uint32_t nPixels,
+                                    uint32_t inChannels,
+                                    const int8_t *__restrict__ pWeights,
+                                    uint32_t outChannels,
+                                    const int32_t *__restrict__ pBias,
+                                    uint32_t shift,
+                                    uint8_t relu,
+                                    uint32_t nPE,
+                                    int8_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_conv_pointwise_instance_q8 S = { .pSrc = pSrc,
+                                        .nPixels = nPixels,
+                                        .inChannels = inChannels,
+                                        .pWeights = pWeights,
+                                        .outChannels = outChannels,
+                                        .pBias = pBias,
+                                        .shift = shift,
+                                        .relu = relu,
+                                        .nPE = nPE,
+                                        .pDst = pDst };
+
+    rt_team_fork(nPE, plp_conv_pointwise_q8p_xpulpv2, (void *)&S);
+}
+
+/**
+  @} end of ConvPointwise group
+ */
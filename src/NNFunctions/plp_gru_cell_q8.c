@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gru_cell_q8.c
+ * Description:  GRU cell of 8-bit fixed point vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupNN
+ */
+
+/**
+  @addtogroup RNNCell
+  @{
+ */
+
+/**
+  @brief Glue code for GRU cell of 8-bit fixed point vectors.
+  @param[in]     pInput      points to the input vector, nInput values in Q0.7
+  @param[in]     pHidden     points to the hidden state of the previous step, in Q0.7
+  @param[in]     pWeights    points to the weights, 3 * nHidden x (nInput + nHidden)
+  @param[in]     pBias       points to the biases, 4 * nHidden values, or NULL
+  @param[in]     nInput      number of inputs
+  @param[in]     nHidden     number of hidden units
+  @param[in]     fracBits    number of fractional bits of the weights
+  @param[out]    pHiddenOut  points to the new hidden state, in Q0.7
+  @return        none
+ */
+
+void plp_gru_cell_q8(const int8_t *__restrict__ pInput,
+                     const int8_t *__restrict__ pHidden,
+                     const int8_t *__restrict__ pWeights,
+                     const int32_t *__restrict__ pBias,
+                     uint32_t nInput,
+                     uint32_t nHidden,
+                     uint32_t fracBits,
+                     int8_t *__restrict__ pHiddenOut) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_gru_cell_q8s_rv32im(pInput, pHidden, pWeights, pBias, nInput, nHidden, fracBits,
+                                pHiddenOut);
+    } else {
+        plp_gru_cell_q8s_xpulpv2(pInput, pHidden, pWeights, pBias, nInput, nHidden, fracBits,
+                                 pHiddenOut);
+    }
+}
+
+/**
+  @} end of RNNCell group
+ */
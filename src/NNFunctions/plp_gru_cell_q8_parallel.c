@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_gru_cell_q8_parallel.c
+ * Description:  Parallel GRU cell of 8-bit fixed point vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupNN
+ */
+
+/**
+  @addtogroup RNNCell
+  @{
+ */
+
+/**
+  @brief Glue code for parallel GRU cell of 8-bit fixed point vectors.
+  @param[in]     pInput      points to the input vector, nInput values in Q0.7
+  @param[in]     pHidden     points to the hidden state of the previous step, in Q0.7
+  @param[in]     pWeights    points to the weights, 3 * nHidden x (nInput + nHidden)
+  @param[in]     pBias       points to the biases, 4 * nHidden values, or NULL
+  @param[in]     nInput      number of inputs
+  @param[in]     nHidden     number of hidden units
+  @param[in]     fracBits    number of fractional bits of the weights
+  @param[in]     nPE         number of parallel processing units
+  @param[out]    pHiddenOut  points to the new hidden state, in Q0.7
+  @return        none
+
+  @par The hidden units are split into nPE contiguous ranges, one per core.
+ */
+
+void plp_gru_cell_q8_parallel(const int8_t *__restrict__ pInput,
+                              const int8_t *__restrict__ pHidden,
+                              const int8_t *__restrict__ pWeights,
+                              const int32_t *__restrict__ pBias,
+                              uint32_t nInput,
+                              uint32_t nHidden,
+                              uint32_t fracBits,
+                              uint32_t nPE,
+                              int8_t *__restrict__ pHiddenOut) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_gru_cell_instance_q8 S = { .pInput = pInput,
+                                   .pHidden = pHidden,
+                                   .pWeights = pWeights,
+                                   .pBias = pBias,
+                                   .nInput = nInput,
+                                   .nHidden = nHidden,
+                                   .fracBits = fracBits,
+                                   .nPE = nPE,
+                                   .pHiddenOut = pHiddenOut };
+
+    rt_team_fork(nPE, plp_gru_cell_q8p_xpulpv2, (void *)&S);
+}
+
+/**
+  @} end of RNNCell group
+ */
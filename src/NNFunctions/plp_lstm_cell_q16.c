@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lstm_cell_q16.c
+ * Description:  LSTM cell of 16-bit fixed point vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupNN
+ */
+
+/**
+  @defgroup RNNCell Recurrent Cells
+  This module contains the glue code for one time step of the cells of long short-term memory
+  (LSTM) and gated recurrent unit (GRU) networks. The matrix vector products of all gates are
+  computed in a single pass over the input and the hidden state, and the activations and the state
+  update are applied right away to every hidden unit, without buffers in between. The parallel
+  versions split the hidden units among the cores. The kernel codes are in the module Recurrent
+  Cells Kernels.
+
+  The rows of the weights of the gates are stored one gate after the other, in the order of
+  PyTorch: input, forget, cell and output gate for the LSTM, and reset, update and new gate for the
+  GRU. Every row holds the weights of the input followed by the weights of the hidden state. The
+  LSTM cell computes
+  <pre>
+      i = sigmoid(Wi [x; h] + bi)
+      f = sigmoid(Wf [x; h] + bf)
+      g = tanh(Wg [x; h] + bg)
+      o = sigmoid(Wo [x; h] + bo)
+      c = f * c + i * g
+      h = o * tanh(c)
+  </pre>
+  and the GRU cell computes
+  <pre>
+      r = sigmoid(Wr [x; h] + br)
+      z = sigmoid(Wz [x; h] + bz)
+      n = tanh(Wnx x + bnx + r * (Wnh h + bnh))
+      h = (1 - z) * n + z * h
+  </pre>
+  where the biases of the GRU are stored in the order br, bz, bnx and bnh.
+
+  The input and the hidden state are in Q0.15 for the 16-bit and in Q0.7 for the 8-bit cells, the
+  weights have fracBits fractional bits, and the 32-bit biases fracBits + 15 and fracBits + 7
+  fractional bits, respectively. The pre-activations of the gates are rounded and saturated to
+  Q3.12, and sigmoid and tanh are interpolated linearly in tanhTable_q16 (plp_sigmoid_q12 and
+  plp_tanh_q12), with results in Q0.15. The cell state of the LSTM is kept in Q3.12 for both
+  cells. pHiddenOut must not overlap with pHidden, because the whole hidden state of the previous
+  step is needed for every hidden unit.
+ */
+
+/**
+  @addtogroup RNNCell
+  @{
+ */
+
+/**
+  @brief Glue code for LSTM cell of 16-bit fixed point vectors.
+  @param[in]     pInput      points to the input vector, nInput values in Q0.15
+  @param[in]     pHidden     points to the hidden state of the previous step, in Q0.15
+  @param[in,out] pCell       points to the cell state in Q3.12, updated in place
+  @param[in]     pWeights    points to the weights, 4 * nHidden x (nInput + nHidden)
+  @param[in]     pBias       points to the biases, 4 * nHidden values, or NULL
+  @param[in]     nInput      number of inputs
+  @param[in]     nHidden     number of hidden units
+  @param[in]     fracBits    number of fractional bits of the weights
+  @param[out]    pHiddenOut  points to the new hidden state, in Q0.15
+  @return        none
+ */
+
+void plp_lstm_cell_q16(const int16_t *__restrict__ pInput,
+                       const int16_t *__restrict__ pHidden,
+                       int16_t *__restrict__ pCell,
+                       const int16_t *__restrict__ pWeights,
+                       const int32_t *__restrict__ pBias,
+                       uint32_t nInput,
+                       uint32_t nHidden,
+                       uint32_t fracBits,
+                       int16_t *__restrict__ pHiddenOut) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_lstm_cell_q16s_rv32im(pInput, pHidden, pCell, pWeights, pBias, nInput, nHidden,
+                                  fracBits, pHiddenOut);
+    } else {
+        plp_lstm_cell_q16s_xpulpv2(pInput, pHidden, pCell, pWeights, pBias, nInput, nHidden,
+                                   fracBits, pHiddenOut);
+    }
+}
+
+/**
+  @} end of RNNCell group
+ */
@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_maxpool2d_q8.c
+ * Description:  Glue code for 2D max pooling of 8-bit fixed point images
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupNN
+ */
+
+/**
+  @defgroup MaxPool2d 2D Max Pooling
+  This module contains the glue code for the 2D max pooling of images. Every output sample is the
+  maximum of a window of poolRows x poolCols input samples, and the window moves by stride samples
+  in both directions. Only windows which lie completely inside the image are computed (no padding),
+  thus the output has the size ((srcRows - poolRows) / stride + 1) x ((srcCols - poolCols) / stride
+  + 1). Images with several channels are stored channel after channel (CHW), and every channel is
+  pooled on its own. The kernel codes are in the module 2D Max Pooling Kernels.
+ */
+
+/**
+  @addtogroup MaxPool2d
+  @{
+ */
+
+/**
+  @brief Glue code for 2D max pooling of 8-bit fixed point images.
+  @param[in]  pSrc       points to the input image, srcRows x srcCols
+  @param[in]  srcRows    number of rows of the input image
+  @param[in]  srcCols    number of columns of the input image
+  @param[in]  nChannels  number of channels, stored one after the other
+  @param[in]  poolRows   number of rows of the pooling window
+  @param[in]  poolCols   number of columns of the pooling window
+  @param[in]  stride     distance between two windows, in rows and columns
+  @param[out] pDst       output image returned here, ((srcRows - poolRows) / stride + 1) x
+                         ((srcCols - poolCols) / stride + 1) per channel
+  @return     none
+ */
+
+void plp_maxpool2d_q8(const int8_t *__restrict__ pSrc,
+                      uint32_t srcRows,
+                      uint32_t srcCols,
+                      uint32_t nChannels,
+                      uint32_t poolRows,
+                      uint32_t poolCols,
+                      uint32_t stride,
+                      int8_t *__restrict__ pDst) {
+
+    if (srcRows < poolRows || srcCols < poolCols || stride == 0) {
+        return;
+    }
+
+    // samples per input and output channel
+    uint32_t outRows = (srcRows - poolRows) / stride + 1;
+    uint32_t outCols = (srcCols - poolCols) / stride + 1;
+    uint32_t srcSize = srcRows * srcCols;
+    uint32_t dstSize = outRows * outCols;
+    uint32_t ch;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        for (ch = 0; ch < nChannels; ch++) {
+            plp_maxpool2d_q8s_rv32im(pSrc + ch * srcSize, srcRows, srcCols, poolRows, poolCols,
+                                     stride, pDst + ch * dstSize);
+        }
+    } else {
+        for (ch = 0; ch < nChannels; ch++) {
+            plp_maxpool2d_q8s_xpulpv2(pSrc + ch * srcSize, srcRows, srcCols, poolRows, poolCols,
+                                      stride, pDst + ch * dstSize);
+        }
+    }
+}
+
+/**
+  @} end of MaxPool2d group
+ */
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_relu_q8.c
+ * Description:  Glue code for ReLU of an 8-bit fixed point vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupNN
+ */
+
+/**
+  @defgroup Relu ReLU
+  This module contains the glue code for the rectified linear unit, pDst[i] = max(pSrc[i], 0). The
+  result does not depend on the position of the decimal point, thus the functions take no fixed
+  point parameter. The kernel codes are in the module ReLU Kernels.
+ */
+
+/**
+  @addtogroup Relu
+  @{
+ */
+
+/**
+  @brief Glue code for ReLU of an 8-bit fixed point vector.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector, may be equal to pSrc
+  @return     none
+ */
+
+void plp_relu_q8(const int8_t *pSrc,
+                 uint32_t blockSize,
+                 int8_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_relu_q8s_rv32im(pSrc, blockSize, pDst);
+    } else {
+        plp_relu_q8s_xpulpv2(pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of Relu group
+ */
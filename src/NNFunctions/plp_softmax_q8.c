@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_softmax_q8.c
+ * Description:  Glue code for softmax of an 8-bit fixed point vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupNN
+ */
+
+/**
+  @defgroup Softmax Softmax
+  This module contains the glue code for the softmax of a vector,
+  pDst[i] = exp(pSrc[i]) / sum over j of exp(pSrc[j]). The maximum of the vector is subtracted
+  before the exponential, such that the exponentials lie in (0, 1]. The exponentials are computed
+  with the vector exponential of the Fast Math Functions. The kernel codes are in the module
+  Softmax Kernels.
+
+  The 8-bit fixed point softmax computes the exponentials in Q3.12 with plp_exp_vec_q16, and
+  returns the probabilities in Q0.7, saturated to 127. Inputs which are more than 8.0 below the
+  maximum are rounded to 8.0 below the maximum, as their probability is below the resolution of the
+  output.
+ */
+
+/**
+  @addtogroup Softmax
+  @{
+ */
+
+/**
+  @brief Glue code for softmax of an 8-bit fixed point vector.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  fracBits   number of fractional bits of the input, at most 7
+  @param[out] pDst       points to the output vector, in Q0.7
+  @return     none
+ */
+
+void plp_softmax_q8(const int8_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    uint32_t fracBits,
+                    int8_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_softmax_q8s_rv32im(pSrc, blockSize, fracBits, pDst);
+    } else {
+        plp_softmax_q8s_xpulpv2(pSrc, blockSize, fracBits, pDst);
+    }
+}
+
+/**
+  @} end of Softmax group
+ */
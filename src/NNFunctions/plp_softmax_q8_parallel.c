@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_softmax_q8_parallel.c
+ * Description:  Glue code for parallel softmax of an 8-bit fixed point vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupNN
+ */
+
+/**
+  @addtogroup Softmax
+  @{
+ */
+
+/**
+  @brief Glue code for parallel softmax of an 8-bit fixed point vector.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  fracBits   number of fractional bits of the input, at most 7
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the output vector, in Q0.7
+  @return     none
+ */
+
+void plp_softmax_q8_parallel(const int8_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t fracBits,
+                             uint32_t nPE,
+                             int8_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        // maximum and sum of every core
+        int32_t partBuffer[2 * nPE];
+
+        plp_softmax_instance_q8 S = { .pSrc = pSrc,
+                                      .blockSize = blockSize,
+                                      .fracBits = fracBits,
+                                      .nPE = nPE,
+                                      .pPart = partBuffer,
+                                      .pDst = pDst };
+
+        rt_team_fork(nPE, plp_softmax_q8p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+  @} end of Softmax group
+ */
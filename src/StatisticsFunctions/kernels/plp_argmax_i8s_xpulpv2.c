@@ -0,0 +1,116 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_argmax_i8s_xpulpv2.c
+ * Description:  ArgMax of a 8-bit integer vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup argmax
+*/
+
+/**
+   @defgroup argmaxKernels ArgMax Kernels
+*/
+
+/**
+   @addtogroup argmaxKernels
+   @{
+*/
+
+/**
+   @brief Maximum and its index of a 8-bit integer vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[out] pRes       maximum value returned here
+   @param[out] pIndex     index of the first occurrence of the maximum returned here
+   @return     none
+*/
+
+void plp_argmax_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int8_t *__restrict__ pRes,
+                            uint32_t *__restrict__ pIndex) {
+
+    uint32_t blkCnt;
+    int8_t max = pSrc[0];
+    uint32_t maxIndex = 0;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    v4s vMax = __PACK4(max, max, max, max);
+    v4s x;
+
+    // the running extremum is broadcast to all lanes and the lanes of x are only inspected one by
+    // one when pv.max finds a sample beyond it
+    for (blkCnt = 0; blkCnt < (blockSize & ~0x3U); blkCnt += 4) {
+        x = *((const v4s *)(pSrc + blkCnt));
+        if ((int32_t)__MAX4(x, vMax) != (int32_t)vMax) {
+            if (x[0] > max) {
+                max = x[0];
+                maxIndex = blkCnt;
+            }
+            if (x[1] > max) {
+                max = x[1];
+                maxIndex = blkCnt + 1;
+            }
+            if (x[2] > max) {
+                max = x[2];
+                maxIndex = blkCnt + 2;
+            }
+            if (x[3] > max) {
+                max = x[3];
+                maxIndex = blkCnt + 3;
+            }
+            vMax = __PACK4(max, max, max, max);
+        }
+    }
+
+    for (; blkCnt < blockSize; blkCnt++) {
+        if (pSrc[blkCnt] > max) {
+            max = pSrc[blkCnt];
+            maxIndex = blkCnt;
+        }
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    for (blkCnt = 1; blkCnt < blockSize; blkCnt++) {
+        if (pSrc[blkCnt] > max) {
+            max = pSrc[blkCnt];
+            maxIndex = blkCnt;
+        }
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    *pRes = max;
+    *pIndex = maxIndex;
+}
+
+/**
+   @} end of argmaxKernels group
+*/
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_argmin_f32p_xpulpv2.c
+ * Description:  Parallel ArgMin of a 32-bit float vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup argmin
+*/
+
+/**
+   @addtogroup argminKernels
+   @{
+*/
+
+/**
+   @brief Partial minimum and its index of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_minmax_instance_f32 struct initialized by
+                          plp_argmin_f32_parallel
+   @return     none
+*/
+
+void plp_argmin_f32p_xpulpv2(void *task_args) {
+
+    plp_minmax_instance_f32 *S = (plp_minmax_instance_f32 *)task_args;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t chunk = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start = MIN(core_id * chunk, S->blockSize);
+    uint32_t blockSize = MIN(start + chunk, S->blockSize) - start;
+
+    float min;
+    uint32_t minIndex;
+
+    if (blockSize > 0) {
+        plp_argmin_f32s_xpulpv2(S->pSrc + start, blockSize, &min, &minIndex);
+        minIndex += start;
+    } else {
+        // the first sample does not change the result of the reduction
+        min = S->pSrc[0];
+        minIndex = 0;
+    }
+
+    S->pMin[core_id] = min;
+    S->pMinIndex[core_id] = minIndex;
+}
+
+/**
+   @} end of argminKernels group
+*/
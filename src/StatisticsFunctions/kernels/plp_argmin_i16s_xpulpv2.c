@@ -0,0 +1,108 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_argmin_i16s_xpulpv2.c
+ * Description:  ArgMin of a 16-bit integer vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup argmin
+*/
+
+/**
+   @defgroup argminKernels ArgMin Kernels
+*/
+
+/**
+   @addtogroup argminKernels
+   @{
+*/
+
+/**
+   @brief Minimum and its index of a 16-bit integer vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[out] pRes       minimum value returned here
+   @param[out] pIndex     index of the first occurrence of the minimum returned here
+   @return     none
+*/
+
+void plp_argmin_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex) {
+
+    uint32_t blkCnt;
+    int16_t min = pSrc[0];
+    uint32_t minIndex = 0;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    v2s vMin = __PACK2(min, min);
+    v2s x;
+
+    // the running extremum is broadcast to all lanes and the lanes of x are only inspected one by
+    // one when pv.min finds a sample beyond it
+    for (blkCnt = 0; blkCnt < (blockSize & ~0x1U); blkCnt += 2) {
+        x = *((const v2s *)(pSrc + blkCnt));
+        if ((int32_t)__MIN2(x, vMin) != (int32_t)vMin) {
+            if (x[0] < min) {
+                min = x[0];
+                minIndex = blkCnt;
+            }
+            if (x[1] < min) {
+                min = x[1];
+                minIndex = blkCnt + 1;
+            }
+            vMin = __PACK2(min, min);
+        }
+    }
+
+    for (; blkCnt < blockSize; blkCnt++) {
+        if (pSrc[blkCnt] < min) {
+            min = pSrc[blkCnt];
+            minIndex = blkCnt;
+        }
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    for (blkCnt = 1; blkCnt < blockSize; blkCnt++) {
+        if (pSrc[blkCnt] < min) {
+            min = pSrc[blkCnt];
+            minIndex = blkCnt;
+        }
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    *pRes = min;
+    *pIndex = minIndex;
+}
+
+/**
+   @} end of argminKernels group
+*/
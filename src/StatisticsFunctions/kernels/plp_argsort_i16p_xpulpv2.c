@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_argsort_i16p_xpulpv2.c
+ * Description:  Parallel index sorting of a 16-bit integer vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+// maps the samples to unsigned keys with the same ordering
+#define SORT_KEY(x) ((uint32_t)(uint16_t)(x) ^ 0x8000U)
+
+/**
+   @ingroup sort
+*/
+
+/**
+   @addtogroup sortKernels
+   @{
+*/
+
+/**
+   @brief Parallel index sorting of a 16-bit integer vector for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_argsort_instance_i16 struct initialized by
+                          plp_argsort_i16_parallel
+   @return     none
+*/
+
+void plp_argsort_i16p_xpulpv2(void *task_args) {
+
+    plp_argsort_instance_i16 *S = (plp_argsort_instance_i16 *)task_args;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t chunk = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start = MIN(core_id * chunk, S->blockSize);
+    uint32_t end = MIN(start + chunk, S->blockSize);
+    uint32_t *pCount = S->pCount + 16 * core_id;
+    const int16_t *pSrc = S->pSrc;
+    const uint32_t *pIn = S->pTmp;
+    uint32_t *pOut = S->pTmp;
+
+    uint32_t blkCnt;
+    uint32_t core;
+    uint32_t digit;
+    uint32_t index;
+    uint32_t offset;
+    uint32_t pos[16];
+    int32_t shift;
+
+    for (shift = 0; shift < 16; shift += 4) {
+
+        for (digit = 0; digit < 16; digit++) {
+            pCount[digit] = 0;
+        }
+
+        // the first pass sorts the identity permutation
+        for (blkCnt = start; blkCnt < end; blkCnt++) {
+            index = (shift == 0) ? blkCnt : pIn[blkCnt];
+            pCount[(SORT_KEY(pSrc[index]) >> shift) & 0xF]++;
+        }
+
+        rt_team_barrier();
+
+        // the indices of this core with a given digit follow all indices with a smaller digit, and
+        // the indices of the previous cores with the same digit
+        offset = 0;
+        for (digit = 0; digit < 16; digit++) {
+            for (core = 0; core < S->nPE; core++) {
+                if (core == core_id) {
+                    pos[digit] = offset;
+                }
+                offset += S->pCount[16 * core + digit];
+            }
+        }
+
+        for (blkCnt = start; blkCnt < end; blkCnt++) {
+            index = (shift == 0) ? blkCnt : pIn[blkCnt];
+            pOut[pos[(SORT_KEY(pSrc[index]) >> shift) & 0xF]++] = index;
+        }
+
+        // the output is read by all cores in the next pass, which also overwrites the counts
+        rt_team_barrier();
+
+        pIn = pOut;
+        pOut = (pOut == S->pTmp) ? S->pIndex : S->pTmp;
+    }
+}
+
+/**
+   @} end of sortKernels group
+*/
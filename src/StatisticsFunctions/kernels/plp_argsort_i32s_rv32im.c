@@ -0,0 +1,109 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_argsort_i32s_rv32im.c
+ * Description:  Index sorting of a 32-bit integer vector on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// maps the samples to unsigned keys with the same ordering
+#define SORT_KEY(x) ((uint32_t)(x) ^ 0x80000000U)
+
+/**
+   @ingroup sort
+*/
+
+/**
+   @defgroup sortKernels Sorting Kernels
+*/
+
+/**
+   @addtogroup sortKernels
+   @{
+*/
+
+/**
+   @brief Indices that sort a 32-bit integer vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  pTmp       points to a temporary buffer of blockSize indices
+   @param[out] pIndex     points to the blockSize indices of the samples in ascending order
+   @return     none
+
+   @par Least significant digit radix sort of the indices with 8 passes, each sorting
+   them stably by the next four bits of the key of their sample. The digit counts do not
+   depend on the order of the indices and are taken from the input directly.
+*/
+
+void plp_argsort_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t *__restrict__ pTmp,
+                             uint32_t *__restrict__ pIndex) {
+
+    const uint32_t *pIn = pTmp;
+    uint32_t *pOut = pTmp;
+    uint32_t blkCnt;
+    uint32_t digit;
+    uint32_t index;
+    uint32_t start;
+    uint32_t count[16];
+    int32_t shift;
+
+    for (shift = 0; shift < 32; shift += 4) {
+
+        for (digit = 0; digit < 16; digit++) {
+            count[digit] = 0;
+        }
+
+        for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+            count[(SORT_KEY(pSrc[blkCnt]) >> shift) & 0xF]++;
+        }
+
+        // position of the first index with every digit in the output
+        start = 0;
+        for (digit = 0; digit < 16; digit++) {
+            start += count[digit];
+            count[digit] = start - count[digit];
+        }
+
+        if (shift == 0) {
+            for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+                pOut[count[SORT_KEY(pSrc[blkCnt]) & 0xF]++] = blkCnt;
+            }
+        } else {
+            for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+                index = pIn[blkCnt];
+                pOut[count[(SORT_KEY(pSrc[index]) >> shift) & 0xF]++] = index;
+            }
+        }
+
+        pIn = pOut;
+        pOut = (pOut == pTmp) ? pIndex : pTmp;
+    }
+}
+
+/**
+   @} end of sortKernels group
+*/
@@ -0,0 +1,139 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_covariance_f32p_xpulpv2.c
+ * Description:  Parallel covariance matrix of 32-bit float channels kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Covariance of the channels i0, i0 + 1 with the channels j0, j0 + 1, where j0 <= i0. The first
+// sample of every channel is subtracted from all samples, to avoid cancellation. The diagonal
+// blocks also return the means. The second channel is omitted at the end of an odd number of
+// channels.
+static inline void plp_covariance_block_f32(const float32_t *__restrict__ pSrc,
+                                            uint32_t blockSize,
+                                            uint32_t nChannels,
+                                            uint32_t i0,
+                                            uint32_t j0,
+                                            float32_t *__restrict__ pMean,
+                                            float32_t *__restrict__ pCov) {
+
+    uint32_t i1 = (i0 + 1 < nChannels) ? i0 + 1 : i0;
+    uint32_t j1 = (j0 + 1 < nChannels) ? j0 + 1 : j0;
+    float32_t ki0 = pSrc[i0], ki1 = pSrc[i1], kj0 = pSrc[j0], kj1 = pSrc[j1];
+    float32_t si0 = 0.0f, si1 = 0.0f, sj0 = 0.0f, sj1 = 0.0f;
+    float32_t p00 = 0.0f, p01 = 0.0f, p10 = 0.0f, p11 = 0.0f;
+    float32_t c[4];
+    uint32_t t;
+
+    for (t = 0; t < blockSize; t++) {
+        const float32_t *pRow = pSrc + t * nChannels;
+        float32_t a0 = pRow[i0] - ki0;
+        float32_t a1 = pRow[i1] - ki1;
+        float32_t b0 = pRow[j0] - kj0;
+        float32_t b1 = pRow[j1] - kj1;
+        si0 += a0;
+        si1 += a1;
+        sj0 += b0;
+        sj1 += b1;
+        p00 += a0 * b0;
+        p01 += a0 * b1;
+        p10 += a1 * b0;
+        p11 += a1 * b1;
+    }
+
+    if (blockSize > 1) {
+        float32_t invN = 1.0f / blockSize;
+        float32_t invN1 = 1.0f / (blockSize - 1);
+        c[0] = (p00 - si0 * sj0 * invN) * invN1;
+        c[1] = (p01 - si0 * sj1 * invN) * invN1;
+        c[2] = (p10 - si1 * sj0 * invN) * invN1;
+        c[3] = (p11 - si1 * sj1 * invN) * invN1;
+    } else {
+        c[0] = c[1] = c[2] = c[3] = 0.0f;
+    }
+
+    pCov[PLP_MAT_PACKED_IDX(i0, j0)] = c[0];
+    if (j1 != j0 && j1 <= i0) {
+        pCov[PLP_MAT_PACKED_IDX(i0, j1)] = c[1];
+    }
+    if (i1 != i0) {
+        pCov[PLP_MAT_PACKED_IDX(i1, j0)] = c[2];
+        if (j1 != j0) {
+            pCov[PLP_MAT_PACKED_IDX(i1, j1)] = c[3];
+        }
+    }
+
+    if (i0 == j0) {
+        pMean[i0] = ki0 + si0 / blockSize;
+        pMean[i1] = ki1 + si1 / blockSize;
+    }
+}
+
+/**
+  @ingroup Covariance
+ */
+
+/**
+  @addtogroup CovarianceKernels
+  @{
+ */
+
+/**
+  @brief Parallel covariance matrix of 32-bit float channels kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_covariance_instance_f32 struct initialized by
+                    plp_covariance_f32_parallel
+  @return     none
+
+  @par The blocks of two by two channels of the lower triangle are numbered row by row, and
+  distributed round robin among the cores.
+ */
+
+void plp_covariance_f32p_xpulpv2(void *args) {
+
+    plp_covariance_instance_f32 *S = (plp_covariance_instance_f32 *)args;
+
+    uint32_t nBlocks = (S->nChannels + 1) / 2;
+    uint32_t b;
+
+    if (S->blockSize == 0) {
+        return;
+    }
+
+    for (b = rt_core_id(); b < PLP_MAT_PACKED_LEN(nBlocks); b += S->nPE) {
+        // row and column of the block in the packed triangle of blocks
+        uint32_t i = 0;
+        while (PLP_MAT_PACKED_LEN(i + 1) <= b) {
+            i++;
+        }
+        uint32_t j = b - PLP_MAT_PACKED_IDX(i, 0);
+        plp_covariance_block_f32(S->pSrc, S->blockSize, S->nChannels, 2 * i, 2 * j, S->pMean,
+                                 S->pCov);
+    }
+}
+
+/**
+  @} end of CovarianceKernels group
+ */
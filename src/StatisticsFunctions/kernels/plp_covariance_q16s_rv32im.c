@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_covariance_q16s_rv32im.c
+ * Description:  Covariance matrix of 16-bit fixed point channels kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Covariance
+ */
+
+/**
+  @defgroup CovarianceKernels Covariance Kernels
+  This module contains the kernel codes of the covariance.
+ */
+
+/**
+  @addtogroup CovarianceKernels
+  @{
+ */
+
+/**
+  @brief Covariance matrix of 16-bit fixed point channels kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input, blockSize x nChannels, one sample of all channels
+                         after the other
+  @param[in]  blockSize  number of samples of every channel, below 65536
+  @param[in]  nChannels  number of channels
+  @param[in]  fracBits   number of fractional bits of the input and the output
+  @param[out] pMean      points to the means of the nChannels channels
+  @param[out] pCov       points to the packed covariance matrix of
+                         PLP_MAT_PACKED_LEN(nChannels) values
+  @return     none
+ */
+
+void plp_covariance_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                uint32_t nChannels,
+                                uint32_t fracBits,
+                                int16_t *__restrict__ pMean,
+                                int16_t *__restrict__ pCov) {
+
+    uint32_t i, j, t;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    for (i = 0; i < nChannels; i++) {
+        int32_t sumI = 0;
+        for (t = 0; t < blockSize; t++) {
+            sumI += pSrc[t * nChannels + i];
+        }
+        pMean[i] = (int16_t)(sumI / (int32_t)blockSize);
+
+        for (j = 0; j <= i; j++) {
+            int32_t sumJ = 0;
+            int64_t prod = 0;
+            for (t = 0; t < blockSize; t++) {
+                int32_t x = pSrc[t * nChannels + j];
+                sumJ += x;
+                prod += x * pSrc[t * nChannels + i];
+            }
+
+            int64_t cov = 0;
+            if (blockSize > 1) {
+                int64_t n = blockSize;
+                cov = (n * prod - (int64_t)sumI * sumJ) / ((n * (n - 1)) << fracBits);
+            }
+            pCov[PLP_MAT_PACKED_IDX(i, j)] =
+                (int16_t)((cov > 32767) ? 32767 : (cov < -32768) ? -32768 : cov);
+        }
+    }
+}
+
+/**
+  @} end of CovarianceKernels group
+ */
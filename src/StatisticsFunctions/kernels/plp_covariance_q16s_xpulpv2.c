@@ -0,0 +1,146 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_covariance_q16s_xpulpv2.c
+ * Description:  Covariance matrix of 16-bit fixed point channels kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// covariance saturated to 16 bits
+static inline int32_t plp_covariance_sat_q16(int64_t x) {
+    return (int32_t)((x > 32767) ? 32767 : (x < -32768) ? -32768 : x);
+}
+
+// Covariance of the channels i0, i0 + 1 with the channels j0, j0 + 1, where j0 <= i0, from the
+// exact sums of the samples and their products. The diagonal blocks also return the means. The
+// second channel is omitted at the end of an odd number of channels.
+static inline void plp_covariance_block_q16(const int16_t *__restrict__ pSrc,
+                                            uint32_t blockSize,
+                                            uint32_t nChannels,
+                                            uint32_t fracBits,
+                                            uint32_t i0,
+                                            uint32_t j0,
+                                            int16_t *__restrict__ pMean,
+                                            int16_t *__restrict__ pCov) {
+
+    uint32_t i1 = (i0 + 1 < nChannels) ? i0 + 1 : i0;
+    uint32_t j1 = (j0 + 1 < nChannels) ? j0 + 1 : j0;
+    int32_t si0 = 0, si1 = 0, sj0 = 0, sj1 = 0;
+    int64_t p00 = 0, p01 = 0, p10 = 0, p11 = 0;
+    int32_t c[4];
+    uint32_t t;
+
+    for (t = 0; t < blockSize; t++) {
+        const int16_t *pRow = pSrc + t * nChannels;
+        int32_t a0 = pRow[i0];
+        int32_t a1 = pRow[i1];
+        int32_t b0 = pRow[j0];
+        int32_t b1 = pRow[j1];
+        si0 += a0;
+        si1 += a1;
+        sj0 += b0;
+        sj1 += b1;
+        p00 += a0 * b0;
+        p01 += a0 * b1;
+        p10 += a1 * b0;
+        p11 += a1 * b1;
+    }
+
+    if (blockSize > 1) {
+        int64_t n = blockSize;
+        int64_t div = (n * (n - 1)) << fracBits;
+        c[0] = plp_covariance_sat_q16((n * p00 - (int64_t)si0 * sj0) / div);
+        c[1] = plp_covariance_sat_q16((n * p01 - (int64_t)si0 * sj1) / div);
+        c[2] = plp_covariance_sat_q16((n * p10 - (int64_t)si1 * sj0) / div);
+        c[3] = plp_covariance_sat_q16((n * p11 - (int64_t)si1 * sj1) / div);
+    } else {
+        c[0] = c[1] = c[2] = c[3] = 0;
+    }
+
+    pCov[PLP_MAT_PACKED_IDX(i0, j0)] = (int16_t)c[0];
+    if (j1 != j0 && j1 <= i0) {
+        pCov[PLP_MAT_PACKED_IDX(i0, j1)] = (int16_t)c[1];
+    }
+    if (i1 != i0) {
+        pCov[PLP_MAT_PACKED_IDX(i1, j0)] = (int16_t)c[2];
+        if (j1 != j0) {
+            pCov[PLP_MAT_PACKED_IDX(i1, j1)] = (int16_t)c[3];
+        }
+    }
+
+    if (i0 == j0) {
+        pMean[i0] = (int16_t)(si0 / (int32_t)blockSize);
+        pMean[i1] = (int16_t)(si1 / (int32_t)blockSize);
+    }
+}
+
+/**
+  @ingroup Covariance
+ */
+
+/**
+  @addtogroup CovarianceKernels
+  @{
+ */
+
+/**
+  @brief Covariance matrix of 16-bit fixed point channels kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input, blockSize x nChannels, one sample of all channels
+                         after the other
+  @param[in]  blockSize  number of samples of every channel, below 65536
+  @param[in]  nChannels  number of channels
+  @param[in]  fracBits   number of fractional bits of the input and the output
+  @param[out] pMean      points to the means of the nChannels channels
+  @param[out] pCov       points to the packed covariance matrix of
+                         PLP_MAT_PACKED_LEN(nChannels) values
+  @return     none
+
+  @par The covariance is computed in blocks of two by two channels, such that every sample
+  loaded from memory is used for two products.
+ */
+
+void plp_covariance_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 uint32_t nChannels,
+                                 uint32_t fracBits,
+                                 int16_t *__restrict__ pMean,
+                                 int16_t *__restrict__ pCov) {
+
+    uint32_t i, j;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    for (i = 0; i < nChannels; i += 2) {
+        for (j = 0; j <= i; j += 2) {
+            plp_covariance_block_q16(pSrc, blockSize, nChannels, fracBits, i, j, pMean, pCov);
+        }
+    }
+}
+
+/**
+  @} end of CovarianceKernels group
+ */
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cumsum_f32s_rv32im.c
+ * Description:  Cumulative sum of a 32-bit float vector on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup cumsum
+*/
+
+/**
+   @defgroup cumsumKernels Cumulative Sum Kernels
+*/
+
+/**
+   @addtogroup cumsumKernels
+   @{
+*/
+
+/**
+   @brief Cumulative sum of a 32-bit float vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[out] pDst       points to the blockSize cumulative sums
+   @return     none
+*/
+
+void plp_cumsum_f32s_rv32im(const float *pSrc,
+                            uint32_t blockSize,
+                            float *pDst) {
+
+    uint32_t blkCnt;
+    float acc = 0.0f;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        acc += pSrc[blkCnt];
+        pDst[blkCnt] = acc;
+    }
+}
+
+/**
+   @} end of cumsumKernels group
+*/
@@ -0,0 +1,122 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cumsum_i16p_xpulpv2.c
+ * Description:  Parallel cumulative sum of a 16-bit integer vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+// Prefix sums of a chunk, starting from acc. The second sum of every pair of samples adds both
+// samples at once with a dot product, such that it does not depend on the first one.
+static inline void plp_cumsum_i16_scan(const int16_t *__restrict__ pSrc,
+                                       uint32_t blockSize,
+                                       int32_t acc,
+                                       int32_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+    v2s x;
+    v2s ones = (v2s){ 1, 1 };
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        x = *((const v2s *)pSrc);
+        pSrc += 2;
+        pDst[0] = acc + x[0];
+        acc = __SUMDOTP2(x, ones, acc);
+        pDst[1] = acc;
+        pDst += 2;
+    }
+
+    if (blockSize & 0x1) {
+        *pDst = acc + *pSrc;
+    }
+}
+
+// Sum of a chunk, two samples at a time with a dot product
+static inline int32_t plp_cumsum_i16_sum(const int16_t *__restrict__ pSrc, uint32_t blockSize) {
+
+    uint32_t blkCnt;
+    int32_t sum = 0;
+    v2s ones = (v2s){ 1, 1 };
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        sum = __SUMDOTP2(*((const v2s *)pSrc), ones, sum);
+        pSrc += 2;
+    }
+
+    if (blockSize & 0x1) {
+        sum += *pSrc;
+    }
+
+    return sum;
+}
+
+/**
+   @ingroup cumsum
+*/
+
+/**
+   @addtogroup cumsumKernels
+   @{
+*/
+
+/**
+   @brief Parallel cumulative sum of a 16-bit integer vector for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_cumsum_instance_i16 struct initialized by
+                          plp_cumsum_i16_parallel
+   @return     none
+*/
+
+void plp_cumsum_i16p_xpulpv2(void *task_args) {
+
+    plp_cumsum_instance_i16 *S = (plp_cumsum_instance_i16 *)task_args;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t core;
+    int32_t offset = 0;
+
+    // chunks are a multiple of 2 samples, such that every core starts on a word boundary
+    uint32_t chunk = (((S->blockSize + S->nPE - 1) / S->nPE) + 1) & ~0x1U;
+    uint32_t start = MIN(core_id * chunk, S->blockSize);
+    uint32_t blockSize = MIN(start + chunk, S->blockSize) - start;
+
+    // the sum of the last chunk is not needed by any core
+    if (core_id < S->nPE - 1) {
+        S->pPartial[core_id] = plp_cumsum_i16_sum(S->pSrc + start, blockSize);
+    }
+
+    rt_team_barrier();
+
+    for (core = 0; core < core_id; core++) {
+        offset += S->pPartial[core];
+    }
+
+    plp_cumsum_i16_scan(S->pSrc + start, blockSize, offset, S->pDst + start);
+}
+
+/**
+   @} end of cumsumKernels group
+*/
@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cumsum_i32s_xpulpv2.c
+ * Description:  Cumulative sum of a 32-bit integer vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// Prefix sums of a chunk, starting from acc. The second sum of every pair of samples adds the sum
+// of both samples, such that it does not depend on the first one.
+static inline void plp_cumsum_i32_scan(const int32_t *pSrc,
+                                       uint32_t blockSize,
+                                       int32_t acc,
+                                       int32_t *pDst) {
+
+    uint32_t blkCnt;
+    int32_t x0, x1;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        x0 = pSrc[0];
+        x1 = pSrc[1];
+        pSrc += 2;
+        pDst[0] = acc + x0;
+        acc += x0 + x1;
+        pDst[1] = acc;
+        pDst += 2;
+    }
+
+    if (blockSize & 0x1) {
+        *pDst = acc + *pSrc;
+    }
+}
+
+/**
+   @ingroup cumsum
+*/
+
+/**
+   @defgroup cumsumKernels Cumulative Sum Kernels
+*/
+
+/**
+   @addtogroup cumsumKernels
+   @{
+*/
+
+/**
+   @brief Cumulative sum of a 32-bit integer vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[out] pDst       points to the blockSize cumulative sums
+   @return     none
+*/
+
+void plp_cumsum_i32s_xpulpv2(const int32_t *pSrc,
+                             uint32_t blockSize,
+                             int32_t *pDst) {
+    plp_cumsum_i32_scan(pSrc, blockSize, 0, pDst);
+}
+
+/**
+   @} end of cumsumKernels group
+*/
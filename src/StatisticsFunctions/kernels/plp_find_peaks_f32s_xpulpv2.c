@@ -0,0 +1,221 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_find_peaks_f32s_xpulpv2.c
+ * Description:  Peak finding in a 32-bit float vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup peaks
+*/
+
+/**
+   @brief Whether a sample dominates the samples 2 to minDist positions away from it.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  k          index of the sample
+   @param[in]  minDist    number of samples on each side the sample must dominate
+   @return     1 if the sample is larger than the samples before it and not smaller than the
+               samples after it, 0 otherwise
+*/
+
+static inline int plp_find_peaks_window_f32(const float *pSrc,
+                                            uint32_t blockSize,
+                                            uint32_t k,
+                                            uint32_t minDist) {
+
+    float x = pSrc[k];
+    uint32_t j;
+
+    for (j = 2; j <= minDist; j++) {
+        if ((j <= k && pSrc[k - j] >= x) || (k + j < blockSize && pSrc[k + j] > x)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+   @brief Insert a peak into a list of the largest peaks, sorted in descending order.
+   @param[in]     pSrc      points to the input vector
+   @param[in]     k         index of the peak
+   @param[in]     maxPeaks  largest number of peaks in the list
+   @param[in,out] pList     points to the indices of the peaks in the list
+   @param[in]     count     number of peaks in the list
+   @return        number of peaks in the list after the insertion
+
+   @par A peak equal to one in the list is inserted after it, since the peaks are inserted in the
+   order of the input.
+*/
+
+static inline uint32_t plp_find_peaks_insert_f32(const float *pSrc,
+                                                 uint32_t k,
+                                                 uint32_t maxPeaks,
+                                                 uint32_t *pList,
+                                                 uint32_t count) {
+
+    float value = pSrc[k];
+    uint32_t j;
+
+    if (count == maxPeaks) {
+        if (pSrc[pList[count - 1]] >= value) {
+            return count;
+        }
+        count--;
+    }
+
+    for (j = count; j > 0 && pSrc[pList[j - 1]] < value; j--) {
+        pList[j] = pList[j - 1];
+    }
+    pList[j] = k;
+
+    return count + 1;
+}
+
+/**
+   @brief Largest peaks among the samples first to last - 1.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  first      first sample to check, at least 1
+   @param[in]  last       sample after the last one to check, at most blockSize - 1
+   @param[in]  threshold  smallest value of a peak
+   @param[in]  minDist    number of samples on each side a peak must dominate
+   @param[in]  maxPeaks   largest number of peaks returned, at least 1
+   @param[out] pList      points to the indices of the largest peaks, in descending order
+   @return     number of peaks in pList
+*/
+
+static uint32_t plp_find_peaks_scan_f32(const float *pSrc,
+                                        uint32_t blockSize,
+                                        uint32_t first,
+                                        uint32_t last,
+                                        float threshold,
+                                        uint32_t minDist,
+                                        uint32_t maxPeaks,
+                                        uint32_t *pList) {
+
+    uint32_t count = 0;
+    uint32_t k;
+    float a;
+    float b;
+    float c;
+
+    if (first >= last) {
+        return 0;
+    }
+
+    a = pSrc[first - 1];
+    b = pSrc[first];
+
+    for (k = first; k < last; k++) {
+        c = pSrc[k + 1];
+        if (b > a && b >= c && b >= threshold &&
+            plp_find_peaks_window_f32(pSrc, blockSize, k, minDist)) {
+            count = plp_find_peaks_insert_f32(pSrc, k, maxPeaks, pList, count);
+        }
+        a = b;
+        b = c;
+    }
+
+    return count;
+}
+
+/**
+   @brief Parabolic interpolation of the selected peaks.
+   @param[in]  pSrc    points to the input vector
+   @param[in]  pIndex  points to the indices of the peaks
+   @param[in]  count   number of peaks
+   @param[out] pDelta  points to the offsets of the interpolated peaks from their indices
+   @param[out] pValue  points to the interpolated values of the peaks
+   @return     none
+*/
+
+static void plp_find_peaks_interp_f32(const float *pSrc,
+                                      const uint32_t *pIndex,
+                                      uint32_t count,
+                                      float *pDelta,
+                                      float *pValue) {
+
+    uint32_t i;
+
+    for (i = 0; i < count; i++) {
+        uint32_t k = pIndex[i];
+        float a = pSrc[k - 1];
+        float b = pSrc[k];
+        float c = pSrc[k + 1];
+        float num = a - c;
+        float delta = 0.5f * num / (a - 2.0f * b + c);
+
+        pDelta[i] = delta;
+        pValue[i] = b - 0.25f * num * delta;
+    }
+}
+
+/**
+   @addtogroup peaksKernels
+   @{
+*/
+
+/**
+   @brief Largest peaks of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  threshold  smallest value of a peak
+   @param[in]  minDist    number of samples on each side a peak must dominate, 0 acts as 1
+   @param[in]  maxPeaks   largest number of peaks returned
+   @param[out] pIndex     points to the indices of the peaks, maxPeaks words
+   @param[out] pDelta     points to the offsets of the interpolated peaks from their indices
+   @param[out] pValue     points to the interpolated values of the peaks
+   @param[out] pNumPeaks  number of peaks found, at most maxPeaks, returned here
+   @return     none
+
+*/
+
+void plp_find_peaks_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 float threshold,
+                                 uint32_t minDist,
+                                 uint32_t maxPeaks,
+                                 uint32_t *__restrict__ pIndex,
+                                 float *__restrict__ pDelta,
+                                 float *__restrict__ pValue,
+                                 uint32_t *__restrict__ pNumPeaks) {
+
+    uint32_t count = 0;
+
+    if (blockSize >= 3 && maxPeaks > 0) {
+        count = plp_find_peaks_scan_f32(pSrc, blockSize, 1, blockSize - 1, threshold, minDist,
+                                        maxPeaks, pIndex);
+        plp_find_peaks_interp_f32(pSrc, pIndex, count, pDelta, pValue);
+    }
+
+    *pNumPeaks = count;
+}
+
+/**
+   @} end of peaksKernels group
+*/
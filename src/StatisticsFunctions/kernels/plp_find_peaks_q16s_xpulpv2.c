@@ -0,0 +1,252 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_find_peaks_q16s_xpulpv2.c
+ * Description:  Peak finding in a 16-bit fixed point vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup peaks
+*/
+
+/**
+   @brief Whether a sample dominates the samples 2 to minDist positions away from it.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  k          index of the sample
+   @param[in]  minDist    number of samples on each side the sample must dominate
+   @return     1 if the sample is larger than the samples before it and not smaller than the
+               samples after it, 0 otherwise
+*/
+
+static inline int plp_find_peaks_window_q16(const int16_t *pSrc,
+                                            uint32_t blockSize,
+                                            uint32_t k,
+                                            uint32_t minDist) {
+
+    int16_t x = pSrc[k];
+    uint32_t j;
+
+    for (j = 2; j <= minDist; j++) {
+        if ((j <= k && pSrc[k - j] >= x) || (k + j < blockSize && pSrc[k + j] > x)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+   @brief Insert a peak into a list of the largest peaks, sorted in descending order.
+   @param[in]     pSrc      points to the input vector
+   @param[in]     k         index of the peak
+   @param[in]     maxPeaks  largest number of peaks in the list
+   @param[in,out] pList     points to the indices of the peaks in the list
+   @param[in]     count     number of peaks in the list
+   @return        number of peaks in the list after the insertion
+
+   @par A peak equal to one in the list is inserted after it, since the peaks are inserted in the
+   order of the input.
+*/
+
+static inline uint32_t plp_find_peaks_insert_q16(const int16_t *pSrc,
+                                                 uint32_t k,
+                                                 uint32_t maxPeaks,
+                                                 uint32_t *pList,
+                                                 uint32_t count) {
+
+    int16_t value = pSrc[k];
+    uint32_t j;
+
+    if (count == maxPeaks) {
+        if (pSrc[pList[count - 1]] >= value) {
+            return count;
+        }
+        count--;
+    }
+
+    for (j = count; j > 0 && pSrc[pList[j - 1]] < value; j--) {
+        pList[j] = pList[j - 1];
+    }
+    pList[j] = k;
+
+    return count + 1;
+}
+
+/**
+   @brief Largest peaks among the samples first to last - 1.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  first      first sample to check, at least 1
+   @param[in]  last       sample after the last one to check, at most blockSize - 1
+   @param[in]  threshold  smallest value of a peak
+   @param[in]  minDist    number of samples on each side a peak must dominate
+   @param[in]  maxPeaks   largest number of peaks returned, at least 1
+   @param[out] pList      points to the indices of the largest peaks, in descending order
+   @return     number of peaks in pList
+*/
+
+static uint32_t plp_find_peaks_scan_q16(const int16_t *pSrc,
+                                        uint32_t blockSize,
+                                        uint32_t first,
+                                        uint32_t last,
+                                        int16_t threshold,
+                                        uint32_t minDist,
+                                        uint32_t maxPeaks,
+                                        uint32_t *pList) {
+
+    uint32_t count = 0;
+    uint32_t k = first;
+    v2s vThr = __PACK2(threshold, threshold);
+    v2s prev;
+    v2s cur;
+    v2s next;
+    v2s c;
+
+    // an odd first sample is checked alone, such that the vector loop loads aligned pairs
+    if ((k & 1) && k < last) {
+        if (pSrc[k] > pSrc[k - 1] && pSrc[k] >= pSrc[k + 1] && pSrc[k] >= threshold &&
+            plp_find_peaks_window_q16(pSrc, blockSize, k, minDist)) {
+            count = plp_find_peaks_insert_q16(pSrc, k, maxPeaks, pList, count);
+        }
+        k++;
+    }
+
+    if (k + 1 < last && k + 3 < blockSize) {
+        prev = *((v2s *)&pSrc[k - 2]);
+        cur = *((v2s *)&pSrc[k]);
+
+        for (; k + 1 < last && k + 3 < blockSize; k += 2) {
+            next = *((v2s *)&pSrc[k + 2]);
+            // every lane of c is -1 if the sample is a local maximum at least the threshold,
+            // which is rare, such that the window is only checked for few samples
+            c = (cur > __builtin_shuffle(prev, cur, (v2s){ 1, 2 })) &
+                (cur >= __builtin_shuffle(cur, next, (v2s){ 1, 2 })) & (cur >= vThr);
+            if ((uint32_t)c != 0) {
+                if (c[0] && plp_find_peaks_window_q16(pSrc, blockSize, k, minDist)) {
+                    count = plp_find_peaks_insert_q16(pSrc, k, maxPeaks, pList, count);
+                }
+                if (c[1] && plp_find_peaks_window_q16(pSrc, blockSize, k + 1, minDist)) {
+                    count = plp_find_peaks_insert_q16(pSrc, k + 1, maxPeaks, pList, count);
+                }
+            }
+            prev = cur;
+            cur = next;
+        }
+    }
+
+    for (; k < last; k++) {
+        if (pSrc[k] > pSrc[k - 1] && pSrc[k] >= pSrc[k + 1] && pSrc[k] >= threshold &&
+            plp_find_peaks_window_q16(pSrc, blockSize, k, minDist)) {
+            count = plp_find_peaks_insert_q16(pSrc, k, maxPeaks, pList, count);
+        }
+    }
+
+    return count;
+}
+
+/**
+   @brief Parabolic interpolation of the selected peaks.
+   @param[in]  pSrc    points to the input vector
+   @param[in]  pIndex  points to the indices of the peaks
+   @param[in]  count   number of peaks
+   @param[out] pDelta  points to the offsets of the interpolated peaks from their indices
+   @param[out] pValue  points to the interpolated values of the peaks
+   @return     none
+*/
+
+static void plp_find_peaks_interp_q16(const int16_t *pSrc,
+                                      const uint32_t *pIndex,
+                                      uint32_t count,
+                                      int16_t *pDelta,
+                                      int16_t *pValue) {
+
+    uint32_t i;
+
+    for (i = 0; i < count; i++) {
+        uint32_t k = pIndex[i];
+        int32_t a = pSrc[k - 1];
+        int32_t b = pSrc[k];
+        int32_t c = pSrc[k + 1];
+        int32_t num = a - c;
+        // negative, since b is larger than a and not smaller than c
+        int32_t den = a - 2 * b + c;
+        // |num| <= |den|, thus |delta| <= 0.5 in Q1.15. The correction num * delta / 4 is never
+        // positive, so the value only saturates upwards.
+        int32_t delta = num * 16384 / den;
+        int32_t value = b - ((num * delta) >> 17);
+
+        pDelta[i] = (int16_t)delta;
+        pValue[i] = (int16_t)((value > INT16_MAX) ? INT16_MAX : value);
+    }
+}
+
+/**
+   @addtogroup peaksKernels
+   @{
+*/
+
+/**
+   @brief Largest peaks of a 16-bit fixed point vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  threshold  smallest value of a peak
+   @param[in]  minDist    number of samples on each side a peak must dominate, 0 acts as 1
+   @param[in]  maxPeaks   largest number of peaks returned
+   @param[out] pIndex     points to the indices of the peaks, maxPeaks words
+   @param[out] pDelta     points to the Q1.15 offsets of the interpolated peaks from their indices
+   @param[out] pValue     points to the interpolated values of the peaks
+   @param[out] pNumPeaks  number of peaks found, at most maxPeaks, returned here
+   @return     none
+
+   @par Two samples are compared with both neighbours and the threshold at once, with the
+   neighbours shuffled from the aligned pairs around them.
+*/
+
+void plp_find_peaks_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 int16_t threshold,
+                                 uint32_t minDist,
+                                 uint32_t maxPeaks,
+                                 uint32_t *__restrict__ pIndex,
+                                 int16_t *__restrict__ pDelta,
+                                 int16_t *__restrict__ pValue,
+                                 uint32_t *__restrict__ pNumPeaks) {
+
+    uint32_t count = 0;
+
+    if (blockSize >= 3 && maxPeaks > 0) {
+        count = plp_find_peaks_scan_q16(pSrc, blockSize, 1, blockSize - 1, threshold, minDist,
+                                        maxPeaks, pIndex);
+        plp_find_peaks_interp_q16(pSrc, pIndex, count, pDelta, pValue);
+    }
+
+    *pNumPeaks = count;
+}
+
+/**
+   @} end of peaksKernels group
+*/
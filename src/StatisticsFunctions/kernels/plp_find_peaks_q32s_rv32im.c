@@ -0,0 +1,230 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_find_peaks_q32s_rv32im.c
+ * Description:  Peak finding in a 32-bit fixed point vector on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup peaks
+*/
+
+/**
+   @defgroup peaksKernels Peak Finding Kernels
+*/
+
+/**
+   @brief Whether a sample dominates the samples 2 to minDist positions away from it.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  k          index of the sample
+   @param[in]  minDist    number of samples on each side the sample must dominate
+   @return     1 if the sample is larger than the samples before it and not smaller than the
+               samples after it, 0 otherwise
+*/
+
+static inline int plp_find_peaks_window_q32(const int32_t *pSrc,
+                                            uint32_t blockSize,
+                                            uint32_t k,
+                                            uint32_t minDist) {
+
+    int32_t x = pSrc[k];
+    uint32_t j;
+
+    for (j = 2; j <= minDist; j++) {
+        if ((j <= k && pSrc[k - j] >= x) || (k + j < blockSize && pSrc[k + j] > x)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+   @brief Insert a peak into a list of the largest peaks, sorted in descending order.
+   @param[in]     pSrc      points to the input vector
+   @param[in]     k         index of the peak
+   @param[in]     maxPeaks  largest number of peaks in the list
+   @param[in,out] pList     points to the indices of the peaks in the list
+   @param[in]     count     number of peaks in the list
+   @return        number of peaks in the list after the insertion
+
+   @par A peak equal to one in the list is inserted after it, since the peaks are inserted in the
+   order of the input.
+*/
+
+static inline uint32_t plp_find_peaks_insert_q32(const int32_t *pSrc,
+                                                 uint32_t k,
+                                                 uint32_t maxPeaks,
+                                                 uint32_t *pList,
+                                                 uint32_t count) {
+
+    int32_t value = pSrc[k];
+    uint32_t j;
+
+    if (count == maxPeaks) {
+        if (pSrc[pList[count - 1]] >= value) {
+            return count;
+        }
+        count--;
+    }
+
+    for (j = count; j > 0 && pSrc[pList[j - 1]] < value; j--) {
+        pList[j] = pList[j - 1];
+    }
+    pList[j] = k;
+
+    return count + 1;
+}
+
+/**
+   @brief Largest peaks among the samples first to last - 1.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  first      first sample to check, at least 1
+   @param[in]  last       sample after the last one to check, at most blockSize - 1
+   @param[in]  threshold  smallest value of a peak
+   @param[in]  minDist    number of samples on each side a peak must dominate
+   @param[in]  maxPeaks   largest number of peaks returned, at least 1
+   @param[out] pList      points to the indices of the largest peaks, in descending order
+   @return     number of peaks in pList
+*/
+
+static uint32_t plp_find_peaks_scan_q32(const int32_t *pSrc,
+                                        uint32_t blockSize,
+                                        uint32_t first,
+                                        uint32_t last,
+                                        int32_t threshold,
+                                        uint32_t minDist,
+                                        uint32_t maxPeaks,
+                                        uint32_t *pList) {
+
+    uint32_t count = 0;
+    uint32_t k;
+    int32_t a;
+    int32_t b;
+    int32_t c;
+
+    if (first >= last) {
+        return 0;
+    }
+
+    a = pSrc[first - 1];
+    b = pSrc[first];
+
+    for (k = first; k < last; k++) {
+        c = pSrc[k + 1];
+        if (b > a && b >= c && b >= threshold &&
+            plp_find_peaks_window_q32(pSrc, blockSize, k, minDist)) {
+            count = plp_find_peaks_insert_q32(pSrc, k, maxPeaks, pList, count);
+        }
+        a = b;
+        b = c;
+    }
+
+    return count;
+}
+
+/**
+   @brief Parabolic interpolation of the selected peaks.
+   @param[in]  pSrc    points to the input vector
+   @param[in]  pIndex  points to the indices of the peaks
+   @param[in]  count   number of peaks
+   @param[out] pDelta  points to the offsets of the interpolated peaks from their indices
+   @param[out] pValue  points to the interpolated values of the peaks
+   @return     none
+*/
+
+static void plp_find_peaks_interp_q32(const int32_t *pSrc,
+                                      const uint32_t *pIndex,
+                                      uint32_t count,
+                                      int32_t *pDelta,
+                                      int32_t *pValue) {
+
+    uint32_t i;
+
+    for (i = 0; i < count; i++) {
+        uint32_t k = pIndex[i];
+        int64_t a = pSrc[k - 1];
+        int64_t b = pSrc[k];
+        int64_t c = pSrc[k + 1];
+        int64_t num = a - c;
+        // negative, since b is larger than a and not smaller than c
+        int64_t den = a - 2 * b + c;
+        // |num| <= |den|, thus |delta| <= 0.5 in Q1.31. The correction num * delta / 4 is never
+        // positive, so the value only saturates upwards.
+        int64_t delta = num * 1073741824 / den;
+        int64_t value = b - ((num * delta) >> 33);
+
+        pDelta[i] = (int32_t)delta;
+        pValue[i] = (int32_t)((value > INT32_MAX) ? INT32_MAX : value);
+    }
+}
+
+/**
+   @addtogroup peaksKernels
+   @{
+*/
+
+/**
+   @brief Largest peaks of a 32-bit fixed point vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  threshold  smallest value of a peak
+   @param[in]  minDist    number of samples on each side a peak must dominate, 0 acts as 1
+   @param[in]  maxPeaks   largest number of peaks returned
+   @param[out] pIndex     points to the indices of the peaks, maxPeaks words
+   @param[out] pDelta     points to the Q1.31 offsets of the interpolated peaks from their indices
+   @param[out] pValue     points to the interpolated values of the peaks
+   @param[out] pNumPeaks  number of peaks found, at most maxPeaks, returned here
+   @return     none
+
+*/
+
+void plp_find_peaks_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                int32_t threshold,
+                                uint32_t minDist,
+                                uint32_t maxPeaks,
+                                uint32_t *__restrict__ pIndex,
+                                int32_t *__restrict__ pDelta,
+                                int32_t *__restrict__ pValue,
+                                uint32_t *__restrict__ pNumPeaks) {
+
+    uint32_t count = 0;
+
+    if (blockSize >= 3 && maxPeaks > 0) {
+        count = plp_find_peaks_scan_q32(pSrc, blockSize, 1, blockSize - 1, threshold, minDist,
+                                        maxPeaks, pIndex);
+        plp_find_peaks_interp_q32(pSrc, pIndex, count, pDelta, pValue);
+    }
+
+    *pNumPeaks = count;
+}
+
+/**
+   @} end of peaksKernels group
+*/
@@ -0,0 +1,132 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_frame_features_q16s_rv32im.c
+ * Description:  Single pass frame features of a 16-bit fixed point vector for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup frameFeatures
+*/
+
+/**
+   @defgroup frameFeaturesKernels FrameFeatures Kernels
+*/
+
+/**
+   @addtogroup frameFeaturesKernels
+   @{
+*/
+
+/**
+   @brief Single pass frame features of a 16-bit fixed point vector for RV32IM extension.
+   @param[in]  pSrc        points to the input vector
+   @param[in]  blockSize   number of samples in input vector, must be at least one
+   @param[in]  fracBits    number of fractional bits of the input
+   @param[out] pEnergy     sum of squares returned here
+   @param[out] pZeroCross  number of zero crossings returned here
+   @param[out] pPeak       largest magnitude returned here
+   @param[out] pDc         mean value returned here
+   @return     none
+
+   @par The loop body is free of data dependent branches, apart from the peak update. A sign
+   change is found in the sign bit of the XOR of two neighboring samples, and the magnitude is
+   computed with the sign mask instead of a comparison.
+*/
+
+void plp_frame_features_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                    uint32_t blockSize,
+                                    uint32_t fracBits,
+                                    int32_t *__restrict__ pEnergy,
+                                    uint32_t *__restrict__ pZeroCross,
+                                    int16_t *__restrict__ pPeak,
+                                    int16_t *__restrict__ pDc) {
+
+    uint32_t blkCnt;
+    int32_t sum = 0;        // sum of the samples
+    uint32_t energy = 0;    // sum of the squared samples
+    uint32_t zeroCross = 0; // number of sign changes
+    int32_t peak = 0;       // largest magnitude
+    int32_t x, s, mag;
+    int32_t prev = pSrc[0]; // the first sample has no predecessor, it cannot be a crossing
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    int32_t y;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        x = *pSrc++;
+        y = *pSrc++;
+
+        sum += x + y;
+        energy += (x * x) >> fracBits;
+        energy += (y * y) >> fracBits;
+        zeroCross += ((uint32_t)(prev ^ x) >> 31) + ((uint32_t)(x ^ y) >> 31);
+
+        s = x >> 31;
+        mag = (x ^ s) - s;
+        peak = (mag > peak) ? mag : peak;
+        s = y >> 31;
+        mag = (y ^ s) - s;
+        peak = (mag > peak) ? mag : peak;
+
+        prev = y;
+    }
+
+    if (blockSize & 0x1) {
+        x = *pSrc;
+        sum += x;
+        energy += (x * x) >> fracBits;
+        zeroCross += (uint32_t)(prev ^ x) >> 31;
+        s = x >> 31;
+        mag = (x ^ s) - s;
+        peak = (mag > peak) ? mag : peak;
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        x = *pSrc++;
+        sum += x;
+        energy += (x * x) >> fracBits;
+        zeroCross += (uint32_t)(prev ^ x) >> 31;
+        s = x >> 31;
+        mag = (x ^ s) - s;
+        peak = (mag > peak) ? mag : peak;
+        prev = x;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    *pEnergy = (int32_t)energy;
+    *pZeroCross = zeroCross;
+    *pPeak = (int16_t)((peak > 0x7FFF) ? 0x7FFF : peak);
+    *pDc = (int16_t)(sum / (int32_t)blockSize);
+}
+
+/**
+   @} end of frameFeaturesKernels group
+*/
@@ -0,0 +1,135 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_frame_features_q16s_xpulpv2.c
+ * Description:  Single pass frame features of a 16-bit fixed point vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup frameFeatures
+*/
+
+/**
+   @addtogroup frameFeaturesKernels
+   @{
+*/
+
+/**
+   @brief Single pass frame features of a 16-bit fixed point vector for XPULPV2 extension.
+   @param[in]  pSrc        points to the input vector
+   @param[in]  blockSize   number of samples in input vector, must be at least one
+   @param[in]  fracBits    number of fractional bits of the input
+   @param[out] pEnergy     sum of squares returned here
+   @param[out] pZeroCross  number of zero crossings returned here
+   @param[out] pPeak       largest magnitude returned here
+   @param[out] pDc         mean value returned here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   Two samples are loaded as one word. The sum uses pv.dotsp.h with a vector of ones, and the peak
+   is found with pv.max.h and pv.min.h, such that the magnitude of -0x8000 does not overflow. The
+   sign bits of both samples are bits 15 and 31 of the word, hence the zero crossings within the
+   word and towards the previous word are found with two XORs of shifted words.
+*/
+
+void plp_frame_features_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                     uint32_t blockSize,
+                                     uint32_t fracBits,
+                                     int32_t *__restrict__ pEnergy,
+                                     uint32_t *__restrict__ pZeroCross,
+                                     int16_t *__restrict__ pPeak,
+                                     int16_t *__restrict__ pDc) {
+
+    uint32_t blkCnt;
+    int32_t sum = 0;        // sum of the samples
+    uint32_t energy = 0;    // sum of the squared samples
+    uint32_t zeroCross = 0; // number of sign changes
+    int32_t peak = 0;       // largest magnitude
+    int32_t x;
+    int32_t prev = pSrc[0]; // sign bit of the previous sample in bit 31
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    const v2s ones = { 1, 1 };
+    v2s vMax = { -0x8000, -0x8000 };
+    v2s vMin = { 0x7FFF, 0x7FFF };
+    v2s a;
+    int32_t w, lo;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        a = *((v2s *)pSrc);
+        pSrc += 2;
+
+        sum = __SUMDOTP2(a, ones, sum);
+        energy += (a[0] * a[0]) >> fracBits;
+        energy += (a[1] * a[1]) >> fracBits;
+        vMax = __MAX2(vMax, a);
+        vMin = __MIN2(vMin, a);
+
+        w = (int32_t)a;
+        lo = (int32_t)((uint32_t)w << 16);
+        zeroCross += ((uint32_t)(prev ^ lo) >> 31) + ((uint32_t)(lo ^ w) >> 31);
+        prev = w;
+    }
+
+    if (blockSize > 1) {
+        peak = (vMax[0] > vMax[1]) ? vMax[0] : vMax[1];
+        x = -((vMin[0] < vMin[1]) ? vMin[0] : vMin[1]);
+        peak = (x > peak) ? x : peak;
+    }
+
+    if (blockSize & 0x1) {
+        x = *pSrc;
+        sum += x;
+        energy += (x * x) >> fracBits;
+        zeroCross += (uint32_t)(prev ^ x) >> 31;
+        x = (x < 0) ? -x : x;
+        peak = (x > peak) ? x : peak;
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        x = *pSrc++;
+        sum += x;
+        energy += (x * x) >> fracBits;
+        zeroCross += (uint32_t)(prev ^ x) >> 31;
+        prev = x;
+        x = (x < 0) ? -x : x;
+        peak = (x > peak) ? x : peak;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    *pEnergy = (int32_t)energy;
+    *pZeroCross = zeroCross;
+    *pPeak = (int16_t)((peak > 0x7FFF) ? 0x7FFF : peak);
+    *pDc = (int16_t)(sum / (int32_t)blockSize);
+}
+
+/**
+   @} end of frameFeaturesKernels group
+*/
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_i16p_xpulpv2.c
+ * Description:  Parallel histogram of a 16-bit integer vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup histogram
+*/
+
+/**
+   @addtogroup histogramKernels
+   @{
+*/
+
+/**
+   @brief Parallel histogram of a 16-bit integer vector for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_histogram_instance_i16 struct initialized by
+                          plp_histogram_i16_parallel
+   @return     none
+*/
+
+void plp_histogram_i16p_xpulpv2(void *task_args) {
+
+    plp_histogram_instance_i16 *S = (plp_histogram_instance_i16 *)task_args;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t nBins = S->nBins;
+    uint32_t bin;
+    uint32_t core;
+    uint32_t sum;
+
+    // chunks are a multiple of 4 samples, such that every core starts on a word boundary
+    uint32_t chunk = (((S->blockSize + S->nPE - 1) / S->nPE) + 3) & ~0x3U;
+    uint32_t start = MIN(core_id * chunk, S->blockSize);
+    uint32_t blockSize = MIN(start + chunk, S->blockSize) - start;
+
+    // the first core bins directly into the result, the others into their private bins
+    uint32_t *pBins = (core_id == 0) ? S->pHist : S->pScratch + (core_id - 1) * nBins;
+
+    plp_histogram_i16s_xpulpv2(S->pSrc + start, blockSize, S->lowEdge, S->binShift, nBins, pBins);
+
+    rt_team_barrier();
+
+    // every core merges the private bins of a contiguous range of bins
+    uint32_t binChunk = (nBins + S->nPE - 1) / S->nPE;
+    uint32_t binStart = MIN(core_id * binChunk, nBins);
+    uint32_t binEnd = MIN(binStart + binChunk, nBins);
+
+    for (bin = binStart; bin < binEnd; bin++) {
+        sum = 0;
+        for (core = 1; core < S->nPE; core++) {
+            sum += S->pScratch[(core - 1) * nBins + bin];
+        }
+        S->pHist[bin] += sum;
+    }
+}
+
+/**
+   @} end of histogramKernels group
+*/
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_i8s_rv32im.c
+ * Description:  Histogram of a 8-bit integer vector on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup histogram
+*/
+
+/**
+   @defgroup histogramKernels Histogram Kernels
+*/
+
+/**
+   @addtogroup histogramKernels
+   @{
+*/
+
+/**
+   @brief Histogram of a 8-bit integer vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  lowEdge    lower edge of the first bin
+   @param[in]  binShift   log2 of the bin width
+   @param[in]  nBins      number of bins
+   @param[out] pHist      points to the nBins counts
+   @return     none
+*/
+
+void plp_histogram_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              int32_t lowEdge,
+                              uint32_t binShift,
+                              uint32_t nBins,
+                              uint32_t *__restrict__ pHist) {
+
+    uint32_t blkCnt;
+    uint32_t bin;
+
+    for (bin = 0; bin < nBins; bin++) {
+        pHist[bin] = 0;
+    }
+
+    // samples below lowEdge wrap around to a large bin number and are dropped like the ones above
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        bin = (uint32_t)((int32_t)pSrc[blkCnt] - lowEdge) >> binShift;
+        if (bin < nBins) {
+            pHist[bin]++;
+        }
+    }
+}
+
+/**
+   @} end of histogramKernels group
+*/
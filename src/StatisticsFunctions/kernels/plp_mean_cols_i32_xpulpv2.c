@@ -0,0 +1,118 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_cols_i32_xpulpv2.c
+ * Description:  Column means of a 32-bit integer matrix kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup mean
+ */
+
+/**
+  @addtogroup meanKernels
+  @{
+ */
+
+/**
+  @brief Column means of a 32-bit integer matrix kernel for XPULPV2 extension.
+  @param[in]  pSrc    points to the input matrix of shape MxN
+  @param[in]  M       height of the matrix, number of samples of every column
+  @param[in]  N       width of the matrix, number of columns
+  @param[in]  stride  distance between two rows of pSrc, in elements
+  @param[out] pDst    points to the N column means
+  @return     none
+ */
+
+void plp_mean_cols_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t stride,
+                                int32_t *__restrict__ pDst) {
+
+    uint32_t m, n;
+
+    // 4 adjacent columns per sweep over the rows, such that the samples of one row are loaded
+    // from consecutive addresses and every sum stays in a register
+    for (n = 0; n + 3 < N; n += 4) {
+        const int32_t *pCol = &pSrc[n];
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        int32_t sum2 = 0;
+        int32_t sum3 = 0;
+        for (m = 0; m < M; m++) {
+            sum0 += pCol[0];
+            sum1 += pCol[1];
+            sum2 += pCol[2];
+            sum3 += pCol[3];
+            pCol += stride;
+        }
+        pDst[n + 0] = sum0 / (int32_t)M;
+        pDst[n + 1] = sum1 / (int32_t)M;
+        pDst[n + 2] = sum2 / (int32_t)M;
+        pDst[n + 3] = sum3 / (int32_t)M;
+    }
+
+    for (; n < N; n++) {
+        const int32_t *pCol = &pSrc[n];
+        int32_t sum = 0;
+        for (m = 0; m < M; m++) {
+            sum += pCol[0];
+            pCol += stride;
+        }
+        pDst[n] = sum / (int32_t)M;
+    }
+}
+
+/**
+  @brief Parallel column means of a 32-bit integer matrix kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mean_cols_instance_i32 struct initialized by
+                    plp_mean_cols_i32_parallel
+  @return     none
+
+  @par Parallelization
+  The columns are split into contiguous chunks, one per core, and every core computes the column
+  means of its chunk with plp_mean_cols_i32s_xpulpv2. In every row, the cores load from neighbouring
+  addresses, which are in different banks, and every result is written by exactly one core, so no
+  reduction is needed.
+ */
+
+void plp_mean_cols_i32p_xpulpv2(void *args) {
+
+    plp_mean_cols_instance_i32 *a = (plp_mean_cols_instance_i32 *)args;
+
+    uint32_t start, end;
+
+    plp_team_chunk(a->N, a->nPE, rt_core_id(), 1, &start, &end);
+
+    if (start < end) {
+        plp_mean_cols_i32s_xpulpv2(a->pSrc + start, a->M, end - start, a->stride, a->pDst + start);
+    }
+}
+
+/**
+  @} end of meanKernels group
+ */
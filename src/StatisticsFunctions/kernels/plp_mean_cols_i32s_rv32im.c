@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_cols_i32s_rv32im.c
+ * Description:  Column means of a 32-bit integer matrix kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup mean
+ */
+
+/**
+  @addtogroup meanKernels
+  @{
+ */
+
+/**
+  @brief Column means of a 32-bit integer matrix kernel for RV32IM extension.
+  @param[in]  pSrc    points to the input matrix of shape MxN
+  @param[in]  M       height of the matrix, number of samples of every column
+  @param[in]  N       width of the matrix, number of columns
+  @param[in]  stride  distance between two rows of pSrc, in elements
+  @param[out] pDst    points to the N column means
+  @return     none
+ */
+
+void plp_mean_cols_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t stride,
+                               int32_t *__restrict__ pDst) {
+
+    uint32_t m, n;
+
+    // 2 adjacent columns per sweep over the rows, such that the samples of one row are loaded
+    // from consecutive addresses and every sum stays in a register
+    for (n = 0; n + 1 < N; n += 2) {
+        const int32_t *pCol = &pSrc[n];
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        for (m = 0; m < M; m++) {
+            sum0 += pCol[0];
+            sum1 += pCol[1];
+            pCol += stride;
+        }
+        pDst[n + 0] = sum0 / (int32_t)M;
+        pDst[n + 1] = sum1 / (int32_t)M;
+    }
+
+    for (; n < N; n++) {
+        const int32_t *pCol = &pSrc[n];
+        int32_t sum = 0;
+        for (m = 0; m < M; m++) {
+            sum += pCol[0];
+            pCol += stride;
+        }
+        pDst[n] = sum / (int32_t)M;
+    }
+}
+
+/**
+  @} end of meanKernels group
+ */
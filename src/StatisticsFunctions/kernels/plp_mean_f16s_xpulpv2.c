@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_f16s_xpulpv2.c
+ * Description:  Mean value of a half-precision float vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup mean
+ */
+
+/**
+  @addtogroup meanKernels
+  @{
+ */
+
+/**
+   @brief         Mean value of a half-precision float vector for XPULPV2 extension with the
+                  smallFloat extensions.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[out]    pRes       mean value returned here
+   @return        none
+*/
+
+void plp_mean_f16s_xpulpv2(const float16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float16_t *__restrict__ pRes) {
+
+    uint32_t blkCnt;
+
+#ifdef PLP_MATH_SMALLFLOAT
+
+    const v2f16 *pSrc2 = (const v2f16 *)pSrc;
+    v2f16 sum = { 0, 0 };
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        sum += *pSrc2++; // vfadd.h
+    }
+
+    float16_t res = sum[0] + sum[1];
+    if (blockSize % 2 == 1) {
+        res += pSrc[blockSize - 1];
+    }
+    *pRes = res / (float16_t)blockSize;
+
+#else // PLP_MATH_SMALLFLOAT
+
+    float32_t sum = 0;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        sum += plp_f16_to_f32(pSrc[blkCnt]);
+    }
+    *pRes = plp_f32_to_f16(sum / (float32_t)blockSize);
+
+#endif // PLP_MATH_SMALLFLOAT
+}
+
+/**
+   @} end of meanKernels group
+*/
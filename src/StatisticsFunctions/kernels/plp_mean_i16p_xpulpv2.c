@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_i16p_xpulpv2.c
+ * Description:  Parallel mean of a 16-bit integer vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup mean
+*/
+
+/**
+   @addtogroup meanKernels
+   @{
+*/
+
+/**
+   @brief Partial sum of a 16-bit integer vector for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_stats_instance_i16 struct initialized by
+                          plp_mean_i16_parallel
+   @return     none
+*/
+
+void plp_mean_i16p_xpulpv2(void *task_args) {
+
+    plp_stats_instance_i16 *S = (plp_stats_instance_i16 *)task_args;
+
+    uint32_t core_id = rt_core_id();
+    // chunks are a multiple of 4 samples, such that every core starts on a word boundary
+    uint32_t chunk = (((S->blockSize + S->nPE - 1) / S->nPE) + 3) & ~0x3U;
+    uint32_t start = MIN(core_id * chunk, S->blockSize);
+    uint32_t blockSize = MIN(start + chunk, S->blockSize) - start;
+
+    const int16_t *pSrc = S->pSrc + start;
+    uint32_t blkCnt;
+    int32_t sum = 0;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    const v2s ones = { 1, 1 };
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        sum = __SUMDOTP2(*((v2s *)pSrc), ones, sum);
+        pSrc += 2;
+    }
+
+    if (blockSize & 0x1) {
+        sum += *pSrc;
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        sum += *pSrc++;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    S->resBuffer[core_id] = sum;
+}
+
+/**
+   @} end of meanKernels group
+*/
@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_i32p_xpulpv2.c
+ * Description:  Parallel mean of a 32-bit integer vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup mean
+*/
+
+/**
+   @addtogroup meanKernels
+   @{
+*/
+
+/**
+   @brief Partial sum of a 32-bit integer vector for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_stats_instance_i32 struct initialized by
+                          plp_mean_i32_parallel
+   @return     none
+*/
+
+void plp_mean_i32p_xpulpv2(void *task_args) {
+
+    plp_stats_instance_i32 *S = (plp_stats_instance_i32 *)task_args;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t chunk = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start = MIN(core_id * chunk, S->blockSize);
+    uint32_t blockSize = MIN(start + chunk, S->blockSize) - start;
+
+    const int32_t *pSrc = S->pSrc + start;
+    uint32_t blkCnt;
+    int32_t sum = 0;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    int32_t sum2 = 0;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        sum += *pSrc++;
+        sum2 += *pSrc++;
+    }
+
+    if (blockSize & 0x1) {
+        sum += *pSrc;
+    }
+
+    sum += sum2;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        sum += *pSrc++;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    S->resBuffer[core_id] = sum;
+}
+
+/**
+   @} end of meanKernels group
+*/
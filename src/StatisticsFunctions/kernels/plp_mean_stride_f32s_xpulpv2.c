@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_stride_f32s_xpulpv2.c
+ * Description:  Mean value of a strided 32-bit float vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup mean
+ */
+
+/**
+  @addtogroup meanKernels
+  @{
+ */
+
+/**
+  @brief Mean value of a strided 32-bit float vector for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  stride     distance between two samples of pSrc, in elements
+  @param[in]  blockSize  number of samples in the input vector
+  @param[out] pRes       mean value returned here
+  @return     none
+ */
+
+void plp_mean_stride_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                  uint32_t stride,
+                                  uint32_t blockSize,
+                                  float *__restrict__ pRes) {
+
+    uint32_t blkCnt;
+    float sum1 = 0;
+    float sum2 = 0;
+
+    // two samples per iteration into independent sums, which hides the load latency
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        sum1 += pSrc[0];
+        sum2 += pSrc[stride];
+        pSrc += 2 * stride;
+    }
+
+    if (blockSize & 1) {
+        sum1 += *pSrc;
+    }
+
+    *pRes = (sum1 + sum2) / (float)blockSize;
+}
+
+/**
+  @} end of meanKernels group
+ */
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_var_std_q16s_rv32im.c
+ * Description:  Single pass mean, var and std of a 16-bit fixed point vector on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup meanVarStd
+*/
+
+/**
+   @defgroup meanVarStdKernels MeanVarStd Kernels
+*/
+
+/**
+   @addtogroup meanVarStdKernels
+   @{
+*/
+
+/**
+   @brief Single pass mean, variance and standard deviation of a 16-bit fixed point vector for
+   RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  fracBits   number of fractional bits of the input
+   @param[out] pMean      mean value returned here
+   @param[out] pVar       variance returned here
+   @param[out] pStd       standard deviation returned here
+   @return     none
+*/
+
+void plp_mean_var_std_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  uint32_t fracBits,
+                                  int16_t *__restrict__ pMean,
+                                  int16_t *__restrict__ pVar,
+                                  int16_t *__restrict__ pStd) {
+
+    uint32_t blkCnt;
+    int64_t sum = 0;   // sum of the samples
+    int64_t sumSq = 0; // sum of the squared samples
+    int32_t x;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        x = *pSrc++;
+        sum += x;
+        sumSq += x * x;
+    }
+
+    int64_t mean = sum / blockSize;
+    int64_t rem = sum - mean * blockSize;
+    // split sum^2 / blockSize into mean * sum + rem * sum / blockSize to stay within 64 bits
+    int64_t var = (sumSq - mean * sum - (rem * sum) / blockSize) / blockSize;
+
+    *pMean = (int16_t)mean;
+    *pVar = (int16_t)(var >> fracBits);
+    plp_sqrt_q16(pVar, fracBits, pStd);
+}
+
+/**
+   @} end of meanVarStdKernels group
+*/
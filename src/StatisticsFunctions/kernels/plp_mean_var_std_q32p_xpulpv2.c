@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_var_std_q32p_xpulpv2.c
+ * Description:  Parallel mean, var and std of a 32-bit fixed point vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup meanVarStd
+*/
+
+/**
+   @addtogroup meanVarStdKernels
+   @{
+*/
+
+/**
+   @brief Partial moments of a 32-bit fixed point vector for parallel mean, variance and standard
+   deviation on XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_mean_var_std_instance_q32 struct initialized by
+                          plp_mean_var_std_q32_parallel
+   @return     none
+*/
+
+void plp_mean_var_std_q32p_xpulpv2(void *task_args) {
+
+    plp_mean_var_std_instance_q32 *S = (plp_mean_var_std_instance_q32 *)task_args;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t chunk = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start = MIN(core_id * chunk, S->blockSize);
+    uint32_t blockSize = MIN(start + chunk, S->blockSize) - start;
+    const int32_t *pSrc = S->pSrc + start;
+    uint32_t fracBits = S->fracBits;
+
+    uint32_t blkCnt;
+    int64_t shift = S->pSrc[0]; // all samples are shifted by the first one to avoid cancellation
+    int64_t sum = 0;            // sum of the shifted samples
+    int64_t sumSq = 0;          // sum of the squared shifted samples, in fixed point
+    int64_t x;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    int64_t y;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 1); blkCnt++) {
+        x = *pSrc++ - shift;
+        y = *pSrc++ - shift;
+        sum += x;
+        sumSq += (x * x) >> fracBits;
+        sum += y;
+        sumSq += (y * y) >> fracBits;
+    }
+
+    if (blockSize & 0x1) {
+        x = *pSrc - shift;
+        sum += x;
+        sumSq += (x * x) >> fracBits;
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        x = *pSrc++ - shift;
+        sum += x;
+        sumSq += (x * x) >> fracBits;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    S->pSum[core_id] = sum;
+    S->pSumSq[core_id] = sumSq;
+}
+
+/**
+   @} end of meanVarStdKernels group
+*/
@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_var_std_q8p_xpulpv2.c
+ * Description:  Parallel mean, var and std of a 8-bit fixed point vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup meanVarStd
+*/
+
+/**
+   @addtogroup meanVarStdKernels
+   @{
+*/
+
+/**
+   @brief Partial moments of a 8-bit fixed point vector for parallel mean, variance and standard
+   deviation on XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_mean_var_std_instance_q8 struct initialized by
+                          plp_mean_var_std_q8_parallel
+   @return     none
+*/
+
+void plp_mean_var_std_q8p_xpulpv2(void *task_args) {
+
+    plp_mean_var_std_instance_q8 *S = (plp_mean_var_std_instance_q8 *)task_args;
+
+    uint32_t core_id = rt_core_id();
+    // chunks are a multiple of 4 samples, such that every core starts on a word boundary
+    uint32_t chunk = (((S->blockSize + S->nPE - 1) / S->nPE) + 3) & ~0x3U;
+    uint32_t start = MIN(core_id * chunk, S->blockSize);
+    uint32_t blockSize = MIN(start + chunk, S->blockSize) - start;
+    const int8_t *pSrc = S->pSrc + start;
+
+    uint32_t blkCnt;
+    int64_t sum = 0;   // sum of the samples
+    int64_t sumSq = 0; // sum of the squared samples
+    int32_t x;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    const v4s ones = { 1, 1, 1, 1 };
+    v4s a;
+
+    for (blkCnt = 0; blkCnt < (blockSize >> 2); blkCnt++) {
+        a = *((v4s *)pSrc);
+        pSrc += 4;
+        sum += __DOTP4(a, ones);
+        sumSq += __DOTP4(a, a);
+    }
+
+    for (blkCnt = 0; blkCnt < (blockSize & 0x3); blkCnt++) {
+        x = *pSrc++;
+        sum += x;
+        sumSq += x * x;
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        x = *pSrc++;
+        sum += x;
+        sumSq += x * x;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    S->pSum[core_id] = sum;
+    S->pSumSq[core_id] = sumSq;
+}
+
+/**
+   @} end of meanVarStdKernels group
+*/
@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_min_f16s_xpulpv2.c
+ * Description:  Minimum value of a half-precision float vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup min
+ */
+
+/**
+  @addtogroup minKernels
+  @{
+ */
+
+/**
+   @brief         Minimum value of a half-precision float vector for XPULPV2 extension with the
+                  smallFloat extensions.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[out]    pRes       minimum value returned here
+   @return        none
+*/
+
+void plp_min_f16s_xpulpv2(const float16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float16_t *__restrict__ pRes) {
+
+    uint32_t blkCnt;
+
+#ifdef PLP_MATH_SMALLFLOAT
+
+    float16_t min = pSrc[0];
+
+    for (blkCnt = 1; blkCnt < blockSize; blkCnt++) {
+        if (pSrc[blkCnt] < min) {
+            min = pSrc[blkCnt];
+        }
+    }
+    *pRes = min;
+
+#else // PLP_MATH_SMALLFLOAT
+
+    float32_t min = plp_f16_to_f32(pSrc[0]);
+    uint32_t idx = 0;
+
+    for (blkCnt = 1; blkCnt < blockSize; blkCnt++) {
+        float32_t x = plp_f16_to_f32(pSrc[blkCnt]);
+        if (x < min) {
+            min = x;
+            idx = blkCnt;
+        }
+    }
+    *pRes = pSrc[idx];
+
+#endif // PLP_MATH_SMALLFLOAT
+}
+
+/**
+   @} end of minKernels group
+*/
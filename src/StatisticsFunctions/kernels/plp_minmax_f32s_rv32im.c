@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_minmax_f32s_rv32im.c
+ * Description:  Min and max with indices of a 32-bit float vector on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// maps the bit pattern of a float to a signed integer with the same ordering, such that the samples
+// are compared with integer instructions instead of software floating point calls
+#define F32_ORDER(x) ((x) ^ (((x) >> 31) & 0x7FFFFFFF))
+
+/**
+   @ingroup minmax
+*/
+
+/**
+   @addtogroup minmaxKernels
+   @{
+*/
+
+/**
+   @brief Min and max with indices of a 32-bit float vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[out] pMin       minimum value returned here
+   @param[out] pMinIndex  index of the first occurrence of the minimum returned here
+   @param[out] pMax       maximum value returned here
+   @param[out] pMaxIndex  index of the first occurrence of the maximum returned here
+   @return     none
+
+   @par The samples are compared on their bit patterns, so -0.0f sorts below +0.0f and NaN inputs
+   are not supported.
+*/
+
+void plp_minmax_f32s_rv32im(const float *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            float *__restrict__ pMin,
+                            uint32_t *__restrict__ pMinIndex,
+                            float *__restrict__ pMax,
+                            uint32_t *__restrict__ pMaxIndex) {
+
+    uint32_t blkCnt;
+    const int32_t *pBits = (const int32_t *)pSrc;
+    int32_t x;
+    int32_t min = F32_ORDER(pBits[0]);
+    uint32_t minIndex = 0;
+    int32_t max = F32_ORDER(pBits[0]);
+    uint32_t maxIndex = 0;
+
+    for (blkCnt = 1; blkCnt < blockSize; blkCnt++) {
+        x = F32_ORDER(pBits[blkCnt]);
+        if (x < min) {
+            min = x;
+            minIndex = blkCnt;
+        }
+        if (x > max) {
+            max = x;
+            maxIndex = blkCnt;
+        }
+    }
+
+    *pMin = pSrc[minIndex];
+    *pMinIndex = minIndex;
+    *pMax = pSrc[maxIndex];
+    *pMaxIndex = maxIndex;
+}
+
+/**
+   @} end of minmaxKernels group
+*/
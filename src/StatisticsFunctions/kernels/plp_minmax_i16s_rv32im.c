@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_minmax_i16s_rv32im.c
+ * Description:  MinMax of a 16-bit integer vector on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup minmax
+*/
+
+/**
+   @defgroup minmaxKernels MinMax Kernels
+*/
+
+/**
+   @addtogroup minmaxKernels
+   @{
+*/
+
+/**
+   @brief Min and max with indices of a 16-bit integer vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[out] pMin       minimum value returned here
+   @param[out] pMinIndex  index of the first occurrence of the minimum returned here
+   @param[out] pMax       maximum value returned here
+   @param[out] pMaxIndex  index of the first occurrence of the maximum returned here
+   @return     none
+*/
+
+void plp_minmax_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int16_t *__restrict__ pMin,
+                            uint32_t *__restrict__ pMinIndex,
+                            int16_t *__restrict__ pMax,
+                            uint32_t *__restrict__ pMaxIndex) {
+
+    uint32_t blkCnt;
+    int16_t min = pSrc[0];
+    uint32_t minIndex = 0;
+    int16_t max = pSrc[0];
+    uint32_t maxIndex = 0;
+
+    for (blkCnt = 1; blkCnt < blockSize; blkCnt++) {
+        if (pSrc[blkCnt] < min) {
+            min = pSrc[blkCnt];
+            minIndex = blkCnt;
+        }
+        if (pSrc[blkCnt] > max) {
+            max = pSrc[blkCnt];
+            maxIndex = blkCnt;
+        }
+    }
+
+    *pMin = min;
+    *pMinIndex = minIndex;
+    *pMax = max;
+    *pMaxIndex = maxIndex;
+}
+
+/**
+   @} end of minmaxKernels group
+*/
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_l2_f32s_xpulpv2.c
+ * Description:  L2 normalization of a 32-bit float vector kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Normalize
+ */
+
+/**
+  @addtogroup NormalizeKernels
+  @{
+ */
+
+/**
+  @brief L2 normalization of a 32-bit float vector kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector
+  @return     none
+ */
+
+void plp_normalize_l2_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   float32_t *__restrict__ pDst) {
+
+    uint32_t i;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    float32_t sumSq = 0.0f;
+
+    for (i = 0; i < blockSize; i++) {
+        sumSq += pSrc[i] * pSrc[i];
+    }
+
+    float32_t norm;
+    plp_sqrt_f32(&sumSq, &norm);
+    float32_t gain = (norm > 0.0f) ? 1.0f / norm : 0.0f;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = pSrc[i] * gain;
+    }
+}
+
+/**
+  @} end of NormalizeKernels group
+ */
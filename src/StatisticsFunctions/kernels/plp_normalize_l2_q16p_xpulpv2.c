@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_l2_q16p_xpulpv2.c
+ * Description:  Parallel L2 normalization of a 16-bit fixed point vector kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Normalize
+ */
+
+/**
+  @addtogroup NormalizeKernels
+  @{
+ */
+
+/**
+  @brief Parallel L2 normalization of a 16-bit fixed point vector kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_normalize_instance_q16 struct initialized by
+                    plp_normalize_l2_q16_parallel
+  @return     none
+ */
+
+void plp_normalize_l2_q16p_xpulpv2(void *args) {
+
+    plp_normalize_instance_q16 *S = (plp_normalize_instance_q16 *)args;
+
+    uint32_t coreId = rt_core_id();
+    uint32_t start, end, i;
+
+    if (S->blockSize == 0) {
+        return;
+    }
+
+    plp_team_chunk(S->blockSize, S->nPE, coreId, 2, &start, &end);
+
+    const int16_t *pSrc = S->pSrc + start;
+    int16_t *pDst = S->pDst + start;
+    uint32_t len = end - start;
+    int64_t sumSq = 0;
+
+    for (i = 0; i + 1 < len; i += 2) {
+        v2s a = *((v2s *)&pSrc[i]);
+        // a sum of two squares is non-negative and always fits into 32 unsigned bits
+        sumSq += (uint32_t)__DOTP2(a, a);
+    }
+    if (i < len) {
+        int32_t x = pSrc[i];
+        sumSq += x * x;
+    }
+
+    S->pSumSq[coreId] = sumSq;
+
+    plp_team_barrier();
+
+    // every core adds up the moments of all cores
+    sumSq = 0;
+    for (i = 0; i < S->nPE; i++) {
+        sumSq += S->pSumSq[i];
+    }
+
+    uint64_t energy = (uint64_t)sumSq;
+    int32_t gain = 0;
+    int32_t shift = 0;
+
+    if (energy != 0) {
+        plp_normalize_gain_q16(energy, (uint64_t)1 << 15, &gain, &shift);
+    }
+
+    for (i = 0; i + 1 < len; i += 2) {
+        int16_t y0 = plp_normalize_apply_q16(pSrc[i], gain, shift);
+        int16_t y1 = plp_normalize_apply_q16(pSrc[i + 1], gain, shift);
+        *((v2s *)&pDst[i]) = __PACK2(y0, y1);
+    }
+    if (i < len) {
+        pDst[i] = plp_normalize_apply_q16(pSrc[i], gain, shift);
+    }
+}
+
+/**
+  @} end of NormalizeKernels group
+ */
@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_l2_q16s_xpulpv2.c
+ * Description:  L2 normalization of a 16-bit fixed point vector kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Normalize
+ */
+
+/**
+  @addtogroup NormalizeKernels
+  @{
+ */
+
+/**
+  @brief L2 normalization of a 16-bit fixed point vector kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector, in Q0.15
+  @return     none
+
+  @par The moments are accumulated two samples at a time with pv.dotsp.h, as in
+  plp_mean_var_std_q16s_xpulpv2.
+ */
+
+void plp_normalize_l2_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   int16_t *__restrict__ pDst) {
+
+    uint32_t i;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    int64_t sumSq = 0;
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        v2s a = *((v2s *)&pSrc[i]);
+        // a sum of two squares is non-negative and always fits into 32 unsigned bits
+        sumSq += (uint32_t)__DOTP2(a, a);
+    }
+    if (i < blockSize) {
+        int32_t x = pSrc[i];
+        sumSq += x * x;
+    }
+
+    uint64_t energy = (uint64_t)sumSq;
+    int32_t gain = 0;
+    int32_t shift = 0;
+
+    if (energy != 0) {
+        plp_normalize_gain_q16(energy, (uint64_t)1 << 15, &gain, &shift);
+    }
+
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        int16_t y0 = plp_normalize_apply_q16(pSrc[i], gain, shift);
+        int16_t y1 = plp_normalize_apply_q16(pSrc[i + 1], gain, shift);
+        *((v2s *)&pDst[i]) = __PACK2(y0, y1);
+    }
+    if (i < blockSize) {
+        pDst[i] = plp_normalize_apply_q16(pSrc[i], gain, shift);
+    }
+}
+
+/**
+  @} end of NormalizeKernels group
+ */
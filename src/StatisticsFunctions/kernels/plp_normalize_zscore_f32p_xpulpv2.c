@@ -0,0 +1,103 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_zscore_f32p_xpulpv2.c
+ * Description:  Parallel z-score normalization of a 32-bit float vector kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Normalize
+ */
+
+/**
+  @addtogroup NormalizeKernels
+  @{
+ */
+
+/**
+  @brief Parallel z-score normalization of a 32-bit float vector kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_normalize_instance_f32 struct initialized by
+                    plp_normalize_zscore_f32_parallel
+  @return     none
+ */
+
+void plp_normalize_zscore_f32p_xpulpv2(void *args) {
+
+    plp_normalize_instance_f32 *S = (plp_normalize_instance_f32 *)args;
+
+    uint32_t coreId = rt_core_id();
+    uint32_t start, end, i;
+
+    if (S->blockSize == 0) {
+        return;
+    }
+
+    plp_team_chunk(S->blockSize, S->nPE, coreId, 1, &start, &end);
+
+    const float32_t *pSrc = S->pSrc + start;
+    float32_t *pDst = S->pDst + start;
+    uint32_t len = end - start;
+    float32_t shift = S->pSrc[0]; // all samples are shifted by the first one
+    float32_t sum = 0.0f;
+    float32_t sumSq = 0.0f;
+
+    for (i = 0; i < len; i++) {
+        float32_t x = pSrc[i] - shift;
+        sum += x;
+        sumSq += x * x;
+    }
+
+    S->pSum[coreId] = sum;
+    S->pSumSq[coreId] = sumSq;
+
+    plp_team_barrier();
+
+    // every core adds up the moments of all cores
+    sum = 0.0f;
+    sumSq = 0.0f;
+    for (i = 0; i < S->nPE; i++) {
+        sum += S->pSum[i];
+        sumSq += S->pSumSq[i];
+    }
+
+    float32_t mean = sum / S->blockSize;
+    float32_t var = sumSq / S->blockSize - mean * mean;
+    float32_t std;
+
+    if (var < 0.0f) {
+        var = 0.0f;
+    }
+    plp_sqrt_f32(&var, &std);
+    float32_t gain = (std > 0.0f) ? 1.0f / std : 0.0f;
+
+    for (i = 0; i < len; i++) {
+        pDst[i] = (pSrc[i] - shift - mean) * gain;
+    }
+}
+
+/**
+  @} end of NormalizeKernels group
+ */
@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_zscore_f32s_xpulpv2.c
+ * Description:  Z-score normalization of a 32-bit float vector kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Normalize
+ */
+
+/**
+  @defgroup NormalizeKernels Normalization Kernels
+  This module contains the kernel codes of the normalizations.
+ */
+
+/**
+  @addtogroup NormalizeKernels
+  @{
+ */
+
+/**
+  @brief Z-score normalization of a 32-bit float vector kernel for XPULPV2 extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector
+  @return     none
+ */
+
+void plp_normalize_zscore_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                       uint32_t blockSize,
+                                       float32_t *__restrict__ pDst) {
+
+    uint32_t i;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    float32_t shift = pSrc[0]; // all samples are shifted by the first one to avoid cancellation
+    float32_t sum = 0.0f;
+    float32_t sumSq = 0.0f;
+
+    for (i = 0; i < blockSize; i++) {
+        float32_t x = pSrc[i] - shift;
+        sum += x;
+        sumSq += x * x;
+    }
+
+    float32_t mean = sum / blockSize;
+    float32_t var = sumSq / blockSize - mean * mean;
+    float32_t std;
+
+    if (var < 0.0f) {
+        var = 0.0f;
+    }
+    plp_sqrt_f32(&var, &std);
+    float32_t gain = (std > 0.0f) ? 1.0f / std : 0.0f;
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = (pSrc[i] - shift - mean) * gain;
+    }
+}
+
+/**
+  @} end of NormalizeKernels group
+ */
@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_zscore_q16s_rv32im.c
+ * Description:  Z-score normalization of a 16-bit fixed point vector kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Normalize
+ */
+
+/**
+  @addtogroup NormalizeKernels
+  @{
+ */
+
+/**
+  @brief Z-score normalization of a 16-bit fixed point vector kernel for RV32IM extension.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector, below 65536
+  @param[in]  fracBits   number of fractional bits of the output
+  @param[out] pDst       points to the output vector
+  @return     none
+ */
+
+void plp_normalize_zscore_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      uint32_t fracBits,
+                                      int16_t *__restrict__ pDst) {
+
+    uint32_t i;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    int64_t sum = 0;
+    int64_t sumSq = 0;
+
+    for (i = 0; i < blockSize; i++) {
+        int32_t x = pSrc[i];
+        sum += x;
+        sumSq += x * x;
+    }
+
+    // n^2 times the variance, the samples are scaled by n and shifted by the sum below
+    uint64_t energy = (uint64_t)((int64_t)blockSize * sumSq - sum * sum);
+    int32_t gain = 0;
+    int32_t shift = 0;
+
+    if (energy != 0) {
+        plp_normalize_gain_q16(energy, (uint64_t)1 << fracBits, &gain, &shift);
+    }
+
+    for (i = 0; i < blockSize; i++) {
+        pDst[i] = plp_normalize_apply_q16((int64_t)pSrc[i] * blockSize - sum, gain, shift);
+    }
+}
+
+/**
+  @} end of NormalizeKernels group
+ */
@@ -0,0 +1,122 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_percentile_f32p_xpulpv2.c
+ * Description:  Parallel percentile of a 32-bit float vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+// maps the bit pattern of a float to an unsigned key with the same ordering, such that the samples
+// are compared with integer instructions only
+#define PERCENTILE_KEY(x) ((uint32_t)(x) ^ ((uint32_t)((x) >> 31) | 0x80000000U))
+
+/**
+   @ingroup percentile
+*/
+
+/**
+   @addtogroup percentileKernels
+   @{
+*/
+
+/**
+   @brief Parallel rank selection of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_percentile_instance_f32 struct initialized by
+                          plp_percentile_f32_parallel
+   @return     none
+*/
+
+void plp_percentile_f32p_xpulpv2(void *task_args) {
+
+    plp_percentile_instance_f32 *S = (plp_percentile_instance_f32 *)task_args;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t chunk = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start = MIN(core_id * chunk, S->blockSize);
+    uint32_t blockSize = MIN(start + chunk, S->blockSize) - start;
+    const int32_t *pBits = (const int32_t *)S->pSrc + start;
+    uint32_t *pCount = S->pCount + 16 * core_id;
+
+    uint32_t blkCnt;
+    uint32_t core;
+    uint32_t digit;
+    uint32_t key;
+    uint32_t total;
+    uint32_t k = S->k;
+    uint32_t prefix = 0; // digits of the selected key found so far
+    uint32_t mask = 0;   // bits of the key covered by prefix
+    int32_t shift;
+
+    union {
+        float f;
+        uint32_t i;
+    } conv;
+
+    for (shift = 28; shift >= 0; shift -= 4) {
+
+        for (digit = 0; digit < 16; digit++) {
+            pCount[digit] = 0;
+        }
+
+        for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+            key = PERCENTILE_KEY(pBits[blkCnt]);
+            if ((key & mask) == prefix) {
+                pCount[(key >> shift) & 0xF]++;
+            }
+        }
+
+        rt_team_barrier();
+
+        // every core combines the counts on its own and follows the same digit
+        for (digit = 0; digit < 16; digit++) {
+            total = 0;
+            for (core = 0; core < S->nPE; core++) {
+                total += S->pCount[16 * core + digit];
+            }
+            if (k < total) {
+                break;
+            }
+            k -= total;
+        }
+
+        prefix |= digit << shift;
+        mask |= 0xFU << shift;
+
+        // the counts are overwritten in the next pass
+        rt_team_barrier();
+    }
+
+    if (core_id == 0) {
+        // positive numbers have the sign bit set in their key, negative ones are inverted
+        conv.i = (prefix & 0x80000000U) ? (prefix ^ 0x80000000U) : ~prefix;
+        *S->pRes = conv.f;
+    }
+}
+
+/**
+   @} end of percentileKernels group
+*/
@@ -0,0 +1,136 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_percentile_f32s_xpulpv2.c
+ * Description:  Percentile of a 32-bit float vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// maps the bit pattern of a float to an unsigned key with the same ordering, such that the samples
+// are compared with integer instructions only
+#define PERCENTILE_KEY(x) ((uint32_t)(x) ^ ((uint32_t)((x) >> 31) | 0x80000000U))
+
+/**
+   @ingroup percentile
+*/
+
+/**
+   @defgroup percentileKernels Percentile Kernels
+*/
+
+/**
+   @addtogroup percentileKernels
+   @{
+*/
+
+/**
+   @brief Sample of a given rank of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  k          rank of the sample to select, 0 selects the minimum
+   @param[out] pRes       selected sample returned here
+   @return     none
+
+   @par The input is left untouched. The sample is found with 8 counting passes over the input,
+   each resolving four bits of the result.
+*/
+
+void plp_percentile_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 uint32_t k,
+                                 float *__restrict__ pRes) {
+
+    const int32_t *pBits = (const int32_t *)pSrc;
+    uint32_t blkCnt;
+    uint32_t digit;
+    uint32_t key;
+#if defined(PLP_MATH_LOOPUNROLL)
+    uint32_t key2;
+#endif
+    uint32_t count[16];
+    uint32_t prefix = 0; // digits of the selected key found so far
+    uint32_t mask = 0;   // bits of the key covered by prefix
+    int32_t shift;
+
+    union {
+        float f;
+        uint32_t i;
+    } conv;
+
+    // radix select, four bits of the key per pass starting with the most significant digit. Only
+    // the samples whose key starts with the digits found so far are counted in each pass.
+    for (shift = 28; shift >= 0; shift -= 4) {
+
+        for (digit = 0; digit < 16; digit++) {
+            count[digit] = 0;
+        }
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+        for (blkCnt = 0; blkCnt < (blockSize & ~0x1U); blkCnt += 2) {
+            key = PERCENTILE_KEY(pBits[blkCnt]);
+            key2 = PERCENTILE_KEY(pBits[blkCnt + 1]);
+            if ((key & mask) == prefix) {
+                count[(key >> shift) & 0xF]++;
+            }
+            if ((key2 & mask) == prefix) {
+                count[(key2 >> shift) & 0xF]++;
+            }
+        }
+
+        if (blockSize & 0x1) {
+            key = PERCENTILE_KEY(pBits[blkCnt]);
+            if ((key & mask) == prefix) {
+                count[(key >> shift) & 0xF]++;
+            }
+        }
+
+#else // PLP_MATH_LOOPUNROLL
+
+        for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+            key = PERCENTILE_KEY(pBits[blkCnt]);
+            if ((key & mask) == prefix) {
+                count[(key >> shift) & 0xF]++;
+            }
+        }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+        for (digit = 0; k >= count[digit]; digit++) {
+            k -= count[digit];
+        }
+
+        prefix |= digit << shift;
+        mask |= 0xFU << shift;
+    }
+
+    // positive numbers have the sign bit set in their key, negative ones are inverted
+    conv.i = (prefix & 0x80000000U) ? (prefix ^ 0x80000000U) : ~prefix;
+    *pRes = conv.f;
+}
+
+/**
+   @} end of percentileKernels group
+*/
@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_percentile_i16p_xpulpv2.c
+ * Description:  Parallel percentile of a 16-bit integer vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+// maps the samples to unsigned keys with the same ordering
+#define PERCENTILE_KEY(x) ((uint32_t)(uint16_t)(x) ^ 0x8000U)
+
+/**
+   @ingroup percentile
+*/
+
+/**
+   @addtogroup percentileKernels
+   @{
+*/
+
+/**
+   @brief Parallel rank selection of a 16-bit integer vector for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_percentile_instance_i16 struct initialized by
+                          plp_percentile_i16_parallel
+   @return     none
+*/
+
+void plp_percentile_i16p_xpulpv2(void *task_args) {
+
+    plp_percentile_instance_i16 *S = (plp_percentile_instance_i16 *)task_args;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t chunk = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start = MIN(core_id * chunk, S->blockSize);
+    uint32_t blockSize = MIN(start + chunk, S->blockSize) - start;
+    const int16_t *pSrc = S->pSrc + start;
+    uint32_t *pCount = S->pCount + 16 * core_id;
+
+    uint32_t blkCnt;
+    uint32_t core;
+    uint32_t digit;
+    uint32_t key;
+    uint32_t total;
+    uint32_t k = S->k;
+    uint32_t prefix = 0; // digits of the selected key found so far
+    uint32_t mask = 0;   // bits of the key covered by prefix
+    int32_t shift;
+
+    for (shift = 12; shift >= 0; shift -= 4) {
+
+        for (digit = 0; digit < 16; digit++) {
+            pCount[digit] = 0;
+        }
+
+        for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+            key = PERCENTILE_KEY(pSrc[blkCnt]);
+            if ((key & mask) == prefix) {
+                pCount[(key >> shift) & 0xF]++;
+            }
+        }
+
+        rt_team_barrier();
+
+        // every core combines the counts on its own and follows the same digit
+        for (digit = 0; digit < 16; digit++) {
+            total = 0;
+            for (core = 0; core < S->nPE; core++) {
+                total += S->pCount[16 * core + digit];
+            }
+            if (k < total) {
+                break;
+            }
+            k -= total;
+        }
+
+        prefix |= digit << shift;
+        mask |= 0xFU << shift;
+
+        // the counts are overwritten in the next pass
+        rt_team_barrier();
+    }
+
+    if (core_id == 0) {
+        *S->pRes = (int16_t)(prefix ^ 0x8000U);
+    }
+}
+
+/**
+   @} end of percentileKernels group
+*/
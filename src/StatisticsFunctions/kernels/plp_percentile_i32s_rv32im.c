@@ -0,0 +1,100 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_percentile_i32s_rv32im.c
+ * Description:  Percentile of a 32-bit integer vector on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// maps the samples to unsigned keys with the same ordering
+#define PERCENTILE_KEY(x) ((uint32_t)(x) ^ 0x80000000U)
+
+/**
+   @ingroup percentile
+*/
+
+/**
+   @defgroup percentileKernels Percentile Kernels
+*/
+
+/**
+   @addtogroup percentileKernels
+   @{
+*/
+
+/**
+   @brief Sample of a given rank of a 32-bit integer vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  k          rank of the sample to select, 0 selects the minimum
+   @param[out] pRes       selected sample returned here
+   @return     none
+
+   @par The input is left untouched. The sample is found with 8 counting passes over the input,
+   each resolving four bits of the result.
+*/
+
+void plp_percentile_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                uint32_t k,
+                                int32_t *__restrict__ pRes) {
+
+    uint32_t blkCnt;
+    uint32_t digit;
+    uint32_t key;
+    uint32_t count[16];
+    uint32_t prefix = 0; // digits of the selected key found so far
+    uint32_t mask = 0;   // bits of the key covered by prefix
+    int32_t shift;
+
+    // radix select, four bits of the key per pass starting with the most significant digit. Only
+    // the samples whose key starts with the digits found so far are counted in each pass.
+    for (shift = 28; shift >= 0; shift -= 4) {
+
+        for (digit = 0; digit < 16; digit++) {
+            count[digit] = 0;
+        }
+
+        for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+            key = PERCENTILE_KEY(pSrc[blkCnt]);
+            if ((key & mask) == prefix) {
+                count[(key >> shift) & 0xF]++;
+            }
+        }
+
+        for (digit = 0; k >= count[digit]; digit++) {
+            k -= count[digit];
+        }
+
+        prefix |= digit << shift;
+        mask |= 0xFU << shift;
+    }
+
+    *pRes = (int32_t)(prefix ^ 0x80000000U);
+}
+
+/**
+   @} end of percentileKernels group
+*/
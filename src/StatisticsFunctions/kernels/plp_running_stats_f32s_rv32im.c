@@ -0,0 +1,118 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_f32s_rv32im.c
+ * Description:  Running statistics of a 32-bit float signal on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup runningStats
+*/
+
+/**
+   @defgroup runningStatsKernels Running Statistics Kernels
+*/
+
+/**
+   @addtogroup runningStatsKernels
+   @{
+*/
+
+/**
+   @brief Running statistics of a 32-bit float signal for RV32IM extension.
+   @param[in]  S          points to the instance initialized by plp_running_stats_init_f32
+   @param[in]  pSrc       points to the hopSize new samples
+   @param[in]  hopSize    number of new samples
+   @param[out] pMean      mean of the window returned here
+   @param[out] pVar       variance of the window returned here
+   @param[out] pRms       mean of the squared samples of the window returned here
+   @return     none
+*/
+
+void plp_running_stats_f32s_rv32im(plp_running_stats_instance_f32 *S,
+                                   const float *__restrict__ pSrc,
+                                   uint32_t hopSize,
+                                   float *__restrict__ pMean,
+                                   float *__restrict__ pVar,
+                                   float *__restrict__ pRms) {
+
+    float *pState = S->pState;
+    uint32_t windowLen = S->windowLen;
+    uint32_t index = S->index;
+    float sum = S->sum;
+    float sumSq = S->sumSq;
+    uint32_t blkCnt;
+    uint32_t segLen;
+    float xNew, xOld;
+
+    while (hopSize > 0) {
+        // replace the oldest samples up to the end of the circular buffer in one run
+        segLen = MIN(hopSize, windowLen - index);
+        hopSize -= segLen;
+
+        for (blkCnt = 0; blkCnt < segLen; blkCnt++) {
+            xNew = *pSrc++;
+            xOld = pState[index];
+            pState[index++] = xNew;
+            sum += xNew - xOld;
+            sumSq += xNew * xNew - xOld * xOld;
+        }
+
+        if (index == windowLen) {
+            index = 0;
+
+            // recompute the sums once per window length, which discards the rounding errors of the
+            // incremental updates
+            sum = 0.0f;
+            sumSq = 0.0f;
+            for (blkCnt = 0; blkCnt < windowLen; blkCnt++) {
+                sum += pState[blkCnt];
+                sumSq += pState[blkCnt] * pState[blkCnt];
+            }
+        }
+    }
+
+    S->index = index;
+    S->sum = sum;
+    S->sumSq = sumSq;
+
+    float mean = sum / windowLen;
+    float var = sumSq / windowLen - mean * mean;
+
+    if (var < 0.0f) {
+        var = 0.0f;
+    }
+
+    *pMean = mean;
+    *pVar = var;
+    *pRms = sumSq / windowLen;
+}
+
+/**
+   @} end of runningStatsKernels group
+*/
@@ -0,0 +1,139 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_q32s_xpulpv2.c
+ * Description:  Running statistics of a 32-bit fixed point signal on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup runningStats
+*/
+
+/**
+   @defgroup runningStatsKernels Running Statistics Kernels
+*/
+
+/**
+   @addtogroup runningStatsKernels
+   @{
+*/
+
+/**
+   @brief Running statistics of a 32-bit fixed point signal for XPULPV2 extension.
+   @param[in]  S          points to the instance initialized by plp_running_stats_init_q32
+   @param[in]  pSrc       points to the hopSize new samples
+   @param[in]  hopSize    number of new samples
+   @param[out] pMean      mean of the window returned here
+   @param[out] pVar       variance of the window returned here
+   @param[out] pRms       mean of the squared samples of the window returned here
+   @return     none
+*/
+
+void plp_running_stats_q32s_xpulpv2(plp_running_stats_instance_q32 *S,
+                                    const int32_t *__restrict__ pSrc,
+                                    uint32_t hopSize,
+                                    int32_t *__restrict__ pMean,
+                                    int32_t *__restrict__ pVar,
+                                    int32_t *__restrict__ pRms) {
+
+    int32_t *pState = S->pState;
+    uint32_t windowLen = S->windowLen;
+    uint32_t fracBits = S->fracBits;
+    uint32_t index = S->index;
+    int64_t sum = S->sum;
+    int64_t sumSq = S->sumSq;
+    uint32_t blkCnt;
+    uint32_t segLen;
+    int32_t xNew, xOld;
+
+    while (hopSize > 0) {
+        // replace the oldest samples up to the end of the circular buffer in one run
+        segLen = MIN(hopSize, windowLen - index);
+        hopSize -= segLen;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+        for (blkCnt = 0; blkCnt < (segLen >> 1); blkCnt++) {
+            xNew = *pSrc++;
+            xOld = pState[index];
+            pState[index++] = xNew;
+            sum += (int64_t)xNew - xOld;
+            sumSq += (((int64_t)xNew * xNew) >> fracBits) - (((int64_t)xOld * xOld) >> fracBits);
+            xNew = *pSrc++;
+            xOld = pState[index];
+            pState[index++] = xNew;
+            sum += (int64_t)xNew - xOld;
+            sumSq += (((int64_t)xNew * xNew) >> fracBits) - (((int64_t)xOld * xOld) >> fracBits);
+        }
+
+        if (segLen & 0x1) {
+            xNew = *pSrc++;
+            xOld = pState[index];
+            pState[index++] = xNew;
+            sum += (int64_t)xNew - xOld;
+            sumSq += (((int64_t)xNew * xNew) >> fracBits) - (((int64_t)xOld * xOld) >> fracBits);
+        }
+
+#else // PLP_MATH_LOOPUNROLL
+
+        for (blkCnt = 0; blkCnt < segLen; blkCnt++) {
+            xNew = *pSrc++;
+            xOld = pState[index];
+            pState[index++] = xNew;
+            sum += (int64_t)xNew - xOld;
+            sumSq += (((int64_t)xNew * xNew) >> fracBits) - (((int64_t)xOld * xOld) >> fracBits);
+        }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+        if (index == windowLen) {
+            index = 0;
+        }
+    }
+
+    S->index = index;
+    S->sum = sum;
+    S->sumSq = sumSq;
+
+    int64_t mean = sum / windowLen;
+    int64_t meanSq = sumSq / windowLen;
+    int64_t var = meanSq - ((mean * mean) >> fracBits);
+
+    // the squares are truncated one by one, which can push a tiny variance below zero
+    if (var < 0) {
+        var = 0;
+    }
+
+    *pMean = (int32_t)mean;
+    *pVar = (int32_t)var;
+    *pRms = (int32_t)meanSq;
+}
+
+/**
+   @} end of runningStatsKernels group
+*/
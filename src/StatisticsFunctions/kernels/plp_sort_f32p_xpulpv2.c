@@ -0,0 +1,110 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sort_f32p_xpulpv2.c
+ * Description:  Parallel sorting of a 32-bit float vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+// maps the bit pattern of a float to an unsigned key with the same ordering, such that the samples
+// are compared with integer instructions only
+#define SORT_KEY(x) ((uint32_t)(x) ^ ((uint32_t)((x) >> 31) | 0x80000000U))
+
+/**
+   @ingroup sort
+*/
+
+/**
+   @addtogroup sortKernels
+   @{
+*/
+
+/**
+   @brief Parallel sorting of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_sort_instance_f32 struct initialized by
+                          plp_sort_f32_parallel
+   @return     none
+*/
+
+void plp_sort_f32p_xpulpv2(void *task_args) {
+
+    plp_sort_instance_f32 *S = (plp_sort_instance_f32 *)task_args;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t chunk = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start = MIN(core_id * chunk, S->blockSize);
+    uint32_t end = MIN(start + chunk, S->blockSize);
+    uint32_t *pCount = S->pCount + 16 * core_id;
+    const int32_t *pIn = (const int32_t *)S->pSrc;
+    int32_t *pOut = (int32_t *)S->pTmp;
+
+    uint32_t blkCnt;
+    uint32_t core;
+    uint32_t digit;
+    uint32_t offset;
+    uint32_t pos[16];
+    int32_t shift;
+
+    for (shift = 0; shift < 32; shift += 4) {
+
+        for (digit = 0; digit < 16; digit++) {
+            pCount[digit] = 0;
+        }
+
+        for (blkCnt = start; blkCnt < end; blkCnt++) {
+            pCount[(SORT_KEY(pIn[blkCnt]) >> shift) & 0xF]++;
+        }
+
+        rt_team_barrier();
+
+        // the samples of this core with a given digit follow all samples with a smaller digit, and
+        // the samples of the previous cores with the same digit
+        offset = 0;
+        for (digit = 0; digit < 16; digit++) {
+            for (core = 0; core < S->nPE; core++) {
+                if (core == core_id) {
+                    pos[digit] = offset;
+                }
+                offset += S->pCount[16 * core + digit];
+            }
+        }
+
+        for (blkCnt = start; blkCnt < end; blkCnt++) {
+            pOut[pos[(SORT_KEY(pIn[blkCnt]) >> shift) & 0xF]++] = pIn[blkCnt];
+        }
+
+        // the output is read by all cores in the next pass, which also overwrites the counts
+        rt_team_barrier();
+
+        pIn = pOut;
+        pOut = (pOut == (int32_t *)S->pTmp) ? (int32_t *)S->pDst : (int32_t *)S->pTmp;
+    }
+}
+
+/**
+   @} end of sortKernels group
+*/
@@ -0,0 +1,123 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sort_f32s_xpulpv2.c
+ * Description:  Sorting of a 32-bit float vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// maps the bit pattern of a float to an unsigned key with the same ordering, such that the samples
+// are compared with integer instructions only
+#define SORT_KEY(x) ((uint32_t)(x) ^ ((uint32_t)((x) >> 31) | 0x80000000U))
+
+/**
+   @ingroup sort
+*/
+
+/**
+   @defgroup sortKernels Sorting Kernels
+*/
+
+/**
+   @addtogroup sortKernels
+   @{
+*/
+
+/**
+   @brief Sorting of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  pTmp       points to a temporary buffer of blockSize samples
+   @param[out] pDst       points to the output vector, sorted in ascending order, may equal pSrc
+   @return     none
+
+   @par Least significant digit radix sort with 8 passes over the data, each sorting the
+   samples stably by the next four bits of their key. The passes alternate between pTmp and
+   pDst, such that the last one writes pDst.
+*/
+
+void plp_sort_f32s_xpulpv2(const float *pSrc,
+                           uint32_t blockSize,
+                           float *pTmp,
+                           float *pDst) {
+
+    const int32_t *pIn = (const int32_t *)pSrc;
+    int32_t *pOut = (int32_t *)pTmp;
+    uint32_t blkCnt;
+    uint32_t digit;
+    uint32_t start;
+#if defined(PLP_MATH_LOOPUNROLL)
+    uint32_t key;
+    uint32_t key2;
+#endif
+    uint32_t count[16];
+    int32_t shift;
+
+    for (shift = 0; shift < 32; shift += 4) {
+
+        for (digit = 0; digit < 16; digit++) {
+            count[digit] = 0;
+        }
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+        for (blkCnt = 0; blkCnt < (blockSize & ~0x1U); blkCnt += 2) {
+            key = SORT_KEY(pIn[blkCnt]);
+            key2 = SORT_KEY(pIn[blkCnt + 1]);
+            count[(key >> shift) & 0xF]++;
+            count[(key2 >> shift) & 0xF]++;
+        }
+
+        if (blockSize & 0x1) {
+            count[(SORT_KEY(pIn[blkCnt]) >> shift) & 0xF]++;
+        }
+
+#else // PLP_MATH_LOOPUNROLL
+
+        for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+            count[(SORT_KEY(pIn[blkCnt]) >> shift) & 0xF]++;
+        }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+        // position of the first sample with every digit in the output
+        start = 0;
+        for (digit = 0; digit < 16; digit++) {
+            start += count[digit];
+            count[digit] = start - count[digit];
+        }
+
+        for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+            pOut[count[(SORT_KEY(pIn[blkCnt]) >> shift) & 0xF]++] = pIn[blkCnt];
+        }
+
+        pIn = pOut;
+        pOut = (pOut == (int32_t *)pTmp) ? (int32_t *)pDst : (int32_t *)pTmp;
+    }
+}
+
+/**
+   @} end of sortKernels group
+*/
@@ -0,0 +1,101 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sort_i16s_rv32im.c
+ * Description:  Sorting of a 16-bit integer vector on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// maps the samples to unsigned keys with the same ordering
+#define SORT_KEY(x) ((uint32_t)(uint16_t)(x) ^ 0x8000U)
+
+/**
+   @ingroup sort
+*/
+
+/**
+   @defgroup sortKernels Sorting Kernels
+*/
+
+/**
+   @addtogroup sortKernels
+   @{
+*/
+
+/**
+   @brief Sorting of a 16-bit integer vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  pTmp       points to a temporary buffer of blockSize samples
+   @param[out] pDst       points to the output vector, sorted in ascending order, may equal pSrc
+   @return     none
+
+   @par Least significant digit radix sort with 4 passes over the data, each sorting the
+   samples stably by the next four bits of their key. The passes alternate between pTmp and
+   pDst, such that the last one writes pDst.
+*/
+
+void plp_sort_i16s_rv32im(const int16_t *pSrc,
+                          uint32_t blockSize,
+                          int16_t *pTmp,
+                          int16_t *pDst) {
+
+    const int16_t *pIn = pSrc;
+    int16_t *pOut = pTmp;
+    uint32_t blkCnt;
+    uint32_t digit;
+    uint32_t start;
+    uint32_t count[16];
+    int32_t shift;
+
+    for (shift = 0; shift < 16; shift += 4) {
+
+        for (digit = 0; digit < 16; digit++) {
+            count[digit] = 0;
+        }
+
+        for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+            count[(SORT_KEY(pIn[blkCnt]) >> shift) & 0xF]++;
+        }
+
+        // position of the first sample with every digit in the output
+        start = 0;
+        for (digit = 0; digit < 16; digit++) {
+            start += count[digit];
+            count[digit] = start - count[digit];
+        }
+
+        for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+            pOut[count[(SORT_KEY(pIn[blkCnt]) >> shift) & 0xF]++] = pIn[blkCnt];
+        }
+
+        pIn = pOut;
+        pOut = (pOut == pTmp) ? pDst : pTmp;
+    }
+}
+
+/**
+   @} end of sortKernels group
+*/
@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_std_f16s_xpulpv2.c
+ * Description:  Standard deviation of a half-precision float vector for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup std
+ */
+
+/**
+  @addtogroup stdKernels
+  @{
+ */
+
+/**
+   @brief         Standard deviation of a half-precision float vector for XPULPV2 extension with the
+                  smallFloat extensions.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[out]    pRes       standard deviation returned here
+   @return        none
+*/
+
+void plp_std_f16s_xpulpv2(const float16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float16_t *__restrict__ pRes) {
+
+    float16_t variance;
+    float32_t variance32, res;
+
+    plp_var_f16s_xpulpv2(pSrc, blockSize, &variance);
+    variance32 = plp_f16_to_f32(variance);
+    plp_sqrt_f32(&variance32, &res);
+    *pRes = plp_f32_to_f16(res);
+}
+
+/**
+   @} end of stdKernels group
+*/
@@ -0,0 +1,59 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_std_f32s_rv32im.c
+ * Description:  Standard deviation of a 32-bit float vector on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup std
+*/
+
+/**
+   @addtogroup stdKernels
+   @{
+*/
+
+/**
+   @brief Standard deviation of a 32-bit float vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[out] pRes       standard deviation returned here
+   @return     none
+*/
+
+void plp_std_f32s_rv32im(const float *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float *__restrict__ pRes) {
+
+    float variance;
+    plp_var_f32s_rv32im(pSrc, blockSize, &variance);
+    plp_sqrt_f32s_rv32im(&variance, pRes);
+}
+
+/**
+   @} end of stdKernels group
+*/
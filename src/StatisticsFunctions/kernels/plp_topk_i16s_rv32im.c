@@ -0,0 +1,119 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_topk_i16s_rv32im.c
+ * Description:  Top-k selection of a 16-bit integer vector on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// maps the samples to unsigned keys with the same ordering
+#define SORT_KEY(x) ((uint32_t)(uint16_t)(x) ^ 0x8000U)
+
+/**
+   @ingroup sort
+*/
+
+/**
+   @defgroup sortKernels Sorting Kernels
+*/
+
+/**
+   @addtogroup sortKernels
+   @{
+*/
+
+/**
+   @brief k largest samples of a 16-bit integer vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  k          number of samples to select, at most blockSize
+   @param[out] pDst       points to the k largest samples, in descending order
+   @param[out] pIndex     points to the indices of the k largest samples
+   @return     none
+
+   @par The k-th largest sample is found with the radix selection of
+   plp_percentile_i16s_rv32im. The samples above it, followed by as many samples equal to it
+   as needed, are gathered in the order of the input and sorted by insertion, which is
+   intended for k much smaller than blockSize.
+*/
+
+void plp_topk_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t k,
+                          int16_t *__restrict__ pDst,
+                          uint32_t *__restrict__ pIndex) {
+
+    int16_t *pOut = pDst;
+    uint32_t blkCnt;
+    uint32_t i;
+    uint32_t j;
+    uint32_t index;
+    uint32_t key;
+    uint32_t threshold;
+    uint32_t nEqual;
+    uint32_t pos = 0;
+    int16_t value;
+
+    if (k == 0) {
+        return;
+    }
+
+    // k-th largest sample, written to the first output temporarily
+    plp_percentile_i16s_rv32im(pSrc, blockSize, blockSize - k, pDst);
+    threshold = SORT_KEY(pOut[0]);
+
+    // number of samples equal to the threshold among the k largest
+    nEqual = k;
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        nEqual -= (SORT_KEY(pSrc[blkCnt]) > threshold);
+    }
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        key = SORT_KEY(pSrc[blkCnt]);
+        if (key > threshold || (key == threshold && nEqual > 0)) {
+            nEqual -= (key == threshold);
+            pOut[pos] = pSrc[blkCnt];
+            pIndex[pos++] = blkCnt;
+        }
+    }
+
+    // insertion sort of the k selected samples, which keeps equal samples in the order of the
+    // input
+    for (i = 1; i < k; i++) {
+        value = pOut[i];
+        index = pIndex[i];
+        key = SORT_KEY(value);
+        for (j = i; j > 0 && SORT_KEY(pOut[j - 1]) < key; j--) {
+            pOut[j] = pOut[j - 1];
+            pIndex[j] = pIndex[j - 1];
+        }
+        pOut[j] = value;
+        pIndex[j] = index;
+    }
+}
+
+/**
+   @} end of sortKernels group
+*/
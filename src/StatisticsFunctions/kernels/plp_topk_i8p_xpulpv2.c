@@ -0,0 +1,150 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_topk_i8p_xpulpv2.c
+ * Description:  Parallel top-k selection of a 8-bit integer vector on XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+// maps the samples to unsigned keys with the same ordering
+#define SORT_KEY(x) ((uint32_t)(uint8_t)(x) ^ 0x80U)
+
+/**
+   @ingroup sort
+*/
+
+/**
+   @addtogroup sortKernels
+   @{
+*/
+
+/**
+   @brief Parallel top-k selection of a 8-bit integer vector for XPULPV2 extension.
+   @param[in]  task_args  pointer to plp_topk_instance_i8 struct initialized by
+                          plp_topk_i8_parallel
+   @return     none
+*/
+
+void plp_topk_i8p_xpulpv2(void *task_args) {
+
+    plp_topk_instance_i8 *S = (plp_topk_instance_i8 *)task_args;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t chunk = (S->blockSize + S->nPE - 1) / S->nPE;
+    uint32_t start = MIN(core_id * chunk, S->blockSize);
+    uint32_t end = MIN(start + chunk, S->blockSize);
+    uint32_t *pCount = S->pCount + 2 * core_id;
+    const int8_t *pSrc = S->pSrc;
+    int8_t *pOut = S->pDst;
+    uint32_t *pIndex = S->pIndex;
+    uint32_t k = S->k;
+
+    uint32_t blkCnt;
+    uint32_t core;
+    uint32_t i;
+    uint32_t j;
+    uint32_t index;
+    uint32_t key;
+    uint32_t threshold;
+    uint32_t nAbove = 0;
+    uint32_t nEqual = 0;
+    uint32_t nEqualBefore = 0;
+    uint32_t pos = 0;
+    int8_t value;
+
+    // k-th largest sample, written to the first output by core 0
+    plp_percentile_instance_i8 select = { .pSrc = S->pSrc,
+                                          .blockSize = S->blockSize,
+                                          .k = S->blockSize - k,
+                                          .nPE = S->nPE,
+                                          .pCount = S->pCount,
+                                          .pRes = S->pDst };
+
+    if (k == 0) {
+        return;
+    }
+
+    plp_percentile_i8p_xpulpv2(&select);
+
+    rt_team_barrier();
+
+    threshold = SORT_KEY(pOut[0]);
+
+    for (blkCnt = start; blkCnt < end; blkCnt++) {
+        key = SORT_KEY(pSrc[blkCnt]);
+        nAbove += (key > threshold);
+        nEqual += (key == threshold);
+    }
+
+    pCount[0] = nAbove;
+    pCount[1] = nEqual;
+
+    rt_team_barrier();
+
+    // the samples of this core follow the selected samples of the previous cores. Only the first
+    // samples equal to the threshold are selected, up to k samples in total.
+    nEqual = k;
+    for (core = 0; core < S->nPE; core++) {
+        if (core < core_id) {
+            pos += S->pCount[2 * core];
+            nEqualBefore += S->pCount[2 * core + 1];
+        }
+        nEqual -= S->pCount[2 * core];
+    }
+    pos += MIN(nEqualBefore, nEqual);
+
+    for (blkCnt = start; blkCnt < end; blkCnt++) {
+        key = SORT_KEY(pSrc[blkCnt]);
+        if (key > threshold || (key == threshold && nEqualBefore < nEqual)) {
+            nEqualBefore += (key == threshold);
+            pOut[pos] = pSrc[blkCnt];
+            pIndex[pos++] = blkCnt;
+        }
+    }
+
+    rt_team_barrier();
+
+    if (core_id == 0) {
+        // insertion sort of the k selected samples, which keeps equal samples in the order of the
+        // input
+        for (i = 1; i < k; i++) {
+            value = pOut[i];
+            index = pIndex[i];
+            key = SORT_KEY(value);
+            for (j = i; j > 0 && SORT_KEY(pOut[j - 1]) < key; j--) {
+                pOut[j] = pOut[j - 1];
+                pIndex[j] = pIndex[j - 1];
+            }
+            pOut[j] = value;
+            pIndex[j] = index;
+        }
+    }
+}
+
+/**
+   @} end of sortKernels group
+*/
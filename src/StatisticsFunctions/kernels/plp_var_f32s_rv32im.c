@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_var_f32s_rv32im.c
+ * Description:  Variance of a 32-bit float vector on RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup var
+*/
+
+/**
+   @addtogroup varKernels
+   @{
+*/
+
+/**
+   @brief Variance value of a 32-bit float vector for RV32IM extension.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[out] pRes       variance value returned here
+   @return     none
+*/
+
+void plp_var_f32s_rv32im(const float *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float *__restrict__ pRes) {
+
+    uint32_t blkCnt;
+    float shift = pSrc[0]; // all samples are shifted by the first one to avoid cancellation
+    float sum = 0.0f;      // sum of the shifted samples
+    float sumSq = 0.0f;    // sum of the squared shifted samples
+    float x;
+
+    for (blkCnt = 0; blkCnt < blockSize; blkCnt++) {
+        x = pSrc[blkCnt] - shift;
+        sum += x;
+        sumSq += x * x;
+    }
+
+    float mean = sum / blockSize;
+    float var = sumSq / blockSize - mean * mean;
+
+    if (var < 0.0f) {
+        var = 0.0f;
+    }
+
+    *pRes = var;
+}
+
+/**
+   @} end of varKernels group
+*/
@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_argmax_i16_parallel.c
+ * Description:  Parallel ArgMax of a 16-bit integer vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup argmax
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel maximum and its index of a 16-bit integer vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pRes       maximum value returned here
+   @param[out] pIndex     index of the first occurrence of the maximum returned here
+   @return     none
+
+   @par Every core searches a contiguous chunk of the input. The per core results are reduced in
+   core order after the join, so ties resolve to the first occurrence as in the single core version.
+*/
+
+void plp_argmax_i16_parallel(const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int16_t *__restrict__ pRes,
+                             uint32_t *__restrict__ pIndex) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t i;
+        int16_t maxBuffer[nPE];
+        uint32_t maxIndexBuffer[nPE];
+
+        plp_minmax_instance_i16 S = { .pSrc = pSrc,
+                                      .blockSize = blockSize,
+                                      .nPE = nPE,
+                                      .pMax = maxBuffer,
+                                      .pMaxIndex = maxIndexBuffer };
+
+        rt_team_fork(nPE, plp_argmax_i16p_xpulpv2, (void *)&S);
+
+        int16_t max = maxBuffer[0];
+        uint32_t maxIndex = maxIndexBuffer[0];
+
+        for (i = 1; i < nPE; i++) {
+            if (maxBuffer[i] > max) {
+                max = maxBuffer[i];
+                maxIndex = maxIndexBuffer[i];
+            }
+        }
+
+        *pRes = max;
+        *pIndex = maxIndex;
+    }
+}
+
+/**
+   @} end of argmax group
+*/
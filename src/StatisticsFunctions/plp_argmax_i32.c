@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_argmax_i32.c
+ * Description:  ArgMax of a 32-bit integer vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup argmax ArgMax
+   Maximum and its index of a vector, found in a single pass. If the extremum occurs
+   more than once, the index of its first occurrence is returned.
+*/
+
+/**
+   @addtogroup argmax
+   @{
+*/
+
+/**
+   @brief Glue code for the maximum and its index of a 32-bit integer vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[out] pRes       maximum value returned here
+   @param[out] pIndex     index of the first occurrence of the maximum returned here
+   @return     none
+*/
+
+void plp_argmax_i32(const int32_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    int32_t *__restrict__ pRes,
+                    uint32_t *__restrict__ pIndex) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_argmax_i32s_rv32im(pSrc, blockSize, pRes, pIndex);
+    } else {
+        plp_argmax_i32s_xpulpv2(pSrc, blockSize, pRes, pIndex);
+    }
+}
+
+/**
+   @} end of argmax group
+*/
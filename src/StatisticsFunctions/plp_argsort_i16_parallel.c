@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_argsort_i16_parallel.c
+ * Description:  Parallel index sorting of a 16-bit integer vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup sort
+   @{
+*/
+
+/**
+   @brief Glue code for the indices that sort a 16-bit integer vector, computed in parallel.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  nPE        number of parallel processing units
+   @param[in]  pTmp       points to a temporary buffer of blockSize indices
+   @param[out] pIndex     points to the blockSize indices of the samples in ascending order
+   @return     none
+
+   @par The indices are sorted like the samples in plp_sort_i16_parallel, with the digit
+   counts of every core taken from its chunk of the intermediate index vector.
+*/
+
+void plp_argsort_i16_parallel(const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t nPE,
+                              uint32_t *__restrict__ pTmp,
+                              uint32_t *__restrict__ pIndex) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t countBuffer[16 * nPE];
+
+        plp_argsort_instance_i16 S = { .pSrc = pSrc,
+                                       .blockSize = blockSize,
+                                       .nPE = nPE,
+                                       .pCount = countBuffer,
+                                       .pTmp = pTmp,
+                                       .pIndex = pIndex };
+
+        rt_team_fork(nPE, plp_argsort_i16p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+   @} end of sort group
+*/
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_covariance_f32.c
+ * Description:  Covariance matrix of 32-bit float channels glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup Covariance Covariance
+  This module contains the glue code for the sample covariance matrix of nChannels channels of
+  blockSize samples each,
+  <pre>
+      pCov(i, j) = sum over t of (x(t, i) - mean(i)) * (x(t, j) - mean(j)) / (blockSize - 1),
+  </pre>
+  together with the means of the channels. The input holds one sample of all channels after the
+  other, i.e. it is a blockSize x nChannels matrix. The sums of the samples and of their products
+  are accumulated together, such that neither a separate pass for the means nor a centered copy of
+  the input is needed. As the matrix is symmetric, only the lower triangle (which is the upper
+  triangle stored column by column) is returned, packed row by row as in plp_mat_syrk, see
+  PLP_MAT_PACKED_IDX. The kernel codes are in the module Covariance Kernels.
+
+  The 32-bit float version subtracts the first sample of every channel from all samples before the
+  products are accumulated, which avoids cancellation for channels with a large mean. The 16-bit
+  fixed point version accumulates the exact sums in 64 bits, and computes
+  (blockSize * sum(x y) - sum(x) * sum(y)) / (blockSize * (blockSize - 1)), which is truncated to
+  Q(fracBits) and saturated. For blockSize below 2, the covariance is zero.
+ */
+
+/**
+  @addtogroup Covariance
+  @{
+ */
+
+/**
+  @brief Glue code for covariance matrix of 32-bit float channels.
+  @param[in]  pSrc       points to the input, blockSize x nChannels, one sample of all channels
+                         after the other
+  @param[in]  blockSize  number of samples of every channel
+  @param[in]  nChannels  number of channels
+  @param[out] pMean      points to the means of the nChannels channels
+  @param[out] pCov       points to the packed covariance matrix of
+                         PLP_MAT_PACKED_LEN(nChannels) values
+  @return     none
+ */
+
+void plp_covariance_f32(const float32_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t nChannels,
+                        float32_t *__restrict__ pMean,
+                        float32_t *__restrict__ pCov) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_covariance_f32s_xpulpv2(pSrc, blockSize, nChannels, pMean, pCov);
+    }
+}
+
+/**
+  @} end of Covariance group
+ */
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_covariance_q16_parallel.c
+ * Description:  Parallel covariance matrix of 16-bit fixed point channels glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup Covariance
+  @{
+ */
+
+/**
+  @brief Glue code for parallel covariance matrix of 16-bit fixed point channels.
+  @param[in]  pSrc       points to the input, blockSize x nChannels, one sample of all channels
+                         after the other
+  @param[in]  blockSize  number of samples of every channel, below 65536
+  @param[in]  nChannels  number of channels
+  @param[in]  fracBits   number of fractional bits of the input and the output
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pMean      points to the means of the nChannels channels
+  @param[out] pCov       points to the packed covariance matrix of
+                         PLP_MAT_PACKED_LEN(nChannels) values
+  @return     none
+
+  @par The covariance is computed in blocks of two by two channels, which are distributed
+  among the cores. The blocks are independent, so no barrier is required.
+ */
+
+void plp_covariance_q16_parallel(const int16_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 uint32_t nChannels,
+                                 uint32_t fracBits,
+                                 uint32_t nPE,
+                                 int16_t *__restrict__ pMean,
+                                 int16_t *__restrict__ pCov) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_covariance_instance_q16 S = { .pSrc = pSrc,
+                                      .blockSize = blockSize,
+                                      .nChannels = nChannels,
+                                      .fracBits = fracBits,
+                                      .nPE = nPE,
+                                      .pMean = pMean,
+                                      .pCov = pCov };
+
+    rt_team_fork(nPE, plp_covariance_q16p_xpulpv2, (void *)&S);
+}
+
+/**
+  @} end of Covariance group
+ */
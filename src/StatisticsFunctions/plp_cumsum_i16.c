@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cumsum_i16.c
+ * Description:  Cumulative sum of a 16-bit integer vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup cumsum Cumulative Sum
+   Cumulative sum, or prefix sum, of a vector:
+
+   <pre>
+       pDst[n] = pSrc[0] + pSrc[1] + ... + pSrc[n]    0 <= n < blockSize
+   </pre>
+
+   The 16-bit integer version returns 32-bit sums. The 32-bit integer version wraps around on
+   overflow. The 32-bit fixed point version accumulates in 64 bits and saturates every output to 32
+   bits, such that the output is in the format of the input. The functions can work in-place,
+   i.e., pDst may be equal to pSrc, if the output has the same data type as the input.
+*/
+
+/**
+   @addtogroup cumsum
+   @{
+*/
+
+/**
+   @brief Glue code for the cumulative sum of a 16-bit integer vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[out] pDst       points to the blockSize cumulative sums
+   @return     none
+*/
+
+void plp_cumsum_i16(const int16_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cumsum_i16s_rv32im(pSrc, blockSize, pDst);
+    } else {
+        plp_cumsum_i16s_xpulpv2(pSrc, blockSize, pDst);
+    }
+}
+
+/**
+   @} end of cumsum group
+*/
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cumsum_q32_parallel.c
+ * Description:  Parallel cumulative sum of a 32-bit fixed point vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup cumsum
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel cumulative sum of a 32-bit fixed point vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pDst       points to the blockSize cumulative sums, saturated
+   @return     none
+
+   @par Every core sums a contiguous chunk of the input. After a barrier, every core computes the
+   cumulative sums of its chunk, starting from the sum of all chunks before it.
+*/
+
+void plp_cumsum_q32_parallel(const int32_t *pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        int64_t partialBuffer[nPE];
+
+        plp_cumsum_instance_q32 S = { .pSrc = pSrc,
+                                      .blockSize = blockSize,
+                                      .nPE = nPE,
+                                      .pPartial = partialBuffer,
+                                      .pDst = pDst };
+
+        rt_team_fork(nPE, plp_cumsum_q32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+   @} end of cumsum group
+*/
@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_find_peaks_q16_parallel.c
+ * Description:  Parallel peak finding in a 16-bit fixed point vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup peaks
+   @{
+*/
+
+/**
+   @brief Glue code for the largest peaks of a 16-bit fixed point vector, computed in parallel.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  threshold  smallest value of a peak
+   @param[in]  minDist    number of samples on each side a peak must dominate, 0 acts as 1
+   @param[in]  maxPeaks   largest number of peaks returned
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pIndex     points to the indices of the peaks, maxPeaks words
+   @param[out] pDelta     points to the Q1.15 offsets of the interpolated peaks from their indices
+   @param[out] pValue     points to the interpolated values of the peaks
+   @param[out] pNumPeaks  number of peaks found, at most maxPeaks, returned here
+   @return     none
+
+   @par Every core searches a contiguous segment of the input for peaks and keeps the largest
+   maxPeaks of them. The samples around the borders of the segments are read from the
+   neighbouring segments, such that the peaks are the same as in the single core version. One core
+   merges the lists of all cores and interpolates the selected peaks. The lists take
+   nPE * (maxPeaks + 1) words, allocated with plp_scratch_alloc.
+*/
+
+void plp_find_peaks_q16_parallel(const int16_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 int16_t threshold,
+                                 uint32_t minDist,
+                                 uint32_t maxPeaks,
+                                 uint32_t nPE,
+                                 uint32_t *__restrict__ pIndex,
+                                 int16_t *__restrict__ pDelta,
+                                 int16_t *__restrict__ pValue,
+                                 uint32_t *__restrict__ pNumPeaks) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t tmpSize = nPE * (maxPeaks + 1) * sizeof(uint32_t);
+        uint32_t *pTmp = (uint32_t *)plp_scratch_alloc(tmpSize);
+
+        if (pTmp == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+
+        plp_find_peaks_instance_q16 S = { .pSrc = pSrc,
+                                          .blockSize = blockSize,
+                                          .threshold = threshold,
+                                          .minDist = minDist,
+                                          .maxPeaks = maxPeaks,
+                                          .nPE = nPE,
+                                          .pTmp = pTmp,
+                                          .pIndex = pIndex,
+                                          .pDelta = pDelta,
+                                          .pValue = pValue,
+                                          .pNumPeaks = pNumPeaks };
+
+        rt_team_fork(nPE, plp_find_peaks_q16p_xpulpv2, (void *)&S);
+
+        plp_scratch_free(pTmp, tmpSize);
+    }
+}
+
+/**
+   @} end of peaks group
+*/
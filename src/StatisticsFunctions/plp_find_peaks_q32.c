@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_find_peaks_q32.c
+ * Description:  Peak finding in a 32-bit fixed point vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup peaks Peak Finding
+   Largest local maxima of a vector, e.g. of a magnitude spectrum, refined by parabolic
+   interpolation in the same call. A sample is a peak if it is at least the threshold, larger than
+   the minDist samples before it and not smaller than the minDist samples after it, such that a
+   plateau or several equal maxima closer than minDist count once, at their first sample. The first
+   and the last sample are never peaks. Up to maxPeaks peaks are returned, the largest first and
+   equal peaks in the order of the input.
+
+   The parabola through the peak b = x[k] and its neighbours a = x[k - 1] and c = x[k + 1] has its
+   vertex at k + delta, with delta = (a - c) / (2 (a - 2 b + c)) between -0.5 and 0.5, and its value
+   there is b - (a - c) delta / 4. The fixed point versions return delta in Q1.15 (q16) or Q1.31
+   (q32), and the value in the format of the input, saturated.
+*/
+
+/**
+   @addtogroup peaks
+   @{
+*/
+
+/**
+   @brief Glue code for the largest peaks of a 32-bit fixed point vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  threshold  smallest value of a peak
+   @param[in]  minDist    number of samples on each side a peak must dominate, 0 acts as 1
+   @param[in]  maxPeaks   largest number of peaks returned
+   @param[out] pIndex     points to the indices of the peaks, maxPeaks words
+   @param[out] pDelta     points to the Q1.31 offsets of the interpolated peaks from their indices
+   @param[out] pValue     points to the interpolated values of the peaks
+   @param[out] pNumPeaks  number of peaks found, at most maxPeaks, returned here
+   @return     none
+
+   @par Entries of the outputs after the *pNumPeaks found peaks are not written.
+*/
+
+void plp_find_peaks_q32(const int32_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        int32_t threshold,
+                        uint32_t minDist,
+                        uint32_t maxPeaks,
+                        uint32_t *__restrict__ pIndex,
+                        int32_t *__restrict__ pDelta,
+                        int32_t *__restrict__ pValue,
+                        uint32_t *__restrict__ pNumPeaks) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_find_peaks_q32s_rv32im(pSrc, blockSize, threshold, minDist, maxPeaks, pIndex, pDelta,
+                                   pValue, pNumPeaks);
+    } else {
+        plp_find_peaks_q32s_xpulpv2(pSrc, blockSize, threshold, minDist, maxPeaks, pIndex, pDelta,
+                                    pValue, pNumPeaks);
+    }
+}
+
+/**
+   @} end of peaks group
+*/
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_frame_features_q16.c
+ * Description:  Glue code for single pass frame features of a 16-bit fixed point vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup frameFeatures FrameFeatures
+   Short-time energy, number of zero crossings, peak magnitude and DC value of a frame, computed
+   in a single pass over the input. These are the features of a typical voice activity detector,
+   which runs continuously on the fabric controller. Computing them together reads every sample
+   only once, and needs a fraction of the cycles of plp_power_q16, plp_mean_i16 and a separate
+   loop for the zero crossings and the peak.
+
+   The energy is the sum of the squares, each shifted right by fracBits, exactly as returned by
+   plp_power_q16. It is accumulated with 32 bits, fracBits has to be chosen such that the energy
+   of a frame fits. A zero crossing is counted for every pair of neighboring samples of different
+   sign, where zero counts as positive. The peak is the largest magnitude of the frame, saturated
+   to 0x7FFF, and the DC value is the mean, rounded towards zero.
+*/
+
+/**
+   @addtogroup frameFeatures
+   @{
+*/
+
+/**
+   @brief Glue code for single pass frame features of a 16-bit fixed point vector.
+   @param[in]  pSrc        points to the input vector
+   @param[in]  blockSize   number of samples in input vector, must be at least one
+   @param[in]  fracBits    number of fractional bits of the input
+   @param[out] pEnergy     sum of squares returned here
+   @param[out] pZeroCross  number of zero crossings returned here
+   @param[out] pPeak       largest magnitude returned here
+   @param[out] pDc         mean value returned here
+   @return     none
+*/
+
+void plp_frame_features_q16(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pEnergy,
+                            uint32_t *__restrict__ pZeroCross,
+                            int16_t *__restrict__ pPeak,
+                            int16_t *__restrict__ pDc) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_frame_features_q16s_rv32im(pSrc, blockSize, fracBits, pEnergy, pZeroCross, pPeak,
+                                       pDc);
+    } else {
+        plp_frame_features_q16s_xpulpv2(pSrc, blockSize, fracBits, pEnergy, pZeroCross, pPeak,
+                                        pDc);
+    }
+}
+
+/**
+   @} end of frameFeatures group
+*/
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_i16.c
+ * Description:  Histogram of a 16-bit integer vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup histogram Histogram
+   Histogram of a vector with nBins bins of width 2^binShift, the first of which starts at
+   lowEdge. Sample x is counted in bin (x - lowEdge) >> binShift. Samples outside of the bins are
+   not counted.
+*/
+
+/**
+   @addtogroup histogram
+   @{
+*/
+
+/**
+   @brief Glue code for the histogram of a 16-bit integer vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  lowEdge    lower edge of the first bin
+   @param[in]  binShift   log2 of the bin width
+   @param[in]  nBins      number of bins
+   @param[out] pHist      points to the nBins counts
+   @return     none
+   @par Fixed point q16 data is binned with the same function, with lowEdge given in the format of
+   the input.
+*/
+
+void plp_histogram_i16(const int16_t *__restrict__ pSrc,
+                       uint32_t blockSize,
+                       int32_t lowEdge,
+                       uint32_t binShift,
+                       uint32_t nBins,
+                       uint32_t *__restrict__ pHist) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_histogram_i16s_rv32im(pSrc, blockSize, lowEdge, binShift, nBins, pHist);
+    } else {
+        plp_histogram_i16s_xpulpv2(pSrc, blockSize, lowEdge, binShift, nBins, pHist);
+    }
+}
+
+/**
+   @} end of histogram group
+*/
@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_histogram_i16_parallel.c
+ * Description:  Parallel histogram of a 16-bit integer vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup histogram
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel histogram of a 16-bit integer vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  lowEdge    lower edge of the first bin
+   @param[in]  binShift   log2 of the bin width
+   @param[in]  nBins      number of bins
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pHist      points to the nBins counts
+   @return     none
+
+   @par Every core bins a contiguous chunk of the input into private bins, which are merged into
+   pHist after a barrier. The private bins of all but the first core are allocated in L1 for the
+   duration of the call, (nPE - 1) * nBins words in total.
+*/
+
+void plp_histogram_i16_parallel(const int16_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                int32_t lowEdge,
+                                uint32_t binShift,
+                                uint32_t nBins,
+                                uint32_t nPE,
+                                uint32_t *__restrict__ pHist) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        uint32_t scratchSize = (nPE - 1) * nBins;
+        uint32_t *pScratch = NULL;
+
+        if (scratchSize > 0) {
+            pScratch = (uint32_t *)plp_scratch_alloc(sizeof(uint32_t) * scratchSize);
+            if (pScratch == NULL) {
+                printf("Error: insufficient L1 memory!\n");
+                return;
+            }
+        }
+
+        plp_histogram_instance_i16 S = { .pSrc = pSrc,
+                                         .blockSize = blockSize,
+                                         .lowEdge = lowEdge,
+                                         .binShift = binShift,
+                                         .nBins = nBins,
+                                         .nPE = nPE,
+                                         .pScratch = pScratch,
+                                         .pHist = pHist };
+
+        rt_team_fork(nPE, plp_histogram_i16p_xpulpv2, (void *)&S);
+
+        if (scratchSize > 0) {
+            plp_scratch_free(pScratch, sizeof(uint32_t) * scratchSize);
+        }
+    }
+}
+
+/**
+   @} end of histogram group
+*/
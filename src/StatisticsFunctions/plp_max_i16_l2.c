@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_max_i16_l2.c
+ * Description:  16-bit integer parallel maximum of L2 vectors glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+ */
+
+/**
+   @addtogroup max
+   @{
+ */
+
+/**
+   @brief Glue code for parallel maximum of a 16-bit integer vector in L2.
+   @param[in]  pSrc       points to the input vector in L2
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pRes       maximum value returned here
+   @return     none
+
+   @par
+   The vector is streamed through L1 tiles with plp_dma_stream_next, and every tile is processed
+   with plp_max_i16_parallel while the DMA copies the next tile. The maximum of the results of the
+   tiles is kept. The L1 buffer of PLP_DMA_STREAM_BUFFER_BYTES bytes is taken with
+   plp_scratch_alloc.
+ */
+
+void plp_max_i16_l2(const int16_t *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    uint32_t nPE,
+                    int16_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        uint8_t *pBuf = (uint8_t *)plp_scratch_alloc(PLP_DMA_STREAM_BUFFER_BYTES);
+
+        if (pBuf == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+
+        plp_dma_stream_t S;
+        plp_dma_stream_init(&S, pSrc, NULL, sizeof(int16_t), NULL, 0, blockSize, pBuf,
+                            PLP_DMA_STREAM_BUFFER_BYTES);
+
+        void *pA, *pB, *pD;
+        uint32_t len;
+        int16_t res;
+        int16_t max = INT16_MIN;
+
+        while ((len = plp_dma_stream_next(&S, &pA, &pB, &pD)) > 0) {
+            plp_max_i16_parallel(pA, len, nPE, &res);
+            if (res > max) {
+                max = res;
+            }
+        }
+
+        *pRes = max;
+
+        plp_scratch_free(pBuf, PLP_DMA_STREAM_BUFFER_BYTES);
+    }
+}
+
+/**
+   @} end of max group
+ */
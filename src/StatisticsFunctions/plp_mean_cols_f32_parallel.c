@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_cols_f32_parallel.c
+ * Description:  Glue code for parallel column means of a 32-bit float matrix
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup mean
+  @{
+ */
+
+/**
+  @brief Glue code for parallel means of all columns of a 32-bit float matrix.
+  @param[in]  pSrc    points to the input matrix of shape MxN
+  @param[in]  M       height of the matrix, number of samples of every column
+  @param[in]  N       width of the matrix, number of columns
+  @param[in]  stride  distance between two rows of pSrc, in elements
+  @param[in]  nPE     number of parallel processing units
+  @param[out] pDst    points to the N column means
+  @return     none
+ */
+
+void plp_mean_cols_f32_parallel(const float *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t stride,
+                                uint32_t nPE,
+                                float *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mean_cols_instance_f32 args = { .pSrc = pSrc,
+                                            .M = M,
+                                            .N = N,
+                                            .stride = stride,
+                                            .nPE = nPE,
+                                            .pDst = pDst };
+        rt_team_fork(nPE, plp_mean_cols_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of mean group
+ */
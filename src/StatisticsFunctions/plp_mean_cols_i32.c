@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_cols_i32.c
+ * Description:  Glue code for column means of a 32-bit integer matrix
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup mean
+  @{
+ */
+
+/**
+  @brief Glue code for the means of all columns of a 32-bit integer matrix.
+  @param[in]  pSrc    points to the input matrix of shape MxN
+  @param[in]  M       height of the matrix, number of samples of every column
+  @param[in]  N       width of the matrix, number of columns
+  @param[in]  stride  distance between two rows of pSrc, in elements
+  @param[out] pDst    points to the N column means
+  @return     none
+
+  @par Columns
+  pDst[n] is the mean of the column n of pSrc, which is the same as calling plp_mean_stride_i32
+  with stride for every column. All columns are computed in a single sweep over the rows, such
+  that every row is loaded from consecutive addresses. The matrix may be a window of a larger one,
+  or interleaved multi-channel data with one column per channel.
+ */
+
+void plp_mean_cols_i32(const int32_t *__restrict__ pSrc,
+                       uint32_t M,
+                       uint32_t N,
+                       uint32_t stride,
+                       int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mean_cols_i32s_rv32im(pSrc, M, N, stride, pDst);
+    } else {
+        plp_mean_cols_i32s_xpulpv2(pSrc, M, N, stride, pDst);
+    }
+}
+
+/**
+  @} end of mean group
+ */
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_f32_parallel.c
+ * Description:  Parallel mean of a 32-bit float vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup mean
+   @{
+*/
+
+/**
+   @brief Glue code for parallel mean of a 32-bit float vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pRes       mean value returned here
+   @return     none
+
+   @par Every core reduces a contiguous chunk of the input into one partial result. The partial
+   results are combined after the join, without a further fork.
+*/
+
+void plp_mean_f32_parallel(const float *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           float *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t i;
+        float resBuffer[nPE];
+
+        plp_stats_instance_f32 S = { .pSrc = pSrc,
+                                     .blockSize = blockSize,
+                                     .nPE = nPE,
+                                     .resBuffer = resBuffer };
+
+        rt_team_fork(nPE, plp_mean_f32p_xpulpv2, (void *)&S);
+
+        float sum = 0.0f;
+
+        for (i = 0; i < nPE; i++) {
+            sum += resBuffer[i];
+        }
+
+        *pRes = sum / blockSize;
+    }
+}
+
+/**
+   @} end of mean group
+*/
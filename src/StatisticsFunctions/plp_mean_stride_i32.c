@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_stride_i32.c
+ * Description:  Glue code for mean value of a strided 32-bit integer vector
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup mean
+  @{
+ */
+
+/**
+  @brief Glue code for mean value of a strided 32-bit integer vector.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  stride     distance between two samples of pSrc, in elements
+  @param[in]  blockSize  number of samples in the input vector
+  @param[out] pRes       mean value returned here
+  @return     none
+
+  @par Strides
+  The n-th sample is pSrc[n * stride], such that the mean of a matrix column, or of a channel of
+  interleaved multi-channel data, needs no contiguous copy. See plp_mean_cols for the means of all
+  columns at once.
+ */
+
+void plp_mean_stride_i32(const int32_t *__restrict__ pSrc,
+                         uint32_t stride,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mean_stride_i32s_rv32im(pSrc, stride, blockSize, pRes);
+    } else {
+        plp_mean_stride_i32s_xpulpv2(pSrc, stride, blockSize, pRes);
+    }
+}
+
+/**
+  @} end of mean group
+ */
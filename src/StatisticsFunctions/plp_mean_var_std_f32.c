@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_var_std_f32.c
+ * Description:  Mean, var and std of a 32-bit float vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup meanVarStd MeanVarStd
+   Mean, variance and standard deviation of a vector, computed in a single pass over the input.
+   The sum and the sum of squares are accumulated together; fixed point versions use 64-bit
+   accumulators, such that the variance is not computed from two truncated intermediate results.
+*/
+
+/**
+   @addtogroup meanVarStd
+   @{
+*/
+
+/**
+   @brief Glue code for single pass mean, variance and standard deviation of a
+   32-bit float vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[out] pMean      mean value returned here
+   @param[out] pVar       variance returned here
+   @param[out] pStd       standard deviation returned here
+   @return     none
+*/
+
+void plp_mean_var_std_f32(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pMean,
+                          float *__restrict__ pVar,
+                          float *__restrict__ pStd) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mean_var_std_f32s_rv32im(pSrc, blockSize, pMean, pVar, pStd);
+    } else {
+        plp_mean_var_std_f32s_xpulpv2(pSrc, blockSize, pMean, pVar, pStd);
+    }
+}
+
+/**
+   @} end of meanVarStd group
+*/
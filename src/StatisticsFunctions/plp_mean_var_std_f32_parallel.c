@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_var_std_f32_parallel.c
+ * Description:  Parallel mean, var and std of a 32-bit float vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup meanVarStd
+   @{
+*/
+
+/**
+   @brief Glue code for parallel single pass mean, variance and standard deviation of a
+   32-bit float vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pMean      mean value returned here
+   @param[out] pVar       variance returned here
+   @param[out] pStd       standard deviation returned here
+   @return     none
+
+   @par Every core accumulates the sum and the sum of squares of a contiguous chunk of the input.
+   The partial moments are added up after the join, so no further fork or barrier is required.
+*/
+
+void plp_mean_var_std_f32_parallel(const float *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t nPE,
+                                   float *__restrict__ pMean,
+                                   float *__restrict__ pVar,
+                                   float *__restrict__ pStd) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t i;
+        float sumBuffer[nPE];
+        float sumSqBuffer[nPE];
+
+        plp_mean_var_std_instance_f32 S = { .pSrc = pSrc,
+                                            .blockSize = blockSize,
+                                            .nPE = nPE,
+                                            .pSum = sumBuffer,
+                                            .pSumSq = sumSqBuffer };
+
+        rt_team_fork(nPE, plp_mean_var_std_f32p_xpulpv2, (void *)&S);
+
+        float shift = pSrc[0];
+        float sum = 0.0f;
+        float sumSq = 0.0f;
+
+        for (i = 0; i < nPE; i++) {
+            sum += sumBuffer[i];
+            sumSq += sumSqBuffer[i];
+        }
+
+        float mean = sum / blockSize;
+        float var = sumSq / blockSize - mean * mean;
+
+        if (var < 0.0f) {
+            var = 0.0f;
+        }
+
+        *pMean = shift + mean;
+        *pVar = var;
+        plp_sqrt_f32(pVar, pStd);
+    }
+}
+
+/**
+   @} end of meanVarStd group
+*/
@@ -0,0 +1,103 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mean_var_std_q32_parallel.c
+ * Description:  Parallel mean, var and std of a 32-bit fixed point vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup meanVarStd
+   @{
+*/
+
+/**
+   @brief Glue code for parallel single pass mean, variance and standard deviation of a
+   32-bit fixed point vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  fracBits   number of fractional bits of the input
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pMean      mean value returned here
+   @param[out] pVar       variance returned here
+   @param[out] pStd       standard deviation returned here
+   @return     none
+
+   @par Every core accumulates the sum and the sum of squares of a contiguous chunk of the input.
+   The partial moments are added up after the join, so no further fork or barrier is required.
+*/
+
+void plp_mean_var_std_q32_parallel(const int32_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t fracBits,
+                                   uint32_t nPE,
+                                   int32_t *__restrict__ pMean,
+                                   int32_t *__restrict__ pVar,
+                                   int32_t *__restrict__ pStd) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t i;
+        int64_t sumBuffer[nPE];
+        int64_t sumSqBuffer[nPE];
+
+        plp_mean_var_std_instance_q32 S = { .pSrc = pSrc,
+                                            .blockSize = blockSize,
+                                            .fracBits = fracBits,
+                                            .nPE = nPE,
+                                            .pSum = sumBuffer,
+                                            .pSumSq = sumSqBuffer };
+
+        rt_team_fork(nPE, plp_mean_var_std_q32p_xpulpv2, (void *)&S);
+
+        int64_t shift = pSrc[0];
+        int64_t sum = 0;
+        int64_t sumSq = 0;
+
+        for (i = 0; i < nPE; i++) {
+            sum += sumBuffer[i];
+            sumSq += sumSqBuffer[i];
+        }
+
+        int64_t mean = sum / blockSize;
+        int64_t rem = sum - mean * blockSize;
+        // split sum^2 / blockSize into mean * sum + rem * sum / blockSize to stay within 64 bits
+        int64_t var = (sumSq - ((mean * sum + (rem * sum) / blockSize) >> fracBits)) / blockSize;
+
+        *pMean = (int32_t)(shift + mean);
+        *pVar = (int32_t)var;
+        plp_sqrt_q32(pVar, fracBits, pStd);
+    }
+}
+
+/**
+   @} end of meanVarStd group
+*/
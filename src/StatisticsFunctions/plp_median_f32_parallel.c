@@ -0,0 +1,59 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_median_f32_parallel.c
+ * Description:  Parallel median of a 32-bit float vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup percentile
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel median of a 32-bit float vector.
+   For an even number of samples, the lower of the two middle samples is returned.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pRes       median returned here
+   @return     none
+*/
+
+void plp_median_f32_parallel(const float *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             float *__restrict__ pRes) {
+    plp_percentile_f32_parallel(pSrc, blockSize, 50, nPE, pRes);
+}
+
+/**
+   @} end of percentile group
+*/
@@ -53,7 +53,7 @@
 void plp_min_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
-        *pRes = -1;
+        plp_min_f32s_rv32im(pSrc, blockSize, pRes);
     } else {
         plp_min_f32s_xpulpv2(pSrc, blockSize, pRes);
     }
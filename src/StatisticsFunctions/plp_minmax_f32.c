@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_minmax_f32.c
+ * Description:  MinMax of a 32-bit float vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup minmax MinMax
+   Min and max with indices of a vector, found in a single pass. If the extremum occurs
+   more than once, the index of its first occurrence is returned.
+*/
+
+/**
+   @addtogroup minmax
+   @{
+*/
+
+/**
+   @brief Glue code for the min and max with indices of a 32-bit float vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[out] pMin       minimum value returned here
+   @param[out] pMinIndex  index of the first occurrence of the minimum returned here
+   @param[out] pMax       maximum value returned here
+   @param[out] pMaxIndex  index of the first occurrence of the maximum returned here
+   @return     none
+*/
+
+void plp_minmax_f32(const float *__restrict__ pSrc,
+                    uint32_t blockSize,
+                    float *__restrict__ pMin,
+                    uint32_t *__restrict__ pMinIndex,
+                    float *__restrict__ pMax,
+                    uint32_t *__restrict__ pMaxIndex) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_minmax_f32s_rv32im(pSrc, blockSize, pMin, pMinIndex, pMax, pMaxIndex);
+    } else {
+        plp_minmax_f32s_xpulpv2(pSrc, blockSize, pMin, pMinIndex, pMax, pMaxIndex);
+    }
+}
+
+/**
+   @} end of minmax group
+*/
@@ -0,0 +1,108 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_minmax_f32_parallel.c
+ * Description:  Parallel MinMax of a 32-bit float vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup minmax
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel min and max with indices of a 32-bit float vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pMin       minimum value returned here
+   @param[out] pMinIndex  index of the first occurrence of the minimum returned here
+   @param[out] pMax       maximum value returned here
+   @param[out] pMaxIndex  index of the first occurrence of the maximum returned here
+   @return     none
+
+   @par Every core searches a contiguous chunk of the input. The per core results are reduced in
+   core order after the join, so ties resolve to the first occurrence as in the single core version.
+*/
+
+void plp_minmax_f32_parallel(const float *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             float *__restrict__ pMin,
+                             uint32_t *__restrict__ pMinIndex,
+                             float *__restrict__ pMax,
+                             uint32_t *__restrict__ pMaxIndex) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t i;
+        float minBuffer[nPE];
+        uint32_t minIndexBuffer[nPE];
+        float maxBuffer[nPE];
+        uint32_t maxIndexBuffer[nPE];
+
+        plp_minmax_instance_f32 S = { .pSrc = pSrc,
+                                      .blockSize = blockSize,
+                                      .nPE = nPE,
+                                      .pMin = minBuffer,
+                                      .pMinIndex = minIndexBuffer,
+                                      .pMax = maxBuffer,
+                                      .pMaxIndex = maxIndexBuffer };
+
+        rt_team_fork(nPE, plp_minmax_f32p_xpulpv2, (void *)&S);
+
+        float min = minBuffer[0];
+        uint32_t minIndex = minIndexBuffer[0];
+        float max = maxBuffer[0];
+        uint32_t maxIndex = maxIndexBuffer[0];
+
+        for (i = 1; i < nPE; i++) {
+            if (minBuffer[i] < min) {
+                min = minBuffer[i];
+                minIndex = minIndexBuffer[i];
+            }
+            if (maxBuffer[i] > max) {
+                max = maxBuffer[i];
+                maxIndex = maxIndexBuffer[i];
+            }
+        }
+
+        *pMin = min;
+        *pMinIndex = minIndex;
+        *pMax = max;
+        *pMaxIndex = maxIndex;
+    }
+}
+
+/**
+   @} end of minmax group
+*/
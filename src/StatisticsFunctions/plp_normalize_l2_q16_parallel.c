@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_l2_q16_parallel.c
+ * Description:  Parallel L2 normalization of a 16-bit fixed point vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup Normalize
+  @{
+ */
+
+/**
+  @brief Glue code for parallel L2 normalization of a 16-bit fixed point vector.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the output vector, in Q0.15
+  @return     none
+
+  @par Every core accumulates the energy of a contiguous chunk of the input. After a
+  barrier, every core adds up the energies of all cores and normalizes its chunk.
+ */
+
+void plp_normalize_l2_q16_parallel(const int16_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t nPE,
+                                   int16_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    int64_t sumSqBuffer[nPE];
+
+    plp_normalize_instance_q16 S = { .pSrc = pSrc,
+                                     .blockSize = blockSize,
+                                     .fracBits = 15,
+                                     .nPE = nPE,
+                                     .pSum = NULL,
+                                     .pSumSq = sumSqBuffer,
+                                     .pDst = pDst };
+
+    rt_team_fork(nPE, plp_normalize_l2_q16p_xpulpv2, (void *)&S);
+}
+
+/**
+  @} end of Normalize group
+ */
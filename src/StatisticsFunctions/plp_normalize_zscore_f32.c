@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_normalize_zscore_f32.c
+ * Description:  Z-score normalization of a 32-bit float vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup Normalize Normalization
+  This module contains the glue code for the normalization of a vector, either to zero mean and
+  unit standard deviation (z-score),
+  <pre>
+      pDst[i] = (pSrc[i] - mean) / std,
+  </pre>
+  with the standard deviation of the population as in plp_mean_var_std, or to unit Euclidean norm
+  (L2),
+  <pre>
+      pDst[i] = pSrc[i] / sqrt(sum over j of pSrc[j]^2).
+  </pre>
+  If the standard deviation or the norm is zero, the output is zero. The kernel codes are in the
+  module Normalization Kernels.
+
+  The 32-bit float z-score normalization subtracts the first sample from all samples before the
+  moments are accumulated, as plp_mean_var_std_f32. The 16-bit fixed point versions accumulate
+  the exact moments in 64 bits, and scale blockSize * pSrc[i] - sum(pSrc) (z-score) or pSrc[i]
+  (L2) with a gain of 23 significant bits from plp_normalize_gain_q16, such that the mean is never
+  rounded. As the scale of the input cancels, the z-score returns Q(fracBits) for any input
+  format, and the L2 normalization returns Q0.15. The outputs are rounded and saturated.
+ */
+
+/**
+  @addtogroup Normalize
+  @{
+ */
+
+/**
+  @brief Glue code for z-score normalization of a 32-bit float vector.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[out] pDst       points to the output vector
+  @return     none
+ */
+
+void plp_normalize_zscore_f32(const float32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_normalize_zscore_f32s_xpulpv2(pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of Normalize group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_percentile_i16.c
+ * Description:  Percentile of a 16-bit integer vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup percentile Percentile
+   Percentiles and median of a vector. The p-th percentile is the sample of rank
+   floor(p * (blockSize - 1) / 100) in the sorted input, which is the lower of the two
+   candidates when the exact percentile falls between two samples. The input is not modified.
+*/
+
+/**
+   @addtogroup percentile
+   @{
+*/
+
+/**
+   @brief Glue code for the percentile of a 16-bit integer vector.
+   @param[in]  pSrc        points to the input vector
+   @param[in]  blockSize   number of samples in input vector
+   @param[in]  percentile  percentile to compute, between 0 and 100
+   @param[out] pRes        percentile returned here
+   @return     none
+*/
+
+void plp_percentile_i16(const int16_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t percentile,
+                        int16_t *__restrict__ pRes) {
+
+    uint32_t k = (percentile * (blockSize - 1)) / 100;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_percentile_i16s_rv32im(pSrc, blockSize, k, pRes);
+    } else {
+        plp_percentile_i16s_xpulpv2(pSrc, blockSize, k, pRes);
+    }
+}
+
+/**
+   @} end of percentile group
+*/
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_percentile_i16_parallel.c
+ * Description:  Parallel percentile of a 16-bit integer vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup percentile
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel percentile of a 16-bit integer vector.
+   @param[in]  pSrc        points to the input vector
+   @param[in]  blockSize   number of samples in input vector
+   @param[in]  percentile  percentile to compute, between 0 and 100
+   @param[in]  nPE         number of parallel processing units
+   @param[out] pRes        percentile returned here
+   @return     none
+
+   @par Every core counts the digits of the keys in a contiguous chunk of the input. The counts of
+   all cores are combined after a barrier, so all cores follow the same digit in the next pass.
+*/
+
+void plp_percentile_i16_parallel(const int16_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 uint32_t percentile,
+                                 uint32_t nPE,
+                                 int16_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t countBuffer[16 * nPE];
+
+        plp_percentile_instance_i16 S = { .pSrc = pSrc,
+                                          .blockSize = blockSize,
+                                          .k = (percentile * (blockSize - 1)) / 100,
+                                          .nPE = nPE,
+                                          .pCount = countBuffer,
+                                          .pRes = pRes };
+
+        rt_team_fork(nPE, plp_percentile_i16p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+   @} end of percentile group
+*/
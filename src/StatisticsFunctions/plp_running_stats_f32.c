@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_f32.c
+ * Description:  Running statistics of a 32-bit float signal glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief Glue code for the running statistics of a 32-bit float signal.
+   @param[in]  S          points to the instance initialized by plp_running_stats_init_f32
+   @param[in]  pSrc       points to the hopSize new samples
+   @param[in]  hopSize    number of new samples
+   @param[out] pMean      mean of the window returned here
+   @param[out] pVar       variance of the window returned here
+   @param[out] pRms       mean of the squared samples of the window returned here
+   @return     none
+
+   @par Rounding errors of the incremental updates are discarded once per window length, when the
+   sums are recomputed from the state buffer.
+*/
+
+void plp_running_stats_f32(plp_running_stats_instance_f32 *S,
+                           const float *__restrict__ pSrc,
+                           uint32_t hopSize,
+                           float *__restrict__ pMean,
+                           float *__restrict__ pVar,
+                           float *__restrict__ pRms) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_running_stats_f32s_rv32im(S, pSrc, hopSize, pMean, pVar, pRms);
+    } else {
+        plp_running_stats_f32s_xpulpv2(S, pSrc, hopSize, pMean, pVar, pRms);
+    }
+}
+
+/**
+   @} end of runningStats group
+*/
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_running_stats_init_f32.c
+ * Description:  Initialization of the 32-bit float running statistics
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup runningStats Running Statistics
+   Mean, variance and mean square over a sliding window. The instance keeps the window in a
+   circular buffer together with the sum and the sum of squares of its samples. Every call pushes
+   hopSize new samples, which replace the oldest ones, and updates the sums by the difference, so
+   the cost of a call is proportional to hopSize instead of the window length.
+*/
+
+/**
+   @addtogroup runningStats
+   @{
+*/
+
+/**
+   @brief Initializes an instance of the 32-bit float running statistics.
+   @param[out] S          points to the instance of the 32-bit float running statistics
+   @param[in]  pState     points to the state buffer of windowLen samples
+   @param[in]  windowLen  number of samples in the window
+   @return     none
+
+   @par The window starts out filled with zeros. The state buffer must stay valid as long as S is
+   used.
+*/
+
+void plp_running_stats_init_f32(plp_running_stats_instance_f32 *S,
+                                float *__restrict__ pState,
+                                uint32_t windowLen) {
+
+    uint32_t i;
+
+    for (i = 0; i < windowLen; i++) {
+        pState[i] = 0;
+    }
+
+    S->pState = pState;
+    S->windowLen = windowLen;
+    S->index = 0;
+    S->sum = 0;
+    S->sumSq = 0;
+}
+
+/**
+   @} end of runningStats group
+*/
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sort_f32_parallel.c
+ * Description:  Parallel sorting of a 32-bit float vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup sort
+   @{
+*/
+
+/**
+   @brief Glue code for sorting a 32-bit float vector in parallel.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  nPE        number of parallel processing units
+   @param[in]  pTmp       points to a temporary buffer of blockSize samples
+   @param[out] pDst       points to the output vector, sorted in ascending order, may equal pSrc
+   @return     none
+
+   @par Every core counts the digits of a contiguous chunk of the intermediate vector. The
+   counts of all cores are combined after a barrier, such that every core scatters its chunk
+   to its own range of positions in the output, which keeps the sort stable.
+*/
+
+void plp_sort_f32_parallel(const float *pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           float *pTmp,
+                           float *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t countBuffer[16 * nPE];
+
+        plp_sort_instance_f32 S = { .pSrc = pSrc,
+                                    .blockSize = blockSize,
+                                    .nPE = nPE,
+                                    .pCount = countBuffer,
+                                    .pTmp = pTmp,
+                                    .pDst = pDst };
+
+        rt_team_fork(nPE, plp_sort_f32p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+   @} end of sort group
+*/
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sort_i16.c
+ * Description:  Sorting of a 16-bit integer vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @defgroup sort Sorting
+   Sorting, index sorting and top-k selection of a vector. The samples are ordered by a least
+   significant digit radix sort on unsigned integer keys with the same ordering as the samples, such
+   that floats are compared with integer instructions only. All functions are stable: samples with
+   equal values keep the order of the input, so equal samples appear with the lower index first.
+*/
+
+/**
+   @addtogroup sort
+   @{
+*/
+
+/**
+   @brief Glue code for sorting a 16-bit integer vector.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  pTmp       points to a temporary buffer of blockSize samples
+   @param[out] pDst       points to the output vector, sorted in ascending order, may equal pSrc
+   @return     none
+*/
+
+void plp_sort_i16(const int16_t *pSrc,
+                  uint32_t blockSize,
+                  int16_t *pTmp,
+                  int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_sort_i16s_rv32im(pSrc, blockSize, pTmp, pDst);
+    } else {
+        plp_sort_i16s_xpulpv2(pSrc, blockSize, pTmp, pDst);
+    }
+}
+
+/**
+   @} end of sort group
+*/
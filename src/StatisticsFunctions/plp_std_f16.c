@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_std_f16.c
+ * Description:  Standard deviation of a half-precision float vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup std
+   @{
+*/
+
+/**
+   @brief         Glue code for standard deviation of a half-precision float vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[out]    pRes       standard deviation returned here
+   @return        none
+
+   @par Half Precision
+   With PLP_MATH_SMALLFLOAT, the samples are processed in half precision, two at once with the
+   packed SIMD instructions where possible, and the vector must be aligned to 32 bits. Otherwise,
+   the samples are converted to single precision.
+ */
+
+void plp_std_f16(const float16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 float16_t *__restrict__ pRes) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_std_f16s_xpulpv2(pSrc, blockSize, pRes);
+    }
+}
+
+/**
+   @} end of std group
+*/
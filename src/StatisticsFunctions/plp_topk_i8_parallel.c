@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_topk_i8_parallel.c
+ * Description:  Parallel top-k selection of a 8-bit integer vector glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup sort
+   @{
+*/
+
+/**
+   @brief Glue code for the k largest samples of a 8-bit integer vector, computed in parallel.
+   @param[in]  pSrc       points to the input vector
+   @param[in]  blockSize  number of samples in input vector
+   @param[in]  k          number of samples to select, at most blockSize
+   @param[in]  nPE        number of parallel processing units
+   @param[out] pDst       points to the k largest samples, in descending order
+   @param[out] pIndex     points to the indices of the k largest samples
+   @return     none
+
+   @par The k-th largest sample is found with plp_percentile_i8p_xpulpv2. Every core then
+   gathers the selected samples of a contiguous chunk of the input to its own range of the
+   output, which is finally sorted by one core.
+*/
+
+void plp_topk_i8_parallel(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t k,
+                          uint32_t nPE,
+                          int8_t *__restrict__ pDst,
+                          uint32_t *__restrict__ pIndex) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        uint32_t countBuffer[16 * nPE];
+
+        plp_topk_instance_i8 S = { .pSrc = pSrc,
+                                   .blockSize = blockSize,
+                                   .k = k,
+                                   .nPE = nPE,
+                                   .pCount = countBuffer,
+                                   .pDst = pDst,
+                                   .pIndex = pIndex };
+
+        rt_team_fork(nPE, plp_topk_i8p_xpulpv2, (void *)&S);
+    }
+}
+
+/**
+   @} end of sort group
+*/
@@ -0,0 +1,62 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_convert_f32_to_q16s_rv32im.c
+ * Description:  32-bit float to 16-bit fixed point vector conversion kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Convert
+ */
+
+/**
+  @addtogroup ConvertKernels
+  @{
+ */
+
+/**
+  @brief         Converts a 32-bit float vector to 16-bit fixed point for RV32IM extension.
+  @param[in]     pSrc       points to input vector
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_convert_f32_to_q16s_rv32im(const float32_t *__restrict__ pSrc,
+                                    int16_t *__restrict__ pDst,
+                                    uint32_t blockSize) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i < blockSize; i++) {
+        int32_t val = plp_f32_to_i32_sat(pSrc[i] * 32768.0f);
+        pDst[i] = (int16_t)((val > 0x7FFF) ? 0x7FFF : (val < -0x8000) ? -0x8000 : val);
+    }
+}
+
+/**
+  @} end of ConvertKernels group
+ */
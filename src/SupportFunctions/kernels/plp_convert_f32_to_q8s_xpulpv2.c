@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_convert_f32_to_q8s_xpulpv2.c
+ * Description:  32-bit float to 8-bit fixed point vector conversion kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Convert
+ */
+
+/**
+  @addtogroup ConvertKernels
+  @{
+ */
+
+/**
+  @brief         Converts a 32-bit float vector to 8-bit fixed point for XPULPV2 extension.
+  @param[in]     pSrc       points to input vector
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_convert_f32_to_q8s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                    int8_t *__restrict__ pDst,
+                                    uint32_t blockSize) {
+
+    uint32_t i; // loop counter
+
+    // four samples per iteration, such that every packed word is loaded or stored at once
+    for (i = 0; i + 3 < blockSize; i += 4) {
+        *((v4s *)&pDst[i]) = __PACK4(__CLIP(plp_f32_to_i32_sat(pSrc[i] * 128.0f), 7),
+                                     __CLIP(plp_f32_to_i32_sat(pSrc[i + 1] * 128.0f), 7),
+                                     __CLIP(plp_f32_to_i32_sat(pSrc[i + 2] * 128.0f), 7),
+                                     __CLIP(plp_f32_to_i32_sat(pSrc[i + 3] * 128.0f), 7));
+    }
+
+    // leftover elements
+    for (; i < blockSize; i++) {
+        pDst[i] = (int8_t)__CLIP(plp_f32_to_i32_sat(pSrc[i] * 128.0f), 7);
+    }
+}
+
+/**
+  @} end of ConvertKernels group
+ */
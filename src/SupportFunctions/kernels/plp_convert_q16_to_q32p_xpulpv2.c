@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_convert_q16_to_q32p_xpulpv2.c
+ * Description:  parallel 16-bit fixed point to 32-bit fixed point vector conversion for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Convert
+ */
+
+/**
+  @addtogroup ConvertKernels
+  @{
+ */
+
+/**
+  @brief         Parallel conversion of a 16-bit fixed point vector to 32-bit fixed point for
+                 XPULPV2 extension.
+  @param[in]     args       pointer to plp_convert_instance struct initialized by
+                            plp_convert_q16_to_q32_parallel
+  @return        none
+
+  @par Parallelization
+  Every core converts a contiguous chunk of the vector with plp_convert_q16_to_q32s_xpulpv2. The
+  size of each chunk is a multiple of 4 samples, such that every chunk starts word aligned.
+ */
+
+void plp_convert_q16_to_q32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_convert_instance *a = (plp_convert_instance *)args;
+
+    const int16_t *pSrc = (const int16_t *)a->pSrc;
+    int32_t *pDst = (int32_t *)a->pDst;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+
+    uint32_t chunk = (((blockSize + nPE - 1) / nPE) + 3) & ~3;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > blockSize) {
+        start = blockSize;
+    }
+    if (end > blockSize) {
+        end = blockSize;
+    }
+
+    if (start < end) {
+        plp_convert_q16_to_q32s_xpulpv2(pSrc + start, pDst + start, end - start);
+    }
+}
+
+/**
+  @} end of ConvertKernels group
+ */
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_convert_q16_to_q8s_xpulpv2.c
+ * Description:  16-bit fixed point to 8-bit fixed point vector conversion kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Convert
+ */
+
+/**
+  @addtogroup ConvertKernels
+  @{
+ */
+
+/**
+  @brief         Converts a 16-bit fixed point vector to 8-bit fixed point for XPULPV2 extension.
+  @param[in]     pSrc       points to input vector
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_convert_q16_to_q8s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                    int8_t *__restrict__ pDst,
+                                    uint32_t blockSize) {
+
+    uint32_t i; // loop counter
+
+    // four samples per iteration, such that every packed word is loaded or stored at once
+    for (i = 0; i + 3 < blockSize; i += 4) {
+        v2s x0 = *((v2s *)&pSrc[i]);
+        v2s x1 = *((v2s *)&pSrc[i + 2]);
+        *((v4s *)&pDst[i]) = __PACK4(__CLIP(__ROUNDNORM_REG(x0[0], 8), 7),
+                                     __CLIP(__ROUNDNORM_REG(x0[1], 8), 7),
+                                     __CLIP(__ROUNDNORM_REG(x1[0], 8), 7),
+                                     __CLIP(__ROUNDNORM_REG(x1[1], 8), 7));
+    }
+
+    // leftover elements
+    for (; i < blockSize; i++) {
+        pDst[i] = (int8_t)__CLIP(__ROUNDNORM_REG(pSrc[i], 8), 7);
+    }
+}
+
+/**
+  @} end of ConvertKernels group
+ */
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_convert_q32_to_f32s_xpulpv2.c
+ * Description:  32-bit fixed point to 32-bit float vector conversion kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Convert
+ */
+
+/**
+  @addtogroup ConvertKernels
+  @{
+ */
+
+/**
+  @brief         Converts a 32-bit fixed point vector to 32-bit float for XPULPV2 extension.
+  @param[in]     pSrc       points to input vector
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_convert_q32_to_f32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                     float32_t *__restrict__ pDst,
+                                     uint32_t blockSize) {
+
+    uint32_t i; // loop counter
+
+    // two samples per iteration
+    for (i = 0; i + 1 < blockSize; i += 2) {
+        pDst[i] = (float32_t)pSrc[i] * 4.656612873077392578125e-10f;
+        pDst[i + 1] = (float32_t)pSrc[i + 1] * 4.656612873077392578125e-10f;
+    }
+
+    // leftover elements
+    for (; i < blockSize; i++) {
+        pDst[i] = (float32_t)pSrc[i] * 4.656612873077392578125e-10f;
+    }
+}
+
+/**
+  @} end of ConvertKernels group
+ */
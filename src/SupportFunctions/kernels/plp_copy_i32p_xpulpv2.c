@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_copy_i32p_xpulpv2.c
+ * Description:  parallel 32-bit integer vector copy for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Copy
+ */
+
+/**
+  @addtogroup CopyKernels
+  @{
+ */
+
+/**
+  @brief         Parallel copy of the elements of a 32-bit integer vector for XPULPV2 extension.
+  @param[in]     args       pointer to plp_copy_instance_i32 struct initialized by
+                            plp_copy_i32_parallel
+  @return        none
+
+  @par Parallelization
+  Every core processes a contiguous chunk of the vector with plp_copy_i32s_xpulpv2. The size of
+  each chunk is a multiple of 4 samples, such that all chunks have the same word alignment.
+ */
+
+void plp_copy_i32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_copy_instance_i32 *a = (plp_copy_instance_i32 *)args;
+
+    int32_t *pSrc = a->pSrc;
+    int32_t *pDst = a->pDst;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+
+    uint32_t chunk = (((blockSize + nPE - 1) / nPE) + 3) & ~3;
+
+    uint32_t start = core_id * chunk;
+    uint32_t end = start + chunk;
+    if (start > blockSize) {
+        start = blockSize;
+    }
+    if (end > blockSize) {
+        end = blockSize;
+    }
+
+    if (start < end) {
+        plp_copy_i32s_xpulpv2(pSrc + start, pDst + start, end - start);
+    }
+}
+
+/**
+  @} end of CopyKernels group
+ */
@@ -60,16 +60,22 @@ void plp_copy_i32s_xpulpv2(int32_t *__restrict__ pSrc,
 
 #if defined(PLP_MATH_LOOPUNROLL)
 
-    tmpBS = (blockSize >> 1);
+    tmpBS = (blockSize >> 2);
 
     for (blkCnt = 0; blkCnt < tmpBS; blkCnt++) {
 
-        /* Copy and store result in destination buffer */
-        *pDst++ = *pSrc++;
-        *pDst++ = *pSrc++;
+        /* Load four words before storing them, such that the loads are not stalled by the stores */
+        int32_t w0 = *pSrc++;
+        int32_t w1 = *pSrc++;
+        int32_t w2 = *pSrc++;
+        int32_t w3 = *pSrc++;
+        *pDst++ = w0;
+        *pDst++ = w1;
+        *pDst++ = w2;
+        *pDst++ = w3;
     }
 
-    tmpBS = (blockSize % 2U);
+    tmpBS = (blockSize % 4U);
 
     for (blkCnt = 0; blkCnt < tmpBS; blkCnt++) {
         *pDst++ = *pSrc++;
@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_copy_i8s_rv32im.c
+ * Description:  8-bit integer vector copy kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Copy
+ */
+
+/**
+  @addtogroup CopyKernels
+  @{
+ */
+
+/**
+  @brief         Copies the elements of an 8-bit integer vector for RV32IM extension.
+  @param[in]     pSrc       points to input vector
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_copy_i8s_rv32im(int8_t *__restrict__ pSrc, int8_t *__restrict__ pDst, uint32_t blockSize) {
+
+    uint32_t i = 0; // loop counter
+
+    // whole words can only be copied if pSrc and pDst have the same offset to a word boundary
+    if ((((uint32_t)pSrc ^ (uint32_t)pDst) & 0x3) == 0) {
+
+        // single samples until both vectors are word aligned
+        while (i < blockSize && ((uint32_t)&pDst[i] & 0x3)) {
+            pDst[i] = pSrc[i];
+            i++;
+        }
+
+        for (; i + 3 < blockSize; i += 4) {
+            *((int32_t *)&pDst[i]) = *((int32_t *)&pSrc[i]);
+        }
+    }
+
+    // leftover elements, or all elements if pSrc and pDst are aligned differently
+    for (; i < blockSize; i++) {
+        pDst[i] = pSrc[i];
+    }
+}
+
+/**
+  @} end of CopyKernels group
+ */
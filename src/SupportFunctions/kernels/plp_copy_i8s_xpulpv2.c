@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_copy_i8s_xpulpv2.c
+ * Description:  8-bit integer vector copy kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Copy
+ */
+
+/**
+  @addtogroup CopyKernels
+  @{
+ */
+
+/**
+  @brief         Copies the elements of an 8-bit integer vector for XPULPV2 extension.
+  @param[in]     pSrc       points to input vector
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_copy_i8s_xpulpv2(int8_t *__restrict__ pSrc,
+                          int8_t *__restrict__ pDst,
+                          uint32_t blockSize) {
+
+    uint32_t i = 0; // loop counter
+
+    // single samples until pDst is word aligned, such that all stores are aligned words
+    while (i < blockSize && ((uint32_t)&pDst[i] & 0x3)) {
+        pDst[i] = pSrc[i];
+        i++;
+    }
+
+    // two words per iteration, pSrc may be misaligned which is handled by the load unit
+    for (; i + 7 < blockSize; i += 8) {
+        int32_t w0 = *((int32_t *)&pSrc[i]);
+        int32_t w1 = *((int32_t *)&pSrc[i + 4]);
+        *((int32_t *)&pDst[i]) = w0;
+        *((int32_t *)&pDst[i + 4]) = w1;
+    }
+
+    // leftover elements
+    for (; i < blockSize; i++) {
+        pDst[i] = pSrc[i];
+    }
+}
+
+/**
+  @} end of CopyKernels group
+ */
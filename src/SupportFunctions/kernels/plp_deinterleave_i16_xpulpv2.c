@@ -0,0 +1,130 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_deinterleave_i16_xpulpv2.c
+ * Description:  Deinterleaving of 16-bit integer multi-channel data for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static void deinterleave_i16_block(const int16_t *__restrict__ pSrc,
+                                   uint32_t nCh,
+                                   uint32_t len,
+                                   uint32_t planeStride,
+                                   int16_t *__restrict__ pDst);
+
+/**
+  @ingroup Interleave
+ */
+
+/**
+  @addtogroup InterleaveKernels
+  @{
+ */
+
+/**
+  @brief Deinterleaving of 16-bit integer multi-channel data for XPULPV2 extension.
+  @param[in]  pSrc       points to the interleaved input of blockSize frames of nCh samples
+  @param[in]  nCh        number of channels
+  @param[in]  blockSize  number of samples of every channel
+  @param[out] pDst       points to the planar output, channel c starts at pDst[c * blockSize]
+  @return     none
+
+  @par SIMD
+  If nCh is even, two frames are converted at a time: a pair of channels of both frames is a 2x2
+  transpose of two words, which takes two shuffle instructions. The planes must be word aligned,
+  which needs an even blockSize (or plane distance), and the buffers must be word aligned. Else,
+  the samples are copied one by one.
+ */
+
+void plp_deinterleave_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                   uint32_t nCh,
+                                   uint32_t blockSize,
+                                   int16_t *__restrict__ pDst) {
+
+    deinterleave_i16_block(pSrc, nCh, blockSize, blockSize, pDst);
+}
+
+/**
+  @brief Parallel deinterleaving of 16-bit integer multi-channel data for XPULPV2 extension.
+  @param[in]  args  pointer to plp_interleave_instance_i16 struct initialized by
+                    plp_deinterleave_i16_parallel
+  @return     none
+
+  @par Parallelization
+  The frames are split into contiguous chunks of a multiple of 2 frames, one per core, such that the
+  planes of all chunks start at a word boundary. Every core converts its chunk of all channels, such
+  that every sample is written by exactly one core.
+ */
+
+void plp_deinterleave_i16p_xpulpv2(void *args) {
+
+    plp_interleave_instance_i16 *a = (plp_interleave_instance_i16 *)args;
+
+    uint32_t start, end;
+
+    plp_team_chunk(a->blockSize, a->nPE, rt_core_id(), 2, &start, &end);
+
+    if (start < end) {
+        deinterleave_i16_block(a->pSrc + start * a->nCh, a->nCh, end - start, a->blockSize,
+                               a->pDst + start);
+    }
+}
+
+/**
+  @} end of InterleaveKernels group
+ */
+
+// converts the frames [0, len), the planes are planeStride elements apart
+static void deinterleave_i16_block(const int16_t *__restrict__ pSrc,
+                                   uint32_t nCh,
+                                   uint32_t len,
+                                   uint32_t planeStride,
+                                   int16_t *__restrict__ pDst) {
+
+    uint32_t n = 0;
+    uint32_t c;
+
+    // two frames at a time, every pair of channels of both frames is a 2x2 transpose
+    if ((nCh & 1) == 0 && (planeStride & 1) == 0) {
+        for (; n + 1 < len; n += 2) {
+            const v2s *pFrame0 = (const v2s *)&pSrc[n * nCh];
+            const v2s *pFrame1 = (const v2s *)&pSrc[(n + 1) * nCh];
+            for (c = 0; c < nCh; c += 2) {
+                v2s x0 = pFrame0[c >> 1];
+                v2s x1 = pFrame1[c >> 1];
+                int16_t *pOut = &pDst[c * planeStride + n];
+                *(v2s *)pOut = __builtin_shuffle(x0, x1, (v2s){ 0, 2 });
+                *(v2s *)&pOut[planeStride] = __builtin_shuffle(x0, x1, (v2s){ 1, 3 });
+            }
+        }
+    }
+
+    // remaining frames, or all frames if the layout does not fit the SIMD path
+    for (; n < len; n++) {
+        for (c = 0; c < nCh; c++) {
+            pDst[c * planeStride + n] = pSrc[n * nCh + c];
+        }
+    }
+}
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_deinterleave_i8s_rv32im.c
+ * Description:  Deinterleaving of 8-bit integer multi-channel data for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Interleave
+ */
+
+/**
+  @addtogroup InterleaveKernels
+  @{
+ */
+
+/**
+  @brief Deinterleaving of 8-bit integer multi-channel data for RV32IM extension.
+  @param[in]  pSrc       points to the interleaved input of blockSize frames of nCh samples
+  @param[in]  nCh        number of channels
+  @param[in]  blockSize  number of samples of every channel
+  @param[out] pDst       points to the planar output, channel c starts at pDst[c * blockSize]
+  @return     none
+ */
+
+void plp_deinterleave_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                 uint32_t nCh,
+                                 uint32_t blockSize,
+                                 int8_t *__restrict__ pDst) {
+
+    uint32_t n, c;
+
+    for (c = 0; c < nCh; c++) {
+        const int8_t *pIn = &pSrc[c];
+        int8_t *pOut = &pDst[c * blockSize];
+        for (n = 0; n < blockSize; n++) {
+            pOut[n] = *pIn;
+            pIn += nCh;
+        }
+    }
+}
+
+/**
+  @} end of InterleaveKernels group
+ */
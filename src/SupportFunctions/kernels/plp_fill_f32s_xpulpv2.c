@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fill_f32s_xpulpv2.c
+ * Description:  32-bit float vector fill kernel for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Fill
+ */
+
+/**
+  @addtogroup FillKernels
+  @{
+ */
+
+/**
+  @brief         Fills a constant value into a 32-bit float vector for XPULPV2 extension.
+  @param[in]     value      input value to be filled
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_fill_f32s_xpulpv2(float32_t value, float32_t *__restrict__ pDst, uint32_t blockSize) {
+
+    uint32_t i; // loop counter
+
+    for (i = 0; i + 3 < blockSize; i += 4) {
+        pDst[i] = value;
+        pDst[i + 1] = value;
+        pDst[i + 2] = value;
+        pDst[i + 3] = value;
+    }
+
+    // leftover elements
+    for (; i < blockSize; i++) {
+        pDst[i] = value;
+    }
+}
+
+/**
+  @} end of FillKernels group
+ */
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fill_i8s_rv32im.c
+ * Description:  8-bit integer vector fill kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Fill
+ */
+
+/**
+  @addtogroup FillKernels
+  @{
+ */
+
+/**
+  @brief         Fills a constant value into an 8-bit integer vector for RV32IM extension.
+  @param[in]     value      input value to be filled
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_fill_i8s_rv32im(int8_t value, int8_t *__restrict__ pDst, uint32_t blockSize) {
+
+    uint32_t i = 0; // loop counter
+
+    // value replicated to a whole word
+    int32_t word = (uint32_t)(uint8_t)value * 0x01010101;
+
+    // single samples until pDst is word aligned, such that all stores are aligned words
+    while (i < blockSize && ((uint32_t)&pDst[i] & 0x3)) {
+        pDst[i] = value;
+        i++;
+    }
+
+    // two words per iteration
+    for (; i + 7 < blockSize; i += 8) {
+        *((int32_t *)&pDst[i]) = word;
+        *((int32_t *)&pDst[i + 4]) = word;
+    }
+
+    // leftover elements
+    for (; i < blockSize; i++) {
+        pDst[i] = value;
+    }
+}
+
+/**
+  @} end of FillKernels group
+ */
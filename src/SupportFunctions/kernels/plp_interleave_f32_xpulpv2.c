@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_interleave_f32_xpulpv2.c
+ * Description:  Interleaving of 32-bit float multi-channel data for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static void interleave_f32_block(const float32_t *__restrict__ pSrc,
+                                 uint32_t nCh,
+                                 uint32_t len,
+                                 uint32_t planeStride,
+                                 float32_t *__restrict__ pDst);
+
+/**
+  @ingroup Interleave
+ */
+
+/**
+  @addtogroup InterleaveKernels
+  @{
+ */
+
+/**
+  @brief Interleaving of 32-bit float multi-channel data for XPULPV2 extension.
+  @param[in]  pSrc       points to the planar input, channel c starts at pSrc[c * blockSize]
+  @param[in]  nCh        number of channels
+  @param[in]  blockSize  number of samples of every channel
+  @param[out] pDst       points to the interleaved output of blockSize frames of nCh samples
+  @return     none
+ */
+
+void plp_interleave_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                 uint32_t nCh,
+                                 uint32_t blockSize,
+                                 float32_t *__restrict__ pDst) {
+
+    interleave_f32_block(pSrc, nCh, blockSize, blockSize, pDst);
+}
+
+/**
+  @brief Parallel interleaving of 32-bit float multi-channel data for XPULPV2 extension.
+  @param[in]  args  pointer to plp_interleave_instance_f32 struct initialized by
+                    plp_interleave_f32_parallel
+  @return     none
+
+  @par Parallelization
+  The frames are split into contiguous chunks, one per core. Every core converts its chunk of all
+  channels, such that every sample is written by exactly one core.
+ */
+
+void plp_interleave_f32p_xpulpv2(void *args) {
+
+    plp_interleave_instance_f32 *a = (plp_interleave_instance_f32 *)args;
+
+    uint32_t start, end;
+
+    plp_team_chunk(a->blockSize, a->nPE, rt_core_id(), 1, &start, &end);
+
+    if (start < end) {
+        interleave_f32_block(a->pSrc + start, a->nCh, end - start, a->blockSize,
+                             a->pDst + start * a->nCh);
+    }
+}
+
+/**
+  @} end of InterleaveKernels group
+ */
+
+// converts the frames [0, len), the planes are planeStride elements apart
+static void interleave_f32_block(const float32_t *__restrict__ pSrc,
+                                 uint32_t nCh,
+                                 uint32_t len,
+                                 uint32_t planeStride,
+                                 float32_t *__restrict__ pDst) {
+
+    uint32_t n, c;
+
+    for (c = 0; c < nCh; c++) {
+        const float32_t *pIn = &pSrc[c * planeStride];
+        float32_t *pOut = &pDst[c];
+        for (n = 0; n + 1 < len; n += 2) {
+            float32_t x0 = pIn[n];
+            float32_t x1 = pIn[n + 1];
+            pOut[0] = x0;
+            pOut[nCh] = x1;
+            pOut += 2 * nCh;
+        }
+        if (n < len) {
+            *pOut = pIn[n];
+        }
+    }
+}
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_interleave_i32s_rv32im.c
+ * Description:  Interleaving of 32-bit integer multi-channel data for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup Interleave
+ */
+
+/**
+  @addtogroup InterleaveKernels
+  @{
+ */
+
+/**
+  @brief Interleaving of 32-bit integer multi-channel data for RV32IM extension.
+  @param[in]  pSrc       points to the planar input, channel c starts at pSrc[c * blockSize]
+  @param[in]  nCh        number of channels
+  @param[in]  blockSize  number of samples of every channel
+  @param[out] pDst       points to the interleaved output of blockSize frames of nCh samples
+  @return     none
+ */
+
+void plp_interleave_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                uint32_t nCh,
+                                uint32_t blockSize,
+                                int32_t *__restrict__ pDst) {
+
+    uint32_t n, c;
+
+    for (c = 0; c < nCh; c++) {
+        const int32_t *pIn = &pSrc[c * blockSize];
+        int32_t *pOut = &pDst[c];
+        for (n = 0; n < blockSize; n++) {
+            *pOut = pIn[n];
+            pOut += nCh;
+        }
+    }
+}
+
+/**
+  @} end of InterleaveKernels group
+ */
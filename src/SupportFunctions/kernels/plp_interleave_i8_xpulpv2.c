@@ -0,0 +1,151 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_interleave_i8_xpulpv2.c
+ * Description:  Interleaving of 8-bit integer multi-channel data for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static void interleave_i8_block(const int8_t *__restrict__ pSrc,
+                                uint32_t nCh,
+                                uint32_t len,
+                                uint32_t planeStride,
+                                int8_t *__restrict__ pDst);
+
+/**
+  @ingroup Interleave
+ */
+
+/**
+  @addtogroup InterleaveKernels
+  @{
+ */
+
+/**
+  @brief Interleaving of 8-bit integer multi-channel data for XPULPV2 extension.
+  @param[in]  pSrc       points to the planar input, channel c starts at pSrc[c * blockSize]
+  @param[in]  nCh        number of channels
+  @param[in]  blockSize  number of samples of every channel
+  @param[out] pDst       points to the interleaved output of blockSize frames of nCh samples
+  @return     none
+
+  @par SIMD
+  If nCh is a multiple of 4, four frames are converted at a time: a group of four channels of the
+  four frames is a 4x4 transpose of four words, which takes eight shuffle instructions. Stereo
+  data (nCh equal to 2) is converted four frames at a time, with two shuffle instructions. The
+  planes must be word aligned, which needs a blockSize (or plane distance) that is a multiple of
+  4, and the buffers must be word aligned. Else, the samples are copied one by one.
+ */
+
+void plp_interleave_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                uint32_t nCh,
+                                uint32_t blockSize,
+                                int8_t *__restrict__ pDst) {
+
+    interleave_i8_block(pSrc, nCh, blockSize, blockSize, pDst);
+}
+
+/**
+  @brief Parallel interleaving of 8-bit integer multi-channel data for XPULPV2 extension.
+  @param[in]  args  pointer to plp_interleave_instance_i8 struct initialized by
+                    plp_interleave_i8_parallel
+  @return     none
+
+  @par Parallelization
+  The frames are split into contiguous chunks of a multiple of 4 frames, one per core, such that the
+  planes of all chunks start at a word boundary. Every core converts its chunk of all channels, such
+  that every sample is written by exactly one core.
+ */
+
+void plp_interleave_i8p_xpulpv2(void *args) {
+
+    plp_interleave_instance_i8 *a = (plp_interleave_instance_i8 *)args;
+
+    uint32_t start, end;
+
+    plp_team_chunk(a->blockSize, a->nPE, rt_core_id(), 4, &start, &end);
+
+    if (start < end) {
+        interleave_i8_block(a->pSrc + start, a->nCh, end - start, a->blockSize,
+                            a->pDst + start * a->nCh);
+    }
+}
+
+/**
+  @} end of InterleaveKernels group
+ */
+
+// converts the frames [0, len), the planes are planeStride elements apart
+static void interleave_i8_block(const int8_t *__restrict__ pSrc,
+                                uint32_t nCh,
+                                uint32_t len,
+                                uint32_t planeStride,
+                                int8_t *__restrict__ pDst) {
+
+    uint32_t n = 0;
+    uint32_t c;
+
+    // four frames at a time, every group of four channels of the four frames is a 4x4 transpose
+    if ((nCh & 3) == 0 && (planeStride & 3) == 0) {
+        for (; n + 3 < len; n += 4) {
+            for (c = 0; c < nCh; c += 4) {
+                const int8_t *pIn = &pSrc[c * planeStride + n];
+                v4s x0 = *(v4s *)pIn;
+                v4s x1 = *(v4s *)&pIn[planeStride];
+                v4s x2 = *(v4s *)&pIn[2 * planeStride];
+                v4s x3 = *(v4s *)&pIn[3 * planeStride];
+                int8_t *pOut = &pDst[n * nCh + c];
+                // interleave the bytes of the rows pairwise, and then the halfwords of the pairs
+                v4s lo01 = __builtin_shuffle(x0, x1, (v4s){ 0, 4, 1, 5 });
+                v4s hi01 = __builtin_shuffle(x0, x1, (v4s){ 2, 6, 3, 7 });
+                v4s lo23 = __builtin_shuffle(x2, x3, (v4s){ 0, 4, 1, 5 });
+                v4s hi23 = __builtin_shuffle(x2, x3, (v4s){ 2, 6, 3, 7 });
+                v4s y0 = __builtin_shuffle(lo01, lo23, (v4s){ 0, 1, 4, 5 });
+                v4s y1 = __builtin_shuffle(lo01, lo23, (v4s){ 2, 3, 6, 7 });
+                v4s y2 = __builtin_shuffle(hi01, hi23, (v4s){ 0, 1, 4, 5 });
+                v4s y3 = __builtin_shuffle(hi01, hi23, (v4s){ 2, 3, 6, 7 });
+                *(v4s *)pOut = y0;
+                *(v4s *)&pOut[nCh] = y1;
+                *(v4s *)&pOut[2 * nCh] = y2;
+                *(v4s *)&pOut[3 * nCh] = y3;
+            }
+        }
+    } else if (nCh == 2 && (planeStride & 3) == 0) {
+        // four stereo frames at a time, interleaving the bytes of both channels
+        for (; n + 3 < len; n += 4) {
+            v4s x0 = *(v4s *)&pSrc[n];
+            v4s x1 = *(v4s *)&pSrc[planeStride + n];
+            *(v4s *)&pDst[2 * n] = __builtin_shuffle(x0, x1, (v4s){ 0, 4, 1, 5 });
+            *(v4s *)&pDst[2 * n + 4] = __builtin_shuffle(x0, x1, (v4s){ 2, 6, 3, 7 });
+        }
+    }
+
+    // remaining frames, or all frames if the layout does not fit the SIMD path
+    for (; n < len; n++) {
+        for (c = 0; c < nCh; c++) {
+            pDst[n * nCh + c] = pSrc[c * planeStride + n];
+        }
+    }
+}
@@ -0,0 +1,190 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_arena.c
+ * Description:  stack allocator for L1 scratch buffers of the kernels
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// arena selected with plp_arena_use, NULL if the kernels allocate with rt_alloc
+static plp_arena_t *plp_arena_current = NULL;
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Arena L1 Scratch Arena
+  Some kernels need a scratch buffer in L1 (e.g. the parallel convolutions, histograms and matrix
+  multiplications). By default, the glue code allocates it with rt_alloc and frees it with rt_free
+  on every call, which is slow and fragments the L1 memory over long runtimes.
+
+  Instead, the application can reserve an L1 region once, and let the kernels draw their scratch
+  buffers from it:
+  <pre>
+  static plp_arena_t arena;
+  plp_arena_init(&arena, rt_alloc(RT_ALLOC_CL_DATA, 16384), 16384);
+  plp_arena_use(&arena);
+  ...
+  plp_conv_i16_parallel(pSrcA, srcALen, pSrcB, srcBLen, nPE, pRes);
+  ...
+  printf("L1 scratch high-water mark: %d bytes\n", arena.peak);
+  </pre>
+  The arena is a stack: an allocation only moves the top of the stack, and plp_arena_free moves it
+  back, releasing the buffer together with all buffers allocated after it. Both take constant
+  time. The kernels release their scratch buffers before returning, thus the arena holds the same
+  data before and after every call, and the high-water mark depends only on the calls made.
+
+  The arena is not protected against concurrent use. The glue code allocates from it before the
+  fork, and an application should only use it from a single core of the cluster.
+  @{
+ */
+
+/**
+  @brief         Initialize an arena on a memory region.
+  @param[out]    arena      points to the arena
+  @param[in]     pBase      points to the memory region, usually in L1
+  @param[in]     size       size of the memory region in bytes
+  @return        none
+ */
+
+void plp_arena_init(plp_arena_t *arena, void *pBase, uint32_t size) {
+
+    // all allocations are word aligned
+    uint32_t skip = (4 - ((uint32_t)pBase & 3)) & 3;
+    if (pBase == NULL || size < skip) {
+        skip = 0;
+        size = 0;
+    }
+
+    arena->pBase = (uint8_t *)pBase + skip;
+    arena->size = (size - skip) & ~3;
+    arena->used = 0;
+    arena->peak = 0;
+}
+
+/**
+  @brief         Allocate a word aligned buffer on top of the arena.
+  @param[in,out] arena      points to the arena
+  @param[in]     size       size of the buffer in bytes
+  @return        pointer to the buffer, or NULL if the arena has not enough free memory left
+ */
+
+void *plp_arena_alloc(plp_arena_t *arena, uint32_t size) {
+
+    uint32_t aligned = (size + 3) & ~3;
+
+    if (aligned < size || aligned > arena->size - arena->used) {
+        return NULL;
+    }
+
+    void *ptr = arena->pBase + arena->used;
+    arena->used += aligned;
+    if (arena->used > arena->peak) {
+        arena->peak = arena->used;
+    }
+    return ptr;
+}
+
+/**
+  @brief         Release a buffer, and all buffers allocated after it.
+  @param[in,out] arena      points to the arena
+  @param[in]     ptr        points to a buffer returned by plp_arena_alloc
+  @return        none
+
+  @par
+  Buffers which were already released (e.g. with a buffer allocated before) and NULL are ignored.
+  Thus, a set of buffers can be freed in any order.
+ */
+
+void plp_arena_free(plp_arena_t *arena, void *ptr) {
+
+    uint8_t *p = (uint8_t *)ptr;
+
+    if (p >= arena->pBase && p < arena->pBase + arena->used) {
+        arena->used = p - arena->pBase;
+    }
+}
+
+/**
+  @brief         Release all buffers of the arena. The high-water mark is kept.
+  @param[in,out] arena      points to the arena
+  @return        none
+ */
+
+void plp_arena_reset(plp_arena_t *arena) {
+    arena->used = 0;
+}
+
+/**
+  @brief         Select the arena from which the kernels allocate their scratch buffers.
+  @param[in]     arena      points to an initialized arena, or NULL to allocate with rt_alloc
+  @return        none
+ */
+
+void plp_arena_use(plp_arena_t *arena) {
+    plp_arena_current = arena;
+}
+
+/**
+  @brief         Allocate a scratch buffer in L1 for a kernel.
+  @param[in]     size       size of the buffer in bytes
+  @return        pointer to the buffer, or NULL if there is not enough memory
+
+  @par
+  The buffer is taken from the arena selected with plp_arena_use, or allocated with rt_alloc if
+  there is none. It must be released with plp_scratch_free before the kernel returns.
+ */
+
+void *plp_scratch_alloc(uint32_t size) {
+
+    if (plp_arena_current != NULL) {
+        return plp_arena_alloc(plp_arena_current, size);
+    }
+    return rt_alloc(RT_ALLOC_CL_DATA, size);
+}
+
+/**
+  @brief         Release a scratch buffer allocated with plp_scratch_alloc.
+  @param[in]     ptr        points to the buffer, NULL is ignored
+  @param[in]     size       size of the buffer in bytes, as passed to plp_scratch_alloc
+  @return        none
+ */
+
+void plp_scratch_free(void *ptr, uint32_t size) {
+
+    if (ptr == NULL) {
+        return;
+    }
+    if (plp_arena_current != NULL) {
+        plp_arena_free(plp_arena_current, ptr);
+    } else {
+        rt_free(RT_ALLOC_CL_DATA, ptr, size);
+    }
+}
+
+/**
+  @} end of Arena group
+ */
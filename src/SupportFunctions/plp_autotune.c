@@ -0,0 +1,170 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_autotune.c
+ * Description:  selection of the fastest kernel variant per shape
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+// table of the tuned (function, shape bucket) pairs
+static plp_autotune_entry_t plp_autotune_entries[PLP_AUTOTUNE_TABLE_SIZE];
+static uint32_t plp_autotune_n_entries = 0;
+// entry which is replaced next, if the table is full
+static uint32_t plp_autotune_next = 0;
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Autotune Autotuning
+  The glue code selects the kernel only by the core it runs on, and the number of cores of a
+  parallel function is chosen by the caller. For small shapes, the fork and barrier of the
+  parallel kernel often cost more than they save, and fewer cores or the single core kernel is
+  faster.
+
+  The _autotune functions (e.g. plp_mat_mult_i16_autotune) choose by themselves: on the first
+  call with a new shape bucket (usually the number of bits of the sizes), they run the single
+  core kernel and the parallel kernel on 2, 4, ... up to rt_nb_pe() cores, measure the cycles of
+  every run with the performance counters, and remember the fastest variant. Later calls in the
+  same bucket run this variant only.
+  <pre>
+  for (i = 0; i < nFrames; i++) {
+      // the first call takes longer, all others use the fastest variant for this shape
+      plp_mat_mult_i16_autotune(pSrcA[i], pSrcB, M, N, O, pDstC[i]);
+  }
+  </pre>
+  Every variant writes the same output, and the inputs must not overlap with the output. The
+  table holds PLP_AUTOTUNE_TABLE_SIZE entries, the oldest one is replaced when it is full. The
+  table is not protected against concurrent use, and the measurement reconfigures the performance
+  counters of the calling core. On the fabric controller, the single core kernel is always used.
+  @{
+ */
+
+/**
+  @brief         Shape bucket of a size, which is the number of bits needed to represent it.
+  @param[in]     size       size of a dimension (e.g. the number of samples)
+  @return        bucket of the size, from 0 (size 0) to 32
+ */
+
+uint32_t plp_autotune_bucket(uint32_t size) {
+    return (size == 0) ? 0 : 32 - __builtin_clz(size);
+}
+
+/**
+  @brief         Run the fastest variant of a function for a shape bucket, after measuring all
+                 variants on the first call.
+  @param[in]     key        identifies the function, usually the address of the _autotune function
+  @param[in]     bucket     shape bucket of the call, see plp_autotune_bucket
+  @param[in]     run        runs the function on nPE cores, or the single core kernel if nPE is 0
+  @param[in]     args       arguments passed to run
+  @return        none
+ */
+
+void plp_autotune_run(const void *key, uint32_t bucket, plp_autotune_run_t run, void *args) {
+
+    uint32_t i;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        run(args, 0);
+        return;
+    }
+
+    for (i = 0; i < plp_autotune_n_entries; i++) {
+        if (plp_autotune_entries[i].key == key && plp_autotune_entries[i].bucket == bucket) {
+            run(args, plp_autotune_entries[i].nPE);
+            return;
+        }
+    }
+
+    // measure the single core kernel (nPE = 0) and 2, 4, ... cores, up to all cores
+    rt_perf_t perf;
+    uint32_t nbPE = rt_nb_pe();
+    uint32_t nPE = 0;
+    uint32_t bestPE = 0;
+    uint32_t bestCycles = 0xFFFFFFFF;
+
+    rt_perf_init(&perf);
+    rt_perf_conf(&perf, 1 << RT_PERF_CYCLES);
+
+    while (1) {
+        rt_perf_reset(&perf);
+        rt_perf_start(&perf);
+        run(args, nPE);
+        rt_perf_stop(&perf);
+
+        uint32_t cycles = rt_perf_read(RT_PERF_CYCLES);
+        if (cycles < bestCycles) {
+            bestCycles = cycles;
+            bestPE = nPE;
+        }
+
+        if (nPE == nbPE) {
+            break;
+        }
+        nPE = (nPE == 0) ? 2 : 2 * nPE;
+        if (nPE > nbPE) {
+            nPE = nbPE;
+        }
+    }
+
+    if (plp_autotune_n_entries < PLP_AUTOTUNE_TABLE_SIZE) {
+        i = plp_autotune_n_entries++;
+    } else {
+        i = plp_autotune_next;
+        plp_autotune_next = (plp_autotune_next + 1) % PLP_AUTOTUNE_TABLE_SIZE;
+    }
+
+    plp_autotune_entries[i].key = key;
+    plp_autotune_entries[i].bucket = bucket;
+    plp_autotune_entries[i].nPE = bestPE;
+    plp_autotune_entries[i].cycles = bestCycles;
+}
+
+/**
+  @brief         Forget all tuned variants, such that they are measured again on the next call.
+  @return        none
+ */
+
+void plp_autotune_reset(void) {
+    plp_autotune_n_entries = 0;
+    plp_autotune_next = 0;
+}
+
+/**
+  @brief         Get the table of the tuned variants.
+  @param[out]    pCount     number of entries in the table
+  @return        pointer to the first entry of the table
+ */
+
+const plp_autotune_entry_t *plp_autotune_table(uint32_t *pCount) {
+    *pCount = plp_autotune_n_entries;
+    return plp_autotune_entries;
+}
+
+/**
+  @} end of Autotune group
+ */
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_convert_f32_to_q16_parallel.c
+ * Description:  32-bit float to 16-bit fixed point parallel vector conversion glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Convert
+  @{
+ */
+
+/**
+  @brief         Glue code for parallel conversion of a 32-bit float vector to 16-bit fixed point.
+  @param[in]     pSrc       points to input vector
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     nPE        number of parallel processing units
+  @return        none
+ */
+
+void plp_convert_f32_to_q16_parallel(const float32_t *__restrict__ pSrc,
+                                     int16_t *__restrict__ pDst,
+                                     uint32_t blockSize,
+                                     uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_convert_instance args = { .pSrc = pSrc,
+                                       .pDst = pDst,
+                                       .blockSize = blockSize,
+                                       .nPE = nPE };
+        rt_team_fork(nPE, plp_convert_f32_to_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of Convert group
+ */
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_convert_q8_to_q16.c
+ * Description:  8-bit fixed point to 16-bit fixed point vector conversion glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Convert Vector Conversion
+  Converts a vector from one data type to another.
+
+  The fixed point types are interpreted as fractional numbers with the full range of the type,
+  i.e. q8 is Q1.7, q16 is Q1.15 and q32 is Q1.31, such that all represent values in [-1, 1).
+  <pre>
+  q8 to q16:   pDst[n] = pSrc[n] << 8
+  q16 to q8:   pDst[n] = sat((pSrc[n] + 2^7) >> 8)
+  q16 to f32:  pDst[n] = pSrc[n] / 2^15
+  f32 to q16:  pDst[n] = sat(round(pSrc[n] * 2^15)),   0 <= n < blockSize.
+  </pre>
+  Conversions to a wider fixed point type are exact. Conversions to a narrower fixed point type
+  round to the nearest value (ties towards positive infinity), and conversions from float round
+  to the nearest value (ties away from zero). Both saturate to the range of the output type.
+
+ */
+
+/**
+  @addtogroup Convert
+  @{
+ */
+
+/**
+  @brief         Glue code for converting an 8-bit fixed point vector to 16-bit fixed point.
+  @param[in]     pSrc       points to input vector
+  @param[out]    pDst       points to output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void plp_convert_q8_to_q16(const int8_t *__restrict__ pSrc,
+                           int16_t *__restrict__ pDst,
+                           uint32_t blockSize) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_convert_q8_to_q16s_rv32im(pSrc, pDst, blockSize);
+    } else {
+        plp_convert_q8_to_q16s_xpulpv2(pSrc, pDst, blockSize);
+    }
+}
+
+/**
+  @} end of Convert group
+ */
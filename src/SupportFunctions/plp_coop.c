@@ -0,0 +1,202 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_coop.c
+ * Description:  cooperative execution on the fabric controller and the cluster
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Coop Cooperative Execution
+  While a function runs on the cluster, the fabric controller usually just waits for it. The _coop
+  functions (e.g. plp_dot_prod_i32_coop) split the samples of one call between both: the cluster
+  processes the first samples with the _l2 function, which streams them from L2 through L1, and
+  the fabric controller processes the remaining samples directly in L2 with the RV32IM kernel at
+  the same time. The results of both shares are merged at the end.
+
+  The split follows the measured throughput. plp_coop_run measures the cycles of both shares, and
+  moves the share of the fabric controller towards the value for which both finish at the same
+  time. The cycles of the cluster are converted to cycles of the fabric controller with the
+  frequencies of both domains (see rt_freq_get).
+  <pre>
+  static plp_coop_t coop;
+
+  rt_event_alloc(NULL, 1);
+  plp_coop_init(&coop, PLP_COOP_ONE / 8);
+  for (i = 0; i < nFrames; i++) {
+      plp_dot_prod_i32_coop(&coop, pSrcA[i], pSrcB[i], blockSize, 8, &res[i]);
+  }
+  </pre>
+  The state must stay valid until the call returns, and every call needs one event (see
+  rt_event_alloc). The vectors must be in L2, since both sides read them. A state can be shared
+  by several functions, but the split then follows their average throughput, so every function
+  should use its own state if they differ a lot.
+  @{
+ */
+
+/**
+  @brief         Measure the cycles of the cluster share of plp_coop_run, on the cluster.
+  @param[in]     args       pointer to the plp_coop_t state of the call
+  @return        none
+ */
+
+static void plp_coop_cluster_entry(void *args) {
+
+    plp_coop_t *C = (plp_coop_t *)args;
+    rt_perf_t perf;
+
+    rt_perf_init(&perf);
+    rt_perf_conf(&perf, 1 << RT_PERF_CYCLES);
+    rt_perf_reset(&perf);
+    rt_perf_start(&perf);
+    C->clEntry(C->args);
+    rt_perf_stop(&perf);
+
+    C->clCycles = rt_perf_read(RT_PERF_CYCLES);
+}
+
+/**
+  @brief         Initialize the state of cooperative calls.
+  @param[out]    C          points to the state
+  @param[in]     fcShare    initial share of the fabric controller, in units of 1 / PLP_COOP_ONE
+  @return        none
+ */
+
+void plp_coop_init(plp_coop_t *C, uint32_t fcShare) {
+
+    if (fcShare > PLP_COOP_ONE) {
+        fcShare = PLP_COOP_ONE;
+    }
+
+    C->clEntry = NULL;
+    C->args = NULL;
+    C->fcShare = fcShare;
+    C->clCycles = 0;
+}
+
+/**
+  @brief         Number of samples of the fabric controller for the current share.
+  @param[in]     C          points to the state
+  @param[in]     blockSize  number of samples of the call
+  @return        number of samples of the fabric controller, which processes the last ones. The
+                 cluster processes the others, a multiple of 4 samples.
+ */
+
+uint32_t plp_coop_split(const plp_coop_t *C, uint32_t blockSize) {
+
+    uint32_t clLen = blockSize - (uint32_t)(((uint64_t)blockSize * C->fcShare) >> 16);
+
+    return blockSize - (clLen & ~3u);
+}
+
+/**
+  @brief         Run the cluster share of a call on the cluster and the fabric controller share on
+                 the fabric controller at the same time, and adapt the share to the measured
+                 cycles.
+  @param[in,out] C          points to the state
+  @param[in]     clEntry    processes the first clLen samples, runs on core 0 of the cluster
+  @param[in]     fcEntry    processes the last fcLen samples, runs on the fabric controller
+  @param[in]     args       arguments passed to clEntry and fcEntry
+  @param[in]     clLen      number of samples of the cluster
+  @param[in]     fcLen      number of samples of the fabric controller
+  @return        none
+
+  @par
+  The new share of the fabric controller is the mean of the old one and of the share for which
+  both would have finished at the same time, and stays between PLP_COOP_MIN_SHARE and
+  PLP_COOP_ONE - PLP_COOP_MIN_SHARE, such that both sides are measured again on the next call.
+  If one side has no samples, the other one runs alone and the share is kept.
+ */
+
+void plp_coop_run(plp_coop_t *C,
+                  void (*clEntry)(void *),
+                  void (*fcEntry)(void *),
+                  void *args,
+                  uint32_t clLen,
+                  uint32_t fcLen) {
+
+    if (rt_cluster_id() != ARCHI_FC_CID) {
+        printf("cooperative processing supported only for FC side\n");
+        return;
+    }
+
+    if (clLen == 0) {
+        fcEntry(args);
+        return;
+    }
+
+    rt_event_t *done = rt_event_get_blocking(NULL);
+    rt_perf_t perf;
+    uint32_t fcCycles;
+
+    C->clEntry = clEntry;
+    C->args = args;
+    plp_offload(&C->task, plp_coop_cluster_entry, (void *)C, done);
+
+    rt_perf_init(&perf);
+    rt_perf_conf(&perf, 1 << RT_PERF_CYCLES);
+    rt_perf_reset(&perf);
+    rt_perf_start(&perf);
+    if (fcLen > 0) {
+        fcEntry(args);
+    }
+    rt_perf_stop(&perf);
+    fcCycles = rt_perf_read(RT_PERF_CYCLES);
+
+    rt_event_wait(done);
+
+    if (fcLen == 0) {
+        return;
+    }
+
+    // samples per cycle of the fabric controller (in Q16) of both sides
+    uint64_t clCycles = (uint64_t)C->clCycles * rt_freq_get(RT_FREQ_DOMAIN_FC) /
+                        rt_freq_get(RT_FREQ_DOMAIN_CL);
+    uint64_t fcRate = ((uint64_t)fcLen << 16) / (fcCycles ? fcCycles : 1);
+    uint64_t clRate = ((uint64_t)clLen << 16) / (clCycles ? clCycles : 1);
+
+    if (fcRate + clRate == 0) {
+        return;
+    }
+
+    uint32_t share = (uint32_t)((fcRate * PLP_COOP_ONE) / (fcRate + clRate));
+    share = (C->fcShare + share) / 2;
+
+    if (share < PLP_COOP_MIN_SHARE) {
+        share = PLP_COOP_MIN_SHARE;
+    } else if (share > PLP_COOP_ONE - PLP_COOP_MIN_SHARE) {
+        share = PLP_COOP_ONE - PLP_COOP_MIN_SHARE;
+    }
+
+    C->fcShare = share;
+}
+
+/**
+  @} end of Coop group
+ */
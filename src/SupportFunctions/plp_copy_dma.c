@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_copy_dma.c
+ * Description:  asynchronous copy between L2 and L1 with the cluster DMA
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#ifndef PLP_COPY_DMA_MAX_BYTES
+#define PLP_COPY_DMA_MAX_BYTES 0x8000 // largest single DMA transfer
+#endif
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Copy
+  @{
+ */
+
+/**
+  @brief         Start a copy between L2 and L1 with the cluster DMA.
+  @param[in]     pSrc       points to the input buffer
+  @param[out]    pDst       points to the output buffer
+  @param[in]     nBytes     number of bytes to copy, must be larger than 0
+  @param[in]     dir        RT_DMA_DIR_EXT2LOC if pSrc is in L2 and pDst in L1, or
+                            RT_DMA_DIR_LOC2EXT if pSrc is in L1 and pDst in L2
+  @param[out]    copy       DMA copy descriptor, used to wait for the end of the copy
+  @return        none
+
+  @par DMA Transfers
+  The copy is split into transfers of at most PLP_COPY_DMA_MAX_BYTES bytes, which are all merged
+  into the same descriptor. The function returns as soon as the transfers are enqueued, such that
+  the cores can compute while the DMA is copying. plp_copy_dma_wait must be called before pDst is
+  read (EXT2LOC) or pSrc is overwritten (LOC2EXT). A typical use is double buffering: start the
+  copy of the next block, process the current block, and wait for the copy.
+  <pre>
+  plp_copy_dma(pL2 + blk, pL1[1], nBytes, RT_DMA_DIR_EXT2LOC, &copy);
+  process(pL1[0]);
+  plp_copy_dma_wait(&copy);
+  </pre>
+ */
+
+void plp_copy_dma(const void *__restrict__ pSrc,
+                  void *__restrict__ pDst,
+                  uint32_t nBytes,
+                  int dir,
+                  rt_dma_copy_t *copy) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA transfers supported only for cluster side\n");
+        return;
+    }
+
+    unsigned int ext; // address of the buffer in L2
+    unsigned int loc; // address of the buffer in L1
+
+    if (dir == RT_DMA_DIR_EXT2LOC) {
+        ext = (unsigned int)pSrc;
+        loc = (unsigned int)pDst;
+    } else {
+        ext = (unsigned int)pDst;
+        loc = (unsigned int)pSrc;
+    }
+
+    uint32_t offset = 0;
+    int merge = 0;
+    do {
+        uint32_t size = nBytes - offset;
+        if (size > PLP_COPY_DMA_MAX_BYTES) {
+            size = PLP_COPY_DMA_MAX_BYTES;
+        }
+        rt_dma_memcpy(ext + offset, loc + offset, size, dir, merge, copy);
+        offset += size;
+        merge = 1;
+    } while (offset < nBytes);
+}
+
+/**
+  @brief         Wait for the end of a copy started with plp_copy_dma.
+  @param[in]     copy       DMA copy descriptor passed to plp_copy_dma
+  @return        none
+ */
+
+void plp_copy_dma_wait(rt_dma_copy_t *copy) {
+    rt_dma_wait(copy);
+}
+
+/**
+  @} end of Copy group
+ */
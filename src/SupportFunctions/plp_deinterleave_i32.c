@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_deinterleave_i32.c
+ * Description:  Glue code for deinterleaving of 32-bit integer multi-channel data
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Interleave Interleaving
+  This module contains the conversion of multi-channel data between the interleaved layout, in
+  which the samples of all channels at the same time instant (a frame) are stored next to each
+  other, and the planar layout, in which every channel is stored as a contiguous vector. With nCh
+  channels of blockSize samples each, the sample n of channel c is stored at
+  <pre>
+  interleaved[n * nCh + c]
+  planar[c * blockSize + n]
+  </pre>
+  The planar layout is the one expected by most vector functions of this library, while sensors,
+  codecs and DMA streams usually deliver interleaved data. plp_deinterleave converts interleaved
+  data to the planar layout, and plp_interleave converts it back. The 8-bit and 16-bit kernels
+  for the cluster transpose blocks of frames in registers with the SIMD shuffle instructions.
+  plp_deinterleave_dma and plp_interleave_dma do the same conversion while copying the data
+  between L2 and L1 with the cluster DMA.
+ */
+
+/**
+  @addtogroup Interleave
+  @{
+ */
+
+/**
+  @brief Glue code for deinterleaving of 32-bit integer multi-channel data.
+  @param[in]  pSrc       points to the interleaved input of blockSize frames of nCh samples
+  @param[in]  nCh        number of channels
+  @param[in]  blockSize  number of samples of every channel
+  @param[out] pDst       points to the planar output, channel c starts at pDst[c * blockSize]
+  @return     none
+ */
+
+void plp_deinterleave_i32(const int32_t *__restrict__ pSrc,
+                          uint32_t nCh,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_deinterleave_i32s_rv32im(pSrc, nCh, blockSize, pDst);
+    } else {
+        plp_deinterleave_i32s_xpulpv2(pSrc, nCh, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of Interleave group
+ */
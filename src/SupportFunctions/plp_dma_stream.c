@@ -0,0 +1,218 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dma_stream.c
+ * Description:  double buffered streaming of L2 vectors through L1 tiles
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup DmaStream DMA Streaming
+  The vector kernels of the library expect their operands in L1. A stream moves vectors which
+  reside in L2 through L1 in tiles: up to two input vectors are copied into L1 with the cluster
+  DMA, and an optional output vector is copied back to L2. Every tile is double buffered, such
+  that the DMA copies the next input tile and writes back the previous output tile while the
+  cores process the current tile.
+  <pre>
+  plp_dma_stream_t S;
+  void *pA, *pB, *pDst;
+  uint32_t len;
+
+  plp_dma_stream_init(&S, pSrcA, pSrcB, sizeof(int16_t), pDst, sizeof(int32_t), blockSize,
+                      pBuf, bufSize);
+  while ((len = plp_dma_stream_next(&S, &pA, &pB, &pDst)) > 0) {
+      plp_mult_i16_parallel(pA, pB, pDst, len, nPE);
+  }
+  </pre>
+  The _l2 variants of the kernels (e.g. plp_dot_prod_i16_l2) are built this way, with a buffer of
+  PLP_DMA_STREAM_BUFFER_BYTES bytes taken with plp_scratch_alloc.
+  @{
+ */
+
+/**
+  @brief         Initialize a stream of L2 vectors through double buffered L1 tiles.
+  @param[out]    S          points to the stream
+  @param[in]     pSrcA      points to the first input vector in L2
+  @param[in]     pSrcB      points to the second input vector in L2, or NULL
+  @param[in]     srcSize    number of bytes of one sample of the input vectors
+  @param[out]    pDst       points to the output vector in L2, or NULL
+  @param[in]     dstSize    number of bytes of one sample of the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     pBuf       points to a word aligned buffer in L1
+  @param[in]     bufSize    size of the buffer in bytes
+  @return        number of samples per tile, or 0 if the buffer is too small for 8 samples per tile
+
+  @par
+  The number of samples per tile is a multiple of 8, such that every tile starts word aligned,
+  and the tiles are reduced in the same groups as the parallel kernels of the library.
+ */
+
+uint32_t plp_dma_stream_init(plp_dma_stream_t *S,
+                             const void *pSrcA,
+                             const void *pSrcB,
+                             uint32_t srcSize,
+                             void *pDst,
+                             uint32_t dstSize,
+                             uint32_t blockSize,
+                             void *pBuf,
+                             uint32_t bufSize) {
+
+    uint32_t sampleSize = srcSize;
+    if (pSrcB != NULL) {
+        sampleSize += srcSize;
+    }
+    if (pDst != NULL) {
+        sampleSize += dstSize;
+    }
+
+    uint32_t tileLen = (bufSize / (2 * sampleSize)) & ~7;
+
+    S->pSrcA = (const uint8_t *)pSrcA;
+    S->pSrcB = (const uint8_t *)pSrcB;
+    S->pDst = (uint8_t *)pDst;
+    S->srcSize = srcSize;
+    S->dstSize = dstSize;
+    S->blockSize = blockSize;
+    S->tileLen = tileLen;
+    S->nTiles = (tileLen > 0) ? (blockSize + tileLen - 1) / tileLen : 0;
+    S->tile = 0;
+
+    // split the buffer into the ping and pong tiles of every vector
+    uint8_t *p = (uint8_t *)pBuf;
+    for (uint32_t b = 0; b < 2; b++) {
+        S->pTileA[b] = p;
+        p += tileLen * srcSize;
+        S->pTileB[b] = p;
+        if (pSrcB != NULL) {
+            p += tileLen * srcSize;
+        }
+        S->pTileDst[b] = p;
+        if (pDst != NULL) {
+            p += tileLen * dstSize;
+        }
+    }
+
+    return tileLen;
+}
+
+// number of samples in the tile k
+static uint32_t plp_dma_stream_len(const plp_dma_stream_t *S, uint32_t k) {
+    uint32_t len = S->blockSize - k * S->tileLen;
+    return (len > S->tileLen) ? S->tileLen : len;
+}
+
+// start the copy of the input tile k into the buffer k & 1
+static void plp_dma_stream_fetch(plp_dma_stream_t *S, uint32_t k) {
+
+    uint32_t b = k & 1;
+    uint32_t offset = k * S->tileLen;
+    uint32_t len = plp_dma_stream_len(S, k);
+
+    plp_copy_dma(S->pSrcA + offset * S->srcSize, S->pTileA[b], len * S->srcSize,
+                 RT_DMA_DIR_EXT2LOC, &S->copyA[b]);
+    if (S->pSrcB != NULL) {
+        plp_copy_dma(S->pSrcB + offset * S->srcSize, S->pTileB[b], len * S->srcSize,
+                     RT_DMA_DIR_EXT2LOC, &S->copyB[b]);
+    }
+}
+
+/**
+  @brief         Get the next tile of a stream in L1.
+  @param[in,out] S          points to the stream
+  @param[out]    ppSrcA     pointer to the tile of the first input vector returned here
+  @param[out]    ppSrcB     pointer to the tile of the second input vector returned here
+  @param[out]    ppDst      pointer to the tile of the output vector returned here
+  @return        number of samples in the tile, or 0 at the end of the stream
+
+  @par
+  The output tile of the previous call is written back to L2, so it must be complete when
+  plp_dma_stream_next is called again. The function must be called until it returns 0, which
+  waits for the last write-backs.
+ */
+
+uint32_t plp_dma_stream_next(plp_dma_stream_t *S, void **ppSrcA, void **ppSrcB, void **ppDst) {
+
+    uint32_t k = S->tile;
+    uint32_t b = k & 1;
+
+    if (k > S->nTiles) {
+        return 0;
+    }
+    S->tile = k + 1;
+
+    // write back the tile processed since the last call
+    if (k > 0 && S->pDst != NULL) {
+        uint32_t offset = (k - 1) * S->tileLen;
+        plp_copy_dma(S->pTileDst[b ^ 1], S->pDst + offset * S->dstSize,
+                     plp_dma_stream_len(S, k - 1) * S->dstSize, RT_DMA_DIR_LOC2EXT,
+                     &S->copyOut[b ^ 1]);
+    }
+
+    // end of the stream, wait for the write-backs of the last two tiles
+    if (k == S->nTiles) {
+        if (S->pDst != NULL) {
+            if (k >= 2) {
+                plp_copy_dma_wait(&S->copyOut[b]);
+            }
+            if (k >= 1) {
+                plp_copy_dma_wait(&S->copyOut[b ^ 1]);
+            }
+        }
+        return 0;
+    }
+
+    if (k == 0) {
+        plp_dma_stream_fetch(S, 0);
+    }
+
+    plp_copy_dma_wait(&S->copyA[b]);
+    if (S->pSrcB != NULL) {
+        plp_copy_dma_wait(&S->copyB[b]);
+    }
+
+    // prefetch the next tile into the other buffer, which was consumed by the previous tile
+    if (k + 1 < S->nTiles) {
+        plp_dma_stream_fetch(S, k + 1);
+    }
+
+    // the output tile is reused from two tiles before, whose write-back must be finished
+    if (S->pDst != NULL && k >= 2) {
+        plp_copy_dma_wait(&S->copyOut[b]);
+    }
+
+    *ppSrcA = S->pTileA[b];
+    *ppSrcB = S->pTileB[b];
+    *ppDst = S->pTileDst[b];
+
+    return plp_dma_stream_len(S, k);
+}
+
+/**
+  @} end of DmaStream group
+ */
@@ -0,0 +1,154 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_interleave_dma.c
+ * Description:  Conversion between interleaved and planar data with the cluster DMA
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#ifndef PLP_COPY_DMA_MAX_BYTES
+#define PLP_COPY_DMA_MAX_BYTES 0x8000 // largest single DMA transfer
+#endif
+
+static void interleave_dma(unsigned int ext,
+                           unsigned int loc,
+                           uint32_t nCh,
+                           uint32_t blockSize,
+                           uint32_t elemSize,
+                           int dir,
+                           rt_dma_copy_t *copy);
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Interleave
+  @{
+ */
+
+/**
+  @brief         Start a copy of interleaved data from L2 into planar data in L1 with the cluster
+                 DMA.
+  @param[in]     pSrc       points to the interleaved input of blockSize frames of nCh samples, in
+                            L2
+  @param[in]     nCh        number of channels
+  @param[in]     blockSize  number of samples of every channel
+  @param[in]     elemSize   size of a sample in bytes
+  @param[out]    pDst       points to the planar output, in L1. Channel c starts at byte
+                            c * blockSize * elemSize
+  @param[out]    copy       DMA copy descriptor, used to wait for the end of the copy
+  @return        none
+
+  @par DMA Transfers
+  Every channel is copied with 2-D transfers, which read one sample of every frame with a stride
+  of nCh samples in L2, and write them contiguously in L1. All transfers are merged into the same
+  descriptor, and the function returns as soon as they are enqueued. plp_copy_dma_wait must be
+  called before pDst is read. The DMA moves only a single sample per burst, which keeps the cores
+  free but uses a small fraction of the bandwidth of the DMA. If the cores are idle anyway, it is
+  faster to copy the interleaved data with plp_copy_dma and convert it in L1 with
+  plp_deinterleave_parallel.
+ */
+
+void plp_deinterleave_dma(const void *__restrict__ pSrc,
+                          uint32_t nCh,
+                          uint32_t blockSize,
+                          uint32_t elemSize,
+                          void *__restrict__ pDst,
+                          rt_dma_copy_t *copy) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA transfers supported only for cluster side\n");
+        return;
+    }
+
+    interleave_dma((unsigned int)pSrc, (unsigned int)pDst, nCh, blockSize, elemSize,
+                   RT_DMA_DIR_EXT2LOC, copy);
+}
+
+/**
+  @brief         Start a copy of planar data from L1 into interleaved data in L2 with the cluster
+                 DMA.
+  @param[in]     pSrc       points to the planar input, in L1. Channel c starts at byte
+                            c * blockSize * elemSize
+  @param[in]     nCh        number of channels
+  @param[in]     blockSize  number of samples of every channel
+  @param[in]     elemSize   size of a sample in bytes
+  @param[out]    pDst       points to the interleaved output of blockSize frames of nCh samples,
+                            in L2
+  @param[out]    copy       DMA copy descriptor, used to wait for the end of the copy
+  @return        none
+
+  @par DMA Transfers
+  This is the counterpart of plp_deinterleave_dma: every channel is copied with 2-D transfers,
+  which write one sample of every frame with a stride of nCh samples in L2. plp_copy_dma_wait must
+  be called before pSrc is overwritten.
+ */
+
+void plp_interleave_dma(const void *__restrict__ pSrc,
+                        uint32_t nCh,
+                        uint32_t blockSize,
+                        uint32_t elemSize,
+                        void *__restrict__ pDst,
+                        rt_dma_copy_t *copy) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA transfers supported only for cluster side\n");
+        return;
+    }
+
+    interleave_dma((unsigned int)pDst, (unsigned int)pSrc, nCh, blockSize, elemSize,
+                   RT_DMA_DIR_LOC2EXT, copy);
+}
+
+/**
+  @} end of Interleave group
+ */
+
+// one 2-D transfer per channel and chunk of at most PLP_COPY_DMA_MAX_BYTES bytes in L1
+static void interleave_dma(unsigned int ext,
+                           unsigned int loc,
+                           uint32_t nCh,
+                           uint32_t blockSize,
+                           uint32_t elemSize,
+                           int dir,
+                           rt_dma_copy_t *copy) {
+
+    uint32_t maxFrames = PLP_COPY_DMA_MAX_BYTES / elemSize;
+    uint32_t c, n;
+    int merge = 0;
+
+    for (c = 0; c < nCh; c++) {
+        for (n = 0; n < blockSize; n += maxFrames) {
+            uint32_t len = blockSize - n;
+            if (len > maxFrames) {
+                len = maxFrames;
+            }
+            rt_dma_memcpy_2d(ext + (n * nCh + c) * elemSize, loc + (c * blockSize + n) * elemSize,
+                             len * elemSize, nCh * elemSize, elemSize, dir, merge, copy);
+            merge = 1;
+        }
+    }
+}
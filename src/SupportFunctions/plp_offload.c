@@ -0,0 +1,186 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_offload.c
+ * Description:  offloading of functions from the fabric controller to the cluster
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+// mounted clusters (one bit per cluster id), they stay mounted until plp_offload_deinit
+static uint32_t plp_offload_mounted = 0;
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Offload Offloading to the Cluster
+  The _parallel functions run only on the cluster. plp_offload runs a function on the cluster
+  from the fabric controller, without mounting the cluster again for every call. If an event is
+  given, plp_offload returns as soon as the call is issued, such that the fabric controller can
+  prepare the next buffer while the cluster computes, and the event is pushed when the function
+  is done. Without an event, plp_offload waits for the function.
+
+  There are typed versions for some functions (e.g. plp_offload_mat_mult_i16_parallel), which
+  store the arguments in their task.
+  <pre>
+  static plp_offload_mat_mult_task_i16 task;
+
+  rt_event_alloc(NULL, 1);
+  plp_offload_init();
+  for (i = 0; i < nFrames; i++) {
+      rt_event_t *done = rt_event_get_blocking(NULL);
+      plp_offload_mat_mult_i16_parallel(&task, pSrcA[i], pSrcB, M, N, O, 8, pDstC[i], done);
+      // prepare the next frame on the fabric controller
+      rt_event_wait(done);
+  }
+  plp_offload_deinit();
+  </pre>
+  The task, the arguments and the data must stay valid until the function is done, since the
+  cluster reads them while the fabric controller continues. The data can be in L2, or in L1 if
+  the function copies it with the DMA.
+
+  On configurations with several clusters, plp_offload_cluster runs a function on a given
+  cluster, and plp_offload_multicluster runs it on several clusters at once (e.g.
+  plp_mat_mult_i16_multicluster).
+  @{
+ */
+
+/**
+  @brief         Mount the cluster for plp_offload, if it is not mounted yet.
+  @return        none
+ */
+
+void plp_offload_init(void) {
+    if (!(plp_offload_mounted & 1)) {
+        rt_cluster_mount(1, 0, 0, NULL);
+        plp_offload_mounted |= 1;
+    }
+}
+
+/**
+  @brief         Unmount all clusters, after all offloaded functions are done.
+  @return        none
+ */
+
+void plp_offload_deinit(void) {
+    uint32_t cid;
+    for (cid = 0; cid < ARCHI_NB_CLUSTER; cid++) {
+        if (plp_offload_mounted & (1 << cid)) {
+            rt_cluster_mount(0, cid, 0, NULL);
+        }
+    }
+    plp_offload_mounted = 0;
+}
+
+/**
+  @brief         Run a function on the cluster, called from the fabric controller.
+  @param[in]     task       task of the call, valid until the function is done
+  @param[in]     entry      function which runs on core 0 of the cluster
+  @param[in]     args       arguments passed to entry
+  @param[in]     done       event pushed when the function is done, or NULL to wait for it
+  @return        none
+ */
+
+void plp_offload(plp_offload_task_t *task, void (*entry)(void *), void *args, rt_event_t *done) {
+    plp_offload_cluster(task, 0, entry, args, done);
+}
+
+/**
+  @brief         Run a function on a given cluster, called from the fabric controller.
+  @param[in]     task       task of the call, valid until the function is done
+  @param[in]     cid        cluster on which the function runs, below ARCHI_NB_CLUSTER
+  @param[in]     entry      function which runs on core 0 of the cluster
+  @param[in]     args       arguments passed to entry
+  @param[in]     done       event pushed when the function is done, or NULL to wait for it
+  @return        none
+ */
+
+void plp_offload_cluster(plp_offload_task_t *task,
+                         uint32_t cid,
+                         void (*entry)(void *),
+                         void *args,
+                         rt_event_t *done) {
+
+    if (rt_cluster_id() != ARCHI_FC_CID) {
+        printf("offloading supported only for FC side\n");
+        return;
+    }
+
+    if (cid >= ARCHI_NB_CLUSTER) {
+        printf("Error: there is no cluster %d\n", (int)cid);
+        return;
+    }
+
+    if (!(plp_offload_mounted & (1 << cid))) {
+        rt_cluster_mount(1, cid, 0, NULL);
+        plp_offload_mounted |= 1 << cid;
+    }
+
+    rt_cluster_call(&task->call, cid, entry, args, NULL, 0, 0, 0, done);
+}
+
+/**
+  @brief         Run a function on several clusters at once, and wait until all are done. Needs
+                 nClusters events (see rt_event_alloc).
+  @param[in]     tasks      array of nClusters tasks
+  @param[in]     nClusters  number of clusters, the function runs on the clusters 0 to nClusters-1
+  @param[in]     entry      function which runs on core 0 of every cluster
+  @param[in]     args       array of nClusters arguments, cluster c runs entry(args[c])
+  @return        none
+ */
+
+void plp_offload_multicluster(plp_offload_task_t *tasks,
+                              uint32_t nClusters,
+                              void (*entry)(void *),
+                              void *const *args) {
+
+    rt_event_t *done[ARCHI_NB_CLUSTER];
+    uint32_t cid;
+
+    if (rt_cluster_id() != ARCHI_FC_CID) {
+        printf("offloading supported only for FC side\n");
+        return;
+    }
+
+    if (nClusters > ARCHI_NB_CLUSTER) {
+        printf("Error: there are only %d clusters\n", ARCHI_NB_CLUSTER);
+        return;
+    }
+
+    for (cid = 0; cid < nClusters; cid++) {
+        done[cid] = rt_event_get_blocking(NULL);
+        plp_offload_cluster(&tasks[cid], cid, entry, args[cid], done[cid]);
+    }
+
+    for (cid = 0; cid < nClusters; cid++) {
+        rt_event_wait(done[cid]);
+    }
+}
+
+/**
+  @} end of Offload group
+ */
@@ -0,0 +1,293 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_profile.c
+ * Description:  per-function cycle accounting of the library calls
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+#ifdef PLP_MATH_PROFILE
+
+// table of the functions called so far, in the order of their first call
+static plp_profile_entry_t plp_profile_entries[PLP_PROFILE_MAX_FUNCTIONS];
+static uint32_t plp_profile_n_entries = 0;
+// number of calls which did not fit into the table
+static uint32_t plp_profile_dropped = 0;
+// number of library functions currently running, only the outermost one is measured
+static uint32_t plp_profile_depth = 0;
+static rt_perf_t plp_profile_perf;
+// histogram of the shapes, in the order of their first call
+static plp_profile_shape_t plp_profile_shape_entries[PLP_PROFILE_MAX_SHAPES];
+static uint32_t plp_profile_n_shapes = 0;
+// number of calls whose shape did not fit into the histogram
+static uint32_t plp_profile_shapes_dropped = 0;
+
+void __cyg_profile_func_enter(void *fn, void *caller) __attribute__((no_instrument_function));
+void __cyg_profile_func_exit(void *fn, void *caller) __attribute__((no_instrument_function));
+
+/**
+  @brief         Hook called by the instrumented glue code when a function is entered.
+  @param[in]     fn         address of the function
+  @param[in]     caller     address of the call site
+  @return        none
+ */
+
+void __cyg_profile_func_enter(void *fn, void *caller) {
+
+    if (plp_profile_depth++ == 0) {
+        rt_perf_init(&plp_profile_perf);
+        rt_perf_conf(&plp_profile_perf, (1 << RT_PERF_CYCLES) | (1 << RT_PERF_LD_STALL));
+        rt_perf_reset(&plp_profile_perf);
+        rt_perf_start(&plp_profile_perf);
+    }
+}
+
+/**
+  @brief         Hook called by the instrumented glue code when a function returns.
+  @param[in]     fn         address of the function
+  @param[in]     caller     address of the call site
+  @return        none
+ */
+
+void __cyg_profile_func_exit(void *fn, void *caller) {
+
+    uint32_t i;
+
+    if (--plp_profile_depth != 0) {
+        return;
+    }
+
+    rt_perf_stop(&plp_profile_perf);
+
+    for (i = 0; i < plp_profile_n_entries; i++) {
+        if (plp_profile_entries[i].fn == fn) {
+            break;
+        }
+    }
+
+    if (i == plp_profile_n_entries) {
+        if (i == PLP_PROFILE_MAX_FUNCTIONS) {
+            plp_profile_dropped++;
+            return;
+        }
+        plp_profile_entries[i].fn = fn;
+        plp_profile_entries[i].calls = 0;
+        plp_profile_entries[i].cycles = 0;
+        plp_profile_entries[i].ldStalls = 0;
+        plp_profile_n_entries++;
+    }
+
+    plp_profile_entries[i].calls++;
+    plp_profile_entries[i].cycles += rt_perf_read(RT_PERF_CYCLES);
+    plp_profile_entries[i].ldStalls += rt_perf_read(RT_PERF_LD_STALL);
+}
+
+#endif // PLP_MATH_PROFILE
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Profile Profiling
+  The library can be built with `make PLP_MATH_PROFILE=1`, which instruments all glue code with
+  the hooks of `-finstrument-functions`. Then, the performance counters are started when a library
+  function is called, and the number of calls, the cycles and the load stalls are accumulated per
+  function. The application can dump the table at any time:
+  <pre>
+  plp_profile_reset();
+  ...
+  plp_mat_mult_i16(pSrcA, pSrcB, M, N, O, pDstC);
+  ...
+  plp_profile_print();
+  </pre>
+  The functions are identified by their address, which can be translated to the name with the
+  symbol table of the application (e.g. with `addr2line -f -e <binary> <address>`).
+
+  Some functions (e.g. plp_mat_mult, plp_conv and plp_fir) also record the shape of every call
+  with PLP_PROFILE_SHAPE, in a histogram of the number of calls per function, core (FC or cluster)
+  and shape. plp_profile_print_shapes prints it as CSV:
+  <pre>
+  function,device,d0,d1,d2,calls
+  plp_mat_mult_i16,cluster,7,23,1,1200
+  </pre>
+  The benchmarks in test/mrWolf replay this file with the shapes and weights of the application
+  (see TEST_SHAPE_PROFILE in test/README.md).
+
+  Only the outermost call is measured: if a library function calls another one (e.g. the _l2
+  functions call plp_dma_stream_next), the cycles are accounted to the caller. The kernels are not
+  instrumented, thus a parallel function is measured on the core which forks the team, including
+  the fork and the barrier. The profiler configures and resets the performance counters on every
+  call, and should only be used from a single core at a time. Without PLP_MATH_PROFILE, the table
+  stays empty.
+  @{
+ */
+
+/**
+  @brief         Clear the table of the library functions recorded with PLP_MATH_PROFILE.
+  @return        none
+ */
+
+void plp_profile_reset(void) {
+#ifdef PLP_MATH_PROFILE
+    plp_profile_n_entries = 0;
+    plp_profile_dropped = 0;
+    plp_profile_n_shapes = 0;
+    plp_profile_shapes_dropped = 0;
+#endif
+}
+
+/**
+  @brief         Get the table of the library functions recorded with PLP_MATH_PROFILE.
+  @param[out]    pCount     number of entries in the table, 0 if the library is built without
+                            PLP_MATH_PROFILE
+  @return        pointer to the first entry of the table
+ */
+
+const plp_profile_entry_t *plp_profile_table(uint32_t *pCount) {
+#ifdef PLP_MATH_PROFILE
+    *pCount = plp_profile_n_entries;
+    return plp_profile_entries;
+#else
+    *pCount = 0;
+    return NULL;
+#endif
+}
+
+/**
+  @brief         Print the table of the library functions recorded with PLP_MATH_PROFILE.
+  @return        none
+ */
+
+void plp_profile_print(void) {
+#ifdef PLP_MATH_PROFILE
+    uint32_t i;
+
+    printf("function    calls      cycles  ld_stall\n");
+    for (i = 0; i < plp_profile_n_entries; i++) {
+        printf("0x%08x %6d %11d %9d\n", (unsigned int)plp_profile_entries[i].fn,
+               plp_profile_entries[i].calls, plp_profile_entries[i].cycles,
+               plp_profile_entries[i].ldStalls);
+    }
+    if (plp_profile_dropped > 0) {
+        printf("%d calls not recorded, increase PLP_PROFILE_MAX_FUNCTIONS\n", plp_profile_dropped);
+    }
+#else
+    printf("the library is built without PLP_MATH_PROFILE\n");
+#endif
+}
+
+/**
+  @brief         Record a call of a library function with its shape, if the library is built with
+                 PLP_MATH_PROFILE. Only the outermost library call is recorded.
+  @param[in]     name       name of the function
+  @param[in]     d0         first dimension of the call
+  @param[in]     d1         second dimension of the call, 0 if unused
+  @param[in]     d2         third dimension of the call, 0 if unused
+  @return        none
+ */
+
+void plp_profile_shape(const char *name, uint32_t d0, uint32_t d1, uint32_t d2) {
+#ifdef PLP_MATH_PROFILE
+    uint32_t i;
+    uint32_t fc = rt_cluster_id() == ARCHI_FC_CID;
+
+    // only the outermost library call is recorded, like its cycles
+    if (plp_profile_depth > 1) {
+        return;
+    }
+
+    // the name is __func__ of the caller, thus, the same function passes the same pointer
+    for (i = 0; i < plp_profile_n_shapes; i++) {
+        plp_profile_shape_t *e = &plp_profile_shape_entries[i];
+        if (e->name == name && e->fc == fc && e->dims[0] == d0 && e->dims[1] == d1 &&
+            e->dims[2] == d2) {
+            break;
+        }
+    }
+
+    if (i == plp_profile_n_shapes) {
+        if (i == PLP_PROFILE_MAX_SHAPES) {
+            plp_profile_shapes_dropped++;
+            return;
+        }
+        plp_profile_shape_entries[i].name = name;
+        plp_profile_shape_entries[i].fc = fc;
+        plp_profile_shape_entries[i].dims[0] = d0;
+        plp_profile_shape_entries[i].dims[1] = d1;
+        plp_profile_shape_entries[i].dims[2] = d2;
+        plp_profile_shape_entries[i].calls = 0;
+        plp_profile_n_shapes++;
+    }
+
+    plp_profile_shape_entries[i].calls++;
+#endif
+}
+
+/**
+  @brief         Get the histogram of the shapes recorded with PLP_MATH_PROFILE.
+  @param[out]    pCount     number of entries in the histogram, 0 if the library is built without
+                            PLP_MATH_PROFILE
+  @return        pointer to the first entry of the histogram
+ */
+
+const plp_profile_shape_t *plp_profile_shapes(uint32_t *pCount) {
+#ifdef PLP_MATH_PROFILE
+    *pCount = plp_profile_n_shapes;
+    return plp_profile_shape_entries;
+#else
+    *pCount = 0;
+    return NULL;
+#endif
+}
+
+/**
+  @brief         Print the histogram of the shapes recorded with PLP_MATH_PROFILE as CSV.
+  @return        none
+ */
+
+void plp_profile_print_shapes(void) {
+#ifdef PLP_MATH_PROFILE
+    uint32_t i;
+
+    printf("function,device,d0,d1,d2,calls\n");
+    for (i = 0; i < plp_profile_n_shapes; i++) {
+        plp_profile_shape_t *e = &plp_profile_shape_entries[i];
+        printf("%s,%s,%d,%d,%d,%d\n", e->name, e->fc ? "fc" : "cluster", e->dims[0], e->dims[1],
+               e->dims[2], e->calls);
+    }
+    if (plp_profile_shapes_dropped > 0) {
+        printf("%d calls not recorded, increase PLP_PROFILE_MAX_SHAPES\n",
+               plp_profile_shapes_dropped);
+    }
+#else
+    printf("the library is built without PLP_MATH_PROFILE\n");
+#endif
+}
+
+/**
+  @} end of Profile group
+ */
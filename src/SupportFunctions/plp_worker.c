@@ -0,0 +1,162 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_worker.c
+ * Description:  persistent worker which runs commands on the cluster
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Worker Cluster Worker
+  Every plp_offload issues a new cluster call. If the cluster runs many short functions (e.g.
+  one block of a stream at a time), the call costs more than the function. A worker is offloaded
+  once, and stays on core 0 of the cluster: the fabric controller pushes commands (a function and
+  its arguments) to a queue, which the worker runs one after the other.
+  <pre>
+  static plp_worker_t worker;
+
+  rt_event_alloc(NULL, 1);
+  plp_worker_start(&worker);
+  for (i = 0; i < nBlocks; i++) {
+      uint32_t ticket = plp_worker_push(&worker, process_block, &blocks[i]);
+      // prepare the next block on the fabric controller
+      plp_worker_wait(&worker, ticket);
+  }
+  plp_worker_stop(&worker);
+  plp_offload_deinit();
+  </pre>
+  The queue is a ring buffer with a single producer (the fabric controller, which writes head)
+  and a single consumer (the cluster, which writes tail), so it needs no lock. The worker polls
+  head while the queue is empty, such that it starts a command without waking up. The commands
+  can fork to the other cores (e.g. call a _parallel function). The worker, the commands and their
+  arguments must be accessible from both the fabric controller and the cluster (e.g. in L2).
+  @{
+ */
+
+/**
+  @brief         Run the commands of a worker, until the NULL command of plp_worker_stop.
+  @param[in]     args       pointer to the plp_worker_t
+  @return        none
+ */
+
+static void plp_worker_loop(void *args) {
+
+    plp_worker_t *worker = (plp_worker_t *)args;
+    uint32_t tail = worker->tail;
+
+    while (1) {
+        while (worker->head == tail) {
+            // wait for the next command
+        }
+        __sync_synchronize();
+
+        plp_worker_cmd_t *cmd = &worker->cmds[tail % PLP_WORKER_QUEUE_SIZE];
+        if (cmd->entry == NULL) {
+            worker->tail = tail + 1;
+            return;
+        }
+        cmd->entry(cmd->args);
+
+        __sync_synchronize();
+        tail++;
+        worker->tail = tail;
+    }
+}
+
+/**
+  @brief         Start a worker on the cluster, which runs the commands of plp_worker_push until
+                 plp_worker_stop.
+  @param[in]     worker     worker to start, valid until it has stopped
+  @return        none
+ */
+
+void plp_worker_start(plp_worker_t *worker) {
+    worker->head = 0;
+    worker->tail = 0;
+    worker->done = rt_event_get_blocking(NULL);
+    plp_offload(&worker->task, plp_worker_loop, (void *)worker, worker->done);
+}
+
+/**
+  @brief         Push a command to the queue of a worker, and wait if the queue is full.
+  @param[in]     worker     running worker
+  @param[in]     entry      function which runs on core 0 of the cluster
+  @param[in]     args       arguments passed to entry, valid until the command is done
+  @return        ticket of the command, see plp_worker_wait
+ */
+
+uint32_t plp_worker_push(plp_worker_t *worker, void (*entry)(void *), void *args) {
+
+    uint32_t head = worker->head;
+
+    while (head - worker->tail >= PLP_WORKER_QUEUE_SIZE) {
+        // wait until the cluster has taken a command
+    }
+
+    plp_worker_cmd_t *cmd = &worker->cmds[head % PLP_WORKER_QUEUE_SIZE];
+    cmd->entry = entry;
+    cmd->args = args;
+
+    // the command must be written before the cluster sees the new head
+    __sync_synchronize();
+    head++;
+    worker->head = head;
+
+    return head;
+}
+
+/**
+  @brief         Wait until a command of a worker is done.
+  @param[in]     worker     running worker
+  @param[in]     ticket     ticket returned by plp_worker_push
+  @return        none
+ */
+
+void plp_worker_wait(plp_worker_t *worker, uint32_t ticket) {
+    while ((int32_t)(worker->tail - ticket) < 0) {
+        // wait for the cluster
+    }
+    __sync_synchronize();
+}
+
+/**
+  @brief         Stop a worker, after all pushed commands are done.
+  @param[in]     worker     running worker
+  @return        none
+ */
+
+void plp_worker_stop(plp_worker_t *worker) {
+    plp_worker_push(worker, NULL, NULL);
+    rt_event_wait(worker->done);
+}
+
+/**
+  @} end of Worker group
+ */
@@ -167,6 +167,95 @@ plp_bitreversal_32s_xpulpv2(uint32_t *pSrc, const uint16_t bitRevLen, const uint
     }
 }
 
+/**
+  @brief         In-place 32 bit reversal function.
+  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
+  @param[in]     bitRevLen   bit reversal table length
+  @param[in]     pBitRevTab  points to bit reversal table
+  @param[in]     nPE         number of cores
+  @return        none
+
+  @par The swap pairs of the table are disjoint, so every core swaps its own contiguous chunk of
+  pairs without synchronization.
+*/
+
+void plp_bitreversal_32p_xpulpv2(uint32_t *pSrc,
+                                 const uint16_t bitRevLen,
+                                 const uint16_t *pBitRevTab,
+                                 uint32_t nPE) {
+    uint32_t a, b, i, tmp;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t nPairs = bitRevLen >> 1;
+    uint32_t step = (nPairs + nPE - 1) / nPE;
+    uint32_t start = MIN(core_id * step, nPairs) << 1;
+    uint32_t end = MIN(core_id * step + step, nPairs) << 1;
+
+    for (i = start; i < end; i += 2) {
+        a = pBitRevTab[i] >> 2;
+        b = pBitRevTab[i + 1] >> 2;
+
+        // real
+        tmp = pSrc[a];
+        pSrc[a] = pSrc[b];
+        pSrc[b] = tmp;
+
+        // complex
+        tmp = pSrc[a + 1];
+        pSrc[a + 1] = pSrc[b + 1];
+        pSrc[b + 1] = tmp;
+    }
+}
+
+/**
+  @brief         In-place bit reversal of floating-point complex data for XPULPV2
+  @param[in,out] pSrc            points to in-place buffer of complex data
+  @param[in]     fftLen          number of complex elements, a power of two
+  @param[in]     pBitReverseLUT  points to the bit reversal table of plp_rfft_instance_f32, or NULL
+                                 to compute the indices
+  @param[in]     lutShift        amount to shift the table entries to the right, 1 if the table
+                                 was made for twice the length
+  @param[in]     coreId          index of the calling core, 0 for single core processing
+  @param[in]     nPE             number of cores executing this function together
+  @return        none
+
+  @par Parallelization
+  Every element j is swapped with its bit reversed index by the core j % nPE, if this index is
+  larger than j. Hence, every swap is done by exactly one core. The cores synchronize with a
+  barrier at the end.
+*/
+
+void plp_bitreversal_f32_xpulpv2(Complex_type_f32 *pSrc,
+                                 uint32_t fftLen,
+                                 const uint16_t *pBitReverseLUT,
+                                 uint32_t lutShift,
+                                 uint32_t coreId,
+                                 uint32_t nPE) {
+    uint32_t i, j, index;
+    uint32_t log2Len = log2(fftLen);
+    Complex_type_f32 tmp;
+
+    for (j = coreId; j < fftLen; j += nPE) {
+        if (pBitReverseLUT) {
+            index = pBitReverseLUT[j] >> lutShift;
+        } else {
+            index = 0;
+            for (i = 0; i < log2Len; i++) {
+                index |= ((j >> i) & 1) << (log2Len - 1 - i);
+            }
+        }
+        if (index > j) {
+            tmp = pSrc[j];
+            pSrc[j] = pSrc[index];
+            pSrc[index] = tmp;
+        }
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+}
+
 /**
  * @} end of FFT group
  */
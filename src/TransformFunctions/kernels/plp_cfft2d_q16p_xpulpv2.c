@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft2d_q16p_xpulpv2.c
+ * Description:  Tile kernel of the parallel 16-bit fixed-point 2-D complex FFT for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Transforms of one L1 tile of the parallel quantized 16 bit 2-D complex FFT for
+ *             XPULPV2
+ *
+ * If pTrans is NULL, the tile holds nChannels rows, which are transformed in place. Else, the tile
+ * holds fftLen lines of nChannels complex values (a block of columns). The cores transpose it into
+ * pTrans, such that every column is contiguous, transform the columns, and transpose them back.
+ * Each transpose splits the lines of the tile over the cores, and the transforms are distributed
+ * like in plp_cfft_q16p_batched_xpulpv2.
+ *
+ * @param[in]   args    points to the plp_cfft2d_instance_q16_parallel
+ */
+
+void plp_cfft2d_q16p_xpulpv2(void *args) {
+    plp_cfft2d_instance_q16_parallel *a = (plp_cfft2d_instance_q16_parallel *)args;
+
+    uint32_t coreId = rt_core_id();
+    uint32_t nPE = a->nPE;
+    uint32_t len = a->S->fftLen;
+    uint32_t n = a->nChannels;
+    uint32_t chunk = (len + nPE - 1) / nPE;
+    uint32_t start = MIN(coreId * chunk, len);
+    uint32_t end = MIN(start + chunk, len);
+    uint32_t r, c;
+
+    // complex values are moved as 32-bit words
+    uint32_t *pTile = (uint32_t *)a->pTile;
+    uint32_t *pTrans = (uint32_t *)a->pTrans;
+
+    if (pTrans != NULL) {
+        for (r = start; r < end; r++) {
+            for (c = 0; c < n; c++) {
+                pTrans[c * len + r] = pTile[r * n + c];
+            }
+        }
+        rt_team_barrier();
+    }
+
+    plp_cfft_instance_q16_batched_parallel batchArgs = { .S = a->S,
+                                                         .pChannels = a->pChannels,
+                                                         .nChannels = n,
+                                                         .ifftFlag = a->ifftFlag,
+                                                         .bitReverseFlag = 1,
+                                                         .deciPoint = 15,
+                                                         .nPE = nPE };
+
+    plp_cfft_q16p_batched_xpulpv2((void *)&batchArgs);
+
+    if (pTrans != NULL) {
+        rt_team_barrier();
+        for (r = start; r < end; r++) {
+            for (c = 0; c < n; c++) {
+                pTile[r * n + c] = pTrans[c * len + r];
+            }
+        }
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
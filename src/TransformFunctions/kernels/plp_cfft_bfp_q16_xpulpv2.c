@@ -0,0 +1,372 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16_xpulpv2.c
+ * Description:  16-bit block-floating-point complex FFT kernels for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/* HELPER FUNCTIONS */
+
+static inline int32_t shift_bfp_q16(uint32_t maxSq, int32_t growth);
+static inline uint32_t reduce_bfp_q16(uint32_t maxSq,
+                                      uint32_t *pMax,
+                                      uint32_t slot,
+                                      uint32_t coreId,
+                                      uint32_t nPE);
+static uint32_t process_stage_bfp_q16(const int16_t *pIn,
+                                      int16_t *pOut,
+                                      uint32_t n,
+                                      uint32_t s,
+                                      const int16_t *pTwiddle,
+                                      int32_t dir,
+                                      int32_t shift,
+                                      uint32_t coreId,
+                                      uint32_t nPE);
+static void process_last_radix2_bfp_q16(const int16_t *pIn,
+                                        int16_t *pOut,
+                                        uint32_t s,
+                                        int32_t shift,
+                                        uint32_t coreId,
+                                        uint32_t nPE);
+static inline int32_t process_cfft_bfp_q16(const plp_cfft_instance_q16 *S,
+                                           const int16_t *pSrc,
+                                           int16_t *pDst,
+                                           int16_t *pBuffer,
+                                           uint8_t ifftFlag,
+                                           uint32_t *pMax,
+                                           uint32_t coreId,
+                                           uint32_t nPE);
+
+/**
+   @ingroup fft
+ */
+
+/**
+   @addtogroup fftKernels
+   @{
+*/
+
+/**
+   @brief  16-bit block-floating-point FFT on complex input data for XPULPV2 extension.
+   @param[in]   S         points to an instance of the 16-bit fixed-point CFFT structure
+   @param[in]   pSrc      points to the complex input buffer of size <code>2*fftLen</code>
+   @param[out]  pDst      points to the complex output buffer of size <code>2*fftLen</code>
+   @param[in]   pBuffer   points to a scratch buffer of size <code>2*fftLen</code>
+   @param[in]   ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+                          transform.
+   @return      block exponent of the output
+
+   @par Dynamic Scaling
+   Every stage keeps the largest squared magnitude of all complex values it writes. Before the
+   next stage, its leading zeros give the headroom of the whole block, and the stage shifts its
+   input such that the largest magnitude just stays below 1 after the growth of the stage (at
+   most 4 for a radix-4 stage and 2 for the last radix-2 stage). The shift is to the right only if
+   the block has not enough headroom, and to the left if the block has more headroom than needed,
+   such that low-level signals are normalized to the full 16-bit range.
+*/
+int32_t plp_cfft_bfp_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                                  const int16_t *__restrict__ pSrc,
+                                  int16_t *__restrict__ pDst,
+                                  int16_t *__restrict__ pBuffer,
+                                  uint8_t ifftFlag) {
+
+    return process_cfft_bfp_q16(S, pSrc, pDst, pBuffer, ifftFlag, NULL, 0, 1);
+}
+
+/**
+   @brief  16-bit block-floating-point FFT on complex input data for XPULPV2 extension (parallel
+           version).
+   @param[in]   args    points to the plp_cfft_bfp_instance_q16_parallel
+   @return      none, the block exponent is written to args->exponent
+
+   @par Parallelization
+   The butterflies of every stage are split into contiguous chunks over the cores. Each core
+   publishes the largest squared magnitude of its chunk in pMax, and the barrier between the
+   stages makes it visible to all cores, which then choose the same shift. pMax alternates between
+   two halves, such that a core can not overwrite a value that another core still reads.
+*/
+void plp_cfft_bfp_q16p_xpulpv2(void *args) {
+
+    plp_cfft_bfp_instance_q16_parallel *a = (plp_cfft_bfp_instance_q16_parallel *)args;
+    uint32_t coreId = rt_core_id();
+
+    int32_t exponent = process_cfft_bfp_q16(a->S, a->pSrc, a->pDst, a->pBuffer, a->ifftFlag,
+                                            a->pMax, coreId, a->nPE);
+
+    if (coreId == 0) {
+        a->exponent = exponent;
+    }
+}
+
+/**
+   @} end of fftKernels group
+*/
+
+/*
+ * Shift of the next stage, such that its output stays below 2^15 if the largest squared magnitude
+ * of its input is maxSq and the stage grows the magnitudes by up to 2^growth. The limit leaves a
+ * margin for the truncation of the shifts and of the twiddle factor multiplication. A negative
+ * shift is a left shift.
+ */
+static inline int32_t shift_bfp_q16(uint32_t maxSq, int32_t growth) {
+
+    uint32_t limit = (1 << (15 - growth)) - 4;
+    int32_t shift;
+
+    if (maxSq == 0) {
+        return 0;
+    }
+
+    // the magnitude is below 2^k, with k = ceil(log2(maxSq + 1) / 2)
+    shift = ((33 - __builtin_clz(maxSq)) >> 1) + growth - 15;
+    if (((shift >= 0) ? (maxSq >> (2 * shift)) : (maxSq << (-2 * shift))) >= limit * limit) {
+        shift++;
+    }
+    return shift;
+}
+
+// maximum of the squared magnitudes of all cores, the barrier also completes the current stage
+static inline uint32_t reduce_bfp_q16(uint32_t maxSq,
+                                      uint32_t *pMax,
+                                      uint32_t slot,
+                                      uint32_t coreId,
+                                      uint32_t nPE) {
+
+    uint32_t i;
+
+    if (nPE == 1) {
+        return maxSq;
+    }
+
+    pMax[slot * nPE + coreId] = maxSq;
+    rt_team_barrier();
+
+    maxSq = 0;
+    for (i = 0; i < nPE; i++) {
+        if (pMax[slot * nPE + i] > maxSq) {
+            maxSq = pMax[slot * nPE + i];
+        }
+    }
+    return maxSq;
+}
+
+static inline int32_t process_cfft_bfp_q16(const plp_cfft_instance_q16 *S,
+                                           const int16_t *pSrc,
+                                           int16_t *pDst,
+                                           int16_t *pBuffer,
+                                           uint8_t ifftFlag,
+                                           uint32_t *pMax,
+                                           uint32_t coreId,
+                                           uint32_t nPE) {
+
+    uint32_t i;
+    int32_t shift, re, im;
+    uint32_t sq;
+    uint32_t N = S->fftLen;
+    uint32_t n = N;
+    uint32_t s = 1;
+    uint32_t log2N = 0;
+    uint32_t slot = 0;
+    uint32_t maxSq = 0;
+    int32_t exponent = 0;
+    int32_t dir = ifftFlag ? -1 : 1;
+    uint32_t chunk = (N + nPE - 1) / nPE;
+    uint32_t start = MIN(coreId * chunk, N);
+    uint32_t end = MIN(start + chunk, N);
+    const int16_t *pIn = pSrc;
+    int16_t *pOut;
+
+    while ((1U << log2N) < N) {
+        log2N++;
+    }
+
+    // choose the first output buffer such that the last stage writes pDst
+    pOut = (((log2N + 1) >> 1) & 1) ? pDst : pBuffer;
+
+    // largest squared magnitude of the input, which can reach 2^31
+    for (i = start; i < end; i++) {
+        re = pSrc[2 * i];
+        im = pSrc[2 * i + 1];
+        sq = (uint32_t)(re * re) + (uint32_t)(im * im);
+        if (sq > maxSq) {
+            maxSq = sq;
+        }
+    }
+    maxSq = reduce_bfp_q16(maxSq, pMax, slot, coreId, nPE);
+
+    for (; n >= 4; n >>= 2, s <<= 2) {
+        shift = shift_bfp_q16(maxSq, 2);
+        exponent += shift;
+
+        maxSq = process_stage_bfp_q16(pIn, pOut, n, s, S->pTwiddle, dir, shift, coreId, nPE);
+        pIn = pOut;
+        pOut = (pOut == pDst) ? pBuffer : pDst;
+
+        // the last stage needs neither the headroom nor a barrier
+        if (n > 4) {
+            slot ^= 1;
+            maxSq = reduce_bfp_q16(maxSq, pMax, slot, coreId, nPE);
+        }
+    }
+
+    // last stage, only if log2(fftLen) is odd
+    if (n == 2) {
+        shift = shift_bfp_q16(maxSq, 1);
+        exponent += shift;
+
+        process_last_radix2_bfp_q16(pIn, pOut, s, shift, coreId, nPE);
+    }
+
+    return exponent;
+}
+
+/*
+ * Same decimation-in-frequency Stockham radix-4 stage as plp_cfft_stockham_q16, but the inputs
+ * are shifted by shift instead of 2. Returns the largest squared magnitude of all values written
+ * by this core.
+ */
+static uint32_t process_stage_bfp_q16(const int16_t *pIn,
+                                      int16_t *pOut,
+                                      uint32_t n,
+                                      uint32_t s,
+                                      const int16_t *pTwiddle,
+                                      int32_t dir,
+                                      int32_t shift,
+                                      uint32_t coreId,
+                                      uint32_t nPE) {
+
+    uint32_t b, p, q, qEnd, u;
+    uint32_t up = (shift < 0) ? -shift : 0;
+    uint32_t down = (shift > 0) ? shift : 0;
+    uint32_t m = n >> 2;
+    uint32_t total = m * s;
+    uint32_t chunk = (total + nPE - 1) / nPE;
+    uint32_t start = MIN(coreId * chunk, total);
+    uint32_t end = MIN(start + chunk, total);
+    uint32_t d = s * m; // distance between the inputs of a butterfly
+    uint32_t maxSq = 0;
+    v2s wRe[4], wIm[4];
+    int32_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i;
+    int32_t b1r, b1i, b2r, b2i, b3r, b3i;
+    int32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+    int32_t y0r, y0i, y1r, y1i, y2r, y2i, y3r, y3i;
+    uint32_t sq0, sq1, sq2, sq3;
+
+    for (b = start; b < end; b = p * s + qEnd) {
+        p = b / s;
+        qEnd = MIN(end - p * s, s);
+
+        for (u = 1; u < 4; u++) {
+            int32_t wr = pTwiddle[2 * u * p * s];
+            int32_t wi = -dir * pTwiddle[2 * u * p * s + 1];
+            wRe[u] = __PACK2(wr, -wi);
+            wIm[u] = __PACK2(wi, wr);
+        }
+
+        const int16_t *x = &pIn[2 * s * p];
+        int16_t *y = &pOut[2 * s * 4 * p];
+
+        for (q = b - p * s; q < qEnd; q++) {
+            a0r = (x[2 * q] << up) >> down;
+            a0i = (x[2 * q + 1] << up) >> down;
+            a1r = (x[2 * (q + d)] << up) >> down;
+            a1i = (x[2 * (q + d) + 1] << up) >> down;
+            a2r = (x[2 * (q + 2 * d)] << up) >> down;
+            a2i = (x[2 * (q + 2 * d) + 1] << up) >> down;
+            a3r = (x[2 * (q + 3 * d)] << up) >> down;
+            a3i = (x[2 * (q + 3 * d) + 1] << up) >> down;
+            t0r = a0r + a2r;
+            t0i = a0i + a2i;
+            t1r = a0r - a2r;
+            t1i = a0i - a2i;
+            t2r = a1r + a3r;
+            t2i = a1i + a3i;
+            t3r = dir * (a1i - a3i);
+            t3i = -dir * (a1r - a3r);
+            y0r = t0r + t2r;
+            y0i = t0i + t2i;
+            b1r = t1r + t3r;
+            b1i = t1i + t3i;
+            b2r = t0r - t2r;
+            b2i = t0i - t2i;
+            b3r = t1r - t3r;
+            b3i = t1i - t3i;
+            y1r = __DOTP2(__PACK2(b1r, b1i), wRe[1]) >> 15;
+            y1i = __DOTP2(__PACK2(b1r, b1i), wIm[1]) >> 15;
+            y2r = __DOTP2(__PACK2(b2r, b2i), wRe[2]) >> 15;
+            y2i = __DOTP2(__PACK2(b2r, b2i), wIm[2]) >> 15;
+            y3r = __DOTP2(__PACK2(b3r, b3i), wRe[3]) >> 15;
+            y3i = __DOTP2(__PACK2(b3r, b3i), wIm[3]) >> 15;
+            v2s y0 = __PACK2(y0r, y0i);
+            v2s y1 = __PACK2(y1r, y1i);
+            v2s y2 = __PACK2(y2r, y2i);
+            v2s y3 = __PACK2(y3r, y3i);
+            *((v2s *)&y[2 * q]) = y0;
+            *((v2s *)&y[2 * (q + s)]) = y1;
+            *((v2s *)&y[2 * (q + 2 * s)]) = y2;
+            *((v2s *)&y[2 * (q + 3 * s)]) = y3;
+            sq0 = __DOTP2(y0, y0);
+            sq1 = __DOTP2(y1, y1);
+            sq2 = __DOTP2(y2, y2);
+            sq3 = __DOTP2(y3, y3);
+            sq0 = (sq0 > sq1) ? sq0 : sq1;
+            sq2 = (sq2 > sq3) ? sq2 : sq3;
+            sq0 = (sq0 > sq2) ? sq0 : sq2;
+            maxSq = (sq0 > maxSq) ? sq0 : maxSq;
+        }
+    }
+
+    return maxSq;
+}
+
+/*
+ * Last radix-2 stage with n = 2, where all twiddle factors are 1: pOut[q] and pOut[q + s] are the
+ * sum and difference of pIn[q] and pIn[q + s], shifted by shift, for q < s = fftLen / 2.
+ */
+static void process_last_radix2_bfp_q16(const int16_t *pIn,
+                                        int16_t *pOut,
+                                        uint32_t s,
+                                        int32_t shift,
+                                        uint32_t coreId,
+                                        uint32_t nPE) {
+
+    uint32_t q;
+    uint32_t up = (shift < 0) ? -shift : 0;
+    uint32_t down = (shift > 0) ? shift : 0;
+    uint32_t chunk = (s + nPE - 1) / nPE;
+    uint32_t start = MIN(coreId * chunk, s);
+    uint32_t end = MIN(start + chunk, s);
+    v2s a0, a1;
+
+    for (q = start; q < end; q++) {
+        a0 = __PACK2((pIn[2 * q] << up) >> down, (pIn[2 * q + 1] << up) >> down);
+        a1 = __PACK2((pIn[2 * (q + s)] << up) >> down, (pIn[2 * (q + s) + 1] << up) >> down);
+        *((v2s *)&pOut[2 * q]) = __ADD2(a0, a1);
+        *((v2s *)&pOut[2 * (q + s)]) = __SUB2(a0, a1);
+    }
+}
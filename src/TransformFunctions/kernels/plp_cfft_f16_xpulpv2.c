@@ -0,0 +1,250 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_f16_xpulpv2.c
+ * Description:  Half-precision floating-point FFT on complex input data for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+
+#ifdef PLP_MATH_SMALLFLOAT
+
+// a complex value in one register, real part in the lower half
+typedef v2f16 cmplx_f16;
+
+static inline cmplx_f16 cmplx_load(const float16_t *p) {
+    return *(const v2f16 *)p;
+}
+
+static inline void cmplx_store(float16_t *p, cmplx_f16 x) {
+    *(v2f16 *)p = x;
+}
+
+static inline cmplx_f16 cmplx_add(cmplx_f16 a, cmplx_f16 b) {
+    return a + b; // vfadd.h
+}
+
+static inline cmplx_f16 cmplx_sub(cmplx_f16 a, cmplx_f16 b) {
+    return a - b; // vfsub.h
+}
+
+static inline cmplx_f16 cmplx_mul(cmplx_f16 a, cmplx_f16 b) {
+    cmplx_f16 bRot = { -b[1], b[0] };
+    return (v2f16){ a[0], a[0] } * b + (v2f16){ a[1], a[1] } * bRot; // vfmul.h, vfmac.h
+}
+
+// multiplies with -j for the forward and +j for the inverse transform
+static inline cmplx_f16 cmplx_rot(cmplx_f16 a, float16_t conj) {
+    return (v2f16){ a[1], -a[0] } * (v2f16){ conj, conj };
+}
+
+static inline cmplx_f16 cmplx_scale(cmplx_f16 a, float16_t scale, float16_t conj) {
+    return a * (v2f16){ scale, scale * conj };
+}
+
+#else // PLP_MATH_SMALLFLOAT
+
+typedef Complex_type_f32 cmplx_f16;
+
+static inline cmplx_f16 cmplx_load(const float16_t *p) {
+    cmplx_f16 x = { plp_f16_to_f32(p[0]), plp_f16_to_f32(p[1]) };
+    return x;
+}
+
+static inline void cmplx_store(float16_t *p, cmplx_f16 x) {
+    p[0] = plp_f32_to_f16(x.re);
+    p[1] = plp_f32_to_f16(x.im);
+}
+
+static inline cmplx_f16 cmplx_add(cmplx_f16 a, cmplx_f16 b) {
+    cmplx_f16 r = { a.re + b.re, a.im + b.im };
+    return r;
+}
+
+static inline cmplx_f16 cmplx_sub(cmplx_f16 a, cmplx_f16 b) {
+    cmplx_f16 r = { a.re - b.re, a.im - b.im };
+    return r;
+}
+
+static inline cmplx_f16 cmplx_mul(cmplx_f16 a, cmplx_f16 b) {
+    cmplx_f16 r = { a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re };
+    return r;
+}
+
+// multiplies with -j for the forward and +j for the inverse transform
+static inline cmplx_f16 cmplx_rot(cmplx_f16 a, float32_t conj) {
+    cmplx_f16 r = { a.im * conj, -a.re * conj };
+    return r;
+}
+
+static inline cmplx_f16 cmplx_scale(cmplx_f16 a, float32_t scale, float32_t conj) {
+    cmplx_f16 r = { a.re * scale, a.im * scale * conj };
+    return r;
+}
+
+#endif // PLP_MATH_SMALLFLOAT
+
+static inline cmplx_f16 twiddle_radix4(const float16_t *twiddle_ptr, int index, int half, int conj);
+static inline void process_butterfly_radix4(float16_t *input,
+                                            int twiddle_index,
+                                            int distance,
+                                            const float16_t *twiddle_ptr,
+                                            int half,
+                                            int conj);
+static inline void process_butterfly_last_radix2(float16_t *input);
+
+/**
+   @ingroup fft
+ */
+
+/**
+   @addtogroup fftKernels
+   @{
+*/
+
+/**
+   @brief  Half-precision floating-point FFT on complex input data for XPULPV2 extension with the
+           smallFloat extensions.
+   @param[in]      S         points to an instance of the half-precision FFT structure
+   @param[in,out]  p1        points to the complex data buffer of size <code>2*FFTLength</code>.
+                             Processing occurs in-place.
+   @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+                             transform.
+   @return         none
+
+   @par Radix-4 Stages
+   As in plp_cfft_f32_radix4_xpulpv2, two consecutive radix-2 decimation-in-frequency stages are
+   merged into one radix-4 stage, followed by a radix-2 stage if log2(FFTLength) is odd.
+*/
+void plp_cfft_f16s_xpulpv2(const plp_cfft_instance_f16 *S,
+                           float16_t *__restrict__ p1,
+                           uint8_t ifftFlag) {
+
+    int t, k;
+
+    int N = S->FFTLength;
+    int half = N >> 1; // W^(k + half) = -W^k
+    int conj = ifftFlag ? -1 : 1;
+    const float16_t *pTwiddle = S->pTwiddleFactors;
+
+    int log2dist = (int)log2(N) - 2;
+    int dist = (log2dist >= 0) ? (1 << log2dist) : 0;
+    int step = 1;
+
+    // RADIX-4 STAGES
+    while (log2dist >= 0) {
+        for (t = 0; t < (N >> 2); t++) {
+            int i = t & (dist - 1);
+            int base = ((t >> log2dist) << (log2dist + 2)) + i;
+            process_butterfly_radix4(&p1[2 * base], i * step, dist, pTwiddle, half, conj);
+        }
+        log2dist -= 2;
+        dist >>= 2;
+        step <<= 2;
+    }
+
+    // LAST STAGE, only if log2(N) is odd
+    if (log2dist == -1) {
+        for (t = 0; t < (N >> 1); t++) {
+            process_butterfly_last_radix2(&p1[4 * t]);
+        }
+    }
+
+    // ORDER VALUES, every complex value is swapped as a whole 32-bit word
+    if (S->bitReverseFlag) {
+        uint32_t *pData = (uint32_t *)p1;
+        for (k = 0; k < N; k++) {
+            int j = S->pBitReverseLUT[k];
+            if (j > k) {
+                uint32_t tmp = pData[k];
+                pData[k] = pData[j];
+                pData[j] = tmp;
+            }
+        }
+    }
+
+    // SCALE THE INVERSE TRANSFORM
+    if (ifftFlag) {
+        for (k = 0; k < N; k++) {
+            cmplx_store(&p1[2 * k], cmplx_scale(cmplx_load(&p1[2 * k]), 1.0f / N, 1));
+        }
+    }
+}
+
+/**
+   @} end of fftKernels group
+*/
+
+static inline cmplx_f16 twiddle_radix4(const float16_t *twiddle_ptr, int index, int half, int conj) {
+
+    // the table only holds W^k for k < N/2, and W^(k + N/2) = -W^k, and the inverse transform uses
+    // the conjugate twiddle factors
+    if (index < half) {
+        return cmplx_scale(cmplx_load(&twiddle_ptr[2 * index]), 1, conj);
+    } else {
+        return cmplx_scale(cmplx_load(&twiddle_ptr[2 * (index - half)]), -1, conj);
+    }
+}
+
+static inline void process_butterfly_radix4(float16_t *input,
+                                            int twiddle_index,
+                                            int distance,
+                                            const float16_t *twiddle_ptr,
+                                            int half,
+                                            int conj) {
+
+    cmplx_f16 x0 = cmplx_load(&input[0]);
+    cmplx_f16 x1 = cmplx_load(&input[2 * distance]);
+    cmplx_f16 x2 = cmplx_load(&input[4 * distance]);
+    cmplx_f16 x3 = cmplx_load(&input[6 * distance]);
+
+    // first radix-2 stage (pairs x0, x2 and x1, x3), where W^(N/4) = -j (or +j for the inverse)
+    // is applied to x1 - x3
+    cmplx_f16 t0 = cmplx_add(x0, x2);
+    cmplx_f16 t1 = cmplx_add(x1, x3);
+    cmplx_f16 t2 = cmplx_sub(x0, x2);
+    cmplx_f16 t3 = cmplx_rot(cmplx_sub(x1, x3), conj);
+
+    cmplx_f16 tw1 = twiddle_radix4(twiddle_ptr, twiddle_index, half, conj);
+    cmplx_f16 tw2 = twiddle_radix4(twiddle_ptr, 2 * twiddle_index, half, conj);
+    cmplx_f16 tw3 = twiddle_radix4(twiddle_ptr, 3 * twiddle_index, half, conj);
+
+    // second radix-2 stage (pairs t0, t1 and t2, t3)
+    cmplx_store(&input[0], cmplx_add(t0, t1));
+    cmplx_store(&input[2 * distance], cmplx_mul(tw2, cmplx_sub(t0, t1)));
+    cmplx_store(&input[4 * distance], cmplx_mul(tw1, cmplx_add(t2, t3)));
+    cmplx_store(&input[6 * distance], cmplx_mul(tw3, cmplx_sub(t2, t3)));
+}
+
+static inline void process_butterfly_last_radix2(float16_t *input) {
+
+    cmplx_f16 x0 = cmplx_load(&input[0]);
+    cmplx_f16 x1 = cmplx_load(&input[2]);
+
+    /* In the Last step, twiddle factors are all 1 */
+    cmplx_store(&input[0], cmplx_add(x0, x1));
+    cmplx_store(&input[2], cmplx_sub(x0, x1));
+}
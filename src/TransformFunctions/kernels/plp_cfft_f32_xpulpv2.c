@@ -0,0 +1,272 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_f32_xpulpv2.c
+ * Description:  Floating-point complex FFT for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+
+static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B);
+static inline Complex_type_f32
+twiddle_radix4(const Complex_type_f32 *twiddle_ptr, int index, int half, float32_t conj);
+static inline void process_butterfly_radix4(Complex_type_f32 *input,
+                                            int twiddle_index,
+                                            int distance,
+                                            const Complex_type_f32 *twiddle_ptr,
+                                            int half,
+                                            float32_t conj);
+static inline void process_butterfly_last_radix2(Complex_type_f32 *input);
+static inline void process_cfft_f32(const plp_rfft_instance_f32 *S,
+                                    float32_t *p1,
+                                    uint8_t ifftFlag,
+                                    int core_id,
+                                    int nPE);
+
+/**
+   @ingroup fft
+ */
+
+/**
+   @addtogroup fftKernels
+   @{
+*/
+
+/**
+   @brief  Floating-point FFT on complex input data for XPULPV2 extension.
+   @param[in]      S         points to an instance of the floating-point FFT structure
+   @param[in,out]  p1        points to the complex data buffer of size <code>2*FFTLength</code>.
+                             Processing occurs in-place.
+   @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+                             transform.
+   @return         none
+*/
+PLP_HOT_CODE
+void plp_cfft_f32s_xpulpv2(const plp_rfft_instance_f32 *S,
+                           float32_t *__restrict__ p1,
+                           uint8_t ifftFlag) {
+
+    process_cfft_f32(S, p1, ifftFlag, 0, 1);
+}
+
+/**
+   @brief  Floating-point FFT on complex input data for XPULPV2 extension (parallel version).
+   @param[in]   args    points to the plp_cfft_instance_f32_parallel
+   @return      none
+*/
+PLP_HOT_CODE
+void plp_cfft_f32p_xpulpv2(void *args) {
+
+    plp_cfft_instance_f32_parallel *a = (plp_cfft_instance_f32_parallel *)args;
+
+    process_cfft_f32(a->S, a->p1, a->ifftFlag, rt_core_id(), a->nPE);
+}
+
+/**
+   @brief  Radix-4 stages of the in-place floating-point complex FFT for XPULPV2 extension.
+   @param[in,out]  pData          points to the complex data buffer of size <code>2*fftLen</code>
+   @param[in]      fftLen         length of the FFT, a power of two
+   @param[in]      pTwiddle       points to the twiddle factors W^k of length
+                                  <code>fftLen*twiddleStride/2</code>
+   @param[in]      twiddleStride  distance between the twiddle factors used by this FFT
+   @param[in]      ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+                                  transform. The inverse transform is not scaled.
+   @param[in]      coreId         index of the calling core, 0 for single core processing
+   @param[in]      nPE            number of cores executing this function together
+   @return         none
+
+   @par Radix-4 Stages
+   Two consecutive radix-2 decimation-in-frequency stages are merged into one radix-4
+   (radix-2^2) stage. If log2(fftLen) is odd, the last stage is a radix-2 stage. The output is in
+   bit reversed order. The butterflies of every stage are distributed in an interleaved way over
+   the nPE cores, which synchronize with a barrier after each stage.
+*/
+PLP_HOT_CODE
+void plp_cfft_f32_radix4_xpulpv2(Complex_type_f32 *__restrict__ pData,
+                                 uint32_t fftLen,
+                                 const Complex_type_f32 *__restrict__ pTwiddle,
+                                 uint32_t twiddleStride,
+                                 uint8_t ifftFlag,
+                                 uint32_t coreId,
+                                 uint32_t nPE) {
+
+    int t;
+
+    int N = fftLen;
+    int half = (N * twiddleStride) >> 1; // W^(k + half) = -W^k
+    float32_t conj = ifftFlag ? -1.0f : 1.0f;
+
+    // Every radix-4 butterfly t works on the elements base + {0, 1, 2, 3} * dist, where the groups
+    // of the current stage are 4 * dist elements long. The twiddle factors of the merged stages are
+    // W^(i * step), W^(2 * i * step) and W^(3 * i * step), with i the index inside the group.
+    int log2dist = (int)log2(N) - 2;
+    int dist = (log2dist >= 0) ? (1 << log2dist) : 0;
+    int step = twiddleStride;
+
+    // RADIX-4 STAGES
+    while (log2dist >= 0) {
+        for (t = coreId; t < (N >> 2); t += nPE) {
+            int i = t & (dist - 1);
+            int base = ((t >> log2dist) << (log2dist + 2)) + i;
+            process_butterfly_radix4(&pData[base], i * step, dist, pTwiddle, half, conj);
+        }
+        if (nPE > 1) {
+            rt_team_barrier();
+        }
+        log2dist -= 2;
+        dist >>= 2;
+        step <<= 2;
+    }
+
+    // LAST STAGE, only if log2(N) is odd
+    if (log2dist == -1) {
+        for (t = coreId; t < (N >> 1); t += nPE) {
+            process_butterfly_last_radix2(&pData[2 * t]);
+        }
+        if (nPE > 1) {
+            rt_team_barrier();
+        }
+    }
+}
+
+/**
+   @} end of fftKernels group
+*/
+
+static inline void process_cfft_f32(const plp_rfft_instance_f32 *S,
+                                    float32_t *p1,
+                                    uint8_t ifftFlag,
+                                    int core_id,
+                                    int nPE) {
+
+    int j;
+    int N = S->FFTLength;
+
+    plp_cfft_f32_radix4_xpulpv2((Complex_type_f32 *)p1, N,
+                                (const Complex_type_f32 *)S->pTwiddleFactors, 1, ifftFlag,
+                                core_id, nPE);
+
+    // ORDER VALUES
+    if (S->bitReverseFlag) {
+        plp_bitreversal_f32_xpulpv2((Complex_type_f32 *)p1, N, S->pBitReverseLUT, 0, core_id,
+                                    nPE);
+    }
+
+    // SCALE THE INVERSE TRANSFORM
+    if (ifftFlag) {
+        float32_t scale = 1.0f / N;
+        for (j = core_id; j < 2 * N; j += nPE) {
+            p1[j] = p1[j] * scale;
+        }
+    }
+}
+
+static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B) {
+
+    Complex_type_f32 result;
+    result.re = A.re * B.re - A.im * B.im;
+    result.im = A.re * B.im + A.im * B.re;
+    return result;
+}
+
+static inline Complex_type_f32
+twiddle_radix4(const Complex_type_f32 *twiddle_ptr, int index, int half, float32_t conj) {
+
+    // the table only holds W^k for k < N/2, and W^(k + N/2) = -W^k
+    Complex_type_f32 result;
+    if (index < half) {
+        result = twiddle_ptr[index];
+    } else {
+        result = twiddle_ptr[index - half];
+        result.re = -result.re;
+        result.im = -result.im;
+    }
+
+    // the inverse transform uses the conjugate twiddle factors
+    result.im = result.im * conj;
+    return result;
+}
+
+static inline void process_butterfly_radix4(Complex_type_f32 *input,
+                                            int twiddle_index,
+                                            int distance,
+                                            const Complex_type_f32 *twiddle_ptr,
+                                            int half,
+                                            float32_t conj) {
+
+    Complex_type_f32 x0 = input[0];
+    Complex_type_f32 x1 = input[distance];
+    Complex_type_f32 x2 = input[2 * distance];
+    Complex_type_f32 x3 = input[3 * distance];
+
+    Complex_type_f32 t0, t1, t2, t3, r;
+
+    // first radix-2 stage (pairs x0, x2 and x1, x3), where W^(N/4) = -j (or +j for the inverse)
+    // is applied to x1 - x3
+    t0.re = x0.re + x2.re;
+    t0.im = x0.im + x2.im;
+    t1.re = x1.re + x3.re;
+    t1.im = x1.im + x3.im;
+    t2.re = x0.re - x2.re;
+    t2.im = x0.im - x2.im;
+    t3.re = (x1.im - x3.im) * conj;
+    t3.im = (x3.re - x1.re) * conj;
+
+    Complex_type_f32 tw1 = twiddle_radix4(twiddle_ptr, twiddle_index, half, conj);
+    Complex_type_f32 tw2 = twiddle_radix4(twiddle_ptr, 2 * twiddle_index, half, conj);
+    Complex_type_f32 tw3 = twiddle_radix4(twiddle_ptr, 3 * twiddle_index, half, conj);
+
+    // second radix-2 stage (pairs t0, t1 and t2, t3)
+    r.re = t0.re + t1.re;
+    r.im = t0.im + t1.im;
+    input[0] = r;
+
+    r.re = t0.re - t1.re;
+    r.im = t0.im - t1.im;
+    input[distance] = complex_mul(tw2, r);
+
+    r.re = t2.re + t3.re;
+    r.im = t2.im + t3.im;
+    input[2 * distance] = complex_mul(tw1, r);
+
+    r.re = t2.re - t3.re;
+    r.im = t2.im - t3.im;
+    input[3 * distance] = complex_mul(tw3, r);
+}
+
+static inline void process_butterfly_last_radix2(Complex_type_f32 *input) {
+
+    Complex_type_f32 r0, r1;
+
+    /* In the Last step, twiddle factors are all 1 */
+    r0.re = input[0].re + input[1].re;
+    r0.im = input[0].im + input[1].im;
+    r1.re = input[0].re - input[1].re;
+    r1.im = input[0].im - input[1].im;
+
+    input[0] = r0;
+    input[1] = r1;
+}
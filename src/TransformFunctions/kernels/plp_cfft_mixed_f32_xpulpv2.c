@@ -0,0 +1,306 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mixed_f32_xpulpv2.c
+ * Description:  Floating-point mixed-radix FFT on complex input data for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+#define PLP_MIXED_SIN_60 0.86602540378443864676f
+#define PLP_MIXED_COS_72 0.30901699437494742410f
+#define PLP_MIXED_SIN_72 0.95105651629515357212f
+#define PLP_MIXED_COS_144 -0.80901699437494742410f
+#define PLP_MIXED_SIN_144 0.58778525229247312917f
+
+/* HELPER FUNCTIONS */
+
+static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B);
+static inline Complex_type_f32 complex_rot(Complex_type_f32 A, float32_t dir);
+static void process_stage_mixed_f32(const Complex_type_f32 *pIn,
+                                    Complex_type_f32 *pOut,
+                                    uint32_t n,
+                                    uint32_t s,
+                                    uint32_t radix,
+                                    const Complex_type_f32 *pTwiddle,
+                                    float32_t dir,
+                                    uint32_t coreId,
+                                    uint32_t nPE);
+static inline void process_cfft_mixed_f32(const plp_cfft_mixed_instance_f32 *S,
+                                          float32_t *p1,
+                                          float32_t *pScratch,
+                                          uint8_t ifftFlag,
+                                          uint32_t coreId,
+                                          uint32_t nPE);
+
+/**
+   @ingroup fft
+ */
+
+/**
+   @addtogroup fftKernels
+   @{
+*/
+
+/**
+   @brief  Floating-point mixed-radix FFT on complex input data for XPULPV2 extension.
+   @param[in]      S         points to an instance of the floating-point mixed-radix FFT structure
+   @param[in,out]  p1        points to the complex data buffer of size <code>2*fftLen</code>
+   @param[in]      pScratch  points to a scratch buffer of size <code>2*fftLen</code>
+   @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+                             transform.
+   @return         none
+*/
+void plp_cfft_mixed_f32s_xpulpv2(const plp_cfft_mixed_instance_f32 *S,
+                                 float32_t *__restrict__ p1,
+                                 float32_t *__restrict__ pScratch,
+                                 uint8_t ifftFlag) {
+
+    process_cfft_mixed_f32(S, p1, pScratch, ifftFlag, 0, 1);
+}
+
+/**
+   @brief  Floating-point mixed-radix FFT on complex input data for XPULPV2 extension (parallel
+           version).
+   @param[in]   args    points to the plp_cfft_mixed_instance_f32_parallel
+   @return      none
+*/
+void plp_cfft_mixed_f32p_xpulpv2(void *args) {
+
+    plp_cfft_mixed_instance_f32_parallel *a = (plp_cfft_mixed_instance_f32_parallel *)args;
+
+    process_cfft_mixed_f32(a->S, a->p1, a->pScratch, a->ifftFlag, rt_core_id(), a->nPE);
+}
+
+/**
+   @} end of fftKernels group
+*/
+
+static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B) {
+    Complex_type_f32 c;
+    c.re = A.re * B.re - A.im * B.im;
+    c.im = A.re * B.im + A.im * B.re;
+    return c;
+}
+
+// multiplication with -j (dir = 1, forward transform) or with j (dir = -1, inverse transform)
+static inline Complex_type_f32 complex_rot(Complex_type_f32 A, float32_t dir) {
+    Complex_type_f32 c;
+    c.re = dir * A.im;
+    c.im = -dir * A.re;
+    return c;
+}
+
+static inline void process_cfft_mixed_f32(const plp_cfft_mixed_instance_f32 *S,
+                                          float32_t *p1,
+                                          float32_t *pScratch,
+                                          uint8_t ifftFlag,
+                                          uint32_t coreId,
+                                          uint32_t nPE) {
+
+    uint32_t f, i, start, end, chunk;
+    uint32_t N = S->fftLen;
+    uint32_t n = N;
+    uint32_t s = 1;
+    float32_t dir = ifftFlag ? -1.0f : 1.0f;
+    Complex_type_f32 *pIn = (Complex_type_f32 *)p1;
+    Complex_type_f32 *pOut = (Complex_type_f32 *)pScratch;
+    Complex_type_f32 *pTmp;
+
+    // Stockham stages: every stage reads from one buffer and writes to the other one in natural
+    // order, such that no digit reversal is needed at the end.
+    for (f = 0; f < S->nFactors; f++) {
+        process_stage_mixed_f32(pIn, pOut, n, s, S->factors[f], S->pTwiddle, dir, coreId, nPE);
+        n /= S->factors[f];
+        s *= S->factors[f];
+        pTmp = pIn;
+        pIn = pOut;
+        pOut = pTmp;
+        if (nPE > 1) {
+            rt_team_barrier();
+        }
+    }
+
+    // copy the result back to p1 if the number of stages is odd, and scale the inverse transform
+    if (pIn != (Complex_type_f32 *)p1 || ifftFlag) {
+        float32_t scale = ifftFlag ? 1.0f / N : 1.0f;
+        chunk = (N + nPE - 1) / nPE;
+        start = MIN(coreId * chunk, N);
+        end = MIN(start + chunk, N);
+        for (i = start; i < end; i++) {
+            p1[2 * i] = pIn[i].re * scale;
+            p1[2 * i + 1] = pIn[i].im * scale;
+        }
+    }
+}
+
+/*
+ * One decimation-in-frequency Stockham stage of radix r on the sub-transforms of length n, with s
+ * sub-transforms interleaved with stride s. For p < n / r and q < s, the butterfly reads
+ * pIn[q + s * (p + i * n / r)] for i < r and writes the r-point DFT, multiplied by the twiddle
+ * factors W_n^(u * p) = W_N^(u * p * s), to pOut[q + s * (r * p + u)] for u < r. The n * s / r
+ * butterflies are split into contiguous chunks over the cores, such that the twiddle factors only
+ * change once every s butterflies.
+ */
+static void process_stage_mixed_f32(const Complex_type_f32 *pIn,
+                                    Complex_type_f32 *pOut,
+                                    uint32_t n,
+                                    uint32_t s,
+                                    uint32_t radix,
+                                    const Complex_type_f32 *pTwiddle,
+                                    float32_t dir,
+                                    uint32_t coreId,
+                                    uint32_t nPE) {
+
+    uint32_t b, p, q, qEnd, u, d;
+    uint32_t m = n / radix;
+    uint32_t total = m * s;
+    uint32_t chunk = (total + nPE - 1) / nPE;
+    uint32_t start = MIN(coreId * chunk, total);
+    uint32_t end = MIN(start + chunk, total);
+    Complex_type_f32 w[5];
+    Complex_type_f32 a0, a1, a2, a3, a4, b0, b1, b2, b3, b4, t0, t1, t2, t3;
+
+    d = s * m; // distance between the inputs of a butterfly
+
+    for (b = start; b < end; b = p * s + qEnd) {
+        p = b / s;
+        qEnd = MIN(end - p * s, s);
+
+        for (u = 1; u < radix; u++) {
+            w[u] = pTwiddle[u * p * s];
+            w[u].im *= dir;
+        }
+
+        const Complex_type_f32 *x = &pIn[s * p];
+        Complex_type_f32 *y = &pOut[s * radix * p];
+
+        switch (radix) {
+        case 2:
+            for (q = b - p * s; q < qEnd; q++) {
+                a0 = x[q];
+                a1 = x[q + d];
+                b1.re = a0.re - a1.re;
+                b1.im = a0.im - a1.im;
+                y[q].re = a0.re + a1.re;
+                y[q].im = a0.im + a1.im;
+                y[q + s] = complex_mul(b1, w[1]);
+            }
+            break;
+        case 3:
+            for (q = b - p * s; q < qEnd; q++) {
+                a0 = x[q];
+                a1 = x[q + d];
+                a2 = x[q + 2 * d];
+                t1.re = a1.re + a2.re;
+                t1.im = a1.im + a2.im;
+                t2.re = a0.re - 0.5f * t1.re;
+                t2.im = a0.im - 0.5f * t1.im;
+                t0.re = PLP_MIXED_SIN_60 * (a1.re - a2.re);
+                t0.im = PLP_MIXED_SIN_60 * (a1.im - a2.im);
+                t3 = complex_rot(t0, dir);
+                b1.re = t2.re + t3.re;
+                b1.im = t2.im + t3.im;
+                b2.re = t2.re - t3.re;
+                b2.im = t2.im - t3.im;
+                y[q].re = a0.re + t1.re;
+                y[q].im = a0.im + t1.im;
+                y[q + s] = complex_mul(b1, w[1]);
+                y[q + 2 * s] = complex_mul(b2, w[2]);
+            }
+            break;
+        case 4:
+            for (q = b - p * s; q < qEnd; q++) {
+                a0 = x[q];
+                a1 = x[q + d];
+                a2 = x[q + 2 * d];
+                a3 = x[q + 3 * d];
+                t0.re = a0.re + a2.re;
+                t0.im = a0.im + a2.im;
+                t1.re = a0.re - a2.re;
+                t1.im = a0.im - a2.im;
+                t2.re = a1.re + a3.re;
+                t2.im = a1.im + a3.im;
+                b3.re = a1.re - a3.re;
+                b3.im = a1.im - a3.im;
+                t3 = complex_rot(b3, dir);
+                b1.re = t1.re + t3.re;
+                b1.im = t1.im + t3.im;
+                b2.re = t0.re - t2.re;
+                b2.im = t0.im - t2.im;
+                b3.re = t1.re - t3.re;
+                b3.im = t1.im - t3.im;
+                y[q].re = t0.re + t2.re;
+                y[q].im = t0.im + t2.im;
+                y[q + s] = complex_mul(b1, w[1]);
+                y[q + 2 * s] = complex_mul(b2, w[2]);
+                y[q + 3 * s] = complex_mul(b3, w[3]);
+            }
+            break;
+        default: // radix 5
+            for (q = b - p * s; q < qEnd; q++) {
+                a0 = x[q];
+                a1 = x[q + d];
+                a2 = x[q + 2 * d];
+                a3 = x[q + 3 * d];
+                a4 = x[q + 4 * d];
+                t0.re = a1.re + a4.re; // sums and differences of the symmetric inputs
+                t0.im = a1.im + a4.im;
+                t1.re = a2.re + a3.re;
+                t1.im = a2.im + a3.im;
+                t2.re = a1.re - a4.re;
+                t2.im = a1.im - a4.im;
+                t3.re = a2.re - a3.re;
+                t3.im = a2.im - a3.im;
+                b0.re = a0.re + PLP_MIXED_COS_72 * t0.re + PLP_MIXED_COS_144 * t1.re;
+                b0.im = a0.im + PLP_MIXED_COS_72 * t0.im + PLP_MIXED_COS_144 * t1.im;
+                b2.re = a0.re + PLP_MIXED_COS_144 * t0.re + PLP_MIXED_COS_72 * t1.re;
+                b2.im = a0.im + PLP_MIXED_COS_144 * t0.im + PLP_MIXED_COS_72 * t1.im;
+                b1.re = PLP_MIXED_SIN_72 * t2.re + PLP_MIXED_SIN_144 * t3.re;
+                b1.im = PLP_MIXED_SIN_72 * t2.im + PLP_MIXED_SIN_144 * t3.im;
+                b3.re = PLP_MIXED_SIN_144 * t2.re - PLP_MIXED_SIN_72 * t3.re;
+                b3.im = PLP_MIXED_SIN_144 * t2.im - PLP_MIXED_SIN_72 * t3.im;
+                b1 = complex_rot(b1, dir);
+                b3 = complex_rot(b3, dir);
+                y[q].re = a0.re + t0.re + t1.re;
+                y[q].im = a0.im + t0.im + t1.im;
+                b4.re = b0.re - b1.re;
+                b4.im = b0.im - b1.im;
+                b1.re = b0.re + b1.re;
+                b1.im = b0.im + b1.im;
+                y[q + s] = complex_mul(b1, w[1]);
+                y[q + 4 * s] = complex_mul(b4, w[4]);
+                b4.re = b2.re - b3.re;
+                b4.im = b2.im - b3.im;
+                b2.re = b2.re + b3.re;
+                b2.im = b2.im + b3.im;
+                y[q + 2 * s] = complex_mul(b2, w[2]);
+                y[q + 3 * s] = complex_mul(b4, w[3]);
+            }
+            break;
+        }
+    }
+}
@@ -0,0 +1,314 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mixed_q16_xpulpv2.c
+ * Description:  16-bit fixed-point mixed-radix FFT on complex input data for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+// constants of the radix-3 and radix-5 butterflies in Q15
+#define PLP_MIXED_ONE_THIRD 10922
+#define PLP_MIXED_ONE_FIFTH 6553
+#define PLP_MIXED_SIN_60 28378
+#define PLP_MIXED_COS_72 10126
+#define PLP_MIXED_SIN_72 31164
+#define PLP_MIXED_COS_144 (-26510)
+#define PLP_MIXED_SIN_144 19261
+
+/* HELPER FUNCTIONS */
+
+static void process_stage_mixed_q16(const int16_t *pIn,
+                                    int16_t *pOut,
+                                    uint32_t n,
+                                    uint32_t s,
+                                    uint32_t radix,
+                                    const int16_t *pTwiddle,
+                                    int32_t dir,
+                                    uint32_t coreId,
+                                    uint32_t nPE);
+static inline void process_cfft_mixed_q16(const plp_cfft_mixed_instance_q16 *S,
+                                          int16_t *p1,
+                                          int16_t *pScratch,
+                                          uint8_t ifftFlag,
+                                          uint32_t coreId,
+                                          uint32_t nPE);
+
+/**
+   @ingroup fft
+ */
+
+/**
+   @addtogroup fftKernels
+   @{
+*/
+
+/**
+   @brief  16-bit fixed-point mixed-radix FFT on complex input data for XPULPV2 extension.
+   @param[in]      S         points to an instance of the 16-bit mixed-radix FFT structure
+   @param[in,out]  p1        points to the complex data buffer of size <code>2*fftLen</code>
+   @param[in]      pScratch  points to a scratch buffer of size <code>2*fftLen</code>
+   @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+                             transform.
+   @return         none
+*/
+void plp_cfft_mixed_q16s_xpulpv2(const plp_cfft_mixed_instance_q16 *S,
+                                 int16_t *__restrict__ p1,
+                                 int16_t *__restrict__ pScratch,
+                                 uint8_t ifftFlag) {
+
+    process_cfft_mixed_q16(S, p1, pScratch, ifftFlag, 0, 1);
+}
+
+/**
+   @brief  16-bit fixed-point mixed-radix FFT on complex input data for XPULPV2 extension
+           (parallel version).
+   @param[in]   args    points to the plp_cfft_mixed_instance_q16_parallel
+   @return      none
+*/
+void plp_cfft_mixed_q16p_xpulpv2(void *args) {
+
+    plp_cfft_mixed_instance_q16_parallel *a = (plp_cfft_mixed_instance_q16_parallel *)args;
+
+    process_cfft_mixed_q16(a->S, a->p1, a->pScratch, a->ifftFlag, rt_core_id(), a->nPE);
+}
+
+/**
+   @} end of fftKernels group
+*/
+
+static inline void process_cfft_mixed_q16(const plp_cfft_mixed_instance_q16 *S,
+                                          int16_t *p1,
+                                          int16_t *pScratch,
+                                          uint8_t ifftFlag,
+                                          uint32_t coreId,
+                                          uint32_t nPE) {
+
+    uint32_t f, i, start, end, chunk;
+    uint32_t N = S->fftLen;
+    uint32_t n = N;
+    uint32_t s = 1;
+    int32_t dir = ifftFlag ? -1 : 1;
+    int16_t *pIn = p1;
+    int16_t *pOut = pScratch;
+    int16_t *pTmp;
+
+    // Stockham stages: every stage reads from one buffer and writes to the other one in natural
+    // order, such that no digit reversal is needed at the end.
+    for (f = 0; f < S->nFactors; f++) {
+        process_stage_mixed_q16(pIn, pOut, n, s, S->factors[f], S->pTwiddle, dir, coreId, nPE);
+        n /= S->factors[f];
+        s *= S->factors[f];
+        pTmp = pIn;
+        pIn = pOut;
+        pOut = pTmp;
+        if (nPE > 1) {
+            rt_team_barrier();
+        }
+    }
+
+    // copy the result back to p1 if the number of stages is odd
+    if (pIn != p1) {
+        chunk = (N + nPE - 1) / nPE;
+        start = MIN(coreId * chunk, N);
+        end = MIN(start + chunk, N);
+        for (i = 2 * start; i < 2 * end; i++) {
+            p1[i] = pIn[i];
+        }
+    }
+}
+
+/*
+ * One decimation-in-frequency Stockham stage of radix r on the sub-transforms of length n, with s
+ * sub-transforms interleaved with stride s. For p < n / r and q < s, the butterfly reads
+ * pIn[q + s * (p + i * n / r)] for i < r, divides it by r and writes the r-point DFT, multiplied
+ * by the twiddle factors W_n^(u * p) = W_N^(u * p * s), to pOut[q + s * (r * p + u)] for u < r.
+ * The n * s / r butterflies are split into contiguous chunks over the cores, such that the twiddle
+ * factors only change once every s butterflies.
+ */
+static void process_stage_mixed_q16(const int16_t *pIn,
+                                    int16_t *pOut,
+                                    uint32_t n,
+                                    uint32_t s,
+                                    uint32_t radix,
+                                    const int16_t *pTwiddle,
+                                    int32_t dir,
+                                    uint32_t coreId,
+                                    uint32_t nPE) {
+
+    uint32_t b, p, q, qEnd, u, d;
+    uint32_t m = n / radix;
+    uint32_t total = m * s;
+    uint32_t chunk = (total + nPE - 1) / nPE;
+    uint32_t start = MIN(coreId * chunk, total);
+    uint32_t end = MIN(start + chunk, total);
+    v2s wRe[5], wIm[5];
+    int32_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i, a4r, a4i;
+    int32_t b0r, b0i, b1r, b1i, b2r, b2i, b3r, b3i, b4r, b4i;
+    int32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+    d = s * m; // distance between the inputs of a butterfly
+
+    for (b = start; b < end; b = p * s + qEnd) {
+        p = b / s;
+        qEnd = MIN(end - p * s, s);
+
+        for (u = 1; u < radix; u++) {
+            int32_t wr = pTwiddle[2 * u * p * s];
+            int32_t wi = dir * pTwiddle[2 * u * p * s + 1];
+            wRe[u] = __PACK2(wr, -wi);
+            wIm[u] = __PACK2(wi, wr);
+        }
+
+        const int16_t *x = &pIn[2 * s * p];
+        int16_t *y = &pOut[2 * s * radix * p];
+
+        switch (radix) {
+        case 2:
+            for (q = b - p * s; q < qEnd; q++) {
+                a0r = x[2 * q] >> 1;
+                a0i = x[2 * q + 1] >> 1;
+                a1r = x[2 * (q + d)] >> 1;
+                a1i = x[2 * (q + d) + 1] >> 1;
+                y[2 * q] = (int16_t)(a0r + a1r);
+                y[2 * q + 1] = (int16_t)(a0i + a1i);
+                b1r = a0r - a1r;
+                b1i = a0i - a1i;
+                y[2 * (q + s)] = (int16_t)(__DOTP2(__PACK2(b1r, b1i), wRe[1]) >> 15);
+                y[2 * (q + s) + 1] = (int16_t)(__DOTP2(__PACK2(b1r, b1i), wIm[1]) >> 15);
+            }
+            break;
+        case 3:
+            for (q = b - p * s; q < qEnd; q++) {
+                a0r = (x[2 * q] * PLP_MIXED_ONE_THIRD) >> 15;
+                a0i = (x[2 * q + 1] * PLP_MIXED_ONE_THIRD) >> 15;
+                a1r = (x[2 * (q + d)] * PLP_MIXED_ONE_THIRD) >> 15;
+                a1i = (x[2 * (q + d) + 1] * PLP_MIXED_ONE_THIRD) >> 15;
+                a2r = (x[2 * (q + 2 * d)] * PLP_MIXED_ONE_THIRD) >> 15;
+                a2i = (x[2 * (q + 2 * d) + 1] * PLP_MIXED_ONE_THIRD) >> 15;
+                t1r = a1r + a2r;
+                t1i = a1i + a2i;
+                t2r = a0r - (t1r >> 1);
+                t2i = a0i - (t1i >> 1);
+                t3r = dir * ((PLP_MIXED_SIN_60 * (a1i - a2i)) >> 15);
+                t3i = -dir * ((PLP_MIXED_SIN_60 * (a1r - a2r)) >> 15);
+                y[2 * q] = (int16_t)(a0r + t1r);
+                y[2 * q + 1] = (int16_t)(a0i + t1i);
+                b1r = t2r + t3r;
+                b1i = t2i + t3i;
+                b2r = t2r - t3r;
+                b2i = t2i - t3i;
+                y[2 * (q + s)] = (int16_t)(__DOTP2(__PACK2(b1r, b1i), wRe[1]) >> 15);
+                y[2 * (q + s) + 1] = (int16_t)(__DOTP2(__PACK2(b1r, b1i), wIm[1]) >> 15);
+                y[2 * (q + 2 * s)] = (int16_t)(__DOTP2(__PACK2(b2r, b2i), wRe[2]) >> 15);
+                y[2 * (q + 2 * s) + 1] = (int16_t)(__DOTP2(__PACK2(b2r, b2i), wIm[2]) >> 15);
+            }
+            break;
+        case 4:
+            for (q = b - p * s; q < qEnd; q++) {
+                a0r = x[2 * q] >> 2;
+                a0i = x[2 * q + 1] >> 2;
+                a1r = x[2 * (q + d)] >> 2;
+                a1i = x[2 * (q + d) + 1] >> 2;
+                a2r = x[2 * (q + 2 * d)] >> 2;
+                a2i = x[2 * (q + 2 * d) + 1] >> 2;
+                a3r = x[2 * (q + 3 * d)] >> 2;
+                a3i = x[2 * (q + 3 * d) + 1] >> 2;
+                t0r = a0r + a2r;
+                t0i = a0i + a2i;
+                t1r = a0r - a2r;
+                t1i = a0i - a2i;
+                t2r = a1r + a3r;
+                t2i = a1i + a3i;
+                t3r = dir * (a1i - a3i);
+                t3i = -dir * (a1r - a3r);
+                y[2 * q] = (int16_t)(t0r + t2r);
+                y[2 * q + 1] = (int16_t)(t0i + t2i);
+                b1r = t1r + t3r;
+                b1i = t1i + t3i;
+                b2r = t0r - t2r;
+                b2i = t0i - t2i;
+                b3r = t1r - t3r;
+                b3i = t1i - t3i;
+                y[2 * (q + s)] = (int16_t)(__DOTP2(__PACK2(b1r, b1i), wRe[1]) >> 15);
+                y[2 * (q + s) + 1] = (int16_t)(__DOTP2(__PACK2(b1r, b1i), wIm[1]) >> 15);
+                y[2 * (q + 2 * s)] = (int16_t)(__DOTP2(__PACK2(b2r, b2i), wRe[2]) >> 15);
+                y[2 * (q + 2 * s) + 1] = (int16_t)(__DOTP2(__PACK2(b2r, b2i), wIm[2]) >> 15);
+                y[2 * (q + 3 * s)] = (int16_t)(__DOTP2(__PACK2(b3r, b3i), wRe[3]) >> 15);
+                y[2 * (q + 3 * s) + 1] = (int16_t)(__DOTP2(__PACK2(b3r, b3i), wIm[3]) >> 15);
+            }
+            break;
+        default: // radix 5
+            for (q = b - p * s; q < qEnd; q++) {
+                a0r = (x[2 * q] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a0i = (x[2 * q + 1] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a1r = (x[2 * (q + d)] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a1i = (x[2 * (q + d) + 1] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a2r = (x[2 * (q + 2 * d)] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a2i = (x[2 * (q + 2 * d) + 1] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a3r = (x[2 * (q + 3 * d)] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a3i = (x[2 * (q + 3 * d) + 1] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a4r = (x[2 * (q + 4 * d)] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a4i = (x[2 * (q + 4 * d) + 1] * PLP_MIXED_ONE_FIFTH) >> 15;
+                t0r = a1r + a4r; // sums and differences of the symmetric inputs
+                t0i = a1i + a4i;
+                t1r = a2r + a3r;
+                t1i = a2i + a3i;
+                t2r = a1r - a4r;
+                t2i = a1i - a4i;
+                t3r = a2r - a3r;
+                t3i = a2i - a3i;
+                b0r = a0r + ((PLP_MIXED_COS_72 * t0r + PLP_MIXED_COS_144 * t1r) >> 15);
+                b0i = a0i + ((PLP_MIXED_COS_72 * t0i + PLP_MIXED_COS_144 * t1i) >> 15);
+                b2r = a0r + ((PLP_MIXED_COS_144 * t0r + PLP_MIXED_COS_72 * t1r) >> 15);
+                b2i = a0i + ((PLP_MIXED_COS_144 * t0i + PLP_MIXED_COS_72 * t1i) >> 15);
+                b1r = dir * ((PLP_MIXED_SIN_72 * t2i + PLP_MIXED_SIN_144 * t3i) >> 15);
+                b1i = -dir * ((PLP_MIXED_SIN_72 * t2r + PLP_MIXED_SIN_144 * t3r) >> 15);
+                b3r = dir * ((PLP_MIXED_SIN_144 * t2i - PLP_MIXED_SIN_72 * t3i) >> 15);
+                b3i = -dir * ((PLP_MIXED_SIN_144 * t2r - PLP_MIXED_SIN_72 * t3r) >> 15);
+                y[2 * q] = (int16_t)(a0r + t0r + t1r);
+                y[2 * q + 1] = (int16_t)(a0i + t0i + t1i);
+                b4r = b0r - b1r;
+                b4i = b0i - b1i;
+                b1r = b0r + b1r;
+                b1i = b0i + b1i;
+                y[2 * (q + s)] = (int16_t)(__DOTP2(__PACK2(b1r, b1i), wRe[1]) >> 15);
+                y[2 * (q + s) + 1] = (int16_t)(__DOTP2(__PACK2(b1r, b1i), wIm[1]) >> 15);
+                y[2 * (q + 4 * s)] = (int16_t)(__DOTP2(__PACK2(b4r, b4i), wRe[4]) >> 15);
+                y[2 * (q + 4 * s) + 1] = (int16_t)(__DOTP2(__PACK2(b4r, b4i), wIm[4]) >> 15);
+                b4r = b2r - b3r;
+                b4i = b2i - b3i;
+                b2r = b2r + b3r;
+                b2i = b2i + b3i;
+                y[2 * (q + 2 * s)] = (int16_t)(__DOTP2(__PACK2(b2r, b2i), wRe[2]) >> 15);
+                y[2 * (q + 2 * s) + 1] = (int16_t)(__DOTP2(__PACK2(b2r, b2i), wIm[2]) >> 15);
+                y[2 * (q + 3 * s)] = (int16_t)(__DOTP2(__PACK2(b4r, b4i), wRe[3]) >> 15);
+                y[2 * (q + 3 * s) + 1] = (int16_t)(__DOTP2(__PACK2(b4r, b4i), wIm[3]) >> 15);
+            }
+            break;
+        }
+    }
+}
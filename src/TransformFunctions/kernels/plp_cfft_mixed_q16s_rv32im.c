@@ -0,0 +1,274 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mixed_q16s_rv32im.c
+ * Description:  16-bit fixed-point mixed-radix FFT on complex input data for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+// constants of the radix-3 and radix-5 butterflies in Q15
+#define PLP_MIXED_ONE_THIRD 10922
+#define PLP_MIXED_ONE_FIFTH 6553
+#define PLP_MIXED_SIN_60 28378
+#define PLP_MIXED_COS_72 10126
+#define PLP_MIXED_SIN_72 31164
+#define PLP_MIXED_COS_144 (-26510)
+#define PLP_MIXED_SIN_144 19261
+
+/* HELPER FUNCTIONS */
+
+static void process_stage_mixed_q16(const int16_t *pIn,
+                                    int16_t *pOut,
+                                    uint32_t n,
+                                    uint32_t s,
+                                    uint32_t radix,
+                                    const int16_t *pTwiddle,
+                                    int32_t dir,
+                                    uint32_t coreId,
+                                    uint32_t nPE);
+
+/**
+   @ingroup fft
+ */
+
+/**
+   @addtogroup fftKernels
+   @{
+*/
+
+/**
+   @brief  16-bit fixed-point mixed-radix FFT on complex input data for RV32IM extension.
+   @param[in]      S         points to an instance of the 16-bit mixed-radix FFT structure
+   @param[in,out]  p1        points to the complex data buffer of size <code>2*fftLen</code>
+   @param[in]      pScratch  points to a scratch buffer of size <code>2*fftLen</code>
+   @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+                             transform.
+   @return         none
+*/
+void plp_cfft_mixed_q16s_rv32im(const plp_cfft_mixed_instance_q16 *S,
+                                int16_t *__restrict__ p1,
+                                int16_t *__restrict__ pScratch,
+                                uint8_t ifftFlag) {
+
+    uint32_t f, i;
+    uint32_t n = S->fftLen;
+    uint32_t s = 1;
+    int32_t dir = ifftFlag ? -1 : 1;
+    int16_t *pIn = p1;
+    int16_t *pOut = pScratch;
+    int16_t *pTmp;
+
+    for (f = 0; f < S->nFactors; f++) {
+        process_stage_mixed_q16(pIn, pOut, n, s, S->factors[f], S->pTwiddle, dir, 0, 1);
+        n /= S->factors[f];
+        s *= S->factors[f];
+        pTmp = pIn;
+        pIn = pOut;
+        pOut = pTmp;
+    }
+
+    // copy the result back to p1 if the number of stages is odd
+    if (pIn != p1) {
+        for (i = 0; i < 2 * S->fftLen; i++) {
+            p1[i] = pIn[i];
+        }
+    }
+}
+
+/**
+   @} end of fftKernels group
+*/
+
+/*
+ * One decimation-in-frequency Stockham stage of radix r on the sub-transforms of length n, with s
+ * sub-transforms interleaved with stride s. For p < n / r and q < s, the butterfly reads
+ * pIn[q + s * (p + i * n / r)] for i < r, divides it by r and writes the r-point DFT, multiplied
+ * by the twiddle factors W_n^(u * p) = W_N^(u * p * s), to pOut[q + s * (r * p + u)] for u < r.
+ * The n * s / r butterflies are split into contiguous chunks over the cores, such that the twiddle
+ * factors only change once every s butterflies.
+ */
+static void process_stage_mixed_q16(const int16_t *pIn,
+                                    int16_t *pOut,
+                                    uint32_t n,
+                                    uint32_t s,
+                                    uint32_t radix,
+                                    const int16_t *pTwiddle,
+                                    int32_t dir,
+                                    uint32_t coreId,
+                                    uint32_t nPE) {
+
+    uint32_t b, p, q, qEnd, u, d;
+    uint32_t m = n / radix;
+    uint32_t total = m * s;
+    uint32_t chunk = (total + nPE - 1) / nPE;
+    uint32_t start = MIN(coreId * chunk, total);
+    uint32_t end = MIN(start + chunk, total);
+    int32_t wr[5], wi[5];
+    int32_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i, a4r, a4i;
+    int32_t b0r, b0i, b1r, b1i, b2r, b2i, b3r, b3i, b4r, b4i;
+    int32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+    d = s * m; // distance between the inputs of a butterfly
+
+    for (b = start; b < end; b = p * s + qEnd) {
+        p = b / s;
+        qEnd = MIN(end - p * s, s);
+
+        for (u = 1; u < radix; u++) {
+            wr[u] = pTwiddle[2 * u * p * s];
+            wi[u] = dir * pTwiddle[2 * u * p * s + 1];
+        }
+
+        const int16_t *x = &pIn[2 * s * p];
+        int16_t *y = &pOut[2 * s * radix * p];
+
+        switch (radix) {
+        case 2:
+            for (q = b - p * s; q < qEnd; q++) {
+                a0r = x[2 * q] >> 1;
+                a0i = x[2 * q + 1] >> 1;
+                a1r = x[2 * (q + d)] >> 1;
+                a1i = x[2 * (q + d) + 1] >> 1;
+                y[2 * q] = (int16_t)(a0r + a1r);
+                y[2 * q + 1] = (int16_t)(a0i + a1i);
+                b1r = a0r - a1r;
+                b1i = a0i - a1i;
+                y[2 * (q + s)] = (int16_t)((b1r * wr[1] - b1i * wi[1]) >> 15);
+                y[2 * (q + s) + 1] = (int16_t)((b1r * wi[1] + b1i * wr[1]) >> 15);
+            }
+            break;
+        case 3:
+            for (q = b - p * s; q < qEnd; q++) {
+                a0r = (x[2 * q] * PLP_MIXED_ONE_THIRD) >> 15;
+                a0i = (x[2 * q + 1] * PLP_MIXED_ONE_THIRD) >> 15;
+                a1r = (x[2 * (q + d)] * PLP_MIXED_ONE_THIRD) >> 15;
+                a1i = (x[2 * (q + d) + 1] * PLP_MIXED_ONE_THIRD) >> 15;
+                a2r = (x[2 * (q + 2 * d)] * PLP_MIXED_ONE_THIRD) >> 15;
+                a2i = (x[2 * (q + 2 * d) + 1] * PLP_MIXED_ONE_THIRD) >> 15;
+                t1r = a1r + a2r;
+                t1i = a1i + a2i;
+                t2r = a0r - (t1r >> 1);
+                t2i = a0i - (t1i >> 1);
+                t3r = dir * ((PLP_MIXED_SIN_60 * (a1i - a2i)) >> 15);
+                t3i = -dir * ((PLP_MIXED_SIN_60 * (a1r - a2r)) >> 15);
+                y[2 * q] = (int16_t)(a0r + t1r);
+                y[2 * q + 1] = (int16_t)(a0i + t1i);
+                b1r = t2r + t3r;
+                b1i = t2i + t3i;
+                b2r = t2r - t3r;
+                b2i = t2i - t3i;
+                y[2 * (q + s)] = (int16_t)((b1r * wr[1] - b1i * wi[1]) >> 15);
+                y[2 * (q + s) + 1] = (int16_t)((b1r * wi[1] + b1i * wr[1]) >> 15);
+                y[2 * (q + 2 * s)] = (int16_t)((b2r * wr[2] - b2i * wi[2]) >> 15);
+                y[2 * (q + 2 * s) + 1] = (int16_t)((b2r * wi[2] + b2i * wr[2]) >> 15);
+            }
+            break;
+        case 4:
+            for (q = b - p * s; q < qEnd; q++) {
+                a0r = x[2 * q] >> 2;
+                a0i = x[2 * q + 1] >> 2;
+                a1r = x[2 * (q + d)] >> 2;
+                a1i = x[2 * (q + d) + 1] >> 2;
+                a2r = x[2 * (q + 2 * d)] >> 2;
+                a2i = x[2 * (q + 2 * d) + 1] >> 2;
+                a3r = x[2 * (q + 3 * d)] >> 2;
+                a3i = x[2 * (q + 3 * d) + 1] >> 2;
+                t0r = a0r + a2r;
+                t0i = a0i + a2i;
+                t1r = a0r - a2r;
+                t1i = a0i - a2i;
+                t2r = a1r + a3r;
+                t2i = a1i + a3i;
+                t3r = dir * (a1i - a3i);
+                t3i = -dir * (a1r - a3r);
+                y[2 * q] = (int16_t)(t0r + t2r);
+                y[2 * q + 1] = (int16_t)(t0i + t2i);
+                b1r = t1r + t3r;
+                b1i = t1i + t3i;
+                b2r = t0r - t2r;
+                b2i = t0i - t2i;
+                b3r = t1r - t3r;
+                b3i = t1i - t3i;
+                y[2 * (q + s)] = (int16_t)((b1r * wr[1] - b1i * wi[1]) >> 15);
+                y[2 * (q + s) + 1] = (int16_t)((b1r * wi[1] + b1i * wr[1]) >> 15);
+                y[2 * (q + 2 * s)] = (int16_t)((b2r * wr[2] - b2i * wi[2]) >> 15);
+                y[2 * (q + 2 * s) + 1] = (int16_t)((b2r * wi[2] + b2i * wr[2]) >> 15);
+                y[2 * (q + 3 * s)] = (int16_t)((b3r * wr[3] - b3i * wi[3]) >> 15);
+                y[2 * (q + 3 * s) + 1] = (int16_t)((b3r * wi[3] + b3i * wr[3]) >> 15);
+            }
+            break;
+        default: // radix 5
+            for (q = b - p * s; q < qEnd; q++) {
+                a0r = (x[2 * q] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a0i = (x[2 * q + 1] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a1r = (x[2 * (q + d)] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a1i = (x[2 * (q + d) + 1] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a2r = (x[2 * (q + 2 * d)] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a2i = (x[2 * (q + 2 * d) + 1] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a3r = (x[2 * (q + 3 * d)] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a3i = (x[2 * (q + 3 * d) + 1] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a4r = (x[2 * (q + 4 * d)] * PLP_MIXED_ONE_FIFTH) >> 15;
+                a4i = (x[2 * (q + 4 * d) + 1] * PLP_MIXED_ONE_FIFTH) >> 15;
+                t0r = a1r + a4r; // sums and differences of the symmetric inputs
+                t0i = a1i + a4i;
+                t1r = a2r + a3r;
+                t1i = a2i + a3i;
+                t2r = a1r - a4r;
+                t2i = a1i - a4i;
+                t3r = a2r - a3r;
+                t3i = a2i - a3i;
+                b0r = a0r + ((PLP_MIXED_COS_72 * t0r + PLP_MIXED_COS_144 * t1r) >> 15);
+                b0i = a0i + ((PLP_MIXED_COS_72 * t0i + PLP_MIXED_COS_144 * t1i) >> 15);
+                b2r = a0r + ((PLP_MIXED_COS_144 * t0r + PLP_MIXED_COS_72 * t1r) >> 15);
+                b2i = a0i + ((PLP_MIXED_COS_144 * t0i + PLP_MIXED_COS_72 * t1i) >> 15);
+                b1r = dir * ((PLP_MIXED_SIN_72 * t2i + PLP_MIXED_SIN_144 * t3i) >> 15);
+                b1i = -dir * ((PLP_MIXED_SIN_72 * t2r + PLP_MIXED_SIN_144 * t3r) >> 15);
+                b3r = dir * ((PLP_MIXED_SIN_144 * t2i - PLP_MIXED_SIN_72 * t3i) >> 15);
+                b3i = -dir * ((PLP_MIXED_SIN_144 * t2r - PLP_MIXED_SIN_72 * t3r) >> 15);
+                y[2 * q] = (int16_t)(a0r + t0r + t1r);
+                y[2 * q + 1] = (int16_t)(a0i + t0i + t1i);
+                b4r = b0r - b1r;
+                b4i = b0i - b1i;
+                b1r = b0r + b1r;
+                b1i = b0i + b1i;
+                y[2 * (q + s)] = (int16_t)((b1r * wr[1] - b1i * wi[1]) >> 15);
+                y[2 * (q + s) + 1] = (int16_t)((b1r * wi[1] + b1i * wr[1]) >> 15);
+                y[2 * (q + 4 * s)] = (int16_t)((b4r * wr[4] - b4i * wi[4]) >> 15);
+                y[2 * (q + 4 * s) + 1] = (int16_t)((b4r * wi[4] + b4i * wr[4]) >> 15);
+                b4r = b2r - b3r;
+                b4i = b2i - b3i;
+                b2r = b2r + b3r;
+                b2i = b2i + b3i;
+                y[2 * (q + 2 * s)] = (int16_t)((b2r * wr[2] - b2i * wi[2]) >> 15);
+                y[2 * (q + 2 * s) + 1] = (int16_t)((b2r * wi[2] + b2i * wr[2]) >> 15);
+                y[2 * (q + 3 * s)] = (int16_t)((b4r * wr[3] - b4i * wi[3]) >> 15);
+                y[2 * (q + 3 * s) + 1] = (int16_t)((b4r * wi[3] + b4i * wr[3]) >> 15);
+            }
+            break;
+        }
+    }
+}
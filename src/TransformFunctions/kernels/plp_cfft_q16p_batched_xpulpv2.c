@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q16p_batched_xpulpv2.c
+ * Description:  Batched parallel 16-bit fixed-point complex FFT for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Batch of parallel quantized 16 bit complex fast fourier transforms for XPULPV2
+ *
+ * @par Work Distribution
+ * As long as there are at least nPE channels left, every core computes whole transforms with
+ * plp_cfft_q16s_xpulpv2, which needs neither barriers nor communication between the cores. The
+ * remaining nChannels % nPE channels are computed one after the other by all cores together with
+ * plp_cfft_q16p_xpulpv2. Hence, a batch of fewer channels than cores is split inside each
+ * transform, and large batches scale with the number of cores.
+ *
+ * @param[in]   args    points to the plp_cfft_instance_q16_batched_parallel
+ */
+
+void plp_cfft_q16p_batched_xpulpv2(void *args) {
+    plp_cfft_instance_q16_batched_parallel *a = (plp_cfft_instance_q16_batched_parallel *)args;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t nPE = a->nPE;
+    uint32_t nWhole = a->nChannels - a->nChannels % nPE;
+    uint32_t c;
+
+    for (c = core_id; c < nWhole; c += nPE) {
+        plp_cfft_q16s_xpulpv2(a->S, a->pChannels[c], a->ifftFlag, a->bitReverseFlag,
+                              a->deciPoint);
+    }
+
+    for (c = nWhole; c < a->nChannels; c++) {
+        plp_cfft_instance_q16_parallel channelArgs = { .S = (plp_cfft_instance_q16 *)a->S,
+                                                       .p1 = a->pChannels[c],
+                                                       .ifftFlag = a->ifftFlag,
+                                                       .bitReverseFlag = a->bitReverseFlag,
+                                                       .deciPoint = a->deciPoint,
+                                                       .nPE = nPE };
+
+        plp_cfft_q16p_xpulpv2((void *)&channelArgs);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
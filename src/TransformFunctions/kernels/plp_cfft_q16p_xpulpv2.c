@@ -42,41 +42,51 @@
  * @{
  */
 
-static void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef, uint32_t nPE);
+static void plp_cfft_radix4by2_q16(int16_t *pSrc,
+                                   uint32_t fftLen,
+                                   const int16_t *pCoef,
+                                   uint8_t ifftFlag,
+                                   uint32_t nPE);
 
 static void plp_radix4_butterfly_q16(int16_t *pSrc16,
                                      uint32_t fftLen,
                                      int16_t *pCoef16,
                                      uint32_t twidCoefModifier,
+                                     uint8_t ifftFlag,
                                      uint32_t nPE);
 
+// Swaps the real and imaginary part of x if swap is set. Like in plp_cfft_q16s_xpulpv2, the
+// inverse transform swaps the input in the first stage and the output in the last stage.
+static inline v2s plp_cfft_swap_q16(v2s x, uint8_t swap) {
+    return swap ? __PACK2(x[1], x[0]) : x;
+}
+
 /**
  * @brief      Parallel quantized 16 bit complex fast fourier transform for XPULPV2
  * @param[in]   args    points to the plp_cfft_instance_q16_parallel
  */
 
+PLP_HOT_CODE
 void plp_cfft_q16p_xpulpv2(void *args){
 	int core_id = rt_core_id();
 	plp_cfft_instance_q16_parallel *a = (plp_cfft_instance_q16_parallel *) args;
 
 	uint32_t L = a->S->fftLen;
 
-    if (a->ifftFlag == 0) {
-        switch (L) {
-        case 16:
-        case 64:
-        case 256:
-        case 1024:
-        case 4096:
-            plp_radix4_butterfly_q16(a->p1, L, (int16_t *)a->S->pTwiddle, 1, a->nPE);
-            break;
-        case 32:
-        case 128:
-        case 512:
-        case 2048:
-            plp_cfft_radix4by2_q16(a->p1, L, (int16_t *)a->S->pTwiddle, a->nPE);
-            break;
-        }
+    switch (L) {
+    case 16:
+    case 64:
+    case 256:
+    case 1024:
+    case 4096:
+        plp_radix4_butterfly_q16(a->p1, L, (int16_t *)a->S->pTwiddle, 1, a->ifftFlag, a->nPE);
+        break;
+    case 32:
+    case 128:
+    case 512:
+    case 2048:
+        plp_cfft_radix4by2_q16(a->p1, L, (int16_t *)a->S->pTwiddle, a->ifftFlag, a->nPE);
+        break;
     }
     rt_team_barrier();
     // if (core_id == 0) {
@@ -86,7 +96,12 @@ void plp_cfft_q16p_xpulpv2(void *args){
 	// }
 }
 
-void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef, uint32_t nPE) {
+PLP_HOT_CODE
+void plp_cfft_radix4by2_q16(int16_t *pSrc,
+                            uint32_t fftLen,
+                            const int16_t *pCoef,
+                            uint8_t ifftFlag,
+                            uint32_t nPE) {
 
 	int core_id = rt_core_id();
 
@@ -114,8 +129,8 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
 
         l = i + n2;
 
-        a = __SRA2(*(v2s *)&pSrc[2 * i], ((v2s){ 1, 1 }));
-        b = __SRA2(*(v2s *)&pSrc[2 * l], ((v2s){ 1, 1 }));
+        a = __SRA2(plp_cfft_swap_q16(*(v2s *)&pSrc[2 * i], ifftFlag), ((v2s){ 1, 1 }));
+        b = __SRA2(plp_cfft_swap_q16(*(v2s *)&pSrc[2 * l], ifftFlag), ((v2s){ 1, 1 }));
         t = __SUB2(a, b);
         *((v2s *)&pSrc[i * 2]) = __SRA2(__ADD2(a, b), ((v2s){ 1, 1 }));
 
@@ -141,16 +156,16 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
     if (nPE > 1){
     	if (core_id < nPE/2){
     		// first col
-    		plp_radix4_butterfly_q16(pSrc, n2, (int16_t *)pCoef, 2U, nPE/2);
+    		plp_radix4_butterfly_q16(pSrc, n2, (int16_t *)pCoef, 2U, 0, nPE/2);
     	} else {
     		// second col
-    		plp_radix4_butterfly_q16(pSrc + fftLen, n2, (int16_t *)pCoef, 2U, nPE - nPE/2);
+    		plp_radix4_butterfly_q16(pSrc + fftLen, n2, (int16_t *)pCoef, 2U, 0, nPE - nPE/2);
     	}
     } else {
 	    // first col
-	    plp_radix4_butterfly_q16(pSrc, n2, (int16_t *)pCoef, 2U, nPE);
+	    plp_radix4_butterfly_q16(pSrc, n2, (int16_t *)pCoef, 2U, 0, nPE);
 	    // second col
-	    plp_radix4_butterfly_q16(pSrc + fftLen, n2, (int16_t *)pCoef, 2U, nPE);
+	    plp_radix4_butterfly_q16(pSrc + fftLen, n2, (int16_t *)pCoef, 2U, 0, nPE);
 	}
 
 	rt_team_barrier();
@@ -162,8 +177,8 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
         pa = __SLL2(pa, ((v2s){ 1, 1 }));
         pb = __SLL2(pb, ((v2s){ 1, 1 }));
 
-        *((v2s *)&pSrc[4 * i]) = pa;
-        *((v2s *)&pSrc[4 * i + 2]) = pb;
+        *((v2s *)&pSrc[4 * i]) = plp_cfft_swap_q16(pa, ifftFlag);
+        *((v2s *)&pSrc[4 * i + 2]) = plp_cfft_swap_q16(pb, ifftFlag);
     }
 }
 
@@ -211,10 +226,12 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
  * @return none.
  */
 
+PLP_HOT_CODE
 void plp_radix4_butterfly_q16(int16_t *pSrc16,
                               uint32_t fftLen,
                               int16_t *pCoef16,
                               uint32_t twidCoefModifier,
+                              uint8_t ifftFlag,
                               uint32_t nPE) {
 	int core_id = rt_core_id()%nPE;
     v2s R, S, T, U, V;
@@ -267,11 +284,11 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
 
         /* input is down scale by 4 to avoid overflow */
         /* Read ya (real), xa (imag) input */
-        T = __SRA2(*(v2s *)&pSrc16[i0 * 2U], ((v2s){ 2, 2 }));
+        T = __SRA2(plp_cfft_swap_q16(*(v2s *)&pSrc16[i0 * 2U], ifftFlag), ((v2s){ 2, 2 }));
 
         /* input is down scale by 4 to avoid overflow */
         /* Read yc (real), xc(imag) input */
-        S = __SRA2(*(v2s *)&pSrc16[i2 * 2U], ((v2s){ 2, 2 }));
+        S = __SRA2(plp_cfft_swap_q16(*(v2s *)&pSrc16[i2 * 2U], ifftFlag), ((v2s){ 2, 2 }));
 
         /* R0 = (ya + yc) */
         /* R1 = (xa + xc) */
@@ -284,11 +301,11 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
         /* input is down scale by 4 to avoid overflow */
         /* Read yb (real), xb(imag) input */
-        T = __SRA2(*(v2s *)&pSrc16[i1 * 2U], ((v2s){ 2, 2 }));
+        T = __SRA2(plp_cfft_swap_q16(*(v2s *)&pSrc16[i1 * 2U], ifftFlag), ((v2s){ 2, 2 }));
 
         /* input is down scale by 4 to avoid overflow */
         /* Read yd (real), xd(imag) input */
-        U = __SRA2(*(v2s *)&pSrc16[i3 * 2U], ((v2s){ 2, 2 }));
+        U = __SRA2(plp_cfft_swap_q16(*(v2s *)&pSrc16[i3 * 2U], ifftFlag), ((v2s){ 2, 2 }));
 
         /* T0 = (yb + yd) */
         /* T1 = (xb + xd) */
@@ -322,7 +339,7 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  Butterfly calculations */
         /* input is down scale by 4 to avoid overflow */
         /* U0 = yd, U1 = xd */
-        U = __SRA2(*(v2s *)&pSrc16[i3 * 2U], ((v2s){ 2, 2 }));
+        U = __SRA2(plp_cfft_swap_q16(*(v2s *)&pSrc16[i3 * 2U], ifftFlag), ((v2s){ 2, 2 }));
 
         /* T0 = yb-yd */
         /* T1 = xb-xd */
@@ -540,7 +557,8 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  writing the butterfly processed i0 sample */
         /* xa' = xa + xb + xc + xd */
         /* ya' = ya + yb + yc + yd */
-        *((v2s *)&pSrc16[i0 * 2U]) = __ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(T, ((v2s){ 1, 1 })));
+        *((v2s *)&pSrc16[i0 * 2U]) = plp_cfft_swap_q16(
+            __ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(T, ((v2s){ 1, 1 }))), ifftFlag);
 
         /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc) - (xb + xd) */
         R = __SUB2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(T, ((v2s){ 1, 1 })));
@@ -551,7 +569,7 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  writing the butterfly processed i0 + fftLen/4 sample */
         /* xc' = (xa-xb+xc-xd) */
         /* yc' = (ya-yb+yc-yd) */
-        *((v2s *)&pSrc16[i1 * 2U]) = R;
+        *((v2s *)&pSrc16[i1 * 2U]) = plp_cfft_swap_q16(R, ifftFlag);
 
         /* Read yd (real), xd(imag) input */
         U = *(v2s *)&pSrc16[i3 * 2U];
@@ -565,12 +583,12 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  writing the butterfly processed i0 + fftLen/2 sample */
         /* xb' = (xa+yb-xc-yd) */
         /* yb' = (ya-xb-yc+xd) */
-        *((v2s *)&pSrc16[i2 * 2U]) = __ADD2(S, __PACK2(T[1], -T[0]));
+        *((v2s *)&pSrc16[i2 * 2U]) = plp_cfft_swap_q16(__ADD2(S, __PACK2(T[1], -T[0])), ifftFlag);
 
         /*  writing the butterfly processed i0 + 3fftLen/4 sample */
         /* xd' = (xa-yb-xc+yd) */
         /* yd' = (ya+xb-yc-xd) */
-        *((v2s *)&pSrc16[i3 * 2U]) = __ADD2(S, __PACK2(-T[1], T[0]));
+        *((v2s *)&pSrc16[i3 * 2U]) = plp_cfft_swap_q16(__ADD2(S, __PACK2(-T[1], T[0])), ifftFlag);
     }
 
     /* end of last stage process */
@@ -39,12 +39,78 @@
  * @{
  */
 
-static void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef);
+static void plp_cfft_radix4by2_q16(int16_t *pSrc,
+                                   uint32_t fftLen,
+                                   const int16_t *pCoef,
+                                   const int16_t *pWindow,
+                                   const int8_t *pSrc8,
+                                   uint8_t ifftFlag);
 
 static void plp_radix4_butterfly_q16(int16_t *pSrc16,
                                      uint32_t fftLen,
                                      int16_t *pCoef16,
-                                     uint32_t twidCoefModifier);
+                                     uint32_t twidCoefModifier,
+                                     const int16_t *pWindow,
+                                     const int8_t *pSrc8,
+                                     uint8_t ifftFlag);
+
+// Returns the offset of the real (part=0) or imaginary (part=1) part of a sample in the buffer.
+// The inverse transform swaps the real and imaginary part of the input when it is read by the
+// first stage, and of the output when it is written by the last stage. This is the same as
+// computing the butterflies with conjugated twiddle factors, and the scaling by 1/fftLen of the
+// forward transform is exactly the one of the inverse transform.
+static inline uint32_t plp_cfft_part_q16(uint32_t part, uint8_t ifftFlag) {
+    return (ifftFlag != 0) ? (part ^ 1U) : part;
+}
+
+// Reads the real (part=0) or imaginary (part=1) part of sample i, scaled down by 2^shift. If
+// pWindow is set, the sample is multiplied with the window, whose first half is stored in pWindow.
+// If pSrc8 is set, the sample is read from the 8-bit input pSrc8 instead, and widened to 16 bits.
+static inline int16_t plp_cfft_window_load_q16(const int16_t *pSrc,
+                                               const int8_t *pSrc8,
+                                               uint32_t i,
+                                               uint32_t part,
+                                               const int16_t *pWindow,
+                                               uint32_t fftLen,
+                                               uint32_t shift,
+                                               uint8_t ifftFlag) {
+    part = plp_cfft_part_q16(part, ifftFlag);
+    int16_t x = (pSrc8 == NULL) ? pSrc[2 * i + part] : (int16_t)(pSrc8[2 * i + part] * 256);
+    if (pWindow == NULL) {
+        return x >> shift;
+    }
+    int32_t w = pWindow[(i <= (fftLen >> 1)) ? i : fftLen - i];
+    return (int16_t)(((int32_t)x * w) >> (15 + shift));
+}
+
+static void plp_cfft_process_q16(const plp_cfft_instance_q16 *S,
+                                 int16_t *p1,
+                                 const int16_t *pWindow,
+                                 const int8_t *pSrc8,
+                                 uint8_t ifftFlag,
+                                 uint8_t bitReverseFlag) {
+
+    uint32_t L = S->fftLen;
+
+    switch (L) {
+    case 16:
+    case 64:
+    case 256:
+    case 1024:
+    case 4096:
+        plp_radix4_butterfly_q16(p1, L, (int16_t *)S->pTwiddle, 1, pWindow, pSrc8, ifftFlag);
+        break;
+    case 32:
+    case 128:
+    case 512:
+    case 2048:
+        plp_cfft_radix4by2_q16(p1, L, (int16_t *)S->pTwiddle, pWindow, pSrc8, ifftFlag);
+        break;
+    }
+
+    if (bitReverseFlag)
+        plp_bitreversal_16s_rv32im((uint16_t *)p1, S->bitRevLength, S->pBitRevTable);
+}
 
 void plp_cfft_q16s_rv32im(const plp_cfft_instance_q16 *S,
                           int16_t *p1,
@@ -52,37 +118,80 @@ void plp_cfft_q16s_rv32im(const plp_cfft_instance_q16 *S,
                           uint8_t bitReverseFlag,
                           uint32_t deciPoint) {
 
-    uint32_t L = S->fftLen;
+    plp_cfft_process_q16(S, p1, NULL, NULL, ifftFlag, bitReverseFlag);
+}
+
+/**
+ * @brief      Windowed quantized 16 bit complex fast fourier transform for RV32IM
+ *
+ * The input samples are multiplied with the window when they are read by the first stage.
+ *
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in]  pWindow         points to the first half of the window in Q1.15,
+ *                             PLP_WINDOW_LEN(fftLen) values
+ * @param[in,out] p1           points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
 
-    if (ifftFlag == 0) {
-        switch (L) {
-        case 16:
-        case 64:
-        case 256:
-        case 1024:
-        case 4096:
-            plp_radix4_butterfly_q16(p1, L, (int16_t *)S->pTwiddle, 1);
-            break;
-        case 32:
-        case 128:
-        case 512:
-        case 2048:
-            plp_cfft_radix4by2_q16(p1, L, (int16_t *)S->pTwiddle);
-            break;
+void plp_cfft_windowed_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                                   const int16_t *pWindow,
+                                   int16_t *p1,
+                                   uint8_t bitReverseFlag,
+                                   uint32_t deciPoint) {
+
+    plp_cfft_process_q16(S, p1, pWindow, NULL, 0, bitReverseFlag);
+}
+
+/**
+ * @brief      Quantized complex fast fourier transform of 8 bit input for RV32IM
+ *
+ * The 8-bit input samples are widened to 16 bits when they are read by the first stage.
+ *
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in]  pSrc            points to the complex 8-bit input of size <code>2*fftLen</code>
+ * @param[out] p1              points to the complex 16-bit output of size <code>2*fftLen</code>
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ * @param[out] pDst            points to the complex 8-bit output of size <code>2*fftLen</code>,
+ * or NULL
+ */
+
+void plp_cfft_q8s_rv32im(const plp_cfft_instance_q16 *S,
+                         const int8_t *pSrc,
+                         int16_t *p1,
+                         uint8_t bitReverseFlag,
+                         uint32_t deciPoint,
+                         int8_t *pDst) {
+
+    uint32_t i;
+
+    plp_cfft_process_q16(S, p1, NULL, pSrc, 0, bitReverseFlag);
+
+    if (pDst != NULL) {
+        for (i = 0; i < 2 * S->fftLen; i++) {
+            int32_t val = (p1[i] + 128) >> 8;
+            pDst[i] = (int8_t)((val > INT8_MAX) ? INT8_MAX : (val < INT8_MIN) ? INT8_MIN : val);
         }
     }
-
-    if (bitReverseFlag)
-        plp_bitreversal_16s_rv32im((uint16_t *)p1, S->bitRevLength, S->pBitRevTable);
 }
 
-void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef) {
+void plp_cfft_radix4by2_q16(int16_t *pSrc,
+                            uint32_t fftLen,
+                            const int16_t *pCoef,
+                            const int16_t *pWindow,
+                            const int8_t *pSrc8,
+                            uint8_t ifftFlag) {
 
     uint32_t i;
     uint32_t n2;
     int16_t p0, p1, p2, p3;
 
     uint32_t l;
+    int16_t xa, ya, xb, yb;
     int16_t xt, yt, cosVal, sinVal;
 
     n2 = fftLen >> 1;
@@ -93,11 +202,16 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
 
         l = i + n2;
 
-        xt = (pSrc[2 * i] >> 1U) - (pSrc[2 * l] >> 1U);
-        pSrc[2 * i] = ((pSrc[2 * i] >> 1U) + (pSrc[2 * l] >> 1U)) >> 1U;
+        xa = plp_cfft_window_load_q16(pSrc, pSrc8, i, 0, pWindow, fftLen, 1U, ifftFlag);
+        ya = plp_cfft_window_load_q16(pSrc, pSrc8, i, 1, pWindow, fftLen, 1U, ifftFlag);
+        xb = plp_cfft_window_load_q16(pSrc, pSrc8, l, 0, pWindow, fftLen, 1U, ifftFlag);
+        yb = plp_cfft_window_load_q16(pSrc, pSrc8, l, 1, pWindow, fftLen, 1U, ifftFlag);
 
-        yt = (pSrc[2 * i + 1] >> 1U) - (pSrc[2 * l + 1] >> 1U);
-        pSrc[2 * i + 1] = ((pSrc[2 * l + 1] >> 1U) + (pSrc[2 * i + 1] >> 1U)) >> 1U;
+        xt = xa - xb;
+        pSrc[2 * i] = (xa + xb) >> 1U;
+
+        yt = ya - yb;
+        pSrc[2 * i + 1] = (yb + ya) >> 1U;
 
         pSrc[2U * l] =
             (((int16_t)(((int32_t)xt * cosVal) >> 16)) + ((int16_t)(((int32_t)yt * sinVal) >> 16)));
@@ -107,9 +221,9 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
     }
 
     // first col
-    plp_radix4_butterfly_q16(pSrc, n2, (int16_t *)pCoef, 2U);
+    plp_radix4_butterfly_q16(pSrc, n2, (int16_t *)pCoef, 2U, NULL, NULL, 0);
     // second col
-    plp_radix4_butterfly_q16(pSrc + fftLen, n2, (int16_t *)pCoef, 2U);
+    plp_radix4_butterfly_q16(pSrc + fftLen, n2, (int16_t *)pCoef, 2U, NULL, NULL, 0);
 
     for (i = 0; i < (fftLen >> 1); i++) {
         p0 = pSrc[4 * i + 0];
@@ -122,10 +236,10 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
         p2 <<= 1;
         p3 <<= 1;
 
-        pSrc[4 * i + 0] = p0;
-        pSrc[4 * i + 1] = p1;
-        pSrc[4 * i + 2] = p2;
-        pSrc[4 * i + 3] = p3;
+        pSrc[4 * i + plp_cfft_part_q16(0, ifftFlag)] = p0;
+        pSrc[4 * i + plp_cfft_part_q16(1, ifftFlag)] = p1;
+        pSrc[4 * i + 2 + plp_cfft_part_q16(0, ifftFlag)] = p2;
+        pSrc[4 * i + 2 + plp_cfft_part_q16(1, ifftFlag)] = p3;
     }
 }
 
@@ -170,16 +284,25 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
  * @param[in]      *pCoef16         points to twiddle coefficient buffer.
  * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs
  * with the same twiddle factor table.
+ * @param[in]      *pWindow         points to the first half of the window applied to the input,
+ * or NULL.
+ * @param[in]      *pSrc8           points to the 8-bit input read by the first stage instead of
+ * pSrc16, or NULL.
+ * @param[in]      ifftFlag         swaps the real and imaginary part of the input and output for
+ * the inverse transform.
  * @return none.
  */
 
 void plp_radix4_butterfly_q16(int16_t *pSrc16,
                               uint32_t fftLen,
                               int16_t *pCoef16,
-                              uint32_t twidCoefModifier) {
+                              uint32_t twidCoefModifier,
+                              const int16_t *pWindow,
+                              const int8_t *pSrc8,
+                              uint8_t ifftFlag) {
     int16_t R0, R1, S0, S1, T0, T1, U0, U1;
     int16_t Co1, Si1, Co2, Si2, Co3, Si3, out1, out2;
-    uint32_t n1, n2, ic, i0, i1, i2, i3, j, k;
+    uint32_t n1, n2, ic, i0, i1, i2, i3, j, k, re, im;
 
     /* Total process is divided into three stages */
 
@@ -215,13 +338,13 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
 
         /* input is down scale by 4 to avoid overflow */
         /* Read ya (real), xa (imag) input */
-        T0 = pSrc16[i0 * 2U] >> 2U;
-        T1 = pSrc16[(i0 * 2U) + 1U] >> 2U;
+        T0 = plp_cfft_window_load_q16(pSrc16, pSrc8, i0, 0, pWindow, fftLen, 2U, ifftFlag);
+        T1 = plp_cfft_window_load_q16(pSrc16, pSrc8, i0, 1, pWindow, fftLen, 2U, ifftFlag);
 
         /* input is down scale by 4 to avoid overflow */
         /* Read yc (real), xc(imag) input */
-        S0 = pSrc16[i2 * 2U] >> 2U;
-        S1 = pSrc16[(i2 * 2U) + 1U] >> 2U;
+        S0 = plp_cfft_window_load_q16(pSrc16, pSrc8, i2, 0, pWindow, fftLen, 2U, ifftFlag);
+        S1 = plp_cfft_window_load_q16(pSrc16, pSrc8, i2, 1, pWindow, fftLen, 2U, ifftFlag);
 
         /* R0 = (ya + yc) */
         R0 = __CLIP(T0 + S0, 15);
@@ -236,13 +359,13 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
         /* input is down scale by 4 to avoid overflow */
         /* Read yb (real), xb(imag) input */
-        T0 = pSrc16[i1 * 2U] >> 2U;
-        T1 = pSrc16[(i1 * 2U) + 1U] >> 2U;
+        T0 = plp_cfft_window_load_q16(pSrc16, pSrc8, i1, 0, pWindow, fftLen, 2U, ifftFlag);
+        T1 = plp_cfft_window_load_q16(pSrc16, pSrc8, i1, 1, pWindow, fftLen, 2U, ifftFlag);
 
         /* input is down scale by 4 to avoid overflow */
         /* Read yd (real), xd(imag) input */
-        U0 = pSrc16[i3 * 2U] >> 2U;
-        U1 = pSrc16[(i3 * 2U) + 1] >> 2U;
+        U0 = plp_cfft_window_load_q16(pSrc16, pSrc8, i3, 0, pWindow, fftLen, 2U, ifftFlag);
+        U1 = plp_cfft_window_load_q16(pSrc16, pSrc8, i3, 1, pWindow, fftLen, 2U, ifftFlag);
 
         /* T0 = (yb + yd) */
         T0 = __CLIP(T0 + U0, 15);
@@ -272,8 +395,8 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  Reading i0+fftLen/4 */
         /* input is down scale by 4 to avoid overflow */
         /* T0 = yb, T1 =  xb */
-        T0 = pSrc16[i1 * 2U] >> 2;
-        T1 = pSrc16[(i1 * 2U) + 1] >> 2;
+        T0 = plp_cfft_window_load_q16(pSrc16, pSrc8, i1, 0, pWindow, fftLen, 2U, ifftFlag);
+        T1 = plp_cfft_window_load_q16(pSrc16, pSrc8, i1, 1, pWindow, fftLen, 2U, ifftFlag);
 
         /* writing the butterfly processed i0 + fftLen/4 sample */
         /* writing output(xc', yc') in little endian format */
@@ -281,10 +404,7 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         pSrc16[(i1 * 2U) + 1] = out2;
 
         /*  Butterfly calculations */
-        /* input is down scale by 4 to avoid overflow */
-        /* U0 = yd, U1 = xd */
-        U0 = pSrc16[i3 * 2U] >> 2;
-        U1 = pSrc16[(i3 * 2U) + 1] >> 2;
+        /* U0 = yd, U1 = xd are still in U0, U1 */
         /* T0 = yb-yd */
         T0 = __CLIP(T0 - U0, 15);
         /* T1 = xb-xd */
@@ -480,6 +600,10 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
     n1 = n2;
     n2 >>= 2U;
 
+    /* the inverse transform swaps the real and imaginary part of the output */
+    re = plp_cfft_part_q16(0, ifftFlag);
+    im = plp_cfft_part_q16(1, ifftFlag);
+
     /* start of last stage process */
 
     /*  Butterfly implementation */
@@ -522,8 +646,8 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  writing the butterfly processed i0 sample */
         /* xa' = xa + xb + xc + xd */
         /* ya' = ya + yb + yc + yd */
-        pSrc16[i0 * 2U] = (R0 >> 1U) + (T0 >> 1U);
-        pSrc16[(i0 * 2U) + 1U] = (R1 >> 1U) + (T1 >> 1U);
+        pSrc16[(i0 * 2U) + re] = (R0 >> 1U) + (T0 >> 1U);
+        pSrc16[(i0 * 2U) + im] = (R1 >> 1U) + (T1 >> 1U);
 
         /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc) - (xb + xd) */
         R0 = (R0 >> 1U) - (T0 >> 1U);
@@ -535,8 +659,8 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  writing the butterfly processed i0 + fftLen/4 sample */
         /* xc' = (xa-xb+xc-xd) */
         /* yc' = (ya-yb+yc-yd) */
-        pSrc16[i1 * 2U] = R0;
-        pSrc16[(i1 * 2U) + 1U] = R1;
+        pSrc16[(i1 * 2U) + re] = R0;
+        pSrc16[(i1 * 2U) + im] = R1;
 
         /* Read yd (real), xd(imag) input */
         U0 = pSrc16[i3 * 2U];
@@ -548,14 +672,14 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  writing the butterfly processed i0 + fftLen/2 sample */
         /* xb' = (xa+yb-xc-yd) */
         /* yb' = (ya-xb-yc+xd) */
-        pSrc16[i2 * 2U] = (S0 >> 1U) + (T1 >> 1U);
-        pSrc16[(i2 * 2U) + 1U] = (S1 >> 1U) - (T0 >> 1U);
+        pSrc16[(i2 * 2U) + re] = (S0 >> 1U) + (T1 >> 1U);
+        pSrc16[(i2 * 2U) + im] = (S1 >> 1U) - (T0 >> 1U);
 
         /*  writing the butterfly processed i0 + 3fftLen/4 sample */
         /* xd' = (xa-yb-xc+yd) */
         /* yd' = (ya+xb-yc-xd) */
-        pSrc16[i3 * 2U] = (S0 >> 1U) - (T1 >> 1U);
-        pSrc16[(i3 * 2U) + 1U] = (S1 >> 1U) + (T0 >> 1U);
+        pSrc16[(i3 * 2U) + re] = (S0 >> 1U) - (T1 >> 1U);
+        pSrc16[(i3 * 2U) + im] = (S1 >> 1U) + (T0 >> 1U);
     }
 
     /* end of last stage process */
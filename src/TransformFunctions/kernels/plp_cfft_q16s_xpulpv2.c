@@ -39,44 +39,166 @@
  * @{
  */
 
-static void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef);
+static void plp_cfft_radix4by2_q16(int16_t *pSrc,
+                                   uint32_t fftLen,
+                                   const int16_t *pCoef,
+                                   const int16_t *pWindow,
+                                   const int8_t *pSrc8,
+                                   uint8_t ifftFlag);
 
 static void plp_radix4_butterfly_q16(int16_t *pSrc16,
                                      uint32_t fftLen,
                                      int16_t *pCoef16,
-                                     uint32_t twidCoefModifier);
+                                     uint32_t twidCoefModifier,
+                                     const int16_t *pWindow,
+                                     const int8_t *pSrc8,
+                                     uint8_t ifftFlag);
+
+// Swaps the real and imaginary part of x if swap is set. The inverse transform swaps the input
+// when it is read by the first stage, and the output when it is written by the last stage. This
+// is the same as computing the butterflies with conjugated twiddle factors, and the scaling by
+// 1/fftLen of the forward transform is exactly the one of the inverse transform.
+static inline v2s plp_cfft_swap_q16(v2s x, uint8_t swap) {
+    return swap ? __PACK2(x[1], x[0]) : x;
+}
+
+// Reads the complex sample i, scaled down by 2^shift. If pWindow is set, the sample is multiplied
+// with the window, whose first half is stored in pWindow. If pSrc8 is set, the sample is read from
+// the 8-bit input pSrc8 instead, and widened to 16 bits in the registers.
+static inline v2s plp_cfft_window_load_q16(const int16_t *pSrc,
+                                           const int8_t *pSrc8,
+                                           uint32_t i,
+                                           const int16_t *pWindow,
+                                           uint32_t fftLen,
+                                           int32_t shift,
+                                           uint8_t ifftFlag) {
+    v2s x;
+    if (pSrc8 == NULL) {
+        x = *(v2s *)&pSrc[2 * i];
+    } else {
+        x = __SLL2(__PACK2(pSrc8[2 * i], pSrc8[2 * i + 1]), ((v2s){ 8, 8 }));
+    }
+    x = plp_cfft_swap_q16(x, ifftFlag);
+    if (pWindow == NULL) {
+        return __SRA2(x, ((v2s){ shift, shift }));
+    }
+    int32_t w = pWindow[(i <= (fftLen >> 1)) ? i : fftLen - i];
+    return __PACK2((int16_t)((x[0] * w) >> (15 + shift)), (int16_t)((x[1] * w) >> (15 + shift)));
+}
+
+static void plp_cfft_process_q16(const plp_cfft_instance_q16 *S,
+                                 int16_t *p1,
+                                 const int16_t *pWindow,
+                                 const int8_t *pSrc8,
+                                 uint8_t ifftFlag,
+                                 uint8_t bitReverseFlag) {
+
+    uint32_t L = S->fftLen;
+
+    switch (L) {
+    case 16:
+    case 64:
+    case 256:
+    case 1024:
+    case 4096:
+        plp_radix4_butterfly_q16(p1, L, (int16_t *)S->pTwiddle, 1, pWindow, pSrc8, ifftFlag);
+        break;
+    case 32:
+    case 128:
+    case 512:
+    case 2048:
+        plp_cfft_radix4by2_q16(p1, L, (int16_t *)S->pTwiddle, pWindow, pSrc8, ifftFlag);
+        break;
+    }
+
+    if (bitReverseFlag)
+        plp_bitreversal_16s_xpulpv2((uint16_t *)p1, S->bitRevLength, S->pBitRevTable);
+}
 
+PLP_HOT_CODE
 void plp_cfft_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
                            int16_t *p1,
                            uint8_t ifftFlag,
                            uint8_t bitReverseFlag,
                            uint32_t deciPoint) {
 
-    uint32_t L = S->fftLen;
+    plp_cfft_process_q16(S, p1, NULL, NULL, ifftFlag, bitReverseFlag);
+}
 
-    if (ifftFlag == 0) {
-        switch (L) {
-        case 16:
-        case 64:
-        case 256:
-        case 1024:
-        case 4096:
-            plp_radix4_butterfly_q16(p1, L, (int16_t *)S->pTwiddle, 1);
-            break;
-        case 32:
-        case 128:
-        case 512:
-        case 2048:
-            plp_cfft_radix4by2_q16(p1, L, (int16_t *)S->pTwiddle);
-            break;
+/**
+ * @brief      Windowed quantized 16 bit complex fast fourier transform for XPULPV2
+ *
+ * The input samples are multiplied with the window when they are read by the first stage.
+ *
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in]  pWindow         points to the first half of the window in Q1.15,
+ *                             PLP_WINDOW_LEN(fftLen) values
+ * @param[in,out] p1           points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+PLP_HOT_CODE
+void plp_cfft_windowed_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                                    const int16_t *pWindow,
+                                    int16_t *p1,
+                                    uint8_t bitReverseFlag,
+                                    uint32_t deciPoint) {
+
+    plp_cfft_process_q16(S, p1, pWindow, NULL, 0, bitReverseFlag);
+}
+
+/**
+ * @brief      Quantized complex fast fourier transform of 8 bit input for XPULPV2
+ *
+ * The 8-bit input samples are widened to 16 bits in the registers when they are read by the first
+ * stage, and the optional 8-bit output is packed four values at a time.
+ *
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in]  pSrc            points to the complex 8-bit input of size <code>2*fftLen</code>
+ * @param[out] p1              points to the complex 16-bit output of size <code>2*fftLen</code>
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ * @param[out] pDst            points to the complex 8-bit output of size <code>2*fftLen</code>,
+ * or NULL
+ */
+
+PLP_HOT_CODE
+void plp_cfft_q8s_xpulpv2(const plp_cfft_instance_q16 *S,
+                          const int8_t *pSrc,
+                          int16_t *p1,
+                          uint8_t bitReverseFlag,
+                          uint32_t deciPoint,
+                          int8_t *pDst) {
+
+    uint32_t i;
+    v2s a, b;
+
+    plp_cfft_process_q16(S, p1, NULL, pSrc, 0, bitReverseFlag);
+
+    if (pDst != NULL) {
+        // fftLen is at least 16, hence the 2 * fftLen values are a multiple of 4
+        for (i = 0; i < 2 * S->fftLen; i += 4) {
+            a = *(v2s *)&p1[i];
+            b = *(v2s *)&p1[i + 2];
+            *((v4s *)&pDst[i]) = __PACK4(__CLIP((a[0] + 128) >> 8, 7),
+                                         __CLIP((a[1] + 128) >> 8, 7),
+                                         __CLIP((b[0] + 128) >> 8, 7),
+                                         __CLIP((b[1] + 128) >> 8, 7));
         }
     }
-
-    if (bitReverseFlag)
-        plp_bitreversal_16s_xpulpv2((uint16_t *)p1, S->bitRevLength, S->pBitRevTable);
 }
 
-void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef) {
+PLP_HOT_CODE
+void plp_cfft_radix4by2_q16(int16_t *pSrc,
+                            uint32_t fftLen,
+                            const int16_t *pCoef,
+                            const int16_t *pWindow,
+                            const int8_t *pSrc8,
+                            uint8_t ifftFlag) {
 
     uint32_t i;
     uint32_t n2;
@@ -98,8 +220,8 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
 
         l = i + n2;
 
-        a = __SRA2(*(v2s *)&pSrc[2 * i], ((v2s){ 1, 1 }));
-        b = __SRA2(*(v2s *)&pSrc[2 * l], ((v2s){ 1, 1 }));
+        a = plp_cfft_window_load_q16(pSrc, pSrc8, i, pWindow, fftLen, 1, ifftFlag);
+        b = plp_cfft_window_load_q16(pSrc, pSrc8, l, pWindow, fftLen, 1, ifftFlag);
         t = __SUB2(a, b);
         *((v2s *)&pSrc[i * 2]) = __SRA2(__ADD2(a, b), ((v2s){ 1, 1 }));
 
@@ -121,9 +243,9 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
     }
 
     // first col
-    plp_radix4_butterfly_q16(pSrc, n2, (int16_t *)pCoef, 2U);
+    plp_radix4_butterfly_q16(pSrc, n2, (int16_t *)pCoef, 2U, NULL, NULL, 0);
     // second col
-    plp_radix4_butterfly_q16(pSrc + fftLen, n2, (int16_t *)pCoef, 2U);
+    plp_radix4_butterfly_q16(pSrc + fftLen, n2, (int16_t *)pCoef, 2U, NULL, NULL, 0);
 
     for (i = 0; i < (fftLen >> 1); i++) {
         pa = *(v2s *)&pSrc[4 * i];
@@ -132,8 +254,8 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
         pa = __SLL2(pa, ((v2s){ 1, 1 }));
         pb = __SLL2(pb, ((v2s){ 1, 1 }));
 
-        *((v2s *)&pSrc[4 * i]) = pa;
-        *((v2s *)&pSrc[4 * i + 2]) = pb;
+        *((v2s *)&pSrc[4 * i]) = plp_cfft_swap_q16(pa, ifftFlag);
+        *((v2s *)&pSrc[4 * i + 2]) = plp_cfft_swap_q16(pb, ifftFlag);
     }
 }
 
@@ -178,13 +300,23 @@ void plp_cfft_radix4by2_q16(int16_t *pSrc, uint32_t fftLen, const int16_t *pCoef
  * @param[in]      *pCoef16         points to twiddle coefficient buffer.
  * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs
  * with the same twiddle factor table.
+ * @param[in]      *pWindow         points to the first half of the window applied to the input,
+ * or NULL.
+ * @param[in]      *pSrc8           points to the 8-bit input read by the first stage instead of
+ * pSrc16, or NULL.
+ * @param[in]      ifftFlag         swaps the real and imaginary part of the input and output for
+ * the inverse transform.
  * @return none.
  */
 
+PLP_HOT_CODE
 void plp_radix4_butterfly_q16(int16_t *pSrc16,
                               uint32_t fftLen,
                               int16_t *pCoef16,
-                              uint32_t twidCoefModifier) {
+                              uint32_t twidCoefModifier,
+                              const int16_t *pWindow,
+                              const int8_t *pSrc8,
+                              uint8_t ifftFlag) {
     v2s R, S, T, U, V;
     v2s CoSi1, CoSi2, CoSi3, out;
     uint32_t n1, n2, ic, i0, i1, i2, i3, j, k;
@@ -224,11 +356,11 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
 
         /* input is down scale by 4 to avoid overflow */
         /* Read ya (real), xa (imag) input */
-        T = __SRA2(*(v2s *)&pSrc16[i0 * 2U], ((v2s){ 2, 2 }));
+        T = plp_cfft_window_load_q16(pSrc16, pSrc8, i0, pWindow, fftLen, 2, ifftFlag);
 
         /* input is down scale by 4 to avoid overflow */
         /* Read yc (real), xc(imag) input */
-        S = __SRA2(*(v2s *)&pSrc16[i2 * 2U], ((v2s){ 2, 2 }));
+        S = plp_cfft_window_load_q16(pSrc16, pSrc8, i2, pWindow, fftLen, 2, ifftFlag);
 
         /* R0 = (ya + yc) */
         /* R1 = (xa + xc) */
@@ -241,11 +373,11 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
         /* input is down scale by 4 to avoid overflow */
         /* Read yb (real), xb(imag) input */
-        T = __SRA2(*(v2s *)&pSrc16[i1 * 2U], ((v2s){ 2, 2 }));
+        T = plp_cfft_window_load_q16(pSrc16, pSrc8, i1, pWindow, fftLen, 2, ifftFlag);
 
         /* input is down scale by 4 to avoid overflow */
         /* Read yd (real), xd(imag) input */
-        U = __SRA2(*(v2s *)&pSrc16[i3 * 2U], ((v2s){ 2, 2 }));
+        U = plp_cfft_window_load_q16(pSrc16, pSrc8, i3, pWindow, fftLen, 2, ifftFlag);
 
         /* T0 = (yb + yd) */
         /* T1 = (xb + xd) */
@@ -277,9 +409,7 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
                     (int16_t)(__DOTP2(__PACK2(-CoSi2[1], CoSi2[0]), R) >> 16U));
 
         /*  Butterfly calculations */
-        /* input is down scale by 4 to avoid overflow */
-        /* U0 = yd, U1 = xd */
-        U = __SRA2(*(v2s *)&pSrc16[i3 * 2U], ((v2s){ 2, 2 }));
+        /* U0 = yd, U1 = xd are still in U */
 
         /* T0 = yb-yd */
         /* T1 = xb-xd */
@@ -481,7 +611,8 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  writing the butterfly processed i0 sample */
         /* xa' = xa + xb + xc + xd */
         /* ya' = ya + yb + yc + yd */
-        *((v2s *)&pSrc16[i0 * 2U]) = __ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(T, ((v2s){ 1, 1 })));
+        *((v2s *)&pSrc16[i0 * 2U]) = plp_cfft_swap_q16(
+            __ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(T, ((v2s){ 1, 1 }))), ifftFlag);
 
         /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc) - (xb + xd) */
         R = __SUB2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(T, ((v2s){ 1, 1 })));
@@ -492,7 +623,7 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  writing the butterfly processed i0 + fftLen/4 sample */
         /* xc' = (xa-xb+xc-xd) */
         /* yc' = (ya-yb+yc-yd) */
-        *((v2s *)&pSrc16[i1 * 2U]) = R;
+        *((v2s *)&pSrc16[i1 * 2U]) = plp_cfft_swap_q16(R, ifftFlag);
 
         /* Read yd (real), xd(imag) input */
         U = *(v2s *)&pSrc16[i3 * 2U];
@@ -506,12 +637,12 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
         /*  writing the butterfly processed i0 + fftLen/2 sample */
         /* xb' = (xa+yb-xc-yd) */
         /* yb' = (ya-xb-yc+xd) */
-        *((v2s *)&pSrc16[i2 * 2U]) = __ADD2(S, __PACK2(T[1], -T[0]));
+        *((v2s *)&pSrc16[i2 * 2U]) = plp_cfft_swap_q16(__ADD2(S, __PACK2(T[1], -T[0])), ifftFlag);
 
         /*  writing the butterfly processed i0 + 3fftLen/4 sample */
         /* xd' = (xa-yb-xc+yd) */
         /* yd' = (ya+xb-yc-xd) */
-        *((v2s *)&pSrc16[i3 * 2U]) = __ADD2(S, __PACK2(-T[1], T[0]));
+        *((v2s *)&pSrc16[i3 * 2U]) = plp_cfft_swap_q16(__ADD2(S, __PACK2(-T[1], T[0])), ifftFlag);
     }
 
     /* end of last stage process */
@@ -0,0 +1,430 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q32p_xpulpv2.c
+ * Description:  Parallel 32-bit fixed-point complex FFT for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+static void plp_cfft_radix4by2_q32p(int32_t *pSrc,
+                                    uint32_t fftLen,
+                                    const int32_t *pCoef,
+                                    uint8_t ifftFlag,
+                                    uint32_t coreId,
+                                    uint32_t nPE);
+
+static void plp_radix4_butterfly_q32p(int32_t *pSrc,
+                                      uint32_t fftLen,
+                                      const int32_t *pCoef,
+                                      uint32_t twidCoefModifier,
+                                      uint8_t ifftFlag,
+                                      uint32_t coreId,
+                                      uint32_t nPE);
+
+/**
+ * @brief      Range [start, end) of n work items assigned to core coreId out of nPE
+ */
+
+static inline void plp_cfft_q32p_chunk(
+    uint32_t n, uint32_t coreId, uint32_t nPE, uint32_t *start, uint32_t *end) {
+    uint32_t step = (n + nPE - 1) / nPE;
+    *start = MIN(coreId * step, n);
+    *end = MIN(*start + step, n);
+}
+
+/**
+ * @brief      Parallel quantized 32 bit complex fast fourier transform for XPULPV2
+ *
+ * @par Work Distribution
+ * Every radix-4 stage is split into contiguous chunks of fftLen/4 butterflies, so all cores stay
+ * busy even in the last middle stages, where there are fewer twiddle groups than cores. The
+ * results are bit-exact with plp_cfft_q32s_xpulpv2 for any number of cores.
+ *
+ * @param[in]   args    points to the plp_cfft_instance_q32_parallel
+ */
+
+void plp_cfft_q32p_xpulpv2(void *args) {
+    uint32_t core_id = rt_core_id();
+    plp_cfft_instance_q32_parallel *a = (plp_cfft_instance_q32_parallel *)args;
+
+    uint32_t L = a->S->fftLen;
+
+    switch (L) {
+    case 16:
+    case 64:
+    case 256:
+    case 1024:
+    case 4096:
+        plp_radix4_butterfly_q32p(a->p1, L, a->S->pTwiddle, 1, a->ifftFlag, core_id, a->nPE);
+        break;
+    case 32:
+    case 128:
+    case 512:
+    case 2048:
+        plp_cfft_radix4by2_q32p(a->p1, L, a->S->pTwiddle, a->ifftFlag, core_id, a->nPE);
+        break;
+    }
+
+    rt_team_barrier();
+
+    if (a->bitReverseFlag)
+        plp_bitreversal_32p_xpulpv2((uint32_t *)a->p1, a->S->bitRevLength,
+                                    (const uint16_t *)a->S->pBitRevTable, a->nPE);
+}
+
+#define multAcc_32x32_keep32_R(a, x, y) \
+    a = (int32_t)(((((int64_t)a) << 32) + ((int64_t)x * y) + 0x80000000LL) >> 32)
+
+#define multSub_32x32_keep32_R(a, x, y) \
+    a = (int32_t)(((((int64_t)a) << 32) - ((int64_t)x * y) + 0x80000000LL) >> 32)
+
+#define mult_32x32_keep32_R(a, x, y) a = (int32_t)(((int64_t)x * y + 0x80000000LL) >> 32)
+
+/*
+ * The inverse transform swaps the real and imaginary part of the input in the first stage and of
+ * the output in the last stage, like plp_cfft_q32s_xpulpv2.
+ */
+
+void plp_cfft_radix4by2_q32p(int32_t *pSrc,
+                             uint32_t fftLen,
+                             const int32_t *pCoef,
+                             uint8_t ifftFlag,
+                             uint32_t coreId,
+                             uint32_t nPE) {
+    uint32_t i, l, start, end;
+    uint32_t n2 = fftLen >> 1;
+    int32_t xt, yt, cosVal, sinVal;
+    int32_t p0, p1;
+    uint32_t re = ifftFlag ? 1 : 0;
+    uint32_t im = 1 - re;
+
+    plp_cfft_q32p_chunk(n2, coreId, nPE, &start, &end);
+
+    for (i = start; i < end; i++) {
+        cosVal = pCoef[2 * i];
+        sinVal = pCoef[2 * i + 1];
+
+        l = i + n2;
+
+        xt = (pSrc[2 * i + re] >> 2) - (pSrc[2 * l + re] >> 2);
+        yt = (pSrc[2 * i + im] >> 2) - (pSrc[2 * l + im] >> 2);
+        p0 = (pSrc[2 * i + re] >> 2) + (pSrc[2 * l + re] >> 2);
+        p1 = (pSrc[2 * i + im] >> 2) + (pSrc[2 * l + im] >> 2);
+
+        pSrc[2 * i] = p0;
+        pSrc[2 * i + 1] = p1;
+
+        mult_32x32_keep32_R(p0, xt, cosVal);
+        mult_32x32_keep32_R(p1, yt, cosVal);
+        multAcc_32x32_keep32_R(p0, yt, sinVal);
+        multSub_32x32_keep32_R(p1, xt, sinVal);
+
+        pSrc[2 * l] = p0 << 1;
+        pSrc[2 * l + 1] = p1 << 1;
+    }
+
+    rt_team_barrier();
+
+    if (nPE > 1) {
+        // both halves execute the same number of barriers, so the team stays in sync
+        uint32_t nLow = nPE >> 1;
+        if (coreId < nLow) {
+            // first col
+            plp_radix4_butterfly_q32p(pSrc, n2, pCoef, 2U, 0, coreId, nLow);
+        } else {
+            // second col
+            plp_radix4_butterfly_q32p(pSrc + fftLen, n2, pCoef, 2U, 0, coreId - nLow,
+                                      nPE - nLow);
+        }
+    } else {
+        // first col
+        plp_radix4_butterfly_q32p(pSrc, n2, pCoef, 2U, 0, 0, 1);
+        // second col
+        plp_radix4_butterfly_q32p(pSrc + fftLen, n2, pCoef, 2U, 0, 0, 1);
+    }
+
+    rt_team_barrier();
+
+    for (i = start; i < end; i++) {
+        p0 = pSrc[4 * i + 0];
+        p1 = pSrc[4 * i + 1];
+        xt = pSrc[4 * i + 2];
+        yt = pSrc[4 * i + 3];
+        pSrc[4 * i + re] = p0 << 1;
+        pSrc[4 * i + im] = p1 << 1;
+        pSrc[4 * i + 2 + re] = xt << 1;
+        pSrc[4 * i + 2 + im] = yt << 1;
+    }
+}
+
+/*
+ * The arithmetic of all stages is identical to plp_radix4_butterfly_q32 in
+ * plp_cfft_q32s_xpulpv2.c, only the loops are split among the cores.
+ */
+
+void plp_radix4_butterfly_q32p(int32_t *pSrc,
+                               uint32_t fftLen,
+                               const int32_t *pCoef,
+                               uint32_t twidCoefModifier,
+                               uint8_t ifftFlag,
+                               uint32_t coreId,
+                               uint32_t nPE) {
+    uint32_t n1, n2, ia1, ia2, ia3, i0, i1, i2, i3, j, k, g, b;
+    uint32_t nGroups, gEnd, start, end;
+    int32_t t1, t2, r1, r2, s1, s2, co1, co2, co3, si1, si2, si3;
+
+    int32_t xa, xb, xc, xd;
+    int32_t ya, yb, yc, yd;
+
+    int32_t *ptr1;
+    uint32_t re = ifftFlag ? 1 : 0;
+    uint32_t im = 1 - re;
+
+    /* start of first stage process */
+
+    n2 = fftLen >> 2;
+
+    plp_cfft_q32p_chunk(n2, coreId, nPE, &start, &end);
+
+    for (i0 = start; i0 < end; i0++) {
+        i1 = i0 + n2;
+        i2 = i1 + n2;
+        i3 = i2 + n2;
+
+        /* input is in 1.31(q31) format and provide 4 guard bits for the input */
+
+        /* xa + xc */
+        r1 = (pSrc[2 * i0 + re] >> 4) + (pSrc[2 * i2 + re] >> 4);
+        /* xa - xc */
+        r2 = (pSrc[2 * i0 + re] >> 4) - (pSrc[2 * i2 + re] >> 4);
+        /* xb + xd */
+        t1 = (pSrc[2 * i1 + re] >> 4) + (pSrc[2 * i3 + re] >> 4);
+        /* ya + yc */
+        s1 = (pSrc[2 * i0 + im] >> 4) + (pSrc[2 * i2 + im] >> 4);
+        /* ya - yc */
+        s2 = (pSrc[2 * i0 + im] >> 4) - (pSrc[2 * i2 + im] >> 4);
+
+        /* xa' = xa + xb + xc + xd */
+        pSrc[2 * i0] = (r1 + t1);
+        /* (xa + xc) - (xb + xd) */
+        r1 = r1 - t1;
+        /* yb + yd */
+        t2 = (pSrc[2 * i1 + im] >> 4) + (pSrc[2 * i3 + im] >> 4);
+        /* ya' = ya + yb + yc + yd */
+        pSrc[2 * i0 + 1] = (s1 + t2);
+        /* (ya + yc) - (yb + yd) */
+        s1 = s1 - t2;
+
+        /* yb - yd */
+        t1 = (pSrc[2 * i1 + im] >> 4) - (pSrc[2 * i3 + im] >> 4);
+        /* xb - xd */
+        t2 = (pSrc[2 * i1 + re] >> 4) - (pSrc[2 * i3 + re] >> 4);
+
+        ia1 = i0 * twidCoefModifier;
+        ia2 = 2 * ia1;
+        co2 = pCoef[ia2 * 2];
+        si2 = pCoef[ia2 * 2 + 1];
+
+        /* xc' = (xa-xb+xc-xd)co2 + (ya-yb+yc-yd)(si2) */
+        pSrc[2 * i1] = (((int32_t)(((int64_t)r1 * co2) >> 32)) +
+                        ((int32_t)(((int64_t)s1 * si2) >> 32))) << 1;
+        /* yc' = (ya-yb+yc-yd)co2 - (xa-xb+xc-xd)(si2) */
+        pSrc[2 * i1 + 1] = (((int32_t)(((int64_t)s1 * co2) >> 32)) -
+                            ((int32_t)(((int64_t)r1 * si2) >> 32))) << 1;
+
+        /* (xa - xc) + (yb - yd) */
+        r1 = r2 + t1;
+        /* (xa - xc) - (yb - yd) */
+        r2 = r2 - t1;
+        /* (ya - yc) - (xb - xd) */
+        s1 = s2 - t2;
+        /* (ya - yc) + (xb - xd) */
+        s2 = s2 + t2;
+
+        co1 = pCoef[ia1 * 2];
+        si1 = pCoef[ia1 * 2 + 1];
+
+        /* xb' = (xa+yb-xc-yd)co1 + (ya-xb-yc+xd)(si1) */
+        pSrc[2 * i2] = (((int32_t)(((int64_t)r1 * co1) >> 32)) +
+                        ((int32_t)(((int64_t)s1 * si1) >> 32))) << 1;
+        /* yb' = (ya-xb-yc+xd)co1 - (xa+yb-xc-yd)(si1) */
+        pSrc[2 * i2 + 1] = (((int32_t)(((int64_t)s1 * co1) >> 32)) -
+                            ((int32_t)(((int64_t)r1 * si1) >> 32))) << 1;
+
+        ia3 = 3 * ia1;
+        co3 = pCoef[ia3 * 2];
+        si3 = pCoef[ia3 * 2 + 1];
+
+        /* xd' = (xa-yb-xc+yd)co3 + (ya+xb-yc-xd)(si3) */
+        pSrc[2 * i3] = (((int32_t)(((int64_t)r2 * co3) >> 32)) +
+                        ((int32_t)(((int64_t)s2 * si3) >> 32))) << 1;
+        /* yd' = (ya+xb-yc-xd)co3 - (xa-yb-xc+yd)(si3) */
+        pSrc[2 * i3 + 1] = (((int32_t)(((int64_t)s2 * co3) >> 32)) -
+                            ((int32_t)(((int64_t)r2 * si3) >> 32))) << 1;
+    }
+
+    rt_team_barrier();
+
+    /* start of middle stages process */
+
+    twidCoefModifier <<= 2;
+
+    for (k = fftLen >> 2; k > 4; k >>= 2) {
+        n1 = n2;
+        n2 >>= 2;
+        nGroups = fftLen / n1;
+
+        /* butterfly b handles twiddle j = b / nGroups of group g = b % nGroups */
+        plp_cfft_q32p_chunk(n2 * nGroups, coreId, nPE, &start, &end);
+
+        for (b = start; b < end; b = j * nGroups + gEnd) {
+            j = b / nGroups;
+            gEnd = MIN(end - j * nGroups, nGroups);
+
+            ia1 = j * twidCoefModifier;
+            ia2 = ia1 + ia1;
+            ia3 = ia2 + ia1;
+            co1 = pCoef[ia1 * 2];
+            si1 = pCoef[ia1 * 2 + 1];
+            co2 = pCoef[ia2 * 2];
+            si2 = pCoef[ia2 * 2 + 1];
+            co3 = pCoef[ia3 * 2];
+            si3 = pCoef[ia3 * 2 + 1];
+
+            for (g = b - j * nGroups; g < gEnd; g++) {
+                i0 = j + g * n1;
+                i1 = i0 + n2;
+                i2 = i1 + n2;
+                i3 = i2 + n2;
+
+                /* xa + xc */
+                r1 = pSrc[2 * i0] + pSrc[2 * i2];
+                /* xa - xc */
+                r2 = pSrc[2 * i0] - pSrc[2 * i2];
+                /* ya + yc */
+                s1 = pSrc[2 * i0 + 1] + pSrc[2 * i2 + 1];
+                /* ya - yc */
+                s2 = pSrc[2 * i0 + 1] - pSrc[2 * i2 + 1];
+                /* xb + xd */
+                t1 = pSrc[2 * i1] + pSrc[2 * i3];
+
+                /* xa' = xa + xb + xc + xd */
+                pSrc[2 * i0] = (r1 + t1) >> 2;
+                /* xa + xc -(xb + xd) */
+                r1 = r1 - t1;
+                /* yb + yd */
+                t2 = pSrc[2 * i1 + 1] + pSrc[2 * i3 + 1];
+                /* ya' = ya + yb + yc + yd */
+                pSrc[2 * i0 + 1] = (s1 + t2) >> 2;
+                /* (ya + yc) - (yb + yd) */
+                s1 = s1 - t2;
+
+                /* (yb - yd) */
+                t1 = pSrc[2 * i1 + 1] - pSrc[2 * i3 + 1];
+                /* (xb - xd) */
+                t2 = pSrc[2 * i1] - pSrc[2 * i3];
+
+                /* xc' = (xa-xb+xc-xd)co2 + (ya-yb+yc-yd)(si2) */
+                pSrc[2 * i1] = (((int32_t)(((int64_t)r1 * co2) >> 32)) +
+                                ((int32_t)(((int64_t)s1 * si2) >> 32))) >> 1;
+                /* yc' = (ya-yb+yc-yd)co2 - (xa-xb+xc-xd)(si2) */
+                pSrc[2 * i1 + 1] = (((int32_t)(((int64_t)s1 * co2) >> 32)) -
+                                    ((int32_t)(((int64_t)r1 * si2) >> 32))) >> 1;
+
+                /* (xa - xc) + (yb - yd) */
+                r1 = r2 + t1;
+                /* (xa - xc) - (yb - yd) */
+                r2 = r2 - t1;
+                /* (ya - yc) -  (xb - xd) */
+                s1 = s2 - t2;
+                /* (ya - yc) +  (xb - xd) */
+                s2 = s2 + t2;
+
+                /* xb' = (xa+yb-xc-yd)co1 + (ya-xb-yc+xd)(si1) */
+                pSrc[2 * i2] = (((int32_t)(((int64_t)r1 * co1) >> 32)) +
+                                ((int32_t)(((int64_t)s1 * si1) >> 32))) >> 1;
+                /* yb' = (ya-xb-yc+xd)co1 - (xa+yb-xc-yd)(si1) */
+                pSrc[2 * i2 + 1] = (((int32_t)(((int64_t)s1 * co1) >> 32)) -
+                                    ((int32_t)(((int64_t)r1 * si1) >> 32))) >> 1;
+
+                /* xd' = (xa-yb-xc+yd)co3 + (ya+xb-yc-xd)(si3) */
+                pSrc[2 * i3] = (((int32_t)(((int64_t)r2 * co3) >> 32)) +
+                                ((int32_t)(((int64_t)s2 * si3) >> 32))) >> 1;
+                /* yd' = (ya+xb-yc-xd)co3 - (xa-yb-xc+yd)(si3) */
+                pSrc[2 * i3 + 1] = (((int32_t)(((int64_t)s2 * co3) >> 32)) -
+                                    ((int32_t)(((int64_t)r2 * si3) >> 32))) >> 1;
+            }
+        }
+
+        twidCoefModifier <<= 2;
+
+        rt_team_barrier();
+    }
+
+    /* start of last stage process */
+
+    plp_cfft_q32p_chunk(fftLen >> 2, coreId, nPE, &start, &end);
+
+    for (b = start; b < end; b++) {
+        ptr1 = &pSrc[8 * b];
+
+        xa = ptr1[0];
+        ya = ptr1[1];
+        xb = ptr1[2];
+        yb = ptr1[3];
+        xc = ptr1[4];
+        yc = ptr1[5];
+        xd = ptr1[6];
+        yd = ptr1[7];
+
+        /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+        ptr1[0 + re] = xa + xb + xc + xd;
+        ptr1[0 + im] = ya + yb + yc + yd;
+        /* xc' = xa - xb + xc - xd, yc' = ya - yb + yc - yd */
+        ptr1[2 + re] = xa - xb + xc - xd;
+        ptr1[2 + im] = ya - yb + yc - yd;
+        /* xb' = xa + yb - xc - yd, yb' = ya - xb - yc + xd */
+        ptr1[4 + re] = xa + yb - xc - yd;
+        ptr1[4 + im] = ya - xb - yc + xd;
+        /* xd' = xa - yb - xc + yd, yd' = ya + xb - yc - xd */
+        ptr1[6 + re] = xa - yb - xc + yd;
+        ptr1[6 + im] = ya + xb - yc - xd;
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
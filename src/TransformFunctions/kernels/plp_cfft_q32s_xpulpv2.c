@@ -49,12 +49,16 @@
 	a = (int32_t) (((int64_t) x * y + 0x80000000LL ) >> 32)
 
 
-static void plp_cfft_radix4by2_q32(int32_t *pSrc, uint32_t fftLen, const int32_t *pCoef);
+static void plp_cfft_radix4by2_q32(int32_t *pSrc,
+                                   uint32_t fftLen,
+                                   const int32_t *pCoef,
+                                   uint8_t ifftFlag);
 
 static void plp_radix4_butterfly_q32(int32_t *pSrc,
 	uint32_t fftLen,
 	int32_t *pCoef,
-	uint32_t twidCoefModifier);
+	uint32_t twidCoefModifier,
+	uint8_t ifftFlag);
 
 /**
  * @brief      Quantized 32-bit complex fast fourier transform for XPULPV2
@@ -62,6 +66,8 @@ static void plp_radix4_butterfly_q32(int32_t *pSrc,
  * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
  * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
  * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform. The inverse transform includes the scaling by 1/fftLen, hence the output has the
+ * same fixed point format as the input.
  * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
  * (bitReverseFlag=0) bit reversal of output.
  * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
@@ -74,33 +80,40 @@ void plp_cfft_q32s_xpulpv2(const plp_cfft_instance_q32 *S,
                       uint32_t fracBits){
 	uint32_t L = S->fftLen;
 
-	if (ifftFlag == 0) {
-		switch (L) {
-			case 16:
-			case 64:
-			case 256:
-			case 1024:
-			case 4096:
-			plp_radix4_butterfly_q32(p1, L, (int32_t *)S->pTwiddle, 1);
-			break;
-			case 32:
-			case 128:
-			case 512:
-			case 2048:
-			plp_cfft_radix4by2_q32(p1, L, (int32_t *)S->pTwiddle);
-			break;
-		}
+	switch (L) {
+		case 16:
+		case 64:
+		case 256:
+		case 1024:
+		case 4096:
+		plp_radix4_butterfly_q32(p1, L, (int32_t *)S->pTwiddle, 1, ifftFlag);
+		break;
+		case 32:
+		case 128:
+		case 512:
+		case 2048:
+		plp_cfft_radix4by2_q32(p1, L, (int32_t *)S->pTwiddle, ifftFlag);
+		break;
 	}
 
 	if (bitReverseFlag)
 		plp_bitreversal_32s_xpulpv2((uint32_t *)p1, S->bitRevLength, S->pBitRevTable);
 }
 
-void plp_cfft_radix4by2_q32(int32_t *pSrc, uint32_t fftLen, const int32_t *pCoef){
+/*
+ * The inverse transform swaps the real and imaginary part of the input when it is read by the
+ * first stage, and of the output when it is written by the last stage. This is the same as
+ * computing the butterflies with conjugated twiddle factors, and the scaling by 1/fftLen of the
+ * forward transform is exactly the one of the inverse transform.
+ */
+
+void plp_cfft_radix4by2_q32(int32_t *pSrc, uint32_t fftLen, const int32_t *pCoef, uint8_t ifftFlag){
 	uint32_t i, l;
 	uint32_t n2;
 	int32_t xt, yt, cosVal, sinVal;
 	int32_t p0, p1;
+	uint32_t re = ifftFlag ? 1U : 0U;
+	uint32_t im = 1U - re;
 
 	n2 = fftLen >> 1U;
 	for (i = 0; i < n2; i++)
@@ -110,11 +123,13 @@ void plp_cfft_radix4by2_q32(int32_t *pSrc, uint32_t fftLen, const int32_t *pCoef
 
 		l = i + n2;
 
-		xt =          (pSrc[2 * i] >> 2U) - (pSrc[2 * l] >> 2U);
-		pSrc[2 * i] = (pSrc[2 * i] >> 2U) + (pSrc[2 * l] >> 2U);
+		xt = (pSrc[2 * i + re] >> 2U) - (pSrc[2 * l + re] >> 2U);
+		yt = (pSrc[2 * i + im] >> 2U) - (pSrc[2 * l + im] >> 2U);
+		p0 = (pSrc[2 * i + re] >> 2U) + (pSrc[2 * l + re] >> 2U);
+		p1 = (pSrc[2 * i + im] >> 2U) + (pSrc[2 * l + im] >> 2U);
 
-		yt =              (pSrc[2 * i + 1] >> 2U) - (pSrc[2 * l + 1] >> 2U);
-		pSrc[2 * i + 1] = (pSrc[2 * l + 1] >> 2U) + (pSrc[2 * i + 1] >> 2U);
+		pSrc[2 * i]     = p0;
+		pSrc[2 * i + 1] = p1;
 
 		mult_32x32_keep32_R(p0, xt, cosVal);
 		mult_32x32_keep32_R(p1, yt, cosVal);
@@ -127,10 +142,10 @@ void plp_cfft_radix4by2_q32(int32_t *pSrc, uint32_t fftLen, const int32_t *pCoef
 
 
     /* first col */
-	plp_radix4_butterfly_q32 (pSrc,          n2, (int32_t*)pCoef, 2U);
+	plp_radix4_butterfly_q32 (pSrc,          n2, (int32_t*)pCoef, 2U, 0);
 
     /* second col */
-	plp_radix4_butterfly_q32 (pSrc + fftLen, n2, (int32_t*)pCoef, 2U);
+	plp_radix4_butterfly_q32 (pSrc + fftLen, n2, (int32_t*)pCoef, 2U, 0);
 
 	n2 = fftLen >> 1U;
 	for (i = 0; i < n2; i++)
@@ -145,17 +160,18 @@ void plp_cfft_radix4by2_q32(int32_t *pSrc, uint32_t fftLen, const int32_t *pCoef
 		xt <<= 1U;
 		yt <<= 1U;
 
-		pSrc[4 * i + 0] = p0;
-		pSrc[4 * i + 1] = p1;
-		pSrc[4 * i + 2] = xt;
-		pSrc[4 * i + 3] = yt;
+		pSrc[4 * i + re]      = p0;
+		pSrc[4 * i + im]      = p1;
+		pSrc[4 * i + 2 + re] = xt;
+		pSrc[4 * i + 2 + im] = yt;
 	}
 }
 
 void plp_radix4_butterfly_q32(int32_t *pSrc,
 	uint32_t fftLen,
 	int32_t *pCoef,
-	uint32_t twidCoefModifier){
+	uint32_t twidCoefModifier,
+	uint8_t ifftFlag){
 	uint32_t n1, n2, ia1, ia2, ia3, i0, i1, i2, i3, j, k;
 	int32_t t1, t2, r1, r2, s1, s2, co1, co2, co3, si1, si2, si3;
 
@@ -166,6 +182,9 @@ void plp_radix4_butterfly_q32(int32_t *pSrc,
 
 	int32_t *ptr1;
 
+	uint32_t re = ifftFlag ? 1U : 0U;
+	uint32_t im = 1U - re;
+
   /* Total process is divided into three stages */
 
   /* process first stage, middle stages, & last stage */
@@ -196,24 +215,24 @@ void plp_radix4_butterfly_q32(int32_t *pSrc,
 
     /*  Butterfly implementation */
     /* xa + xc */
-		r1 = (pSrc[(2U * i0)] >> 4U) + (pSrc[(2U * i2)] >> 4U);
+		r1 = (pSrc[(2U * i0) + re] >> 4U) + (pSrc[(2U * i2) + re] >> 4U);
     /* xa - xc */
-		r2 = (pSrc[(2U * i0)] >> 4U) - (pSrc[(2U * i2)] >> 4U);
+		r2 = (pSrc[(2U * i0) + re] >> 4U) - (pSrc[(2U * i2) + re] >> 4U);
 
     /* xb + xd */
-		t1 = (pSrc[(2U * i1)] >> 4U) + (pSrc[(2U * i3)] >> 4U);
+		t1 = (pSrc[(2U * i1) + re] >> 4U) + (pSrc[(2U * i3) + re] >> 4U);
 
     /* ya + yc */
-		s1 = (pSrc[(2U * i0) + 1U] >> 4U) + (pSrc[(2U * i2) + 1U] >> 4U);
+		s1 = (pSrc[(2U * i0) + im] >> 4U) + (pSrc[(2U * i2) + im] >> 4U);
     /* ya - yc */
-		s2 = (pSrc[(2U * i0) + 1U] >> 4U) - (pSrc[(2U * i2) + 1U] >> 4U);
+		s2 = (pSrc[(2U * i0) + im] >> 4U) - (pSrc[(2U * i2) + im] >> 4U);
 
     /* xa' = xa + xb + xc + xd */
 		pSrc[2U * i0] = (r1 + t1);
     /* (xa + xc) - (xb + xd) */
 		r1 = r1 - t1;
     /* yb + yd */
-		t2 = (pSrc[(2U * i1) + 1U] >> 4U) + (pSrc[(2U * i3) + 1U] >> 4U);
+		t2 = (pSrc[(2U * i1) + im] >> 4U) + (pSrc[(2U * i3) + im] >> 4U);
 
     /* ya' = ya + yb + yc + yd */
 		pSrc[(2U * i0) + 1U] = (s1 + t2);
@@ -222,9 +241,9 @@ void plp_radix4_butterfly_q32(int32_t *pSrc,
 		s1 = s1 - t2;
 
     /* yb - yd */
-		t1 = (pSrc[(2U * i1) + 1U] >> 4U) - (pSrc[(2U * i3) + 1U] >> 4U);
+		t1 = (pSrc[(2U * i1) + im] >> 4U) - (pSrc[(2U * i3) + im] >> 4U);
     /* xb - xd */
-		t2 = (pSrc[(2U * i1)] >> 4U) - (pSrc[(2U * i3)] >> 4U);
+		t2 = (pSrc[(2U * i1) + re] >> 4U) - (pSrc[(2U * i3) + re] >> 4U);
 
     /*  index calculation for the coefficients */
 		ia2 = 2U * ia1;
@@ -436,29 +455,33 @@ void plp_radix4_butterfly_q32(int32_t *pSrc,
 		ptr1 = ptr1 - 8U;
 
     /* writing xa' and ya' */
-		*ptr1++ = xa_out;
-		*ptr1++ = ya_out;
+		ptr1[re] = xa_out;
+		ptr1[im] = ya_out;
+		ptr1 += 2;
 
 		xc_out = (xa - xb + xc - xd);
 		yc_out = (ya - yb + yc - yd);
 
     /* writing xc' and yc' */
-		*ptr1++ = xc_out;
-		*ptr1++ = yc_out;
+		ptr1[re] = xc_out;
+		ptr1[im] = yc_out;
+		ptr1 += 2;
 
 		xb_out = (xa + yb - xc - yd);
 		yb_out = (ya - xb - yc + xd);
 
     /* writing xb' and yb' */
-		*ptr1++ = xb_out;
-		*ptr1++ = yb_out;
+		ptr1[re] = xb_out;
+		ptr1[im] = yb_out;
+		ptr1 += 2;
 
 		xd_out = (xa - yb - xc + yd);
 		yd_out = (ya + xb - yc - xd);
 
     /* writing xd' and yd' */
-		*ptr1++ = xd_out;
-		*ptr1++ = yd_out;
+		ptr1[re] = xd_out;
+		ptr1[im] = yd_out;
+		ptr1 += 2;
 
 
 	} while (--j);
@@ -0,0 +1,255 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_stockham_q16_xpulpv2.c
+ * Description:  16-bit fixed-point Stockham complex FFT kernels for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/* HELPER FUNCTIONS */
+
+static void process_stage_stockham_q16(const int16_t *pIn,
+                                       int16_t *pOut,
+                                       uint32_t n,
+                                       uint32_t s,
+                                       const int16_t *pTwiddle,
+                                       int32_t dir,
+                                       uint32_t coreId,
+                                       uint32_t nPE);
+static void process_last_radix2_stockham_q16(const int16_t *pIn,
+                                             int16_t *pOut,
+                                             uint32_t s,
+                                             uint32_t coreId,
+                                             uint32_t nPE);
+static inline void process_cfft_stockham_q16(const plp_cfft_instance_q16 *S,
+                                             const int16_t *pSrc,
+                                             int16_t *pDst,
+                                             int16_t *pBuffer,
+                                             uint8_t ifftFlag,
+                                             uint32_t coreId,
+                                             uint32_t nPE);
+
+/**
+   @ingroup fft
+ */
+
+/**
+   @addtogroup fftKernels
+   @{
+*/
+
+/**
+   @brief  16-bit fixed-point Stockham FFT on complex input data for XPULPV2 extension.
+   @param[in]   S         points to an instance of the 16-bit fixed-point CFFT structure
+   @param[in]   pSrc      points to the complex input buffer of size <code>2*fftLen</code>
+   @param[out]  pDst      points to the complex output buffer of size <code>2*fftLen</code>
+   @param[in]   pBuffer   points to a scratch buffer of size <code>2*fftLen</code>
+   @param[in]   ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+                          transform.
+   @return      none
+
+   @par Ping-Pong Buffers
+   Every radix-4 stage reads one buffer and writes the other one in natural order. The first stage
+   writes pDst or pBuffer, depending on the number of stages, such that the last stage ends in pDst
+   and no copy is needed. pSrc is only read.
+*/
+void plp_cfft_stockham_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                                    const int16_t *__restrict__ pSrc,
+                                    int16_t *__restrict__ pDst,
+                                    int16_t *__restrict__ pBuffer,
+                                    uint8_t ifftFlag) {
+
+    process_cfft_stockham_q16(S, pSrc, pDst, pBuffer, ifftFlag, 0, 1);
+}
+
+/**
+   @brief  16-bit fixed-point Stockham FFT on complex input data for XPULPV2 extension
+           (parallel version).
+   @param[in]   args    points to the plp_cfft_stockham_instance_q16_parallel
+   @return      none
+
+   @par Parallelization
+   The butterflies of every stage are split into contiguous chunks over the cores, and a barrier
+   separates the stages. Since the stages never work in-place, no core waits for another one
+   within a stage.
+*/
+void plp_cfft_stockham_q16p_xpulpv2(void *args) {
+
+    plp_cfft_stockham_instance_q16_parallel *a = (plp_cfft_stockham_instance_q16_parallel *)args;
+
+    process_cfft_stockham_q16(a->S, a->pSrc, a->pDst, a->pBuffer, a->ifftFlag, rt_core_id(),
+                              a->nPE);
+}
+
+/**
+   @} end of fftKernels group
+*/
+
+static inline void process_cfft_stockham_q16(const plp_cfft_instance_q16 *S,
+                                             const int16_t *pSrc,
+                                             int16_t *pDst,
+                                             int16_t *pBuffer,
+                                             uint8_t ifftFlag,
+                                             uint32_t coreId,
+                                             uint32_t nPE) {
+
+    uint32_t N = S->fftLen;
+    uint32_t n = N;
+    uint32_t s = 1;
+    uint32_t log2N = 0;
+    uint32_t nStages;
+    int32_t dir = ifftFlag ? -1 : 1;
+    const int16_t *pIn = pSrc;
+    int16_t *pOut;
+
+    while ((1U << log2N) < N) {
+        log2N++;
+    }
+    nStages = (log2N + 1) >> 1;
+
+    // choose the first output buffer such that the last stage writes pDst
+    pOut = (nStages & 1) ? pDst : pBuffer;
+
+    for (; n >= 4; n >>= 2, s <<= 2) {
+        if (nPE > 1 && pIn != pSrc) {
+            rt_team_barrier();
+        }
+        process_stage_stockham_q16(pIn, pOut, n, s, S->pTwiddle, dir, coreId, nPE);
+        pIn = pOut;
+        pOut = (pOut == pDst) ? pBuffer : pDst;
+    }
+
+    // last stage, only if log2(fftLen) is odd
+    if (n == 2) {
+        if (nPE > 1 && pIn != pSrc) {
+            rt_team_barrier();
+        }
+        process_last_radix2_stockham_q16(pIn, pOut, s, coreId, nPE);
+    }
+}
+
+/*
+ * One decimation-in-frequency Stockham radix-4 stage on the sub-transforms of length n, with s
+ * sub-transforms interleaved with stride s. For p < n / 4 and q < s, the butterfly reads
+ * pIn[q + s * (p + i * n / 4)] for i < 4, divides it by 4 and writes the 4-point DFT, multiplied
+ * by the twiddle factors W_N^(u * p * s), to pOut[q + s * (4 * p + u)] for u < 4. The twiddle
+ * table of plp_cfft_instance_q16 holds cos and sin of 2 * pi * k / N for k < 3 * N / 4, which
+ * covers all u * p * s.
+ */
+static void process_stage_stockham_q16(const int16_t *pIn,
+                                       int16_t *pOut,
+                                       uint32_t n,
+                                       uint32_t s,
+                                       const int16_t *pTwiddle,
+                                       int32_t dir,
+                                       uint32_t coreId,
+                                       uint32_t nPE) {
+
+    uint32_t b, p, q, qEnd, u;
+    uint32_t m = n >> 2;
+    uint32_t total = m * s;
+    uint32_t chunk = (total + nPE - 1) / nPE;
+    uint32_t start = MIN(coreId * chunk, total);
+    uint32_t end = MIN(start + chunk, total);
+    uint32_t d = s * m; // distance between the inputs of a butterfly
+    v2s wRe[4], wIm[4];
+    int32_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i;
+    int32_t b1r, b1i, b2r, b2i, b3r, b3i;
+    int32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+    for (b = start; b < end; b = p * s + qEnd) {
+        p = b / s;
+        qEnd = MIN(end - p * s, s);
+
+        for (u = 1; u < 4; u++) {
+            int32_t wr = pTwiddle[2 * u * p * s];
+            int32_t wi = -dir * pTwiddle[2 * u * p * s + 1];
+            wRe[u] = __PACK2(wr, -wi);
+            wIm[u] = __PACK2(wi, wr);
+        }
+
+        const int16_t *x = &pIn[2 * s * p];
+        int16_t *y = &pOut[2 * s * 4 * p];
+
+        for (q = b - p * s; q < qEnd; q++) {
+            a0r = x[2 * q] >> 2;
+            a0i = x[2 * q + 1] >> 2;
+            a1r = x[2 * (q + d)] >> 2;
+            a1i = x[2 * (q + d) + 1] >> 2;
+            a2r = x[2 * (q + 2 * d)] >> 2;
+            a2i = x[2 * (q + 2 * d) + 1] >> 2;
+            a3r = x[2 * (q + 3 * d)] >> 2;
+            a3i = x[2 * (q + 3 * d) + 1] >> 2;
+            t0r = a0r + a2r;
+            t0i = a0i + a2i;
+            t1r = a0r - a2r;
+            t1i = a0i - a2i;
+            t2r = a1r + a3r;
+            t2i = a1i + a3i;
+            t3r = dir * (a1i - a3i);
+            t3i = -dir * (a1r - a3r);
+            y[2 * q] = (int16_t)(t0r + t2r);
+            y[2 * q + 1] = (int16_t)(t0i + t2i);
+            b1r = t1r + t3r;
+            b1i = t1i + t3i;
+            b2r = t0r - t2r;
+            b2i = t0i - t2i;
+            b3r = t1r - t3r;
+            b3i = t1i - t3i;
+            y[2 * (q + s)] = (int16_t)(__DOTP2(__PACK2(b1r, b1i), wRe[1]) >> 15);
+            y[2 * (q + s) + 1] = (int16_t)(__DOTP2(__PACK2(b1r, b1i), wIm[1]) >> 15);
+            y[2 * (q + 2 * s)] = (int16_t)(__DOTP2(__PACK2(b2r, b2i), wRe[2]) >> 15);
+            y[2 * (q + 2 * s) + 1] = (int16_t)(__DOTP2(__PACK2(b2r, b2i), wIm[2]) >> 15);
+            y[2 * (q + 3 * s)] = (int16_t)(__DOTP2(__PACK2(b3r, b3i), wRe[3]) >> 15);
+            y[2 * (q + 3 * s) + 1] = (int16_t)(__DOTP2(__PACK2(b3r, b3i), wIm[3]) >> 15);
+        }
+    }
+}
+
+/*
+ * Last radix-2 stage with n = 2, where all twiddle factors are 1: pOut[q] and pOut[q + s] are the
+ * halved sum and difference of pIn[q] and pIn[q + s], for q < s = fftLen / 2.
+ */
+static void process_last_radix2_stockham_q16(const int16_t *pIn,
+                                             int16_t *pOut,
+                                             uint32_t s,
+                                             uint32_t coreId,
+                                             uint32_t nPE) {
+
+    uint32_t q;
+    uint32_t chunk = (s + nPE - 1) / nPE;
+    uint32_t start = MIN(coreId * chunk, s);
+    uint32_t end = MIN(start + chunk, s);
+    v2s a0, a1;
+
+    for (q = start; q < end; q++) {
+        a0 = __PACK2(pIn[2 * q] >> 1, pIn[2 * q + 1] >> 1);
+        a1 = __PACK2(pIn[2 * (q + s)] >> 1, pIn[2 * (q + s) + 1] >> 1);
+        *((v2s *)&pOut[2 * q]) = __ADD2(a0, a1);
+        *((v2s *)&pOut[2 * (q + s)]) = __SUB2(a0, a1);
+    }
+}
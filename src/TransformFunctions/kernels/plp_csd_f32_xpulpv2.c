@@ -0,0 +1,234 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_csd_f32_xpulpv2.c
+ * Description:  Cross-spectral density of 32-bit floating-point signals for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static inline void process_csd_f32(const plp_csd_instance_f32 *S,
+                                   const float32_t *pSrc,
+                                   uint32_t nSamples,
+                                   float32_t *pCsd,
+                                   float32_t *pPsd,
+                                   uint32_t coreId,
+                                   uint32_t nPE);
+
+/**
+ * @ingroup CSD
+ */
+
+/**
+ * @defgroup CSDKernels CSD Kernels
+ * Kernels of the cross-spectral density and the coherence.
+ */
+
+/**
+ * @addtogroup CSDKernels
+ * @{
+ */
+
+/**
+ * @brief      Cross-spectral density of 32-bit floating-point signals for XPULPV2 extension
+ *
+ * @param[in]   S         points to the instance, initialized by plp_csd_init_f32
+ * @param[in]   pSrc      points to the signals, nChannels x nSamples
+ * @param[in]   nSamples  number of samples of every channel
+ * @param[out]  pCsd      points to the cross-spectral densities, nPairs x (N/2 + 1) complex values
+ * @param[out]  pPsd      points to the power spectral densities, nChannels x (N/2 + 1) values, or
+ *                        NULL
+ */
+
+void plp_csd_f32s_xpulpv2(const plp_csd_instance_f32 *S,
+                          const float32_t *pSrc,
+                          uint32_t nSamples,
+                          float32_t *pCsd,
+                          float32_t *pPsd) {
+    process_csd_f32(S, pSrc, nSamples, pCsd, pPsd, 0, 1);
+}
+
+/**
+ * @brief      Parallel cross-spectral density of 32-bit floating-point signals for XPULPV2
+ *             extension
+ *
+ * @par Parallelization
+ * The segments are processed in batches of nSegBuf segments. Every core transforms whole channels
+ * of the segments of a batch, item i being channel i % nChannels of segment i / nChannels. After
+ * a barrier, every core accumulates a contiguous range of the bins of all pairs, followed by a
+ * range of the bins of all channels, such that no two cores write the same output.
+ *
+ * @param[in]   args    points to the plp_csd_instance_f32_parallel
+ */
+
+void plp_csd_f32p_xpulpv2(void *args) {
+    plp_csd_instance_f32_parallel *a = (plp_csd_instance_f32_parallel *)args;
+
+    process_csd_f32(a->S, a->pSrc, a->nSamples, a->pCsd, a->pPsd, rt_core_id(), a->nPE);
+}
+
+/**
+ * @brief      Magnitude-squared coherence of 32-bit floating-point signals for XPULPV2 extension
+ *
+ * @param[in]   S     points to the instance, initialized by plp_csd_init_f32
+ * @param[in]   pCsd  points to the cross-spectral densities computed by plp_csd_f32
+ * @param[in]   pPsd  points to the power spectral densities computed by plp_csd_f32
+ * @param[out]  pDst  points to the coherence of the pairs, nPairs x (N/2 + 1) values
+ */
+
+void plp_coherence_f32s_xpulpv2(const plp_csd_instance_f32 *S,
+                                const float32_t *pCsd,
+                                const float32_t *pPsd,
+                                float32_t *pDst) {
+
+    uint32_t nBins = S->pRfft->FFTLength / 2 + 1;
+    uint32_t p, b;
+
+    for (p = 0; p < S->nPairs; p++) {
+        const float32_t *pXY = &pCsd[2 * p * nBins];
+        const float32_t *pXX = &pPsd[S->pPairs[2 * p] * nBins];
+        const float32_t *pYY = &pPsd[S->pPairs[2 * p + 1] * nBins];
+        float32_t *pOut = &pDst[p * nBins];
+
+        for (b = 0; b < nBins; b++) {
+            float32_t re = pXY[2 * b];
+            float32_t im = pXY[2 * b + 1];
+            float32_t den = pXX[b] * pYY[b];
+            pOut[b] = (den > 0.0f) ? (re * re + im * im) / den : 0.0f;
+        }
+    }
+}
+
+/**
+ * @} end of CSDKernels group
+ */
+
+static inline void process_csd_f32(const plp_csd_instance_f32 *S,
+                                   const float32_t *pSrc,
+                                   uint32_t nSamples,
+                                   float32_t *pCsd,
+                                   float32_t *pPsd,
+                                   uint32_t coreId,
+                                   uint32_t nPE) {
+    const plp_rfft_instance_f32 *pRfft = S->pRfft;
+    uint32_t N = pRfft->FFTLength;
+    uint32_t nBins = N / 2 + 1;
+    uint32_t C = S->nChannels;
+    uint32_t hop = S->hop;
+    uint32_t nSeg = (nSamples < N) ? 0 : (nSamples - N) / hop + 1;
+    uint32_t segStride = 2 * N * C; // distance of the spectra of two segments in pSpec
+    const float32_t *pSpec = S->pSpec;
+    uint32_t startX, endX, startA, endA;
+    uint32_t s0, nb, i, k, p, b, s;
+
+    // every core owns a range of the bins of all pairs, and of all channels
+    plp_team_chunk(S->nPairs * nBins, nPE, coreId, 1, &startX, &endX);
+    plp_team_chunk((pPsd == NULL) ? 0 : C * nBins, nPE, coreId, 1, &startA, &endA);
+
+    for (k = 2 * startX; k < 2 * endX; k++) {
+        pCsd[k] = 0.0f;
+    }
+    for (k = startA; k < endA; k++) {
+        pPsd[k] = 0.0f;
+    }
+
+    for (s0 = 0; s0 < nSeg; s0 += nb) {
+        nb = MIN(S->nSegBuf, nSeg - s0);
+
+        // transform every channel of every segment of the batch once
+        for (i = coreId; i < nb * C; i += nPE) {
+            s = i / C;
+            plp_rfft_windowed_f32_xpulpv2(pRfft, S->pWindow,
+                                          &pSrc[(i - s * C) * nSamples + (s0 + s) * hop],
+                                          &S->pSpec[i * 2 * N]);
+        }
+
+        if (nPE > 1) {
+            plp_team_barrier();
+        }
+
+        // accumulate conj(X) * Y of all segments of the batch
+        p = startX / nBins;
+        b = startX - p * nBins;
+        for (k = startX; k < endX; k++) {
+            const float32_t *pX = &pSpec[2 * (S->pPairs[2 * p] * N + b)];
+            const float32_t *pY = &pSpec[2 * (S->pPairs[2 * p + 1] * N + b)];
+            float32_t re = pCsd[2 * k];
+            float32_t im = pCsd[2 * k + 1];
+
+            for (s = 0; s < nb; s++) {
+                float32_t xr = pX[0], xi = pX[1];
+                float32_t yr = pY[0], yi = pY[1];
+                re += xr * yr + xi * yi;
+                im += xr * yi - xi * yr;
+                pX += segStride;
+                pY += segStride;
+            }
+
+            pCsd[2 * k] = re;
+            pCsd[2 * k + 1] = im;
+            if (++b == nBins) {
+                b = 0;
+                p++;
+            }
+        }
+
+        // accumulate |X|^2 of all segments of the batch
+        p = startA / nBins;
+        b = startA - p * nBins;
+        for (k = startA; k < endA; k++) {
+            const float32_t *pX = &pSpec[2 * (p * N + b)];
+            float32_t acc = pPsd[k];
+
+            for (s = 0; s < nb; s++) {
+                acc += pX[0] * pX[0] + pX[1] * pX[1];
+                pX += segStride;
+            }
+
+            pPsd[k] = acc;
+            if (++b == nBins) {
+                b = 0;
+                p++;
+            }
+        }
+
+        // the next batch overwrites the spectra of this batch
+        if (nPE > 1 && s0 + nb < nSeg) {
+            plp_team_barrier();
+        }
+    }
+
+    if (nSeg > 0) {
+        float32_t g = S->scale / (float32_t)nSeg;
+
+        for (k = 2 * startX; k < 2 * endX; k++) {
+            pCsd[k] *= g;
+        }
+        for (k = startA; k < endA; k++) {
+            pPsd[k] *= g;
+        }
+    }
+}
@@ -0,0 +1,155 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_f32_xpulpv2.c
+ * Description:  32-bit floating-point DCT-II kernels for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// real part of v * exp(-j*theta) with c = cos(theta) and s = sin(theta)
+static inline float32_t
+plp_dct2_f32_rotate(float32_t vRe, float32_t vIm, float32_t c, float32_t s) {
+    return vRe * c + vIm * s;
+}
+
+static inline void process_dct2_f32(const plp_dct2_instance_f32 *S,
+                                    const float32_t *pSrc,
+                                    float32_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE);
+
+/**
+ * @ingroup DCT
+ */
+
+/**
+ * @addtogroup DCTKernels
+ * @{
+ */
+
+/**
+ * @brief      DCT-II of 32-bit floating-point data for XPULPV2 extension
+ *
+ * @param[in]   S       points to the instance, initialized by plp_dct2_init_f32
+ * @param[in]   pSrc    points to the input buffer of N values
+ * @param[out]  pDst    points to the output buffer of N values.
+ *                      pSrc and pDst may point to the same buffer.
+ */
+
+void plp_dct2_f32s_xpulpv2(const plp_dct2_instance_f32 *S,
+                           const float32_t *pSrc,
+                           float32_t *pDst) {
+    process_dct2_f32(S, pSrc, pDst, 0, 1);
+}
+
+/**
+ * @brief      Parallel DCT-II of 32-bit floating-point data for XPULPV2 extension
+ *
+ * @par Parallelization
+ * The reordering of the input, the complex FFT of half the length (see plp_cfft_f32p_xpulpv2) and
+ * the split and rotation of the spectrum are all distributed over the cores, with a barrier in
+ * between.
+ *
+ * @param[in]   args    points to the plp_dct2_instance_f32_parallel
+ */
+
+void plp_dct2_f32p_xpulpv2(void *args) {
+    plp_dct2_instance_f32_parallel *a = (plp_dct2_instance_f32_parallel *)args;
+
+    process_dct2_f32(a->S, a->pSrc, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+ * @} end of DCTKernels group
+ */
+
+static inline void process_dct2_f32(const plp_dct2_instance_f32 *S,
+                                    const float32_t *pSrc,
+                                    float32_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE) {
+    uint32_t N = S->N;
+    uint32_t m, k, start, end;
+    float32_t *pBuf = S->pBuffer;
+    const float32_t *pW = S->pTwiddle;             // exp(-2j*pi*k/N)
+    const float32_t *pP = &S->pTwiddle[N / 2 + 2]; // exp(-j*pi*k/(2N))
+    plp_cfft_instance_f32_parallel fftArgs = {
+        .S = S->pCfft, .p1 = pBuf, .ifftFlag = 0, .nPE = nPE
+    };
+
+    // even samples in ascending and odd samples in descending order
+    plp_team_chunk(N / 2, nPE, coreId, 1, &start, &end);
+    for (m = start; m < end; m += 1) {
+        pBuf[m] = pSrc[2 * m];
+        pBuf[N - 1 - m] = pSrc[2 * m + 1];
+    }
+
+    if (nPE > 1) {
+        plp_team_barrier();
+        plp_cfft_f32p_xpulpv2(&fftArgs);
+        plp_team_barrier();
+    } else {
+        plp_cfft_f32s_xpulpv2(S->pCfft, pBuf, 0);
+    }
+
+    // X[0] and X[N/2] from the real bins 0 and N/2 of V, which are both stored in Z[0]
+    if (coreId == 0) {
+        float32_t zRe = pBuf[0];
+        float32_t zIm = pBuf[1];
+        pDst[0] = zRe + zIm;
+        pDst[N / 2] = 0.70710678f * (zRe - zIm);
+    }
+
+    plp_team_chunk(N / 4, nPE, coreId, 1, &start, &end);
+    for (k = start + 1; k <= end; k++) {
+        float32_t aRe = 0.5f * pBuf[2 * k]; // Z[k] / 2
+        float32_t aIm = 0.5f * pBuf[2 * k + 1];
+        float32_t bRe = 0.5f * pBuf[N - 2 * k]; // Z[N/2-k] / 2
+        float32_t bIm = 0.5f * pBuf[N - 2 * k + 1];
+        float32_t c = pW[2 * k];
+        float32_t s = pW[2 * k + 1];
+
+        // even part (Z[k] + conj(Z[N/2-k])) / 2 and odd part (Z[k] - conj(Z[N/2-k])) / 2j
+        float32_t eRe = aRe + bRe;
+        float32_t eIm = aIm - bIm;
+        float32_t oRe = aIm + bIm;
+        float32_t oIm = bRe - aRe;
+        float32_t tRe = oRe * c + oIm * s;
+        float32_t tIm = oIm * c - oRe * s;
+
+        // V[k] = e + t and V[N/2-k] = conj(e - t)
+        float32_t v0Re = eRe + tRe;
+        float32_t v0Im = eIm + tIm;
+        float32_t v1Re = eRe - tRe;
+        float32_t v1Im = tIm - eIm;
+        const float32_t *p0 = &pP[2 * k];
+        const float32_t *p1 = &pP[N - 2 * k];
+
+        pDst[k] = plp_dct2_f32_rotate(v0Re, v0Im, p0[0], p0[1]);
+        pDst[N - k] = plp_dct2_f32_rotate(v0Re, v0Im, p0[1], -p0[0]);
+        pDst[N / 2 - k] = plp_dct2_f32_rotate(v1Re, v1Im, p1[0], p1[1]);
+        pDst[N / 2 + k] = plp_dct2_f32_rotate(v1Re, v1Im, p1[1], -p1[0]);
+    }
+}
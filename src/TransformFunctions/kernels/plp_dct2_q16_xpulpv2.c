@@ -0,0 +1,156 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_q16_xpulpv2.c
+ * Description:  16-bit fixed-point DCT-II kernels for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void process_dct2_q16(const plp_dct2_instance_q16 *S,
+                                    const int16_t *pSrc,
+                                    int16_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE);
+
+/**
+ * @ingroup DCT
+ */
+
+/**
+ * @addtogroup DCTKernels
+ * @{
+ */
+
+/**
+ * @brief      DCT-II of 16-bit fixed-point data for XPULPV2 extension
+ *
+ * @param[in]   S       points to the instance, initialized by plp_dct2_init_q16
+ * @param[in]   pSrc    points to the input buffer of N values
+ * @param[out]  pDst    points to the output buffer of N values.
+ *                      pSrc and pDst may point to the same buffer.
+ *
+ * @par SIMD
+ * The complex values are processed as packed 16-bit pairs, and every complex rotation takes two
+ * pv.dotsp.h instructions.
+ */
+
+void plp_dct2_q16s_xpulpv2(const plp_dct2_instance_q16 *S,
+                           const int16_t *pSrc,
+                           int16_t *pDst) {
+    process_dct2_q16(S, pSrc, pDst, 0, 1);
+}
+
+/**
+ * @brief      Parallel DCT-II of 16-bit fixed-point data for XPULPV2 extension
+ *
+ * @par Parallelization
+ * The reordering of the input, the complex FFT of half the length (see plp_cfft_q16p_xpulpv2) and
+ * the split and rotation of the spectrum are all distributed over the cores, with a barrier in
+ * between.
+ *
+ * @param[in]   args    points to the plp_dct2_instance_q16_parallel
+ */
+
+void plp_dct2_q16p_xpulpv2(void *args) {
+    plp_dct2_instance_q16_parallel *a = (plp_dct2_instance_q16_parallel *)args;
+
+    process_dct2_q16(a->S, a->pSrc, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+ * @} end of DCTKernels group
+ */
+
+static inline void process_dct2_q16(const plp_dct2_instance_q16 *S,
+                                    const int16_t *pSrc,
+                                    int16_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE) {
+    uint32_t N = S->N;
+    uint32_t m, k, start, end;
+    int16_t *pBuf = S->pBuffer;
+    const v2s *pW = (const v2s *)S->pTwiddle;             // exp(-2j*pi*k/N)
+    const v2s *pP = (const v2s *)&S->pTwiddle[N / 2 + 2]; // exp(-j*pi*k/(2N))
+    const v2s one = { 1, 1 };
+    plp_cfft_instance_q16_parallel fftArgs = { .S = (plp_cfft_instance_q16 *)S->pCfft,
+                                               .p1 = pBuf,
+                                               .ifftFlag = 0,
+                                               .bitReverseFlag = 1,
+                                               .deciPoint = 15,
+                                               .nPE = nPE };
+
+    // even samples in ascending and odd samples in descending order, halved such that the FFT
+    // cannot overflow
+    plp_team_chunk(N / 2, nPE, coreId, 2, &start, &end);
+    for (m = start; m < end; m += 2) {
+        v2s a = __SRA2(*((v2s *)&pSrc[2 * m]), one);
+        v2s b = __SRA2(*((v2s *)&pSrc[2 * m + 2]), one);
+        *((v2s *)&pBuf[m]) = __PACK2(a[0], b[0]);
+        *((v2s *)&pBuf[N - 2 - m]) = __PACK2(b[1], a[1]);
+    }
+
+    if (nPE > 1) {
+        plp_team_barrier();
+        plp_cfft_q16p_xpulpv2(&fftArgs);
+        plp_team_barrier();
+    } else {
+        plp_cfft_q16s_xpulpv2(S->pCfft, pBuf, 0, 1, 15);
+    }
+
+    // X[0] and X[N/2] from the real bins 0 and N/2 of V, which are both stored in Z[0]
+    if (coreId == 0) {
+        int32_t zRe = pBuf[0];
+        int32_t zIm = pBuf[1];
+        pDst[0] = (int16_t)__CLIP(zRe + zIm, 15);
+        pDst[N / 2] = (int16_t)__CLIP(((zRe - zIm) * 23170 + (1 << 14)) >> 15, 15);
+    }
+
+    plp_team_chunk(N / 4, nPE, coreId, 1, &start, &end);
+    for (k = start + 1; k <= end; k++) {
+        v2s a = __SRA2(*((v2s *)&pBuf[2 * k]), one);     // Z[k] / 2
+        v2s b = __SRA2(*((v2s *)&pBuf[N - 2 * k]), one); // Z[N/2-k] / 2
+        v2s w = pW[k];
+        v2s p0 = pP[k];
+        v2s p1 = pP[N / 2 - k];
+
+        // even part (Z[k] + conj(Z[N/2-k])) / 2 and odd part (Z[k] - conj(Z[N/2-k])) / 2j
+        v2s e = __PACK2(a[0] + b[0], a[1] - b[1]);
+        v2s o = __PACK2(a[1] + b[1], b[0] - a[0]);
+        v2s t = __PACK2(__DOTP2(o, w) >> 15, __DOTP2(o, __PACK2(-w[1], w[0])) >> 15);
+
+        // V[k] = e + t and V[N/2-k] = conj(e - t)
+        v2s v0 = __ADD2(e, t);
+        v2s d = __SUB2(e, t);
+        v2s v1 = __PACK2(d[0], -d[1]);
+
+        v2s q0 = __PACK2(p0[1], -p0[0]);
+        v2s q1 = __PACK2(p1[1], -p1[0]);
+
+        pDst[k] = (int16_t)__CLIP((__DOTP2(v0, p0) + (1 << 14)) >> 15, 15);
+        pDst[N - k] = (int16_t)__CLIP((__DOTP2(v0, q0) + (1 << 14)) >> 15, 15);
+        pDst[N / 2 - k] = (int16_t)__CLIP((__DOTP2(v1, p1) + (1 << 14)) >> 15, 15);
+        pDst[N / 2 + k] = (int16_t)__CLIP((__DOTP2(v1, q1) + (1 << 14)) >> 15, 15);
+    }
+}
@@ -0,0 +1,122 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_q32s_rv32im.c
+ * Description:  32-bit fixed-point DCT-II kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// real part of v * exp(-j*theta) in Q1.31 with c = cos(theta) and s = sin(theta), rounded
+// and saturated
+static inline int32_t plp_dct2_q32_rotate(int64_t vRe, int64_t vIm, int64_t c, int64_t s) {
+    int64_t x = (vRe * c + vIm * s + (1LL << 30)) >> 31;
+    return (int32_t)((x > 2147483647LL) ? 2147483647LL : ((x < -2147483648LL) ? -2147483648LL : x));
+}
+
+/**
+ * @ingroup DCT
+ */
+
+/**
+ * @addtogroup DCTKernels
+ * @{
+ */
+
+/**
+ * @brief      DCT-II of 32-bit fixed-point data for RV32IM extension
+ *
+ * @param[in]   S       points to the instance, initialized by plp_dct2_init_q32
+ * @param[in]   pSrc    points to the input buffer of N values
+ * @param[out]  pDst    points to the output buffer of N values.
+ *                      pSrc and pDst may point to the same buffer.
+ *
+ * @par Scaling
+ * The input is in Q1.31, and the output is the transform scaled by 1/N in Q1.31,
+ * such that it cannot overflow.
+ * @par Algorithm
+ * The even input samples in ascending and the odd input samples in descending order form the
+ * sequence v, whose DFT V of length N is computed with the complex FFT of length N/2 of the pairs
+ * v[2n] + j v[2n+1], followed by a split step. Then, X[k] = Re(exp(-j pi k/(2N)) V[k]) and
+ * X[N-k] = -Im(exp(-j pi k/(2N)) V[k]).
+ */
+
+void plp_dct2_q32s_rv32im(const plp_dct2_instance_q32 *S,
+                          const int32_t *pSrc,
+                          int32_t *pDst) {
+    uint32_t N = S->N;
+    uint32_t m, k;
+    int32_t *pBuf = S->pBuffer;
+    const int32_t *pW = S->pTwiddle;             // exp(-2j*pi*k/N)
+    const int32_t *pP = &S->pTwiddle[N / 2 + 2]; // exp(-j*pi*k/(2N))
+
+    // even samples in ascending and odd samples in descending order, halved such that the FFT
+    // cannot overflow
+    for (m = 0; m < N / 2; m += 1) {
+        pBuf[m] = pSrc[2 * m] >> 1;
+        pBuf[N - 1 - m] = pSrc[2 * m + 1] >> 1;
+    }
+
+    plp_cfft_q32s_rv32im(S->pCfft, pBuf, 0, 1, 31);
+
+    // X[0] and X[N/2] from the real bins 0 and N/2 of V, which are both stored in Z[0]
+    int64_t zRe = pBuf[0];
+    int64_t zIm = pBuf[1];
+    pDst[0] = plp_dct2_q32_rotate(zRe + zIm, 0, 1LL << 31, 0);
+    pDst[N / 2] = plp_dct2_q32_rotate(zRe - zIm, 0, 1518500250, 0);
+
+    for (k = 1; k <= N / 4; k++) {
+        int32_t aRe = pBuf[2 * k] >> 1; // Z[k] / 2
+        int32_t aIm = pBuf[2 * k + 1] >> 1;
+        int32_t bRe = pBuf[N - 2 * k] >> 1; // Z[N/2-k] / 2
+        int32_t bIm = pBuf[N - 2 * k + 1] >> 1;
+        int64_t c = pW[2 * k];
+        int64_t s = pW[2 * k + 1];
+
+        // even part (Z[k] + conj(Z[N/2-k])) / 2 and odd part (Z[k] - conj(Z[N/2-k])) / 2j
+        int64_t eRe = aRe + bRe;
+        int64_t eIm = aIm - bIm;
+        int64_t oRe = aIm + bIm;
+        int64_t oIm = bRe - aRe;
+        int64_t tRe = (oRe * c + oIm * s) >> 31;
+        int64_t tIm = (oIm * c - oRe * s) >> 31;
+
+        // V[k] = e + t and V[N/2-k] = conj(e - t)
+        int64_t v0Re = eRe + tRe;
+        int64_t v0Im = eIm + tIm;
+        int64_t v1Re = eRe - tRe;
+        int64_t v1Im = tIm - eIm;
+        const int32_t *p0 = &pP[2 * k];
+        const int32_t *p1 = &pP[N - 2 * k];
+
+        pDst[k] = plp_dct2_q32_rotate(v0Re, v0Im, p0[0], p0[1]);
+        pDst[N - k] = plp_dct2_q32_rotate(v0Re, v0Im, p0[1], -p0[0]);
+        pDst[N / 2 - k] = plp_dct2_q32_rotate(v1Re, v1Im, p1[0], p1[1]);
+        pDst[N / 2 + k] = plp_dct2_q32_rotate(v1Re, v1Im, p1[1], -p1[0]);
+    }
+}
+
+/**
+ * @} end of DCTKernels group
+ */
@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_f32_xpulpv2.c
+ * Description:  32-bit floating-point DCT-IV kernels for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// real part of v * exp(-j*theta) with c = cos(theta) and s = sin(theta)
+static inline float32_t
+plp_dct4_f32_rotate(float32_t vRe, float32_t vIm, float32_t c, float32_t s) {
+    return vRe * c + vIm * s;
+}
+
+static inline void process_dct4_f32(const plp_dct4_instance_f32 *S,
+                                    const float32_t *pSrc,
+                                    float32_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE);
+
+/**
+ * @ingroup DCT
+ */
+
+/**
+ * @addtogroup DCTKernels
+ * @{
+ */
+
+/**
+ * @brief      DCT-IV of 32-bit floating-point data for XPULPV2 extension
+ *
+ * @param[in]   S       points to the instance, initialized by plp_dct4_init_f32
+ * @param[in]   pSrc    points to the input buffer of N values
+ * @param[out]  pDst    points to the output buffer of N values.
+ *                      pSrc and pDst may point to the same buffer.
+ */
+
+void plp_dct4_f32s_xpulpv2(const plp_dct4_instance_f32 *S,
+                           const float32_t *pSrc,
+                           float32_t *pDst) {
+    process_dct4_f32(S, pSrc, pDst, 0, 1);
+}
+
+/**
+ * @brief      Parallel DCT-IV of 32-bit floating-point data for XPULPV2 extension
+ *
+ * @par Parallelization
+ * The rotation of the input, the complex FFT of half the length (see plp_cfft_f32p_xpulpv2) and
+ * the rotation of the spectrum are all distributed over the cores, with a barrier in between.
+ *
+ * @param[in]   args    points to the plp_dct4_instance_f32_parallel
+ */
+
+void plp_dct4_f32p_xpulpv2(void *args) {
+    plp_dct4_instance_f32_parallel *a = (plp_dct4_instance_f32_parallel *)args;
+
+    process_dct4_f32(a->S, a->pSrc, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+ * @} end of DCTKernels group
+ */
+
+static inline void process_dct4_f32(const plp_dct4_instance_f32 *S,
+                                    const float32_t *pSrc,
+                                    float32_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE) {
+    uint32_t N = S->N;
+    uint32_t n, k, start, end;
+    float32_t *pBuf = S->pBuffer;
+    const float32_t *pPre = S->pTwiddle;       // exp(-j*pi*(4n+1)/(4N))
+    const float32_t *pPost = &S->pTwiddle[N];  // exp(-j*pi*k/N)
+    plp_cfft_instance_f32_parallel fftArgs = {
+        .S = S->pCfft, .p1 = pBuf, .ifftFlag = 0, .nPE = nPE
+    };
+
+    // rotated pairs x[2n] + j x[N-1-2n]
+    plp_team_chunk(N / 2, nPE, coreId, 1, &start, &end);
+    for (n = start; n < end; n++) {
+        float32_t uRe = pSrc[2 * n];
+        float32_t uIm = pSrc[N - 1 - 2 * n];
+        float32_t c = pPre[2 * n];
+        float32_t s = pPre[2 * n + 1];
+        pBuf[2 * n] = uRe * c + uIm * s;
+        pBuf[2 * n + 1] = uIm * c - uRe * s;
+    }
+
+    if (nPE > 1) {
+        plp_team_barrier();
+        plp_cfft_f32p_xpulpv2(&fftArgs);
+        plp_team_barrier();
+    } else {
+        plp_cfft_f32s_xpulpv2(S->pCfft, pBuf, 0);
+    }
+
+    for (k = start; k < end; k++) {
+        float32_t yRe = pBuf[2 * k];
+        float32_t yIm = pBuf[2 * k + 1];
+        float32_t c = pPost[2 * k];
+        float32_t s = pPost[2 * k + 1];
+        pDst[2 * k] = plp_dct4_f32_rotate(yRe, yIm, c, s);
+        pDst[N - 1 - 2 * k] = plp_dct4_f32_rotate(yRe, yIm, s, -c);
+    }
+}
@@ -0,0 +1,127 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_q16_xpulpv2.c
+ * Description:  16-bit fixed-point DCT-IV kernels for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void process_dct4_q16(const plp_dct4_instance_q16 *S,
+                                    const int16_t *pSrc,
+                                    int16_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE);
+
+/**
+ * @ingroup DCT
+ */
+
+/**
+ * @addtogroup DCTKernels
+ * @{
+ */
+
+/**
+ * @brief      DCT-IV of 16-bit fixed-point data for XPULPV2 extension
+ *
+ * @param[in]   S       points to the instance, initialized by plp_dct4_init_q16
+ * @param[in]   pSrc    points to the input buffer of N values
+ * @param[out]  pDst    points to the output buffer of N values.
+ *                      pSrc and pDst may point to the same buffer.
+ *
+ * @par SIMD
+ * The complex values are processed as packed 16-bit pairs, and every complex rotation takes two
+ * pv.dotsp.h instructions.
+ */
+
+void plp_dct4_q16s_xpulpv2(const plp_dct4_instance_q16 *S,
+                           const int16_t *pSrc,
+                           int16_t *pDst) {
+    process_dct4_q16(S, pSrc, pDst, 0, 1);
+}
+
+/**
+ * @brief      Parallel DCT-IV of 16-bit fixed-point data for XPULPV2 extension
+ *
+ * @par Parallelization
+ * The rotation of the input, the complex FFT of half the length (see plp_cfft_q16p_xpulpv2) and
+ * the rotation of the spectrum are all distributed over the cores, with a barrier in between.
+ *
+ * @param[in]   args    points to the plp_dct4_instance_q16_parallel
+ */
+
+void plp_dct4_q16p_xpulpv2(void *args) {
+    plp_dct4_instance_q16_parallel *a = (plp_dct4_instance_q16_parallel *)args;
+
+    process_dct4_q16(a->S, a->pSrc, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+ * @} end of DCTKernels group
+ */
+
+static inline void process_dct4_q16(const plp_dct4_instance_q16 *S,
+                                    const int16_t *pSrc,
+                                    int16_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE) {
+    uint32_t N = S->N;
+    uint32_t n, k, start, end;
+    int16_t *pBuf = S->pBuffer;
+    const v2s *pPre = (const v2s *)S->pTwiddle;       // exp(-j*pi*(4n+1)/(4N))
+    const v2s *pPost = (const v2s *)&S->pTwiddle[N];  // exp(-j*pi*k/N)
+    plp_cfft_instance_q16_parallel fftArgs = { .S = (plp_cfft_instance_q16 *)S->pCfft,
+                                               .p1 = pBuf,
+                                               .ifftFlag = 0,
+                                               .bitReverseFlag = 1,
+                                               .deciPoint = 15,
+                                               .nPE = nPE };
+
+    // rotated pairs x[2n] + j x[N-1-2n], halved such that the FFT cannot
+    // overflow
+    plp_team_chunk(N / 2, nPE, coreId, 1, &start, &end);
+    for (n = start; n < end; n++) {
+        v2s u = __PACK2(pSrc[2 * n], pSrc[N - 1 - 2 * n]);
+        v2s w = pPre[n];
+        v2s wj = __PACK2(-w[1], w[0]);
+        *((v2s *)&pBuf[2 * n]) = __PACK2(__DOTP2(u, w) >> 16, __DOTP2(u, wj) >> 16);
+    }
+
+    if (nPE > 1) {
+        plp_team_barrier();
+        plp_cfft_q16p_xpulpv2(&fftArgs);
+        plp_team_barrier();
+    } else {
+        plp_cfft_q16s_xpulpv2(S->pCfft, pBuf, 0, 1, 15);
+    }
+
+    for (k = start; k < end; k++) {
+        v2s y = *((v2s *)&pBuf[2 * k]);
+        v2s w = pPost[k];
+        v2s wn = __PACK2(w[1], -w[0]);
+        pDst[2 * k] = (int16_t)__CLIP((__DOTP2(y, w) + (1 << 14)) >> 15, 15);
+        pDst[N - 1 - 2 * k] = (int16_t)__CLIP((__DOTP2(y, wn) + (1 << 14)) >> 15, 15);
+    }
+}
@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_q16s_rv32im.c
+ * Description:  16-bit fixed-point DCT-IV kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// real part of v * exp(-j*theta) in Q1.15 with c = cos(theta) and s = sin(theta), rounded
+// and saturated
+static inline int16_t plp_dct4_q16_rotate(int32_t vRe, int32_t vIm, int32_t c, int32_t s) {
+    int32_t x = (vRe * c + vIm * s + (1 << 14)) >> 15;
+    return (int16_t)((x > 32767) ? 32767 : ((x < -32768) ? -32768 : x));
+}
+
+/**
+ * @ingroup DCT
+ */
+
+/**
+ * @addtogroup DCTKernels
+ * @{
+ */
+
+/**
+ * @brief      DCT-IV of 16-bit fixed-point data for RV32IM extension
+ *
+ * @param[in]   S       points to the instance, initialized by plp_dct4_init_q16
+ * @param[in]   pSrc    points to the input buffer of N values
+ * @param[out]  pDst    points to the output buffer of N values.
+ *                      pSrc and pDst may point to the same buffer.
+ *
+ * @par Scaling
+ * The input is in Q1.15, and the output is the transform scaled by 1/N in Q1.15,
+ * such that it cannot overflow.
+ * @par Algorithm
+ * The pairs x[2n] + j x[N-1-2n] are rotated by exp(-j pi (4n+1)/(4N)), transformed with the complex
+ * FFT of length N/2 and rotated by exp(-j pi k/N). The real parts are X[2k], and the negated
+ * imaginary parts are X[N-1-2k].
+ */
+
+void plp_dct4_q16s_rv32im(const plp_dct4_instance_q16 *S,
+                          const int16_t *pSrc,
+                          int16_t *pDst) {
+    uint32_t N = S->N;
+    uint32_t n, k;
+    int16_t *pBuf = S->pBuffer;
+    const int16_t *pPre = S->pTwiddle;       // exp(-j*pi*(4n+1)/(4N))
+    const int16_t *pPost = &S->pTwiddle[N];  // exp(-j*pi*k/N)
+
+    // rotated pairs x[2n] + j x[N-1-2n], halved such that the FFT cannot
+    // overflow
+    for (n = 0; n < N / 2; n++) {
+        int32_t uRe = pSrc[2 * n];
+        int32_t uIm = pSrc[N - 1 - 2 * n];
+        int32_t c = pPre[2 * n];
+        int32_t s = pPre[2 * n + 1];
+        pBuf[2 * n] = (int16_t)((uRe * c + uIm * s) >> 16);
+        pBuf[2 * n + 1] = (int16_t)((uIm * c - uRe * s) >> 16);
+    }
+
+    plp_cfft_q16s_rv32im(S->pCfft, pBuf, 0, 1, 15);
+
+    for (k = 0; k < N / 2; k++) {
+        int32_t yRe = pBuf[2 * k];
+        int32_t yIm = pBuf[2 * k + 1];
+        int32_t c = pPost[2 * k];
+        int32_t s = pPost[2 * k + 1];
+        pDst[2 * k] = plp_dct4_q16_rotate(yRe, yIm, c, s);
+        pDst[N - 1 - 2 * k] = plp_dct4_q16_rotate(yRe, yIm, s, -c);
+    }
+}
+
+/**
+ * @} end of DCTKernels group
+ */
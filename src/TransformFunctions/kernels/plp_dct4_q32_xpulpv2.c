@@ -0,0 +1,133 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_q32_xpulpv2.c
+ * Description:  32-bit fixed-point DCT-IV kernels for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// real part of v * exp(-j*theta) in Q1.31 with c = cos(theta) and s = sin(theta), rounded
+// and saturated
+static inline int32_t plp_dct4_q32_rotate(int64_t vRe, int64_t vIm, int64_t c, int64_t s) {
+    int64_t x = (vRe * c + vIm * s + (1LL << 30)) >> 31;
+    return (int32_t)((x > 2147483647LL) ? 2147483647LL : ((x < -2147483648LL) ? -2147483648LL : x));
+}
+
+static inline void process_dct4_q32(const plp_dct4_instance_q32 *S,
+                                    const int32_t *pSrc,
+                                    int32_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE);
+
+/**
+ * @ingroup DCT
+ */
+
+/**
+ * @addtogroup DCTKernels
+ * @{
+ */
+
+/**
+ * @brief      DCT-IV of 32-bit fixed-point data for XPULPV2 extension
+ *
+ * @param[in]   S       points to the instance, initialized by plp_dct4_init_q32
+ * @param[in]   pSrc    points to the input buffer of N values
+ * @param[out]  pDst    points to the output buffer of N values.
+ *                      pSrc and pDst may point to the same buffer.
+ */
+
+void plp_dct4_q32s_xpulpv2(const plp_dct4_instance_q32 *S,
+                           const int32_t *pSrc,
+                           int32_t *pDst) {
+    process_dct4_q32(S, pSrc, pDst, 0, 1);
+}
+
+/**
+ * @brief      Parallel DCT-IV of 32-bit fixed-point data for XPULPV2 extension
+ *
+ * @par Parallelization
+ * The rotation of the input, the complex FFT of half the length (see plp_cfft_q32p_xpulpv2) and
+ * the rotation of the spectrum are all distributed over the cores, with a barrier in between.
+ *
+ * @param[in]   args    points to the plp_dct4_instance_q32_parallel
+ */
+
+void plp_dct4_q32p_xpulpv2(void *args) {
+    plp_dct4_instance_q32_parallel *a = (plp_dct4_instance_q32_parallel *)args;
+
+    process_dct4_q32(a->S, a->pSrc, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+ * @} end of DCTKernels group
+ */
+
+static inline void process_dct4_q32(const plp_dct4_instance_q32 *S,
+                                    const int32_t *pSrc,
+                                    int32_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE) {
+    uint32_t N = S->N;
+    uint32_t n, k, start, end;
+    int32_t *pBuf = S->pBuffer;
+    const int32_t *pPre = S->pTwiddle;       // exp(-j*pi*(4n+1)/(4N))
+    const int32_t *pPost = &S->pTwiddle[N];  // exp(-j*pi*k/N)
+    plp_cfft_instance_q32_parallel fftArgs = { .S = S->pCfft,
+                                               .p1 = pBuf,
+                                               .ifftFlag = 0,
+                                               .bitReverseFlag = 1,
+                                               .fracBits = 31,
+                                               .nPE = nPE };
+
+    // rotated pairs x[2n] + j x[N-1-2n], halved such that the FFT cannot
+    // overflow
+    plp_team_chunk(N / 2, nPE, coreId, 1, &start, &end);
+    for (n = start; n < end; n++) {
+        int64_t uRe = pSrc[2 * n];
+        int64_t uIm = pSrc[N - 1 - 2 * n];
+        int64_t c = pPre[2 * n];
+        int64_t s = pPre[2 * n + 1];
+        pBuf[2 * n] = (int32_t)((uRe * c + uIm * s) >> 32);
+        pBuf[2 * n + 1] = (int32_t)((uIm * c - uRe * s) >> 32);
+    }
+
+    if (nPE > 1) {
+        plp_team_barrier();
+        plp_cfft_q32p_xpulpv2(&fftArgs);
+        plp_team_barrier();
+    } else {
+        plp_cfft_q32s_xpulpv2(S->pCfft, pBuf, 0, 1, 31);
+    }
+
+    for (k = start; k < end; k++) {
+        int64_t yRe = pBuf[2 * k];
+        int64_t yIm = pBuf[2 * k + 1];
+        int64_t c = pPost[2 * k];
+        int64_t s = pPost[2 * k + 1];
+        pDst[2 * k] = plp_dct4_q32_rotate(yRe, yIm, c, s);
+        pDst[N - 1 - 2 * k] = plp_dct4_q32_rotate(yRe, yIm, s, -c);
+    }
+}
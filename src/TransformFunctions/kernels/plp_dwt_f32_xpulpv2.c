@@ -0,0 +1,263 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dwt_f32_xpulpv2.c
+ * Description:  Discrete wavelet transform of f32 samples for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+// index i modulo h, for the taps at the borders
+static inline int32_t plp_dwt_wrap(int32_t i, int32_t h) {
+    int32_t r = i % h;
+    return (r < 0) ? r + h : r;
+}
+
+// c0 y[i] + c1 y[i + 1] with periodic indices
+static inline float32_t plp_dwt_f32_wrap_tap(
+    const float32_t *pY, int32_t h, int32_t i, float32_t c0, float32_t c1) {
+    return c0 * pY[plp_dwt_wrap(i, h)] + c1 * pY[plp_dwt_wrap(i + 1, h)];
+}
+
+// x[n] += c0 y[n + o] + c1 y[n + o + 1] with periodic indices, or -= for the inverse transform
+static inline void plp_dwt_f32_lift(float32_t *pX,
+                                    const float32_t *pY,
+                                    int32_t h,
+                                    const plp_dwt_step_f32 *pStep,
+                                    int32_t inverse) {
+    int32_t o = pStep->offset;
+    float32_t c0 = pStep->c0;
+    float32_t c1 = pStep->c1;
+    int32_t lo = (o < 0) ? -o : 0;           // taps of n < lo wrap to the end
+    int32_t hi = h - ((o >= 0) ? o + 1 : 0); // taps of n >= hi wrap to the start
+    int32_t n;
+
+    if (hi < lo) {
+        hi = lo;
+    }
+
+    if (c1 == 0.0f) {
+        for (n = lo; n < hi; n++) {
+            float32_t t = c0 * pY[n + o];
+            pX[n] = inverse ? pX[n] - t : pX[n] + t;
+        }
+    } else {
+        for (n = lo; n < hi; n++) {
+            float32_t t = c0 * pY[n + o] + c1 * pY[n + o + 1];
+            pX[n] = inverse ? pX[n] - t : pX[n] + t;
+        }
+    }
+
+    for (n = 0; n < lo; n++) {
+        float32_t t = plp_dwt_f32_wrap_tap(pY, h, n + o, c0, c1);
+        pX[n] = inverse ? pX[n] - t : pX[n] + t;
+    }
+    for (n = hi; n < h; n++) {
+        float32_t t = plp_dwt_f32_wrap_tap(pY, h, n + o, c0, c1);
+        pX[n] = inverse ? pX[n] - t : pX[n] + t;
+    }
+}
+
+// splits the first n samples into approximation and detail
+static void plp_dwt_f32_level(float32_t *pX,
+                              uint32_t n,
+                              const plp_dwt_lifting_f32 *pW,
+                              float32_t *pTmp) {
+    int32_t h = n >> 1;
+    float32_t *pS = pTmp;
+    float32_t *pD = pTmp + h;
+    int32_t i;
+    uint32_t k;
+
+    for (i = 0; i < h; i++) {
+        pS[i] = pX[2 * i];
+        pD[i] = pX[2 * i + 1];
+    }
+
+    for (k = 0; k < pW->nSteps; k++) {
+        if (pW->steps[k].update) {
+            plp_dwt_f32_lift(pS, pD, h, &pW->steps[k], 0);
+        } else {
+            plp_dwt_f32_lift(pD, pS, h, &pW->steps[k], 0);
+        }
+    }
+
+    for (i = 0; i < h; i++) {
+        pX[i] = pW->scaleA * pS[i];
+        pX[h + i] = pW->scaleD * pD[i];
+    }
+}
+
+// merges approximation and detail into the first n samples
+static void plp_idwt_f32_level(float32_t *pX,
+                               uint32_t n,
+                               const plp_dwt_lifting_f32 *pW,
+                               float32_t *pTmp) {
+    int32_t h = n >> 1;
+    float32_t *pS = pTmp;
+    float32_t *pD = pTmp + h;
+    int32_t i;
+    uint32_t k;
+
+    for (i = 0; i < h; i++) {
+        pS[i] = pW->invScaleA * pX[i];
+        pD[i] = pW->invScaleD * pX[h + i];
+    }
+
+    for (k = pW->nSteps; k > 0; k--) {
+        if (pW->steps[k - 1].update) {
+            plp_dwt_f32_lift(pS, pD, h, &pW->steps[k - 1], 1);
+        } else {
+            plp_dwt_f32_lift(pD, pS, h, &pW->steps[k - 1], 1);
+        }
+    }
+
+    for (i = 0; i < h; i++) {
+        pX[2 * i] = pS[i];
+        pX[2 * i + 1] = pD[i];
+    }
+}
+
+static void plp_dwt_f32_block(float32_t *pX,
+                              uint32_t blockSize,
+                              plp_dwt_wavelet_t wavelet,
+                              uint32_t nLevels,
+                              float32_t *pTmp) {
+    uint32_t l;
+
+    for (l = 0; l < nLevels; l++) {
+        plp_dwt_f32_level(pX, blockSize >> l, &dwtLiftingTable_f32[wavelet], pTmp);
+    }
+}
+
+static void plp_idwt_f32_block(float32_t *pX,
+                               uint32_t blockSize,
+                               plp_dwt_wavelet_t wavelet,
+                               uint32_t nLevels,
+                               float32_t *pTmp) {
+    uint32_t l;
+
+    for (l = nLevels; l > 0; l--) {
+        plp_idwt_f32_level(pX, blockSize >> (l - 1), &dwtLiftingTable_f32[wavelet], pTmp);
+    }
+}
+
+/**
+ * @ingroup DWT
+ */
+
+/**
+ * @addtogroup DWTKernels
+ * @{
+ */
+
+/**
+ * @brief      Discrete wavelet transform of 32-bit floating-point samples for XPULPV2 extension
+ *
+ * @param[in,out]  pSrcDst    points to the samples, overwritten by the coefficients
+ * @param[in]      blockSize  number of samples, a multiple of 2^nLevels
+ * @param[in]      wavelet    wavelet of the transform
+ * @param[in]      nLevels    number of levels of the decomposition
+ * @param[in]      pTmp       points to a temporary buffer of blockSize values
+ */
+
+void plp_dwt_f32s_xpulpv2(float32_t *pSrcDst,
+                          uint32_t blockSize,
+                          plp_dwt_wavelet_t wavelet,
+                          uint32_t nLevels,
+                          float32_t *pTmp) {
+
+    plp_dwt_f32_block(pSrcDst, blockSize, wavelet, nLevels, pTmp);
+}
+
+/**
+ * @brief      Inverse discrete wavelet transform of 32-bit floating-point samples for XPULPV2
+ *             extension
+ *
+ * @param[in,out]  pSrcDst    points to the coefficients, overwritten by the samples
+ * @param[in]      blockSize  number of samples, a multiple of 2^nLevels
+ * @param[in]      wavelet    wavelet of the transform
+ * @param[in]      nLevels    number of levels of the decomposition
+ * @param[in]      pTmp       points to a temporary buffer of blockSize values
+ */
+
+void plp_idwt_f32s_xpulpv2(float32_t *pSrcDst,
+                           uint32_t blockSize,
+                           plp_dwt_wavelet_t wavelet,
+                           uint32_t nLevels,
+                           float32_t *pTmp) {
+
+    plp_idwt_f32_block(pSrcDst, blockSize, wavelet, nLevels, pTmp);
+}
+
+/**
+ * @brief      Parallel discrete wavelet transform of 32-bit floating-point blocks for XPULPV2
+ *             extension
+ *
+ * @par Parallelization
+ * Every core transforms a chunk of the blocks, using its own blockSize values of the temporary
+ * buffer. The chunks are disjoint, hence no synchronization is needed.
+ *
+ * @param[in]   args    points to the plp_dwt_instance_f32_parallel
+ */
+
+void plp_dwt_f32p_xpulpv2(void *args) {
+    plp_dwt_instance_f32_parallel *a = (plp_dwt_instance_f32_parallel *)args;
+    uint32_t core = rt_core_id();
+    uint32_t start, end, c;
+
+    plp_team_chunk(a->nChannels, a->nPE, core, 1, &start, &end);
+    for (c = start; c < end; c++) {
+        plp_dwt_f32_block(&a->pSrcDst[c * a->blockSize], a->blockSize, a->wavelet, a->nLevels,
+                          &a->pTmp[core * a->blockSize]);
+    }
+}
+
+/**
+ * @brief      Parallel inverse discrete wavelet transform of 32-bit floating-point blocks for
+ *             XPULPV2 extension
+ *
+ * @par Parallelization
+ * Every core transforms a chunk of the blocks, using its own blockSize values of the temporary
+ * buffer. The chunks are disjoint, hence no synchronization is needed.
+ *
+ * @param[in]   args    points to the plp_dwt_instance_f32_parallel
+ */
+
+void plp_idwt_f32p_xpulpv2(void *args) {
+    plp_dwt_instance_f32_parallel *a = (plp_dwt_instance_f32_parallel *)args;
+    uint32_t core = rt_core_id();
+    uint32_t start, end, c;
+
+    plp_team_chunk(a->nChannels, a->nPE, core, 1, &start, &end);
+    for (c = start; c < end; c++) {
+        plp_idwt_f32_block(&a->pSrcDst[c * a->blockSize], a->blockSize, a->wavelet, a->nLevels,
+                           &a->pTmp[core * a->blockSize]);
+    }
+}
+
+/**
+ * @} end of DWTKernels group
+ */
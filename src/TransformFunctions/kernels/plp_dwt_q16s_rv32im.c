@@ -0,0 +1,229 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dwt_q16s_rv32im.c
+ * Description:  Discrete wavelet transform of q16 samples for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+// c0 y0 + c1 y1 with the coefficients in Q2.29, rounded to the nearest
+static inline int32_t plp_dwt_q16_mul(int32_t c0, int32_t y0, int32_t c1, int32_t y1) {
+    return (int32_t)(((int64_t)c0 * y0 + (int64_t)c1 * y1 + (1 << 28)) >> 29);
+}
+
+static inline int16_t plp_dwt_q16_sat(int32_t x) {
+    return (int16_t)((x > INT16_MAX) ? INT16_MAX : (x < INT16_MIN) ? INT16_MIN : x);
+}
+
+// index i modulo h, for the taps at the borders
+static inline int32_t plp_dwt_wrap(int32_t i, int32_t h) {
+    int32_t r = i % h;
+    return (r < 0) ? r + h : r;
+}
+
+// c0 y[i] + c1 y[i + 1] with periodic indices
+static inline int32_t plp_dwt_q16_wrap_tap(
+    const int32_t *pY, int32_t h, int32_t i, int32_t c0, int32_t c1) {
+    return plp_dwt_q16_mul(c0, pY[plp_dwt_wrap(i, h)], c1, pY[plp_dwt_wrap(i + 1, h)]);
+}
+
+// x[n] += c0 y[n + o] + c1 y[n + o + 1] with periodic indices, or -= for the inverse transform
+static inline void plp_dwt_q16_lift(int32_t *pX,
+                                    const int32_t *pY,
+                                    int32_t h,
+                                    const plp_dwt_step_q16 *pStep,
+                                    int32_t inverse) {
+    int32_t o = pStep->offset;
+    int32_t c0 = pStep->c0;
+    int32_t c1 = pStep->c1;
+    int32_t lo = (o < 0) ? -o : 0;           // taps of n < lo wrap to the end
+    int32_t hi = h - ((o >= 0) ? o + 1 : 0); // taps of n >= hi wrap to the start
+    int32_t n;
+
+    if (hi < lo) {
+        hi = lo;
+    }
+
+    if (c1 == 0) {
+        for (n = lo; n < hi; n++) {
+            int32_t t = plp_dwt_q16_mul(c0, pY[n + o], 0, 0);
+            pX[n] = inverse ? pX[n] - t : pX[n] + t;
+        }
+    } else {
+        for (n = lo; n < hi; n++) {
+            int32_t t = plp_dwt_q16_mul(c0, pY[n + o], c1, pY[n + o + 1]);
+            pX[n] = inverse ? pX[n] - t : pX[n] + t;
+        }
+    }
+
+    for (n = 0; n < lo; n++) {
+        int32_t t = plp_dwt_q16_wrap_tap(pY, h, n + o, c0, c1);
+        pX[n] = inverse ? pX[n] - t : pX[n] + t;
+    }
+    for (n = hi; n < h; n++) {
+        int32_t t = plp_dwt_q16_wrap_tap(pY, h, n + o, c0, c1);
+        pX[n] = inverse ? pX[n] - t : pX[n] + t;
+    }
+}
+
+// splits the first n samples into approximation and detail
+static void plp_dwt_q16_level(int16_t *pX,
+                              uint32_t n,
+                              const plp_dwt_lifting_q16 *pW,
+                              int32_t *pTmp) {
+    int32_t h = n >> 1;
+    int32_t *pS = pTmp;
+    int32_t *pD = pTmp + h;
+    int32_t i;
+    uint32_t k;
+
+    for (i = 0; i < h; i++) {
+        pS[i] = pX[2 * i];
+        pD[i] = pX[2 * i + 1];
+    }
+
+    for (k = 0; k < pW->nSteps; k++) {
+        if (pW->steps[k].update) {
+            plp_dwt_q16_lift(pS, pD, h, &pW->steps[k], 0);
+        } else {
+            plp_dwt_q16_lift(pD, pS, h, &pW->steps[k], 0);
+        }
+    }
+
+    for (i = 0; i < h; i++) {
+        pX[i] = plp_dwt_q16_sat(plp_dwt_q16_mul(pW->scaleA, pS[i], 0, 0));
+        pX[h + i] = plp_dwt_q16_sat(plp_dwt_q16_mul(pW->scaleD, pD[i], 0, 0));
+    }
+}
+
+// merges approximation and detail into the first n samples
+static void plp_idwt_q16_level(int16_t *pX,
+                               uint32_t n,
+                               const plp_dwt_lifting_q16 *pW,
+                               int32_t *pTmp) {
+    int32_t h = n >> 1;
+    int32_t *pS = pTmp;
+    int32_t *pD = pTmp + h;
+    int32_t i;
+    uint32_t k;
+
+    for (i = 0; i < h; i++) {
+        pS[i] = plp_dwt_q16_mul(pW->invScaleA, pX[i], 0, 0);
+        pD[i] = plp_dwt_q16_mul(pW->invScaleD, pX[h + i], 0, 0);
+    }
+
+    for (k = pW->nSteps; k > 0; k--) {
+        if (pW->steps[k - 1].update) {
+            plp_dwt_q16_lift(pS, pD, h, &pW->steps[k - 1], 1);
+        } else {
+            plp_dwt_q16_lift(pD, pS, h, &pW->steps[k - 1], 1);
+        }
+    }
+
+    for (i = 0; i < h; i++) {
+        pX[2 * i] = plp_dwt_q16_sat(pS[i]);
+        pX[2 * i + 1] = plp_dwt_q16_sat(pD[i]);
+    }
+}
+
+static void plp_dwt_q16_block(int16_t *pX,
+                              uint32_t blockSize,
+                              plp_dwt_wavelet_t wavelet,
+                              uint32_t nLevels,
+                              int32_t *pTmp) {
+    uint32_t l;
+
+    for (l = 0; l < nLevels; l++) {
+        plp_dwt_q16_level(pX, blockSize >> l, &dwtLiftingTable_q16[wavelet], pTmp);
+    }
+}
+
+static void plp_idwt_q16_block(int16_t *pX,
+                               uint32_t blockSize,
+                               plp_dwt_wavelet_t wavelet,
+                               uint32_t nLevels,
+                               int32_t *pTmp) {
+    uint32_t l;
+
+    for (l = nLevels; l > 0; l--) {
+        plp_idwt_q16_level(pX, blockSize >> (l - 1), &dwtLiftingTable_q16[wavelet], pTmp);
+    }
+}
+
+/**
+ * @ingroup DWT
+ */
+
+/**
+ * @defgroup DWTKernels DWT Kernels
+ */
+
+/**
+ * @addtogroup DWTKernels
+ * @{
+ */
+
+/**
+ * @brief      Discrete wavelet transform of 16-bit fixed-point samples for RV32IM extension
+ *
+ * @param[in,out]  pSrcDst    points to the samples, overwritten by the coefficients
+ * @param[in]      blockSize  number of samples, a multiple of 2^nLevels
+ * @param[in]      wavelet    wavelet of the transform
+ * @param[in]      nLevels    number of levels of the decomposition
+ * @param[in]      pTmp       points to a temporary buffer of blockSize values
+ */
+
+void plp_dwt_q16s_rv32im(int16_t *pSrcDst,
+                         uint32_t blockSize,
+                         plp_dwt_wavelet_t wavelet,
+                         uint32_t nLevels,
+                         int32_t *pTmp) {
+
+    plp_dwt_q16_block(pSrcDst, blockSize, wavelet, nLevels, pTmp);
+}
+
+/**
+ * @brief      Inverse discrete wavelet transform of 16-bit fixed-point samples for RV32IM extension
+ *
+ * @param[in,out]  pSrcDst    points to the coefficients, overwritten by the samples
+ * @param[in]      blockSize  number of samples, a multiple of 2^nLevels
+ * @param[in]      wavelet    wavelet of the transform
+ * @param[in]      nLevels    number of levels of the decomposition
+ * @param[in]      pTmp       points to a temporary buffer of blockSize values
+ */
+
+void plp_idwt_q16s_rv32im(int16_t *pSrcDst,
+                          uint32_t blockSize,
+                          plp_dwt_wavelet_t wavelet,
+                          uint32_t nLevels,
+                          int32_t *pTmp) {
+
+    plp_idwt_q16_block(pSrcDst, blockSize, wavelet, nLevels, pTmp);
+}
+
+/**
+ * @} end of DWTKernels group
+ */
@@ -0,0 +1,151 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel_f32_xpulpv2.c
+ * Description:  Goertzel algorithm on 32-bit floating-point samples for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define PLP_GOERTZEL_F32_STEP4(x)                                                                  \
+    do {                                                                                           \
+        float32_t t0 = x + c0 * a0 - b0;                                                           \
+        float32_t t1 = x + c1 * a1 - b1;                                                           \
+        float32_t t2 = x + c2 * a2 - b2;                                                           \
+        float32_t t3 = x + c3 * a3 - b3;                                                           \
+        b0 = a0;                                                                                   \
+        b1 = a1;                                                                                   \
+        b2 = a2;                                                                                   \
+        b3 = a3;                                                                                   \
+        a0 = t0;                                                                                   \
+        a1 = t1;                                                                                   \
+        a2 = t2;                                                                                   \
+        a3 = t3;                                                                                   \
+    } while (0)
+
+// resonators of the frequencies start .. end-1, four of them per pass over the block
+static inline void process_goertzel_f32(const plp_goertzel_instance_f32 *S,
+                                        const float32_t *pSrc,
+                                        uint32_t blockSize,
+                                        uint32_t start,
+                                        uint32_t end,
+                                        float32_t *pDst) {
+    const float32_t *pC = S->pCoeffs;
+    uint32_t k, n;
+
+    for (k = start; k + 3 < end; k += 4) {
+        float32_t c0 = 2.0f * pC[2 * k];
+        float32_t c1 = 2.0f * pC[2 * k + 2];
+        float32_t c2 = 2.0f * pC[2 * k + 4];
+        float32_t c3 = 2.0f * pC[2 * k + 6];
+        float32_t a0 = 0.0f, a1 = 0.0f, a2 = 0.0f, a3 = 0.0f; // s[n-1]
+        float32_t b0 = 0.0f, b1 = 0.0f, b2 = 0.0f, b3 = 0.0f; // s[n-2]
+
+        for (n = 0; n + 1 < blockSize; n += 2) {
+            float32_t x0 = pSrc[n];
+            float32_t x1 = pSrc[n + 1];
+
+            PLP_GOERTZEL_F32_STEP4(x0);
+            PLP_GOERTZEL_F32_STEP4(x1);
+        }
+        if (n < blockSize) {
+            float32_t x0 = pSrc[n];
+
+            PLP_GOERTZEL_F32_STEP4(x0);
+        }
+
+        // y = exp(jw) s[N-1] - s[N-2]
+        pDst[2 * k] = pC[2 * k] * a0 - b0;
+        pDst[2 * k + 1] = pC[2 * k + 1] * a0;
+        pDst[2 * k + 2] = pC[2 * k + 2] * a1 - b1;
+        pDst[2 * k + 3] = pC[2 * k + 3] * a1;
+        pDst[2 * k + 4] = pC[2 * k + 4] * a2 - b2;
+        pDst[2 * k + 5] = pC[2 * k + 5] * a2;
+        pDst[2 * k + 6] = pC[2 * k + 6] * a3 - b3;
+        pDst[2 * k + 7] = pC[2 * k + 7] * a3;
+    }
+
+    for (; k < end; k++) {
+        float32_t c0 = 2.0f * pC[2 * k];
+        float32_t a0 = 0.0f, b0 = 0.0f;
+
+        for (n = 0; n < blockSize; n++) {
+            float32_t t0 = pSrc[n] + c0 * a0 - b0;
+            b0 = a0;
+            a0 = t0;
+        }
+
+        pDst[2 * k] = pC[2 * k] * a0 - b0;
+        pDst[2 * k + 1] = pC[2 * k + 1] * a0;
+    }
+}
+
+/**
+ * @ingroup Goertzel
+ */
+
+/**
+ * @addtogroup GoertzelKernels
+ * @{
+ */
+
+/**
+ * @brief      Goertzel algorithm on a block of 32-bit floating-point samples for XPULPV2 extension
+ *
+ * @param[in]   S          points to the instance, initialized by plp_goertzel_init_f32
+ * @param[in]   pSrc       points to the block of input samples
+ * @param[in]   blockSize  number of input samples
+ * @param[out]  pDst       points to the output, a complex value {re, im} for every frequency
+ */
+
+void plp_goertzel_f32s_xpulpv2(const plp_goertzel_instance_f32 *S,
+                               const float32_t *pSrc,
+                               uint32_t blockSize,
+                               float32_t *pDst) {
+
+    process_goertzel_f32(S, pSrc, blockSize, 0, S->nBins, pDst);
+}
+
+/**
+ * @brief      Parallel Goertzel algorithm on a block of 32-bit floating-point samples for XPULPV2
+ *             extension
+ *
+ * @par Parallelization
+ * Every core evaluates a chunk of the frequencies over the whole block. The chunks are disjoint,
+ * hence no synchronization is needed.
+ *
+ * @param[in]   args    points to the plp_goertzel_instance_f32_parallel
+ */
+
+void plp_goertzel_f32p_xpulpv2(void *args) {
+    plp_goertzel_instance_f32_parallel *a = (plp_goertzel_instance_f32_parallel *)args;
+    uint32_t start, end;
+
+    plp_team_chunk(a->S->nBins, a->nPE, rt_core_id(), 1, &start, &end);
+    process_goertzel_f32(a->S, a->pSrc, a->blockSize, start, end, a->pDst);
+}
+
+/**
+ * @} end of GoertzelKernels group
+ */
@@ -0,0 +1,161 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel_q32_xpulpv2.c
+ * Description:  Goertzel algorithm on 32-bit fixed-point samples for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// s[n] = x[n] + 2 cos(w) s[n-1] - s[n-2], with cos(w) in Q1.31
+static inline int32_t plp_goertzel_q32_step(int32_t x, int32_t c, int32_t s1, int32_t s2) {
+    return x + (int32_t)(((int64_t)c * s1) >> 30) - s2;
+}
+
+#define PLP_GOERTZEL_Q32_STEP4(x)                                                                  \
+    do {                                                                                           \
+        int32_t t0 = plp_goertzel_q32_step(x, c0, a0, b0);                                         \
+        int32_t t1 = plp_goertzel_q32_step(x, c1, a1, b1);                                         \
+        int32_t t2 = plp_goertzel_q32_step(x, c2, a2, b2);                                         \
+        int32_t t3 = plp_goertzel_q32_step(x, c3, a3, b3);                                         \
+        b0 = a0;                                                                                   \
+        b1 = a1;                                                                                   \
+        b2 = a2;                                                                                   \
+        b3 = a3;                                                                                   \
+        a0 = t0;                                                                                   \
+        a1 = t1;                                                                                   \
+        a2 = t2;                                                                                   \
+        a3 = t3;                                                                                   \
+    } while (0)
+
+// y = exp(jw) s[N-1] - s[N-2] of frequency k
+static inline void plp_goertzel_q32_output(const int32_t *pC,
+                                           uint32_t k,
+                                           int32_t s1,
+                                           int32_t s2,
+                                           int32_t *pDst) {
+    pDst[2 * k] = (int32_t)(((int64_t)pC[2 * k] * s1) >> 31) - s2;
+    pDst[2 * k + 1] = (int32_t)(((int64_t)pC[2 * k + 1] * s1) >> 31);
+}
+
+// resonators of the frequencies start .. end-1, four of them per pass over the block
+static inline void process_goertzel_q32(const plp_goertzel_instance_q32 *S,
+                                        const int32_t *pSrc,
+                                        uint32_t blockSize,
+                                        uint32_t start,
+                                        uint32_t end,
+                                        int32_t *pDst) {
+    const int32_t *pC = S->pCoeffs;
+    uint32_t shift = S->shift;
+    uint32_t k, n;
+
+    for (k = start; k + 3 < end; k += 4) {
+        int32_t c0 = pC[2 * k];
+        int32_t c1 = pC[2 * k + 2];
+        int32_t c2 = pC[2 * k + 4];
+        int32_t c3 = pC[2 * k + 6];
+        int32_t a0 = 0, a1 = 0, a2 = 0, a3 = 0; // s[n-1]
+        int32_t b0 = 0, b1 = 0, b2 = 0, b3 = 0; // s[n-2]
+
+        for (n = 0; n + 1 < blockSize; n += 2) {
+            int32_t x0 = pSrc[n] >> shift;
+            int32_t x1 = pSrc[n + 1] >> shift;
+
+            PLP_GOERTZEL_Q32_STEP4(x0);
+            PLP_GOERTZEL_Q32_STEP4(x1);
+        }
+        if (n < blockSize) {
+            int32_t x0 = pSrc[n] >> shift;
+
+            PLP_GOERTZEL_Q32_STEP4(x0);
+        }
+
+        plp_goertzel_q32_output(pC, k, a0, b0, pDst);
+        plp_goertzel_q32_output(pC, k + 1, a1, b1, pDst);
+        plp_goertzel_q32_output(pC, k + 2, a2, b2, pDst);
+        plp_goertzel_q32_output(pC, k + 3, a3, b3, pDst);
+    }
+
+    for (; k < end; k++) {
+        int32_t c0 = pC[2 * k];
+        int32_t a0 = 0, b0 = 0;
+
+        for (n = 0; n < blockSize; n++) {
+            int32_t t0 = plp_goertzel_q32_step(pSrc[n] >> shift, c0, a0, b0);
+            b0 = a0;
+            a0 = t0;
+        }
+
+        plp_goertzel_q32_output(pC, k, a0, b0, pDst);
+    }
+}
+
+/**
+ * @ingroup Goertzel
+ */
+
+/**
+ * @addtogroup GoertzelKernels
+ * @{
+ */
+
+/**
+ * @brief      Goertzel algorithm on a block of 32-bit fixed-point samples for XPULPV2 extension
+ *
+ * @param[in]   S          points to the instance, initialized by plp_goertzel_init_q32
+ * @param[in]   pSrc       points to the block of input samples
+ * @param[in]   blockSize  number of input samples
+ * @param[out]  pDst       points to the output, a complex value {re, im} for every frequency
+ */
+
+void plp_goertzel_q32s_xpulpv2(const plp_goertzel_instance_q32 *S,
+                               const int32_t *pSrc,
+                               uint32_t blockSize,
+                               int32_t *pDst) {
+
+    process_goertzel_q32(S, pSrc, blockSize, 0, S->nBins, pDst);
+}
+
+/**
+ * @brief      Parallel Goertzel algorithm on a block of 32-bit fixed-point samples for XPULPV2
+ *             extension
+ *
+ * @par Parallelization
+ * Every core evaluates a chunk of the frequencies over the whole block. The chunks are disjoint,
+ * hence no synchronization is needed.
+ *
+ * @param[in]   args    points to the plp_goertzel_instance_q32_parallel
+ */
+
+void plp_goertzel_q32p_xpulpv2(void *args) {
+    plp_goertzel_instance_q32_parallel *a = (plp_goertzel_instance_q32_parallel *)args;
+    uint32_t start, end;
+
+    plp_team_chunk(a->S->nBins, a->nPE, rt_core_id(), 1, &start, &end);
+    process_goertzel_q32(a->S, a->pSrc, a->blockSize, start, end, a->pDst);
+}
+
+/**
+ * @} end of GoertzelKernels group
+ */
@@ -0,0 +1,103 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mdct_q32_xpulpv2.c
+ * Description:  32-bit fixed-point MDCT kernels for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void process_mdct_q32(const plp_dct4_instance_q32 *S,
+                                    const int32_t *pSrc,
+                                    int32_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE);
+
+/**
+ * @ingroup DCT
+ */
+
+/**
+ * @addtogroup DCTKernels
+ * @{
+ */
+
+/**
+ * @brief      MDCT of 32-bit fixed-point data for XPULPV2 extension
+ *
+ * @param[in]   S       points to the instance, initialized by plp_dct4_init_q32
+ * @param[in]   pSrc    points to the input buffer of 2*N values
+ * @param[out]  pDst    points to the output buffer of N values.
+ *                      pDst must not overlap with pSrc.
+ */
+
+void plp_mdct_q32s_xpulpv2(const plp_dct4_instance_q32 *S,
+                           const int32_t *pSrc,
+                           int32_t *pDst) {
+    process_mdct_q32(S, pSrc, pDst, 0, 1);
+}
+
+/**
+ * @brief      Parallel MDCT of 32-bit fixed-point data for XPULPV2 extension
+ *
+ * @par Parallelization
+ * The folding of the input is distributed over the cores, followed by the parallel DCT-IV
+ * plp_dct4_q32p_xpulpv2 in the same team.
+ *
+ * @param[in]   args    points to the plp_mdct_instance_q32_parallel
+ */
+
+void plp_mdct_q32p_xpulpv2(void *args) {
+    plp_mdct_instance_q32_parallel *a = (plp_mdct_instance_q32_parallel *)args;
+
+    process_mdct_q32(a->S, a->pSrc, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+ * @} end of DCTKernels group
+ */
+
+static inline void process_mdct_q32(const plp_dct4_instance_q32 *S,
+                                    const int32_t *pSrc,
+                                    int32_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE) {
+    uint32_t N = S->N;
+    uint32_t n, start, end;
+    plp_dct4_instance_q32_parallel dctArgs = { .S = S, .pSrc = pDst, .nPE = nPE, .pDst = pDst };
+
+    // fold the 2N input samples into N samples, halved such that the sums cannot overflow
+    plp_team_chunk(N / 2, nPE, coreId, 1, &start, &end);
+    for (n = start; n < end; n++) {
+        pDst[n] = (int32_t)(((int64_t)-pSrc[3 * N / 2 - 1 - n] - pSrc[3 * N / 2 + n]) >> 1);
+        pDst[N / 2 + n] = (int32_t)(((int64_t)pSrc[n] - pSrc[N - 1 - n]) >> 1);
+    }
+
+    if (nPE > 1) {
+        plp_team_barrier();
+        plp_dct4_q32p_xpulpv2(&dctArgs);
+    } else {
+        plp_dct4_q32s_xpulpv2(S, pDst, pDst);
+    }
+}
@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mdct_q32s_rv32im.c
+ * Description:  32-bit fixed-point MDCT kernel for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup DCT
+ */
+
+/**
+ * @addtogroup DCTKernels
+ * @{
+ */
+
+/**
+ * @brief      MDCT of 32-bit fixed-point data for RV32IM extension
+ *
+ * @param[in]   S       points to the instance, initialized by plp_dct4_init_q32
+ * @param[in]   pSrc    points to the input buffer of 2*N values
+ * @param[out]  pDst    points to the output buffer of N values.
+ *                      pDst must not overlap with pSrc.
+ *
+ * @par Scaling
+ * The input is in Q1.31, and the output is the transform scaled by 1/2N in Q1.31,
+ * such that it cannot overflow.
+ * @par Algorithm
+ * With the input split into the quarters a, b, c and d of length N/2, the MDCT is the DCT-IV of
+ * (-c_r - d, a - b_r), where _r denotes the reversed order. The folded sequence is written to
+ * pDst, and transformed in-place with the DCT-IV.
+ */
+
+void plp_mdct_q32s_rv32im(const plp_dct4_instance_q32 *S,
+                          const int32_t *pSrc,
+                          int32_t *pDst) {
+    uint32_t N = S->N;
+    uint32_t n;
+
+    // fold the 2N input samples into N samples, halved such that the sums cannot overflow
+    for (n = 0; n < N / 2; n++) {
+        pDst[n] = (int32_t)(((int64_t)-pSrc[3 * N / 2 - 1 - n] - pSrc[3 * N / 2 + n]) >> 1);
+        pDst[N / 2 + n] = (int32_t)(((int64_t)pSrc[n] - pSrc[N - 1 - n]) >> 1);
+    }
+
+    plp_dct4_q32s_rv32im(S, pDst, pDst);
+}
+
+/**
+ * @} end of DCTKernels group
+ */
@@ -0,0 +1,196 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_f32_xpulpv2.c
+ * Description:  MFCC of 32-bit floating-point frames for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// mel energies are limited to this value, such that their logarithm is finite
+#define PLP_MFCC_MIN_ENERGY 1e-30f
+
+static inline void process_mfcc_f32(const plp_mfcc_instance_f32 *S,
+                                    const float32_t *pSrc,
+                                    float32_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE);
+
+/**
+ * @ingroup MFCC
+ */
+
+/**
+ * @addtogroup MFCCKernels
+ * @{
+ */
+
+/**
+ * @brief      MFCC of a frame of 32-bit floating-point samples for XPULPV2 extension
+ *
+ * @param[in]   S       points to the instance, initialized by plp_mfcc_init_f32
+ * @param[in]   pSrc    points to the frame of fftLen samples
+ * @param[out]  pDst    points to the nCoef cepstral coefficients
+ *
+ * @par Real FFT
+ * The frame is transformed with the complex FFT of half the length in place, and the split into
+ * the spectrum of the real frame is fused with the power. Hence, the work buffer holds only the
+ * frame, and not its complex spectrum of twice the size as plp_rfft_f32.
+ */
+
+void plp_mfcc_f32s_xpulpv2(const plp_mfcc_instance_f32 *S,
+                           const float32_t *pSrc,
+                           float32_t *pDst) {
+    process_mfcc_f32(S, pSrc, pDst, 0, 1);
+}
+
+/**
+ * @brief      Parallel MFCC of a frame of 32-bit floating-point samples for XPULPV2 extension
+ *
+ * @par Parallelization
+ * All stages run in this single fork. The window, the split and power, and the log are split
+ * into chunks of the frame, the bins and the mel filters, the complex FFT is
+ * plp_cfft_f32p_xpulpv2, and the mel filters and the cepstral coefficients are distributed over
+ * the cores. There is a barrier between the stages.
+ *
+ * @param[in]   args    points to the plp_mfcc_instance_f32_parallel
+ */
+
+void plp_mfcc_f32p_xpulpv2(void *args) {
+    plp_mfcc_instance_f32_parallel *a = (plp_mfcc_instance_f32_parallel *)args;
+
+    process_mfcc_f32(a->S, a->pSrc, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+ * @} end of MFCCKernels group
+ */
+
+static inline void process_mfcc_f32(const plp_mfcc_instance_f32 *S,
+                                    const float32_t *pSrc,
+                                    float32_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE) {
+    uint32_t N = S->fftLen;
+    uint32_t nMel = S->nMel;
+    uint32_t nCoef = S->nCoef;
+    float32_t *pBuf = S->pBuffer;
+    const float32_t *pWindow = S->pWindow;
+    const float32_t *pW = S->pTwiddle;         // exp(-2j*pi*k/N)
+    const uint16_t *pIndex = S->pMelIndex;
+    float32_t *pEnergy = &pBuf[N];             // mel energies behind the spectrum
+    float32_t *pLog = pBuf;                    // log mel energies overwrite the power
+    uint32_t n, k, m, i, j, len, start, end;
+    plp_cfft_instance_f32_parallel fftArgs = {
+        .S = S->pCfft, .p1 = pBuf, .ifftFlag = 0, .nPE = nPE
+    };
+
+    // window
+    plp_team_chunk(N, nPE, coreId, 1, &start, &end);
+    if (pWindow == NULL) {
+        for (n = start; n < end; n++) {
+            pBuf[n] = pSrc[n];
+        }
+    } else {
+        for (n = start; n < end; n++) {
+            pBuf[n] = pSrc[n] * pWindow[(n <= N / 2) ? n : N - n];
+        }
+    }
+
+    if (nPE > 1) {
+        plp_team_barrier();
+        plp_cfft_f32p_xpulpv2(&fftArgs);
+        plp_team_barrier();
+    } else {
+        plp_cfft_f32s_xpulpv2(S->pCfft, pBuf, 0);
+    }
+
+    // power of bin k into pBuf[2k], bin 0 holds the DC and the (unused) Nyquist component
+    if (coreId == 0) {
+        float32_t dc = pBuf[0] + pBuf[1];
+        pBuf[0] = dc * dc;
+    }
+
+    plp_team_chunk(N / 4, nPE, coreId, 1, &start, &end);
+    for (k = start + 1; k <= end; k++) {
+        float32_t aRe = 0.5f * pBuf[2 * k]; // Z[k] / 2
+        float32_t aIm = 0.5f * pBuf[2 * k + 1];
+        float32_t bRe = 0.5f * pBuf[N - 2 * k]; // Z[N/2-k] / 2
+        float32_t bIm = 0.5f * pBuf[N - 2 * k + 1];
+        float32_t c = pW[2 * k];
+        float32_t s = pW[2 * k + 1];
+
+        // even part (Z[k] + conj(Z[N/2-k])) / 2 and odd part (Z[k] - conj(Z[N/2-k])) / 2j
+        float32_t eRe = aRe + bRe;
+        float32_t eIm = aIm - bIm;
+        float32_t oRe = aIm + bIm;
+        float32_t oIm = bRe - aRe;
+        float32_t tRe = oRe * c + oIm * s;
+        float32_t tIm = oIm * c - oRe * s;
+
+        // X[k] = e + t and X[N/2-k] = conj(e - t)
+        pBuf[2 * k] = (eRe + tRe) * (eRe + tRe) + (eIm + tIm) * (eIm + tIm);
+        pBuf[N - 2 * k] = (eRe - tRe) * (eRe - tRe) + (eIm - tIm) * (eIm - tIm);
+    }
+
+    if (nPE > 1) {
+        plp_team_barrier();
+    }
+
+    plp_team_chunk(nMel, nPE, coreId, 1, &start, &end);
+    for (m = start; m < end; m++) {
+        const float32_t *pP = &pBuf[2 * pIndex[m]];
+        const float32_t *pMel = &S->pMelWeights[pIndex[nMel + m]];
+        float32_t acc = 0.0f;
+
+        len = pIndex[nMel + m + 1] - pIndex[nMel + m];
+        for (i = 0; i < len; i++) {
+            acc += pP[2 * i] * pMel[i];
+        }
+        pEnergy[m] = (acc < PLP_MFCC_MIN_ENERGY) ? PLP_MFCC_MIN_ENERGY : acc;
+    }
+
+    if (nPE > 1) {
+        plp_team_barrier();
+    }
+
+    if (start < end) {
+        plp_log_vec_f32s_xpulpv2(&pEnergy[start], end - start, &pLog[start]);
+    }
+
+    if (nPE > 1) {
+        plp_team_barrier();
+    }
+
+    plp_team_chunk(nCoef, nPE, coreId, 1, &start, &end);
+    for (j = start; j < end; j++) {
+        const float32_t *pD = &S->pDct[j * nMel];
+        float32_t acc = 0.0f;
+
+        for (m = 0; m < nMel; m++) {
+            acc += pD[m] * pLog[m];
+        }
+        pDst[j] = acc;
+    }
+}
@@ -0,0 +1,211 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_q16_xpulpv2.c
+ * Description:  MFCC of 16-bit fixed-point frames for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// the power spectrum in Q2.30 is passed to the 32-bit logarithm as Q6.26, which adds 4*log(2)
+#define PLP_MFCC_LOG_FRAC_BITS 26
+#define PLP_MFCC_LOG_OFFSET 186065280 // 4*log(2) in Q6.26
+
+// mel energy of filter m in Q2.30, at least one
+static inline int32_t plp_mfcc_q16_mel(const plp_mfcc_instance_q16 *S,
+                                       const uint32_t *pPower,
+                                       uint32_t m) {
+    const uint16_t *pIndex = S->pMelIndex;
+    const uint32_t *pP = &pPower[pIndex[m]];
+    const int16_t *pW = &S->pMelWeights[pIndex[S->nMel + m]];
+    uint32_t len = pIndex[S->nMel + m + 1] - pIndex[S->nMel + m];
+    uint32_t i, acc = 0;
+
+    for (i = 0; i < len; i++) {
+        acc += (uint32_t)(((uint64_t)pP[i] * pW[i]) >> 15);
+    }
+
+    if (acc == 0) {
+        acc = 1;
+    } else if (acc > 0x7FFFFFFF) {
+        acc = 0x7FFFFFFF;
+    }
+    return (int32_t)acc;
+}
+
+// cepstral coefficient j with fracBits fractional bits, from the log mel energies in Q6.26
+static inline int32_t plp_mfcc_q16_dct(const plp_mfcc_instance_q16 *S,
+                                       const int32_t *pLog,
+                                       uint32_t j) {
+    const int16_t *pD = &S->pDct[j * S->nMel];
+    uint32_t shift = 15 + PLP_MFCC_LOG_FRAC_BITS - S->fracBits;
+    uint32_t m;
+    int64_t acc = 0;
+
+    for (m = 0; m < S->nMel; m++) {
+        acc += (int64_t)pD[m] * pLog[m];
+    }
+
+    return (int32_t)((acc + (1LL << (shift - 1))) >> shift);
+}
+
+static inline void process_mfcc_q16(const plp_mfcc_instance_q16 *S,
+                                    const int16_t *pSrc,
+                                    int16_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE);
+
+/**
+ * @ingroup MFCC
+ */
+
+/**
+ * @addtogroup MFCCKernels
+ * @{
+ */
+
+/**
+ * @brief      MFCC of a frame of 16-bit fixed-point samples for XPULPV2 extension
+ *
+ * @param[in]   S       points to the instance, initialized by plp_mfcc_init_q16
+ * @param[in]   pSrc    points to the frame of fftLenReal samples
+ * @param[out]  pDst    points to the nCoef cepstral coefficients
+ */
+
+void plp_mfcc_q16s_xpulpv2(const plp_mfcc_instance_q16 *S, const int16_t *pSrc, int16_t *pDst) {
+    process_mfcc_q16(S, pSrc, pDst, 0, 1);
+}
+
+/**
+ * @brief      Parallel MFCC of a frame of 16-bit fixed-point samples for XPULPV2 extension
+ *
+ * @par Parallelization
+ * All stages run in this single fork. The window, the power and the log are split into chunks
+ * of the frame, the bins and the mel filters, the real FFT is plp_rfft_q16p_xpulpv2, and the mel
+ * filters and the cepstral coefficients are distributed over the cores. There is a barrier
+ * between the stages.
+ *
+ * @param[in]   args    points to the plp_mfcc_instance_q16_parallel
+ */
+
+void plp_mfcc_q16p_xpulpv2(void *args) {
+    plp_mfcc_instance_q16_parallel *a = (plp_mfcc_instance_q16_parallel *)args;
+
+    process_mfcc_q16(a->S, a->pSrc, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+ * @} end of MFCCKernels group
+ */
+
+static inline void process_mfcc_q16(const plp_mfcc_instance_q16 *S,
+                                    const int16_t *pSrc,
+                                    int16_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE) {
+    const plp_rfft_instance_q16 *pRfft = S->pRfft;
+    uint32_t N = pRfft->fftLenReal;
+    uint32_t nMel = S->nMel;
+    int16_t *pBuf = S->pBuffer;
+    const int16_t *pWindow = S->pWindow;
+    uint32_t *pPower = (uint32_t *)pBuf;       // power of bin k overwrites bin k
+    int32_t *pEnergy = (int32_t *)&pBuf[N];    // mel energies behind the spectrum
+    int32_t *pLog = (int32_t *)pBuf;           // log mel energies overwrite the power
+    uint32_t n, k, m, j, start, end;
+    int16_t x0, x1, w0, w1;
+    v2s z;
+    plp_rfft_instance_q16_parallel fftArgs = {
+        .S = pRfft, .pSrc = pBuf, .nPE = nPE, .pDst = pBuf
+    };
+
+    // window
+    plp_team_chunk(N, nPE, coreId, 2, &start, &end);
+    if (pWindow == NULL) {
+        for (n = start; n < end; n += 2) {
+            x0 = pSrc[n];
+            x1 = pSrc[n + 1];
+            pBuf[n] = x0;
+            pBuf[n + 1] = x1;
+        }
+    } else {
+        for (n = start; n < end; n += 2) {
+            x0 = pSrc[n];
+            x1 = pSrc[n + 1];
+            w0 = pWindow[(n <= N / 2) ? n : N - n];
+            w1 = pWindow[(n + 1 <= N / 2) ? n + 1 : N - n - 1];
+            pBuf[n] = (x0 * w0) >> 15;
+            pBuf[n + 1] = (x1 * w1) >> 15;
+        }
+    }
+
+    // the parallel real FFT starts with a barrier
+    if (nPE > 1) {
+        plp_rfft_q16p_xpulpv2(&fftArgs);
+        plp_team_barrier();
+    } else {
+        plp_rfft_q16s_xpulpv2(pRfft, pBuf, pBuf);
+    }
+
+    // power, bin 0 holds the DC and the (unused) Nyquist component
+    plp_team_chunk(N / 2, nPE, coreId, 1, &start, &end);
+    if (start == 0 && end > 0) {
+        x0 = pBuf[0];
+        pPower[0] = (uint32_t)(x0 * x0);
+        start = 1;
+    }
+    for (k = start; k < end; k++) {
+        z = *(v2s *)&pBuf[2 * k];
+        pPower[k] = (uint32_t)__DOTP2(z, z);
+    }
+
+    if (nPE > 1) {
+        plp_team_barrier();
+    }
+
+    plp_team_chunk(nMel, nPE, coreId, 1, &start, &end);
+    for (m = start; m < end; m++) {
+        pEnergy[m] = plp_mfcc_q16_mel(S, pPower, m);
+    }
+
+    if (nPE > 1) {
+        plp_team_barrier();
+    }
+
+    if (start < end) {
+        plp_log_vec_q32s_xpulpv2(&pEnergy[start], end - start, PLP_MFCC_LOG_FRAC_BITS,
+                                 &pLog[start]);
+    }
+    for (m = start; m < end; m++) {
+        pLog[m] -= PLP_MFCC_LOG_OFFSET;
+    }
+
+    if (nPE > 1) {
+        plp_team_barrier();
+    }
+
+    plp_team_chunk(S->nCoef, nPE, coreId, 1, &start, &end);
+    for (j = start; j < end; j++) {
+        pDst[j] = __CLIP(plp_mfcc_q16_dct(S, pLog, j), 15);
+    }
+}
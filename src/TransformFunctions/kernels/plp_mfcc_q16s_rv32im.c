@@ -0,0 +1,146 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_q16s_rv32im.c
+ * Description:  MFCC of 16-bit fixed-point frames for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// the power spectrum in Q2.30 is passed to the 32-bit logarithm as Q6.26, which adds 4*log(2)
+#define PLP_MFCC_LOG_FRAC_BITS 26
+#define PLP_MFCC_LOG_OFFSET 186065280 // 4*log(2) in Q6.26
+
+// mel energy of filter m in Q2.30, at least one
+static inline int32_t plp_mfcc_q16_mel(const plp_mfcc_instance_q16 *S,
+                                       const uint32_t *pPower,
+                                       uint32_t m) {
+    const uint16_t *pIndex = S->pMelIndex;
+    const uint32_t *pP = &pPower[pIndex[m]];
+    const int16_t *pW = &S->pMelWeights[pIndex[S->nMel + m]];
+    uint32_t len = pIndex[S->nMel + m + 1] - pIndex[S->nMel + m];
+    uint32_t i, acc = 0;
+
+    for (i = 0; i < len; i++) {
+        acc += (uint32_t)(((uint64_t)pP[i] * pW[i]) >> 15);
+    }
+
+    if (acc == 0) {
+        acc = 1;
+    } else if (acc > 0x7FFFFFFF) {
+        acc = 0x7FFFFFFF;
+    }
+    return (int32_t)acc;
+}
+
+// cepstral coefficient j with fracBits fractional bits, from the log mel energies in Q6.26
+static inline int32_t plp_mfcc_q16_dct(const plp_mfcc_instance_q16 *S,
+                                       const int32_t *pLog,
+                                       uint32_t j) {
+    const int16_t *pD = &S->pDct[j * S->nMel];
+    uint32_t shift = 15 + PLP_MFCC_LOG_FRAC_BITS - S->fracBits;
+    uint32_t m;
+    int64_t acc = 0;
+
+    for (m = 0; m < S->nMel; m++) {
+        acc += (int64_t)pD[m] * pLog[m];
+    }
+
+    return (int32_t)((acc + (1LL << (shift - 1))) >> shift);
+}
+
+/**
+ * @ingroup MFCC
+ */
+
+/**
+ * @defgroup MFCCKernels MFCC Kernels
+ * Kernels of the fused MFCC.
+ */
+
+/**
+ * @addtogroup MFCCKernels
+ * @{
+ */
+
+/**
+ * @brief      MFCC of a frame of 16-bit fixed-point samples for RV32IM
+ *
+ * @param[in]   S       points to the instance, initialized by plp_mfcc_init_q16
+ * @param[in]   pSrc    points to the frame of fftLenReal samples
+ * @param[out]  pDst    points to the nCoef cepstral coefficients
+ */
+
+void plp_mfcc_q16s_rv32im(const plp_mfcc_instance_q16 *S, const int16_t *pSrc, int16_t *pDst) {
+    const plp_rfft_instance_q16 *pRfft = S->pRfft;
+    uint32_t N = pRfft->fftLenReal;
+    uint32_t nMel = S->nMel;
+    int16_t *pBuf = S->pBuffer;
+    const int16_t *pWindow = S->pWindow;
+    uint32_t *pPower = (uint32_t *)pBuf;       // power of bin k overwrites bin k
+    int32_t *pEnergy = (int32_t *)&pBuf[N];    // mel energies behind the spectrum
+    int32_t *pLog = (int32_t *)pBuf;           // log mel energies overwrite the power
+    uint32_t n, k, m, j;
+    int32_t re, im, c;
+
+    // window
+    if (pWindow == NULL) {
+        for (n = 0; n < N; n++) {
+            pBuf[n] = pSrc[n];
+        }
+    } else {
+        for (n = 0; n < N; n++) {
+            pBuf[n] = (pSrc[n] * pWindow[(n <= N / 2) ? n : N - n]) >> 15;
+        }
+    }
+
+    plp_rfft_q16s_rv32im(pRfft, pBuf, pBuf);
+
+    // power, bin 0 holds the DC and the (unused) Nyquist component
+    re = pBuf[0];
+    pPower[0] = (uint32_t)(re * re);
+    for (k = 1; k < N / 2; k++) {
+        re = pBuf[2 * k];
+        im = pBuf[2 * k + 1];
+        pPower[k] = (uint32_t)(re * re) + (uint32_t)(im * im);
+    }
+
+    for (m = 0; m < nMel; m++) {
+        pEnergy[m] = plp_mfcc_q16_mel(S, pPower, m);
+    }
+
+    plp_log_vec_q32s_rv32im(pEnergy, nMel, PLP_MFCC_LOG_FRAC_BITS, pLog);
+    for (m = 0; m < nMel; m++) {
+        pLog[m] -= PLP_MFCC_LOG_OFFSET;
+    }
+
+    for (j = 0; j < S->nCoef; j++) {
+        c = plp_mfcc_q16_dct(S, pLog, j);
+        pDst[j] = (c > 0x7FFF) ? 0x7FFF : (c < -0x8000) ? -0x8000 : c;
+    }
+}
+
+/**
+ * @} end of MFCCKernels group
+ */
@@ -35,18 +35,28 @@
 int bit_rev_radix2(int index, int log2FFTLen);
 static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B);
 static inline Complex_type_f32 complex_mul_real(float32_t A, Complex_type_f32 B);
-static inline void process_butterfly_real_radix2(const float32_t *input,
+static inline void
+process_butterfly_last_radix2(Complex_type_f32 *input, Complex_type_f32 *output, int outindex);
+static inline Complex_type_f32 twiddle_radix4(Complex_type_f32 *twiddle_ptr, int index, int half);
+static inline void process_butterfly_real_radix4(const float32_t *input,
+                                                 int input_stride,
                                                  Complex_type_f32 *output,
                                                  int twiddle_index,
                                                  int distance,
-                                                 Complex_type_f32 *twiddle_ptr);
-static inline void process_butterfly_radix2(Complex_type_f32 *input,
+                                                 Complex_type_f32 *twiddle_ptr,
+                                                 int half,
+                                                 const float32_t *window);
+static inline void process_butterfly_radix4(Complex_type_f32 *input,
                                             int twiddle_index,
-                                            int index,
                                             int distance,
-                                            Complex_type_f32 *twiddle_ptr);
-static inline void
-process_butterfly_last_radix2(Complex_type_f32 *input, Complex_type_f32 *output, int outindex);
+                                            Complex_type_f32 *twiddle_ptr,
+                                            int half);
+static inline void process_rfft_radix4(const plp_rfft_instance_f32 *S,
+                                       const float32_t *pWindow,
+                                       const float32_t *pSrc,
+                                       float32_t *pDst,
+                                       int core_id,
+                                       int nPE);
 
 /**
   @ingroup fft
@@ -55,7 +65,7 @@ process_butterfly_last_radix2(Complex_type_f32 *input, Complex_type_f32 *output,
 /**
   @defgroup fftKernels FFT Kernels
   These kernels calculate the FFT transform on the input data.
-  Supported algorithms: radix-2
+  Supported algorithms: radix-2, radix-4 (radix-2^2)
 */
 
 /**
@@ -67,239 +77,75 @@ process_butterfly_last_radix2(Complex_type_f32 *input, Complex_type_f32 *output,
    @brief  Floating-point FFT on real input data for XPULPV2 extension.
    @param[in]   S       points to an instance of the floating-point FFT structure
    @param[in]   pSrc    points to the input buffer (real data)
-   @param[out]  pDst    points to the output buffer (complex data)
+   @param[out]  pDst    points to the output buffer (complex data), may be equal to pSrc
    @return      none
-*/
-void plp_rfft_f32_xpulpv2(const plp_rfft_instance_f32 *S,
-                          const float32_t *__restrict__ pSrc,
-                          float32_t *__restrict__ pDst) {
-
-    int k, j, stage, step, d, index;
 
-    Complex_type_f32 temp;
-    int dist = S->FFTLength >> 1;
-    int nbutterfly = S->FFTLength >> 1;
-    int butt = 2; // number of butterflies in the same group
-
-    const float32_t *_in_ptr_real;
-    Complex_type_f32 *_in_ptr;
-    Complex_type_f32 *_out_ptr;
-    Complex_type_f32 *_tw_ptr;
-
-    // FIRST STAGE, input is real, stage=1
-    stage = 1;
-
-    _in_ptr_real = pSrc;
-    _in_ptr = (Complex_type_f32 *)pDst;
-    _tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
-
-    for (j = 0; j < nbutterfly; j++) {
-        process_butterfly_real_radix2(_in_ptr_real, _in_ptr, j, dist, _tw_ptr);
-        _in_ptr_real++;
-        _in_ptr++;
-    } // j
-
-    stage = stage + 1;
-    dist = dist >> 1;
-
-    // STAGES 2 -> n-1
-    while (dist > 1) {
-        step = dist << 1;
-        for (j = 0; j < butt; j++) {
-            _in_ptr = (Complex_type_f32 *)pDst;
-            for (d = 0; d < dist; d++) {
-                process_butterfly_radix2(_in_ptr, d * butt, j * step, dist, _tw_ptr);
-                _in_ptr++;
-            } // d
-        }     // j
-        stage = stage + 1;
-        dist = dist >> 1;
-        butt = butt << 1;
-    }
+   @par Radix-4 Stages
+   Two consecutive radix-2 stages are merged into one radix-4 (radix-2^2) stage, which halves the
+   number of passes over the data. If log2(FFTLength) is odd, the last stage is a radix-2 stage.
+   The output order is the same as with radix-2 stages only. FFTLength must be a power of two, and
+   at least 4.
 
-    // LAST STAGE
-    _in_ptr = (Complex_type_f32 *)pDst;
-    index = 0;
-    for (j = 0; j < (S->FFTLength >> 1); j++) {
-        process_butterfly_last_radix2(_in_ptr, (Complex_type_f32 *)pDst, index);
-        _in_ptr += 2;
-        index += 2;
-    } // j
+   @par In-place
+   pDst may be equal to pSrc, if the buffer holds the 2 * FFTLength values of the output. This
+   costs one more pass over the input, and log2(FFTLength) more barriers in the parallel version.
+*/
+void plp_rfft_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                          const float32_t *pSrc,
+                          float32_t *pDst) {
 
-    // ORDER VALUES
-    if (S->bitReverseFlag) {
-        int index1, index2, index3, index4;
-        _out_ptr = (Complex_type_f32 *)pDst;
-        for (j = 0; j < S->FFTLength; j += 4) {
-            if (S->pBitReverseLUT) {
-                unsigned int index12 = *((unsigned int *)(&S->pBitReverseLUT[j]));
-                unsigned int index34 = *((unsigned int *)(&S->pBitReverseLUT[j + 2]));
-                index1 = index12 & 0x0000FFFF;
-                index2 = index12 >> 16;
-                index3 = index34 & 0x0000FFFF;
-                index4 = index34 >> 16;
-            } else {
-                int log2FFTLen = log2(S->FFTLength);
-                index1 = bit_rev_radix2(j, log2FFTLen);
-                index2 = bit_rev_radix2(j + 1, log2FFTLen);
-                index3 = bit_rev_radix2(j + 2, log2FFTLen);
-                index4 = bit_rev_radix2(j + 3, log2FFTLen);
-            }
-            if (index1 > j) {
-                temp = _out_ptr[j];
-                _out_ptr[j] = _out_ptr[index1];
-                _out_ptr[index1] = temp;
-            }
-            if (index2 > j + 1) {
-                temp = _out_ptr[j + 1];
-                _out_ptr[j + 1] = _out_ptr[index2];
-                _out_ptr[index2] = temp;
-            }
-            if (index3 > j + 2) {
-                temp = _out_ptr[j + 2];
-                _out_ptr[j + 2] = _out_ptr[index3];
-                _out_ptr[index3] = temp;
-            }
-            if (index4 > j + 3) {
-                temp = _out_ptr[j + 3];
-                _out_ptr[j + 3] = _out_ptr[index4];
-                _out_ptr[index4] = temp;
-            }
-        }
-    }
+    process_rfft_radix4(S, NULL, pSrc, pDst, 0, 1);
 }
 
 /**
    @brief  Floating-point FFT on real input data for XPULPV2 extension.
    @param[in]   arg      points to an instance of the floating-point FFT structure
    @return      none
+
+   @par Parallelization
+   Every stage consists of FFTLength / 4 radix-4 butterflies (FFTLength / 2 radix-2 butterflies in
+   the last stage), which are distributed in an interleaved way over the cores. Hence, any number
+   of cores can be used, and a barrier is only needed after each stage, which amounts to about
+   log4(FFTLength) barriers.
 */
 void plp_rfft_f32_xpulpv2_parallel(plp_rfft_parallel_arg_f32 *arg) {
 
-    int k, j, stage, step, d, index;
-
-    plp_rfft_instance_f32 *S = arg->S;
-    const float32_t *pSrc = arg->pSrc;
-    const uint32_t nPE = arg->nPE;
-    float32_t *pDst = arg->pDst;
+    process_rfft_radix4(arg->S, NULL, arg->pSrc, arg->pDst, rt_core_id(), arg->nPE);
+}
 
-    Complex_type_f32 temp;
-    int dist = S->FFTLength >> 1;
-    int nbutterfly = S->FFTLength >> 1;
-    int butt = 2; // number of butterflies in the same group
-
-    const float32_t *_in_ptr_real;
-    Complex_type_f32 *_in_ptr;
-    Complex_type_f32 *_out_ptr;
-    Complex_type_f32 *_tw_ptr;
-
-    int core_id = rt_core_id();
-
-    // FIRST STAGE, input is real, stage=1
-    stage = 1;
-    _in_ptr_real = &pSrc[core_id];
-    _in_ptr = (Complex_type_f32 *)&pDst[2 * core_id];
-    _tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
-
-    for (j = 0; j < nbutterfly / nPE; j++) {
-        process_butterfly_real_radix2(_in_ptr_real, _in_ptr, j * nPE + core_id, dist, _tw_ptr);
-        _in_ptr_real += nPE;
-        _in_ptr += nPE;
-    } // j
-
-    stage = stage + 1;
-    dist = dist >> 1;
-
-    // STAGES 2 -> n-1
-    while (dist > nPE / 2) {
-        rt_team_barrier();
-        step = dist << 1;
-        for (j = 0; j < butt; j++) {
-            _in_ptr = (Complex_type_f32 *)&pDst[2 * core_id];
-            for (d = 0; d < dist / nPE; d++) {
-                process_butterfly_radix2(_in_ptr, (d * nPE + core_id) * butt, j * step, dist,
-                                         _tw_ptr);
-                _in_ptr += nPE;
-            } // d
-        }     // j
-        stage = stage + 1;
-        dist = dist >> 1;
-        butt = butt << 1;
-    }
+/**
+   @brief  Windowed floating-point FFT on real input data for XPULPV2 extension.
+   @param[in]   S        points to an instance of the floating-point FFT structure
+   @param[in]   pWindow  points to the first half of the window, PLP_WINDOW_LEN(FFTLength) values
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[out]  pDst     points to the output buffer (complex data), may be equal to pSrc
+   @return      none
 
-    while (dist > 1) {
-        rt_team_barrier();
-        step = dist << 1;
-        for (j = 0; j < butt / nPE; j++) {
-            _in_ptr = _in_ptr = (Complex_type_f32 *)pDst;
-            ;
-            for (d = 0; d < dist; d++) {
-                process_butterfly_radix2(_in_ptr, butt * d, (j * nPE + core_id) * step, dist,
-                                         _tw_ptr);
-                _in_ptr++;
-            } // d
-        }     // j
-        stage = stage + 1;
-        dist = dist >> 1;
-        butt = butt << 1;
-    }
+   @par Window
+   The input is multiplied with the window when it is read by the first radix-4 stage, such that
+   no separate pass over the input (and no buffer for the windowed input) is needed.
+*/
+void plp_rfft_windowed_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                                   const float32_t *__restrict__ pWindow,
+                                   const float32_t *pSrc,
+                                   float32_t *pDst) {
 
-    rt_team_barrier();
+    process_rfft_radix4(S, pWindow, pSrc, pDst, 0, 1);
+}
 
-    // LAST STAGE
-    _in_ptr = (Complex_type_f32 *)&pDst[4 * core_id];
-    index = 2 * core_id;
-    for (j = 0; j < S->FFTLength / (2 * nPE); j++) {
-        process_butterfly_last_radix2(_in_ptr, (Complex_type_f32 *)pDst, index);
-        _in_ptr += 2 * nPE;
-        index += 2 * nPE;
-    } // j
+/**
+   @brief  Windowed floating-point FFT on real input data for XPULPV2 extension (parallel version).
+   @param[in]   args     points to the plp_rfft_windowed_parallel_arg_f32
+   @return      none
 
-    rt_team_barrier();
+   @par Parallelization
+   Same as plp_rfft_f32_xpulpv2_parallel, the window is applied in the first stage.
+*/
+void plp_rfft_windowed_f32_xpulpv2_parallel(void *args) {
 
-    // ORDER VALUES
-    if (S->bitReverseFlag) {
+    plp_rfft_windowed_parallel_arg_f32 *a = (plp_rfft_windowed_parallel_arg_f32 *)args;
 
-        int index1, index2, index3, index4;
-        _out_ptr = (Complex_type_f32 *)pDst;
-        for (j = 4 * core_id; j < S->FFTLength; j += nPE * 4) {
-            if (S->pBitReverseLUT) {
-                unsigned int index12 = *((unsigned int *)(&S->pBitReverseLUT[j]));
-                unsigned int index34 = *((unsigned int *)(&S->pBitReverseLUT[j + 2]));
-                index1 = index12 & 0x0000FFFF;
-                index2 = index12 >> 16;
-                index3 = index34 & 0x0000FFFF;
-                index4 = index34 >> 16;
-            } else {
-                int log2FFTLen = log2(S->FFTLength);
-                index1 = bit_rev_radix2(j, log2FFTLen);
-                index2 = bit_rev_radix2(j + 1, log2FFTLen);
-                index3 = bit_rev_radix2(j + 2, log2FFTLen);
-                index4 = bit_rev_radix2(j + 3, log2FFTLen);
-            }
-            if (index1 > j) {
-                temp = _out_ptr[j];
-                _out_ptr[j] = _out_ptr[index1];
-                _out_ptr[index1] = temp;
-            }
-            if (index2 > j + 1) {
-                temp = _out_ptr[j + 1];
-                _out_ptr[j + 1] = _out_ptr[index2];
-                _out_ptr[index2] = temp;
-            }
-            if (index3 > j + 2) {
-                temp = _out_ptr[j + 2];
-                _out_ptr[j + 2] = _out_ptr[index3];
-                _out_ptr[index3] = temp;
-            }
-            if (index4 > j + 3) {
-                temp = _out_ptr[j + 3];
-                _out_ptr[j + 3] = _out_ptr[index4];
-                _out_ptr[index4] = temp;
-            }
-        }
-        rt_team_barrier();
-    }
+    process_rfft_radix4(a->S, a->pWindow, a->pSrc, a->pDst, rt_core_id(), a->nPE);
 }
 
 /**
@@ -336,78 +182,257 @@ static inline Complex_type_f32 complex_mul_real(float32_t A, Complex_type_f32 B)
     return result;
 }
 
-static inline void process_butterfly_real_radix2(const float32_t *input,
-                                                 Complex_type_f32 *output,
-                                                 int twiddle_index,
-                                                 int distance,
-                                                 Complex_type_f32 *twiddle_ptr) {
+static inline void
+process_butterfly_last_radix2(Complex_type_f32 *input, Complex_type_f32 *output, int outindex) {
 
     int index = 0;
-    float32_t d0 = input[index];
-    float32_t d1 = input[index + distance];
-
     Complex_type_f32 r0, r1;
-
-    // Re(c1*c2) = c1.re*c2.re - c1.im*c2.im, since c1 is real = c1.re*c2.re
+    float32_t d0 = input[index].re;
+    float32_t d1 = input[index + 1].re;
+    float32_t e0 = input[index].im;
+    float32_t e1 = input[index + 1].im;
+    // Re(c1*c2) = c1.re*c2.re - c1.im*c2.im
     r0.re = d0 + d1;
-    r0.im = 0.0f;
     r1.re = d0 - d1;
 
-    Complex_type_f32 tw0 = twiddle_ptr[twiddle_index];
+    // Im(c1*c2) = c1.re*c2.im + c1.im*c2.re
 
-    output[index] = r0;
-    // printf("%f %f\n", r0.re, r0.im);
-    output[index + distance] = complex_mul_real(r1.re, tw0);
-}
+    r0.im = e0 + e1;
+    r1.im = e0 - e1;
 
-static inline void process_butterfly_radix2(Complex_type_f32 *input,
-                                            int twiddle_index,
-                                            int index,
-                                            int distance,
-                                            Complex_type_f32 *twiddle_ptr) {
+    /* In the Last step, twiddle factors are all 1 */
+    output[outindex] = r0;
+    output[outindex + 1] = r1;
+}
 
-    Complex_type_f32 r0, r1;
+static inline Complex_type_f32 twiddle_radix4(Complex_type_f32 *twiddle_ptr, int index, int half) {
 
-    float32_t d0 = input[index].re;
-    float32_t d1 = input[index + distance].re;
-    float32_t e0 = input[index].im;
-    float32_t e1 = input[index + distance].im;
+    // the table only holds W^k for k < N/2, and W^(k + N/2) = -W^k
+    if (index < half) {
+        return twiddle_ptr[index];
+    }
 
-    // Re(c1*c2) = c1.re*c2.re - c1.im*c2.im
+    Complex_type_f32 result = twiddle_ptr[index - half];
+    result.re = -result.re;
+    result.im = -result.im;
+    return result;
+}
 
-    r0.re = d0 + d1;
-    r1.re = d0 - d1;
+static inline void process_butterfly_real_radix4(const float32_t *input,
+                                                 int input_stride,
+                                                 Complex_type_f32 *output,
+                                                 int twiddle_index,
+                                                 int distance,
+                                                 Complex_type_f32 *twiddle_ptr,
+                                                 int half,
+                                                 const float32_t *window) {
+
+    float32_t x0 = input[0];
+    float32_t x1 = input[distance * input_stride];
+    float32_t x2 = input[2 * distance * input_stride];
+    float32_t x3 = input[3 * distance * input_stride];
+
+    // the first stage reads the samples t + {0, 1, 2, 3} * N/4, and the half window holds
+    // w[n] = w[N - n] for n > N/2
+    if (window != NULL) {
+        x0 *= window[twiddle_index];
+        x1 *= window[twiddle_index + distance];
+        x2 *= window[2 * distance - twiddle_index];
+        x3 *= window[distance - twiddle_index];
+    }
 
-    // Im(c1*c2) = c1.re*c2.im + c1.im*c2.re
+    // first radix-2 stage (pairs x0, x2 and x1, x3), where W^(N/4) = -j is applied to x1 - x3
+    float32_t t0 = x0 + x2;
+    float32_t t1 = x1 + x3;
+    float32_t t2 = x0 - x2;
+    float32_t u = x1 - x3;
 
-    r0.im = e0 + e1;
-    r1.im = e0 - e1;
+    Complex_type_f32 r0, r2, r3;
 
-    Complex_type_f32 tw0 = twiddle_ptr[twiddle_index];
+    // second radix-2 stage (pairs t0, t1 and t2, -j * u)
+    r0.re = t0 + t1;
+    r0.im = 0.0f;
+    r2.re = t2;
+    r2.im = -u;
+    r3.re = t2;
+    r3.im = u;
+
+    Complex_type_f32 tw1 = twiddle_radix4(twiddle_ptr, twiddle_index, half);
+    Complex_type_f32 tw2 = twiddle_radix4(twiddle_ptr, 2 * twiddle_index, half);
+    Complex_type_f32 tw3 = twiddle_radix4(twiddle_ptr, 3 * twiddle_index, half);
+
+    output[0] = r0;
+    output[distance] = complex_mul_real(t0 - t1, tw2);
+    output[2 * distance] = complex_mul(tw1, r2);
+    output[3 * distance] = complex_mul(tw3, r3);
+}
 
-    input[index] = r0;
-    input[index + distance] = complex_mul(tw0, r1);
+static inline void process_butterfly_radix4(Complex_type_f32 *input,
+                                            int twiddle_index,
+                                            int distance,
+                                            Complex_type_f32 *twiddle_ptr,
+                                            int half) {
+
+    Complex_type_f32 x0 = input[0];
+    Complex_type_f32 x1 = input[distance];
+    Complex_type_f32 x2 = input[2 * distance];
+    Complex_type_f32 x3 = input[3 * distance];
+
+    Complex_type_f32 t0, t1, t2, t3, r;
+
+    // first radix-2 stage (pairs x0, x2 and x1, x3), where W^(N/4) = -j is applied to x1 - x3
+    t0.re = x0.re + x2.re;
+    t0.im = x0.im + x2.im;
+    t1.re = x1.re + x3.re;
+    t1.im = x1.im + x3.im;
+    t2.re = x0.re - x2.re;
+    t2.im = x0.im - x2.im;
+    t3.re = x1.im - x3.im;
+    t3.im = x3.re - x1.re;
+
+    Complex_type_f32 tw1 = twiddle_radix4(twiddle_ptr, twiddle_index, half);
+    Complex_type_f32 tw2 = twiddle_radix4(twiddle_ptr, 2 * twiddle_index, half);
+    Complex_type_f32 tw3 = twiddle_radix4(twiddle_ptr, 3 * twiddle_index, half);
+
+    // second radix-2 stage (pairs t0, t1 and t2, t3)
+    r.re = t0.re + t1.re;
+    r.im = t0.im + t1.im;
+    input[0] = r;
+
+    r.re = t0.re - t1.re;
+    r.im = t0.im - t1.im;
+    input[distance] = complex_mul(tw2, r);
+
+    r.re = t2.re + t3.re;
+    r.im = t2.im + t3.im;
+    input[2 * distance] = complex_mul(tw1, r);
+
+    r.re = t2.re - t3.re;
+    r.im = t2.im - t3.im;
+    input[3 * distance] = complex_mul(tw3, r);
 }
 
-static inline void
-process_butterfly_last_radix2(Complex_type_f32 *input, Complex_type_f32 *output, int outindex) {
+static inline void process_rfft_radix4(const plp_rfft_instance_f32 *S,
+                                       const float32_t *pWindow,
+                                       const float32_t *pSrc,
+                                       float32_t *pDst,
+                                       int core_id,
+                                       int nPE) {
 
-    int index = 0;
-    Complex_type_f32 r0, r1;
-    float32_t d0 = input[index].re;
-    float32_t d1 = input[index + 1].re;
-    float32_t e0 = input[index].im;
-    float32_t e1 = input[index + 1].im;
-    // Re(c1*c2) = c1.re*c2.re - c1.im*c2.im
-    r0.re = d0 + d1;
-    r1.re = d0 - d1;
+    int j, t;
 
-    // Im(c1*c2) = c1.re*c2.im + c1.im*c2.re
+    int N = S->FFTLength;
+    int half = N >> 1;
+    int log2FFTLen = log2(N);
 
-    r0.im = e0 + e1;
-    r1.im = e0 - e1;
+    Complex_type_f32 temp;
+    Complex_type_f32 *_out_ptr = (Complex_type_f32 *)pDst;
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
+
+    // Every radix-4 butterfly t works on the elements base + {0, 1, 2, 3} * dist, where the groups
+    // of the current stage are 4 * dist elements long. The twiddle factors of the merged stages are
+    // W^(i * step), W^(2 * i * step) and W^(3 * i * step), with i the index inside the group.
+    int log2dist = log2FFTLen - 2;
+    int dist = 1 << log2dist;
+    int step = 1;
+
+    // IN-PLACE, the first stage would overwrite samples of other butterflies. Hence, the sample n
+    // is first moved to the real part of the output element n, such that every butterfly of the
+    // first stage reads and writes the same elements. The upper half of the samples is moved
+    // first, which never overwrites samples that are still to be moved.
+    int in_stride = 1;
+    if ((const float32_t *)pDst == pSrc) {
+        for (int len = half; len > 0; len >>= 1) {
+            for (j = len + core_id; j < 2 * len; j += nPE) {
+                _out_ptr[j].re = pSrc[j];
+            }
+            if (nPE > 1) {
+                rt_team_barrier();
+            }
+        }
+        in_stride = 2;
+    }
 
-    /* In the Last step, twiddle factors are all 1 */
-    output[outindex] = r0;
-    output[outindex + 1] = r1;
+    // FIRST STAGE, input is real (and multiplied with the window, if any)
+    for (t = core_id; t < (N >> 2); t += nPE) {
+        process_butterfly_real_radix4(&pSrc[t * in_stride], in_stride, &_out_ptr[t], t, dist,
+                                      _tw_ptr, half, pWindow);
+    }
+
+    log2dist -= 2;
+    dist >>= 2;
+    step <<= 2;
+
+    // RADIX-4 STAGES
+    while (log2dist >= 0) {
+        if (nPE > 1) {
+            rt_team_barrier();
+        }
+        for (t = core_id; t < (N >> 2); t += nPE) {
+            int i = t & (dist - 1);
+            int base = ((t >> log2dist) << (log2dist + 2)) + i;
+            process_butterfly_radix4(&_out_ptr[base], i * step, dist, _tw_ptr, half);
+        }
+        log2dist -= 2;
+        dist >>= 2;
+        step <<= 2;
+    }
+
+    // LAST STAGE, only if log2(N) is odd
+    if (log2dist == -1) {
+        if (nPE > 1) {
+            rt_team_barrier();
+        }
+        for (j = core_id; j < half; j += nPE) {
+            process_butterfly_last_radix2(&_out_ptr[2 * j], _out_ptr, 2 * j);
+        }
+    }
+
+    // ORDER VALUES
+    if (S->bitReverseFlag) {
+        if (nPE > 1) {
+            rt_team_barrier();
+        }
+
+        int index1, index2, index3, index4;
+        for (j = 4 * core_id; j < N; j += nPE * 4) {
+            if (S->pBitReverseLUT) {
+                unsigned int index12 = *((unsigned int *)(&S->pBitReverseLUT[j]));
+                unsigned int index34 = *((unsigned int *)(&S->pBitReverseLUT[j + 2]));
+                index1 = index12 & 0x0000FFFF;
+                index2 = index12 >> 16;
+                index3 = index34 & 0x0000FFFF;
+                index4 = index34 >> 16;
+            } else {
+                index1 = bit_rev_radix2(j, log2FFTLen);
+                index2 = bit_rev_radix2(j + 1, log2FFTLen);
+                index3 = bit_rev_radix2(j + 2, log2FFTLen);
+                index4 = bit_rev_radix2(j + 3, log2FFTLen);
+            }
+            if (index1 > j) {
+                temp = _out_ptr[j];
+                _out_ptr[j] = _out_ptr[index1];
+                _out_ptr[index1] = temp;
+            }
+            if (index2 > j + 1) {
+                temp = _out_ptr[j + 1];
+                _out_ptr[j + 1] = _out_ptr[index2];
+                _out_ptr[index2] = temp;
+            }
+            if (index3 > j + 2) {
+                temp = _out_ptr[j + 2];
+                _out_ptr[j + 2] = _out_ptr[index3];
+                _out_ptr[index3] = temp;
+            }
+            if (index4 > j + 3) {
+                temp = _out_ptr[j + 3];
+                _out_ptr[j + 3] = _out_ptr[index4];
+                _out_ptr[index4] = temp;
+            }
+        }
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
 }
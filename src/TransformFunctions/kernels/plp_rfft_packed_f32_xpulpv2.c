@@ -0,0 +1,141 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_packed_f32_xpulpv2.c
+ * Description:  Floating-point FFT on real input data with packed output for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void process_rfft_packed_f32(const plp_rfft_instance_f32 *S,
+                                           const float32_t *pSrc,
+                                           float32_t *pDst,
+                                           int core_id,
+                                           int nPE);
+
+/**
+   @ingroup fft
+ */
+
+/**
+   @addtogroup fftKernels
+   @{
+*/
+
+/**
+   @brief  Floating-point FFT on real input data with packed output for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (real data)
+   @param[out]  pDst    points to the output buffer (packed complex data), may be equal to pSrc
+   @return      none
+*/
+void plp_rfft_packed_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                                 const float32_t *pSrc,
+                                 float32_t *pDst) {
+
+    process_rfft_packed_f32(S, pSrc, pDst, 0, 1);
+}
+
+/**
+   @brief  Floating-point FFT on real input data with packed output for XPULPV2 extension
+           (parallel version).
+   @param[in]   args     points to the plp_rfft_parallel_arg_f32
+   @return      none
+
+   @par Parallelization
+   The copy of the input, the complex FFT of half the length and the bit reversal are distributed
+   as in plp_cfft_f32p_xpulpv2. The pairs of bins (k, N/2 - k) of the split step are independent,
+   and are distributed in an interleaved way over the cores.
+*/
+void plp_rfft_packed_f32_xpulpv2_parallel(void *args) {
+
+    plp_rfft_parallel_arg_f32 *a = (plp_rfft_parallel_arg_f32 *)args;
+
+    process_rfft_packed_f32(a->S, a->pSrc, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+   @} end of fftKernels group
+*/
+
+static inline void process_rfft_packed_f32(const plp_rfft_instance_f32 *S,
+                                           const float32_t *pSrc,
+                                           float32_t *pDst,
+                                           int core_id,
+                                           int nPE) {
+
+    int k;
+
+    int N = S->FFTLength;
+    int H = N >> 1;
+
+    const Complex_type_f32 *tw = (const Complex_type_f32 *)S->pTwiddleFactors;
+    Complex_type_f32 *Z = (Complex_type_f32 *)pDst;
+
+    // z[n] = x[2n] + j x[2n + 1] is the input itself, interpreted as complex data
+    if (pSrc != pDst) {
+        for (k = core_id; k < N; k += nPE) {
+            pDst[k] = pSrc[k];
+        }
+        if (nPE > 1) {
+            rt_team_barrier();
+        }
+    }
+
+    // Z = FFT(z) of length N/2
+    plp_cfft_f32_radix4_xpulpv2(Z, H, tw, 2, 0, core_id, nPE);
+
+    // the bit reversal of N/2 elements is the one of N elements, shifted by one
+    plp_bitreversal_f32_xpulpv2(Z, H, S->pBitReverseLUT, 1, core_id, nPE);
+
+    // The spectra of the even and odd samples are E[k] = (Z[k] + conj(Z[N/2 - k])) / 2 and
+    // O[k] = (Z[k] - conj(Z[N/2 - k])) / 2j. Then, X[k] = E[k] + W^k O[k], and
+    // X[N/2 - k] = conj(E[k] - W^k O[k]), such that every pair (k, N/2 - k) is computed in place.
+    if (core_id == 0) {
+        float32_t re = Z[0].re;
+        float32_t im = Z[0].im;
+        Z[0].re = re + im; // X[0]
+        Z[0].im = re - im; // X[N/2]
+    }
+
+    for (k = 1 + core_id; k <= (H >> 1); k += nPE) {
+        Complex_type_f32 a = Z[k];
+        Complex_type_f32 b = Z[H - k];
+        Complex_type_f32 w = tw[k];
+
+        float32_t e_re = 0.5f * (a.re + b.re);
+        float32_t e_im = 0.5f * (a.im - b.im);
+        float32_t o_re = 0.5f * (a.im + b.im);
+        float32_t o_im = 0.5f * (b.re - a.re);
+
+        // W^k * O
+        float32_t t_re = w.re * o_re - w.im * o_im;
+        float32_t t_im = w.re * o_im + w.im * o_re;
+
+        Z[k].re = e_re + t_re;
+        Z[k].im = e_im + t_im;
+        Z[H - k].re = e_re - t_re;
+        Z[H - k].im = t_im - e_im;
+    }
+}
@@ -0,0 +1,169 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16_xpulpv2.c
+ * Description:  16-bit fixed-point real FFT for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static inline void plp_rfft_split_q16(const plp_rfft_instance_q16 *S,
+                                      int16_t *pDst,
+                                      uint32_t coreId,
+                                      uint32_t nPE);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Quantized 16 bit real fast fourier transform for XPULPV2
+ *
+ * @param[in]   S       points to an instance of the 16bit quantized real FFT structure
+ * @param[in]   pSrc    points to the input buffer of fftLenReal real values
+ * @param[out]  pDst    points to the output buffer of fftLenReal values (packed complex data)
+ */
+
+void plp_rfft_q16s_xpulpv2(const plp_rfft_instance_q16 *S, const int16_t *pSrc, int16_t *pDst) {
+    uint32_t i;
+
+    if (pSrc != pDst) {
+        for (i = 0; i < S->fftLenReal; i++) {
+            pDst[i] = pSrc[i];
+        }
+    }
+
+    plp_cfft_q16s_xpulpv2(S->pCfft, pDst, 0, 1, 15);
+
+    plp_rfft_split_q16(S, pDst, 0, 1);
+}
+
+/**
+ * @brief      Parallel quantized 16 bit real fast fourier transform for XPULPV2
+ *
+ * @par Parallelization
+ * The copy of the input, the complex FFT of half the length (see plp_cfft_q16p_xpulpv2) and the
+ * split step are all distributed over the cores, with a barrier in between.
+ *
+ * @param[in]   args    points to the plp_rfft_instance_q16_parallel
+ */
+
+void plp_rfft_q16p_xpulpv2(void *args) {
+    plp_rfft_instance_q16_parallel *a = (plp_rfft_instance_q16_parallel *)args;
+    const plp_rfft_instance_q16 *S = a->S;
+    int16_t *pDst = a->pDst;
+    uint32_t nPE = a->nPE;
+    uint32_t core_id = rt_core_id();
+    uint32_t i, start, end, step;
+
+    if (a->pSrc != pDst) {
+        step = (S->fftLenReal + nPE - 1) / nPE;
+        start = MIN(core_id * step, S->fftLenReal);
+        end = MIN(start + step, S->fftLenReal);
+        for (i = start; i < end; i++) {
+            pDst[i] = a->pSrc[i];
+        }
+    }
+
+    rt_team_barrier();
+
+    plp_cfft_instance_q16_parallel cfftArgs = { .S = (plp_cfft_instance_q16 *)S->pCfft,
+                                                .p1 = pDst,
+                                                .ifftFlag = 0,
+                                                .bitReverseFlag = 1,
+                                                .deciPoint = 15,
+                                                .nPE = nPE };
+
+    plp_cfft_q16p_xpulpv2((void *)&cfftArgs);
+
+    rt_team_barrier();
+
+    plp_rfft_split_q16(S, pDst, core_id, nPE);
+}
+
+/**
+ * @} end of FFT group
+ */
+
+/*
+ * Split step of the real FFT. The pairs (k, N/2-k), 0 < k < N/4, are distributed in contiguous
+ * chunks over the cores, core 0 additionally computes the bins 0, N/4 and N/2.
+ */
+
+static inline void plp_rfft_split_q16(const plp_rfft_instance_q16 *S,
+                                      int16_t *pDst,
+                                      uint32_t coreId,
+                                      uint32_t nPE) {
+    uint32_t half = S->fftLenReal >> 1;
+    uint32_t quarter = S->fftLenReal >> 2;
+    uint32_t step = (quarter + nPE - 1) / nPE;
+    uint32_t k = MIN(coreId * step, quarter);
+    uint32_t end = MIN(k + step, quarter);
+    uint32_t m;
+    const int16_t *pCoef = S->pTwiddleRFFT;
+    uint32_t modifier = S->twidCoefRModifier;
+    int32_t re, im, ar, ai, br, bi, wr, wi;
+    v2s zk, zm, cs, b;
+
+    if (k == 0) {
+        re = pDst[0];
+        im = pDst[1];
+        pDst[0] = (re + im) >> 1;
+        pDst[1] = (re - im) >> 1;
+
+        re = pDst[half];
+        im = pDst[half + 1];
+        pDst[half] = re >> 1;
+        pDst[half + 1] = (-im) >> 1;
+        k = 1;
+    }
+
+    for (; k < end; k++) {
+        m = half - k;
+
+        zk = *(v2s *)&pDst[2 * k];
+        zm = *(v2s *)&pDst[2 * m];
+        cs = *(v2s *)&pCoef[2 * k * modifier];
+
+        ar = (zk[0] + zm[0]) >> 1;
+        br = (zk[0] - zm[0]) >> 1;
+        ai = (zk[1] - zm[1]) >> 1;
+        bi = (zk[1] + zm[1]) >> 1;
+
+        // W^k * (-j) * b with W^k = cs[0] - j cs[1]
+        b = __PACK2(bi, br);
+        wr = __DOTP2(b, __PACK2(cs[0], -cs[1])) >> 15;
+        wi = -__DOTP2(b, __PACK2(cs[1], cs[0])) >> 15;
+
+        *(v2s *)&pDst[2 * k] = __PACK2((ar + wr) >> 1, (ai + wi) >> 1);
+        *(v2s *)&pDst[2 * m] = __PACK2((ar - wr) >> 1, (wi - ai) >> 1);
+    }
+}
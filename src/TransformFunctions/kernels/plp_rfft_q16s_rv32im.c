@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16s_rv32im.c
+ * Description:  16-bit fixed-point real FFT for RV32IM
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Quantized 16 bit real fast fourier transform for RV32IM
+ *
+ * @param[in]   S       points to an instance of the 16bit quantized real FFT structure
+ * @param[in]   pSrc    points to the input buffer of fftLenReal real values
+ * @param[out]  pDst    points to the output buffer of fftLenReal values (packed complex data)
+ */
+
+void plp_rfft_q16s_rv32im(const plp_rfft_instance_q16 *S, const int16_t *pSrc, int16_t *pDst) {
+    uint32_t i, k, m;
+    uint32_t half = S->fftLenReal >> 1;
+    uint32_t quarter = S->fftLenReal >> 2;
+    const int16_t *pCoef = S->pTwiddleRFFT;
+    uint32_t modifier = S->twidCoefRModifier;
+    int32_t re, im, ar, ai, br, bi, wr, wi;
+    int32_t c, s;
+
+    if (pSrc != pDst) {
+        for (i = 0; i < S->fftLenReal; i++) {
+            pDst[i] = pSrc[i];
+        }
+    }
+
+    plp_cfft_q16s_rv32im(S->pCfft, pDst, 0, 1, 15);
+
+    // split step, X[k] and X[N/2-k] are computed from Z[k] and Z[N/2-k]
+    re = pDst[0];
+    im = pDst[1];
+    pDst[0] = (re + im) >> 1;
+    pDst[1] = (re - im) >> 1;
+
+    re = pDst[half];
+    im = pDst[half + 1];
+    pDst[half] = re >> 1;
+    pDst[half + 1] = (-im) >> 1;
+
+    for (k = 1; k < quarter; k++) {
+        m = half - k;
+
+        re = pDst[2 * k];
+        im = pDst[2 * k + 1];
+        ar = (re + pDst[2 * m]) >> 1;
+        br = (re - pDst[2 * m]) >> 1;
+        ai = (im - pDst[2 * m + 1]) >> 1;
+        bi = (im + pDst[2 * m + 1]) >> 1;
+
+        c = pCoef[2 * k * modifier];
+        s = pCoef[2 * k * modifier + 1];
+
+        // W^k * (-j) * b with W^k = c - j s
+        wr = (c * bi - s * br) >> 15;
+        wi = (-(s * bi) - c * br) >> 15;
+
+        pDst[2 * k] = (ar + wr) >> 1;
+        pDst[2 * k + 1] = (ai + wi) >> 1;
+        pDst[2 * m] = (ar - wr) >> 1;
+        pDst[2 * m + 1] = (wi - ai) >> 1;
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
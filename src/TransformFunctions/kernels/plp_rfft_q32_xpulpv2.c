@@ -0,0 +1,172 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q32_xpulpv2.c
+ * Description:  32-bit fixed-point real FFT for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static inline void plp_rfft_split_q32(const plp_rfft_instance_q32 *S,
+                                      int32_t *pDst,
+                                      uint32_t coreId,
+                                      uint32_t nPE);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Quantized 32 bit real fast fourier transform for XPULPV2
+ *
+ * @param[in]   S       points to an instance of the 32bit quantized real FFT structure
+ * @param[in]   pSrc    points to the input buffer of fftLenReal real values
+ * @param[out]  pDst    points to the output buffer of fftLenReal values (packed complex data)
+ */
+
+void plp_rfft_q32s_xpulpv2(const plp_rfft_instance_q32 *S, const int32_t *pSrc, int32_t *pDst) {
+    uint32_t i;
+
+    if (pSrc != pDst) {
+        for (i = 0; i < S->fftLenReal; i++) {
+            pDst[i] = pSrc[i];
+        }
+    }
+
+    plp_cfft_q32s_xpulpv2(S->pCfft, pDst, 0, 1, 31);
+
+    plp_rfft_split_q32(S, pDst, 0, 1);
+}
+
+/**
+ * @brief      Parallel quantized 32 bit real fast fourier transform for XPULPV2
+ *
+ * @par Parallelization
+ * The copy of the input, the complex FFT of half the length (see plp_cfft_q32p_xpulpv2) and the
+ * split step are all distributed over the cores, with a barrier in between.
+ *
+ * @param[in]   args    points to the plp_rfft_instance_q32_parallel
+ */
+
+void plp_rfft_q32p_xpulpv2(void *args) {
+    plp_rfft_instance_q32_parallel *a = (plp_rfft_instance_q32_parallel *)args;
+    const plp_rfft_instance_q32 *S = a->S;
+    int32_t *pDst = a->pDst;
+    uint32_t nPE = a->nPE;
+    uint32_t core_id = rt_core_id();
+    uint32_t i, start, end, step;
+
+    if (a->pSrc != pDst) {
+        step = (S->fftLenReal + nPE - 1) / nPE;
+        start = MIN(core_id * step, S->fftLenReal);
+        end = MIN(start + step, S->fftLenReal);
+        for (i = start; i < end; i++) {
+            pDst[i] = a->pSrc[i];
+        }
+    }
+
+    rt_team_barrier();
+
+    plp_cfft_instance_q32_parallel cfftArgs = { .S = S->pCfft,
+                                                .p1 = pDst,
+                                                .ifftFlag = 0,
+                                                .bitReverseFlag = 1,
+                                                .fracBits = 31,
+                                                .nPE = nPE };
+
+    plp_cfft_q32p_xpulpv2((void *)&cfftArgs);
+
+    rt_team_barrier();
+
+    plp_rfft_split_q32(S, pDst, core_id, nPE);
+}
+
+/**
+ * @} end of FFT group
+ */
+
+/*
+ * Split step of the real FFT. The pairs (k, N/2-k), 0 < k < N/4, are distributed in contiguous
+ * chunks over the cores, core 0 additionally computes the bins 0, N/4 and N/2.
+ */
+
+static inline void plp_rfft_split_q32(const plp_rfft_instance_q32 *S,
+                                      int32_t *pDst,
+                                      uint32_t coreId,
+                                      uint32_t nPE) {
+    uint32_t half = S->fftLenReal >> 1;
+    uint32_t quarter = S->fftLenReal >> 2;
+    uint32_t step = (quarter + nPE - 1) / nPE;
+    uint32_t k = MIN(coreId * step, quarter);
+    uint32_t end = MIN(k + step, quarter);
+    uint32_t m;
+    const int32_t *pCoef = S->pTwiddleRFFT;
+    uint32_t modifier = S->twidCoefRModifier;
+    int64_t re, im;
+    int32_t ar, ai, br, bi, wr, wi;
+    int32_t c, s;
+
+    if (k == 0) {
+        re = pDst[0];
+        im = pDst[1];
+        pDst[0] = (int32_t)((re + im) >> 1);
+        pDst[1] = (int32_t)((re - im) >> 1);
+
+        re = pDst[half];
+        im = pDst[half + 1];
+        pDst[half] = (int32_t)(re >> 1);
+        pDst[half + 1] = (int32_t)((-im) >> 1);
+        k = 1;
+    }
+
+    for (; k < end; k++) {
+        m = half - k;
+
+        re = pDst[2 * k];
+        im = pDst[2 * k + 1];
+        ar = (int32_t)((re + pDst[2 * m]) >> 1);
+        br = (int32_t)((re - pDst[2 * m]) >> 1);
+        ai = (int32_t)((im - pDst[2 * m + 1]) >> 1);
+        bi = (int32_t)((im + pDst[2 * m + 1]) >> 1);
+
+        c = pCoef[2 * k * modifier];
+        s = pCoef[2 * k * modifier + 1];
+
+        // W^k * (-j) * b with W^k = c - j s
+        wr = (int32_t)(((int64_t)c * bi - (int64_t)s * br) >> 31);
+        wi = (int32_t)((-(int64_t)s * bi - (int64_t)c * br) >> 31);
+
+        pDst[2 * k] = (int32_t)(((int64_t)ar + wr) >> 1);
+        pDst[2 * k + 1] = (int32_t)(((int64_t)ai + wi) >> 1);
+        pDst[2 * m] = (int32_t)(((int64_t)ar - wr) >> 1);
+        pDst[2 * m + 1] = (int32_t)(((int64_t)wi - ai) >> 1);
+    }
+}
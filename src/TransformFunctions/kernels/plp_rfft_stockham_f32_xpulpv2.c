@@ -0,0 +1,336 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_stockham_f32_xpulpv2.c
+ * Description:  Floating-point Stockham real FFT kernels for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/* HELPER FUNCTIONS */
+
+static inline Complex_type_f32 stockham_twiddle_f32(const Complex_type_f32 *pTwiddle,
+                                                    uint32_t index,
+                                                    uint32_t half);
+static void process_first_stage_stockham_f32(const float32_t *pSrc,
+                                             Complex_type_f32 *pOut,
+                                             uint32_t N,
+                                             const Complex_type_f32 *pTwiddle,
+                                             uint32_t coreId,
+                                             uint32_t nPE);
+static void process_stage_stockham_f32(const Complex_type_f32 *pIn,
+                                       Complex_type_f32 *pOut,
+                                       uint32_t n,
+                                       uint32_t s,
+                                       const Complex_type_f32 *pTwiddle,
+                                       uint32_t half,
+                                       uint32_t coreId,
+                                       uint32_t nPE);
+static void process_last_radix2_stockham_f32(const Complex_type_f32 *pIn,
+                                             Complex_type_f32 *pOut,
+                                             uint32_t s,
+                                             uint32_t coreId,
+                                             uint32_t nPE);
+static inline void process_rfft_stockham_f32(const plp_rfft_instance_f32 *S,
+                                             const float32_t *pSrc,
+                                             float32_t *pDst,
+                                             float32_t *pBuffer,
+                                             uint32_t coreId,
+                                             uint32_t nPE);
+
+/**
+   @ingroup fft
+ */
+
+/**
+   @addtogroup fftKernels
+   @{
+*/
+
+/**
+   @brief  Floating-point Stockham FFT on real input data for XPULPV2 extension.
+   @param[in]   S        points to an instance of the floating-point FFT structure
+   @param[in]   pSrc     points to the input buffer (real data) of size <code>FFTLength</code>
+   @param[out]  pDst     points to the output buffer (complex data) of size
+                         <code>2*FFTLength</code>
+   @param[in]   pBuffer  points to a scratch buffer of size <code>2*FFTLength</code>
+   @return      none
+
+   @par Ping-Pong Buffers
+   The first radix-4 stage reads the real input, and every stage writes the other buffer in
+   natural order. The first stage writes pDst or pBuffer, depending on the number of stages, such
+   that the last stage ends in pDst. Neither bitReverseFlag nor pBitReverseLUT of S are used.
+   FFTLength must be a power of two, and at least 4.
+*/
+void plp_rfft_stockham_f32s_xpulpv2(const plp_rfft_instance_f32 *S,
+                                    const float32_t *__restrict__ pSrc,
+                                    float32_t *__restrict__ pDst,
+                                    float32_t *__restrict__ pBuffer) {
+
+    process_rfft_stockham_f32(S, pSrc, pDst, pBuffer, 0, 1);
+}
+
+/**
+   @brief  Floating-point Stockham FFT on real input data for XPULPV2 extension (parallel
+           version).
+   @param[in]   args    points to the plp_rfft_stockham_instance_f32_parallel
+   @return      none
+
+   @par Parallelization
+   The butterflies of every stage are split into contiguous chunks over the cores, and a barrier
+   separates the stages.
+*/
+void plp_rfft_stockham_f32p_xpulpv2(void *args) {
+
+    plp_rfft_stockham_instance_f32_parallel *a = (plp_rfft_stockham_instance_f32_parallel *)args;
+
+    process_rfft_stockham_f32(a->S, a->pSrc, a->pDst, a->pBuffer, rt_core_id(), a->nPE);
+}
+
+/**
+   @} end of fftKernels group
+*/
+
+static inline void process_rfft_stockham_f32(const plp_rfft_instance_f32 *S,
+                                             const float32_t *pSrc,
+                                             float32_t *pDst,
+                                             float32_t *pBuffer,
+                                             uint32_t coreId,
+                                             uint32_t nPE) {
+
+    uint32_t N = S->FFTLength;
+    uint32_t n = N >> 2;
+    uint32_t s = 4;
+    uint32_t log2N = 0;
+    const Complex_type_f32 *pTwiddle = (const Complex_type_f32 *)S->pTwiddleFactors;
+    Complex_type_f32 *pIn;
+    Complex_type_f32 *pOut;
+    Complex_type_f32 *pOther;
+
+    while ((1U << log2N) < N) {
+        log2N++;
+    }
+
+    // choose the first output buffer such that the last stage writes pDst
+    if (((log2N + 1) >> 1) & 1) {
+        pOut = (Complex_type_f32 *)pDst;
+        pOther = (Complex_type_f32 *)pBuffer;
+    } else {
+        pOut = (Complex_type_f32 *)pBuffer;
+        pOther = (Complex_type_f32 *)pDst;
+    }
+
+    // FIRST STAGE, input is real
+    process_first_stage_stockham_f32(pSrc, pOut, N, pTwiddle, coreId, nPE);
+
+    // RADIX-4 STAGES
+    for (; n >= 4; n >>= 2, s <<= 2) {
+        if (nPE > 1) {
+            rt_team_barrier();
+        }
+        pIn = pOut;
+        pOut = pOther;
+        pOther = pIn;
+        process_stage_stockham_f32(pIn, pOut, n, s, pTwiddle, N >> 1, coreId, nPE);
+    }
+
+    // LAST STAGE, only if log2(N) is odd
+    if (n == 2) {
+        if (nPE > 1) {
+            rt_team_barrier();
+        }
+        process_last_radix2_stockham_f32(pOut, pOther, s, coreId, nPE);
+    }
+}
+
+static inline Complex_type_f32 stockham_twiddle_f32(const Complex_type_f32 *pTwiddle,
+                                                    uint32_t index,
+                                                    uint32_t half) {
+
+    // the table only holds W^k for k < N/2, and W^(k + N/2) = -W^k
+    if (index < half) {
+        return pTwiddle[index];
+    }
+
+    Complex_type_f32 result = pTwiddle[index - half];
+    result.re = -result.re;
+    result.im = -result.im;
+    return result;
+}
+
+/*
+ * First radix-4 stage on the real input (n = N, s = 1): the butterfly p < N / 4 reads
+ * pSrc[p + i * N / 4] for i < 4 and writes bin u of the 4-point DFT, multiplied by W_N^(u * p),
+ * to pOut[4 * p + u].
+ */
+static void process_first_stage_stockham_f32(const float32_t *pSrc,
+                                             Complex_type_f32 *pOut,
+                                             uint32_t N,
+                                             const Complex_type_f32 *pTwiddle,
+                                             uint32_t coreId,
+                                             uint32_t nPE) {
+
+    uint32_t p;
+    uint32_t m = N >> 2;
+    uint32_t half = N >> 1;
+    uint32_t chunk = (m + nPE - 1) / nPE;
+    uint32_t start = MIN(coreId * chunk, m);
+    uint32_t end = MIN(start + chunk, m);
+    Complex_type_f32 tw1, tw2, tw3, r;
+
+    for (p = start; p < end; p++) {
+        float32_t x0 = pSrc[p];
+        float32_t x1 = pSrc[p + m];
+        float32_t x2 = pSrc[p + 2 * m];
+        float32_t x3 = pSrc[p + 3 * m];
+
+        float32_t t0 = x0 + x2;
+        float32_t t1 = x1 + x3;
+        float32_t t2 = x0 - x2;
+        float32_t u = x1 - x3;
+
+        tw1 = stockham_twiddle_f32(pTwiddle, p, half);
+        tw2 = stockham_twiddle_f32(pTwiddle, 2 * p, half);
+        tw3 = stockham_twiddle_f32(pTwiddle, 3 * p, half);
+
+        r.re = t0 + t1;
+        r.im = 0.0f;
+        pOut[4 * p] = r;
+
+        // bin 1 is t2 - j * u, bin 3 is t2 + j * u
+        r.re = t2 * tw1.re + u * tw1.im;
+        r.im = t2 * tw1.im - u * tw1.re;
+        pOut[4 * p + 1] = r;
+
+        r.re = (t0 - t1) * tw2.re;
+        r.im = (t0 - t1) * tw2.im;
+        pOut[4 * p + 2] = r;
+
+        r.re = t2 * tw3.re - u * tw3.im;
+        r.im = t2 * tw3.im + u * tw3.re;
+        pOut[4 * p + 3] = r;
+    }
+}
+
+/*
+ * One decimation-in-frequency Stockham radix-4 stage on the sub-transforms of length n, with s
+ * sub-transforms interleaved with stride s. For p < n / 4 and q < s, the butterfly reads
+ * pIn[q + s * (p + i * n / 4)] for i < 4 and writes bin u of the 4-point DFT, multiplied by
+ * W_N^(u * p * s), to pOut[q + s * (4 * p + u)]. The butterflies are split into contiguous chunks
+ * over the cores, such that the twiddle factors only change once every s butterflies.
+ */
+static void process_stage_stockham_f32(const Complex_type_f32 *pIn,
+                                       Complex_type_f32 *pOut,
+                                       uint32_t n,
+                                       uint32_t s,
+                                       const Complex_type_f32 *pTwiddle,
+                                       uint32_t half,
+                                       uint32_t coreId,
+                                       uint32_t nPE) {
+
+    uint32_t b, p, q, qEnd;
+    uint32_t m = n >> 2;
+    uint32_t total = m * s;
+    uint32_t chunk = (total + nPE - 1) / nPE;
+    uint32_t start = MIN(coreId * chunk, total);
+    uint32_t end = MIN(start + chunk, total);
+    uint32_t d = s * m; // distance between the inputs of a butterfly
+    Complex_type_f32 tw1, tw2, tw3, x0, x1, x2, x3, t0, t1, t2, t3, r;
+
+    for (b = start; b < end; b = p * s + qEnd) {
+        p = b / s;
+        qEnd = MIN(end - p * s, s);
+
+        tw1 = stockham_twiddle_f32(pTwiddle, p * s, half);
+        tw2 = stockham_twiddle_f32(pTwiddle, 2 * p * s, half);
+        tw3 = stockham_twiddle_f32(pTwiddle, 3 * p * s, half);
+
+        const Complex_type_f32 *x = &pIn[s * p];
+        Complex_type_f32 *y = &pOut[4 * s * p];
+
+        for (q = b - p * s; q < qEnd; q++) {
+            x0 = x[q];
+            x1 = x[q + d];
+            x2 = x[q + 2 * d];
+            x3 = x[q + 3 * d];
+
+            // t3 = -j * (x1 - x3)
+            t0.re = x0.re + x2.re;
+            t0.im = x0.im + x2.im;
+            t1.re = x1.re + x3.re;
+            t1.im = x1.im + x3.im;
+            t2.re = x0.re - x2.re;
+            t2.im = x0.im - x2.im;
+            t3.re = x1.im - x3.im;
+            t3.im = x3.re - x1.re;
+
+            r.re = t0.re + t1.re;
+            r.im = t0.im + t1.im;
+            y[q] = r;
+
+            r.re = t2.re + t3.re;
+            r.im = t2.im + t3.im;
+            y[q + s].re = r.re * tw1.re - r.im * tw1.im;
+            y[q + s].im = r.re * tw1.im + r.im * tw1.re;
+
+            r.re = t0.re - t1.re;
+            r.im = t0.im - t1.im;
+            y[q + 2 * s].re = r.re * tw2.re - r.im * tw2.im;
+            y[q + 2 * s].im = r.re * tw2.im + r.im * tw2.re;
+
+            r.re = t2.re - t3.re;
+            r.im = t2.im - t3.im;
+            y[q + 3 * s].re = r.re * tw3.re - r.im * tw3.im;
+            y[q + 3 * s].im = r.re * tw3.im + r.im * tw3.re;
+        }
+    }
+}
+
+/*
+ * Last radix-2 stage with n = 2, where all twiddle factors are 1: pOut[q] and pOut[q + s] are the
+ * sum and difference of pIn[q] and pIn[q + s], for q < s = N / 2.
+ */
+static void process_last_radix2_stockham_f32(const Complex_type_f32 *pIn,
+                                             Complex_type_f32 *pOut,
+                                             uint32_t s,
+                                             uint32_t coreId,
+                                             uint32_t nPE) {
+
+    uint32_t q;
+    uint32_t chunk = (s + nPE - 1) / nPE;
+    uint32_t start = MIN(coreId * chunk, s);
+    uint32_t end = MIN(start + chunk, s);
+    Complex_type_f32 a0, a1;
+
+    for (q = start; q < end; q++) {
+        a0 = pIn[q];
+        a1 = pIn[q + s];
+        pOut[q].re = a0.re + a1.re;
+        pOut[q].im = a0.im + a1.im;
+        pOut[q + s].re = a0.re - a1.re;
+        pOut[q + s].im = a0.im - a1.im;
+    }
+}
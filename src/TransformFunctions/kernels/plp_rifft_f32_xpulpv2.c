@@ -0,0 +1,122 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rifft_f32_xpulpv2.c
+ * Description:  Floating-point inverse FFT with real output for XPULPV2
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void process_rifft_f32(const plp_rfft_instance_f32 *S,
+                                     const float32_t *pSrc,
+                                     float32_t *pDst,
+                                     int core_id,
+                                     int nPE);
+
+/**
+   @ingroup fft
+ */
+
+/**
+   @addtogroup fftKernels
+   @{
+*/
+
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data)
+   @param[out]  pDst    points to the output buffer (real data)
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pDst) {
+
+    process_rifft_f32(S, pSrc, pDst, 0, 1);
+}
+
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension (parallel
+           version).
+   @param[in]   args     points to the plp_rfft_parallel_arg_f32
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2_parallel(void *args) {
+
+    plp_rfft_parallel_arg_f32 *a = (plp_rfft_parallel_arg_f32 *)args;
+
+    process_rifft_f32(a->S, a->pSrc, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+   @} end of fftKernels group
+*/
+
+static inline void process_rifft_f32(const plp_rfft_instance_f32 *S,
+                                     const float32_t *pSrc,
+                                     float32_t *pDst,
+                                     int core_id,
+                                     int nPE) {
+
+    int k;
+
+    int N = S->FFTLength;
+    int H = N >> 1;
+    float32_t scale = 1.0f / N;
+
+    const Complex_type_f32 *X = (const Complex_type_f32 *)pSrc;
+    const Complex_type_f32 *tw = (const Complex_type_f32 *)S->pTwiddleFactors;
+    Complex_type_f32 *Z = (Complex_type_f32 *)pDst;
+
+    // Split the spectrum into the spectra of the even samples, E[k] = X[k] + X[k + N/2], and of
+    // the odd samples, O[k] = (X[k] - X[k + N/2]) * W^-k, and combine them to Z[k] = E[k] + j O[k].
+    for (k = core_id; k < H; k += nPE) {
+        Complex_type_f32 a = X[k];
+        Complex_type_f32 b = X[k + H];
+        Complex_type_f32 w = tw[k];
+
+        float32_t e_re = a.re + b.re;
+        float32_t e_im = a.im + b.im;
+        float32_t d_re = a.re - b.re;
+        float32_t d_im = a.im - b.im;
+
+        // O = conj(W) * d
+        float32_t o_re = w.re * d_re + w.im * d_im;
+        float32_t o_im = w.re * d_im - w.im * d_re;
+
+        Z[k].re = (e_re - o_im) * scale;
+        Z[k].im = (e_im + o_re) * scale;
+    }
+
+    if (nPE > 1) {
+        rt_team_barrier();
+    }
+
+    // z = IFFT(Z) of length N/2, where z[n] = x[2n] + j x[2n + 1]
+    plp_cfft_f32_radix4_xpulpv2(Z, H, tw, 2, 1, core_id, nPE);
+
+    // the bit reversal of N/2 elements is the one of N elements, shifted by one
+    plp_bitreversal_f32_xpulpv2(Z, H, S->pBitReverseLUT, 1, core_id, nPE);
+}
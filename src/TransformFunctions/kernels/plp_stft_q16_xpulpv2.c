@@ -0,0 +1,184 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_q16_xpulpv2.c
+ * Description:  Short-time Fourier transform of a 16-bit fixed-point stream for XPULPV2
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+// samples start to end of the frame, multiplied with the window (if any)
+static inline void plp_stft_window_q16(const int16_t *pWindow,
+                                       const int16_t *pFrame,
+                                       uint32_t N,
+                                       uint32_t start,
+                                       uint32_t end,
+                                       int16_t *pDst) {
+    uint32_t n;
+
+    if (pWindow == NULL) {
+        for (n = start; n < end; n++) {
+            pDst[n] = pFrame[n];
+        }
+    } else {
+        for (n = start; n < end; n++) {
+            pDst[n] = (pFrame[n] * pWindow[(n <= N / 2) ? n : N - n]) >> 15;
+        }
+    }
+}
+
+static inline void process_stft_q16(plp_stft_instance_q16 *S,
+                                    const int16_t *pSrc,
+                                    uint32_t nFrames,
+                                    int16_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE);
+
+/**
+ * @ingroup STFT
+ */
+
+/**
+ * @addtogroup STFTKernels
+ * @{
+ */
+
+/**
+ * @brief      STFT of a stream of 16-bit fixed-point samples for XPULPV2 extension
+ *
+ * @param[in,out]  S        points to the instance, initialized by plp_stft_init_q16
+ * @param[in]      pSrc     points to the next nFrames*hop samples of the stream
+ * @param[in]      nFrames  number of frames to compute
+ * @param[out]     pDst     points to nFrames spectra of N values each
+ */
+
+void plp_stft_q16s_xpulpv2(plp_stft_instance_q16 *S,
+                           const int16_t *pSrc,
+                           uint32_t nFrames,
+                           int16_t *pDst) {
+    process_stft_q16(S, pSrc, nFrames, pDst, 0, 1);
+}
+
+/**
+ * @brief      Parallel STFT of a stream of 16-bit fixed-point samples for XPULPV2 extension
+ *
+ * @par Parallelization
+ * The frames are computed in batches of up to (ringLen - N) / hop + 1 frames, which all lie in the
+ * ring buffer. The new samples of a batch are written to the ring buffer by all cores. Then, every
+ * core computes whole frames with the single core transform, and the remaining nb % nPE frames of
+ * a batch of nb frames are computed by all cores together with plp_rfft_q16p_xpulpv2.
+ *
+ * @param[in]   args    points to the plp_stft_instance_q16_parallel
+ */
+
+void plp_stft_q16p_xpulpv2(void *args) {
+    plp_stft_instance_q16_parallel *a = (plp_stft_instance_q16_parallel *)args;
+
+    process_stft_q16(a->S, a->pSrc, a->nFrames, a->pDst, rt_core_id(), a->nPE);
+}
+
+/**
+ * @} end of STFTKernels group
+ */
+
+static inline void process_stft_q16(plp_stft_instance_q16 *S,
+                                    const int16_t *pSrc,
+                                    uint32_t nFrames,
+                                    int16_t *pDst,
+                                    uint32_t coreId,
+                                    uint32_t nPE) {
+    const plp_rfft_instance_q16 *pRfft = S->pRfft;
+    const int16_t *pWindow = S->pWindow;
+    uint32_t N = pRfft->fftLenReal;
+    uint32_t hop = S->hop;
+    uint32_t L = S->ringLen;
+    uint32_t batch = (L - N) / hop + 1;
+    uint32_t head = S->head;
+    int16_t *pRing = S->pRing;
+    uint32_t f0, f, nb, nFull, i, pos, start, end;
+    const int16_t *pFrame;
+    int16_t *pSpec;
+    int16_t x;
+    plp_rfft_instance_q16_parallel fftArgs = { .S = pRfft, .nPE = nPE };
+
+    for (f0 = 0; f0 < nFrames; f0 += nb) {
+        nb = MIN(batch, nFrames - f0);
+
+        // write the new samples of the batch, and their mirror
+        plp_team_chunk(nb * hop, nPE, coreId, 1, &start, &end);
+        pos = head + start;
+        if (pos >= L) {
+            pos -= L;
+        }
+        for (i = start; i < end; i++) {
+            x = pSrc[f0 * hop + i];
+            pRing[pos] = x;
+            pRing[pos + L] = x;
+            if (++pos == L) {
+                pos = 0;
+            }
+        }
+        head += nb * hop;
+        if (head >= L) {
+            head -= L;
+        }
+
+        if (nPE > 1) {
+            plp_team_barrier();
+        }
+
+        // frame f ends (nb - 1 - f) hops before the sample before head
+        nFull = nb - nb % nPE;
+        for (f = coreId; f < nFull; f += nPE) {
+            pFrame = &pRing[(head + 2 * L - N - (nb - 1 - f) * hop) % L];
+            pSpec = &pDst[(f0 + f) * N];
+            plp_stft_window_q16(pWindow, pFrame, N, 0, N, pSpec);
+            plp_rfft_q16s_xpulpv2(pRfft, pSpec, pSpec);
+        }
+
+        for (f = nFull; f < nb; f++) {
+            pFrame = &pRing[(head + 2 * L - N - (nb - 1 - f) * hop) % L];
+            pSpec = &pDst[(f0 + f) * N];
+            plp_team_chunk(N, nPE, coreId, 1, &start, &end);
+            plp_stft_window_q16(pWindow, pFrame, N, start, end, pSpec);
+
+            // the parallel real FFT starts with a barrier
+            fftArgs.pSrc = pSpec;
+            fftArgs.pDst = pSpec;
+            plp_rfft_q16p_xpulpv2(&fftArgs);
+            plp_team_barrier();
+        }
+
+        // the next batch overwrites the oldest samples of this batch
+        if (nPE > 1 && f0 + nb < nFrames) {
+            plp_team_barrier();
+        }
+    }
+
+    if (coreId == 0) {
+        S->head = head;
+    }
+}
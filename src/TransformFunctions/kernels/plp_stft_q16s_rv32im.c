@@ -0,0 +1,103 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_q16s_rv32im.c
+ * Description:  Short-time Fourier transform of a 16-bit fixed-point stream for RV32IM
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup STFT
+ */
+
+/**
+ * @defgroup STFTKernels STFT Kernels
+ * Kernels of the short-time Fourier transform.
+ */
+
+/**
+ * @addtogroup STFTKernels
+ * @{
+ */
+
+/**
+ * @brief      STFT of a stream of 16-bit fixed-point samples for RV32IM
+ *
+ * @param[in,out]  S        points to the instance, initialized by plp_stft_init_q16
+ * @param[in]      pSrc     points to the next nFrames*hop samples of the stream
+ * @param[in]      nFrames  number of frames to compute
+ * @param[out]     pDst     points to nFrames spectra of N values each
+ */
+
+void plp_stft_q16s_rv32im(plp_stft_instance_q16 *S,
+                          const int16_t *pSrc,
+                          uint32_t nFrames,
+                          int16_t *pDst) {
+    const plp_rfft_instance_q16 *pRfft = S->pRfft;
+    const int16_t *pWindow = S->pWindow;
+    uint32_t N = pRfft->fftLenReal;
+    uint32_t hop = S->hop;
+    uint32_t L = S->ringLen;
+    uint32_t head = S->head;
+    int16_t *pRing = S->pRing;
+    uint32_t f, n, i;
+    int16_t x;
+
+    for (f = 0; f < nFrames; f++) {
+        const int16_t *pFrame;
+        int16_t *pSpec = &pDst[f * N];
+
+        // write the hop new samples, and their mirror
+        for (i = 0; i < hop; i++) {
+            x = *pSrc++;
+            pRing[head] = x;
+            pRing[head + L] = x;
+            if (++head == L) {
+                head = 0;
+            }
+        }
+
+        // the frame ends with the sample before head, it is contiguous thanks to the mirror
+        pFrame = &pRing[head + L - N];
+
+        if (pWindow == NULL) {
+            for (n = 0; n < N; n++) {
+                pSpec[n] = pFrame[n];
+            }
+        } else {
+            for (n = 0; n < N; n++) {
+                pSpec[n] = (pFrame[n] * pWindow[(n <= N / 2) ? n : N - n]) >> 15;
+            }
+        }
+
+        plp_rfft_q16s_rv32im(pRfft, pSpec, pSpec);
+    }
+
+    S->head = head;
+}
+
+/**
+ * @} end of STFTKernels group
+ */
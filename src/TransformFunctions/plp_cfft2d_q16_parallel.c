@@ -0,0 +1,258 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft2d_q16_parallel.c
+ * Description:  Glue code for the parallel 16-bit fixed-point 2-D complex FFT
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+static void plp_cfft2d_q16_rows(const plp_cfft_instance_q16 *S,
+                                const int16_t *pSrc,
+                                uint32_t rows,
+                                uint8_t ifftFlag,
+                                uint32_t nPE,
+                                int16_t *pDst,
+                                uint8_t *pBuf);
+static void plp_cfft2d_q16_cols(const plp_cfft_instance_q16 *S,
+                                uint32_t cols,
+                                uint8_t ifftFlag,
+                                uint32_t nPE,
+                                int16_t *pDst,
+                                uint8_t *pBuf);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the parallel quantized 16 bit 2-D complex fast fourier transform
+ *
+ * Computes the transforms of all rows (e.g. the range FFTs of a radar cube slice), followed by
+ * the transforms of all columns (e.g. the Doppler FFTs). Each 1-D transform has the same fixed
+ * point units as plp_cfft_q16, so the output is the 2-D DFT scaled by 1 / (rows * cols), in
+ * natural order.
+ *
+ * @param[in]   SRow      points to the CFFT instance of the rows, of length cols
+ * @param[in]   SCol      points to the CFFT instance of the columns, of length rows
+ * @param[in]   pSrc      points to the complex input matrix in L2, of rows x cols complex values
+ *                        stored row by row
+ * @param[in]   ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ *                        transform.
+ * @param[in]   nPE       number of cores to use
+ * @param[out]  pDst      points to the complex output matrix in L2, of rows x cols complex values.
+ *                        It can be equal to pSrc.
+ * @return      none
+ *
+ * @par DMA Streaming
+ * Both passes stream the matrix through double buffered tiles of a L1 buffer of
+ * PLP_DMA_STREAM_BUFFER_BYTES bytes, taken with plp_scratch_alloc, such that the cluster DMA
+ * copies the next tile and writes back the previous one while the cores compute. The row pass
+ * copies bands of whole rows and transforms them in place. The column pass copies blocks of
+ * columns with 2-D transfers, which read the columns of the block with the stride of a row. The
+ * cores transpose the block in L1, transform the columns, and transpose them back. The transforms
+ * of a tile are batched over the cores like plp_cfft_q16_batched_parallel, so a larger buffer
+ * (more transforms per tile) reduces the synchronization between the cores.
+ */
+
+void plp_cfft2d_q16_parallel(const plp_cfft_instance_q16 *SRow,
+                             const plp_cfft_instance_q16 *SCol,
+                             const int16_t *pSrc,
+                             uint8_t ifftFlag,
+                             uint32_t nPE,
+                             int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        uint32_t rows = SCol->fftLen;
+        uint32_t cols = SRow->fftLen;
+
+        // two rows, or two blocks and one transposed block of one column, must fit into L1
+        if (2 * cols * 4 > PLP_DMA_STREAM_BUFFER_BYTES ||
+            3 * rows * 4 > PLP_DMA_STREAM_BUFFER_BYTES) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+
+        uint8_t *pBuf = (uint8_t *)plp_scratch_alloc(PLP_DMA_STREAM_BUFFER_BYTES);
+
+        if (pBuf == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+
+        plp_cfft2d_q16_rows(SRow, pSrc, rows, ifftFlag, nPE, pDst, pBuf);
+        plp_cfft2d_q16_cols(SCol, cols, ifftFlag, nPE, pDst, pBuf);
+
+        plp_scratch_free(pBuf, PLP_DMA_STREAM_BUFFER_BYTES);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
+
+// transforms the rows of pSrc into pDst, in bands of bandRows rows
+static void plp_cfft2d_q16_rows(const plp_cfft_instance_q16 *S,
+                                const int16_t *pSrc,
+                                uint32_t rows,
+                                uint8_t ifftFlag,
+                                uint32_t nPE,
+                                int16_t *pDst,
+                                uint8_t *pBuf) {
+
+    uint32_t cols = S->fftLen;
+    uint32_t rowBytes = cols * 4;
+    uint32_t bandRows = MIN(PLP_DMA_STREAM_BUFFER_BYTES / (2 * rowBytes), rows);
+    uint32_t nBands = (rows + bandRows - 1) / bandRows;
+    uint32_t t, i;
+
+    int16_t *pTile[2] = { (int16_t *)pBuf, (int16_t *)(pBuf + bandRows * rowBytes) };
+    int16_t *pChannels[bandRows];
+    rt_dma_copy_t copyIn[2], copyOut[2];
+
+    for (t = 0; t <= nBands; t++) {
+        uint32_t b = t & 1;
+
+        // start the copy of the next band into the tile written back two bands ago
+        if (t < nBands) {
+            uint32_t row = t * bandRows;
+            uint32_t n = MIN(bandRows, rows - row);
+
+            if (t >= 2) {
+                plp_copy_dma_wait(&copyOut[b]);
+            }
+            plp_copy_dma(pSrc + 2 * row * cols, pTile[b], n * rowBytes, RT_DMA_DIR_EXT2LOC,
+                         &copyIn[b]);
+        }
+
+        // transform the current band, and write it back
+        if (t > 0) {
+            uint32_t p = b ^ 1;
+            uint32_t row = (t - 1) * bandRows;
+            uint32_t n = MIN(bandRows, rows - row);
+
+            for (i = 0; i < n; i++) {
+                pChannels[i] = pTile[p] + 2 * i * cols;
+            }
+
+            plp_cfft2d_instance_q16_parallel args = { .S = S,
+                                                      .pTile = pTile[p],
+                                                      .pTrans = NULL,
+                                                      .pChannels = pChannels,
+                                                      .nChannels = n,
+                                                      .ifftFlag = ifftFlag,
+                                                      .nPE = nPE };
+
+            plp_copy_dma_wait(&copyIn[p]);
+            rt_team_fork(nPE, plp_cfft2d_q16p_xpulpv2, (void *)&args);
+
+            plp_copy_dma(pTile[p], pDst + 2 * row * cols, n * rowBytes, RT_DMA_DIR_LOC2EXT,
+                         &copyOut[p]);
+        }
+    }
+
+    // wait for the write-backs of the last two bands
+    plp_copy_dma_wait(&copyOut[(nBands - 1) & 1]);
+    if (nBands > 1) {
+        plp_copy_dma_wait(&copyOut[nBands & 1]);
+    }
+}
+
+// transforms the columns of pDst in place, in blocks of blockCols columns
+static void plp_cfft2d_q16_cols(const plp_cfft_instance_q16 *S,
+                                uint32_t cols,
+                                uint8_t ifftFlag,
+                                uint32_t nPE,
+                                int16_t *pDst,
+                                uint8_t *pBuf) {
+
+    uint32_t rows = S->fftLen;
+    uint32_t colBytes = rows * 4;
+    uint32_t blockCols = MIN(PLP_DMA_STREAM_BUFFER_BYTES / (3 * colBytes), cols);
+    uint32_t nBlocks = (cols + blockCols - 1) / blockCols;
+    uint32_t t, i;
+
+    int16_t *pTile[2] = { (int16_t *)pBuf, (int16_t *)(pBuf + blockCols * colBytes) };
+    int16_t *pTrans = (int16_t *)(pBuf + 2 * blockCols * colBytes);
+    int16_t *pChannels[blockCols];
+    rt_dma_copy_t copyIn[2], copyOut[2];
+
+    for (t = 0; t <= nBlocks; t++) {
+        uint32_t b = t & 1;
+
+        // start the 2-D copy of the next block, rows lines of n values with the stride of a row
+        if (t < nBlocks) {
+            uint32_t col = t * blockCols;
+            uint32_t n = MIN(blockCols, cols - col);
+
+            if (t >= 2) {
+                plp_copy_dma_wait(&copyOut[b]);
+            }
+            rt_dma_memcpy_2d((unsigned int)(pDst + 2 * col), (unsigned int)pTile[b], rows * n * 4,
+                             cols * 4, n * 4, RT_DMA_DIR_EXT2LOC, 0, &copyIn[b]);
+        }
+
+        // transform the columns of the current block, and write it back
+        if (t > 0) {
+            uint32_t p = b ^ 1;
+            uint32_t col = (t - 1) * blockCols;
+            uint32_t n = MIN(blockCols, cols - col);
+
+            for (i = 0; i < n; i++) {
+                pChannels[i] = pTrans + 2 * i * rows;
+            }
+
+            plp_cfft2d_instance_q16_parallel args = { .S = S,
+                                                      .pTile = pTile[p],
+                                                      .pTrans = pTrans,
+                                                      .pChannels = pChannels,
+                                                      .nChannels = n,
+                                                      .ifftFlag = ifftFlag,
+                                                      .nPE = nPE };
+
+            plp_copy_dma_wait(&copyIn[p]);
+            rt_team_fork(nPE, plp_cfft2d_q16p_xpulpv2, (void *)&args);
+
+            rt_dma_memcpy_2d((unsigned int)(pDst + 2 * col), (unsigned int)pTile[p], rows * n * 4,
+                             cols * 4, n * 4, RT_DMA_DIR_LOC2EXT, 0, &copyOut[p]);
+        }
+    }
+
+    // wait for the write-backs of the last two blocks
+    plp_copy_dma_wait(&copyOut[(nBlocks - 1) & 1]);
+    if (nBlocks > 1) {
+        plp_copy_dma_wait(&copyOut[nBlocks & 1]);
+    }
+}
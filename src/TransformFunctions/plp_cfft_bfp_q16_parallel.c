@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16_parallel.c
+ * Description:  16-bit block-floating-point complex FFT glue code (parallel version)
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief 16-bit block-floating-point FFT on complex input data (parallel version).
+   @param[in]   S         points to an instance of the 16-bit fixed-point CFFT structure, for
+                          example plp_cfft_sR_q16_len256. The bit reversal table is not used.
+   @param[in]   pSrc      points to the complex input buffer of size <code>2*fftLen</code>, which
+                          is not modified
+   @param[out]  pDst      points to the complex output buffer of size <code>2*fftLen</code>
+   @param[in]   pBuffer   points to a scratch buffer of size <code>2*fftLen</code>
+   @param[in]   ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+                          transform.
+   @param[in]   nPE       number of parallel processing units
+   @return      block exponent of the output, 0 if the operation is not supported
+
+   @par Block Floating Point
+   Instead of dividing by 4 in every stage like plp_cfft_q16, every stage measures the largest
+   magnitude of the whole block and shifts its input just enough to avoid an overflow, or shifts
+   it to the left if the block is small. Low-level inputs hence keep their resolution through all
+   stages. The output is in natural order, and the DFT sum (without the factor 1 / fftLen of the
+   inverse transform) equals the output multiplied by 2^exponent, where the exponent can be
+   negative. pSrc, pDst and pBuffer must not overlap.
+*/
+int32_t plp_cfft_bfp_q16_parallel(const plp_cfft_instance_q16 *S,
+                                  const int16_t *__restrict__ pSrc,
+                                  int16_t *__restrict__ pDst,
+                                  int16_t *__restrict__ pBuffer,
+                                  uint8_t ifftFlag,
+                                  uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return 0;
+    }
+
+    uint32_t maxSq[2 * nPE];
+
+    plp_cfft_bfp_instance_q16_parallel args = { .S = S,
+                                                .pSrc = pSrc,
+                                                .pDst = pDst,
+                                                .pBuffer = pBuffer,
+                                                .ifftFlag = ifftFlag,
+                                                .nPE = nPE,
+                                                .pMax = maxSq,
+                                                .exponent = 0 };
+
+    rt_team_fork(nPE, plp_cfft_bfp_q16p_xpulpv2, (void *)&args);
+
+    return args.exponent;
+}
+
+/**
+   @} end of FFT group
+*/
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_f16.c
+ * Description:  Half-precision floating-point FFT on complex input data glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Half-precision floating-point FFT on complex input data.
+   @param[in]      S         points to an instance of the half-precision FFT structure (see
+                             plp_cfft_init_f16)
+   @param[in,out]  p1        points to the complex data buffer of size <code>2*FFTLength</code>,
+                             aligned to 32 bits. Processing occurs in-place.
+   @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+                             transform.
+   @return         none
+
+   @par Output Order and Scaling
+   The output is bit reversed if S->bitReverseFlag is 0. The inverse transform is scaled by
+   1 / FFTLength, such that the inverse of the forward transform is the original input. The
+   forward transform is not scaled, so the magnitude of the output must stay below 65504, the
+   largest half-precision value.
+
+   @par Half Precision
+   With PLP_MATH_SMALLFLOAT, a complex value is held in one register, and the butterflies add,
+   subtract and multiply the real and imaginary parts at once with the packed SIMD instructions.
+   Otherwise, the values are converted to single precision in every butterfly.
+*/
+void plp_cfft_f16(const plp_cfft_instance_f16 *S, float16_t *__restrict__ p1, uint8_t ifftFlag) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_cfft_f16s_xpulpv2(S, p1, ifftFlag);
+}
+
+/**
+   @} end of FFT group
+*/
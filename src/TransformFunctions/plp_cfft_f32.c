@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_f32.c
+ * Description:  Floating-point complex FFT glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Floating-point FFT on complex input data.
+   @param[in]      S         points to an instance of the floating-point FFT structure. The same
+                             instance (and twiddle factors) as for plp_rfft_f32 is used.
+   @param[in,out]  p1        points to the complex data buffer of size <code>2*FFTLength</code>.
+                             Processing occurs in-place.
+   @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+                             transform.
+   @return         none
+
+   @par Output Order and Scaling
+   The output is bit reversed if S->bitReverseFlag is 0. The inverse transform is scaled by
+   1 / FFTLength, such that the inverse of the forward transform is the original input.
+*/
+void plp_cfft_f32(const plp_rfft_instance_f32 *S, float32_t *__restrict__ p1, uint8_t ifftFlag) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_cfft_f32s_xpulpv2(S, p1, ifftFlag);
+}
+
+/**
+   @} end of FFT group
+*/
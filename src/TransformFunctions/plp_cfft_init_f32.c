@@ -0,0 +1,95 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_init_f32.c
+ * Description:  Runtime initialization of the floating-point FFT tables
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Initializes an instance of the floating-point FFT structure at runtime
+ *
+ * Generates the twiddle factors and the bit reversal lookup table of the given length into
+ * pBuffer, instead of using a static table like plp_rfft_sR_f32_len2048. The instance can be used
+ * with plp_cfft_f32, plp_rfft_f32 and plp_rifft_f32 and their parallel versions, and the tables
+ * can be put into L1 by passing a buffer allocated there. The bit reversal of the output is
+ * enabled.
+ *
+ * @param[out]  S         points to the instance of the floating-point FFT structure
+ * @param[in]   fftLen    length of the FFT, a power of two from 4 to 32768
+ * @param[in]   pBuffer   points to a buffer of at least 3*fftLen/2 32-bit words, which must stay
+ *                        valid as long as S is used. The twiddle factors are stored at the
+ *                        beginning, followed by the bit reversal lookup table.
+ * @return      0: Success, 1: fftLen is not supported
+ */
+
+int plp_cfft_init_f32(plp_rfft_instance_f32 *S, uint32_t fftLen, float32_t *pBuffer) {
+    uint32_t i, j, k;
+    uint32_t log2Len = 0;
+    uint16_t *pBitReverseLUT;
+
+    if (fftLen < 4 || fftLen > 32768 || (fftLen & (fftLen - 1)) != 0) {
+        return 1;
+    }
+
+    while ((1U << log2Len) < fftLen) {
+        log2Len++;
+    }
+
+    // twiddle factors exp(-2*pi*j*i/fftLen) for i < fftLen/2, as interleaved real and imaginary part
+    for (i = 0; i < fftLen / 2; i++) {
+        pBuffer[2 * i] = (float32_t)cos(2 * M_PI * i / fftLen);
+        pBuffer[2 * i + 1] = (float32_t)-sin(2 * M_PI * i / fftLen);
+    }
+
+    pBitReverseLUT = (uint16_t *)&pBuffer[fftLen];
+    for (i = 0; i < fftLen; i++) {
+        j = 0;
+        for (k = 0; k < log2Len; k++) {
+            j |= ((i >> k) & 1) << (log2Len - 1 - k);
+        }
+        pBitReverseLUT[i] = j;
+    }
+
+    S->FFTLength = fftLen;
+    S->bitReverseFlag = 1;
+    S->pTwiddleFactors = pBuffer;
+    S->pBitReverseLUT = pBitReverseLUT;
+
+    return 0;
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_init_l1_f32.c
+ * Description:  Copy of the floating-point FFT tables into L1
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Initializes an instance of the floating-point FFT structure with tables in L1
+ *
+ * Copies the twiddle factors and the bit reversal lookup table (if any) of an instance in L2,
+ * like plp_rfft_sR_f32_len2048, into pBuffer with the cluster DMA. pBuffer is meant to be
+ * allocated in L1, such that all later transforms with S (plp_cfft_f32, plp_rfft_f32,
+ * plp_rfft_packed_f32, plp_rifft_f32 and their parallel versions) load their twiddle factors at L1
+ * latency. In contrast to plp_cfft_init_f32, nothing is computed, and the copy is done once per
+ * length. Must be called by a single core of the cluster.
+ *
+ * @param[out]  S         points to the instance with the tables in pBuffer
+ * @param[in]   pSrc      points to the instance with the tables in L2
+ * @param[in]   pBuffer   points to a buffer of at least 3*FFTLength/2 32-bit words (as for
+ *                        plp_cfft_init_f32), which must stay valid as long as S is used. The
+ *                        twiddle factors are stored at the beginning, followed by the bit reversal
+ *                        lookup table.
+ * @return      0: Success, 1: called on the fabric controller
+ */
+
+int plp_cfft_init_l1_f32(plp_rfft_instance_f32 *S,
+                         const plp_rfft_instance_f32 *pSrc,
+                         float32_t *pBuffer) {
+    rt_dma_copy_t copyTwiddle;
+    rt_dma_copy_t copyBitRev;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA transfers supported only for cluster side\n");
+        return 1;
+    }
+
+    // FFTLength/2 complex twiddle factors, and FFTLength 16-bit entries of the lookup table
+    uint32_t nTwiddle = pSrc->FFTLength;
+    uint16_t *pBitReverseLUT = NULL;
+
+    plp_copy_dma(pSrc->pTwiddleFactors, pBuffer, nTwiddle * sizeof(float32_t),
+                 RT_DMA_DIR_EXT2LOC, &copyTwiddle);
+    if (pSrc->pBitReverseLUT != NULL) {
+        pBitReverseLUT = (uint16_t *)&pBuffer[nTwiddle];
+        plp_copy_dma(pSrc->pBitReverseLUT, pBitReverseLUT, pSrc->FFTLength * sizeof(uint16_t),
+                     RT_DMA_DIR_EXT2LOC, &copyBitRev);
+        plp_copy_dma_wait(&copyBitRev);
+    }
+    plp_copy_dma_wait(&copyTwiddle);
+
+    S->FFTLength = pSrc->FFTLength;
+    S->bitReverseFlag = pSrc->bitReverseFlag;
+    S->pTwiddleFactors = pBuffer;
+    S->pBitReverseLUT = pBitReverseLUT;
+
+    return 0;
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_init_l1_q32.c
+ * Description:  Copy of the 32-bit fixed-point CFFT tables into L1
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Initializes an instance of the 32bit quantized CFFT structure with tables in L1
+ *
+ * Copies the twiddle factors and the bit reversal table of an instance in L2, like
+ * plp_cfft_sR_q32_len256, into pBuffer with the cluster DMA. pBuffer is meant to be allocated in
+ * L1, such that all later transforms with S load their twiddle factors at L1 latency. In contrast
+ * to plp_cfft_init_q32, nothing is computed, and the copy is done once per length. Must be called
+ * by a single core of the cluster.
+ *
+ * @param[out]  S         points to the instance with the tables in pBuffer
+ * @param[in]   pSrc      points to the instance with the tables in L2
+ * @param[in]   pBuffer   points to a buffer of at least 2*fftLen 32-bit words (as for
+ *                        plp_cfft_init_q32), which must stay valid as long as S is used. The
+ *                        twiddle factors are stored at the beginning, followed by the bit reversal
+ *                        table.
+ * @return      0: Success, 1: called on the fabric controller
+ */
+
+int plp_cfft_init_l1_q32(plp_cfft_instance_q32 *S,
+                         const plp_cfft_instance_q32 *pSrc,
+                         int32_t *pBuffer) {
+    rt_dma_copy_t copyTwiddle;
+    rt_dma_copy_t copyBitRev;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("DMA transfers supported only for cluster side\n");
+        return 1;
+    }
+
+    // 3*fftLen/4 complex twiddle factors, and bitRevLength 16-bit entries of the bit reversal
+    // table, which start at a word boundary
+    uint32_t nTwiddle = 3 * pSrc->fftLen / 2;
+    uint32_t nBitRev = pSrc->bitRevLength;
+    int16_t *pBitRevTable = (int16_t *)&pBuffer[nTwiddle];
+
+    plp_copy_dma(pSrc->pTwiddle, pBuffer, nTwiddle * sizeof(int32_t), RT_DMA_DIR_EXT2LOC,
+                 &copyTwiddle);
+    plp_copy_dma(pSrc->pBitRevTable, pBitRevTable, nBitRev * sizeof(int16_t), RT_DMA_DIR_EXT2LOC,
+                 &copyBitRev);
+
+    plp_copy_dma_wait(&copyTwiddle);
+    plp_copy_dma_wait(&copyBitRev);
+
+    S->fftLen = pSrc->fftLen;
+    S->pTwiddle = pBuffer;
+    S->pBitRevTable = pBitRevTable;
+    S->bitRevLength = nBitRev;
+
+    return 0;
+}
+
+/**
+ * @} end of FFT group
+ */
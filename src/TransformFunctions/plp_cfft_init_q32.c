@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_init_q32.c
+ * Description:  Runtime initialization of the 32-bit fixed-point CFFT tables
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Initializes an instance of the 32bit quantized CFFT structure at runtime
+ *
+ * Generates the twiddle factors and the bit reversal table of the given length into pBuffer,
+ * instead of using the static tables of plp_cfft_sR_q32_len*. Only the tables of the sizes
+ * actually used are needed, and they can be put into L1 by passing a buffer allocated there. The
+ * values are the same as in the static tables (up to one LSB for q32), and the initialization only
+ * has to be done once per length.
+ *
+ * @param[out]  S         points to the instance of the 32bit quantized CFFT structure
+ * @param[in]   fftLen    length of the FFT, a power of two from 16 to 4096
+ * @param[in]   pBuffer   points to a buffer of at least 2*fftLen 32-bit words, which must stay valid as long
+ *                        as S is used. The twiddle factors are stored at the beginning, followed
+ *                        by the bit reversal table.
+ * @return      0: Success, 1: fftLen is not supported
+ */
+
+int plp_cfft_init_q32(plp_cfft_instance_q32 *S, uint16_t fftLen, int32_t *pBuffer) {
+    uint32_t i, j, k, n;
+    uint32_t log2Len = 0;
+    uint16_t *pBitRevTable;
+    double x;
+
+    if (fftLen < 16 || fftLen > 4096 || (fftLen & (fftLen - 1)) != 0) {
+        return 1;
+    }
+
+    while ((1U << log2Len) < fftLen) {
+        log2Len++;
+    }
+
+    // twiddle factors cos(2*pi*i/fftLen) and sin(2*pi*i/fftLen) for i < 3*fftLen/4, in Q1.31
+    for (i = 0; i < 3 * fftLen / 4; i++) {
+        for (k = 0; k < 2; k++) {
+            x = (k == 0) ? cos(2 * M_PI * i / fftLen) : sin(2 * M_PI * i / fftLen);
+            x = floor(x * 2147483648.0);
+            pBuffer[2 * i + k] = (x > 2147483647.0) ? 0x7FFFFFFF : (int32_t)x;
+        }
+    }
+
+    // pairs of byte offsets (of 8 byte complex words) of the elements swapped by the bit reversal
+    pBitRevTable = (uint16_t *)&pBuffer[3 * fftLen / 2];
+    n = 0;
+    for (i = 0; i < fftLen; i++) {
+        j = 0;
+        for (k = 0; k < log2Len; k++) {
+            j |= ((i >> k) & 1) << (log2Len - 1 - k);
+        }
+        if (i < j) {
+            pBitRevTable[n++] = 8 * i;
+            pBitRevTable[n++] = 8 * j;
+        }
+    }
+
+    S->fftLen = fftLen;
+    S->pTwiddle = pBuffer;
+    S->pBitRevTable = (const int16_t *)pBitRevTable;
+    S->bitRevLength = n;
+
+    return 0;
+}
+
+/**
+ * @} end of FFT group
+ */
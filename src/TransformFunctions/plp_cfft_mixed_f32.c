@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mixed_f32.c
+ * Description:  floating-point mixed-radix complex FFT glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Floating-point mixed-radix FFT on complex input data.
+   @param[in]      S         points to an instance of the floating-point mixed-radix FFT
+                             structure, initialized by plp_cfft_mixed_init_f32
+   @param[in,out]  p1        points to the complex data buffer of size <code>2*fftLen</code>.
+                             The result is written back to p1.
+   @param[in]      pScratch  points to a scratch buffer of size <code>2*fftLen</code>
+   @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+                             transform.
+   @return         none
+
+   @par Output Order and Scaling
+   The output is in natural order. The inverse transform is scaled by 1 / fftLen, such that the
+   inverse of the forward transform is the original input.
+*/
+void plp_cfft_mixed_f32(const plp_cfft_mixed_instance_f32 *S,
+                        float32_t *__restrict__ p1,
+                        float32_t *__restrict__ pScratch,
+                        uint8_t ifftFlag) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_cfft_mixed_f32s_xpulpv2(S, p1, pScratch, ifftFlag);
+}
+
+/**
+   @} end of FFT group
+*/
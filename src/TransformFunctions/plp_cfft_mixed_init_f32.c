@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mixed_init_f32.c
+ * Description:  floating-point mixed-radix FFT instance initialization
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Initializes an instance of the floating-point mixed-radix FFT structure
+ *
+ * Splits fftLen into radix-4, radix-2, radix-3 and radix-5 stages (in this order, with at most
+ * one radix-2 stage) and generates the fftLen twiddle factors into pBuffer. Lengths like 600, 1200
+ * or 1536, which are not a power of two, can be transformed without zero padding. The buffer can be
+ * allocated in L1.
+ *
+ * @param[out]  S         points to the instance of the floating-point mixed-radix FFT structure
+ * @param[in]   fftLen    length of the FFT, a product of at most PLP_CFFT_MIXED_MAX_FACTORS
+ *                        factors 2, 3, 4 and 5
+ * @param[in]   pBuffer   points to a buffer of at least 2*fftLen 32-bit words, which must stay valid as
+ *                        long as S is used
+ * @return      0: Success, 1: fftLen is not supported
+ */
+
+int plp_cfft_mixed_init_f32(plp_cfft_mixed_instance_f32 *S, uint32_t fftLen, float32_t *pBuffer) {
+    uint32_t i, k, n;
+    static const uint8_t radices[4] = { 4, 2, 3, 5 };
+
+    if (fftLen < 2) {
+        return 1;
+    }
+
+    n = fftLen;
+    S->nFactors = 0;
+    for (k = 0; k < 4; k++) {
+        while (n % radices[k] == 0) {
+            if (S->nFactors == PLP_CFFT_MIXED_MAX_FACTORS) {
+                return 1;
+            }
+            S->factors[S->nFactors++] = radices[k];
+            n /= radices[k];
+        }
+    }
+    if (n != 1) {
+        return 1;
+    }
+
+    // twiddle factors exp(-2*pi*j*i/fftLen) for i < fftLen
+    for (i = 0; i < fftLen; i++) {
+        pBuffer[2 * i] = (float32_t)cos(2 * M_PI * i / fftLen);
+        pBuffer[2 * i + 1] = (float32_t)-sin(2 * M_PI * i / fftLen);
+    }
+
+    S->fftLen = fftLen;
+    S->pTwiddle = (const Complex_type_f32 *)pBuffer;
+
+    return 0;
+}
+
+/**
+ * @} end of FFT group
+ */
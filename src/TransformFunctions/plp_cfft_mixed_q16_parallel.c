@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mixed_q16_parallel.c
+ * Description:  16-bit fixed-point mixed-radix complex FFT parallel glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief 16-bit fixed-point mixed-radix FFT on complex input data (parallel version).
+   @param[in]      S         points to an instance of the 16-bit fixed-point mixed-radix FFT
+                             structure, initialized by plp_cfft_mixed_init_q16
+   @param[in,out]  p1        points to the complex data buffer of size <code>2*fftLen</code>.
+                             The result is written back to p1.
+   @param[in]      pScratch  points to a scratch buffer of size <code>2*fftLen</code>
+   @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+                             transform.
+   @param[in]      nPE       number of parallel processing units
+   @return         none
+
+   @par Output Order and Scaling
+   The output is in natural order. Every stage divides its input by its radix to avoid overflow,
+   so the output of both the forward and the inverse transform is the DFT sum scaled by 1 / fftLen.
+   The magnitude of the complex input samples must not exceed 1 to avoid overflows.
+*/
+void plp_cfft_mixed_q16_parallel(const plp_cfft_mixed_instance_q16 *S,
+                                 int16_t *__restrict__ p1,
+                                 int16_t *__restrict__ pScratch,
+                                 uint8_t ifftFlag,
+                                 uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_cfft_mixed_instance_q16_parallel args = {
+        .S = S, .p1 = p1, .pScratch = pScratch, .ifftFlag = ifftFlag, .nPE = nPE
+    };
+
+    rt_team_fork(nPE, plp_cfft_mixed_q16p_xpulpv2, (void *)&args);
+}
+
+/**
+   @} end of FFT group
+*/
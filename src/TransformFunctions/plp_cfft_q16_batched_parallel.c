@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q16_batched_parallel.c
+ * Description:  Batched parallel 16-bit fixed-point complex FFT glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Glue code for a batch of parallel quantized 16 bit complex fast fourier transforms
+ *
+ * Computes nChannels independent transforms of the same length, with the same fixed point units as
+ * plp_cfft_q16. The cluster is forked only once for the whole batch, see
+ * plp_cfft_q16p_batched_xpulpv2 for the work distribution.
+ *
+ * @param[in]       S               points to an instance of the 16bit quantized CFFT structure, shared
+ *                                  by all channels
+ * @param[in,out]   pChannels       array of nChannels pointers to the complex data buffers of size
+ *                                  <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]       nChannels       number of independent transforms
+ * @param[in]       ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ *                                  transform.
+ * @param[in]       bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ *                                  (bitReverseFlag=0) bit reversal of output.
+ * @param[in]       deciPoint       decimal point for right shift
+ * @param[in]       nPE             Number of cores to use
+ */
+
+void plp_cfft_q16_batched_parallel(const plp_cfft_instance_q16 *S,
+                                   int16_t *const *pChannels,
+                                   uint32_t nChannels,
+                                   uint8_t ifftFlag,
+                                   uint8_t bitReverseFlag,
+                                   uint32_t deciPoint,
+                                   uint32_t nPE) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_cfft_instance_q16_batched_parallel args = { .S = S,
+                                                        .pChannels = pChannels,
+                                                        .nChannels = nChannels,
+                                                        .ifftFlag = ifftFlag,
+                                                        .bitReverseFlag = bitReverseFlag,
+                                                        .deciPoint = deciPoint,
+                                                        .nPE = nPE };
+
+        rt_team_fork(nPE, plp_cfft_q16p_batched_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,308 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q16_multicluster.c
+ * Description:  quantized 16 bit complex fast fourier transform on several clusters
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+// One pass of the multi-cluster transform on one cluster: the transforms of the channels first to
+// first+count-1. Element i of channel c is at pSrc[c + i * srcStride] if srcStride > 0, else at
+// pSrc[c * fftLen + i] (in complex values), and likewise for pDst.
+typedef struct {
+    const plp_cfft_instance_q16 *S; // transform of every channel
+    const int16_t *pTwiddle;        // twiddle factors of the whole transform, or NULL
+    uint32_t twiddleLen;            // length of the whole transform
+    const int16_t *pSrc;
+    uint32_t srcStride;
+    int16_t *pDst;
+    uint32_t dstStride;
+    uint32_t first;
+    uint32_t count;
+    uint32_t nPE;
+} plp_cfft_q16_multicluster_pass;
+
+// Block of channels in L1, pStrided holds them interleaved (element i of channel j at
+// i * nChannels + j) and pChannels[j] points to channel j in pContiguous.
+typedef struct {
+    const plp_cfft_q16_multicluster_pass *pass;
+    uint32_t *pStrided;
+    uint32_t *pContiguous;
+    int16_t *const *pChannels;
+    uint32_t first;
+    uint32_t nChannels;
+} plp_cfft_q16_multicluster_block;
+
+static inline int16_t plp_cfft_q16_multicluster_sat(int32_t x) {
+    return (int16_t)((x > 32767) ? 32767 : (x < -32768) ? -32768 : x);
+}
+
+/**
+ * @brief      Transforms a block of channels in L1, on all cores of the cluster.
+ * @param[in]  args  points to the plp_cfft_q16_multicluster_block
+ */
+
+static void plp_cfft_q16_multicluster_block_p(void *args) {
+
+    plp_cfft_q16_multicluster_block *b = (plp_cfft_q16_multicluster_block *)args;
+    const plp_cfft_q16_multicluster_pass *a = b->pass;
+    uint32_t core_id = rt_core_id();
+    uint32_t L = a->S->fftLen;
+    uint32_t n = b->nChannels;
+    uint32_t i, j;
+
+    if (a->srcStride > 0) {
+        for (j = core_id; j < n; j += a->nPE) {
+            for (i = 0; i < L; i++) {
+                b->pContiguous[j * L + i] = b->pStrided[i * n + j];
+            }
+        }
+        rt_team_barrier();
+    }
+
+    plp_cfft_instance_q16_batched_parallel fftArgs = { .S = a->S,
+                                                       .pChannels = b->pChannels,
+                                                       .nChannels = n,
+                                                       .ifftFlag = 0,
+                                                       .bitReverseFlag = 1,
+                                                       .deciPoint = 0,
+                                                       .nPE = a->nPE };
+    plp_cfft_q16p_batched_xpulpv2((void *)&fftArgs);
+    rt_team_barrier();
+
+    for (j = core_id; j < n; j += a->nPE) {
+        int16_t *pChannel = b->pChannels[j];
+
+        // multiply element k of channel c with exp(-2*pi*i * c*k / twiddleLen)
+        if (a->pTwiddle != NULL) {
+            uint32_t half = a->twiddleLen / 2;
+            for (i = 0; i < L; i++) {
+                uint32_t m = ((b->first + j) * i) % a->twiddleLen;
+                int32_t co, si;
+                if (m < half) {
+                    co = a->pTwiddle[2 * m];
+                    si = a->pTwiddle[2 * m + 1];
+                } else {
+                    co = -a->pTwiddle[2 * (m - half)];
+                    si = -a->pTwiddle[2 * (m - half) + 1];
+                }
+                int32_t re = pChannel[2 * i];
+                int32_t im = pChannel[2 * i + 1];
+                pChannel[2 * i] = plp_cfft_q16_multicluster_sat((re * co + im * si) >> 15);
+                pChannel[2 * i + 1] = plp_cfft_q16_multicluster_sat((im * co - re * si) >> 15);
+            }
+        }
+
+        if (a->dstStride > 0) {
+            for (i = 0; i < L; i++) {
+                b->pStrided[i * n + j] = b->pContiguous[j * L + i];
+            }
+        }
+    }
+}
+
+/**
+ * @brief      Runs one pass of the multi-cluster transform on the cluster, streaming blocks of
+ *             channels through L1 with the DMA.
+ * @param[in]  args  points to the plp_cfft_q16_multicluster_pass
+ */
+
+static void plp_cfft_q16_multicluster_entry(void *args) {
+
+    plp_cfft_q16_multicluster_pass *a = (plp_cfft_q16_multicluster_pass *)args;
+    uint32_t L = a->S->fftLen;
+    const uint32_t *pSrc = (const uint32_t *)a->pSrc;
+    uint32_t *pDst = (uint32_t *)a->pDst;
+
+    // largest block of channels which fits into the L1 budget
+    uint32_t channelSize = 2 * L * sizeof(uint32_t) + sizeof(int16_t *);
+    uint32_t nBlock = PLP_CFFT_MULTICLUSTER_L1_SIZE / channelSize;
+    if (nBlock > a->count) {
+        nBlock = a->count;
+    }
+
+    uint32_t bufferSize = nBlock * channelSize;
+    uint32_t *pBuffer = (uint32_t *)plp_scratch_alloc(bufferSize);
+
+    if (nBlock == 0 || pBuffer == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        plp_scratch_free(pBuffer, bufferSize);
+        return;
+    }
+
+    int16_t **pChannels = (int16_t **)(pBuffer + 2 * nBlock * L);
+    plp_cfft_q16_multicluster_block b = { .pass = a,
+                                          .pStrided = pBuffer,
+                                          .pContiguous = pBuffer + nBlock * L,
+                                          .pChannels = pChannels };
+    uint32_t c, j;
+    rt_dma_copy_t copy;
+
+    for (c = a->first; c < a->first + a->count; c += nBlock) {
+        uint32_t n = (a->first + a->count - c < nBlock) ? a->first + a->count - c : nBlock;
+        uint32_t size = n * L * sizeof(uint32_t);
+
+        if (a->srcStride > 0) {
+            rt_dma_memcpy_2d((unsigned int)(pSrc + c), (unsigned int)b.pStrided, size,
+                             a->srcStride * sizeof(uint32_t), n * sizeof(uint32_t),
+                             RT_DMA_DIR_EXT2LOC, 0, &copy);
+        } else {
+            rt_dma_memcpy((unsigned int)(pSrc + c * L), (unsigned int)b.pContiguous, size,
+                          RT_DMA_DIR_EXT2LOC, 0, &copy);
+        }
+
+        for (j = 0; j < n; j++) {
+            pChannels[j] = (int16_t *)(b.pContiguous + j * L);
+        }
+        b.first = c;
+        b.nChannels = n;
+        rt_dma_wait(&copy);
+
+        rt_team_fork(a->nPE, plp_cfft_q16_multicluster_block_p, (void *)&b);
+
+        if (a->dstStride > 0) {
+            rt_dma_memcpy_2d((unsigned int)(pDst + c), (unsigned int)b.pStrided, size,
+                             a->dstStride * sizeof(uint32_t), n * sizeof(uint32_t),
+                             RT_DMA_DIR_LOC2EXT, 0, &copy);
+        } else {
+            rt_dma_memcpy((unsigned int)(pDst + c * L), (unsigned int)b.pContiguous, size,
+                          RT_DMA_DIR_LOC2EXT, 0, &copy);
+        }
+        rt_dma_wait(&copy);
+    }
+
+    plp_scratch_free(pBuffer, bufferSize);
+}
+
+/**
+ * @brief      Runs one pass on several clusters, every cluster transforming a range of channels.
+ */
+
+static void plp_cfft_q16_multicluster_run(const plp_cfft_q16_multicluster_pass *pass,
+                                          uint32_t nChannels,
+                                          uint32_t nClusters) {
+
+    plp_offload_task_t tasks[ARCHI_NB_CLUSTER];
+    plp_cfft_q16_multicluster_pass args[ARCHI_NB_CLUSTER];
+    void *pArgs[ARCHI_NB_CLUSTER];
+
+    uint32_t count = (nChannels + nClusters - 1) / nClusters;
+    uint32_t cid;
+
+    for (cid = 0; cid < nClusters && cid * count < nChannels; cid++) {
+        args[cid] = *pass;
+        args[cid].first = cid * count;
+        args[cid].count = (nChannels - cid * count < count) ? nChannels - cid * count : count;
+        pArgs[cid] = (void *)&args[cid];
+    }
+
+    plp_offload_multicluster(tasks, cid, plp_cfft_q16_multicluster_entry, pArgs);
+}
+
+/**
+ * @brief      Glue code for quantized 16 bit complex fast fourier transform on several clusters,
+ *             called from the fabric controller.
+ *
+ * Computes the forward transform of length N = N1 * N2 with the same fixed point units as
+ * plp_cfft_q16, and the output in natural order. The data is seen as a matrix of N1 rows and N2
+ * columns (x[n1 * N2 + n2]):
+ * 1. The N2 columns are transformed (length N1) and multiplied with the twiddle factors
+ *    exp(-2*pi*i * n2*k1 / N). The result is stored in pBuffer, in the same layout.
+ * 2. The N1 rows of pBuffer are transformed (length N2), and X[k1 + N1 * k2] is stored in p1.
+ *
+ * In both steps, every cluster transforms a range of the columns (rows) with the batched
+ * parallel transform, streaming blocks of them through PLP_CFFT_MULTICLUSTER_L1_SIZE bytes of
+ * its L1 with the DMA. The clusters exchange the data through L2 between the steps. The call
+ * returns when all clusters are done, and needs nClusters events (see rt_event_alloc). No arena
+ * must be selected with plp_arena_use, such that every cluster allocates its buffers in its own
+ * L1.
+ *
+ * @param[in]      S          points to the instance of length N, of which only the twiddle
+ *                            factors are used
+ * @param[in]      SCols      points to the instance of length N1, N1 * N2 = N
+ * @param[in]      SRows      points to the instance of length N2, e.g. N1 = N2 = 64 for N = 4096
+ * @param[in,out]  p1         points to the complex data buffer of size <code>2*fftLen</code> (in
+ *                            L2). Processing occurs in-place.
+ * @param[out]     pBuffer    points to a buffer of size <code>2*fftLen</code> (in L2)
+ * @param[in]      nClusters  number of clusters to use, at most ARCHI_NB_CLUSTER
+ * @param[in]      nPE        number of cores to use on every cluster
+ */
+
+void plp_cfft_q16_multicluster(const plp_cfft_instance_q16 *S,
+                               const plp_cfft_instance_q16 *SCols,
+                               const plp_cfft_instance_q16 *SRows,
+                               int16_t *p1,
+                               int16_t *pBuffer,
+                               uint32_t nClusters,
+                               uint32_t nPE) {
+
+    if (rt_cluster_id() != ARCHI_FC_CID) {
+        printf("multi-cluster processing supported only for FC side\n");
+        return;
+    }
+
+    if ((uint32_t)SCols->fftLen * SRows->fftLen != S->fftLen) {
+        printf("Error: the lengths of the columns and rows do not match the transform\n");
+        return;
+    }
+
+    if (nClusters > ARCHI_NB_CLUSTER) {
+        nClusters = ARCHI_NB_CLUSTER;
+    }
+
+    plp_cfft_q16_multicluster_pass cols = { .S = SCols,
+                                            .pTwiddle = S->pTwiddle,
+                                            .twiddleLen = S->fftLen,
+                                            .pSrc = p1,
+                                            .srcStride = SRows->fftLen,
+                                            .pDst = pBuffer,
+                                            .dstStride = SRows->fftLen,
+                                            .nPE = nPE };
+    plp_cfft_q16_multicluster_run(&cols, SRows->fftLen, nClusters);
+
+    plp_cfft_q16_multicluster_pass rows = { .S = SRows,
+                                            .pTwiddle = NULL,
+                                            .twiddleLen = S->fftLen,
+                                            .pSrc = pBuffer,
+                                            .srcStride = 0,
+                                            .pDst = p1,
+                                            .dstStride = SCols->fftLen,
+                                            .nPE = nPE };
+    plp_cfft_q16_multicluster_run(&rows, SCols->fftLen, nClusters);
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -58,7 +58,8 @@
  * @param[in,out] 	p1           points to the complex data buffer of size <code>2*fftLen</code>.
  * Processing occurs in-place.
  * @param[in]  		ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
- * transform.
+ * transform. The inverse transform includes the scaling by 1/fftLen, so its output has the
+ * same fixed point format as the input.
  * @param[in]  		bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
  * (bitReverseFlag=0) bit reversal of output.
  * @param[in]  		deciPoint       decimal point for right shift
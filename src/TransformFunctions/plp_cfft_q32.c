@@ -45,6 +45,8 @@
  * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
  * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
  * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform. The inverse transform includes the scaling by 1/fftLen, so its output has the
+ * same fixed point format as the input.
  * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
  * (bitReverseFlag=0) bit reversal of output.
  * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
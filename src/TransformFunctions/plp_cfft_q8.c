@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q8.c
+ * Description:  Complex FFT of 8-bit fixed-point input
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for the quantized complex fast fourier transform of 8 bit input
+ *
+ * Computes the forward transform of the 8-bit input pSrc, e.g. the samples of an 8-bit ADC or
+ * the activations of a quantized network. The samples are widened to 16 bits while the first
+ * stage reads them, hence the input needs no 16-bit copy, and the result in p1 is the same as
+ * plp_cfft_q16 of the input shifted left by 8. If pDst is not NULL, the spectrum is additionally
+ * rounded to 8 bits with saturation, i.e. it is returned in the same units as the input scaled by
+ * the FFT.
+ *
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in]     pSrc            points to the complex 8-bit input of size <code>2*fftLen</code>,
+ *                                which is not modified
+ * @param[out]    p1              points to the complex 16-bit output of size
+ *                                <code>2*fftLen</code>, must not overlap pSrc
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]     deciPoint       decimal point for right shift
+ * @param[out]    pDst            points to the complex 8-bit output of size <code>2*fftLen</code>,
+ *                                may be equal to pSrc, or NULL to skip it
+ */
+
+void plp_cfft_q8(const plp_cfft_instance_q16 *S,
+                 const int8_t *pSrc,
+                 int16_t *p1,
+                 uint8_t bitReverseFlag,
+                 uint32_t deciPoint,
+                 int8_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cfft_q8s_rv32im(S, pSrc, p1, bitReverseFlag, deciPoint, pDst);
+    } else {
+        plp_cfft_q8s_xpulpv2(S, pSrc, p1, bitReverseFlag, deciPoint, pDst);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
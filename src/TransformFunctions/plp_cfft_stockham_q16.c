@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_stockham_q16.c
+ * Description:  16-bit fixed-point Stockham complex FFT glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief 16-bit fixed-point Stockham FFT on complex input data.
+   @param[in]   S         points to an instance of the 16-bit fixed-point CFFT structure, for
+                          example plp_cfft_sR_q16_len256. The bit reversal table is not used.
+   @param[in]   pSrc      points to the complex input buffer of size <code>2*fftLen</code>, which
+                          is not modified
+   @param[out]  pDst      points to the complex output buffer of size <code>2*fftLen</code>
+   @param[in]   pBuffer   points to a scratch buffer of size <code>2*fftLen</code>
+   @param[in]   ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+                          transform.
+   @return      none
+
+   @par Output Order and Scaling
+   The stages are out-of-place Stockham stages, which leave the output in natural order, so no
+   bit reversal pass (and no bit reversal table) is needed. Every stage divides its input by its
+   radix, so the output of both the forward and the inverse transform is the DFT sum scaled by
+   1 / fftLen, the same format as plp_cfft_q16. pSrc, pDst and pBuffer must not overlap.
+*/
+void plp_cfft_stockham_q16(const plp_cfft_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           int16_t *__restrict__ pDst,
+                           int16_t *__restrict__ pBuffer,
+                           uint8_t ifftFlag) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Stockham FFT is supported only for cluster side\n");
+        return;
+    }
+
+    plp_cfft_stockham_q16s_xpulpv2(S, pSrc, pDst, pBuffer, ifftFlag);
+}
+
+/**
+   @} end of FFT group
+*/
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_windowed_q16.c
+ * Description:  Windowed 16-bit fixed-point complex FFT
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for the windowed quantized 16 bit complex fast fourier transform
+ *
+ * Computes the forward transform of p1 multiplied with the window. The window is applied while
+ * the first stage reads the input, which saves a pass over the frame. The output has the same
+ * fixed point units as plp_cfft_q16.
+ *
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in]     pWindow         points to the first half of the window in Q1.15,
+ *                                PLP_WINDOW_LEN(fftLen) values, for example created by
+ *                                plp_window_hann_q16
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]     deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_windowed_q16(const plp_cfft_instance_q16 *S,
+                           const int16_t *pWindow,
+                           int16_t *p1,
+                           uint8_t bitReverseFlag,
+                           uint32_t deciPoint) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cfft_windowed_q16s_rv32im(S, pWindow, p1, bitReverseFlag, deciPoint);
+    } else {
+        plp_cfft_windowed_q16s_xpulpv2(S, pWindow, p1, bitReverseFlag, deciPoint);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
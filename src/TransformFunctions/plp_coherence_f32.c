@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_coherence_f32.c
+ * Description:  Glue code for the 32-bit floating-point coherence
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup CSD
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the magnitude-squared coherence of 32-bit floating-point signals
+ *
+ * @param[in]   S     points to the instance, initialized by plp_csd_init_f32
+ * @param[in]   pCsd  points to the cross-spectral densities computed by plp_csd_f32
+ * @param[in]   pPsd  points to the power spectral densities computed by plp_csd_f32
+ * @param[out]  pDst  points to the coherence |Pxy|^2 / (Pxx * Pyy) of the pairs,
+ *                    nPairs x (N/2 + 1) values. Bins without power in x or y are set to 0.
+ */
+
+void plp_coherence_f32(const plp_csd_instance_f32 *S,
+                       const float32_t *pCsd,
+                       const float32_t *pPsd,
+                       float32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_coherence_f32s_xpulpv2(S, pCsd, pPsd, pDst);
+}
+
+/**
+ * @} end of CSD group
+ */
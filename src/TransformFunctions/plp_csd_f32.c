@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_csd_f32.c
+ * Description:  Glue code for the 32-bit floating-point cross-spectral density
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup CSD Cross-Spectral Density
+ *
+ * Welch estimate of the cross-spectral densities of pairs of channels, e.g. of the sensors of a
+ * structural-health monitoring system, and the coherence of the pairs. The signals are split into
+ * segments of N samples, the length of the real FFT, which start every hop samples. For every
+ * pair (x, y), the cross-spectral density is the mean over all segments of
+ *
+ *     Pxy[b] = scale * conj(X[b]) * Y[b],   b = 0 .. N/2,
+ *
+ * where X and Y are the windowed spectra of the segment of channel x and y. The power spectral
+ * densities Pxx of the channels are computed alongside, as they are needed for the coherence
+ * |Pxy|^2 / (Pxx * Pyy), which plp_coherence_f32 computes. No factor two is applied to the bins
+ * of a one-sided density; it cancels in the coherence.
+ *
+ * Every channel of a segment is transformed only once, no matter in how many pairs it takes part,
+ * with plp_rfft_windowed_f32. The spectra of nSegBuf segments are kept in the buffer of the
+ * instance, and the conjugate products are accumulated with one fused multiply-accumulate pass
+ * per pair and bin over all segments of the buffer.
+ *
+ * The parallel version splits the segments and channels of the buffer among the cores for the
+ * FFTs, and the pairs and bins for the accumulation. With nSegBuf * nChannels a multiple of nPE,
+ * all cores compute the same number of FFTs. The instance is created with plp_csd_init_f32.
+ */
+
+/**
+ * @addtogroup CSD
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the cross-spectral density of 32-bit floating-point signals
+ *
+ * @param[in]   S          points to the instance, initialized by plp_csd_init_f32
+ * @param[in]   pSrc       points to the signals, nChannels x nSamples
+ * @param[in]   nSamples   number of samples of every channel
+ * @param[out]  pCsd       points to the cross-spectral densities, nPairs x (N/2 + 1) complex
+ *                         values, i.e. bin b of pair p is at pCsd[2 * (p * (N/2 + 1) + b)]
+ * @param[out]  pPsd       points to the power spectral densities of the channels,
+ *                         nChannels x (N/2 + 1) values, or NULL if they are not needed
+ *
+ * @par The ((nSamples - N) / hop + 1) segments start at sample 0; the samples after the last
+ * segment are not used.
+ */
+
+void plp_csd_f32(const plp_csd_instance_f32 *S,
+                 const float32_t *pSrc,
+                 uint32_t nSamples,
+                 float32_t *pCsd,
+                 float32_t *pPsd) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_csd_f32s_xpulpv2(S, pSrc, nSamples, pCsd, pPsd);
+}
+
+/**
+ * @} end of CSD group
+ */
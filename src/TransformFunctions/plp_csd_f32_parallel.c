@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_csd_f32_parallel.c
+ * Description:  Glue code for the parallel 32-bit floating-point cross-spectral density
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup CSD
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the parallel cross-spectral density of 32-bit floating-point signals
+ *
+ * @param[in]   S          points to the instance, initialized by plp_csd_init_f32
+ * @param[in]   pSrc       points to the signals, nChannels x nSamples
+ * @param[in]   nSamples   number of samples of every channel
+ * @param[in]   nPE        number of cores to use
+ * @param[out]  pCsd       points to the cross-spectral densities, nPairs x (N/2 + 1) complex
+ *                         values, i.e. bin b of pair p is at pCsd[2 * (p * (N/2 + 1) + b)]
+ * @param[out]  pPsd       points to the power spectral densities of the channels,
+ *                         nChannels x (N/2 + 1) values, or NULL if they are not needed
+ */
+
+void plp_csd_f32_parallel(const plp_csd_instance_f32 *S,
+                          const float32_t *pSrc,
+                          uint32_t nSamples,
+                          uint32_t nPE,
+                          float32_t *pCsd,
+                          float32_t *pPsd) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_csd_instance_f32_parallel args = { .S = S,
+                                               .pSrc = pSrc,
+                                               .nSamples = nSamples,
+                                               .nPE = nPE,
+                                               .pCsd = pCsd,
+                                               .pPsd = pPsd };
+
+        rt_team_fork(nPE, plp_csd_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+ * @} end of CSD group
+ */
@@ -0,0 +1,99 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_csd_init_f32.c
+ * Description:  Initialization of the 32-bit floating-point cross-spectral density
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup CSD
+ * @{
+ */
+
+/**
+ * @brief      Initializes an instance of the 32-bit floating-point cross-spectral density
+ *
+ * @param[out]  S          points to the instance
+ * @param[in]   pRfft      points to the real FFT instance, whose length N is the segment length
+ *                         and whose output is in natural order (bitReverseFlag = 1)
+ * @param[in]   pWindow    points to the first half of the window, PLP_WINDOW_LEN(N) values, or
+ *                         NULL for a rectangular window
+ * @param[in]   hop        number of samples between the starts of two segments, at most N
+ * @param[in]   nChannels  number of channels
+ * @param[in]   pPairs     points to nPairs pairs (x, y) of channel indices
+ * @param[in]   nPairs     number of pairs
+ * @param[in]   nSegBuf    number of segments which are transformed at once
+ * @param[in]   pSpec      points to the spectra buffer of PLP_CSD_SPEC_LEN(N, nChannels, nSegBuf)
+ *                         values
+ * @param[in]   scale      factor of the averaged products, e.g. 1 / (fs * sum(w^2)) for a density
+ * @return      0: Success, 1: hop, nSegBuf or a channel index is not supported
+ *
+ * @par All buffers must stay valid as long as S is used.
+ */
+
+int plp_csd_init_f32(plp_csd_instance_f32 *S,
+                     const plp_rfft_instance_f32 *pRfft,
+                     const float32_t *pWindow,
+                     uint32_t hop,
+                     uint32_t nChannels,
+                     const uint16_t *pPairs,
+                     uint32_t nPairs,
+                     uint32_t nSegBuf,
+                     float32_t *pSpec,
+                     float32_t scale) {
+
+    uint32_t i;
+
+    if (hop == 0 || hop > pRfft->FFTLength || nSegBuf == 0) {
+        return 1;
+    }
+
+    for (i = 0; i < 2 * nPairs; i++) {
+        if (pPairs[i] >= nChannels) {
+            return 1;
+        }
+    }
+
+    S->pRfft = pRfft;
+    S->pWindow = pWindow;
+    S->hop = hop;
+    S->nChannels = nChannels;
+    S->pPairs = pPairs;
+    S->nPairs = nPairs;
+    S->nSegBuf = nSegBuf;
+    S->pSpec = pSpec;
+    S->scale = scale;
+
+    return 0;
+}
+
+/**
+ * @} end of CSD group
+ */
@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_init_q32.c
+ * Description:  Initialization of the 32-bit fixed-point DCT-II
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// x in Q1.31, rounded and saturated
+static inline int32_t plp_dct2_init_to_q32(double x) {
+    x = floor(x * 2147483648.0 + 0.5);
+    return (x > 2147483647.0) ? 0x7FFFFFFF : (int32_t)x;
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup DCT
+ * @{
+ */
+
+/**
+ * @brief      Initializes an instance of the 32-bit fixed-point DCT-II of length N
+ *
+ * Computes the twiddle factors as pairs of cosine and sine into pTwiddle. The initialization
+ * only has to be done once per length, and the tables can be put into L1 by passing buffers
+ * allocated there.
+ *
+ * @param[out]  S         points to the instance
+ * @param[in]   pCfft     points to the complex FFT instance of length N/2 for
+ *                        example plp_cfft_sR_q32_len* or created by plp_cfft_init_q32
+ * @param[out]  pTwiddle  points to a buffer of PLP_DCT2_TWIDDLE_LEN(N) = 3*N/2 + 2 values
+ * @param[in]   pBuffer   points to a work buffer of N values
+ * @return      0: Success
+ *
+ * All buffers must stay valid as long as S is used.
+ */
+
+int plp_dct2_init_q32(plp_dct2_instance_q32 *S,
+                      const plp_cfft_instance_q32 *pCfft,
+                      int32_t *pTwiddle,
+                      int32_t *pBuffer) {
+    uint32_t k;
+    uint32_t N = 2 * pCfft->fftLen;
+
+    // exp(-2j*pi*k/N) for the split into the spectrum of the real input, k = 0 .. N/4
+    for (k = 0; k <= N / 4; k++) {
+        pTwiddle[2 * k] = plp_dct2_init_to_q32(cos(2 * M_PI * k / N));
+        pTwiddle[2 * k + 1] = plp_dct2_init_to_q32(sin(2 * M_PI * k / N));
+    }
+
+    // exp(-j*pi*k/(2N)) for the rotation of the spectrum into the DCT-II, k = 0 .. N/2-1
+    for (k = 0; k < N / 2; k++) {
+        pTwiddle[N / 2 + 2 + 2 * k] = plp_dct2_init_to_q32(cos(M_PI * k / (2 * N)));
+        pTwiddle[N / 2 + 2 + 2 * k + 1] = plp_dct2_init_to_q32(sin(M_PI * k / (2 * N)));
+    }
+
+    S->N = N;
+    S->pCfft = pCfft;
+    S->pTwiddle = pTwiddle;
+    S->pBuffer = pBuffer;
+
+    return 0;
+}
+
+/**
+ * @} end of DCT group
+ */
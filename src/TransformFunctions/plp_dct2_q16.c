@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_q16.c
+ * Description:  16-bit fixed-point DCT-II glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup DCT Discrete Cosine Transforms
+ * DCT-II, DCT-IV and MDCT of real signals of length N, a power of two, computed with the complex
+ * FFT of length N/2 and precomputed twiddle factors in O(N log(N)) instead of O(N^2) operations:
+ *
+ * <pre>
+ *     DCT-II:  X[k] = sum_{n=0}^{N-1} x[n] cos(pi/N (n + 1/2) k)
+ *     DCT-IV:  X[k] = sum_{n=0}^{N-1} x[n] cos(pi/N (n + 1/2) (k + 1/2))
+ *     MDCT:    X[k] = sum_{n=0}^{2N-1} x[n] cos(pi/N (n + 1/2 + N/2) (k + 1/2))
+ * </pre>
+ *
+ * for k = 0 .. N-1. The transforms are not normalized. The MDCT of 2N input samples is folded into
+ * N samples and computed with the DCT-IV of length N, hence it uses the same instance. A window,
+ * if any, has to be applied to the input beforehand.
+ *
+ * The instances are created with plp_dct2_init_<type> and plp_dct4_init_<type> from a complex FFT
+ * instance of length N/2 (e.g. plp_cfft_sR_q16_len64 or created by plp_cfft_init_q16 for N = 128),
+ * which can be shared with other transforms. The fixed-point transforms are scaled by one over the
+ * number of input samples, like the FFT, and the input is halved before the FFT, such that no
+ * intermediate value can overflow.
+ */
+
+/**
+ * @addtogroup DCT
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the DCT-II of 16-bit fixed-point data
+ *
+ * @param[in]   S       points to the instance, initialized by plp_dct2_init_q16
+ * @param[in]   pSrc    points to the input buffer of N values
+ * @param[out]  pDst    points to the output buffer of N values.
+ *                      pSrc and pDst may point to the same buffer.
+ *
+ * @par Scaling
+ * The input is in Q1.15, and the output is the transform scaled by 1/N in Q1.15,
+ * such that it cannot overflow.
+ */
+
+void plp_dct2_q16(const plp_dct2_instance_q16 *S,
+                  const int16_t *pSrc,
+                  int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_dct2_q16s_rv32im(S, pSrc, pDst);
+    } else {
+        plp_dct2_q16s_xpulpv2(S, pSrc, pDst);
+    }
+}
+
+/**
+ * @} end of DCT group
+ */
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_q16_parallel.c
+ * Description:  Parallel 16-bit fixed-point DCT-II glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup DCT
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the parallel DCT-II of 16-bit fixed-point data
+ *
+ * @param[in]   S       points to the instance, initialized by plp_dct2_init_q16
+ * @param[in]   pSrc    points to the input buffer of N values
+ * @param[in]   nPE     number of cores to use
+ * @param[out]  pDst    points to the output buffer of N values.
+ *                      pSrc and pDst may point to the same buffer.
+ *
+ * @par Scaling
+ * The input is in Q1.15, and the output is the transform scaled by 1/N in Q1.15,
+ * such that it cannot overflow.
+ */
+
+void plp_dct2_q16_parallel(const plp_dct2_instance_q16 *S,
+                           const int16_t *pSrc,
+                           uint32_t nPE,
+                           int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_dct2_instance_q16_parallel args = {
+            .S = S, .pSrc = pSrc, .nPE = nPE, .pDst = pDst
+        };
+
+        rt_team_fork(nPE, plp_dct2_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+ * @} end of DCT group
+ */
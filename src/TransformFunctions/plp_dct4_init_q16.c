@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_init_q16.c
+ * Description:  Initialization of the 16-bit fixed-point DCT-IV
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// x in Q1.15, rounded and saturated
+static inline int16_t plp_dct4_init_to_q16(double x) {
+    x = floor(x * 32768.0 + 0.5);
+    return (x > 32767.0) ? 0x7FFF : (int16_t)x;
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup DCT
+ * @{
+ */
+
+/**
+ * @brief      Initializes an instance of the 16-bit fixed-point DCT-IV (and MDCT) of length N
+ *
+ * Computes the twiddle factors as pairs of cosine and sine into pTwiddle. The initialization
+ * only has to be done once per length, and the tables can be put into L1 by passing buffers
+ * allocated there.
+ *
+ * @param[out]  S         points to the instance
+ * @param[in]   pCfft     points to the complex FFT instance of length N/2 for
+ *                        example plp_cfft_sR_q16_len* or created by plp_cfft_init_q16
+ * @param[out]  pTwiddle  points to a buffer of PLP_DCT4_TWIDDLE_LEN(N) = 2*N values
+ * @param[in]   pBuffer   points to a work buffer of N values
+ * @return      0: Success
+ *
+ * All buffers must stay valid as long as S is used.
+ */
+
+int plp_dct4_init_q16(plp_dct4_instance_q16 *S,
+                      const plp_cfft_instance_q16 *pCfft,
+                      int16_t *pTwiddle,
+                      int16_t *pBuffer) {
+    uint32_t k;
+    uint32_t N = 2 * pCfft->fftLen;
+
+    // exp(-j*pi*(4n+1)/(4N)) for the rotation of the input, n = 0 .. N/2-1
+    for (k = 0; k < N / 2; k++) {
+        pTwiddle[2 * k] = plp_dct4_init_to_q16(cos(M_PI * (4 * k + 1) / (4 * N)));
+        pTwiddle[2 * k + 1] = plp_dct4_init_to_q16(sin(M_PI * (4 * k + 1) / (4 * N)));
+    }
+
+    // exp(-j*pi*k/N) for the rotation of the spectrum into the DCT-IV, k = 0 .. N/2-1
+    for (k = 0; k < N / 2; k++) {
+        pTwiddle[N + 2 * k] = plp_dct4_init_to_q16(cos(M_PI * k / N));
+        pTwiddle[N + 2 * k + 1] = plp_dct4_init_to_q16(sin(M_PI * k / N));
+    }
+
+    S->N = N;
+    S->pCfft = pCfft;
+    S->pTwiddle = pTwiddle;
+    S->pBuffer = pBuffer;
+
+    return 0;
+}
+
+/**
+ * @} end of DCT group
+ */
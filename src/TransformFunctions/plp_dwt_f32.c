@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dwt_f32.c
+ * Description:  Discrete wavelet transform of 32-bit floating-point samples
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup DWT
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the discrete wavelet transform of 32-bit floating-point samples
+ *
+ * @param[in,out]  pSrcDst    points to the block of samples, overwritten by the
+ *                            coefficients [a_L | d_L | ... | d_1]
+ * @param[in]      blockSize  number of samples, a multiple of 2^nLevels
+ * @param[in]      wavelet    wavelet of the transform
+ * @param[in]      nLevels    number of levels of the decomposition
+ * @param[in]      pTmp       points to a temporary buffer of blockSize values
+ *
+ * @par
+ * The transform is orthonormal for the orthogonal wavelets (Haar and db4).
+ */
+
+void plp_dwt_f32(float32_t *pSrcDst,
+                 uint32_t blockSize,
+                 plp_dwt_wavelet_t wavelet,
+                 uint32_t nLevels,
+                 float32_t *pTmp) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_dwt_f32s_xpulpv2(pSrcDst, blockSize, wavelet, nLevels, pTmp);
+    }
+}
+
+/**
+ * @} end of DWT group
+ */
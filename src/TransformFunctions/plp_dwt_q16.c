@@ -0,0 +1,112 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dwt_q16.c
+ * Description:  Discrete wavelet transform of 16-bit fixed-point samples
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup DWT Discrete Wavelet Transform
+ *
+ * Multi-level discrete wavelet transform with the lifting scheme. Every level splits the first
+ * n samples of the block into the even samples s and the odd samples d, and applies a sequence
+ * of lifting steps
+ *
+ * <pre>
+ *     predict:  d[k] += c0 s[k + o] + c1 s[k + o + 1]
+ *     update:   s[k] += c0 d[k + o] + c1 d[k + o + 1]
+ * </pre>
+ *
+ * with periodic indices, followed by a scaling of s and d. The approximation s is stored in the
+ * first n/2 samples and the detail d in the next n/2 samples, and the next level works on the
+ * approximation only. After nLevels levels, the block holds
+ *
+ * <pre>
+ *     [a_L | d_L | d_(L-1) | ... | d_1]
+ * </pre>
+ *
+ * where the detail d_l of level l has blockSize / 2^l coefficients, and blockSize must be a
+ * multiple of 2^nLevels. The inverse transform undoes the steps in reverse order, which
+ * reconstructs the input exactly up to rounding, whatever the boundary handling.
+ *
+ * The supported wavelets (plp_dwt_wavelet_t) are
+ *  - PLP_DWT_HAAR: Haar, two lifting steps,
+ *  - PLP_DWT_DB4: Daubechies with four vanishing moments (8 taps), five lifting steps,
+ *  - PLP_DWT_CDF97: biorthogonal Cohen-Daubechies-Feauveau 9/7 (as in JPEG 2000), four steps.
+ *
+ * The borders are periodic, hence the orthogonal wavelets match the periodized filter bank (for
+ * db4, up to a circular shift of every band). Compared to filtering with the decimated filter
+ * bank, lifting needs about half the multiplications, and needs no extra buffer for the
+ * convolution. The lifting coefficients are stored in dwtLiftingTable_f32 and
+ * dwtLiftingTable_q16.
+ *
+ * The parallel versions transform nChannels independent blocks (e.g. the leads of an ECG), which
+ * are split into chunks for the cores.
+ */
+
+/**
+ * @addtogroup DWT
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the discrete wavelet transform of 16-bit fixed-point samples
+ *
+ * @param[in,out]  pSrcDst    points to the block of samples, overwritten by the
+ *                            coefficients [a_L | d_L | ... | d_1]
+ * @param[in]      blockSize  number of samples, a multiple of 2^nLevels
+ * @param[in]      wavelet    wavelet of the transform
+ * @param[in]      nLevels    number of levels of the decomposition
+ * @param[in]      pTmp       points to a temporary buffer of blockSize values
+ *
+ * @par Fix-Point and Scaling
+ * The lifting steps are computed in 32 bits with coefficients in Q2.29 and 64-bit products, and
+ * the coefficients are rounded to 16 bits with saturation after every level. To keep the range,
+ * the approximation and the detail of every level are scaled by 1/sqrt(2) compared to the
+ * orthonormal transform (the Haar approximation is the mean of two samples), hence the level l
+ * is scaled by 2^(-l/2).
+ */
+
+void plp_dwt_q16(int16_t *pSrcDst,
+                 uint32_t blockSize,
+                 plp_dwt_wavelet_t wavelet,
+                 uint32_t nLevels,
+                 int32_t *pTmp) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_dwt_q16s_rv32im(pSrcDst, blockSize, wavelet, nLevels, pTmp);
+    } else {
+        plp_dwt_q16s_xpulpv2(pSrcDst, blockSize, wavelet, nLevels, pTmp);
+    }
+}
+
+/**
+ * @} end of DWT group
+ */
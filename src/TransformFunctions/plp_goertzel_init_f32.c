@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel_init_f32.c
+ * Description:  Initialization of the 32-bit floating-point Goertzel algorithm
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief      Initializes an instance of the 32-bit floating-point Goertzel algorithm
+ *
+ * Computes cos(2 pi f) and sin(2 pi f) of every frequency into pCoeffs. The initialization only
+ * has to be done once for a set of frequencies.
+ *
+ * @param[out]  S          points to the instance
+ * @param[in]   pFreq      points to the nBins frequencies, normalized to the sample rate
+ *                         (f / fs, from 0 to 0.5)
+ * @param[in]   nBins      number of frequencies
+ * @param[out]  pCoeffs    points to a buffer of 2 * nBins values
+ * @return      0: Success, 1: a frequency is out of range
+ *
+ * The buffer must stay valid as long as S is used.
+ */
+
+int plp_goertzel_init_f32(plp_goertzel_instance_f32 *S,
+                          const float32_t *pFreq,
+                          uint32_t nBins,
+                          float32_t *pCoeffs) {
+    uint32_t k;
+
+    for (k = 0; k < nBins; k++) {
+        if (!(pFreq[k] >= 0.0f && pFreq[k] <= 0.5f)) {
+            return 1;
+        }
+        pCoeffs[2 * k] = (float32_t)cos(2 * M_PI * pFreq[k]);
+        pCoeffs[2 * k + 1] = (float32_t)sin(2 * M_PI * pFreq[k]);
+    }
+
+    S->nBins = nBins;
+    S->pCoeffs = pCoeffs;
+
+    return 0;
+}
+
+/**
+ * @} end of Goertzel group
+ */
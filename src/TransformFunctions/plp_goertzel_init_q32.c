@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel_init_q32.c
+ * Description:  Initialization of the 32-bit fixed-point Goertzel algorithm
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// rounds x in [-1, 1] to Q1.31, saturating 1
+static int32_t plp_goertzel_to_q32(double x) {
+    double y = floor(x * 2147483648.0 + 0.5);
+    return (y > 0x7FFFFFFF) ? 0x7FFFFFFF : (int32_t)y;
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief      Initializes an instance of the 32-bit fixed-point Goertzel algorithm
+ *
+ * Computes cos(2 pi f) and sin(2 pi f) of every frequency into pCoeffs. The initialization only
+ * has to be done once for a set of frequencies.
+ *
+ * @param[out]  S          points to the instance
+ * @param[in]   pFreq      points to the nBins frequencies, normalized to the sample rate
+ *                         (f / fs, from 0 to 0.5)
+ * @param[in]   nBins      number of frequencies
+ * @param[in]   shift      right shift of the input samples, see plp_goertzel_q32
+ * @param[out]  pCoeffs    points to a buffer of 2 * nBins values in Q1.31
+ * @return      0: Success, 1: a frequency is out of range
+ *
+ * The buffer must stay valid as long as S is used.
+ */
+
+int plp_goertzel_init_q32(plp_goertzel_instance_q32 *S,
+                          const float32_t *pFreq,
+                          uint32_t nBins,
+                          uint32_t shift,
+                          int32_t *pCoeffs) {
+    uint32_t k;
+
+    for (k = 0; k < nBins; k++) {
+        if (!(pFreq[k] >= 0.0f && pFreq[k] <= 0.5f)) {
+            return 1;
+        }
+        pCoeffs[2 * k] = plp_goertzel_to_q32(cos(2 * M_PI * pFreq[k]));
+        pCoeffs[2 * k + 1] = plp_goertzel_to_q32(sin(2 * M_PI * pFreq[k]));
+    }
+
+    S->nBins = nBins;
+    S->pCoeffs = pCoeffs;
+    S->shift = shift;
+
+    return 0;
+}
+
+/**
+ * @} end of Goertzel group
+ */
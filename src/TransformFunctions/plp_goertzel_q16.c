@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel_q16.c
+ * Description:  Goertzel algorithm on 16-bit fixed-point samples
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel
+ *
+ * Evaluates the spectrum of a block at a few frequencies with the Goertzel algorithm. Every
+ * frequency f (in cycles per sample, 0 <= f <= 0.5) is a second order resonator
+ *
+ * <pre>
+ *     s[n] = x[n] + 2 cos(2 pi f) s[n-1] - s[n-2]
+ * </pre>
+ *
+ * which needs one multiplication per sample. After blockSize samples, the output is
+ *
+ * <pre>
+ *     y = exp(j 2 pi f) s[blockSize-1] - s[blockSize-2]
+ *       = exp(j 2 pi f blockSize) * sum_n x[n] exp(-j 2 pi f n)
+ * </pre>
+ *
+ * For f = k/blockSize, this is the bin k of the DFT of the block. For other frequencies, the
+ * magnitude is the one of the DTFT, and the phase is rotated by 2 pi f blockSize. Evaluating K
+ * frequencies costs K multiplications per sample, compared to about 2 log2(N) for a full FFT,
+ * which makes it cheaper for a few bins (e.g., DTMF or pilot tone detection).
+ *
+ * The kernels update the resonators of four frequencies per pass over the block, such that every
+ * sample is loaded once for four frequencies. The parallel versions split the frequencies into
+ * chunks for the cores, each of which passes over the whole block.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the Goertzel algorithm on a block of 16-bit fixed-point samples
+ *
+ * @param[in]   S          points to the instance, initialized by plp_goertzel_init_q16
+ * @param[in]   pSrc       points to the block of input samples
+ * @param[in]   blockSize  number of input samples
+ * @param[out]  pDst       points to the output, a complex value {re, im} for every frequency
+ *                         (2 * nBins values)
+ *
+ * @par Fix-Point and Scaling
+ * The samples are shifted right by S->shift and fed into resonators with 32-bit states. The
+ * frequencies are stored as cos and sin in Q1.31 (the phase error of coefficients in Q1.15
+ * would grow with blockSize), and the products with the states are computed with 64 bits. The states grow up to blockSize * min(blockSize, 1 / |sin(2 pi f)|) times the
+ * amplitude of the input, which must fit into 32 bits after the shift. The output has the same
+ * fixed-point format as the input, divided by 2^shift.
+ */
+
+void plp_goertzel_q16(const plp_goertzel_instance_q16 *S,
+                      const int16_t *pSrc,
+                      uint32_t blockSize,
+                      int32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_goertzel_q16s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_goertzel_q16s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_idwt_q16_parallel.c
+ * Description:  Parallel inverse discrete wavelet transform of 16-bit fixed-point samples
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup DWT
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the parallel inverse discrete wavelet transform of 16-bit fixed-point
+ *             samples
+ *
+ * @param[in,out]  pSrcDst    points to the coefficients of the nChannels blocks,
+ *                            overwritten by the reconstructed samples
+ * @param[in]      blockSize  number of samples of every block, a multiple of 2^nLevels
+ * @param[in]      nChannels  number of blocks
+ * @param[in]      wavelet    wavelet of the transform
+ * @param[in]      nLevels    number of levels of the decomposition
+ * @param[in]      nPE        number of cores to use
+ * @param[in]      pTmp       points to a temporary buffer of nPE * blockSize values
+ *
+ * @par Parallelization
+ * The blocks are split into nPE chunks, hence at most nChannels cores are busy. Every core
+ * uses its own blockSize values of pTmp.
+ *
+ * @par Fix-Point and Scaling
+ * The input is scaled as the output of plp_dwt_q16, and is reconstructed with an error of a few
+ * LSB.
+ */
+
+void plp_idwt_q16_parallel(int16_t *pSrcDst,
+                           uint32_t blockSize,
+                           uint32_t nChannels,
+                           plp_dwt_wavelet_t wavelet,
+                           uint32_t nLevels,
+                           uint32_t nPE,
+                           int32_t *pTmp) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_dwt_instance_q16_parallel args = {
+            .pSrcDst = pSrcDst, .blockSize = blockSize, .nChannels = nChannels,
+            .wavelet = wavelet, .nLevels = nLevels, .nPE = nPE, .pTmp = pTmp
+        };
+
+        rt_team_fork(nPE, plp_idwt_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+ * @} end of DWT group
+ */
@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_f32.c
+ * Description:  Glue code for the MFCC of 32-bit floating-point frames
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the MFCC of a frame of 32-bit floating-point samples
+ *
+ * @param[in]   S       points to the instance, initialized by plp_mfcc_init_f32
+ * @param[in]   pSrc    points to the frame of fftLen samples
+ * @param[out]  pDst    points to the nCoef cepstral coefficients
+ *
+ * @par Scaling
+ * The spectrum is not scaled. The cepstral coefficients are the DCT-II of the natural logarithm
+ * of the mel energies, which are limited to at least 1e-30.
+ */
+
+void plp_mfcc_f32(const plp_mfcc_instance_f32 *S,
+                  const float32_t *pSrc,
+                  float32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_mfcc_f32s_xpulpv2(S, pSrc, pDst);
+}
+
+/**
+ * @} end of MFCC group
+ */
@@ -0,0 +1,158 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_init_f32.c
+ * Description:  Initialization of the 32-bit floating-point MFCC
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// frequency in Hz to mel (HTK formula) and back
+static inline double plp_mfcc_init_to_mel(double f) {
+    return 2595.0 * log10(1.0 + f / 700.0);
+}
+
+static inline double plp_mfcc_init_to_hz(double mel) {
+    return 700.0 * (pow(10.0, mel / 2595.0) - 1.0);
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief      Initializes an instance of the 32-bit floating-point MFCC
+ *
+ * Computes the sparse mel filter bank and the DCT-II matrix. The nMel triangular filters have a
+ * peak of one, and their edges are equally spaced on the mel scale between fMin and fMax. Only
+ * the non-zero span of every filter is stored: pMelIndex[m] is the first bin of filter m, and its
+ * weights are pMelWeights[pMelIndex[nMel + m]] to pMelWeights[pMelIndex[nMel + m + 1] - 1]. The
+ * bins of the filters are limited to 0 .. N/2 - 1, the Nyquist bin is not used. The DCT-II matrix
+ * is orthonormal. The initialization only has to be done once, and the tables can be put into L1
+ * by passing buffers allocated there.
+ *
+ * @param[out]  S            points to the instance
+ * @param[in]   pCfft        points to the complex FFT instance of length fftLen/2 with
+ *                           bitReverseFlag=1, for example created by plp_cfft_init_f32
+ * @param[in]   pWindow      points to the first half of the window, PLP_WINDOW_LEN(fftLen)
+ *                           values (see plp_window_hann_f32), or NULL for a rectangular window
+ * @param[in]   sampleRate   sample rate in Hz
+ * @param[in]   fMin         lower edge of the first mel filter in Hz
+ * @param[in]   fMax         upper edge of the last mel filter in Hz, at most sampleRate/2
+ * @param[in]   nMel         number of mel filters
+ * @param[in]   nCoef        number of cepstral coefficients, at most nMel
+ * @param[out]  pMelIndex    points to a buffer of PLP_MFCC_INDEX_LEN(nMel) = 2*nMel + 1 values
+ * @param[out]  pMelWeights  points to a buffer of PLP_MFCC_WEIGHTS_LEN(fftLen) values
+ * @param[out]  pDct         points to a buffer of nCoef*nMel values
+ * @param[out]  pTwiddle     points to a buffer of PLP_MFCC_TWIDDLE_LEN_F32(fftLen) =
+ *                           fftLen/2 + 2 values
+ * @param[in]   pBuffer      points to a work buffer of PLP_MFCC_BUFFER_LEN_F32(fftLen, nMel) =
+ *                           fftLen + nMel values
+ * @return      0: Success, 1: the arguments are not supported
+ *
+ * All buffers must stay valid as long as S is used.
+ */
+
+int plp_mfcc_init_f32(plp_mfcc_instance_f32 *S,
+                      const plp_rfft_instance_f32 *pCfft,
+                      const float32_t *pWindow,
+                      uint32_t sampleRate,
+                      float32_t fMin,
+                      float32_t fMax,
+                      uint32_t nMel,
+                      uint32_t nCoef,
+                      uint16_t *pMelIndex,
+                      float32_t *pMelWeights,
+                      float32_t *pDct,
+                      float32_t *pTwiddle,
+                      float32_t *pBuffer) {
+    uint32_t k, m, j, count;
+    uint32_t N = 2 * pCfft->FFTLength;
+    double melMin, melMax, fl, fc, fr, f, w;
+
+    if (fMin < 0 || fMin >= fMax || fMax > sampleRate / 2.0 || nMel == 0 || nCoef == 0 ||
+        nCoef > nMel || pCfft->bitReverseFlag == 0) {
+        return 1;
+    }
+
+    melMin = plp_mfcc_init_to_mel(fMin);
+    melMax = plp_mfcc_init_to_mel(fMax);
+
+    // non-zero weights of filter m, from the edge fl over the peak fc to the edge fr
+    count = 0;
+    for (m = 0; m < nMel; m++) {
+        fl = plp_mfcc_init_to_hz(melMin + (melMax - melMin) * m / (nMel + 1));
+        fc = plp_mfcc_init_to_hz(melMin + (melMax - melMin) * (m + 1) / (nMel + 1));
+        fr = plp_mfcc_init_to_hz(melMin + (melMax - melMin) * (m + 2) / (nMel + 1));
+
+        k = (uint32_t)(fl * N / sampleRate) + 1;
+        pMelIndex[m] = k;
+        pMelIndex[nMel + m] = count;
+        for (; k < N / 2; k++) {
+            f = (double)k * sampleRate / N;
+            if (f >= fr) {
+                break;
+            }
+            w = (f <= fc) ? (f - fl) / (fc - fl) : (fr - f) / (fr - fc);
+            pMelWeights[count++] = (float32_t)(w);
+        }
+    }
+    pMelIndex[2 * nMel] = count;
+
+    // orthonormal DCT-II
+    for (j = 0; j < nCoef; j++) {
+        w = (j == 0) ? sqrt(1.0 / nMel) : sqrt(2.0 / nMel);
+        for (m = 0; m < nMel; m++) {
+            pDct[j * nMel + m] = (float32_t)(w * cos(M_PI * j * (m + 0.5) / nMel));
+        }
+    }
+
+    // exp(-2j*pi*k/N) for the split into the spectrum of the real frame, k = 0 .. N/4
+    for (k = 0; k <= N / 4; k++) {
+        pTwiddle[2 * k] = (float32_t)cos(2 * M_PI * k / N);
+        pTwiddle[2 * k + 1] = (float32_t)sin(2 * M_PI * k / N);
+    }
+
+    S->fftLen = N;
+    S->pCfft = pCfft;
+    S->pTwiddle = pTwiddle;
+    S->pWindow = pWindow;
+    S->nMel = nMel;
+    S->nCoef = nCoef;
+    S->pMelIndex = pMelIndex;
+    S->pMelWeights = pMelWeights;
+    S->pDct = pDct;
+    S->pBuffer = pBuffer;
+
+    return 0;
+}
+
+/**
+ * @} end of MFCC group
+ */
@@ -0,0 +1,158 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_init_q16.c
+ * Description:  Initialization of the 16-bit fixed-point MFCC
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// x in Q1.15, rounded and saturated
+static inline int16_t plp_mfcc_init_to_q16(double x) {
+    x = floor(x * 32768.0 + 0.5);
+    return (x > 32767.0) ? 0x7FFF : (int16_t)x;
+}
+
+// frequency in Hz to mel (HTK formula) and back
+static inline double plp_mfcc_init_to_mel(double f) {
+    return 2595.0 * log10(1.0 + f / 700.0);
+}
+
+static inline double plp_mfcc_init_to_hz(double mel) {
+    return 700.0 * (pow(10.0, mel / 2595.0) - 1.0);
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief      Initializes an instance of the 16-bit fixed-point MFCC
+ *
+ * Computes the sparse mel filter bank and the DCT-II matrix. The nMel triangular filters have a
+ * peak of one, and their edges are equally spaced on the mel scale between fMin and fMax. Only
+ * the non-zero span of every filter is stored: pMelIndex[m] is the first bin of filter m, and its
+ * weights are pMelWeights[pMelIndex[nMel + m]] to pMelWeights[pMelIndex[nMel + m + 1] - 1]. The
+ * bins of the filters are limited to 0 .. N/2 - 1, the Nyquist bin is not used. The DCT-II matrix
+ * is orthonormal. The initialization only has to be done once, and the tables can be put into L1
+ * by passing buffers allocated there.
+ *
+ * @param[out]  S            points to the instance
+ * @param[in]   pRfft        points to the real FFT instance, for example plp_rfft_sR_q16_len*,
+ *                           which determines the frame length fftLenReal
+ * @param[in]   pWindow      points to the first half of the window in Q1.15,
+ *                           PLP_WINDOW_LEN(fftLenReal) values (see plp_window_hann_q16), or NULL
+ *                           for a rectangular window
+ * @param[in]   sampleRate   sample rate in Hz
+ * @param[in]   fMin         lower edge of the first mel filter in Hz
+ * @param[in]   fMax         upper edge of the last mel filter in Hz, at most sampleRate/2
+ * @param[in]   nMel         number of mel filters
+ * @param[in]   nCoef        number of cepstral coefficients, at most nMel
+ * @param[in]   fracBits     number of fractional bits of the cepstral coefficients, at most 15
+ * @param[out]  pMelIndex    points to a buffer of PLP_MFCC_INDEX_LEN(nMel) = 2*nMel + 1 values
+ * @param[out]  pMelWeights  points to a buffer of PLP_MFCC_WEIGHTS_LEN(fftLenReal) values
+ * @param[out]  pDct         points to a buffer of nCoef*nMel values
+ * @param[in]   pBuffer      points to a 32-bit aligned work buffer of
+ *                           PLP_MFCC_BUFFER_LEN_Q16(fftLenReal, nMel) = fftLenReal + 2*nMel
+ *                           values
+ * @return      0: Success, 1: the arguments are not supported
+ *
+ * All buffers must stay valid as long as S is used.
+ */
+
+int plp_mfcc_init_q16(plp_mfcc_instance_q16 *S,
+                      const plp_rfft_instance_q16 *pRfft,
+                      const int16_t *pWindow,
+                      uint32_t sampleRate,
+                      float32_t fMin,
+                      float32_t fMax,
+                      uint32_t nMel,
+                      uint32_t nCoef,
+                      uint32_t fracBits,
+                      uint16_t *pMelIndex,
+                      int16_t *pMelWeights,
+                      int16_t *pDct,
+                      int16_t *pBuffer) {
+    uint32_t k, m, j, count;
+    uint32_t N = pRfft->fftLenReal;
+    double melMin, melMax, fl, fc, fr, f, w;
+
+    if (fMin < 0 || fMin >= fMax || fMax > sampleRate / 2.0 || nMel == 0 || nCoef == 0 ||
+        nCoef > nMel || fracBits > 15) {
+        return 1;
+    }
+
+    melMin = plp_mfcc_init_to_mel(fMin);
+    melMax = plp_mfcc_init_to_mel(fMax);
+
+    // non-zero weights of filter m, from the edge fl over the peak fc to the edge fr
+    count = 0;
+    for (m = 0; m < nMel; m++) {
+        fl = plp_mfcc_init_to_hz(melMin + (melMax - melMin) * m / (nMel + 1));
+        fc = plp_mfcc_init_to_hz(melMin + (melMax - melMin) * (m + 1) / (nMel + 1));
+        fr = plp_mfcc_init_to_hz(melMin + (melMax - melMin) * (m + 2) / (nMel + 1));
+
+        k = (uint32_t)(fl * N / sampleRate) + 1;
+        pMelIndex[m] = k;
+        pMelIndex[nMel + m] = count;
+        for (; k < N / 2; k++) {
+            f = (double)k * sampleRate / N;
+            if (f >= fr) {
+                break;
+            }
+            w = (f <= fc) ? (f - fl) / (fc - fl) : (fr - f) / (fr - fc);
+            pMelWeights[count++] = plp_mfcc_init_to_q16(w);
+        }
+    }
+    pMelIndex[2 * nMel] = count;
+
+    // orthonormal DCT-II
+    for (j = 0; j < nCoef; j++) {
+        w = (j == 0) ? sqrt(1.0 / nMel) : sqrt(2.0 / nMel);
+        for (m = 0; m < nMel; m++) {
+            pDct[j * nMel + m] = plp_mfcc_init_to_q16(w * cos(M_PI * j * (m + 0.5) / nMel));
+        }
+    }
+
+    S->pRfft = pRfft;
+    S->pWindow = pWindow;
+    S->nMel = nMel;
+    S->nCoef = nCoef;
+    S->fracBits = fracBits;
+    S->pMelIndex = pMelIndex;
+    S->pMelWeights = pMelWeights;
+    S->pDct = pDct;
+    S->pBuffer = pBuffer;
+
+    return 0;
+}
+
+/**
+ * @} end of MFCC group
+ */
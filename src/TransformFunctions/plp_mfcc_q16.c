@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_q16.c
+ * Description:  Glue code for the MFCC of 16-bit fixed-point frames
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup MFCC MFCC
+ *
+ * Mel-frequency cepstral coefficients of a frame of samples, as used by keyword spotting front
+ * ends. All stages are fused into one function, which works in place on a single work buffer:
+ *
+ * - window:   the frame is multiplied with the window (if any) into the work buffer
+ * - spectrum: real FFT of the frame in place
+ * - power:    squared magnitude of every bin, which overwrites the bin
+ * - mel:      sparse triangular mel filter bank, of which only the non-zero spans are stored
+ * - log:      natural logarithm of the mel energies, which overwrites the power spectrum
+ * - dct:      orthonormal DCT-II of the log mel energies, of which only the first nCoef rows are
+ *             computed
+ *
+ * The parallel version runs all stages in a single fork of the cluster, with a barrier between
+ * the stages, instead of forking the cluster for every stage. The instance and the tables are
+ * created with plp_mfcc_init_q16 or plp_mfcc_init_f32.
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the MFCC of a frame of 16-bit fixed-point samples
+ *
+ * @param[in]   S       points to the instance, initialized by plp_mfcc_init_q16
+ * @param[in]   pSrc    points to the frame of fftLenReal samples
+ * @param[out]  pDst    points to the nCoef cepstral coefficients
+ *
+ * @par Scaling
+ * The frame is in Q1.15. The spectrum is scaled by 1/fftLenReal like the output of
+ * plp_rfft_q16, and its power is kept in 32 bits (Q2.30). The cepstral coefficients are the
+ * DCT-II of the natural logarithm of the mel energies, with fracBits fractional bits. Mel
+ * energies of zero are replaced by the smallest positive value.
+ */
+
+void plp_mfcc_q16(const plp_mfcc_instance_q16 *S,
+                  const int16_t *pSrc,
+                  int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mfcc_q16s_rv32im(S, pSrc, pDst);
+    } else {
+        plp_mfcc_q16s_xpulpv2(S, pSrc, pDst);
+    }
+}
+
+/**
+ * @} end of MFCC group
+ */
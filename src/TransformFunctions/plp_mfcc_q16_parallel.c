@@ -0,0 +1,74 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_q16_parallel.c
+ * Description:  Glue code for the parallel MFCC of 16-bit fixed-point frames
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the parallel MFCC of a frame of 16-bit fixed-point samples
+ *
+ * @param[in]   S       points to the instance, initialized by plp_mfcc_init_q16
+ * @param[in]   pSrc    points to the frame of fftLenReal samples
+ * @param[in]   nPE     number of cores to use
+ * @param[out]  pDst    points to the nCoef cepstral coefficients
+ *
+ * @par Scaling
+ * The frame is in Q1.15. The spectrum is scaled by 1/fftLenReal like the output of
+ * plp_rfft_q16, and its power is kept in 32 bits (Q2.30). The cepstral coefficients are the
+ * DCT-II of the natural logarithm of the mel energies, with fracBits fractional bits. Mel
+ * energies of zero are replaced by the smallest positive value.
+ */
+
+void plp_mfcc_q16_parallel(const plp_mfcc_instance_q16 *S,
+                           const int16_t *pSrc,
+                           uint32_t nPE,
+                           int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mfcc_instance_q16_parallel args = {
+            .S = S, .pSrc = pSrc, .nPE = nPE, .pDst = pDst
+        };
+
+        rt_team_fork(nPE, plp_mfcc_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+ * @} end of MFCC group
+ */
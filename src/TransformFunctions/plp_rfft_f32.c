@@ -50,12 +50,12 @@
    @brief Floating-point FFT on real input data.
    @param[in]   S       points to an instance of the floating-point FFT structure
    @param[in]   pSrc    points to the input buffer (real data)
-   @param[out]  pDst    points to the output buffer (complex data)
+   @param[out]  pDst    points to the output buffer (complex data), may be equal to pSrc
    @return      none
 */
 void plp_rfft_f32(const plp_rfft_instance_f32 *S,
-                  const float32_t *__restrict__ pSrc,
-                  float32_t *__restrict__ pDst) {
+                  const float32_t *pSrc,
+                  float32_t *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("F extension is supported only for cluster side\n");
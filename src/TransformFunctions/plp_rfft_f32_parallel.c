@@ -51,13 +51,13 @@
    @param[in]   S       points to an instance of the floating-point FFT structure
    @param[in]   pSrc    points to the input buffer (real data)
    @param[in]   nPE     number of parallel processing units
-   @param[out]  pDst    points to the output buffer (complex data)
+   @param[out]  pDst    points to the output buffer (complex data), may be equal to pSrc
    @return      none
 */
 void plp_rfft_f32_parallel(const plp_rfft_instance_f32 *S,
-                           const float32_t *__restrict__ pSrc,
+                           const float32_t *pSrc,
                            const uint32_t nPE,
-                           float32_t *__restrict__ pDst) {
+                           float32_t *pDst) {
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("Parallel processing supported only for cluster side\n");
@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_packed_f32_parallel.c
+ * Description:  Parallel floating-point FFT on real input data with packed output
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Floating-point FFT on real input data, with the bins 0 to FFTLength/2 as output
+          (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure, the same as used
+                        for plp_rfft_f32
+   @param[in]   pSrc    points to the input buffer (real data, FFTLength values)
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer (packed complex data, FFTLength values), may be
+                        equal to pSrc
+   @return      none
+
+   @par Output Format
+   The spectrum of a real signal is conjugate symmetric, X[N - k] = conj(X[k]). Hence, only the bins
+   0 to N/2 are stored, as FFTLength real values in natural order (N = FFTLength):
+
+       pDst = { X[0].re, X[N/2].re, X[1].re, X[1].im, ..., X[N/2 - 1].re, X[N/2 - 1].im }
+
+   X[0] and X[N/2] are real, and are packed into the first pair. This is the format of
+   plp_rfft_q16 and plp_rfft_q32.
+
+   @par Algorithm
+   The even and odd samples are transformed together as real and imaginary part of a single
+   complex FFT of length FFTLength / 2, which uses every second twiddle factor of S. A final split
+   step computes the bins 0 to N/2 from it. Compared to plp_rfft_f32, this computes the mirrored
+   bins neither in the butterflies nor in the output. FFTLength must be at least 4, and the output
+   is always in natural order.
+*/
+void plp_rfft_packed_f32_parallel(const plp_rfft_instance_f32 *S,
+                                  const float32_t *pSrc,
+                                  const uint32_t nPE,
+                                  float32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_rfft_parallel_arg_f32 arg = (plp_rfft_parallel_arg_f32){ S, pSrc, nPE, pDst };
+
+    rt_team_fork(nPE, plp_rfft_packed_f32_xpulpv2_parallel, (void *)&arg);
+}
+
+/**
+   @} end of FFT group
+*/
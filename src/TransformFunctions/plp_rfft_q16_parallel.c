@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16_parallel.c
+ * Description:  Parallel 16-bit fixed-point real FFT glue code
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Glue code for parallel quantized 16 bit real fast fourier transform
+ *
+ * Fixed point units input -> output dependent on fftLenReal:
+ * len=32:    Q1.15 -> Q6.10
+ * len=64:    Q1.15 -> Q7.9
+ * len=128:   Q1.15 -> Q8.8
+ * len=256:   Q1.15 -> Q9.7
+ * len=512:   Q1.15 -> Q10.6
+ * len=1024:  Q1.15 -> Q11.5
+ * len=2048:  Q1.15 -> Q12.4
+ * len=4096:  Q1.15 -> Q13.3
+ * len=8192:  Q1.15 -> Q14.2
+ *
+ * @par Output Format
+ * The spectrum of a real signal is conjugate symmetric, hence only the bins 0 to fftLenReal/2
+ * are stored, packed into fftLenReal values: pDst[0] = X[0] and pDst[1] = X[fftLenReal/2] (both
+ * are real), followed by the real and imaginary parts of X[k] for 0 < k < fftLenReal/2.
+ *
+ * @par Algorithm
+ * The input is interpreted as fftLenReal/2 complex values x[2n] + j x[2n+1], transformed in-place
+ * in pDst with the complex FFT of half the length, and separated into the spectrum of the real
+ * signal by a split step with the twiddle factors twiddleCoef_rfft_q16. pSrc and pDst may point to
+ * the same buffer.
+ *
+ * @param[in]   S       points to an instance of the 16bit quantized real FFT structure
+ * @param[in]   pSrc    points to the input buffer of fftLenReal real values
+ * @param[in]   nPE     number of cores to use
+ * @param[out]  pDst    points to the output buffer of fftLenReal values (packed complex data)
+ */
+
+void plp_rfft_q16_parallel(const plp_rfft_instance_q16 *S,
+                           const int16_t *pSrc,
+                           uint32_t nPE,
+                           int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_rfft_instance_q16_parallel args = { .S = S, .pSrc = pSrc, .nPE = nPE, .pDst = pDst };
+
+        rt_team_fork(nPE, plp_rfft_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_stockham_f32.c
+ * Description:  Floating-point Stockham real FFT glue code
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Floating-point Stockham FFT on real input data.
+   @param[in]   S        points to an instance of the floating-point FFT structure, for
+                         example plp_rfft_sR_f32_len2048. The bit reversal settings are not used.
+   @param[in]   pSrc     points to the input buffer (real data) of size <code>FFTLength</code>
+   @param[out]  pDst     points to the output buffer (complex data) of size
+                         <code>2*FFTLength</code>
+   @param[in]   pBuffer  points to a scratch buffer of size <code>2*FFTLength</code>
+   @return      none
+
+   @par Output Order
+   The stages are out-of-place Stockham stages, which leave the output in natural order, the same
+   as plp_rfft_f32 with bitReverseFlag set, without a bit reversal pass. pSrc, pDst and pBuffer
+   must not overlap.
+*/
+void plp_rfft_stockham_f32(const plp_rfft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pDst,
+                           float32_t *__restrict__ pBuffer) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_rfft_stockham_f32s_xpulpv2(S, pSrc, pDst, pBuffer);
+}
+
+/**
+   @} end of FFT group
+*/
@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_windowed_f32.c
+ * Description:  Windowed 32-bit floating-point FFT on real input data
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Windowed floating-point FFT on real input data.
+
+   Computes the FFT of pSrc multiplied with the window. The window is applied while the first
+   stage of the FFT reads the input, which saves a pass over the frame and the windowed copy.
+
+   @param[in]   S        points to an instance of the floating-point FFT structure
+   @param[in]   pWindow  points to the first half of the window, PLP_WINDOW_LEN(FFTLength) values,
+                         for example created by plp_window_hann_f32
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[out]  pDst     points to the output buffer (complex data), may be equal to pSrc
+   @return      none
+*/
+void plp_rfft_windowed_f32(const plp_rfft_instance_f32 *S,
+                           const float32_t *__restrict__ pWindow,
+                           const float32_t *pSrc,
+                           float32_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_rfft_windowed_f32_xpulpv2(S, pWindow, pSrc, pDst);
+}
+
+/**
+   @} end of FFT group
+*/
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rifft_f32_parallel.c
+ * Description:  Floating-point inverse FFT with real output glue code (parallel version)
+ *
+ * $Date:        14. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Floating-point inverse FFT with real output data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure, the same as used
+                        for plp_rfft_f32
+   @param[in]   pSrc    points to the input buffer (complex data, FFTLength values in natural order,
+                        as computed by plp_rfft_f32 with bitReverseFlag=1)
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer (real data, FFTLength values)
+   @return      none
+
+   @par Algorithm
+   The spectrum of a real signal is conjugate symmetric. Hence, the even and odd samples of the
+   output are computed together as real and imaginary part of a single complex inverse FFT of
+   length FFTLength / 2, which uses every second twiddle factor of S. The result is scaled by
+   1 / FFTLength and always returned in natural order. FFTLength must be at least 4.
+*/
+void plp_rifft_f32_parallel(const plp_rfft_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            const uint32_t nPE,
+                            float32_t *__restrict__ pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_rfft_parallel_arg_f32 arg = (plp_rfft_parallel_arg_f32){ S, pSrc, nPE, pDst };
+
+    rt_team_fork(nPE, plp_rifft_f32_xpulpv2_parallel, (void *)&arg);
+}
+
+/**
+   @} end of FFT group
+*/
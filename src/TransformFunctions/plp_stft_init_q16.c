@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_init_q16.c
+ * Description:  Initialization of the 16-bit fixed-point short-time Fourier transform
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief      Initializes an instance of the 16-bit fixed-point STFT
+ *
+ * @param[out]  S        points to the instance
+ * @param[in]   pRfft    points to the real FFT instance, whose length N is the frame length
+ * @param[in]   pWindow  points to the first half of the window in Q1.15, PLP_WINDOW_LEN(N)
+ *                       values, or NULL for a rectangular window
+ * @param[in]   hop      number of new samples per frame, at most N
+ * @param[in]   ringLen  number of samples of the ring buffer, at least N. The parallel version
+ *                       computes up to (ringLen - N) / hop + 1 frames at once, see
+ *                       PLP_STFT_RING_LEN.
+ * @param[out]  pRing    points to the ring buffer of 2*ringLen samples
+ * @return      0: Success, 1: hop or ringLen is not supported
+ *
+ * @par The ring buffer is cleared, such that the stream starts with silence. All buffers must
+ * stay valid as long as S is used.
+ */
+
+int plp_stft_init_q16(plp_stft_instance_q16 *S,
+                      const plp_rfft_instance_q16 *pRfft,
+                      const int16_t *pWindow,
+                      uint32_t hop,
+                      uint32_t ringLen,
+                      int16_t *pRing) {
+
+    uint32_t N = pRfft->fftLenReal;
+    uint32_t i;
+
+    if (hop == 0 || hop > N || ringLen < N) {
+        return 1;
+    }
+
+    for (i = 0; i < 2 * ringLen; i++) {
+        pRing[i] = 0;
+    }
+
+    S->pRfft = pRfft;
+    S->pWindow = pWindow;
+    S->hop = hop;
+    S->ringLen = ringLen;
+    S->pRing = pRing;
+    S->head = 0;
+
+    return 0;
+}
+
+/**
+ * @} end of STFT group
+ */
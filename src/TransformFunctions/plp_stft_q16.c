@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_q16.c
+ * Description:  Glue code for the 16-bit fixed-point short-time Fourier transform
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup STFT STFT
+ *
+ * Short-time Fourier transform of a stream of samples, e.g. to compute a spectrogram. A frame of
+ * N samples, the length of the real FFT, starts every hop samples, such that consecutive frames
+ * overlap by N - hop samples.
+ *
+ * The last samples of the stream are kept in a mirrored ring buffer of ringLen samples: every
+ * sample is written to position i and i + ringLen of a buffer of 2*ringLen samples. Thus, every
+ * frame is a contiguous block of the buffer, and each new hop only writes its hop new samples,
+ * instead of moving the N - hop overlapping samples. The window is applied while the frame is
+ * read by the transform, so there is no windowed copy of the frame either:
+ *
+ * - q16: the frame is multiplied with the window into the output spectrum, which is then
+ *        transformed in place by plp_rfft_q16
+ * - f32: the frame is passed to plp_rfft_windowed_f32, which applies the window in its first
+ *        stage
+ *
+ * The parallel version hands whole frames to the cores. As many frames as the ring buffer holds
+ * are computed at once; with a ring buffer of PLP_STFT_RING_LEN(N, hop, nPE) samples, every core
+ * computes one frame at a time. The instance is created with plp_stft_init_q16 or
+ * plp_stft_init_f32.
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the STFT of a stream of 16-bit fixed-point samples
+ *
+ * @param[in,out]  S        points to the instance, initialized by plp_stft_init_q16. The ring
+ *                          buffer is updated.
+ * @param[in]      pSrc     points to the next nFrames*hop samples of the stream
+ * @param[in]      nFrames  number of frames to compute
+ * @param[out]     pDst     points to nFrames spectra of N values each, in the packed format of
+ *                          plp_rfft_q16. Spectrum f belongs to the frame which ends with sample
+ *                          (f+1)*hop-1 of pSrc.
+ *
+ * @par Scaling
+ * The samples and the window are in Q1.15, and the spectrum is scaled by 1/N like the output of
+ * plp_rfft_q16.
+ */
+
+void plp_stft_q16(plp_stft_instance_q16 *S,
+                  const int16_t *pSrc,
+                  uint32_t nFrames,
+                  int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_stft_q16s_rv32im(S, pSrc, nFrames, pDst);
+    } else {
+        plp_stft_q16s_xpulpv2(S, pSrc, nFrames, pDst);
+    }
+}
+
+/**
+ * @} end of STFT group
+ */
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_q16_parallel.c
+ * Description:  Glue code for the parallel 16-bit fixed-point short-time Fourier transform
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the parallel STFT of a stream of 16-bit fixed-point samples
+ *
+ * @param[in,out]  S        points to the instance, initialized by plp_stft_init_q16. The ring
+ *                          buffer is updated.
+ * @param[in]      pSrc     points to the next nFrames*hop samples of the stream
+ * @param[in]      nFrames  number of frames to compute
+ * @param[in]      nPE      number of cores to use
+ * @param[out]     pDst     points to nFrames spectra of N values each, in the packed format of
+ *                          plp_rfft_q16
+ *
+ * @par Scaling
+ * The samples and the window are in Q1.15, and the spectrum is scaled by 1/N like the output of
+ * plp_rfft_q16.
+ */
+
+void plp_stft_q16_parallel(plp_stft_instance_q16 *S,
+                           const int16_t *pSrc,
+                           uint32_t nFrames,
+                           uint32_t nPE,
+                           int16_t *pDst) {
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_stft_instance_q16_parallel args = {
+            .S = S, .pSrc = pSrc, .nFrames = nFrames, .nPE = nPE, .pDst = pDst
+        };
+
+        rt_team_fork(nPE, plp_stft_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+ * @} end of STFT group
+ */
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_window_blackman_q16.c
+ * Description:  Blackman window table of 16-bit fixed-point values
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+// x in Q1.15, rounded and saturated
+static inline int16_t plp_window_to_q16(double x) {
+    x = floor(x * 32768.0 + 0.5);
+    return (x > 32767.0) ? 0x7FFF : (int16_t)x;
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Window
+ * @{
+ */
+
+/**
+ * @brief      Blackman window in Q1.15
+ *
+ * Computes the first half of the periodic Blackman window
+ * w[n] = 0.42 - 0.5 cos(2 pi n / N) + 0.08 cos(4 pi n / N).
+ *
+ * @param[in]   len     length N of the frame, a multiple of two
+ * @param[out]  pDst    points to the window of PLP_WINDOW_LEN(len) = len/2 + 1 values
+ */
+
+void plp_window_blackman_q16(uint32_t len, int16_t *pDst) {
+    uint32_t n;
+
+    for (n = 0; n <= len / 2; n++) {
+        pDst[n] = plp_window_to_q16(0.42 - 0.5 * cos(2 * M_PI * n / len) +
+                                    0.08 * cos(4 * M_PI * n / len));
+    }
+}
+
+/**
+ * @} end of Window group
+ */
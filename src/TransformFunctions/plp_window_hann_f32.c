@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_window_hann_f32.c
+ * Description:  Hann window table of 32-bit floating-point values
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Window Window functions
+ *
+ * Generators of the tables of window functions, which are applied to a frame before a transform
+ * (see plp_rfft_windowed_f32, plp_cfft_windowed_q16 and plp_mfcc_init_q16). The windows are
+ * periodic (DFT-even), i.e., w[n] = w[N - n] for a frame of N samples. Hence, only the first half
+ * w[0] .. w[N/2] of the window is stored, which are PLP_WINDOW_LEN(N) = N/2 + 1 values.
+ */
+
+/**
+ * @addtogroup Window
+ * @{
+ */
+
+/**
+ * @brief      Hann window
+ *
+ * Computes the first half of the periodic Hann window w[n] = 0.5 - 0.5 cos(2 pi n / N).
+ *
+ * @param[in]   len     length N of the frame, a multiple of two
+ * @param[out]  pDst    points to the window of PLP_WINDOW_LEN(len) = len/2 + 1 values
+ */
+
+void plp_window_hann_f32(uint32_t len, float32_t *pDst) {
+    uint32_t n;
+
+    for (n = 0; n <= len / 2; n++) {
+        pDst[n] = (float32_t)(0.5 - 0.5 * cos(2 * M_PI * n / len));
+    }
+}
+
+/**
+ * @} end of Window group
+ */
@@ -0,0 +1,153 @@
+#include "rt/rt_api.h"
+#include "stdio.h"
+#include "cluster.h"
+
+// number of repetitions, every result is the average over all of them
+#define ITER 32
+// largest transfer of the DMA and largest allocation
+#define MAX_BYTES 16384
+
+static const int sizes[] = { 4, 16, 64, 256, 1024, 4096, 16384 };
+#define N_SIZES (sizeof(sizes) / sizeof(sizes[0]))
+
+RT_L2_DATA static char l2_buffer[MAX_BYTES];
+
+static rt_perf_t perf;
+
+static void perf_restart(void) {
+    rt_perf_conf(&perf, 1 << RT_PERF_CYCLES);
+    rt_perf_reset(&perf);
+}
+
+static void print_result(const char *primitive, int nPE, int bytes, int cycles) {
+    printf("%s,%d,%d,%d\n", primitive, nPE, bytes, cycles);
+}
+
+static void empty_entry(void *arg) {}
+
+// every core waits ITER times in the barrier, and core 0 counts the cycles from the first to the
+// last one. The first barrier synchronizes the cores after the fork.
+static void barrier_entry(void *arg) {
+    int i;
+    int *cycles = (int *)arg;
+
+    rt_team_barrier();
+    if (rt_core_id() == 0) {
+        perf_restart();
+        rt_perf_start(&perf);
+    }
+    for (i = 0; i < ITER; i++) {
+        rt_team_barrier();
+    }
+    if (rt_core_id() == 0) {
+        rt_perf_stop(&perf);
+        *cycles = rt_perf_read(RT_PERF_CYCLES);
+    }
+}
+
+// fork and join of an empty team
+static void bench_fork(int nPE) {
+    int i;
+
+    // the first fork wakes up the cores
+    rt_team_fork(nPE, empty_entry, NULL);
+
+    perf_restart();
+    rt_perf_start(&perf);
+    for (i = 0; i < ITER; i++) {
+        rt_team_fork(nPE, empty_entry, NULL);
+    }
+    rt_perf_stop(&perf);
+    print_result("fork", nPE, 0, rt_perf_read(RT_PERF_CYCLES) / ITER);
+}
+
+static void bench_barrier(int nPE) {
+    int cycles = 0;
+    rt_team_fork(nPE, barrier_entry, &cycles);
+    print_result("barrier", nPE, 0, cycles / ITER);
+}
+
+// rt_alloc and rt_free of the cluster data (L1), measured separately
+static void bench_alloc(int bytes) {
+    int i;
+    int alloc_cycles = 0;
+    int free_cycles = 0;
+
+    for (i = 0; i < ITER; i++) {
+        perf_restart();
+        rt_perf_start(&perf);
+        void *p = rt_alloc(RT_ALLOC_CL_DATA, bytes);
+        rt_perf_stop(&perf);
+        alloc_cycles += rt_perf_read(RT_PERF_CYCLES);
+
+        if (p == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+
+        perf_restart();
+        rt_perf_start(&perf);
+        rt_free(RT_ALLOC_CL_DATA, p, bytes);
+        rt_perf_stop(&perf);
+        free_cycles += rt_perf_read(RT_PERF_CYCLES);
+    }
+
+    print_result("alloc", 1, bytes, alloc_cycles / ITER);
+    print_result("free", 1, bytes, free_cycles / ITER);
+}
+
+// rt_dma_memcpy between L2 and L1: the cycles to issue the transfer, and until it is complete
+static void bench_dma(char *l1_buffer, int bytes, int dir, const char *name_issue,
+                      const char *name) {
+    int i;
+    int issue_cycles = 0;
+    int total_cycles = 0;
+    rt_dma_copy_t copy;
+
+    for (i = 0; i < ITER; i++) {
+        perf_restart();
+        rt_perf_start(&perf);
+        rt_dma_memcpy((unsigned int)l2_buffer, (unsigned int)l1_buffer, bytes, dir, 0, &copy);
+        rt_perf_stop(&perf);
+        issue_cycles += rt_perf_read(RT_PERF_CYCLES);
+        rt_perf_start(&perf);
+        rt_dma_wait(&copy);
+        rt_perf_stop(&perf);
+        total_cycles += rt_perf_read(RT_PERF_CYCLES);
+    }
+
+    print_result(name_issue, 1, bytes, issue_cycles / ITER);
+    print_result(name, 1, bytes, total_cycles / ITER);
+}
+
+void cluster_entry(void *arg) {
+    int nPE;
+    unsigned int i;
+
+    rt_perf_init(&perf);
+
+    printf("primitive,nPE,bytes,cycles\n");
+
+    for (nPE = 1; nPE <= rt_nb_pe(); nPE++) {
+        bench_fork(nPE);
+    }
+
+    for (nPE = 1; nPE <= rt_nb_pe(); nPE++) {
+        bench_barrier(nPE);
+    }
+
+    for (i = 0; i < N_SIZES; i++) {
+        bench_alloc(sizes[i]);
+    }
+
+    char *l1_buffer = rt_alloc(RT_ALLOC_CL_DATA, MAX_BYTES);
+    if (l1_buffer == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+    for (i = 0; i < N_SIZES; i++) {
+        bench_dma(l1_buffer, sizes[i], RT_DMA_DIR_EXT2LOC, "dma_in_issue", "dma_in");
+        bench_dma(l1_buffer, sizes[i], RT_DMA_DIR_LOC2EXT, "dma_out_issue", "dma_out");
+    }
+    rt_free(RT_ALLOC_CL_DATA, l1_buffer, MAX_BYTES);
+}
@@ -0,0 +1,4 @@
+#ifndef __MICROBENCH__CLUSTER_H__
+#define __MICROBENCH__CLUSTER_H__
+void cluster_entry(void *arg);
+#endif//__MICROBENCH__CLUSTER_H__
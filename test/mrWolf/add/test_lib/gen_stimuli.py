@@ -19,16 +19,16 @@ def compute_result(result_parameter, inputs, env, fix_point):
     env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
     fix_point: None (if no fixpoint is used) or decimal point
     """
-    if fix_point is not None:
-        raise RuntimeError("FixPoint is not supported")
-    elif result_parameter.ctype == 'int8_t':
-        a = inputs['pSrcA'].value.astype(np.int8)
-        b = inputs['pSrcB'].value.astype(np.int8)
-        result = np.add(a, b, dtype=np.int8)
+    if result_parameter.ctype == 'int8_t':
+        # only the saturating q8 versions write 8-bit results
+        a = inputs['pSrcA'].value.astype(np.int32)
+        b = inputs['pSrcB'].value.astype(np.int32)
+        result = np.clip(a + b, -2**7, 2**7 - 1).astype(np.int8)
     elif result_parameter.ctype == 'int16_t':
-        a = inputs['pSrcA'].value.astype(np.int16)
-        b = inputs['pSrcB'].value.astype(np.int16)
-        result = np.add(a, b, dtype=np.int16)
+        # only the saturating q16 versions write 16-bit results
+        a = inputs['pSrcA'].value.astype(np.int32)
+        b = inputs['pSrcB'].value.astype(np.int32)
+        result = np.clip(a + b, -2**15, 2**15 - 1).astype(np.int16)
     elif result_parameter.ctype == 'int32_t':
         a = inputs['pSrcA'].value.astype(np.int32)
         b = inputs['pSrcB'].value.astype(np.int32)
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The instances start with a cleared envelope and the gain 1.0, and the serial version only
+    # processes the first channel. The fixed-point arithmetic follows the kernels exactly.
+
+    src = inputs['pSrc'].value
+    length = env['len']
+    n_channels = result_parameter.length // length
+
+    result = np.zeros(n_channels * length, dtype=np.int16)
+    for c in range(n_channels):
+        x = [int(v) for v in src[c * length:(c + 1) * length]]
+        result[c * length:(c + 1) * length] = agc_q16(x, env['level'], 24000, 3000, env['min_gain'],
+                                                      0x2000)
+
+    return result
+
+
+def trunc_div(a, b):
+    """ integer division rounding towards zero, like in C """
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b > 0) else -q
+
+
+def agc_q16(x, target, attack, release, min_gain, max_gain):
+    """ one block of the AGC, starting with a cleared envelope and the gain 1.0 """
+    gain = min(max(0x0100, min_gain), max_gain)
+
+    peak = min(max(abs(v) for v in x), 0x7FFF)
+    env = ((attack if peak > 0 else release) * peak) >> 15
+    g_new = max_gain if env == 0 else (target << 8) // env
+    g_new = min(max(g_new, min_gain), max_gain)
+
+    step = trunc_div((g_new - gain) * 65536, len(x))
+    g = gain * 65536
+    y = []
+    for v in x:
+        g += step
+        y.append(min(max((v * (g >> 16)) >> 8, -0x8000), 0x7FFF))
+    return y
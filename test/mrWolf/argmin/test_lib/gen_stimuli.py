@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    p = inputs['pSrc'].value
+    # numpy returns the first occurrence of the extremum, as the kernels do
+    index = np.argmin(p)
+    result = {'pRes': p[index], 'pIndex': index}[result_parameter.name]
+
+    dtype = {'int32_t': np.int32, 'int16_t': np.int16, 'int8_t': np.int8, 'float': np.float32,
+             'uint32_t': np.uint32}
+    if result_parameter.ctype not in dtype:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return np.array([result]).astype(dtype[result_parameter.ctype])
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The q16 version shifts the exact sums with rounding, the q32 version shifts every product.
+
+    ctype = inputs['pSrc'].ctype
+    src = inputs['pSrc'].value
+    n = env['len']
+
+    if ctype == 'float':
+        result = np.zeros(env['num_lags'], dtype=np.float32)
+        for l in range(env['num_lags']):
+            acc = np.float32(0)
+            for i in range(n - l):
+                acc += np.float32(src[i]) * np.float32(src[i + l])
+            result[l] = acc
+        return result
+    elif ctype not in ('int16_t', 'int32_t'):
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    result = np.zeros(env['num_lags'], dtype=np.int32)
+    for l in range(env['num_lags']):
+        acc = 0
+        for i in range(n - l):
+            if ctype == 'int32_t':
+                acc += (int(src[i]) * int(src[i + l])) >> fix_point
+            else:
+                acc += int(src[i]) * int(src[i + l])
+        if ctype == 'int16_t' and fix_point > 0:
+            acc = (acc + (1 << (fix_point - 1))) >> fix_point
+        result[l] = max(-2**31, min(2**31 - 1, acc))
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
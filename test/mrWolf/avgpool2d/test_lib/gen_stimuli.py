@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def round_away(s, n):
+    """integer division of s by n, rounded to the nearest integer with ties away from zero"""
+    return np.sign(s) * ((np.abs(s) + n // 2) // n)
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value
+    rows = inputs['srcRows'].value
+    cols = inputs['srcCols'].value
+    channels = inputs['nChannels'].value
+    pool_rows = inputs['poolRows'].value
+    pool_cols = inputs['poolCols'].value
+    stride = inputs['stride'].value
+    out_rows = (rows - pool_rows) // stride + 1
+    out_cols = (cols - pool_cols) // stride + 1
+
+    x = x.reshape(channels, rows, cols).astype(np.int64 if result_parameter.ctype != 'float'
+                                              else np.float64)
+    result = np.zeros((channels, out_rows, out_cols), dtype=x.dtype)
+    for i in range(out_rows):
+        for j in range(out_cols):
+            window = x[:, i * stride:i * stride + pool_rows, j * stride:j * stride + pool_cols]
+            result[:, i, j] = (np.sum(window, axis=(1, 2)) / (pool_rows * pool_cols)
+                               if result_parameter.ctype == 'float' else
+                               round_away(np.sum(window, axis=(1, 2)), pool_rows * pool_cols))
+
+    if result_parameter.ctype == 'float':
+        return result.flatten().astype(np.float32)
+    return result.flatten().astype(np.dtype(result_parameter.ctype[:-2]))
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -2,6 +2,9 @@
 
 import os
 import re
+import sys
+import csv
+import json
 import argparse
 from collections import namedtuple
 
@@ -21,19 +24,60 @@ def main():
     parser_cmp.add_argument('-o', '--old-bench-file', type=str, help='Benchmark CSV file to compare to.', required=True)
     parser_cmp.add_argument('-f', '--function', type=str, help='Regex to only show the specified function')
     parser_cmp.add_argument('-d', '--device', type=str, help='Filter to only show the given device')
+    parser_cmp.add_argument('--fail-on-regression', type=percentage, metavar='THRESHOLD', help='Exit with status 1 if any of {} increased by more than THRESHOLD (e.g. 3%%)'.format(", ".join(REGRESSION_METRICS)))
+    parser_cmp.add_argument('-t', '--threshold', type=metric_threshold, action='append', default=[], metavar='METRIC=THRESHOLD', help='Threshold for a single metric (e.g. ld_stall=10%%), overwrites --fail-on-regression')
+    parser_cmp.add_argument('--format', choices=['table', 'json', 'csv'], default='table', help='Output format (default: table)')
 
     parser_score = subparsers.add_parser('score', help='compute a socre based on the imporvement of the benchmark')
     parser_score.add_argument('-n', '--new-bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
     parser_score.add_argument('-o', '--old-bench-file', type=str, help='Benchmark CSV file to compare to.', required=True)
 
+    parser_scaling = subparsers.add_parser('scaling', help='Show how the parallel functions scale with the number of cores (run the tests with TEST_NPE_SWEEP=1,2,4,8)')
+    parser_scaling.add_argument('-b', '--bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
+    parser_scaling.add_argument('-f', '--function', type=str, help='Regex to only show the specified function.')
+    parser_scaling.add_argument('-d', '--device', type=str, help='Filter to only show the given device')
+    parser_scaling.add_argument('-e', '--min-efficiency', type=float, default=0.5, help='Mark core counts with a lower parallel efficiency (default: 0.5)')
+
+    parser_placement = subparsers.add_parser('placement', help='Show the cycles of every L1/L2 placement of the arrays (run the tests with TEST_PLACEMENT_SWEEP=1)')
+    parser_placement.add_argument('-b', '--bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
+    parser_placement.add_argument('-f', '--function', type=str, help='Regex to only show the specified function.')
+    parser_placement.add_argument('-d', '--device', type=str, help='Filter to only show the given device')
+
+    parser_padding = subparsers.add_parser('padding', help='Show the cycles of the strided functions with and without padded rows (run the tests with TEST_PADDING_SWEEP=1)')
+    parser_padding.add_argument('-b', '--bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
+    parser_padding.add_argument('-f', '--function', type=str, help='Regex to only show the specified function.')
+    parser_padding.add_argument('-d', '--device', type=str, help='Filter to only show the given device')
+
+    parser_latency = subparsers.add_parser('latency', help='Show the minimum and maximum cycles and the jitter of every function (run the tests with TEST_REPEAT=100)')
+    parser_latency.add_argument('-b', '--bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
+    parser_latency.add_argument('-f', '--function', type=str, help='Regex to only show the specified function.')
+    parser_latency.add_argument('-d', '--device', type=str, help='Filter to only show the given device')
+    parser_latency.add_argument('-j', '--max-jitter', type=percentage, metavar='THRESHOLD', help='Mark runs whose jitter is larger than THRESHOLD of the minimum (e.g. 5%%)')
+
+    parser_crossover = subparsers.add_parser('crossover', help='Show the size from which offloading to the cluster is faster than the FC (run the tests with TEST_OFFLOAD=1)')
+    parser_crossover.add_argument('-b', '--bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
+    parser_crossover.add_argument('-f', '--function', type=str, help='Regex to only show the specified function.')
+    parser_crossover.add_argument('-s', '--size', type=str, default='bytes', help='Size of a run: bytes, ops, or the name of a variable of the dimension (e.g. len) (default: bytes)')
+    parser_crossover.add_argument('--format', choices=['table', 'json', 'csv'], default='table', help='Output format (default: table)')
+
     args = parser.parse_args()
 
     if args.command == 'view':
         view(args)
     elif args.command == "compare":
-        compare(args)
+        sys.exit(compare(args))
     elif args.command == "score":
         score(args)
+    elif args.command == "scaling":
+        scaling(args)
+    elif args.command == "placement":
+        placement(args)
+    elif args.command == "padding":
+        padding(args)
+    elif args.command == "latency":
+        latency(args)
+    elif args.command == "crossover":
+        crossover(args)
 
 
 def view(args):
@@ -49,6 +93,14 @@ def view(args):
     runs = filter_runs(runs, args.function, args.device)
     # print remaining runs
     print_runs(runs)
+    # print the parallel efficiency of the parallel runs
+    parallel_runs = [r for r in runs if r.cores > 1]
+    if parallel_runs:
+        print_parallel_runs(parallel_runs, runs)
+    # print the roofline metrics of all runs with a known number of operations and data size
+    roofline_runs = [r for r in runs if r.ops > 0 and r.bytes > 0]
+    if roofline_runs:
+        print_roofline(roofline_runs)
 
 
 def compare(args):
@@ -73,8 +125,131 @@ def compare(args):
 
     assert len(new_runs) != 0
 
+    # thresholds for the regression check
+    thresholds = {}
+    if args.fail_on_regression is not None:
+        thresholds = {m: args.fail_on_regression for m in REGRESSION_METRICS}
+    thresholds.update(dict(args.threshold))
+
+    regressions = find_regressions(new_runs, old_runs, thresholds)
+
     # print comparison
-    print_comparison(new_runs, old_runs)
+    if args.format == 'json':
+        print_comparison_json(new_runs, old_runs, thresholds, regressions)
+    elif args.format == 'csv':
+        print_comparison_csv(new_runs, old_runs, thresholds, regressions)
+    else:
+        print_comparison(new_runs, old_runs)
+        print_regressions(new_runs, old_runs, thresholds, regressions)
+
+    return 1 if regressions else 0
+
+
+def scaling(args):
+    """ Scaling subcommand """
+    if args.bench_file is None:
+        bench_file = get_most_recent_bench_filename()
+    else:
+        bench_file = args.bench_file
+
+    runs = read_bench(bench_file)
+    runs = filter_runs(runs, args.function, args.device)
+
+    # group the parallel runs by function, device and dimension
+    groups = {}
+    for run in runs:
+        if run.name.endswith("_parallel"):
+            groups.setdefault((run.name, run.device, run.dimension), []).append(run)
+
+    for key in sorted(groups):
+        print_scaling(sorted(groups[key], key=lambda r: r.cores), runs, args.min_efficiency)
+
+
+def placement(args):
+    """ Placement subcommand """
+    if args.bench_file is None:
+        bench_file = get_most_recent_bench_filename()
+    else:
+        bench_file = args.bench_file
+
+    runs = read_bench(bench_file)
+    runs = filter_runs(runs, args.function, args.device)
+
+    # group the runs of the placement sweep by function, device, dimension and cores
+    groups = {}
+    for run in runs:
+        dimension, l2_arrays = split_placement(run.dimension)
+        if l2_arrays is not None:
+            groups.setdefault((run.name, run.device, dimension, run.cores), []).append(run)
+
+    for key in sorted(groups):
+        print_placement(key, groups[key])
+
+
+def padding(args):
+    """ Padding subcommand """
+    if args.bench_file is None:
+        bench_file = get_most_recent_bench_filename()
+    else:
+        bench_file = args.bench_file
+
+    runs = read_bench(bench_file)
+    runs = filter_runs(runs, args.function, args.device)
+
+    # group the runs of the padding sweep by function, device, dimension and cores
+    groups = {}
+    for run in runs:
+        dimension, pad = split_padding(run.dimension)
+        if pad is not None:
+            groups.setdefault((run.name, run.device, dimension, run.cores), []).append(run)
+
+    for key in sorted(groups):
+        print_padding(key, groups[key])
+
+
+def latency(args):
+    """ Latency subcommand """
+    if args.bench_file is None:
+        bench_file = get_most_recent_bench_filename()
+    else:
+        bench_file = args.bench_file
+
+    runs = read_bench(bench_file)
+    runs = filter_runs(runs, args.function, args.device)
+    print_latency(runs, args.max_jitter)
+
+
+def crossover(args):
+    """ Crossover subcommand """
+    if args.bench_file is None:
+        bench_file = get_most_recent_bench_filename()
+    else:
+        bench_file = args.bench_file
+
+    runs = read_bench(bench_file)
+
+    # group the offloaded runs on riscy by function and cores, each with the run on the FC
+    groups = {}
+    for run in filter_runs(runs, args.function, "riscy"):
+        if run.offload_cycles == 0:
+            continue
+        fc_run = find_fc_run(run, runs)
+        if fc_run is None:
+            continue
+        groups.setdefault((run.name, run.cores), []).append((run, fc_run))
+
+    results = []
+    for key in sorted(groups):
+        pairs = sorted(groups[key], key=lambda p: run_size(p[0], args.size))
+        results.append((key, pairs, find_crossover(pairs, args.size)))
+
+    if args.format == 'json':
+        print_crossover_json(results, args.size)
+    elif args.format == 'csv':
+        print_crossover_csv(results, args.size)
+    else:
+        for key, pairs, size in results:
+            print_crossover(key, pairs, size, args.size)
 
 
 def score(args):
@@ -93,13 +268,118 @@ def score(args):
 
     name_length = max([len(run.name) for run in new_runs])
 
+    # every run is weighted by the number of calls of its shape when a shape profile was replayed
     bench_score = 0.0
     for run_old, run_new in zip(old_runs, new_runs):
-        run_score = score_fun(run_old, run_new)
+        run_score = score_fun(run_old, run_new) * run_new.weight
         bench_score += run_score
         print("{}: {}".format(run_old.name.ljust(name_length), run_score))
     print("{}: {}".format("total score".ljust(name_length), bench_score))
 
+    if any(run.weight != 1 for run in new_runs):
+        old_cycles = sum(run_old.cycles * run_new.weight
+                         for run_old, run_new in zip(old_runs, new_runs))
+        new_cycles = sum(run.cycles * run.weight for run in new_runs)
+        print("{}: {} -> {} ({})".format("workload cycles".ljust(name_length), old_cycles,
+                                         new_cycles,
+                                         format_float(relative_change(new_cycles, old_cycles), 4)))
+
+
+REGRESSION_METRICS = ["cycles", "cycles_max", "ld_stall", "tcdm_cont", "imiss"]
+COMPARISON_METRICS = ["cycles", "instructions", "ipc", "imiss", "ld_stall", "tcdm_cont", "ops",
+                      "mpc"]
+
+
+def percentage(value):
+    """ parse a threshold like '3%' or '3' and return it as a fraction (0.03) """
+    try:
+        fraction = float(value.strip().rstrip("%")) / 100
+    except ValueError:
+        raise argparse.ArgumentTypeError("invalid threshold: {}".format(value))
+    if fraction < 0:
+        raise argparse.ArgumentTypeError("threshold must not be negative: {}".format(value))
+    return fraction
+
+
+def metric_threshold(value):
+    """ parse a threshold like 'ld_stall=10%' and return the tuple (metric, fraction) """
+    metric, sep, threshold = value.partition("=")
+    if not sep or metric not in REGRESSION_METRICS:
+        raise argparse.ArgumentTypeError("expected METRIC=THRESHOLD with METRIC one of {}".format(
+            ", ".join(REGRESSION_METRICS)))
+    return metric, percentage(threshold)
+
+
+def relative_change(new, old):
+    """ returns the relative change from old to new. A metric which was 0 before is compared to 1 """
+    return (new - old) / max(old, 1)
+
+
+def find_regressions(new_runs, old_runs, thresholds):
+    """
+    returns a list of tuples (index, metric, change), for every metric of every run which increased
+    by more than the threshold of this metric.
+    """
+    regressions = []
+    for i, (new_run, old_run) in enumerate(zip(new_runs, old_runs)):
+        for metric in REGRESSION_METRICS:
+            if metric not in thresholds:
+                continue
+            change = relative_change(getattr(new_run, metric), getattr(old_run, metric))
+            if change > thresholds[metric]:
+                regressions.append((i, metric, change))
+    return regressions
+
+
+def print_regressions(new_runs, old_runs, thresholds, regressions):
+    """ print all regressions found below the comparison table """
+    if not thresholds:
+        return
+    print()
+    for i, metric, change in regressions:
+        run = new_runs[i]
+        print("REGRESSION {} ({}, {}): {} {} -> {} ({:+.1f}% > {:.1f}%)".format(
+            run.name, run.device, run.dimension, metric, getattr(old_runs[i], metric),
+            getattr(run, metric), change * 100, thresholds[metric] * 100))
+    print("{} regression(s) in {} compared runs".format(len(regressions), len(new_runs)))
+
+
+def print_comparison_json(new_runs, old_runs, thresholds, regressions):
+    """ print the comparison and the found regressions as JSON """
+    regressed = {}
+    for i, metric, _ in regressions:
+        regressed.setdefault(i, []).append(metric)
+    runs = []
+    for i, (new_run, old_run) in enumerate(zip(new_runs, old_runs)):
+        runs.append({"function": new_run.name,
+                     "device": new_run.device,
+                     "dimension": new_run.dimension,
+                     "old": {m: getattr(old_run, m) for m in COMPARISON_METRICS},
+                     "new": {m: getattr(new_run, m) for m in COMPARISON_METRICS},
+                     "change": {m: relative_change(getattr(new_run, m), getattr(old_run, m))
+                                for m in REGRESSION_METRICS},
+                     "regressions": regressed.get(i, [])})
+    print(json.dumps({"thresholds": thresholds,
+                      "regressions": len(regressions),
+                      "runs": runs}, indent=2))
+
+
+def print_comparison_csv(new_runs, old_runs, thresholds, regressions):
+    """ print the comparison as CSV, with one line per run and metric """
+    regressed = set((i, metric) for i, metric, _ in regressions)
+    writer = csv.writer(sys.stdout, lineterminator="\n")
+    writer.writerow(["name", "device", "dimension", "metric", "old", "new", "change", "threshold",
+                     "regression"])
+    for i, (new_run, old_run) in enumerate(zip(new_runs, old_runs)):
+        for metric in REGRESSION_METRICS:
+            new = getattr(new_run, metric)
+            old = getattr(old_run, metric)
+            threshold = thresholds.get(metric)
+            writer.writerow([new_run.name, new_run.device, new_run.dimension, metric, old, new,
+                             format_float(relative_change(new, old), 4),
+                             format_float(threshold, 4) if threshold is not None else "",
+                             int((i, metric) in regressed)])
+
 
 def score_fun(run_old, run_new):
     x = 0.0
@@ -128,7 +408,17 @@ def get_most_recent_bench_filename():
 
 
 HEADER = ["name", "device", "dimension", "cycles", "instructions", "ipc", "imiss", "ld_stall",
-          "tcdm_cont", "ops", "mpc"]
+          "tcdm_cont", "ops", "mpc", "cores", "core_active", "core_instr", "bytes", "bpc",
+          "cycles_min", "cycles_max", "offload_cycles", "offload_mount", "offload_dma_in",
+          "offload_compute", "offload_dma_out", "weight"]
+# bench files written before the per-core counters were added end after mpc, before the data size
+# was added after core_instr, before the latency was added after bpc, before the offload cost was
+# added after cycles_max, and before the weight was added after offload_dma_out.
+HEADER_SINGLE_CORE = HEADER[:11]
+HEADER_NO_BYTES = HEADER[:14]
+HEADER_NO_LATENCY = HEADER[:16]
+HEADER_NO_OFFLOAD = HEADER[:18]
+HEADER_NO_WEIGHT = HEADER[:23]
 Run = namedtuple("Run", HEADER)
 
 
@@ -138,7 +428,8 @@ def read_bench(bench_file):
         # check the first line
         lines = iter(f.readlines())
         header = next(lines).strip().split(",")
-        assert(header == HEADER)
+        assert(header in (HEADER, HEADER_SINGLE_CORE, HEADER_NO_BYTES, HEADER_NO_LATENCY,
+                          HEADER_NO_OFFLOAD, HEADER_NO_WEIGHT))
         runs = [run_from_csv_line(line) for line in lines]
     # sort the runs
     runs = sorted(runs, key=run_sort_key)
@@ -146,7 +437,8 @@ def read_bench(bench_file):
 
 
 def run_sort_key(run):
-    return "{}{}{}".format(run.device, run.name, run.dimension)
+    # the number of cores distinguishes the runs of a parallel function swept over nPE
+    return "{}{}{}{:02d}".format(run.device, run.name, run.dimension, run.cores)
 
 
 def filter_runs(runs, function, device):
@@ -238,6 +530,431 @@ def print_comparison(new_runs, old_runs):
     print(hline)
 
 
+TABLE_HEADER_PAR = ["function", "device", "dimension", "cores", "cycles", "serial", "speedup",
+                    "efficiency", "imbalance", "max wait"]
+
+
+def print_parallel_runs(parallel_runs, runs):
+    """ print the speedup and per-core balance of the parallel runs in a table """
+    runs_str = [format_parallel_run_to_str_list(r, find_serial_run(r, runs))
+                for r in parallel_runs]
+    column_width = tuple(get_column_width(runs_str, c, h) for c, h in enumerate(TABLE_HEADER_PAR))
+    hline = horizontal_line(column_width)
+    fmt = "| {:<%d} | {:<%d} | {:<%d} | " % column_width[:3]
+    fmt += " | ".join(["{:>%d}" % w for w in column_width[3:]]) + " |"
+    print()
+    print(hline)
+    print(fmt.format(*TABLE_HEADER_PAR))
+    print(hline)
+    for run_str in runs_str:
+        print(fmt.format(*run_str))
+    print(hline)
+
+
+TABLE_HEADER_ROOF = ["function", "device", "dimension", "ops/c", "bytes/c", "ops/byte", "peak",
+                     "% peak", "bound"]
+
+# Theoretical peak per core, in operations (MACs) per cycle for the width of the data, and in bytes
+# per cycle. The riscy cores compute 4 8-bit or 2 16-bit MACs per cycle with the SIMD dot products
+# of XPULPV2, and every core can load one word per cycle from L1. ibex has no SIMD extension.
+PEAK_OPS = {
+    'riscy': {8: 4, 16: 2, 32: 1},
+    'ibex': {8: 1, 16: 1, 32: 1}
+}
+PEAK_BYTES = {
+    'riscy': 4,
+    'ibex': 4
+}
+
+
+def data_width(run):
+    """ returns the width of the data in bits, based on the version in the function name """
+    match = re.search(r"_[iqf](8|16|32)(_|$)", run.name)
+    return int(match.group(1)) if match else 32
+
+
+def roofline_metrics(run):
+    """
+    returns (intensity, peak, fraction of peak, bound) of a run. intensity is the number of
+    operations per byte. peak is the attainable number of operations per cycle following the
+    roofline model: the compute peak, or the memory bandwidth times the intensity if lower. bound is
+    "memory" if the memory bandwidth limits the peak, and "compute" otherwise. peak and fraction
+    are None for unknown devices.
+    """
+    intensity = run.ops / run.bytes
+    if run.device not in PEAK_OPS:
+        return intensity, None, None, "-"
+    cores = max(run.cores, 1)
+    peak_ops = PEAK_OPS[run.device][data_width(run)] * cores
+    peak_bytes = PEAK_BYTES[run.device] * cores
+    peak = min(peak_ops, peak_bytes * intensity)
+    bound = "memory" if peak_bytes * intensity < peak_ops else "compute"
+    return intensity, peak, run.mpc / peak, bound
+
+
+def print_roofline(runs):
+    """ print the throughput of the runs compared to the peak of the device in a table """
+    runs_str = []
+    for run in runs:
+        intensity, peak, fraction, bound = roofline_metrics(run)
+        runs_str.append([run.name,
+                         run.device,
+                         run.dimension,
+                         format_float(run.mpc),
+                         format_float(run.bpc),
+                         format_float(intensity),
+                         format_float(peak) if peak is not None else "-",
+                         format_float(fraction * 100, 1) + "%" if fraction is not None else "-",
+                         bound])
+    column_width = tuple(get_column_width(runs_str, c, h) for c, h in enumerate(TABLE_HEADER_ROOF))
+    hline = horizontal_line(column_width)
+    fmt = "| {:<%d} | {:<%d} | {:<%d} | " % column_width[:3]
+    fmt += " | ".join(["{:>%d}" % w for w in column_width[3:-1]])
+    fmt += " | {:<%d} |" % column_width[-1]
+    print()
+    print(hline)
+    print(fmt.format(*TABLE_HEADER_ROOF))
+    print(hline)
+    for run_str in runs_str:
+        print(fmt.format(*run_str))
+    print(hline)
+
+
+TABLE_HEADER_PLACEMENT = ["arrays in L2", "cycles", "vs L1", "ld_stall", "tcdm_cont"]
+
+
+def split_placement(dimension):
+    """
+    splits the dimension of a run into the dimension without placement, and the list of arrays
+    placed in L2 ("l2=pSrcA+pSrcB", or "l2=-" for none). The list is None if the placement was not
+    swept.
+    """
+    parts = dimension.split("; ")
+    placements = [p for p in parts if p.startswith("l2=")]
+    if not placements:
+        return dimension, None
+    l2_arrays = placements[0][len("l2="):]
+    return "; ".join(p for p in parts if not p.startswith("l2=")), \
+        [] if l2_arrays == "-" else l2_arrays.split("+")
+
+
+def print_placement(key, group):
+    """
+    print the cycles of every placement of a function, compared to the placement with all arrays in
+    L1.
+    """
+    name, device, dimension, cores = key
+    group = sorted(group, key=lambda r: len(split_placement(r.dimension)[1]))
+    baseline = ([r for r in group if not split_placement(r.dimension)[1]] or [None])[0]
+    print()
+    print("{} ({}, {}{})".format(name, device, dimension,
+                                 ", {} cores".format(cores) if cores > 1 else ""))
+    rows = []
+    for r in group:
+        l2_arrays = split_placement(r.dimension)[1]
+        rows.append(["+".join(l2_arrays) if l2_arrays else "none",
+                     str(r.cycles),
+                     "{:+.1f}%".format((r.cycles - baseline.cycles) * 100 / baseline.cycles)
+                     if baseline is not None and baseline.cycles > 0 else "-",
+                     str(r.ld_stall),
+                     str(r.tcdm_cont)])
+    column_width = tuple(get_column_width(rows, c, h) for c, h in enumerate(TABLE_HEADER_PLACEMENT))
+    hline = horizontal_line(column_width)
+    fmt = "| {:<%d} | " % column_width[0]
+    fmt += " | ".join(["{:>%d}" % w for w in column_width[1:]]) + " |"
+    print(hline)
+    print(fmt.format(*TABLE_HEADER_PLACEMENT))
+    print(hline)
+    for row in rows:
+        print(fmt.format(*row))
+    print(hline)
+
+
+TABLE_HEADER_LATENCY = ["function", "device", "dimension", "cores", "min", "max", "jitter",
+                        "% min", ""]
+
+
+def print_latency(runs, max_jitter):
+    """
+    print the minimum and maximum cycles of every run, and the jitter (the difference between both).
+    Runs with more jitter than max_jitter (relative to the minimum) are marked.
+    """
+    if not runs:
+        return
+    runs_str = []
+    for run in runs:
+        jitter = run.cycles_max - run.cycles_min
+        fraction = jitter / max(run.cycles_min, 1)
+        runs_str.append([run.name,
+                         run.device,
+                         run.dimension,
+                         str(run.cores),
+                         str(run.cycles_min),
+                         str(run.cycles_max),
+                         str(jitter),
+                         format_float(fraction * 100, 1) + "%",
+                         "<" if max_jitter is not None and fraction > max_jitter else ""])
+    column_width = tuple(get_column_width(runs_str, c, h)
+                         for c, h in enumerate(TABLE_HEADER_LATENCY))
+    hline = horizontal_line(column_width)
+    fmt = "| {:<%d} | {:<%d} | {:<%d} | " % column_width[:3]
+    fmt += " | ".join(["{:>%d}" % w for w in column_width[3:-1]])
+    fmt += " | {:<%d} |" % column_width[-1]
+    print(hline)
+    print(fmt.format(*TABLE_HEADER_LATENCY))
+    print(hline)
+    for run_str in runs_str:
+        print(fmt.format(*run_str))
+    print(hline)
+
+
+TABLE_HEADER_PADDING = ["padding", "cycles", "vs none", "ld_stall", "tcdm_cont"]
+
+
+def split_padding(dimension):
+    """
+    splits the dimension of a run into the dimension without padding, and the padding of the rows
+    ("pad=none" or "pad=banks"). The padding is None if it was not swept.
+    """
+    parts = dimension.split("; ")
+    paddings = [p for p in parts if p.startswith("pad=")]
+    if not paddings:
+        return dimension, None
+    return "; ".join(p for p in parts if not p.startswith("pad=")), paddings[0][len("pad="):]
+
+
+def print_padding(key, group):
+    """
+    print the cycles of a function with every padding of the rows, compared to the matrices
+    without padding. The stall and contention columns show the effect of the bank conflicts.
+    """
+    name, device, dimension, cores = key
+    group = sorted(group, key=lambda r: split_padding(r.dimension)[1] != "none")
+    baseline = ([r for r in group if split_padding(r.dimension)[1] == "none"] or [None])[0]
+    print()
+    print("{} ({}, {}{})".format(name, device, dimension,
+                                 ", {} cores".format(cores) if cores > 1 else ""))
+    rows = []
+    for r in group:
+        rows.append([split_padding(r.dimension)[1],
+                     str(r.cycles),
+                     "{:+.1f}%".format((r.cycles - baseline.cycles) * 100 / baseline.cycles)
+                     if baseline is not None and baseline.cycles > 0 else "-",
+                     str(r.ld_stall),
+                     str(r.tcdm_cont)])
+    column_width = tuple(get_column_width(rows, c, h) for c, h in enumerate(TABLE_HEADER_PADDING))
+    hline = horizontal_line(column_width)
+    fmt = "| {:<%d} | " % column_width[0]
+    fmt += " | ".join(["{:>%d}" % w for w in column_width[1:]]) + " |"
+    print(hline)
+    print(fmt.format(*TABLE_HEADER_PADDING))
+    print(hline)
+    for row in rows:
+        print(fmt.format(*row))
+    print(hline)
+
+
+TABLE_HEADER_SCALING = ["cores", "cycles", "speedup", "efficiency", "", "imbalance"]
+SCALING_BAR_WIDTH = 20
+
+
+def print_scaling(group, runs, min_efficiency):
+    """
+    print the speedup and efficiency of a parallel function for every number of cores. The
+    baseline is the single-core version, or the parallel version on a single core if the former is
+    missing. Core counts where the efficiency drops below min_efficiency, or where adding cores
+    does not reduce the cycles, are marked.
+    """
+    run = group[0]
+    baseline = find_serial_run(run, runs)
+    if baseline is None:
+        baseline = ([r for r in group if r.cores == 1] or [None])[0]
+    print()
+    print("{} ({}, {}), baseline: {}".format(
+        run.name, run.device, run.dimension,
+        "{} cycles".format(baseline.cycles) if baseline is not None else "-"))
+
+    rows = []
+    prev_cycles = None
+    for r in group:
+        speedup = efficiency = None
+        if baseline is not None and r.cycles > 0:
+            speedup = baseline.cycles / r.cycles
+            efficiency = speedup / r.cores
+        imbalance = parallel_metrics(r, None)[2]
+        marks = []
+        if efficiency is not None and efficiency < min_efficiency:
+            marks.append("low efficiency")
+        if prev_cycles is not None and r.cycles >= prev_cycles:
+            marks.append("no speedup")
+        prev_cycles = r.cycles
+        bar = "#" * int(round(min(efficiency, 1.0) * SCALING_BAR_WIDTH)) if efficiency else ""
+        rows.append([str(r.cores),
+                     str(r.cycles),
+                     format_float(speedup, 2) if speedup is not None else "-",
+                     format_float(efficiency * 100, 1) + "%" if efficiency is not None else "-",
+                     bar.ljust(SCALING_BAR_WIDTH),
+                     format_float(imbalance) if imbalance is not None else "-",
+                     ", ".join(marks)])
+
+    column_width = tuple(get_column_width(rows, c, h) for c, h in enumerate(TABLE_HEADER_SCALING))
+    hline = horizontal_line(column_width)
+    fmt = "| " + " | ".join(["{:>%d}" % w for w in column_width]) + " | {}"
+    print(hline)
+    print(fmt.format(*TABLE_HEADER_SCALING, "").rstrip())
+    print(hline)
+    for row in rows:
+        print(fmt.format(*row).rstrip())
+    print(hline)
+
+
+TABLE_HEADER_CROSSOVER = ["dimension", "size", "fc", "offload", "mount", "dma_in", "compute",
+                          "dma_out", "speedup", ""]
+
+
+def find_fc_run(run, runs):
+    """ returns the run on the FC (ibex) of the single-core function and dimension, or None """
+    name = run.name[:-len("_parallel")] if run.name.endswith("_parallel") else run.name
+    return ([r for r in runs if r.name == name and r.device == "ibex"
+             and r.dimension == run.dimension] or [None])[0]
+
+
+def run_size(run, size):
+    """ returns the size of a run: its bytes, its ops, or a variable of its dimension """
+    if size == "bytes":
+        return run.bytes
+    if size == "ops":
+        return run.ops
+    for part in run.dimension.split("; "):
+        var, _, value = part.partition("=")
+        if var == size:
+            return float(value) if "." in value else int(value)
+    sys.exit("variable {} is not in the dimension of {}: {}".format(size, run.name, run.dimension))
+
+
+def find_crossover(pairs, size):
+    """
+    returns the smallest size from which the offloaded run is faster than the run on the FC at every
+    larger size, or None if it is slower at the largest size. pairs are sorted by size.
+    """
+    crossover = None
+    for run, fc_run in reversed(pairs):
+        if run.offload_cycles >= fc_run.cycles:
+            break
+        crossover = run_size(run, size)
+    return crossover
+
+
+def print_crossover(key, pairs, crossover, size):
+    """
+    print the cycles on the FC and of the offload (mount, DMA in, compute and DMA out) of every
+    size, followed by the crossover. The stages of the offload are counted by the cluster.
+    """
+    name, cores = key
+    fc_name = pairs[0][1].name
+    print()
+    print("{} ({}) vs {} (ibex)".format(name, "{} cores".format(cores) if cores > 1 else "riscy",
+                                        fc_name))
+    rows = []
+    for run, fc_run in pairs:
+        rows.append([run.dimension,
+                     str(run_size(run, size)),
+                     str(fc_run.cycles),
+                     str(run.offload_cycles),
+                     str(run.offload_mount),
+                     str(run.offload_dma_in),
+                     str(run.offload_compute),
+                     str(run.offload_dma_out),
+                     format_float(fc_run.cycles / run.offload_cycles, 2),
+                     "<" if run.offload_cycles < fc_run.cycles else ""])
+    column_width = tuple(get_column_width(rows, c, h) for c, h in enumerate(TABLE_HEADER_CROSSOVER))
+    hline = horizontal_line(column_width)
+    fmt = "| {:<%d} | " % column_width[0]
+    fmt += " | ".join(["{:>%d}" % w for w in column_width[1:-1]])
+    fmt += " | {:<%d} |" % column_width[-1]
+    print(hline)
+    print(fmt.format(*TABLE_HEADER_CROSSOVER))
+    print(hline)
+    for row in rows:
+        print(fmt.format(*row))
+    print(hline)
+    if crossover is None:
+        print("crossover: none, the FC is faster at the largest size")
+    else:
+        print("crossover: {} >= {}".format(size, crossover))
+
+
+def print_crossover_json(results, size):
+    """ print the crossover of every function and the cycles of every size as JSON """
+    functions = []
+    for (name, cores), pairs, crossover in results:
+        functions.append({"function": name,
+                          "cores": cores,
+                          "fc_function": pairs[0][1].name,
+                          "crossover": crossover,
+                          "runs": [{"dimension": run.dimension,
+                                    "size": run_size(run, size),
+                                    "fc_cycles": fc_run.cycles,
+                                    "offload_cycles": run.offload_cycles,
+                                    "offload_mount": run.offload_mount,
+                                    "offload_dma_in": run.offload_dma_in,
+                                    "offload_compute": run.offload_compute,
+                                    "offload_dma_out": run.offload_dma_out}
+                                   for run, fc_run in pairs]})
+    print(json.dumps({"size": size, "functions": functions}, indent=2))
+
+
+def print_crossover_csv(results, size):
+    """ print the crossover as CSV, with one line per function (empty if the FC is faster) """
+    writer = csv.writer(sys.stdout, lineterminator="\n")
+    writer.writerow(["name", "cores", "fc_name", "size", "crossover"])
+    for (name, cores), pairs, crossover in results:
+        writer.writerow([name, cores, pairs[0][1].name, size,
+                         crossover if crossover is not None else ""])
+
+
+def find_serial_run(run, runs):
+    """ returns the single-core run of the same function and dimension, or None """
+    if not run.name.endswith("_parallel"):
+        return None
+    name = run.name[:-len("_parallel")]
+    return ([r for r in runs if r.name == name and r.device == run.device
+             and r.dimension == run.dimension] or [None])[0]
+
+
+def parallel_metrics(run, serial_run):
+    """
+    returns (speedup, efficiency, imbalance, max_wait) of a parallel run. speedup and efficiency
+    are None without a single-core run. imbalance is the most active core divided by the average
+    active core. max_wait is the largest number of cycles a core was idle during the call (waiting
+    in a barrier, or for the fork and join), i.e. cycles minus its active cycles. Both are None if
+    the per-core counters are missing.
+    """
+    speedup = efficiency = imbalance = max_wait = None
+    if serial_run is not None and run.cycles > 0:
+        speedup = serial_run.cycles / run.cycles
+        efficiency = speedup / run.cores
+    if run.core_active and sum(run.core_active) > 0:
+        imbalance = max(run.core_active) * len(run.core_active) / sum(run.core_active)
+        max_wait = max(max(run.cycles - a, 0) for a in run.core_active)
+    return speedup, efficiency, imbalance, max_wait
+
+
+def format_parallel_run_to_str_list(run, serial_run):
+    """ returns a list of 10 strings """
+    speedup, efficiency, imbalance, max_wait = parallel_metrics(run, serial_run)
+    return [run.name,
+            run.device,
+            run.dimension,
+            str(run.cores),
+            str(run.cycles),
+            str(serial_run.cycles) if serial_run is not None else "-",
+            format_float(speedup, 2) if speedup is not None else "-",
+            format_float(efficiency * 100, 1) + "%" if efficiency is not None else "-",
+            format_float(imbalance) if imbalance is not None else "-",
+            str(max_wait) if max_wait is not None else "-"]
+
+
 def get_column_width(runs_str, idx, header):
     """ returns the maximum width of the given column """
     return max(max([len(r[idx]) for r in runs_str]), len(header))
@@ -252,17 +969,31 @@ def run_from_csv_line(line):
     """ parse csv line and return Run (namedtuple) """
     line = line.strip()
     parts = line.split(",")
+    cycles = int(parts[3].strip())
     return Run(name=parts[0],
                device=parts[1].strip(),
                dimension=parts[2].strip(),
-               cycles=int(parts[3].strip()),
+               cycles=cycles,
                instructions=int(parts[4].strip()),
                ipc=float(parts[5].strip()),
                imiss=int(parts[6].strip()),
                ld_stall=int(parts[7].strip()),
                tcdm_cont=int(parts[8].strip()),
                ops=int(parts[9].strip()),
-               mpc=float(parts[10].strip()))
+               mpc=float(parts[10].strip()),
+               cores=int(parts[11].strip()) if len(parts) > 11 else 1,
+               core_active=tuple(int(x) for x in parts[12].split()) if len(parts) > 12 else (),
+               core_instr=tuple(int(x) for x in parts[13].split()) if len(parts) > 13 else (),
+               bytes=int(parts[14].strip()) if len(parts) > 14 else 0,
+               bpc=float(parts[15].strip()) if len(parts) > 15 else 0.0,
+               cycles_min=int(parts[16].strip()) if len(parts) > 16 else cycles,
+               cycles_max=int(parts[17].strip()) if len(parts) > 17 else cycles,
+               offload_cycles=int(parts[18].strip()) if len(parts) > 18 else 0,
+               offload_mount=int(parts[19].strip()) if len(parts) > 19 else 0,
+               offload_dma_in=int(parts[20].strip()) if len(parts) > 20 else 0,
+               offload_compute=int(parts[21].strip()) if len(parts) > 21 else 0,
+               offload_dma_out=int(parts[22].strip()) if len(parts) > 22 else 0,
+               weight=int(parts[23].strip()) if len(parts) > 23 else 1)
 
 
 def format_run_to_str_list(run):
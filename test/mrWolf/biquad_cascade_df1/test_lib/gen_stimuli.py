@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The state is cleared, and the serial version only filters the first channel. All channels use
+    # the same coefficients with postShift = 1.
+
+    ctype = inputs['pSrc'].ctype
+    if ctype == 'int16_t':
+        my_type, my_bits, n_coeffs, offset = np.int16, 16, 6, 1
+    elif ctype == 'int32_t':
+        my_type, my_bits, n_coeffs, offset = np.int32, 32, 5, 0
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+    shift = fix_point
+
+    coeffs = [int(c) for c in inputs['pCoeffs'].value]
+    src = inputs['pSrc'].value
+    length = env['len']
+    n_channels = result_parameter.length // length
+
+    result = np.zeros(n_channels * length, dtype=my_type)
+    for c in range(n_channels):
+        data = [int(x) for x in src[c * length:(c + 1) * length]]
+        for s in range(env['stages']):
+            b0 = coeffs[s * n_coeffs]
+            b1, b2, a1, a2 = coeffs[s * n_coeffs + 1 + offset:(s + 1) * n_coeffs]
+            x1, x2, y1, y2 = 0, 0, 0, 0
+            for i in range(length):
+                acc = b0 * data[i] + b1 * x1 + b2 * x2 + a1 * y1 + a2 * y2
+                y = (acc + (1 << (shift - 1))) >> shift
+                y = max(-2**(my_bits - 1), min(2**(my_bits - 1) - 1, y))
+                x2, x1, y2, y1 = x1, data[i], y1, y
+                data[i] = y
+        result[c * length:(c + 1) * length] = data
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
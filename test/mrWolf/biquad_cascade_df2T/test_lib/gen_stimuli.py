@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The state is cleared, and the serial version only filters the first channel. All channels use
+    # the same coefficients.
+
+    ctype = inputs['pSrc'].ctype
+    if ctype != 'float':
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    coeffs = inputs['pCoeffs'].value.astype(np.float32)
+    src = inputs['pSrc'].value.astype(np.float32)
+    length = env['len']
+    n_channels = result_parameter.length // length
+
+    result = np.zeros(n_channels * length, dtype=np.float32)
+    for c in range(n_channels):
+        data = src[c * length:(c + 1) * length].copy()
+        for s in range(env['stages']):
+            b0, b1, b2, a1, a2 = coeffs[s * 5:(s + 1) * 5]
+            d1, d2 = np.float32(0), np.float32(0)
+            for i in range(length):
+                x = data[i]
+                y = b0 * x + d1
+                d1 = b1 * x + a1 * y + d2
+                d2 = b2 * x + a2 * y
+                data[i] = y
+        result[c * length:(c + 1) * length] = data
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # Must match the instance in testset.cfg. Near the borders, only the cells inside the map are
+    # averaged.
+    guard_rows, guard_cols, train_rows, train_cols = 1, 2, 2, 4
+    alpha = 0x0300
+
+    rows = env['rows']
+    cols = env['cols']
+    words = (cols + 31) // 32
+    src = np.array(inputs['pSrc'].value, dtype=np.int64).reshape(rows, cols)
+
+    result = np.zeros(rows * words, dtype=np.uint32)
+    for i in range(rows):
+        o_rows = slice(max(i - guard_rows - train_rows, 0), i + guard_rows + train_rows + 1)
+        g_rows = slice(max(i - guard_rows, 0), i + guard_rows + 1)
+        for j in range(cols):
+            o_cols = slice(max(j - guard_cols - train_cols, 0), j + guard_cols + train_cols + 1)
+            g_cols = slice(max(j - guard_cols, 0), j + guard_cols + 1)
+            outer = src[o_rows, o_cols]
+            guard = src[g_rows, g_cols]
+            n = outer.size - guard.size
+            noise = int(outer.sum() - guard.sum())
+            if n > 0 and int(src[i, j]) * n * 256 > alpha * noise:
+                result[i * words + j // 32] |= np.uint32(1 << (j % 32))
+
+    return result
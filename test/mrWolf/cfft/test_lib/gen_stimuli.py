@@ -56,7 +56,12 @@ def compute_result(result_parameter, inputs, env, fix_point):
     complex_result = np.zeros(len(a)>>1, dtype=np.csingle)
     for i in range(len(a)>>1):
         complex_a[i] = a[2*i].astype(np.csingle)/(2**(my_fixpoint)) + (a[2*i + 1].astype(np.csingle)/(2**(my_fixpoint)))*1j
-    complex_result = np.fft.fft(complex_a)
+    if env['ifft']:
+        # The inverse transform has the same 1/len scaling as the forward transform, so the output
+        # has the input's fixed point format.
+        complex_result = np.fft.ifft(complex_a) * len(complex_a)
+    else:
+        complex_result = np.fft.fft(complex_a)
     for i in range(int(len(a)/2)):
         result[2*i] = (np.real(complex_result[i])*(2**(bit_shift_dict[int(len(a)/2)]))).astype(my_type)
         result[2*i+1] = (np.imag(complex_result[i])*(2**(bit_shift_dict[int(len(a)/2)]))).astype(my_type)
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # same fixed point units as plp_cfft_q16:
+    bit_shift_dict = {16:11, 32:10, 64: 9, 128: 8, 256: 7, 512: 6, 1024: 5, 2048: 4, 4096: 3}
+
+    n = env['len']
+    a = inputs['pSrc'].value.astype(np.int64)
+    # the 16-bit output is the one of plp_cfft_q16 of the input shifted left by 8
+    complex_a = (a[0::2] + 1j * a[1::2]) / 2**7
+    complex_result = np.fft.fft(complex_a) * 2**bit_shift_dict[n]
+    result = np.zeros(2 * n, dtype=np.int64)
+    result[0::2] = np.real(complex_result).astype(np.int64)
+    result[1::2] = np.imag(complex_result).astype(np.int64)
+
+    ctype = result_parameter.ctype
+    if ctype == 'int16_t':
+        return result.astype(np.int16)
+    elif ctype == 'int8_t':
+        # the 8-bit output is rounded from the 16-bit one
+        return np.clip((result + 128) >> 8, -128, 127).astype(np.int8)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
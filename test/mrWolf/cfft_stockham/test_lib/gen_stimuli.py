@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # Every stage divides by its radix, so the forward transform is scaled by 1 / len, and the
+    # inverse transform is the regular inverse DFT (which includes the factor 1 / len).
+
+    ctype = inputs['pSrc'].ctype
+    if ctype == 'int16_t':
+        my_type = np.int16
+        my_fixpoint = 15
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    n = env['len']
+    a = inputs['pSrc'].value.astype(np.float64)
+    complex_a = a[0::2] + 1j * a[1::2]
+    if env['ifft']:
+        complex_result = np.fft.ifft(complex_a)
+    else:
+        complex_result = np.fft.fft(complex_a) / n
+
+    result = np.zeros(2 * n, dtype=np.float64)
+    result[0::2] = np.real(complex_result)
+    result[1::2] = np.imag(complex_result)
+
+    return np.clip(np.round(result), -2**my_fixpoint, 2**my_fixpoint - 1).astype(my_type)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+
+def hann_q16(n):
+    # first half of the periodic Hann window, as generated by plp_window_hann_q16
+    w = [0.5 - 0.5 * math.cos(2 * math.pi * i / n) for i in range(n // 2 + 1)]
+    return [min(2**15 - 1, math.floor(x * 2**15 + 0.5)) for x in w]
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # same fixed point units as plp_cfft_q16:
+    bit_shift_dict = {16:11, 32:10, 64: 9, 128: 8, 256: 7, 512: 6, 1024: 5, 2048: 4, 4096: 3}
+
+    ctype = result_parameter.ctype
+    if ctype == 'int16_t':
+        my_type = np.int16
+        my_fixpoint = 15
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    n = env['len']
+    a = inputs['p1'].value.astype(np.int64)
+    window = hann_q16(n)
+    w = np.array([window[i] if i <= n // 2 else window[n - i] for i in range(n)], dtype=np.int64)
+    complex_a = (a[0::2] * w + 1j * a[1::2] * w) / 2**(2 * my_fixpoint)
+    complex_result = np.fft.fft(complex_a) * 2**bit_shift_dict[n]
+    result = np.zeros(2 * n, dtype=my_type)
+    result[0::2] = np.real(complex_result).astype(my_type)
+    result[1::2] = np.imag(complex_result).astype(my_type)
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
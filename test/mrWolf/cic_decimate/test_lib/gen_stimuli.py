@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+
+import math
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The state is cleared and the serial version only decimates the first channel. The CIC is
+    # equal to an FIR filter with N cascaded boxcars of R * D ones, evaluated at every R-th input.
+
+    if result_parameter.ctype != 'int32_t':
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    src = inputs['pSrc'].value
+    N = env['N']
+    R = env['R']
+    D = env['D']
+    length = env['len']
+    out_len = env['out_len']
+    n_channels = result_parameter.length // out_len
+    shift = int(N * math.log2(R * D))
+
+    h = np.ones(1, dtype=np.int64)
+    for _ in range(N):
+        h = np.convolve(h, np.ones(R * D, dtype=np.int64))
+
+    result = np.zeros(n_channels * out_len, dtype=np.int32)
+    for c in range(n_channels):
+        data = src[c * length:(c + 1) * length].astype(np.int64)
+        y = np.convolve(data, h)[R - 1:length:R]
+        result[c * out_len:(c + 1) * out_len] = (y + ((1 << shift) >> 1)) >> shift
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
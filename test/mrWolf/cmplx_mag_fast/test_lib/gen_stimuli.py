@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # alpha max plus beta min, bit exact to the kernels, with alpha and beta in Q1.15
+    alpha = 29425
+    beta = 15939
+
+    src = inputs['pSrc'].value
+    num_samples = inputs['numSamples'].value
+    result = np.zeros(num_samples, dtype=np.int16)
+    for n in range(num_samples):
+        real = min(abs(int(src[2*n])), 2**15 - 1)
+        imag = min(abs(int(src[2*n + 1])), 2**15 - 1)
+        hi, lo = max(real, imag), min(real, imag)
+        mag = min((alpha * hi + beta * lo + (1 << 14)) >> 15, 2**15 - 1)
+        result[n] = max(hi, mag)
+
+    return result
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
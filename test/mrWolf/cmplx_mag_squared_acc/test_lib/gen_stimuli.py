@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    num_samples = inputs['numSamples'].value
+    alpha = inputs['alpha'].value
+    src = inputs['pSrc'].value
+    acc = inputs['pAcc'].value
+
+    if result_parameter.ctype == 'float':
+        src = src.astype(np.float32)
+        result = acc.astype(np.float32).copy()
+        for n in range(num_samples):
+            p = src[2*n] * src[2*n] + src[2*n + 1] * src[2*n + 1]
+            if alpha == 0:
+                result[n] += p
+            else:
+                result[n] += np.float32(alpha) * (p - result[n])
+        return result
+
+    # fixed point, computed with python integers to avoid any overflow
+    result = np.zeros(num_samples, dtype=np.int32)
+    for n in range(num_samples):
+        re, im, a = int(src[2*n]), int(src[2*n + 1]), int(acc[n])
+        p = (re * re + im * im + ((1 << fix_point) >> 1)) >> fix_point
+        if alpha == 0:
+            result[n] = min(a + p, 2**31 - 1)
+        else:
+            p = min(p, 2**31 - 1)
+            result[n] = a + ((alpha * (p - a) + (1 << 14)) >> 15)
+    return result
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -19,15 +19,26 @@ def compute_result(result_parameter, inputs, env, fix_point):
     env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
     fix_point: None (if no fixpoint is used) or decimal point
     """
-    if result_parameter.ctype == 'int32_t':
-        if fix_point is None:
-            a = inputs['srcA'].value.astype(np.int32)
-            b = inputs['srcB'].value.astype(np.int32)
-            return np.convolve(a, b, mode='full')
-        else:
-            raise RuntimeError("Fixpoint not implemented")
+    if fix_point is not None:
+        # q versions: exact sum, shifted with rounding and saturated to the output width
+        bits = {'int32_t': 32, 'int16_t': 16, 'int8_t': 8}[result_parameter.ctype]
+        a = [int(x) for x in inputs['srcA'].value]
+        b = [int(x) for x in inputs['srcB'].value]
+        result = np.zeros(len(a) + len(b) - 1, dtype=inputs['srcA'].value.dtype)
+        for n in range(len(result)):
+            acc = sum(a[k] * b[n - k] for k in range(max(0, n - len(b) + 1), min(n, len(a) - 1) + 1))
+            if fix_point > 0:
+                acc = (acc + (1 << (fix_point - 1))) >> fix_point
+            result[n] = max(-2**(bits - 1), min(2**(bits - 1) - 1, acc))
+        return result
+    elif result_parameter.ctype == 'int32_t':
+        a = inputs['srcA'].value.astype(np.int32)
+        b = inputs['srcB'].value.astype(np.int32)
+        return np.convolve(a, b, mode='full')
     elif result_parameter.ctype == 'float':
-        raise RuntimeError("Float not implemented")
+        a = inputs['srcA'].value.astype(np.float64)
+        b = inputs['srcB'].value.astype(np.float64)
+        return np.convolve(a, b, mode='full').astype(np.float32)
     else:
         raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
 
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value
+    k = inputs['pKernel'].value
+    rows = inputs['srcRows'].value
+    cols = inputs['srcCols'].value
+    channels = inputs['nChannels'].value
+    k_rows = inputs['kRows'].value
+    k_cols = inputs['kCols'].value
+    out_rows = rows - k_rows + 1
+    out_cols = cols - k_cols + 1
+
+    dtype = np.float32 if result_parameter.ctype == 'float' else np.int64
+    x = x.reshape(channels, rows, cols).astype(dtype)
+    # flip the kernel, such that the convolution becomes a correlation
+    k = k.reshape(channels, k_rows, k_cols)[:, ::-1, ::-1].astype(dtype)
+    result = np.zeros((channels, out_rows, out_cols), dtype=dtype)
+    for i in range(out_rows):
+        for j in range(out_cols):
+            window = x[:, i:i + k_rows, j:j + k_cols]
+            result[:, i, j] = np.sum(window * k, axis=(1, 2))
+
+    if result_parameter.ctype == 'float':
+        return result.flatten()
+    return result.flatten().astype(np.int32)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value.astype(np.int64)
+    u = inputs['pU'].value.astype(np.int64)
+    rows = inputs['srcRows'].value
+    cols = inputs['srcCols'].value
+    in_channels = inputs['inChannels'].value
+    out_channels = inputs['outChannels'].value
+    out_rows = rows - 2
+    out_cols = cols - 2
+
+    b_t = np.array([[1, 0, -1, 0], [0, 1, 1, 0], [0, -1, 1, 0], [0, 1, 0, -1]], dtype=np.int64)
+    a_t = np.array([[1, 1, 1, 0], [0, 1, -1, -1]], dtype=np.int64)
+
+    # zero padding for the last tiles of images with an odd output size
+    x = x.reshape(in_channels, rows, cols)
+    x = np.pad(x, ((0, 0), (0, out_rows % 2), (0, out_cols % 2)))
+    u = u.reshape(4, 4, out_channels, in_channels)
+
+    result = np.zeros((out_channels, out_rows + out_rows % 2, out_cols + out_cols % 2),
+                      dtype=np.int64)
+    for i in range(0, out_rows, 2):
+        for j in range(0, out_cols, 2):
+            v = np.stack([b_t @ x[ci, i:i + 4, j:j + 4] @ b_t.T for ci in range(in_channels)])
+            m = np.einsum('rsoc,crs->ors', u, v)
+            for co in range(out_channels):
+                # the weights are scaled by four
+                result[co, i:i + 2, j:j + 2] = (a_t @ m[co] @ a_t.T) >> 2
+
+    return result[:, :out_rows, :out_cols].flatten().astype(np.int32)
+    if result_parameter.ctype == 'float':
+        return result.flatten()
+    return result.flatten().astype(np.int32)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value
+    x = inputs['pSrc'].value
+    rows = inputs['srcRows'].value
+    cols = inputs['srcCols'].value
+    channels = inputs['nChannels'].value
+    k = inputs['pKernel'].value
+    k_rows = inputs['kRows'].value
+    k_cols = inputs['kCols'].value
+    stride = inputs['stride'].value
+    bias = inputs['pBias'].value
+    shift = inputs['shift'].value
+    relu = inputs['relu'].value
+    out_rows = (rows - k_rows) // stride + 1
+    out_cols = (cols - k_cols) // stride + 1
+
+    x = x.reshape(channels, rows, cols).astype(np.int64)
+    k = k.reshape(channels, k_rows, k_cols).astype(np.int64)
+    result = np.zeros((channels, out_rows, out_cols), dtype=np.int64)
+    for i in range(out_rows):
+        for j in range(out_cols):
+            window = x[:, i * stride:i * stride + k_rows, j * stride:j * stride + k_cols]
+            result[:, i, j] = (window * k).sum(axis=(1, 2))
+
+    result += bias.astype(np.int64).reshape(channels, 1, 1)
+    result = requantize(result, shift, relu)
+    return result.flatten().astype(np.dtype(result_parameter.ctype[:-2]))
+
+
+def requantize(x, shift, relu):
+    x = (x + ((1 << shift) >> 1)) >> shift
+    return np.clip(x, 0 if relu else -128, 127)
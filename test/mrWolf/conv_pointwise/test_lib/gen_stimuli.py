@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value
+    x = inputs['pSrc'].value
+    pixels = inputs['nPixels'].value
+    in_channels = inputs['inChannels'].value
+    w = inputs['pWeights'].value
+    out_channels = inputs['outChannels'].value
+    bias = inputs['pBias'].value
+    shift = inputs['shift'].value
+    relu = inputs['relu'].value
+
+    x = x.reshape(in_channels, pixels).astype(np.int64)
+    w = w.reshape(out_channels, in_channels).astype(np.int64)
+    result = w @ x + bias.astype(np.int64).reshape(out_channels, 1)
+
+    result = requantize(result, shift, relu)
+    return result.flatten().astype(np.dtype(result_parameter.ctype[:-2]))
+
+
+def requantize(x, shift, relu):
+    x = (x + ((1 << shift) >> 1)) >> shift
+    return np.clip(x, 0 if relu else -128, 127)
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value.astype(np.float32)
+    my_type = np.dtype(result_parameter.ctype[:-2]).type
+    bits = np.iinfo(my_type).bits
+    # scale in float, round to the nearest with ties away from zero, and saturate
+    v = x * np.float32(2.0 ** (bits - 1))
+    v = np.clip(v, np.float32(-2.0 ** 31), np.float32(2.0 ** 31))
+    v = np.trunc(v + np.where(v >= 0, np.float32(0.5), np.float32(-0.5)).astype(np.float32))
+    result = np.clip(v.astype(np.int64), np.iinfo(my_type).min, np.iinfo(my_type).max)
+    result = result.astype(my_type)
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
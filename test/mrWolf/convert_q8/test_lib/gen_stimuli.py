@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value.astype(np.int64)
+    src_bits = 8
+    if result_parameter.ctype == 'float':
+        result = (x.astype(np.float32) * np.float32(2.0 ** (1 - src_bits))).astype(np.float32)
+    else:
+        my_type = np.dtype(result_parameter.ctype[:-2]).type
+        dst_bits = np.iinfo(my_type).bits
+        if dst_bits > src_bits:
+            result = x << (dst_bits - src_bits)
+        else:
+            # round to the nearest, ties towards positive infinity, and saturate
+            shift = src_bits - dst_bits
+            result = (x + (1 << (shift - 1))) >> shift
+            result = np.clip(result, np.iinfo(my_type).min, np.iinfo(my_type).max)
+        result = result.astype(my_type)
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    src = inputs['pSrc'].value.astype(np.float64)
+    x = src[0::2]
+    y = src[1::2]
+
+    if result_parameter.ctype != 'int16_t':
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    # the angle is given in turns, 0.5 is mapped to PI
+    angle = 2 * np.pi * inputs['pAngle'].value.astype(np.float64) / 2**15
+    result = np.zeros(len(src))
+    result[0::2] = np.round(x * np.cos(angle) - y * np.sin(angle))
+    result[1::2] = np.round(x * np.sin(angle) + y * np.cos(angle))
+    return np.clip(result, -2**15, 2**15 - 1).astype(np.int16)
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -49,7 +49,9 @@ def compute_result(result_parameter, inputs, env, fix_point):
           return c.astype(np.int8)
 
     elif result_parameter.ctype == 'float':
-        raise RuntimeError("Float not implemented")
+        a = inputs['srcA'].value.astype(np.float64)
+        b = inputs['srcB'].value.astype(np.float64)
+        return np.correlate(a, b, mode='full').astype(np.float32)
     else:
         raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
 
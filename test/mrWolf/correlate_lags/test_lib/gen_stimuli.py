@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The q16 version shifts the exact sums with rounding, the q32 version shifts every product.
+
+    ctype = inputs['pSrcA'].ctype
+    a = inputs['pSrcA'].value
+    b = inputs['pSrcB'].value
+    len_a = env['len_a']
+    len_b = env['len_b']
+    min_lag = env['min_lag']
+
+    if ctype == 'float':
+        result = np.zeros(env['num_lags'], dtype=np.float32)
+    elif ctype in ('int16_t', 'int32_t'):
+        result = np.zeros(env['num_lags'], dtype=np.int32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    for l in range(min_lag, env['max_lag'] + 1):
+        start = max(-l, 0)
+        end = min(len_a - l, len_b)
+        if ctype == 'float':
+            acc = np.float32(0)
+            for n in range(start, end):
+                acc += np.float32(a[n + l]) * np.float32(b[n])
+            result[l - min_lag] = acc
+            continue
+        acc = 0
+        for n in range(start, end):
+            if ctype == 'int32_t':
+                acc += (int(a[n + l]) * int(b[n])) >> fix_point
+            else:
+                acc += int(a[n + l]) * int(b[n])
+        if ctype == 'int16_t' and fix_point > 0:
+            acc = (acc + (1 << (fix_point - 1))) >> fix_point
+        result[l - min_lag] = max(-2**31, min(2**31 - 1, acc))
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
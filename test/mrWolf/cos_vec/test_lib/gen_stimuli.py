@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value
+    if result_parameter.ctype == 'float':
+        return np.cos(x.astype(np.float32)).astype(np.float32)
+
+    if result_parameter.ctype == 'int16_t':
+        dtype, bits = np.int16, 16
+    elif result_parameter.ctype == 'int32_t':
+        dtype, bits = np.int32, 32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    # the input range [-1, 1) wraps around one period
+    in_rad = 2 * np.pi * x.astype(np.float64) / 2**(bits - 1)
+    result = np.round(2**(bits - 1) * np.cos(in_rad))
+    return np.clip(result, -2**(bits - 1), 2**(bits - 1) - 1).astype(dtype)
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    n = env['len']
+    channels = env['channels']
+    src = inputs['pSrc'].value.reshape((n, channels))
+
+    if result_parameter.ctype == 'float':
+        x = src.astype(np.float64)
+        if result_parameter.name == 'pMean':
+            return np.mean(x, axis=0).astype(np.float32)
+        cov = np.cov(x, rowvar=False).reshape((channels, channels)) if n > 1 \
+            else np.zeros((channels, channels))
+        return cov[np.tril_indices(channels)].astype(np.float32)
+
+    x = [[int(v) for v in row] for row in src]
+    sums = [sum(row[i] for row in x) for i in range(channels)]
+    if result_parameter.name == 'pMean':
+        return np.array([c_div(s, n) for s in sums], dtype=np.int16)
+
+    result = []
+    for i in range(channels):
+        for j in range(i + 1):
+            cov = 0
+            if n > 1:
+                prod = sum(row[i] * row[j] for row in x)
+                cov = c_div(n * prod - sums[i] * sums[j], (n * (n - 1)) << fix_point)
+            result.append(min(max(cov, -32768), 32767))
+    return np.array(result, dtype=np.int16)
+
+
+def c_div(a, b):
+    """ Integer division rounding towards zero, as in C """
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value
+    if result_parameter.ctype == 'float':
+        return np.cumsum(x.astype(np.float32), dtype=np.float32)
+
+    if result_parameter.ctype != 'int32_t':
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    result = np.cumsum(x.astype(np.int64))
+    if fix_point is not None:
+        # the fixed point version saturates, the integer versions wrap around
+        return np.clip(result, -2**31, 2**31 - 1).astype(np.int32)
+    return result.astype(np.int32)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
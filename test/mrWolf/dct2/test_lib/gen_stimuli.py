@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    ctype = result_parameter.ctype
+    if ctype == 'int16_t':
+        my_type = np.int16
+        my_fixpoint = 15
+    elif ctype == 'int32_t':
+        my_type = np.int32
+        my_fixpoint = 31
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    n = env['len']
+    x = inputs['pSrc'].value.astype(np.float64)
+    # DCT-II, scaled by 1 / N
+    i = np.arange(n)
+    basis = np.cos(np.pi / n * np.outer(i, i + 0.5))
+    result = basis.dot(x) / n
+
+    return np.clip(np.round(result), -2**my_fixpoint, 2**my_fixpoint - 1).astype(my_type)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
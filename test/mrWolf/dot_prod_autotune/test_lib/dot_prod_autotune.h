@@ -0,0 +1,118 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        dot_prod_autotune.h
+ * Description:  Autotuned dot product test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DOT_PROD_AUTOTUNE_H__
+#define __DOT_PROD_AUTOTUNE_H__
+
+#include "plp_math.h"
+
+/** -------------------------------------------------------
+    @brief      Dot product of 32-bit integer vectors, computed by plp_dot_prod_i32 and
+                plp_dot_prod_i32_autotune.
+    @param[in]  srcA    points to the first input vector
+    @param[in]  srcB    points to the second input vector
+    @param[in]  length  number of samples in each vector
+    @param[out] res     result of plp_dot_prod_i32
+    @param[out] tuned   result of the first call of plp_dot_prod_i32_autotune, which measures
+                        all variants
+    @param[out] cached  result of the second call of plp_dot_prod_i32_autotune, which runs the
+                        fastest variant
+    @return     none
+*/
+
+void dot_prod_i32_autotune(const int32_t *srcA,
+                           const int32_t *srcB,
+                           uint32_t length,
+                           int32_t *res,
+                           int32_t *tuned,
+                           int32_t *cached);
+
+/** -------------------------------------------------------
+    @brief      Dot product of 16-bit integer vectors, computed by plp_dot_prod_i16 and
+                plp_dot_prod_i16_autotune.
+    @param[in]  srcA    points to the first input vector
+    @param[in]  srcB    points to the second input vector
+    @param[in]  length  number of samples in each vector
+    @param[out] res     result of plp_dot_prod_i16
+    @param[out] tuned   result of the first call of plp_dot_prod_i16_autotune, which measures
+                        all variants
+    @param[out] cached  result of the second call of plp_dot_prod_i16_autotune, which runs the
+                        fastest variant
+    @return     none
+*/
+
+void dot_prod_i16_autotune(const int16_t *srcA,
+                           const int16_t *srcB,
+                           uint32_t length,
+                           int32_t *res,
+                           int32_t *tuned,
+                           int32_t *cached);
+
+/** -------------------------------------------------------
+    @brief      Dot product of 8-bit integer vectors, computed by plp_dot_prod_i8 and
+                plp_dot_prod_i8_autotune.
+    @param[in]  srcA    points to the first input vector
+    @param[in]  srcB    points to the second input vector
+    @param[in]  length  number of samples in each vector
+    @param[out] res     result of plp_dot_prod_i8
+    @param[out] tuned   result of the first call of plp_dot_prod_i8_autotune, which measures
+                        all variants
+    @param[out] cached  result of the second call of plp_dot_prod_i8_autotune, which runs the
+                        fastest variant
+    @return     none
+*/
+
+void dot_prod_i8_autotune(const int8_t *srcA,
+                          const int8_t *srcB,
+                          uint32_t length,
+                          int32_t *res,
+                          int32_t *tuned,
+                          int32_t *cached);
+
+/** -------------------------------------------------------
+    @brief      Dot product of 32-bit floating-point vectors, computed by plp_dot_prod_f32 and
+                plp_dot_prod_f32_autotune.
+    @param[in]  srcA    points to the first input vector
+    @param[in]  srcB    points to the second input vector
+    @param[in]  length  number of samples in each vector
+    @param[out] res     result of plp_dot_prod_f32
+    @param[out] tuned   result of the first call of plp_dot_prod_f32_autotune, which measures
+                        all variants
+    @param[out] cached  result of the second call of plp_dot_prod_f32_autotune, which runs the
+                        fastest variant
+    @return     none
+*/
+
+void dot_prod_f32_autotune(const float32_t *srcA,
+                           const float32_t *srcB,
+                           uint32_t length,
+                           float32_t *res,
+                           float32_t *tuned,
+                           float32_t *cached);
+
+#endif //__DOT_PROD_AUTOTUNE_H__
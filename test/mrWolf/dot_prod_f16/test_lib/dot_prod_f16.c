@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        dot_prod_f16.c
+ * Description:  Half-precision dot product test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dot_prod_f16.h"
+
+/**
+  @brief      Runs the dot product of half-precision vectors.
+
+  Both vectors are converted to half precision, and the result back to single precision. The
+  conversion does not depend on PLP_MATH_SMALLFLOAT, because both representations of float16_t
+  have the same bits in memory.
+
+  @param[in]  srcA    points to the first input vector
+  @param[in]  srcB    points to the second input vector
+  @param[in]  length  number of samples in each vector
+  @param[in]  pWork   points to the half-precision vectors, see DOT_PROD_F16_WORK_LEN
+  @param[in]  nPE     number of parallel processing units, or 0 for the serial function
+  @param[out] res     output result returned here
+  @return     none
+ */
+
+static void dot_prod_f16_run(const float32_t *srcA,
+                             const float32_t *srcB,
+                             uint32_t length,
+                             float32_t *pWork,
+                             uint32_t nPE,
+                             float32_t *res) {
+
+    float16_t *pA = (float16_t *)pWork;
+    float16_t *pB = pA + ((length + 1) & ~1);
+    float16_t result;
+    uint32_t i;
+
+    for (i = 0; i < length; i++) {
+        pA[i] = plp_f32_to_f16(srcA[i]);
+        pB[i] = plp_f32_to_f16(srcB[i]);
+    }
+
+    if (nPE == 0) {
+        plp_dot_prod_f16(pA, pB, length, &result);
+    } else {
+        plp_dot_prod_f16_parallel(pA, pB, length, nPE, &result);
+    }
+
+    *res = plp_f16_to_f32(result);
+}
+
+void dot_prod_f16(const float32_t *srcA,
+                  const float32_t *srcB,
+                  uint32_t length,
+                  float32_t *pWork,
+                  float32_t *res) {
+
+    dot_prod_f16_run(srcA, srcB, length, pWork, 0, res);
+}
+
+void dot_prod_f16_parallel(const float32_t *srcA,
+                           const float32_t *srcB,
+                           uint32_t length,
+                           float32_t *pWork,
+                           uint32_t nPE,
+                           float32_t *res) {
+
+    dot_prod_f16_run(srcA, srcB, length, pWork, nPE, res);
+}
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        dot_prod_f16.h
+ * Description:  Half-precision dot product test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DOT_PROD_F16_H__
+#define __DOT_PROD_F16_H__
+
+#include "plp_math.h"
+
+/**
+   Number of 32-bit words of the half-precision copies of both vectors, the second one starting at
+   a word boundary.
+*/
+#define DOT_PROD_F16_WORK_LEN(blockSize) ((blockSize) + 1)
+
+/** -------------------------------------------------------
+    @brief      Dot product of two vectors, computed by plp_dot_prod_f16.
+    @param[in]  srcA    points to the first input vector, which is exactly representable in
+                        half precision
+    @param[in]  srcB    points to the second input vector, which is exactly representable in
+                        half precision
+    @param[in]  length  number of samples in each vector
+    @param[in]  pWork   points to the half-precision vectors, see DOT_PROD_F16_WORK_LEN
+    @param[out] res     output result returned here
+    @return     none
+*/
+
+void dot_prod_f16(const float32_t *srcA,
+                  const float32_t *srcB,
+                  uint32_t length,
+                  float32_t *pWork,
+                  float32_t *res);
+
+/** -------------------------------------------------------
+    @brief      Dot product of two vectors, computed by plp_dot_prod_f16_parallel.
+    @param[in]  srcA    points to the first input vector, which is exactly representable in
+                        half precision
+    @param[in]  srcB    points to the second input vector, which is exactly representable in
+                        half precision
+    @param[in]  length  number of samples in each vector
+    @param[in]  pWork   points to the half-precision vectors, see DOT_PROD_F16_WORK_LEN
+    @param[in]  nPE     number of parallel processing units
+    @param[out] res     output result returned here
+    @return     none
+*/
+
+void dot_prod_f16_parallel(const float32_t *srcA,
+                           const float32_t *srcB,
+                           uint32_t length,
+                           float32_t *pWork,
+                           uint32_t nPE,
+                           float32_t *res);
+
+#endif //__DOT_PROD_F16_H__
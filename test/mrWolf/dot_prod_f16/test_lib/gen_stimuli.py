@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+####################
+# generate_stimuli #
+####################
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    # Multiples of 1/4 from -1 to 1: all products are multiples of 1/16, and every partial sum of
+    # up to 64 products has at most 11 significant bits, hence it is exact in half precision.
+    if arg.name in ['srcA', 'srcB']:
+        return (np.random.randint(-4, 5, size=env['len']) / 4).astype(np.float32)
+    raise RuntimeError("No stimuli for argument: %s" % arg.name)
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The result is exact, both with the half-precision accumulation of PLP_MATH_SMALLFLOAT and
+    # with the single-precision one of the emulation.
+
+    a = np.array(inputs['srcA'].value).astype(np.float64)
+    b = np.array(inputs['srcB'].value).astype(np.float64)
+    return np.array([np.dot(a, b)]).astype(np.float32)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        dot_prod_packed.h
+ * Description:  Packed 4-bit and 2-bit dot product test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DOT_PROD_PACKED_H__
+#define __DOT_PROD_PACKED_H__
+
+#include "plp_math.h"
+
+/**
+   Number of 32-bit words of the packed copies of both vectors, each one starting at a word
+   boundary.
+*/
+#define DOT_PROD_PACKED_WORK_LEN(blockSize, bits) (2 * (((blockSize) * (bits) + 31) / 32))
+
+/** -------------------------------------------------------
+    @brief      Dot product of two vectors, computed by plp_dot_prod_i4 on the packed vectors.
+    @param[in]  srcA    points to the first input vector, one 4-bit value per byte
+    @param[in]  srcB    points to the second input vector, one 4-bit value per byte
+    @param[in]  length  number of samples in each vector
+    @param[in]  pWork   points to the packed vectors, see DOT_PROD_PACKED_WORK_LEN
+    @param[out] res     output result returned here
+    @return     none
+*/
+
+void dot_prod_i4(const int8_t *srcA,
+                 const int8_t *srcB,
+                 uint32_t length,
+                 int32_t *pWork,
+                 int32_t *res);
+
+/** -------------------------------------------------------
+    @brief      Dot product of two vectors, computed by plp_dot_prod_i2 on the packed vectors.
+    @param[in]  srcA    points to the first input vector, one 2-bit value per byte
+    @param[in]  srcB    points to the second input vector, one 2-bit value per byte
+    @param[in]  length  number of samples in each vector
+    @param[in]  pWork   points to the packed vectors, see DOT_PROD_PACKED_WORK_LEN
+    @param[out] res     output result returned here
+    @return     none
+*/
+
+void dot_prod_i2(const int8_t *srcA,
+                 const int8_t *srcB,
+                 uint32_t length,
+                 int32_t *pWork,
+                 int32_t *res);
+
+#endif //__DOT_PROD_PACKED_H__
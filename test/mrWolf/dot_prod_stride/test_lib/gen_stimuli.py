@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    stride = env['stride']
+    if result_parameter.ctype == 'int32_t':
+        a = inputs['srcA'].value.astype(np.int64)[::stride]
+        b = inputs['srcB'].value.astype(np.int64)[::stride]
+        result = np.array([q_wrap(np.dot(a, b))], dtype=np.int32)
+    elif result_parameter.ctype == 'float':
+        # for float implementation, it is important to always use float32 for intermediate operations!
+        a = inputs['srcA'].value.astype(np.float32)[::stride]
+        b = inputs['srcB'].value.astype(np.float32)[::stride]
+        res = np.float32(0)
+        for x_a, x_b in zip(a, b):
+            res += x_a * x_b
+        result = np.array([res], dtype=np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result
+
+
+def q_wrap(x):
+    return ((int(x) + 2**31) % 2**32) - 2**31
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The instances start with a cleared envelope and the makeup gain 1.5, and the serial version
+    # only processes the first channel. The fixed-point arithmetic follows the kernels exactly.
+
+    src = inputs['pSrc'].value
+    length = env['len']
+    n_channels = result_parameter.length // length
+
+    if inputs['pSrc'].ctype == 'float':
+        result = np.zeros(n_channels * length, dtype=np.float32)
+        drc = drc_f32
+    else:
+        result = np.zeros(n_channels * length, dtype=np.int16)
+        drc = drc_q16
+
+    for c in range(n_channels):
+        result[c * length:(c + 1) * length] = drc(src[c * length:(c + 1) * length],
+                                                  env['threshold'], env['slope'])
+
+    return result
+
+
+def trunc_div(a, b):
+    """ integer division rounding towards zero, like in C """
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b > 0) else -q
+
+
+def log_q16(x):
+    """ natural logarithm of a positive integer in Q15, as in the kernels """
+    n = 32 - x.bit_length()
+    m = (x << n) & 0xFFFFFFFF
+    e = 31 - n
+    if m > 0xB504F333:
+        m >>= 1
+        e += 1
+    d = (m - 0x80000000) >> 16
+
+    acc = 5739
+    acc = ((acc * d) >> 15) - 8962
+    acc = ((acc * d) >> 15) + 11054
+    acc = ((acc * d) >> 15) - 16359
+    acc = ((acc * d) >> 15) + 32765
+
+    return e * 22713 + ((acc * d) >> 15)
+
+
+def drc_q16(x, threshold, slope):
+    """ one block of the DRC, starting with a cleared envelope and the makeup gain 1.5 """
+    makeup = 0x0180
+    x = [int(v) for v in x]
+
+    peak = min(max(abs(v) for v in x), 0x7FFF)
+    env = ((30000 if peak > 0 else 2000) * peak) >> 15
+
+    if env <= threshold:
+        g_new = makeup
+    else:
+        t = -((slope * (log_q16(env) - log_q16(threshold)) * 47274) >> 30)
+        shift = -(t >> 15)
+        u = t & 0x7FFF
+        if shift > 16:
+            g_new = 0
+        else:
+            acc = 449
+            acc = ((acc * u) >> 15) + 1694
+            acc = ((acc * u) >> 15) + 7918
+            acc = ((acc * u) >> 15) + 22707
+            acc = ((acc * u) >> 15) + 32768
+            if shift > 0:
+                acc = (acc + (1 << (shift - 1))) >> shift
+            g_new = (acc * makeup) >> 15
+
+    step = trunc_div((g_new - makeup) * 65536, len(x))
+    g = makeup * 65536
+    y = []
+    for v in x:
+        g += step
+        y.append(min(max((v * (g >> 16)) >> 8, -0x8000), 0x7FFF))
+    return y
+
+
+def drc_f32(x, threshold, slope):
+    """ one block of the DRC in floating point """
+    makeup = 1.5
+    threshold = threshold / 32768
+    slope = slope / 32768
+
+    peak = float(np.max(np.abs(x)))
+    env = (30000 / 32768 if peak > 0 else 2000 / 32768) * peak
+    g_new = makeup * (threshold / env)**slope if env > threshold else makeup
+
+    gain = makeup + (g_new - makeup) * np.arange(1, len(x) + 1) / len(x)
+    return (np.array(x, dtype=np.float64) * gain).astype(np.float32)
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    q = [float(v) for v in inputs['pSrcQ'].value]
+    t = np.array(inputs['pTemplates'].value, dtype=np.float64).reshape(env['nT'], env['lenT'])
+    dist = np.array([dtw(q, list(row), env['band']) for row in t])
+    # nearest template, the first one on ties
+    index = int(np.argmin(dist))
+    result = {'pDist': dist, 'pMin': [dist[index]], 'pIndex': [index]}[result_parameter.name]
+
+    dtype = {'int32_t': np.int32, 'int16_t': np.int16, 'int8_t': np.int8, 'float': np.float32,
+             'uint32_t': np.uint32}
+    if result_parameter.ctype not in dtype:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return np.array(result).astype(dtype[result_parameter.ctype])
+
+
+def dtw(q, t, band):
+    """ DTW distance of q and t with the Sakoe-Chiba band """
+    inf = float('inf')
+    D = np.full((len(q) + 1, len(t) + 1), inf)
+    D[0, 0] = 0
+    for i in range(len(q)):
+        for j in range(max(0, i - band), min(len(t), i + band + 1)):
+            D[i + 1, j + 1] = abs(q[i] - t[j]) + min(D[i, j], D[i, j + 1], D[i + 1, j])
+    return D[len(q), len(t)]
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
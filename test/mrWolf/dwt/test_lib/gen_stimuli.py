@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+# lifting steps (update, offset, c0, c1) and scaling of the approximation and the detail, as in
+# dwtLiftingTable_f32
+LIFTING = [
+    # Haar
+    ([(0, 0, -1.0, 0.0), (1, 0, 0.5, 0.0)], np.sqrt(2), 1 / np.sqrt(2)),
+    # db4
+    ([(0, 0, -0.3222758880, 0.0), (1, -1, -1.1171236052, 0.2919531260),
+      (0, 0, -1.6889170660, 0.5400282834), (1, -1, 0.0066173380, 0.5547946970),
+      (0, 1, -0.3190921925, 0.0)], 2.6337752651, -0.3796831161),
+    # CDF 9/7
+    ([(0, 0, -1.5861343421, -1.5861343421), (1, -1, -0.0529801186, -0.0529801186),
+      (0, 0, 0.8829110755, 0.8829110755), (1, -1, 0.4435068520, 0.4435068520)],
+     1.1496043989, 0.8698644516),
+]
+
+
+def dwt_level(x, wavelet):
+    steps, scale_a, scale_d = LIFTING[wavelet]
+    s, d = x[0::2].copy(), x[1::2].copy()
+    for update, o, c0, c1 in steps:
+        if update:
+            s += c0 * np.roll(d, -o) + c1 * np.roll(d, -o - 1)
+        else:
+            d += c0 * np.roll(s, -o) + c1 * np.roll(s, -o - 1)
+    return np.concatenate([scale_a * s, scale_d * d])
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrcDst'].value.astype(np.float64)
+    ctype = result_parameter.ctype
+    for l in range(env['levels']):
+        n = env['len'] >> l
+        y = dwt_level(x[:n], env['wavelet'])
+        if ctype == 'int16_t':
+            # every level is scaled by 1/sqrt(2) and rounded to 16 bits
+            y = np.clip(np.round(y / np.sqrt(2)), -2**15, 2**15 - 1)
+        x[:n] = y
+
+    if ctype == 'float':
+        return x.astype(np.float32)
+    if ctype == 'int16_t':
+        return x.astype(np.int16)
+    raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
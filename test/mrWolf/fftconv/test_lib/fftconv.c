@@ -0,0 +1,186 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        fftconv.c
+ * Description:  FFT convolution test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "fftconv.h"
+
+/**
+  @brief      Runs the FFT convolution of a 16-bit fixed-point stream.
+
+  The transform of length fftLen is initialized at runtime. The stream is passed to the
+  convolution in calls of samplesPerCall samples (the last call may get fewer), which need not be
+  a multiple of the block length fftLen - filterLen + 1, such that the state carries over from one
+  call to the next in the middle of a block.
+
+  @param[in]  pFilter         points to the filter coefficients in Q1.15
+  @param[in]  filterLen       number of filter coefficients, at most fftLen
+  @param[in]  fftLen          length of the transform, a power of two from 16 to 4096
+  @param[in]  pSrc            points to the numSamples input samples in Q1.15
+  @param[in]  numSamples      number of input samples
+  @param[in]  samplesPerCall  number of samples per call
+  @param[in]  pWork           points to the buffers of the instance, see FFTCONV_WORK_LEN
+  @param[in]  nPE             number of parallel processing units, or 0 for the serial functions
+  @param[out] pDst            points to the numSamples output samples in Q1.15
+  @return     none
+ */
+
+static void fftconv_run_q16(const int16_t *pFilter,
+                            uint32_t filterLen,
+                            uint32_t fftLen,
+                            const int16_t *pSrc,
+                            uint32_t numSamples,
+                            uint32_t samplesPerCall,
+                            int32_t *pWork,
+                            uint32_t nPE,
+                            int16_t *pDst) {
+
+    plp_cfft_instance_q32 fft;
+    plp_fftconv_instance_q16 S;
+    uint32_t i, n;
+
+    int32_t *pFilterSpectrum = pWork;
+    int32_t *pBuffer = pFilterSpectrum + 2 * fftLen;
+    int32_t *pTables = pBuffer + 2 * fftLen;
+    int16_t *pState = (int16_t *)(pTables + 2 * fftLen);
+
+    if (plp_cfft_init_q32(&fft, fftLen, pTables) != 0 ||
+        plp_fftconv_init_q16(&S, &fft, pFilter, filterLen, pFilterSpectrum, pState, pBuffer) != 0) {
+        printf("Error: unsupported transform or filter length!\n");
+        return;
+    }
+
+    for (i = 0; i < numSamples; i += n) {
+        n = (numSamples - i < samplesPerCall) ? numSamples - i : samplesPerCall;
+        if (nPE == 0) {
+            plp_fftconv_q16(&S, pSrc + i, n, pDst + i);
+        } else {
+            plp_fftconv_q16_parallel(&S, pSrc + i, n, nPE, pDst + i);
+        }
+    }
+}
+
+/**
+  @brief      Runs the FFT convolution of a 32-bit floating-point stream, like fftconv_run_q16.
+  @param[in]  pFilter         points to the filter coefficients
+  @param[in]  filterLen       number of filter coefficients, at most fftLen
+  @param[in]  fftLen          length of the transform, a power of two from 4 to 32768
+  @param[in]  pSrc            points to the numSamples input samples
+  @param[in]  numSamples      number of input samples
+  @param[in]  samplesPerCall  number of samples per call
+  @param[in]  pWork           points to the buffers of the instance, see FFTCONV_WORK_LEN
+  @param[in]  nPE             number of parallel processing units, or 0 for the serial functions
+  @param[out] pDst            points to the numSamples output samples
+  @return     none
+ */
+
+static void fftconv_run_f32(const float32_t *pFilter,
+                            uint32_t filterLen,
+                            uint32_t fftLen,
+                            const float32_t *pSrc,
+                            uint32_t numSamples,
+                            uint32_t samplesPerCall,
+                            float32_t *pWork,
+                            uint32_t nPE,
+                            float32_t *pDst) {
+
+    plp_rfft_instance_f32 fft;
+    plp_fftconv_instance_f32 S;
+    uint32_t i, n;
+
+    float32_t *pFilterSpectrum = pWork;
+    float32_t *pBuffer = pFilterSpectrum + 2 * fftLen;
+    float32_t *pTables = pBuffer + 3 * fftLen;
+    float32_t *pState = pTables + 2 * fftLen;
+
+    if (plp_cfft_init_f32(&fft, fftLen, pTables) != 0 ||
+        plp_fftconv_init_f32(&S, &fft, pFilter, filterLen, pFilterSpectrum, pState, pBuffer) != 0) {
+        printf("Error: unsupported transform or filter length!\n");
+        return;
+    }
+
+    for (i = 0; i < numSamples; i += n) {
+        n = (numSamples - i < samplesPerCall) ? numSamples - i : samplesPerCall;
+        if (nPE == 0) {
+            plp_fftconv_f32(&S, pSrc + i, n, pDst + i);
+        } else {
+            plp_fftconv_f32_parallel(&S, pSrc + i, n, nPE, pDst + i);
+        }
+    }
+}
+
+void fftconv_q16(const int16_t *pFilter,
+                 uint32_t filterLen,
+                 uint32_t fftLen,
+                 const int16_t *pSrc,
+                 uint32_t numSamples,
+                 uint32_t samplesPerCall,
+                 int32_t *pWork,
+                 int16_t *pDst) {
+
+    fftconv_run_q16(pFilter, filterLen, fftLen, pSrc, numSamples, samplesPerCall, pWork, 0, pDst);
+}
+
+void fftconv_q16_parallel(const int16_t *pFilter,
+                          uint32_t filterLen,
+                          uint32_t fftLen,
+                          const int16_t *pSrc,
+                          uint32_t numSamples,
+                          uint32_t samplesPerCall,
+                          int32_t *pWork,
+                          uint32_t nPE,
+                          int16_t *pDst) {
+
+    fftconv_run_q16(pFilter, filterLen, fftLen, pSrc, numSamples, samplesPerCall, pWork, nPE,
+                    pDst);
+}
+
+void fftconv_f32(const float32_t *pFilter,
+                 uint32_t filterLen,
+                 uint32_t fftLen,
+                 const float32_t *pSrc,
+                 uint32_t numSamples,
+                 uint32_t samplesPerCall,
+                 float32_t *pWork,
+                 float32_t *pDst) {
+
+    fftconv_run_f32(pFilter, filterLen, fftLen, pSrc, numSamples, samplesPerCall, pWork, 0, pDst);
+}
+
+void fftconv_f32_parallel(const float32_t *pFilter,
+                          uint32_t filterLen,
+                          uint32_t fftLen,
+                          const float32_t *pSrc,
+                          uint32_t numSamples,
+                          uint32_t samplesPerCall,
+                          float32_t *pWork,
+                          uint32_t nPE,
+                          float32_t *pDst) {
+
+    fftconv_run_f32(pFilter, filterLen, fftLen, pSrc, numSamples, samplesPerCall, pWork, nPE,
+                    pDst);
+}
@@ -0,0 +1,137 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        fftconv.h
+ * Description:  FFT convolution test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FFTCONV_H__
+#define __FFTCONV_H__
+
+#include "plp_math.h"
+
+/**
+   Number of 32-bit words of the buffers of the transform and of the instance: the spectrum of the
+   filter, the work buffer of at most 3*fftLen values, the tables of the transform of at most
+   2*fftLen values (plp_cfft_init_q32), and the past input samples.
+*/
+#define FFTCONV_WORK_LEN(fftLen) (8 * (fftLen))
+
+/** -------------------------------------------------------
+    @brief      FFT convolution of a 16-bit fixed-point stream.
+    @param[in]  pFilter         points to the filter coefficients in Q1.15
+    @param[in]  filterLen       number of filter coefficients, at most fftLen
+    @param[in]  fftLen          length of the transform, a power of two from 16 to 4096
+    @param[in]  pSrc            points to the numSamples input samples in Q1.15
+    @param[in]  numSamples      number of input samples
+    @param[in]  samplesPerCall  number of samples, which are passed to one call of the
+                                convolution
+    @param[in]  pWork           points to the buffers of the instance, see FFTCONV_WORK_LEN
+    @param[out] pDst            points to the numSamples output samples in Q1.15
+    @return     none
+*/
+
+void fftconv_q16(const int16_t *pFilter,
+                 uint32_t filterLen,
+                 uint32_t fftLen,
+                 const int16_t *pSrc,
+                 uint32_t numSamples,
+                 uint32_t samplesPerCall,
+                 int32_t *pWork,
+                 int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      Parallel FFT convolution of a 16-bit fixed-point stream.
+    @param[in]  pFilter         points to the filter coefficients in Q1.15
+    @param[in]  filterLen       number of filter coefficients, at most fftLen
+    @param[in]  fftLen          length of the transform, a power of two from 16 to 4096
+    @param[in]  pSrc            points to the numSamples input samples in Q1.15
+    @param[in]  numSamples      number of input samples
+    @param[in]  samplesPerCall  number of samples, which are passed to one call of the
+                                convolution
+    @param[in]  pWork           points to the buffers of the instance, see FFTCONV_WORK_LEN
+    @param[in]  nPE             number of parallel processing units
+    @param[out] pDst            points to the numSamples output samples in Q1.15
+    @return     none
+*/
+
+void fftconv_q16_parallel(const int16_t *pFilter,
+                          uint32_t filterLen,
+                          uint32_t fftLen,
+                          const int16_t *pSrc,
+                          uint32_t numSamples,
+                          uint32_t samplesPerCall,
+                          int32_t *pWork,
+                          uint32_t nPE,
+                          int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      FFT convolution of a 32-bit floating-point stream.
+    @param[in]  pFilter         points to the filter coefficients
+    @param[in]  filterLen       number of filter coefficients, at most fftLen
+    @param[in]  fftLen          length of the transform, a power of two from 4 to 32768
+    @param[in]  pSrc            points to the numSamples input samples
+    @param[in]  numSamples      number of input samples
+    @param[in]  samplesPerCall  number of samples, which are passed to one call of the
+                                convolution
+    @param[in]  pWork           points to the buffers of the instance, see FFTCONV_WORK_LEN
+    @param[out] pDst            points to the numSamples output samples
+    @return     none
+*/
+
+void fftconv_f32(const float32_t *pFilter,
+                 uint32_t filterLen,
+                 uint32_t fftLen,
+                 const float32_t *pSrc,
+                 uint32_t numSamples,
+                 uint32_t samplesPerCall,
+                 float32_t *pWork,
+                 float32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      Parallel FFT convolution of a 32-bit floating-point stream.
+    @param[in]  pFilter         points to the filter coefficients
+    @param[in]  filterLen       number of filter coefficients, at most fftLen
+    @param[in]  fftLen          length of the transform, a power of two from 4 to 32768
+    @param[in]  pSrc            points to the numSamples input samples
+    @param[in]  numSamples      number of input samples
+    @param[in]  samplesPerCall  number of samples, which are passed to one call of the
+                                convolution
+    @param[in]  pWork           points to the buffers of the instance, see FFTCONV_WORK_LEN
+    @param[in]  nPE             number of parallel processing units
+    @param[out] pDst            points to the numSamples output samples
+    @return     none
+*/
+
+void fftconv_f32_parallel(const float32_t *pFilter,
+                          uint32_t filterLen,
+                          uint32_t fftLen,
+                          const float32_t *pSrc,
+                          uint32_t numSamples,
+                          uint32_t samplesPerCall,
+                          float32_t *pWork,
+                          uint32_t nPE,
+                          float32_t *pDst);
+
+#endif //__FFTCONV_H__
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value
+    ky = inputs['pKernelY'].value.astype(np.int64)
+    kx = inputs['pKernelX'].value.astype(np.int64)
+    rows = inputs['srcRows'].value
+    cols = inputs['srcCols'].value
+    channels = inputs['nChannels'].value
+    k_rows = inputs['kRows'].value
+    k_cols = inputs['kCols'].value
+    shift_y = inputs['shiftY'].value
+    shift = inputs['shift'].value
+    out_rows = rows - k_rows + 1
+    out_cols = cols - k_cols + 1
+    bits = 8 if result_parameter.ctype == 'int8_t' else 16
+
+    x = x.reshape(channels, rows, cols).astype(np.int64)
+    # vertical pass, rounded to the intermediate precision
+    t = np.zeros((channels, out_rows, cols), dtype=np.int64)
+    for r in range(k_rows):
+        t += ky[r] * x[:, r:r + out_rows, :]
+    t = (t + ((1 << shift_y) >> 1)) >> shift_y
+    # horizontal pass, rounded and saturated
+    result = np.zeros((channels, out_rows, out_cols), dtype=np.int64)
+    for c in range(k_cols):
+        result += kx[c] * t[:, :, c:c + out_cols]
+    result = (result + ((1 << shift) >> 1)) >> shift
+    result = np.clip(result, -2**(bits - 1), 2**(bits - 1) - 1)
+
+    return result.flatten().astype(np.int8 if bits == 8 else np.int16)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
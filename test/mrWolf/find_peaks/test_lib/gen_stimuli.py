@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value
+    threshold = inputs['threshold'].value
+    min_dist = max(inputs['minDist'].value, 1)
+    max_peaks = inputs['maxPeaks'].value
+    n = len(x)
+
+    # larger than the min_dist samples before, not smaller than the min_dist samples after
+    peaks = []
+    for k in range(1, n - 1):
+        b = x[k]
+        if b >= threshold and \
+           all(x[k - j] < b for j in range(1, min_dist + 1) if j <= k) and \
+           all(x[k + j] <= b for j in range(1, min_dist + 1) if k + j < n):
+            peaks.append(k)
+    # largest first, equal peaks in the order of the input
+    peaks = sorted(peaks, key=lambda k: -float(x[k]))[:max_peaks]
+
+    index, delta, value = [], [], []
+    for k in peaks:
+        if inputs['pSrc'].ctype == 'float':
+            a, b, c = np.float32(x[k - 1]), np.float32(x[k]), np.float32(x[k + 1])
+            num = a - c
+            d = np.float32(0.5) * num / (a - np.float32(2) * b + c)
+            v = b - np.float32(0.25) * num * d
+        else:
+            q32 = inputs['pSrc'].ctype == 'int32_t'
+            a, b, c = int(x[k - 1]), int(x[k]), int(x[k + 1])
+            num = a - c
+            den = a - 2 * b + c
+            # C division truncates towards zero
+            d = abs(num) * (2 ** 30 if q32 else 2 ** 14) // abs(den)
+            d = d if (num < 0) == (den < 0) else -d
+            v = min(b - ((num * d) >> (33 if q32 else 17)), 2 ** 31 - 1 if q32 else 2 ** 15 - 1)
+        index.append(k)
+        delta.append(d)
+        value.append(v)
+
+    result = {'pIndex': index, 'pDelta': delta, 'pValue': value,
+              'pNumPeaks': [len(peaks)]}[result_parameter.name]
+
+    dtype = {'int32_t': np.int32, 'int16_t': np.int16, 'float': np.float32, 'uint32_t': np.uint32}
+    if result_parameter.ctype not in dtype:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return np.array(result).astype(dtype[result_parameter.ctype])
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The state is cleared, hence every output only depends on the current block. The coefficients
+    # are stored in time-reversed order, and only every M-th output is kept.
+
+    ctype = inputs['pSrc'].ctype
+    if ctype == 'int16_t':
+        my_type, my_bits, shift = np.int16, 16, 15
+    elif ctype == 'int32_t':
+        my_type, my_bits, shift = np.int32, 32, 15
+    elif ctype == 'float':
+        my_type, my_bits, shift = np.float32, None, None
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    coeffs = inputs['pCoeffs'].value
+    src = inputs['pSrc'].value
+    taps = env['taps']
+    M = env['M']
+
+    result = np.zeros(env['out_len'], dtype=my_type)
+    for m in range(env['out_len']):
+        acc = np.float32(0) if my_bits is None else 0
+        for k in range(taps):
+            i = m * M - (taps - 1) + k
+            if i >= 0:
+                if my_bits is None:
+                    acc += np.float32(coeffs[k]) * np.float32(src[i])
+                else:
+                    acc += int(coeffs[k]) * int(src[i])
+        if my_bits is None:
+            result[m] = np.float32(acc)
+        else:
+            acc = (int(acc) + (1 << (shift - 1))) >> shift
+            result[m] = max(-2**(my_bits - 1), min(2**(my_bits - 1) - 1, acc))
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
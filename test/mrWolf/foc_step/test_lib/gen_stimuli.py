@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+# Must match the instance in testset.cfg: (Kp, Ki, Kd, fracBits, outMin, outMax)
+PID_Q16 = (128, 32, 16, 8, -20000, 20000)
+PID_Q32 = (1 << 15, 1 << 13, 1 << 12, 16, -(1 << 30), 1 << 30)
+
+
+def pid_first_step(pid, err):
+    """ output of a PID controller in the reset state """
+    kp, ki, kd, frac_bits, out_min, out_max = pid
+    integ = np.clip(ki * err, out_min * 2**frac_bits, out_max * 2**frac_bits)
+    return np.clip((integ + (kp + kd) * err) / 2**frac_bits, out_min, out_max)
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype == 'int16_t':
+        dtype, bits, pid = np.int16, 16, PID_Q16
+    elif result_parameter.ctype == 'int32_t':
+        dtype, bits, pid = np.int32, 32, PID_Q32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    lo, hi = -2**(bits - 1), 2**(bits - 1) - 1
+    ia = float(inputs['Ia'].value)
+    ib = float(inputs['Ib'].value)
+    theta = 2 * np.pi * float(inputs['theta'].value) / 2**(bits - 1)
+    s, c = np.sin(theta), np.cos(theta)
+
+    i_alpha = ia
+    i_beta = np.clip((ia + 2 * ib) / np.sqrt(3), lo, hi)
+    i_d = np.clip(i_alpha * c + i_beta * s, lo, hi)
+    i_q = np.clip(i_beta * c - i_alpha * s, lo, hi)
+
+    v_d = pid_first_step(pid, np.clip(float(inputs['IdRef'].value) - i_d, lo, hi))
+    v_q = pid_first_step(pid, np.clip(float(inputs['IqRef'].value) - i_q, lo, hi))
+
+    if result_parameter.name == 'pValpha':
+        result = v_d * c - v_q * s
+    else:
+        result = v_d * s + v_q * c
+
+    return np.array([np.clip(np.round(result), lo, hi)]).astype(dtype)
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    p = [int(x) for x in inputs['pSrc'].value]
+    n = len(p)
+
+    if result_parameter.name == 'pEnergy':
+        result = sum((x * x) >> fix_point for x in p)
+    elif result_parameter.name == 'pZeroCross':
+        result = sum((a < 0) != (b < 0) for a, b in zip(p[:-1], p[1:]))
+    elif result_parameter.name == 'pPeak':
+        result = min(max(abs(x) for x in p), 0x7FFF)
+    else:
+        result = c_div(sum(p), n)
+
+    dtype = {'int32_t': np.int32, 'uint32_t': np.uint32, 'int16_t': np.int16}[result_parameter.ctype]
+    return np.array([result]).astype(dtype)
+
+
+def c_div(a, b):
+    """ Integer division rounding towards zero, as in C """
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
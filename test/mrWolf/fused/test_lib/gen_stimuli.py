@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # same chains as in testset.cfg, the floating-point version uses the 16-bit operands
+    chains = {
+        'int16_t': [
+            [('MULT', 3), ('ADD', 1000), ('SHIFT', 2), ('CLIP', -8000, 8000)],
+            [('ABS',), ('MAX', 100), ('SHIFT', -1), ('MIN', 30000), ('ADD', -2000)],
+        ],
+        'int8_t': [
+            [('MULT', 3), ('ADD', 10), ('SHIFT', 2), ('CLIP', -50, 50)],
+            [('ABS',), ('MAX', 10), ('SHIFT', -1), ('MIN', 200), ('ADD', -100)],
+        ],
+    }
+
+    ctype = inputs['pSrc'].ctype
+    ops = chains['int8_t' if ctype == 'int8_t' else 'int16_t'][env['chain']]
+
+    if ctype == 'float':
+        y = inputs['pSrc'].value.astype(np.float64)
+    else:
+        y = inputs['pSrc'].value.astype(np.int64)
+
+    for op in ops:
+        if op[0] == 'MULT':
+            y = y * op[1]
+        elif op[0] == 'ADD':
+            y = y + op[1]
+        elif op[0] == 'SHIFT':
+            if ctype == 'float':
+                y = y * 2.0**(-op[1])
+            elif op[1] >= 0:
+                y = y >> op[1]
+            else:
+                y = y << -op[1]
+        elif op[0] == 'CLIP':
+            y = np.clip(y, op[1], op[2])
+        elif op[0] == 'ABS':
+            y = np.abs(y)
+        elif op[0] == 'MAX':
+            y = np.maximum(y, op[1])
+        elif op[0] == 'MIN':
+            y = np.minimum(y, op[1])
+
+    if ctype == 'float':
+        return y.astype(np.float32)
+
+    info = np.iinfo(np.dtype(ctype[:-2]))
+    return np.clip(y, info.min, info.max).astype(np.dtype(ctype[:-2]))
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # same frequencies as in testset.cfg
+    freqs = [0.05, 0.1, 697 / 8000, 0.25, 0.33]
+
+    ctype = inputs['pSrc'].ctype
+    if ctype == 'int16_t':
+        shift = 0
+    elif ctype == 'int32_t':
+        shift = 16
+    else:
+        raise RuntimeError("Unrecognized input type: %s" % ctype)
+
+    n = env['len']
+    x = inputs['pSrc'].value.astype(np.float64) / 2**shift
+    result = []
+    for f in freqs:
+        # y = exp(j 2 pi f N) * sum_n x[n] exp(-j 2 pi f n)
+        y = np.exp(2j * np.pi * f * n) * np.sum(x * np.exp(-2j * np.pi * f * np.arange(n)))
+        result += [y.real, y.imag]
+
+    return np.round(np.array(result)).astype(np.int32)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = [int(v) for v in inputs['pInput'].value]
+    h = [int(v) for v in inputs['pHidden'].value]
+    w = [int(v) for v in inputs['pWeights'].value]
+    b = [int(v) for v in inputs['pBias'].value]
+    n_in, n_hid = env['len_input'], env['len_hidden']
+    n_cols = n_in + n_hid
+    is_q16 = result_parameter.ctype == 'int16_t'
+    # accumulator in Q(fix_point + 15) or Q(fix_point + 7), gates in Q3.12
+    shift = fix_point + 3 if is_q16 else fix_point - 5
+    result = []
+    for j in range(n_hid):
+        acc_x, acc_h = [], []
+        for g in range(3):
+            row = w[(g * n_hid + j) * n_cols:(g * n_hid + j + 1) * n_cols]
+            acc_x.append(sum(v * wv for v, wv in zip(x, row[:n_in])))
+            acc_h.append(sum(v * wv for v, wv in zip(h, row[n_in:])))
+        r = sigmoid_q12(gate_q12(acc_x[0] + acc_h[0] + b[j], shift))
+        z = sigmoid_q12(gate_q12(acc_x[1] + acc_h[1] + b[n_hid + j], shift))
+        n = gate_q12(acc_h[2] + b[3 * n_hid + j], shift)
+        n = tanh_q12(gate_q12(acc_x[2] + b[2 * n_hid + j], shift) + ((r * n + (1 << 14)) >> 15))
+        if is_q16:
+            result.append(n + ((z * (h[j] - n) + (1 << 14)) >> 15))
+        else:
+            y = n + ((z * (h[j] * 256 - n) + (1 << 14)) >> 15)
+            result.append(min((y + (1 << 7)) >> 8, 127))
+    return np.array(result, dtype=np.int16 if is_q16 else np.int8)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+TANH_TABLE = [min(32767, int(np.floor(np.tanh(n / 32) * 32768 + 0.5))) for n in range(257)]
+
+
+def tanh_q12(x):
+    """same as plp_tanh_q12"""
+    a = min(abs(x), 0x7FFF)
+    i = a >> 7
+    y = TANH_TABLE[i] + (((TANH_TABLE[i + 1] - TANH_TABLE[i]) * (a & 0x7F) + 64) >> 7)
+    return -y if x < 0 else y
+
+
+def sigmoid_q12(x):
+    """same as plp_sigmoid_q12"""
+    a = min(abs(x), 0x7FFF)
+    i = a >> 8
+    y = TANH_TABLE[i] + (((TANH_TABLE[i + 1] - TANH_TABLE[i]) * (a & 0xFF) + 128) >> 8)
+    return (0x8000 + (-y if x < 0 else y)) >> 1
+
+
+def gate_q12(acc, shift):
+    """same as plp_rnn_gate_q12"""
+    if shift > 0:
+        acc = ((acc >> (shift - 1)) + 1) >> 1
+    elif shift < 0:
+        acc = acc * (1 << -shift)
+    return min(max(acc, -0x8000), 0x7FFF)
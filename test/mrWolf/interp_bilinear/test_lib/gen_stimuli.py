@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # Must match the instance in testset.cfg
+    num_rows, num_cols = 9, 13
+
+    data = np.array(inputs['pData'].value, dtype=np.float64).reshape(num_rows, num_cols)
+    x = np.array(inputs['pX'].value, dtype=np.float64)
+    y = np.array(inputs['pY'].value, dtype=np.float64)
+
+    if result_parameter.ctype == 'int16_t':
+        x = x / 2**20
+        y = y / 2**20
+    elif result_parameter.ctype != 'float':
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    # the positions are clamped to the grid
+    x = np.clip(x, 0, num_cols - 1)
+    y = np.clip(y, 0, num_rows - 1)
+
+    # interpolate along the columns in every row, and then along the rows
+    rows = np.array([np.interp(x, np.arange(num_cols), data[r]) for r in range(num_rows)])
+    result = np.array([np.interp(y, np.arange(num_rows), rows[:, j]) for j in range(len(x))]).T
+
+    if result_parameter.ctype == 'float':
+        return result.flatten().astype(np.float32)
+    return np.round(result).flatten().astype(np.int16)
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # Must match the instance in testset.cfg
+    n_values, x1, x_spacing = 33, -1.0, 0.5
+
+    y = np.array(inputs['pYData'].value, dtype=np.float64)
+    x = np.array(inputs['pX'].value, dtype=np.float64)
+
+    if result_parameter.ctype == 'float':
+        x = (x - x1) / x_spacing
+    elif result_parameter.ctype == 'int16_t':
+        x = x / 2**20
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    # positions outside the table return the first or the last sample
+    result = np.interp(x, np.arange(n_values), y)
+
+    if result_parameter.ctype == 'float':
+        return result.astype(np.float32)
+    return np.round(result).astype(np.int16)
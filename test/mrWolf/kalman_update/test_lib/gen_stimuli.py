@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+
+    n = env['states'] if arg.name == 'pP' else env['meas']
+    return covariance_matrix(n).reshape((n * n, ))
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    n, m = env['states'], env['meas']
+    x = inputs['pX'].value.astype(np.float64)
+    P = inputs['pP'].value.reshape((n, n)).astype(np.float64)
+    H = inputs['pH'].value.reshape((m, n)).astype(np.float64)
+    R = inputs['pR'].value.reshape((m, m)).astype(np.float64)
+    z = inputs['pZ'].value.astype(np.float64)
+
+    if "return_value" in result_parameter.name:
+        return 0
+
+    S = H @ P @ H.T + R
+    K = P @ H.T @ np.linalg.inv(S)
+    if result_parameter.name == 'pX':
+        return (x + K @ (z - H @ x)).astype(np.float32)
+    else:
+        return (P - K @ H @ P).astype(np.float32).reshape((n * n, ))
+
+
+def covariance_matrix(n):
+    """ Well conditioned symmetric positive definite matrix """
+    A = np.random.uniform(low=-1, high=1, size=(n, n))
+    return (A @ A.T / n + np.eye(n)).astype(np.float32)
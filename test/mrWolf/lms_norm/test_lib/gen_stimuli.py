@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+MU = {'int16_t': 16384, 'int32_t': 1 << 30, 'float': 0.5}
+
+
+def round_shift(x, shift):
+    return (x + ((1 << shift) >> 1)) >> shift
+
+
+def trunc_div(a, b):
+    # integer division, rounding towards zero like in C
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The state is cleared, and the serial version only adapts the first channel. The result is
+    # either the filter output pOut or the error pErr.
+
+    ctype = inputs['pSrc'].ctype
+    if ctype == 'int16_t':
+        my_type, my_bits = np.int16, 16
+    elif ctype == 'int32_t':
+        my_type, my_bits = np.int32, 32
+    elif ctype == 'float':
+        my_type, my_bits = np.float32, None
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    is_float = my_bits is None
+    if not is_float:
+        frac = my_bits - 1
+        shift = fix_point
+
+    def sat(x):
+        if is_float:
+            return x
+        return max(-2**(my_bits - 1), min(2**(my_bits - 1) - 1, x))
+
+    taps = env['taps']
+    length = env['len']
+    n_channels = result_parameter.length // length
+    mu = MU[ctype]
+    conv = float if is_float else int
+
+    result = np.zeros(n_channels * length, dtype=my_type)
+    for c in range(n_channels):
+        w = [conv(v) for v in inputs['pCoeffs'].value[c * taps:(c + 1) * taps]]
+        x = [conv(v) for v in inputs['pSrc'].value[c * length:(c + 1) * length]]
+        d = [conv(v) for v in inputs['pRef'].value[c * length:(c + 1) * length]]
+        window = [0] * (taps - 1) + x
+        energy = 0
+        for n in range(length):
+            # coefficients are stored in time-reversed order
+            px = window[n:n + taps]
+            acc = sum(wk * xk for wk, xk in zip(w, px))
+            y = acc if is_float else sat(round_shift(acc, shift))
+            e = d[n] - y if is_float else sat(d[n] - y)
+            x_new = window[n + taps - 1]
+            x_old = window[n - 1] if n > 0 else 0
+            if is_float:
+                energy += x_new * x_new - x_old * x_old
+                g = mu * e / (energy + 1.19209290e-7)
+                w = [wk + g * xk for wk, xk in zip(w, px)]
+            else:
+                energy += ((x_new * x_new) >> frac) - ((x_old * x_old) >> frac)
+                g = sat(trunc_div(mu * e, energy + 1))
+                w = [sat(wk + round_shift(g * xk, frac)) for wk, xk in zip(w, px)]
+            result[c * length + n] = y if result_parameter.name == 'pOut' else e
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value.astype(np.int64)
+    table = inputs['pTable'].value.astype(np.int64)
+    if result_parameter.ctype != 'int16_t':
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    # the input in [-1, 1) spans the whole table, the fraction between two entries is in Q16
+    pos = (x + 0x8000) * (len(table) - 1)
+    index = pos >> 16
+    frac = pos & 0xFFFF
+    upper = table[np.minimum(index + 1, len(table) - 1)]
+    result = (table[index] * (0x10000 - frac) + upper * frac + 0x8000) >> 16
+    return result.astype(np.int16)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype == 'float':
+        x = inputs['pSrcX'].value.astype(np.float32)
+        y = inputs['pSrcY'].value.astype(np.float32)
+        alpha = np.float32(inputs['alpha'].value)
+        beta = np.float32(inputs['beta'].value)
+        result = np.zeros((env['len_mat'], ), dtype=np.float32)
+        for i in range(env['len_mat']):
+            result[i] = np.float32(np.float32(alpha * x[i]) + np.float32(beta * y[i]))
+    else:
+        if result_parameter.ctype == 'int8_t':
+            dtype, bits = np.int8, 8
+        elif result_parameter.ctype == 'int16_t':
+            dtype, bits = np.int16, 16
+        elif result_parameter.ctype == 'int32_t':
+            dtype, bits = np.int32, 32
+        else:
+            raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+        x = inputs['pSrcX'].value
+        y = inputs['pSrcY'].value
+        alpha = int(inputs['alpha'].value)
+        beta = int(inputs['beta'].value)
+        shift = int(inputs['shift'].value)
+        result = np.zeros((env['len_mat'], ), dtype=dtype)
+        for i in range(env['len_mat']):
+            # the intermediate result has 32-bit precision
+            val = wrap(int(x[i]) * alpha + int(y[i]) * beta, 32)
+            result[i] = wrap(val >> shift, bits)
+
+    return result
+
+
+######################
+# Integer Functions  #
+######################
+
+
+def wrap(x, bits):
+    return ((int(x) + 2**(bits - 1)) % 2**bits) - 2**(bits - 1)
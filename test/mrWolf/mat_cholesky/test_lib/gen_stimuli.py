@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+
+    return spd_matrix(env['len_n']).reshape((env['len_mat'], ))
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    A = inputs['pSrc'].value.reshape((env['len_n'], env['len_n'])).astype(np.float64)
+
+    if "return_value" in result_parameter.name:
+        return 0
+    else:
+        return np.linalg.cholesky(A).astype(np.float32).reshape((env['len_mat'], ))
+
+
+def spd_matrix(n):
+    """ Random, well conditioned symmetric positive definite matrix """
+    G = np.random.uniform(low=-1, high=1, size=(n, n))
+    return (G @ G.T + n * np.eye(n)).astype(np.float32)
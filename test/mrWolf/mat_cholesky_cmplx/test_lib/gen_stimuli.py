@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+
+    return to_interleaved(hpd_matrix(env['len_n']))
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    A = to_complex(inputs['pSrc'].value).reshape((env['len_n'], env['len_n']))
+
+    if "return_value" in result_parameter.name:
+        return 0
+    else:
+        return to_interleaved(np.linalg.cholesky(A))
+
+
+def hpd_matrix(n):
+    """ Random, well conditioned Hermitian positive definite matrix """
+    G = np.random.uniform(low=-1, high=1, size=(n, n)) + 1j * np.random.uniform(low=-1, high=1, size=(n, n))
+    return G @ G.conj().T + n * np.eye(n)
+
+
+def to_complex(x):
+    x = x.astype(np.float64)
+    return x[0::2] + 1j * x[1::2]
+
+
+def to_interleaved(A):
+    A = A.reshape((-1, ))
+    return np.stack([A.real, A.imag], axis=1).astype(np.float32).reshape((-1, ))
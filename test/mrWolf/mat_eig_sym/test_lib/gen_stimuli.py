@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+
+    return covariance_matrix(env['len_n']).reshape((env['len_mat'], ))
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    n = env['len_n']
+    A = inputs['pSrc'].value.reshape((n, n)).astype(np.float64)
+
+    if "return_value" in result_parameter.name:
+        return 0
+    else:
+        # the eigenvectors are only unique up to their sign and are not checked
+        return np.linalg.eigvalsh(A)[::-1].astype(np.float32)
+
+
+def covariance_matrix(n):
+    """ Sample covariance matrix of 2n random observations """
+    X = np.random.normal(size=(2 * n, n))
+    return (X.T @ X / (2 * n)).astype(np.float32)
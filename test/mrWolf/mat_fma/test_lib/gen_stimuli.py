@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    ctype = result_parameter.ctype
+    c = inputs['pRes'].value
+    if ctype == 'float':
+        a = inputs['srcA'].value.astype(np.float32).reshape((env['len_m'], env['len_n']))
+        b = inputs['srcB'].value.astype(np.float32).reshape((env['len_n'], env['len_o']))
+        bias = inputs['bias'].value.astype(np.float32)
+        result = c.astype(np.float32).reshape((env['len_m'], env['len_o'])).copy()
+        for m in range(env['len_m']):
+            for o in range(env['len_o']):
+                s = np.float32(0)
+                for n in range(env['len_n']):
+                    s = np.float32(s + np.float32(a[m, n] * b[n, o]))
+                result[m, o] = np.float32(result[m, o] + np.float32(s + bias[o]))
+        return result.reshape((env['len_res'], ))
+
+    # the integer sum is accumulated with 32 bits (wrapping around on overflow)
+    a = inputs['srcA'].value.astype(np.int64).reshape((env['len_m'], env['len_n']))
+    b = inputs['srcB'].value.astype(np.int64).reshape((env['len_n'], env['len_o']))
+    bias = inputs['bias'].value.astype(np.int64)
+    acc = (np.matmul(a, b) + bias).astype(np.int32).astype(np.int64)
+    c = c.astype(np.int64).reshape((env['len_m'], env['len_o']))
+
+    if fix_point is None:
+        return (c + acc).astype(np.int32).reshape((env['len_res'], ))
+
+    # fix-point computation, requantize and saturate
+    bits = 8 if ctype == 'int8_t' else 16
+    rounding = (1 << fix_point) >> 1
+    result = np.clip(c + ((acc + rounding) >> fix_point), -2**(bits - 1), 2**(bits - 1) - 1)
+    dtype = np.int8 if bits == 8 else np.int16
+    return result.astype(dtype).reshape((env['len_res'], ))
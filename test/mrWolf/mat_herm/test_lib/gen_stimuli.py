@@ -0,0 +1,18 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    assert fix_point is None
+    assert result_parameter.ctype == inputs['pSrc'].ctype
+    src = inputs['pSrc'].value.reshape((env['len_m'], env['len_n'], 2))
+    dst = src.transpose((1, 0, 2)).copy()
+    # conjugate, the integers saturated like plp_cmplx_conj
+    imag = dst[:, :, 1]
+    if np.issubdtype(dst.dtype, np.integer):
+        info = np.iinfo(dst.dtype)
+        dst[:, :, 1] = np.where(imag == info.min, info.max, -imag)
+    else:
+        dst[:, :, 1] = -imag
+    return dst.reshape((env['len_mat'], ))
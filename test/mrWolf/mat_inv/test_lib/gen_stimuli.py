@@ -2,6 +2,23 @@
 
 import numpy as np
 
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    if arg.name == "pSrc":
+        if arg.ctype == 'float':
+            return np.random.uniform(-1, 1, size=arg.length).astype(np.float32)
+        return diagonally_dominant(env['len_n'], env['fracBits'], arg.get_dtype())
+    raise RuntimeError("No stimuli for argument: %s" % arg.name)
+
+
 def compute_result(result_parameter, inputs, env, fix_point):
     """
     Funciton to generate the expected result of the testcase.
@@ -16,6 +33,15 @@ def compute_result(result_parameter, inputs, env, fix_point):
 
     A = inputs['pSrc'].value.reshape((env['len_n'], env['len_n']))
 
+    if fix_point is not None:
+        if "return_value" in result_parameter.name:
+            return 0
+        # pDst has the format of pSrc
+        A = A.astype(np.float64) / 2**fix_point
+        X = np.round(np.linalg.inv(A) * 2**fix_point)
+        info = np.iinfo(np.int16 if inputs['pSrc'].ctype == 'int16_t' else np.int32)
+        return np.clip(X, info.min, info.max).reshape((env['len_mat'], ))
+
     if "return_value" in result_parameter.name:
         return 0 if is_invertible(A) else 1
     else:
@@ -24,3 +50,11 @@ def compute_result(result_parameter, inputs, env, fix_point):
 
 def is_invertible(A):
     return A.shape[0] == A.shape[1] and np.linalg.matrix_rank(A) == A.shape[0]
+
+
+def diagonally_dominant(n, frac_bits, dtype):
+    """ random matrix with a diagonal in +-[1, 2) and off-diagonal elements below 1/(2n) """
+    A = np.random.uniform(-0.5 / n, 0.5 / n, size=(n, n))
+    sign = np.where(np.random.uniform(size=n) < 0.5, -1, 1)
+    A[np.diag_indices(n)] = sign * np.random.uniform(1, 2, size=n)
+    return np.round(A * 2**frac_bits).astype(dtype).reshape((n * n, ))
@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+
+    return well_conditioned_matrix(env['len_m'], env['len_n']).reshape((env['len_a'], ))
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    A = inputs['pA'].value.reshape((env['len_m'], env['len_n'])).astype(np.float64)
+    B = inputs['pB'].value.reshape((env['len_m'], env['len_o'])).astype(np.float64)
+
+    if "return_value" in result_parameter.name:
+        return 0
+    else:
+        X = np.linalg.lstsq(A, B, rcond=None)[0]
+        return X.astype(np.float32).reshape((env['len_x'], ))
+
+
+def well_conditioned_matrix(m, n):
+    """ Random matrix with full column rank, the singular values are between 1 and 2 """
+    U, _ = np.linalg.qr(np.random.normal(size=(m, n)))
+    V, _ = np.linalg.qr(np.random.normal(size=(n, n)))
+    return (U @ np.diag(np.random.uniform(low=1, high=2, size=n)) @ V.T).astype(np.float32)
@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    A = inputs['pSrc'].value.reshape((env['len_n'], env['len_n']))
+
+    if "return_value" in result_parameter.name:
+        return 0 if is_invertible(A) else 1
+
+    LU, perm = lu_decomposition(A)
+    if result_parameter.name == 'pPerm':
+        return perm.astype(np.int32)
+    else:
+        return LU.astype(np.float32).reshape((env['len_mat'], ))
+
+
+def lu_decomposition(A):
+    """ LU decomposition with partial pivoting, L and U are packed into the same matrix """
+    LU = A.astype(np.float64)
+    n = LU.shape[0]
+    perm = np.arange(n)
+    for l in range(n):
+        p = l + np.argmax(np.abs(LU[l:, l]))
+        LU[[l, p]] = LU[[p, l]]
+        perm[[l, p]] = perm[[p, l]]
+        LU[l + 1:, l] /= LU[l, l]
+        LU[l + 1:, l + 1:] -= np.outer(LU[l + 1:, l], LU[l, l + 1:])
+    return LU, perm
+
+
+def is_invertible(A):
+    return A.shape[0] == A.shape[1] and np.linalg.matrix_rank(A) == A.shape[0]
@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    a = inputs['srcA'].value.astype(np.int64).reshape((env['len_m'], env['len_n']))
+    b = inputs['srcB'].value.astype(np.int64).reshape((env['len_n'], env['len_o']))
+    # the full sum is accumulated in 64 bits, and shifted (with rounding) only once
+    acc = np.matmul(a, b)
+    result = np.array([q_roundnorm_sat(int(x), fix_point) for x in acc.reshape((env['len_res'], ))],
+                      dtype=np.int32)
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_roundnorm_sat(a, p):
+    rounding = (1 << p) >> 1
+    return min(max((a + rounding) >> p, -2**31), 2**31 - 1)
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    m, n, o = env['len_m'], env['len_n'], env['len_o']
+    a = inputs['srcA'].value.astype(np.int64).reshape((m, n))
+    b = inputs['srcB'].value.astype(np.int64).reshape((n, o))
+    z_b = inputs['pZeroPointB'].value.astype(np.int64)
+    offset = inputs['pColOffset'].value.astype(np.int64)
+    mult = inputs['pMultiplier'].value
+    shift = inputs['pShift'].value
+    z_c = int(inputs['zeroPointC'].value)
+    # the zero point of B is subtracted with the row sums of A
+    acc = np.matmul(a, b) + offset[np.newaxis, :] - np.outer(a.sum(axis=1), z_b)
+    result = np.array([requantize(int(acc[i, j]), int(mult[j]), int(shift[j]), z_c)
+                       for i in range(m) for j in range(o)], dtype=np.int8)
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def saturate(x, bits):
+    return min(max(x, -2**(bits - 1)), 2**(bits - 1) - 1)
+
+
+def requantize(acc, multiplier, shift, zero_point):
+    """same rounding as plp_requantize_q8 (TensorFlow Lite MultiplyByQuantizedMultiplier)"""
+    x = saturate(acc << max(shift, 0), 32)
+    if x == -2**31 and multiplier == -2**31:
+        y = 2**31 - 1
+    else:
+        ab = x * multiplier
+        ab += (1 << 30) if ab >= 0 else (1 - (1 << 30))
+        y = ab >> 31 if ab >= 0 else -((-ab) >> 31)
+    right = max(-shift, 0)
+    mask = (1 << right) - 1
+    threshold = (mask >> 1) + (1 if y < 0 else 0)
+    y = (y >> right) + (1 if (y & mask) > threshold else 0)
+    return saturate(y + zero_point, 8)
@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        mat_mul_autotune.c
+ * Description:  Autotuned matrix multiplication test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "mat_mul_autotune.h"
+
+/*
+  Every function computes the product with the single core function, and twice with the _autotune
+  function: the first call measures all variants (the tuned variants are reset before), and the
+  second one runs the fastest of them.
+*/
+
+void mat_mult_i32_autotune(const int32_t *srcA,
+                           const int32_t *srcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           int32_t *dstC,
+                           int32_t *tuned,
+                           int32_t *cached) {
+
+    plp_mat_mult_i32(srcA, srcB, M, N, O, dstC);
+    plp_autotune_reset();
+    plp_mat_mult_i32_autotune(srcA, srcB, M, N, O, tuned);
+    plp_mat_mult_i32_autotune(srcA, srcB, M, N, O, cached);
+}
+
+void mat_mult_i16_autotune(const int16_t *srcA,
+                           const int16_t *srcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           int32_t *dstC,
+                           int32_t *tuned,
+                           int32_t *cached) {
+
+    plp_mat_mult_i16(srcA, srcB, M, N, O, dstC);
+    plp_autotune_reset();
+    plp_mat_mult_i16_autotune(srcA, srcB, M, N, O, tuned);
+    plp_mat_mult_i16_autotune(srcA, srcB, M, N, O, cached);
+}
+
+void mat_mult_i8_autotune(const int8_t *srcA,
+                          const int8_t *srcB,
+                          uint32_t M,
+                          uint32_t N,
+                          uint32_t O,
+                          int32_t *dstC,
+                          int32_t *tuned,
+                          int32_t *cached) {
+
+    plp_mat_mult_i8(srcA, srcB, M, N, O, dstC);
+    plp_autotune_reset();
+    plp_mat_mult_i8_autotune(srcA, srcB, M, N, O, tuned);
+    plp_mat_mult_i8_autotune(srcA, srcB, M, N, O, cached);
+}
+
+void mat_mult_f32_autotune(const float32_t *srcA,
+                           const float32_t *srcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           float32_t *dstC,
+                           float32_t *tuned,
+                           float32_t *cached) {
+
+    plp_mat_mult_f32(srcA, srcB, M, N, O, dstC);
+    plp_autotune_reset();
+    plp_mat_mult_f32_autotune(srcA, srcB, M, N, O, tuned);
+    plp_mat_mult_f32_autotune(srcA, srcB, M, N, O, cached);
+}
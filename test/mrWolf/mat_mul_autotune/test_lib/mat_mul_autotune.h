@@ -0,0 +1,134 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        mat_mul_autotune.h
+ * Description:  Autotuned matrix multiplication test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MAT_MUL_AUTOTUNE_H__
+#define __MAT_MUL_AUTOTUNE_H__
+
+#include "plp_math.h"
+
+/** -------------------------------------------------------
+    @brief      Matrix multiplication of 32-bit integer matrices, computed by plp_mat_mult_i32
+                and plp_mat_mult_i32_autotune.
+    @param[in]  srcA    points to the first input matrix (MxN)
+    @param[in]  srcB    points to the second input matrix (NxO)
+    @param[in]  M       height of the first matrix
+    @param[in]  N       width of the first and height of the second matrix
+    @param[in]  O       width of the second matrix
+    @param[out] dstC    output matrix (MxO) of plp_mat_mult_i32
+    @param[out] tuned   output matrix of the first call of plp_mat_mult_i32_autotune, which
+                        measures all variants
+    @param[out] cached  output matrix of the second call of plp_mat_mult_i32_autotune, which runs
+                        the fastest variant
+    @return     none
+*/
+
+void mat_mult_i32_autotune(const int32_t *srcA,
+                           const int32_t *srcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           int32_t *dstC,
+                           int32_t *tuned,
+                           int32_t *cached);
+
+/** -------------------------------------------------------
+    @brief      Matrix multiplication of 16-bit integer matrices, computed by plp_mat_mult_i16
+                and plp_mat_mult_i16_autotune.
+    @param[in]  srcA    points to the first input matrix (MxN)
+    @param[in]  srcB    points to the second input matrix (NxO)
+    @param[in]  M       height of the first matrix
+    @param[in]  N       width of the first and height of the second matrix
+    @param[in]  O       width of the second matrix
+    @param[out] dstC    output matrix (MxO) of plp_mat_mult_i16
+    @param[out] tuned   output matrix of the first call of plp_mat_mult_i16_autotune, which
+                        measures all variants
+    @param[out] cached  output matrix of the second call of plp_mat_mult_i16_autotune, which runs
+                        the fastest variant
+    @return     none
+*/
+
+void mat_mult_i16_autotune(const int16_t *srcA,
+                           const int16_t *srcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           int32_t *dstC,
+                           int32_t *tuned,
+                           int32_t *cached);
+
+/** -------------------------------------------------------
+    @brief      Matrix multiplication of 8-bit integer matrices, computed by plp_mat_mult_i8
+                and plp_mat_mult_i8_autotune.
+    @param[in]  srcA    points to the first input matrix (MxN)
+    @param[in]  srcB    points to the second input matrix (NxO)
+    @param[in]  M       height of the first matrix
+    @param[in]  N       width of the first and height of the second matrix
+    @param[in]  O       width of the second matrix
+    @param[out] dstC    output matrix (MxO) of plp_mat_mult_i8
+    @param[out] tuned   output matrix of the first call of plp_mat_mult_i8_autotune, which
+                        measures all variants
+    @param[out] cached  output matrix of the second call of plp_mat_mult_i8_autotune, which runs
+                        the fastest variant
+    @return     none
+*/
+
+void mat_mult_i8_autotune(const int8_t *srcA,
+                          const int8_t *srcB,
+                          uint32_t M,
+                          uint32_t N,
+                          uint32_t O,
+                          int32_t *dstC,
+                          int32_t *tuned,
+                          int32_t *cached);
+
+/** -------------------------------------------------------
+    @brief      Matrix multiplication of 32-bit floating-point matrices, computed by plp_mat_mult_f32
+                and plp_mat_mult_f32_autotune.
+    @param[in]  srcA    points to the first input matrix (MxN)
+    @param[in]  srcB    points to the second input matrix (NxO)
+    @param[in]  M       height of the first matrix
+    @param[in]  N       width of the first and height of the second matrix
+    @param[in]  O       width of the second matrix
+    @param[out] dstC    output matrix (MxO) of plp_mat_mult_f32
+    @param[out] tuned   output matrix of the first call of plp_mat_mult_f32_autotune, which
+                        measures all variants
+    @param[out] cached  output matrix of the second call of plp_mat_mult_f32_autotune, which runs
+                        the fastest variant
+    @return     none
+*/
+
+void mat_mult_f32_autotune(const float32_t *srcA,
+                           const float32_t *srcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           float32_t *dstC,
+                           float32_t *tuned,
+                           float32_t *cached);
+
+#endif //__MAT_MUL_AUTOTUNE_H__
@@ -29,6 +29,8 @@ def compute_result(result_parameter, inputs, env, fix_point):
     A = inputs['srcA'].value.reshape((M, N, 2))
     B = inputs['srcB'].value.reshape((N, O, 2))
     C = np.zeros((M, O, 2)).astype(rtype)
+    # the 16-bit fix-point version accumulates in 32 bit, and only shifts and saturates the sum
+    fused = fix_point is not None and rtype == np.int16
     for m in range(M):
         for o in range(O):
             sum_re = ctype(0)
@@ -40,11 +42,14 @@ def compute_result(result_parameter, inputs, env, fix_point):
                 b_im = ctype(B[n, o, 1])
                 res_re = ctype(a_re * b_re - a_im * b_im)
                 res_im = ctype(a_re * b_im + a_im * b_re)
-                if fix_point is not None:
+                if fix_point is not None and not fused:
                     res_re = q_roundnorm(res_re, fix_point)
                     res_im = q_roundnorm(res_im, fix_point)
                 sum_re += res_re
                 sum_im += res_im
+            if fused:
+                sum_re = q_clip(q_roundnorm(q_wrap(sum_re), fix_point), 16)
+                sum_im = q_clip(q_roundnorm(q_wrap(sum_im), fix_point), 16)
             C[m, o, 0] = rtype(sum_re)
             C[m, o, 1] = rtype(sum_im)
     return C.astype(rtype).reshape((M * O * 2, ))
@@ -64,6 +69,14 @@ def q_sat(x):
         return x
 
 
+def q_wrap(x):
+    return ((x + 2**31) % 2**32) - 2**31
+
+
+def q_clip(x, bits):
+    return min(max(x, -(1 << (bits - 1))), (1 << (bits - 1)) - 1)
+
+
 def q_add(a, b):
     return q_sat(a + b)
 
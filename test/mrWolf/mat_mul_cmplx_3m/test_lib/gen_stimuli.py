@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    rtype = result_parameter.get_dtype()
+    ctype = rtype if rtype == np.float32 else np.int64
+    M = env['len_m']
+    N = env['len_n']
+    O = env['len_o']
+
+    # generate result, the integer version wraps around like the four-multiplication kernels
+    A = inputs['srcA'].value.reshape((M, N, 2))
+    B = inputs['srcB'].value.reshape((N, O, 2))
+    C = np.zeros((M, O, 2)).astype(rtype)
+    for m in range(M):
+        for o in range(O):
+            sum_re = ctype(0)
+            sum_im = ctype(0)
+            for n in range(N):
+                a_re = ctype(A[m, n, 0])
+                a_im = ctype(A[m, n, 1])
+                b_re = ctype(B[n, o, 0])
+                b_im = ctype(B[n, o, 1])
+                sum_re += ctype(a_re * b_re - a_im * b_im)
+                sum_im += ctype(a_re * b_im + a_im * b_re)
+            if rtype != np.float32:
+                sum_re = q_wrap(sum_re)
+                sum_im = q_wrap(sum_im)
+            C[m, o, 0] = rtype(sum_re)
+            C[m, o, 1] = rtype(sum_im)
+    return C.astype(rtype).reshape((M * O * 2, ))
+
+
+def q_wrap(x):
+    return ((int(x) + 2**31) % 2**32) - 2**31
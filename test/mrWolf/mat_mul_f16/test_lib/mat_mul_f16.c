@@ -0,0 +1,103 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        mat_mul_f16.c
+ * Description:  Half-precision matrix multiplication test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "mat_mul_f16.h"
+
+/**
+  @brief      Runs the matrix multiplication of half-precision matrices.
+
+  Both input matrices are converted to half precision, and the output back to single precision,
+  like in dot_prod_f16. Every matrix starts at a word boundary, such that the kernel of
+  PLP_MATH_SMALLFLOAT can use packed loads and stores if O is even.
+
+  @param[in]  srcA   points to the first input matrix (MxN)
+  @param[in]  srcB   points to the second input matrix (NxO)
+  @param[in]  M      height of the first matrix
+  @param[in]  N      width of the first and height of the second matrix
+  @param[in]  O      width of the second matrix
+  @param[in]  pWork  points to the half-precision matrices, see MAT_MUL_F16_WORK_LEN
+  @param[in]  nPE    number of parallel processing units, or 0 for the serial function
+  @param[out] dstC   points to the output matrix (MxO)
+  @return     none
+ */
+
+static void mat_mult_f16_run(const float32_t *srcA,
+                             const float32_t *srcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             float32_t *pWork,
+                             uint32_t nPE,
+                             float32_t *dstC) {
+
+    float16_t *pA = (float16_t *)pWork;
+    float16_t *pB = pA + ((M * N + 1) & ~1);
+    float16_t *pC = pB + ((N * O + 1) & ~1);
+    uint32_t i;
+
+    for (i = 0; i < M * N; i++) {
+        pA[i] = plp_f32_to_f16(srcA[i]);
+    }
+    for (i = 0; i < N * O; i++) {
+        pB[i] = plp_f32_to_f16(srcB[i]);
+    }
+
+    if (nPE == 0) {
+        plp_mat_mult_f16(pA, pB, M, N, O, pC);
+    } else {
+        plp_mat_mult_f16_parallel(pA, pB, M, N, O, nPE, pC);
+    }
+
+    for (i = 0; i < M * O; i++) {
+        dstC[i] = plp_f16_to_f32(pC[i]);
+    }
+}
+
+void mat_mult_f16(const float32_t *srcA,
+                  const float32_t *srcB,
+                  uint32_t M,
+                  uint32_t N,
+                  uint32_t O,
+                  float32_t *pWork,
+                  float32_t *dstC) {
+
+    mat_mult_f16_run(srcA, srcB, M, N, O, pWork, 0, dstC);
+}
+
+void mat_mult_f16_parallel(const float32_t *srcA,
+                           const float32_t *srcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           float32_t *pWork,
+                           uint32_t nPE,
+                           float32_t *dstC) {
+
+    mat_mult_f16_run(srcA, srcB, M, N, O, pWork, nPE, dstC);
+}
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        mat_mul_f16.h
+ * Description:  Half-precision matrix multiplication test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MAT_MUL_F16_H__
+#define __MAT_MUL_F16_H__
+
+#include "plp_math.h"
+
+/**
+   Number of 32-bit words of the half-precision copies of the three matrices, each one starting at
+   a word boundary.
+*/
+#define MAT_MUL_F16_WORK_LEN(M, N, O) \
+    (((M) * (N) + 1) / 2 + ((N) * (O) + 1) / 2 + ((M) * (O) + 1) / 2)
+
+/** -------------------------------------------------------
+    @brief      Matrix multiplication, computed by plp_mat_mult_f16.
+    @param[in]  srcA   points to the first input matrix (MxN), which is exactly representable in
+                       half precision
+    @param[in]  srcB   points to the second input matrix (NxO), which is exactly representable in
+                       half precision
+    @param[in]  M      height of the first matrix
+    @param[in]  N      width of the first and height of the second matrix
+    @param[in]  O      width of the second matrix
+    @param[in]  pWork  points to the half-precision matrices, see MAT_MUL_F16_WORK_LEN
+    @param[out] dstC   points to the output matrix (MxO)
+    @return     none
+*/
+
+void mat_mult_f16(const float32_t *srcA,
+                  const float32_t *srcB,
+                  uint32_t M,
+                  uint32_t N,
+                  uint32_t O,
+                  float32_t *pWork,
+                  float32_t *dstC);
+
+/** -------------------------------------------------------
+    @brief      Matrix multiplication, computed by plp_mat_mult_f16_parallel.
+    @param[in]  srcA   points to the first input matrix (MxN), which is exactly representable in
+                       half precision
+    @param[in]  srcB   points to the second input matrix (NxO), which is exactly representable in
+                       half precision
+    @param[in]  M      height of the first matrix
+    @param[in]  N      width of the first and height of the second matrix
+    @param[in]  O      width of the second matrix
+    @param[in]  pWork  points to the half-precision matrices, see MAT_MUL_F16_WORK_LEN
+    @param[in]  nPE    number of parallel processing units
+    @param[out] dstC   points to the output matrix (MxO)
+    @return     none
+*/
+
+void mat_mult_f16_parallel(const float32_t *srcA,
+                           const float32_t *srcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           float32_t *pWork,
+                           uint32_t nPE,
+                           float32_t *dstC);
+
+#endif //__MAT_MUL_F16_H__
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if inputs['srcB'].ctype == 'int16_t':
+        # i8xi16: A holds 8-bit elements
+        a = inputs['srcA'].value.astype(np.int32).reshape((env['len_m'], env['len_n']))
+    else:
+        # i4xi8: A holds two signed 4-bit elements per byte, low nibble first
+        a = unpack_i4(inputs['srcA'].value, env['len_m'], env['len_n'])
+    b = inputs['srcB'].value.astype(np.int32).reshape((env['len_n'], env['len_o']))
+    result = np.matmul(a, b).astype(np.int32).reshape((env['len_res'], ))
+
+    return result
+
+
+def unpack_i4(packed, rows, cols):
+    """ unpacks a matrix of signed 4-bit values, where every row starts at a new byte """
+    packed = packed.astype(np.uint8).reshape((rows, (cols + 1) // 2))
+    nibbles = np.zeros((rows, 2 * packed.shape[1]), dtype=np.int32)
+    nibbles[:, 0::2] = packed & 0xf
+    nibbles[:, 1::2] = packed >> 4
+    nibbles[nibbles >= 8] -= 16
+    return nibbles[:, :cols]
@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        mat_mul_trans_packed.c
+ * Description:  Packed 4-bit and 2-bit matrix transposed matrix multiplication test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "mat_mul_trans_packed.h"
+
+/**
+  @brief      Packs a vector of small integers, starting at a new byte.
+  @param[in]  pSrc  points to the input vector, one value per byte
+  @param[in]  len   number of values
+  @param[in]  bits  number of bits per packed value, 4 or 2
+  @param[out] pDst  points to the packed vector of (len * bits + 7) / 8 bytes, element n in the
+                    bits (n % (8 / bits)) * bits of byte n / (8 / bits)
+  @return     none
+ */
+
+static void mat_mult_trans_pack(const int8_t *pSrc, uint32_t len, uint32_t bits, int8_t *pDst) {
+
+    uint32_t perByte = 8 / bits;
+    uint32_t mask = (1 << bits) - 1;
+    uint32_t n;
+
+    for (n = 0; n < (len + perByte - 1) / perByte; n++) {
+        pDst[n] = 0;
+    }
+    for (n = 0; n < len; n++) {
+        pDst[n / perByte] |= (pSrc[n] & mask) << ((n % perByte) * bits);
+    }
+}
+
+void mat_mult_trans_i4(const int8_t *srcA,
+                       const int8_t *srcB,
+                       uint32_t M,
+                       uint32_t N,
+                       uint32_t O,
+                       int32_t *pWork,
+                       int32_t *dstC) {
+
+    uint32_t stride = (N * 4 + 7) / 8;
+    int8_t *pA = (int8_t *)pWork;
+    int8_t *pB = (int8_t *)(pWork + (M * stride + 3) / 4);
+    uint32_t i;
+
+    for (i = 0; i < M; i++) {
+        mat_mult_trans_pack(srcA + i * N, N, 4, pA + i * stride);
+    }
+    for (i = 0; i < O; i++) {
+        mat_mult_trans_pack(srcB + i * N, N, 4, pB + i * stride);
+    }
+    plp_mat_mult_trans_i4(pA, pB, M, N, O, dstC);
+}
+
+void mat_mult_trans_i2(const int8_t *srcA,
+                       const int8_t *srcB,
+                       uint32_t M,
+                       uint32_t N,
+                       uint32_t O,
+                       int32_t *pWork,
+                       int32_t *dstC) {
+
+    uint32_t stride = (N * 2 + 7) / 8;
+    int8_t *pA = (int8_t *)pWork;
+    int8_t *pB = (int8_t *)(pWork + (M * stride + 3) / 4);
+    uint32_t i;
+
+    for (i = 0; i < M; i++) {
+        mat_mult_trans_pack(srcA + i * N, N, 2, pA + i * stride);
+    }
+    for (i = 0; i < O; i++) {
+        mat_mult_trans_pack(srcB + i * N, N, 2, pB + i * stride);
+    }
+    plp_mat_mult_trans_i2(pA, pB, M, N, O, dstC);
+}
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        mat_mul_trans_packed.h
+ * Description:  Packed 4-bit and 2-bit matrix transposed matrix multiplication test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MAT_MUL_TRANS_PACKED_H__
+#define __MAT_MUL_TRANS_PACKED_H__
+
+#include "plp_math.h"
+
+/**
+   Number of 32-bit words of the packed copies of both matrices, each one starting at a word
+   boundary, and each row at a new byte.
+*/
+#define MAT_MUL_TRANS_PACKED_WORK_LEN(M, N, O, bits) \
+    (((M) * (((N) * (bits) + 7) / 8) + 3) / 4 + ((O) * (((N) * (bits) + 7) / 8) + 3) / 4)
+
+/** -------------------------------------------------------
+    @brief      Matrix transposed matrix multiplication, computed by plp_mat_mult_trans_i4 on the packed
+                matrices.
+    @param[in]  srcA   points to the first input matrix (MxN), one 4-bit value per byte
+    @param[in]  srcB   points to the transposed second input matrix (OxN), one 4-bit value per byte
+    @param[in]  M      height of the first matrix
+    @param[in]  N      width of the first matrix and of the transposed second matrix
+    @param[in]  O      height of the transposed second matrix
+    @param[in]  pWork  points to the packed matrices, see MAT_MUL_TRANS_PACKED_WORK_LEN
+    @param[out] dstC   points to the output matrix (MxO)
+    @return     none
+*/
+
+void mat_mult_trans_i4(const int8_t *srcA,
+                       const int8_t *srcB,
+                       uint32_t M,
+                       uint32_t N,
+                       uint32_t O,
+                       int32_t *pWork,
+                       int32_t *dstC);
+
+/** -------------------------------------------------------
+    @brief      Matrix transposed matrix multiplication, computed by plp_mat_mult_trans_i2 on the packed
+                matrices.
+    @param[in]  srcA   points to the first input matrix (MxN), one 2-bit value per byte
+    @param[in]  srcB   points to the transposed second input matrix (OxN), one 2-bit value per byte
+    @param[in]  M      height of the first matrix
+    @param[in]  N      width of the first matrix and of the transposed second matrix
+    @param[in]  O      height of the transposed second matrix
+    @param[in]  pWork  points to the packed matrices, see MAT_MUL_TRANS_PACKED_WORK_LEN
+    @param[out] dstC   points to the output matrix (MxO)
+    @return     none
+*/
+
+void mat_mult_trans_i2(const int8_t *srcA,
+                       const int8_t *srcB,
+                       uint32_t M,
+                       uint32_t N,
+                       uint32_t O,
+                       int32_t *pWork,
+                       int32_t *dstC);
+
+#endif //__MAT_MUL_TRANS_PACKED_H__
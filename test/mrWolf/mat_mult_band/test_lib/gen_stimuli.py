@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    M, N, O = env['len_m'], env['len_n'], env['len_o']
+    kl, ku = env['kl'], env['ku']
+    width = kl + ku + 1
+
+    # dense A from its band, stored row by row
+    A = np.zeros((M, N), dtype=np.float64)
+    band = inputs['pSrcA'].value
+    for m in range(M):
+        for n in range(max(m - kl, 0), min(m + ku + 1, N)):
+            A[m, n] = band[m * width + kl + n - m]
+    B = inputs['pSrcB'].value.astype(np.float64).reshape(N, O)
+    C = np.matmul(A, B).reshape(M * O)
+
+    if result_parameter.ctype == 'float':
+        return C.astype(np.float32)
+    elif result_parameter.ctype == 'int32_t':
+        return np.array([wrap(int(round(c)), 32) for c in C]).astype(np.int32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+
+######################
+# Integer Functions  #
+######################
+
+
+def wrap(x, bits):
+    return ((int(x) + 2**(bits - 1)) % 2**bits) - 2**(bits - 1)
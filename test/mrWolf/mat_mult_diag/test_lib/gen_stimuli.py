@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    M, N = env['len_m'], env['len_n']
+    # row m is scaled by pDiag[m] (D * A), or column n by pDiag[n] (A * D)
+    factor = lambda m, n: d[n] if env['right'] else d[m]
+    if result_parameter.ctype == 'float':
+        a = inputs['pSrc'].value.astype(np.float32)
+        d = inputs['pDiag'].value.astype(np.float32)
+        result = np.zeros((M * N, ), dtype=np.float32)
+        for m in range(M):
+            for n in range(N):
+                result[m * N + n] = np.float32(a[m * N + n] * factor(m, n))
+    else:
+        if result_parameter.ctype == 'int16_t':
+            dtype, bits = np.int16, 16
+        elif result_parameter.ctype == 'int32_t':
+            dtype, bits = np.int32, 32
+        else:
+            raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+        a = inputs['pSrc'].value
+        d = inputs['pDiag'].value
+        shift = int(inputs['shift'].value)
+        result = np.zeros((M * N, ), dtype=dtype)
+        for m in range(M):
+            for n in range(N):
+                # the product has 32-bit precision
+                val = wrap(int(a[m * N + n]) * int(factor(m, n)), 32)
+                result[m * N + n] = wrap(val >> shift, bits)
+
+    return result
+
+
+######################
+# Integer Functions  #
+######################
+
+
+def wrap(x, bits):
+    return ((int(x) + 2**(bits - 1)) % 2**bits) - 2**(bits - 1)
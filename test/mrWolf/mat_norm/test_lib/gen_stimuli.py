@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The integer versions return the squared Frobenius norm, and accumulate with 32 bits.
+
+    a = inputs['pSrc'].value.reshape((env['len_m'], env['len_n']))
+    if result_parameter.ctype == 'float':
+        a = a.astype(np.float64)
+        if env['norm'] == 0:
+            result = np.sqrt(np.sum(a * a))
+        elif env['norm'] == 1:
+            result = np.max(np.sum(np.abs(a), axis=0))
+        else:
+            result = np.max(np.sum(np.abs(a), axis=1))
+        return np.array([result], dtype=np.float32)
+    elif result_parameter.ctype == 'int32_t':
+        a = a.astype(np.int64)
+        if env['norm'] == 0:
+            result = np.sum(a * a)
+        elif env['norm'] == 1:
+            result = np.max(np.sum(np.abs(a), axis=0))
+        else:
+            result = np.max(np.sum(np.abs(a), axis=1))
+        return np.array([wrap_i32(int(result))], dtype=np.int32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+
+def wrap_i32(x):
+    return ((x + 2**31) % 2**32) - 2**31
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
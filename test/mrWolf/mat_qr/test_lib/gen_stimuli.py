@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    A = inputs['pSrc'].value.reshape((env['len_m'], env['len_n'])).astype(np.float64)
+
+    if "return_value" in result_parameter.name:
+        return 0
+
+    # LAPACK uses the same sign convention for the Householder reflections, Q and R match exactly
+    Q, R = np.linalg.qr(A)
+    if result_parameter.name == 'pQ':
+        return Q.astype(np.float32).reshape((env['len_src'], ))
+    else:
+        return R.astype(np.float32).reshape((env['len_r'], ))
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    if arg.name == "pA":
+        return diagonally_dominant(env['len_n'], env['fracBits'], arg.get_dtype())
+    raise RuntimeError("No stimuli for argument: %s" % arg.name)
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    if "return_value" in result_parameter.name:
+        return 0
+
+    n = env['len_n']
+    A = inputs['pA'].value.reshape((n, n)).astype(np.float64) / 2**fix_point
+    B = inputs['pB'].value.reshape((n, env['len_o'])).astype(np.float64)
+    # pX has the format of pB
+    X = np.round(np.linalg.solve(A, B))
+    info = np.iinfo(np.int16 if inputs['pB'].ctype == 'int16_t' else np.int32)
+    return np.clip(X, info.min, info.max).reshape((env['len_x'], ))
+
+
+def diagonally_dominant(n, frac_bits, dtype):
+    """ random matrix with a diagonal in +-[1, 2) and off-diagonal elements below 1/(2n) """
+    A = np.random.uniform(-0.5 / n, 0.5 / n, size=(n, n))
+    sign = np.where(np.random.uniform(size=n) < 0.5, -1, 1)
+    A[np.diag_indices(n)] = sign * np.random.uniform(1, 2, size=n)
+    return np.round(A * 2**frac_bits).astype(dtype).reshape((n * n, ))
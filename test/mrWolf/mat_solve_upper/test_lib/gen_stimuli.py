@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+
+    return triangular_matrix(env['len_n']).reshape((env['len_mat'], ))
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    n = env['len_n']
+    A = np.triu(inputs['pU'].value.reshape((n, n)).astype(np.float64))
+    B = inputs['pB'].value.reshape((n, env['len_o'])).astype(np.float64)
+
+    if env['unit_diag']:
+        np.fill_diagonal(A, 1)
+
+    if "return_value" in result_parameter.name:
+        return 0
+    else:
+        return np.linalg.solve(A, B).astype(np.float32).reshape((env['len_rhs'], ))
+
+
+def triangular_matrix(n):
+    """ Random, well conditioned upper triangular matrix, the other half is filled with noise """
+    A = np.random.uniform(low=-1, high=1, size=(n, n)) / n
+    A += np.diag(np.random.choice([-1, 1], n) * np.random.uniform(low=1, high=2, size=n))
+    return A.astype(np.float32)
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    row_ptr = inputs['rowPtr'].value
+    col_idx = inputs['colIdx'].value
+    if result_parameter.ctype == 'int32_t':
+        val = inputs['val'].value.astype(np.int32)
+        x = inputs['srcX'].value.astype(np.int32)
+        result = np.zeros(env['len_m'], dtype=np.int32)
+        for m in range(env['len_m']):
+            for k in range(row_ptr[m], row_ptr[m + 1]):
+                result[m] += val[k] * x[col_idx[k]]
+    elif result_parameter.ctype == 'float':
+        val = inputs['val'].value.astype(np.float32)
+        x = inputs['srcX'].value.astype(np.float32)
+        result = np.zeros(env['len_m'], dtype=np.float32)
+        for m in range(env['len_m']):
+            for k in range(row_ptr[m], row_ptr[m + 1]):
+                result[m] = np.float32(result[m] + val[k] * x[col_idx[k]])
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result
@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    N = env['len_n']
+    K = env['len_k']
+
+    a = inputs['pSrcA'].value.reshape((N, env['strideA']))[:, :K].astype(np.float64)
+    c = np.matmul(a, a.T)
+
+    return c[np.tril_indices(N)].astype(np.float32)
@@ -0,0 +1,11 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    assert fix_point is None
+    assert result_parameter.ctype == inputs['pSrc'].ctype
+    src = inputs['pSrc'].value.reshape((env['len_m'], env['len_n'], 2))
+    dst = src.transpose((1, 0, 2)).copy()
+    return dst.reshape((env['len_mat'], ))
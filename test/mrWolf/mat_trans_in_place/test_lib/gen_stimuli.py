@@ -0,0 +1,8 @@
+#!/usr/bin/env python3
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    assert fix_point is None
+    assert result_parameter.ctype == inputs['pSrcDst'].ctype
+    src = inputs['pSrcDst'].value.reshape((env['len_n'], env['len_n']))
+    dst = src.T.reshape((env['len_mat'], ))
+    return dst
@@ -0,0 +1,34 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    N = env['len_n']
+    O = env['len_o']
+
+    L = np.zeros((N, N), dtype=np.float64)
+    L[np.tril_indices(N)] = inputs['pSrcL'].value
+    if env['trans']:
+        L = L.T
+    b = inputs['pSrcB'].value.reshape((N, env['strideB']))[:, :O].astype(np.float64)
+
+    result = np.zeros((N, env['strideC']), dtype=np.float32)
+    result[:, :O] = np.matmul(L, b)
+
+    return result.reshape((env['len_res'], ))
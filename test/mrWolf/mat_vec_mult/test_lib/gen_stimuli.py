@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if fix_point is not None:
+        # fix-point computation, accumulated at 32-bit and shifted only once
+        a = inputs['srcA'].value.astype(np.int64).reshape((env['len_m'], env['len_n']))
+        x = inputs['srcX'].value.astype(np.int64)
+        ctype = result_parameter.ctype
+        dtype = np.int8 if ctype == "int8_t" else np.int16 if ctype == "int16_t" else np.int32
+        result = np.zeros(env['len_m'], dtype=dtype)
+        for m in range(env['len_m']):
+            s = q_wrap(int(np.dot(a[m], x)))
+            s = q_roundnorm(s, fix_point)
+            if dtype != np.int32:
+                bits = np.iinfo(dtype).bits
+                s = max(min(s, 2**(bits - 1) - 1), -2**(bits - 1))
+            result[m] = dtype(s)
+    elif result_parameter.ctype == 'int32_t':
+        # integer computation
+        a = inputs['srcA'].value.astype(np.int32).reshape((env['len_m'], env['len_n']))
+        x = inputs['srcX'].value.astype(np.int32)
+        result = np.matmul(a, x).astype(np.int32)
+    elif result_parameter.ctype == 'float':
+        a = inputs['srcA'].value.astype(np.float32).reshape((env['len_m'], env['len_n']))
+        x = inputs['srcX'].value.astype(np.float32)
+        result = np.zeros(env['len_m'], dtype=np.float32)
+        for m in range(env['len_m']):
+            for n in range(env['len_n']):
+                result[m] = np.float32(result[m] + np.float32(a[m, n] * x[n]))
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_wrap(x):
+    return ((x + 2**31) % 2**32) - 2**31
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return (a + rounding) >> p
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    M = env['len_m']
+    N = env['len_n']
+    stride = env['stride']
+
+    if result_parameter.ctype in ('int32_t', 'int16_t'):
+        rtype = np.int32 if result_parameter.ctype == 'int32_t' else np.int16
+        p = inputs['pSrc'].value.astype(np.int64).reshape((M, stride))[:, :N]
+        # the sums wrap around at 32 bits, and the division truncates towards zero like in C
+        result = np.zeros(N, dtype=rtype)
+        for n in range(N):
+            s = q_wrap(np.sum(p[:, n]))
+            result[n] = rtype(int(s / M))
+    elif result_parameter.ctype == 'float':
+        p = inputs['pSrc'].value.astype(np.float32).reshape((M, stride))[:, :N]
+        result = np.zeros(N, dtype=np.float32)
+        for n in range(N):
+            s = np.float32(0)
+            for x in p[:, n]:
+                s += x
+            result[n] = s / np.float32(M)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result
+
+
+def q_wrap(x):
+    return ((int(x) + 2**31) % 2**32) - 2**31
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    n = inputs['blockSize'].value
+    if fix_point is None:
+        fix_point = 0
+
+    if result_parameter.ctype == 'float':
+        p = inputs['pSrc'].value.astype(np.float64)
+        mean, var = np.mean(p), np.var(p)
+        result = {'pMean': mean, 'pVar': var, 'pStd': np.sqrt(var)}[result_parameter.name]
+        return np.array([result], dtype=np.float32)
+
+    dtype = {'int32_t': np.int32, 'int16_t': np.int16, 'int8_t': np.int8}[result_parameter.ctype]
+    p = [int(x) for x in inputs['pSrc'].value]
+
+    if dtype == np.int32:
+        # the kernel shifts all samples by the first one and accumulates truncated squares
+        shift = p[0]
+        d = [x - shift for x in p]
+        s1 = sum(d)
+        s2 = sum((x * x) >> fix_point for x in d)
+        mean = c_div(s1, n)
+        var = c_div(s2 - ((mean * s1 + c_div((s1 - mean * n) * s1, n)) >> fix_point), n)
+        mean += shift
+    else:
+        # exact integer moments
+        s1 = sum(p)
+        s2 = sum(x * x for x in p)
+        mean = c_div(s1, n)
+        var = c_div(s2 - mean * s1 - c_div((s1 - mean * n) * s1, n), n) >> fix_point
+
+    std = int(2**fix_point * np.sqrt(float(var) / 2**fix_point))
+    result = {'pMean': mean, 'pVar': var, 'pStd': std}[result_parameter.name]
+    return np.array([result]).astype(dtype)
+
+
+def c_div(a, b):
+    """ Integer division rounding towards zero, as in C """
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The state is cleared, and the serial version only filters the first channel. All channels use
+    # the median of the window, and the samples before the block are 0.
+
+    ctype = inputs['pSrc'].ctype
+    if ctype == 'int16_t':
+        my_type = np.int16
+    elif ctype == 'float':
+        my_type = np.float32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    src = inputs['pSrc'].value
+    window = env['window']
+    length = env['len']
+    n_channels = result_parameter.length // length
+
+    result = np.zeros(n_channels * length, dtype=my_type)
+    for c in range(n_channels):
+        data = np.concatenate([np.zeros(window - 1, dtype=my_type),
+                               np.array(src[c * length:(c + 1) * length], dtype=my_type)])
+        for i in range(length):
+            result[c * length + i] = np.sort(data[i:i + window])[(window - 1) // 2]
+
+    return result
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+
+import math
+import numpy as np
+
+# sample rate and edges of the mel filter bank in Hz (same as in testset.cfg)
+SAMPLE_RATE, F_MIN, F_MAX = 16000, 20, 8000
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # floating point model with the tables and the scaling of plp_mfcc_q16
+    n, n_mel, n_coef = env['len'], env['n_mel'], env['n_coef']
+    index, weights, dct = mfcc_tables(n, n_mel, n_coef, SAMPLE_RATE, F_MIN, F_MAX)
+    a = inputs['pSrc'].value.astype(np.float64) / 2**15
+    power = np.abs(np.fft.rfft(a) / n)**2
+    log_mel = np.zeros(n_mel)
+    for m in range(n_mel):
+        w = np.array(weights[index[n_mel + m]:index[n_mel + m + 1]]) / 2**15
+        energy = np.dot(w, power[index[m]:index[m] + len(w)])
+        # mel energies of zero are replaced by one LSB of Q2.30
+        log_mel[m] = np.log(max(energy, 2**-30))
+    result = np.array(dct).reshape(n_coef, n_mel).dot(log_mel) / 2**15
+    return np.clip(np.round(result * 2**fix_point), -2**15, 2**15 - 1).astype(np.int16)
+
+
+def mfcc_tables(n, n_mel, n_coef, sample_rate, f_min, f_max):
+    """ Same sparse mel filter bank and DCT-II matrix in Q1.15 as plp_mfcc_init_q16 """
+    def to_q15(x):
+        return min(32767, math.floor(x * 32768 + 0.5))
+    def to_mel(f):
+        return 2595 * math.log10(1 + f / 700)
+    def to_hz(mel):
+        return 700 * (10**(mel / 2595) - 1)
+    mel_min, mel_max = to_mel(f_min), to_mel(f_max)
+    start, offset, weights = [], [], []
+    for m in range(n_mel):
+        fl, fc, fr = [to_hz(mel_min + (mel_max - mel_min) * (m + i) / (n_mel + 1)) for i in range(3)]
+        k = int(fl * n / sample_rate) + 1
+        start.append(k)
+        offset.append(len(weights))
+        while k < n // 2 and k * sample_rate / n < fr:
+            f = k * sample_rate / n
+            weights.append(to_q15((f - fl) / (fc - fl) if f <= fc else (fr - f) / (fr - fc)))
+            k += 1
+    offset.append(len(weights))
+    dct = [to_q15(math.sqrt((1 if j == 0 else 2) / n_mel) * math.cos(math.pi * j * (m + 0.5) / n_mel))
+           for j in range(n_coef) for m in range(n_mel)]
+    return start + offset, weights, dct
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -20,7 +20,12 @@ def compute_result(result_parameter, inputs, env, fix_point):
     fix_point: None (if no fixpoint is used) or decimal point
     """
     if fix_point is not None:
-        raise RuntimeError("FixPoint is not supported")
+        # saturating q versions, rounded and clipped to the width of the inputs
+        my_type = np.int16 if result_parameter.ctype == 'int16_t' else np.int8
+        a = inputs['pSrcA'].value.astype(np.int64)
+        b = inputs['pSrcB'].value.astype(np.int64)
+        result = (a * b + ((1 << fix_point) >> 1)) >> fix_point
+        result = np.clip(result, np.iinfo(my_type).min, np.iinfo(my_type).max).astype(my_type)
     elif result_parameter.ctype == 'int8_t':
         a = inputs['pSrcA'].value.astype(np.int8)
         b = inputs['pSrcB'].value.astype(np.int8)
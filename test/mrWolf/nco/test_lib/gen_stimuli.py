@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # must match the initial phase in testset.cfg
+    phase = 0x40000000
+    result = np.zeros((2 * env['len'], ), dtype=np.int16)
+    for i in range(env['len']):
+        in_rad = 2 * np.pi * phase / 2**32
+        result[2 * i] = np.clip(np.round(2**15 * np.cos(in_rad)), -2**15, 2**15 - 1)
+        result[2 * i + 1] = np.clip(np.round(2**15 * np.sin(in_rad)), -2**15, 2**15 - 1)
+        phase = (phase + env['phaseInc']) % 2**32
+    return result
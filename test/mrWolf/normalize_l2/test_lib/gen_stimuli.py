@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value.astype(np.float64)
+    norm = np.sqrt(np.sum(x * x))
+    y = x / norm if norm > 0 else np.zeros(len(x))
+
+    if result_parameter.ctype == 'float':
+        return y.astype(np.float32)
+
+    # the output is in Q0.15 for any input format
+    y = np.floor(y * 2**15 + 0.5)
+    return np.clip(y, -32768, 32767).astype(np.int16)
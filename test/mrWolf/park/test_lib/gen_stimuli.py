@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype == 'int16_t':
+        dtype, bits = np.int16, 16
+    elif result_parameter.ctype == 'int32_t':
+        dtype, bits = np.int32, 32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    alpha = int(inputs['Ialpha'].value)
+    beta = int(inputs['Ibeta'].value)
+    s = int(inputs['sinVal'].value)
+    c = int(inputs['cosVal'].value)
+
+    if result_parameter.name == 'pId':
+        acc = alpha * c + beta * s
+    else:
+        acc = beta * c - alpha * s
+
+    # rounded to the nearest and saturated
+    result = (acc + (1 << (bits - 2))) >> (bits - 1)
+    return np.array([np.clip(result, -2**(bits - 1), 2**(bits - 1) - 1)]).astype(dtype)
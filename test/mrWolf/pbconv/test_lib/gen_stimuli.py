@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The blocks of all calls form one stream, hence the expected output is the first numSamples
+    # samples of the direct convolution of the whole stream with the filter.
+
+    ctype = inputs['pSrc'].ctype
+    h = np.array(inputs['pFilter'].value).astype(np.float64)
+    x = np.array(inputs['pSrc'].value).astype(np.float64)
+    result = np.convolve(x, h)[:len(x)]
+
+    if ctype == 'int16_t':
+        result = np.clip(np.round(result / 2**fix_point), -2**15, 2**15 - 1)
+        return result.astype(np.int16)
+    elif ctype == 'float':
+        return result.astype(np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,194 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        pbconv.c
+ * Description:  Partitioned convolution test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "pbconv.h"
+
+/**
+  @brief      Runs the partitioned convolution of a 16-bit fixed-point stream.
+
+  The transform of length 2*blockLen is initialized at runtime. The stream is passed to the
+  convolution in calls of samplesPerCall samples (the last call may get fewer), such that the
+  state and the delay line carry over from one call to the next.
+
+  @param[in]  pFilter         points to the filter coefficients in Q1.15
+  @param[in]  filterLen       number of filter coefficients
+  @param[in]  blockLen        number of samples per block, a power of two from 8 to 2048
+  @param[in]  pSrc            points to the numSamples input samples in Q1.15
+  @param[in]  numSamples      number of input samples, a multiple of blockLen
+  @param[in]  samplesPerCall  number of samples per call, a multiple of blockLen
+  @param[in]  pWork           points to the buffers of the instance, see PBCONV_WORK_LEN
+  @param[in]  nPE             number of parallel processing units, or 0 for the serial functions
+  @param[out] pDst            points to the numSamples output samples in Q1.15
+  @return     none
+ */
+
+static void pbconv_run_q16(const int16_t *pFilter,
+                           uint32_t filterLen,
+                           uint32_t blockLen,
+                           const int16_t *pSrc,
+                           uint32_t numSamples,
+                           uint32_t samplesPerCall,
+                           int32_t *pWork,
+                           uint32_t nPE,
+                           int16_t *pDst) {
+
+    plp_cfft_instance_q32 fft;
+    plp_pbconv_instance_q16 S;
+    uint32_t i, n;
+    uint32_t B = blockLen;
+    uint32_t P = (filterLen + B - 1) / B;
+
+    int32_t *pFilterSpectra = pWork;
+    int32_t *pFdl = pFilterSpectra + 2 * (B + 1) * P;
+    int32_t *pBuffer = pFdl + 2 * (B + 1) * P;
+    int32_t *pTables = pBuffer + 4 * B;
+    int16_t *pState = (int16_t *)(pTables + 4 * B);
+
+    if (plp_cfft_init_q32(&fft, 2 * B, pTables) != 0 ||
+        plp_pbconv_init_q16(&S, &fft, pFilter, filterLen, pFilterSpectra, pFdl, pState, pBuffer) !=
+            0) {
+        printf("Error: unsupported block or filter length!\n");
+        return;
+    }
+
+    for (i = 0; i < numSamples; i += n) {
+        n = (numSamples - i < samplesPerCall) ? numSamples - i : samplesPerCall;
+        if (nPE == 0) {
+            plp_pbconv_q16(&S, pSrc + i, n, pDst + i);
+        } else {
+            plp_pbconv_q16_parallel(&S, pSrc + i, n, nPE, pDst + i);
+        }
+    }
+}
+
+/**
+  @brief      Runs the partitioned convolution of a 32-bit floating-point stream, like
+              pbconv_run_q16.
+  @param[in]  pFilter         points to the filter coefficients
+  @param[in]  filterLen       number of filter coefficients
+  @param[in]  blockLen        number of samples per block, a power of two from 2 to 16384
+  @param[in]  pSrc            points to the numSamples input samples
+  @param[in]  numSamples      number of input samples, a multiple of blockLen
+  @param[in]  samplesPerCall  number of samples per call, a multiple of blockLen
+  @param[in]  pWork           points to the buffers of the instance, see PBCONV_WORK_LEN
+  @param[in]  nPE             number of parallel processing units, or 0 for the serial functions
+  @param[out] pDst            points to the numSamples output samples
+  @return     none
+ */
+
+static void pbconv_run_f32(const float32_t *pFilter,
+                           uint32_t filterLen,
+                           uint32_t blockLen,
+                           const float32_t *pSrc,
+                           uint32_t numSamples,
+                           uint32_t samplesPerCall,
+                           float32_t *pWork,
+                           uint32_t nPE,
+                           float32_t *pDst) {
+
+    plp_rfft_instance_f32 fft;
+    plp_pbconv_instance_f32 S;
+    uint32_t i, n;
+    uint32_t B = blockLen;
+    uint32_t P = (filterLen + B - 1) / B;
+
+    float32_t *pFilterSpectra = pWork;
+    float32_t *pFdl = pFilterSpectra + 2 * (B + 1) * P;
+    float32_t *pBuffer = pFdl + 2 * (B + 1) * P;
+    float32_t *pTables = pBuffer + 6 * B;
+    float32_t *pState = pTables + 3 * B;
+
+    if (plp_cfft_init_f32(&fft, 2 * B, pTables) != 0 ||
+        plp_pbconv_init_f32(&S, &fft, pFilter, filterLen, pFilterSpectra, pFdl, pState, pBuffer) !=
+            0) {
+        printf("Error: unsupported block or filter length!\n");
+        return;
+    }
+
+    for (i = 0; i < numSamples; i += n) {
+        n = (numSamples - i < samplesPerCall) ? numSamples - i : samplesPerCall;
+        if (nPE == 0) {
+            plp_pbconv_f32(&S, pSrc + i, n, pDst + i);
+        } else {
+            plp_pbconv_f32_parallel(&S, pSrc + i, n, nPE, pDst + i);
+        }
+    }
+}
+
+void pbconv_q16(const int16_t *pFilter,
+                uint32_t filterLen,
+                uint32_t blockLen,
+                const int16_t *pSrc,
+                uint32_t numSamples,
+                uint32_t samplesPerCall,
+                int32_t *pWork,
+                int16_t *pDst) {
+
+    pbconv_run_q16(pFilter, filterLen, blockLen, pSrc, numSamples, samplesPerCall, pWork, 0, pDst);
+}
+
+void pbconv_q16_parallel(const int16_t *pFilter,
+                         uint32_t filterLen,
+                         uint32_t blockLen,
+                         const int16_t *pSrc,
+                         uint32_t numSamples,
+                         uint32_t samplesPerCall,
+                         int32_t *pWork,
+                         uint32_t nPE,
+                         int16_t *pDst) {
+
+    pbconv_run_q16(pFilter, filterLen, blockLen, pSrc, numSamples, samplesPerCall, pWork, nPE,
+                   pDst);
+}
+
+void pbconv_f32(const float32_t *pFilter,
+                uint32_t filterLen,
+                uint32_t blockLen,
+                const float32_t *pSrc,
+                uint32_t numSamples,
+                uint32_t samplesPerCall,
+                float32_t *pWork,
+                float32_t *pDst) {
+
+    pbconv_run_f32(pFilter, filterLen, blockLen, pSrc, numSamples, samplesPerCall, pWork, 0, pDst);
+}
+
+void pbconv_f32_parallel(const float32_t *pFilter,
+                         uint32_t filterLen,
+                         uint32_t blockLen,
+                         const float32_t *pSrc,
+                         uint32_t numSamples,
+                         uint32_t samplesPerCall,
+                         float32_t *pWork,
+                         uint32_t nPE,
+                         float32_t *pDst) {
+
+    pbconv_run_f32(pFilter, filterLen, blockLen, pSrc, numSamples, samplesPerCall, pWork, nPE,
+                   pDst);
+}
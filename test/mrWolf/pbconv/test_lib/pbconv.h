@@ -0,0 +1,138 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        pbconv.h
+ * Description:  Partitioned convolution test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PBCONV_H__
+#define __PBCONV_H__
+
+#include "plp_math.h"
+
+/**
+   Number of 32-bit words of the buffers of the transform and of the instance: the spectra of the
+   partitions and the delay line, the work buffer of at most 3*fftLen values, the tables of the
+   transform of at most 2*fftLen values (plp_cfft_init_q32), and the past input samples.
+*/
+#define PBCONV_WORK_LEN(blockLen, numPartitions) \
+    (4 * ((blockLen) + 1) * (numPartitions) + 11 * (blockLen))
+
+/** -------------------------------------------------------
+    @brief      Partitioned convolution of a 16-bit fixed-point stream.
+    @param[in]  pFilter         points to the filter coefficients in Q1.15
+    @param[in]  filterLen       number of filter coefficients
+    @param[in]  blockLen        number of samples per block, a power of two from 8 to 2048
+    @param[in]  pSrc            points to the numSamples input samples in Q1.15
+    @param[in]  numSamples      number of input samples, a multiple of blockLen
+    @param[in]  samplesPerCall  number of samples, which are passed to one call of the
+                                convolution, a multiple of blockLen
+    @param[in]  pWork           points to the buffers of the instance, see PBCONV_WORK_LEN
+    @param[out] pDst            points to the numSamples output samples in Q1.15
+    @return     none
+*/
+
+void pbconv_q16(const int16_t *pFilter,
+                uint32_t filterLen,
+                uint32_t blockLen,
+                const int16_t *pSrc,
+                uint32_t numSamples,
+                uint32_t samplesPerCall,
+                int32_t *pWork,
+                int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      Parallel partitioned convolution of a 16-bit fixed-point stream.
+    @param[in]  pFilter         points to the filter coefficients in Q1.15
+    @param[in]  filterLen       number of filter coefficients
+    @param[in]  blockLen        number of samples per block, a power of two from 8 to 2048
+    @param[in]  pSrc            points to the numSamples input samples in Q1.15
+    @param[in]  numSamples      number of input samples, a multiple of blockLen
+    @param[in]  samplesPerCall  number of samples, which are passed to one call of the
+                                convolution, a multiple of blockLen
+    @param[in]  pWork           points to the buffers of the instance, see PBCONV_WORK_LEN
+    @param[in]  nPE             number of parallel processing units
+    @param[out] pDst            points to the numSamples output samples in Q1.15
+    @return     none
+*/
+
+void pbconv_q16_parallel(const int16_t *pFilter,
+                         uint32_t filterLen,
+                         uint32_t blockLen,
+                         const int16_t *pSrc,
+                         uint32_t numSamples,
+                         uint32_t samplesPerCall,
+                         int32_t *pWork,
+                         uint32_t nPE,
+                         int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      Partitioned convolution of a 32-bit floating-point stream.
+    @param[in]  pFilter         points to the filter coefficients
+    @param[in]  filterLen       number of filter coefficients
+    @param[in]  blockLen        number of samples per block, a power of two from 2 to 16384
+    @param[in]  pSrc            points to the numSamples input samples
+    @param[in]  numSamples      number of input samples, a multiple of blockLen
+    @param[in]  samplesPerCall  number of samples, which are passed to one call of the
+                                convolution, a multiple of blockLen
+    @param[in]  pWork           points to the buffers of the instance, see PBCONV_WORK_LEN
+    @param[out] pDst            points to the numSamples output samples
+    @return     none
+*/
+
+void pbconv_f32(const float32_t *pFilter,
+                uint32_t filterLen,
+                uint32_t blockLen,
+                const float32_t *pSrc,
+                uint32_t numSamples,
+                uint32_t samplesPerCall,
+                float32_t *pWork,
+                float32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      Parallel partitioned convolution of a 32-bit floating-point stream.
+    @param[in]  pFilter         points to the filter coefficients
+    @param[in]  filterLen       number of filter coefficients
+    @param[in]  blockLen        number of samples per block, a power of two from 2 to 16384
+    @param[in]  pSrc            points to the numSamples input samples
+    @param[in]  numSamples      number of input samples, a multiple of blockLen
+    @param[in]  samplesPerCall  number of samples, which are passed to one call of the
+                                convolution, a multiple of blockLen
+    @param[in]  pWork           points to the buffers of the instance, see PBCONV_WORK_LEN
+    @param[in]  nPE             number of parallel processing units
+    @param[out] pDst            points to the numSamples output samples
+    @return     none
+*/
+
+void pbconv_f32_parallel(const float32_t *pFilter,
+                         uint32_t filterLen,
+                         uint32_t blockLen,
+                         const float32_t *pSrc,
+                         uint32_t numSamples,
+                         uint32_t samplesPerCall,
+                         float32_t *pWork,
+                         uint32_t nPE,
+                         float32_t *pDst);
+
+#endif //__PBCONV_H__
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The frames of all calls form one stream, hence both filter banks are computed on the whole
+    # stream. pChannels is the analysis of pSrc, and pDst is the synthesis of pSrc, taken as
+    # channel samples. The fixed-point versions are computed in floating point, and compared with
+    # a tolerance, which covers the rounding of the 16-bit transform.
+
+    ctype = inputs['pSrc'].ctype
+    if ctype == 'int16_t':
+        my_type, scale = np.int16, 2**15
+    elif ctype == 'float':
+        my_type, scale = np.float32, 1
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    m = env['channels']
+    h = np.array(inputs['pFilter'].value).astype(np.float64) / scale
+    src = np.array(inputs['pSrc'].value).astype(np.float64)
+    x = (src[0::2] + 1j * src[1::2]).reshape(env['frames'], m)
+
+    if 'pChannels' in result_parameter.name:
+        result = pfb_analysis(h, x)
+        if ctype == 'int16_t':
+            # plp_cfft_q16 scales the transform by 1/numChannels
+            result = result / m
+    else:
+        result = pfb_synthesis(h, x)
+
+    result = np.stack([result.real, result.imag], axis=-1).reshape(-1)
+    if ctype == 'int16_t':
+        result = np.clip(np.round(result), -2**15, 2**15 - 1)
+    return result.astype(my_type)
+
+
+def polyphase(h, m):
+    """ Returns the branches of the prototype filter h, zero padded to a multiple of m taps """
+    t = (len(h) + m - 1) // m
+    return np.concatenate([h, np.zeros(m * t - len(h))]).reshape(t, m).T
+
+
+def pfb_analysis(h, x):
+    """
+    Analysis of the frames x (one frame per row): the commutator feeds branch m with sample M-1-m
+    of every frame, and the transform with positive exponent of the branch outputs gives
+
+        y[r][k] = sum_l h[l] * x[r*M + M-1 - l] * exp(j*2*pi*k*l/M)
+    """
+    frames, m = x.shape
+    e = polyphase(h, m)
+    v = np.zeros((frames, m), dtype=complex)
+    for r in range(frames):
+        for t in range(e.shape[1]):
+            if r >= t:
+                v[r] += e[:, t] * x[r - t][::-1]
+    return np.fft.ifft(v, axis=1) * m
+
+
+def pfb_synthesis(h, y):
+    """
+    Synthesis of the channel frames y: the inverse transform (scaled by 1/M) of every frame feeds
+    the branches, and branch m computes sample m of the output frame.
+    """
+    frames, m = y.shape
+    e = polyphase(h, m)
+    u = np.fft.ifft(y, axis=1)
+    result = np.zeros((frames, m), dtype=complex)
+    for r in range(frames):
+        for t in range(e.shape[1]):
+            if r >= t:
+                result[r] += e[:, t] * u[r - t]
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
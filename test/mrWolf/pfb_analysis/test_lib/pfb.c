@@ -0,0 +1,213 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        pfb.c
+ * Description:  Polyphase filter bank test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "pfb.h"
+
+/**
+  @brief      Runs the analysis and the synthesis of a stream of 16-bit fixed-point frames.
+
+  Both instances share the transform of length numChannels, which is initialized at runtime. The
+  stream is passed to the filter bank in calls of framesPerCall frames (the last call may get
+  fewer), such that the delay lines carry over from one call to the next. The synthesis gets the
+  input samples as channel samples, such that it is checked independently of the analysis.
+
+  @param[in]  pFilter        points to the coefficients of the prototype filter in Q1.15
+  @param[in]  filterLen      number of coefficients of the prototype filter
+  @param[in]  numChannels    number of channels, a power of two from 16 to 4096
+  @param[in]  pSrc           points to the numFrames*numChannels complex input samples in Q1.15
+  @param[in]  numFrames      number of frames
+  @param[in]  framesPerCall  number of frames, which are passed to one call of the filter bank
+  @param[in]  pWork          points to the buffers of both instances, see PFB_WORK_LEN
+  @param[in]  nPE            number of parallel processing units, or 0 for the serial functions
+  @param[out] pChannels      points to the numFrames*numChannels complex channel samples
+  @param[out] pDst           points to the numFrames*numChannels complex output samples
+  @return     none
+ */
+
+static void pfb_run_q16(const int16_t *pFilter,
+                        uint32_t filterLen,
+                        uint32_t numChannels,
+                        const int16_t *pSrc,
+                        uint32_t numFrames,
+                        uint32_t framesPerCall,
+                        int16_t *pWork,
+                        uint32_t nPE,
+                        int16_t *pChannels,
+                        int16_t *pDst) {
+
+    plp_cfft_instance_q16 fft;
+    plp_pfb_analysis_instance_q16 analysis;
+    plp_pfb_synthesis_instance_q16 synthesis;
+    uint32_t r, n;
+    uint32_t M = numChannels;
+    uint32_t T = (filterLen + M - 1) / M;
+
+    int16_t *pCoeffsA = pWork;
+    int16_t *pStateA = pCoeffsA + M * T;
+    int16_t *pCoeffsS = pStateA + 2 * M * T;
+    int16_t *pStateS = pCoeffsS + M * T;
+    int16_t *pTables = pStateS + 2 * M * T;
+
+    if (plp_cfft_init_q16(&fft, M, pTables) != 0 ||
+        plp_pfb_analysis_init_q16(&analysis, &fft, pFilter, filterLen, pCoeffsA, pStateA) != 0 ||
+        plp_pfb_synthesis_init_q16(&synthesis, &fft, pFilter, filterLen, pCoeffsS, pStateS) != 0) {
+        printf("Error: unsupported number of channels or filter length!\n");
+        return;
+    }
+
+    for (r = 0; r < numFrames; r += n) {
+        const int16_t *pIn = pSrc + 2 * M * r;
+        n = (numFrames - r < framesPerCall) ? numFrames - r : framesPerCall;
+        if (nPE == 0) {
+            plp_pfb_analysis_q16(&analysis, pIn, n, pChannels + 2 * M * r);
+            plp_pfb_synthesis_q16(&synthesis, pIn, n, pDst + 2 * M * r);
+        } else {
+            plp_pfb_analysis_q16_parallel(&analysis, pIn, n, nPE, pChannels + 2 * M * r);
+            plp_pfb_synthesis_q16_parallel(&synthesis, pIn, n, nPE, pDst + 2 * M * r);
+        }
+    }
+}
+
+/**
+  @brief      Runs the analysis and the synthesis of a stream of 32-bit floating-point frames,
+              like pfb_run_q16.
+  @param[in]  pFilter        points to the coefficients of the prototype filter
+  @param[in]  filterLen      number of coefficients of the prototype filter
+  @param[in]  numChannels    number of channels, a power of two from 4 to 32768
+  @param[in]  pSrc           points to the numFrames*numChannels complex input samples
+  @param[in]  numFrames      number of frames
+  @param[in]  framesPerCall  number of frames, which are passed to one call of the filter bank
+  @param[in]  pWork          points to the buffers of both instances, see PFB_WORK_LEN
+  @param[in]  nPE            number of parallel processing units, or 0 for the serial functions
+  @param[out] pChannels      points to the numFrames*numChannels complex channel samples
+  @param[out] pDst           points to the numFrames*numChannels complex output samples
+  @return     none
+ */
+
+static void pfb_run_f32(const float32_t *pFilter,
+                        uint32_t filterLen,
+                        uint32_t numChannels,
+                        const float32_t *pSrc,
+                        uint32_t numFrames,
+                        uint32_t framesPerCall,
+                        float32_t *pWork,
+                        uint32_t nPE,
+                        float32_t *pChannels,
+                        float32_t *pDst) {
+
+    plp_rfft_instance_f32 fft;
+    plp_pfb_analysis_instance_f32 analysis;
+    plp_pfb_synthesis_instance_f32 synthesis;
+    uint32_t r, n;
+    uint32_t M = numChannels;
+    uint32_t T = (filterLen + M - 1) / M;
+
+    float32_t *pCoeffsA = pWork;
+    float32_t *pStateA = pCoeffsA + M * T;
+    float32_t *pCoeffsS = pStateA + 2 * M * T;
+    float32_t *pStateS = pCoeffsS + M * T;
+    float32_t *pTables = pStateS + 2 * M * T;
+
+    if (plp_cfft_init_f32(&fft, M, pTables) != 0 ||
+        plp_pfb_analysis_init_f32(&analysis, &fft, pFilter, filterLen, pCoeffsA, pStateA) != 0 ||
+        plp_pfb_synthesis_init_f32(&synthesis, &fft, pFilter, filterLen, pCoeffsS, pStateS) != 0) {
+        printf("Error: unsupported number of channels or filter length!\n");
+        return;
+    }
+
+    for (r = 0; r < numFrames; r += n) {
+        const float32_t *pIn = pSrc + 2 * M * r;
+        n = (numFrames - r < framesPerCall) ? numFrames - r : framesPerCall;
+        if (nPE == 0) {
+            plp_pfb_analysis_f32(&analysis, pIn, n, pChannels + 2 * M * r);
+            plp_pfb_synthesis_f32(&synthesis, pIn, n, pDst + 2 * M * r);
+        } else {
+            plp_pfb_analysis_f32_parallel(&analysis, pIn, n, nPE, pChannels + 2 * M * r);
+            plp_pfb_synthesis_f32_parallel(&synthesis, pIn, n, nPE, pDst + 2 * M * r);
+        }
+    }
+}
+
+void pfb_q16(const int16_t *pFilter,
+             uint32_t filterLen,
+             uint32_t numChannels,
+             const int16_t *pSrc,
+             uint32_t numFrames,
+             uint32_t framesPerCall,
+             int16_t *pWork,
+             int16_t *pChannels,
+             int16_t *pDst) {
+
+    pfb_run_q16(pFilter, filterLen, numChannels, pSrc, numFrames, framesPerCall, pWork, 0,
+                pChannels, pDst);
+}
+
+void pfb_q16_parallel(const int16_t *pFilter,
+                      uint32_t filterLen,
+                      uint32_t numChannels,
+                      const int16_t *pSrc,
+                      uint32_t numFrames,
+                      uint32_t framesPerCall,
+                      int16_t *pWork,
+                      uint32_t nPE,
+                      int16_t *pChannels,
+                      int16_t *pDst) {
+
+    pfb_run_q16(pFilter, filterLen, numChannels, pSrc, numFrames, framesPerCall, pWork, nPE,
+                pChannels, pDst);
+}
+
+void pfb_f32(const float32_t *pFilter,
+             uint32_t filterLen,
+             uint32_t numChannels,
+             const float32_t *pSrc,
+             uint32_t numFrames,
+             uint32_t framesPerCall,
+             float32_t *pWork,
+             float32_t *pChannels,
+             float32_t *pDst) {
+
+    pfb_run_f32(pFilter, filterLen, numChannels, pSrc, numFrames, framesPerCall, pWork, 0,
+                pChannels, pDst);
+}
+
+void pfb_f32_parallel(const float32_t *pFilter,
+                      uint32_t filterLen,
+                      uint32_t numChannels,
+                      const float32_t *pSrc,
+                      uint32_t numFrames,
+                      uint32_t framesPerCall,
+                      float32_t *pWork,
+                      uint32_t nPE,
+                      float32_t *pChannels,
+                      float32_t *pDst) {
+
+    pfb_run_f32(pFilter, filterLen, numChannels, pSrc, numFrames, framesPerCall, pWork, nPE,
+                pChannels, pDst);
+}
@@ -0,0 +1,154 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        pfb.h
+ * Description:  Polyphase filter bank test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PFB_H__
+#define __PFB_H__
+
+#include "plp_math.h"
+
+/**
+   Number of values of the buffers of the transform and of both instances: the coefficients and
+   the delay lines of the analysis and of the synthesis, and the tables of the transform, which
+   take at most 5*numChannels/2 values (plp_cfft_init_q16).
+*/
+#define PFB_WORK_LEN(numChannels, tapsPerBranch) \
+    (6 * (numChannels) * (tapsPerBranch) + 5 * (numChannels) / 2)
+
+/** -------------------------------------------------------
+    @brief      Polyphase filter bank analysis and synthesis of a stream of 16-bit fixed-point
+                frames.
+    @param[in]  pFilter        points to the coefficients of the prototype filter in Q1.15
+    @param[in]  filterLen      number of coefficients of the prototype filter
+    @param[in]  numChannels    number of channels, a power of two from 16 to 4096
+    @param[in]  pSrc           points to the numFrames*numChannels complex input samples in Q1.15
+    @param[in]  numFrames      number of frames
+    @param[in]  framesPerCall  number of frames, which are passed to one call of the filter bank
+    @param[in]  pWork          points to the buffers of both instances, see PFB_WORK_LEN
+    @param[out] pChannels      points to the numFrames*numChannels complex channel samples of the
+                               analysis of pSrc
+    @param[out] pDst           points to the numFrames*numChannels complex output samples of the
+                               synthesis of pSrc, taken as channel samples
+    @return     none
+*/
+
+void pfb_q16(const int16_t *pFilter,
+             uint32_t filterLen,
+             uint32_t numChannels,
+             const int16_t *pSrc,
+             uint32_t numFrames,
+             uint32_t framesPerCall,
+             int16_t *pWork,
+             int16_t *pChannels,
+             int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      Parallel polyphase filter bank analysis and synthesis of a stream of 16-bit
+                fixed-point frames.
+    @param[in]  pFilter        points to the coefficients of the prototype filter in Q1.15
+    @param[in]  filterLen      number of coefficients of the prototype filter
+    @param[in]  numChannels    number of channels, a power of two from 16 to 4096
+    @param[in]  pSrc           points to the numFrames*numChannels complex input samples in Q1.15
+    @param[in]  numFrames      number of frames
+    @param[in]  framesPerCall  number of frames, which are passed to one call of the filter bank
+    @param[in]  pWork          points to the buffers of both instances, see PFB_WORK_LEN
+    @param[in]  nPE            number of parallel processing units
+    @param[out] pChannels      points to the numFrames*numChannels complex channel samples of the
+                               analysis of pSrc
+    @param[out] pDst           points to the numFrames*numChannels complex output samples of the
+                               synthesis of pSrc, taken as channel samples
+    @return     none
+*/
+
+void pfb_q16_parallel(const int16_t *pFilter,
+                      uint32_t filterLen,
+                      uint32_t numChannels,
+                      const int16_t *pSrc,
+                      uint32_t numFrames,
+                      uint32_t framesPerCall,
+                      int16_t *pWork,
+                      uint32_t nPE,
+                      int16_t *pChannels,
+                      int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      Polyphase filter bank analysis and synthesis of a stream of 32-bit floating-point
+                frames.
+    @param[in]  pFilter        points to the coefficients of the prototype filter
+    @param[in]  filterLen      number of coefficients of the prototype filter
+    @param[in]  numChannels    number of channels, a power of two from 4 to 32768
+    @param[in]  pSrc           points to the numFrames*numChannels complex input samples
+    @param[in]  numFrames      number of frames
+    @param[in]  framesPerCall  number of frames, which are passed to one call of the filter bank
+    @param[in]  pWork          points to the buffers of both instances, see PFB_WORK_LEN
+    @param[out] pChannels      points to the numFrames*numChannels complex channel samples of the
+                               analysis of pSrc
+    @param[out] pDst           points to the numFrames*numChannels complex output samples of the
+                               synthesis of pSrc, taken as channel samples
+    @return     none
+*/
+
+void pfb_f32(const float32_t *pFilter,
+             uint32_t filterLen,
+             uint32_t numChannels,
+             const float32_t *pSrc,
+             uint32_t numFrames,
+             uint32_t framesPerCall,
+             float32_t *pWork,
+             float32_t *pChannels,
+             float32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      Parallel polyphase filter bank analysis and synthesis of a stream of 32-bit
+                floating-point frames.
+    @param[in]  pFilter        points to the coefficients of the prototype filter
+    @param[in]  filterLen      number of coefficients of the prototype filter
+    @param[in]  numChannels    number of channels, a power of two from 4 to 32768
+    @param[in]  pSrc           points to the numFrames*numChannels complex input samples
+    @param[in]  numFrames      number of frames
+    @param[in]  framesPerCall  number of frames, which are passed to one call of the filter bank
+    @param[in]  pWork          points to the buffers of both instances, see PFB_WORK_LEN
+    @param[in]  nPE            number of parallel processing units
+    @param[out] pChannels      points to the numFrames*numChannels complex channel samples of the
+                               analysis of pSrc
+    @param[out] pDst           points to the numFrames*numChannels complex output samples of the
+                               synthesis of pSrc, taken as channel samples
+    @return     none
+*/
+
+void pfb_f32_parallel(const float32_t *pFilter,
+                      uint32_t filterLen,
+                      uint32_t numChannels,
+                      const float32_t *pSrc,
+                      uint32_t numFrames,
+                      uint32_t framesPerCall,
+                      float32_t *pWork,
+                      uint32_t nPE,
+                      float32_t *pChannels,
+                      float32_t *pDst);
+
+#endif //__PFB_H__
@@ -0,0 +1,34 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    result = beamformer([int(x) for x in inputs['pSrc'].value],
+                        [int(x) for x in inputs['pDelays'].value],
+                        [int(x) for x in inputs['pWeights'].value],
+                        env['mics'], env['src_len'], env['len'], fix_point)
+    return np.array(result).astype(np.int16)
+
+
+def beamformer(src, delays, weights, mics, src_len, dst_len, shift):
+    """ Bit exact model of the pipeline: align and sum """
+    result = []
+    for t in range(dst_len):
+        # plp_mat_mult_q16 rounds every product, and wraps the sum to 16 bits
+        acc = 0
+        for m in range(mics):
+            acc += (weights[m] * src[m * src_len + delays[m] + t] + (1 << (shift - 1))) >> shift
+        result.append(((acc + 2**15) & 0xFFFF) - 2**15)
+    return result
@@ -0,0 +1,135 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        pipeline_beamformer.c
+ * Description:  Delay-and-sum beamformer pipeline benchmark
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "pipeline_beamformer.h"
+#include "stages.h"
+
+/**
+  @brief      Delay-and-sum beamformer of 16-bit fixed-point signals.
+
+  <pre>
+  pDst[t] = sum_m (pWeights[m] * pSrc[m][t + pDelays[m]]) >> shift,   0 <= t < dstLen
+  </pre>
+
+  The pipeline is built from the library kernels only:
+
+  - align: plp_copy_i16 of the delayed part of every signal into the rows of a matrix
+  - sum:   plp_mat_mult_q16 of the weights (a 1 x nMics matrix) with the aligned signals
+
+  @param[in]  pSrc      points to the signals, nMics rows of srcLen samples
+  @param[in]  pDelays   points to the delay of every microphone, at most srcLen - dstLen
+  @param[in]  pWeights  points to the weight of every microphone
+  @param[in]  nMics     number of microphones
+  @param[in]  srcLen    number of samples of every signal
+  @param[in]  dstLen    number of samples of the output
+  @param[in]  shift     right shift of every weighted sample
+  @param[out] pDst      points to the output of dstLen samples
+  @return     none
+ */
+
+void pipeline_beamformer_q16(const int16_t *pSrc,
+                             const uint32_t *pDelays,
+                             const int16_t *pWeights,
+                             uint32_t nMics,
+                             uint32_t srcLen,
+                             uint32_t dstLen,
+                             uint32_t shift,
+                             int16_t *pDst) {
+
+    uint32_t m;
+    uint32_t alignedSize = nMics * dstLen * sizeof(int16_t);
+
+    int16_t *pAligned = (int16_t *)plp_scratch_alloc(alignedSize);
+
+    if (pAligned == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+
+    for (m = 0; m < nMics; m++) {
+        plp_copy_i16((int16_t *)&pSrc[m * srcLen + pDelays[m]], &pAligned[m * dstLen], dstLen);
+    }
+    test_stage("align");
+
+    plp_mat_mult_q16(pWeights, pAligned, 1, nMics, dstLen, shift, pDst);
+    test_stage("sum");
+
+    plp_scratch_free(pAligned, alignedSize);
+}
+
+/**
+  @brief      Parallel delay-and-sum beamformer of 16-bit fixed-point signals.
+
+  Same pipeline as pipeline_beamformer_q16, with the parallel version of every kernel. Every call
+  forks the team on its own, such that the cycles of every stage include the fork and barrier
+  overhead of all its calls.
+
+  @param[in]  pSrc      points to the signals, nMics rows of srcLen samples
+  @param[in]  pDelays   points to the delay of every microphone, at most srcLen - dstLen
+  @param[in]  pWeights  points to the weight of every microphone
+  @param[in]  nMics     number of microphones
+  @param[in]  srcLen    number of samples of every signal
+  @param[in]  dstLen    number of samples of the output
+  @param[in]  shift     right shift of every weighted sample
+  @param[in]  nPE       number of parallel processing units
+  @param[out] pDst      points to the output of dstLen samples
+  @return     none
+ */
+
+void pipeline_beamformer_q16_parallel(const int16_t *pSrc,
+                                      const uint32_t *pDelays,
+                                      const int16_t *pWeights,
+                                      uint32_t nMics,
+                                      uint32_t srcLen,
+                                      uint32_t dstLen,
+                                      uint32_t shift,
+                                      uint32_t nPE,
+                                      int16_t *pDst) {
+
+    uint32_t m;
+    uint32_t alignedSize = nMics * dstLen * sizeof(int16_t);
+
+    int16_t *pAligned = (int16_t *)plp_scratch_alloc(alignedSize);
+
+    if (pAligned == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+
+    for (m = 0; m < nMics; m++) {
+        plp_copy_i16_parallel((int16_t *)&pSrc[m * srcLen + pDelays[m]], &pAligned[m * dstLen],
+                              dstLen, nPE);
+    }
+    test_stage("align");
+
+    plp_mat_mult_q16_parallel(pWeights, pAligned, 1, nMics, dstLen, shift, nPE, pDst);
+    test_stage("sum");
+
+    plp_scratch_free(pAligned, alignedSize);
+}
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        pipeline_beamformer.h
+ * Description:  Delay-and-sum beamformer pipeline benchmark
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PIPELINE_BEAMFORMER_H__
+#define __PIPELINE_BEAMFORMER_H__
+
+#include "plp_math.h"
+
+/** -------------------------------------------------------
+    @brief      Delay-and-sum beamformer of 16-bit fixed-point signals.
+    @param[in]  pSrc      points to the signals, nMics rows of srcLen samples
+    @param[in]  pDelays   points to the delay of every microphone, at most srcLen - dstLen
+    @param[in]  pWeights  points to the weight of every microphone
+    @param[in]  nMics     number of microphones
+    @param[in]  srcLen    number of samples of every signal
+    @param[in]  dstLen    number of samples of the output
+    @param[in]  shift     right shift of every weighted sample
+    @param[out] pDst      points to the output of dstLen samples
+    @return     none
+*/
+
+void pipeline_beamformer_q16(const int16_t *pSrc,
+                             const uint32_t *pDelays,
+                             const int16_t *pWeights,
+                             uint32_t nMics,
+                             uint32_t srcLen,
+                             uint32_t dstLen,
+                             uint32_t shift,
+                             int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      Parallel delay-and-sum beamformer of 16-bit fixed-point signals.
+    @param[in]  pSrc      points to the signals, nMics rows of srcLen samples
+    @param[in]  pDelays   points to the delay of every microphone, at most srcLen - dstLen
+    @param[in]  pWeights  points to the weight of every microphone
+    @param[in]  nMics     number of microphones
+    @param[in]  srcLen    number of samples of every signal
+    @param[in]  dstLen    number of samples of the output
+    @param[in]  shift     right shift of every weighted sample
+    @param[in]  nPE       number of parallel processing units
+    @param[out] pDst      points to the output of dstLen samples
+    @return     none
+*/
+
+void pipeline_beamformer_q16_parallel(const int16_t *pSrc,
+                                      const uint32_t *pDelays,
+                                      const int16_t *pWeights,
+                                      uint32_t nMics,
+                                      uint32_t srcLen,
+                                      uint32_t dstLen,
+                                      uint32_t shift,
+                                      uint32_t nPE,
+                                      int16_t *pDst);
+
+#endif //__PIPELINE_BEAMFORMER_H__
@@ -0,0 +1,40 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    result = conv_layer([int(x) for x in inputs['pSrc'].value],
+                        [int(x) for x in inputs['pWeights'].value],
+                        env['in_ch'], env['out_ch'], env['len'], env['kernel_len'], fix_point)
+    return np.array(result).astype(np.int8)
+
+
+def conv_layer(src, weights, in_ch, out_ch, src_len, kernel_len, shift):
+    """ Bit exact model of the pipeline: conv, relu and requant """
+    dst_len = src_len - kernel_len + 1
+    result = []
+    for o in range(out_ch):
+        acc = [0] * dst_len
+        for i in range(in_ch):
+            x = src[i * src_len:(i + 1) * src_len]
+            w = weights[(o * in_ch + i) * kernel_len:(o * in_ch + i + 1) * kernel_len]
+            # valid convolution, with the flipped kernel (as np.convolve)
+            for t in range(dst_len):
+                acc[t] += sum([x[t + k] * w[kernel_len - 1 - k] for k in range(kernel_len)])
+        for t in range(dst_len):
+            # relu, saturating left shift of plp_shift_q32, and rounding of plp_convert_q32_to_q8
+            val = min(max(acc[t], 0) << (24 - shift), 2**31 - 1)
+            result.append(min(((val >> 23) + 1) >> 1, 2**7 - 1))
+    return result
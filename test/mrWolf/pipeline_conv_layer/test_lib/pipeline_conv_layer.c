@@ -0,0 +1,167 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        pipeline_conv_layer.c
+ * Description:  1D convolution layer pipeline benchmark
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "pipeline_conv_layer.h"
+#include "stages.h"
+
+/**
+  @brief      1D convolution layer with ReLU and requantization to 8 bits.
+
+  Every output channel is the sum of the valid convolutions of all input channels with their
+  kernel, accumulated in 32 bits. The pipeline is built from the library kernels only:
+
+  - conv:    plp_conv_valid_i8 per pair of channels, summed up with plp_add_i32
+  - relu:    plp_clip_i32 to [0, INT32_MAX]
+  - requant: plp_shift_q32 by 24 - shift, and plp_convert_q32_to_q8, such that the result is the
+             accumulator shifted right by shift (rounded and saturated)
+
+  @param[in]  pSrc         points to the input, inChannels rows of srcLen samples
+  @param[in]  pWeights     points to the weights, outChannels x inChannels rows of kernelLen
+  @param[in]  inChannels   number of input channels
+  @param[in]  outChannels  number of output channels
+  @param[in]  srcLen       number of samples of every input channel
+  @param[in]  kernelLen    number of weights of every kernel
+  @param[in]  shift        right shift of the accumulated products before the conversion
+  @param[out] pDst         points to the output, outChannels rows of srcLen - kernelLen + 1
+  @return     none
+ */
+
+void pipeline_conv_layer_q8(const int8_t *pSrc,
+                            const int8_t *pWeights,
+                            uint32_t inChannels,
+                            uint32_t outChannels,
+                            uint32_t srcLen,
+                            uint32_t kernelLen,
+                            uint32_t shift,
+                            int8_t *pDst) {
+
+    uint32_t o, i;
+    uint32_t dstLen = srcLen - kernelLen + 1;
+    uint32_t accSize = outChannels * dstLen * sizeof(int32_t);
+    uint32_t tmpSize = dstLen * sizeof(int32_t);
+
+    int32_t *pAcc = (int32_t *)plp_scratch_alloc(accSize);
+    int32_t *pTmp = (int32_t *)plp_scratch_alloc(tmpSize);
+
+    if (pAcc == NULL || pTmp == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        plp_scratch_free(pTmp, tmpSize);
+        plp_scratch_free(pAcc, accSize);
+        return;
+    }
+
+    for (o = 0; o < outChannels; o++) {
+        int32_t *pAccRow = &pAcc[o * dstLen];
+        plp_conv_valid_i8(pSrc, srcLen, &pWeights[o * inChannels * kernelLen], kernelLen, pAccRow);
+        for (i = 1; i < inChannels; i++) {
+            plp_conv_valid_i8(&pSrc[i * srcLen], srcLen,
+                              &pWeights[(o * inChannels + i) * kernelLen], kernelLen, pTmp);
+            plp_add_i32(pAccRow, pTmp, pAccRow, dstLen);
+        }
+    }
+    test_stage("conv");
+
+    plp_clip_i32(pAcc, pAcc, outChannels * dstLen, 0, INT32_MAX);
+    test_stage("relu");
+
+    plp_shift_q32(pAcc, pAcc, outChannels * dstLen, (int8_t)(24 - shift));
+    plp_convert_q32_to_q8(pAcc, pDst, outChannels * dstLen);
+    test_stage("requant");
+
+    plp_scratch_free(pTmp, tmpSize);
+    plp_scratch_free(pAcc, accSize);
+}
+
+/**
+  @brief      Parallel 1D convolution layer with ReLU and requantization to 8 bits.
+
+  Same pipeline as pipeline_conv_layer_q8, with the parallel version of every kernel. Every call
+  forks the team on its own, such that the cycles of every stage include the fork and barrier
+  overhead of all its calls.
+
+  @param[in]  pSrc         points to the input, inChannels rows of srcLen samples
+  @param[in]  pWeights     points to the weights, outChannels x inChannels rows of kernelLen
+  @param[in]  inChannels   number of input channels
+  @param[in]  outChannels  number of output channels
+  @param[in]  srcLen       number of samples of every input channel
+  @param[in]  kernelLen    number of weights of every kernel
+  @param[in]  shift        right shift of the accumulated products before the conversion
+  @param[in]  nPE          number of parallel processing units
+  @param[out] pDst         points to the output, outChannels rows of srcLen - kernelLen + 1
+  @return     none
+ */
+
+void pipeline_conv_layer_q8_parallel(const int8_t *pSrc,
+                                     const int8_t *pWeights,
+                                     uint32_t inChannels,
+                                     uint32_t outChannels,
+                                     uint32_t srcLen,
+                                     uint32_t kernelLen,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int8_t *pDst) {
+
+    uint32_t o, i;
+    uint32_t dstLen = srcLen - kernelLen + 1;
+    uint32_t accSize = outChannels * dstLen * sizeof(int32_t);
+    uint32_t tmpSize = dstLen * sizeof(int32_t);
+
+    int32_t *pAcc = (int32_t *)plp_scratch_alloc(accSize);
+    int32_t *pTmp = (int32_t *)plp_scratch_alloc(tmpSize);
+
+    if (pAcc == NULL || pTmp == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        plp_scratch_free(pTmp, tmpSize);
+        plp_scratch_free(pAcc, accSize);
+        return;
+    }
+
+    for (o = 0; o < outChannels; o++) {
+        int32_t *pAccRow = &pAcc[o * dstLen];
+        plp_conv_valid_i8_parallel(pSrc, srcLen, &pWeights[o * inChannels * kernelLen], kernelLen,
+                                   nPE, pAccRow);
+        for (i = 1; i < inChannels; i++) {
+            plp_conv_valid_i8_parallel(&pSrc[i * srcLen], srcLen,
+                                       &pWeights[(o * inChannels + i) * kernelLen], kernelLen,
+                                       nPE, pTmp);
+            plp_add_i32_parallel(pAccRow, pTmp, pAccRow, dstLen, nPE);
+        }
+    }
+    test_stage("conv");
+
+    plp_clip_i32_parallel(pAcc, pAcc, outChannels * dstLen, 0, INT32_MAX, nPE);
+    test_stage("relu");
+
+    plp_shift_q32_parallel(pAcc, pAcc, outChannels * dstLen, (int8_t)(24 - shift), nPE);
+    plp_convert_q32_to_q8_parallel(pAcc, pDst, outChannels * dstLen, nPE);
+    test_stage("requant");
+
+    plp_scratch_free(pTmp, tmpSize);
+    plp_scratch_free(pAcc, accSize);
+}
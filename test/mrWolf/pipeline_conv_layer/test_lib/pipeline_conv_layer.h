@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        pipeline_conv_layer.h
+ * Description:  1D convolution layer pipeline benchmark
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PIPELINE_CONV_LAYER_H__
+#define __PIPELINE_CONV_LAYER_H__
+
+#include "plp_math.h"
+
+/** -------------------------------------------------------
+    @brief      1D convolution layer with ReLU and requantization to 8 bits.
+    @param[in]  pSrc         points to the input, inChannels rows of srcLen samples
+    @param[in]  pWeights     points to the weights, outChannels x inChannels rows of kernelLen
+    @param[in]  inChannels   number of input channels
+    @param[in]  outChannels  number of output channels
+    @param[in]  srcLen       number of samples of every input channel
+    @param[in]  kernelLen    number of weights of every kernel
+    @param[in]  shift        right shift of the accumulated products before the conversion
+    @param[out] pDst         points to the output, outChannels rows of srcLen - kernelLen + 1
+    @return     none
+*/
+
+void pipeline_conv_layer_q8(const int8_t *pSrc,
+                            const int8_t *pWeights,
+                            uint32_t inChannels,
+                            uint32_t outChannels,
+                            uint32_t srcLen,
+                            uint32_t kernelLen,
+                            uint32_t shift,
+                            int8_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      Parallel 1D convolution layer with ReLU and requantization to 8 bits.
+    @param[in]  pSrc         points to the input, inChannels rows of srcLen samples
+    @param[in]  pWeights     points to the weights, outChannels x inChannels rows of kernelLen
+    @param[in]  inChannels   number of input channels
+    @param[in]  outChannels  number of output channels
+    @param[in]  srcLen       number of samples of every input channel
+    @param[in]  kernelLen    number of weights of every kernel
+    @param[in]  shift        right shift of the accumulated products before the conversion
+    @param[in]  nPE          number of parallel processing units
+    @param[out] pDst         points to the output, outChannels rows of srcLen - kernelLen + 1
+    @return     none
+*/
+
+void pipeline_conv_layer_q8_parallel(const int8_t *pSrc,
+                                     const int8_t *pWeights,
+                                     uint32_t inChannels,
+                                     uint32_t outChannels,
+                                     uint32_t srcLen,
+                                     uint32_t kernelLen,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int8_t *pDst);
+
+#endif //__PIPELINE_CONV_LAYER_H__
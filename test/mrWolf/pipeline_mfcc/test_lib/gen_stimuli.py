@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+# right shift of the squared magnitude (PIPELINE_MFCC_POWER_SHIFT in pipeline_mfcc.c)
+POWER_SHIFT = 8
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    if arg.name == "pMel":
+        return np.array(mel_filter_bank(env['n_mel'], env['n_bins'])).astype(np.int16)
+    if arg.name == "pDct":
+        return np.array(dct_matrix(env['n_coef'], env['n_mel'])).astype(np.int16)
+    raise RuntimeError("No stimuli for argument: %s" % arg.name)
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The rfft is computed in floating point, with the scaling of plp_rfft_q16 (see rfft_q). All
+    # other stages are bit exact models of the kernels.
+    n = env['len']
+    a = inputs['pSrc'].value.astype(np.float64) / 2**15
+    spectrum = np.fft.rfft(a) * 2**(15 - int(np.log2(n)))
+    spectrum = np.round(np.concatenate((np.real(spectrum), np.imag(spectrum)))).astype(np.int64)
+
+    result = mfcc([int(x) for x in spectrum[:n // 2 + 1]],
+                  [int(x) for x in spectrum[n // 2 + 1:]],
+                  [int(x) for x in inputs['pMel'].value],
+                  [int(x) for x in inputs['pDct'].value],
+                  env['n_bins'], env['n_mel'], env['n_coef'], fix_point)
+    return np.array(result).astype(np.int16)
+
+
+def mfcc(re, im, mel, dct, n_bins, n_mel, n_coef, frac_bits):
+    """ Bit exact model of the stages after the rfft (of which re and im are the n_bins + 1 bins) """
+    # plp_rfft_q16 packs the Nyquist bin into the imaginary part of the DC bin
+    im = [re[n_bins]] + im[1:n_bins]
+    power = [wrap16(roundnorm(re[k] * re[k], POWER_SHIFT) + roundnorm(im[k] * im[k], POWER_SHIFT))
+             for k in range(n_bins)]
+    mel_energy = mat_vec_mult(mel, power, n_mel, n_bins, 15)
+    log_mel = [log_q16(x, frac_bits) for x in mel_energy]
+    return mat_vec_mult(dct, log_mel, n_coef, n_mel, 15)
+
+
+def roundnorm(x, shift):
+    return (x + ((1 << shift) >> 1)) >> shift
+
+
+def wrap16(x):
+    return ((x + 2**15) & 0xFFFF) - 2**15
+
+
+def clip16(x):
+    return min(max(x, -2**15), 2**15 - 1)
+
+
+def mat_vec_mult(a, x, m, n, shift):
+    """ plp_mat_vec_mult_q16: 32-bit sum, rounded shift and saturation """
+    y = []
+    for i in range(m):
+        acc = sum([a[i * n + j] * x[j] for j in range(n)])
+        acc = ((acc + 2**31) & 0xFFFFFFFF) - 2**31
+        y.append(clip16(roundnorm(acc, shift)))
+    return y
+
+
+def log_q16(x, frac_bits):
+    """ plp_log_vec_q16: polynomial of log(1 + d) around the normalized mantissa """
+    if x <= 0:
+        return -2**15
+    n = 32 - x.bit_length()
+    m = x << n
+    e = 31 - n - frac_bits
+    if m > 0xB504F333:
+        m >>= 1
+        e += 1
+    d = (m - 0x80000000) >> 16
+    acc = 5739
+    acc = ((acc * d) >> 15) - 8962
+    acc = ((acc * d) >> 15) + 11054
+    acc = ((acc * d) >> 15) - 16359
+    acc = ((acc * d) >> 15) + 32765
+    acc = e * 22713 + ((acc * d) >> 15)
+    return clip16(roundnorm(acc, 15 - frac_bits))
+
+
+def mel_filter_bank(n_mel, n_bins):
+    """
+    Triangular filters in Q1.15 with a peak of 0.5, equally spaced on the mel scale between 0 and
+    the Nyquist frequency. The corners are rounded to whole bins, and spread such that every
+    filter covers at least one bin.
+    """
+    mel_max = 2595 * np.log10(1 + 8000 / 700)
+    corners = []
+    for i in range(n_mel + 2):
+        f = 700 * (10**(mel_max * i / (n_mel + 1) / 2595) - 1)
+        corners.append(int(round(f / 8000 * (n_bins - 1))))
+    for i in range(1, n_mel + 2):
+        corners[i] = max(corners[i], corners[i - 1] + 1)
+    weights = []
+    for i in range(n_mel):
+        low, center, high = corners[i:i + 3]
+        for k in range(n_bins):
+            if low < k <= center:
+                weights.append(int(round(2**14 * (k - low) / (center - low))))
+            elif center < k < high:
+                weights.append(int(round(2**14 * (high - k) / (high - center))))
+            else:
+                weights.append(0)
+    return weights
+
+
+def dct_matrix(n_coef, n_mel):
+    """ First n_coef rows of the orthonormal DCT-II in Q1.15 """
+    return [int(round((2**15 - 1) * np.sqrt((1 if k == 0 else 2) / n_mel)
+                      * np.cos(np.pi * k * (2 * m + 1) / (2 * n_mel))))
+            for k in range(n_coef) for m in range(n_mel)]
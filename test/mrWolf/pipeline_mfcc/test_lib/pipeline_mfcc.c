@@ -0,0 +1,163 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        pipeline_mfcc.c
+ * Description:  MFCC pipeline benchmark
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "pipeline_mfcc.h"
+#include "stages.h"
+
+/**
+  Right shift of the squared magnitude, which keeps the power of the benchmark frames (white noise
+  in [-0.5, 0.5)) in 16 bits.
+ */
+#define PIPELINE_MFCC_POWER_SHIFT 8
+
+/**
+  @brief      MFCC features of a frame of 16-bit fixed-point samples.
+
+  The keyword spotting front end, built from the library kernels only:
+
+  - rfft:  plp_rfft_q16 of the frame
+  - power: plp_cmplx_mag_squared_q16 of the fftLenReal / 2 bins. The first bin holds the DC and
+           the Nyquist component, which are packed into the first two outputs of the rfft.
+  - mel:   plp_mat_vec_mult_q16 of the mel filter bank (in Q1.15) with the power
+  - log:   plp_log_vec_q16 of the mel energies
+  - dct:   plp_mat_vec_mult_q16 of the DCT matrix (in Q1.15) with the log mel energies
+
+  @param[in]  S         points to the instance of the rfft, which determines the frame length
+  @param[in]  pSrc      points to the frame of fftLenReal samples
+  @param[in]  pMel      points to the mel filter bank, nMel rows of fftLenReal / 2 weights
+  @param[in]  pDct      points to the DCT matrix, nCoef rows of nMel coefficients
+  @param[in]  nMel      number of mel filters
+  @param[in]  nCoef     number of cepstral coefficients
+  @param[in]  fracBits  number of fractional bits of the mel energies and of the log
+  @param[out] pDst      points to the nCoef cepstral coefficients
+  @return     none
+ */
+
+void pipeline_mfcc_q16(const plp_rfft_instance_q16 *S,
+                       const int16_t *pSrc,
+                       const int16_t *pMel,
+                       const int16_t *pDct,
+                       uint32_t nMel,
+                       uint32_t nCoef,
+                       uint32_t fracBits,
+                       int16_t *pDst) {
+
+    uint32_t nBins = S->fftLenReal / 2;
+    uint32_t bufSize = (S->fftLenReal + nBins + 2 * nMel) * sizeof(int16_t);
+
+    int16_t *pBuf = (int16_t *)plp_scratch_alloc(bufSize);
+
+    if (pBuf == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+
+    int16_t *pSpectrum = pBuf;
+    int16_t *pPower = pSpectrum + S->fftLenReal;
+    int16_t *pMelEnergy = pPower + nBins;
+    int16_t *pLogMel = pMelEnergy + nMel;
+
+    plp_rfft_q16(S, pSrc, pSpectrum);
+    test_stage("rfft");
+
+    plp_cmplx_mag_squared_q16(pSpectrum, pPower, PIPELINE_MFCC_POWER_SHIFT, nBins);
+    test_stage("power");
+
+    plp_mat_vec_mult_q16(pMel, pPower, nMel, nBins, 15, pMelEnergy);
+    test_stage("mel");
+
+    plp_log_vec_q16(pMelEnergy, nMel, fracBits, pLogMel);
+    test_stage("log");
+
+    plp_mat_vec_mult_q16(pDct, pLogMel, nCoef, nMel, 15, pDst);
+    test_stage("dct");
+
+    plp_scratch_free(pBuf, bufSize);
+}
+
+/**
+  @brief      Parallel MFCC features of a frame of 16-bit fixed-point samples.
+
+  Same pipeline as pipeline_mfcc_q16, with the parallel version of every kernel. Every call forks
+  the team on its own, such that the cycles of every stage include the fork and barrier overhead.
+
+  @param[in]  S         points to the instance of the rfft, which determines the frame length
+  @param[in]  pSrc      points to the frame of fftLenReal samples
+  @param[in]  pMel      points to the mel filter bank, nMel rows of fftLenReal / 2 weights
+  @param[in]  pDct      points to the DCT matrix, nCoef rows of nMel coefficients
+  @param[in]  nMel      number of mel filters
+  @param[in]  nCoef     number of cepstral coefficients
+  @param[in]  fracBits  number of fractional bits of the mel energies and of the log
+  @param[in]  nPE       number of parallel processing units
+  @param[out] pDst      points to the nCoef cepstral coefficients
+  @return     none
+ */
+
+void pipeline_mfcc_q16_parallel(const plp_rfft_instance_q16 *S,
+                                const int16_t *pSrc,
+                                const int16_t *pMel,
+                                const int16_t *pDct,
+                                uint32_t nMel,
+                                uint32_t nCoef,
+                                uint32_t fracBits,
+                                uint32_t nPE,
+                                int16_t *pDst) {
+
+    uint32_t nBins = S->fftLenReal / 2;
+    uint32_t bufSize = (S->fftLenReal + nBins + 2 * nMel) * sizeof(int16_t);
+
+    int16_t *pBuf = (int16_t *)plp_scratch_alloc(bufSize);
+
+    if (pBuf == NULL) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+
+    int16_t *pSpectrum = pBuf;
+    int16_t *pPower = pSpectrum + S->fftLenReal;
+    int16_t *pMelEnergy = pPower + nBins;
+    int16_t *pLogMel = pMelEnergy + nMel;
+
+    plp_rfft_q16_parallel(S, pSrc, nPE, pSpectrum);
+    test_stage("rfft");
+
+    plp_cmplx_mag_squared_q16_parallel(pSpectrum, pPower, PIPELINE_MFCC_POWER_SHIFT, nBins, nPE);
+    test_stage("power");
+
+    plp_mat_vec_mult_q16_parallel(pMel, pPower, nMel, nBins, 15, nPE, pMelEnergy);
+    test_stage("mel");
+
+    plp_log_vec_q16_parallel(pMelEnergy, nMel, fracBits, nPE, pLogMel);
+    test_stage("log");
+
+    plp_mat_vec_mult_q16_parallel(pDct, pLogMel, nCoef, nMel, 15, nPE, pDst);
+    test_stage("dct");
+
+    plp_scratch_free(pBuf, bufSize);
+}
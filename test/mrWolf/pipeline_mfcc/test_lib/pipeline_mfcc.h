@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        pipeline_mfcc.h
+ * Description:  MFCC pipeline benchmark
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PIPELINE_MFCC_H__
+#define __PIPELINE_MFCC_H__
+
+#include "plp_math.h"
+
+/** -------------------------------------------------------
+    @brief      MFCC features of a frame of 16-bit fixed-point samples.
+    @param[in]  S         points to the instance of the rfft, which determines the frame length
+    @param[in]  pSrc      points to the frame of fftLenReal samples
+    @param[in]  pMel      points to the mel filter bank, nMel rows of fftLenReal / 2 weights
+    @param[in]  pDct      points to the DCT matrix, nCoef rows of nMel coefficients
+    @param[in]  nMel      number of mel filters
+    @param[in]  nCoef     number of cepstral coefficients
+    @param[in]  fracBits  number of fractional bits of the mel energies and of the log
+    @param[out] pDst      points to the nCoef cepstral coefficients
+    @return     none
+*/
+
+void pipeline_mfcc_q16(const plp_rfft_instance_q16 *S,
+                       const int16_t *pSrc,
+                       const int16_t *pMel,
+                       const int16_t *pDct,
+                       uint32_t nMel,
+                       uint32_t nCoef,
+                       uint32_t fracBits,
+                       int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      Parallel MFCC features of a frame of 16-bit fixed-point samples.
+    @param[in]  S         points to the instance of the rfft, which determines the frame length
+    @param[in]  pSrc      points to the frame of fftLenReal samples
+    @param[in]  pMel      points to the mel filter bank, nMel rows of fftLenReal / 2 weights
+    @param[in]  pDct      points to the DCT matrix, nCoef rows of nMel coefficients
+    @param[in]  nMel      number of mel filters
+    @param[in]  nCoef     number of cepstral coefficients
+    @param[in]  fracBits  number of fractional bits of the mel energies and of the log
+    @param[in]  nPE       number of parallel processing units
+    @param[out] pDst      points to the nCoef cepstral coefficients
+    @return     none
+*/
+
+void pipeline_mfcc_q16_parallel(const plp_rfft_instance_q16 *S,
+                                const int16_t *pSrc,
+                                const int16_t *pMel,
+                                const int16_t *pDct,
+                                uint32_t nMel,
+                                uint32_t nCoef,
+                                uint32_t fracBits,
+                                uint32_t nPE,
+                                int16_t *pDst);
+
+#endif //__PIPELINE_MFCC_H__
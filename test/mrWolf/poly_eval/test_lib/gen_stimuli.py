@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    x = inputs['pSrc'].value
+    coeffs = inputs['pCoeffs'].value
+    if result_parameter.ctype == 'float':
+        x = x.astype(np.float32)
+        acc = np.full(x.shape, coeffs[-1], dtype=np.float32)
+        for c in coeffs[-2::-1]:
+            acc = acc * x + np.float32(c)
+        return acc.astype(np.float32)
+
+    if result_parameter.ctype == 'int16_t':
+        dtype, bits = np.int16, 16
+    elif result_parameter.ctype == 'int32_t':
+        dtype, bits = np.int32, 32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    # every Horner step is rounded and saturated, exactly as in the kernels
+    lo, hi = -2**(bits - 1), 2**(bits - 1) - 1
+    rnd = 1 << (fix_point - 1) if fix_point > 0 else 0
+    result = []
+    for xi in x:
+        acc = int(coeffs[-1])
+        for c in coeffs[-2::-1]:
+            acc = ((acc * int(xi) + rnd) >> fix_point) + int(c)
+            acc = min(max(acc, lo), hi)
+        result.append(acc)
+    return np.array(result, dtype=dtype)
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
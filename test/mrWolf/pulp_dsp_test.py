@@ -17,6 +17,37 @@ import re
 GENERATE_STIMULI = "gen_stimuli"
 # L2_MEM_SIZE_KB = 448
 TEST_MEM_SIZE_KB = 224
+# environment variable with a comma separated list of core counts (e.g. "1,2,4,8"). If it is set,
+# every _parallel and _l2 version is run once for each number of cores instead of the nPE of the
+# testset.
+NPE_SWEEP_ENV = "TEST_NPE_SWEEP"
+# environment variable to sweep the placement of the array arguments. If it is set (e.g. to "1"),
+# every case on riscy is run with all arrays in L1, with each array alone moved to L2, and with all
+# arrays in L2. Arrays with an explicit use_l1 in the testset are not moved.
+PLACEMENT_SWEEP_ENV = "TEST_PLACEMENT_SWEEP"
+# environment variable to sweep the padding of the rows of strided matrices. If it is set (e.g. to
+# "1"), every case on riscy of a testset with a PaddingVariable is run once without padding, and
+# once with the stride of plp_matrix_padded_stride, which avoids conflicts of the L1 banks.
+PADDING_SWEEP_ENV = "TEST_PADDING_SWEEP"
+# environment variable with the number of repetitions to measure the latency of every case. If it is
+# set (e.g. to "100"), the function is called this many more times, and the minimum and maximum
+# cycles of all calls (including the first, with a cold cache) are written to the benchmark.
+REPEAT_ENV = "TEST_REPEAT"
+# environment variable to measure the cost of offloading every case to the cluster. If it is set
+# (e.g. to "1"), the fabric controller calls every case on riscy once more after the tests, with the
+# cluster powered down before. It counts the cycles to mount the cluster and of the whole call,
+# which copies the arrays from L2 to L1, calls the function and copies the outputs back.
+OFFLOAD_ENV = "TEST_OFFLOAD"
+# environment variable with the path to a shape profile, printed by plp_profile_print_shapes. If it
+# is set, every testset with a shape (see generate_test) replays the shapes of the profile instead
+# of its sweep, and every case is weighted by its number of calls in the benchmark.
+SHAPE_PROFILE_ENV = "TEST_SHAPE_PROFILE"
+# if the environment variable TEST_PLATFORM is set to this platform, the tests are built with the
+# compiler of the host and linked with lib/host/libplpdsp.a (see `make host`), instead of the
+# pulp-sdk. The cycles are then measured in nanoseconds.
+HOST_PLATFORM = "host"
+# root of the library, which contains the host runtime and lib/host
+PLP_DSP_HOME = os.path.abspath(os.path.join(os.path.dirname(os.path.realpath(__file__)), "../.."))
 
 
 class Variable(object):
@@ -36,11 +67,16 @@ class SweepVariable(Variable):
     def __init__(self, name, values, visible=True, active=None):
         """
         name: name for the sweep variable
-        values: iterable over all possible values for this variable
+        values: iterable over all possible values for this variable, or a function which returns
+                them for the version (e.g. to add longer vectors for the _l2 versions)
         """
         super(SweepVariable, self).__init__(name, visible, active)
         self.values = values
 
+    def get_values(self, version):
+        """ returns the values to sweep for the given version """
+        return self.values(version) if callable(self.values) else self.values
+
 
 class DynamicVariable(Variable):
     """Dynamic Variable, value determined based on others"""
@@ -54,6 +90,23 @@ class DynamicVariable(Variable):
         self.fun = fun
 
 
+class PaddingVariable(SweepVariable):
+    """Padding of the rows of a strided matrix, in elements"""
+    def __init__(self, name, cols, ctype, values=[0], visible=False):
+        """
+        name: name of the variable
+        cols: name of the variable with the number of columns of the matrix
+        ctype: element type of the matrix, a ctype or 'var_type' | 'ret_type'
+        values: paddings to sweep, unless the padding is swept with PADDING_SWEEP_ENV. In that
+                case, the padding is 0 or the one of plp_matrix_padded_stride.
+        example: PaddingVariable('lA', 'len_n', 'var_type'), with
+                 DynamicVariable('strideA', lambda e: e['len_n'] + e['lA'])
+        """
+        super(PaddingVariable, self).__init__(name, values, visible)
+        self.cols = cols
+        self.ctype = ctype
+
+
 class Argument(object):
     """docstring for argument"""
     def __init__(self, name, ctype, value=None, use_l1=None, in_function=True):
@@ -133,6 +186,10 @@ class Argument(object):
             return np.int16
         if self.ctype == "int32_t":
             return np.int32
+        if self.ctype == "uint16_t":
+            return np.uint16
+        if self.ctype == "uint32_t":
+            return np.uint32
         if self.ctype == "float":
             return np.float32
         raise RuntimeError("Unknown type: %s" % self.ctype)
@@ -157,6 +214,14 @@ class Argument(object):
         """ string to free up memory for the variable """
         return None
 
+    def offload_setup_str(self):
+        """ returns the string for setup the variable, when offloaded from the FC """
+        return self.run_test_setup_str()
+
+    def copy_back_str(self):
+        """ returns the string to copy the result back to L2, when offloaded from the FC """
+        return None
+
     def check_str(self, target):
         """ returns the string to check the result """
         return None
@@ -196,6 +261,11 @@ class Argument(object):
         # memory. Thus, always use 4 bytes for each scalar
         return 4
 
+    def data_bytes(self):
+        """ returns the number of bytes the function reads or writes through this argument """
+        # scalars are passed in registers
+        return 0
+
 
 class ArrayArgument(Argument):
     """Array Argument"""
@@ -296,7 +366,7 @@ class ArrayArgument(Argument):
         if callable(self.value):
             self.value = call_dynamic_function(self.value, env, version, device)
         if self.value == GENERATE_STIMULI:
-            self.value = call_dynamic_function(gen_stimuli, env, version, device, variable=self)
+            self.value = call_dynamic_function(gen_stimuli, env, version, device, argument=self)
         if isinstance(self.value, str):
             self.value = env[self.value]
         if self.value is None or (isinstance(self.value, (tuple, list)) and len(self.value) == 2):
@@ -338,6 +408,11 @@ class ArrayArgument(Argument):
         mem += 8 if "float" in self.ctype else 4
         return mem
 
+    def data_bytes(self):
+        """ returns the number of bytes the function reads or writes through this argument """
+        # every element is read (or written for an OutputArgument) once
+        return ctype_mem_size(self.ctype) * self.length
+
 
 class OutputArgument(ArrayArgument):
     """Output Array Argument"""
@@ -371,6 +446,34 @@ class OutputArgument(ArrayArgument):
     def reference_name(self):
         return self.name + "__reference"
 
+    def offload_setup_str(self):
+        """ returns the string for setup the variable, when offloaded from the FC """
+        # the output is only written (an InplaceArgument is reset from its original in do_bench)
+        if self.use_l1:
+            return dedent(
+                """\
+                {l1_name} = rt_alloc(RT_ALLOC_CL_DATA, sizeof({ctype}) * {len});
+                """
+            ).format(l1_name=self.name, ctype=self.ctype, len=self.length)
+        else:
+            return None
+
+    def copy_back_str(self):
+        """ returns the string to copy the result back to L2, when offloaded from the FC """
+        if self.use_l1:
+            return dedent(
+                """\
+                rt_dma_memcpy((unsigned int){l2_name},
+                              (unsigned int){l1_name},
+                              sizeof({ctype}) * {len},
+                              RT_DMA_DIR_LOC2EXT, 0, &copy);
+                rt_dma_wait(&copy);
+                """
+            ).format(l1_name=self.name, l2_name=self.l2_data_name(), ctype=self.ctype,
+                     len=self.length)
+        else:
+            return None
+
     def apply(self, env, var_type, version, use_l1, idx, device):
         """
         Prepare the variable for the specific test case. The following is done:
@@ -497,6 +600,11 @@ class InplaceArgument(OutputArgument):
         # of Output Argument, divide by 2 and multiply by 3.
         return (super(InplaceArgument, self).estimate_memory() // 2) * 3
 
+    def data_bytes(self):
+        """ returns the number of bytes the function reads or writes through this argument """
+        # every element is read and written once
+        return super(InplaceArgument, self).data_bytes() * 2
+
 
 class ReturnValue(Argument):
     """ result value """
@@ -630,7 +738,7 @@ class CustomArgument(Argument):
             return "t{}__{}".format(idx, name)
         self.name = arg_name(self.name)
         self.value = call_dynamic_function(self.value, env, version, device, use_l1=use_l1,
-                                           arg_name=arg_name)
+                                           arg_name=arg_name, var_type=var_type)
         return self
 
     def arg_str(self):
@@ -663,14 +771,39 @@ class CustomArgument(Argument):
 
 class AggregatedTestCase(object):
     """ Structure for one testcase in the aggregated tests """
-    def __init__(self, idx, arguments, env, n_ops, version, device_name):
-        """ constructor. Arguments must already be applied! """
+    def __init__(self, idx, arguments, env, n_ops, version, device_name, n_pe=None,
+                 placement=None, padding=None, dim_env=None, weight=None):
+        """
+        constructor. Arguments must already be applied! n_pe is the number of cores of this case
+        when sweeping the number of cores, and None otherwise. placement is the tuple of the names
+        of the arrays placed in L2 when sweeping the placement, and None otherwise. padding is
+        'none' or 'banks' when sweeping the padding, and None otherwise. dim_env is the environment
+        which describes the dimension of the case in the benchmark (default: env). weight is the
+        number of calls of this shape when replaying a shape profile, and None otherwise.
+        """
         self.idx = idx
         self.arguments = arguments
         self.env = env
         self.n_ops = n_ops
         self.version = version
         self.device_name = device_name
+        self.n_pe = n_pe
+        self.placement = placement
+        self.padding = padding
+        self.dim_env = env if dim_env is None else dim_env
+        self.weight = weight
+
+    def placement_str(self):
+        """ returns the placement of the arrays as "l2=<arrays in L2>", or None if not swept """
+        if self.placement is None:
+            return None
+        return "l2={}".format("+".join(self.placement) if self.placement else "-")
+
+    def padding_str(self):
+        """ returns the padding of the matrices as "pad=<none|banks>", or None if not swept """
+        if self.padding is None:
+            return None
+        return "pad={}".format(self.padding)
 
     def generate_header_content(self, gen_stimuli, gen_result):
         """ generate all stimuli values and compute the expected result """
@@ -710,15 +843,20 @@ class AggregatedTestCase(object):
                 // setup variables (like resetting InplaceArguments)
             {setup}
 
-                // start the performance counters
-                rt_perf_conf(perf, events);
-                rt_perf_reset(perf);
-                rt_perf_start(perf);
+                // start the performance counters (perf is NULL if the counters of all cores are
+                // configured by the caller)
+                if (perf != NULL) {{
+                    rt_perf_conf(perf, events);
+                    rt_perf_reset(perf);
+                    rt_perf_start(perf);
+                }}
 
                 // call the function-under-test
                 {ret_str}{fname}({args});
 
-                rt_perf_stop(perf);
+                if (perf != NULL) {{
+                    rt_perf_stop(perf);
+                }}
 
                 // check the result
                 int passed = 1;
@@ -741,11 +879,148 @@ class AggregatedTestCase(object):
                                          if arg.check_str(self.device_name) is not None]),
                               "        "))
 
+    def get_n_pe_str(self):
+        """ returns the name of the variable with the number of cores, or None if not parallel """
+        if self.device_name != "riscy":
+            return None
+        return ([a.arg_str() for a in self.arguments if isinstance(a, ParallelArgument)]
+                or [None])[0]
+
+    def get_core_bench_str(self):
+        """ returns the string of the run, which reads the counters of every core in the team """
+        n_pe = self.get_n_pe_str()
+        if n_pe is None:
+            return ""
+        return dedent(
+            """
+            // run 5: count active cycles and instructions on every core of the team. Idle cycles
+            // (waiting in a barrier or for the next fork) are not counted as active.
+            rt_team_fork({n_pe}, core_perf_start, NULL);
+            t{idx}__do_bench(NULL, 0, 0);
+            rt_team_fork({n_pe}, core_perf_stop, NULL);
+            printf("\\n#@# core_active:");
+            for (int i = 0; i < {n_pe}; i++) {{
+                printf(" %d", core_active[i]);
+            }}
+            printf("\\n#@# core_instr:");
+            for (int i = 0; i < {n_pe}; i++) {{
+                printf(" %d", core_instr[i]);
+            }}
+            printf("\\n");
+            """
+        ).format(idx=self.idx, n_pe=n_pe)
+
+    def get_repeat_bench_str(self):
+        """ returns the string of the run, which repeats the function to measure the jitter """
+        repeat = get_repeat()
+        if repeat is None:
+            return ""
+        return dedent(
+            """
+            // run 6: repeat the function for the minimum and maximum number of cycles
+            {{
+                int cycles_min = 0x7FFFFFFF;
+                int cycles_max = 0;
+                for (int i = 0; i < {repeat}; i++) {{
+                    t{idx}__do_bench(&perf, 1<<RT_PERF_CYCLES, 0);
+                    int cycles = rt_perf_read(RT_PERF_CYCLES);
+                    cycles_min = cycles < cycles_min ? cycles : cycles_min;
+                    cycles_max = cycles > cycles_max ? cycles : cycles_max;
+                }}
+                printf("\\n#@# cycles_min: %d\\n", cycles_min);
+                printf("#@# cycles_max: %d\\n", cycles_max);
+            }}
+            """
+        ).format(idx=self.idx, repeat=repeat)
+
     def get_run_test_function_call(self):
         return "t{}__run_test();".format(self.idx)
 
-    def get_run_test_function(self):
-        """ returns the run_test function for the current test """
+    def get_offload_entry_name(self):
+        return "t{}__offload_entry".format(self.idx)
+
+    def get_offload_entry_function(self):
+        """
+        returns the cluster entry of the offload measurement (see OFFLOAD_ENV). It moves the arrays
+        between L2 and L1 like an application would, and records the cycles of every step in
+        offload_stages.
+        """
+        return dedent(
+            """\
+            void {entry}(void *arg) {{
+                rt_dma_copy_t copy;
+                rt_perf_t perf;
+                rt_perf_init(&perf);
+                rt_perf_conf(&perf, 1<<RT_PERF_CYCLES);
+                rt_perf_reset(&perf);
+                rt_perf_start(&perf);
+
+                // copy the inputs from L2 to L1
+            {setup}
+                offload_stages[0] = rt_perf_read(RT_PERF_CYCLES);
+
+                // call the function-under-test
+                t{idx}__do_bench(NULL, 0, 0);
+                offload_stages[1] = rt_perf_read(RT_PERF_CYCLES);
+
+                // copy the outputs back to L2
+            {copy_back}
+                rt_perf_stop(&perf);
+                offload_stages[2] = rt_perf_read(RT_PERF_CYCLES);
+
+            {free}}}
+            """
+        ).format(idx=self.idx,
+                 entry=self.get_offload_entry_name(),
+                 setup=indent("\n".join([arg.offload_setup_str()
+                                         for arg in self.arguments
+                                         if arg.offload_setup_str() is not None]),
+                              "    "),
+                 copy_back=indent("\n".join([arg.copy_back_str()
+                                             for arg in self.arguments
+                                             if arg.copy_back_str() is not None]),
+                                  "    "),
+                 free=indent("".join([arg.run_test_free_str()
+                                      for arg in self.arguments
+                                      if arg.run_test_free_str() is not None]),
+                             "    "))
+
+    def get_offload_function(self):
+        """
+        returns the function on the FC, which powers up the cluster, runs the offload entry and
+        prints the cycles (see OFFLOAD_ENV)
+        """
+        return dedent(
+            """\
+            static void t{idx}__offload(void) {{
+                rt_perf_t perf;
+                rt_perf_init(&perf);
+                rt_perf_conf(&perf, 1<<RT_PERF_CYCLES);
+                rt_perf_reset(&perf);
+                rt_perf_start(&perf);
+                rt_cluster_mount(1, 0, 0, NULL);
+                int mount = rt_perf_read(RT_PERF_CYCLES);
+                rt_cluster_call(NULL, 0, {entry}, NULL, NULL, 0, 0, 0, NULL);
+                rt_perf_stop(&perf);
+                int total = rt_perf_read(RT_PERF_CYCLES);
+                rt_cluster_mount(0, 0, 0, NULL);
+
+                printf("\\n#@# offload {idx} {{\\n");
+                printf("#@# offload_mount: %d\\n", mount);
+                printf("#@# offload_cycles: %d\\n", total);
+                printf("#@# offload_stages: %d %d %d\\n", offload_stages[0],
+                       offload_stages[1] - offload_stages[0],
+                       offload_stages[2] - offload_stages[1]);
+                printf("\\n#@# }}\\n");
+            }}
+            """
+        ).format(idx=self.idx, entry=self.get_offload_entry_name())
+
+    def get_run_test_function(self, stages=False):
+        """
+        returns the run_test function for the current test. If stages is set, the cycles of every
+        stage (marked with test_stage in the sources of a pipeline) are recorded in run 1.
+        """
         return dedent(
             """\
             static void t{idx}__run_test(void) {{
@@ -761,10 +1036,10 @@ class AggregatedTestCase(object):
                 rt_perf_init(&perf);
 
                 // run 1: check result and get numebr of cycles / instructions
-                int passed = t{idx}__do_bench(&perf, (1<<RT_PERF_CYCLES) | (1<<RT_PERF_INSTR), 1);
+                {stages_start}int passed = t{idx}__do_bench(&perf, (1<<RT_PERF_CYCLES) | (1<<RT_PERF_INSTR), 1);
                 printf("\\n#@# passed: %d\\n", passed);
                 printf("#@# cycles: %d\\n", rt_perf_read(RT_PERF_CYCLES));
-                printf("#@# instructions: %d\\n", rt_perf_read(RT_PERF_INSTR));
+                printf("#@# instructions: %d\\n", rt_perf_read(RT_PERF_INSTR));{stages_end}
 
                 // run 2: count load stalls
                 t{idx}__do_bench(&perf, 1<<RT_PERF_LD_STALL, 0);
@@ -779,7 +1054,7 @@ class AggregatedTestCase(object):
                 t{idx}__do_bench(&perf, 1<<RT_PERF_TCDM_CONT, 0);
                 printf("\\n#@# output end\\n");
                 printf("#@# tcdm_cont: %d\\n", rt_perf_read(RT_PERF_TCDM_CONT));
-
+            {core_bench}{repeat_bench}
                 // free up all memory
             {free}
 
@@ -791,6 +1066,10 @@ class AggregatedTestCase(object):
                                          for arg in self.arguments
                                          if arg.run_test_setup_str() is not None]),
                               "    "),
+                 stages_start="test_stages_start();\n    " if stages else "",
+                 stages_end="\n    test_stages_print();" if stages else "",
+                 repeat_bench=indent(self.get_repeat_bench_str(), "    "),
+                 core_bench=indent(self.get_core_bench_str(), "    "),
                  free=indent("".join([arg.run_test_free_str()
                                       for arg in self.arguments
                                       if arg.run_test_free_str() is not None]),
@@ -820,6 +1099,14 @@ class AggregatedTestCase(object):
         """ returns an estimate of the number of bytes needed on L2 """
         return sum([arg.estimate_memory() for arg in self.arguments])
 
+    def data_bytes(self):
+        """
+        returns the number of bytes moved between the core and the memory by one call, assuming
+        that every element of every array argument is accessed once. Custom arguments (structs) are
+        not counted.
+        """
+        return sum([arg.data_bytes() for arg in self.arguments])
+
 
 class AggregatedTest(object):
     """ Test structure for aggregated tests
@@ -829,9 +1116,10 @@ class AggregatedTest(object):
     statically.
     """
     def __init__(self, function_name, version, arg_ret_type, arguments, variables, visible_env,
-                 device_name, use_l1, extended_output=True, n_ops=None):
+                 device_name, use_l1, extended_output=True, n_ops=None, sources=None, shape=None):
         """ Build an aggregated test. This will also apply all arguments for all versions """
         self.function_name = function_name
+        self.sources = sources or []
         self.version = version
         self.device_name = device_name
         self.extended_output = extended_output
@@ -841,8 +1129,9 @@ class AggregatedTest(object):
         # extend funciton name
         self.function_name += "_" + self.version
 
-        # set use_l1 to false for ibex
-        if self.device_name == "ibex":
+        # set use_l1 to false for ibex, and for the _l2 versions, which stream their operands from
+        # L2 through L1 themselves
+        if self.device_name == "ibex" or is_l2_version(version):
             use_l1 = False
 
         # set n_ops function
@@ -869,34 +1158,79 @@ class AggregatedTest(object):
             var_type = ['float', 'float']
 
         # arguments based on if fix-point and parallel is used
-        if not version.startswith('q') and not version.endswith('parallel'):
+        parallel = is_parallel_version(version)
+        if not version.startswith('q') and not parallel:
             arguments = [arg for arg in arguments
                          if not isinstance(arg, (FixPointArgument, ParallelArgument))]
-        if not version.startswith('q') and version.endswith('parallel'):
+        if not version.startswith('q') and parallel:
             arguments = [arg for arg in arguments if not isinstance(arg, FixPointArgument)]
-        if version.startswith('q') and not version.endswith('parallel'):
+        if version.startswith('q') and not parallel:
             arguments = [arg for arg in arguments if not isinstance(arg, ParallelArgument)]
-        if version.startswith('q') and version.endswith('parallel'):
+        if version.startswith('q') and parallel:
             arguments = arguments
 
         # check fixpoint stuff
         if version.startswith('q'):
             assert len([arg for arg in arguments if isinstance(arg, FixPointArgument)]) == 1
 
+        # sweep the number of cores of the parallel versions, if requested
+        n_pe_sweep = [None]
+        if parallel and self.device_name == "riscy":
+            n_pe_sweep = get_npe_sweep() or [None]
+
+        # sweep the placement of the arrays in L1 and L2, if requested
+        placement_sweep = [None]
+        if self.device_name == "riscy" and not is_l2_version(version):
+            placement_sweep = get_placement_sweep(arguments)
+
+        # sweep the padding of the strided matrices, if requested
+        padding_sweep = [None]
+        if self.device_name == "riscy":
+            padding_sweep = get_padding_sweep(variables)
+        sweep_variables = variables
+        if padding_sweep != [None]:
+            # the values of the PaddingVariables are replaced by the padding sweep
+            sweep_variables = [SweepVariable(var.name, var.values[:1], var.visible)
+                               if isinstance(var, PaddingVariable) else var
+                               for var in variables]
+
+        # replay the shapes of a profile instead of the sweep, if requested
+        shape_profile = get_shape_profile(self.function_name, self.device_name)
+        if shape_profile is None:
+            envs = [(env, None) for env in Sweep(sweep_variables, version)]
+        elif shape is None:
+            envs = []
+        else:
+            envs = [(replay_env(sweep_variables, version, shape, dims), calls)
+                    for dims, calls in shape_profile]
+
         # generate all aggregated tests
         self.cases = [
             AggregatedTestCase(
                 idx=i,
                 arguments=[
-                    deepcopy(arg).apply(env, var_type, self.version, use_l1, i, self.device_name)
+                    set_placement(set_npe(deepcopy(arg), n_pe), placement).apply(
+                        env, var_type, self.version, use_l1, i, self.device_name)
                     for arg in arguments
                 ],
                 env=env,
                 n_ops=self.n_ops(env),
                 version=self.version,
-                device_name=self.device_name
+                device_name=self.device_name,
+                n_pe=n_pe,
+                placement=placement,
+                padding=padding,
+                dim_env=dim_env,
+                weight=weight
             )
-            for (i, env) in enumerate(Sweep(variables, version))
+            for (i, (env, dim_env, n_pe, placement, padding, weight)) in enumerate(
+                (set_padding(env, variables, padding, var_type),
+                 set_padding(env, variables, None if padding is None else 'none', var_type),
+                 n_pe, placement, padding, weight)
+                for env, weight in envs
+                for n_pe in n_pe_sweep
+                for placement in placement_sweep
+                for padding in padding_sweep)
         ]
 
     def to_plptest(self):
@@ -956,6 +1290,100 @@ class AggregatedTest(object):
             """
         )
 
+    def get_core_perf_str(self):
+        """ returns the functions to read the performance counters of every core in the team """
+        return dedent(
+            """\
+            #ifndef ARCHI_CLUSTER_NB_PE
+            #define ARCHI_CLUSTER_NB_PE 8
+            #endif
+
+            static rt_perf_t core_perf[ARCHI_CLUSTER_NB_PE];
+            static int core_active[ARCHI_CLUSTER_NB_PE];
+            static int core_instr[ARCHI_CLUSTER_NB_PE];
+
+            static void core_perf_start(void *arg) {
+                rt_perf_t *perf = &core_perf[rt_core_id()];
+                rt_perf_init(perf);
+                rt_perf_conf(perf, (1<<RT_PERF_ACTIVE_CYCLES) | (1<<RT_PERF_INSTR));
+                rt_perf_reset(perf);
+                rt_perf_start(perf);
+            }
+
+            static void core_perf_stop(void *arg) {
+                int core_id = rt_core_id();
+                rt_perf_stop(&core_perf[core_id]);
+                core_active[core_id] = rt_perf_read(RT_PERF_ACTIVE_CYCLES);
+                core_instr[core_id] = rt_perf_read(RT_PERF_INSTR);
+            }
+            """
+        )
+
+    def get_stages_header_str(self):
+        """ returns the header, which the sources of a pipeline include to mark their stages """
+        return dedent(
+            """\
+            #ifndef __PULP_DSP_TEST__STAGES_H__
+            #define __PULP_DSP_TEST__STAGES_H__
+
+            // Marks the end of a stage of the function-under-test. The cycles since the end of the
+            // previous stage (or the start of the call) are reported as the cycles of this stage.
+            void test_stage(const char *name);
+
+            #endif//__PULP_DSP_TEST__STAGES_H__
+            """
+        )
+
+    def get_stages_str(self):
+        """ returns the functions to record the cycles of every stage, or "" without sources """
+        if not self.sources:
+            return ""
+        return "".join(["#include \"{}\"\n".format(source) for source in self.sources
+                        if source.endswith(".h")]) + dedent(
+            """\
+            #include "stages.h"
+
+            #define TEST_MAX_STAGES 16
+
+            static int test_stages_on = 0;
+            static int test_n_stages = 0;
+            static const char *test_stage_names[TEST_MAX_STAGES];
+            static int test_stage_cycles[TEST_MAX_STAGES];
+
+            void test_stage(const char *name) {
+                if (test_stages_on && test_n_stages < TEST_MAX_STAGES) {
+                    test_stage_cycles[test_n_stages] = rt_perf_read(RT_PERF_CYCLES);
+                    test_stage_names[test_n_stages] = name;
+                    test_n_stages++;
+                }
+            }
+
+            static void test_stages_start(void) {
+                test_n_stages = 0;
+                test_stages_on = 1;
+            }
+
+            static void test_stages_print(void) {
+                test_stages_on = 0;
+                printf("#@# stages:");
+                for (int i = 0; i < test_n_stages; i++) {
+                    printf(" %s=%d", test_stage_names[i],
+                           test_stage_cycles[i] - (i > 0 ? test_stage_cycles[i - 1] : 0));
+                }
+                printf("\\n");
+            }
+            """
+        )
+
+    def copy_sources(self):
+        """ copy the sources of a pipeline (next to testset.cfg) into the test folder """
+        if not self.sources:
+            return
+        with open(os.path.join(self.sub_folder, "stages.h"), "w") as fp:
+            fp.write(self.get_stages_header_str())
+        for source in self.sources:
+            shutil.copy(os.path.join(os.getcwd(), source), self.sub_folder)
+
     def get_main_imports(self, start, end):
         """ returns a string containing all imports of the test case headers """
         return "\n".join(["#include \"{}\"".format(case.get_header_filename())
@@ -1015,6 +1443,9 @@ class AggregatedTest(object):
             with open(os.path.join(self.sub_folder, case.get_header_filename()), "w") as fp:
                 fp.write(case.get_header_file_str(gen_stimuli, gen_result))
 
+        # copy the sources of the function-under-test, if it is part of the test
+        self.copy_sources()
+
         # next, generate the remaining test structure
         if self.device_name == "ibex":
             self.generate_ibex_test_program(start, end)
@@ -1036,6 +1467,8 @@ class AggregatedTest(object):
                     #include "common.h"
                     {includes}
 
+                    {stages}
+
                     {do_benchs}
 
                     {run_tests}
@@ -1048,18 +1481,23 @@ class AggregatedTest(object):
                     }}
                     """
                 ).format(includes=self.get_main_imports(start, end),
+                         stages=self.get_stages_str(),
                          test_entry=self.get_test_entry_function(start, end),
-                         run_tests="\n".join([case.get_run_test_function()
+                         run_tests="\n".join([case.get_run_test_function(bool(self.sources))
                                               for case in self.cases[start:end]]),
                          do_benchs="\n".join([case.get_do_bench_function(self.function_name)
                                               for case in self.cases[start:end]]))
             )
 
+        if is_host_platform():
+            self.generate_host_makefile(["test.c"])
+            return
+
         with open(os.path.join(self.sub_folder, "Makefile"), "w") as fp:
             fp.write(dedent(
                 """\
                 PULP_APP = test
-                PULP_APP_FC_SRCS = test.c
+                PULP_APP_FC_SRCS = test.c{sources}
                 PULP_LDFLAGS += -lplpdsp
                 PULP_CFLAGS += -I$(CONFIG_BUILD_DIR) -O3 -g
                 ifdef TFLAGS
@@ -1068,24 +1506,42 @@ class AggregatedTest(object):
                 include $(PULP_SDK_HOME)/install/rules/pulp_rt.mk
                 PULP_CFLAGS += -D DATA=$(CONFIG_BUILD_DIR)$(BUILD_DIR_EXT)
                 """
-            ))
+            ).format(sources="".join(" " + source for source in self.sources
+                                     if source.endswith(".c"))))
+
+    def get_offload_decl_str(self, start, end):
+        """ returns the declarations of the offload entries for cluster.h, or "" without offload """
+        if not get_offload():
+            return ""
+        return "extern int offload_stages[3];\n" + "".join(
+            ["void {}(void *arg);\n".format(case.get_offload_entry_name())
+             for case in self.cases[start:end]])
 
     def generate_riscy_test_program(self, start, end):
         """ generate all files needed for the riscy test """
+        offload = get_offload()
         with open(os.path.join(self.sub_folder, "test.c"), "w") as fp:
             fp.write(dedent(
                 """\
                 #include "rt/rt_api.h"
                 #include "stdio.h"
                 #include "cluster.h"
-                int main(){
+
+                {offloads}
+
+                int main(){{
                     rt_cluster_mount(1, 0, 0, NULL);
                     rt_cluster_call(NULL, 0, cluster_entry, NULL, NULL, 0, 0, 0, NULL);
                     rt_cluster_mount(0, 0, 0, NULL);
+                {offload_calls}
                     return 0;
-                }
+                }}
                 """
-            ))
+            ).format(offloads="\n".join([case.get_offload_function()
+                                          for case in self.cases[start:end]]) if offload else "",
+                     offload_calls=indent("\n".join(["t{}__offload();".format(case.idx)
+                                                     for case in self.cases[start:end]]),
+                                          "    ") if offload else ""))
 
         with open(os.path.join(self.sub_folder, "cluster.h"), "w") as fp:
             fp.write(dedent(
@@ -1093,9 +1549,9 @@ class AggregatedTest(object):
                 #ifndef __PULP_DSP_TEST__CLUSTER_H__
                 #define __PULP_DSP_TEST__CLUSTER_H__
                 void cluster_entry(void *arg);
-                #endif//__PULP_DSP_TEST__CLUSTER_H__
+                {offload_decl}#endif//__PULP_DSP_TEST__CLUSTER_H__
                 """
-            ))
+            ).format(offload_decl=self.get_offload_decl_str(start, end)))
 
         with open(os.path.join(self.sub_folder, "cluster.c"), "w") as fp:
             fp.write(
@@ -1105,9 +1561,14 @@ class AggregatedTest(object):
                     #include "stdio.h"
                     #include "plp_math.h"
 
+                    #include "cluster.h"
                     #include "common.h"
                     {includes}
 
+                    {core_perf}
+
+                    {stages}
+
                     {do_benchs}
 
                     {run_tests}
@@ -1117,21 +1578,33 @@ class AggregatedTest(object):
                     void cluster_entry(void* args) {{
                         test_entry();
                     }}
+
+                    {offload_entries}
                     """
                 ).format(includes=self.get_main_imports(start, end),
+                         core_perf=self.get_core_perf_str(),
+                         offload_entries="int offload_stages[3];\n\n"
+                                         + "\n".join([case.get_offload_entry_function()
+                                                      for case in self.cases[start:end]])
+                                         if offload else "",
+                         stages=self.get_stages_str(),
                          test_entry=self.get_test_entry_function(start, end),
-                         run_tests="\n".join([case.get_run_test_function()
+                         run_tests="\n".join([case.get_run_test_function(bool(self.sources))
                                               for case in self.cases[start:end]]),
                          do_benchs="\n".join([case.get_do_bench_function(self.function_name)
                                               for case in self.cases[start:end]]))
             )
 
+        if is_host_platform():
+            self.generate_host_makefile(["test.c", "cluster.c"])
+            return
+
         with open(os.path.join(self.sub_folder, "Makefile"), "w") as fp:
             fp.write(dedent(
                 """\
                 PULP_APP = test
                 PULP_APP_FC_SRCS = test.c
-                PULP_APP_CL_SRCS = cluster.c
+                PULP_APP_CL_SRCS = cluster.c{sources}
                 PULP_LDFLAGS += -lplpdsp
                 PULP_CFLAGS += -I$(CONFIG_BUILD_DIR) -O3 -g
                 ifdef TFLAGS
@@ -1140,7 +1613,176 @@ class AggregatedTest(object):
                 include $(PULP_SDK_HOME)/install/rules/pulp_rt.mk
                 PULP_CFLAGS += -D DATA=$(CONFIG_BUILD_DIR)$(BUILD_DIR_EXT)
                 """
-            ))
+            ).format(sources="".join(" " + source for source in self.sources
+                                     if source.endswith(".c"))))
+
+    def generate_host_makefile(self, test_sources):
+        """ generate the Makefile, which builds the test with the compiler of the host """
+        sources = test_sources + [source for source in self.sources if source.endswith(".c")]
+        with open(os.path.join(self.sub_folder, "Makefile"), "w") as fp:
+            fp.write(dedent(
+                """\
+                PLP_DSP_HOME = {home}
+                HOST_CC ?= gcc
+                HOST_CFLAGS ?= -m32 -O2 -g
+
+                all: test
+
+                test: {sources}
+                \t$(HOST_CC) $(HOST_CFLAGS) $(TFLAGS) -I. -I$(PLP_DSP_HOME)/host \\
+                \t\t-I$(PLP_DSP_HOME)/include $^ -L$(PLP_DSP_HOME)/lib/host -lplpdsp -lpthread -lm -o $@
+
+                run:
+                \t./test
+
+                clean:
+                \trm -f test
+                """
+            ).format(home=PLP_DSP_HOME, sources=" ".join(sources)))
+
+
+def is_host_platform():
+    """ returns True if the tests are built for the host instead of PULP (see HOST_PLATFORM) """
+    return os.environ.get("TEST_PLATFORM") == HOST_PLATFORM
+
+
+def is_l2_version(version):
+    """
+    returns True for the _l2 versions (e.g. i16_l2), which take their arrays in L2 and stream them
+    through L1 with the DMA. They have the same arguments as the _parallel versions.
+    """
+    return version.endswith('_l2')
+
+
+def is_parallel_version(version):
+    """ returns True if the version takes the number of cores (ParallelArgument) """
+    return version.endswith('parallel') or is_l2_version(version)
+
+
+def get_npe_sweep():
+    """ returns the list of core counts set in the environment variable NPE_SWEEP_ENV, or None """
+    if not os.environ.get(NPE_SWEEP_ENV):
+        return None
+    return [int(x) for x in os.environ[NPE_SWEEP_ENV].split(",") if x.strip()]
+
+
+def set_npe(arg, n_pe):
+    """ overwrites the value of a ParallelArgument with n_pe, unless n_pe is None """
+    if n_pe is not None and isinstance(arg, ParallelArgument):
+        arg.value = n_pe
+    return arg
+
+
+def get_placement_sweep(arguments):
+    """
+    returns the list of placements to test if PLACEMENT_SWEEP_ENV is set, or [None]. Every
+    placement is a tuple of the names of the arrays placed in L2: first none, then every array
+    alone, and finally all of them. Only arrays without an explicit use_l1 are moved.
+    """
+    if not os.environ.get(PLACEMENT_SWEEP_ENV):
+        return [None]
+    names = [arg.name for arg in arguments if isinstance(arg, ArrayArgument) and arg.use_l1 is None]
+    placements = [()] + [(name,) for name in names]
+    if len(names) > 1:
+        placements.append(tuple(names))
+    return placements
+
+
+def set_placement(arg, placement):
+    """ places an array argument in L2 if its name is in placement, and in L1 otherwise """
+    if placement is not None and isinstance(arg, ArrayArgument) and arg.use_l1 is None:
+        arg.use_l1 = arg.name not in placement
+    return arg
+
+
+def get_offload():
+    """ returns True if the cost of offloading to the cluster is measured (see OFFLOAD_ENV) """
+    return bool(os.environ.get(OFFLOAD_ENV))
+
+
+def get_shape_profile(function_name, device_name):
+    """
+    returns the list of shapes (dims, calls) of the function called on the device (the FC for ibex,
+    and the cluster for riscy) in the shape profile set in SHAPE_PROFILE_ENV, or None if it is not
+    set. Lines of other functions, the header and all other lines are skipped.
+    """
+    if not os.environ.get(SHAPE_PROFILE_ENV):
+        return None
+    device = "fc" if device_name == "ibex" else "cluster"
+    shapes = []
+    with open(os.environ[SHAPE_PROFILE_ENV], "r") as fp:
+        for line in fp:
+            parts = [x.strip() for x in line.split(",")]
+            if len(parts) != 6 or parts[0] != function_name or parts[1] != device:
+                continue
+            shapes.append(([int(x) for x in parts[2:5]], int(parts[5])))
+    return shapes
+
+
+def replay_env(variables, version, shape, dims):
+    """
+    returns the environment of a shape of the profile. The SweepVariables named in shape take the
+    dimensions recorded with PLP_PROFILE_SHAPE, in the same order. All other SweepVariables take
+    their first value, and the DynamicVariables are recomputed.
+    """
+    env = OrderedDict()
+    for var in variables:
+        if isinstance(var, SweepVariable):
+            env[var.name] = (dims[shape.index(var.name)] if var.name in shape
+                             else var.get_values(version)[0])
+        elif isinstance(var, DynamicVariable):
+            env[var.name] = var.fun(env)
+    return env
+
+
+def get_repeat():
+    """ returns the number of repetitions set in the environment variable REPEAT_ENV, or None """
+    if not os.environ.get(REPEAT_ENV):
+        return None
+    return int(os.environ[REPEAT_ENV])
+
+
+def padded_stride(cols, size):
+    """ returns the stride of plp_matrix_padded_stride, with an odd number of words """
+    words = (cols * size + 3) // 4
+    if words % 2 == 0:
+        words += 1
+    return words * 4 // size
+
+
+def get_padding_sweep(variables):
+    """
+    returns the list of paddings to test if PADDING_SWEEP_ENV is set and there is a
+    PaddingVariable, or [None]
+    """
+    if not os.environ.get(PADDING_SWEEP_ENV):
+        return [None]
+    if not any(isinstance(var, PaddingVariable) for var in variables):
+        return [None]
+    return ['none', 'banks']
+
+
+def set_padding(env, variables, padding, var_type):
+    """
+    returns the environment with all PaddingVariables set to padding ('none' or 'banks'), and all
+    DynamicVariables recomputed. If padding is None, env is returned unchanged.
+    """
+    if padding is None:
+        return env
+    padded_env = OrderedDict()
+    for var in variables:
+        if isinstance(var, PaddingVariable):
+            cols = padded_env[var.cols]
+            ctype = {'var_type': var_type[0], 'ret_type': var_type[1]}.get(var.ctype, var.ctype)
+            if padding == 'banks':
+                padded_env[var.name] = padded_stride(cols, ctype_mem_size(ctype)) - cols
+            else:
+                padded_env[var.name] = 0
+        elif isinstance(var, SweepVariable):
+            padded_env[var.name] = env[var.name]
+        elif isinstance(var, DynamicVariable):
+            padded_env[var.name] = var.fun(padded_env)
+    return padded_env
 
 
 def generate_test_program(_config, _output, test_obj, start, end):
@@ -1202,7 +1844,26 @@ def check_output(config, output, test_obj):
             else:
                 status = '\033[91mFAIL:\033[0m'
         print("{} {}".format(status, ", ".join(["{}={}".format(k, case.env[k])
-                                                for k in test_obj.visible_env])))
+                                                for k in test_obj.visible_env]
+                                               + (["nPE={}".format(case.n_pe)]
+                                                  if case.n_pe is not None else [])
+                                               + ([case.placement_str()]
+                                                  if case.placement is not None else [])
+                                               + ([case.padding_str()]
+                                                  if case.padding is not None else []))))
+        # print the cycles of every stage of a pipeline
+        if result['stages']:
+            print("      cycles: {} (total: {})".format(
+                ", ".join(["{}={}".format(k, v) for k, v in result['stages']]), result['cycles']))
+        # print the latency of the repeated calls
+        if result['cycles_max'] is not None:
+            cycles_min, cycles_max = cycles_range(result)
+            print("      latency: min={}, max={}, jitter={}".format(cycles_min, cycles_max,
+                                                                  cycles_max - cycles_min))
+        # print the cost of offloading the case from the FC
+        if result['offload_cycles']:
+            print("      offload: mount={}, dma_in={}, compute={}, dma_out={}, total={}".format(
+                result['offload_mount'], *result['offload_stages'], result['offload_cycles']))
         # print error messages
         if result['error_msg']:
             err = "\033[1m%s\033[0m" % err
@@ -1260,15 +1921,30 @@ def parse_output(output):
                           'error_msg': None,
                           'user_msg': [],
                           'cycles': 0,
+                          'cycles_min': None,
+                          'cycles_max': None,
                           'instructions': 0,
                           'load_stalls': 0,
                           'icache_miss': 0,
                           'tcdm_cont': 0,
+                          'core_active': [],
+                          'core_instr': [],
+                          'stages': [],
+                          'offload_cycles': 0,
+                          'offload_mount': 0,
+                          'offload_stages': [0, 0, 0],
                           'mismatches': []})
+        elif line.startswith("#@# offload ") and line.endswith("{"):
+            current_case = int(line[len("#@# offload "):-len(" {")])
+            assert current_case < len(cases)
         elif line.startswith('#@# passed:'):
             cases[current_case]['passed'] = line.find('1') != -1
-        elif line.startswith('#@# cycles'):
+        elif line.startswith('#@# cycles:'):
             cases[current_case]['cycles'] = int(line.split(": ")[1])
+        elif line.startswith('#@# cycles_min:'):
+            cases[current_case]['cycles_min'] = int(line.split(": ")[1])
+        elif line.startswith('#@# cycles_max:'):
+            cases[current_case]['cycles_max'] = int(line.split(": ")[1])
         elif line.startswith('#@# instructions'):
             cases[current_case]['instructions'] = int(line.split(": ")[1])
         elif line.startswith('#@# load_stalls'):
@@ -1277,6 +1953,19 @@ def parse_output(output):
             cases[current_case]['icache_miss'] = int(line.split(": ")[1])
         elif line.startswith('#@# tcdm_cont'):
             cases[current_case]['tcdm_cont'] = int(line.split(": ")[1])
+        elif line.startswith('#@# core_active:'):
+            cases[current_case]['core_active'] = [int(x) for x in line.split(":")[1].split()]
+        elif line.startswith('#@# core_instr:'):
+            cases[current_case]['core_instr'] = [int(x) for x in line.split(":")[1].split()]
+        elif line.startswith('#@# offload_mount:'):
+            cases[current_case]['offload_mount'] = int(line.split(": ")[1])
+        elif line.startswith('#@# offload_cycles:'):
+            cases[current_case]['offload_cycles'] = int(line.split(": ")[1])
+        elif line.startswith('#@# offload_stages:'):
+            cases[current_case]['offload_stages'] = [int(x) for x in line.split(":")[1].split()]
+        elif line.startswith('#@# stages:'):
+            cases[current_case]['stages'] = [(x.split("=")[0], int(x.split("=")[1]))
+                                             for x in line.split(":")[1].split()]
         elif line.startswith('#@# mismatch'):
             cases[current_case]['mismatches'].append("Mismatch: %s" % line[13:])
         elif "#@# output start" in line:
@@ -1301,19 +1990,37 @@ BENCHMARK_FILE = os.path.join(os.path.dirname(os.path.realpath(__file__)),
                               "bench_{}.csv".format(time.strftime("%Y-%m-%d_%H:%M:%S")))
 
 
+def cycles_range(performance):
+    """
+    returns the minimum and maximum cycles of a case: of the first and the repeated calls with
+    REPEAT_ENV, or of the first call only.
+    """
+    cycles = performance['cycles']
+    if performance['cycles_max'] is None:
+        return cycles, cycles
+    return min(cycles, performance['cycles_min']), max(cycles, performance['cycles_max'])
+
+
 def bench_output(performance, test_obj, test_case):
     # generate file and first header line if it does not yet exist
     if not os.path.isfile(BENCHMARK_FILE):
         # create file and write header
         with open(BENCHMARK_FILE, "w") as f:
             f.write(
-                "name,device,dimension,cycles,instructions,ipc,imiss,ld_stall,tcdm_cont,ops,mpc\n"
+                "name,device,dimension,cycles,instructions,ipc,imiss,ld_stall,tcdm_cont,ops,mpc,"
+                "cores,core_active,core_instr,bytes,bpc,cycles_min,cycles_max,offload_cycles,"
+                "offload_mount,offload_dma_in,offload_compute,offload_dma_out,weight\n"
             )
 
     # extract relevant fields
-    dimension = "; ".join(["%s=%s" % (k, str(test_case.env[k])) for k in test_obj.visible_env])
+    dimension = "; ".join(["%s=%s" % (k, str(test_case.dim_env[k])) for k in test_obj.visible_env]
+                          + ([test_case.placement_str()] if test_case.placement is not None else [])
+                          + ([test_case.padding_str()] if test_case.padding is not None else []))
     insn_per_cycles = performance['instructions'] / performance['cycles']
     ops_per_cycle = test_case.n_ops / performance['cycles']
+    data_bytes = test_case.data_bytes()
+    bytes_per_cycle = data_bytes / performance['cycles']
+    cycles_min, cycles_max = cycles_range(performance)
     # write the new line
     with open(BENCHMARK_FILE, "a") as f:
         f.write(",".join([test_obj.function_name,
@@ -1326,15 +2033,38 @@ def bench_output(performance, test_obj, test_case):
                           str(performance['load_stalls']),
                           str(performance['tcdm_cont']),
                           str(test_case.n_ops),
-                          str(ops_per_cycle)]))
+                          str(ops_per_cycle),
+                          str(max(len(performance['core_active']), 1)),
+                          " ".join([str(x) for x in performance['core_active']]),
+                          " ".join([str(x) for x in performance['core_instr']]),
+                          str(data_bytes),
+                          str(bytes_per_cycle),
+                          str(cycles_min),
+                          str(cycles_max),
+                          str(performance['offload_cycles']),
+                          str(performance['offload_mount'])]
+                         + [str(x) for x in performance['offload_stages']]
+                         + [str(test_case.weight if test_case.weight is not None else 1)]))
         f.write("\n")
+        # every stage of a pipeline is written as a separate line, named <function>.<stage>, which
+        # only contains the cycles.
+        for stage, cycles in performance['stages']:
+            f.write(",".join(["{}.{}".format(test_obj.function_name, stage),
+                              test_obj.device_name,
+                              dimension,
+                              str(cycles),
+                              "0", "0", "0", "0", "0", "0", "0", "1", "", "", "0", "0",
+                              str(cycles), str(cycles), "0", "0", "0", "0", "0",
+                              str(test_case.weight if test_case.weight is not None else 1)]))
+            f.write("\n")
 
 
 class Sweep:
     """ Iterator over all variables and returns the environment"""
     def __init__(self, variables, version):
         self.variables = variables
-        self.prod_iter = product(*[v.values if v.active(version) else [v.values[0]]
+        self.prod_iter = product(*[v.get_values(version) if v.active(version)
+                                   else [v.get_values(version)[0]]
                                    for v in self.variables
                                    if isinstance(v, SweepVariable)])
 
@@ -1519,23 +2249,30 @@ def tolerance_check_str(acq, exp, tolerance, ctype, indent, target):
 
 
 def generate_test(function_name, arguments, variables, implemented, use_l1=False,
-                  extended_output=True, n_ops=None, arg_ret_type=None):
+                  extended_output=True, n_ops=None, arg_ret_type=None, sources=None, shape=None):
     """ Entry-Point of the phase 1 """
     testsets = [
         Testset(
             name=device_name,
             tests=[
-                AggregatedTest(function_name=function_name,
-                               version=v,
-                               arg_ret_type=arg_ret_type,
-                               arguments=arguments,
-                               variables=variables,
-                               visible_env=[var.name for var in variables if var.visible and var.active(v)],
-                               device_name=device_name,
-                               use_l1=use_l1,
-                               extended_output=extended_output,
-                               n_ops=n_ops).to_plptest()
-                for v in impl if impl[v]
+                test.to_plptest()
+                for test in [
+                    AggregatedTest(function_name=function_name,
+                                   version=v,
+                                   arg_ret_type=arg_ret_type,
+                                   arguments=arguments,
+                                   variables=variables,
+                                   visible_env=[var.name for var in variables if var.visible and var.active(v)],
+                                   device_name=device_name,
+                                   use_l1=use_l1,
+                                   extended_output=extended_output,
+                                   n_ops=n_ops,
+                                   sources=sources,
+                                   shape=shape)
+                    for v in impl if impl[v]
+                ]
+                # without cases, the function was not called in the replayed shape profile
+                if test.cases
             ]
         )
         for device_name, impl in implemented.items()
@@ -1544,7 +2281,8 @@ def generate_test(function_name, arguments, variables, implemented, use_l1=False
     return {'testsets': testsets}
 
 
-def call_dynamic_function(f, env, version, device, arg_name=None, argument=None, use_l1=None):
+def call_dynamic_function(f, env, version, device, arg_name=None, argument=None, use_l1=None,
+                          var_type=None):
     """ Calls the funciton f and passes env, version, device or var_types, based on the arguments of
     the function """
     possible_args = {
@@ -1580,14 +2318,20 @@ def call_dynamic_function(f, env, version, device, arg_name=None, argument=None,
             'argument': (argument, "arg_name: F: str -> str"),
         })
 
+    if var_type is not None:
+        possible_args.update({
+            'var_type': (var_type, "var_type: tuple(str, str)"),
+        })
+
     if use_l1 is not None:
         possible_args.update({
             'l1': (argument, "use_l1: bool"),
             'use_l1': (argument, "use_l1: bool"),
         })
 
-    # __code__.co_varnames returns the list of argument names of the function
-    arg_list = f.__code__.co_varnames
+    # __code__.co_varnames returns the list of argument names of the function, followed by its
+    # local variables
+    arg_list = f.__code__.co_varnames[:f.__code__.co_argcount]
 
     if not set(arg_list).issubset(possible_args.keys()):
         valid_options = "\n".join(["{:11} -> {}".format(k, v[1]) for k, v in sorted(
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+####################
+# generate_stimuli #
+####################
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    if arg.name.endswith("pFilter"):
+        h = prototype_filter(env['taps'], env['filter'])
+        if arg.ctype == 'float':
+            return np.array(h).astype(np.float32)
+        return np.array([clip16(int(round(x * 2**15))) for x in h]).astype(np.int16)
+    raise RuntimeError("No stimuli for argument: %s" % arg.name)
+
+
+def prototype_filter(taps, kind):
+    """
+    Returns the lowpass prototype filter, whose coefficients sum up to 1.
+
+    lowpass: Hamming windowed half-band filter, which reconstructs its input only approximately.
+    pr: h[0] = h[taps-1] = 1/2, which reconstructs its input exactly, delayed by taps-2 samples.
+    """
+    if kind == 'pr':
+        return [0.5] + [0.0] * (taps - 2) + [0.5]
+    h = []
+    for n in range(taps):
+        t = (n - (taps - 1) / 2) / 2
+        sinc = 1.0 if t == 0 else np.sin(np.pi * t) / (np.pi * t)
+        h.append(sinc * (0.54 - 0.46 * np.cos(2 * np.pi * n / (taps - 1))))
+    return [x / sum(h) for x in h]
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The blocks form one stream, hence both the analysis and the synthesis are computed on the
+    # whole stream, and the bands are split into blocks afterwards. The fixed-point version is bit
+    # exact. With the pr filter, the expected output is the input delayed by the delay of the tree,
+    # which checks (2^numLevels - 1)*(numTaps - 2).
+
+    ctype = inputs['pSrc'].ctype
+    if ctype == 'int16_t':
+        my_type, fixed = np.int16, True
+    elif ctype == 'float':
+        my_type, fixed = np.float32, False
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    h = [int(x) if fixed else float(x) for x in inputs['pFilter'].value]
+    x = [int(v) if fixed else float(v) for v in inputs['pSrc'].value]
+    levels = env['levels']
+    n = env['len']
+
+    if 'pDst' in result_parameter.name and env['filter'] == 'pr':
+        delay = (2**levels - 1) * (env['taps'] - 2)
+        return np.array([0] * delay + x[:len(x) - delay]).astype(my_type)
+
+    # analysis: bands[0] is the lowest band, bands[l+1] the upper band of level levels-1-l
+    bands = []
+    low = x
+    for _ in range(levels):
+        low, high = qmf_analysis(h, low, fixed)
+        bands.insert(0, high)
+    bands.insert(0, low)
+
+    if 'pBands' in result_parameter.name:
+        # every block stores its part of the bands from the lowest to the highest frequency
+        result = []
+        for b in range(env['blocks']):
+            for band in bands:
+                m = len(band) // env['blocks']
+                result += band[b * m:(b + 1) * m]
+        return np.array(result).astype(my_type)
+
+    # synthesis: the upper band of level l is delayed by the levels below it
+    g = env['taps'] - 2
+    low = bands[0]
+    for l in reversed(range(levels)):
+        high = bands[levels - l]
+        d = g * (2**(levels - 1 - l) - 1)
+        high = [0] * d + high[:len(high) - d]
+        low = qmf_synthesis(h, low, high, fixed)
+    return np.array(low).astype(my_type)
+
+
+def qmf_analysis(h, x, fixed):
+    """ plp_qmf_analysis: both bands of the stream x, the upper band with (-1)^l * h[l] """
+    low, high = [], []
+    for r in range(len(x) // 2):
+        e = [0, 0]
+        for l in range(len(h)):
+            i = 2 * r + 1 - l
+            if i >= 0:
+                e[l % 2] += h[l] * x[i]
+        if fixed:
+            low.append(clip16(roundnorm(e[0] + e[1], 15)))
+            high.append(clip16(roundnorm(e[0] - e[1], 15)))
+        else:
+            low.append(e[0] + e[1])
+            high.append(e[0] - e[1])
+    return low, high
+
+
+def qmf_synthesis(h, a, b, fixed):
+    """ plp_qmf_synthesis: the stream of the lower band a and the upper band b """
+    if fixed:
+        d = [clip16(a[r] - b[r]) for r in range(len(a))]
+        s = [clip16(a[r] + b[r]) for r in range(len(a))]
+    else:
+        d = [a[r] - b[r] for r in range(len(a))]
+        s = [a[r] + b[r] for r in range(len(a))]
+    y = []
+    for r in range(len(a)):
+        y0 = sum([h[2 * t] * d[r - t] for t in range(len(h) // 2) if r >= t])
+        y1 = sum([h[2 * t + 1] * s[r - t] for t in range(len(h) // 2) if r >= t])
+        if fixed:
+            y += [clip16(roundnorm(y0, 14)), clip16(roundnorm(y1, 14))]
+        else:
+            y += [2 * y0, 2 * y1]
+    return y
+
+
+def roundnorm(x, shift):
+    return (x + ((1 << shift) >> 1)) >> shift
+
+
+def clip16(x):
+    return min(max(x, -2**15), 2**15 - 1)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,247 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        qmf.c
+ * Description:  QMF bank test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "qmf.h"
+
+/** Largest number of levels of the tree, which the drivers support */
+#define QMF_MAX_LEVELS 4
+
+/**
+  @brief      Runs the analysis and the synthesis of every block with 16-bit fixed-point samples.
+
+  A single level uses plp_qmf_init_q16, plp_qmf_analysis_q16 and plp_qmf_synthesis_q16, more
+  levels use the tree functions. The analysis and the synthesis have their own instance, whose
+  delay lines carry over from one block to the next, such that the blocks form one stream. The
+  synthesis gets the bands of the analysis, hence pDst is the input delayed by
+  (2^numLevels - 1)*(numTaps-2) samples, if the prototype filter reconstructs its input.
+
+  @param[in]  pFilter    points to the coefficients of the lowpass prototype filter in Q1.15
+  @param[in]  numTaps    number of coefficients of the prototype filter, even
+  @param[in]  numLevels  number of levels of the tree, between 1 and QMF_MAX_LEVELS
+  @param[in]  pSrc       points to the numBlocks*blockSize input samples in Q1.15
+  @param[in]  numBlocks  number of blocks
+  @param[in]  blockSize  number of samples per block, a multiple of 2^numLevels
+  @param[in]  pWork      points to the buffers of both instances, see QMF_WORK_LEN
+  @param[in]  nPE        number of parallel processing units, or 0 for the serial functions
+  @param[out] pBands     points to the numBlocks*blockSize samples of the bands of all blocks
+  @param[out] pDst       points to the numBlocks*blockSize reconstructed samples
+  @return     none
+ */
+
+static void qmf_run_q16(const int16_t *pFilter,
+                        uint32_t numTaps,
+                        uint32_t numLevels,
+                        const int16_t *pSrc,
+                        uint32_t numBlocks,
+                        uint32_t blockSize,
+                        int16_t *pWork,
+                        uint32_t nPE,
+                        int16_t *pBands,
+                        int16_t *pDst) {
+
+    plp_qmf_instance_q16 stages[2 * QMF_MAX_LEVELS];
+    plp_qmf_tree_instance_q16 analysis, synthesis;
+    uint32_t b;
+    uint32_t N = blockSize;
+    uint32_t stateLen = QMF_STATE_LEN(numTaps, numLevels, blockSize);
+
+    int16_t *pCoeffs = pWork;
+    int16_t *pStateA = pCoeffs + numTaps;
+    int16_t *pStateS = pStateA + stateLen;
+    int16_t *pDelay = pStateS + stateLen;
+    int16_t *pScratch = pDelay + QMF_DELAY_LEN(numTaps, numLevels, blockSize);
+
+    if (numLevels == 0 || numLevels > QMF_MAX_LEVELS) {
+        printf("Error: unsupported number of levels!\n");
+        return;
+    }
+
+    if (numLevels == 1) {
+        plp_qmf_init_q16(&stages[0], pFilter, numTaps, pCoeffs, pStateA, N);
+        plp_qmf_init_q16(&stages[1], pFilter, numTaps, pCoeffs, pStateS, N);
+        for (b = 0; b < numBlocks; b++) {
+            const int16_t *pIn = pSrc + b * N;
+            int16_t *pLow = pBands + b * N;
+            int16_t *pHigh = pLow + (N >> 1);
+            if (nPE == 0) {
+                plp_qmf_analysis_q16(&stages[0], pIn, pLow, pHigh);
+                plp_qmf_synthesis_q16(&stages[1], pLow, pHigh, pDst + b * N);
+            } else {
+                plp_qmf_analysis_q16_parallel(&stages[0], pIn, nPE, pLow, pHigh);
+                plp_qmf_synthesis_q16_parallel(&stages[1], pLow, pHigh, nPE, pDst + b * N);
+            }
+        }
+        return;
+    }
+
+    plp_qmf_tree_init_q16(&analysis, &stages[0], numLevels, pFilter, numTaps, pCoeffs, pStateA,
+                          NULL, pScratch, N);
+    plp_qmf_tree_init_q16(&synthesis, &stages[numLevels], numLevels, pFilter, numTaps, pCoeffs,
+                          pStateS, pDelay, pScratch, N);
+    for (b = 0; b < numBlocks; b++) {
+        if (nPE == 0) {
+            plp_qmf_tree_analysis_q16(&analysis, pSrc + b * N, pBands + b * N);
+            plp_qmf_tree_synthesis_q16(&synthesis, pBands + b * N, pDst + b * N);
+        } else {
+            plp_qmf_tree_analysis_q16_parallel(&analysis, pSrc + b * N, nPE, pBands + b * N);
+            plp_qmf_tree_synthesis_q16_parallel(&synthesis, pBands + b * N, nPE, pDst + b * N);
+        }
+    }
+}
+
+/**
+  @brief      Runs the analysis and the synthesis of every block with 32-bit floating-point
+              samples, like qmf_run_q16.
+  @param[in]  pFilter    points to the coefficients of the lowpass prototype filter
+  @param[in]  numTaps    number of coefficients of the prototype filter, even
+  @param[in]  numLevels  number of levels of the tree, between 1 and QMF_MAX_LEVELS
+  @param[in]  pSrc       points to the numBlocks*blockSize input samples
+  @param[in]  numBlocks  number of blocks
+  @param[in]  blockSize  number of samples per block, a multiple of 2^numLevels
+  @param[in]  pWork      points to the buffers of both instances, see QMF_WORK_LEN
+  @param[in]  nPE        number of parallel processing units, or 0 for the serial functions
+  @param[out] pBands     points to the numBlocks*blockSize samples of the bands of all blocks
+  @param[out] pDst       points to the numBlocks*blockSize reconstructed samples
+  @return     none
+ */
+
+static void qmf_run_f32(const float32_t *pFilter,
+                        uint32_t numTaps,
+                        uint32_t numLevels,
+                        const float32_t *pSrc,
+                        uint32_t numBlocks,
+                        uint32_t blockSize,
+                        float32_t *pWork,
+                        uint32_t nPE,
+                        float32_t *pBands,
+                        float32_t *pDst) {
+
+    plp_qmf_instance_f32 stages[2 * QMF_MAX_LEVELS];
+    plp_qmf_tree_instance_f32 analysis, synthesis;
+    uint32_t b;
+    uint32_t N = blockSize;
+    uint32_t stateLen = QMF_STATE_LEN(numTaps, numLevels, blockSize);
+
+    float32_t *pCoeffs = pWork;
+    float32_t *pStateA = pCoeffs + numTaps;
+    float32_t *pStateS = pStateA + stateLen;
+    float32_t *pDelay = pStateS + stateLen;
+    float32_t *pScratch = pDelay + QMF_DELAY_LEN(numTaps, numLevels, blockSize);
+
+    if (numLevels == 0 || numLevels > QMF_MAX_LEVELS) {
+        printf("Error: unsupported number of levels!\n");
+        return;
+    }
+
+    if (numLevels == 1) {
+        plp_qmf_init_f32(&stages[0], pFilter, numTaps, pCoeffs, pStateA, N);
+        plp_qmf_init_f32(&stages[1], pFilter, numTaps, pCoeffs, pStateS, N);
+        for (b = 0; b < numBlocks; b++) {
+            const float32_t *pIn = pSrc + b * N;
+            float32_t *pLow = pBands + b * N;
+            float32_t *pHigh = pLow + (N >> 1);
+            if (nPE == 0) {
+                plp_qmf_analysis_f32(&stages[0], pIn, pLow, pHigh);
+                plp_qmf_synthesis_f32(&stages[1], pLow, pHigh, pDst + b * N);
+            } else {
+                plp_qmf_analysis_f32_parallel(&stages[0], pIn, nPE, pLow, pHigh);
+                plp_qmf_synthesis_f32_parallel(&stages[1], pLow, pHigh, nPE, pDst + b * N);
+            }
+        }
+        return;
+    }
+
+    plp_qmf_tree_init_f32(&analysis, &stages[0], numLevels, pFilter, numTaps, pCoeffs, pStateA,
+                          NULL, pScratch, N);
+    plp_qmf_tree_init_f32(&synthesis, &stages[numLevels], numLevels, pFilter, numTaps, pCoeffs,
+                          pStateS, pDelay, pScratch, N);
+    for (b = 0; b < numBlocks; b++) {
+        if (nPE == 0) {
+            plp_qmf_tree_analysis_f32(&analysis, pSrc + b * N, pBands + b * N);
+            plp_qmf_tree_synthesis_f32(&synthesis, pBands + b * N, pDst + b * N);
+        } else {
+            plp_qmf_tree_analysis_f32_parallel(&analysis, pSrc + b * N, nPE, pBands + b * N);
+            plp_qmf_tree_synthesis_f32_parallel(&synthesis, pBands + b * N, nPE, pDst + b * N);
+        }
+    }
+}
+
+void qmf_q16(const int16_t *pFilter,
+             uint32_t numTaps,
+             uint32_t numLevels,
+             const int16_t *pSrc,
+             uint32_t numBlocks,
+             uint32_t blockSize,
+             int16_t *pWork,
+             int16_t *pBands,
+             int16_t *pDst) {
+
+    qmf_run_q16(pFilter, numTaps, numLevels, pSrc, numBlocks, blockSize, pWork, 0, pBands, pDst);
+}
+
+void qmf_q16_parallel(const int16_t *pFilter,
+                      uint32_t numTaps,
+                      uint32_t numLevels,
+                      const int16_t *pSrc,
+                      uint32_t numBlocks,
+                      uint32_t blockSize,
+                      int16_t *pWork,
+                      uint32_t nPE,
+                      int16_t *pBands,
+                      int16_t *pDst) {
+
+    qmf_run_q16(pFilter, numTaps, numLevels, pSrc, numBlocks, blockSize, pWork, nPE, pBands, pDst);
+}
+
+void qmf_f32(const float32_t *pFilter,
+             uint32_t numTaps,
+             uint32_t numLevels,
+             const float32_t *pSrc,
+             uint32_t numBlocks,
+             uint32_t blockSize,
+             float32_t *pWork,
+             float32_t *pBands,
+             float32_t *pDst) {
+
+    qmf_run_f32(pFilter, numTaps, numLevels, pSrc, numBlocks, blockSize, pWork, 0, pBands, pDst);
+}
+
+void qmf_f32_parallel(const float32_t *pFilter,
+                      uint32_t numTaps,
+                      uint32_t numLevels,
+                      const float32_t *pSrc,
+                      uint32_t numBlocks,
+                      uint32_t blockSize,
+                      float32_t *pWork,
+                      uint32_t nPE,
+                      float32_t *pBands,
+                      float32_t *pDst) {
+
+    qmf_run_f32(pFilter, numTaps, numLevels, pSrc, numBlocks, blockSize, pWork, nPE, pBands, pDst);
+}
@@ -0,0 +1,152 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        qmf.h
+ * Description:  QMF bank test driver
+ *
+ * $Date:        15. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __QMF_H__
+#define __QMF_H__
+
+#include "plp_math.h"
+
+/** Number of values of the delay lines of one tree instance, see plp_qmf_tree_init_q16 */
+#define QMF_STATE_LEN(numTaps, numLevels, blockSize) \
+    ((numLevels) * ((numTaps)-2) + 2 * ((blockSize) - ((blockSize) >> (numLevels))))
+
+/** Number of values of the delay of the upper bands, see plp_qmf_tree_init_q16 */
+#define QMF_DELAY_LEN(numTaps, numLevels, blockSize)          \
+    (((numTaps)-2) * ((1 << (numLevels)) - 1 - (numLevels)) + \
+     (blockSize) - ((blockSize) >> ((numLevels)-1)))
+
+/**
+  Number of values of the work buffer: the coefficients, which both instances share, the delay lines
+  of the analysis and of the synthesis, the delay of the upper bands, and the scratch buffer, which
+  is only used within a call and therefore shared by the analysis and the synthesis.
+ */
+#define QMF_WORK_LEN(numTaps, numLevels, blockSize)                                         \
+    ((numTaps) + 2 * QMF_STATE_LEN(numTaps, numLevels, blockSize) +                         \
+     QMF_DELAY_LEN(numTaps, numLevels, blockSize) + 3 * (blockSize) / 4)
+
+/** -------------------------------------------------------
+    @brief      QMF analysis and synthesis of a stream of 16-bit fixed-point blocks.
+    @param[in]  pFilter    points to the coefficients of the lowpass prototype filter in Q1.15
+    @param[in]  numTaps    number of coefficients of the prototype filter, even
+    @param[in]  numLevels  number of levels of the tree, 1 for a single QMF bank
+    @param[in]  pSrc       points to the numBlocks*blockSize input samples in Q1.15
+    @param[in]  numBlocks  number of blocks
+    @param[in]  blockSize  number of samples per block, a multiple of 2^numLevels
+    @param[in]  pWork      points to the buffers of both instances, see QMF_WORK_LEN
+    @param[out] pBands     points to the numBlocks*blockSize samples of the bands of all blocks
+    @param[out] pDst       points to the numBlocks*blockSize reconstructed samples
+    @return     none
+*/
+
+void qmf_q16(const int16_t *pFilter,
+             uint32_t numTaps,
+             uint32_t numLevels,
+             const int16_t *pSrc,
+             uint32_t numBlocks,
+             uint32_t blockSize,
+             int16_t *pWork,
+             int16_t *pBands,
+             int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      Parallel QMF analysis and synthesis of a stream of 16-bit fixed-point blocks.
+    @param[in]  pFilter    points to the coefficients of the lowpass prototype filter in Q1.15
+    @param[in]  numTaps    number of coefficients of the prototype filter, even
+    @param[in]  numLevels  number of levels of the tree, 1 for a single QMF bank
+    @param[in]  pSrc       points to the numBlocks*blockSize input samples in Q1.15
+    @param[in]  numBlocks  number of blocks
+    @param[in]  blockSize  number of samples per block, a multiple of 2^numLevels
+    @param[in]  pWork      points to the buffers of both instances, see QMF_WORK_LEN
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pBands     points to the numBlocks*blockSize samples of the bands of all blocks
+    @param[out] pDst       points to the numBlocks*blockSize reconstructed samples
+    @return     none
+*/
+
+void qmf_q16_parallel(const int16_t *pFilter,
+                      uint32_t numTaps,
+                      uint32_t numLevels,
+                      const int16_t *pSrc,
+                      uint32_t numBlocks,
+                      uint32_t blockSize,
+                      int16_t *pWork,
+                      uint32_t nPE,
+                      int16_t *pBands,
+                      int16_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      QMF analysis and synthesis of a stream of 32-bit floating-point blocks.
+    @param[in]  pFilter    points to the coefficients of the lowpass prototype filter
+    @param[in]  numTaps    number of coefficients of the prototype filter, even
+    @param[in]  numLevels  number of levels of the tree, 1 for a single QMF bank
+    @param[in]  pSrc       points to the numBlocks*blockSize input samples
+    @param[in]  numBlocks  number of blocks
+    @param[in]  blockSize  number of samples per block, a multiple of 2^numLevels
+    @param[in]  pWork      points to the buffers of both instances, see QMF_WORK_LEN
+    @param[out] pBands     points to the numBlocks*blockSize samples of the bands of all blocks
+    @param[out] pDst       points to the numBlocks*blockSize reconstructed samples
+    @return     none
+*/
+
+void qmf_f32(const float32_t *pFilter,
+             uint32_t numTaps,
+             uint32_t numLevels,
+             const float32_t *pSrc,
+             uint32_t numBlocks,
+             uint32_t blockSize,
+             float32_t *pWork,
+             float32_t *pBands,
+             float32_t *pDst);
+
+/** -------------------------------------------------------
+    @brief      Parallel QMF analysis and synthesis of a stream of 32-bit floating-point blocks.
+    @param[in]  pFilter    points to the coefficients of the lowpass prototype filter
+    @param[in]  numTaps    number of coefficients of the prototype filter, even
+    @param[in]  numLevels  number of levels of the tree, 1 for a single QMF bank
+    @param[in]  pSrc       points to the numBlocks*blockSize input samples
+    @param[in]  numBlocks  number of blocks
+    @param[in]  blockSize  number of samples per block, a multiple of 2^numLevels
+    @param[in]  pWork      points to the buffers of both instances, see QMF_WORK_LEN
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pBands     points to the numBlocks*blockSize samples of the bands of all blocks
+    @param[out] pDst       points to the numBlocks*blockSize reconstructed samples
+    @return     none
+*/
+
+void qmf_f32_parallel(const float32_t *pFilter,
+                      uint32_t numTaps,
+                      uint32_t numLevels,
+                      const float32_t *pSrc,
+                      uint32_t numBlocks,
+                      uint32_t blockSize,
+                      float32_t *pWork,
+                      uint32_t nPE,
+                      float32_t *pBands,
+                      float32_t *pDst);
+
+#endif //__QMF_H__
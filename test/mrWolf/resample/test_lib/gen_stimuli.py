@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The state is cleared and the serial version only resamples the first channel. Output m uses
+    # the polyphase branch (m * M) % L and the input samples ending at (m * M) // L.
+
+    ctype = inputs['pSrc'].ctype
+    if ctype == 'int16_t':
+        my_type, my_bits, shift = np.int16, 16, 15
+    elif ctype == 'float':
+        my_type, my_bits, shift = np.float32, None, None
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    coeffs = inputs['pPhaseCoeffs'].value
+    src = inputs['pSrc'].value
+    P = env['phase_len']
+    L = env['L']
+    M = env['M']
+    length = env['len']
+    out_len = env['out_len']
+    n_channels = result_parameter.length // out_len
+
+    result = np.zeros(n_channels * out_len, dtype=my_type)
+    for c in range(n_channels):
+        data = src[c * length:(c + 1) * length]
+        for m in range(out_len):
+            n, j = divmod(m * M, L)
+            acc = np.float32(0) if my_bits is None else 0
+            for s in range(P):
+                i = n - (P - 1) + s
+                if i >= 0:
+                    if my_bits is None:
+                        acc += np.float32(coeffs[j * P + s]) * np.float32(data[i])
+                    else:
+                        acc += int(coeffs[j * P + s]) * int(data[i])
+            if my_bits is None:
+                result[c * out_len + m] = np.float32(acc)
+            else:
+                acc = (int(acc) + (1 << (shift - 1))) >> shift
+                result[c * out_len + m] = max(-2**(my_bits - 1), min(2**(my_bits - 1) - 1, acc))
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
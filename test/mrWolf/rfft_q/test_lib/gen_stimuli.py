@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # len=N: Q1.15 -> Q(1+log2(N)).(15-log2(N)) for q16, and Q1.31 -> Q(1+log2(N)).(31-log2(N))
+    # for q32. The output is packed: X[0], X[N/2], followed by re and im of X[k] for 0 < k < N/2.
+
+    ctype = inputs['pSrc'].ctype
+    if ctype == 'int32_t':
+        my_type = np.int32
+        my_fixpoint = 31
+    elif ctype == 'int16_t':
+        my_type = np.int16
+        my_fixpoint = 15
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    n = env['len']
+    a = inputs['pSrc'].value.astype(np.float64) / 2**my_fixpoint
+    spectrum = np.fft.rfft(a) * 2**(my_fixpoint - int(np.log2(n)))
+
+    result = np.zeros(n, dtype=np.float64)
+    result[0] = np.real(spectrum[0])
+    result[1] = np.real(spectrum[n // 2])
+    result[2::2] = np.real(spectrum[1:n // 2])
+    result[3::2] = np.imag(spectrum[1:n // 2])
+
+    return np.round(result).astype(my_type)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
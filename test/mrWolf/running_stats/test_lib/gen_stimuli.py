@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # the window starts out filled with zeros and holds the last samples after the update
+    n = env['window']
+    p = [0] * n + [int(x) if fix_point is not None else float(x) for x in inputs['pSrc'].value]
+    p = p[-n:]
+
+    if result_parameter.ctype == 'float':
+        p = np.array(p, dtype=np.float64)
+        mean = np.mean(p)
+        rms = np.mean(p * p)
+        var = max(rms - mean * mean, 0.0)
+        result = {'pMean': mean, 'pVar': var, 'pRms': rms}[result_parameter.name]
+        return np.array([result], dtype=np.float32)
+
+    s1 = sum(p)
+    mean = c_div(s1, n)
+    if result_parameter.ctype == 'int16_t':
+        # exact integer moments
+        s2 = sum(x * x for x in p)
+        var = c_div(s2 - mean * s1 - c_div((s1 - mean * n) * s1, n), n) >> fix_point
+        rms = c_div(s2, n) >> fix_point
+        dtype = np.int16
+    elif result_parameter.ctype == 'int32_t':
+        # every square is truncated before it is summed
+        s2 = sum((x * x) >> fix_point for x in p)
+        rms = c_div(s2, n)
+        var = max(rms - ((mean * mean) >> fix_point), 0)
+        dtype = np.int32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    result = {'pMean': mean, 'pVar': var, 'pRms': rms}[result_parameter.name]
+    return np.array([result]).astype(dtype)
+
+
+def c_div(a, b):
+    """ Integer division rounding towards zero, as in C """
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
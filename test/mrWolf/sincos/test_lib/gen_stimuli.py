@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    fn = np.sin if result_parameter.name == 'pSin' else np.cos
+    x = inputs['x'].value
+    if result_parameter.ctype == 'float':
+        return np.array([fn(np.float32(x))], dtype=np.float32)
+
+    if result_parameter.ctype == 'int16_t':
+        dtype, bits = np.int16, 16
+    elif result_parameter.ctype == 'int32_t':
+        dtype, bits = np.int32, 32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    # the input range [-1, 1) wraps around one period
+    in_rad = 2 * np.pi * float(x) / 2**(bits - 1)
+    result = np.round(2**(bits - 1) * fn(in_rad))
+    return np.array([np.clip(result, -2**(bits - 1), 2**(bits - 1) - 1)]).astype(dtype)
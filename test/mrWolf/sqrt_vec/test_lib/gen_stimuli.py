@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # negative inputs return zero
+    x = inputs['pSrc'].value
+    if result_parameter.ctype == 'float':
+        return np.sqrt(np.maximum(x.astype(np.float32), 0)).astype(np.float32)
+
+    if result_parameter.ctype == 'int16_t':
+        dtype = np.int16
+    elif result_parameter.ctype == 'int32_t':
+        dtype = np.int32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    scale = 2.0**fix_point
+    return np.round(np.sqrt(np.maximum(x.astype(np.float64), 0) * scale)).astype(dtype)
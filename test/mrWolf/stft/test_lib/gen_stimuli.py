@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # the ring buffer starts out filled with zeros, frame f ends with sample (f+1)*hop-1 of pSrc.
+    # Every spectrum is in the packed format of plp_rfft_q16, scaled by 1/len.
+    n, hop = env['len'], env['hop']
+    stream = np.concatenate((np.zeros(n), inputs['pSrc'].value.astype(np.float64) / 2**15))
+
+    result = np.zeros(env['n_frames'] * n, dtype=np.float64)
+    for f in range(env['n_frames']):
+        start = (f + 1) * hop
+        spectrum = np.fft.rfft(stream[start:start + n]) * 2**(15 - int(np.log2(n)))
+        out = result[f * n:(f + 1) * n]
+        out[0] = np.real(spectrum[0])
+        out[1] = np.real(spectrum[n // 2])
+        out[2::2] = np.real(spectrum[1:n // 2])
+        out[3::2] = np.imag(spectrum[1:n // 2])
+
+    return np.round(result).astype(np.int16)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype in ('int8_t', 'int16_t'):
+        # only the saturating q versions write 8- and 16-bit results
+        my_type = np.int16 if result_parameter.ctype == 'int16_t' else np.int8
+        a = inputs['pSrcA'].value.astype(np.int32)
+        b = inputs['pSrcB'].value.astype(np.int32)
+        result = np.clip(a - b, np.iinfo(my_type).min, np.iinfo(my_type).max).astype(my_type)
+    elif result_parameter.ctype == 'int32_t':
+        a = inputs['pSrcA'].value.astype(np.int32)
+        b = inputs['pSrcB'].value.astype(np.int32)
+        result = np.subtract(a, b, dtype=np.int32)
+    elif result_parameter.ctype == 'float':
+        a = inputs['pSrcA'].value.astype(np.float32)
+        b = inputs['pSrcB'].value.astype(np.float32)
+        result = np.subtract(a, b, dtype=np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
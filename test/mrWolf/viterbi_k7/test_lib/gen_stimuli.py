@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # Must match the instance in testset.cfg. The serial version only decodes the first block. The
+    # path metrics follow the kernels exactly.
+
+    src = [int(v) for v in inputs['pSrc'].value]
+    length = env['len']
+    words = (length + 31) // 32
+    n_blocks = result_parameter.length // words
+
+    result = np.zeros(n_blocks * words, dtype=np.uint32)
+    for b in range(n_blocks):
+        bits = viterbi_k7(src[2 * b * length:2 * (b + 1) * length], 0o171, 0o133,
+                          env['terminated'])
+        for t, bit in enumerate(bits):
+            result[b * words + t // 32] |= np.uint32(bit << (t % 32))
+
+    return result
+
+
+def parity(x):
+    """ parity of the bits of x """
+    return bin(x).count('1') & 1
+
+
+def viterbi_k7(soft, poly0, poly1, terminated, shift=6, init=-8192):
+    """ decodes the soft values of one block, two per bit """
+    code = [parity((j << 1) & poly0) | (parity((j << 1) & poly1) << 1) for j in range(32)]
+    metric = [0] + [init] * 63
+    decisions = []
+    for t in range(len(soft) // 2):
+        s0 = soft[2 * t] >> shift
+        s1 = soft[2 * t + 1] >> shift
+        bm = [s0 + s1, s1 - s0, s0 - s1, -s0 - s1]
+        ref = metric[0]
+        new = [0] * 64
+        dec = [0] * 64
+        for j in range(32):
+            m = bm[code[j]]
+            a = metric[j] - ref
+            b = metric[j + 32] - ref
+            for k, (x, y) in enumerate([(a + m, b - m), (a - m, b + m)]):
+                new[2 * j + k] = max(x, y)
+                dec[2 * j + k] = 1 if y > x else 0
+        metric = new
+        decisions.append(dec)
+
+    state = 0
+    if not terminated:
+        state = metric.index(max(metric))
+
+    bits = [0] * len(decisions)
+    for t in reversed(range(len(decisions))):
+        bits[t] = state & 1
+        state = (state >> 1) | (decisions[t][state] << 5)
+    return bits